@@ -31,8 +31,49 @@ struct MaterialInput
 	float4 SvPosition;
 	float3 PreSkinnedPosition;
 	float3 PreSkinnedNormal;
+#if USE_INSTANCING
+	float4x4 InstanceWorld;
+#endif
+};
+
+#if USE_INSTANCING
+
+// Per-instance decal data (vertex shader input, see GBufferPass::DrawDecals)
+struct DecalInstance
+{
+	float3 Transform1 : ATTRIBUTE0;
+	float3 Transform2 : ATTRIBUTE1;
+	float3 Transform3 : ATTRIBUTE2;
+	float3 Origin : ATTRIBUTE3;
+	float3 InvTransform1 : ATTRIBUTE4;
+	float3 InvTransform2 : ATTRIBUTE5;
+	float3 InvTransform3 : ATTRIBUTE6;
+	float3 InvOrigin : ATTRIBUTE7;
+};
+
+// Per-instance decal data (passed to the pixel shader)
+struct DecalInstanceData
+{
+	nointerpolation float3 Transform1 : TEXCOORD0;
+	nointerpolation float3 Transform2 : TEXCOORD1;
+	nointerpolation float3 Transform3 : TEXCOORD2;
+	nointerpolation float3 Origin : TEXCOORD3;
+	nointerpolation float3 InvTransform1 : TEXCOORD4;
+	nointerpolation float3 InvTransform2 : TEXCOORD5;
+	nointerpolation float3 InvTransform3 : TEXCOORD6;
+	nointerpolation float3 InvOrigin : TEXCOORD7;
 };
 
+// Gets the local to world transform matrix (supports instancing)
+#define GetDecalWorld(input) input.InstanceWorld
+
+#else
+
+// Gets the local to world transform matrix (supports instancing)
+#define GetDecalWorld(input) WorldMatrix
+
+#endif
+
 // Transforms a vector from tangent space to world space
 float3 TransformTangentVectorToWorld(MaterialInput input, float3 tangentVector)
 {
@@ -60,21 +101,21 @@ float3 TransformViewVectorToWorld(MaterialInput input, float3 viewVector)
 // Transforms a vector from local space to world space
 float3 TransformLocalVectorToWorld(MaterialInput input, float3 localVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
 	return mul(localVector, localToWorld);
 }
 
 // Transforms a vector from local space to world space
 float3 TransformWorldVectorToLocal(MaterialInput input, float3 worldVector)
 {
-	float3x3 localToWorld = (float3x3)WorldMatrix;
+	float3x3 localToWorld = (float3x3)GetDecalWorld(input);
 	return mul(localToWorld, worldVector);
 }
 
 // Gets the current object position (supports instancing)
 float3 GetObjectPosition(MaterialInput input)
 {
-	return WorldMatrix[3].xyz;
+	return GetDecalWorld(input)[3].xyz;
 }
 
 // Gets the current object size
@@ -118,11 +159,43 @@ Material GetMaterialPS(MaterialInput input)
 
 // Vertex Shader function for decals rendering
 META_VS(true, FEATURE_LEVEL_ES2)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT, 0, 0, PER_VERTEX, 0, true)
-void VS_Decal(in float3 Position : POSITION0, out float4 SvPosition : SV_Position)
+META_PERMUTATION_1(USE_INSTANCING=0)
+META_PERMUTATION_1(USE_INSTANCING=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT, 0, 0,     PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(ATTRIBUTE,0, R32G32B32_FLOAT, 1, 0,     PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,1, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,2, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,3, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,4, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,5, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,6, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,7, R32G32B32_FLOAT, 1, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+void VS_Decal(
+	in float3 Position : POSITION0
+#if USE_INSTANCING
+	, in DecalInstance instance
+#endif
+	, out float4 SvPosition : SV_Position
+#if USE_INSTANCING
+	, out DecalInstanceData instanceData
+#endif
+	)
 {
 	// Compute world space vertex position
-	float3 worldPosition = mul(float4(Position.xyz, 1), WorldMatrix).xyz;
+#if USE_INSTANCING
+	float4x4 world = float4x4(float4(instance.Transform1, 0.0f), float4(instance.Transform2, 0.0f), float4(instance.Transform3, 0.0f), float4(instance.Origin, 1.0f));
+	instanceData.Transform1 = instance.Transform1;
+	instanceData.Transform2 = instance.Transform2;
+	instanceData.Transform3 = instance.Transform3;
+	instanceData.Origin = instance.Origin;
+	instanceData.InvTransform1 = instance.InvTransform1;
+	instanceData.InvTransform2 = instance.InvTransform2;
+	instanceData.InvTransform3 = instance.InvTransform3;
+	instanceData.InvOrigin = instance.InvOrigin;
+#else
+	float4x4 world = WorldMatrix;
+#endif
+	float3 worldPosition = mul(float4(Position.xyz, 1), world).xyz;
 
 	// Compute clip space position
 	SvPosition = mul(float4(worldPosition.xyz, 1), ViewProjectionMatrix);
@@ -130,8 +203,13 @@ void VS_Decal(in float3 Position : POSITION0, out float4 SvPosition : SV_Positio
 
 // Pixel Shader function for decals rendering
 META_PS(true, FEATURE_LEVEL_ES2)
+META_PERMUTATION_1(USE_INSTANCING=0)
+META_PERMUTATION_1(USE_INSTANCING=1)
 void PS_Decal(
 	in float4 SvPosition : SV_Position
+#if USE_INSTANCING
+	, in DecalInstanceData instanceData
+#endif
 	, out float4 Out0 : SV_Target0
 #if DECAL_BLEND_MODE == DECAL_BLEND_MODE_TRANSLUCENT
 	, out float4 Out1 : SV_Target1
@@ -149,7 +227,12 @@ void PS_Decal(
 
 	float4 positionHS = mul(float4(SvPosition.xyz, 1), SVPositionToWorld);
 	float3 positionWS = positionHS.xyz / positionHS.w;
-	float3 positionOS = mul(float4(positionWS, 1), InvWorld).xyz;
+#if USE_INSTANCING
+	float4x4 invWorld = float4x4(float4(instanceData.InvTransform1, 0.0f), float4(instanceData.InvTransform2, 0.0f), float4(instanceData.InvTransform3, 0.0f), float4(instanceData.InvOrigin, 1.0f));
+#else
+	float4x4 invWorld = InvWorld;
+#endif
+	float3 positionOS = mul(float4(positionWS, 1), invWorld).xyz;
 
 	clip(0.5 - abs(positionOS.xyz));
 	float2 decalUVs = positionOS.xz + 0.5f;
@@ -160,6 +243,9 @@ void PS_Decal(
 	materialInput.TexCoord = decalUVs;
 	materialInput.TwoSidedSign = 1;
 	materialInput.SvPosition = SvPosition;
+#if USE_INSTANCING
+	materialInput.InstanceWorld = float4x4(float4(instanceData.Transform1, 0.0f), float4(instanceData.Transform2, 0.0f), float4(instanceData.Transform3, 0.0f), float4(instanceData.Origin, 1.0f));
+#endif
 	
 	// Build tangent to world transformation matrix
 	float3 ddxWp = ddx(positionWS);
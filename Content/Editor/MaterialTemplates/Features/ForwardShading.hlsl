@@ -23,10 +23,18 @@ ExponentialHeightFogData ExponentialHeightFog;
 float3 Dummy2;
 uint LocalLightsCount;
 LightData LocalLights[MAX_LOCAL_LIGHTS];
+int3 LightGridSize;
+uint LightGridEnabled;
+float4 LightGridParams;
 @3// Forward Shading: Resources
 TextureCube EnvProbe : register(t__SRV__);
 TextureCube SkyLightTexture : register(t__SRV__);
 Texture2DArray DirectionalLightShadowMap : register(t__SRV__);
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+StructuredBuffer<LightData> LightGridLights : register(t__SRV__);
+Buffer<uint2> LightGridCells : register(t__SRV__);
+Buffer<uint> LightGridIndices : register(t__SRV__);
+#endif
 @4// Forward Shading: Utilities
 DECLARE_LIGHTSHADOWDATA_ACCESS(DirectionalLightShadow);
 @5// Forward Shading: Shaders
@@ -91,6 +99,26 @@ void PS_Forward(
 	light += GetSkyLightLighting(SkyLight, gBuffer, SkyLightTexture);
 
 	// Calculate lighting from local lights
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+	BRANCH
+	if (LightGridEnabled)
+	{
+		// Clustered lights grid (screen tile and exponential depth slice)
+		int3 cellCoord;
+		cellCoord.xy = (int2)(materialInput.SvPosition.xy * LightGridParams.x);
+		cellCoord.z = (int)(log2(max(gBuffer.ViewPos.z, 0.0001f)) * LightGridParams.y + LightGridParams.z);
+		cellCoord = clamp(cellCoord, 0, LightGridSize - 1);
+		uint2 cell = LightGridCells[(cellCoord.z * LightGridSize.y + cellCoord.y) * LightGridSize.x + cellCoord.x];
+		LOOP
+		for (uint cellLightIndex = 0; cellLightIndex < cell.y; cellLightIndex++)
+		{
+			const LightData localLight = LightGridLights[LightGridIndices[cell.x + cellLightIndex]];
+			bool isSpotLight = localLight.SpotAngles.x > -2.0f;
+			shadowMask = 1.0f;
+			light += GetLighting(ViewPos, localLight, gBuffer, shadowMask, true, isSpotLight);
+		}
+	}
+#endif
 	LOOP
 	for (uint localLightIndex = 0; localLightIndex < LocalLightsCount; localLightIndex++)
 	{
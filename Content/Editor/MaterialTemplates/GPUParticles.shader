@@ -176,3 +176,16 @@ void CS_Main(uint3 dispatchThreadId : SV_DispatchThreadID)
 		SpawnParticle(context);
 	}
 }
+
+// The indirect dispatch arguments generated from the particles counter (x: thread groups for the simulation of the live and spawned particles)
+RWByteAddressBuffer DispatchArgs : register(u1);
+
+// Shader for the simulation dispatch arguments generation (executed before CS_Main with a single thread)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_DispatchArgs()
+{
+	uint particlesCount = min(SrcParticlesData.Load(ParticleCounterOffset), PARTICLE_CAPACITY);
+	uint threadGroups = min((particlesCount + SpawnCount + THREAD_GROUP_SIZE - 1) / THREAD_GROUP_SIZE, 65535);
+	DispatchArgs.Store3(0, uint3(threadGroups, 1, 1));
+}
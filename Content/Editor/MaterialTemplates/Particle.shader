@@ -609,7 +609,8 @@ VertexOutput VS_Ribbon(RibbonInput input, uint vertexIndex : SV_VertexID)
 	}
 	else
 	{
-		output.TexCoord.x = (float)input.Order / (float)RibbonSegmentCount;
+		// Ribbons generated on a GPU store the normalized texture coordinate in the distance
+		output.TexCoord.x = RibbonSegmentCount != 0 ? (float)input.Order / (float)RibbonSegmentCount : input.Distance;
 	}
 	output.TexCoord.y = (vertexIndex + 1) & 0x1;
 	output.TexCoord = output.TexCoord * RibbonUVScale + RibbonUVOffset;
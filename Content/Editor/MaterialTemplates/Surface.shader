@@ -12,11 +12,12 @@
 META_CB_BEGIN(0, Data)
 float4x4 WorldMatrix;
 float4x4 PrevWorldMatrix;
-float2 Dummy0;
+float3 GeometryOrigin;
 float LODDitherFactor;
-float PerInstanceRandom;
 float3 GeometrySize;
 float WorldDeterminantSign;
+float PerInstanceRandom;
+float3 Dummy0;
 @1META_CB_END
 
 // Shader resources
@@ -300,6 +301,12 @@ float3x3 CalcTangentToLocal(ModelInput input)
 	return float3x3(tangent, bitangent, normal);
 }
 
+// Decodes the 16-bit vertex position quantized within the mesh bounds (see Mesh::HasCompressedPositions)
+float3 DecodeCompressedPosition(float3 position)
+{
+	return position * GeometrySize + GeometryOrigin;
+}
+
 float3x3 CalcTangentToWorld(float4x4 world, float3x3 tangentToLocal)
 {
 	float3x3 localToWorld = RemoveScaleFromLocalToWorld((float3x3)world);
@@ -308,9 +315,12 @@ float3x3 CalcTangentToWorld(float4x4 world, float3x3 tangentToLocal)
 
 // Vertex Shader function for GBuffer Pass and Depth Pass (with full vertex data)
 META_VS(true, FEATURE_LEVEL_ES2)
-META_PERMUTATION_1(USE_INSTANCING=0)
-META_PERMUTATION_1(USE_INSTANCING=1)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_PERMUTATION_2(USE_INSTANCING=0, USE_COMPRESSED_POSITIONS=0)
+META_PERMUTATION_2(USE_INSTANCING=1, USE_COMPRESSED_POSITIONS=0)
+META_PERMUTATION_2(USE_INSTANCING=0, USE_COMPRESSED_POSITIONS=1)
+META_PERMUTATION_2(USE_INSTANCING=1, USE_COMPRESSED_POSITIONS=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, !USE_COMPRESSED_POSITIONS)
+META_VS_IN_ELEMENT(POSITION, 0, R16G16B16A16_UNORM,0, 0,     PER_VERTEX, 0, USE_COMPRESSED_POSITIONS)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R16G16_FLOAT,      1, 0,     PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(NORMAL,   0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TANGENT,  0, R10G10B10A2_UNORM, 1, ALIGN, PER_VERTEX, 0, true)
@@ -324,6 +334,9 @@ META_VS_IN_ELEMENT(ATTRIBUTE,4, R16G16B16A16_FLOAT,3, ALIGN, PER_INSTANCE, 1, US
 VertexOutput VS(ModelInput input)
 {
 	VertexOutput output;
+#if USE_COMPRESSED_POSITIONS
+	input.Position = DecodeCompressedPosition(input.Position);
+#endif
 
 	// Compute world space vertex position
 	CalculateInstanceTransform(input);
@@ -389,9 +402,12 @@ VertexOutput VS(ModelInput input)
 
 // Vertex Shader function for Depth Pass
 META_VS(true, FEATURE_LEVEL_ES2)
-META_PERMUTATION_1(USE_INSTANCING=0)
-META_PERMUTATION_1(USE_INSTANCING=1)
-META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, true)
+META_PERMUTATION_2(USE_INSTANCING=0, USE_COMPRESSED_POSITIONS=0)
+META_PERMUTATION_2(USE_INSTANCING=1, USE_COMPRESSED_POSITIONS=0)
+META_PERMUTATION_2(USE_INSTANCING=0, USE_COMPRESSED_POSITIONS=1)
+META_PERMUTATION_2(USE_INSTANCING=1, USE_COMPRESSED_POSITIONS=1)
+META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT,   0, 0,     PER_VERTEX, 0, !USE_COMPRESSED_POSITIONS)
+META_VS_IN_ELEMENT(POSITION, 0, R16G16B16A16_UNORM,0, 0,     PER_VERTEX, 0, USE_COMPRESSED_POSITIONS)
 META_VS_IN_ELEMENT(ATTRIBUTE,0, R32G32B32A32_FLOAT,3, 0,     PER_INSTANCE, 1, USE_INSTANCING)
 META_VS_IN_ELEMENT(ATTRIBUTE,1, R32G32B32A32_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
 META_VS_IN_ELEMENT(ATTRIBUTE,2, R32G32B32_FLOAT,   3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
@@ -399,6 +415,9 @@ META_VS_IN_ELEMENT(ATTRIBUTE,3, R32G32B32_FLOAT,   3, ALIGN, PER_INSTANCE, 1, US
 META_VS_IN_ELEMENT(ATTRIBUTE,4, R16G16B16A16_FLOAT,3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
 float4 VS_Depth(ModelInput_PosOnly input) : SV_Position
 {
+#if USE_COMPRESSED_POSITIONS
+	input.Position = DecodeCompressedPosition(input.Position);
+#endif
 #if USE_INSTANCING
 	float4x4 world = GetInstanceTransform(input);
 #else
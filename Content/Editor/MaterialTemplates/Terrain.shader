@@ -258,11 +258,11 @@ Material GetMaterialPS(MaterialInput input)
 }
 
 // Calculates LOD value (with fractional part for blending)
-float CalcLOD(float2 xy, float4 morph)
+float CalcLOD(float2 xy, float4 morph, float4 neighborLOD)
 {
 #if USE_SMOOTH_LOD_TRANSITION
 	// Use LOD value based on Barycentric coordinates to morph to the lower LOD near chunk edges
-	float4 lodCalculated = morph * CurrentLOD + NeighborLOD * (float4(1, 1, 1, 1) - morph);
+	float4 lodCalculated = morph * CurrentLOD + neighborLOD * (float4(1, 1, 1, 1) - morph);
 
 	// Pick a quadrant (top, left, right or bottom)
 	float lod;
@@ -298,27 +298,51 @@ struct TerrainVertexInput
 {
 	float2 TexCoord : TEXCOORD0;
 	float4 Morph : TEXCOORD1;
+#if USE_INSTANCING
+	// Must match structure defined in TerrainCullingPass.h
+	float4 InstanceHeightmapUVScaleBias : ATTRIBUTE0;
+	float4 InstanceNeighborLOD          : ATTRIBUTE1;
+	float4 InstanceOffset               : ATTRIBUTE2; // xy: OffsetUV, zw: chunk location (in patch local space)
+#endif
 };
 
-// Vertex Shader function for terrain rendering
+// Vertex Shader function for terrain rendering (instanced variant draws the patch chunks culled on GPU, see TerrainCullingPass)
 META_VS(true, FEATURE_LEVEL_ES2)
+META_PERMUTATION_1(USE_INSTANCING=0)
+META_PERMUTATION_1(USE_INSTANCING=1)
 META_VS_IN_ELEMENT(TEXCOORD, 0, R32G32_FLOAT,   0, ALIGN, PER_VERTEX, 0, true)
 META_VS_IN_ELEMENT(TEXCOORD, 1, R8G8B8A8_UNORM, 0, ALIGN, PER_VERTEX, 0, true)
+META_VS_IN_ELEMENT(ATTRIBUTE,0, R32G32B32A32_FLOAT, 3, 0,     PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,1, R32G32B32A32_FLOAT, 3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
+META_VS_IN_ELEMENT(ATTRIBUTE,2, R32G32B32A32_FLOAT, 3, ALIGN, PER_INSTANCE, 1, USE_INSTANCING)
 VertexOutput VS(TerrainVertexInput input)
 {
 	VertexOutput output;
 
+	// Get chunk data
+#if USE_INSTANCING
+	float4 heightmapUVScaleBias = input.InstanceHeightmapUVScaleBias;
+	float4 neighborLOD = input.InstanceNeighborLOD;
+	float2 offsetUV = input.InstanceOffset.xy;
+	float2 chunkOffset = input.InstanceOffset.zw;
+#else
+	float4 heightmapUVScaleBias = HeightmapUVScaleBias;
+	float4 neighborLOD = NeighborLOD;
+	float2 offsetUV = OffsetUV;
+	float2 chunkOffset = float2(0, 0);
+#endif
+
 	// Calculate terrain LOD for this chunk
-	float lodCalculated = CalcLOD(input.TexCoord, input.Morph);
+	float lodCalculated = CalcLOD(input.TexCoord, input.Morph, neighborLOD);
 	float lodValue = CurrentLOD;
 	float morphAlpha = lodCalculated - CurrentLOD;
 
 	// Sample heightmap
-	float2 heightmapUVs = input.TexCoord * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float2 heightmapUVs = input.TexCoord * heightmapUVScaleBias.xy + heightmapUVScaleBias.zw;
 #if USE_SMOOTH_LOD_TRANSITION
 	float4 heightmapValueThisLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVs, lodValue);
 	float2 nextLODPos = round(input.TexCoord * ChunkSizeNextLOD) / ChunkSizeNextLOD;
-	float2 heightmapUVsNextLOD = nextLODPos * HeightmapUVScaleBias.xy + HeightmapUVScaleBias.zw;
+	float2 heightmapUVsNextLOD = nextLODPos * heightmapUVScaleBias.xy + heightmapUVScaleBias.zw;
 	float4 heightmapValueNextLOD = Heightmap.SampleLevel(SamplerPointClamp, heightmapUVsNextLOD, lodValue + 1);
 	float4 heightmapValue = lerp(heightmapValueThisLOD, heightmapValueNextLOD, morphAlpha);
 	bool isHole = max(heightmapValueThisLOD.b + heightmapValueThisLOD.a, heightmapValueNextLOD.b + heightmapValueNextLOD.a) >= 1.9f;
@@ -364,8 +388,8 @@ VertexOutput VS(TerrainVertexInput input)
 #endif
 	float3 position = float3(positionXZ.x, height, positionXZ.y);
 
-	// Compute world space vertex position
-	output.Geometry.WorldPosition = mul(float4(position, 1), WorldMatrix).xyz;
+	// Compute world space vertex position (instanced chunks use the patch transformation)
+	output.Geometry.WorldPosition = mul(float4(position + float3(chunkOffset.x, 0, chunkOffset.y), 1), WorldMatrix).xyz;
 
 	// Compute clip space position
 	output.Position = mul(float4(output.Geometry.WorldPosition, 1), ViewProjectionMatrix);
@@ -376,7 +400,7 @@ VertexOutput VS(TerrainVertexInput input)
 #else
 	float2 texCoord = input.TexCoord;
 #endif
-	output.Geometry.TexCoord = positionXZ * (1.0f / TerrainChunkSizeLOD0) + OffsetUV;
+	output.Geometry.TexCoord = positionXZ * (1.0f / TerrainChunkSizeLOD0) + offsetUV;
 	output.Geometry.LightmapUV = texCoord * LightmapArea.zw + LightmapArea.xy;
 
 	// Extract terrain layers weights from the splatmap
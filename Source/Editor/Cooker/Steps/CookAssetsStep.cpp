@@ -15,11 +15,16 @@
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Texture.h"
 #include "Engine/Content/Assets/CubeTexture.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Content/Assets/Animation.h"
 #include "Engine/Render2D/SpriteAtlas.h"
 #include "Engine/Content/Storage/FlaxFile.h"
 #include "Engine/Particles/ParticleEmitter.h"
 #include "Engine/Utilities/Encryption.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonBinary.h"
+#include "Engine/Serialization/FileReadStream.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
 #include "Engine/Core/Config/PlatformSettings.h"
@@ -37,6 +42,9 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Tools/TextureTool/TextureTool.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Utilities/Crc.h"
 #include "Engine/Scripting/Enums.h"
 #if PLATFORM_TOOLS_WINDOWS
 #include "Engine/Platform/Windows/WindowsPlatformSettings.h"
@@ -49,7 +57,49 @@
 #endif
 #include "FlaxEngine.Gen.h"
 
+// Version of the cooking cache header file format
+#define COOK_CACHE_HEADER_VERSION 2
+// Cooking cost multipliers (relative to the asset file size) used to cook the heaviest assets first
+#define COOK_COST_SCALE_SHADER 64
+#define COOK_COST_SCALE_TEXTURE 4
+
 Dictionary<String, CookAssetsStep::ProcessAssetFunc> CookAssetsStep::AssetProcessors;
+HashSet<String> CookAssetsStep::ParallelAssetTypes;
+
+namespace
+{
+    struct CookItem
+    {
+        Guid ID;
+        uint64 Cost;
+        bool Parallel;
+
+        bool operator<(const CookItem& other) const
+        {
+            // Sort from the most expensive
+            return Cost > other.Cost;
+        }
+    };
+
+    bool CalculateFileHash(const String& path, uint64& size, uint32& hash)
+    {
+        auto file = FileReadStream::Open(path);
+        if (file == nullptr)
+            return true;
+        DeleteMe<FileReadStream> deleteFile(file);
+        size = file->GetLength();
+        hash = 0;
+        byte buffer[16 * 1024];
+        for (uint64 left = size; left > 0;)
+        {
+            const uint32 bytes = (uint32)Math::Min<uint64>(left, sizeof(buffer));
+            file->ReadBytes(buffer, bytes);
+            hash = Crc::MemCrc32(buffer, (int32)bytes, hash);
+            left -= bytes;
+        }
+        return file->HasError();
+    }
+}
 
 void IBuildCache::InvalidateCacheShaders()
 {
@@ -115,6 +165,47 @@ CookAssetsStep::CacheEntry& CookAssetsStep::CacheData::CreateEntry(const Asset*
     return entry;
 }
 
+bool CookAssetsStep::CacheData::IsFileModified(const String& path, DateTime& fileModified)
+{
+    const DateTime modified = FileSystem::GetFileLastEditTime(path);
+    if (modified <= fileModified)
+        return false;
+
+    // Compare the file contents with the hash from the last build
+    FileHash cached;
+    {
+        ScopeLock lock(Locker);
+        const FileHash* e = FileHashes.TryGet(path);
+        if (e == nullptr)
+            return true;
+        cached = *e;
+    }
+    uint64 size;
+    uint32 hash;
+    if (CalculateFileHash(path, size, hash) || size != cached.Size || hash != cached.Hash)
+        return true;
+    ScopeLock lock(Locker);
+    FileHashes[path].FileModified = modified;
+    fileModified = modified;
+    return false;
+}
+
+void CookAssetsStep::CacheData::AddFileHash(const String& path)
+{
+    FileHash e;
+    e.FileModified = FileSystem::GetFileLastEditTime(path);
+    {
+        ScopeLock lock(Locker);
+        const FileHash* cached = FileHashes.TryGet(path);
+        if (cached && cached->FileModified == e.FileModified)
+            return;
+    }
+    if (CalculateFileHash(path, e.Size, e.Hash))
+        return;
+    ScopeLock lock(Locker);
+    FileHashes[path] = e;
+}
+
 void CookAssetsStep::CacheData::InvalidateCachePerType(const StringView& typeName)
 {
     LOG(Info, "Invalidating cooker cache for {0} assets.", typeName);
@@ -130,9 +221,10 @@ void CookAssetsStep::CacheData::InvalidateCachePerType(const StringView& typeNam
 void CookAssetsStep::CacheData::Load(CookingData& data)
 {
     PROFILE_CPU();
-    HeaderFilePath = data.CacheDirectory / String::Format(TEXT("CookedHeader_{0}.bin"), FLAXENGINE_VERSION_BUILD);
+    HeaderFilePath = data.CacheDirectory / String::Format(TEXT("CookedHeader_{0}_{1}.bin"), FLAXENGINE_VERSION_BUILD, COOK_CACHE_HEADER_VERSION);
     CacheFolder = data.CacheDirectory / TEXT("Cooked");
     Entries.Clear();
+    FileHashes.Clear();
 
     if (!FileSystem::DirectoryExists(CacheFolder))
         FileSystem::CreateDirectory(CacheFolder);
@@ -194,12 +286,29 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
     Array<byte> platformCache;
     file->Read(platformCache);
 
+    int32 fileHashesCount;
+    file->ReadInt32(&fileHashesCount);
+    if (Math::IsNotInRange(fileHashesCount, 0, 10000000))
+        fileHashesCount = 0;
+    FileHashes.EnsureCapacity(fileHashesCount);
+    for (int32 i = 0; i < fileHashesCount; i++)
+    {
+        String path;
+        file->ReadString(&path, 10);
+        FileHash e;
+        file->Read(e.FileModified);
+        file->ReadUint64(&e.Size);
+        file->ReadUint32(&e.Hash);
+        FileHashes[path] = e;
+    }
+
     int32 checkChar;
     file->ReadInt32(&checkChar);
     if (checkChar != 13)
     {
         LOG(Warning, "Corrupted cooking cache header file.");
         Entries.Clear();
+        FileHashes.Clear();
     }
 
     // Per-platform custom data loading (eg. to invalidate textures/shaders options)
@@ -235,6 +344,13 @@ void CookAssetsStep::CacheData::Load(CookingData& data)
         LOG(Info, "{0} option has been modified.", TEXT("ShadersGenerateDebugData"));
         invalidateShaders = true;
     }
+    if (buildSettings->CompressMeshesAndAnimations != Settings.Global.CompressMeshesAndAnimations)
+    {
+        LOG(Info, "{0} option has been modified.", TEXT("CompressMeshesAndAnimations"));
+        InvalidateCachePerType<Model>();
+        InvalidateCachePerType<SkinnedModel>();
+        InvalidateCachePerType<Animation>();
+    }
 #if PLATFORM_TOOLS_WINDOWS
     if (data.Platform == BuildPlatform::Windows32 || data.Platform == BuildPlatform::Windows64)
     {
@@ -321,6 +437,14 @@ void CookAssetsStep::CacheData::Save(CookingData& data)
         }
     }
     file->Write(data.Tools->SaveCache(data, this));
+    file->WriteInt32(FileHashes.Count());
+    for (auto i = FileHashes.Begin(); i.IsNotEnd(); ++i)
+    {
+        file->Write(i->Key, 10);
+        file->Write(i->Value.FileModified);
+        file->WriteUint64(i->Value.Size);
+        file->WriteUint32(i->Value.Hash);
+    }
     file->WriteInt32(13);
 }
 
@@ -345,15 +469,16 @@ bool CookAssetsStep::ProcessDefaultAsset(AssetCookData& options)
     const auto asJsonAsset = dynamic_cast<JsonAssetBase*>(options.Asset);
     if (asJsonAsset)
     {
-        // Use compact json
-        rapidjson_flax::StringBuffer buffer;
-        CompactJsonWriter writerObj(buffer);
+        // Use binary json (faster to load than text)
+        BinaryJsonWriter writerObj;
         asJsonAsset->Save(writerObj);
+        Array<byte> buffer;
+        writerObj.GetData(buffer);
 
         // Store json data in the first chunk
         auto chunk = New<FlaxChunk>();
-        chunk->Flags = FlaxChunkFlags::CompressedLZ4; // Compress json data (internal storage layer will handle it)
-        chunk->Data.Copy((byte*)buffer.GetString(), (int32)buffer.GetSize());
+        chunk->Flags = FlaxChunkFlags::CompressedLZ4Dictionary; // Compress json data (internal storage layer will handle it)
+        chunk->Data.Copy(buffer);
         options.InitData.Header.Chunks[0] = chunk;
 
         return false;
@@ -402,10 +527,6 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
     while (sourceLength > 2 && source[sourceLength - 1] == 0)
         sourceLength--;
 
-    // Init shader cache output stream
-    // TODO: reuse MemoryWriteStream per cooking process to reduce dynamic memory allocations
-    MemoryWriteStream cacheStream(32 * 1024);
-
     // Compile shader source
     ShaderCompilationOptions options;
     options.TargetName = StringUtils::GetFileNameWithoutExtension(asset->GetPath());
@@ -415,30 +536,27 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
     options.NoOptimize = data.Cache.Settings.Global.ShadersNoOptimize;
     options.GenerateDebugData = data.Cache.Settings.Global.ShadersGenerateDebugData;
     options.TreatWarningsAsErrors = false;
-    options.Output = &cacheStream;
-    Array<String> includes;
+
+    // Collect shader profiles to compile (compiled later in parallel)
+    struct ProfileCompilation
+    {
+        ShaderCompilationOptions Options;
+        int32 CacheChunk;
+        MemoryWriteStream* Output;
+        bool Failed;
+    };
+    Array<ProfileCompilation, InlinedAllocation<4>> profiles;
 
 #define COMPILE_PROFILE(profile, cacheChunk) \
 	{ \
-		cacheStream.SetPosition(0); \
-		options.Profile = ShaderProfile::profile; \
-		options.Macros.Clear(); \
-		auto& platformDefine = options.Macros.AddOne(); \
+		auto& e = profiles.AddOne(); \
+		e.Options = options; \
+		e.Options.Profile = ShaderProfile::profile; \
+		auto& platformDefine = e.Options.Macros.AddOne(); \
 		platformDefine.Name = platformDefineName; \
 		platformDefine.Definition = nullptr; \
-		assetBase->InitCompilationOptions(options); \
-		if (ShadersCompilation::Compile(options)) \
-		{ \
-			data.Data.Error(String::Format(TEXT("Failed to compile shader '{0}' (profile: {1})."), asset->ToString(), ::ToString(options.Profile))); \
-			return true; \
-		} \
-        includes.Clear(); \
-        ShadersCompilation::ExtractShaderIncludes(cacheStream.GetHandle(), cacheStream.GetPosition(), includes); \
-        for (auto& include : includes) \
-            data.FileDependencies.Add(ToPair(include, FileSystem::GetFileLastEditTime(include))); \
-		auto chunk = New<FlaxChunk>(); \
-		chunk->Data.Copy(cacheStream.GetHandle(), cacheStream.GetPosition()); \
-		data.InitData.Header.Chunks[cacheChunk] = chunk; \
+		assetBase->InitCompilationOptions(e.Options); \
+		e.CacheChunk = cacheChunk; \
 	}
 
     // Compile for a target platform
@@ -569,11 +687,56 @@ bool ProcessShaderBase(CookAssetsStep::AssetCookData& data, ShaderAssetBase* ass
         return true;
     }
     }
+#undef COMPILE_PROFILE
+
+    // Compile all profiles in parallel (each compilation uses a separate shader compiler)
+    for (auto& e : profiles)
+    {
+        // TODO: reuse MemoryWriteStream per cooking process to reduce dynamic memory allocations
+        e.Output = New<MemoryWriteStream>(32 * 1024);
+        e.Options.Output = e.Output;
+        e.Failed = false;
+    }
+    if (profiles.Count() == 1)
+    {
+        profiles[0].Failed = ShadersCompilation::Compile(profiles[0].Options);
+    }
+    else
+    {
+        Function<void(int32)> job = [&profiles](int32 i)
+        {
+            profiles[i].Failed = ShadersCompilation::Compile(profiles[i].Options);
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, profiles.Count()));
+    }
 
     // Encrypt source code
     Encryption::EncryptBytes(reinterpret_cast<byte*>(source), sourceLength);
 
-    return false;
+    // Store results
+    bool failed = false;
+    Array<String> includes;
+    for (auto& e : profiles)
+    {
+        if (e.Failed)
+        {
+            data.Data.Error(String::Format(TEXT("Failed to compile shader '{0}' (profile: {1})."), asset->ToString(), ::ToString(e.Options.Profile)));
+            failed = true;
+        }
+        else if (!failed)
+        {
+            includes.Clear();
+            ShadersCompilation::ExtractShaderIncludes(e.Output->GetHandle(), e.Output->GetPosition(), includes);
+            for (auto& include : includes)
+                data.FileDependencies.Add(ToPair(include, FileSystem::GetFileLastEditTime(include)));
+            auto chunk = New<FlaxChunk>();
+            chunk->Data.Copy(e.Output->GetHandle(), e.Output->GetPosition());
+            data.InitData.Header.Chunks[e.CacheChunk] = chunk;
+        }
+        Delete(e.Output);
+    }
+
+    return failed;
 }
 
 bool ProcessMaterial(CookAssetsStep::AssetCookData& data)
@@ -638,6 +801,25 @@ bool ProcessParticleEmitter(CookAssetsStep::AssetCookData& data)
     return ProcessShaderBase(data, asset);
 }
 
+bool ProcessCompressedAsset(CookAssetsStep::AssetCookData& data)
+{
+    if (CookAssetsStep::ProcessDefaultAsset(data))
+        return true;
+
+    // Compress data chunks (internal storage layer will handle it)
+    if (data.Cache.Settings.Global.CompressMeshesAndAnimations)
+    {
+        for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
+        {
+            const auto chunk = data.InitData.Header.Chunks[i];
+            if (chunk)
+                chunk->Flags |= FlaxChunkFlags::CompressedLZ4;
+        }
+    }
+
+    return false;
+}
+
 bool ProcessTextureBase(CookAssetsStep::AssetCookData& data)
 {
     const auto asset = static_cast<TextureBase*>(data.Asset);
@@ -782,6 +964,18 @@ CookAssetsStep::CookAssetsStep()
     AssetProcessors.Add(Texture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(CubeTexture::TypeName, ProcessTextureBase);
     AssetProcessors.Add(SpriteAtlas::TypeName, ProcessTextureBase);
+    AssetProcessors.Add(Model::TypeName, ProcessCompressedAsset);
+    AssetProcessors.Add(SkinnedModel::TypeName, ProcessCompressedAsset);
+    AssetProcessors.Add(Animation::TypeName, ProcessCompressedAsset);
+    ParallelAssetTypes.Add(Material::TypeName);
+    ParallelAssetTypes.Add(Shader::TypeName);
+    ParallelAssetTypes.Add(ParticleEmitter::TypeName);
+    ParallelAssetTypes.Add(Texture::TypeName);
+    ParallelAssetTypes.Add(CubeTexture::TypeName);
+    ParallelAssetTypes.Add(SpriteAtlas::TypeName);
+    ParallelAssetTypes.Add(Model::TypeName);
+    ParallelAssetTypes.Add(SkinnedModel::TypeName);
+    ParallelAssetTypes.Add(Animation::TypeName);
 }
 
 bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* asset)
@@ -824,10 +1018,16 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, BinaryAsset* a
     if (assetProcessor(options))
         return true;
 
-    // Save cache
+    // Save cache (store files hashes to reuse cached asset if only modification time changes)
+    cache.AddFileHash(asset->GetPath());
+    for (auto& e : fileDependencies)
+        cache.AddFileHash(e.First);
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -868,10 +1068,16 @@ bool CookAssetsStep::Process(CookingData& data, CacheData& cache, JsonAssetBase*
     if (assetProcessor(options))
         return true;
 
-    // Save cache
+    // Save cache (store files hashes to reuse cached asset if only modification time changes)
+    cache.AddFileHash(asset->GetPath());
+    for (auto& e : fileDependencies)
+        cache.AddFileHash(e.First);
     String cachedFilePath;
-    auto& entry = cache.CreateEntry(asset, cachedFilePath);
-    entry.FileDependencies = MoveTemp(fileDependencies);
+    {
+        ScopeLock lock(cache.Locker);
+        auto& entry = cache.CreateEntry(asset, cachedFilePath);
+        entry.FileDependencies = MoveTemp(fileDependencies);
+    }
     const bool result = FlaxStorage::Create(cachedFilePath, initData);
 
     // Cleanup allocated data chunks
@@ -1084,6 +1290,7 @@ bool CookAssetsStep::Perform(CookingData& data)
     {
         cache.Settings.Global.ShadersNoOptimize = buildSettings->ShadersNoOptimize;
         cache.Settings.Global.ShadersGenerateDebugData = buildSettings->ShadersGenerateDebugData;
+        cache.Settings.Global.CompressMeshesAndAnimations = buildSettings->CompressMeshesAndAnimations;
         cache.Settings.Global.StreamingSettingsAssetId = gameSettings->Streaming;
         cache.Settings.Global.ShadersVersion = GPU_SHADER_CACHE_VERSION;
         cache.Settings.Global.MaterialGraphVersion = MATERIAL_GRAPH_VERSION;
@@ -1094,18 +1301,18 @@ bool CookAssetsStep::Perform(CookingData& data)
     // Then files cooked files are packed into the packages.
 
     // Process all assets
+    // Check the cache and register assets first (on the cooker thread), then cook modified assets in parallel
     AssetInfo assetInfo;
 #if ENABLE_ASSETS_DISCOVERY
     auto minDateTime = DateTime::MinValue();
 #endif
     int32 subStepIndex = 0;
-    AssetReference<Asset> assetRef;
-    assetRef.Unload.Bind([]() { LOG(Error, "Asset gets unloaded while cooking it!"); Platform::Sleep(100); });
+    Array<CookItem> cookItems;
     for (auto i = data.Assets.Begin(); i.IsNotEnd(); ++i)
     {
         BUILD_STEP_CANCEL_CHECK;
 
-        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, static_cast<float>(subStepIndex++) / data.Assets.Count()));
+        data.StepProgress(TEXT("Checking build cache"), Math::Lerp(0.0f, Step1ProgressStart, static_cast<float>(subStepIndex++) / data.Assets.Count()));
         const Guid assetId = i->Item;
 
         // Register asset
@@ -1115,71 +1322,124 @@ bool CookAssetsStep::Perform(CookingData& data)
         e.FileModified = minDateTime;
 #endif
 
+        // Get actual asset info
+        if (!Content::GetAssetInfo(assetId, assetInfo))
+        {
+            data.Error(TEXT("Failed to load asset included in build."));
+            return true;
+        }
+        e.Info.TypeName = assetInfo.TypeName;
+
         // Check if asset is in cooking cache and was not modified since last build
         const auto cachedEntry = cache.Entries.TryGet(assetId);
         if (cachedEntry)
         {
             ASSERT(cachedEntry->ID == assetId);
 
-            // Get actual asset info
-            if (Content::GetAssetInfo(assetId, assetInfo))
+            // Ensure that cached entry is valid
+            if (cachedEntry->TypeName == assetInfo.TypeName)
             {
-                // Ensure that cached entry is valid
-                if (cachedEntry->TypeName == assetInfo.TypeName)
+                // Check if file hasn't been modified (and all dependant files)
+                bool isValid = !cache.IsFileModified(assetInfo.Path, cachedEntry->FileModified);
+                for (int32 j = 0; j < cachedEntry->FileDependencies.Count() && isValid; j++)
                 {
-                    // Check if file hasn't been modified
-                    if (FileSystem::GetFileLastEditTime(assetInfo.Path) <= cachedEntry->FileModified)
-                    {
-                        // Check all dependant files
-                        bool isValid = true;
-                        for (auto& f : cachedEntry->FileDependencies)
-                        {
-                            if (FileSystem::GetFileLastEditTime(f.First) > f.Second)
-                            {
-                                isValid = false;
-                                break;
-                            }
-                        }
-
-                        if (isValid)
-                        {
-                            // Cache hit!
-                            e.Info.TypeName = assetInfo.TypeName;
-                            continue;
-                        }
-                    }
+                    auto& f = cachedEntry->FileDependencies[j];
+                    isValid = !cache.IsFileModified(f.First, f.Second);
                 }
-                else
+                if (isValid)
                 {
-                    // Remove invalid entry
-                    cache.Entries.Remove(assetId);
+                    // Cache hit!
+                    continue;
                 }
             }
+            else
+            {
+                // Remove invalid entry
+                cache.Entries.Remove(assetId);
+            }
         }
 
-        // Load asset (and keep ref)
-        assetRef = Content::LoadAsync<Asset>(assetId);
-        if (assetRef == nullptr)
+        // Estimate the cooking cost to start from the heaviest assets (shaders compilation and textures compression dominate the cooking time)
+        auto& item = cookItems.AddOne();
+        item.ID = assetId;
+        item.Parallel = ParallelAssetTypes.Contains(assetInfo.TypeName);
+        item.Cost = FileSystem::GetFileSize(assetInfo.Path) + 1;
+        if (assetInfo.TypeName == Material::TypeName || assetInfo.TypeName == Shader::TypeName || assetInfo.TypeName == ParticleEmitter::TypeName)
+            item.Cost *= COOK_COST_SCALE_SHADER;
+        else if (assetInfo.TypeName == Texture::TypeName || assetInfo.TypeName == CubeTexture::TypeName || assetInfo.TypeName == SpriteAtlas::TypeName)
+            item.Cost *= COOK_COST_SCALE_TEXTURE;
+    }
+    Sorting::QuickSort(cookItems.Get(), cookItems.Count());
+    Array<Guid> parallelAssets, serialAssets;
+    for (const CookItem& item : cookItems)
+        (item.Parallel ? parallelAssets : serialAssets).Add(item.ID);
+    LOG(Info, "Cooking {0} assets ({1} in parallel, {2} on cooker thread)", cookItems.Count(), parallelAssets.Count(), serialAssets.Count());
+
+    // Cook thread-safe assets on job system threads (each job loads, cooks and releases a single asset, jobs are picked in the order of the cost)
+    volatile int64 cookedCount = 0, failedCount = 0;
+    auto cookAsset = [this, &data, &cache, &cookedCount, &failedCount](const Guid& assetId)
+    {
+        if (Platform::AtomicRead(&failedCount) != 0 || GameCooker::IsCancelRequested())
+            return;
+        AssetReference<Asset> asset = Content::LoadAsync<Asset>(assetId);
+        if (asset == nullptr)
         {
             data.Error(TEXT("Failed to load asset included in build."));
-            return true;
+            Platform::InterlockedIncrement(&failedCount);
+            return;
         }
-        e.Info.TypeName = assetRef->GetTypeName();
-
-        // Cook asset
-        if (Process(data, cache, assetRef.Get()))
+        if (Process(data, cache, asset.Get()))
         {
-            cache.Save(data);
-            return true;
+            Platform::InterlockedIncrement(&failedCount);
+            return;
         }
-        data.Stats.CookedAssets++;
+        Platform::InterlockedIncrement(&cookedCount);
+    };
+    int64 parallelLabel = 0;
+    if (parallelAssets.HasItems())
+    {
+        Function<void(int32)> job = [&parallelAssets, &cookAsset](int32 i)
+        {
+            cookAsset(parallelAssets.Get()[i]);
+        };
+        parallelLabel = JobSystem::Dispatch(job, parallelAssets.Count());
+    }
+
+    // Cook other assets on the cooker thread (while jobs are running) and report the progress
+    int32 lastSavedCount = 0;
+    const int32 totalCount = cookItems.Count();
+    int32 serialIndex = 0;
+    while (true)
+    {
+        const int32 cooked = (int32)Platform::AtomicRead(&cookedCount);
+        data.StepProgress(Step1Info, Math::Lerp(Step1ProgressStart, Step1ProgressEnd, totalCount != 0 ? static_cast<float>(cooked) / totalCount : 1.0f));
 
         // Auto save build cache after every few cooked assets (reduces next build time if cooking fails later)
-        if (data.Stats.CookedAssets % 50 == 0)
+        if (cooked - lastSavedCount >= 50)
         {
+            lastSavedCount = cooked;
+            ScopeLock lock(cache.Locker);
             cache.Save(data);
         }
+
+        if (Platform::AtomicRead(&failedCount) != 0 || GameCooker::IsCancelRequested())
+            break;
+        if (serialIndex < serialAssets.Count())
+            cookAsset(serialAssets[serialIndex++]);
+        else if (cooked >= parallelAssets.Count() + serialIndex)
+            break;
+        else
+            Platform::Sleep(10);
+    }
+    if (parallelAssets.HasItems())
+        JobSystem::Wait(parallelLabel);
+    data.Stats.CookedAssets += (int32)Platform::AtomicRead(&cookedCount);
+    if (Platform::AtomicRead(&failedCount) != 0)
+    {
+        cache.Save(data);
+        return true;
     }
+    BUILD_STEP_CANCEL_CHECK;
 
     // Save build cache header
     cache.Save(data);
@@ -7,6 +7,8 @@
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Content/AssetInfo.h"
 #include "Engine/Content/Cache/AssetsCache.h"
 
@@ -54,6 +56,27 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         bool IsValid(bool withDependencies = false);
     };
 
+    /// <summary>
+    /// Cached file contents hash.
+    /// </summary>
+    struct FLAXENGINE_API FileHash
+    {
+        /// <summary>
+        /// The file modification time when hash was calculated.
+        /// </summary>
+        DateTime FileModified;
+
+        /// <summary>
+        /// The file size (in bytes).
+        /// </summary>
+        uint64 Size;
+
+        /// <summary>
+        /// The file contents hash (CRC32).
+        /// </summary>
+        uint32 Hash;
+    };
+
     /// <summary>
     /// Assets cooking cache data (incremental building feature).
     /// </summary>
@@ -97,6 +120,7 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
             {
                 bool ShadersNoOptimize;
                 bool ShadersGenerateDebugData;
+                bool CompressMeshesAndAnimations;
                 Guid StreamingSettingsAssetId;
                 int32 ShadersVersion;
                 int32 MaterialGraphVersion;
@@ -109,6 +133,16 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// </summary>
         Dictionary<Guid, CacheEntry> Entries;
 
+        /// <summary>
+        /// The hashes of the cooked assets files and their dependencies (key: file path). Used to reuse cached asset when file modification time changes but its contents is the same (eg. fresh checkout on a build machine).
+        /// </summary>
+        Dictionary<String, FileHash> FileHashes;
+
+        /// <summary>
+        /// The cache data locker (assets are cooked in parallel).
+        /// </summary>
+        CriticalSection Locker;
+
     public:
 
         /// <summary>
@@ -137,6 +171,20 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
         /// <returns>The added entry reference.</returns>
         CacheEntry& CreateEntry(const Asset* asset, String& cachedFilePath);
 
+        /// <summary>
+        /// Checks if the file has been modified since the cached modification time. Files with newer modification time but the same contents (hash) are not modified.
+        /// </summary>
+        /// <param name="path">The file path.</param>
+        /// <param name="fileModified">The cached file modification time. Updated to the current file modification time if contents is the same.</param>
+        /// <returns>True if file has been modified, otherwise false.</returns>
+        bool IsFileModified(const String& path, DateTime& fileModified);
+
+        /// <summary>
+        /// Calculates and stores the file contents hash (if not cached yet).
+        /// </summary>
+        /// <param name="path">The file path.</param>
+        void AddFileHash(const String& path);
+
         /// <summary>
         /// Loads the cache for the given cooking data.
         /// </summary>
@@ -169,6 +217,11 @@ class FLAXENGINE_API CookAssetsStep : public GameCooker::BuildStep
     /// </summary>
     static Dictionary<String, ProcessAssetFunc> AssetProcessors;
 
+    /// <summary>
+    /// The asset types (full typename) that can be cooked in parallel on job system threads (asset processor is thread-safe). Other assets are cooked one-by-one on the cooker thread.
+    /// </summary>
+    static HashSet<String> ParallelAssetTypes;
+
     static bool ProcessDefaultAsset(AssetCookData& options);
     
 private:
@@ -1021,15 +1021,16 @@ protected override Asset LoadSignature(Guid id, out string[] types, out string[]
             {
                 TypeID = 31,
                 Title = "Two Bone IK",
-                Description = "Performs inverse kinematic on a three nodes chain.",
+                Description = "Performs inverse kinematic on a three nodes chain. Deferred IK is solved on the final pose together with other deferred chains (batched).",
                 Flags = NodeFlags.AnimGraph,
-                Size = new Float2(250, 140),
+                Size = new Float2(250, 160),
                 DefaultValues = new object[]
                 {
                     string.Empty,
                     1.0f,
                     false,
                     1.5f,
+                    false,
                 },
                 Elements = new[]
                 {
@@ -1042,6 +1043,8 @@ protected override Asset LoadSignature(Guid id, out string[] types, out string[]
                     NodeElementArchetype.Factory.Input(5, "Max Stretch Scale", true, typeof(float), 6, 3),
                     NodeElementArchetype.Factory.SkeletonNodeNameSelect(40, Surface.Constants.LayoutOffsetY * 6, 120, 0),
                     NodeElementArchetype.Factory.Text(0, Surface.Constants.LayoutOffsetY * 6, "Node:"),
+                    NodeElementArchetype.Factory.Bool(40, Surface.Constants.LayoutOffsetY * 7, 4),
+                    NodeElementArchetype.Factory.Text(0, Surface.Constants.LayoutOffsetY * 7, "Deferred:"),
                 }
             },
             new NodeArchetype
@@ -446,6 +446,29 @@ private void OnSelectedTextureGroupChanged(ComboBox comboBox)
                 {
                     NodeElementArchetype.Factory.Output(0, "UVs", typeof(Float2), 0)
                 }
+            },
+            new NodeArchetype
+            {
+                TypeID = 19,
+                Title = "Vertex Animation Texture",
+                AlternativeTitles = new string[] { "VAT" },
+                Description = "Plays back the vertex animation baked with VertexAnimationBaker (use with the baked static model and connect Position Offset to the material). Vertex colors of the model encode the vertex index into the texture.",
+                Flags = NodeFlags.MaterialGraph,
+                Size = new Float2(240, 90),
+                DefaultValues = new object[]
+                {
+                    30.0f,
+                    30.0f,
+                },
+                Elements = new[]
+                {
+                    NodeElementArchetype.Factory.Input(0, "Texture", true, typeof(FlaxEngine.Object), 0),
+                    NodeElementArchetype.Factory.Input(1, "Time", true, typeof(float), 1),
+                    NodeElementArchetype.Factory.Input(2, "Frames Count", true, typeof(float), 2, 0),
+                    NodeElementArchetype.Factory.Input(3, "Frame Rate", true, typeof(float), 3, 1),
+                    NodeElementArchetype.Factory.Output(0, "Position Offset", typeof(Float3), 4),
+                    NodeElementArchetype.Factory.Output(1, "Local Position", typeof(Float3), 5),
+                }
             }
         };
     }
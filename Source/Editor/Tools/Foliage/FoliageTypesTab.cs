@@ -181,6 +181,13 @@ public float DensityScalingScale
                 }
             }
 
+            [EditorOrder(170), EditorDisplay("Instance Options"), Tooltip("If checked, instances data will be cached in GPU memory and only clusters culling and LOD selection will be performed per-frame. Greatly reduces CPU cost of drawing dense foliage at cost of the coarser culling and LOD selection (per cluster, without LOD transitions). If GPU-driven rendering is enabled, culling and LOD selection are performed per-instance on GPU (opaque materials only). Not used by the foliage with baked lightmaps.")]
+            public bool UseDrawCache
+            {
+                get => _type.UseDrawCache;
+                set => _type.UseDrawCache = value;
+            }
+
             //
 
             [EditorOrder(200), EditorDisplay("Painting"), Limit(0.0f), Tooltip("The foliage instances density defined in instances count per 1000x1000 units area.")]
@@ -14,12 +14,8 @@ EditorScene::EditorScene(const SpawnParams& params)
 
 void EditorScene::Update()
 {
-    for (auto& e : Ticking.Update.Ticks)
-        e.Call();
-    for (auto& e : Ticking.LateUpdate.Ticks)
-        e.Call();
-    for (auto& e : Ticking.FixedUpdate.Ticks)
-        e.Call();
-    for (auto& e : Ticking.LateFixedUpdate.Ticks)
-        e.Call();
+    Ticking.Update.Ticks.Call();
+    Ticking.LateUpdate.Ticks.Call();
+    Ticking.FixedUpdate.Ticks.Call();
+    Ticking.LateFixedUpdate.Ticks.Call();
 }
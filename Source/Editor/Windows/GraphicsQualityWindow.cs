@@ -121,7 +121,25 @@ public RenderingUpscaleLocation UpscaleLocation
                 set => MainRenderTask.Instance.UpscaleLocation = value;
             }
 
-            private bool UpscaleLocation_Visible => MainRenderTask.Instance.RenderingPercentage < 1.0f;
+            private bool UpscaleLocation_Visible => MainRenderTask.Instance.RenderingPercentage < 1.0f || MainRenderTask.Instance.DynamicResolution;
+
+            [NoSerialize, DefaultValue(false)]
+            [EditorOrder(1402), EditorDisplay("Quality")]
+            [Tooltip("If checked, the rendering percentage will be adjusted automatically based on the GPU time of the scene rendering to match the target time.")]
+            public bool DynamicResolution
+            {
+                get => MainRenderTask.Instance.DynamicResolution;
+                set => MainRenderTask.Instance.DynamicResolution = value;
+            }
+
+            [NoSerialize, DefaultValue(16.0f), Limit(1, 100), VisibleIf(nameof(DynamicResolution))]
+            [EditorOrder(1403), EditorDisplay("Quality")]
+            [Tooltip("The target GPU time (in milliseconds) of the scene rendering used by the dynamic resolution.")]
+            public float DynamicResolutionTargetTime
+            {
+                get => MainRenderTask.Instance.DynamicResolutionTargetTime;
+                set => MainRenderTask.Instance.DynamicResolutionTargetTime = value;
+            }
 
             [NoSerialize, DefaultValue(1.0f), Limit(0, 1)]
             [EditorOrder(1500), EditorDisplay("Quality"), Tooltip("The global density scale for all foliage instances. The default value is 1. Use values from range 0-1. Lower values decrease amount of foliage instances in-game. Use it to tweak game performance for slower devices.")]
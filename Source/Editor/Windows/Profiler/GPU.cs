@@ -124,16 +124,40 @@ public GPU()
                         TitleColor = textColor,
                         FormatValue = FormatCountLong,
                     },
+                    new ColumnDefinition
+                    {
+                        Title = "VS Invocations",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCountLong,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "PS Invocations",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCountLong,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "PS per Triangle",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = (x) => ((float)x).ToString("0.0"),
+                    },
                 },
                 Parent = layout,
             };
             _table.Splits = new[]
             {
-                0.5f,
-                0.1f,
-                0.1f,
-                0.1f,
-                0.1f,
+                0.32f,
+                0.06f,
+                0.08f,
+                0.08f,
+                0.09f,
+                0.09f,
+                0.09f,
+                0.09f,
                 0.1f,
             };
         }
@@ -352,8 +376,8 @@ private void UpdateTableInner()
                 {
                     row = new Row
                     {
-                        Values = new object[6],
-                        BackgroundColors = new Color[6],
+                        Values = new object[9],
+                        BackgroundColors = new Color[9],
                     };
                     for (int k = 0; k < row.BackgroundColors.Length; k++)
                         row.BackgroundColors[k] = Color.Transparent;
@@ -378,6 +402,11 @@ private void UpdateTableInner()
 
                     // Vertices
                     row.Values[5] = e.Stats.Vertices;
+
+                    // Pipeline statistics (zeros if not collected, see ProfilerGPU.PipelineStatistics)
+                    row.Values[6] = (long)e.PipelineStats.VSInvocations;
+                    row.Values[7] = (long)e.PipelineStats.PSInvocations;
+                    row.Values[8] = e.PipelineStats.RasterizedPrimitives != 0 ? (float)((double)e.PipelineStats.PSInvocations / e.PipelineStats.RasterizedPrimitives) : 0.0f;
                 }
                 row.Depth = e.Depth;
                 row.Width = _table.Width;
@@ -199,7 +199,7 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
                         {
                             row = new Row
                             {
-                                Values = new object[5],
+                                Values = new object[9],
                             };
                         }
                         {
@@ -216,7 +216,19 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
                             row.Values[3] = (int)e.MessageSize;
 
                             // Receivers
-                            row.Values[4] = (float)e.Receivers / (float)e.Count;
+                            row.Values[4] = e.Count != 0 ? (float)e.Receivers / (float)e.Count : 0.0f;
+
+                            // Received Count
+                            row.Values[5] = (int)e.ReceivedCount;
+
+                            // Received Data Size
+                            row.Values[6] = (int)e.ReceivedDataSize;
+
+                            // Serialize Time
+                            row.Values[7] = e.SerializeTime;
+
+                            // Deserialize Time
+                            row.Values[8] = e.DeserializeTime;
                         }
 
                         var table = isRpc ? _tableRpc : _tableRep;
@@ -293,14 +305,45 @@ private static Table InitTable(ContainerControl parent, string name)
                         TitleBackgroundColor = headerColor,
                         TitleColor = textColor,
                     },
+                    new ColumnDefinition
+                    {
+                        Title = "Received",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Received Size",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCellBytes,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Serialize",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCellMs,
+                    },
+                    new ColumnDefinition
+                    {
+                        Title = "Deserialize",
+                        TitleBackgroundColor = headerColor,
+                        TitleColor = textColor,
+                        FormatValue = FormatCellMs,
+                    },
                 },
                 Splits = new[]
                 {
-                    0.40f,
-                    0.15f,
-                    0.15f,
-                    0.15f,
-                    0.15f,
+                    0.28f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
+                    0.09f,
                 },
                 Parent = parent,
             };
@@ -322,12 +365,17 @@ private static string FormatCellBytes(object x)
             return Utilities.Utils.FormatBytesCount((int)x);
         }
 
+        private static string FormatCellMs(object x)
+        {
+            return ((float)x).ToString("0.000") + " ms";
+        }
+
         private static int SortRows(Control x, Control y)
         {
             if (x is Row xRow && y is Row yRow)
             {
-                var xDataSize = (int)xRow.Values[2];
-                var yDataSize = (int)yRow.Values[2];
+                var xDataSize = (int)xRow.Values[2] + (int)xRow.Values[6];
+                var yDataSize = (int)yRow.Values[2] + (int)yRow.Values[6];
                 return yDataSize - xDataSize;
             }
             return 0;
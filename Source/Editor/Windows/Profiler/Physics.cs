@@ -17,6 +17,11 @@ internal sealed class Physics : ProfilerMode
         private readonly SingleChart _staticBodiesChart;
         private readonly SingleChart _newPairsChart;
         private readonly SingleChart _newTouchesChart;
+        private readonly SingleChart _broadPhaseTimeChart;
+        private readonly SingleChart _narrowPhaseTimeChart;
+        private readonly SingleChart _solverTimeChart;
+        private readonly SingleChart _ccdTimeChart;
+        private readonly SingleChart _callbacksTimeChart;
 
         public Physics()
         : base("Physics")
@@ -73,6 +78,41 @@ public Physics()
                 Parent = layout,
             };
             _newTouchesChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _broadPhaseTimeChart = new SingleChart
+            {
+                Title = "Broad Phase Time",
+                FormatSample = v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms",
+                Parent = layout,
+            };
+            _broadPhaseTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _narrowPhaseTimeChart = new SingleChart
+            {
+                Title = "Narrow Phase Time",
+                FormatSample = v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms",
+                Parent = layout,
+            };
+            _narrowPhaseTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _solverTimeChart = new SingleChart
+            {
+                Title = "Solver Time",
+                FormatSample = v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms",
+                Parent = layout,
+            };
+            _solverTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _ccdTimeChart = new SingleChart
+            {
+                Title = "CCD Time",
+                FormatSample = v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms",
+                Parent = layout,
+            };
+            _ccdTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
+            _callbacksTimeChart = new SingleChart
+            {
+                Title = "Callbacks Time",
+                FormatSample = v => (Mathf.RoundToInt(v * 100.0f) / 100.0f) + " ms",
+                Parent = layout,
+            };
+            _callbacksTimeChart.SelectedSampleChanged += OnSelectedSampleChanged;
         }
 
         /// <inheritdoc />
@@ -84,6 +124,11 @@ public override void Clear()
             _staticBodiesChart.Clear();
             _newPairsChart.Clear();
             _newTouchesChart.Clear();
+            _broadPhaseTimeChart.Clear();
+            _narrowPhaseTimeChart.Clear();
+            _solverTimeChart.Clear();
+            _ccdTimeChart.Clear();
+            _callbacksTimeChart.Clear();
         }
 
         /// <inheritdoc />
@@ -97,6 +142,11 @@ public override void Update(ref SharedUpdateData sharedData)
             _staticBodiesChart.AddSample(statistics.StaticBodies);
             _newPairsChart.AddSample(statistics.NewPairs);
             _newTouchesChart.AddSample(statistics.NewTouches);
+            _broadPhaseTimeChart.AddSample(statistics.BroadPhaseTime);
+            _narrowPhaseTimeChart.AddSample(statistics.NarrowPhaseTime);
+            _solverTimeChart.AddSample(statistics.SolverTime);
+            _ccdTimeChart.AddSample(statistics.CCDTime);
+            _callbacksTimeChart.AddSample(statistics.CallbacksTime);
         }
 
         /// <inheritdoc />
@@ -108,6 +158,11 @@ public override void UpdateView(int selectedFrame, bool showOnlyLastUpdateEvents
             _staticBodiesChart.SelectedSampleIndex = selectedFrame;
             _newPairsChart.SelectedSampleIndex = selectedFrame;
             _newTouchesChart.SelectedSampleIndex = selectedFrame;
+            _broadPhaseTimeChart.SelectedSampleIndex = selectedFrame;
+            _narrowPhaseTimeChart.SelectedSampleIndex = selectedFrame;
+            _solverTimeChart.SelectedSampleIndex = selectedFrame;
+            _ccdTimeChart.SelectedSampleIndex = selectedFrame;
+            _callbacksTimeChart.SelectedSampleIndex = selectedFrame;
         }
     }
 }
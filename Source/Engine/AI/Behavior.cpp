@@ -3,17 +3,22 @@
 #include "Behavior.h"
 #include "BehaviorKnowledge.h"
 #include "BehaviorTreeNodes.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/TaskGraph.h"
 
+// The amount of behaviors updated within a single job
+#define BEHAVIOR_UPDATE_BATCH_SIZE 16
+
 class BehaviorSystem : public TaskGraphSystem
 {
 public:
     Array<Behavior*> Behaviors;
 
+    static bool SortBehaviors(Behavior* const& a, Behavior* const& b);
     void Job(int32 index);
     void Execute(TaskGraph* graph) override;
 };
@@ -35,10 +40,21 @@ class BehaviorService : public EngineService
 BehaviorService BehaviorServiceInstance;
 TaskGraphSystem* Behavior::System = nullptr;
 
+bool BehaviorSystem::SortBehaviors(Behavior* const& a, Behavior* const& b)
+{
+    // Group behaviors by the tree and then by the states memory location (pooled per-tree)
+    if (a->_knowledge.Tree != b->_knowledge.Tree)
+        return (uintptr)a->_knowledge.Tree < (uintptr)b->_knowledge.Tree;
+    return (uintptr)a->_knowledge.Memory < (uintptr)b->_knowledge.Memory;
+}
+
 void BehaviorSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Behavior.Job");
-    Behaviors[index]->UpdateAsync();
+    const int32 start = index * BEHAVIOR_UPDATE_BATCH_SIZE;
+    const int32 end = Math::Min(start + BEHAVIOR_UPDATE_BATCH_SIZE, Behaviors.Count());
+    for (int32 i = start; i < end; i++)
+        Behaviors.Get()[i]->UpdateAsync();
 }
 
 void BehaviorSystem::Execute(TaskGraph* graph)
@@ -47,12 +63,29 @@ void BehaviorSystem::Execute(TaskGraph* graph)
     if (BehaviorServiceInstance.UpdateList.Count() == 0)
         return;
     Behaviors.Clear();
-    Behaviors.Add(BehaviorServiceInstance.UpdateList);
+    Behaviors.EnsureCapacity(BehaviorServiceInstance.UpdateList.Count());
+    const float time = Time::Update.Time.GetTotalSeconds();
+    for (Behavior* behavior : BehaviorServiceInstance.UpdateList)
+    {
+        // Skip sleeping behaviors (unless sleep timeout has passed)
+        if (behavior->IsSleeping())
+        {
+            if (behavior->_sleepEndTime <= 0.0f || time < behavior->_sleepEndTime)
+                continue;
+            behavior->WakeUp();
+        }
+        Behaviors.Add(behavior);
+    }
+    if (Behaviors.Count() == 0)
+        return;
+
+    // Sort behaviors to update the ones using the same tree together (shared nodes data and contiguous states memory)
+    Sorting::QuickSort(Behaviors.Get(), Behaviors.Count(), &SortBehaviors);
 
-    // Schedule work to update all behaviors in async
+    // Schedule work to update all behaviors in async (in batches)
     Function<void(int32)> job;
     job.Bind<BehaviorSystem, &BehaviorSystem::Job>(this);
-    graph->DispatchJob(job, Behaviors.Count());
+    graph->DispatchJob(job, Math::DivideAndRoundUp(Behaviors.Count(), BEHAVIOR_UPDATE_BATCH_SIZE));
 }
 
 bool BehaviorService::Init()
@@ -77,7 +110,7 @@ Behavior::Behavior(const SpawnParams& params)
 
 void Behavior::UpdateAsync()
 {
-    if (_result != BehaviorUpdateResult::Running)
+    if (_result != BehaviorUpdateResult::Running || IsSleeping())
         return;
     const BehaviorTree* tree = Tree.Get();
     if (!tree || !tree->Graph.Root)
@@ -88,6 +121,12 @@ void Behavior::UpdateAsync()
     }
 
     // Update timer
+    if (_sleepStartTime >= 0.0f)
+    {
+        // Include the time passed during sleep
+        _totalTime += Math::Max(Time::Update.Time.GetTotalSeconds() - _sleepStartTime, 0.0f);
+        _sleepStartTime = -1.0f;
+    }
     _accumulatedTime += Time::Update.DeltaTime.GetTotalSeconds();
     const float updateDeltaTime = 1.0f / Math::Max(tree->Graph.Root->UpdateFPS * UpdateRateScale, ZeroTolerance);
     if (_accumulatedTime < updateDeltaTime)
@@ -139,6 +178,8 @@ void Behavior::StopLogic(BehaviorUpdateResult result)
     PROFILE_CPU();
     _accumulatedTime = 0.0f;
     _totalTime = 0;
+    _sleepStartTime = -1.0f;
+    Platform::AtomicStore(&_sleeping, 0);
     _result = result;
     _knowledge.FreeMemory();
 }
@@ -160,6 +201,22 @@ void Behavior::ResetLogic()
         StartLogic();
 }
 
+void Behavior::Sleep(float duration)
+{
+    if (_result != BehaviorUpdateResult::Running)
+        return;
+    const float time = Time::Update.Time.GetTotalSeconds();
+    if (_sleepStartTime < 0.0f)
+        _sleepStartTime = time;
+    _sleepEndTime = duration > 0.0f ? time + duration : 0.0f;
+    Platform::AtomicStore(&_sleeping, 1);
+}
+
+void Behavior::WakeUp()
+{
+    Platform::AtomicStore(&_sleeping, 0);
+}
+
 void Behavior::OnEnable()
 {
     BehaviorServiceInstance.UpdateList.Add(this);
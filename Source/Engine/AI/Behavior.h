@@ -26,6 +26,9 @@ API_CLASS(Attributes="Category(\"Flax Engine\")") class FLAXENGINE_API Behavior
     BehaviorKnowledge _knowledge;
     float _accumulatedTime = 0.0f;
     float _totalTime = 0.0f;
+    float _sleepStartTime = -1.0f;
+    float _sleepEndTime = 0.0f;
+    int64 _sleeping = 0;
     BehaviorUpdateResult _result = BehaviorUpdateResult::Success;
 
     void UpdateAsync();
@@ -66,6 +69,14 @@ API_CLASS(Attributes="Category(\"Flax Engine\")") class FLAXENGINE_API Behavior
         return _result;
     }
 
+    /// <summary>
+    /// Checks if the behavior is sleeping (logic is not updated until it gets woken up).
+    /// </summary>
+    API_PROPERTY() bool IsSleeping() const
+    {
+        return Platform::AtomicRead(&_sleeping) != 0;
+    }
+
     /// <summary>
     /// Event called when behavior tree execution ends with a result.
     /// </summary>
@@ -87,6 +98,17 @@ API_CLASS(Attributes="Category(\"Flax Engine\")") class FLAXENGINE_API Behavior
     /// </summary>
     API_FUNCTION() void ResetLogic();
 
+    /// <summary>
+    /// Puts the behavior to sleep. Sleeping behavior doesn't update its tree until woken up (via WakeUp, knowledge change or after the timeout). Can be used by behaviors that wait on events to reduce the cost of mostly idle AI. Simulation time advances while sleeping.
+    /// </summary>
+    /// <param name="duration">The maximum sleep duration (in seconds). Use 0 to sleep until woken up.</param>
+    API_FUNCTION() void Sleep(float duration = 0.0f);
+
+    /// <summary>
+    /// Wakes up the sleeping behavior. Called automatically when behavior knowledge gets modified. Can be called from any thread.
+    /// </summary>
+    API_FUNCTION() void WakeUp();
+
     // [Script]
     void OnEnable() override;
     void OnDisable() override;
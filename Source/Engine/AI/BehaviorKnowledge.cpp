@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "BehaviorKnowledge.h"
+#include "Behavior.h"
 #include "BehaviorTree.h"
 #include "BehaviorTreeNodes.h"
 #include "BehaviorKnowledgeSelector.h"
@@ -149,12 +150,13 @@ void BehaviorKnowledge::InitMemory(BehaviorTree* tree)
     if (!tree)
         return;
     Tree = tree;
+    Version++;
     Blackboard = Variant::NewValue(tree->Graph.Root->BlackboardType);
     RelevantNodes.Resize(tree->Graph.NodesCount, false);
     RelevantNodes.SetAll(false);
     if (!Memory && tree->Graph.NodesStatesSize)
     {
-        Memory = Allocator::Allocate(tree->Graph.NodesStatesSize);
+        Memory = tree->StatesPool.Allocate();
 #if !BUILD_RELEASE
         // Clear memory to make it easier to spot missing data issues (eg. zero GCHandle in C# BT node due to missing state init)
         Platform::MemoryClear(Memory, tree->Graph.NodesStatesSize);
@@ -175,12 +177,12 @@ void BehaviorKnowledge::FreeMemory()
         context.RelevantNodes = &RelevantNodes;
         context.DeltaTime = 0.0f;
         context.Time = 0.0f;
-        for (const auto& node : Tree->Graph.Nodes)
+        for (BehaviorTreeNode* node : Tree->Graph.ExecutionNodes)
         {
-            if (node.Instance && node.Instance->_executionIndex != -1 && RelevantNodes[node.Instance->_executionIndex])
-                node.Instance->ReleaseState(context);
+            if (node->_executionIndex < RelevantNodes.Count() && RelevantNodes[node->_executionIndex])
+                node->ReleaseState(context);
         }
-        Allocator::Free(Memory);
+        Tree->StatesPool.Free(Memory);
         Memory = nullptr;
     }
     RelevantNodes.Clear();
@@ -189,6 +191,7 @@ void BehaviorKnowledge::FreeMemory()
         goal.DeleteValue();
     Goals.Resize(0);
     Tree = nullptr;
+    Version++;
 }
 
 bool BehaviorKnowledge::Get(const StringAnsiView& path, Variant& value) const
@@ -198,7 +201,17 @@ bool BehaviorKnowledge::Get(const StringAnsiView& path, Variant& value) const
 
 bool BehaviorKnowledge::Set(const StringAnsiView& path, const Variant& value)
 {
-    return AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true);
+    if (!AccessBehaviorKnowledge(this, path, const_cast<Variant&>(value), true))
+        return false;
+    NotifyChanged();
+    return true;
+}
+
+void BehaviorKnowledge::NotifyChanged()
+{
+    Version++;
+    if (Behavior)
+        Behavior->WakeUp();
 }
 
 bool BehaviorKnowledge::HasGoal(ScriptingTypeHandle type) const
@@ -234,6 +247,7 @@ void BehaviorKnowledge::AddGoal(Variant&& goal)
     if (i == Goals.Count())
         Goals.AddDefault();
     Goals.Get()[i] = MoveTemp(goal);
+    NotifyChanged();
 }
 
 void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
@@ -244,6 +258,7 @@ void BehaviorKnowledge::RemoveGoal(ScriptingTypeHandle type)
         if (goalType == type)
         {
             Goals.RemoveAt(i);
+            NotifyChanged();
             break;
         }
     }
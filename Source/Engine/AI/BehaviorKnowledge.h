@@ -49,6 +49,11 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// </summary>
     API_FIELD() Array<Variant> Goals;
 
+    /// <summary>
+    /// The knowledge data version. Incremented on every change made via Set, goals modification or NotifyChanged. Can be used to detect knowledge changes without polling its values.
+    /// </summary>
+    API_FIELD(ReadOnly) uint32 Version = 0;
+
 public:
     /// <summary>
     /// Initializes the knowledge for a certain tree.
@@ -78,6 +83,11 @@ API_CLASS() class FLAXENGINE_API BehaviorKnowledge : public ScriptingObject
     /// <returns>True if set value, otherwise false.</returns>
     API_FUNCTION() bool Set(const StringAnsiView& path, const Variant& value);
 
+    /// <summary>
+    /// Notifies about the knowledge data modification. Updates the version and wakes up the sleeping behavior. Call it after modifying blackboard or goals directly (eg. fields of the blackboard class object).
+    /// </summary>
+    API_FUNCTION() void NotifyChanged();
+
 public:
     /// <summary>
     /// Checks if knowledge has a given goal (exact type match without base class check).
@@ -17,6 +17,9 @@
 
 REGISTER_BINARY_ASSET(BehaviorTree, "FlaxEngine.BehaviorTree", false);
 
+// The amount of behavior states stored in a single memory page of the pool
+#define BEHAVIOR_TREE_STATES_PAGE_SLOTS 64
+
 #define IS_BT_NODE(n) (n.GroupID == 19 && (n.TypeID == 1 || n.TypeID == 2 || n.TypeID == 3))
 
 bool SortBehaviorTreeChildren(GraphBox* const& a, GraphBox* const& b)
@@ -43,6 +46,7 @@ void BehaviorTreeGraph::Clear()
     Root = nullptr;
     NodesCount = 0;
     NodesStatesSize = 0;
+    ExecutionNodes.Clear();
 }
 
 bool BehaviorTreeGraph::onNodeLoaded(Node* n)
@@ -94,7 +98,9 @@ void BehaviorTreeGraph::Setup(BehaviorTree* tree)
     // Setup nodes hierarchy
     NodesCount = 0;
     NodesStatesSize = 0;
+    ExecutionNodes.Clear();
     SetupRecursive(*root);
+    tree->StatesPool.Init(NodesStatesSize);
 
     // Init graph with asset
     Root->Init(tree);
@@ -108,6 +114,7 @@ void BehaviorTreeGraph::SetupRecursive(Node& node)
     node.Instance->_executionIndex = NodesCount;
     NodesStatesSize += node.Instance->GetStateSize();
     NodesCount++;
+    ExecutionNodes.Add(node.Instance);
 
     if (node.TypeID == 1 && node.Values.Count() >= 3)
     {
@@ -149,6 +156,90 @@ void BehaviorTreeGraph::SetupRecursive(Node& node)
     }
 }
 
+BehaviorTreeStatesPool::~BehaviorTreeStatesPool()
+{
+    for (const Page& page : _pages)
+        Allocator::Free(page.Memory);
+}
+
+void BehaviorTreeStatesPool::Init(int32 size)
+{
+    size = size > 0 ? Math::AlignUp(size, 16) : 0;
+    ScopeLock lock(_locker);
+    if (_slotSize == size)
+        return;
+    _slotSize = size;
+
+    // Release unused pages and retire the ones that still have blocks in use
+    _freeSlots.Clear();
+    for (int32 i = _pages.Count() - 1; i >= 0; i--)
+    {
+        Page& page = _pages[i];
+        if (page.UsedCount == 0)
+        {
+            Allocator::Free(page.Memory);
+            _pages.RemoveAt(i);
+        }
+        else
+        {
+            page.Retired = true;
+        }
+    }
+}
+
+void* BehaviorTreeStatesPool::Allocate()
+{
+    ScopeLock lock(_locker);
+    if (_slotSize == 0)
+        return nullptr;
+    if (_freeSlots.IsEmpty())
+    {
+        // Allocate a new page
+        auto& page = _pages.AddOne();
+        page.Memory = (byte*)Allocator::Allocate(_slotSize * BEHAVIOR_TREE_STATES_PAGE_SLOTS);
+        page.SlotSize = _slotSize;
+        page.UsedCount = 0;
+        page.Retired = false;
+        for (int32 i = BEHAVIOR_TREE_STATES_PAGE_SLOTS - 1; i >= 0; i--)
+            _freeSlots.Add(page.Memory + i * _slotSize);
+    }
+    void* memory = _freeSlots.Pop();
+    for (Page& page : _pages)
+    {
+        if (memory >= page.Memory && memory < page.Memory + page.SlotSize * BEHAVIOR_TREE_STATES_PAGE_SLOTS)
+        {
+            page.UsedCount++;
+            break;
+        }
+    }
+    return memory;
+}
+
+void BehaviorTreeStatesPool::Free(void* memory)
+{
+    if (!memory)
+        return;
+    ScopeLock lock(_locker);
+    for (int32 i = 0; i < _pages.Count(); i++)
+    {
+        Page& page = _pages[i];
+        if (memory >= page.Memory && memory < page.Memory + page.SlotSize * BEHAVIOR_TREE_STATES_PAGE_SLOTS)
+        {
+            page.UsedCount--;
+            if (!page.Retired)
+            {
+                _freeSlots.Add(memory);
+            }
+            else if (page.UsedCount == 0)
+            {
+                Allocator::Free(page.Memory);
+                _pages.RemoveAt(i);
+            }
+            return;
+        }
+    }
+}
+
 BehaviorTree::BehaviorTree(const SpawnParams& params, const AssetInfo* info)
     : BinaryAsset(params, info)
 {
@@ -259,6 +350,7 @@ void BehaviorTree::OnScriptingDispose()
     {
         SAFE_DELETE(n.Instance);
     }
+    Graph.ExecutionNodes.Clear();
 
     BinaryAsset::OnScriptingDispose();
 }
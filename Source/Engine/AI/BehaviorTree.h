@@ -4,6 +4,7 @@
 
 #include "Engine/Content/BinaryAsset.h"
 #include "Engine/Visject/VisjectGraph.h"
+#include "Engine/Platform/CriticalSection.h"
 
 class BehaviorKnowledge;
 class BehaviorTree;
@@ -35,6 +36,8 @@ class BehaviorTreeGraph : public VisjectGraph<BehaviorTreeGraphNode>
     int32 NodesCount = 0;
     // Total size of the nodes states memory.
     int32 NodesStatesSize = 0;
+    // Used nodes in the execution order (indexed by the node execution index). Shared by all behaviors using this tree.
+    Array<BehaviorTreeNode*> ExecutionNodes;
 
     // [VisjectGraph]
     void Clear() override;
@@ -45,6 +48,49 @@ class BehaviorTreeGraph : public VisjectGraph<BehaviorTreeGraphNode>
     void SetupRecursive(Node& node);
 };
 
+/// <summary>
+/// Behavior Tree nodes states memory pool. Allocates per-behavior states memory blocks from the larger pages so states of all behaviors using the same tree are laid out contiguously in memory.
+/// </summary>
+class FLAXENGINE_API BehaviorTreeStatesPool
+{
+private:
+    struct Page
+    {
+        byte* Memory;
+        int32 SlotSize;
+        int32 UsedCount;
+        bool Retired;
+    };
+
+    CriticalSection _locker;
+    Array<Page> _pages;
+    Array<void*> _freeSlots;
+    int32 _slotSize = 0;
+
+public:
+    NON_COPYABLE(BehaviorTreeStatesPool);
+    BehaviorTreeStatesPool() = default;
+    ~BehaviorTreeStatesPool();
+
+    /// <summary>
+    /// Sets the size of the states memory block. Pages with blocks that are still in use (eg. allocated before tree reload) are kept until all their blocks get freed.
+    /// </summary>
+    /// <param name="size">The states memory block size (in bytes).</param>
+    void Init(int32 size);
+
+    /// <summary>
+    /// Allocates the states memory block.
+    /// </summary>
+    /// <returns>The allocated memory or null if states size is zero.</returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Frees the states memory block.
+    /// </summary>
+    /// <param name="memory">The memory allocated via Allocate.</param>
+    void Free(void* memory);
+};
+
 /// <summary>
 /// Behavior Tree graph executor runtime.
 /// </summary>
@@ -66,6 +112,11 @@ API_CLASS(NoSpawn, Sealed) class FLAXENGINE_API BehaviorTree : public BinaryAsse
     /// </summary>
     BehaviorTreeGraph Graph;
 
+    /// <summary>
+    /// The nodes states memory pool for behaviors using this tree.
+    /// </summary>
+    BehaviorTreeStatesPool StatesPool;
+
     /// <summary>
     /// Gets a specific node instance object from Behavior Tree.
     /// </summary>
@@ -694,17 +694,48 @@ void BehaviorTreeCooldownDecorator::PostUpdate(const BehaviorUpdateContext& cont
     }
 }
 
-bool BehaviorTreeKnowledgeConditionalDecorator::CanUpdate(const BehaviorUpdateContext& context)
+int32 BehaviorTreeKnowledgeObserverDecorator::GetStateSize() const
+{
+    return sizeof(State);
+}
+
+void BehaviorTreeKnowledgeObserverDecorator::InitState(const BehaviorUpdateContext& context)
+{
+    auto state = GetState<State>(context.Memory);
+    new(state)State();
+    state->Version = 0;
+    state->Valid = false;
+    state->Result = false;
+}
+
+bool BehaviorTreeKnowledgeObserverDecorator::CanUpdate(const BehaviorUpdateContext& context)
+{
+    if (!ObserveChanges)
+        return Evaluate(context);
+
+    // Reuse the last result if knowledge is unchanged
+    auto state = GetState<State>(context.Memory);
+    const uint32 version = context.Knowledge->Version;
+    if (!state->Valid || state->Version != version)
+    {
+        state->Version = version;
+        state->Valid = true;
+        state->Result = Evaluate(context);
+    }
+    return state->Result;
+}
+
+bool BehaviorTreeKnowledgeConditionalDecorator::Evaluate(const BehaviorUpdateContext& context)
 {
     return BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), ValueB, Comparison);
 }
 
-bool BehaviorTreeKnowledgeValuesConditionalDecorator::CanUpdate(const BehaviorUpdateContext& context)
+bool BehaviorTreeKnowledgeValuesConditionalDecorator::Evaluate(const BehaviorUpdateContext& context)
 {
     return BehaviorKnowledge::CompareValues((float)ValueA.Get(context.Knowledge), (float)ValueB.Get(context.Knowledge), Comparison);
 }
 
-bool BehaviorTreeKnowledgeBooleanDecorator::CanUpdate(const BehaviorUpdateContext& context)
+bool BehaviorTreeKnowledgeBooleanDecorator::Evaluate(const BehaviorUpdateContext& context)
 {
     Variant value = Value.Get(context.Knowledge);
     bool result = (bool)value;
@@ -722,7 +753,7 @@ bool BehaviorTreeHasTagDecorator::CanUpdate(const BehaviorUpdateContext& context
     return result;
 }
 
-bool BehaviorTreeHasGoalDecorator::CanUpdate(const BehaviorUpdateContext& context)
+bool BehaviorTreeHasGoalDecorator::Evaluate(const BehaviorUpdateContext& context)
 {
     Variant value; // TODO: use HasGoal in Knowledge to optimize this (goal struct is copied by selector accessor)
     return Goal.TryGet(context.Knowledge, value);
@@ -395,12 +395,46 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeCooldownDecorator : public Be
     };
 };
 
+/// <summary>
+/// Base class for decorators that check the behavior knowledge values to conditionally enter the node. Can observe knowledge changes to skip the condition evaluation when knowledge is unchanged.
+/// </summary>
+API_CLASS(Abstract) class FLAXENGINE_API BehaviorTreeKnowledgeObserverDecorator : public BehaviorTreeDecorator
+{
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeObserverDecorator, BehaviorTreeDecorator);
+    API_AUTO_SERIALIZATION();
+
+    // If checked, the condition is evaluated again only after the knowledge changes (see BehaviorKnowledge.Version), otherwise it's checked on every update. Use it only when knowledge is modified via Set (or NotifyChanged is called).
+    API_FIELD(Attributes="EditorOrder(1000)")
+    bool ObserveChanges = false;
+
+protected:
+    // Evaluates the condition.
+    virtual bool Evaluate(const BehaviorUpdateContext& context)
+    {
+        return true;
+    }
+
+public:
+    // [BehaviorTreeNode]
+    int32 GetStateSize() const override;
+    void InitState(const BehaviorUpdateContext& context) override;
+    bool CanUpdate(const BehaviorUpdateContext& context) override;
+
+private:
+    struct State
+    {
+        uint32 Version;
+        bool Valid;
+        bool Result;
+    };
+};
+
 /// <summary>
 /// Checks certain knowledge value to conditionally enter the node.
 /// </summary>
-API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeConditionalDecorator : public BehaviorTreeDecorator
+API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeConditionalDecorator : public BehaviorTreeKnowledgeObserverDecorator
 {
-    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeConditionalDecorator, BehaviorTreeDecorator);
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeConditionalDecorator, BehaviorTreeKnowledgeObserverDecorator);
     API_AUTO_SERIALIZATION();
 
     // The first value from behavior's knowledge (blackboard, goal or sensor) to use for comparision.
@@ -416,16 +450,16 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeConditionalDecorator
     BehaviorValueComparison Comparison = BehaviorValueComparison::Equal;
 
 public:
-    // [BehaviorTreeNode]
-    bool CanUpdate(const BehaviorUpdateContext& context) override;
+    // [BehaviorTreeKnowledgeObserverDecorator]
+    bool Evaluate(const BehaviorUpdateContext& context) override;
 };
 
 /// <summary>
 /// Checks certain knowledge value to conditionally enter the node.
 /// </summary>
-API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeValuesConditionalDecorator : public BehaviorTreeDecorator
+API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeValuesConditionalDecorator : public BehaviorTreeKnowledgeObserverDecorator
 {
-    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeValuesConditionalDecorator, BehaviorTreeDecorator);
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeValuesConditionalDecorator, BehaviorTreeKnowledgeObserverDecorator);
     API_AUTO_SERIALIZATION();
 
     // The first value from behavior's knowledge (blackboard, goal or sensor) to use for comparision.
@@ -441,16 +475,16 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeValuesConditionalDec
     BehaviorValueComparison Comparison = BehaviorValueComparison::Equal;
 
 public:
-    // [BehaviorTreeNode]
-    bool CanUpdate(const BehaviorUpdateContext& context) override;
+    // [BehaviorTreeKnowledgeObserverDecorator]
+    bool Evaluate(const BehaviorUpdateContext& context) override;
 };
 
 /// <summary>
 /// Checks certain knowledge value to conditionally enter the node if the value is set (eg. not-null object reference or boolean value).
 /// </summary>
-API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeBooleanDecorator : public BehaviorTreeDecorator
+API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeBooleanDecorator : public BehaviorTreeKnowledgeObserverDecorator
 {
-    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeBooleanDecorator, BehaviorTreeDecorator);
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeKnowledgeBooleanDecorator, BehaviorTreeKnowledgeObserverDecorator);
     API_AUTO_SERIALIZATION();
 
     // The value from behavior's knowledge (blackboard, goal or sensor) to check if it's set (eg. not-null object reference or boolean value).
@@ -462,8 +496,8 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeKnowledgeBooleanDecorator : p
     bool Invert = false;
 
 public:
-    // [BehaviorTreeNode]
-    bool CanUpdate(const BehaviorUpdateContext& context) override;
+    // [BehaviorTreeKnowledgeObserverDecorator]
+    bool Evaluate(const BehaviorUpdateContext& context) override;
 };
 
 /// <summary>
@@ -494,9 +528,9 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeHasTagDecorator : public Beha
 /// <summary>
 /// Checks if certain goal has been added to Behavior knowledge.
 /// </summary>
-API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeHasGoalDecorator : public BehaviorTreeDecorator
+API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeHasGoalDecorator : public BehaviorTreeKnowledgeObserverDecorator
 {
-    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeHasGoalDecorator, BehaviorTreeDecorator);
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(BehaviorTreeHasGoalDecorator, BehaviorTreeKnowledgeObserverDecorator);
     API_AUTO_SERIALIZATION();
 
     // The goal type to check.
@@ -504,6 +538,6 @@ API_CLASS(Sealed) class FLAXENGINE_API BehaviorTreeHasGoalDecorator : public Beh
     BehaviorKnowledgeSelectorAny Goal;
 
 public:
-    // [BehaviorTreeNode]
-    bool CanUpdate(const BehaviorUpdateContext& context) override;
+    // [BehaviorTreeKnowledgeObserverDecorator]
+    bool Evaluate(const BehaviorUpdateContext& context) override;
 };
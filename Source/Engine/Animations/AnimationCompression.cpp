@@ -0,0 +1,310 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "AnimationCompression.h"
+#include "AnimationData.h"
+#include "AnimationUtils.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+#define ROTATION_COMPONENT_MAX 32767.0f
+#define ROTATION_COMPONENT_RANGE 0.70710678118f
+
+namespace
+{
+    typedef CompressedAnimationData::Track Track;
+    typedef CompressedAnimationData::TrackType TrackType;
+
+    FORCE_INLINE float GetError(const Float3& a, const Float3& b)
+    {
+        return Float3::Distance(a, b);
+    }
+
+    FORCE_INLINE float GetError(const Quaternion& a, const Quaternion& b)
+    {
+        return 2.0f * Math::Acos(Math::Min(Math::Abs(Quaternion::Dot(a, b)), 1.0f));
+    }
+
+    FORCE_INLINE void SetConstant(Track& track, const Float3& value)
+    {
+        track.Value = Float4(value, 0.0f);
+    }
+
+    FORCE_INLINE void SetConstant(Track& track, const Quaternion& value)
+    {
+        Quaternion q = value;
+        q.Normalize();
+        track.Value = Float4(q.X, q.Y, q.Z, q.W);
+    }
+
+    FORCE_INLINE void GetConstant(const Track& track, Float3& result)
+    {
+        result = Float3(track.Value.X, track.Value.Y, track.Value.Z);
+    }
+
+    FORCE_INLINE void GetConstant(const Track& track, Quaternion& result)
+    {
+        result = Quaternion(track.Value.X, track.Value.Y, track.Value.Z, track.Value.W);
+    }
+
+    void InitQuantization(Track& track, const LinearCurveKeyframe<Float3>* keys, const Array<int32>& indices)
+    {
+        Float3 min = keys[indices[0]].Value, max = min;
+        for (int32 i = 1; i < indices.Count(); i++)
+        {
+            const Float3& value = keys[indices[i]].Value;
+            min = Float3::Min(min, value);
+            max = Float3::Max(max, value);
+        }
+        track.Value = Float4(min, 0.0f);
+        track.Range = (max - min) / (float)MAX_uint16;
+    }
+
+    void InitQuantization(Track& track, const LinearCurveKeyframe<Quaternion>* keys, const Array<int32>& indices)
+    {
+        // Rotations use the fixed quantization range
+    }
+
+    FORCE_INLINE void Quantize(const Track& track, const Float3& value, uint16* result)
+    {
+        for (int32 i = 0; i < 3; i++)
+            result[i] = track.Range.Raw[i] > ZeroTolerance ? (uint16)Math::Clamp(Math::RoundToInt((value.Raw[i] - track.Value.Raw[i]) / track.Range.Raw[i]), 0, (int32)MAX_uint16) : 0;
+    }
+
+    FORCE_INLINE void Quantize(const Track& track, const Quaternion& value, uint16* result)
+    {
+        // Smallest-three encoding: 2 bits for the index of the largest component (skipped) and 15 bits for each of the remaining components
+        Quaternion q = value;
+        q.Normalize();
+        int32 largest = 0;
+        for (int32 i = 1; i < 4; i++)
+        {
+            if (Math::Abs(q.Raw[i]) > Math::Abs(q.Raw[largest]))
+                largest = i;
+        }
+        const float sign = q.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+        uint64 packed = (uint64)largest << 45;
+        int32 shift = 30;
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (i == largest)
+                continue;
+            const float normalized = Math::Saturate(q.Raw[i] * sign / ROTATION_COMPONENT_RANGE * 0.5f + 0.5f);
+            packed |= (uint64)Math::RoundToInt(normalized * ROTATION_COMPONENT_MAX) << shift;
+            shift -= 15;
+        }
+        result[0] = (uint16)(packed & 0xffff);
+        result[1] = (uint16)((packed >> 16) & 0xffff);
+        result[2] = (uint16)((packed >> 32) & 0xffff);
+    }
+
+    FORCE_INLINE void Dequantize(const Track& track, const uint16* data, Float3& result)
+    {
+        result.X = track.Value.X + (float)data[0] * track.Range.X;
+        result.Y = track.Value.Y + (float)data[1] * track.Range.Y;
+        result.Z = track.Value.Z + (float)data[2] * track.Range.Z;
+    }
+
+    FORCE_INLINE void Dequantize(const Track& track, const uint16* data, Quaternion& result)
+    {
+        const uint64 packed = (uint64)data[0] | ((uint64)data[1] << 16) | ((uint64)data[2] << 32);
+        const int32 largest = (int32)(packed >> 45) & 3;
+        int32 shift = 30;
+        float sumSq = 0.0f;
+        for (int32 i = 0; i < 4; i++)
+        {
+            if (i == largest)
+                continue;
+            const float value = ((float)((packed >> shift) & 0x7fff) / ROTATION_COMPONENT_MAX * 2.0f - 1.0f) * ROTATION_COMPONENT_RANGE;
+            result.Raw[i] = value;
+            sumSq += value * value;
+            shift -= 15;
+        }
+        result.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sumSq, 0.0f));
+    }
+
+    template<typename T>
+    void ReduceKeys(const LinearCurveKeyframe<T>* keys, int32 count, float tolerance, Array<int32>& result)
+    {
+        // Greedy error-bounded reduction: extend each linear segment as long as all skipped keyframes stay within the tolerance
+        result.Clear();
+        result.Add(0);
+        int32 anchor = 0;
+        for (int32 end = 2; end < count; end++)
+        {
+            const auto& a = keys[anchor];
+            const auto& b = keys[end];
+            const float length = b.Time - a.Time;
+            bool valid = true;
+            for (int32 i = anchor + 1; i < end && valid; i++)
+            {
+                const float alpha = length > ZeroTolerance ? (keys[i].Time - a.Time) / length : 0.0f;
+                T value;
+                AnimationUtils::Interpolate(a.Value, b.Value, alpha, value);
+                valid = GetError(value, keys[i].Value) <= tolerance;
+            }
+            if (!valid)
+            {
+                anchor = end - 1;
+                result.Add(anchor);
+            }
+        }
+        if (count > 1)
+            result.Add(count - 1);
+    }
+
+    template<typename T>
+    bool CompressTrack(const LinearCurve<T>& curve, float tolerance, Track& track, Array<uint16>& data, Array<int32>& indices)
+    {
+        const auto& keyframes = curve.GetKeyframes();
+        const LinearCurveKeyframe<T>* keys = keyframes.Get();
+        const int32 count = keyframes.Count();
+        track = Track();
+        if (count == 0)
+            return false;
+
+        // Constant track elimination
+        bool isConstant = true;
+        for (int32 i = 1; i < count && isConstant; i++)
+            isConstant = GetError(keys[0].Value, keys[i].Value) <= tolerance;
+        if (isConstant)
+        {
+            track.Type = TrackType::Constant;
+            track.KeysCount = 1;
+            SetConstant(track, keys[0].Value);
+            return false;
+        }
+
+        // Keyframes reduction
+        ReduceKeys(keys, count, tolerance, indices);
+        if (indices.Count() > MAX_uint16)
+            return true;
+        track.Type = TrackType::Animated;
+        track.KeysCount = indices.Count();
+        track.DataOffset = data.Count();
+
+        // Quantize times (use exact frame indices if keys are placed at whole frames)
+        const float timeStart = keys[indices.First()].Time;
+        const float timeRange = keys[indices.Last()].Time - timeStart;
+        bool wholeFrames = timeRange <= (float)MAX_uint16;
+        for (int32 i = 0; i < indices.Count() && wholeFrames; i++)
+        {
+            const float time = keys[indices[i]].Time - timeStart;
+            wholeFrames = Math::Abs(time - Math::Round(time)) < 0.001f;
+        }
+        track.TimeStart = timeStart;
+        track.TimeScale = wholeFrames ? 1.0f : timeRange / (float)MAX_uint16;
+        track.TimeScaleInv = track.TimeScale > ZeroTolerance ? 1.0f / track.TimeScale : 0.0f;
+        data.AddUninitialized(track.KeysCount * 4);
+        uint16* times = data.Get() + track.DataOffset;
+        for (int32 i = 0; i < indices.Count(); i++)
+            times[i] = (uint16)Math::Clamp(Math::RoundToInt((keys[indices[i]].Time - timeStart) * track.TimeScaleInv), 0, (int32)MAX_uint16);
+
+        // Quantize values
+        InitQuantization(track, keys, indices);
+        uint16* values = times + track.KeysCount;
+        for (int32 i = 0; i < indices.Count(); i++)
+            Quantize(track, keys[indices[i]].Value, values + i * 3);
+        return false;
+    }
+
+    template<typename T>
+    FORCE_INLINE void EvaluateTrack(const Track& track, const uint16* data, float time, T& result)
+    {
+        if (track.Type == TrackType::Constant)
+        {
+            GetConstant(track, result);
+            return;
+        }
+
+        // Find keys around the time (binary search over the packed quantized times)
+        const uint16* times = data + track.DataOffset;
+        const int32 last = track.KeysCount - 1;
+        const float position = Math::Clamp((time - track.TimeStart) * track.TimeScaleInv, 0.0f, (float)times[last]);
+        int32 start = 0, end = last;
+        while (end - start > 1)
+        {
+            const int32 middle = (start + end) >> 1;
+            if ((float)times[middle] <= position)
+                start = middle;
+            else
+                end = middle;
+        }
+        const float length = (float)(times[end] - times[start]);
+        const float alpha = length > 0.0f ? Math::Saturate((position - (float)times[start]) / length) : 0.0f;
+
+        // Interpolate between the decoded keys
+        const uint16* values = times + track.KeysCount;
+        T a, b;
+        Dequantize(track, values + start * 3, a);
+        Dequantize(track, values + end * 3, b);
+        AnimationUtils::Interpolate(a, b, alpha, result);
+    }
+}
+
+bool CompressedAnimationData::Compress(const AnimationData& data, const Settings& settings)
+{
+    PROFILE_CPU();
+    Clear();
+    _channels.Resize(data.Channels.Count());
+    Array<int32> indices;
+    bool failed = false;
+    for (int32 i = 0; i < data.Channels.Count() && !failed; i++)
+    {
+        const NodeAnimationData& src = data.Channels[i];
+        Channel& dst = _channels[i];
+        failed |= CompressTrack(src.Position, settings.PositionTolerance, dst.Position, _data, indices);
+        failed |= CompressTrack(src.Rotation, settings.RotationTolerance, dst.Rotation, _data, indices);
+        failed |= CompressTrack(src.Scale, settings.ScaleTolerance, dst.Scale, _data, indices);
+    }
+    if (failed)
+    {
+        LOG(Warning, "Failed to compress animation '{0}'. Too many keyframes in a single track.", data.Name);
+        Clear();
+    }
+    return failed;
+}
+
+void CompressedAnimationData::Evaluate(int32 channelIndex, float time, Transform* result) const
+{
+    const Channel& channel = _channels[channelIndex];
+    const uint16* data = _data.Get();
+    if (channel.Position.Type != TrackType::Empty)
+#if USE_LARGE_WORLDS
+    {
+        Float3 position;
+        EvaluateTrack(channel.Position, data, time, position);
+        result->Translation = position;
+    }
+#else
+        EvaluateTrack(channel.Position, data, time, result->Translation);
+#endif
+    if (channel.Rotation.Type != TrackType::Empty)
+        EvaluateTrack(channel.Rotation, data, time, result->Orientation);
+    if (channel.Scale.Type != TrackType::Empty)
+        EvaluateTrack(channel.Scale, data, time, result->Scale);
+}
+
+int32 CompressedAnimationData::GetKeyframesCount() const
+{
+    int32 result = 0;
+    for (const Channel& e : _channels)
+        result += e.Position.KeysCount + e.Rotation.KeysCount + e.Scale.KeysCount;
+    return result;
+}
+
+uint64 CompressedAnimationData::GetMemoryUsage() const
+{
+    return _channels.Capacity() * sizeof(Channel) + _data.Capacity() * sizeof(uint16);
+}
+
+void CompressedAnimationData::Swap(CompressedAnimationData& other)
+{
+    _channels.Swap(other._channels);
+    _data.Swap(other._data);
+}
+
+void CompressedAnimationData::Clear()
+{
+    _channels.Resize(0);
+    _data.Resize(0);
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Core/Math/Transform.h"
+
+struct AnimationData;
+
+/// <summary>
+/// Compressed skeleton nodes animation data. Stores the node channels as keyframe-reduced tracks with quantized keys (16-bit times, range-reduced 16-bit positions and scales, smallest-three 48-bit rotations) packed in a single buffer to reduce memory usage and improve cache coherency of the animation sampling.
+/// </summary>
+class FLAXENGINE_API CompressedAnimationData
+{
+public:
+    /// <summary>
+    /// The animation compression settings (maximum error tolerances used by the keyframes reduction).
+    /// </summary>
+    struct Settings
+    {
+        /// <summary>
+        /// The maximum error of the node position (in units).
+        /// </summary>
+        float PositionTolerance = 0.01f;
+
+        /// <summary>
+        /// The maximum error of the node rotation (in radians).
+        /// </summary>
+        float RotationTolerance = 0.0002f;
+
+        /// <summary>
+        /// The maximum error of the node scale.
+        /// </summary>
+        float ScaleTolerance = 0.0001f;
+    };
+
+    /// <summary>
+    /// The compressed track type.
+    /// </summary>
+    enum class TrackType : byte
+    {
+        // Track has no data (node transformation component is not animated).
+        Empty,
+        // Track has a single value for the whole animation.
+        Constant,
+        // Track has a quantized keyframes data.
+        Animated,
+    };
+
+    /// <summary>
+    /// The compressed track descriptor (position, rotation or scale of the single node).
+    /// </summary>
+    struct Track
+    {
+        TrackType Type = TrackType::Empty;
+        int32 KeysCount = 0;
+        // Offset of the track data in the buffer: quantized keys times (KeysCount items) followed by the quantized keys values (3 * KeysCount items).
+        int32 DataOffset = 0;
+        float TimeStart = 0.0f;
+        float TimeScale = 0.0f;
+        float TimeScaleInv = 0.0f;
+        // The constant value (XYZ for vectors, XYZW for rotations) or the minimum of the quantization range.
+        Float4 Value = Float4::Zero;
+        // The quantization step (range size divided by the maximum quantized value).
+        Float3 Range = Float3::Zero;
+    };
+
+    /// <summary>
+    /// The compressed node animation channel.
+    /// </summary>
+    struct Channel
+    {
+        Track Position;
+        Track Rotation;
+        Track Scale;
+    };
+
+private:
+    Array<Channel> _channels;
+    Array<uint16> _data;
+
+public:
+    /// <summary>
+    /// Returns true if the animation data has been compressed.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return _channels.HasItems();
+    }
+
+    /// <summary>
+    /// Gets the compressed channels (matching the source animation channels order).
+    /// </summary>
+    FORCE_INLINE const Array<Channel>& GetChannels() const
+    {
+        return _channels;
+    }
+
+    /// <summary>
+    /// Compresses the animation channels.
+    /// </summary>
+    /// <param name="data">The source animation data.</param>
+    /// <param name="settings">The compression settings.</param>
+    /// <returns>True if failed to compress the data (eg. track has too many keyframes), otherwise false.</returns>
+    bool Compress(const AnimationData& data, const Settings& settings);
+
+    /// <summary>
+    /// Evaluates the node animation transformation at the specified time (only for the tracks with non-empty data). Time is clamped to the animation range.
+    /// </summary>
+    /// <param name="channelIndex">The index of the channel to evaluate.</param>
+    /// <param name="time">The time to evaluate the tracks at (in frames).</param>
+    /// <param name="result">The interpolated transformation at provided time.</param>
+    void Evaluate(int32 channelIndex, float time, Transform* result) const;
+
+    /// <summary>
+    /// Gets the total amount of keyframes in the all compressed tracks.
+    /// </summary>
+    int32 GetKeyframesCount() const;
+
+    uint64 GetMemoryUsage() const;
+
+    /// <summary>
+    /// Swaps the contents of object with the other object without copy operation.
+    /// </summary>
+    /// <param name="other">The other object.</param>
+    void Swap(CompressedAnimationData& other);
+
+    /// <summary>
+    /// Releases data.
+    /// </summary>
+    void Clear();
+};
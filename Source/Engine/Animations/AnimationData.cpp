@@ -1,6 +1,54 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "AnimationData.h"
+#include "CurveSerialization.h"
+
+namespace
+{
+    template<typename T>
+    void SerializeCurveRange(WriteStream& stream, const LinearCurve<T>& curve, float start, float end)
+    {
+        const auto& keyframes = curve.GetKeyframes();
+        if (keyframes.IsEmpty())
+        {
+            stream.WriteInt32(0);
+            return;
+        }
+
+        // Include the last keyframe before the range and the first one after it to keep the same interpolation within the range
+        int32 first = 0, last = keyframes.Count() - 1;
+        while (first < last && keyframes[first + 1].Time <= start)
+            first++;
+        while (last > first && keyframes[last - 1].Time >= end)
+            last--;
+
+        // Use the same format as the curve serialization
+        const int32 count = last - first + 1;
+        stream.WriteInt32(1);
+        stream.WriteInt32(count);
+        stream.WriteBytes(keyframes.Get() + first, count * sizeof(LinearCurveKeyframe<T>));
+    }
+
+    template<typename T>
+    void AppendCurve(LinearCurve<T>& curve, LinearCurve<T>& other)
+    {
+        auto& keyframes = curve.GetKeyframes();
+        auto& otherKeyframes = other.GetKeyframes();
+        if (keyframes.IsEmpty())
+        {
+            keyframes.Swap(otherKeyframes);
+            return;
+        }
+
+        // Skip the keyframes shared by the both segments (at the boundaries)
+        const float lastTime = keyframes.Last().Time;
+        for (const auto& k : otherKeyframes)
+        {
+            if (k.Time > lastTime)
+                keyframes.Add(k);
+        }
+    }
+}
 
 void NodeAnimationData::Evaluate(float time, Transform* result, bool loop) const
 {
@@ -39,17 +87,53 @@ uint64 NodeAnimationData::GetMemoryUsage() const
     return NodeName.Length() * sizeof(Char) + Position.GetMemoryUsage() + Rotation.GetMemoryUsage() + Scale.GetMemoryUsage();
 }
 
+uint64 AnimationSegment::GetMemoryUsage() const
+{
+    uint64 result = Channels.Capacity() * sizeof(NodeAnimationData);
+    for (const auto& e : Channels)
+        result += e.GetMemoryUsage();
+    result += Compressed.GetMemoryUsage();
+    return result;
+}
+
+void AnimationSegment::Release()
+{
+    Channels.Resize(0);
+    Compressed.Clear();
+}
+
 uint64 AnimationData::GetMemoryUsage() const
 {
     uint64 result = (Name.Length() + RootNodeName.Length()) * sizeof(Char) + Channels.Capacity() * sizeof(NodeAnimationData);
     for (const auto& e : Channels)
         result += e.GetMemoryUsage();
+    result += Compressed.GetMemoryUsage();
+    result += Segments.Capacity() * sizeof(AnimationSegment);
+    for (const auto& e : Segments)
+        result += e.GetMemoryUsage();
     return result;
 }
 
 int32 AnimationData::GetKeyframesCount() const
 {
     int32 result = 0;
+    if (Segments.HasItems())
+    {
+        // Count only the loaded segments
+        for (const auto& segment : Segments)
+        {
+            if (segment.Compressed.IsValid())
+                result += segment.Compressed.GetKeyframesCount();
+            else
+            {
+                for (int32 i = 0; i < segment.Channels.Count(); i++)
+                    result += segment.Channels[i].GetKeyframesCount();
+            }
+        }
+        return result;
+    }
+    if (Compressed.IsValid())
+        return Compressed.GetKeyframesCount();
     for (int32 i = 0; i < Channels.Count(); i++)
         result += Channels[i].GetKeyframesCount();
     return result;
@@ -63,6 +147,99 @@ NodeAnimationData* AnimationData::GetChannel(const StringView& name)
     return nullptr;
 }
 
+void AnimationData::EvaluateSegmentChannel(int32 channelIndex, float time, Transform* result) const
+{
+    // Find the segment at the given time
+    int32 index = 0;
+    while (index + 1 < Segments.Count() && Segments.Get()[index + 1].Start <= time)
+        index++;
+    const AnimationSegment* segment = &Segments.Get()[index];
+    segment->Used = true;
+    segment->UsedPosition = time;
+
+    if (!segment->IsLoaded())
+    {
+        // Use the closest loaded segment until the sampled one gets streamed in (sampling gets clamped to the segment range)
+        segment = nullptr;
+        for (int32 offset = 1; offset < Segments.Count() && !segment; offset++)
+        {
+            if (index - offset >= 0 && Segments.Get()[index - offset].IsLoaded())
+                segment = &Segments.Get()[index - offset];
+            else if (index + offset < Segments.Count() && Segments.Get()[index + offset].IsLoaded())
+                segment = &Segments.Get()[index + offset];
+        }
+        if (!segment)
+            return;
+    }
+
+    segment->Evaluate(channelIndex, time, result);
+}
+
+void AnimationData::GetStreamingSegments(Array<float, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS + 1>>& result) const
+{
+    result.Clear();
+    const float length = GetLength();
+    if (length < ANIM_STREAMING_MIN_LENGTH)
+        return;
+    const int32 count = Math::Min(Math::CeilToInt(length / ANIM_STREAMING_SEGMENT_LENGTH), ANIM_STREAMING_MAX_SEGMENTS);
+    const float segmentDuration = (float)Duration / (float)count;
+    for (int32 i = 0; i < count; i++)
+        result.Add(segmentDuration * (float)i);
+    result.Add((float)Duration);
+}
+
+void AnimationData::SerializeSegment(WriteStream& stream, float start, float end) const
+{
+    for (const auto& channel : Channels)
+    {
+        SerializeCurveRange(stream, channel.Position, start, end);
+        SerializeCurveRange(stream, channel.Rotation, start, end);
+        SerializeCurveRange(stream, channel.Scale, start, end);
+    }
+}
+
+bool AnimationData::DeserializeSegment(ReadStream& stream, Array<NodeAnimationData>& channels, bool append)
+{
+    NodeAnimationData tmp;
+    for (auto& channel : channels)
+    {
+        if (append)
+        {
+            if (Serialization::Deserialize(stream, tmp.Position) ||
+                Serialization::Deserialize(stream, tmp.Rotation) ||
+                Serialization::Deserialize(stream, tmp.Scale))
+                return true;
+            AppendCurve(channel.Position, tmp.Position);
+            AppendCurve(channel.Rotation, tmp.Rotation);
+            AppendCurve(channel.Scale, tmp.Scale);
+        }
+        else
+        {
+            if (Serialization::Deserialize(stream, channel.Position) ||
+                Serialization::Deserialize(stream, channel.Rotation) ||
+                Serialization::Deserialize(stream, channel.Scale))
+                return true;
+        }
+    }
+    return false;
+}
+
+bool AnimationData::Compress(const CompressedAnimationData::Settings& settings, bool releaseSource)
+{
+    if (Compressed.Compress(*this, settings))
+        return true;
+    if (releaseSource)
+    {
+        for (auto& e : Channels)
+        {
+            e.Position.GetKeyframes().SetCapacity(0, false);
+            e.Rotation.GetKeyframes().SetCapacity(0, false);
+            e.Scale.GetKeyframes().SetCapacity(0, false);
+        }
+    }
+    return false;
+}
+
 void AnimationData::Swap(AnimationData& other)
 {
     ::Swap(Duration, other.Duration);
@@ -71,6 +248,8 @@ void AnimationData::Swap(AnimationData& other)
     ::Swap(Name, other.Name);
     ::Swap(RootNodeName, other.RootNodeName);
     Channels.Swap(other.Channels);
+    Compressed.Swap(other.Compressed);
+    Segments.Swap(other.Segments);
 }
 
 void AnimationData::Dispose()
@@ -81,4 +260,6 @@ void AnimationData::Dispose()
     RootNodeName.Clear();
     RootMotionFlags = AnimationRootMotionFlags::None;
     Channels.Resize(0);
+    Compressed.Clear();
+    Segments.Resize(0);
 }
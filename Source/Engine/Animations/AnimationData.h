@@ -6,6 +6,11 @@
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Core/Math/Transform.h"
 #include "Engine/Animations/Curve.h"
+#include "Engine/Animations/AnimationCompression.h"
+#include "Engine/Animations/Config.h"
+
+class ReadStream;
+class WriteStream;
 
 /// <summary>
 /// Single node animation data container.
@@ -69,6 +74,77 @@ struct NodeAnimationData
     uint64 GetMemoryUsage() const;
 };
 
+/// <summary>
+/// Single time segment of the streamed animation data. Long animation clips are split into segments (stored in separate asset chunks) that are loaded only near the playback position.
+/// </summary>
+struct AnimationSegment
+{
+    /// <summary>
+    /// The segment start time (in frames).
+    /// </summary>
+    float Start = 0.0f;
+
+    /// <summary>
+    /// The segment end time (in frames).
+    /// </summary>
+    float End = 0.0f;
+
+    /// <summary>
+    /// The segment channels keyframes (matching the animation channels order, node names are not used). Empty if segment data is not loaded.
+    /// </summary>
+    Array<NodeAnimationData> Channels;
+
+    /// <summary>
+    /// The compressed segment channels data. Used for sampling instead of the channel curves if valid.
+    /// </summary>
+    CompressedAnimationData Compressed;
+
+    /// <summary>
+    /// True if segment has been sampled since the last streaming update. Consumed by the streaming.
+    /// </summary>
+    mutable bool Used = false;
+
+    /// <summary>
+    /// The last sampled time of the segment (in frames).
+    /// </summary>
+    mutable float UsedPosition = 0.0f;
+
+    /// <summary>
+    /// The last time (platform time in seconds) when segment has been used. Updated by the streaming.
+    /// </summary>
+    double LastUsedTime = MIN_double;
+
+public:
+    /// <summary>
+    /// Returns true if the segment data is loaded.
+    /// </summary>
+    FORCE_INLINE bool IsLoaded() const
+    {
+        return Channels.HasItems();
+    }
+
+    /// <summary>
+    /// Evaluates the node animation channel transformation at the specified time (only for the curves with non-empty data). Time is clamped to the segment data range.
+    /// </summary>
+    /// <param name="channelIndex">The index of the channel to evaluate.</param>
+    /// <param name="time">The time to evaluate the channel at (in frames).</param>
+    /// <param name="result">The interpolated transformation at provided time.</param>
+    FORCE_INLINE void Evaluate(int32 channelIndex, float time, Transform* result) const
+    {
+        if (Compressed.IsValid())
+            Compressed.Evaluate(channelIndex, time, result);
+        else
+            Channels[channelIndex].Evaluate(time, result, false);
+    }
+
+    uint64 GetMemoryUsage() const;
+
+    /// <summary>
+    /// Releases the segment data.
+    /// </summary>
+    void Release();
+};
+
 /// <summary>
 /// Single track with events.
 /// </summary>
@@ -140,6 +216,16 @@ struct AnimationData
     /// </summary>
     Array<Pair<String, StepCurve<EventAnimationData>>> Events;
 
+    /// <summary>
+    /// The compressed animation channels data. Used for sampling instead of the channel curves if valid.
+    /// </summary>
+    CompressedAnimationData Compressed;
+
+    /// <summary>
+    /// The streamed time segments of the animation data (sorted by time). Used for sampling instead of the channel curves if not empty (channels contain only node names).
+    /// </summary>
+    Array<AnimationSegment> Segments;
+
 public:
     /// <summary>
     /// Gets the length of the animation (in seconds).
@@ -161,6 +247,61 @@ struct AnimationData
 
     NodeAnimationData* GetChannel(const StringView& name);
 
+    /// <summary>
+    /// Evaluates the node animation channel transformation at the specified time (only for the curves with non-empty data). Time is clamped to the animation range. Uses compressed data if available.
+    /// </summary>
+    /// <param name="channelIndex">The index of the channel to evaluate.</param>
+    /// <param name="time">The time to evaluate the channel at (in frames).</param>
+    /// <param name="result">The interpolated transformation at provided time.</param>
+    FORCE_INLINE void EvaluateChannel(int32 channelIndex, float time, Transform* result) const
+    {
+        if (Segments.HasItems())
+            EvaluateSegmentChannel(channelIndex, time, result);
+        else if (Compressed.IsValid())
+            Compressed.Evaluate(channelIndex, time, result);
+        else
+            Channels[channelIndex].Evaluate(time, result, false);
+    }
+
+    /// <summary>
+    /// Evaluates the node animation channel transformation at the specified time using the streamed segments. Marks the sampled segment as used. Uses the closest loaded segment if the sampled one is not loaded yet.
+    /// </summary>
+    /// <param name="channelIndex">The index of the channel to evaluate.</param>
+    /// <param name="time">The time to evaluate the channel at (in frames).</param>
+    /// <param name="result">The interpolated transformation at provided time.</param>
+    void EvaluateSegmentChannel(int32 channelIndex, float time, Transform* result) const;
+
+    /// <summary>
+    /// Calculates the time segments to split the animation channels for streaming. Returns empty result if animation is too short to be streamed.
+    /// </summary>
+    /// <param name="result">The output segments boundaries (in frames): start of each segment and the end of the last one.</param>
+    void GetStreamingSegments(Array<float, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS + 1>>& result) const;
+
+    /// <summary>
+    /// Serializes the animation channels keyframes within the given time range (including the keyframes at the range boundaries to preserve the interpolation).
+    /// </summary>
+    /// <param name="stream">The output stream.</param>
+    /// <param name="start">The segment start time (in frames).</param>
+    /// <param name="end">The segment end time (in frames).</param>
+    void SerializeSegment(WriteStream& stream, float start, float end) const;
+
+    /// <summary>
+    /// Deserializes the animation segment channels keyframes (see SerializeSegment).
+    /// </summary>
+    /// <param name="stream">The input stream.</param>
+    /// <param name="channels">The channels to deserialize (must match the animation channels count).</param>
+    /// <param name="append">If true, the segment keyframes will be appended to the existing channels curves (segments have to be deserialized in order), otherwise channels curves will be overridden.</param>
+    /// <returns>True if failed to deserialize the data, otherwise false.</returns>
+    static bool DeserializeSegment(ReadStream& stream, Array<NodeAnimationData>& channels, bool append);
+
+    /// <summary>
+    /// Compresses the animation channels data for runtime sampling.
+    /// </summary>
+    /// <param name="settings">The compression settings.</param>
+    /// <param name="releaseSource">If true, the source channels curves will be released after compression (only node names are preserved).</param>
+    /// <returns>True if failed to compress the data, otherwise false.</returns>
+    bool Compress(const CompressedAnimationData::Settings& settings, bool releaseSource);
+
     /// <summary>
     /// Swaps the contents of object with the other object without copy operation. Performs fast internal data exchange.
     /// </summary>
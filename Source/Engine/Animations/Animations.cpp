@@ -4,10 +4,14 @@
 #include "AnimEvent.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Threading/TaskGraph.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/ThreadLocal.h"
 
 class AnimationsService : public EngineService
 {
@@ -23,18 +27,73 @@ class AnimationsService : public EngineService
     void Dispose() override;
 };
 
+namespace
+{
+    // The key of the pose shared between the instances (see AnimatedModel::UsePoseCache)
+    struct PoseCacheKey
+    {
+        const AnimationGraph* Graph;
+        const SkinnedModel* Model;
+        uint32 ParametersHash;
+        float TimeQuantum;
+        int64 TimeIndex;
+
+        bool operator==(const PoseCacheKey& other) const
+        {
+            return Graph == other.Graph && Model == other.Model && ParametersHash == other.ParametersHash && TimeQuantum == other.TimeQuantum && TimeIndex == other.TimeIndex;
+        }
+    };
+
+    uint32 GetHash(const PoseCacheKey& key)
+    {
+        uint32 hash = ::GetHash(key.Graph);
+        CombineHash(hash, ::GetHash(key.Model));
+        CombineHash(hash, key.ParametersHash);
+        CombineHash(hash, ::GetHash(key.TimeQuantum));
+        CombineHash(hash, ::GetHash(key.TimeIndex));
+        return hash;
+    }
+}
+
 class AnimationsSystem : public TaskGraphSystem
 {
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
+    Dictionary<PoseCacheKey, AnimatedModel*> PoseCache;
+    Array<int32> PoseCacheInstances;
+    int64 PoseCacheLabel = 0;
 
+    float GetDeltaTime(const AnimatedModel* animatedModel, float& time) const;
     void Job(int32 index);
+    void PoseCacheJob(int32 index);
+    void SetupPoseCache();
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
 };
 
 namespace
 {
+    // Animated models that need the synchronous update after the async jobs (per-thread to add them from jobs without locking)
+    ThreadLocal<Array<AnimatedModel*>*> SyncQueues;
+
+    void QueueSyncUpdate(AnimatedModel* animatedModel)
+    {
+        auto& queue = SyncQueues.Get();
+        if (!queue)
+            queue = New<Array<AnimatedModel*>>();
+        queue->Add(animatedModel);
+    }
+
+    uint32 GetParametersHash(const AnimGraphInstanceData& data)
+    {
+        uint32 hash = 0;
+        for (const AnimGraphParameter& e : data.Parameters)
+            CombineHash(hash, GetHash(e.Value));
+        for (const AnimGraphSlot& e : data.Slots)
+            CombineHash(hash, e.Animation.Get());
+        return hash;
+    }
+
     FORCE_INLINE bool CanUpdateModel(const AnimatedModel* animatedModel)
     {
         auto skinnedModel = animatedModel->SkinnedModel.Get();
@@ -76,13 +135,32 @@ void AnimationsService::Dispose()
 {
     UpdateList.Resize(0);
     SAFE_DELETE(Animations::System);
+    Array<Array<AnimatedModel*>*> queues;
+    SyncQueues.GetValues(queues);
+    for (auto queue : queues)
+        Delete(queue);
+    SyncQueues.Clear();
+}
+
+float AnimationsSystem::GetDeltaTime(const AnimatedModel* animatedModel, float& time) const
+{
+    // Animation delta time can be based on a time since last update or the current delta
+    float dt = animatedModel->UseTimeScale ? DeltaTime : UnscaledDeltaTime;
+    time = animatedModel->UseTimeScale ? Time : UnscaledTime;
+    const float lastUpdateTime = animatedModel->GraphInstance.LastUpdateTime;
+    if (lastUpdateTime > 0 && time > lastUpdateTime)
+    {
+        dt = time - lastUpdateTime;
+    }
+    return dt * animatedModel->UpdateSpeed;
 }
 
 void AnimationsSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Animations.Job");
+    PROFILE_MEM(Animations);
     auto animatedModel = AnimationManagerInstance.UpdateList[index];
-    if (CanUpdateModel(animatedModel))
+    if (CanUpdateModel(animatedModel) && !animatedModel->_poseCacheSource)
     {
         auto graph = animatedModel->AnimationGraph.Get();
 #if COMPILE_WITH_PROFILER && TRACY_ENABLE
@@ -93,15 +171,8 @@ void AnimationsSystem::Job(int32 index)
         // Prepare skinning data
         animatedModel->SetupSkinningData();
 
-        // Animation delta time can be based on a time since last update or the current delta
-        float dt = animatedModel->UseTimeScale ? DeltaTime : UnscaledDeltaTime;
-        float t = animatedModel->UseTimeScale ? Time : UnscaledTime;
-        const float lastUpdateTime = animatedModel->GraphInstance.LastUpdateTime;
-        if (lastUpdateTime > 0 && t > lastUpdateTime)
-        {
-            dt = t - lastUpdateTime;
-        }
-        dt *= animatedModel->UpdateSpeed;
+        float t;
+        const float dt = GetDeltaTime(animatedModel, t);
         animatedModel->GraphInstance.LastUpdateTime = t;
 
         // Evaluate animated nodes pose
@@ -109,6 +180,64 @@ void AnimationsSystem::Job(int32 index)
 
         // Update gameplay
         animatedModel->OnAnimationUpdated_Async();
+
+        // Queue synchronous update (eg. events, sockets or root motion)
+        if (animatedModel->HasSyncUpdate())
+            QueueSyncUpdate(animatedModel);
+    }
+}
+
+void AnimationsSystem::PoseCacheJob(int32 index)
+{
+    PROFILE_CPU_NAMED("Animations.PoseCacheJob");
+    auto animatedModel = AnimationManagerInstance.UpdateList[PoseCacheInstances[index]];
+
+    // Skip graph evaluation and reuse the pose of the other instance
+    float t;
+    GetDeltaTime(animatedModel, t);
+    animatedModel->GraphInstance.LastUpdateTime = t;
+    animatedModel->OnAnimationUpdated_Async();
+    if (animatedModel->HasSyncUpdate())
+        QueueSyncUpdate(animatedModel);
+}
+
+void AnimationsSystem::SetupPoseCache()
+{
+    PROFILE_CPU();
+
+    // Group the instances that play in sync with the same graph and parameters (first instance evaluates the pose for others)
+    PoseCache.Clear();
+    PoseCacheInstances.Clear();
+    const auto& updateList = AnimationManagerInstance.UpdateList;
+    for (int32 index = 0; index < updateList.Count(); index++)
+    {
+        auto animatedModel = updateList.Get()[index];
+        if (!animatedModel->UsePoseCache || !CanUpdateModel(animatedModel))
+        {
+            if (animatedModel->_poseCacheSource)
+                animatedModel->_poseCacheSource = nullptr;
+            continue;
+        }
+        float t;
+        animatedModel->_poseCacheTime += GetDeltaTime(animatedModel, t);
+        PoseCacheKey key;
+        key.Graph = animatedModel->AnimationGraph.Get();
+        key.Model = animatedModel->SkinnedModel.Get();
+        key.ParametersHash = GetParametersHash(animatedModel->GraphInstance);
+        key.TimeQuantum = Math::Max(animatedModel->PoseCacheTimeQuantum, 0.001f);
+        key.TimeIndex = (int64)(animatedModel->_poseCacheTime / key.TimeQuantum);
+        AnimatedModel* source;
+        if (PoseCache.TryGet(key, source))
+        {
+            animatedModel->_poseCacheSource = source;
+            PoseCacheInstances.Add(index);
+        }
+        else
+        {
+            if (animatedModel->_poseCacheSource)
+                animatedModel->_poseCacheSource = nullptr;
+            PoseCache.Add(key, animatedModel);
+        }
     }
 }
 
@@ -130,29 +259,50 @@ void AnimationsSystem::Execute(TaskGraph* graph)
         Animations::DebugFlow(Animations::DebugFlowInfo());
 #endif
 
+    SetupPoseCache();
+
     // Schedule work to update all animated models in async
     Function<void(int32)> job;
     job.Bind<AnimationsSystem, &AnimationsSystem::Job>(this);
-    graph->DispatchJob(job, AnimationManagerInstance.UpdateList.Count());
+    const int64 label = graph->DispatchJob(job, AnimationManagerInstance.UpdateList.Count());
+
+    // Schedule work to update instances that reuse the cached poses (after the poses are evaluated)
+    if (PoseCacheInstances.HasItems())
+    {
+        job.Bind<AnimationsSystem, &AnimationsSystem::PoseCacheJob>(this);
+        PoseCacheLabel = JobSystem::Dispatch(job, PoseCacheInstances.Count(), Span<int64>(&label, 1));
+    }
 }
 
 void AnimationsSystem::PostExecute(TaskGraph* graph)
 {
     PROFILE_CPU_NAMED("Animations.PostExecute");
+    if (PoseCacheLabel)
+    {
+        JobSystem::Wait(PoseCacheLabel);
+        PoseCacheLabel = 0;
+    }
 
-    // Update gameplay
-    for (int32 index = 0; index < AnimationManagerInstance.UpdateList.Count(); index++)
+    // Update gameplay (only models queued by the async jobs)
+    Array<Array<AnimatedModel*>*, InlinedAllocation<64>> queues;
+    SyncQueues.GetValues(queues);
+    for (auto queue : queues)
     {
-        auto animatedModel = AnimationManagerInstance.UpdateList[index];
-        if (CanUpdateModel(animatedModel))
+        if (!queue)
+            continue;
+        for (int32 index = 0; index < queue->Count(); index++)
         {
+            auto animatedModel = queue->Get()[index];
             animatedModel->GraphInstance.InvokeAnimEvents();
             animatedModel->OnAnimationUpdated_Sync();
         }
+        queue->Clear();
     }
 
     // Cleanup
     AnimationManagerInstance.UpdateList.Clear();
+    PoseCache.Clear();
+    PoseCacheInstances.Clear();
 }
 
 void Animations::AddToUpdate(AnimatedModel* obj)
@@ -163,4 +313,13 @@ void Animations::AddToUpdate(AnimatedModel* obj)
 void Animations::RemoveFromUpdate(AnimatedModel* obj)
 {
     AnimationManagerInstance.UpdateList.Remove(obj);
+
+    // Model can be removed by the gameplay during the synchronous update
+    Array<Array<AnimatedModel*>*, InlinedAllocation<64>> queues;
+    SyncQueues.GetValues(queues);
+    for (auto queue : queues)
+    {
+        if (queue)
+            queue->Remove(obj);
+    }
 }
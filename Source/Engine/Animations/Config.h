@@ -15,3 +15,21 @@
 #else
 #define ANIM_GRAPH_PROFILE_EVENT(name)
 #endif
+
+// Enables/disables compression of the animation clips data at load time (keyframe reduction and values quantization). Disabled in Editor to preserve the source curves for editing.
+#define ANIM_COMPRESSION (!USE_EDITOR)
+
+// The minimum length (in seconds) of the animation clip to split its data into time segments that are streamed during playback. Shorter clips are loaded at once.
+#define ANIM_STREAMING_MIN_LENGTH 60.0f
+
+// The length (in seconds) of a single streamed animation segment (very long clips use longer segments to fit into the asset chunks limit).
+#define ANIM_STREAMING_SEGMENT_LENGTH 10.0f
+
+// The maximum amount of the streamed animation segments (each segment is stored in a separate asset chunk after the header chunk).
+#define ANIM_STREAMING_MAX_SEGMENTS 15
+
+// The time (in seconds) ahead of the playback position to prefetch the next animation segment.
+#define ANIM_STREAMING_PREFETCH_TIME 3.0f
+
+// The time (in seconds) after which the not sampled animation segment gets evicted from memory.
+#define ANIM_STREAMING_EVICT_TIME 2.0f
@@ -0,0 +1,607 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "AnimGraph.h"
+#include "Engine/Core/Types/Pair.h"
+
+// The maximum amount of registers used by the compiled program (limited by the register index size)
+#define ANIM_GRAPH_PROGRAM_MAX_REGISTERS 255
+
+namespace
+{
+    typedef AnimGraphProgram::OpCode OpCode;
+    typedef AnimGraphProgram::Instruction Instruction;
+
+    // The register value type (matches the Variant math conversion rules of the graph executor)
+    enum class RegisterType : byte
+    {
+        Bool,
+        Int,
+        Float,
+    };
+
+    struct Register
+    {
+        byte Index;
+        RegisterType Type;
+    };
+
+    struct ProgramCompiler
+    {
+        AnimGraph* Graph;
+        Array<Instruction>& Instructions;
+        Array<Pair<AnimGraphBox*, Register>, InlinedAllocation<32>> Cache;
+        int32 RegistersCount = 0;
+        int32 Depth = 0;
+
+        ProgramCompiler(AnimGraph* graph, Array<Instruction>& instructions)
+            : Graph(graph)
+            , Instructions(instructions)
+        {
+        }
+
+        bool Emit(OpCode op, RegisterType type, Register& result, byte a = 0, byte b = 0, int32 index = 0)
+        {
+            if (RegistersCount >= ANIM_GRAPH_PROGRAM_MAX_REGISTERS)
+                return true;
+            auto& e = Instructions.AddOne();
+            e.Op = op;
+            e.Result = (byte)RegistersCount++;
+            e.A = a;
+            e.B = b;
+            e.Index = index;
+            result.Index = e.Result;
+            result.Type = type;
+            return false;
+        }
+
+        bool EmitConstant(const Variant& value, Register& result)
+        {
+            RegisterType type;
+            float v;
+            switch (value.Type.Type)
+            {
+            case VariantType::Bool:
+                type = RegisterType::Bool;
+                v = value.AsBool ? 1.0f : 0.0f;
+                break;
+            case VariantType::Int:
+                type = RegisterType::Int;
+                v = (float)value.AsInt;
+                break;
+            case VariantType::Uint:
+                type = RegisterType::Int;
+                v = (float)value.AsUint;
+                break;
+            case VariantType::Float:
+                type = RegisterType::Float;
+                v = value.AsFloat;
+                break;
+            case VariantType::Double:
+                type = RegisterType::Float;
+                v = (float)value.AsDouble;
+                break;
+            default:
+                return true;
+            }
+            if (Emit(OpCode::Constant, type, result))
+                return true;
+            Instructions.Last().Value = v;
+            return false;
+        }
+
+        bool Cast(Register& value, RegisterType type)
+        {
+            if (value.Type == type)
+                return false;
+            if (type == RegisterType::Bool)
+                return Emit(OpCode::ToBool, type, value, value.Index);
+            if (type == RegisterType::Int && value.Type == RegisterType::Float)
+                return Emit(OpCode::ToInt, type, value, value.Index);
+            value.Type = type;
+            return false;
+        }
+
+        bool ConvertResult(Register& value, RegisterType type)
+        {
+            // Math operations are performed on floats and converted into the type of the input
+            switch (type)
+            {
+            case RegisterType::Bool:
+            {
+                Register tolerance;
+                if (EmitConstant(ZeroTolerance, tolerance))
+                    return true;
+                return Emit(OpCode::Greater, type, value, value.Index, tolerance.Index);
+            }
+            case RegisterType::Int:
+                return Emit(OpCode::ToInt, type, value, value.Index);
+            default:
+                value.Type = type;
+                return false;
+            }
+        }
+
+        bool CompileInput(AnimGraphNode* node, int32 boxIndex, int32 defaultValueIndex, const Variant& defaultValue, Register& result, bool& connected)
+        {
+            AnimGraphBox* box = node->GetBox(boxIndex);
+            connected = box && box->HasConnection();
+            if (connected)
+                return CompileBox((AnimGraphBox*)box->FirstConnection(), result);
+            if (defaultValueIndex != -1 && node->Values.Count() > defaultValueIndex)
+                return EmitConstant(node->Values[defaultValueIndex], result);
+            return EmitConstant(defaultValue, result);
+        }
+
+        bool CompileBox(AnimGraphBox* box, Register& result)
+        {
+            for (const auto& e : Cache)
+            {
+                if (e.First == box)
+                {
+                    result = e.Second;
+                    return false;
+                }
+            }
+            if (Depth >= ANIM_GRAPH_MAX_CALL_STACK)
+                return true;
+            Depth++;
+            const bool failed = CompileNode(box, box->GetParent<AnimGraphNode>(), result);
+            Depth--;
+            if (failed)
+                return true;
+            Cache.Add(Pair<AnimGraphBox*, Register>(box, result));
+            return false;
+        }
+
+        bool CompileNode(AnimGraphBox* box, AnimGraphNode* node, Register& result)
+        {
+            const int32 groupId = node->GroupID;
+            const int32 typeId = node->TypeID;
+            bool connected;
+            switch (groupId)
+            {
+            // Constants
+            case 2:
+                switch (typeId)
+                {
+                // Bool, Int, Float, Uint, Double
+                case 1:
+                case 2:
+                case 3:
+                case 12:
+                case 15:
+                    return EmitConstant(node->Values[0], result);
+                // PI
+                case 10:
+                    return EmitConstant(PI, result);
+                }
+                break;
+            // Math
+            case 3:
+            {
+                OpCode op;
+                switch (typeId)
+                {
+                // Add, Subtract, Multiply, Modulo, Divide, Max, Min, Pow, Fmod
+                case 1:
+                    op = OpCode::Add;
+                    break;
+                case 2:
+                    op = OpCode::Subtract;
+                    break;
+                case 3:
+                    op = OpCode::Multiply;
+                    break;
+                case 4:
+                    op = OpCode::Modulo;
+                    break;
+                case 5:
+                    op = OpCode::Divide;
+                    break;
+                case 21:
+                    op = OpCode::Max;
+                    break;
+                case 22:
+                    op = OpCode::Min;
+                    break;
+                case 23:
+                    op = OpCode::Pow;
+                    break;
+                case 40:
+                    op = OpCode::Fmod;
+                    break;
+                // Absolute Value, Ceil, Floor, Round, Saturate, Sqrt, Negate, 1 - Value, Trunc, Frac
+                case 7:
+                    op = OpCode::Abs;
+                    break;
+                case 8:
+                    op = OpCode::Ceil;
+                    break;
+                case 10:
+                    op = OpCode::Floor;
+                    break;
+                case 13:
+                    op = OpCode::Round;
+                    break;
+                case 14:
+                    op = OpCode::Saturate;
+                    break;
+                case 16:
+                    op = OpCode::Sqrt;
+                    break;
+                case 27:
+                    op = OpCode::Negate;
+                    break;
+                case 28:
+                    op = OpCode::OneMinus;
+                    break;
+                case 38:
+                    op = OpCode::Trunc;
+                    break;
+                case 39:
+                    op = OpCode::Frac;
+                    break;
+                default:
+                    return true;
+                }
+                if (op >= OpCode::Abs)
+                {
+                    // Unary operation (result has the type of the input)
+                    Register a;
+                    if (CompileInput(node, 0, -1, Variant::Zero, a, connected))
+                        return true;
+                    return Emit(op, RegisterType::Float, result, a.Index) || ConvertResult(result, a.Type);
+                }
+
+                // Binary operation (result has the type of the first connected input)
+                Register a, b;
+                bool connectedB;
+                if (CompileInput(node, 0, 0, Variant::Zero, a, connected) ||
+                    CompileInput(node, 1, 1, Variant::Zero, b, connectedB))
+                    return true;
+                const RegisterType type = connected ? a.Type : b.Type;
+                return Cast(a, type) || Cast(b, type) || Emit(op, RegisterType::Float, result, a.Index, b.Index) || ConvertResult(result, type);
+            }
+            // Parameters
+            case 6:
+                if (typeId == 1)
+                {
+                    int32 paramIndex;
+                    const auto param = Graph->GetParameter((Guid)node->Values[0], paramIndex);
+                    if (!param)
+                        return true;
+                    RegisterType type = RegisterType::Float;
+                    int32 component = 0;
+                    switch (param->Type.Type)
+                    {
+                    case VariantType::Bool:
+                        type = RegisterType::Bool;
+                        break;
+                    case VariantType::Int:
+                    case VariantType::Uint:
+                        type = RegisterType::Int;
+                        break;
+                    case VariantType::Float:
+                    case VariantType::Double:
+                        break;
+                    case VariantType::Float2:
+                    case VariantType::Float3:
+                    case VariantType::Float4:
+                    case VariantType::Color:
+                        // Only single vector components are supported
+                        if (box->ID == 0)
+                            return true;
+                        component = box->ID - 1;
+                        break;
+                    default:
+                        return true;
+                    }
+                    return Emit(OpCode::Parameter, type, result, (byte)component, 0, paramIndex);
+                }
+                break;
+            // Animation
+            case 9:
+                switch (typeId)
+                {
+                // Rule Output
+                case 22:
+                    if (box->HasConnection())
+                        return CompileBox((AnimGraphBox*)box->FirstConnection(), result) || Cast(result, RegisterType::Bool);
+                    return EmitConstant(false, result);
+                // Transition Source State Anim
+                case 23:
+                    if (box->ID > 4)
+                        return true;
+                    return Emit(OpCode::TransitionData, RegisterType::Float, result, 0, 0, box->ID);
+                }
+                break;
+            // Boolean
+            case 10:
+            {
+                Register a, b;
+                if (typeId == 1)
+                {
+                    // NOT
+                    return CompileInput(node, 0, -1, false, a, connected) || Cast(a, RegisterType::Bool) || Emit(OpCode::Not, RegisterType::Bool, result, a.Index);
+                }
+                OpCode op;
+                switch (typeId)
+                {
+                // AND, OR, XOR, NOR, NAND
+                case 2:
+                    op = OpCode::And;
+                    break;
+                case 3:
+                    op = OpCode::Or;
+                    break;
+                case 4:
+                    op = OpCode::Xor;
+                    break;
+                case 5:
+                    op = OpCode::Nor;
+                    break;
+                case 6:
+                    op = OpCode::Nand;
+                    break;
+                default:
+                    return true;
+                }
+                return CompileInput(node, 0, 0, false, a, connected) ||
+                       CompileInput(node, 1, 1, false, b, connected) ||
+                       Cast(a, RegisterType::Bool) ||
+                       Cast(b, RegisterType::Bool) ||
+                       Emit(op, RegisterType::Bool, result, a.Index, b.Index);
+            }
+            // Comparisons
+            case 12:
+            {
+                OpCode op;
+                switch (typeId)
+                {
+                // ==, !=, >, <, <=, >=
+                case 1:
+                    op = OpCode::Equal;
+                    break;
+                case 2:
+                    op = OpCode::NotEqual;
+                    break;
+                case 3:
+                    op = OpCode::Greater;
+                    break;
+                case 4:
+                    op = OpCode::Less;
+                    break;
+                case 5:
+                    op = OpCode::LessEqual;
+                    break;
+                case 6:
+                    op = OpCode::GreaterEqual;
+                    break;
+                default:
+                    return true;
+                }
+                Register a, b;
+                if (CompileInput(node, 0, 0, Variant::Zero, a, connected) ||
+                    CompileInput(node, 1, 1, Variant::Zero, b, connected) ||
+                    Cast(b, a.Type))
+                    return true;
+                if (a.Type == RegisterType::Float && op == OpCode::Equal)
+                    op = OpCode::NearEqual;
+                else if (a.Type == RegisterType::Float && op == OpCode::NotEqual)
+                    op = OpCode::NearNotEqual;
+                return Emit(op, RegisterType::Bool, result, a.Index, b.Index);
+            }
+            }
+            return true;
+        }
+
+    };
+
+    FORCE_INLINE float GetParameter(const Variant& value, int32 component)
+    {
+        switch (value.Type.Type)
+        {
+        case VariantType::Bool:
+            return value.AsBool ? 1.0f : 0.0f;
+        case VariantType::Int:
+            return (float)value.AsInt;
+        case VariantType::Uint:
+            return (float)value.AsUint;
+        case VariantType::Float:
+            return value.AsFloat;
+        case VariantType::Double:
+            return (float)value.AsDouble;
+        case VariantType::Float2:
+        case VariantType::Float3:
+        case VariantType::Float4:
+        case VariantType::Color:
+            return ((const float*)value.AsData)[component];
+        default:
+            return 0.0f;
+        }
+    }
+}
+
+bool AnimGraphProgram::Compile(AnimGraph* graph, AnimGraphBox* output)
+{
+    Clear();
+    ProgramCompiler compiler(graph, _instructions);
+    Register result;
+    if (compiler.CompileBox(output, result))
+    {
+        // Not supported graph, fallback to the graph executor
+        Clear();
+        return true;
+    }
+    _result = result.Index;
+    return false;
+}
+
+bool AnimGraphProgram::EvaluateBool(const AnimGraphInstanceData& data, const AnimGraphTransitionData& transitionData) const
+{
+    float r[ANIM_GRAPH_PROGRAM_MAX_REGISTERS];
+    for (const Instruction& e : _instructions)
+    {
+        float& result = r[e.Result];
+        switch (e.Op)
+        {
+        case OpCode::Constant:
+            result = e.Value;
+            break;
+        case OpCode::Parameter:
+            result = GetParameter(data.Parameters[e.Index].Value, e.A);
+            break;
+        case OpCode::TransitionData:
+            switch (e.Index)
+            {
+            // Length
+            case 0:
+                result = transitionData.Length;
+                break;
+            // Time
+            case 1:
+                result = transitionData.Position;
+                break;
+            // Normalized Time
+            case 2:
+                result = transitionData.Position / transitionData.Length;
+                break;
+            // Remaining Time
+            case 3:
+                result = transitionData.Length - transitionData.Position;
+                break;
+            // Remaining Normalized Time
+            default:
+                result = 1.0f - (transitionData.Position / transitionData.Length);
+                break;
+            }
+            break;
+        case OpCode::ToInt:
+            result = (float)(int32)r[e.A];
+            break;
+        case OpCode::ToBool:
+            result = Math::IsZero(r[e.A]) ? 0.0f : 1.0f;
+            break;
+        case OpCode::Add:
+            result = r[e.A] + r[e.B];
+            break;
+        case OpCode::Subtract:
+            result = r[e.A] - r[e.B];
+            break;
+        case OpCode::Multiply:
+            result = r[e.A] * r[e.B];
+            break;
+        case OpCode::Modulo:
+            result = (float)((int32)r[e.A] % (int32)r[e.B]);
+            break;
+        case OpCode::Divide:
+            result = r[e.A] / r[e.B];
+            break;
+        case OpCode::Max:
+            result = Math::Max(r[e.A], r[e.B]);
+            break;
+        case OpCode::Min:
+            result = Math::Min(r[e.A], r[e.B]);
+            break;
+        case OpCode::Pow:
+            result = Math::Pow(r[e.A], r[e.B]);
+            break;
+        case OpCode::Fmod:
+            result = Math::Mod(r[e.A], r[e.B]);
+            break;
+        case OpCode::Abs:
+            result = Math::Abs(r[e.A]);
+            break;
+        case OpCode::Ceil:
+            result = Math::Ceil(r[e.A]);
+            break;
+        case OpCode::Floor:
+            result = Math::Floor(r[e.A]);
+            break;
+        case OpCode::Round:
+            result = Math::Round(r[e.A]);
+            break;
+        case OpCode::Saturate:
+            result = Math::Saturate(r[e.A]);
+            break;
+        case OpCode::Sqrt:
+            result = Math::Sqrt(r[e.A]);
+            break;
+        case OpCode::Negate:
+            result = -r[e.A];
+            break;
+        case OpCode::OneMinus:
+            result = 1.0f - r[e.A];
+            break;
+        case OpCode::Trunc:
+            result = Math::Trunc(r[e.A]);
+            break;
+        case OpCode::Frac:
+        {
+            float tmp;
+            result = Math::ModF(r[e.A], &tmp);
+            break;
+        }
+        case OpCode::Not:
+            result = r[e.A] != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::And:
+            result = r[e.A] != 0.0f && r[e.B] != 0.0f ? 1.0f : 0.0f;
+            break;
+        case OpCode::Or:
+            result = r[e.A] != 0.0f || r[e.B] != 0.0f ? 1.0f : 0.0f;
+            break;
+        case OpCode::Xor:
+            result = (r[e.A] != 0.0f) != (r[e.B] != 0.0f) ? 1.0f : 0.0f;
+            break;
+        case OpCode::Nor:
+            result = r[e.A] != 0.0f || r[e.B] != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::Nand:
+            result = r[e.A] != 0.0f && r[e.B] != 0.0f ? 0.0f : 1.0f;
+            break;
+        case OpCode::Equal:
+            result = r[e.A] == r[e.B] ? 1.0f : 0.0f;
+            break;
+        case OpCode::NearEqual:
+            result = Math::NearEqual(r[e.A], r[e.B]) ? 1.0f : 0.0f;
+            break;
+        case OpCode::NotEqual:
+            result = r[e.A] != r[e.B] ? 1.0f : 0.0f;
+            break;
+        case OpCode::NearNotEqual:
+            result = Math::NearEqual(r[e.A], r[e.B]) ? 0.0f : 1.0f;
+            break;
+        case OpCode::Greater:
+            result = r[e.A] > r[e.B] ? 1.0f : 0.0f;
+            break;
+        case OpCode::Less:
+            result = r[e.A] < r[e.B] ? 1.0f : 0.0f;
+            break;
+        case OpCode::LessEqual:
+            result = r[e.A] <= r[e.B] ? 1.0f : 0.0f;
+            break;
+        case OpCode::GreaterEqual:
+            result = r[e.A] >= r[e.B] ? 1.0f : 0.0f;
+            break;
+        }
+    }
+    return r[_result] != 0.0f;
+}
+
+void AnimGraphProgram::Clear()
+{
+    _instructions.Resize(0);
+    _result = 0;
+}
+
+void AnimGraph::CompilePrograms(AnimGraphBase* graph)
+{
+    for (auto& transition : graph->StateTransitions)
+    {
+        if (transition.RuleGraph && transition.RuleGraph->GetRootNode())
+            transition.RuleGraph->Program.Compile(this, &transition.RuleGraph->GetRootNode()->Boxes[0]);
+    }
+    for (AnimSubGraph* subGraph : graph->SubGraphs)
+        CompilePrograms(subGraph);
+}
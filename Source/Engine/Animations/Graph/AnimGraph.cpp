@@ -3,6 +3,7 @@
 #include "AnimGraph.h"
 #include "Engine/Animations/Animations.h"
 #include "Engine/Animations/AnimEvent.h"
+#include "Engine/Animations/InverseKinematics.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Graphics/Models/SkeletonData.h"
 #include "Engine/Scripting/Scripting.h"
@@ -54,6 +55,8 @@ void AnimGraphInstanceData::ClearState()
     CurrentFrame = 0;
     RootTransform = Transform::Identity;
     RootMotion = Transform::Identity;
+    LOD = 0;
+    LODNodesMask = nullptr;
     State.Resize(0);
     NodesPose.Resize(0);
     TraceEvents.Clear();
@@ -168,6 +171,9 @@ bool AnimGraph::Load(ReadStream* stream, bool loadMeta)
         {
             LOG(Warning, "Missing Base Model asset for the Animation Graph. Animation won't be played.");
         }
+
+        // Compile transition rules into programs to skip the graph evaluation at runtime
+        CompilePrograms(this);
     }
 
     // Register for scripts reloading events (only if using any custom nodes)
@@ -255,6 +261,7 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
         context.Functions.Clear();
         context.PoseCacheSize = 0;
         context.ValueCache.Clear();
+        context.DeferredIK.Clear();
 
         // Prepare instance data
         if (data.Version != _graph.Version)
@@ -303,6 +310,47 @@ void AnimGraphExecutor::Update(AnimGraphInstanceData& data, float dt)
         if (animResult == nullptr)
             animResult = GetEmptyNodes();
     }
+    AnimGraphImpulse deferredIKNodes;
+    if (context.DeferredIK.Count() != 0)
+    {
+        ANIM_GRAPH_PROFILE_EVENT("IK");
+
+        // Solve all deferred IK chains at once on the final pose (copied to not modify the cached poses of the nodes)
+        deferredIKNodes = *animResult;
+        animResult = &deferredIKNodes;
+        Array<InverseKinematics::TwoBoneIKChain, InlinedAllocation<8>> chains;
+        chains.Resize(context.DeferredIK.Count());
+        for (int32 i = 0; i < chains.Count(); i++)
+        {
+            const auto& e = context.DeferredIK[i];
+            auto& chain = chains[i];
+            chain.RootNode = deferredIKNodes.GetNodeModelTransformation(skeleton, e.RootNodeIndex);
+            chain.JointNode = chain.RootNode.LocalToWorld(deferredIKNodes.Nodes[e.JointNodeIndex]);
+            chain.TargetNode = chain.JointNode.LocalToWorld(deferredIKNodes.Nodes[e.NodeIndex]);
+            chain.Target = e.Target;
+            chain.JointTarget = e.JointTarget;
+            chain.AllowStretching = e.AllowStretching;
+            chain.MaxStretchScale = e.MaxStretchScale;
+        }
+        InverseKinematics::SolveTwoBoneIK(ToSpan(chains));
+        for (int32 i = 0; i < chains.Count(); i++)
+        {
+            const auto& e = context.DeferredIK[i];
+            const auto& chain = chains[i];
+            const Transform rootTransformLocalSpace = deferredIKNodes.Nodes[e.RootNodeIndex];
+            const Transform jointTransformLocalSpace = deferredIKNodes.Nodes[e.JointNodeIndex];
+            const Transform nodeTransformLocalSpace = deferredIKNodes.Nodes[e.NodeIndex];
+            deferredIKNodes.SetNodeModelTransformation(skeleton, e.RootNodeIndex, chain.RootNode);
+            chain.RootNode.WorldToLocal(chain.JointNode, deferredIKNodes.Nodes[e.JointNodeIndex]);
+            chain.JointNode.WorldToLocal(chain.TargetNode, deferredIKNodes.Nodes[e.NodeIndex]);
+            if (e.Weight < 1.0f)
+            {
+                Transform::Lerp(rootTransformLocalSpace, deferredIKNodes.Nodes[e.RootNodeIndex], e.Weight, deferredIKNodes.Nodes[e.RootNodeIndex]);
+                Transform::Lerp(jointTransformLocalSpace, deferredIKNodes.Nodes[e.JointNodeIndex], e.Weight, deferredIKNodes.Nodes[e.JointNodeIndex]);
+                Transform::Lerp(nodeTransformLocalSpace, deferredIKNodes.Nodes[e.NodeIndex], e.Weight, deferredIKNodes.Nodes[e.NodeIndex]);
+            }
+        }
+    }
     if (data.ActiveEvents.Count() != 0)
     {
         ANIM_GRAPH_PROFILE_EVENT("Events");
@@ -349,6 +349,16 @@ class FLAXENGINE_API AnimGraphInstanceData
     /// </summary>
     SkinnedModel* NodesSkeleton = nullptr;
 
+    /// <summary>
+    /// The animation level of detail. Value 0 evaluates the full graph, higher values skip expensive graph nodes (eg. IK solvers) and use simplified blending (eg. only the dominant sample of the Multi Blend 2D).
+    /// </summary>
+    int32 LOD = 0;
+
+    /// <summary>
+    /// The skeleton nodes mask with nodes to sample from animations when LOD is above 0 (other nodes use the reference pose). Use null to evaluate all nodes.
+    /// </summary>
+    const BitArray<>* LODNodesMask = nullptr;
+
     /// <summary>
     /// The custom event called after local pose evaluation and retargetting.
     /// </summary>
@@ -380,6 +390,14 @@ class FLAXENGINE_API AnimGraphInstanceData
     /// </summary>
     void InvokeAnimEvents();
 
+    /// <summary>
+    /// Checks if there are any outgoing anim events that were not invoked yet (eg. non-async events are waiting for the main thread).
+    /// </summary>
+    FORCE_INLINE bool HasAnimEvents() const
+    {
+        return OutgoingEvents.HasItems();
+    }
+
 public:
     // Anim Graph logic tracing feature that allows to collect insights of animations sampling and skeleton poses operations.
     bool EnableTracing = false;
@@ -574,6 +592,108 @@ class AnimGraphNode : public VisjectGraphNode<AnimGraphBox>
     AnimGraphImpulse* GetNodes(AnimGraphExecutor* executor);
 };
 
+/// <summary>
+/// The value graph (eg. state transition rule) compiled into a flat list of instructions that operate on the typed scalar registers. Evaluated in a single loop without Variant values boxing nor recursive boxes evaluation. Supports only the subset of nodes (constants, parameters, math, boolean and comparison operators, transition data).
+/// </summary>
+class AnimGraphProgram
+{
+public:
+    enum class OpCode : byte
+    {
+        Constant,
+        Parameter,
+        TransitionData,
+        ToInt,
+        ToBool,
+        Add,
+        Subtract,
+        Multiply,
+        Modulo,
+        Divide,
+        Max,
+        Min,
+        Pow,
+        Fmod,
+        Abs,
+        Ceil,
+        Floor,
+        Round,
+        Saturate,
+        Sqrt,
+        Negate,
+        OneMinus,
+        Trunc,
+        Frac,
+        Not,
+        And,
+        Or,
+        Xor,
+        Nor,
+        Nand,
+        Equal,
+        NearEqual,
+        NotEqual,
+        NearNotEqual,
+        Greater,
+        Less,
+        LessEqual,
+        GreaterEqual,
+    };
+
+    struct Instruction
+    {
+        OpCode Op;
+        // The index of the output register.
+        byte Result;
+        // The index of the first input register (or parameter component).
+        byte A;
+        // The index of the second input register.
+        byte B;
+
+        union
+        {
+            // The constant value.
+            float Value;
+            // The parameter index or transition data field.
+            int32 Index;
+        };
+    };
+
+private:
+    Array<Instruction> _instructions;
+    byte _result = 0;
+
+public:
+    /// <summary>
+    /// Returns true if the program has been compiled.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return _instructions.HasItems();
+    }
+
+    /// <summary>
+    /// Compiles the graph starting from the given output node box.
+    /// </summary>
+    /// <param name="graph">The owning animation graph (used to resolve parameters).</param>
+    /// <param name="output">The output box to evaluate (eg. transition rule output).</param>
+    /// <returns>True if graph cannot be compiled (eg. uses unsupported nodes), otherwise false.</returns>
+    bool Compile(AnimGraph* graph, AnimGraphBox* output);
+
+    /// <summary>
+    /// Evaluates the compiled program as a boolean value.
+    /// </summary>
+    /// <param name="data">The instance data (parameters).</param>
+    /// <param name="transitionData">The current state transition data</param>
+    /// <returns>The result value.</returns>
+    bool EvaluateBool(const AnimGraphInstanceData& data, const AnimGraphTransitionData& transitionData) const;
+
+    /// <summary>
+    /// Releases data.
+    /// </summary>
+    void Clear();
+};
+
 /// <summary>
 /// The base class for Anim Graphs that supports nesting sub graphs.
 /// </summary>
@@ -679,6 +799,12 @@ class AnimSubGraph : public AnimGraphBase
         : AnimGraphBase(graph)
     {
     }
+
+public:
+    /// <summary>
+    /// The compiled program of the sub-graph (used by the state transition rules). Invalid if graph uses nodes not supported by the program compilation and has to be evaluated with the graph executor.
+    /// </summary>
+    AnimGraphProgram Program;
 };
 
 /// <summary>
@@ -747,6 +873,7 @@ class AnimGraph : public AnimGraphBase
     void OnScriptsReloaded();
 #endif
     void OnScriptsLoaded();
+    void CompilePrograms(AnimGraphBase* graph);
 
 public:
     // [Graph]
@@ -773,6 +900,21 @@ struct AnimGraphContext
     int32 PoseCacheSize;
     Dictionary<VisjectExecutor::Box*, Variant> ValueCache;
 
+    // The two bone IK request deferred into the batch solved on the final pose.
+    struct DeferredTwoBoneIK
+    {
+        int32 RootNodeIndex;
+        int32 JointNodeIndex;
+        int32 NodeIndex;
+        float Weight;
+        Vector3 Target;
+        Vector3 JointTarget;
+        bool AllowStretching;
+        float MaxStretchScale;
+    };
+
+    Array<DeferredTwoBoneIK> DeferredIK;
+
     AnimGraphTraceEvent& AddTraceEvent(const AnimGraphNode* node);
 };
 
@@ -867,6 +1009,7 @@ class AnimGraphExecutor : public VisjectExecutor
     Variant Blend(AnimGraphNode* node, const Value& poseA, const Value& poseB, float alpha, AlphaBlendMode alphaMode);
     Variant SampleState(AnimGraphContext& context, const AnimGraphNode* state);
     void InitStateTransition(AnimGraphContext& context, AnimGraphInstanceData::StateMachineBucket& stateMachineBucket, AnimGraphStateTransition* transition = nullptr);
+    bool EvaluateTransitionRule(AnimGraphContext& context, AnimSubGraph* ruleGraph);
     AnimGraphStateTransition* UpdateStateTransitions(AnimGraphContext& context, const AnimGraphNode::StateMachineData& stateMachineData, AnimGraphNode* state, AnimGraphNode* ignoreState = nullptr);
     AnimGraphStateTransition* UpdateStateTransitions(AnimGraphContext& context, const AnimGraphNode::StateMachineData& stateMachineData, const AnimGraphNode::StateBaseData& stateData, AnimGraphNode* state, AnimGraphNode* ignoreState = nullptr);
     void UpdateStateTransitions(AnimGraphContext& context, const AnimGraphNode::StateMachineData& stateMachineData, AnimGraphInstanceData::StateMachineBucket& stateMachineBucket, const AnimGraphNode::StateBaseData& stateData);
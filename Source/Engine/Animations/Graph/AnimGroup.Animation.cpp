@@ -6,8 +6,10 @@
 #include "Engine/Content/Assets/SkeletonMask.h"
 #include "Engine/Content/Assets/AnimationGraphFunction.h"
 #include "Engine/Animations/AlphaBlend.h"
+#include "Engine/Animations/Animations.h"
 #include "Engine/Animations/AnimEvent.h"
 #include "Engine/Animations/InverseKinematics.h"
+#include "Engine/Core/SIMD.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 
 namespace
@@ -32,6 +34,187 @@ namespace
             nodes->RootMotion.Orientation.Normalize();
         }
     }
+
+    // Transformations of 4 skeleton nodes in SoA layout (component-wise) for SIMD processing
+    struct NodesSoA4
+    {
+        SimdVector4 TX, TY, TZ;
+        SimdVector4 QX, QY, QZ, QW;
+        SimdVector4 SX, SY, SZ;
+
+        FORCE_INLINE void Load(const Transform* t)
+        {
+            TX = SIMD::Load((float)t[0].Translation.X, (float)t[1].Translation.X, (float)t[2].Translation.X, (float)t[3].Translation.X);
+            TY = SIMD::Load((float)t[0].Translation.Y, (float)t[1].Translation.Y, (float)t[2].Translation.Y, (float)t[3].Translation.Y);
+            TZ = SIMD::Load((float)t[0].Translation.Z, (float)t[1].Translation.Z, (float)t[2].Translation.Z, (float)t[3].Translation.Z);
+            QX = SIMD::Load(t[0].Orientation.X, t[1].Orientation.X, t[2].Orientation.X, t[3].Orientation.X);
+            QY = SIMD::Load(t[0].Orientation.Y, t[1].Orientation.Y, t[2].Orientation.Y, t[3].Orientation.Y);
+            QZ = SIMD::Load(t[0].Orientation.Z, t[1].Orientation.Z, t[2].Orientation.Z, t[3].Orientation.Z);
+            QW = SIMD::Load(t[0].Orientation.W, t[1].Orientation.W, t[2].Orientation.W, t[3].Orientation.W);
+            SX = SIMD::Load(t[0].Scale.X, t[1].Scale.X, t[2].Scale.X, t[3].Scale.X);
+            SY = SIMD::Load(t[0].Scale.Y, t[1].Scale.Y, t[2].Scale.Y, t[3].Scale.Y);
+            SZ = SIMD::Load(t[0].Scale.Z, t[1].Scale.Z, t[2].Scale.Z, t[3].Scale.Z);
+        }
+
+        FORCE_INLINE void Store(Transform* t) const
+        {
+            ALIGN_BEGIN(16) float data[10][4] ALIGN_END(16);
+            SIMD::Store(data[0], TX);
+            SIMD::Store(data[1], TY);
+            SIMD::Store(data[2], TZ);
+            SIMD::Store(data[3], QX);
+            SIMD::Store(data[4], QY);
+            SIMD::Store(data[5], QZ);
+            SIMD::Store(data[6], QW);
+            SIMD::Store(data[7], SX);
+            SIMD::Store(data[8], SY);
+            SIMD::Store(data[9], SZ);
+            for (int32 i = 0; i < 4; i++)
+            {
+                Transform& e = t[i];
+                e.Translation = Vector3(data[0][i], data[1][i], data[2][i]);
+                e.Orientation = Quaternion(data[3][i], data[4][i], data[5][i], data[6][i]);
+                e.Scale = Float3(data[7][i], data[8][i], data[9][i]);
+            }
+        }
+    };
+
+    FORCE_INLINE SimdVector4 Lerp4(SimdVector4 a, SimdVector4 b, SimdVector4 alpha)
+    {
+        return SIMD::Add(a, SIMD::Mul(SIMD::Sub(b, a), alpha));
+    }
+
+    FORCE_INLINE void Blend4(const NodesSoA4& a, const NodesSoA4& b, SimdVector4 alpha, NodesSoA4& result)
+    {
+        // Linear interpolation for translation and scale
+        result.TX = Lerp4(a.TX, b.TX, alpha);
+        result.TY = Lerp4(a.TY, b.TY, alpha);
+        result.TZ = Lerp4(a.TZ, b.TZ, alpha);
+        result.SX = Lerp4(a.SX, b.SX, alpha);
+        result.SY = Lerp4(a.SY, b.SY, alpha);
+        result.SZ = Lerp4(a.SZ, b.SZ, alpha);
+
+        // Normalized linear interpolation for rotation (picks a shortest path)
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        SimdVector4 dot = SIMD::Mul(a.QX, b.QX);
+        dot = SIMD::Add(dot, SIMD::Mul(a.QY, b.QY));
+        dot = SIMD::Add(dot, SIMD::Mul(a.QZ, b.QZ));
+        dot = SIMD::Add(dot, SIMD::Mul(a.QW, b.QW));
+        const SimdVector4 weightA = SIMD::Sub(one, alpha);
+        const SimdVector4 weightB = SIMD::Select(SIMD::Less(dot, zero), SIMD::Sub(zero, alpha), alpha);
+        const SimdVector4 qx = SIMD::Add(SIMD::Mul(a.QX, weightA), SIMD::Mul(b.QX, weightB));
+        const SimdVector4 qy = SIMD::Add(SIMD::Mul(a.QY, weightA), SIMD::Mul(b.QY, weightB));
+        const SimdVector4 qz = SIMD::Add(SIMD::Mul(a.QZ, weightA), SIMD::Mul(b.QZ, weightB));
+        const SimdVector4 qw = SIMD::Add(SIMD::Mul(a.QW, weightA), SIMD::Mul(b.QW, weightB));
+        SimdVector4 lengthSq = SIMD::Mul(qx, qx);
+        lengthSq = SIMD::Add(lengthSq, SIMD::Mul(qy, qy));
+        lengthSq = SIMD::Add(lengthSq, SIMD::Mul(qz, qz));
+        lengthSq = SIMD::Add(lengthSq, SIMD::Mul(qw, qw));
+        const SimdVector4 invLength = SIMD::Div(one, SIMD::Sqrt(SIMD::Max(lengthSq, SIMD::Splat(ZeroTolerance))));
+        result.QX = SIMD::Mul(qx, invLength);
+        result.QY = SIMD::Mul(qy, invLength);
+        result.QZ = SIMD::Mul(qz, invLength);
+        result.QW = SIMD::Mul(qw, invLength);
+    }
+
+    FORCE_INLINE void Multiply4(SimdVector4 ax, SimdVector4 ay, SimdVector4 az, SimdVector4 aw, SimdVector4 bx, SimdVector4 by, SimdVector4 bz, SimdVector4 bw, NodesSoA4& result)
+    {
+        // Matches Quaternion::Multiply(a, b)
+        const SimdVector4 cx = SIMD::Sub(SIMD::Mul(ay, bz), SIMD::Mul(az, by));
+        const SimdVector4 cy = SIMD::Sub(SIMD::Mul(az, bx), SIMD::Mul(ax, bz));
+        const SimdVector4 cz = SIMD::Sub(SIMD::Mul(ax, by), SIMD::Mul(ay, bx));
+        const SimdVector4 d = SIMD::Add(SIMD::Add(SIMD::Mul(ax, bx), SIMD::Mul(ay, by)), SIMD::Mul(az, bz));
+        result.QX = SIMD::Add(SIMD::Add(SIMD::Mul(ax, bw), SIMD::Mul(bx, aw)), cx);
+        result.QY = SIMD::Add(SIMD::Add(SIMD::Mul(ay, bw), SIMD::Mul(by, aw)), cy);
+        result.QZ = SIMD::Add(SIMD::Add(SIMD::Mul(az, bw), SIMD::Mul(bz, aw)), cz);
+        result.QW = SIMD::Sub(SIMD::Mul(aw, bw), d);
+    }
+
+    template<typename Kernel>
+    FORCE_INLINE void ProcessNodes4(int32 count, Kernel kernel)
+    {
+        // Process 4 nodes at once, the remaining nodes are processed via padded batch
+        int32 i = 0;
+        for (; i + 4 <= count; i += 4)
+            kernel(i, 4);
+        if (i < count)
+            kernel(i, count - i);
+    }
+
+    FORCE_INLINE void LoadNodes4(NodesSoA4& result, const Transform* nodes, int32 count)
+    {
+        if (count == 4)
+        {
+            result.Load(nodes);
+        }
+        else
+        {
+            Transform padded[4];
+            for (int32 i = 0; i < 4; i++)
+                padded[i] = nodes[Math::Min(i, count - 1)];
+            result.Load(padded);
+        }
+    }
+
+    FORCE_INLINE void StoreNodes4(const NodesSoA4& value, Transform* nodes, int32 count)
+    {
+        if (count == 4)
+        {
+            value.Store(nodes);
+        }
+        else
+        {
+            Transform padded[4];
+            value.Store(padded);
+            for (int32 i = 0; i < count; i++)
+                nodes[i] = padded[i];
+        }
+    }
+
+    void BlendNodes(const Transform* a, const Transform* b, float alpha, Transform* result, int32 count)
+    {
+        const SimdVector4 alpha4 = SIMD::Splat(alpha);
+        ProcessNodes4(count, [&](int32 start, int32 batch)
+        {
+            NodesSoA4 a4, b4, r4;
+            LoadNodes4(a4, a + start, batch);
+            LoadNodes4(b4, b + start, batch);
+            Blend4(a4, b4, alpha4, r4);
+            StoreNodes4(r4, result + start, batch);
+        });
+    }
+
+    void BlendAdditiveNodes(const Transform* base, const Transform* blend, const SkeletonNode* reference, float alpha, Transform* result, int32 count)
+    {
+        const SimdVector4 alpha4 = SIMD::Splat(alpha);
+        ProcessNodes4(count, [&](int32 start, int32 batch)
+        {
+            Transform referencePose[4];
+            for (int32 i = 0; i < batch; i++)
+                referencePose[i] = reference[start + i].LocalTransform;
+            NodesSoA4 base4, blend4, ref4, t4, r4;
+            LoadNodes4(base4, base + start, batch);
+            LoadNodes4(blend4, blend + start, batch);
+            LoadNodes4(ref4, referencePose, batch);
+
+            // base + (blend - reference)
+            t4.TX = SIMD::Add(base4.TX, SIMD::Sub(blend4.TX, ref4.TX));
+            t4.TY = SIMD::Add(base4.TY, SIMD::Sub(blend4.TY, ref4.TY));
+            t4.TZ = SIMD::Add(base4.TZ, SIMD::Sub(blend4.TZ, ref4.TZ));
+            t4.SX = SIMD::Add(base4.SX, SIMD::Sub(blend4.SX, ref4.SX));
+            t4.SY = SIMD::Add(base4.SY, SIMD::Sub(blend4.SY, ref4.SY));
+            t4.SZ = SIMD::Add(base4.SZ, SIMD::Sub(blend4.SZ, ref4.SZ));
+            NodesSoA4 diff4;
+            const SimdVector4 zero = SIMD::Splat(0.0f);
+            Multiply4(SIMD::Sub(zero, ref4.QX), SIMD::Sub(zero, ref4.QY), SIMD::Sub(zero, ref4.QZ), ref4.QW, blend4.QX, blend4.QY, blend4.QZ, blend4.QW, diff4);
+            Multiply4(base4.QX, base4.QY, base4.QZ, base4.QW, diff4.QX, diff4.QY, diff4.QZ, diff4.QW, t4);
+
+            // Lerp base and transform
+            Blend4(base4, t4, alpha4, r4);
+            StoreNodes4(r4, result + start, batch);
+        });
+    }
 }
 
 void RetargetSkeletonNode(const SkeletonData& sourceSkeleton, const SkeletonData& targetSkeleton, const SkinnedModel::SkeletonMapping& mapping, Transform& node, int32 i)
@@ -287,15 +470,23 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
     SkinnedModel::SkeletonMapping sourceMapping;
     if (retarget)
         sourceMapping = _graph.BaseModel->GetSkeletonMapping(mapping.SourceSkeleton);
+    const BitArray<>* lodNodesMask = context.Data->LOD > 0 ? context.Data->LODNodesMask : nullptr;
+    if (lodNodesMask && lodNodesMask->Count() != nodes->Nodes.Count())
+        lodNodesMask = nullptr;
     for (int32 nodeIndex = 0; nodeIndex < nodes->Nodes.Count(); nodeIndex++)
     {
-        const int32 nodeToChannel = mapping.NodesMapping[nodeIndex];
+        int32 nodeToChannel = mapping.NodesMapping[nodeIndex];
         Transform& dstNode = nodes->Nodes[nodeIndex];
         Transform srcNode = emptyNodes->Nodes[nodeIndex];
+        if (lodNodesMask && !lodNodesMask->Get(nodeIndex))
+        {
+            // Skip sampling nodes excluded by the animation LOD (use reference pose)
+            nodeToChannel = -1;
+        }
         if (nodeToChannel != -1)
         {
             // Calculate the animated node transformation
-            anim->Data.Channels[nodeToChannel].Evaluate(animPos, &srcNode, false);
+            anim->Data.EvaluateChannel(nodeToChannel, animPos, &srcNode);
 
             // Optionally retarget animation into the skeleton used by the Anim Graph
             if (retarget)
@@ -357,8 +548,8 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
         {
             // Get the root bone transformation
             Transform rootBefore = refPose;
-            const NodeAnimationData& rootChannel = anim->Data.Channels[nodeToChannel];
-            rootChannel.Evaluate(animPrevPos, &rootBefore, false);
+            const AnimationData& animData = anim->Data;
+            animData.EvaluateChannel(nodeToChannel, animPrevPos, &rootBefore);
 
             // Check if animation looped
             if (animPos < animPrevPos)
@@ -366,10 +557,10 @@ void AnimGraphExecutor::ProcessAnimation(AnimGraphImpulse* nodes, AnimGraphNode*
                 const float endPos = (float)(anim->GetLength() * anim->Data.FramesPerSecond);
 
                 Transform rootBegin = refPose;
-                rootChannel.Evaluate(0, &rootBegin, false);
+                animData.EvaluateChannel(nodeToChannel, 0, &rootBegin);
 
                 Transform rootEnd = refPose;
-                rootChannel.Evaluate(endPos, &rootEnd, false);
+                animData.EvaluateChannel(nodeToChannel, endPos, &rootEnd);
 
                 // Complex motion calculation to preserve the looped movement
                 // (end - before + now - begin)
@@ -526,10 +717,7 @@ Variant AnimGraphExecutor::Blend(AnimGraphNode* node, const Value& poseA, const
     if (!ANIM_GRAPH_IS_VALID_PTR(poseB))
         nodesB = GetEmptyNodes();
 
-    for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-    {
-        Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-    }
+    BlendNodes(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
     Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
     nodes->Position = Math::Lerp(nodesA->Position, nodesB->Position, alpha);
     nodes->Length = Math::Lerp(nodesA->Length, nodesB->Length, alpha);
@@ -574,6 +762,23 @@ void AnimGraphExecutor::InitStateTransition(AnimGraphContext& context, AnimGraph
     }
 }
 
+bool AnimGraphExecutor::EvaluateTransitionRule(AnimGraphContext& context, AnimSubGraph* ruleGraph)
+{
+#if USE_EDITOR
+    // Use graph executor to report the debug flow of the rule nodes
+    if (ruleGraph->Program.IsValid() && !Animations::DebugFlow.IsBinded())
+#else
+    if (ruleGraph->Program.IsValid())
+#endif
+    {
+        // Use compiled rule
+        return ruleGraph->Program.EvaluateBool(*context.Data, context.TransitionData);
+    }
+    auto rootNode = ruleGraph->GetRootNode();
+    ASSERT(rootNode);
+    return (bool)eatBox((Node*)rootNode, &rootNode->Boxes[0]);
+}
+
 AnimGraphStateTransition* AnimGraphExecutor::UpdateStateTransitions(AnimGraphContext& context, const AnimGraphNode::StateMachineData& stateMachineData, AnimGraphNode* state, AnimGraphNode* ignoreState)
 {
     return UpdateStateTransitions(context, stateMachineData, state->Data.State, state, ignoreState);
@@ -617,9 +822,7 @@ AnimGraphStateTransition* AnimGraphExecutor::UpdateStateTransitions(AnimGraphCon
         {
             // Execute transition rule
             ANIM_GRAPH_PROFILE_EVENT("Rule");
-            auto rootNode = transition.RuleGraph->GetRootNode();
-            ASSERT(rootNode);
-            if (!(bool)eatBox((Node*)rootNode, &rootNode->Boxes[0]))
+            if (!EvaluateTransitionRule(context, transition.RuleGraph))
             {
                 transitionIndex++;
                 continue;
@@ -1122,10 +1325,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             if (!ANIM_GRAPH_IS_VALID_PTR(valueB))
                 nodesB = GetEmptyNodes();
 
-            for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-            {
-                Transform::Lerp(nodesA->Nodes[i], nodesB->Nodes[i], alpha, nodes->Nodes[i]);
-            }
+            BlendNodes(nodesA->Nodes.Get(), nodesB->Nodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
             Transform::Lerp(nodesA->RootMotion, nodesB->RootMotion, alpha, nodes->RootMotion);
             value = nodes;
         }
@@ -1162,22 +1362,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 const auto basePoseNodes = static_cast<AnimGraphImpulse*>(valueA.AsPointer);
                 const auto blendPoseNodes = static_cast<AnimGraphImpulse*>(valueB.AsPointer);
                 const auto& refNodes = _graph.BaseModel.Get()->GetNodes();
-                Transform t, basePoseTransform, blendPoseTransform, refTransform;
-                for (int32 i = 0; i < nodes->Nodes.Count(); i++)
-                {
-                    basePoseTransform = basePoseNodes->Nodes[i];
-                    blendPoseTransform = blendPoseNodes->Nodes[i];
-                    refTransform = refNodes[i].LocalTransform;
-
-                    // base + (blend - reference)
-                    t.Translation = basePoseTransform.Translation + (blendPoseTransform.Translation - refTransform.Translation);
-                    auto diff = Quaternion::Invert(refTransform.Orientation) * blendPoseTransform.Orientation;
-                    t.Orientation = basePoseTransform.Orientation * diff;
-                    t.Scale = basePoseTransform.Scale + (blendPoseTransform.Scale - refTransform.Scale);
-
-                    // Lerp base and transform
-                    Transform::Lerp(basePoseTransform, t, alpha, nodes->Nodes[i]);
-                }
+                BlendAdditiveNodes(basePoseNodes->Nodes.Get(), blendPoseNodes->Nodes.Get(), refNodes.Get(), alpha, nodes->Nodes.Get(), nodes->Nodes.Count());
                 Transform::Lerp(basePoseNodes->RootMotion, basePoseNodes->RootMotion + blendPoseNodes->RootMotion, alpha, nodes->RootMotion);
                 value = nodes;
             }
@@ -1516,6 +1701,18 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                 const float w = (d00 * d21 - d01 * d20) / coeff;
                 const float u = 1.0f - v - w;
 
+                if (context.Data->LOD > 0)
+                {
+                    // Use only the dominant sample at reduced animation LOD
+                    if (u >= v && u >= w)
+                        value = SampleAnimation(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, aAnim, aData.W);
+                    else if (v >= w)
+                        value = SampleAnimation(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, bAnim, bData.W);
+                    else
+                        value = SampleAnimation(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, cAnim, cData.W);
+                    break;
+                }
+
                 // Blend A and B and C
                 value = SampleAnimationsWithBlend(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, aAnim, bAnim, cAnim, aData.W, bData.W, cData.W, u, v, w);
                 break;
@@ -1550,8 +1747,8 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             const auto aAnim = node->Assets[bestAnims[0]].As<Animation>();
             const auto aData = node->Values[4 + bestAnims[0] * 2].AsFloat4();
 
-            // Check if use only one sample
-            if (bestWeight < ANIM_GRAPH_BLEND_THRESHOLD)
+            // Check if use only one sample (use the closer one at reduced animation LOD)
+            if (bestWeight < ANIM_GRAPH_BLEND_THRESHOLD || (context.Data->LOD > 0 && bestWeight < 0.5f))
             {
                 value = SampleAnimation(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, aAnim, aData.W);
             }
@@ -1559,7 +1756,10 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             {
                 const auto bAnim = node->Assets[bestAnims[1]].As<Animation>();
                 const auto bData = node->Values[4 + bestAnims[1] * 2].AsFloat4();
-                value = SampleAnimationsWithBlend(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, aAnim, bAnim, aData.W, bData.W, bestWeight);
+                if (context.Data->LOD > 0)
+                    value = SampleAnimation(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, bAnim, bData.W);
+                else
+                    value = SampleAnimationsWithBlend(node, loop, data.Length, startTimePos, bucket.TimePosition, newTimePos, aAnim, bAnim, aData.W, bData.W, bestWeight);
             }
         }
 
@@ -1745,8 +1945,7 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
                     bucket.ActiveTransition->RuleGraph)
             {
                 // Execute transition rule
-                auto rootNode = bucket.ActiveTransition->RuleGraph->GetRootNode();
-                if (!(bool)eatBox((Node*)rootNode, &rootNode->Boxes[0]))
+                if (!EvaluateTransitionRule(context, bucket.ActiveTransition->RuleGraph))
                 {
                     bool cancelTransition = false;
                     if (EnumHasAnyFlags(bucket.ActiveTransition->Flags, AnimGraphStateTransition::FlagTypes::InterruptionInstant))
@@ -2089,9 +2288,9 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
         auto input = tryGetValue(node->GetBox(1), Value::Null);
         const auto nodeIndex = node->Data.TransformNode.NodeIndex;
         float weight = (float)tryGetValue(node->GetBox(3), node->Values[1]);
-        if (nodeIndex < 0 || nodeIndex >= _skeletonNodesCount || weight < ANIM_GRAPH_BLEND_THRESHOLD)
+        if (nodeIndex < 0 || nodeIndex >= _skeletonNodesCount || weight < ANIM_GRAPH_BLEND_THRESHOLD || context.Data->LOD > 0)
         {
-            // Pass through the input
+            // Pass through the input (IK is skipped at reduced animation LOD)
             value = input;
             break;
         }
@@ -2146,9 +2345,9 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
         auto input = tryGetValue(node->GetBox(1), Value::Null);
         const auto nodeIndex = node->Data.TransformNode.NodeIndex;
         float weight = (float)tryGetValue(node->GetBox(4), node->Values[1]);
-        if (nodeIndex < 0 || nodeIndex >= _skeletonNodesCount || weight < ANIM_GRAPH_BLEND_THRESHOLD)
+        if (nodeIndex < 0 || nodeIndex >= _skeletonNodesCount || weight < ANIM_GRAPH_BLEND_THRESHOLD || context.Data->LOD > 0)
         {
-            // Pass through the input
+            // Pass through the input (IK is skipped at reduced animation LOD)
             value = input;
             break;
         }
@@ -2183,6 +2382,21 @@ void AnimGraphExecutor::ProcessGroupAnimation(Box* boxBase, Node* nodeBase, Valu
             value = input;
             break;
         }
+        if (node->Values.Count() > 4 && (bool)node->Values[4])
+        {
+            // Defer IK into the batch solved on the final pose
+            auto& e = context.DeferredIK.AddOne();
+            e.RootNodeIndex = rootNodeIndex;
+            e.JointNodeIndex = jointNodeIndex;
+            e.NodeIndex = nodeIndex;
+            e.Weight = weight;
+            e.Target = target;
+            e.JointTarget = jointTarget;
+            e.AllowStretching = allowStretching;
+            e.MaxStretchScale = maxStretchScale;
+            value = input;
+            break;
+        }
         Transform rootTransformLocalSpace = nodes->Nodes[rootNodeIndex];
         Transform jointTransformLocalSpace = nodes->Nodes[jointNodeIndex];
         Transform nodeTransformLocalSpace = nodes->Nodes[nodeIndex];
@@ -1,6 +1,124 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "InverseKinematics.h"
+#include "Engine/Core/SIMD.h"
+
+namespace
+{
+    Vector3 GetBendDirection(const Vector3& rootPos, const Vector3& toTargetDir, const Vector3& poleVector)
+    {
+        // Calculate the pole vector direction
+        Vector3 poleVectorDelta = poleVector - rootPos;
+        const Real poleVectorLengthSqr = poleVectorDelta.LengthSquared();
+
+        Vector3 jointPlaneNormal, bendDirection;
+        if (poleVectorLengthSqr < ZeroTolerance * ZeroTolerance)
+        {
+            bendDirection = Vector3::Forward;
+            jointPlaneNormal = Vector3::Up;
+        }
+        else
+        {
+            jointPlaneNormal = toTargetDir ^ poleVectorDelta;
+            if (jointPlaneNormal.LengthSquared() < ZeroTolerance * ZeroTolerance)
+            {
+                toTargetDir.FindBestAxisVectors(jointPlaneNormal, bendDirection);
+            }
+            else
+            {
+                jointPlaneNormal.Normalize();
+                bendDirection = poleVectorDelta - (poleVectorDelta | toTargetDir) * toTargetDir;
+                bendDirection.Normalize();
+            }
+        }
+        return bendDirection;
+    }
+
+    Vector3 GetOutOfReachJointPos(const Vector3& rootPos, const Vector3& targetPosition, const Vector3& poleVector, Real upperLimbLength)
+    {
+        // Target is beyond the reach of the limb
+        Vector3 rootToEnd = (targetPosition - rootPos).GetNormalized();
+
+        // Calculate the slight offset towards the pole vector
+        Vector3 rootToPole = (poleVector - rootPos).GetNormalized();
+        Vector3 slightBendDirection = Vector3::Cross(rootToEnd, rootToPole);
+        if (slightBendDirection.LengthSquared() < ZeroTolerance * ZeroTolerance)
+            slightBendDirection = Vector3::Up;
+        else
+            slightBendDirection.Normalize();
+
+        // Calculate the direction from root to mid joint with a slight offset towards the pole vector
+        Vector3 midJointDirection = Vector3::Cross(slightBendDirection, rootToEnd).GetNormalized();
+        Real slightOffset = upperLimbLength * 0.01f; // Small percentage of the limb length for slight offset
+        return rootPos + rootToEnd * (upperLimbLength - slightOffset) + midJointDirection * slightOffset;
+    }
+
+    void ApplyTwoBoneIK(Transform& rootTransform, Transform& midJointTransform, Transform& endEffectorTransform, const Vector3& newMidJointPos, const Vector3& newEndEffectorPos)
+    {
+        // TODO: fix the new IK impl (https://github.com/FlaxEngine/FlaxEngine/pull/2421) to properly work for character from https://github.com/PrecisionRender/CharacterControllerPro
+#define OLD 0
+        // Update root joint orientation
+        {
+#if OLD
+            const Vector3 oldDir = (midJointTransform.Translation - rootTransform.Translation).GetNormalized();
+            const Vector3 newDir = (newMidJointPos - rootTransform.Translation).GetNormalized();
+            const Quaternion deltaRotation = Quaternion::FindBetween(oldDir, newDir);
+            rootTransform.Orientation = deltaRotation * rootTransform.Orientation;
+#else
+            // Vector from root joint to mid joint (local Y-axis direction)
+            Vector3 localY = (newMidJointPos - rootTransform.Translation).GetNormalized();
+
+            // Vector from mid joint to end effector (used to calculate plane normal)
+            Vector3 midToEnd = (newEndEffectorPos - newMidJointPos).GetNormalized();
+
+            // Calculate the plane normal (local Z-axis direction)
+            Vector3 localZ = Vector3::Cross(localY, midToEnd).GetNormalized();
+
+            // Calculate the local X-axis direction, should be perpendicular to the Y and Z axes
+            Vector3 localX = Vector3::Cross(localY, localZ).GetNormalized();
+
+            // Correct the local Z-axis direction based on the cross product of X and Y to ensure orthogonality
+            localZ = Vector3::Cross(localX, localY).GetNormalized();
+
+            // Construct a rotation from the orthogonal basis vectors
+            rootTransform.Orientation = Quaternion::LookRotation(localZ, localY);
+#endif
+        }
+
+        // Update mid joint orientation to point Y-axis towards the end effector and Z-axis perpendicular to the IK plane
+        {
+#if OLD
+            const Vector3 oldDir = (endEffectorTransform.Translation - midJointTransform.Translation).GetNormalized();
+            const Vector3 newDir = (newEndEffectorPos - newMidJointPos).GetNormalized();
+            const Quaternion deltaRotation = Quaternion::FindBetween(oldDir, newDir);
+            midJointTransform.Orientation = deltaRotation * midJointTransform.Orientation;
+#else
+            // Calculate the plane normal using the root, mid joint, and end effector positions (will be the local Z-axis direction)
+            Vector3 rootToMid = (newMidJointPos - rootTransform.Translation).GetNormalized();
+
+            // Vector from mid joint to end effector (local Y-axis direction)
+            Vector3 localY = (newEndEffectorPos - newMidJointPos).GetNormalized();
+
+            // Calculate the plane normal using the root, mid joint, and end effector positions (local Z-axis direction)
+            Vector3 localZ = Vector3::Cross(rootToMid, localY).GetNormalized();
+
+            // Calculate the local X-axis direction, should be perpendicular to the Y and Z axes
+            Vector3 localX = Vector3::Cross(localY, localZ).GetNormalized();
+
+            // Correct the local Z-axis direction based on the cross product of X and Y to ensure orthogonality
+            localZ = Vector3::Cross(localX, localY).GetNormalized();
+
+            // Construct a rotation from the orthogonal basis vectors
+            midJointTransform.Orientation = Quaternion::LookRotation(localZ, localY);
+#endif
+        }
+#undef OLD
+
+        // Update mid and end locations
+        midJointTransform.Translation = newMidJointPos;
+        endEffectorTransform.Translation = newEndEffectorPos;
+    }
+}
 
 void InverseKinematics::SolveAimIK(const Transform& node, const Vector3& target, Quaternion& outNodeCorrection)
 {
@@ -15,7 +133,6 @@ void InverseKinematics::SolveTwoBoneIK(Transform& rootTransform, Transform& midJ
     // Calculate limb segment lengths
     Real lowerLimbLength = (endEffectorTransform.Translation - midJointTransform.Translation).Length();
     Real upperLimbLength = (midJointTransform.Translation - rootTransform.Translation).Length();
-    Vector3 midJointPos = midJointTransform.Translation;
 
     // Calculate the direction and length towards the target
     Vector3 toTargetVector = targetPosition - rootTransform.Translation;
@@ -33,31 +150,7 @@ void InverseKinematics::SolveTwoBoneIK(Transform& rootTransform, Transform& midJ
     {
         toTargetDir = toTargetVector.GetNormalized();
     }
-
-    // Calculate the pole vector direction
-    Vector3 poleVectorDelta = poleVector - rootTransform.Translation;
-    const Real poleVectorLengthSqr = poleVectorDelta.LengthSquared();
-
-    Vector3 jointPlaneNormal, bendDirection;
-    if (poleVectorLengthSqr < ZeroTolerance * ZeroTolerance)
-    {
-        bendDirection = Vector3::Forward;
-        jointPlaneNormal = Vector3::Up;
-    }
-    else
-    {
-        jointPlaneNormal = toTargetDir ^ poleVectorDelta;
-        if (jointPlaneNormal.LengthSquared() < ZeroTolerance * ZeroTolerance)
-        {
-            toTargetDir.FindBestAxisVectors(jointPlaneNormal, bendDirection);
-        }
-        else
-        {
-            jointPlaneNormal.Normalize();
-            bendDirection = poleVectorDelta - (poleVectorDelta | toTargetDir) * toTargetDir;
-            bendDirection.Normalize();
-        }
-    }
+    const Vector3 bendDirection = GetBendDirection(rootTransform.Translation, toTargetDir, poleVector);
 
     // Handle limb stretching if allowed
     if (allowStretching)
@@ -78,25 +171,10 @@ void InverseKinematics::SolveTwoBoneIK(Transform& rootTransform, Transform& midJ
     }
 
     // Calculate new positions for joint and end effector
-    Vector3 newEndEffectorPos = targetPosition;
-    Vector3 newMidJointPos = midJointPos;
+    Vector3 newMidJointPos;
     if (toTargetLength >= totalLimbLength)
     {
-        // Target is beyond the reach of the limb
-        Vector3 rootToEnd = (targetPosition - rootTransform.Translation).GetNormalized();
-
-        // Calculate the slight offset towards the pole vector
-        Vector3 rootToPole = (poleVector - rootTransform.Translation).GetNormalized();
-        Vector3 slightBendDirection = Vector3::Cross(rootToEnd, rootToPole);
-        if (slightBendDirection.LengthSquared() < ZeroTolerance * ZeroTolerance)
-            slightBendDirection = Vector3::Up;
-        else
-            slightBendDirection.Normalize();
-
-        // Calculate the direction from root to mid joint with a slight offset towards the pole vector
-        Vector3 midJointDirection = Vector3::Cross(slightBendDirection, rootToEnd).GetNormalized();
-        Real slightOffset = upperLimbLength * 0.01f; // Small percentage of the limb length for slight offset
-        newMidJointPos = rootTransform.Translation + rootToEnd * (upperLimbLength - slightOffset) + midJointDirection * slightOffset;
+        newMidJointPos = GetOutOfReachJointPos(rootTransform.Translation, targetPosition, poleVector, upperLimbLength);
     }
     else
     {
@@ -112,68 +190,81 @@ void InverseKinematics::SolveTwoBoneIK(Transform& rootTransform, Transform& midJ
             projJointDist *= -1.0f;
         newMidJointPos = rootTransform.Translation + projJointDist * toTargetDir + jointLineDist * bendDirection;
     }
-    // TODO: fix the new IK impl (https://github.com/FlaxEngine/FlaxEngine/pull/2421) to properly work for character from https://github.com/PrecisionRender/CharacterControllerPro
-#define OLD 0
-    // Update root joint orientation
-    {
-#if OLD
-        const Vector3 oldDir = (midJointPos - rootTransform.Translation).GetNormalized();
-        const Vector3 newDir = (newMidJointPos - rootTransform.Translation).GetNormalized();
-        const Quaternion deltaRotation = Quaternion::FindBetween(oldDir, newDir);
-        rootTransform.Orientation = deltaRotation * rootTransform.Orientation;
-#else
-        // Vector from root joint to mid joint (local Y-axis direction)
-        Vector3 localY = (newMidJointPos - rootTransform.Translation).GetNormalized();
-
-        // Vector from mid joint to end effector (used to calculate plane normal)
-        Vector3 midToEnd = (newEndEffectorPos - newMidJointPos).GetNormalized();
 
-        // Calculate the plane normal (local Z-axis direction)
-        Vector3 localZ = Vector3::Cross(localY, midToEnd).GetNormalized();
-
-        // Calculate the local X-axis direction, should be perpendicular to the Y and Z axes
-        Vector3 localX = Vector3::Cross(localY, localZ).GetNormalized();
-
-        // Correct the local Z-axis direction based on the cross product of X and Y to ensure orthogonality
-        localZ = Vector3::Cross(localX, localY).GetNormalized();
-
-        // Construct a rotation from the orthogonal basis vectors
-        rootTransform.Orientation = Quaternion::LookRotation(localZ, localY);
-#endif
-    }
+    ApplyTwoBoneIK(rootTransform, midJointTransform, endEffectorTransform, newMidJointPos, targetPosition);
+}
 
-    // Update mid joint orientation to point Y-axis towards the end effector and Z-axis perpendicular to the IK plane
+void InverseKinematics::SolveTwoBoneIK(Span<TwoBoneIKChain> chains)
+{
+    // Solve limb lengths and joint distances of 4 chains at once (SoA), then finish the orientations of each chain
+    const SimdVector4 zero = SIMD::Splat(0.0f);
+    const SimdVector4 one = SIMD::Splat(1.0f);
+    const SimdVector4 minusOne = SIMD::Splat(-1.0f);
+    const SimdVector4 tolerance = SIMD::Splat(ZeroTolerance);
+    for (int32 start = 0; start < chains.Length(); start += 4)
     {
-#if OLD
-        const Vector3 oldDir = (endEffectorTransform.Translation - midJointPos).GetNormalized();
-        const Vector3 newDir = (newEndEffectorPos - newMidJointPos).GetNormalized();
-        const Quaternion deltaRotation = Quaternion::FindBetween(oldDir, newDir);
-        midJointTransform.Orientation = deltaRotation * midJointTransform.Orientation;
-#else
-        // Vector from mid joint to end effector (local Y-axis direction after rotation)
-        Vector3 midToEnd = (newEndEffectorPos - newMidJointPos).GetNormalized();
+        // Pad the last group with duplicates of the last chain
+        const int32 count = Math::Min(chains.Length() - start, 4);
+        const TwoBoneIKChain* c[4];
+        for (int32 i = 0; i < 4; i++)
+            c[i] = &chains[start + Math::Min(i, count - 1)];
 
-        // Calculate the plane normal using the root, mid joint, and end effector positions (will be the local Z-axis direction)
-        Vector3 rootToMid = (newMidJointPos - rootTransform.Translation).GetNormalized();
+        // Calculate limb segment lengths and the distance towards the target
+#define LOAD_DELTA(a, b, component) SIMD::Load((float)(c[0]->a.component - c[0]->b.component), (float)(c[1]->a.component - c[1]->b.component), (float)(c[2]->a.component - c[2]->b.component), (float)(c[3]->a.component - c[3]->b.component))
+#define LOAD_LENGTH(a, b) SIMD::Sqrt(SIMD::Add(SIMD::Add(SIMD::Mul(LOAD_DELTA(a, b, X), LOAD_DELTA(a, b, X)), SIMD::Mul(LOAD_DELTA(a, b, Y), LOAD_DELTA(a, b, Y))), SIMD::Mul(LOAD_DELTA(a, b, Z), LOAD_DELTA(a, b, Z))))
+        SimdVector4 lowerLimbLength = LOAD_LENGTH(TargetNode.Translation, JointNode.Translation);
+        SimdVector4 upperLimbLength = LOAD_LENGTH(JointNode.Translation, RootNode.Translation);
+        const SimdVector4 toTargetLength = SIMD::Max(LOAD_LENGTH(Target, RootNode.Translation), tolerance);
+#undef LOAD_LENGTH
+#undef LOAD_DELTA
+        SimdVector4 totalLimbLength = SIMD::Add(lowerLimbLength, upperLimbLength);
 
-        // Vector from mid joint to end effector (local Y-axis direction)
-        Vector3 localY = (newEndEffectorPos - newMidJointPos).GetNormalized();
+        // Handle limb stretching (chains without stretching use scale 1 which results in zero scaling factor)
+#define STRETCH_SCALE(i) (c[i]->AllowStretching ? Math::Max(c[i]->MaxStretchScale, 1.0f) : 1.0f)
+        const SimdVector4 maxStretchScale = SIMD::Load(STRETCH_SCALE(0), STRETCH_SCALE(1), STRETCH_SCALE(2), STRETCH_SCALE(3));
+#undef STRETCH_SCALE
+        const SimdVector4 stretchRange = SIMD::Sub(maxStretchScale, one);
+        const SimdVector4 reachRatio = SIMD::Div(toTargetLength, SIMD::Max(totalLimbLength, tolerance));
+        const SimdVector4 stretchAlpha = SIMD::Min(SIMD::Max(SIMD::Div(SIMD::Sub(reachRatio, one), SIMD::Max(stretchRange, tolerance)), zero), one);
+        const SimdVector4 stretch = SIMD::Add(one, SIMD::Mul(stretchRange, stretchAlpha));
+        lowerLimbLength = SIMD::Mul(lowerLimbLength, stretch);
+        upperLimbLength = SIMD::Mul(upperLimbLength, stretch);
+        totalLimbLength = SIMD::Mul(totalLimbLength, stretch);
 
-        // Calculate the plane normal using the root, mid joint, and end effector positions (local Z-axis direction)
-        Vector3 localZ = Vector3::Cross(rootToMid, localY).GetNormalized();
+        // Calculate the joint distances from the law of cosines (sin(acos(x)) = sqrt(1 - x^2))
+        const SimdVector4 twoAb = SIMD::Max(SIMD::Mul(SIMD::Splat(2.0f), SIMD::Mul(upperLimbLength, toTargetLength)), tolerance);
+        SimdVector4 cosAngle = SIMD::Div(SIMD::Sub(SIMD::Add(SIMD::Mul(upperLimbLength, upperLimbLength), SIMD::Mul(toTargetLength, toTargetLength)), SIMD::Mul(lowerLimbLength, lowerLimbLength)), twoAb);
+        cosAngle = SIMD::Min(SIMD::Max(cosAngle, minusOne), one);
+        const SimdVector4 jointLineDist = SIMD::Mul(upperLimbLength, SIMD::Sqrt(SIMD::Max(SIMD::Sub(one, SIMD::Mul(cosAngle, cosAngle)), zero)));
+        const SimdVector4 projJointDist = SIMD::Mul(upperLimbLength, cosAngle);
+        const int32 inReachMask = SIMD::MoveMask(SIMD::Less(toTargetLength, totalLimbLength));
 
-        // Calculate the local X-axis direction, should be perpendicular to the Y and Z axes
-        Vector3 localX = Vector3::Cross(localY, localZ).GetNormalized();
+        ALIGN_BEGIN(16) float data[3][4] ALIGN_END(16);
+        SIMD::Store(data[0], upperLimbLength);
+        SIMD::Store(data[1], jointLineDist);
+        SIMD::Store(data[2], projJointDist);
 
-        // Correct the local Z-axis direction based on the cross product of X and Y to ensure orthogonality
-        localZ = Vector3::Cross(localX, localY).GetNormalized();
-
-        // Construct a rotation from the orthogonal basis vectors
-        midJointTransform.Orientation = Quaternion::LookRotation(localZ, localY);
-#endif
+        // Calculate new positions for joint and end effector
+        for (int32 i = 0; i < count; i++)
+        {
+            TwoBoneIKChain& chain = chains[start + i];
+            const Vector3& rootPos = chain.RootNode.Translation;
+            Vector3 newMidJointPos;
+            if (inReachMask & (1 << i))
+            {
+                Vector3 toTargetDir = chain.Target - rootPos;
+                if (toTargetDir.LengthSquared() < ZeroTolerance * ZeroTolerance)
+                    toTargetDir = Vector3(1, 0, 0);
+                else
+                    toTargetDir.Normalize();
+                const Vector3 bendDirection = GetBendDirection(rootPos, toTargetDir, chain.JointTarget);
+                newMidJointPos = rootPos + (Real)data[2][i] * toTargetDir + (Real)data[1][i] * bendDirection;
+            }
+            else
+            {
+                newMidJointPos = GetOutOfReachJointPos(rootPos, chain.Target, chain.JointTarget, (Real)data[0][i]);
+            }
+            ApplyTwoBoneIK(chain.RootNode, chain.JointNode, chain.TargetNode, newMidJointPos, chain.Target);
+        }
     }
-
-    // Update mid and end locations
-    midJointTransform.Translation = newMidJointPos;
-    endEffectorTransform.Translation = newEndEffectorPos;
 }
@@ -5,12 +5,35 @@
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Types/Span.h"
 
 /// <summary>
 /// The Inverse Kinematics (IK) utility library.
 /// </summary>
 class FLAXENGINE_API InverseKinematics
 {
+public:
+    /// <summary>
+    /// The three nodes chain for the batched two bone IK solver.
+    /// </summary>
+    struct TwoBoneIKChain
+    {
+        // The start node transformation (in model space). Updated by the solver.
+        Transform RootNode;
+        // The middle node transformation (in model space). Updated by the solver.
+        Transform JointNode;
+        // The end node transformation (in model space). Updated by the solver.
+        Transform TargetNode;
+        // The target position of the end node to reach (in model space).
+        Vector3 Target;
+        // The target position of the middle node to face into (in model space).
+        Vector3 JointTarget;
+        // True if allow bones stretching, otherwise bone lengths will be preserved when trying to reach the target.
+        bool AllowStretching;
+        // The maximum scale when stretching bones. Used only if AllowStretching is true.
+        float MaxStretchScale;
+    };
+
 public:
     /// <summary>
     /// Rotates a node so it aims at a target. Solves the transformation (rotation) that needs to be applied to the node such that a provided forward vector (in node local space) aims at the target position (in skeleton model space).
@@ -31,4 +54,10 @@ class FLAXENGINE_API InverseKinematics
     /// <param name="allowStretching">True if allow bones stretching, otherwise bone lengths will be preserved when trying to reach the target.</param>
     /// <param name="maxStretchScale">The maximum scale when stretching bones. Used only if allowStretching is true.</param>
     static void SolveTwoBoneIK(Transform& rootNode, Transform& jointNode, Transform& targetNode, const Vector3& target, const Vector3& jointTarget, bool allowStretching = false, float maxStretchScale = 1.5f);
+
+    /// <summary>
+    /// Performs inverse kinematic on the multiple three nodes chains at once (eg. feet of all characters). Solves the limbs lengths and joint angles of 4 chains at once with SIMD.
+    /// </summary>
+    /// <param name="chains">The chains to solve (transformations are updated in-place).</param>
+    static void SolveTwoBoneIK(Span<TwoBoneIKChain> chains);
 };
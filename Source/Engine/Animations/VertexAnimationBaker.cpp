@@ -0,0 +1,229 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "VertexAnimationBaker.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Animation.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Content/Assets/Texture.h"
+#include "Engine/Graphics/Config.h"
+#include "Engine/Graphics/PixelFormat.h"
+#include "Engine/Graphics/Models/MeshBase.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The maximum width of the vertex animation texture (vertices of a single frame wrap into multiple rows)
+#define VAT_MAX_WIDTH 4096
+
+namespace
+{
+    struct BakeMeshData
+    {
+        BytesContainer Vertices;
+        BytesContainer Indices;
+        int32 VerticesCount;
+        int32 IndicesCount;
+        int32 VertexOffset;
+        BoundingBox Box;
+    };
+}
+
+bool VertexAnimationBaker::Bake(SkinnedModel* model, Animation* animation, Texture*& positions, Model*& staticModel, int32& framesCount, float frameRate, int32 lodIndex)
+{
+    PROFILE_CPU();
+    positions = nullptr;
+    staticModel = nullptr;
+    framesCount = 0;
+    if (!model || !animation || frameRate <= ZeroTolerance)
+    {
+        LOG(Warning, "Invalid vertex animation baking arguments.");
+        return true;
+    }
+    if (model->WaitForLoaded() || animation->WaitForLoaded())
+    {
+        LOG(Warning, "Failed to load assets for vertex animation baking.");
+        return true;
+    }
+    if (lodIndex < 0 || lodIndex >= model->LODs.Count())
+    {
+        LOG(Warning, "Invalid LOD index {0} for vertex animation baking of '{1}'.", lodIndex, model->ToString());
+        return true;
+    }
+    const SkinnedModel::SkeletonMapping mapping = model->GetSkeletonMapping(animation);
+    if (mapping.NodesMapping.IsInvalid())
+    {
+        LOG(Warning, "Failed to get skeleton mapping of '{0}' for animation '{1}'.", model->ToString(), animation->ToString());
+        return true;
+    }
+    if (mapping.SourceSkeleton && mapping.SourceSkeleton != mapping.TargetSkeleton)
+    {
+        LOG(Warning, "Vertex animation baking doesn't support retargeted animations ('{0}').", animation->ToString());
+        return true;
+    }
+
+    // Get the source meshes data
+    const auto& meshes = model->LODs[lodIndex].Meshes;
+    Array<BakeMeshData> meshesData;
+    meshesData.Resize(meshes.Count());
+    int32 verticesCount = 0;
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+    {
+        const auto& mesh = meshes[meshIndex];
+        auto& data = meshesData[meshIndex];
+        if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, data.Vertices, data.VerticesCount) ||
+            mesh.DownloadDataCPU(MeshBufferType::Index, data.Indices, data.IndicesCount))
+        {
+            LOG(Warning, "Failed to get mesh data of '{0}' for vertex animation baking.", model->ToString());
+            return true;
+        }
+        data.VertexOffset = verticesCount;
+        data.Box = BoundingBox(Vector3::Maximum, Vector3::Minimum);
+        verticesCount += data.VerticesCount;
+    }
+    if (verticesCount == 0 || verticesCount > (1 << 24))
+    {
+        LOG(Warning, "Invalid vertices count {0} for vertex animation baking of '{1}'.", verticesCount, model->ToString());
+        return true;
+    }
+
+    // Calculate the texture layout (each frame uses rowsPerFrame texture rows)
+    framesCount = Math::Max(Math::RoundToInt(animation->GetLength() * frameRate), 1);
+    const int32 width = Math::Min(verticesCount, VAT_MAX_WIDTH);
+    const int32 rowsPerFrame = Math::DivideAndRoundUp(verticesCount, width);
+    const int32 height = framesCount * rowsPerFrame;
+    if (height > GPU_MAX_TEXTURE_SIZE)
+    {
+        LOG(Warning, "Too many frames ({0}) for vertex animation baking of '{1}'. Use lower frame rate or shorter animation.", framesCount, animation->ToString());
+        framesCount = 0;
+        return true;
+    }
+    auto initData = New<TextureBase::InitData>();
+    initData->Format = PixelFormat::R32G32B32A32_Float;
+    initData->Width = width;
+    initData->Height = height;
+    initData->ArraySize = 1;
+    initData->Mips.Resize(1);
+    auto& mip = initData->Mips[0];
+    mip.RowPitch = width * sizeof(Float4);
+    mip.SlicePitch = mip.RowPitch * height;
+    mip.Data.Allocate(mip.SlicePitch);
+    Platform::MemoryClear(mip.Data.Get(), mip.SlicePitch);
+    Float4* texels = (Float4*)mip.Data.Get();
+
+    // Bake frames
+    const SkeletonData& skeleton = model->Skeleton;
+    Array<Matrix> nodesPose, bonesMatrices;
+    nodesPose.Resize(skeleton.Nodes.Count());
+    bonesMatrices.Resize(skeleton.Bones.Count());
+    for (int32 frame = 0; frame < framesCount; frame++)
+    {
+        // Evaluate skeleton pose (nodes are sorted parent-first)
+        const float animPos = (float)frame / frameRate * (float)animation->Data.FramesPerSecond;
+        for (int32 nodeIndex = 0; nodeIndex < skeleton.Nodes.Count(); nodeIndex++)
+        {
+            const SkeletonNode& node = skeleton.Nodes[nodeIndex];
+            Transform localTransform = node.LocalTransform;
+            const int32 nodeToChannel = mapping.NodesMapping[nodeIndex];
+            if (nodeToChannel != -1)
+                animation->Data.EvaluateChannel(nodeToChannel, animPos, &localTransform);
+            Matrix localMatrix;
+            localTransform.GetWorld(localMatrix);
+            if (node.ParentIndex != -1)
+                Matrix::Multiply(localMatrix, nodesPose[node.ParentIndex], nodesPose[nodeIndex]);
+            else
+                nodesPose[nodeIndex] = localMatrix;
+        }
+        for (int32 boneIndex = 0; boneIndex < skeleton.Bones.Count(); boneIndex++)
+        {
+            const SkeletonBone& bone = skeleton.Bones[boneIndex];
+            Matrix::Multiply(bone.OffsetMatrix, nodesPose[bone.NodeIndex], bonesMatrices[boneIndex]);
+        }
+
+        // Skin vertices (the same way as the skinning in the material vertex shader)
+        for (auto& data : meshesData)
+        {
+            const auto vertices = (const VB0SkinnedElementType*)data.Vertices.Get();
+            for (int32 i = 0; i < data.VerticesCount; i++)
+            {
+                const VB0SkinnedElementType& v = vertices[i];
+                const Float4 weights = v.BlendWeights.ToFloat4();
+                const float mainWeight = weights.X + (1.0f - (weights.X + weights.Y + weights.Z + weights.W));
+                Float3 position = Float3::Transform(v.Position, bonesMatrices[v.BlendIndices.R]) * mainWeight;
+                position += Float3::Transform(v.Position, bonesMatrices[v.BlendIndices.G]) * weights.Y;
+                position += Float3::Transform(v.Position, bonesMatrices[v.BlendIndices.B]) * weights.Z;
+                position += Float3::Transform(v.Position, bonesMatrices[v.BlendIndices.A]) * weights.W;
+                data.Box.Merge(position);
+                const int32 vertexIndex = data.VertexOffset + i;
+                texels[(frame * rowsPerFrame + vertexIndex / width) * width + vertexIndex % width] = Float4(position, 1.0f);
+            }
+        }
+    }
+
+    // Create the texture
+    auto texture = Content::CreateVirtualAsset<Texture>();
+    if (texture == nullptr)
+        Delete(initData);
+    if (texture == nullptr || texture->Init(initData))
+    {
+        LOG(Warning, "Failed to create vertex animation texture.");
+        framesCount = 0;
+        return true;
+    }
+
+    // Create the static model (vertex color stores the index of the vertex in the texture)
+    auto result = Content::CreateVirtualAsset<Model>();
+    int32 meshesCount = meshes.Count();
+    if (result == nullptr || result->SetupLODs(Span<int32>(&meshesCount, 1)))
+    {
+        LOG(Warning, "Failed to create vertex animation model.");
+        framesCount = 0;
+        return true;
+    }
+    result->SetupMaterialSlots(model->MaterialSlots.Count());
+    for (int32 slotIndex = 0; slotIndex < model->MaterialSlots.Count(); slotIndex++)
+    {
+        const MaterialSlot& src = model->MaterialSlots[slotIndex];
+        MaterialSlot& dst = result->MaterialSlots[slotIndex];
+        dst.Material = src.Material;
+        dst.ShadowsMode = src.ShadowsMode;
+        dst.Name = src.Name;
+    }
+    Array<VB0ElementType> vb0;
+    Array<VB1ElementType> vb1;
+    Array<VB2ElementType> vb2;
+    for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+    {
+        const auto& data = meshesData[meshIndex];
+        const auto vertices = (const VB0SkinnedElementType*)data.Vertices.Get();
+        vb0.Resize(data.VerticesCount, false);
+        vb1.Resize(data.VerticesCount, false);
+        vb2.Resize(data.VerticesCount, false);
+        for (int32 i = 0; i < data.VerticesCount; i++)
+        {
+            const VB0SkinnedElementType& v = vertices[i];
+            const uint32 vertexIndex = (uint32)(data.VertexOffset + i);
+            vb0[i].Position = v.Position;
+            vb1[i].TexCoord = v.TexCoord;
+            vb1[i].Normal = v.Normal;
+            vb1[i].Tangent = v.Tangent;
+            vb1[i].LightmapUVs = Half2::Zero;
+            vb2[i].Color = Color32(vertexIndex & 0xff, (vertexIndex >> 8) & 0xff, (vertexIndex >> 16) & 0xff, 255);
+        }
+        Mesh& mesh = result->LODs[0].Meshes[meshIndex];
+        mesh.SetMaterialSlotIndex(meshes[meshIndex].GetMaterialSlotIndex());
+        if (mesh.UpdateMesh(data.VerticesCount, data.IndicesCount / 3, vb0.Get(), vb1.Get(), vb2.Get(), data.Indices.Get(), meshes[meshIndex].Use16BitIndexBuffer()))
+        {
+            LOG(Warning, "Failed to create vertex animation model.");
+            framesCount = 0;
+            return true;
+        }
+
+        // Use bounds of the all baked frames
+        mesh.SetBounds(data.Box);
+    }
+
+    positions = texture;
+    staticModel = result;
+    return false;
+}
@@ -0,0 +1,31 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Scripting/ScriptingType.h"
+
+class SkinnedModel;
+class Animation;
+class Texture;
+class Model;
+
+/// <summary>
+/// The vertex animation textures (VAT) baking utility. Samples the skeletal animation over the skinned model and stores the skinned vertex positions of every frame in a texture that can be played back in the material vertex shader (via Vertex Animation Texture node) on a static model. Used to render large crowds with instancing (no bones update nor skinning per instance).
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API VertexAnimationBaker
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(VertexAnimationBaker);
+
+    /// <summary>
+    /// Bakes the animation into the vertex animation texture. Output texture contains the model-space vertex positions (rows of the texture width per frame, frames stored one after another). Output model is a static copy of the skinned model with vertex colors that encode the vertex index into the texture.
+    /// </summary>
+    /// <param name="model">The source skinned model.</param>
+    /// <param name="animation">The animation to bake (uses the skinned model skeleton, retargeting is not supported).</param>
+    /// <param name="positions">The output virtual texture with the baked vertex positions.</param>
+    /// <param name="staticModel">The output virtual static model to draw with the vertex animation material.</param>
+    /// <param name="framesCount">The output amount of the baked frames (to be used in the material node).</param>
+    /// <param name="frameRate">The sampling rate of the animation (frames per second).</param>
+    /// <param name="lodIndex">The index of the skinned model LOD to bake.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool Bake(SkinnedModel* model, Animation* animation, API_PARAM(Out) Texture*& positions, API_PARAM(Out) Model*& staticModel, API_PARAM(Out) int32& framesCount, float frameRate = 30.0f, int32 lodIndex = 0);
+};
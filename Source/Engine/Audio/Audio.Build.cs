@@ -23,6 +23,7 @@ public override void Setup(BuildOptions options)
         bool useNone = true;
         bool useOpenAL = false;
         bool useXAudio2 = false;
+        bool useSoftware = false;
 
         switch (options.Platform.Target)
         {
@@ -63,6 +64,9 @@ public override void Setup(BuildOptions options)
         default: throw new InvalidPlatformException(options.Platform.Target);
         }
 
+        // Software mixer outputs the final mix via OpenAL device
+        useSoftware = useOpenAL;
+
         if (useNone)
         {
             options.SourcePaths.Add(Path.Combine(FolderPath, "None"));
@@ -103,6 +107,12 @@ public override void Setup(BuildOptions options)
             }
         }
 
+        if (useSoftware)
+        {
+            options.SourcePaths.Add(Path.Combine(FolderPath, "Software"));
+            options.CompileEnv.PreprocessorDefinitions.Add("AUDIO_API_SOFTWARE");
+        }
+
         if (useXAudio2)
         {
             options.SourcePaths.Add(Path.Combine(FolderPath, "XAudio2"));
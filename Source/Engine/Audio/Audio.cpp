@@ -2,19 +2,27 @@
 
 #include "Audio.h"
 #include "AudioBackend.h"
+#include "AudioListener.h"
 #include "AudioSettings.h"
+#include "AudioSource.h"
+#include "AudioStreamingDecoder.h"
 #include "FlaxEngine.Gen.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Scripting/BinaryModule.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/EngineService.h"
 #if AUDIO_API_NONE
 #include "None/AudioBackendNone.h"
 #endif
+#if AUDIO_API_SOFTWARE
+#include "Software/AudioBackendSoftware.h"
+#endif
 #if AUDIO_API_PS4
 #include "Platforms/PS4/Engine/Audio/AudioBackendPS4.h"
 #endif
@@ -31,6 +39,9 @@
 #include "XAudio2/AudioBackendXAudio2.h"
 #endif
 
+// The audibility scale of the virtual voice required to restore it (prevents voices from flickering around the audibility threshold)
+#define AUDIO_VOICE_RESTORE_AUDIBILITY_SCALE 1.5f
+
 float AudioDataInfo::GetLength() const
 {
     return (float)NumSamples / (float)Math::Max(1U, SampleRate * NumChannels);
@@ -50,8 +61,25 @@ namespace
     int32 ActiveDeviceIndex = -1;
     bool MuteOnFocusLoss = true;
     bool EnableHRTF = true;
+    int32 MaxVoices = 64;
+    float AudibilityThreshold = 0.001f;
+    Array<int32> VoiceCategoryLimits;
 }
 
+struct AudioVoice
+{
+    AudioSource* Source;
+    float Audibility;
+
+    bool operator<(const AudioVoice& other) const
+    {
+        // Higher priority first, then the more audible ones
+        if (Source->GetPriority() != other.Source->GetPriority())
+            return Source->GetPriority() > other.Source->GetPriority();
+        return Audibility > other.Audibility;
+    }
+};
+
 class AudioService : public EngineService
 {
 public:
@@ -64,6 +92,8 @@ class AudioService : public EngineService
     bool Init() override;
     void Update() override;
     void Dispose() override;
+
+    static void UpdateVoices();
 };
 
 AudioService AudioServiceInstance;
@@ -84,6 +114,11 @@ namespace
 void AudioSettings::Apply()
 {
     ::MuteOnFocusLoss = MuteOnFocusLoss;
+    ::MaxVoices = MaxVoices;
+    ::AudibilityThreshold = AudibilityThreshold;
+    VoiceCategoryLimits.Resize(VoiceCategories.Count());
+    for (int32 i = 0; i < VoiceCategories.Count(); i++)
+        VoiceCategoryLimits[i] = VoiceCategories[i].MaxVoices;
     if (AudioBackend::Instance != nullptr)
     {
         Audio::SetDopplerFactor(DopplerFactor);
@@ -201,6 +236,10 @@ bool AudioService::Init()
     if (mute)
         backend = New<AudioBackendNone>();
 #endif
+#if AUDIO_API_SOFTWARE
+    if (!backend && settings->EnableSoftwareMixer)
+        backend = New<AudioBackendSoftware>();
+#endif
 #if AUDIO_API_PS4
     if (!backend)
         backend = New<AudioBackendPS4>();
@@ -242,6 +281,7 @@ bool AudioService::Init()
     {
         LOG(Warning, "Failed to initialize audio backend.");
     }
+    AudioStreamingDecoder::Init();
 
     Engine::Pause.Bind(&OnEnginePause);
     Engine::Unpause.Bind(&OnEngineUnpause);
@@ -252,6 +292,7 @@ bool AudioService::Init()
 void AudioService::Update()
 {
     PROFILE_CPU_NAMED("Audio.Update");
+    PROFILE_MEM(Audio);
 
     // Update the master volume
     float masterVolume = MasterVolume;
@@ -266,14 +307,79 @@ void AudioService::Update()
         AudioBackend::SetVolume(masterVolume);
     }
 
+    AudioStreamingDecoder::Update();
+    UpdateVoices();
+
     AudioBackend::Update();
 }
 
+void AudioService::UpdateVoices()
+{
+    if (Audio::Sources.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Audio.UpdateVoices");
+
+    // Calculate audibility of the playing sources
+    Array<AudioVoice, InlinedAllocation<256>> voices;
+    for (AudioSource* source : Audio::Sources)
+    {
+        if (source->GetState() != AudioSource::States::Playing || (!source->_isActuallyPlayingSth && !source->_isVirtual) || source->SourceIDs.IsEmpty())
+            continue;
+        float audibility = source->GetVolume();
+        if (source->Is3D() && Audio::Listeners.HasItems())
+        {
+            const Vector3 position = source->GetPosition();
+            Real distance = MAX_Real;
+            for (const AudioListener* listener : Audio::Listeners)
+                distance = Math::Min(distance, Vector3::Distance(listener->GetPosition(), position));
+
+            // Calculate attenuation (the same as AudioBackendTools::CalculateSoundMix)
+            const float minDistance = source->GetMinDistance();
+            const float dst = minDistance + source->GetAttenuation() * (Math::Max((float)distance, minDistance) - minDistance);
+            if (dst > 0)
+                audibility *= Math::Saturate(minDistance / dst);
+        }
+        voices.Add({ source, audibility });
+    }
+    if (voices.IsEmpty())
+        return;
+    Sorting::QuickSort(voices.Get(), voices.Count());
+
+    // Pick the voices to play and virtualize others
+    Array<int32, InlinedAllocation<16>> categoryCounts;
+    categoryCounts.Resize(VoiceCategoryLimits.Count());
+    categoryCounts.SetAll(0);
+    int32 voicesCount = 0;
+    for (const AudioVoice& voice : voices)
+    {
+        AudioSource* source = voice.Source;
+        const float threshold = source->_isVirtual ? AudibilityThreshold * AUDIO_VOICE_RESTORE_AUDIBILITY_SCALE : AudibilityThreshold;
+        bool play = (AudibilityThreshold <= 0.0f || voice.Audibility >= threshold) && (MaxVoices <= 0 || voicesCount < MaxVoices);
+        const int32 category = source->_voiceCategory;
+        const bool hasCategory = category >= 0 && category < categoryCounts.Count() && VoiceCategoryLimits[category] > 0;
+        if (play && hasCategory)
+            play = categoryCounts[category] < VoiceCategoryLimits[category];
+        if (play)
+        {
+            voicesCount++;
+            if (hasCategory)
+                categoryCounts[category]++;
+            if (source->_isVirtual)
+                source->Devirtualize();
+        }
+        else if (!source->_isVirtual)
+        {
+            source->Virtualize();
+        }
+    }
+}
+
 void AudioService::Dispose()
 {
     ASSERT(Audio::Sources.IsEmpty() && Audio::Listeners.IsEmpty());
 
     // Cleanup
+    AudioStreamingDecoder::Dispose();
     Audio::Devices.Resize(0);
     if (AudioBackend::Instance)
     {
@@ -21,6 +21,8 @@ class AudioBackend
         None = 0,
         // Supports multi-channel (incl. stereo) audio playback for spatial sources (3D), otherwise 3d audio needs to be in mono format.
         SpatialMultiChannel = 1,
+        // Supports playback of the IMA ADPCM compressed buffers (decoded during playback), otherwise audio needs to be decompressed before writing to the buffer.
+        CompressedADPCM = 2,
     };
 
     static AudioBackend* Instance;
@@ -61,6 +63,9 @@ class AudioBackend
     virtual uint32 Buffer_Create() = 0;
     virtual void Buffer_Delete(uint32 bufferId) = 0;
     virtual void Buffer_Write(uint32 bufferId, byte* samples, const AudioDataInfo& info) = 0;
+    virtual void Buffer_WriteCompressed(uint32 bufferId, byte* data, uint32 dataSize, AudioFormat format, const AudioDataInfo& info)
+    {
+    }
 
     // Base
     virtual const Char* Base_Name() = 0;
@@ -238,6 +243,11 @@ class AudioBackend
         {
             Instance->Buffer_Write(bufferId, samples, info);
         }
+
+        FORCE_INLINE static void WriteCompressed(uint32 bufferId, byte* data, uint32 dataSize, AudioFormat format, const AudioDataInfo& info)
+        {
+            Instance->Buffer_WriteCompressed(bufferId, data, dataSize, format, info);
+        }
     };
 
     FORCE_INLINE static const Char* Name()
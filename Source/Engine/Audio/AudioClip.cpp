@@ -4,6 +4,7 @@
 #include "Audio.h"
 #include "AudioSource.h"
 #include "AudioBackend.h"
+#include "AudioStreamingDecoder.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Upgraders/AudioClipUpgrader.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
@@ -14,6 +15,15 @@
 #include "Engine/Tools/AudioTool/AudioTool.h"
 #include "Engine/Threading/Threading.h"
 
+// The minimum audio streaming read-ahead time (in seconds)
+#define AUDIO_STREAMING_READ_AHEAD_MIN 2.0f
+
+// The maximum audio streaming read-ahead time (in seconds)
+#define AUDIO_STREAMING_READ_AHEAD_MAX 10.0f
+
+// The assumed worst-case throughput of the audio chunk loading and decoding (in bytes per second, when loading threads are busy). Used to size the streaming read-ahead from the clip bitrate.
+#define AUDIO_STREAMING_THROUGHPUT (1024.0f * 1024.0f)
+
 REGISTER_BINARY_ASSET_WITH_UPGRADER(AudioClip, "FlaxEngine.AudioClip", AudioClipUpgrader, false);
 
 bool AudioClip::StreamingTask::Run()
@@ -53,16 +63,8 @@ bool AudioClip::StreamingTask::Run()
         }
     }
 
-    // Update the sources
-    for (int32 sourceIndex = 0; sourceIndex < Audio::Sources.Count(); sourceIndex++)
-    {
-        // TODO: collect refs to audio clip from sources and use faster iteration (but do it thread-safe)
-        const auto src = Audio::Sources[sourceIndex];
-        if (src->Clip == clip && src->GetState() == AudioSource::States::Playing)
-        {
-            src->RequestStreamingBuffersUpdate();
-        }
-    }
+    // Update the sources (on the main thread if decoded on the audio streaming thread)
+    AudioStreamingDecoder::OnBuffersUpdated(clip);
 
     return false;
 }
@@ -82,12 +84,20 @@ void AudioClip::StreamingTask::OnEnd()
     ThreadPoolTask::OnEnd();
 }
 
+void AudioClip::StreamingTask::Enqueue()
+{
+    // Decode on the dedicated audio thread, fallback to the thread pool
+    if (AudioStreamingDecoder::Enqueue(this))
+        ThreadPoolTask::Enqueue();
+}
+
 AudioClip::AudioClip(const SpawnParams& params, const AssetInfo* info)
     : BinaryAsset(params, info)
     , StreamableResource(StreamingGroups::Instance()->Audio())
     , _totalChunks(0)
     , _totalChunksSize(0)
     , _streamingTask(nullptr)
+    , _streamingReadAhead(AUDIO_STREAMING_READ_AHEAD_MIN)
 {
     Platform::MemoryClear(&AudioHeader, sizeof(AudioHeader));
     Platform::MemoryClear(&_buffersStartTimes, sizeof(_buffersStartTimes));
@@ -218,6 +228,30 @@ bool AudioClip::ExtractDataRaw(Array<byte>& resultData, AudioDataInfo& resultDat
 		return true;
 #endif
     }
+    case AudioFormat::ADPCM:
+    {
+        Array<byte> adpcmData;
+        if (ExtractData(adpcmData, resultDataInfo))
+            return true;
+
+        // Decode chunks separately (each chunk contains whole blocks)
+        const uint32 numChannels = resultDataInfo.NumChannels;
+        resultDataInfo.NumSamples = 0;
+        for (int32 i = 0; i < _totalChunks; i++)
+            resultDataInfo.NumSamples += AudioHeader.SamplesPerChunk[i];
+        resultData.Resize(resultDataInfo.NumSamples * sizeof(int16));
+        const byte* src = adpcmData.Get();
+        int16* dst = (int16*)resultData.Get();
+        for (int32 i = 0; i < _totalChunks; i++)
+        {
+            const uint32 numFrames = AudioHeader.SamplesPerChunk[i] / numChannels;
+            AudioTool::ConvertFromADPCM(src, dst, numFrames, numChannels);
+            src += AudioTool::GetADPCMSize(numFrames, numChannels);
+            dst += numFrames * numChannels;
+        }
+        resultDataInfo.BitDepth = 16;
+        return false;
+    }
     }
 
     return true;
@@ -347,6 +381,12 @@ Asset::LoadResult AudioClip::load()
         _buffersStartTimes[i + 1] = _buffersStartTimes[i] + AudioHeader.SamplesPerChunk[i] * scale;
     }
 
+    // Setup the streaming read-ahead to cover the time needed to load and decode the next chunk (chunk data size follows the clip bitrate)
+    float maxChunkLoadTime = 0.0f;
+    for (int32 i = 0; i < _totalChunks; i++)
+        maxChunkLoadTime = Math::Max(maxChunkLoadTime, (float)GetChunkSize(i) / AUDIO_STREAMING_THROUGHPUT);
+    _streamingReadAhead = Math::Clamp(AUDIO_STREAMING_READ_AHEAD_MIN + maxChunkLoadTime, AUDIO_STREAMING_READ_AHEAD_MIN, AUDIO_STREAMING_READ_AHEAD_MAX);
+
 #if !BUILD_RELEASE
     // Validate buffer start times
     if (!Math::NearEqual(_buffersStartTimes[_totalChunks], GetLength(), 1.0f / 60.0f))
@@ -455,6 +495,27 @@ bool AudioClip::WriteBuffer(int32 chunkIndex)
 #endif
     }
     break;
+    case AudioFormat::ADPCM:
+    {
+        const uint32 numFrames = AudioHeader.SamplesPerChunk[chunkIndex] / info.NumChannels;
+        if (chunk->Size() < AudioTool::GetADPCMSize(numFrames, info.NumChannels))
+        {
+            LOG(Warning, "Invalid ADPCM audio data size.");
+            return true;
+        }
+        const bool needsMono = Is3D() && info.NumChannels > 1 && EnumHasNoneFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::SpatialMultiChannel);
+        if (!needsMono && EnumHasAnyFlags(AudioBackend::Features(), AudioBackend::FeatureFlags::CompressedADPCM))
+        {
+            // Keep the data compressed in memory (backend decodes it during playback)
+            info.NumSamples = numFrames * info.NumChannels;
+            AudioBackend::Buffer::WriteCompressed(bufferId, chunk->Get(), chunk->Size(), AudioFormat::ADPCM, info);
+            return false;
+        }
+        tmp1.Resize(numFrames * info.NumChannels * sizeof(int16));
+        AudioTool::ConvertFromADPCM(chunk->Get(), (int16*)tmp1.Get(), numFrames, info.NumChannels);
+        data = Span<byte>(tmp1.Get(), tmp1.Count());
+    }
+    break;
     case AudioFormat::Raw:
         data = Span<byte>(chunk->Get(), chunk->Size());
         break;
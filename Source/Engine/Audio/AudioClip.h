@@ -35,10 +35,12 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     };
 
     /// <summary>
-    /// Audio clip streaming task
+    /// Audio clip streaming task. Executed on the dedicated audio streaming thread (see AudioStreamingDecoder).
     /// </summary>
     class StreamingTask : public ThreadPoolTask
     {
+        friend class AudioStreamingDecoder;
+
     private:
         WeakAssetReference<AudioClip> _asset;
         FlaxStorage::LockData _dataLock;
@@ -65,6 +67,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
         // [ThreadPoolTask]
         bool Run() override;
         void OnEnd() override;
+        void Enqueue() override;
     };
 
 private:
@@ -72,6 +75,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     int32 _totalChunksSize;
     StreamingTask* _streamingTask;
     float _buffersStartTimes[ASSET_FILE_DATA_CHUNKS + 1];
+    float _streamingReadAhead;
 
 public:
     /// <summary>
@@ -160,6 +164,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API AudioClip : public BinaryAsset, public S
     /// <returns>The buffer index.</returns>
     int32 GetFirstBufferIndex(float time, float& offset) const;
 
+    /// <summary>
+    /// Gets the streaming read-ahead time (in seconds). Audio chunks that start within that time from the current playback position are streamed in advance. Sized from the clip bitrate (larger chunks take more time to load and decode).
+    /// </summary>
+    FORCE_INLINE float GetStreamingReadAhead() const
+    {
+        return _streamingReadAhead;
+    }
+
 public:
     /// <summary>
     /// Extracts the source audio data from the asset storage. Loads the whole asset. The result data is in an asset format.
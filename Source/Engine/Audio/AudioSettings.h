@@ -3,6 +3,40 @@
 #pragma once
 
 #include "Engine/Core/Config/Settings.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/String.h"
+
+/// <summary>
+/// Audio voices category that limits the amount of playing audio sources of a certain kind (eg. footsteps or gun shots).
+/// </summary>
+API_STRUCT() struct FLAXENGINE_API AudioVoiceCategory
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(AudioVoiceCategory);
+
+    /// <summary>
+    /// The category name.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(0)")
+    String Name;
+
+    /// <summary>
+    /// The maximum amount of audio sources from this category that can be played at once (others are virtualized). Use 0 to not limit it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0)")
+    int32 MaxVoices = 16;
+
+    /// <summary>
+    /// The volume of the category bus. Applied only by the software audio mixer.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0, 4, 0.01f)")
+    float Volume = 1.0f;
+
+    /// <summary>
+    /// The cutoff frequency (in Hz) of the low-pass filter applied to the category bus (eg. to muffle the sounds). Use 0 to disable it. Applied only by the software audio mixer.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0, 24000)")
+    float LowPassFrequency = 0.0f;
+};
 
 /// <summary>
 /// Audio settings container.
@@ -38,6 +72,36 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(300), DefaultValue(true), EditorDisplay(\"Spatial Audio\")")
     bool EnableHRTF = true;
 
+    /// <summary>
+    /// The maximum amount of audio sources that can be played at once. Sources with the lowest priority and audibility are virtualized (playback position is tracked but audio is not mixed). Use 0 to not limit it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(400), DefaultValue(64), Limit(0), EditorDisplay(\"Voices\")")
+    int32 MaxVoices = 64;
+
+    /// <summary>
+    /// The volume (including distance attenuation) below which the audio sources are virtualized as inaudible. Use 0 to disable audibility culling.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(410), DefaultValue(0.001f), Limit(0, 1, 0.001f), EditorDisplay(\"Voices\")")
+    float AudibilityThreshold = 0.001f;
+
+    /// <summary>
+    /// The voice categories used to limit the amount of playing audio sources of a certain kind. Audio source references the category by the index in this list.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(420), EditorDisplay(\"Voices\")")
+    Array<AudioVoiceCategory> VoiceCategories;
+
+    /// <summary>
+    /// If checked, audio will be mixed in-engine by the software mixer (resampling, panning, HRTF and voice categories effects) and sent to the audio device as a single stream. Provides consistent latency and CPU cost across platforms (if supported by platform).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(500), DefaultValue(false), EditorDisplay(\"Software Mixer\", \"Enable\")")
+    bool EnableSoftwareMixer = false;
+
+    /// <summary>
+    /// The output latency (in milliseconds) of the software mixer. Lower values reduce the delay of the audio playback but might cause audio glitches on slower devices.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(510), DefaultValue(20), Limit(10, 200), EditorDisplay(\"Software Mixer\", \"Latency\")")
+    int32 SoftwareMixerLatency = 20;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -116,6 +116,16 @@ void AudioSource::SetAllowSpatialization(bool value)
         AudioBackend::Source::SpatialSetupChanged(this);
 }
 
+void AudioSource::SetPriority(int32 value)
+{
+    _priority = value;
+}
+
+void AudioSource::SetVoiceCategory(int32 value)
+{
+    _voiceCategory = Math::Max(value, -1);
+}
+
 void AudioSource::Play()
 {
     auto state = _state;
@@ -126,6 +136,12 @@ void AudioSource::Play()
         LOG(Warning, "Cannot play audio source without a clip ({0})", GetNamePath());
         return;
     }
+    if (_isVirtual)
+    {
+        // Resume virtual playback (audio service will restore the voice)
+        _state = States::Playing;
+        return;
+    }
 
     _state = States::Playing;
     _isActuallyPlayingSth = false;
@@ -186,6 +202,8 @@ void AudioSource::Stop()
 
     _state = States::Stopped;
     _isActuallyPlayingSth = false;
+    _isVirtual = false;
+    _virtualTime = 0.0f;
     _streamingFirstChunk = 0;
 
     if (SourceIDs.HasItems())
@@ -194,6 +212,8 @@ void AudioSource::Stop()
 
 float AudioSource::GetTime() const
 {
+    if (_isVirtual)
+        return _virtualTime;
     if (_state == States::Stopped || SourceIDs.IsEmpty() || !Clip->IsLoaded())
         return 0.0f;
 
@@ -216,6 +236,11 @@ void AudioSource::SetTime(float time)
 {
     if (_state == States::Stopped)
         return;
+    if (_isVirtual)
+    {
+        _virtualTime = Clip ? Math::Clamp(time, 0.0f, Clip->GetLength()) : 0.0f;
+        return;
+    }
 
     const bool isActuallyPlayingSth = _isActuallyPlayingSth;
     const auto state = _state;
@@ -283,7 +308,7 @@ void AudioSource::OnClipLoaded()
     AudioBackend::Source::ClipLoaded(this);
 
     // Start playing if source was waiting for the clip to load
-    if (SourceIDs.HasItems() && _state == States::Playing && !_isActuallyPlayingSth)
+    if (SourceIDs.HasItems() && _state == States::Playing && !_isActuallyPlayingSth && !_isVirtual)
     {
         if (Clip->IsStreamable())
         {
@@ -341,6 +366,35 @@ void AudioSource::PlayInternal()
     _startingToPlay = true;
 }
 
+void AudioSource::Virtualize()
+{
+    ASSERT(!_isVirtual && _isActuallyPlayingSth);
+    _virtualTime = GetTime();
+    _isVirtual = true;
+    _isActuallyPlayingSth = false;
+    _startingToPlay = false;
+    _needToUpdateStreamingBuffers = false;
+    AudioBackend::Source::Stop(this);
+}
+
+void AudioSource::Devirtualize()
+{
+    ASSERT(_isVirtual);
+    const float time = _virtualTime;
+    const States state = _state;
+    _isVirtual = false;
+    _virtualTime = 0.0f;
+
+    // Restart playback from the tracked position (backend voice was stopped)
+    _state = States::Stopped;
+    _streamingFirstChunk = 0;
+    Play();
+    if (time > 0.0f)
+        SetTime(time);
+    if (state == States::Paused)
+        Pause();
+}
+
 #if USE_EDITOR
 
 #include "Engine/Debug/DebugDraw.h"
@@ -375,6 +429,8 @@ void AudioSource::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     SERIALIZE_MEMBER(StartTime, _startTime);
     SERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    SERIALIZE_MEMBER(Priority, _priority);
+    SERIALIZE_MEMBER(VoiceCategory, _voiceCategory);
 }
 
 void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -392,6 +448,8 @@ void AudioSource::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE_MEMBER(PlayOnStart, _playOnStart);
     DESERIALIZE_MEMBER(StartTime, _startTime);
     DESERIALIZE_MEMBER(AllowSpatialization, _allowSpatialization);
+    DESERIALIZE_MEMBER(Priority, _priority);
+    DESERIALIZE_MEMBER(VoiceCategory, _voiceCategory);
     DESERIALIZE(Clip);
 }
 
@@ -420,6 +478,35 @@ void AudioSource::Update()
         AudioBackend::Source::VelocityChanged(this);
     }
 
+    if (_isVirtual)
+    {
+        // Advance the virtual playback position
+        if (_state == States::Playing)
+        {
+            const float length = Clip->GetLength();
+            _virtualTime += dt * _pitch;
+            if (_virtualTime >= length)
+            {
+                if (_loop && length > ZeroTolerance)
+                {
+                    _virtualTime = Math::Mod(_virtualTime, length);
+                }
+                else
+                {
+                    Stop();
+                    return;
+                }
+            }
+            if (UseStreaming())
+            {
+                // Keep streaming the chunk that will be used when voice gets restored
+                float offset;
+                _streamingFirstChunk = Clip->GetFirstBufferIndex(_virtualTime, offset);
+            }
+        }
+        return;
+    }
+
     // Reset starting to play value once time is greater than zero
     if (_startingToPlay && GetTime() > 0.0f)
     {
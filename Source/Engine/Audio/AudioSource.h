@@ -19,6 +19,7 @@ class FLAXENGINE_API AudioSource : public Actor
     DECLARE_SCENE_OBJECT(AudioSource);
     friend class AudioStreamingHandler;
     friend class AudioClip;
+    friend class AudioService;
 public:
     /// <summary>
     /// Valid states in which AudioSource can be in.
@@ -59,6 +60,10 @@ class FLAXENGINE_API AudioSource : public Actor
     bool _isActuallyPlayingSth = false;
     bool _startingToPlay = false;
     bool _needToUpdateStreamingBuffers = false;
+    bool _isVirtual = false;
+    int32 _priority = 0;
+    int32 _voiceCategory = -1;
+    float _virtualTime = 0.0f;
     States _state = States::Stopped;
 
     States _savedState = States::Stopped;
@@ -225,6 +230,34 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     API_PROPERTY() void SetAllowSpatialization(bool value);
 
+    /// <summary>
+    /// Gets the playback priority. When the amount of playing voices exceeds the limit, sources with higher priority are played and others are virtualized (playback position is tracked but audio is not mixed).
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(90), DefaultValue(0), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the playback priority. When the amount of playing voices exceeds the limit, sources with higher priority are played and others are virtualized (playback position is tracked but audio is not mixed).
+    /// </summary>
+    API_PROPERTY() void SetPriority(int32 value);
+
+    /// <summary>
+    /// Gets the index of the voice category (see AudioSettings.VoiceCategories) used to limit the amount of playing voices of a certain kind (eg. footsteps). Use -1 to not use any category.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(100), DefaultValue(-1), Limit(-1), EditorDisplay(\"Audio Source\")")
+    FORCE_INLINE int32 GetVoiceCategory() const
+    {
+        return _voiceCategory;
+    }
+
+    /// <summary>
+    /// Sets the index of the voice category (see AudioSettings.VoiceCategories) used to limit the amount of playing voices of a certain kind (eg. footsteps). Use -1 to not use any category.
+    /// </summary>
+    API_PROPERTY() void SetVoiceCategory(int32 value);
+
 public:
     /// <summary>
     /// Starts playing the currently assigned audio clip.
@@ -293,6 +326,14 @@ class FLAXENGINE_API AudioSource : public Actor
         return _isActuallyPlayingSth;
     }
 
+    /// <summary>
+    /// Determines whether this audio source is virtualized. Virtual source is playing but without audio backend voice (eg. it's inaudible or the voices limit was exceeded) and only its playback position is updated.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool IsVirtual() const
+    {
+        return _isVirtual;
+    }
+
     /// <summary>
     /// Requests the audio streaming buffers update. Rises tha flag to synchronize audio backend buffers of the emitter during next game logic update.
     /// </summary>
@@ -317,6 +358,12 @@ class FLAXENGINE_API AudioSource : public Actor
     /// </summary>
     void PlayInternal();
 
+    // Stops the audio backend voice playback and keeps tracking the playback position.
+    void Virtualize();
+
+    // Resumes the audio backend voice playback from the tracked playback position.
+    void Devirtualize();
+
     void Update();
 
 public:
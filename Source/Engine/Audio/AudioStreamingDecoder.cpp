@@ -0,0 +1,150 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "AudioStreamingDecoder.h"
+#include "Audio.h"
+#include "AudioSource.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/IRunnable.h"
+#include "Engine/Threading/ConcurrentRingBuffer.h"
+
+// The maximum amount of the streaming tasks queued for the decoder thread (overflow is executed on the thread pool)
+#define AUDIO_STREAMING_QUEUE_SIZE 256
+
+// The maximum amount of the buffers update events waiting for the main thread (overflow is handled on the decoder thread)
+#define AUDIO_STREAMING_EVENTS_SIZE 256
+
+namespace AudioStreamingDecoderImpl
+{
+    volatile int64 ExitFlag = 0;
+    volatile int64 Running = 0;
+    uint64 ThreadID = 0;
+    Thread* DecoderThread = nullptr;
+    MPSCRingBuffer<AudioClip::StreamingTask*> Tasks(AUDIO_STREAMING_QUEUE_SIZE);
+    SPSCRingBuffer<Guid> UpdatedClips(AUDIO_STREAMING_EVENTS_SIZE);
+    ConditionVariable TasksSignal;
+    CriticalSection TasksMutex;
+
+    void UpdateSources(AudioClip* clip)
+    {
+        for (int32 sourceIndex = 0; sourceIndex < Audio::Sources.Count(); sourceIndex++)
+        {
+            const auto src = Audio::Sources[sourceIndex];
+            if (src->Clip == clip && src->GetState() == AudioSource::States::Playing)
+            {
+                src->RequestStreamingBuffersUpdate();
+            }
+        }
+    }
+}
+
+using namespace AudioStreamingDecoderImpl;
+
+int32 AudioStreamingDecoder::ThreadProc()
+{
+    AudioClip::StreamingTask* task;
+    while (Platform::AtomicRead(&ExitFlag) == 0)
+    {
+        if (Tasks.TryDequeue(task))
+        {
+            PROFILE_CPU_NAMED("Audio.Decode");
+            task->Execute();
+        }
+        else
+        {
+            // Producers notify under the lock so checking the queue here won't miss the signal
+            TasksMutex.Lock();
+            if (Tasks.Count() == 0 && Platform::AtomicRead(&ExitFlag) == 0)
+                TasksSignal.Wait(TasksMutex);
+            TasksMutex.Unlock();
+        }
+    }
+    return 0;
+}
+
+bool AudioStreamingDecoder::Init()
+{
+    Platform::AtomicStore(&ExitFlag, 0);
+    auto runnable = New<SimpleRunnable>(true);
+    runnable->OnWork.Bind(ThreadProc);
+    DecoderThread = Thread::Create(runnable, TEXT("Audio Streaming"), ThreadPriority::AboveNormal);
+    if (DecoderThread == nullptr)
+    {
+        LOG(Error, "Failed to spawn audio streaming thread");
+        return true;
+    }
+    ThreadID = DecoderThread->GetID();
+    Platform::AtomicStore(&Running, 1);
+    return false;
+}
+
+void AudioStreamingDecoder::Dispose()
+{
+    if (!DecoderThread)
+        return;
+
+    // Stop accepting tasks and wake up the thread
+    Platform::AtomicStore(&Running, 0);
+    Platform::AtomicStore(&ExitFlag, 1);
+    TasksMutex.Lock();
+    TasksSignal.NotifyAll();
+    TasksMutex.Unlock();
+    DecoderThread->Kill(true);
+    Delete(DecoderThread);
+    DecoderThread = nullptr;
+    ThreadID = 0;
+
+    // Finish the remaining tasks
+    AudioClip::StreamingTask* task;
+    while (Tasks.TryDequeue(task))
+        task->Execute();
+    Update();
+}
+
+bool AudioStreamingDecoder::Enqueue(AudioClip::StreamingTask* task)
+{
+    if (Platform::AtomicRead(&Running) == 0 || !Tasks.TryEnqueue(task))
+        return true;
+    TasksMutex.Lock();
+    TasksSignal.NotifyOne();
+    TasksMutex.Unlock();
+    return false;
+}
+
+void AudioStreamingDecoder::OnBuffersUpdated(AudioClip* clip)
+{
+    if (Platform::GetCurrentThreadID() == ThreadID && UpdatedClips.TryEnqueue(clip->GetID()))
+        return;
+    UpdateSources(clip);
+}
+
+void AudioStreamingDecoder::Update()
+{
+    if (UpdatedClips.Count() == 0)
+        return;
+    PROFILE_CPU();
+    Guid clips[32];
+    int32 count;
+    while ((count = UpdatedClips.TryDequeue(clips, ARRAY_COUNT(clips))) != 0)
+    {
+        for (int32 sourceIndex = 0; sourceIndex < Audio::Sources.Count(); sourceIndex++)
+        {
+            const auto src = Audio::Sources[sourceIndex];
+            if (!src->Clip || src->GetState() != AudioSource::States::Playing)
+                continue;
+            const Guid clipId = src->Clip.GetID();
+            for (int32 i = 0; i < count; i++)
+            {
+                if (clips[i] == clipId)
+                {
+                    src->RequestStreamingBuffersUpdate();
+                    break;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "AudioClip.h"
+
+/// <summary>
+/// The dedicated audio streaming thread that decodes the streamed audio clips data into the audio backend buffers. Keeps music and voice-over streams from underruns when the content loading or thread pool threads are busy.
+/// </summary>
+class AudioStreamingDecoder
+{
+public:
+    /// <summary>
+    /// Starts the decoder thread.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool Init();
+
+    /// <summary>
+    /// Stops the decoder thread and executes the remaining tasks.
+    /// </summary>
+    static void Dispose();
+
+    /// <summary>
+    /// Enqueues the audio clip streaming task to be executed on the decoder thread. Can be called from any thread.
+    /// </summary>
+    /// <param name="task">The task.</param>
+    /// <returns>True if failed (decoder is not running or the queue is full), otherwise false.</returns>
+    static bool Enqueue(AudioClip::StreamingTask* task);
+
+    /// <summary>
+    /// Notifies the audio sources that are playing the clip about the updated buffers. When called from the decoder thread the event is passed to the main thread.
+    /// </summary>
+    /// <param name="clip">The audio clip.</param>
+    static void OnBuffersUpdated(AudioClip* clip);
+
+    /// <summary>
+    /// Flushes the buffers update events from the decoder thread. Called on the main thread.
+    /// </summary>
+    static void Update();
+
+private:
+    static int32 ThreadProc();
+};
@@ -0,0 +1,1098 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if AUDIO_API_SOFTWARE
+
+#include "AudioBackendSoftware.h"
+#include "Engine/Audio/Audio.h"
+#include "Engine/Audio/AudioBackendTools.h"
+#include "Engine/Audio/AudioListener.h"
+#include "Engine/Audio/AudioSettings.h"
+#include "Engine/Audio/AudioSource.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/IRunnable.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Tools/AudioTool/AudioTool.h"
+
+// Output device (mixed audio is submitted as a single streaming source)
+#if AUDIO_API_OPENAL
+#include <OpenAL/al.h>
+#include <OpenAL/alc.h>
+#endif
+
+// The output sample rate (in Hz)
+#define MIXER_SAMPLE_RATE 48000
+
+// The amount of the output channels (stereo)
+#define MIXER_CHANNELS 2
+
+// The amount of the frames mixed at once (~5.3ms at 48kHz, must be multiple of 4)
+#define MIXER_BLOCK_FRAMES 256
+
+// The limits for the amount of the mixed blocks queued to the output device (controls the output latency)
+#define MIXER_OUTPUT_BLOCKS_MIN 2
+#define MIXER_OUTPUT_BLOCKS_MAX 16
+
+// The maximum amount of the buffers queued per voice
+#define MIXER_MAX_VOICE_BUFFERS 8
+
+// The HRTF head model used to calculate the interaural time difference (in meters and meters per second)
+#define MIXER_HEAD_RADIUS 0.0875f
+#define MIXER_SPEED_OF_SOUND 343.3f
+
+// The low-pass filter coefficient for the ear that is in the head shadow (source fully on the other side)
+#define MIXER_HEAD_SHADOW 0.35f
+
+namespace Mixer
+{
+    struct Listener : AudioBackendTools::Listener
+    {
+        AudioListener* AudioListener;
+
+        Listener()
+        {
+            Init();
+        }
+
+        void Init()
+        {
+            AudioListener = nullptr;
+        }
+
+        bool IsFree() const
+        {
+            return AudioListener == nullptr;
+        }
+
+        void UpdateTransform()
+        {
+            Position = AudioListener->GetPosition();
+            Orientation = AudioListener->GetOrientation();
+        }
+
+        void UpdateVelocity()
+        {
+            Velocity = AudioListener->GetVelocity();
+        }
+    };
+
+    struct Buffer
+    {
+        int32 Channels = 0;
+        int32 SampleRate = 0;
+        int32 Frames = 0;
+        AudioFormat Format = AudioFormat::Raw;
+        Array<float> Data; // Normalized samples (interleaved channels)
+        Array<byte> Compressed; // Compressed data (decoded during mixing), used for non-raw formats
+    };
+
+    // Range of the buffer samples used by the resampling
+    struct BufferView
+    {
+        const float* Data; // Samples starting at the first frame (interleaved channels)
+        int32 Channels;
+        int32 First;
+        int32 Frames; // Total amount of frames in the buffer
+    };
+
+    struct Voice : AudioBackendTools::Source
+    {
+        AudioSource* Source;
+        uint32 Queue[MIXER_MAX_VOICE_BUFFERS];
+        int32 QueueCount;
+        int32 Current; // Index of the buffer being played (buffers before it are processed)
+        double Offset; // Playback position in the current buffer (in buffer frames)
+        float StartTime;
+        int32 Channels;
+        int32 Category;
+        bool IsPlaying;
+        bool IsLooping;
+        bool IsStreaming;
+        bool IsDirty;
+
+        // Mixing state (updated on the main thread, used by the mixer)
+        float MixPitch;
+        float Gains[MIXER_CHANNELS];
+        float CurrentGains[MIXER_CHANNELS];
+        float Delay[MIXER_CHANNELS]; // Per-ear delay (in output frames)
+        float Shadow[MIXER_CHANNELS]; // Per-ear low-pass coefficient (1 is no filter)
+        float FilterState[MIXER_CHANNELS];
+
+        Voice()
+        {
+            Init();
+        }
+
+        void Init()
+        {
+            Source = nullptr;
+            Pitch = 1.0f;
+            Pan = 0.0f;
+            Is3D = false;
+            Reset();
+            Channels = 1;
+            Category = -1;
+            IsLooping = false;
+            IsStreaming = false;
+            IsDirty = false;
+            MixPitch = 1.0f;
+            for (int32 c = 0; c < MIXER_CHANNELS; c++)
+            {
+                Gains[c] = CurrentGains[c] = 0.0f;
+                Delay[c] = 0.0f;
+                Shadow[c] = 1.0f;
+                FilterState[c] = 0.0f;
+            }
+        }
+
+        void Reset()
+        {
+            QueueCount = 0;
+            Current = 0;
+            Offset = 0.0;
+            StartTime = 0.0f;
+            IsPlaying = false;
+        }
+
+        bool IsFree() const
+        {
+            return Source == nullptr;
+        }
+
+        void UpdateTransform(const AudioSource* source)
+        {
+            Position = source->GetPosition();
+            Orientation = source->GetOrientation();
+        }
+
+        void UpdateVelocity(const AudioSource* source)
+        {
+            Velocity = source->GetVelocity();
+        }
+    };
+
+    struct Bus
+    {
+        float Volume = 1.0f;
+        float LowPass = 1.0f; // Low-pass filter coefficient (1 is no filter)
+        float FilterState[MIXER_CHANNELS] = {};
+        alignas(16) float Data[MIXER_BLOCK_FRAMES * MIXER_CHANNELS];
+        bool IsUsed = false;
+    };
+
+    volatile int64 ExitFlag = 0;
+    Thread* MixerThread = nullptr;
+    bool ForceDirty = true;
+    float MasterVolume = 1.0f;
+    int32 OutputBlocks = 4;
+    AudioBackendTools::Settings Settings;
+    Listener Listeners[AUDIO_MAX_LISTENERS];
+    CriticalSection Locker;
+    ChunkedArray<Voice, 32> Voices;
+    ChunkedArray<Buffer*, 64> Buffers;
+    Array<Bus> Buses; // Master bus at index 0, then voice categories
+    alignas(16) float VoiceData[MIXER_BLOCK_FRAMES * MIXER_CHANNELS];
+    alignas(16) float ChannelData[MIXER_BLOCK_FRAMES + 4];
+    Array<int16> DecodeTemp;
+    Array<float> DecodeData;
+#if AUDIO_API_OPENAL
+    ALCdevice* Device = nullptr;
+    ALCcontext* Context = nullptr;
+    ALuint OutputSource = 0;
+    ALuint OutputBuffers[MIXER_OUTPUT_BLOCKS_MAX];
+#endif
+
+    Listener* GetListener()
+    {
+        for (int32 i = 0; i < AUDIO_MAX_LISTENERS; i++)
+        {
+            if (Listeners[i].AudioListener)
+                return &Listeners[i];
+        }
+        return nullptr;
+    }
+
+    Listener* GetListener(const AudioListener* listener)
+    {
+        for (int32 i = 0; i < AUDIO_MAX_LISTENERS; i++)
+        {
+            if (Listeners[i].AudioListener == listener)
+                return &Listeners[i];
+        }
+        return nullptr;
+    }
+
+    Voice* GetVoice(const AudioSource* source)
+    {
+        if (source->SourceIDs.Count() == 0)
+            return nullptr;
+        const AUDIO_SOURCE_ID_TYPE sourceId = source->SourceIDs[0];
+        // 0 is invalid ID so shift them
+        return &Voices[sourceId - 1];
+    }
+
+    FORCE_INLINE Buffer* GetBuffer(uint32 bufferId)
+    {
+        return bufferId != 0 && bufferId <= (uint32)Buffers.Count() ? Buffers[bufferId - 1] : nullptr;
+    }
+
+    void MarkAllDirty()
+    {
+        ForceDirty = true;
+    }
+
+    // Low-pass coefficient of the one-pole filter for the given cutoff frequency (0 disables filter)
+    float GetLowPass(float frequency)
+    {
+        if (frequency <= 0.0f || frequency >= MIXER_SAMPLE_RATE * 0.5f)
+            return 1.0f;
+        return 1.0f - Math::Exp(-2.0f * PI * frequency / MIXER_SAMPLE_RATE);
+    }
+
+    void UpdateMix(Voice& voice, const Listener* listener)
+    {
+        if (voice.Is3D && !listener)
+        {
+            // No listener to hear spatial audio
+            for (int32 c = 0; c < MIXER_CHANNELS; c++)
+                voice.Gains[c] = 0.0f;
+            return;
+        }
+        static const Listener NoListener;
+        auto mix = AudioBackendTools::CalculateSoundMix(Settings, listener ? *listener : NoListener, voice, MIXER_CHANNELS);
+        mix.VolumeIntoChannels();
+        voice.MixPitch = mix.Pitch;
+        voice.Gains[0] = mix.Channels[AudioBackendTools::FrontLeft];
+        voice.Gains[1] = mix.Channels[AudioBackendTools::FrontRight];
+        for (int32 c = 0; c < MIXER_CHANNELS; c++)
+        {
+            voice.Delay[c] = 0.0f;
+            voice.Shadow[c] = 1.0f;
+        }
+        if (voice.Is3D && Audio::GetEnableHRTF())
+        {
+            // Approximate HRTF with interaural time difference (Woodworth formula) and head shadow low-pass for the far ear
+            const Transform listenerTransform(listener->Position, listener->Orientation);
+            const Float3 direction = Float3::Normalize((Float3)listenerTransform.WorldToLocal(voice.Position));
+            const float lateral = Math::Saturate(Math::Abs(direction.X));
+            const float angle = Math::Asin(lateral);
+            const float itd = MIXER_HEAD_RADIUS / MIXER_SPEED_OF_SOUND * (angle + lateral);
+            const int32 farEar = direction.X > 0.0f ? 0 : 1;
+            voice.Delay[farEar] = itd * MIXER_SAMPLE_RATE;
+            voice.Shadow[farEar] = Math::Lerp(1.0f, MIXER_HEAD_SHADOW, lateral);
+        }
+    }
+
+    // Gets the view of the buffer samples that covers the given frames range (compressed buffers get decoded)
+    BufferView GetView(const Buffer& buffer, int32 first, int32 last)
+    {
+        if (buffer.Format != AudioFormat::ADPCM)
+            return { buffer.Data.Get(), buffer.Channels, 0, buffer.Frames };
+
+        // Decode only the blocks with the used frames
+        const int32 blockFrames = (int32)AudioTool::ADPCMBlockFrames;
+        const int32 blockSize = (int32)AudioTool::GetADPCMBlockSize(buffer.Channels);
+        const int32 blockFirst = Math::Clamp(first, 0, buffer.Frames - 1) / blockFrames;
+        const int32 blockLast = Math::Clamp(last, 0, buffer.Frames - 1) / blockFrames;
+        const int32 samples = (blockLast - blockFirst + 1) * blockFrames * buffer.Channels;
+        DecodeTemp.Resize(samples, false);
+        DecodeData.Resize(samples, false);
+        for (int32 block = blockFirst; block <= blockLast; block++)
+        {
+            const int32 frames = Math::Min(blockFrames, buffer.Frames - block * blockFrames);
+            AudioTool::DecodeADPCMBlock(buffer.Compressed.Get() + block * blockSize, DecodeTemp.Get() + (block - blockFirst) * blockFrames * buffer.Channels, frames, buffer.Channels);
+        }
+        const int32 decoded = (Math::Min((blockLast + 1) * blockFrames, buffer.Frames) - blockFirst * blockFrames) * buffer.Channels;
+        const float scale = 1.0f / 32768.0f;
+        for (int32 i = 0; i < decoded; i++)
+            DecodeData.Get()[i] = (float)DecodeTemp.Get()[i] * scale;
+        return { DecodeData.Get(), buffer.Channels, blockFirst * blockFrames, buffer.Frames };
+    }
+
+    // Resamples the buffer channel with the linear interpolation (4 frames at once)
+    void Resample(const BufferView& buffer, int32 channel, double position, double step, float* output, int32 frames)
+    {
+        const float* src = buffer.Data + channel;
+        const int32 stride = buffer.Channels;
+        const int32 first = buffer.First;
+        const int32 last = buffer.Frames - 1;
+#define SAMPLE(index) src[(Math::Clamp(index, 0, last) - first) * stride]
+        for (int32 i = 0; i < frames; i += 4)
+        {
+            float a[4], b[4];
+            alignas(16) float t[4];
+            for (int32 j = 0; j < 4; j++)
+            {
+                const double p = position + step * (i + j);
+                int32 index = (int32)p;
+                if ((double)index > p)
+                    index--;
+                a[j] = SAMPLE(index);
+                b[j] = SAMPLE(index + 1);
+                t[j] = (float)(p - index);
+            }
+            const SimdVector4 va = SIMD::Load(a[0], a[1], a[2], a[3]);
+            const SimdVector4 vb = SIMD::Load(b[0], b[1], b[2], b[3]);
+            SIMD::Store(output + i, SIMD::Add(va, SIMD::Mul(SIMD::Sub(vb, va), SIMD::Load(t))));
+        }
+#undef SAMPLE
+    }
+
+    // Adds the stereo block into the destination while ramping the gains to prevent clicks
+    void MixInto(float* dst, const float* src, const float gainsStart[MIXER_CHANNELS], const float gainsEnd[MIXER_CHANNELS])
+    {
+        const float scale = 2.0f / MIXER_BLOCK_FRAMES;
+        const float stepL = (gainsEnd[0] - gainsStart[0]) * scale;
+        const float stepR = (gainsEnd[1] - gainsStart[1]) * scale;
+        SimdVector4 gain = SIMD::Load(gainsStart[0], gainsStart[1], gainsStart[0] + stepL * 0.5f, gainsStart[1] + stepR * 0.5f);
+        const SimdVector4 step = SIMD::Load(stepL, stepR, stepL, stepR);
+        for (int32 i = 0; i < MIXER_BLOCK_FRAMES * MIXER_CHANNELS; i += 4)
+        {
+            SIMD::Store(dst + i, SIMD::Add(SIMD::Load(dst + i), SIMD::Mul(SIMD::Load(src + i), gain)));
+            gain = SIMD::Add(gain, step);
+        }
+    }
+
+    // Renders the voice into the stereo block (without the gains), returns false if voice has nothing to play
+    bool RenderVoice(Voice& voice)
+    {
+        Platform::MemoryClear(VoiceData, sizeof(VoiceData));
+        int32 done = 0;
+        bool any = false;
+        while (done < MIXER_BLOCK_FRAMES && voice.Current < voice.QueueCount)
+        {
+            const Buffer* buffer = GetBuffer(voice.Queue[voice.Current]);
+            if (!buffer || buffer->Frames == 0)
+            {
+                voice.Current++;
+                voice.Offset = 0.0;
+                continue;
+            }
+            const double step = (double)voice.MixPitch * buffer->SampleRate / MIXER_SAMPLE_RATE;
+            if (step <= 0.0)
+                break;
+            const int32 left = (int32)Math::Ceil((buffer->Frames - voice.Offset) / step);
+            const int32 count = Math::Clamp(left, 1, MIXER_BLOCK_FRAMES - done);
+            const double maxDelay = Math::Max(voice.Delay[0], voice.Delay[1]) * step;
+            const BufferView view = GetView(*buffer, (int32)(voice.Offset - maxDelay), (int32)(voice.Offset + count * step) + 1);
+
+            // Resample channels into the ears (mono is sent to both, each ear can be delayed by HRTF)
+            for (int32 c = 0; c < MIXER_CHANNELS; c++)
+            {
+                const int32 channel = Math::Min(c, buffer->Channels - 1);
+                const double delay = voice.Delay[c] * step;
+                Resample(view, channel, voice.Offset - delay, step, ChannelData, count);
+                float* dst = VoiceData + done * MIXER_CHANNELS + c;
+                const float shadow = voice.Shadow[c];
+                if (shadow < 1.0f)
+                {
+                    float state = voice.FilterState[c];
+                    for (int32 i = 0; i < count; i++)
+                    {
+                        state += shadow * (ChannelData[i] - state);
+                        dst[i * MIXER_CHANNELS] = state;
+                    }
+                    voice.FilterState[c] = state;
+                }
+                else
+                {
+                    for (int32 i = 0; i < count; i++)
+                        dst[i * MIXER_CHANNELS] = ChannelData[i];
+                }
+            }
+            any = true;
+            done += count;
+            voice.Offset += count * step;
+
+            // Move to the next buffer
+            if (voice.Offset >= buffer->Frames)
+            {
+                voice.Offset -= buffer->Frames;
+                if (voice.IsLooping && !voice.IsStreaming)
+                    continue;
+                voice.Current++;
+                if (voice.Current >= voice.QueueCount && !voice.IsStreaming)
+                {
+                    // End of playback (time gets reset to 0 so audio source can detect it)
+                    voice.IsPlaying = false;
+                    voice.Current = 0;
+                    voice.Offset = 0.0;
+                    break;
+                }
+            }
+        }
+        return any;
+    }
+
+    void MixBlock(float* output)
+    {
+        PROFILE_CPU_NAMED("Audio.Mix");
+        ScopeLock lock(Locker);
+        for (Bus& bus : Buses)
+        {
+            Platform::MemoryClear(bus.Data, sizeof(bus.Data));
+            bus.IsUsed = false;
+        }
+
+        // Mix voices into buses
+        for (int32 i = 0; i < Voices.Count(); i++)
+        {
+            Voice& voice = Voices[i];
+            if (voice.IsFree() || !voice.IsPlaying)
+                continue;
+            if (!RenderVoice(voice))
+                continue;
+            Bus& bus = Buses[Math::IsInRange(voice.Category, 0, Buses.Count() - 2) ? voice.Category + 1 : 0];
+            MixInto(bus.Data, VoiceData, voice.CurrentGains, voice.Gains);
+            for (int32 c = 0; c < MIXER_CHANNELS; c++)
+                voice.CurrentGains[c] = voice.Gains[c];
+            bus.IsUsed = true;
+        }
+
+        // Apply buses effects and mix them into the master bus
+        Bus& master = Buses[0];
+        const float unity[MIXER_CHANNELS] = { 1.0f, 1.0f };
+        for (int32 i = 1; i < Buses.Count(); i++)
+        {
+            Bus& bus = Buses[i];
+            if (!bus.IsUsed)
+                continue;
+            if (bus.LowPass < 1.0f)
+            {
+                for (int32 c = 0; c < MIXER_CHANNELS; c++)
+                {
+                    float state = bus.FilterState[c];
+                    for (int32 f = 0; f < MIXER_BLOCK_FRAMES; f++)
+                    {
+                        float& sample = bus.Data[f * MIXER_CHANNELS + c];
+                        state += bus.LowPass * (sample - state);
+                        sample = state;
+                    }
+                    bus.FilterState[c] = state;
+                }
+            }
+            const float gains[MIXER_CHANNELS] = { bus.Volume, bus.Volume };
+            MixInto(master.Data, bus.Data, gains, gains);
+        }
+
+        // Apply master volume and clip the output
+        const SimdVector4 volume = SIMD::Splat(MasterVolume * master.Volume);
+        const SimdVector4 minValue = SIMD::Splat(-1.0f);
+        const SimdVector4 maxValue = SIMD::Splat(1.0f);
+        for (int32 i = 0; i < MIXER_BLOCK_FRAMES * MIXER_CHANNELS; i += 4)
+            SIMD::Store(output + i, SIMD::Min(SIMD::Max(SIMD::Mul(SIMD::Load(master.Data + i), volume), minValue), maxValue));
+    }
+
+#if AUDIO_API_OPENAL
+    void SubmitBlock(ALuint buffer)
+    {
+        alignas(16) float mix[MIXER_BLOCK_FRAMES * MIXER_CHANNELS];
+        int16 data[MIXER_BLOCK_FRAMES * MIXER_CHANNELS];
+        MixBlock(mix);
+        for (int32 i = 0; i < MIXER_BLOCK_FRAMES * MIXER_CHANNELS; i++)
+            data[i] = (int16)(mix[i] * MAX_int16);
+        alBufferData(buffer, AL_FORMAT_STEREO16, data, sizeof(data), MIXER_SAMPLE_RATE);
+        alSourceQueueBuffers(OutputSource, 1, &buffer);
+    }
+#endif
+
+    int32 ThreadProc()
+    {
+        const int32 sleepTime = Math::Max(1000 * MIXER_BLOCK_FRAMES / MIXER_SAMPLE_RATE / 2, 1);
+        while (Platform::AtomicRead(&ExitFlag) == 0)
+        {
+#if AUDIO_API_OPENAL
+            // Refill the processed output buffers
+            ALint processed = 0;
+            alGetSourcei(OutputSource, AL_BUFFERS_PROCESSED, &processed);
+            for (; processed > 0; processed--)
+            {
+                ALuint buffer;
+                alSourceUnqueueBuffers(OutputSource, 1, &buffer);
+                SubmitBlock(buffer);
+            }
+
+            // Restart output after underrun
+            ALint state;
+            alGetSourcei(OutputSource, AL_SOURCE_STATE, &state);
+            if (state != AL_PLAYING)
+                alSourcePlay(OutputSource);
+#endif
+            Platform::Sleep(sleepTime);
+        }
+        return 0;
+    }
+
+    void InitBuses()
+    {
+        const auto settings = AudioSettings::Get();
+        Buses.Resize(settings->VoiceCategories.Count() + 1);
+        for (int32 i = 0; i < settings->VoiceCategories.Count(); i++)
+        {
+            const AudioVoiceCategory& category = settings->VoiceCategories[i];
+            Bus& bus = Buses[i + 1];
+            bus.Volume = category.Volume;
+            bus.LowPass = GetLowPass(category.LowPassFrequency);
+        }
+    }
+}
+
+void AudioBackendSoftware::Listener_OnAdd(AudioListener* listener)
+{
+    // Get first free listener
+    Mixer::Listener* aListener = nullptr;
+    for (int32 i = 0; i < AUDIO_MAX_LISTENERS; i++)
+    {
+        if (Mixer::Listeners[i].IsFree())
+        {
+            aListener = &Mixer::Listeners[i];
+            break;
+        }
+    }
+    ASSERT(aListener);
+
+    // Setup
+    aListener->AudioListener = listener;
+    aListener->UpdateTransform();
+    aListener->UpdateVelocity();
+
+    Mixer::MarkAllDirty();
+}
+
+void AudioBackendSoftware::Listener_OnRemove(AudioListener* listener)
+{
+    Mixer::Listener* aListener = Mixer::GetListener(listener);
+    if (aListener)
+    {
+        aListener->Init();
+        Mixer::MarkAllDirty();
+    }
+}
+
+void AudioBackendSoftware::Listener_VelocityChanged(AudioListener* listener)
+{
+    Mixer::Listener* aListener = Mixer::GetListener(listener);
+    if (aListener)
+    {
+        aListener->UpdateVelocity();
+        Mixer::MarkAllDirty();
+    }
+}
+
+void AudioBackendSoftware::Listener_TransformChanged(AudioListener* listener)
+{
+    Mixer::Listener* aListener = Mixer::GetListener(listener);
+    if (aListener)
+    {
+        aListener->UpdateTransform();
+        Mixer::MarkAllDirty();
+    }
+}
+
+void AudioBackendSoftware::Listener_ReinitializeAll()
+{
+    // HRTF is evaluated during voices mix update
+    Mixer::MarkAllDirty();
+}
+
+void AudioBackendSoftware::Source_OnAdd(AudioSource* source)
+{
+    // Skip if has no clip (needs audio data to create a source - needs data format information)
+    if (source->Clip == nullptr || !source->Clip->IsLoaded())
+        return;
+    auto clip = source->Clip.Get();
+    ScopeLock lock(Mixer::Locker);
+
+    // Get first free voice
+    Mixer::Voice* voice = nullptr;
+    AUDIO_SOURCE_ID_TYPE sourceID;
+    for (int32 i = 0; i < Mixer::Voices.Count(); i++)
+    {
+        if (Mixer::Voices[i].IsFree())
+        {
+            sourceID = i;
+            voice = &Mixer::Voices[i];
+            break;
+        }
+    }
+    if (voice == nullptr)
+    {
+        // Add new
+        const Mixer::Voice v;
+        sourceID = Mixer::Voices.Count();
+        Mixer::Voices.Add(v);
+        voice = &Mixer::Voices[sourceID];
+    }
+
+    sourceID++; // 0 is invalid ID so shift them
+    source->SourceIDs.Add(sourceID);
+
+    // Prepare voice state
+    voice->Init();
+    voice->Source = source;
+    voice->IsDirty = true;
+    voice->Is3D = source->Is3D();
+    voice->Pitch = source->GetPitch();
+    voice->Pan = source->GetPan();
+    voice->DopplerFactor = source->GetDopplerFactor();
+    voice->Volume = source->GetVolume();
+    voice->MinDistance = source->GetMinDistance();
+    voice->Attenuation = source->GetAttenuation();
+    voice->Channels = clip->Is3D() ? 1 : clip->AudioHeader.Info.NumChannels; // 3d audio is always mono (AudioClip auto-converts before buffer write if FeatureFlags::SpatialMultiChannel is unset)
+    voice->Category = source->GetVoiceCategory();
+    voice->IsLooping = source->GetIsLooping();
+    voice->UpdateTransform(source);
+    voice->UpdateVelocity(source);
+
+    source->Restore();
+}
+
+void AudioBackendSoftware::Source_OnRemove(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    source->Cleanup();
+}
+
+void AudioBackendSoftware::Source_VelocityChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->UpdateVelocity(source);
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_TransformChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->UpdateTransform(source);
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_VolumeChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->Volume = source->GetVolume();
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_PitchChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->Pitch = source->GetPitch();
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_PanChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->Pan = source->GetPan();
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_IsLoopingChanged(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+        voice->IsLooping = source->GetIsLooping();
+}
+
+void AudioBackendSoftware::Source_SpatialSetupChanged(AudioSource* source)
+{
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        voice->Is3D = source->Is3D();
+        voice->MinDistance = source->GetMinDistance();
+        voice->Attenuation = source->GetAttenuation();
+        voice->DopplerFactor = source->GetDopplerFactor();
+        voice->IsDirty = true;
+    }
+}
+
+void AudioBackendSoftware::Source_ClipLoaded(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (!voice)
+    {
+        // Register source if clip was missing
+        Source_OnAdd(source);
+    }
+}
+
+void AudioBackendSoftware::Source_Cleanup(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+        voice->Init();
+}
+
+void AudioBackendSoftware::Source_Play(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice && !voice->IsPlaying)
+    {
+        // Start with the current gains to prevent ramping in from silence after seek
+        Mixer::UpdateMix(*voice, Mixer::GetListener());
+        for (int32 c = 0; c < MIXER_CHANNELS; c++)
+            voice->CurrentGains[c] = voice->Gains[c];
+        voice->IsPlaying = true;
+    }
+}
+
+void AudioBackendSoftware::Source_Pause(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+        voice->IsPlaying = false;
+}
+
+void AudioBackendSoftware::Source_Stop(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice)
+    {
+        // Unset buffers to rewind
+        voice->Reset();
+        for (int32 c = 0; c < MIXER_CHANNELS; c++)
+            voice->FilterState[c] = 0.0f;
+    }
+}
+
+void AudioBackendSoftware::Source_SetCurrentBufferTime(AudioSource* source, float value)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (!voice)
+        return;
+    const Mixer::Buffer* buffer = voice->Current < voice->QueueCount ? Mixer::GetBuffer(voice->Queue[voice->Current]) : nullptr;
+    if (buffer)
+        voice->Offset = Math::Clamp<double>(value * buffer->SampleRate, 0.0, buffer->Frames);
+    else
+    {
+        // Store start time so next buffer submitted will start from here
+        voice->StartTime = value;
+    }
+}
+
+float AudioBackendSoftware::Source_GetCurrentBufferTime(const AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice && voice->Current < voice->QueueCount)
+    {
+        const Mixer::Buffer* buffer = Mixer::GetBuffer(voice->Queue[voice->Current]);
+        if (buffer && buffer->SampleRate > 0)
+            return (float)(voice->Offset / buffer->SampleRate);
+    }
+    return 0.0f;
+}
+
+void AudioBackendSoftware::Source_SetNonStreamingBuffer(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (!voice)
+        return;
+
+    // Queue single buffer
+    voice->IsStreaming = false;
+    voice->IsLooping = source->GetIsLooping();
+    voice->QueueCount = 0;
+    voice->Current = 0;
+    voice->Queue[voice->QueueCount++] = source->Clip->Buffers[0];
+    const Mixer::Buffer* buffer = Mixer::GetBuffer(voice->Queue[0]);
+    voice->Offset = buffer ? Math::Clamp<double>(voice->StartTime * buffer->SampleRate, 0.0, buffer->Frames) : 0.0;
+    voice->StartTime = 0.0f;
+}
+
+void AudioBackendSoftware::Source_GetProcessedBuffersCount(AudioSource* source, int32& processedBuffersCount)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    processedBuffersCount = voice ? voice->Current : 0;
+}
+
+void AudioBackendSoftware::Source_GetQueuedBuffersCount(AudioSource* source, int32& queuedBuffersCount)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    queuedBuffersCount = voice ? voice->QueueCount : 0;
+}
+
+void AudioBackendSoftware::Source_QueueBuffer(AudioSource* source, uint32 bufferId)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (!voice || voice->QueueCount >= MIXER_MAX_VOICE_BUFFERS)
+        return;
+    voice->IsStreaming = true;
+    if (voice->QueueCount == 0)
+    {
+        // Apply the start time offset to the first buffer
+        const Mixer::Buffer* buffer = Mixer::GetBuffer(bufferId);
+        voice->Offset = buffer ? Math::Clamp<double>(voice->StartTime * buffer->SampleRate, 0.0, buffer->Frames) : 0.0;
+        voice->StartTime = 0.0f;
+    }
+    voice->Queue[voice->QueueCount++] = bufferId;
+}
+
+void AudioBackendSoftware::Source_DequeueProcessedBuffers(AudioSource* source)
+{
+    ScopeLock lock(Mixer::Locker);
+    auto voice = Mixer::GetVoice(source);
+    if (voice && voice->Current > 0)
+    {
+        const int32 processed = voice->Current;
+        for (int32 i = processed; i < voice->QueueCount; i++)
+            voice->Queue[i - processed] = voice->Queue[i];
+        voice->QueueCount -= processed;
+        voice->Current = 0;
+    }
+}
+
+uint32 AudioBackendSoftware::Buffer_Create()
+{
+    uint32 bufferId;
+    ScopeLock lock(Mixer::Locker);
+
+    // Get first free buffer slot
+    Mixer::Buffer* aBuffer = nullptr;
+    for (int32 i = 0; i < Mixer::Buffers.Count(); i++)
+    {
+        if (Mixer::Buffers[i] == nullptr)
+        {
+            aBuffer = New<Mixer::Buffer>();
+            Mixer::Buffers[i] = aBuffer;
+            bufferId = i + 1;
+            break;
+        }
+    }
+    if (!aBuffer)
+    {
+        // Add new slot
+        aBuffer = New<Mixer::Buffer>();
+        Mixer::Buffers.Add(aBuffer);
+        bufferId = Mixer::Buffers.Count();
+    }
+
+    return bufferId;
+}
+
+void AudioBackendSoftware::Buffer_Delete(uint32 bufferId)
+{
+    ScopeLock lock(Mixer::Locker);
+    Mixer::Buffer*& aBuffer = Mixer::Buffers[bufferId - 1];
+    Delete(aBuffer);
+    aBuffer = nullptr;
+}
+
+void AudioBackendSoftware::Buffer_Write(uint32 bufferId, byte* samples, const AudioDataInfo& info)
+{
+    PROFILE_CPU();
+    CHECK(info.NumChannels != 0 && info.NumChannels <= MIXER_CHANNELS);
+
+    // Convert samples outside the lock (mixer can run in the meantime)
+    Array<float> data;
+    data.Resize(info.NumSamples);
+    AudioTool::ConvertToFloat(samples, info.BitDepth, data.Get(), info.NumSamples);
+
+    ScopeLock lock(Mixer::Locker);
+    Mixer::Buffer* aBuffer = Mixer::Buffers[bufferId - 1];
+    aBuffer->Channels = (int32)info.NumChannels;
+    aBuffer->SampleRate = (int32)info.SampleRate;
+    aBuffer->Frames = (int32)(info.NumSamples / info.NumChannels);
+    aBuffer->Format = AudioFormat::Raw;
+    aBuffer->Data = MoveTemp(data);
+    aBuffer->Compressed.Resize(0);
+}
+
+void AudioBackendSoftware::Buffer_WriteCompressed(uint32 bufferId, byte* data, uint32 dataSize, AudioFormat format, const AudioDataInfo& info)
+{
+    PROFILE_CPU();
+    CHECK(info.NumChannels != 0 && info.NumChannels <= MIXER_CHANNELS);
+    CHECK(format == AudioFormat::ADPCM && dataSize >= AudioTool::GetADPCMSize(info.NumSamples / info.NumChannels, info.NumChannels));
+
+    // Keep data compressed (decoded by the mixer when playing)
+    Array<byte> compressed;
+    compressed.Set(data, (int32)dataSize);
+
+    ScopeLock lock(Mixer::Locker);
+    Mixer::Buffer* aBuffer = Mixer::Buffers[bufferId - 1];
+    aBuffer->Channels = (int32)info.NumChannels;
+    aBuffer->SampleRate = (int32)info.SampleRate;
+    aBuffer->Frames = (int32)(info.NumSamples / info.NumChannels);
+    aBuffer->Format = format;
+    aBuffer->Data.Resize(0);
+    aBuffer->Compressed = MoveTemp(compressed);
+}
+
+const Char* AudioBackendSoftware::Base_Name()
+{
+    return TEXT("Software");
+}
+
+AudioBackend::FeatureFlags AudioBackendSoftware::Base_Features()
+{
+    return FeatureFlags::CompressedADPCM;
+}
+
+void AudioBackendSoftware::Base_OnActiveDeviceChanged()
+{
+}
+
+void AudioBackendSoftware::Base_SetDopplerFactor(float value)
+{
+    Mixer::Settings.DopplerFactor = value;
+    Mixer::MarkAllDirty();
+}
+
+void AudioBackendSoftware::Base_SetVolume(float value)
+{
+    // Volume is applied on the master bus
+    Mixer::Settings.Volume = 1.0f;
+    Mixer::MasterVolume = value;
+}
+
+bool AudioBackendSoftware::Base_Init()
+{
+    const auto settings = AudioSettings::Get();
+    Mixer::InitBuses();
+    const int32 latencyFrames = settings->SoftwareMixerLatency * MIXER_SAMPLE_RATE / 1000;
+    Mixer::OutputBlocks = Math::Clamp(Math::DivideAndRoundUp(latencyFrames, MIXER_BLOCK_FRAMES), MIXER_OUTPUT_BLOCKS_MIN, MIXER_OUTPUT_BLOCKS_MAX);
+    Base_SetDopplerFactor(settings->DopplerFactor);
+
+#if AUDIO_API_OPENAL
+    // Open the default output device
+    Mixer::Device = alcOpenDevice(nullptr);
+    if (Mixer::Device == nullptr)
+    {
+        LOG(Warning, "Failed to open audio output device.");
+        return true;
+    }
+    const ALCint attrList[] = { ALC_FREQUENCY, MIXER_SAMPLE_RATE, 0 };
+    Mixer::Context = alcCreateContext(Mixer::Device, attrList);
+    alcMakeContextCurrent(Mixer::Context);
+    alGenSources(1, &Mixer::OutputSource);
+    alSourcei(Mixer::OutputSource, AL_SOURCE_RELATIVE, AL_TRUE);
+    alGenBuffers(Mixer::OutputBlocks, Mixer::OutputBuffers);
+    for (int32 i = 0; i < Mixer::OutputBlocks; i++)
+        Mixer::SubmitBlock(Mixer::OutputBuffers[i]);
+    alSourcePlay(Mixer::OutputSource);
+    const ALCchar* deviceName = alcGetString(Mixer::Device, ALC_DEVICE_SPECIFIER);
+    Audio::Devices.Resize(1);
+    Audio::Devices[0].Name = String(deviceName);
+    Audio::Devices[0].InternalName = deviceName;
+#else
+    Audio::Devices.Resize(1);
+    Audio::Devices[0].Name = TEXT("Software Mixer");
+#endif
+    Audio::SetActiveDeviceIndex(0);
+    LOG(Info, "Software audio mixer: {0} channels at {1} kHz, latency: {2} ms", MIXER_CHANNELS, MIXER_SAMPLE_RATE / 1000.0f, Mixer::OutputBlocks * MIXER_BLOCK_FRAMES * 1000 / MIXER_SAMPLE_RATE);
+
+    // Start the mixer thread
+    Platform::AtomicStore(&Mixer::ExitFlag, 0);
+    auto runnable = New<SimpleRunnable>(true);
+    runnable->OnWork.Bind(Mixer::ThreadProc);
+    Mixer::MixerThread = Thread::Create(runnable, TEXT("Audio Mixer"), ThreadPriority::Highest);
+    if (Mixer::MixerThread == nullptr)
+    {
+        LOG(Error, "Failed to spawn audio mixer thread");
+        return true;
+    }
+
+    return false;
+}
+
+void AudioBackendSoftware::Base_Update()
+{
+    PROFILE_CPU();
+    ScopeLock lock(Mixer::Locker);
+
+    // Update dirty voices
+    const auto listener = Mixer::GetListener();
+    for (int32 i = 0; i < Mixer::Voices.Count(); i++)
+    {
+        auto& voice = Mixer::Voices[i];
+        if (voice.IsFree())
+            continue;
+        voice.Category = voice.Source->GetVoiceCategory();
+        if (!(voice.IsDirty || Mixer::ForceDirty))
+            continue;
+        Mixer::UpdateMix(voice, listener);
+        voice.IsDirty = false;
+    }
+
+    // Clear flag
+    Mixer::ForceDirty = false;
+}
+
+void AudioBackendSoftware::Base_Dispose()
+{
+    // Stop the mixer thread
+    if (Mixer::MixerThread)
+    {
+        Platform::AtomicStore(&Mixer::ExitFlag, 1);
+        Mixer::MixerThread->Kill(true);
+        Delete(Mixer::MixerThread);
+        Mixer::MixerThread = nullptr;
+    }
+
+#if AUDIO_API_OPENAL
+    // Cleanup output
+    if (Mixer::OutputSource)
+    {
+        alSourceStop(Mixer::OutputSource);
+        alSourcei(Mixer::OutputSource, AL_BUFFER, 0);
+        alDeleteSources(1, &Mixer::OutputSource);
+        alDeleteBuffers(Mixer::OutputBlocks, Mixer::OutputBuffers);
+        Mixer::OutputSource = 0;
+    }
+    if (Mixer::Context)
+    {
+        alcMakeContextCurrent(nullptr);
+        alcDestroyContext(Mixer::Context);
+        Mixer::Context = nullptr;
+    }
+    if (Mixer::Device)
+    {
+        alcCloseDevice(Mixer::Device);
+        Mixer::Device = nullptr;
+    }
+#endif
+
+    // Cleanup buffers
+    ScopeLock lock(Mixer::Locker);
+    for (int32 i = 0; i < Mixer::Buffers.Count(); i++)
+    {
+        if (Mixer::Buffers[i])
+            Delete(Mixer::Buffers[i]);
+    }
+    Mixer::Buffers.Clear();
+    Mixer::Buses.Resize(0);
+}
+
+#endif
@@ -23,6 +23,11 @@ API_ENUM() enum class AudioFormat
     /// The Vorbis data.
     /// </summary>
     Vorbis,
+
+    /// <summary>
+    /// The IMA ADPCM data (4 bits per sample). Can be kept compressed in memory and decoded during playback by the audio backends that support it, otherwise it's decoded when uploading the audio buffer.
+    /// </summary>
+    ADPCM,
 };
 
 /// <summary>
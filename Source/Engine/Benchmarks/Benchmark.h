@@ -0,0 +1,104 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
+
+// The minimum duration of a single benchmark sample (iterations count is calibrated to match it)
+#define BENCHMARK_SAMPLE_TIME 0.005
+
+// The amount of measured samples per benchmark
+#define BENCHMARK_SAMPLES 30
+
+/// <summary>
+/// The result of a single benchmark (times are per iteration).
+/// </summary>
+struct BenchmarkResult
+{
+    const char* Suite;
+    const char* Name;
+    int32 Iterations;
+    double MinNs;
+    double MedianNs;
+    double MeanNs;
+    double StdDevNs;
+};
+
+namespace BenchmarkImpl
+{
+    extern volatile const void* Sink;
+}
+
+/// <summary>
+/// Prevents the compiler from optimizing out the computation of the value.
+/// </summary>
+template<typename T>
+FORCE_INLINE void BenchmarkKeep(const T& value)
+{
+    BenchmarkImpl::Sink = &value;
+}
+
+/// <summary>
+/// The context of the benchmarks suite that runs the benchmarks and collects the results.
+/// </summary>
+class BenchmarkContext
+{
+public:
+    const char* Suite;
+    Array<BenchmarkResult>* Results;
+
+public:
+    /// <summary>
+    /// Runs the benchmark. Function is called repeatedly (calibrated iterations count per sample) and the time of the single call is measured.
+    /// </summary>
+    /// <param name="name">The benchmark name (must be a static string).</param>
+    /// <param name="func">The benchmarked function.</param>
+    template<typename Func>
+    void Run(const char* name, Func func)
+    {
+        // Warmup and calibrate the iterations count
+        int32 iterations = 1;
+        while (true)
+        {
+            const double start = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations; i++)
+                func();
+            const double time = Platform::GetTimeSeconds() - start;
+            if (time >= BENCHMARK_SAMPLE_TIME || iterations >= (1 << 24))
+                break;
+            iterations *= 2;
+        }
+
+        // Measure samples
+        double samples[BENCHMARK_SAMPLES];
+        for (int32 sample = 0; sample < BENCHMARK_SAMPLES; sample++)
+        {
+            const double start = Platform::GetTimeSeconds();
+            for (int32 i = 0; i < iterations; i++)
+                func();
+            samples[sample] = (Platform::GetTimeSeconds() - start) * 1000000000.0 / iterations;
+        }
+        AddResult(name, iterations, samples, BENCHMARK_SAMPLES);
+    }
+
+private:
+    void AddResult(const char* name, int32 iterations, double* samples, int32 samplesCount);
+};
+
+typedef void (*BenchmarkSuiteFunc)(BenchmarkContext& context);
+
+/// <summary>
+/// Registers the benchmarks suite (static instance).
+/// </summary>
+struct BenchmarkSuiteRegistration
+{
+    BenchmarkSuiteRegistration(const char* suite, BenchmarkSuiteFunc func);
+};
+
+// Declares the benchmarks suite function
+#define BENCHMARK_SUITE(name, func) \
+    static void func(BenchmarkContext& context); \
+    static BenchmarkSuiteRegistration func##Registration(name, &func); \
+    static void func(BenchmarkContext& context)
@@ -0,0 +1,128 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/Sorting.h"
+
+namespace
+{
+    void GenerateData(Array<int32>& data, int32 count)
+    {
+        // Fixed seed for the repeatable results
+        RandomStream rand(101);
+        data.Resize(count);
+        for (int32 i = 0; i < count; i++)
+            data[i] = (int32)rand.GetUnsignedInt();
+    }
+}
+
+BENCHMARK_SUITE("Array", BenchmarkArray)
+{
+    Array<int32> data;
+    GenerateData(data, 1000);
+
+    context.Run("Add 1k", [&]
+    {
+        Array<int32> a;
+        for (int32 i = 0; i < data.Count(); i++)
+            a.Add(data.Get()[i]);
+        BenchmarkKeep(a.Get()[0]);
+    });
+    context.Run("Add 1k (reserved)", [&]
+    {
+        Array<int32> a(data.Count());
+        for (int32 i = 0; i < data.Count(); i++)
+            a.Add(data.Get()[i]);
+        BenchmarkKeep(a.Get()[0]);
+    });
+    context.Run("Find in 1k", [&]
+    {
+        const int32 index = data.Find(data.Last());
+        BenchmarkKeep(index);
+    });
+    context.Run("RemoveAtKeepOrder front 1k", [&]
+    {
+        Array<int32> a(data);
+        while (a.HasItems())
+            a.RemoveAtKeepOrder(0);
+        BenchmarkKeep(a.Count());
+    });
+}
+
+BENCHMARK_SUITE("Dictionary", BenchmarkDictionary)
+{
+    Array<int32> data;
+    GenerateData(data, 1000);
+    Dictionary<int32, int32> filled;
+    for (int32 i = 0; i < data.Count(); i++)
+        filled[data[i]] = i;
+
+    context.Run("Add 1k", [&]
+    {
+        Dictionary<int32, int32> d;
+        for (int32 i = 0; i < data.Count(); i++)
+            d[data.Get()[i]] = i;
+        BenchmarkKeep(d.Count());
+    });
+    context.Run("TryGet 1k", [&]
+    {
+        int32 sum = 0, value;
+        for (int32 i = 0; i < data.Count(); i++)
+        {
+            if (filled.TryGet(data.Get()[i], value))
+                sum += value;
+        }
+        BenchmarkKeep(sum);
+    });
+    context.Run("Iterate 1k", [&]
+    {
+        int32 sum = 0;
+        for (const auto& e : filled)
+            sum += e.Value;
+        BenchmarkKeep(sum);
+    });
+}
+
+BENCHMARK_SUITE("HashSet", BenchmarkHashSet)
+{
+    Array<int32> data;
+    GenerateData(data, 1000);
+    HashSet<int32> filled;
+    for (int32 i = 0; i < data.Count(); i++)
+        filled.Add(data[i]);
+
+    context.Run("Add 1k", [&]
+    {
+        HashSet<int32> s;
+        for (int32 i = 0; i < data.Count(); i++)
+            s.Add(data.Get()[i]);
+        BenchmarkKeep(s.Count());
+    });
+    context.Run("Contains 1k", [&]
+    {
+        int32 count = 0;
+        for (int32 i = 0; i < data.Count(); i++)
+            count += filled.Contains(data.Get()[i]) ? 1 : 0;
+        BenchmarkKeep(count);
+    });
+}
+
+BENCHMARK_SUITE("Sorting", BenchmarkSorting)
+{
+    Array<int32> data, sorted;
+    GenerateData(data, 10000);
+
+    context.Run("QuickSort 10k", [&]
+    {
+        sorted = data;
+        Sorting::QuickSort(sorted.Get(), sorted.Count());
+        BenchmarkKeep(sorted.Get()[0]);
+    });
+    context.Run("QuickSort 10k (sorted)", [&]
+    {
+        Sorting::QuickSort(sorted.Get(), sorted.Count());
+        BenchmarkKeep(sorted.Get()[0]);
+    });
+}
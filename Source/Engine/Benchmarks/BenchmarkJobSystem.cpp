@@ -0,0 +1,45 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Threading/JobSystem.h"
+
+BENCHMARK_SUITE("JobSystem", BenchmarkJobSystem)
+{
+    int64 counter = 0;
+    Function<void(int32)> emptyJob = [](int32)
+    {
+    };
+    Function<void(int32)> counterJob = [&counter](int32)
+    {
+        Platform::InterlockedIncrement(&counter);
+    };
+    Function<void(int32)> workJob = [&counter](int32 index)
+    {
+        // Small amount of work per job to measure the scheduling throughput
+        uint32 hash = (uint32)index;
+        for (int32 i = 0; i < 256; i++)
+            hash = hash * 16777619u ^ (uint32)i;
+        Platform::InterlockedAdd(&counter, (int64)(hash & 1));
+    };
+
+    context.Run("Dispatch and Wait (latency)", [&]
+    {
+        JobSystem::Wait(JobSystem::Dispatch(emptyJob, 1));
+    });
+    context.Run("Dispatch x64 and Wait", [&]
+    {
+        JobSystem::Wait(JobSystem::Dispatch(counterJob, 64));
+    });
+    context.Run("Dispatch x4096 and Wait (throughput)", [&]
+    {
+        JobSystem::Wait(JobSystem::Dispatch(workJob, 4096));
+    });
+    context.Run("Dispatch x16 with dependency and Wait", [&]
+    {
+        const int64 first = JobSystem::Dispatch(counterJob, 16);
+        const int64 second = JobSystem::Dispatch(counterJob, 16, Span<int64>(&first, 1));
+        JobSystem::Wait(second);
+    });
+    BenchmarkKeep(counter);
+}
@@ -0,0 +1,161 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if PLATFORM_WINDOWS || PLATFORM_LINUX || PLATFORM_MAC
+
+#include "Benchmark.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/CPUInfo.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Editor/Scripting/ScriptsBuilder.h"
+
+volatile const void* BenchmarkImpl::Sink = nullptr;
+
+namespace
+{
+    struct BenchmarkSuite
+    {
+        const char* Name;
+        BenchmarkSuiteFunc Func;
+    };
+
+    Array<BenchmarkSuite>& GetSuites()
+    {
+        // Function-local static to not depend on the static initialization order of the registrations
+        static Array<BenchmarkSuite> suites;
+        return suites;
+    }
+
+    bool SaveResults(const Array<BenchmarkResult>& results, const String& path)
+    {
+        rapidjson_flax::StringBuffer buffer;
+        PrettyJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        writer.StartObject();
+        writer.JKEY("EngineVersion");
+        writer.String(FLAXENGINE_VERSION_TEXT);
+        writer.JKEY("Platform");
+        writer.String(ToString(PLATFORM_TYPE));
+        writer.JKEY("Architecture");
+        writer.String(ToString(PLATFORM_ARCH));
+        writer.JKEY("LogicalProcessors");
+        writer.Int((int32)Platform::GetCPUInfo().LogicalProcessorCount);
+        writer.JKEY("Date");
+        writer.String(DateTime::Now().ToString());
+        writer.JKEY("Benchmarks");
+        writer.StartArray();
+        for (const BenchmarkResult& e : results)
+        {
+            writer.StartObject();
+            writer.JKEY("Suite");
+            writer.String(e.Suite);
+            writer.JKEY("Name");
+            writer.String(e.Name);
+            writer.JKEY("Iterations");
+            writer.Int(e.Iterations);
+            writer.JKEY("MinNs");
+            writer.Double(e.MinNs);
+            writer.JKEY("MedianNs");
+            writer.Double(e.MedianNs);
+            writer.JKEY("MeanNs");
+            writer.Double(e.MeanNs);
+            writer.JKEY("StdDevNs");
+            writer.Double(e.StdDevNs);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+        return File::WriteAllBytes(path, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+    }
+}
+
+BenchmarkSuiteRegistration::BenchmarkSuiteRegistration(const char* suite, BenchmarkSuiteFunc func)
+{
+    GetSuites().Add({ suite, func });
+}
+
+void BenchmarkContext::AddResult(const char* name, int32 iterations, double* samples, int32 samplesCount)
+{
+    Sorting::QuickSort(samples, samplesCount);
+    double sum = 0.0;
+    for (int32 i = 0; i < samplesCount; i++)
+        sum += samples[i];
+    const double mean = sum / samplesCount;
+    double variance = 0.0;
+    for (int32 i = 0; i < samplesCount; i++)
+        variance += (samples[i] - mean) * (samples[i] - mean);
+
+    auto& result = Results->AddOne();
+    result.Suite = Suite;
+    result.Name = name;
+    result.Iterations = iterations;
+    result.MinNs = samples[0];
+    result.MedianNs = samples[samplesCount / 2];
+    result.MeanNs = mean;
+    result.StdDevNs = Math::Sqrt(variance / samplesCount);
+    LOG(Info, "{0}.{1}: {2} ns (min: {3} ns, stddev: {4} ns)", String(Suite), String(name), (float)result.MedianNs, (float)result.MinNs, (float)result.StdDevNs);
+}
+
+class BenchmarksRunnerService : public EngineService
+{
+public:
+    BenchmarksRunnerService()
+        : EngineService(TEXT("BenchmarksRunnerService"), 10000)
+    {
+    }
+
+    void Update() override;
+};
+
+BenchmarksRunnerService BenchmarksRunnerServiceInstance;
+
+void BenchmarksRunnerService::Update()
+{
+    // End if failed to perform a startup
+    if (ScriptsBuilder::LastCompilationFailed())
+    {
+        Engine::RequestExit(-1);
+        return;
+    }
+
+    // Wait for Editor to be ready for running benchmarks (eg. scripting loaded) to not measure the startup work
+    if (!ScriptsBuilder::IsReady() ||
+        !Scripting::IsEveryAssemblyLoaded() ||
+        !Scripting::HasGameModulesLoaded())
+        return;
+
+    // Run benchmarks
+    Log::Logger::WriteFloor();
+    LOG(Info, "Running Flax Benchmarks...");
+    Array<BenchmarkResult> results;
+    for (const BenchmarkSuite& suite : GetSuites())
+    {
+        BenchmarkContext context;
+        context.Suite = suite.Name;
+        context.Results = &results;
+        suite.Func(context);
+    }
+
+    // Save results
+    const String path = Globals::StartupFolder / TEXT("Benchmarks.json");
+    int32 result = 0;
+    if (SaveResults(results, path))
+    {
+        LOG(Error, "Failed to save benchmarks results to '{0}'", path);
+        result = -1;
+    }
+    else
+    {
+        LOG(Info, "Saved {0} benchmarks results to '{1}'", results.Count(), path);
+    }
+    Log::Logger::WriteFloor();
+    Engine::RequestExit(result);
+}
+
+#endif
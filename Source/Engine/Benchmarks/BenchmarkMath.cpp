@@ -0,0 +1,118 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/RandomStream.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+// Amount of the items processed in a single benchmark iteration
+#define BENCHMARK_MATH_COUNT 256
+
+namespace
+{
+    Float3 GetRandomPosition(const RandomStream& rand)
+    {
+        return Float3(rand.RandRange(-1000.0f, 1000.0f), rand.RandRange(-1000.0f, 1000.0f), rand.RandRange(-1000.0f, 1000.0f));
+    }
+}
+
+BENCHMARK_SUITE("Matrix", BenchmarkMatrix)
+{
+    RandomStream rand(101);
+    Matrix matrices[BENCHMARK_MATH_COUNT], results[BENCHMARK_MATH_COUNT];
+    for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        Matrix::Transformation(GetRandomPosition(rand) * 0.001f + 1.0f, Quaternion::Euler(GetRandomPosition(rand)), GetRandomPosition(rand), matrices[i]);
+
+    context.Run("Multiply x256", [&]
+    {
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            Matrix::Multiply(matrices[i], matrices[(i + 1) % BENCHMARK_MATH_COUNT], results[i]);
+        BenchmarkKeep(results[BENCHMARK_MATH_COUNT - 1]);
+    });
+    context.Run("Invert x256", [&]
+    {
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            Matrix::Invert(matrices[i], results[i]);
+        BenchmarkKeep(results[BENCHMARK_MATH_COUNT - 1]);
+    });
+    context.Run("Transform Float3 x256", [&]
+    {
+        Float3 result = Float3::Zero;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        {
+            Float3 v;
+            Float3::Transform(Float3::One, matrices[i], v);
+            result += v;
+        }
+        BenchmarkKeep(result);
+    });
+}
+
+BENCHMARK_SUITE("Quaternion", BenchmarkQuaternion)
+{
+    RandomStream rand(101);
+    Quaternion quaternions[BENCHMARK_MATH_COUNT], results[BENCHMARK_MATH_COUNT];
+    for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+        quaternions[i] = Quaternion::Euler(GetRandomPosition(rand));
+
+    context.Run("Multiply x256", [&]
+    {
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            Quaternion::Multiply(quaternions[i], quaternions[(i + 1) % BENCHMARK_MATH_COUNT], results[i]);
+        BenchmarkKeep(results[BENCHMARK_MATH_COUNT - 1]);
+    });
+    context.Run("Slerp x256", [&]
+    {
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            Quaternion::Slerp(quaternions[i], quaternions[(i + 1) % BENCHMARK_MATH_COUNT], 0.3f, results[i]);
+        BenchmarkKeep(results[BENCHMARK_MATH_COUNT - 1]);
+    });
+    context.Run("Rotate Float3 x256", [&]
+    {
+        Float3 result = Float3::Zero;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            result += quaternions[i] * Float3::UnitX;
+        BenchmarkKeep(result);
+    });
+}
+
+BENCHMARK_SUITE("BoundingFrustum", BenchmarkBoundingFrustum)
+{
+    RandomStream rand(101);
+    Matrix view, projection, viewProjection;
+    Matrix::LookAt(Float3::Zero, Float3::UnitZ, Float3::UnitY, view);
+    Matrix::PerspectiveFov(PI_OVER_2, 16.0f / 9.0f, 10.0f, 10000.0f, projection);
+    Matrix::Multiply(view, projection, viewProjection);
+    const BoundingFrustum frustum(viewProjection);
+    BoundingBox boxes[BENCHMARK_MATH_COUNT];
+    BoundingSphere spheres[BENCHMARK_MATH_COUNT];
+    for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+    {
+        const Float3 center = GetRandomPosition(rand);
+        boxes[i] = BoundingBox(center - 50.0f, center + 50.0f);
+        spheres[i] = BoundingSphere(center, 50.0f);
+    }
+
+    context.Run("Create", [&]
+    {
+        const BoundingFrustum f(viewProjection);
+        BenchmarkKeep(f);
+    });
+    context.Run("Intersects Box x256", [&]
+    {
+        int32 count = 0;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            count += frustum.Intersects(boxes[i]) ? 1 : 0;
+        BenchmarkKeep(count);
+    });
+    context.Run("Intersects Sphere x256", [&]
+    {
+        int32 count = 0;
+        for (int32 i = 0; i < BENCHMARK_MATH_COUNT; i++)
+            count += frustum.Intersects(spheres[i]) ? 1 : 0;
+        BenchmarkKeep(count);
+    });
+}
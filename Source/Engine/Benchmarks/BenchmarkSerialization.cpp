@@ -0,0 +1,156 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Benchmark.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+
+// Amount of the items processed in a single benchmark iteration
+#define BENCHMARK_SERIALIZATION_COUNT 256
+
+namespace
+{
+    void WriteTestJson(JsonWriter& writer)
+    {
+        writer.StartArray();
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+        {
+            writer.StartObject();
+            writer.JKEY("ID");
+            writer.Int(i);
+            writer.JKEY("Name");
+            writer.String("Actor");
+            writer.JKEY("Position");
+            writer.StartObject();
+            writer.JKEY("X");
+            writer.Float((float)i * 0.5f);
+            writer.JKEY("Y");
+            writer.Float(1.0f);
+            writer.JKEY("Z");
+            writer.Float(-(float)i);
+            writer.EndObject();
+            writer.JKEY("IsActive");
+            writer.Bool(true);
+            writer.EndObject();
+        }
+        writer.EndArray();
+    }
+}
+
+BENCHMARK_SUITE("MemoryStream", BenchmarkMemoryStream)
+{
+    MemoryWriteStream stream(64 * 1024);
+    const String text(TEXT("Benchmark string value"));
+
+    context.Run("Write int32 x256", [&]
+    {
+        stream.SetPosition(0);
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            stream.WriteInt32(i);
+        BenchmarkKeep(stream.GetPosition());
+    });
+    context.Run("Write Float3 x256", [&]
+    {
+        stream.SetPosition(0);
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            stream.Write(Float3((float)i));
+        BenchmarkKeep(stream.GetPosition());
+    });
+    context.Run("Write String x256", [&]
+    {
+        stream.SetPosition(0);
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            stream.Write(text);
+        BenchmarkKeep(stream.GetPosition());
+    });
+    const uint32 stringsSize = stream.GetPosition();
+    context.Run("Read String x256", [&]
+    {
+        MemoryReadStream read(stream.GetHandle(), stringsSize);
+        String value;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            read.Read(value);
+        BenchmarkKeep(value.Length());
+    });
+}
+
+BENCHMARK_SUITE("Json", BenchmarkJson)
+{
+    rapidjson_flax::StringBuffer buffer;
+    context.Run("Write compact x256 objects", [&]
+    {
+        buffer.Clear();
+        CompactJsonWriter writer(buffer);
+        WriteTestJson(writer);
+        BenchmarkKeep(buffer.GetSize());
+    });
+    context.Run("Parse x256 objects", [&]
+    {
+        rapidjson_flax::Document document;
+        document.Parse(buffer.GetString(), buffer.GetSize());
+        BenchmarkKeep(document.Size());
+    });
+}
+
+BENCHMARK_SUITE("Variant", BenchmarkVariant)
+{
+    const Variant intValue(123);
+    const Variant floatValue(123.5f);
+    const Variant vectorValue(Float3(1, 2, 3));
+    const Variant stringValue(StringView(TEXT("123")));
+    const VariantType floatType(VariantType::Float);
+    const VariantType doubleType(VariantType::Double);
+
+    context.Run("Construct int32 x256", [&]
+    {
+        int32 sum = 0;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+        {
+            const Variant v(i);
+            sum += v.AsInt;
+        }
+        BenchmarkKeep(sum);
+    });
+    context.Run("Construct String x256", [&]
+    {
+        int32 length = 0;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+        {
+            const Variant v(StringView(TEXT("Benchmark string value")));
+            length += ((StringView)v).Length();
+        }
+        BenchmarkKeep(length);
+    });
+    context.Run("Convert int32 to float x256", [&]
+    {
+        float sum = 0.0f;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            sum += (float)intValue;
+        BenchmarkKeep(sum);
+    });
+    context.Run("Cast float to double x256", [&]
+    {
+        double sum = 0.0;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            sum += Variant::Cast(floatValue, doubleType).AsDouble;
+        BenchmarkKeep(sum);
+    });
+    context.Run("Cast String to float x256", [&]
+    {
+        float sum = 0.0f;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            sum += Variant::Cast(stringValue, floatType).AsFloat;
+        BenchmarkKeep(sum);
+    });
+    context.Run("Float3 ToString x256", [&]
+    {
+        int32 length = 0;
+        for (int32 i = 0; i < BENCHMARK_SERIALIZATION_COUNT; i++)
+            length += vectorValue.ToString().Length();
+        BenchmarkKeep(length);
+    });
+}
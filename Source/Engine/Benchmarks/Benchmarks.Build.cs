@@ -0,0 +1,21 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System.Collections.Generic;
+using Flax.Build;
+
+/// <summary>
+/// Engine microbenchmarks module.
+/// </summary>
+public class Benchmarks : EngineModule
+{
+    /// <inheritdoc />
+    public Benchmarks()
+    {
+        Deploy = false;
+    }
+
+    /// <inheritdoc />
+    public override void GetFilesToDeploy(List<string> files)
+    {
+    }
+}
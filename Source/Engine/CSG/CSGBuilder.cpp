@@ -18,6 +18,8 @@
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Utilities/Crc.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
@@ -31,9 +33,30 @@ using namespace CSG;
 
 struct BuildData;
 
+// The CSG geometry of the overlapping brushes group (brushes that don't overlap with other groups can be processed independently)
+struct BuildRegion
+{
+    Array<Guid> Brushes;
+    Array<uint32> Hashes;
+    RawData* Data = nullptr;
+};
+
+// The cached CSG geometry of the scene regions (from the last build)
+struct SceneBuildCache
+{
+    Array<BuildRegion> Regions;
+
+    ~SceneBuildCache()
+    {
+        for (auto& region : Regions)
+            Delete(region.Data);
+    }
+};
+
 namespace CSGBuilderImpl
 {
     Array<Scene*> ScenesToRebuild;
+    Dictionary<Scene*, SceneBuildCache*> Caches;
 
     void onSceneUnloading(Scene* scene, const Guid& sceneId);
     bool buildInner(Scene* scene, BuildData& data);
@@ -53,6 +76,7 @@ class CSGBuilderService : public EngineService
 
     bool Init() override;
     void Update() override;
+    void Dispose() override;
 };
 
 CSGBuilderService CSGBuilderServiceInstance;
@@ -63,6 +87,12 @@ void CSGBuilderImpl::onSceneUnloading(Scene* scene, const Guid& sceneId)
 {
     // Ensure to remove scene (prevent crashes)
     ScenesToRebuild.Remove(scene);
+    SceneBuildCache* cache;
+    if (Caches.TryGet(scene, cache))
+    {
+        Delete(cache);
+        Caches.Remove(scene);
+    }
 }
 
 bool CSGBuilderService::Init()
@@ -92,6 +122,13 @@ void CSGBuilderService::Update()
     }
 }
 
+void CSGBuilderService::Dispose()
+{
+    Level::SceneUnloading.Unbind(onSceneUnloading);
+    ScenesToRebuild.Clear();
+    Caches.ClearDelete();
+}
+
 bool Builder::IsActive()
 {
     return ScenesToRebuild.HasItems();
@@ -120,7 +157,7 @@ namespace CSG
 {
     typedef Dictionary<Actor*, Mesh*> MeshesLookup;
 
-    bool walkTree(Actor* actor, MeshesArray& meshes, MeshesLookup& cache)
+    bool walkTree(Actor* actor, Array<Brush*>& brushes)
     {
         // Check if actor is a brush
         auto brush = dynamic_cast<Brush*>(actor);
@@ -130,15 +167,9 @@ namespace CSG
             if (brush->CanUseCSG())
             {
                 // Skip subtract/common meshes from the beginning (they have no effect)
-                if (meshes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
+                if (brushes.Count() > 0 || brush->GetBrushMode() == Mode::Additive)
                 {
-                    // Create new mesh and build for given brush
-                    auto mesh = New<CSG::Mesh>();
-                    mesh->Build(brush);
-
-                    // Save results
-                    meshes.Add(mesh);
-                    cache.Add(actor, mesh);
+                    brushes.Add(brush);
                 }
                 else
                 {
@@ -151,6 +182,23 @@ namespace CSG
         return true;
     }
 
+    uint32 GetBrushHash(Brush* brush, const Mesh* mesh)
+    {
+        // Hash the brush planes and surfaces properties to detect modifications since the last build
+        uint32 hash = (uint32)brush->GetBrushMode();
+        for (const Surface& surface : *mesh->GetSurfaces())
+        {
+            hash = Crc::MemCrc32(&surface.Normal, sizeof(surface.Normal), hash);
+            hash = Crc::MemCrc32(&surface.D, sizeof(surface.D), hash);
+            hash = Crc::MemCrc32(&surface.Material, sizeof(surface.Material), hash);
+            hash = Crc::MemCrc32(&surface.TexCoordScale, sizeof(surface.TexCoordScale), hash);
+            hash = Crc::MemCrc32(&surface.TexCoordOffset, sizeof(surface.TexCoordOffset), hash);
+            hash = Crc::MemCrc32(&surface.TexCoordRotation, sizeof(surface.TexCoordRotation), hash);
+            hash = Crc::MemCrc32(&surface.ScaleInLightmap, sizeof(surface.ScaleInLightmap), hash);
+        }
+        return hash;
+    }
+
     Mesh* Combine(Actor* actor, MeshesLookup& cache, Mesh* combineParent)
     {
         ASSERT(actor);
@@ -237,44 +285,164 @@ namespace CSG
 
 struct BuildData
 {
+    Array<Brush*> brushes;
     MeshesArray meshes;
-    MeshesLookup cache;
+    Array<uint32> hashes;
+    SceneBuildCache* cache = nullptr;
+    int32 rebuiltRegions = 0;
     Guid outputModelAssetId = Guid::Empty;
     Guid outputRawDataAssetId = Guid::Empty;
     Guid outputCollisionDataAssetId = Guid::Empty;
 
     BuildData(int32 meshesCapacity = 32)
-        : meshes(meshesCapacity * 32)
-        , cache(meshesCapacity * 4)
+        : brushes(meshesCapacity * 32)
+        , meshes(meshesCapacity * 32)
     {
     }
 };
 
+namespace
+{
+    int32 FindRoot(Array<int32>& parents, int32 i)
+    {
+        while (parents[i] != i)
+        {
+            parents[i] = parents[parents[i]];
+            i = parents[i];
+        }
+        return i;
+    }
+}
+
 bool CSGBuilderImpl::buildInner(Scene* scene, BuildData& data)
 {
-    // Setup CSG meshes list and build them
+    // Setup CSG brushes list
     {
-        Function<bool(Actor*, MeshesArray&, MeshesLookup&)> treeWalkFunction(walkTree);
-        SceneQuery::TreeExecute<Array<CSG::Mesh*>&, MeshesLookup&>(treeWalkFunction, data.meshes, data.cache);
+        Function<bool(Actor*, Array<Brush*>&)> treeWalkFunction(walkTree);
+        SceneQuery::TreeExecute<Array<Brush*>&>(treeWalkFunction, data.brushes);
     }
-    if (data.meshes.IsEmpty())
+    const int32 brushesCount = data.brushes.Count();
+    if (brushesCount == 0)
+    {
+        data.cache->Regions.Clear();
         return false;
+    }
 
-    // Process all meshes (performs actual CSG opterations on geometry in tree structure)
-    CSG::Mesh* combinedMesh = Combine(scene, data.cache);
-    if (combinedMesh == nullptr)
-        return false;
+    // Build brushes meshes in parallel
+    data.meshes.Resize(brushesCount);
+    data.hashes.Resize(brushesCount);
+    {
+        PROFILE_CPU_NAMED("Build Brushes");
+        Function<void(int32)> job = [&data](int32 i)
+        {
+            auto mesh = New<CSG::Mesh>();
+            mesh->Build(data.brushes[i]);
+            mesh->Index = i;
+            data.meshes[i] = mesh;
+            data.hashes[i] = GetBrushHash(data.brushes[i], mesh);
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, brushesCount));
+    }
+
+    // Group overlapping brushes into regions (CSG operations affect only the overlapping geometry so regions can be processed independently)
+    Array<int32> parents;
+    parents.Resize(brushesCount);
+    for (int32 i = 0; i < brushesCount; i++)
+        parents[i] = i;
+    for (int32 i = 0; i < brushesCount; i++)
+    {
+        const AABB bounds = data.meshes[i]->GetBounds();
+        for (int32 j = i + 1; j < brushesCount; j++)
+        {
+            if (!AABB::IsOutside(bounds, data.meshes[j]->GetBounds()))
+            {
+                const int32 rootA = FindRoot(parents, i);
+                const int32 rootB = FindRoot(parents, j);
+                if (rootA != rootB)
+                    parents[Math::Max(rootA, rootB)] = Math::Min(rootA, rootB);
+            }
+        }
+    }
+    Array<BuildRegion> regions;
+    Array<Array<int32>> regionsBrushes;
+    Dictionary<int32, int32> rootToRegion;
+    for (int32 i = 0; i < brushesCount; i++)
+    {
+        const int32 root = FindRoot(parents, i);
+        int32 regionIndex;
+        if (!rootToRegion.TryGet(root, regionIndex))
+        {
+            regionIndex = regions.Count();
+            rootToRegion.Add(root, regionIndex);
+            regions.AddOne();
+            regionsBrushes.AddOne();
+        }
+        regions[regionIndex].Brushes.Add(data.brushes[i]->GetBrushID());
+        regions[regionIndex].Hashes.Add(data.hashes[i]);
+        regionsBrushes[regionIndex].Add(i);
+    }
+
+    // Reuse geometry of the regions that were not modified since the last build (the same brushes in the same order)
+    Array<int32> dirtyRegions;
+    for (int32 regionIndex = 0; regionIndex < regions.Count(); regionIndex++)
+    {
+        auto& region = regions[regionIndex];
+        for (auto& cached : data.cache->Regions)
+        {
+            if (cached.Data && cached.Brushes == region.Brushes && cached.Hashes == region.Hashes)
+            {
+                region.Data = cached.Data;
+                cached.Data = nullptr;
+                break;
+            }
+        }
+        if (!region.Data)
+            dirtyRegions.Add(regionIndex);
+    }
+    data.rebuiltRegions = dirtyRegions.Count();
+
+    // Process modified regions in parallel (performs actual CSG operations on geometry in tree structure and triangulates the result)
+    if (dirtyRegions.HasItems())
+    {
+        PROFILE_CPU_NAMED("Build Regions");
+        Function<void(int32)> job = [&](int32 i)
+        {
+            auto& region = regions[dirtyRegions[i]];
+            const auto& regionBrushes = regionsBrushes[dirtyRegions[i]];
+            MeshesLookup lookup(regionBrushes.Count() * 4);
+            bool hasAdditive = false;
+            for (const int32 brushIndex : regionBrushes)
+            {
+                lookup.Add(dynamic_cast<Actor*>(data.brushes[brushIndex]), data.meshes[brushIndex]);
+                hasAdditive |= data.brushes[brushIndex]->GetBrushMode() == Mode::Additive;
+            }
+            region.Data = New<RawData>();
+            if (!hasAdditive)
+                return; // Subtract/common brushes have no effect without additive brushes to operate on
+            CSG::Mesh* combinedMesh = Combine(scene, lookup);
+            if (combinedMesh)
+            {
+                // Convert CSG meshes into raw triangles data
+                Array<RawModelVertex> vertexBuffer;
+                combinedMesh->Triangulate(*region.Data, vertexBuffer);
+            }
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, dirtyRegions.Count()));
+    }
+
+    // Cache the regions for the next build (releases the unused ones)
+    Swap(data.cache->Regions, regions);
+    for (auto& region : regions)
+        Delete(region.Data);
 
     // TODO: split too big meshes (too many verts, to far parts, etc.)
 
     // Triangulate meshes
     {
-        // TODO: setup valid loop for splited meshes
-
-        // Convert CSG meshes into raw triangles data
+        // Merge regions into raw triangles data
         RawData meshData;
-        Array<RawModelVertex> vertexBuffer;
-        combinedMesh->Triangulate(meshData, vertexBuffer);
+        for (const auto& region : data.cache->Regions)
+            meshData.Append(*region.Data);
         meshData.RemoveEmptySlots();
         if (meshData.Slots.HasItems())
         {
@@ -373,6 +541,11 @@ void CSGBuilderImpl::build(Scene* scene)
 
     // Build
     BuildData data;
+    if (!Caches.TryGet(scene, data.cache))
+    {
+        data.cache = New<SceneBuildCache>();
+        Caches.Add(scene, data.cache);
+    }
     bool failed = buildInner(scene, data);
 
     // Link new (or empty) CSG mesh
@@ -385,7 +558,7 @@ void CSGBuilderImpl::build(Scene* scene)
     // End
     data.meshes.ClearDelete();
     auto endTime = DateTime::Now();
-    LOG(Info, "CSG build in {0} ms! {1} brush(es)", (endTime - startTime).GetTotalMilliseconds(), data.meshes.Count());
+    LOG(Info, "CSG build in {0} ms! {1} brush(es), {2}/{3} region(s) rebuilt", (endTime - startTime).GetTotalMilliseconds(), data.brushes.Count(), data.rebuiltRegions, data.cache->Regions.Count());
 }
 
 bool CSGBuilderImpl::generateRawDataAsset(Scene* scene, RawData& meshData, Guid& assetId, const String& assetPath)
@@ -94,6 +94,17 @@ void RawData::AddSurface(Brush* brush, int32 brushSurfaceIndex, const Guid& surf
     }
 }
 
+void RawData::Append(const RawData& other)
+{
+    for (const Slot* otherSlot : other.Slots)
+    {
+        auto slot = GetOrAddSlot(otherSlot->Material);
+        slot->Surfaces.Add(otherSlot->Surfaces);
+    }
+    for (auto i = other.Brushes.Begin(); i.IsNotEnd(); ++i)
+        Brushes[i->Key] = i->Value;
+}
+
 void RawData::ToModelData(ModelData& modelData) const
 {
     // Generate lightmap UVs (single chart for the whole mesh)
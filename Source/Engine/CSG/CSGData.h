@@ -120,6 +120,12 @@ namespace CSG
     public:
         void AddSurface(Brush* brush, int32 brushSurfaceIndex, const Guid& surfaceMaterial, float scaleInLightmap, const Rectangle& lightmapUVsBox, const RawModelVertex* firstVertex, int32 vertexCount);
 
+        /// <summary>
+        /// Appends the geometry of the other mesh data (merges slots with the same material).
+        /// </summary>
+        /// <param name="other">The other mesh data.</param>
+        void Append(const RawData& other);
+
         /// <summary>
         /// Removes the empty slots.
         /// </summary>
@@ -12,7 +12,6 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/MainThreadTask.h"
-#include "Engine/Threading/ConcurrentTaskQueue.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 
 AssetReferenceBase::~AssetReferenceBase()
@@ -379,7 +378,7 @@ void Asset::Reload()
 
 namespace ContentLoadingManagerImpl
 {
-    extern ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    extern bool RemoveTask(Task* task);
 };
 
 bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
@@ -440,44 +439,13 @@ bool Asset::WaitForLoaded(double timeoutInMilliseconds) const
         const double timeoutInSeconds = timeoutInMilliseconds * 0.001;
         const double startTime = Platform::GetTimeSeconds();
         Task* task = loadingTask;
-        Array<ContentLoadTask*, InlinedAllocation<64>> localQueue;
 #define CHECK_CONDITIONS() (!Engine::ShouldExit() && (timeoutInSeconds <= 0.0 || Platform::GetTimeSeconds() - startTime < timeoutInSeconds))
         do
         {
-            // Try to execute content tasks
-            while (task->IsQueued() && CHECK_CONDITIONS())
+            // Try to execute content task (take it from the loading queue if it's still there, otherwise other thread runs it)
+            if (task->IsQueued() && ContentLoadingManagerImpl::RemoveTask(task))
             {
-                // Dequeue task from the loading queue
-                ContentLoadTask* tmp;
-                if (ContentLoadingManagerImpl::Tasks.try_dequeue(tmp))
-                {
-                    if (tmp == task)
-                    {
-                        if (localQueue.Count() != 0)
-                        {
-                            // Put back queued tasks
-                            ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
-                            localQueue.Clear();
-                        }
-
-                        thread->Run(tmp);
-                    }
-                    else
-                    {
-                        localQueue.Add(tmp);
-                    }
-                }
-                else
-                {
-                    // No task in queue but it's queued so other thread could have stolen it into own local queue
-                    break;
-                }
-            }
-            if (localQueue.Count() != 0)
-            {
-                // Put back queued tasks
-                ContentLoadingManagerImpl::Tasks.enqueue_bulk(localQueue.Get(), localQueue.Count());
-                localQueue.Clear();
+                thread->Run((ContentLoadTask*)task);
             }
 
             // Check if task is done
@@ -6,8 +6,10 @@
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
 #include "Engine/Animations/CurveSerialization.h"
 #include "Engine/Animations/AnimEvent.h"
+#include "Engine/Animations/Config.h"
 #include "Engine/Animations/SceneAnimations/SceneAnimation.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Streaming/StreamingGroup.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #if USE_EDITOR
@@ -17,9 +19,54 @@
 
 REGISTER_BINARY_ASSET(Animation, "FlaxEngine.Animation", false);
 
+static_assert(ANIM_STREAMING_MAX_SEGMENTS < ASSET_FILE_DATA_CHUNKS, "Animation segments are stored in the asset chunks after the header chunk.");
+
+bool Animation::StreamingTask::Run()
+{
+    AssetReference<Animation> ref = _asset.Get();
+    if (ref == nullptr)
+        return true;
+    ScopeLock lock(ref->Locker);
+    auto anim = ref.Get();
+    const auto& queue = anim->StreamingQueue;
+
+    // Load the segments data (from asset chunks)
+    for (int32 i = 0; i < queue.Count(); i++)
+    {
+        if (anim->LoadSegment(queue[i], anim->_streamedSegments[queue[i]]))
+            return true;
+    }
+
+    return false;
+}
+
+void Animation::StreamingTask::OnEnd()
+{
+    // Unlink
+    if (_asset)
+    {
+        ASSERT(_asset->_streamingTask == this);
+        _asset->_streamingTask = nullptr;
+
+        // Apply the loaded segments during the next streaming update
+        _asset->RequestStreamingUpdate();
+        _asset = nullptr;
+    }
+    _dataLock.Release();
+
+    // Base
+    ThreadPoolTask::OnEnd();
+}
+
 Animation::Animation(const SpawnParams& params, const AssetInfo* info)
     : BinaryAsset(params, info)
+    , StreamableResource(StreamingGroups::Instance()->Animations())
+{
+}
+
+Animation::~Animation()
 {
+    ASSERT(_streamingTask == nullptr);
 }
 
 #if USE_EDITOR
@@ -54,6 +101,9 @@ Animation::InfoData Animation::GetInfo() const
             info.MemoryUsage += e.Rotation.GetKeyframes().Capacity() * sizeof(LinearCurveKeyframe<Quaternion>);
             info.MemoryUsage += e.Scale.GetKeyframes().Capacity() * sizeof(LinearCurveKeyframe<Float3>);
         }
+        info.MemoryUsage += Data.Compressed.GetMemoryUsage();
+        for (auto& e : Data.Segments)
+            info.MemoryUsage += e.GetMemoryUsage();
     }
     else
     {
@@ -413,21 +463,41 @@ bool Animation::Save(const StringView& path)
         MemoryWriteStream stream(4096);
 
         // Info
-        stream.WriteInt32(103);
+        stream.WriteInt32(104);
         stream.WriteDouble(Data.Duration);
         stream.WriteDouble(Data.FramesPerSecond);
         stream.WriteByte((byte)Data.RootMotionFlags);
         stream.WriteString(Data.RootNodeName, 13);
 
         // Animation channels
+        Array<float, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS + 1>> segments;
+        Data.GetStreamingSegments(segments);
+        const int32 segmentsCount = Math::Max(segments.Count() - 1, 0);
         stream.WriteInt32(Data.Channels.Count());
+        stream.WriteInt32(segmentsCount);
         for (int32 i = 0; i < Data.Channels.Count(); i++)
         {
             auto& anim = Data.Channels[i];
             stream.WriteString(anim.NodeName, 172);
-            Serialization::Serialize(stream, anim.Position);
-            Serialization::Serialize(stream, anim.Rotation);
-            Serialization::Serialize(stream, anim.Scale);
+            if (segmentsCount == 0)
+            {
+                Serialization::Serialize(stream, anim.Position);
+                Serialization::Serialize(stream, anim.Rotation);
+                Serialization::Serialize(stream, anim.Scale);
+            }
+        }
+        if (segmentsCount != 0)
+        {
+            // Channels keyframes are stored in the time segments (in separate chunks) for streaming
+            stream.WriteBytes(segments.Get(), segments.Count() * sizeof(float));
+            for (int32 i = 0; i < segmentsCount; i++)
+            {
+                MemoryWriteStream segmentStream(4096);
+                Data.SerializeSegment(segmentStream, segments[i], segments[i + 1]);
+                auto chunk = GetOrCreateChunk(i + 1);
+                ASSERT(chunk != nullptr);
+                chunk->Data.Copy(segmentStream.GetHandle(), segmentStream.GetPosition());
+            }
         }
 
         // Animation events
@@ -498,6 +568,8 @@ uint64 Animation::GetMemoryUsage() const
     for (const auto& e : Events)
         result += e.First.Length() * sizeof(Char) + e.Second.GetMemoryUsage();
     result += NestedAnims.Capacity() * sizeof(Pair<String, NestedAnimData>);
+    for (const auto& e : _streamedSegments)
+        result += e.GetMemoryUsage();
     Locker.Unlock();
     return result;
 }
@@ -520,6 +592,184 @@ void Animation::OnScriptingDispose()
     BinaryAsset::OnScriptingDispose();
 }
 
+bool Animation::LoadSegment(int32 segmentIndex, AnimationSegment& segment)
+{
+    const int32 chunkIndex = segmentIndex + 1;
+    const auto chunk = GetChunk(chunkIndex);
+    if (chunk == nullptr || chunk->IsMissing())
+    {
+        LOG(Warning, "Missing data chunk {0} of '{1}'.", chunkIndex, ToString());
+        return true;
+    }
+    segment.Channels.Resize(Data.Channels.Count());
+    MemoryReadStream stream(chunk->Get(), chunk->Size());
+    if (AnimationData::DeserializeSegment(stream, segment.Channels, false))
+    {
+        LOG(Warning, "Failed to deserialize the animation segment {0} of '{1}'.", segmentIndex, ToString());
+        segment.Release();
+        return true;
+    }
+#if ANIM_COMPRESSION
+    // Compress segment channels for runtime sampling (keep the source curves if compression fails)
+    AnimationData tmp;
+    tmp.Name = Data.Name;
+    tmp.Channels.Swap(segment.Channels);
+    tmp.Compress(CompressedAnimationData::Settings(), true);
+    tmp.Channels.Swap(segment.Channels);
+    tmp.Compressed.Swap(segment.Compressed);
+#endif
+
+    // Release the source data (segment will be loaded from the storage again if needed)
+    ReleaseChunk(chunkIndex);
+    return false;
+}
+
+void Animation::CancelStreaming()
+{
+    Asset::CancelStreaming();
+    CancelStreamingTasks();
+}
+
+int32 Animation::UpdateStreamingSegments(double currentTime)
+{
+    ScopeLock lock(Locker);
+    auto& segments = Data.Segments;
+    StreamingQueue.Clear();
+    if (segments.IsEmpty() || _streamingTask)
+        return GetCurrentResidency();
+
+    // Apply the loaded segments (on a main thread to not conflict with the animations sampling)
+    for (int32 i = 0; i < segments.Count(); i++)
+    {
+        auto& streamed = _streamedSegments[i];
+        if (streamed.IsLoaded())
+        {
+            auto& segment = segments[i];
+            segment.Channels.Swap(streamed.Channels);
+            segment.Compressed.Swap(streamed.Compressed);
+            streamed.Release();
+        }
+    }
+
+    // Find segments to use (sampled recently or the next ones if playback gets close to them)
+    bool required[ANIM_STREAMING_MAX_SEGMENTS];
+    Platform::MemoryClear(required, sizeof(required));
+    const float prefetchFrames = ANIM_STREAMING_PREFETCH_TIME * (float)Data.FramesPerSecond;
+    for (int32 i = 0; i < segments.Count(); i++)
+    {
+        auto& segment = segments[i];
+        if (segment.Used)
+        {
+            segment.Used = false;
+            segment.LastUsedTime = currentTime;
+        }
+        if (currentTime - segment.LastUsedTime < ANIM_STREAMING_EVICT_TIME)
+        {
+            required[i] = true;
+            if (i + 1 < segments.Count() && segment.UsedPosition + prefetchFrames >= segments[i + 1].Start)
+                required[i + 1] = true;
+        }
+    }
+
+    // Always keep the first segment to start the playback without a delay
+    required[0] = true;
+
+    // Release the unused segments and enqueue the missing ones to load
+    int32 result = 0;
+    for (int32 i = 0; i < segments.Count(); i++)
+    {
+        auto& segment = segments[i];
+        if (required[i])
+        {
+            result++;
+            if (!segment.IsLoaded())
+                StreamingQueue.Add(i);
+        }
+        else if (segment.IsLoaded())
+        {
+            segment.Release();
+        }
+    }
+    return result;
+}
+
+int32 Animation::GetMaxResidency() const
+{
+    return Data.Segments.Count();
+}
+
+int32 Animation::GetCurrentResidency() const
+{
+    int32 result = 0;
+    for (const auto& segment : Data.Segments)
+        result += segment.IsLoaded() ? 1 : 0;
+    return result;
+}
+
+int32 Animation::GetAllocatedResidency() const
+{
+    return GetCurrentResidency();
+}
+
+uint64 Animation::GetMemoryUsage(int32 residency) const
+{
+    // Estimate memory usage from the segments data size
+    uint64 result = 0;
+    for (int32 i = 0; i < residency && i < Data.Segments.Count(); i++)
+        result += GetChunkSize(i + 1);
+    return result;
+}
+
+bool Animation::CanBeUpdated() const
+{
+    // Check if is streamed and has no streaming tasks running
+    return Data.Segments.HasItems() && _streamingTask == nullptr;
+}
+
+Task* Animation::UpdateAllocation(int32 residency)
+{
+    // Animations are not using dynamic allocation feature
+    return nullptr;
+}
+
+Task* Animation::CreateStreamingTask(int32 residency)
+{
+    ScopeLock lock(Locker);
+    ASSERT(Data.Segments.HasItems() && _streamingTask == nullptr);
+    Task* result = nullptr;
+
+    // Requests assets chunks data
+    for (int32 i = 0; i < StreamingQueue.Count(); i++)
+    {
+        const auto task = (Task*)RequestChunkDataAsync(StreamingQueue[i] + 1);
+        if (task)
+        {
+            if (result)
+                result->ContinueWith(task);
+            else
+                result = task;
+        }
+    }
+
+    // Add streaming task
+    _streamingTask = New<StreamingTask>(this);
+    if (result)
+        result->ContinueWith(_streamingTask);
+    else
+        result = _streamingTask;
+
+    return result;
+}
+
+void Animation::CancelStreamingTasks()
+{
+    if (_streamingTask)
+    {
+        _streamingTask->Cancel();
+        ASSERT_LOW_LAYER(_streamingTask == nullptr);
+    }
+}
+
 Asset::LoadResult Animation::load()
 {
     // Get stream with animations data
@@ -533,6 +783,7 @@ Asset::LoadResult Animation::load()
     switch (headerVersion)
     {
     case 103:
+    case 104:
         stream.ReadInt32(&headerVersion);
         stream.ReadDouble(&Data.Duration);
         stream.ReadDouble(&Data.FramesPerSecond);
@@ -562,23 +813,81 @@ Asset::LoadResult Animation::load()
     // Animation channels
     int32 animationsCount;
     stream.ReadInt32(&animationsCount);
+    int32 segmentsCount = 0;
+    if (headerVersion >= 104)
+        stream.ReadInt32(&segmentsCount);
+    if (segmentsCount < 0 || segmentsCount > ANIM_STREAMING_MAX_SEGMENTS)
+    {
+        LOG(Warning, "Invalid animation segments count {0}.", segmentsCount);
+        return LoadResult::InvalidData;
+    }
     Data.Channels.Resize(animationsCount, false);
-    for (int32 i = 0; i < animationsCount; i++)
+    if (segmentsCount != 0)
     {
-        auto& anim = Data.Channels[i];
-
-        stream.ReadString(&anim.NodeName, 172);
-        bool failed = Serialization::Deserialize(stream, anim.Position);
-        failed |= Serialization::Deserialize(stream, anim.Rotation);
-        failed |= Serialization::Deserialize(stream, anim.Scale);
-
-        if (failed)
+        // Channels keyframes are stored in the time segments (in separate chunks)
+        for (int32 i = 0; i < animationsCount; i++)
+            stream.ReadString(&Data.Channels[i].NodeName, 172);
+        float segmentsBounds[ANIM_STREAMING_MAX_SEGMENTS + 1];
+        stream.ReadBytes(segmentsBounds, (segmentsCount + 1) * sizeof(float));
+#if USE_EDITOR
+        // Load all segments at once to be able to edit the whole animation
+        for (int32 segmentIndex = 0; segmentIndex < segmentsCount; segmentIndex++)
         {
-            LOG(Warning, "Failed to deserialize the animation curve data.");
+            const auto chunk = LoadChunk(segmentIndex + 1) ? nullptr : GetChunk(segmentIndex + 1);
+            if (chunk == nullptr)
+                return LoadResult::MissingDataChunk;
+            MemoryReadStream segmentStream(chunk->Get(), chunk->Size());
+            if (AnimationData::DeserializeSegment(segmentStream, Data.Channels, true))
+            {
+                LOG(Warning, "Failed to deserialize the animation curve data.");
+                return LoadResult::Failed;
+            }
+            ReleaseChunk(segmentIndex + 1);
+        }
+#else
+        // Setup segments for streaming
+        Data.Segments.Resize(segmentsCount);
+        _streamedSegments.Resize(segmentsCount);
+        for (int32 segmentIndex = 0; segmentIndex < segmentsCount; segmentIndex++)
+        {
+            auto& segment = Data.Segments[segmentIndex];
+            segment.Start = segmentsBounds[segmentIndex];
+            segment.End = segmentsBounds[segmentIndex + 1];
+        }
+
+        // Load the first segment to start playback without a delay, rest is streamed
+        if (LoadChunk(1))
+            return LoadResult::MissingDataChunk;
+        if (LoadSegment(0, Data.Segments[0]))
             return LoadResult::Failed;
+        StartStreaming(false);
+#endif
+    }
+    else
+    {
+        for (int32 i = 0; i < animationsCount; i++)
+        {
+            auto& anim = Data.Channels[i];
+
+            stream.ReadString(&anim.NodeName, 172);
+            bool failed = Serialization::Deserialize(stream, anim.Position);
+            failed |= Serialization::Deserialize(stream, anim.Rotation);
+            failed |= Serialization::Deserialize(stream, anim.Scale);
+
+            if (failed)
+            {
+                LOG(Warning, "Failed to deserialize the animation curve data.");
+                return LoadResult::Failed;
+            }
         }
     }
 
+#if ANIM_COMPRESSION
+    // Compress animation channels for runtime sampling (keep the source curves if compression fails)
+    if (segmentsCount == 0)
+        Data.Compress(CompressedAnimationData::Settings(), true);
+#endif
+
     // Animation events
     if (headerVersion >= 101)
     {
@@ -659,6 +968,10 @@ void Animation::unload(bool isReloading)
         Level::ScriptsReloadStart.Unbind<Animation, &Animation::OnScriptsReloadStart>(this);
     }
 #endif
+    StopStreaming();
+    CancelStreamingTasks();
+    StreamingQueue.Clear();
+    _streamedSegments.Clear();
     Data.Dispose();
     for (const auto& e : Events)
     {
@@ -6,6 +6,9 @@
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Animations/AnimationData.h"
 #include "Engine/Content/AssetReference.h"
+#include "Engine/Content/WeakAssetReference.h"
+#include "Engine/Streaming/StreamableResource.h"
+#include "Engine/Threading/ThreadPoolTask.h"
 
 class SkinnedModel;
 class AnimEvent;
@@ -13,7 +16,7 @@ class AnimEvent;
 /// <summary>
 /// Asset that contains an animation spline represented by a set of keyframes, each representing an endpoint of a linear curve.
 /// </summary>
-API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset
+API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset, public StreamableResource
 {
     DECLARE_BINARY_ASSET_HEADER(Animation, 1);
 
@@ -76,11 +79,45 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset
         AssetReference<Animation> Anim;
     };
 
+    /// <summary>
+    /// Animation segments streaming task (loads the requested segments data from the asset chunks).
+    /// </summary>
+    class StreamingTask : public ThreadPoolTask
+    {
+    private:
+        WeakAssetReference<Animation> _asset;
+        FlaxStorage::LockData _dataLock;
+
+    public:
+        StreamingTask(Animation* asset)
+            : _asset(asset)
+            , _dataLock(asset->Storage->Lock())
+        {
+        }
+
+    public:
+        // [ThreadPoolTask]
+        bool HasReference(Object* resource) const override
+        {
+            return _asset == resource;
+        }
+
+    protected:
+        // [ThreadPoolTask]
+        bool Run() override;
+        void OnEnd() override;
+    };
+
 private:
 #if USE_EDITOR
     bool _registeredForScriptingReload = false;
     void OnScriptsReloadStart();
 #endif
+    StreamingTask* _streamingTask = nullptr;
+    Array<AnimationSegment> _streamedSegments;
+
+    // Loads the segment keyframes from the asset chunk (data has to be loaded).
+    bool LoadSegment(int32 segmentIndex, AnimationSegment& segment);
 
 public:
     /// <summary>
@@ -98,6 +135,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset
     /// </summary>
     Array<Pair<String, NestedAnimData>> NestedAnims;
 
+    /// <summary>
+    /// The indices of the animation segments to stream in. Updated by the streaming (see UpdateStreamingSegments).
+    /// </summary>
+    Array<int32, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS>> StreamingQueue;
+
+public:
+    ~Animation();
+
 public:
     /// <summary>
     /// Gets the length of the animation (in seconds).
@@ -128,6 +173,21 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset
     /// </summary>
     API_PROPERTY() InfoData GetInfo() const;
 
+    /// <summary>
+    /// Returns true if the animation data is streamed in time segments near the playback position (long clips), otherwise the whole animation is loaded at once.
+    /// </summary>
+    API_PROPERTY() bool IsStreamed() const
+    {
+        return Data.Segments.HasItems();
+    }
+
+    /// <summary>
+    /// Updates the streamed animation segments: applies the loaded segments data, releases the segments that were not sampled for a while and gathers the segments to load into the streaming queue (sampled ones and the next ones near the playback position). Called by the streaming on a main thread.
+    /// </summary>
+    /// <param name="currentTime">The current platform time (seconds).</param>
+    /// <returns>The amount of the segments that should be resident.</returns>
+    int32 UpdateStreamingSegments(double currentTime);
+
 #if USE_EDITOR
     /// <summary>
     /// Gets the animation as serialized timeline data. Used to show it in Editor.
@@ -155,6 +215,17 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Animation : public BinaryAsset
     // [BinaryAsset]
     uint64 GetMemoryUsage() const override;
     void OnScriptingDispose() override;
+    void CancelStreaming() override;
+
+    // [StreamableResource]
+    int32 GetMaxResidency() const override;
+    int32 GetCurrentResidency() const override;
+    int32 GetAllocatedResidency() const override;
+    uint64 GetMemoryUsage(int32 residency) const override;
+    bool CanBeUpdated() const override;
+    Task* UpdateAllocation(int32 residency) override;
+    Task* CreateStreamingTask(int32 residency) override;
+    void CancelStreamingTasks() override;
 
 protected:
     // [BinaryAsset]
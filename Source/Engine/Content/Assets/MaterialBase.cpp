@@ -6,6 +6,7 @@
 #include "Engine/Core/Types/Variant.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Factories/BinaryAssetFactory.h"
+#include "Engine/Engine/Engine.h"
 
 REGISTER_BINARY_ASSET_ABSTRACT(MaterialBase, "FlaxEngine.MaterialBase");
 
@@ -45,3 +46,24 @@ MaterialInstance* MaterialBase::CreateVirtualInstance()
     instance->SetBaseMaterial(this);
     return instance;
 }
+
+void MaterialBase::ReportStreamingFeedback(float size)
+{
+    const int64 frame = (int64)Engine::FrameCount;
+    const int64 pixels = (int64)size;
+    if (Platform::InterlockedExchange(&_streamingFeedbackFrame, frame) != frame)
+        Platform::InterlockedExchange(&_streamingFeedbackSize, 0);
+
+    // Skip if the larger size has been already reported in this frame
+    int64 prev = Platform::AtomicRead(&_streamingFeedbackSize);
+    while (pixels > prev)
+    {
+        const int64 value = Platform::InterlockedCompareExchange(&_streamingFeedbackSize, pixels, prev);
+        if (value == prev)
+        {
+            Params.ReportStreamingFeedback(size);
+            break;
+        }
+        prev = value;
+    }
+}
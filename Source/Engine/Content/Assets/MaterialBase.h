@@ -13,6 +13,10 @@
 API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MaterialBase : public BinaryAsset, public IMaterial
 {
     DECLARE_ASSET_HEADER(MaterialBase);
+private:
+    volatile int64 _streamingFeedbackFrame = -1;
+    volatile int64 _streamingFeedbackSize = 0;
+
 public:
     /// <summary>
     /// The material parameters collection.
@@ -74,6 +78,12 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API MaterialBase : public BinaryAs
     /// <returns>The created virtual material instance asset.</returns>
     API_FUNCTION() MaterialInstance* CreateVirtualInstance();
 
+    /// <summary>
+    /// Reports the size of the geometry drawn with this material to the streaming of the used textures (see TextureGroup::UseRenderingFeedback). Only the largest size per frame gets passed to the textures. Thread-safe.
+    /// </summary>
+    /// <param name="size">The size of the geometry on the screen (in pixels).</param>
+    void ReportStreamingFeedback(float size);
+
 public:
     // [BinaryAsset]
 #if USE_EDITOR
@@ -51,6 +51,7 @@ void MaterialInstance::OnBaseSet()
         param._offset = baseParam._offset;
         param._name = baseParam._name;
     }
+    MaterialParams::InvalidateBindCache();
 
     // Params are valid
     Params._versionHash = baseParams._versionHash;
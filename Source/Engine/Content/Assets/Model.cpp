@@ -221,9 +221,24 @@ FORCE_INLINE void ModelDraw(Model* model, const RenderContext& renderContext, co
     {
         lodIndex = info.ForcedLOD;
     }
+    else if (renderContext.LodProxyView && info.DrawState->LODFrame == frame && info.DrawState->LODView == renderContext.LodProxyView)
+    {
+        // Reuse LOD selected for the proxy view in this frame (eg. shadow maps use the main view LOD, with the own view LOD bias applied later)
+        lodIndex = info.DrawState->LOD;
+    }
     else
     {
-        lodIndex = RenderTools::ComputeModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext);
+        const int32 prevLOD = info.DrawState->LODFrame + 1 >= frame ? info.DrawState->LOD : -1;
+        lodIndex = RenderTools::ComputeModelLOD(model, info.Bounds.Center, (float)info.Bounds.Radius, renderContext, prevLOD);
+        if (!renderContext.View.IsSingleFrame)
+        {
+            info.DrawState->LOD = (char)lodIndex;
+            info.DrawState->LODFrame = frame;
+            info.DrawState->LODView = renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View;
+        }
+    }
+    if (info.ForcedLOD == -1)
+    {
         if (lodIndex == -1)
         {
             // Handling model fade-out transition
@@ -624,6 +639,60 @@ bool Model::Save(bool withMeshDataFromGpu, const StringView& path)
         }
     }
 
+    // Set meshlets data
+    bool hasMeshlets = false;
+    for (const ModelLOD& lod : LODs)
+    {
+        for (const Mesh& mesh : lod.Meshes)
+            hasMeshlets |= mesh.GetMeshlets().HasItems();
+    }
+    if (hasMeshlets)
+    {
+        auto meshletsChunk = GET_CHUNK(14);
+        if (meshletsChunk == nullptr)
+            return true;
+        MemoryWriteStream meshletsStream;
+        meshletsStream.WriteInt32(1); // Version
+        for (const ModelLOD& lod : LODs)
+        {
+            for (const Mesh& mesh : lod.Meshes)
+            {
+                const auto& meshlets = mesh.GetMeshlets();
+                meshletsStream.WriteInt32(meshlets.Count());
+                meshletsStream.WriteBytes(meshlets.Get(), meshlets.Count() * sizeof(Meshlet));
+            }
+        }
+        meshletsChunk->Data.Copy(meshletsStream.GetHandle(), meshletsStream.GetPosition());
+    }
+    else if (!IsVirtual())
+    {
+        // No meshlets
+        ReleaseChunk(14);
+    }
+
+    // Set vertex compression data
+    bool hasCompressedPositions = false;
+    for (const ModelLOD& lod : LODs)
+    {
+        for (const Mesh& mesh : lod.Meshes)
+            hasCompressedPositions |= mesh.HasCompressedPositions();
+    }
+    if (hasCompressedPositions)
+    {
+        auto compressionChunk = GET_CHUNK(13);
+        if (compressionChunk == nullptr)
+            return true;
+        MemoryWriteStream compressionStream;
+        compressionStream.WriteInt32(1); // Version
+        compressionStream.WriteBool(true); // Compressed positions
+        compressionChunk->Data.Copy(compressionStream.GetHandle(), compressionStream.GetPosition());
+    }
+    else if (!IsVirtual())
+    {
+        // No vertex compression
+        ReleaseChunk(13);
+    }
+
     // Set mesh header data
     auto headerChunk = GET_CHUNK(0);
     ASSERT(headerChunk != nullptr);
@@ -816,6 +885,19 @@ int32 Model::GetAllocatedResidency() const
     return LODs.Count();
 }
 
+uint64 Model::GetMemoryUsage(int32 residency) const
+{
+    // Estimate from the LODs data size in storage
+    uint64 result = 0;
+    for (int32 lodIndex = LODs.Count() - residency; lodIndex < LODs.Count(); lodIndex++)
+    {
+        const FlaxChunk* chunk = GetChunk(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
+        if (chunk)
+            result += chunk->LocationInFile.Size;
+    }
+    return result;
+}
+
 bool Model::CanBeUpdated() const
 {
     // Check if is ready and has no streaming tasks running
@@ -965,6 +1047,62 @@ Asset::LoadResult Model::load()
         }
     }
 
+    // Load meshlets
+    auto chunk14 = GetChunk(14);
+    if (chunk14 && chunk14->IsLoaded())
+    {
+        MemoryReadStream meshletsStream(chunk14->Get(), chunk14->Size());
+        int32 version;
+        meshletsStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+        {
+            for (int32 lodIndex = 0; lodIndex < lods; lodIndex++)
+            {
+                for (Mesh& mesh : LODs[lodIndex].Meshes)
+                {
+                    int32 meshletsCount;
+                    meshletsStream.ReadInt32(&meshletsCount);
+                    const uint32 meshletsSize = meshletsCount * sizeof(Meshlet);
+                    if (meshletsCount < 0 || meshletsStream.GetLength() - meshletsStream.GetPosition() < meshletsSize)
+                        return LoadResult::InvalidData;
+                    mesh.SetMeshlets(meshletsStream.Move<Meshlet>(meshletsCount), meshletsCount);
+                }
+            }
+            break;
+        }
+        default:
+            LOG(Warning, "Unknown meshlets data version {0} in {1}", version, ToString());
+            break;
+        }
+    }
+
+    // Load vertex compression
+    auto chunk13 = GetChunk(13);
+    if (chunk13 && chunk13->IsLoaded())
+    {
+        MemoryReadStream compressionStream(chunk13->Get(), chunk13->Size());
+        int32 version;
+        compressionStream.ReadInt32(&version);
+        switch (version)
+        {
+        case 1:
+        {
+            const bool compressedPositions = compressionStream.ReadBool();
+            for (int32 lodIndex = 0; lodIndex < lods; lodIndex++)
+            {
+                for (Mesh& mesh : LODs[lodIndex].Meshes)
+                    mesh.SetCompressedPositions(compressedPositions);
+            }
+            break;
+        }
+        default:
+            LOG(Warning, "Unknown vertex compression data version {0} in {1}", version, ToString());
+            break;
+        }
+    }
+
     // Load SDF
     auto chunk15 = GetChunk(15);
     if (chunk15 && chunk15->IsLoaded() && EnableModelSDF == 1)
@@ -1065,7 +1203,7 @@ bool Model::init(AssetInitData& initData)
 AssetChunksFlag Model::getChunksToPreload() const
 {
     // Note: we don't preload any LODs here because it's done by the Streaming Manager
-    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(15);
+    return GET_CHUNK_FLAG(0) | GET_CHUNK_FLAG(13) | GET_CHUNK_FLAG(14) | GET_CHUNK_FLAG(15);
 }
 
 void ModelBase::SetupMaterialSlots(int32 slotsCount)
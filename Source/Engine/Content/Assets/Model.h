@@ -258,6 +258,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Model : public ModelBase
     int32 GetMaxResidency() const override;
     int32 GetCurrentResidency() const override;
     int32 GetAllocatedResidency() const override;
+    uint64 GetMemoryUsage(int32 residency) const override;
     bool CanBeUpdated() const override;
     Task* UpdateAllocation(int32 residency) override;
     Task* CreateStreamingTask(int32 residency) override;
@@ -14,6 +14,8 @@
 // Chunk 1: LOD0
 // Chunk 2: LOD1
 // ..
+// Chunk 13: Vertex compression
+// Chunk 14: Meshlets
 // Chunk 15: SDF
 #define MODEL_LOD_TO_CHUNK_INDEX(lod) (lod + 1)
 
@@ -1002,6 +1002,19 @@ int32 SkinnedModel::GetAllocatedResidency() const
     return LODs.Count();
 }
 
+uint64 SkinnedModel::GetMemoryUsage(int32 residency) const
+{
+    // Estimate from the LODs data size in storage
+    uint64 result = 0;
+    for (int32 lodIndex = LODs.Count() - residency; lodIndex < LODs.Count(); lodIndex++)
+    {
+        const FlaxChunk* chunk = GetChunk(MODEL_LOD_TO_CHUNK_INDEX(lodIndex));
+        if (chunk)
+            result += chunk->LocationInFile.Size;
+    }
+    return result;
+}
+
 bool SkinnedModel::CanBeUpdated() const
 {
     // Check if is ready and has no streaming tasks running
@@ -21,12 +21,24 @@
 #include "Engine/Threading/MainThreadTask.h"
 #include "FlaxEngine.Gen.h"
 
+// The pure node output value has not been evaluated yet
+#define VISUAL_SCRIPT_GRAPH_CACHE_NONE 0
+// The pure node output value depends only on constants and it's stored in the graph cache
+#define VISUAL_SCRIPT_GRAPH_CACHE_CONSTANT 1
+// The pure node output value depends only on the method parameters and it's stored in the scope cache
+#define VISUAL_SCRIPT_GRAPH_CACHE_SCOPE 2
+// The pure node output value depends on the runtime state and cannot be cached
+#define VISUAL_SCRIPT_GRAPH_CACHE_DYNAMIC 3
+// The pure node output value is being written to the graph cache by other thread
+#define VISUAL_SCRIPT_GRAPH_CACHE_WRITING 4
+
 namespace
 {
     struct VisualScriptThread
     {
         uint32 StackFramesCount;
         VisualScripting::StackFrame* Stack;
+        VisualScriptGraph::ValueDependency Dependency;
     };
 
     ThreadLocal<VisualScriptThread> ThreadStacks;
@@ -49,6 +61,68 @@ Action VisualScripting::DebugFlow;
 static_assert(TIsPODType<VisualScripting::StackFrame>::Value, "VisualScripting::StackFrame must be POD type.");
 static_assert(TIsPODType<VisualScriptThread>::Value, "VisualScriptThread must be POD type.");
 
+bool VisualScriptGraph::IsPure(const Node* node)
+{
+    switch (node->GroupID)
+    {
+    // Constants, Math, Packing, Boolean, Bitwise, Comparisons
+    case 2:
+    case 3:
+    case 4:
+    case 10:
+    case 11:
+    case 12:
+        return true;
+    default:
+        return false;
+    }
+}
+
+int32 VisualScriptGraph::GetCacheIndex(const Node* node, const Box* box) const
+{
+    const int32 nodeIndex = (int32)(node - Nodes.Get());
+    if (nodeIndex < 0 || nodeIndex >= NodesCacheOffset.Count())
+        return -1;
+    const int32 offset = NodesCacheOffset.Get()[nodeIndex];
+    return offset != -1 ? offset + box->ID : -1;
+}
+
+bool VisualScriptGraph::Load(ReadStream* stream, bool loadMeta)
+{
+    if (VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>::Load(stream, loadMeta))
+        return true;
+
+    // Setup values cache for the pure nodes outputs (skip constants as they are cheap to evaluate)
+    int32 cacheSize = 0;
+    NodesCacheOffset.Resize(Nodes.Count());
+    for (int32 i = 0; i < Nodes.Count(); i++)
+    {
+        const Node& node = Nodes[i];
+        if (IsPure(&node) && node.GroupID != 2)
+        {
+            NodesCacheOffset[i] = cacheSize;
+            cacheSize += node.Boxes.Count();
+        }
+        else
+        {
+            NodesCacheOffset[i] = -1;
+        }
+    }
+    CacheStates.Resize(cacheSize);
+    CacheStates.SetAll(VISUAL_SCRIPT_GRAPH_CACHE_NONE);
+    CacheValues.Clear();
+    CacheValues.Resize(cacheSize);
+    return false;
+}
+
+void VisualScriptGraph::Clear()
+{
+    VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>::Clear();
+    CacheStates.Resize(0);
+    CacheValues.Resize(0);
+    NodesCacheOffset.Resize(0);
+}
+
 bool VisualScriptGraph::onNodeLoaded(Node* n)
 {
     switch (n->GroupID)
@@ -129,17 +203,44 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
     if (stack.StackFramesCount >= VISUAL_SCRIPT_GRAPH_MAX_CALL_STACK)
     {
         OnError(caller, box, TEXT("Graph is looped or too deep!"));
+        stack.Dependency = VisualScriptGraph::ValueDependency::Dynamic;
         return Value::Zero;
     }
 #if !BUILD_RELEASE
     if (box == nullptr)
     {
         OnError(caller, box, TEXT("Null graph box!"));
+        stack.Dependency = VisualScriptGraph::ValueDependency::Dynamic;
         return Value::Zero;
     }
 #endif
     const auto parentNode = box->GetParent<Node>();
 
+#if VISUAL_SCRIPT_GRAPH_CACHING
+    // Use the cached value of the pure node output
+    auto& graph = stack.Stack->Script->Graph;
+    const int32 cacheIndex = graph.GetCacheIndex(parentNode, box);
+    const int32 cacheState = cacheIndex != -1 ? Platform::AtomicRead(&graph.CacheStates.Get()[cacheIndex]) : VISUAL_SCRIPT_GRAPH_CACHE_DYNAMIC;
+    if (cacheState == VISUAL_SCRIPT_GRAPH_CACHE_CONSTANT)
+    {
+        return graph.CacheValues.Get()[cacheIndex];
+    }
+    if (cacheState == VISUAL_SCRIPT_GRAPH_CACHE_SCOPE)
+    {
+        const auto scope = stack.Stack->Scope;
+        for (const auto& e : scope->CachedValues)
+        {
+            if (e.NodeId == parentNode->ID && e.BoxId == box->ID)
+            {
+                stack.Dependency = Math::Max(stack.Dependency, VisualScriptGraph::ValueDependency::Scope);
+                return e.Value;
+            }
+        }
+    }
+    const auto dependencyPrev = stack.Dependency;
+    stack.Dependency = VisualScriptGraph::ValueDependency::Constant;
+#endif
+
     // Add to the calling stack
     VisualScripting::StackFrame frame = *stack.Stack;
     frame.Node = parentNode;
@@ -162,6 +263,61 @@ VisjectExecutor::Value VisualScriptExecutor::eatBox(Node* caller, Box* box)
     stack.StackFramesCount--;
     stack.Stack = frame.PreviousFrame;
 
+#if VISUAL_SCRIPT_GRAPH_CACHING
+    // Track the value dependency (pure nodes depend on their inputs, method parameters depend on the call scope, other nodes are dynamic)
+    VisualScriptGraph::ValueDependency dependency;
+    if (VisualScriptGraph::IsPure(parentNode))
+        dependency = stack.Dependency;
+    else if (parentNode->GroupID == 16 && (parentNode->TypeID == 3 || parentNode->TypeID == 6) && box->ID != 0)
+        dependency = VisualScriptGraph::ValueDependency::Scope;
+    else
+        dependency = VisualScriptGraph::ValueDependency::Dynamic;
+    switch (value.Type.Type)
+    {
+    // Skip caching references and collections (cannot be shared between calls)
+    case VariantType::Pointer:
+    case VariantType::Object:
+    case VariantType::Asset:
+    case VariantType::Array:
+    case VariantType::Dictionary:
+    case VariantType::ManagedObject:
+        dependency = VisualScriptGraph::ValueDependency::Dynamic;
+        break;
+    default:
+        break;
+    }
+    stack.Dependency = Math::Max(dependencyPrev, dependency);
+
+    // Cache the pure node output
+    if (cacheState == VISUAL_SCRIPT_GRAPH_CACHE_NONE || cacheState == VISUAL_SCRIPT_GRAPH_CACHE_SCOPE)
+    {
+        int32* state = &graph.CacheStates.Get()[cacheIndex];
+        if (dependency == VisualScriptGraph::ValueDependency::Constant)
+        {
+            // Only a single thread writes the value and then publishes it to others
+            if (Platform::InterlockedCompareExchange(state, VISUAL_SCRIPT_GRAPH_CACHE_WRITING, VISUAL_SCRIPT_GRAPH_CACHE_NONE) == VISUAL_SCRIPT_GRAPH_CACHE_NONE)
+            {
+                graph.CacheValues.Get()[cacheIndex] = value;
+                Platform::AtomicStore(state, VISUAL_SCRIPT_GRAPH_CACHE_CONSTANT);
+            }
+        }
+        else if (dependency == VisualScriptGraph::ValueDependency::Scope)
+        {
+            auto& e = stack.Stack->Scope->CachedValues.AddOne();
+            e.NodeId = parentNode->ID;
+            e.BoxId = box->ID;
+            e.Value = value;
+            if (cacheState == VISUAL_SCRIPT_GRAPH_CACHE_NONE)
+                Platform::InterlockedCompareExchange(state, VISUAL_SCRIPT_GRAPH_CACHE_SCOPE, VISUAL_SCRIPT_GRAPH_CACHE_NONE);
+        }
+        else
+        {
+            // Value depends on the runtime state (eg. via the branch of Switch On Bool node taken by this call) so disable caching
+            Platform::AtomicStore(state, VISUAL_SCRIPT_GRAPH_CACHE_DYNAMIC);
+        }
+    }
+#endif
+
     return value;
 }
 
@@ -11,6 +11,7 @@
 
 #define VISUAL_SCRIPT_GRAPH_MAX_CALL_STACK 250
 #define VISUAL_SCRIPT_DEBUGGING USE_EDITOR
+#define VISUAL_SCRIPT_GRAPH_CACHING 1
 
 #define VisualScriptGraphNode VisjectGraphNode<>
 
@@ -23,6 +24,54 @@ class VisualScriptingBinaryModule;
 class VisualScriptGraph : public VisjectGraph<VisualScriptGraphNode, VisjectGraphBox, VisjectGraphParameter>
 {
 public:
+    /// <summary>
+    /// The evaluation dependency of the node output value (ordered from the most to the least cacheable).
+    /// </summary>
+    enum class ValueDependency : byte
+    {
+        // Value depends only on constants so it can be evaluated once and reused by all calls.
+        Constant = 0,
+        // Value depends only on the method parameters so it can be evaluated once per method call.
+        Scope = 1,
+        // Value depends on the runtime state and has to be evaluated every time.
+        Dynamic = 2,
+    };
+
+    /// <summary>
+    /// The cached values state of the pure nodes outputs (not evaluated, constant, scope or dynamic). Indexed by the node cache offset plus the box id.
+    /// </summary>
+    Array<int32> CacheStates;
+
+    /// <summary>
+    /// The cached values of the pure nodes outputs that depend only on constants (folded after the first evaluation).
+    /// </summary>
+    Array<Variant> CacheValues;
+
+    /// <summary>
+    /// The offset of the node outputs in the cache for each graph node (-1 if node values are not cached).
+    /// </summary>
+    Array<int32> NodesCacheOffset;
+
+public:
+    /// <summary>
+    /// Checks if the node is pure (its output values depend only on its inputs and the node data, without any side effects).
+    /// </summary>
+    /// <param name="node">The node.</param>
+    /// <returns>True if node is pure, otherwise false.</returns>
+    static bool IsPure(const Node* node);
+
+    /// <summary>
+    /// Gets the index of the node output value in the cache.
+    /// </summary>
+    /// <param name="node">The node.</param>
+    /// <param name="box">The node output box.</param>
+    /// <returns>The cache index or -1 if node value is not cached.</returns>
+    int32 GetCacheIndex(const Node* node, const Box* box) const;
+
+public:
+    // [VisjectGraph]
+    bool Load(ReadStream* stream, bool loadMeta) override;
+    void Clear() override;
     bool onNodeLoaded(Node* n) override;
 };
 
@@ -367,6 +416,8 @@ class FLAXENGINE_API VisualScripting
         Array<NodeBoxValue, InlinedAllocation<16>> ReturnedValues;
         // Function result to return
         Variant FunctionReturn;
+        // Pure nodes values cached within the scope (values that depend only on the method input parameters)
+        Array<NodeBoxValue, InlinedAllocation<8>> CachedValues;
     };
 
     struct StackFrame
@@ -286,6 +286,8 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
         return false;
 
     // Load all missing marked chunks
+    FlaxChunk* toLoad[ASSET_FILE_DATA_CHUNKS];
+    int32 toLoadCount = 0;
     for (int32 i = 0; i < ASSET_FILE_DATA_CHUNKS; i++)
     {
         auto chunk = _header.Chunks[i];
@@ -294,12 +296,11 @@ bool BinaryAsset::LoadChunks(AssetChunksFlag chunks)
             && chunk->IsMissing()
             && chunk->ExistsInFile())
         {
-            if (Storage->LoadAssetChunk(chunk))
-                return true;
+            toLoad[toLoadCount++] = chunk;
         }
     }
 
-    return false;
+    return Storage->LoadAssetChunks(toLoad, toLoadCount);
 }
 
 #if USE_EDITOR
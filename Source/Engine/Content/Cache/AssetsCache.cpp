@@ -2,13 +2,13 @@
 
 #include "AssetsCache.h"
 #include "Engine/Core/Log.h"
-#include "Engine/Core/DeleteMe.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Types/DateTime.h"
 #include "Engine/Core/Types/Stopwatch.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Serialization/FileWriteStream.h"
-#include "Engine/Serialization/FileReadStream.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Storage/ContentStorageManager.h"
 #include "Engine/Content/Storage/JsonStorageProxy.h"
@@ -17,10 +17,155 @@
 #include "Engine/Engine/Globals.h"
 #include "FlaxEngine.Gen.h"
 
+namespace
+{
+    // Registry file layout: [FileHeader][FileEntry x EntriesCount][FileMapping x MappingsCount][FilePath x PathsCount][Char x CharsCount]
+    // All structures are 4-byte aligned so the file data can be accessed directly after memory-mapping.
+#define ASSETS_CACHE_MAGIC 0x32434146 // FAC2
+
+    PACK_STRUCT(struct FileString {
+        // Offset (in characters) within the strings table
+        uint32 Offset;
+        int32 Length;
+        });
+
+    PACK_STRUCT(struct FileHeader {
+        int32 Version;
+        uint32 Magic;
+        int32 Flags;
+        int32 EntriesCount;
+        int32 MappingsCount;
+        int32 PathsCount;
+        int32 CharsCount;
+        int32 Dummy0;
+        FileString EnginePath;
+        FileString ProjectPath;
+        });
+
+    // Asset entry (sorted by ID)
+    PACK_STRUCT(struct FileEntry {
+        Guid ID;
+        FileString TypeName;
+        FileString Path;
+        int64 FileModified;
+        });
+
+    // Asset path mapping
+    PACK_STRUCT(struct FileMapping {
+        Guid ID;
+        FileString Path;
+        });
+
+    // Path hash index item (sorted by hash), index points to the entry or to the mapping (if larger or equal than entries count)
+    PACK_STRUCT(struct FilePath {
+        uint32 Hash;
+        int32 Index;
+        });
+
+    struct FileView
+    {
+        const FileHeader* Header;
+        const FileEntry* Entries;
+        const FileMapping* Mappings;
+        const FilePath* Paths;
+        const Char* Chars;
+
+        FileView(const BytesContainer& data)
+        {
+            Header = (const FileHeader*)data.Get();
+            Entries = (const FileEntry*)(Header + 1);
+            Mappings = (const FileMapping*)(Entries + Header->EntriesCount);
+            Paths = (const FilePath*)(Mappings + Header->MappingsCount);
+            Chars = (const Char*)(Paths + Header->PathsCount);
+        }
+
+        StringView Get(const FileString& str) const
+        {
+            return StringView(Chars + str.Offset, str.Length);
+        }
+    };
+
+    bool IsValidFile(const BytesContainer& data)
+    {
+        if (data.Length() < sizeof(FileHeader))
+            return false;
+        const FileHeader* header = (const FileHeader*)data.Get();
+        if (header->Magic != ASSETS_CACHE_MAGIC || header->EntriesCount < 0 || header->MappingsCount < 0 || header->PathsCount < 0 || header->CharsCount < 0)
+            return false;
+        const uint64 size = sizeof(FileHeader) + (uint64)header->EntriesCount * sizeof(FileEntry) + (uint64)header->MappingsCount * sizeof(FileMapping) + (uint64)header->PathsCount * sizeof(FilePath) + (uint64)header->CharsCount * sizeof(Char);
+        return size == (uint64)data.Length();
+    }
+
+    int32 CompareGuid(const Guid& a, const Guid& b)
+    {
+        if (a.A != b.A)
+            return a.A < b.A ? -1 : 1;
+        if (a.B != b.B)
+            return a.B < b.B ? -1 : 1;
+        if (a.C != b.C)
+            return a.C < b.C ? -1 : 1;
+        if (a.D != b.D)
+            return a.D < b.D ? -1 : 1;
+        return 0;
+    }
+
+    bool SortEntriesById(const FileEntry& a, const FileEntry& b)
+    {
+        return CompareGuid(a.ID, b.ID) < 0;
+    }
+
+    bool SortPathsByHash(const FilePath& a, const FilePath& b)
+    {
+        return a.Hash < b.Hash || (a.Hash == b.Hash && a.Index < b.Index);
+    }
+
+    // Converts the path into the format stored in the registry file (relative to the startup folder if used)
+    StringView ToFilePath(const StringView& path, AssetsCacheFlags flags)
+    {
+        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths))
+        {
+            const String& startupFolder = Globals::StartupFolder;
+            if (path.Length() > startupFolder.Length() && path[startupFolder.Length()] == '/' && StringView(path.Get(), startupFolder.Length()) == startupFolder)
+                return StringView(path.Get() + startupFolder.Length() + 1, path.Length() - startupFolder.Length() - 1);
+        }
+        return path;
+    }
+
+    // Converts the path from the format stored in the registry file
+    String FromFilePath(const StringView& path, AssetsCacheFlags flags)
+    {
+        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && path.HasChars())
+            return Globals::StartupFolder / path;
+        return String(path);
+    }
+
+    struct FileStrings
+    {
+        Array<Char> Chars;
+        Dictionary<String, FileString> Cache;
+
+        FileString Add(const String& str)
+        {
+            FileString result;
+            if (!Cache.TryGet(str, result))
+            {
+                result.Offset = Chars.Count();
+                result.Length = str.Length();
+                Chars.Add(str.Get(), str.Length());
+                Cache.Add(str, result);
+            }
+            return result;
+        }
+    };
+}
+
+AssetsCache::~AssetsCache()
+{
+    ReleaseFile();
+}
+
 void AssetsCache::Init()
 {
-    Entry e;
-    int32 count;
     Stopwatch stopwatch;
 #if USE_EDITOR
     _path = Globals::ProjectCacheFolder / TEXT("AssetsCache.dat");
@@ -37,68 +182,98 @@ void AssetsCache::Init()
         return;
     }
 
-    // Open file
-    FileReadStream* stream = FileReadStream::Open(_path);
-    DeleteMe<FileReadStream> deleteStream(stream);
+    ScopeLock lock(_locker);
+    ReleaseFile();
+    _registry.Clear();
+    _pathsMapping.Clear();
 
-    // Load version
-    int32 version;
-    stream->ReadInt32(&version);
-    if (version != FLAXENGINE_VERSION_BUILD)
+    // Map file into memory (fallback to reading the whole file)
+    auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+    if (file)
     {
-        LOG(Warning, "Corrupted or not supported Asset Cache file. Version: {0}", version);
+        uint32 mappedSize;
+        byte* mappedData = file->MapView(mappedSize);
+        if (mappedData)
+            _file.Link(mappedData, (int32)mappedSize);
+        Delete(file);
+    }
+    if (!_file.IsValid() && File::ReadAllBytes(_path, _file))
+    {
+        _isDirty = true;
+        LOG(Warning, "Cannot read assets cache file");
         return;
     }
 
-    // Load paths
-    String enginePath, projectPath;
-    stream->ReadString(&enginePath, -410);
-    stream->ReadString(&projectPath, -410);
-
-    // Flags
-    AssetsCacheFlags flags;
-    stream->ReadInt32((int32*)&flags);
+    // Load version
+    if (_file.Length() < sizeof(int32) || *(const int32*)_file.Get() != FLAXENGINE_VERSION_BUILD)
+    {
+        LOG(Warning, "Corrupted or not supported Asset Cache file. Version: {0}", _file.Length() < sizeof(int32) ? 0 : *(const int32*)_file.Get());
+        ReleaseFile();
+        return;
+    }
+    if (!IsValidFile(_file))
+    {
+        ReleaseFile();
+        _isDirty = true;
+        LOG(Warning, "Asset Cache file has an error. Removing it.");
+        if (FileSystem::DeleteFile(_path))
+        {
+            LOG(Error, "Cannot delete registry file after reading error.");
+        }
+        return;
+    }
+    const FileView view(_file);
+    _fileFlags = (AssetsCacheFlags)view.Header->Flags;
+    _fileEntriesCount = view.Header->EntriesCount;
 
     // Check if other workspace instance used this cache
-    if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && enginePath != Globals::StartupFolder)
+    if (EnumHasNoneFlags(_fileFlags, AssetsCacheFlags::RelativePaths) && view.Get(view.Header->EnginePath) != Globals::StartupFolder)
     {
-        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", enginePath, TEXT("engine"));
+        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", view.Get(view.Header->EnginePath), TEXT("engine"));
+        ReleaseFile();
         return;
     }
-    if (EnumHasNoneFlags(flags, AssetsCacheFlags::RelativePaths) && projectPath != Globals::ProjectFolder)
+    if (EnumHasNoneFlags(_fileFlags, AssetsCacheFlags::RelativePaths) && view.Get(view.Header->ProjectPath) != Globals::ProjectFolder)
     {
-        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", projectPath, TEXT("project"));
+        LOG(Warning, "Assets cache generated by the different {1} installation in \'{0}\'", view.Get(view.Header->ProjectPath), TEXT("project"));
+        ReleaseFile();
         return;
     }
-
-    ScopeLock lock(_locker);
     _isDirty = false;
 
-    // Load elements count
-    stream->ReadInt32(&count);
-    _registry.Clear();
-    _registry.EnsureCapacity(count);
+#if USE_EDITOR
+    // Editor validates and modifies the registry so load it all
+    LoadAll();
+#else
+    stopwatch.Stop();
+    LOG(Info, "Asset Cache mapped {0} entries in {1}ms", _fileEntriesCount, stopwatch.GetMilliseconds());
+#endif
+}
 
-    // Load data
+void AssetsCache::LoadAll()
+{
+    if (!_file.IsValid())
+        return;
+    PROFILE_CPU();
+    Stopwatch stopwatch;
+    ScopeLock lock(_locker);
+    const FileView view(_file);
+
+    // Load entries
+    Entry e;
     int32 rejectedCount = 0;
-    for (int32 i = 0; i < count; i++)
+    _registry.Clear();
+    _registry.EnsureCapacity(view.Header->EntriesCount);
+    for (int32 i = 0; i < view.Header->EntriesCount; i++)
     {
-        stream->Read(e.Info.ID);
-        stream->ReadString(&e.Info.TypeName, i - 13);
-        stream->ReadString(&e.Info.Path, i);
+        const FileEntry& fileEntry = view.Entries[i];
+        e.Info.ID = fileEntry.ID;
+        e.Info.TypeName = view.Get(fileEntry.TypeName);
+        e.Info.Path = FromFilePath(view.Get(fileEntry.Path), _fileFlags);
 #if ENABLE_ASSETS_DISCOVERY
-        stream->Read(e.FileModified);
-#else
-        DateTime tmp1;
-        stream->Read(tmp1);
+        e.FileModified = DateTime(fileEntry.FileModified);
 #endif
 
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && e.Info.Path.HasChars())
-        {
-            // Convert to absolute path
-            e.Info.Path = Globals::StartupFolder / e.Info.Path;
-        }
-
         // Use only valid entries
         if (IsEntryValid(e))
             _registry.Add(e.Info.ID, e);
@@ -107,41 +282,96 @@ void AssetsCache::Init()
     }
 
     // Paths mapping
-    stream->ReadInt32(&count);
     _pathsMapping.Clear();
-    _pathsMapping.EnsureCapacity(count);
-    for (int32 i = 0; i < count; i++)
+    _pathsMapping.EnsureCapacity(view.Header->MappingsCount);
+    for (int32 i = 0; i < view.Header->MappingsCount; i++)
     {
-        Guid id;
-        stream->Read(id);
-        String mappedPath;
-        stream->ReadString(&mappedPath, i + 73);
+        const FileMapping& mapping = view.Mappings[i];
+        _pathsMapping.Add(FromFilePath(view.Get(mapping.Path), _fileFlags), mapping.ID);
+    }
+
+    ReleaseFile();
+    stopwatch.Stop();
+    LOG(Info, "Asset Cache loaded {0} entries in {1}ms ({2} rejected)", _registry.Count(), stopwatch.GetMilliseconds(), rejectedCount);
+}
+
+void AssetsCache::ReleaseFile()
+{
+    if (_file.IsValid() && !_file.IsAllocated())
+        File::UnmapView((byte*)_file.Get(), (uint32)_file.Length());
+    _file.Release();
+    _fileEntriesCount = 0;
+}
 
-        if (EnumHasAnyFlags(flags, AssetsCacheFlags::RelativePaths) && mappedPath.HasChars())
+bool AssetsCache::FindFileAsset(const Guid& id, AssetInfo& info) const
+{
+    const FileView view(_file);
+
+    // Binary search in entries sorted by ID
+    int32 left = 0, right = view.Header->EntriesCount - 1;
+    while (left <= right)
+    {
+        const int32 middle = left + (right - left) / 2;
+        const FileEntry& e = view.Entries[middle];
+        const int32 compare = CompareGuid(e.ID, id);
+        if (compare == 0)
         {
-            // Convert to absolute path
-            mappedPath = Globals::StartupFolder / mappedPath;
+            if (e.Path.Length == 0)
+                return false;
+            info.ID = e.ID;
+            info.TypeName = view.Get(e.TypeName);
+            info.Path = FromFilePath(view.Get(e.Path), _fileFlags);
+            return true;
         }
+        if (compare < 0)
+            left = middle + 1;
+        else
+            right = middle - 1;
+    }
+    return false;
+}
+
+bool AssetsCache::FindFilePath(const StringView& path, Guid& id) const
+{
+    const FileView view(_file);
+    const StringView filePath = ToFilePath(path, _fileFlags);
+    const uint32 hash = GetHash(filePath);
 
-        _pathsMapping.Add(mappedPath, id);
+    // Binary search for the first path with a given hash
+    int32 left = 0, right = view.Header->PathsCount;
+    while (left < right)
+    {
+        const int32 middle = left + (right - left) / 2;
+        if (view.Paths[middle].Hash < hash)
+            left = middle + 1;
+        else
+            right = middle;
     }
 
-    // Check errors
-    const bool hasError = stream->HasError();
-    deleteStream.Delete();
-    if (hasError)
+    // Check all paths with the same hash (mappings are after entries so direct entries go first)
+    for (; left < view.Header->PathsCount && view.Paths[left].Hash == hash; left++)
     {
-        _isDirty = true;
-        _registry.Clear();
-        LOG(Warning, "Asset Cache file has an error. Removing it.");
-        if (FileSystem::DeleteFile(_path))
+        const int32 index = view.Paths[left].Index;
+        if (index < view.Header->EntriesCount)
         {
-            LOG(Error, "Cannot delete registry file after reading error.");
+            const FileEntry& e = view.Entries[index];
+            if (view.Get(e.Path) == filePath)
+            {
+                id = e.ID;
+                return true;
+            }
+        }
+        else
+        {
+            const FileMapping& mapping = view.Mappings[index - view.Header->EntriesCount];
+            if (view.Get(mapping.Path) == filePath)
+            {
+                id = mapping.ID;
+                return true;
+            }
         }
     }
-
-    stopwatch.Stop();
-    LOG(Info, "Asset Cache loaded {0} entries in {1}ms ({2} rejected)", _registry.Count(), stopwatch.GetMilliseconds(), rejectedCount);
+    return false;
 }
 
 bool AssetsCache::Save()
@@ -154,6 +384,7 @@ bool AssetsCache::Save()
         return false;
 
     ScopeLock lock(_locker);
+    LoadAll();
 
     if (Save(_path, _registry, _pathsMapping))
         return true;
@@ -171,49 +402,64 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
 
     LOG(Info, "Saving assets cache to \'{0}\', entries: {1}", path, entries.Count());
 
-    // Open file
-    auto stream = FileWriteStream::Open(path);
-    if (stream == nullptr)
-        return true;
-
-    // Version
-    stream->WriteInt32(FLAXENGINE_VERSION_BUILD);
-
-    // Paths
-    stream->WriteString(Globals::StartupFolder, -410);
-    stream->WriteString(Globals::ProjectFolder, -410);
-
-    // Flags
-    stream->WriteInt32((int32)flags);
-
-    // Items count
-    stream->WriteInt32(entries.Count());
-
-    // Data
+    // Build the registry data
+    FileStrings strings;
+    FileHeader header;
+    Platform::MemoryClear(&header, sizeof(header));
+    header.Version = FLAXENGINE_VERSION_BUILD;
+    header.Magic = ASSETS_CACHE_MAGIC;
+    header.Flags = (int32)flags;
+    header.EnginePath = strings.Add(Globals::StartupFolder);
+    header.ProjectPath = strings.Add(Globals::ProjectFolder);
+    Array<FileEntry> fileEntries;
+    fileEntries.Resize(entries.Count());
     int32 index = 0;
     for (auto i = entries.Begin(); i.IsNotEnd(); ++i)
     {
         auto& e = i->Value;
-        stream->Write(e.Info.ID);
-        stream->WriteString(e.Info.TypeName, index - 13);
-        stream->WriteString(e.Info.Path, index);
+        FileEntry& fileEntry = fileEntries[index++];
+        fileEntry.ID = e.Info.ID;
+        fileEntry.TypeName = strings.Add(e.Info.TypeName);
+        fileEntry.Path = strings.Add(e.Info.Path);
 #if ENABLE_ASSETS_DISCOVERY
-        stream->Write(e.FileModified);
+        fileEntry.FileModified = e.FileModified.Ticks;
 #else
-        stream->WriteInt64(0);
+        fileEntry.FileModified = 0;
 #endif
-        index++;
     }
-
-    // Paths mapping
+    Sorting::QuickSort(fileEntries.Get(), fileEntries.Count(), &SortEntriesById);
+    Array<FileMapping> fileMappings;
+    fileMappings.Resize(pathsMapping.Count());
     index = 0;
-    stream->WriteInt32(pathsMapping.Count());
     for (auto i = pathsMapping.Begin(); i.IsNotEnd(); ++i)
     {
-        stream->Write(i->Value);
-        stream->WriteString(i->Key, index + 73);
-        index++;
+        FileMapping& mapping = fileMappings[index++];
+        mapping.ID = i->Value;
+        mapping.Path = strings.Add(i->Key);
     }
+    Array<FilePath> filePaths;
+    filePaths.Resize(fileEntries.Count() + fileMappings.Count());
+    for (int32 i = 0; i < fileEntries.Count(); i++)
+        filePaths[i] = { GetHash(StringView(strings.Chars.Get() + fileEntries[i].Path.Offset, fileEntries[i].Path.Length)), i };
+    for (int32 i = 0; i < fileMappings.Count(); i++)
+        filePaths[fileEntries.Count() + i] = { GetHash(StringView(strings.Chars.Get() + fileMappings[i].Path.Offset, fileMappings[i].Path.Length)), fileEntries.Count() + i };
+    Sorting::QuickSort(filePaths.Get(), filePaths.Count(), &SortPathsByHash);
+    header.EntriesCount = fileEntries.Count();
+    header.MappingsCount = fileMappings.Count();
+    header.PathsCount = filePaths.Count();
+    header.CharsCount = strings.Chars.Count();
+
+    // Open file
+    auto stream = FileWriteStream::Open(path);
+    if (stream == nullptr)
+        return true;
+
+    // Write data
+    stream->WriteBytes(&header, sizeof(header));
+    stream->WriteBytes(fileEntries.Get(), fileEntries.Count() * sizeof(FileEntry));
+    stream->WriteBytes(fileMappings.Get(), fileMappings.Count() * sizeof(FileMapping));
+    stream->WriteBytes(filePaths.Get(), filePaths.Count() * sizeof(FilePath));
+    stream->WriteBytes(strings.Chars.Get(), strings.Chars.Count() * sizeof(Char));
 
     // Cleanup
     stream->Flush();
@@ -225,6 +471,7 @@ bool AssetsCache::Save(const StringView& path, const Registry& entries, const Pa
 const String& AssetsCache::GetEditorAssetPath(const Guid& id) const
 {
     ScopeLock lock(_locker);
+    const_cast<AssetsCache*>(this)->LoadAll();
 #if USE_EDITOR
     auto e = _registry.TryGet(id);
     return e ? e->Info.Path : String::Empty;
@@ -246,8 +493,20 @@ bool AssetsCache::FindAsset(const StringView& path, AssetInfo& info)
 
     ScopeLock lock(_locker);
 
-    // Check if asset has direct mapping to id (used for some cooked assets)
+    // Lookup in the registry file
     Guid id;
+    if (_file.IsValid())
+    {
+        if (FindFilePath(path, id))
+            return FindAsset(id, info);
+#if !USE_EDITOR
+        if (FileSystem::IsRelative(path) && FindFilePath(Globals::ProjectFolder / *path, id))
+            return FindAsset(id, info);
+#endif
+        return false;
+    }
+
+    // Check if asset has direct mapping to id (used for some cooked assets)
     if (_pathsMapping.TryGet(path, id))
     {
         return FindAsset(id, info);
@@ -294,6 +553,8 @@ bool AssetsCache::FindAsset(const Guid& id, AssetInfo& info)
     PROFILE_CPU();
     bool result = false;
     ScopeLock lock(_locker);
+    if (_file.IsValid())
+        return FindFileAsset(id, info);
     auto e = _registry.TryGet(id);
     if (e != nullptr)
     {
@@ -316,6 +577,7 @@ void AssetsCache::GetAll(Array<Guid>& result) const
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    const_cast<AssetsCache*>(this)->LoadAll();
     _registry.GetKeys(result);
 }
 
@@ -323,6 +585,7 @@ void AssetsCache::GetAllByTypeName(const StringView& typeName, Array<Guid>& resu
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    const_cast<AssetsCache*>(this)->LoadAll();
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
         if (i->Value.Info.TypeName == typeName)
@@ -342,6 +605,7 @@ void AssetsCache::RegisterAssets(FlaxStorage* storage)
     ASSERT(entries.HasItems());
 
     ScopeLock lock(_locker);
+    LoadAll();
     auto storagePath = storage->GetPath();
 
     // Remove all old entries from that location
@@ -440,6 +704,7 @@ void AssetsCache::RegisterAsset(const Guid& id, const String& typeName, const St
 {
     PROFILE_CPU();
     ScopeLock lock(_locker);
+    LoadAll();
 
     // Check if asset has been already added to the registry
     bool isMissing = true;
@@ -492,6 +757,7 @@ bool AssetsCache::DeleteAsset(const StringView& path, AssetInfo* info)
 {
     bool result = false;
     _locker.Lock();
+    LoadAll();
 
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
@@ -514,6 +780,7 @@ bool AssetsCache::DeleteAsset(const Guid& id, AssetInfo* info)
 {
     bool result = false;
     _locker.Lock();
+    LoadAll();
 
     const auto e = _registry.TryGet(id);
     if (e != nullptr)
@@ -533,6 +800,7 @@ bool AssetsCache::RenameAsset(const StringView& oldPath, const StringView& newPa
 {
     bool result = false;
     _locker.Lock();
+    LoadAll();
 
     for (auto i = _registry.Begin(); i.IsNotEnd(); ++i)
     {
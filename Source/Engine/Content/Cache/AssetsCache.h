@@ -9,6 +9,7 @@
 #include "Engine/Core/Types/DateTime.h"
 #endif
 #include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Platform/CriticalSection.h"
 
@@ -35,8 +36,11 @@ enum class AssetsCacheFlags
 DECLARE_ENUM_OPERATORS(AssetsCacheFlags);
 
 /// <summary>
-/// Flax Game Engine assets cache container
+/// Flax Game Engine assets cache container.
 /// </summary>
+/// <remarks>
+/// The registry file uses a compact binary format with entries sorted by ID and a paths hash index. At runtime the file is memory-mapped and the lookups are done in-place without deserializing the whole registry (it gets loaded on the first modification or enumeration).
+/// </remarks>
 class FLAXENGINE_API AssetsCache
 {
 public:
@@ -79,15 +83,23 @@ class FLAXENGINE_API AssetsCache
     Registry _registry;
     PathsMapping _pathsMapping;
     String _path;
+    BytesContainer _file;
+    int32 _fileEntriesCount = 0;
+    AssetsCacheFlags _fileFlags = AssetsCacheFlags::None;
 
 public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="AssetsCache"/> class.
+    /// </summary>
+    ~AssetsCache();
+
     /// <summary>
     /// Gets amount of registered assets.
     /// </summary>
     int32 Size() const
     {
         _locker.Lock();
-        const int32 result = _registry.Count();
+        const int32 result = _file.IsValid() ? _fileEntriesCount : _registry.Count();
         _locker.Unlock();
         return result;
     }
@@ -230,4 +242,10 @@ class FLAXENGINE_API AssetsCache
     /// <param name="e">The asset entry.</param>
     /// <returns>True if is valid, otherwise false.</returns>
     bool IsEntryValid(Entry& e);
+
+private:
+    void LoadAll();
+    void ReleaseFile();
+    bool FindFileAsset(const Guid& id, AssetInfo& info) const;
+    bool FindFilePath(const StringView& path, Guid& id) const;
 };
@@ -10,6 +10,15 @@
 // Enable/disable additional assets metadata verification, note: we should disable it for release builds
 #define ASSETS_LOADING_EXTRA_VERIFICATION (BUILD_DEBUG || USE_EDITOR)
 
+// Enables memory-mapping of the packages in shipping builds (chunks data is read directly from the mapped file instead of per-thread file streams)
+#define ASSETS_STORAGE_MEMORY_MAPPING (BUILD_RELEASE && PLATFORM_64BITS)
+
+// Size of the independently compressed blocks of the large chunks (decompressed in parallel when loading)
+#define ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE (1024 * 1024)
+
+// Minimum size of the chunk to be compressed in blocks
+#define ASSETS_STORAGE_COMPRESSION_BLOCKS_MIN_SIZE (4 * ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE)
+
 // Maximum amount of data chunks used by the single asset
 #define ASSET_FILE_DATA_CHUNKS 16
 
@@ -3,6 +3,7 @@
 #include "Content.h"
 #include "JsonAsset.h"
 #include "SceneReference.h"
+#include "Assets/ModelBase.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Cache/AssetsCache.h"
 #include "Storage/ContentStorageManager.h"
@@ -12,11 +13,14 @@
 #include "Engine/Core/LogContext.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/MemoryStats.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/MainThreadTask.h"
 #include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/Textures/TextureBase.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Level/Types.h"
@@ -33,6 +37,8 @@
 
 TimeSpan Content::AssetsUpdateInterval = TimeSpan::FromMilliseconds(500);
 TimeSpan Content::AssetsUnloadInterval = TimeSpan::FromSeconds(10);
+uint64 Content::AssetsCacheBudget = 0;
+float Content::AssetsCacheMemoryPressure = 0.9f;
 Delegate<Asset*> Content::AssetDisposing;
 Delegate<Asset*> Content::AssetReloading;
 
@@ -69,6 +75,43 @@ namespace
     TimeSpan LastUnloadCheckTime(0);
     bool IsExiting = false;
 
+    // Assets cache
+    struct CacheEntry
+    {
+        Asset* Item;
+        TimeSpan UnreferencedTime;
+
+        bool operator<(const CacheEntry& other) const
+        {
+            // Most recently unreferenced assets go first
+            return UnreferencedTime > other.UnreferencedTime;
+        }
+    };
+
+    struct CacheBudget
+    {
+        ScriptingTypeHandle Type;
+        uint64 Budget;
+        uint64 Used;
+    };
+
+    Array<CacheEntry> CacheEntries;
+    Array<CacheBudget> CacheBudgets;
+
+    // Gets the memory kept by the cached asset (including the GPU memory of the streamed textures and models data)
+    uint64 GetCacheMemoryUsage(Asset* asset)
+    {
+        uint64 result = asset->GetMemoryUsage();
+        const StreamableResource* resource = nullptr;
+        if (const auto texture = ScriptingObject::Cast<TextureBase>(asset))
+            resource = texture->StreamingTexture();
+        else if (const auto model = ScriptingObject::Cast<ModelBase>(asset))
+            resource = model;
+        if (resource)
+            result += resource->GetMemoryUsage(resource->GetCurrentResidency());
+        return result;
+    }
+
 #if ENABLE_ASSETS_DISCOVERY
     DateTime LastWorkspaceDiscovery;
     CriticalSection WorkspaceDiscoveryLocker;
@@ -117,6 +160,58 @@ void ContentService::Update()
     }
 }
 
+// Called under AssetsLocker
+void UpdateAssetsCache()
+{
+    PROFILE_CPU();
+
+    // Copy budgets once per update (changes made meanwhile by the other threads are used by the next update)
+    const uint64 defaultBudget = Content::AssetsCacheBudget;
+    Array<CacheBudget, InlinedAllocation<16>> budgets;
+    budgets.Set(CacheBudgets.Get(), CacheBudgets.Count());
+
+    // Evict all cached assets when caching is disabled or when running low on memory
+    bool evictAll = defaultBudget == 0 && budgets.IsEmpty();
+    if (!evictAll)
+    {
+        const MemoryStats memoryStats = Platform::GetMemoryStats();
+        evictAll = memoryStats.TotalPhysicalMemory != 0 && (float)((double)memoryStats.UsedPhysicalMemory / (double)memoryStats.TotalPhysicalMemory) >= Content::AssetsCacheMemoryPressure;
+    }
+    if (evictAll)
+    {
+        for (const CacheEntry& e : CacheEntries)
+            ToUnload.Add(e.Item);
+        return;
+    }
+
+    // Evict the least recently used assets that don't fit into the budget
+    Sorting::QuickSort(CacheEntries);
+    uint64 used = 0;
+    for (CacheBudget& e : budgets)
+        e.Used = 0;
+    for (const CacheEntry& e : CacheEntries)
+    {
+        const ScriptingTypeHandle type = e.Item->GetTypeHandle();
+        uint64 budget = defaultBudget;
+        uint64* budgetUsed = &used;
+        for (CacheBudget& b : budgets)
+        {
+            if (b.Type == type || type.IsSubclassOf(b.Type))
+            {
+                budget = b.Budget;
+                budgetUsed = &b.Used;
+                if (b.Type == type)
+                    break;
+            }
+        }
+        const uint64 memoryUsage = GetCacheMemoryUsage(e.Item);
+        if (*budgetUsed + memoryUsage <= budget)
+            *budgetUsed += memoryUsage;
+        else
+            ToUnload.Add(e.Item);
+    }
+}
+
 void ContentService::LateUpdate()
 {
     PROFILE_CPU();
@@ -143,15 +238,24 @@ void ContentService::LateUpdate()
 
     // Find assets to unload in unload queue
     ToUnload.Clear();
+    CacheEntries.Clear();
     for (auto i = UnloadQueue.Begin(); i != UnloadQueue.End(); ++i)
     {
         // Check if asset gain any new reference or if need to unload it
-        if (i->Key->GetReferencesCount() > 0 || timeNow - i->Value >= Content::AssetsUnloadInterval)
+        if (i->Key->GetReferencesCount() > 0)
         {
             ToUnload.Add(i->Key);
         }
+        else if (timeNow - i->Value >= Content::AssetsUnloadInterval)
+        {
+            CacheEntries.Add({ i->Key, i->Value });
+        }
     }
 
+    // Keep the most recently unreferenced assets loaded within the cache budgets
+    if (CacheEntries.HasItems())
+        UpdateAssetsCache();
+
     // Unload marked assets
     for (int32 i = 0; i < ToUnload.Count(); i++)
     {
@@ -908,6 +1012,33 @@ void Content::onAssetLoaded(Asset* asset)
     LoadedAssetsToInvoke.Add(asset);
 }
 
+void Content::SetAssetsCacheBudget(const ScriptingTypeHandle& type, uint64 budget)
+{
+    ScopeLock locker(AssetsLocker);
+    for (CacheBudget& e : CacheBudgets)
+    {
+        if (e.Type == type)
+        {
+            e.Budget = budget;
+            return;
+        }
+    }
+    CacheBudgets.Add({ type, budget, 0 });
+}
+
+void Content::ClearAssetsCacheBudget(const ScriptingTypeHandle& type)
+{
+    ScopeLock locker(AssetsLocker);
+    for (int32 i = 0; i < CacheBudgets.Count(); i++)
+    {
+        if (CacheBudgets[i].Type == type)
+        {
+            CacheBudgets.RemoveAt(i);
+            break;
+        }
+    }
+}
+
 void Content::onAssetUnload(Asset* asset)
 {
     // This is called by the asset on unloading
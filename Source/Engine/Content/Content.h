@@ -46,6 +46,29 @@ API_CLASS(Static) class FLAXENGINE_API Content
     /// </summary>
     static TimeSpan AssetsUnloadInterval;
 
+    /// <summary>
+    /// The memory budget (in bytes) of the assets cache. Assets with no references are kept loaded after the unload interval (most recently used first) until they exceed the budget, so content reused soon (eg. when going back to the previous level area) doesn't need to be loaded again. Includes the GPU memory of the textures and models. Use 0 to disable caching (default).
+    /// </summary>
+    static uint64 AssetsCacheBudget;
+
+    /// <summary>
+    /// The physical memory usage threshold (normalized to range 0-1) above which all cached assets are unloaded to free memory.
+    /// </summary>
+    static float AssetsCacheMemoryPressure;
+
+    /// <summary>
+    /// Sets the assets cache memory budget for the assets of the given type (including derived types). Overrides the global AssetsCacheBudget for those assets.
+    /// </summary>
+    /// <param name="type">The asset type.</param>
+    /// <param name="budget">The memory budget (in bytes). Use 0 to disable caching of that assets type.</param>
+    static void SetAssetsCacheBudget(const ScriptingTypeHandle& type, uint64 budget);
+
+    /// <summary>
+    /// Clears the assets cache memory budget of the given type (assets will use the global AssetsCacheBudget).
+    /// </summary>
+    /// <param name="type">The asset type.</param>
+    static void ClearAssetsCacheBudget(const ScriptingTypeHandle& type);
+
 public:
     /// <summary>
     /// Gets the assets registry.
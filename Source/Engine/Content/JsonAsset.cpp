@@ -15,6 +15,7 @@
 #include "Engine/Core/Config/Settings.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Engine/Content/Factories/JsonAssetFactory.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Debug/Exceptions/JsonParseException.h"
@@ -25,6 +26,9 @@
 #include "Engine/Utilities/StringConverter.h"
 #include "Engine/Threading/Threading.h"
 
+// The minimum size of the memory pool chunk used to allocate the parsed Json asset document
+#define JSON_ASSET_DOCUMENT_MIN_CHUNK_SIZE (64 * 1024)
+
 JsonAssetBase::JsonAssetBase(const SpawnParams& params, const AssetInfo* info)
     : Asset(params, info)
     , _path(info->Path)
@@ -33,9 +37,14 @@ JsonAssetBase::JsonAssetBase(const SpawnParams& params, const AssetInfo* info)
 {
 }
 
+JsonAssetBase::~JsonAssetBase()
+{
+    ClearDocument();
+}
+
 String JsonAssetBase::GetData() const
 {
-    if (Data == nullptr)
+    if (Data == nullptr && (!_isDocumentReleased || const_cast<JsonAssetBase*>(this)->EnsureDocument()))
         return String::Empty;
     PROFILE_CPU_NAMED("JsonAsset.GetData");
     rapidjson_flax::StringBuffer buffer;
@@ -86,6 +95,47 @@ void JsonAssetBase::OnGetData(rapidjson_flax::StringBuffer& buffer) const
     Data->Accept(writerObj.GetWriter());
 }
 
+void JsonAssetBase::ReleaseDocument()
+{
+    ScopeLock lock(Locker);
+    if (IsVirtual() || _isVirtualDocument || !Data)
+        return;
+    ClearDocument();
+    _isDocumentReleased = true;
+}
+
+bool JsonAssetBase::EnsureDocument()
+{
+    ScopeLock lock(Locker);
+    if (Data)
+        return false;
+    if (!_isDocumentReleased)
+        return true;
+    PROFILE_CPU();
+    if (JsonAssetBase::loadAsset() != LoadResult::Ok)
+    {
+        LOG(Warning, "Failed to load json asset data. {0}", ToString());
+        ClearDocument();
+        return true;
+    }
+    _isDocumentReleased = false;
+    return false;
+}
+
+void JsonAssetBase::ClearDocument()
+{
+    {
+        ISerializable::SerializeDocument tmp;
+        Document.Swap(tmp);
+    }
+    Data = nullptr;
+    if (_documentAllocator)
+    {
+        Delete(_documentAllocator);
+        _documentAllocator = nullptr;
+    }
+}
+
 const String& JsonAssetBase::GetPath() const
 {
 #if USE_EDITOR
@@ -261,15 +311,35 @@ Asset::LoadResult JsonAssetBase::loadAsset()
     auto& data = chunk->Data;
 #endif
 
-    // Parse json document
+    // Use a single memory pool sized for the whole data to allocate the document nodes (avoids many small chunks for large data assets)
+    ClearDocument();
+    _documentAllocator = New<ISerializable::SerializeDocument::AllocatorType>(Math::Max<size_t>((size_t)data.Length(), JSON_ASSET_DOCUMENT_MIN_CHUNK_SIZE));
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        Document.Parse(data.Get<char>(), data.Length());
+        ISerializable::SerializeDocument document(_documentAllocator);
+        Document.Swap(document);
     }
-    if (Document.HasParseError())
+
+    // Parse json document (cooked game uses binary json)
+    if (JsonBinary::IsBinary(data.Get(), data.Length()))
     {
-        Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
-        return LoadResult::CannotLoadData;
+        PROFILE_CPU_NAMED("Json.ParseBinary");
+        if (JsonBinary::Parse(Document, data.Get(), data.Length()))
+        {
+            LOG(Warning, "Invalid binary json asset data. {0}", ToString());
+            return LoadResult::CannotLoadData;
+        }
+    }
+    else
+    {
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            Document.Parse(data.Get<char>(), data.Length());
+        }
+        if (Document.HasParseError())
+        {
+            Log::JsonParseException(Document.GetParseError(), Document.GetErrorOffset());
+            return LoadResult::CannotLoadData;
+        }
     }
 
     // Gather information from the header
@@ -294,12 +364,11 @@ Asset::LoadResult JsonAssetBase::loadAsset()
 
 void JsonAssetBase::unload(bool isReloading)
 {
-    ISerializable::SerializeDocument tmp;
-    Document.Swap(tmp);
-    Data = nullptr;
+    ClearDocument();
     DataTypeName.Clear();
     DataEngineBuild = 0;
     _isVirtualDocument = false;
+    _isDocumentReleased = false;
 }
 
 #if USE_EDITOR
@@ -316,6 +385,8 @@ void JsonAssetBase::onRename(const StringView& newPath)
 
 REGISTER_JSON_ASSET(JsonAsset, "FlaxEngine.JsonAsset", true);
 
+bool JsonAsset::ReleaseDocumentAfterLoad = false;
+
 JsonAsset::JsonAsset(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
     , Instance(nullptr)
@@ -351,6 +422,12 @@ Asset::LoadResult JsonAsset::loadAsset()
     // Destroy instance on scripting shutdown (eg. asset from scripts)
     Scripting::ScriptsUnload.Bind<JsonAsset, &JsonAsset::DeleteInstance>(this);
 
+#if !USE_EDITOR
+    // Free the document memory if the data has been already deserialized into the instance
+    if (ReleaseDocumentAfterLoad && Instance)
+        ReleaseDocument();
+#endif
+
     return LoadResult::Ok;
 }
 
@@ -386,6 +463,8 @@ bool JsonAsset::CreateInstance()
     ScopeLock lock(Locker);
     if (Instance)
         return false;
+    if (EnsureDocument())
+        return false;
 
     // Try to scripting type for this data
     const StringAsANSI<> dataTypeNameAnsi(DataTypeName.Get(), DataTypeName.Length());
@@ -16,6 +16,8 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API JsonAssetBase : public Asset
 protected:
     String _path;
     bool _isVirtualDocument = false;
+    bool _isDocumentReleased = false;
+    ISerializable::SerializeDocument::AllocatorType* _documentAllocator = nullptr;
 
 protected:
     /// <summary>
@@ -25,6 +27,12 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API JsonAssetBase : public Asset
     /// <param name="info">The asset object information.</param>
     explicit JsonAssetBase(const SpawnParams& params, const AssetInfo* info);
 
+public:
+    /// <summary>
+    /// Finalizes an instance of the <see cref="JsonAssetBase"/> class.
+    /// </summary>
+    ~JsonAssetBase();
+
 public:
     /// <summary>
     /// The parsed json document.
@@ -92,6 +100,15 @@ API_CLASS(Abstract, NoSpawn) class FLAXENGINE_API JsonAssetBase : public Asset
     // Gets the serialized Json data (from runtime state).
     virtual void OnGetData(rapidjson_flax::StringBuffer& buffer) const;
 
+    // Releases the parsed Json document memory. It will be parsed again on the next data access (see EnsureDocument).
+    void ReleaseDocument();
+
+    // Ensures that the parsed Json document is available (loads it again if it was released). Returns true if failed, otherwise false.
+    bool EnsureDocument();
+
+private:
+    void ClearDocument();
+
 public:
     // [Asset]
     const String& GetPath() const override;
@@ -126,6 +143,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API JsonAsset : public JsonAssetBase
     /// </summary>
     ScriptingTypeHandle InstanceType;
 
+    /// <summary>
+    /// True if release the parsed Json document after deserializing the unmanaged object instance from it (reduces memory usage of large data assets such as data tables). The document is parsed again when the asset data gets accessed. Not used in Editor.
+    /// </summary>
+    API_FIELD() static bool ReleaseDocumentAfterLoad;
+
     /// <summary>
     /// The deserialized unmanaged object instance (e.g. PhysicalMaterial). Might be null if asset was loaded before binary module with that asset was loaded (use GetInstance for this case).
     /// </summary>
@@ -20,9 +20,32 @@ class ContentLoadTask : public Task
     /// </summary>
     DECLARE_ENUM_5(Result, Ok, AssetLoadError, MissingReferences, LoadDataError, TaskFailed);
 
+    /// <summary>
+    /// Describes task priority. Loading threads pick the queued tasks with the highest priority first.
+    /// </summary>
+    DECLARE_ENUM_3(Priority, Low, Normal, High);
+
+private:
+    Priority _priority = Priority::Normal;
+
 protected:
     virtual Result run() = 0;
 
+public:
+    /// <summary>
+    /// Gets the task priority.
+    /// </summary>
+    FORCE_INLINE Priority GetPriority() const
+    {
+        return _priority;
+    }
+
+    /// <summary>
+    /// Sets the task priority. Can be changed after the task has been queued (eg. to raise priority of the streaming request that is needed now). Thread-safe.
+    /// </summary>
+    /// <param name="value">The priority.</param>
+    void SetPriority(Priority value);
+
 public:
     // [Task]
     String ToString() const override;
@@ -31,4 +54,5 @@ class ContentLoadTask : public Task
     // [Task]
     void Enqueue() override;
     bool Run() override;
+    void OnCancel() override;
 };
@@ -11,7 +11,8 @@
 #include "Engine/Content/Config.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
-#include "Engine/Threading/ConcurrentTaskQueue.h"
+#include "Engine/Threading/ThreadRegistry.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #if USE_EDITOR && PLATFORM_WINDOWS
 #include "Engine/Platform/Win32/IncludeWindowsHeaders.h"
 #include <propidlbase.h>
@@ -22,9 +23,39 @@ namespace ContentLoadingManagerImpl
     THREADLOCAL LoadingThread* ThisThread = nullptr;
     LoadingThread* MainThread = nullptr;
     Array<LoadingThread*> Threads;
-    ConcurrentTaskQueue<ContentLoadTask> Tasks;
+    Array<ContentLoadTask*> Tasks[ContentLoadTask::Priority_Count]; // Queued tasks (FIFO per priority, guarded with TasksMutex)
     ConditionVariable TasksSignal;
     CriticalSection TasksMutex;
+
+    ContentLoadTask* DequeueTask()
+    {
+        for (int32 priority = ContentLoadTask::Priority_Count - 1; priority >= 0; priority--)
+        {
+            auto& queue = Tasks[priority];
+            if (queue.HasItems())
+            {
+                ContentLoadTask* task = queue[0];
+                queue.RemoveAtKeepOrder(0);
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    bool RemoveTask(Task* task)
+    {
+        ScopeLock lock(TasksMutex);
+        for (auto& queue : Tasks)
+        {
+            const int32 index = queue.Find(task);
+            if (index != -1)
+            {
+                queue.RemoveAtKeepOrder(index);
+                return true;
+            }
+        }
+        return false;
+    }
 };
 
 using namespace ContentLoadingManagerImpl;
@@ -125,16 +156,15 @@ int32 LoadingThread::Run()
 
     while (HasExitFlagClear())
     {
-        if (Tasks.try_dequeue(task))
-        {
-            Run(task);
-        }
-        else
-        {
-            TasksMutex.Lock();
+        ThreadRegistry::UpdateThreadPlacement(ThreadRegistry::ThreadType::Background, ThreadPriority::Normal);
+
+        TasksMutex.Lock();
+        task = DequeueTask();
+        if (!task && HasExitFlagClear())
             TasksSignal.Wait(TasksMutex);
-            TasksMutex.Unlock();
-        }
+        TasksMutex.Unlock();
+        if (task)
+            Run(task);
     }
 
     ThisThread = nullptr;
@@ -155,7 +185,11 @@ LoadingThread* ContentLoadingManager::GetCurrentLoadThread()
 
 int32 ContentLoadingManager::GetTasksCount()
 {
-    return Tasks.Count();
+    ScopeLock lock(TasksMutex);
+    int32 result = 0;
+    for (const auto& queue : Tasks)
+        result += queue.Count();
+    return result;
 }
 
 bool ContentLoadingManagerService::Init()
@@ -208,7 +242,17 @@ void ContentLoadingManagerService::Dispose()
     ThisThread = nullptr;
 
     // Cancel all remaining tasks (no chance to execute them)
-    Tasks.CancelAll();
+    Array<ContentLoadTask*> tasks;
+    TasksMutex.Lock();
+    for (auto& queue : Tasks)
+    {
+        for (ContentLoadTask* task : queue)
+            tasks.Add(task);
+        queue.Clear();
+    }
+    TasksMutex.Unlock();
+    for (ContentLoadTask* task : tasks)
+        task->Cancel();
 }
 
 String ContentLoadTask::ToString() const
@@ -216,14 +260,44 @@ String ContentLoadTask::ToString() const
     return String::Format(TEXT("Content Load Task ({})"), (int32)GetState());
 }
 
+void ContentLoadTask::SetPriority(Priority value)
+{
+    ScopeLock lock(TasksMutex);
+    if (_priority == value)
+        return;
+
+    // Move queued task to the other queue
+    auto& queue = Tasks[(int32)_priority];
+    const int32 index = queue.Find(this);
+    if (index != -1)
+    {
+        queue.RemoveAtKeepOrder(index);
+        Tasks[(int32)value].Add(this);
+    }
+    _priority = value;
+}
+
 void ContentLoadTask::Enqueue()
 {
-    Tasks.Add(this);
+    TasksMutex.Lock();
+    Tasks[(int32)_priority].Add(this);
+    TasksMutex.Unlock();
     TasksSignal.NotifyOne();
 }
 
+void ContentLoadTask::OnCancel()
+{
+    // Remove from the queue if not taken by the loading thread yet (cancelled task doesn't need to wait in queue)
+    RemoveTask(this);
+
+    // Base
+    Task::OnCancel();
+}
+
 bool ContentLoadTask::Run()
 {
+    PROFILE_MEM(Content);
+
     // Perform an operation
     const auto result = run();
 
@@ -19,6 +19,21 @@ enum class FlaxChunkFlags
     /// Compress chunk data using LZ4 algorithm.
     /// </summary>
     CompressedLZ4 = 1,
+
+    /// <summary>
+    /// Compress chunk data using LZ4 algorithm with a built-in dictionary of the common json tokens (eg. scene objects properties). Improves compression ratio of the small json assets.
+    /// </summary>
+    CompressedLZ4Dictionary = 2,
+
+    /// <summary>
+    /// The LZ4 compressed chunk data is split into the independent blocks (see ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE) that can be decompressed in parallel. Used by the storage internally for the large chunks.
+    /// </summary>
+    CompressedBlocks = 4,
+
+    /// <summary>
+    /// The mask of all compression flags.
+    /// </summary>
+    Compressed = CompressedLZ4 | CompressedLZ4Dictionary,
 };
 
 DECLARE_ENUM_OPERATORS(FlaxChunkFlags);
@@ -8,10 +8,14 @@
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Core/Collections/Sorting.h"
 #if USE_EDITOR
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Serialization/JsonWriters.h"
@@ -56,6 +60,98 @@ void FlaxChunk::RegisterUsage()
 
 const int32 FlaxStorage::MagicCode = 1180124739;
 
+namespace
+{
+    // The dictionary used by CompressedLZ4Dictionary chunks. Warning! Changing it breaks existing packages (would need to add a new flag).
+    const char JsonCompressionDictionary[] =
+        "{\"ID\":\"00000000000000000000000000000000\",\"TypeName\":\"FlaxEngine.\",\"PrefabID\":\"\",\"PrefabObjectID\":\"\",\"ParentID\":\""
+        "\"V\":{\"Data\":{\"Version\":\"Actors\":[\"Scripts\":[\"Entries\":[{\"Material\":\"\",\"ShadowsMode\":\"Visible\":true,\"ReceiveDecals\":"
+        "\"Model\":\"\",\"Buffer\":{\"Size\":{\"X\":\"Center\":{\"X\":\"Color\":{\"R\":1.0,\"G\":1.0,\"B\":1.0,\"A\":1.0},\"Brightness\":"
+        "FlaxEngine.StaticModel\"FlaxEngine.EmptyActor\"FlaxEngine.BoxCollider\"FlaxEngine.MeshCollider\"FlaxEngine.PointLight\"FlaxEngine.UIControl\""
+        "\"Control\":\"FlaxEngine.GUI.\"Bounds\":{\"Box\":{\"Minimum\":{\"X\":\"Maximum\":{\"X\":\"Sphere\":{\"Center\":\"Radius\":"
+        "\"IsActive\":false,\"Name\":\"\",\"StaticFlags\":\"HideFlags\":\"Layer\":0,\"Tags\":[\"Transform\":{\"Translation\":{\"X\":0.0,\"Y\":0.0,\"Z\":0.0},"
+        "\"Orientation\":{\"X\":0.0,\"Y\":0.0,\"Z\":0.0,\"W\":1.0},\"Scale\":{\"X\":1.0,\"Y\":1.0,\"Z\":1.0}},";
+
+    FORCE_INLINE bool IsCompressed(const FlaxChunk* chunk)
+    {
+        return EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::Compressed);
+    }
+
+    // Compressed blocks layout: int32 blocksCount, int32 blockSize[blocksCount], blocks data
+    bool CompressBlocks(const byte* src, int32 srcSize, Array<byte>& result)
+    {
+        PROFILE_CPU();
+        const int32 blocksCount = Math::DivideAndRoundUp(srcSize, ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE);
+        const int32 blockMaxSize = LZ4_compressBound(ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE);
+        Array<byte> blocks;
+        blocks.Resize(blocksCount * blockMaxSize);
+        Array<int32> blocksSizes;
+        blocksSizes.Resize(blocksCount);
+        JobSystem::Execute([&](int32 i)
+        {
+            const int32 blockStart = i * ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE;
+            const int32 blockSize = Math::Min(srcSize - blockStart, ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE);
+            blocksSizes[i] = LZ4_compress_default((const char*)src + blockStart, (char*)blocks.Get() + i * blockMaxSize, blockSize, blockMaxSize);
+        }, blocksCount);
+
+        // Merge blocks
+        int32 size = sizeof(int32) * (1 + blocksCount);
+        for (int32 i = 0; i < blocksCount; i++)
+        {
+            if (blocksSizes[i] <= 0)
+                return true;
+            size += blocksSizes[i];
+        }
+        result.Resize(size);
+        byte* dst = result.Get();
+        Platform::MemoryCopy(dst, &blocksCount, sizeof(int32));
+        Platform::MemoryCopy(dst + sizeof(int32), blocksSizes.Get(), blocksCount * sizeof(int32));
+        dst += sizeof(int32) * (1 + blocksCount);
+        for (int32 i = 0; i < blocksCount; i++)
+        {
+            Platform::MemoryCopy(dst, blocks.Get() + i * blockMaxSize, blocksSizes[i]);
+            dst += blocksSizes[i];
+        }
+        return false;
+    }
+
+    bool DecompressBlocks(const byte* src, int32 srcSize, byte* dst, int32 dstSize)
+    {
+        int32 blocksCount;
+        if (srcSize < sizeof(int32))
+            return true;
+        Platform::MemoryCopy(&blocksCount, src, sizeof(int32));
+        const int32 tableSize = sizeof(int32) * (1 + blocksCount);
+        if (blocksCount != Math::DivideAndRoundUp(dstSize, ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE) || srcSize < tableSize)
+            return true;
+
+        // Compute blocks locations
+        Array<int32, InlinedAllocation<64>> blocksOffsets;
+        blocksOffsets.Resize(blocksCount + 1);
+        blocksOffsets[0] = tableSize;
+        for (int32 i = 0; i < blocksCount; i++)
+        {
+            int32 blockSize;
+            Platform::MemoryCopy(&blockSize, src + sizeof(int32) * (1 + i), sizeof(int32));
+            blocksOffsets[i + 1] = blocksOffsets[i] + blockSize;
+            if (blockSize <= 0 || blocksOffsets[i + 1] > srcSize)
+                return true;
+        }
+
+        // Decompress blocks in parallel
+        volatile int64 failed = 0;
+        JobSystem::Execute([&](int32 i)
+        {
+            const int32 blockStart = i * ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE;
+            const int32 blockSize = Math::Min(dstSize - blockStart, ASSETS_STORAGE_COMPRESSION_BLOCK_SIZE);
+            const int32 res = LZ4_decompress_safe((const char*)src + blocksOffsets[i], (char*)dst + blockStart, blocksOffsets[i + 1] - blocksOffsets[i], blockSize);
+            if (res != blockSize)
+                Platform::AtomicStore(&failed, 1);
+        }, blocksCount);
+        return Platform::AtomicRead(&failed) != 0;
+    }
+}
+
 FlaxStorage::LockData FlaxStorage::LockData::Invalid(nullptr);
 
 struct Header
@@ -220,6 +316,7 @@ const Char* TypeId2TypeName(const uint32 typeId)
 FlaxStorage::FlaxStorage(const StringView& path)
     : _path(path)
 {
+    PROFILE_LOCK(_loadLocker, "FlaxStorage::LoadLocker");
 }
 
 FlaxStorage::~FlaxStorage()
@@ -641,6 +738,17 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
 
     LockChunks();
 
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    // Use the data directly from the mapped file (linked chunk keeps the file mapped until it gets unloaded)
+    const byte* mappedData = MapFile();
+    if (mappedData && (uint64)chunk->LocationInFile.Address + chunk->LocationInFile.Size <= _mappedSize)
+    {
+        const bool failed = LoadChunkData(chunk, mappedData + chunk->LocationInFile.Address, true);
+        UnlockChunks();
+        return failed;
+    }
+#endif
+
     // Open file
     auto stream = OpenFile();
     bool failed = stream == nullptr;
@@ -678,35 +786,21 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
 
         // Load data
         auto size = chunk->LocationInFile.Size;
-        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+        if (IsCompressed(chunk))
         {
             // Compressed
-            size -= sizeof(int32); // Don't count original size int
-            int32 originalSize;
-            stream->ReadInt32(&originalSize);
             Array<byte> tmpBuf;
             tmpBuf.Resize(size); // TODO: maybe use thread local or content loading pool with sharable temp buffers for the decompression?
             stream->ReadBytes(tmpBuf.Get(), size);
-
-            // Decompress data
-            PROFILE_CPU_NAMED("DecompressLZ4");
-            chunk->Data.Allocate(originalSize);
-            const int32 res = LZ4_decompress_safe((const char*)tmpBuf.Get(), chunk->Data.Get<char>(), size, originalSize);
-            if (res <= 0)
-            {
-                UnlockChunks();
-                LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
-                return true;
-            }
-            chunk->Data.SetLength(res);
+            failed = LoadChunkData(chunk, tmpBuf.Get(), false);
         }
         else
         {
             // Raw data
             chunk->Data.Read(stream, size);
+            ASSERT(chunk->IsLoaded());
+            chunk->RegisterUsage();
         }
-        ASSERT(chunk->IsLoaded());
-        chunk->RegisterUsage();
     }
 
     UnlockChunks();
@@ -714,6 +808,151 @@ bool FlaxStorage::LoadAssetChunk(FlaxChunk* chunk)
     return failed;
 }
 
+static bool SortChunksByLocation(FlaxChunk* const& a, FlaxChunk* const& b)
+{
+    return a->LocationInFile.Address < b->LocationInFile.Address;
+}
+
+bool FlaxStorage::LoadAssetChunks(FlaxChunk** chunks, int32 count)
+{
+    ASSERT(IsLoaded());
+    PROFILE_CPU();
+
+    // Skip already loaded chunks
+    int32 toLoad = 0;
+    for (int32 i = 0; i < count; i++)
+    {
+        FlaxChunk* chunk = chunks[i];
+        ASSERT(chunk != nullptr && _chunks.Contains(chunk));
+        if (chunk->IsLoaded())
+            continue;
+        if (chunk->ExistsInFile() == false)
+        {
+            LOG(Warning, "Cannot load chunk from {0}. It doesn't exist in storage.", ToString());
+            return true;
+        }
+        chunks[toLoad++] = chunk;
+    }
+    if (toLoad == 0)
+        return false;
+    if (toLoad == 1)
+        return LoadAssetChunk(chunks[0]);
+
+    // Read chunks in the file order to reduce seeking
+    Sorting::QuickSort(chunks, toLoad, &SortChunksByLocation);
+
+    LockChunks();
+    bool failed = false;
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    // Mapped file doesn't need to read data
+    FileReadStream* stream = MapFile() ? nullptr : OpenFile();
+#else
+    FileReadStream* stream = OpenFile();
+#endif
+    if (stream)
+    {
+        // Read the sequences of adjacent chunks with a single read (limit the size of the temporary buffer)
+        constexpr uint32 maxBatchSize = 16 * 1024 * 1024;
+        Array<byte> buffer;
+        int32 start = 0;
+        while (start < toLoad && !failed)
+        {
+            const FlaxChunk::Location& first = chunks[start]->LocationInFile;
+            uint32 batchSize = first.Size;
+            int32 end = start + 1;
+            while (end < toLoad)
+            {
+                const FlaxChunk::Location& next = chunks[end]->LocationInFile;
+                if (next.Address != first.Address + batchSize || batchSize + next.Size > maxBatchSize)
+                    break;
+                batchSize += next.Size;
+                end++;
+            }
+
+            if (end - start == 1 && !IsCompressed(chunks[start]))
+            {
+                // Read raw data directly into the chunk
+                failed = LoadAssetChunk(chunks[start]);
+            }
+            else
+            {
+                stream->SetPosition(first.Address);
+                if (!stream->HasError())
+                {
+                    buffer.Resize((int32)batchSize, false);
+                    stream->ReadBytes(buffer.Get(), batchSize);
+                }
+                if (stream->HasError())
+                {
+                    // Fallback to the single chunks loading (with retries on failed seek)
+                    for (int32 i = start; i < end && !failed; i++)
+                        failed = LoadAssetChunk(chunks[i]);
+                }
+                else
+                {
+                    const byte* data = buffer.Get();
+                    for (int32 i = start; i < end && !failed; i++)
+                    {
+                        failed = LoadChunkData(chunks[i], data, false);
+                        data += chunks[i]->LocationInFile.Size;
+                    }
+                }
+            }
+            start = end;
+        }
+    }
+    else
+    {
+        for (int32 i = 0; i < toLoad && !failed; i++)
+            failed = LoadAssetChunk(chunks[i]);
+    }
+    UnlockChunks();
+
+    return failed;
+}
+
+bool FlaxStorage::LoadChunkData(FlaxChunk* chunk, const byte* data, bool link)
+{
+    int32 size = chunk->LocationInFile.Size;
+    if (IsCompressed(chunk))
+    {
+        // Compressed
+        size -= sizeof(int32); // Don't count original size int
+        int32 originalSize;
+        Platform::MemoryCopy(&originalSize, data, sizeof(int32));
+        data += sizeof(int32);
+
+        // Decompress data
+        PROFILE_CPU_NAMED("DecompressLZ4");
+        chunk->Data.Allocate(originalSize);
+        int32 res;
+        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedBlocks))
+            res = DecompressBlocks(data, size, chunk->Data.Get(), originalSize) ? -1 : originalSize;
+        else if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            res = LZ4_decompress_safe_usingDict((const char*)data, chunk->Data.Get<char>(), size, originalSize, JsonCompressionDictionary, sizeof(JsonCompressionDictionary));
+        else
+            res = LZ4_decompress_safe((const char*)data, chunk->Data.Get<char>(), size, originalSize);
+        if (res <= 0)
+        {
+            LOG(Warning, "Cannot load chunk from {0}. Failed to decompress it data. Result: {1}.", ToString(), res);
+            return true;
+        }
+        chunk->Data.SetLength(res);
+    }
+    else if (link)
+    {
+        // Raw data (linked)
+        chunk->Data.Link(data, size);
+    }
+    else
+    {
+        // Raw data
+        chunk->Data.Copy(data, size);
+    }
+    chunk->RegisterUsage();
+    return false;
+}
+
 #if USE_EDITOR
 
 bool FlaxStorage::ChangeAssetID(Entry& e, const Guid& newId)
@@ -893,15 +1132,37 @@ bool FlaxStorage::Create(WriteStream* stream, const AssetInitData* data, int32 d
     compressedChunks.Resize(chunksCount);
     for (int32 i = 0; i < chunksCount; i++)
     {
-        const FlaxChunk* chunk = chunks[i];
-        if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4))
+        FlaxChunk* chunk = chunks[i];
+        chunk->Flags &= ~FlaxChunkFlags::CompressedBlocks;
+        if (IsCompressed(chunk))
         {
             PROFILE_CPU_NAMED("CompressLZ4");
             const int32 srcSize = chunk->Data.Length();
-            const int32 maxSize = LZ4_compressBound(srcSize);
             auto& chunkCompressed = compressedChunks[i];
+            if (srcSize >= ASSETS_STORAGE_COMPRESSION_BLOCKS_MIN_SIZE && !EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            {
+                // Split large chunks into blocks to decompress them in parallel
+                chunk->Flags |= FlaxChunkFlags::CompressedBlocks;
+                if (CompressBlocks(chunk->Data.Get(), srcSize, chunkCompressed))
+                {
+                    chunkCompressed.Resize(0);
+                    LOG(Warning, "Chunk data LZ4 compression failed.");
+                    return true;
+                }
+                continue;
+            }
+            const int32 maxSize = LZ4_compressBound(srcSize);
             chunkCompressed.Resize(maxSize);
-            const int32 dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
+            int32 dstSize;
+            if (EnumHasAnyFlags(chunk->Flags, FlaxChunkFlags::CompressedLZ4Dictionary))
+            {
+                LZ4_stream_t stream;
+                LZ4_resetStream(&stream);
+                LZ4_loadDict(&stream, JsonCompressionDictionary, sizeof(JsonCompressionDictionary));
+                dstSize = LZ4_compress_fast_continue(&stream, chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize, 1);
+            }
+            else
+                dstSize = LZ4_compress_default(chunk->Data.Get<char>(), (char*)chunkCompressed.Get(), srcSize, maxSize);
             if (dstSize <= 0)
             {
                 chunkCompressed.Resize(0);
@@ -1052,7 +1313,19 @@ bool FlaxStorage::LoadAssetHeader(const Entry& e, AssetInitData& data)
     auto lock = Lock();
 
     // Open file
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    MemoryReadStream mappedStream;
+    ReadStream* stream;
+    if (const byte* mappedData = MapFile())
+    {
+        mappedStream.Init(mappedData, _mappedSize);
+        stream = &mappedStream;
+    }
+    else
+        stream = OpenFile();
+#else
     auto stream = OpenFile();
+#endif
     if (stream == nullptr)
     {
         return true;
@@ -1333,9 +1606,59 @@ FileReadStream* FlaxStorage::OpenFile()
     return stream;
 }
 
+#if ASSETS_STORAGE_MEMORY_MAPPING
+
+const byte* FlaxStorage::MapFile()
+{
+    // Map only read-only packages (files can be modified externally)
+    if (_mappingFailed || !IsPackage())
+        return nullptr;
+    ScopeLock lock(_loadLocker);
+    if (!_mappedData && !_mappingFailed)
+    {
+        auto file = File::Open(_path, FileMode::OpenExisting, FileAccess::Read, FileShare::Read);
+        if (file)
+        {
+            _mappedData = file->MapView(_mappedSize);
+            Delete(file);
+        }
+
+        // Fallback to the file streams if memory-mapping is not supported
+        _mappingFailed = _mappedData == nullptr;
+    }
+    return _mappedData;
+}
+
+bool FlaxStorage::UnmapFile()
+{
+    ScopeLock lock(_loadLocker);
+    if (!_mappedData)
+        return false;
+
+    // Chunks linked to the mapped data pin the mapping until they get unloaded (see Tick)
+    for (const FlaxChunk* chunk : _chunks)
+    {
+        const byte* data = chunk->Data.Get();
+        if (data >= _mappedData && data < _mappedData + _mappedSize)
+            return true;
+    }
+
+    File::UnmapView(_mappedData, _mappedSize);
+    _mappedData = nullptr;
+    _mappedSize = 0;
+    return false;
+}
+
+#endif
+
 bool FlaxStorage::CloseFileHandles()
 {
-    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0)
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    const bool isMapped = _mappedData != nullptr;
+#else
+    const bool isMapped = false;
+#endif
+    if (Platform::AtomicRead(&_chunksLock) == 0 && Platform::AtomicRead(&_files) == 0 && !isMapped)
     {
         return false;
     }
@@ -1379,6 +1702,12 @@ bool FlaxStorage::CloseFileHandles()
     }
     _file.Clear();
     Platform::AtomicStore(&_files, 0);
+
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    // Release file mapping
+    if (isMapped && UnmapFile())
+        return true; // Failed, loaded chunks still use the mapped data
+#endif
     return false;
 }
 
@@ -1388,14 +1717,20 @@ void FlaxStorage::Dispose()
         return;
 
     // Close file
-    if (CloseFileHandles())
-    {
-        LOG(Error, "Cannot close file access for '{}'", _path);
-    }
+    bool failed = CloseFileHandles();
 
     // Release data
     _chunks.ClearDelete();
     _version = 0;
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    // Chunks linked to the mapped file were keeping it alive
+    if (failed && Platform::AtomicRead(&_chunksLock) == 0)
+        failed = UnmapFile();
+#endif
+    if (failed)
+    {
+        LOG(Error, "Cannot close file access for '{}'", _path);
+    }
 }
 
 void FlaxStorage::Tick(double time)
@@ -96,6 +96,11 @@ class FLAXENGINE_API FlaxStorage : public Object
     // Storage
     ThreadLocal<FileReadStream*> _file;
     Array<FlaxChunk*> _chunks;
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    byte* _mappedData = nullptr;
+    uint32 _mappedSize = 0;
+    bool _mappingFailed = false;
+#endif
 
     // Metadata
     uint32 _version = 0;
@@ -384,6 +389,14 @@ class FLAXENGINE_API FlaxStorage : public Object
     /// <returns>True if cannot load data, otherwise false</returns>
     bool LoadAssetChunk(FlaxChunk* chunk);
 
+    /// <summary>
+    /// Loads the asset chunks in a single batch. Chunks are read in the file order and the adjacent chunks are read with a single I/O request.
+    /// </summary>
+    /// <param name="chunks">The chunks to load (already loaded ones are skipped). Array gets sorted by the location in file.</param>
+    /// <param name="count">The chunks count.</param>
+    /// <returns>True if cannot load data, otherwise false</returns>
+    bool LoadAssetChunks(FlaxChunk** chunks, int32 count);
+
 #if USE_EDITOR
 
     /// <summary>
@@ -487,5 +500,10 @@ class FLAXENGINE_API FlaxStorage : public Object
     void AddChunk(FlaxChunk* chunk);
     virtual void AddEntry(Entry& e) = 0;
     FileReadStream* OpenFile();
+    bool LoadChunkData(FlaxChunk* chunk, const byte* data, bool link);
+#if ASSETS_STORAGE_MEMORY_MAPPING
+    const byte* MapFile();
+    bool UnmapFile();
+#endif
     virtual bool GetEntry(const Guid& id, Entry& e) = 0;
 };
@@ -575,6 +575,41 @@ CreateAssetResult ImportModel::CreateModel(CreateAssetContext& context, ModelDat
         context.Data.Header.Chunks[chunkIndex]->Data.Copy(stream.GetHandle(), stream.GetPosition());
     }
 
+    // Pack meshlets
+    bool hasMeshlets = false;
+    for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+    {
+        for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            hasMeshlets |= mesh->Meshlets.HasItems();
+    }
+    if (hasMeshlets)
+    {
+        stream.SetPosition(0);
+        stream.WriteInt32(1); // Version
+        for (int32 lodIndex = 0; lodIndex < lodCount; lodIndex++)
+        {
+            for (const MeshData* mesh : modelData.LODs[lodIndex].Meshes)
+            {
+                stream.WriteInt32(mesh->Meshlets.Count());
+                stream.WriteBytes(mesh->Meshlets.Get(), mesh->Meshlets.Count() * sizeof(Meshlet));
+            }
+        }
+        if (context.AllocateChunk(14))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[14]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
+    // Pack vertex compression
+    if (options && options->CompressVertexPositions)
+    {
+        stream.SetPosition(0);
+        stream.WriteInt32(1); // Version
+        stream.WriteBool(true); // Compressed positions
+        if (context.AllocateChunk(13))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[13]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
     // Generate SDF
     if (options && options->GenerateSDF)
     {
@@ -656,6 +691,19 @@ CreateAssetResult ImportModel::CreateAnimation(CreateAssetContext& context, Mode
         return CreateAssetResult::CannotAllocateChunk;
     context.Data.Header.Chunks[0]->Data.Copy(stream.GetHandle(), stream.GetPosition());
 
+    // Save animation segments data (long animations are streamed)
+    const auto& anim = modelData.Animations[animIndex];
+    Array<float, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS + 1>> segments;
+    anim.GetStreamingSegments(segments);
+    for (int32 i = 0; i + 1 < segments.Count(); i++)
+    {
+        stream.SetPosition(0);
+        anim.SerializeSegment(stream, segments[i], segments[i + 1]);
+        if (context.AllocateChunk(i + 1))
+            return CreateAssetResult::CannotAllocateChunk;
+        context.Data.Header.Chunks[i + 1]->Data.Copy(stream.GetHandle(), stream.GetPosition());
+    }
+
     return CreateAssetResult::Ok;
 }
 
@@ -25,3 +25,8 @@
 /// </summary>
 #define DICTIONARY_PROB_FUNC(size, numChecks) (numChecks)
 //#define DICTIONARY_PROB_FUNC(size, numChecks) (1)
+
+/// <summary>
+/// The amount of the buckets in a group of the flat dictionaries (control bytes of the whole group are scanned at once with SIMD).
+/// </summary>
+#define FLAT_DICTIONARY_GROUP_SIZE 16
@@ -0,0 +1,966 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/HashFunctions.h"
+#include "Engine/Core/Collections/Config.h"
+#include "Engine/Core/SIMD.h"
+
+/// <summary>
+/// Template for unordered dictionary with mapped key with value pairs stored in the open-addressing table with separate control bytes (one per bucket, with 7 bits of the key hash for occupied buckets).
+/// Lookups scan the control bytes of a whole group of buckets at once (using SIMD) and compare the keys only for the matching hash bits which makes it faster than Dictionary for the lookup-heavy collections with many items.
+/// </summary>
+/// <remarks>
+/// Has the same API as the Dictionary. Capacity is the amount of the buckets (power of two, multiple of FLAT_DICTIONARY_GROUP_SIZE) and the collection grows when it gets 7/8 full.
+/// </remarks>
+/// <typeparam name="KeyType">The type of the keys in the dictionary.</typeparam>
+/// <typeparam name="ValueType">The type of the values in the dictionary.</typeparam>
+/// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
+template<typename KeyType, typename ValueType, typename AllocationType = HeapAllocation>
+class FlatDictionary
+{
+    friend FlatDictionary;
+public:
+    /// <summary>
+    /// Describes single portion of space for the key and value pair in a hash map.
+    /// </summary>
+    struct Bucket
+    {
+        /// <summary>The key.</summary>
+        KeyType Key;
+        /// <summary>The value.</summary>
+        ValueType Value;
+    };
+
+    typedef typename AllocationType::template Data<Bucket> AllocationData;
+    typedef typename AllocationType::template Data<byte> ControlAllocationData;
+
+private:
+    enum Control : byte
+    {
+        // Occupied buckets store the lower 7 bits of the key hash.
+        Empty = 0x80,
+        Deleted = 0xFE,
+    };
+
+    int32 _elementsCount = 0;
+    int32 _deletedCount = 0;
+    int32 _size = 0;
+    int32 _growthLeft = 0;
+    ControlAllocationData _control;
+    AllocationData _allocation;
+
+    FORCE_INLINE static bool IsOccupied(byte control)
+    {
+        return (control & 0x80) == 0;
+    }
+
+    FORCE_INLINE static int32 GetMaxElements(int32 size)
+    {
+        return size - size / 8;
+    }
+
+    template<typename KeyComparableType>
+    FORCE_INLINE static uint32 GetKeyHash(const KeyComparableType& key)
+    {
+        // Mix the hash bits (many hash functions are weak in the lower bits that are used for the control bytes, eg. aligned pointers)
+        uint32 hash = GetHash(key);
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6b;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    FORCE_INLINE static void MoveToEmpty(ControlAllocationData& toControl, AllocationData& to, ControlAllocationData& fromControl, AllocationData& from, int32 fromSize)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            toControl.Swap(fromControl);
+            to.Swap(from);
+        }
+        else
+        {
+            toControl.Allocate(fromSize);
+            to.Allocate(fromSize);
+            byte* toControlData = toControl.Get();
+            byte* fromControlData = fromControl.Get();
+            Bucket* toData = to.Get();
+            Bucket* fromData = from.Get();
+            for (int32 i = 0; i < fromSize; i++)
+            {
+                toControlData[i] = fromControlData[i];
+                if (IsOccupied(fromControlData[i]))
+                {
+                    Bucket& toBucket = toData[i];
+                    Bucket& fromBucket = fromData[i];
+                    Memory::MoveItems(&toBucket.Key, &fromBucket.Key, 1);
+                    Memory::MoveItems(&toBucket.Value, &fromBucket.Value, 1);
+                    Memory::DestructItem(&fromBucket.Key);
+                    Memory::DestructItem(&fromBucket.Value);
+                }
+            }
+            fromControl.Free();
+            from.Free();
+        }
+    }
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    FlatDictionary()
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    FlatDictionary(int32 capacity)
+    {
+        SetCapacity(capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    FlatDictionary(FlatDictionary&& other) noexcept
+    {
+        _elementsCount = other._elementsCount;
+        _deletedCount = other._deletedCount;
+        _size = other._size;
+        _growthLeft = other._growthLeft;
+        other._elementsCount = 0;
+        other._deletedCount = 0;
+        other._size = 0;
+        other._growthLeft = 0;
+        MoveToEmpty(_control, _allocation, other._control, other._allocation, _size);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    /// <param name="other">Other collection to copy</param>
+    FlatDictionary(const FlatDictionary& other)
+    {
+        Clone(other);
+    }
+
+    /// <summary>
+    /// Clones the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(const FlatDictionary& other)
+    {
+        if (this != &other)
+            Clone(other);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the data from the other collection.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    FlatDictionary& operator=(FlatDictionary&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            _control.Free();
+            _allocation.Free();
+            _elementsCount = other._elementsCount;
+            _deletedCount = other._deletedCount;
+            _size = other._size;
+            _growthLeft = other._growthLeft;
+            other._elementsCount = 0;
+            other._deletedCount = 0;
+            other._size = 0;
+            other._growthLeft = 0;
+            MoveToEmpty(_control, _allocation, other._control, other._allocation, _size);
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="FlatDictionary"/> class.
+    /// </summary>
+    ~FlatDictionary()
+    {
+        Clear();
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the elements in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _elementsCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of the buckets in the collection (7/8 of it can be occupied by the elements).
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _size;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _elementsCount == 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection has one or more elements.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _elementsCount != 0;
+    }
+
+public:
+    /// <summary>
+    /// The FlatDictionary collection iterator.
+    /// </summary>
+    struct Iterator
+    {
+        friend FlatDictionary;
+    private:
+        FlatDictionary* _collection;
+        int32 _index;
+
+    public:
+        Iterator(FlatDictionary* collection, const int32 index)
+            : _collection(collection)
+            , _index(index)
+        {
+        }
+
+        Iterator(FlatDictionary const* collection, const int32 index)
+            : _collection(const_cast<FlatDictionary*>(collection))
+            , _index(index)
+        {
+        }
+
+        Iterator()
+            : _collection(nullptr)
+            , _index(-1)
+        {
+        }
+
+        Iterator(const Iterator& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+        Iterator(Iterator&& i)
+            : _collection(i._collection)
+            , _index(i._index)
+        {
+        }
+
+    public:
+        FORCE_INLINE int32 Index() const
+        {
+            return _index;
+        }
+
+        FORCE_INLINE bool IsEnd() const
+        {
+            return _index == _collection->_size;
+        }
+
+        FORCE_INLINE bool IsNotEnd() const
+        {
+            return _index != _collection->_size;
+        }
+
+        FORCE_INLINE Bucket& operator*() const
+        {
+            return _collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE Bucket* operator->() const
+        {
+            return &_collection->_allocation.Get()[_index];
+        }
+
+        FORCE_INLINE explicit operator bool() const
+        {
+            return _index >= 0 && _index < _collection->_size;
+        }
+
+        FORCE_INLINE bool operator!() const
+        {
+            return !(bool)*this;
+        }
+
+        FORCE_INLINE bool operator==(const Iterator& v) const
+        {
+            return _index == v._index && _collection == v._collection;
+        }
+
+        FORCE_INLINE bool operator!=(const Iterator& v) const
+        {
+            return _index != v._index || _collection != v._collection;
+        }
+
+        Iterator& operator=(const Iterator& v)
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator=(Iterator&& v)
+        {
+            _collection = v._collection;
+            _index = v._index;
+            return *this;
+        }
+
+        Iterator& operator++()
+        {
+            const int32 capacity = _collection->_size;
+            if (_index != capacity)
+            {
+                const byte* control = _collection->_control.Get();
+                do
+                {
+                    _index++;
+                } while (_index != capacity && !IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator++(int) const
+        {
+            Iterator i = *this;
+            ++i;
+            return i;
+        }
+
+        Iterator& operator--()
+        {
+            if (_index > 0)
+            {
+                const byte* control = _collection->_control.Get();
+                do
+                {
+                    _index--;
+                } while (_index > 0 && !IsOccupied(control[_index]));
+            }
+            return *this;
+        }
+
+        Iterator operator--(int) const
+        {
+            Iterator i = *this;
+            --i;
+            return i;
+        }
+    };
+
+public:
+    /// <summary>
+    /// Gets element by the key (will add default ValueType element if key not found).
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    ValueType& At(const KeyComparableType& key)
+    {
+        const uint32 hash = GetKeyHash(key);
+        const int32 index = FindIndex(key, hash);
+        if (index != -1)
+            return _allocation.Get()[index].Value;
+
+        // Insert
+        Bucket* bucket = Insert(hash);
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::ConstructItem(&bucket->Value);
+        return bucket->Value;
+    }
+
+    /// <summary>
+    /// Gets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    const ValueType& At(const KeyComparableType& key) const
+    {
+        const int32 index = FindIndex(key, GetKeyHash(key));
+        ASSERT(index != -1);
+        return _allocation.Get()[index].Value;
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE ValueType& operator[](const KeyComparableType& key)
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Gets or sets the element by the key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>The value that is at given index.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE const ValueType& operator[](const KeyComparableType& key) const
+    {
+        return At(key);
+    }
+
+    /// <summary>
+    /// Tries to get element with given key.
+    /// </summary>
+    /// <param name="key">The key of the element.</param>
+    /// <param name="result">The result value.</param>
+    /// <returns>True if element of given key has been found, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool TryGet(const KeyComparableType& key, ValueType& result) const
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, GetKeyHash(key));
+        if (index == -1)
+            return false;
+        result = _allocation.Get()[index].Value;
+        return true;
+    }
+
+    /// <summary>
+    /// Tries to get pointer to the element with given key.
+    /// </summary>
+    /// <param name="key">The ky of the element.</param>
+    /// <returns>Pointer to the element value or null if cannot find it.</returns>
+    template<typename KeyComparableType>
+    ValueType* TryGet(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return nullptr;
+        const int32 index = FindIndex(key, GetKeyHash(key));
+        if (index == -1)
+            return nullptr;
+        return (ValueType*)&_allocation.Get()[index].Value;
+    }
+
+public:
+    /// <summary>
+    /// Clears the collection but without changing its capacity (all inserted elements: keys and values will be removed).
+    /// </summary>
+    void Clear()
+    {
+        if (_elementsCount + _deletedCount != 0)
+        {
+            byte* control = _control.Get();
+            Bucket* data = _allocation.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (IsOccupied(control[i]))
+                {
+                    Memory::DestructItem(&data[i].Key);
+                    Memory::DestructItem(&data[i].Value);
+                }
+                control[i] = Empty;
+            }
+            _elementsCount = _deletedCount = 0;
+            _growthLeft = GetMaxElements(_size);
+        }
+    }
+
+    /// <summary>
+    /// Clears the collection and delete value objects.
+    /// Note: collection must contain pointers to the objects that have public destructor and be allocated using New method.
+    /// </summary>
+#if defined(_MSC_VER)
+    template<typename = typename TEnableIf<TIsPointer<ValueType>::Value>::Type>
+#endif
+    void ClearDelete()
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value)
+                ::Delete(i->Value);
+        }
+        Clear();
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (amount of the buckets). Will be aligned to the power of two and increased if too small to contain the preserved elements.</param>
+    /// <param name="preserveContents">Enables preserving collection contents during resizing.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        if (capacity != 0)
+        {
+            if (capacity < FLAT_DICTIONARY_GROUP_SIZE)
+                capacity = FLAT_DICTIONARY_GROUP_SIZE;
+            if (preserveContents)
+            {
+                while (GetMaxElements(capacity) < _elementsCount)
+                    capacity *= 2;
+            }
+            if ((capacity & (capacity - 1)) != 0)
+            {
+                // Align capacity value to the next power of two (http://graphics.stanford.edu/~seander/bithacks.html#RoundUpPowerOf2)
+                capacity--;
+                capacity |= capacity >> 1;
+                capacity |= capacity >> 2;
+                capacity |= capacity >> 4;
+                capacity |= capacity >> 8;
+                capacity |= capacity >> 16;
+                capacity++;
+            }
+        }
+        if (capacity == _size)
+        {
+            if (!preserveContents)
+                Clear();
+            return;
+        }
+        Rehash(capacity, preserveContents);
+    }
+
+    /// <summary>
+    /// Ensures that collection can contain the given amount of the elements without resizing.
+    /// </summary>
+    /// <param name="minCapacity">The minimum required capacity (amount of the elements).</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        if (GetMaxElements(_size) >= minCapacity)
+            return;
+        int32 capacity = _allocation.CalculateCapacityGrow(_size, minCapacity + minCapacity / 7 + 1);
+        if (capacity < DICTIONARY_DEFAULT_CAPACITY)
+            capacity = DICTIONARY_DEFAULT_CAPACITY;
+        SetCapacity(capacity, preserveContents);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(FlatDictionary& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            ::Swap(_elementsCount, other._elementsCount);
+            ::Swap(_deletedCount, other._deletedCount);
+            ::Swap(_size, other._size);
+            ::Swap(_growthLeft, other._growthLeft);
+            _control.Swap(other._control);
+            _allocation.Swap(other._allocation);
+        }
+        else
+        {
+            ::Swap(other, *this);
+        }
+    }
+
+public:
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE Bucket* Add(const KeyComparableType& key, const ValueType& value)
+    {
+        Bucket* bucket = OnAdd(key);
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::ConstructItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="key">The key.</param>
+    /// <param name="value">The value.</param>
+    /// <returns>Weak reference to the stored bucket.</returns>
+    template<typename KeyComparableType>
+    FORCE_INLINE Bucket* Add(const KeyComparableType& key, ValueType&& value)
+    {
+        Bucket* bucket = OnAdd(key);
+        Memory::ConstructItems(&bucket->Key, &key, 1);
+        Memory::MoveItems(&bucket->Value, &value, 1);
+        return bucket;
+    }
+
+    /// <summary>
+    /// Add pair element to the collection.
+    /// </summary>
+    /// <param name="i">Iterator with key and value.</param>
+    void Add(const Iterator& i)
+    {
+        ASSERT(i._collection != this && i);
+        const Bucket& bucket = *i;
+        Add(bucket.Key, bucket.Value);
+    }
+
+    /// <summary>
+    /// Removes element with a specified key.
+    /// </summary>
+    /// <param name="key">The element key to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool Remove(const KeyComparableType& key)
+    {
+        if (IsEmpty())
+            return false;
+        const int32 index = FindIndex(key, GetKeyHash(key));
+        if (index != -1)
+        {
+            RemoveAt(index);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Removes element at specified iterator.
+    /// </summary>
+    /// <param name="i">The element iterator to remove.</param>
+    /// <returns>True if cannot remove item from the collection because cannot find it, otherwise false.</returns>
+    bool Remove(const Iterator& i)
+    {
+        ASSERT(i._collection == this);
+        if (i)
+        {
+            ASSERT(IsOccupied(_control.Get()[i._index]));
+            RemoveAt(i._index);
+            return true;
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Removes elements with a specified value
+    /// </summary>
+    /// <param name="value">Element value to remove</param>
+    /// <returns>The amount of removed items. Zero if nothing changed.</returns>
+    int32 RemoveValue(const ValueType& value)
+    {
+        int32 result = 0;
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value == value)
+            {
+                Remove(i);
+                result++;
+            }
+        }
+        return result;
+    }
+
+public:
+    /// <summary>
+    /// Finds the element with given key in the collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>The iterator for the found element or End if cannot find it.</returns>
+    template<typename KeyComparableType>
+    Iterator Find(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return End();
+        const int32 index = FindIndex(key, GetKeyHash(key));
+        return index != -1 ? Iterator(this, index) : End();
+    }
+
+    /// <summary>
+    /// Checks if given key is in a collection.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <returns>True if key has been found in a collection, otherwise false.</returns>
+    template<typename KeyComparableType>
+    bool ContainsKey(const KeyComparableType& key) const
+    {
+        if (IsEmpty())
+            return false;
+        return FindIndex(key, GetKeyHash(key)) != -1;
+    }
+
+    /// <summary>
+    /// Checks if given value is in a collection.
+    /// </summary>
+    /// <param name="value">The value to find.</param>
+    /// <returns>True if value has been found in a collection, otherwise false.</returns>
+    bool ContainsValue(const ValueType& value) const
+    {
+        if (HasItems())
+        {
+            const byte* control = _control.Get();
+            const Bucket* data = _allocation.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (IsOccupied(control[i]) && data[i].Value == value)
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    /// <summary>
+    /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire dictionary.
+    /// </summary>
+    /// <param name="value">The value of the key to find.</param>
+    /// <param name="key">The output key.</param>
+    /// <returns>True if value has been found, otherwise false.</returns>
+    bool KeyOf(const ValueType& value, KeyType* key) const
+    {
+        if (HasItems())
+        {
+            const byte* control = _control.Get();
+            const Bucket* data = _allocation.Get();
+            for (int32 i = 0; i < _size; i++)
+            {
+                if (IsOccupied(control[i]) && data[i].Value == value)
+                {
+                    if (key)
+                        *key = data[i].Key;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    /// <summary>
+    /// Clones other collection into this.
+    /// </summary>
+    /// <param name="other">The other collection to clone.</param>
+    void Clone(const FlatDictionary& other)
+    {
+        Clear();
+        EnsureCapacity(other.Count(), false);
+        for (Iterator i = other.Begin(); i != other.End(); ++i)
+            Add(i);
+    }
+
+    /// <summary>
+    /// Gets the keys collection to the output array (will contain unique items).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetKeys(Array<KeyType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Key);
+    }
+
+    /// <summary>
+    /// Gets the values collection to the output array (may contain duplicates).
+    /// </summary>
+    /// <param name="result">The result.</param>
+    template<typename ArrayAllocation>
+    void GetValues(Array<ValueType, ArrayAllocation>& result) const
+    {
+        for (Iterator i = Begin(); i.IsNotEnd(); ++i)
+            result.Add(i->Value);
+    }
+
+public:
+    Iterator Begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    Iterator End() const
+    {
+        return Iterator(this, _size);
+    }
+
+    Iterator begin()
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE Iterator end()
+    {
+        return Iterator(this, _size);
+    }
+
+    const Iterator begin() const
+    {
+        Iterator i(this, -1);
+        ++i;
+        return i;
+    }
+
+    FORCE_INLINE const Iterator end() const
+    {
+        return Iterator(this, _size);
+    }
+
+private:
+    /// <summary>
+    /// Finds the bucket with the given key. Probes the groups of buckets (triangular sequence that visits every group) and stops on the first group with any empty bucket.
+    /// </summary>
+    /// <param name="key">The key to find.</param>
+    /// <param name="hash">The key hash (see GetKeyHash).</param>
+    /// <returns>The bucket index or -1 if key is missing.</returns>
+    template<typename KeyComparableType>
+    int32 FindIndex(const KeyComparableType& key, uint32 hash) const
+    {
+        if (_size == 0)
+            return -1;
+        const byte h2 = (byte)(hash & 0x7f);
+        const int32 groupsMask = _size / FLAT_DICTIONARY_GROUP_SIZE - 1;
+        int32 group = (int32)(hash >> 7) & groupsMask;
+        const byte* control = _control.Get();
+        const Bucket* data = _allocation.Get();
+        for (int32 probe = 1; probe <= groupsMask + 1; probe++)
+        {
+            const byte* groupControl = control + group * FLAT_DICTIONARY_GROUP_SIZE;
+            uint32 match = SIMD::MatchBytes16(groupControl, h2);
+            while (match)
+            {
+                const int32 index = group * FLAT_DICTIONARY_GROUP_SIZE + SIMD::FirstMatch(match);
+                if (data[index].Key == key)
+                    return index;
+                match &= match - 1;
+            }
+            if (SIMD::MatchBytes16(groupControl, Empty))
+                break;
+            group = (group + probe) & groupsMask;
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Finds the first empty or deleted bucket for the new element in the probing sequence of the given hash.
+    /// </summary>
+    int32 FindInsertIndex(uint32 hash) const
+    {
+        const int32 groupsMask = _size / FLAT_DICTIONARY_GROUP_SIZE - 1;
+        int32 group = (int32)(hash >> 7) & groupsMask;
+        const byte* control = _control.Get();
+        for (int32 probe = 1; probe <= groupsMask + 1; probe++)
+        {
+            const uint32 match = SIMD::MatchBytesHighBit16(control + group * FLAT_DICTIONARY_GROUP_SIZE);
+            if (match)
+                return group * FLAT_DICTIONARY_GROUP_SIZE + SIMD::FirstMatch(match);
+            group = (group + probe) & groupsMask;
+        }
+        return -1;
+    }
+
+    /// <summary>
+    /// Occupies the bucket for the new element (key and value are not constructed). Grows or rehashes the table if needed.
+    /// </summary>
+    Bucket* Insert(uint32 hash)
+    {
+        if (_growthLeft == 0)
+        {
+            // Rehash in place if enough space is wasted by the deleted elements, otherwise grow
+            if (_deletedCount != 0 && (int64)_elementsCount * 32 <= (int64)_size * 25)
+                Rehash(_size, true);
+            else
+                EnsureCapacity(_elementsCount + _deletedCount + 1);
+        }
+        const int32 index = FindInsertIndex(hash);
+        ASSERT(index != -1);
+        byte& control = _control.Get()[index];
+        if (control == Empty)
+            _growthLeft--;
+        else
+            _deletedCount--;
+        control = (byte)(hash & 0x7f);
+        _elementsCount++;
+        return &_allocation.Get()[index];
+    }
+
+    template<typename KeyComparableType>
+    Bucket* OnAdd(const KeyComparableType& key)
+    {
+        const uint32 hash = GetKeyHash(key);
+
+        // Ensure key is unknown
+        ASSERT(FindIndex(key, hash) == -1 && "That key has been already added to the dictionary.");
+
+        return Insert(hash);
+    }
+
+    void RemoveAt(int32 index)
+    {
+        Bucket& bucket = _allocation.Get()[index];
+        Memory::DestructItem(&bucket.Key);
+        Memory::DestructItem(&bucket.Value);
+        _elementsCount--;
+
+        // Lookups stop on the group with any empty bucket so the bucket doesn't need a tombstone if the group wasn't full
+        byte* control = _control.Get();
+        if (SIMD::MatchBytes16(control + (index & ~(FLAT_DICTIONARY_GROUP_SIZE - 1)), Empty))
+        {
+            control[index] = Empty;
+            _growthLeft++;
+        }
+        else
+        {
+            control[index] = Deleted;
+            _deletedCount++;
+        }
+    }
+
+    void Rehash(int32 capacity, bool preserveContents)
+    {
+        ControlAllocationData oldControl;
+        AllocationData oldAllocation;
+        MoveToEmpty(oldControl, oldAllocation, _control, _allocation, _size);
+        const int32 oldSize = _size;
+        _elementsCount = _deletedCount = 0;
+        _size = capacity;
+        _growthLeft = GetMaxElements(capacity);
+        if (capacity)
+        {
+            _control.Allocate(capacity);
+            _allocation.Allocate(capacity);
+            Platform::MemorySet(_control.Get(), capacity, Empty);
+        }
+        byte* oldControlData = oldControl.Get();
+        Bucket* oldData = oldAllocation.Get();
+        for (int32 i = 0; i < oldSize; i++)
+        {
+            if (IsOccupied(oldControlData[i]))
+            {
+                Bucket& oldBucket = oldData[i];
+                if (preserveContents && capacity)
+                {
+                    Bucket* bucket = Insert(GetKeyHash(oldBucket.Key));
+                    Memory::MoveItems(&bucket->Key, &oldBucket.Key, 1);
+                    Memory::MoveItems(&bucket->Value, &oldBucket.Value, 1);
+                }
+                Memory::DestructItem(&oldBucket.Key);
+                Memory::DestructItem(&oldBucket.Value);
+            }
+        }
+    }
+};
@@ -0,0 +1,554 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Platform.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Memory/Allocation.h"
+
+// The granularity of the SoA array capacity (in elements). Columns are padded so the hot loops can process the items in groups of 4 (eg. SSE/NEON) without the scalar tail.
+#define SOA_ARRAY_CAPACITY_GRANULARITY 4
+
+namespace SoAArrayImpl
+{
+    template<int32 Index, typename... Ts>
+    struct TypeAt;
+
+    template<typename T, typename... Ts>
+    struct TypeAt<0, T, Ts...>
+    {
+        typedef T Type;
+    };
+
+    template<int32 Index, typename T, typename... Ts>
+    struct TypeAt<Index, T, Ts...>
+    {
+        typedef typename TypeAt<Index - 1, Ts...>::Type Type;
+    };
+
+    template<int32 Index>
+    struct ColumnIndex
+    {
+    };
+
+    template<int32 Index, typename AllocationType, typename... Ts>
+    struct Columns
+    {
+        FORCE_INLINE void Allocate(int32 capacity)
+        {
+        }
+
+        FORCE_INLINE void Relocate(int32 capacity, int32 oldCount, int32 newCount)
+        {
+        }
+
+        FORCE_INLINE void Free()
+        {
+        }
+
+        FORCE_INLINE void Swap(Columns& other)
+        {
+        }
+
+        FORCE_INLINE void ConstructItems(int32 start, int32 count)
+        {
+        }
+
+        FORCE_INLINE void ConstructItems(int32 start, const Columns& other, int32 count)
+        {
+        }
+
+        FORCE_INLINE void DestructItems(int32 start, int32 count)
+        {
+        }
+
+        FORCE_INLINE void MoveItem(int32 dst, int32 src)
+        {
+        }
+
+        FORCE_INLINE void Set(int32 index)
+        {
+        }
+
+        FORCE_INLINE void GetColumn() const
+        {
+        }
+    };
+
+    // Single column storage (uses separate allocation per column so it works with any allocation policy), the other columns are stored in the base
+    template<int32 Index, typename AllocationType, typename T, typename... Ts>
+    struct Columns<Index, AllocationType, T, Ts...> : Columns<Index + 1, AllocationType, Ts...>
+    {
+        typedef Columns<Index + 1, AllocationType, Ts...> Base;
+        typename AllocationType::template Data<T> Data;
+
+        using Base::GetColumn;
+
+        FORCE_INLINE T* GetColumn(ColumnIndex<Index>)
+        {
+            return Data.Get();
+        }
+
+        FORCE_INLINE const T* GetColumn(ColumnIndex<Index>) const
+        {
+            return Data.Get();
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            return Data.CalculateCapacityGrow(capacity, minCapacity);
+        }
+
+        FORCE_INLINE void Allocate(int32 capacity)
+        {
+            Data.Allocate(capacity);
+            Base::Allocate(capacity);
+        }
+
+        FORCE_INLINE void Relocate(int32 capacity, int32 oldCount, int32 newCount)
+        {
+            Data.Relocate(capacity, oldCount, newCount);
+            Base::Relocate(capacity, oldCount, newCount);
+        }
+
+        FORCE_INLINE void Free()
+        {
+            Data.Free();
+            Base::Free();
+        }
+
+        FORCE_INLINE void Swap(Columns& other)
+        {
+            Data.Swap(other.Data);
+            Base::Swap(other);
+        }
+
+        FORCE_INLINE void ConstructItems(int32 start, int32 count)
+        {
+            Memory::ConstructItems(Data.Get() + start, count);
+            Base::ConstructItems(start, count);
+        }
+
+        FORCE_INLINE void ConstructItems(int32 start, const Columns& other, int32 count)
+        {
+            Memory::ConstructItems(Data.Get() + start, other.Data.Get(), count);
+            Base::ConstructItems(start, other, count);
+        }
+
+        FORCE_INLINE void DestructItems(int32 start, int32 count)
+        {
+            Memory::DestructItems(Data.Get() + start, count);
+            Base::DestructItems(start, count);
+        }
+
+        FORCE_INLINE void MoveItem(int32 dst, int32 src)
+        {
+            T* data = Data.Get();
+            data[dst] = MoveTemp(data[src]);
+            Base::MoveItem(dst, src);
+        }
+
+        template<typename... Args>
+        FORCE_INLINE void Set(int32 index, const T& value, const Args&... values)
+        {
+            Data.Get()[index] = value;
+            Base::Set(index, values...);
+        }
+    };
+}
+
+/// <summary>
+/// Template for dynamic array with variable capacity that stores the elements in the Structure-of-Arrays layout (each field of the element is stored in a separate, linear column). Use it for the hot data that is processed in bulk (eg. culling bounds, instances transforms or particle attributes) so the loops touch only the used columns and can be vectorized.
+/// </summary>
+/// <remarks>
+/// Columns use separate allocation each (from the given allocation policy) so heap-based allocations are 16-bytes aligned. Heap-based capacity is always a multiple of SOA_ARRAY_CAPACITY_GRANULARITY (use multiples of it for the fixed/inlined allocations too).
+/// Items removal via RemoveAt swaps the last item into the removed slot (order is not preserved).
+/// </remarks>
+/// <typeparam name="AllocationType">The type of memory allocator (used for each column).</typeparam>
+/// <typeparam name="Ts">The types of the columns.</typeparam>
+template<typename AllocationType, typename... Ts>
+class SoAArrayBase
+{
+    static_assert(sizeof...(Ts) > 0, "SoA array requires at least one column.");
+    friend SoAArrayBase;
+
+public:
+    /// <summary>
+    /// The amount of the columns.
+    /// </summary>
+    static constexpr int32 ColumnsCount = (int32)sizeof...(Ts);
+
+    /// <summary>
+    /// The type of the column at the given index.
+    /// </summary>
+    template<int32 Index>
+    using ColumnType = typename SoAArrayImpl::TypeAt<Index, Ts...>::Type;
+
+private:
+    typedef SoAArrayImpl::Columns<0, AllocationType, Ts...> ColumnsData;
+
+    int32 _count;
+    int32 _capacity;
+    ColumnsData _columns;
+
+    FORCE_INLINE static int32 AlignCapacity(int32 capacity)
+    {
+        return (capacity + (SOA_ARRAY_CAPACITY_GRANULARITY - 1)) & ~(SOA_ARRAY_CAPACITY_GRANULARITY - 1);
+    }
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SoAArrayBase"/> class.
+    /// </summary>
+    FORCE_INLINE SoAArrayBase()
+        : _count(0)
+        , _capacity(0)
+    {
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SoAArrayBase"/> class.
+    /// </summary>
+    /// <param name="capacity">The initial capacity.</param>
+    SoAArrayBase(int32 capacity)
+        : _count(0)
+        , _capacity(capacity > 0 ? AlignCapacity(capacity) : 0)
+    {
+        if (_capacity > 0)
+            _columns.Allocate(_capacity);
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SoAArrayBase"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    SoAArrayBase(const SoAArrayBase& other)
+    {
+        _count = other._count;
+        _capacity = _count > 0 ? AlignCapacity(_count) : 0;
+        if (_capacity > 0)
+        {
+            _columns.Allocate(_capacity);
+            _columns.ConstructItems(0, other._columns, _count);
+        }
+    }
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SoAArrayBase"/> class.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    SoAArrayBase(SoAArrayBase&& other) noexcept
+        : _count(0)
+        , _capacity(0)
+    {
+        Swap(other);
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="SoAArrayBase"/> class.
+    /// </summary>
+    ~SoAArrayBase()
+    {
+        _columns.DestructItems(0, _count);
+        _columns.Free();
+    }
+
+    /// <summary>
+    /// The assignment operator that deletes the current collection of items and the copies items from the other array.
+    /// </summary>
+    /// <param name="other">The other collection to copy.</param>
+    /// <returns>The reference to this.</returns>
+    SoAArrayBase& operator=(const SoAArrayBase& other) noexcept
+    {
+        if (this != &other)
+        {
+            _columns.DestructItems(0, _count);
+            _count = 0;
+            EnsureCapacity(other._count, false);
+            _columns.ConstructItems(0, other._columns, other._count);
+            _count = other._count;
+        }
+        return *this;
+    }
+
+    /// <summary>
+    /// The move assignment operator that deletes the current collection of items and the moves items from the other array.
+    /// </summary>
+    /// <param name="other">The other collection to move.</param>
+    /// <returns>The reference to this.</returns>
+    SoAArrayBase& operator=(SoAArrayBase&& other) noexcept
+    {
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+public:
+    /// <summary>
+    /// Gets the amount of the items in the collection.
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return _count;
+    }
+
+    /// <summary>
+    /// Gets the amount of the items that can be contained by collection without resizing.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return _capacity;
+    }
+
+    /// <summary>
+    /// Returns true if collection isn't empty.
+    /// </summary>
+    FORCE_INLINE bool HasItems() const
+    {
+        return _count != 0;
+    }
+
+    /// <summary>
+    /// Returns true if collection is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _count == 0;
+    }
+
+    /// <summary>
+    /// Determines if given index is valid.
+    /// </summary>
+    /// <param name="index">The index.</param>
+    /// <returns><c>true</c> if is valid a index; otherwise, <c>false</c>.</returns>
+    FORCE_INLINE bool IsValidIndex(int32 index) const
+    {
+        return index < _count && index >= 0;
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first item of the column (linear memory of Count() items).
+    /// </summary>
+    template<int32 Column>
+    FORCE_INLINE ColumnType<Column>* Get()
+    {
+        return _columns.GetColumn(SoAArrayImpl::ColumnIndex<Column>());
+    }
+
+    /// <summary>
+    /// Gets the pointer to the first item of the column (linear memory of Count() items).
+    /// </summary>
+    template<int32 Column>
+    FORCE_INLINE const ColumnType<Column>* Get() const
+    {
+        return _columns.GetColumn(SoAArrayImpl::ColumnIndex<Column>());
+    }
+
+    /// <summary>
+    /// Gets the item field from the column at the given index.
+    /// </summary>
+    /// <param name="index">The item index.</param>
+    /// <returns>The reference to the item field.</returns>
+    template<int32 Column>
+    FORCE_INLINE ColumnType<Column>& At(int32 index)
+    {
+        ASSERT(index >= 0 && index < _count);
+        return Get<Column>()[index];
+    }
+
+    /// <summary>
+    /// Gets the item field from the column at the given index.
+    /// </summary>
+    /// <param name="index">The item index.</param>
+    /// <returns>The reference to the item field.</returns>
+    template<int32 Column>
+    FORCE_INLINE const ColumnType<Column>& At(int32 index) const
+    {
+        ASSERT(index >= 0 && index < _count);
+        return Get<Column>()[index];
+    }
+
+public:
+    /// <summary>
+    /// Clear the collection without changing its capacity.
+    /// </summary>
+    void Clear()
+    {
+        _columns.DestructItems(0, _count);
+        _count = 0;
+    }
+
+    /// <summary>
+    /// Changes the capacity of the collection.
+    /// </summary>
+    /// <param name="capacity">The new capacity (rounded up to SOA_ARRAY_CAPACITY_GRANULARITY).</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void SetCapacity(int32 capacity, bool preserveContents = true)
+    {
+        ASSERT(capacity >= 0);
+        Relocate(AlignCapacity(capacity), preserveContents);
+    }
+
+    /// <summary>
+    /// Resizes the collection to the specified size. If the size is equal or less to the current capacity no additional memory reallocation in performed.
+    /// </summary>
+    /// <param name="size">The new collection size.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize might not contain the previous data.</param>
+    void Resize(int32 size, bool preserveContents = true)
+    {
+        if (_count > size)
+        {
+            _columns.DestructItems(size, _count - size);
+        }
+        else
+        {
+            EnsureCapacity(size, preserveContents);
+            _columns.ConstructItems(_count, size - _count);
+        }
+        _count = size;
+    }
+
+    /// <summary>
+    /// Ensures the collection has given capacity (or more).
+    /// </summary>
+    /// <param name="minCapacity">The minimum capacity.</param>
+    /// <param name="preserveContents">True if preserve collection data when changing its size, otherwise collection after resize will be empty.</param>
+    void EnsureCapacity(int32 minCapacity, bool preserveContents = true)
+    {
+        if (_capacity < minCapacity)
+        {
+            // The allocation policy decides on the grow (eg. fixed allocation capacity), heap allocation grows in powers of two which keeps the granularity
+            const int32 capacity = _columns.CalculateCapacityGrow(_capacity, minCapacity);
+            Relocate(capacity, preserveContents);
+        }
+    }
+
+    /// <summary>
+    /// Adds the new item at the end of the collection.
+    /// </summary>
+    /// <param name="values">The item fields (one per column).</param>
+    /// <returns>The index of the added item.</returns>
+    int32 Add(const Ts&... values)
+    {
+        const int32 index = AddDefault(1);
+        _columns.Set(index, values...);
+        return index;
+    }
+
+    /// <summary>
+    /// Adds the given amount of default-constructed items at the end of the collection.
+    /// </summary>
+    /// <param name="count">The amount of items to add.</param>
+    /// <returns>The index of the first added item.</returns>
+    int32 AddDefault(int32 count = 1)
+    {
+        ASSERT(count >= 0);
+        const int32 index = _count;
+        EnsureCapacity(_count + count);
+        _columns.ConstructItems(_count, count);
+        _count += count;
+        return index;
+    }
+
+    /// <summary>
+    /// Removes the item at the specified index of the collection. The last item is moved into the removed item slot (order is not preserved).
+    /// </summary>
+    /// <param name="index">The zero-based index of the item to remove.</param>
+    void RemoveAt(int32 index)
+    {
+        ASSERT(index < _count && index >= 0);
+        _count--;
+        if (index != _count)
+            _columns.MoveItem(index, _count);
+        _columns.DestructItems(_count, 1);
+    }
+
+    /// <summary>
+    /// Removes the last item from the collection.
+    /// </summary>
+    void RemoveLast()
+    {
+        ASSERT(_count > 0);
+        _count--;
+        _columns.DestructItems(_count, 1);
+    }
+
+    /// <summary>
+    /// Swaps the contents of collection with the other object without copy operation. Performs fast internal data exchange.
+    /// </summary>
+    /// <param name="other">The other collection.</param>
+    void Swap(SoAArrayBase& other)
+    {
+        if IF_CONSTEXPR (AllocationType::HasSwap)
+        {
+            _columns.Swap(other._columns);
+            ::Swap(_count, other._count);
+            ::Swap(_capacity, other._capacity);
+        }
+        else
+        {
+            ::Swap(other, *this);
+        }
+    }
+
+public:
+    /// <summary>
+    /// Iterates over the items and invokes the function with the fields from the selected columns, eg. ForEach&lt;0, 2&gt;([](Float3& position, const float& radius) { ... }).
+    /// </summary>
+    /// <param name="func">The function to call for each item (arguments are references to the fields of the selected columns).</param>
+    template<int32... Columns, typename Func>
+    FORCE_INLINE void ForEach(Func func)
+    {
+        ForEach<Columns...>(0, _count, func);
+    }
+
+    /// <summary>
+    /// Iterates over the range of items and invokes the function with the fields from the selected columns (eg. to process the items in a job batch).
+    /// </summary>
+    /// <param name="start">The index of the first item to process.</param>
+    /// <param name="end">The index after the last item to process.</param>
+    /// <param name="func">The function to call for each item (arguments are references to the fields of the selected columns).</param>
+    template<int32... Columns, typename Func>
+    void ForEach(int32 start, int32 end, Func func)
+    {
+        ASSERT(start >= 0 && start <= end && end <= _count);
+        ForEachColumns(start, end, func, Get<Columns>()...);
+    }
+
+    /// <summary>
+    /// Iterates over the items and invokes the function with the fields from the selected columns, eg. ForEach&lt;0, 2&gt;([](const Float3& position, const float& radius) { ... }).
+    /// </summary>
+    /// <param name="func">The function to call for each item (arguments are references to the fields of the selected columns).</param>
+    template<int32... Columns, typename Func>
+    FORCE_INLINE void ForEach(Func func) const
+    {
+        ForEachColumns(0, _count, func, Get<Columns>()...);
+    }
+
+private:
+    void Relocate(int32 capacity, bool preserveContents)
+    {
+        if (capacity == _capacity)
+            return;
+        const int32 count = preserveContents ? (_count < capacity ? _count : capacity) : 0;
+        _columns.Relocate(capacity, _count, count);
+        _capacity = capacity;
+        _count = count;
+    }
+
+    template<typename Func, typename... Ptrs>
+    FORCE_INLINE static void ForEachColumns(int32 start, int32 end, Func& func, Ptrs... columns)
+    {
+        for (int32 i = start; i < end; i++)
+            func(columns[i]...);
+    }
+};
+
+/// <summary>
+/// Template for dynamic array with variable capacity that stores the elements in the Structure-of-Arrays layout and uses default heap allocator (see SoAArrayBase).
+/// </summary>
+template<typename... Ts>
+using SoAArray = SoAArrayBase<HeapAllocation, Ts...>;
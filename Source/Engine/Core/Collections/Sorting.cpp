@@ -2,7 +2,16 @@
 
 #include "Sorting.h"
 #include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The minimum amount of elements to use parallel radix sort
+#define SORTING_RADIX_PARALLEL_MIN_COUNT (32 * 1024)
+// The minimum amount of elements to sort within a single job
+#define SORTING_RADIX_PARALLEL_BLOCK_SIZE (8 * 1024)
 
 // Use a cached storage for the sorting (one per thread to reduce locking)
 ThreadLocal<Sorting::SortingStack*> SortingStacks;
@@ -53,3 +62,124 @@ void Sorting::SortingStack::EnsureCapacity(int32 minCapacity)
         num = minCapacity;
     SetCapacity(num);
 }
+
+namespace
+{
+    template<typename T>
+    void RadixSortParallel(T*& inputKeys, int32*& inputValues, T* tmpKeys, int32* tmpValues, int32 count, int32 threadsCount)
+    {
+        // Parallel version of the Sorting::RadixSort where each pass is split into blocks that build local histograms and then scatter elements into the ranges of the global histogram (ordered by block to keep sorting stable)
+        PROFILE_CPU();
+        enum
+        {
+            RADIXSORT_BITS = 11,
+            RADIXSORT_HISTOGRAM_SIZE = 1 << RADIXSORT_BITS,
+            RADIXSORT_BIT_MASK = RADIXSORT_HISTOGRAM_SIZE - 1,
+            RADIXSORT_PASSES = (sizeof(T) * 8 + RADIXSORT_BITS - 1) / RADIXSORT_BITS,
+        };
+        const int32 blocksCount = Math::Min(threadsCount * 4, (count + SORTING_RADIX_PARALLEL_BLOCK_SIZE - 1) / SORTING_RADIX_PARALLEL_BLOCK_SIZE);
+        const int32 blockSize = (count + blocksCount - 1) / blocksCount;
+        Array<uint32> histograms;
+        histograms.Resize(blocksCount * RADIXSORT_HISTOGRAM_SIZE);
+        Array<byte> blocksSorted;
+        blocksSorted.Resize(blocksCount);
+
+        T* keys = inputKeys;
+        T* tempKeys = tmpKeys;
+        int32* values = inputValues;
+        int32* tempValues = tmpValues;
+        uint32 shift = 0;
+        int32 pass = 0;
+        for (; pass < RADIXSORT_PASSES; pass++)
+        {
+            // Build histograms for each block
+            JobSystem::Execute([&](int32 block)
+            {
+                const int32 start = block * blockSize;
+                const int32 end = Math::Min(start + blockSize, count);
+                uint32* histogram = histograms.Get() + block * RADIXSORT_HISTOGRAM_SIZE;
+                Platform::MemoryClear(histogram, sizeof(uint32) * RADIXSORT_HISTOGRAM_SIZE);
+                bool sorted = true;
+                T prevKey = keys[start];
+                for (int32 i = start; i < end; i++)
+                {
+                    const T key = keys[i];
+                    ++histogram[(key >> shift) & RADIXSORT_BIT_MASK];
+                    sorted &= prevKey <= key;
+                    prevKey = key;
+                }
+                blocksSorted[block] = sorted;
+            }, blocksCount);
+
+            // Early out if data is already sorted
+            bool sorted = blocksSorted[0] != 0;
+            for (int32 block = 1; block < blocksCount && sorted; block++)
+                sorted = blocksSorted[block] && keys[block * blockSize - 1] <= keys[block * blockSize];
+            if (sorted)
+                break;
+
+            // Convert histograms into the output offsets of each block
+            uint32 offset = 0;
+            for (int32 i = 0; i < RADIXSORT_HISTOGRAM_SIZE; i++)
+            {
+                for (int32 block = 0; block < blocksCount; block++)
+                {
+                    uint32& value = histograms[block * RADIXSORT_HISTOGRAM_SIZE + i];
+                    const uint32 cnt = value;
+                    value = offset;
+                    offset += cnt;
+                }
+            }
+
+            // Scatter elements
+            JobSystem::Execute([&](int32 block)
+            {
+                const int32 start = block * blockSize;
+                const int32 end = Math::Min(start + blockSize, count);
+                uint32* histogram = histograms.Get() + block * RADIXSORT_HISTOGRAM_SIZE;
+                for (int32 i = start; i < end; i++)
+                {
+                    const T k = keys[i];
+                    const uint32 dest = histogram[(k >> shift) & RADIXSORT_BIT_MASK]++;
+                    tempKeys[dest] = k;
+                    tempValues[dest] = values[i];
+                }
+            }, blocksCount);
+
+            T* const swapKeys = tempKeys;
+            tempKeys = keys;
+            keys = swapKeys;
+
+            int32* const swapValues = tempValues;
+            tempValues = values;
+            values = swapValues;
+
+            shift += RADIXSORT_BITS;
+        }
+
+        if (pass & 1)
+        {
+            // Use temporary keys and values as a result
+            inputKeys = tmpKeys;
+            inputValues = tmpValues;
+        }
+    }
+}
+
+void Sorting::RadixSort(uint64*& inputKeys, int32*& inputValues, uint64* tmpKeys, int32* tmpValues, int32 count)
+{
+    const int32 threadsCount = JobSystem::GetThreadsCount();
+    if (count >= SORTING_RADIX_PARALLEL_MIN_COUNT && threadsCount > 1)
+        RadixSortParallel(inputKeys, inputValues, tmpKeys, tmpValues, count, threadsCount);
+    else
+        RadixSort<uint64, int32>(inputKeys, inputValues, tmpKeys, tmpValues, count);
+}
+
+void Sorting::RadixSort(uint32*& inputKeys, int32*& inputValues, uint32* tmpKeys, int32* tmpValues, int32 count)
+{
+    const int32 threadsCount = JobSystem::GetThreadsCount();
+    if (count >= SORTING_RADIX_PARALLEL_MIN_COUNT && threadsCount > 1)
+        RadixSortParallel(inputKeys, inputValues, tmpKeys, tmpValues, count, threadsCount);
+    else
+        RadixSort<uint32, int32>(inputKeys, inputValues, tmpKeys, tmpValues, count);
+}
@@ -28,6 +28,9 @@
 #ifndef COMPILE_WITH_DEV_ENV
 #define COMPILE_WITH_DEV_ENV 1
 #endif
+#ifndef USE_THREAD_CACHE_ALLOCATOR
+#define USE_THREAD_CACHE_ALLOCATOR 0
+#endif
 
 // Enable logging service (saving log to file, can be disabled using -nolog command line)
 #define LOG_ENABLE 1
@@ -89,6 +89,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(2100), EditorDisplay(\"Content\")")
     bool SkipDefaultFonts = false;
 
+    /// <summary>
+    /// If checked, the models and animations data will be compressed (LZ4) in the cooked game packages. Reduces the build size at the cost of the data decompression during loading.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2110), EditorDisplay(\"Content\")")
+    bool CompressMeshesAndAnimations = false;
+
     /// <summary>
     /// If checked, .NET Runtime won't be packaged with a game and will be required by user to be installed on system upon running game build. Available only on supported platforms such as Windows, Linux and macOS.
     /// </summary>
@@ -65,6 +65,66 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1320), DefaultValue(false), EditorDisplay(\"Quality\", \"Allow CSM Blending\")")
     bool AllowCSMBlending = false;
 
+    /// <summary>
+    /// Enables GPU-driven rendering of the static models (culling and draw arguments generation on GPU with indirect drawing). Reduces CPU cost of drawing scenes with large amount of static objects.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1330), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable GPU-Driven Rendering\")")
+    bool EnableGPUDrivenRendering = false;
+
+    /// <summary>
+    /// Enables occlusion culling of the objects using the hierarchical depth buffer (HZB) from the previous frames. Reduces the amount of drawn objects in scenes with large occluders (eg. interiors or cities). Objects revealed by fast camera movement can appear with a frame or two of latency.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1340), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Occlusion Culling\")")
+    bool EnableOcclusionCulling = false;
+
+    /// <summary>
+    /// Enables skinning of the animated models with compute shaders. Skinned vertices are cached per-instance once per bones update and all passes (GBuffer, depth, shadows) draw them as static geometry. Reduces GPU cost of skinned meshes in scenes with many shadow-casting lights at cost of additional memory usage.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1350), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Compute Skinning\")")
+    bool EnableComputeSkinning = false;
+
+    /// <summary>
+    /// Enables recording of the large draw calls lists (eg. GBuffer pass) in parallel on the worker threads using the deferred GPU contexts (if supported by the graphics backend). Reduces the rendering thread cost in scenes with many drawn objects.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1360), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Parallel Draw Calls\")")
+    bool EnableParallelDrawCalls = false;
+
+    /// <summary>
+    /// Enables executing some of the compute passes (eg. Global SDF update) on the async compute queue to overlap with the graphics work (if supported by the graphics backend). Materials sampling Global SDF during GBuffer pass use the previous frame data.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1370), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Async Compute\")")
+    bool EnableAsyncCompute = false;
+
+    /// <summary>
+    /// Enables caching of the far directional light shadow cascades (third and further) that are updated at a staggered rate (cascade 3 every 2nd frame, cascade 4 every 4th frame) or when the view moves outside the cached cascade bounds. Reduces the cost of the cascaded shadows rendering in large outdoor scenes at cost of additional shadow map memory per view and slightly lower resolution of the far cascades.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1380), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Cached Shadow Cascades\")")
+    bool EnableCachedShadowCascades = false;
+
+    /// <summary>
+    /// Enables clustered deferred lighting: local lights without shadows and IES profiles are culled into the clustered lights grid (shared with the forward shading) and drawn in a single fullscreen pass (instead of a separate light volume pass per light). Reduces the GBuffer re-reads and overdraw in scenes with many small lights. Requires Shader Model 5.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1390), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Clustered Lighting\")")
+    bool EnableClusteredLighting = false;
+
+    /// <summary>
+    /// Enables Variable Rate Shading (tier 2) of the scene geometry in GBuffer and forward passes. The shading rate image is generated from the previous frame luminance contrast and motion vectors so the flat or fast-moving screen areas are shaded at the reduced rate (up to 4x4 pixels). Supported only on DirectX 12 with compatible GPUs (ignored otherwise).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1400), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Variable Rate Shading\")")
+    bool EnableVariableRateShading = false;
+
+    /// <summary>
+    /// Enables automatic instancing of the static models that use the same model and materials. Such actors are grouped into spatial clusters that are culled as a whole and drawn with a single instanced draw call per mesh. Reduces CPU cost of drawing scenes with many copies of the same static objects (eg. props or modular buildings).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1410), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Auto Instancing\")")
+    bool EnableAutoInstancing = false;
+
+    /// <summary>
+    /// Enables frame pipelining: the swap chains are presented on a dedicated render thread while the main thread proceeds with the next frame update. Hides the present and vertical synchronization wait time behind the game logic at the cost of up to one frame of additional input latency.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1420), DefaultValue(false), EditorDisplay(\"Quality\", \"Enable Frame Pipelining\")")
+    bool EnableFramePipelining = false;
+
     /// <summary>
     /// Default probes cubemap resolution (use for Environment Probes, can be overriden per-actor).
     /// </summary>
@@ -115,6 +175,24 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(2130), Limit(256, 8192), EditorDisplay(\"Global Illumination\")")
     int32 GlobalSurfaceAtlasResolution = 2048;
 
+    /// <summary>
+    /// The maximum amount of particle emitters simulated during a single frame. Effects with the lowest significance over the budget are simulated at lower rate (if visible) or frozen (if not visible). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2200), Limit(0), EditorDisplay("Particles")")
+    int32 MaxSimulatedParticleEmitters = 0;
+
+    /// <summary>
+    /// The maximum amount of particles simulated during a single frame (CPU and GPU). Effects with the lowest significance over the budget are simulated at lower rate (if visible) or frozen (if not visible). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2210), Limit(0), EditorDisplay("Particles")")
+    int32 MaxSimulatedParticles = 0;
+
+    /// <summary>
+    /// The maximum amount of GPU particles simulated during a single frame (GPU simulation cost estimated from the dispatched threads). Effects with the lowest significance over the budget are simulated at lower rate (if visible) or frozen (if not visible). Use 0 to disable the limit.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(2220), Limit(0), EditorDisplay("Particles", "Max Simulated GPU Particles")")
+    int32 MaxSimulatedGPUParticles = 0;
+
     /// <summary>
     /// The default Post Process settings. Can be overriden by PostFxVolume on a level locally, per camera or for a whole map.
     /// </summary>
@@ -43,6 +43,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(20), Limit(0.1f, 1000.0f, 0.01f), EditorDisplay(\"General\")")
     float MaxUpdateDeltaTime = 0.1f;
 
+    /// <summary>
+    /// Enables low-latency frame pacing: engine loop precisely waits for the next tick, waits for the swap chain to be ready for a new frame and then samples the input right before updating and rendering it. Reduces input latency and frame-time jitter at the cost of higher CPU usage.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), EditorDisplay(\"General\")")
+    bool LowLatencyMode = false;
+
 public:
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
@@ -8,6 +8,10 @@
 #include "Engine/Engine/Globals.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Threading/ConcurrentRingBuffer.h"
+#include "Engine/Threading/IRunnable.h"
 #include "Engine/Serialization/FileWriteStream.h"
 #include "Engine/Debug/Exceptions/Exceptions.h"
 #if USE_EDITOR
@@ -17,13 +21,196 @@
 
 #define LOG_ENABLE_FILE (!PLATFORM_SWITCH)
 
+// The maximum amount of the messages queued for the async log writer (the new messages are dropped when it's reached, except errors that are written synchronously)
+#define LOG_ASYNC_QUEUE_CAPACITY (16 * 1024)
+
+// The amount of messages dequeued by the async log writer at once
+#define LOG_ASYNC_BATCH_SIZE 256
+
+// The interval (in milliseconds) at which the async log writer writes the queued messages
+#define LOG_ASYNC_WRITE_INTERVAL 50
+
 namespace
 {
+    struct LogAsyncEntry
+    {
+        Char* Data;
+        int32 Length;
+    };
+
     bool LogAfterInit = false, IsDuringLog = false;
     int LogTotalErrorsCnt = 0;
     FileWriteStream* LogFile = nullptr;
     CriticalSection LogLocker;
     DateTime LogStartTime;
+
+    // Async log writer state (producers use lock-free bounded queue, it's drained only under the log locker so there is always a single consumer)
+    volatile int64 LogAsync = 0;
+    volatile int64 LogAsyncProducers = 0;
+    MPSCRingBuffer<LogAsyncEntry>* LogAsyncQueue = nullptr;
+    volatile int64 LogAsyncDropped = 0;
+    volatile int64 LogAsyncExit = 0;
+    Thread* LogAsyncThread = nullptr;
+    CriticalSection LogAsyncSignalLocker;
+    ConditionVariable LogAsyncSignal;
+
+    void WriteOutput(const Char* ptr, int32 length)
+    {
+        // Send message to standard process output
+        if (CommandLine::Options.Std)
+        {
+#if PLATFORM_TEXT_IS_CHAR16
+            StringAnsi ansi(ptr, length);
+            ansi += PLATFORM_LINE_TERMINATOR;
+            printf("%s", ansi.Get());
+#else
+            std::wcout.write(ptr, length);
+            std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
+#endif
+        }
+
+        // Send message to platform logging
+        Platform::Log(StringView(ptr, length));
+
+        // Write message to log file
+        if (LogAfterInit)
+        {
+            LogFile->WriteBytes(ptr, length * sizeof(Char));
+            LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
+        }
+    }
+
+    // Writes the queued async messages (called under the log locker)
+    void WriteQueue()
+    {
+        LogAsyncEntry entries[LOG_ASYNC_BATCH_SIZE];
+        bool anyWritten = false;
+        while (true)
+        {
+            const int32 count = LogAsyncQueue->TryDequeue(entries, LOG_ASYNC_BATCH_SIZE);
+            if (count == 0)
+                break;
+            for (int32 i = 0; i < count; i++)
+            {
+                const LogAsyncEntry& e = entries[i];
+                WriteOutput(e.Data, e.Length);
+                Allocator::Free(e.Data);
+            }
+            anyWritten = true;
+        }
+        const int64 dropped = Platform::AtomicRead(&LogAsyncDropped);
+        if (dropped != 0)
+        {
+            Platform::InterlockedAdd(&LogAsyncDropped, -dropped);
+            const String msg = String::Format(TEXT("[ Log ]: Dropped {0} messages (async log queue overflow)"), dropped);
+            WriteOutput(msg.Get(), msg.Length());
+            anyWritten = true;
+        }
+
+        // Flush file once per batch
+        if (anyWritten && LogAfterInit)
+            LogFile->Flush();
+    }
+
+    class LogAsyncWriter : public IRunnable
+    {
+    public:
+        // [IRunnable]
+        String ToString() const override
+        {
+            return TEXT("LogAsyncWriter");
+        }
+
+        int32 Run() override
+        {
+            while (Platform::AtomicRead(&LogAsyncExit) == 0)
+            {
+                LogAsyncSignalLocker.Lock();
+                LogAsyncSignal.Wait(LogAsyncSignalLocker, LOG_ASYNC_WRITE_INTERVAL);
+                LogAsyncSignalLocker.Unlock();
+
+                LogLocker.Lock();
+                if (!IsDuringLog)
+                {
+                    IsDuringLog = true;
+                    WriteQueue();
+                    IsDuringLog = false;
+                }
+                LogLocker.Unlock();
+            }
+            return 0;
+        }
+
+        void AfterWork(bool wasKilled) override
+        {
+            Delete(this);
+        }
+    };
+
+    void WriteMessage(const Char* ptr, int32 length, bool isError)
+    {
+        if (length <= 0)
+            return;
+
+        if (Platform::AtomicRead(&LogAsync) != 0)
+        {
+            // Producers are counted so the queue gets freed only after all of them are done with it (see Dispose)
+            Platform::InterlockedIncrement(&LogAsyncProducers);
+            bool queued = false, full = false;
+            if (Platform::AtomicRead(&LogAsync) != 0)
+            {
+                // Queue message for the background writer
+                const int64 size = length * sizeof(Char);
+                LogAsyncEntry e;
+                e.Data = (Char*)Allocator::Allocate(size);
+                e.Length = length;
+                Platform::MemoryCopy(e.Data, ptr, size);
+                queued = LogAsyncQueue->TryEnqueue(e);
+                if (!queued)
+                {
+                    Allocator::Free(e.Data);
+                    full = true;
+                }
+            }
+            Platform::InterlockedDecrement(&LogAsyncProducers);
+            if (queued)
+                return;
+            if (full && !isError)
+            {
+                // Drop message if writer cannot keep up to keep memory usage bounded
+                Platform::InterlockedIncrement(&LogAsyncDropped);
+                return;
+            }
+        }
+
+        LogLocker.Lock();
+        if (IsDuringLog)
+        {
+            LogLocker.Unlock();
+            return;
+        }
+        IsDuringLog = true;
+
+        if (Platform::AtomicRead(&LogAsync) != 0)
+        {
+            // Errors are never dropped: write the queued messages first (to keep the order) and then the error directly to the disk
+            WriteQueue();
+            WriteOutput(ptr, length);
+            if (LogAfterInit)
+                LogFile->Flush();
+        }
+        else
+        {
+            WriteOutput(ptr, length);
+#if LOG_ENABLE_AUTO_FLUSH
+            if (LogAfterInit)
+                LogFile->Flush();
+#endif
+        }
+
+        IsDuringLog = false;
+        LogLocker.Unlock();
+    }
 }
 
 String Log::Logger::LogFilePath;
@@ -100,52 +287,23 @@ bool Log::Logger::Init()
 #endif
     WriteFloor();
 
+    // Start async writer (messages from the calling threads are queued and written in batches on a background thread)
+    if (CommandLine::Options.LogAsync.IsTrue())
+    {
+        Platform::AtomicStore(&LogAsyncExit, 0);
+        LogAsyncQueue = New<MPSCRingBuffer<LogAsyncEntry>>(LOG_ASYNC_QUEUE_CAPACITY);
+        LogAsyncThread = Thread::Create(New<LogAsyncWriter>(), TEXT("Log Writer"), ThreadPriority::BelowNormal);
+        Platform::AtomicStore(&LogAsync, LogAsyncThread != nullptr ? 1 : 0);
+        if (!LogAsyncThread)
+            SAFE_DELETE(LogAsyncQueue);
+    }
+
     return false;
 }
 
 void Log::Logger::Write(const StringView& msg)
 {
-    const auto ptr = msg.Get();
-    const auto length = msg.Length();
-    if (length <= 0)
-        return;
-
-    LogLocker.Lock();
-    if (IsDuringLog)
-    {
-        LogLocker.Unlock();
-        return;
-    }
-    IsDuringLog = true;
-
-    // Send message to standard process output
-    if (CommandLine::Options.Std)
-    {
-#if PLATFORM_TEXT_IS_CHAR16
-        StringAnsi ansi(msg);
-        ansi += PLATFORM_LINE_TERMINATOR;
-        printf("%s", ansi.Get());
-#else
-        std::wcout.write(ptr, length);
-        std::wcout.write(TEXT(PLATFORM_LINE_TERMINATOR), ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1);
-#endif
-    }
-
-    // Send message to platform logging
-    Platform::Log(msg);
-
-    // Write message to log file
-    if (LogAfterInit)
-    {
-        LogFile->WriteBytes(ptr, length * sizeof(Char));
-        LogFile->WriteBytes(TEXT(PLATFORM_LINE_TERMINATOR), (ARRAY_COUNT(PLATFORM_LINE_TERMINATOR) - 1) * sizeof(Char));
-#if LOG_ENABLE_AUTO_FLUSH
-        LogFile->Flush();
-#endif
-    }
-
-    IsDuringLog = false;
-    LogLocker.Unlock();
+    WriteMessage(msg.Get(), msg.Length(), false);
 }
 
 void Log::Logger::Write(const Exception& exception)
@@ -155,7 +313,26 @@ void Log::Logger::Write(const Exception& exception)
 
 void Log::Logger::Dispose()
 {
+    // Stop async writer
+    if (LogAsyncThread)
+    {
+        Platform::AtomicStore(&LogAsyncExit, 1);
+        LogAsyncSignal.NotifyAll();
+        LogAsyncThread->Join();
+        Delete(LogAsyncThread);
+        LogAsyncThread = nullptr;
+    }
+
     LogLocker.Lock();
+    if (Platform::AtomicRead(&LogAsync) != 0)
+    {
+        // Wait for the producers that have seen the async mode enabled before freeing the queue
+        Platform::AtomicStore(&LogAsync, 0);
+        while (Platform::AtomicRead(&LogAsyncProducers) != 0)
+            Platform::Sleep(0);
+        WriteQueue();
+        SAFE_DELETE(LogAsyncQueue);
+    }
 
     // Write ending info
     WriteFloor();
@@ -186,6 +363,13 @@ bool Log::Logger::IsLogEnabled()
 void Log::Logger::Flush()
 {
     LogLocker.Lock();
+    if (Platform::AtomicRead(&LogAsync) != 0 && !IsDuringLog)
+    {
+        // Write the queued messages on the calling thread
+        IsDuringLog = true;
+        WriteQueue();
+        IsDuringLog = false;
+    }
     if (LogFile)
         LogFile->Flush();
     LogLocker.Unlock();
@@ -241,7 +425,7 @@ void Log::Logger::Write(LogType type, const StringView& msg)
     ProcessLogMessage(type, msg, w);
 
     // Log formatted message
-    Write(StringView(w.data(), (int32)w.size()));
+    WriteMessage(w.data(), (int32)w.size(), type == LogType::Fatal || type == LogType::Error);
 
     // Fire events
     OnMessage(type, msg);
@@ -0,0 +1,149 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FrameAllocation.h"
+#include "Engine/Core/Core.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/CriticalSection.h"
+
+// The default size of the arena memory chunk (larger allocations use dedicated chunks)
+#define FRAME_ARENA_CHUNK_SIZE (256 * 1024)
+
+namespace
+{
+    struct FrameArenaChunk
+    {
+        FrameArenaChunk* Next;
+        uintptr Size;
+    };
+
+    // Keeps the allocations 16-byte aligned
+    constexpr uintptr ChunkHeaderSize = (sizeof(FrameArenaChunk) + 15) & ~15;
+
+    struct FrameArena
+    {
+        FrameArena* Next;
+        FrameArenaChunk* Chunks;
+        FrameArenaChunk* FreeChunks;
+        byte* Top;
+        byte* End;
+        int64 Frame;
+    };
+
+    CriticalSection ArenasLocker;
+    FrameArena* Arenas = nullptr;
+    volatile int64 FrameIndex = 0;
+    // Incremented by Dispose to invalidate the arena pointers cached by the threads
+    volatile int64 ArenasGeneration = 0;
+    THREADLOCAL FrameArena* ThreadArena = nullptr;
+    THREADLOCAL int64 ThreadArenaGeneration = 0;
+
+    void FreeChunks(FrameArenaChunk* chunk)
+    {
+        while (chunk)
+        {
+            FrameArenaChunk* next = chunk->Next;
+            Platform::Free(chunk);
+            chunk = next;
+        }
+    }
+
+    void ResetArena(FrameArena* arena, int64 frame)
+    {
+        // Recycle chunks of the default size and release the dedicated ones
+        FrameArenaChunk* chunk = arena->Chunks;
+        while (chunk)
+        {
+            FrameArenaChunk* next = chunk->Next;
+            if (chunk->Size == FRAME_ARENA_CHUNK_SIZE)
+            {
+                chunk->Next = arena->FreeChunks;
+                arena->FreeChunks = chunk;
+            }
+            else
+            {
+                Platform::Free(chunk);
+            }
+            chunk = next;
+        }
+        arena->Chunks = nullptr;
+        arena->Top = arena->End = nullptr;
+        arena->Frame = frame;
+    }
+
+    void AllocateChunk(FrameArena* arena, uintptr size)
+    {
+        FrameArenaChunk* chunk;
+        if (size + ChunkHeaderSize <= FRAME_ARENA_CHUNK_SIZE && arena->FreeChunks)
+        {
+            chunk = arena->FreeChunks;
+            arena->FreeChunks = chunk->Next;
+        }
+        else
+        {
+            const uintptr chunkSize = Math::Max<uintptr>(size + ChunkHeaderSize, FRAME_ARENA_CHUNK_SIZE);
+            chunk = (FrameArenaChunk*)Platform::Allocate(chunkSize, 16);
+            if (!chunk)
+            {
+                OUT_OF_MEMORY;
+            }
+            chunk->Size = chunkSize;
+        }
+        chunk->Next = arena->Chunks;
+        arena->Chunks = chunk;
+        arena->Top = (byte*)chunk + ChunkHeaderSize;
+        arena->End = (byte*)chunk + chunk->Size;
+    }
+}
+
+void* FrameAllocation::Allocate(uintptr size)
+{
+    FrameArena* arena = ThreadArena;
+    const int64 frame = Platform::AtomicRead(&FrameIndex);
+    const int64 generation = Platform::AtomicRead(&ArenasGeneration);
+    if (!arena || ThreadArenaGeneration != generation)
+    {
+        // Create arena for this thread
+        arena = (FrameArena*)Platform::Allocate(sizeof(FrameArena), 16);
+        Platform::MemoryClear(arena, sizeof(FrameArena));
+        arena->Frame = frame;
+        ArenasLocker.Lock();
+        arena->Next = Arenas;
+        Arenas = arena;
+        ArenasLocker.Unlock();
+        ThreadArena = arena;
+        ThreadArenaGeneration = generation;
+    }
+    else if (arena->Frame != frame)
+    {
+        ResetArena(arena, frame);
+    }
+    size = (size + 15) & ~(uintptr)15;
+    if ((uintptr)(arena->End - arena->Top) < size)
+        AllocateChunk(arena, size);
+    void* result = arena->Top;
+    arena->Top += size;
+    return result;
+}
+
+void FrameAllocation::NextFrame()
+{
+    Platform::InterlockedIncrement(&FrameIndex);
+}
+
+void FrameAllocation::Dispose()
+{
+    ArenasLocker.Lock();
+    FrameArena* arena = Arenas;
+    while (arena)
+    {
+        FrameArena* next = arena->Next;
+        FreeChunks(arena->Chunks);
+        FreeChunks(arena->FreeChunks);
+        Platform::Free(arena);
+        arena = next;
+    }
+    Arenas = nullptr;
+    Platform::InterlockedIncrement(&ArenasGeneration);
+    ThreadArena = nullptr;
+    ArenasLocker.Unlock();
+}
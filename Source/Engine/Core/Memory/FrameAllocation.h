@@ -0,0 +1,95 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Types/BaseTypes.h"
+
+/// <summary>
+/// The memory allocation policy that uses the per-thread linear arena (bump allocator) reset every frame. Allocations are very cheap, freeing is a no-op and there is no fragmentation.
+/// </summary>
+/// <remarks>
+/// Use it for the temporary frame-scoped collections (eg. gameplay queries results or animation temporaries): Array&lt;T, FrameAllocation&gt;. Memory is valid only until the end of the current frame (see FrameAllocation::NextFrame), never keep such collections for longer.
+/// </remarks>
+class FLAXENGINE_API FrameAllocation
+{
+public:
+    /// <summary>
+    /// Allocates the memory from the arena of the current thread (aligned to 16 bytes).
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <returns>The pointer to the allocated chunk of the memory.</returns>
+    static void* Allocate(uintptr size);
+
+    /// <summary>
+    /// Ends the current frame. All arenas will be reset (lazily, on the next allocation from the owning thread). Called by the engine at the end of the main loop tick.
+    /// </summary>
+    static void NextFrame();
+
+    /// <summary>
+    /// Releases the memory of all arenas (threads allocating afterwards start with the new arenas). Called by the engine on exit (after all threads end).
+    /// </summary>
+    static void Dispose();
+
+    enum { HasSwap = true };
+
+    template<typename T>
+    class Data
+    {
+        T* _data = nullptr;
+
+    public:
+        FORCE_INLINE Data()
+        {
+        }
+
+        FORCE_INLINE ~Data()
+        {
+        }
+
+        FORCE_INLINE T* Get()
+        {
+            return _data;
+        }
+
+        FORCE_INLINE const T* Get() const
+        {
+            return _data;
+        }
+
+        FORCE_INLINE int32 CalculateCapacityGrow(int32 capacity, int32 minCapacity) const
+        {
+            capacity = capacity ? capacity * 2 : 16;
+            if (capacity < minCapacity)
+                capacity = minCapacity;
+            return capacity;
+        }
+
+        FORCE_INLINE void Allocate(uint64 capacity)
+        {
+            _data = (T*)FrameAllocation::Allocate(capacity * sizeof(T));
+        }
+
+        FORCE_INLINE void Relocate(uint64 capacity, int32 oldCount, int32 newCount)
+        {
+            T* newData = capacity != 0 ? (T*)FrameAllocation::Allocate(capacity * sizeof(T)) : nullptr;
+            if (oldCount)
+            {
+                if (newCount > 0)
+                    Memory::MoveItems(newData, _data, newCount);
+                Memory::DestructItems(_data, oldCount);
+            }
+            _data = newData;
+        }
+
+        FORCE_INLINE void Free()
+        {
+            _data = nullptr;
+        }
+
+        FORCE_INLINE void Swap(Data& other)
+        {
+            ::Swap(_data, other._data);
+        }
+    };
+};
@@ -6,8 +6,13 @@
 #include "Engine/Platform/Platform.h"
 #include <new>
 
+#if USE_THREAD_CACHE_ALLOCATOR
+#include "ThreadCacheAllocator.h"
+typedef ThreadCacheAllocator Allocator;
+#else
 #include "CrtAllocator.h"
 typedef CrtAllocator Allocator;
+#endif
 
 namespace AllocatorExt
 {
@@ -0,0 +1,82 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "PoolAllocator.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Memory/Memory.h"
+
+PoolAllocator::PoolAllocator(int32 blockSize, int32 slabBlocks)
+    : _blockSize(Math::Max(blockSize, (int32)sizeof(FreeBlock)))
+    , _slabBlocks(Math::Max(slabBlocks, 1))
+{
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    ASSERT(_allocatedCount == 0);
+    for (void* slab : _slabs)
+        Allocator::Free(slab);
+}
+
+void* PoolAllocator::Allocate()
+{
+    _locker.Lock();
+    if (!_freeList && AllocateSlab())
+    {
+        _locker.Unlock();
+        return nullptr;
+    }
+    FreeBlock* block = _freeList;
+    _freeList = block->Next;
+    _allocatedCount++;
+    _locker.Unlock();
+    return block;
+}
+
+void PoolAllocator::Free(void* ptr)
+{
+    if (!ptr)
+        return;
+    ASSERT_LOW_LAYER(GetPool(ptr) == this);
+    FreeBlock* block = (FreeBlock*)ptr;
+    _locker.Lock();
+    block->Next = _freeList;
+    _freeList = block;
+    _allocatedCount--;
+    _locker.Unlock();
+}
+
+void PoolAllocator::Reserve(int32 count)
+{
+    _locker.Lock();
+    while (GetCapacity() < count)
+    {
+        if (AllocateSlab())
+            break;
+    }
+    _locker.Unlock();
+}
+
+int32 PoolAllocator::GetStride() const
+{
+    return HeaderSize + Math::AlignUp(_blockSize, 16);
+}
+
+bool PoolAllocator::AllocateSlab()
+{
+    const int32 stride = GetStride();
+    byte* slab = (byte*)Allocator::Allocate((uint64)stride * _slabBlocks, 16);
+    if (!slab)
+        return true;
+    _slabs.Add(slab);
+
+    // Link blocks in memory order so the consecutive allocations are next to each other
+    for (int32 i = _slabBlocks - 1; i >= 0; i--)
+    {
+        byte* header = slab + i * stride;
+        *(PoolAllocator**)header = this;
+        FreeBlock* block = (FreeBlock*)(header + HeaderSize);
+        block->Next = _freeList;
+        _freeList = block;
+    }
+    return false;
+}
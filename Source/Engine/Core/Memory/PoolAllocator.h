@@ -0,0 +1,103 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+
+/// <summary>
+/// The fixed-size blocks allocator that allocates from contiguous memory slabs and recycles freed blocks via free-list. Blocks are 16-byte aligned and know their owning pool (see GetPool). It's thread-safe.
+/// </summary>
+/// <remarks>
+/// Used to pool the frequently spawned and destroyed objects of the same type (eg. bullets and pickups) to avoid heap allocator spikes and to keep objects memory close to each other.
+/// </remarks>
+class FLAXENGINE_API PoolAllocator
+{
+private:
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    CriticalSection _locker;
+    FreeBlock* _freeList = nullptr;
+    Array<void*> _slabs;
+    int32 _blockSize;
+    int32 _slabBlocks;
+    int32 _allocatedCount = 0;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="PoolAllocator"/> class.
+    /// </summary>
+    /// <param name="blockSize">The size of the single block (in bytes).</param>
+    /// <param name="slabBlocks">The amount of the blocks in a single memory slab.</param>
+    PoolAllocator(int32 blockSize, int32 slabBlocks = 64);
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="PoolAllocator"/> class. Releases all slabs (all blocks have to be freed before).
+    /// </summary>
+    ~PoolAllocator();
+
+public:
+    /// <summary>
+    /// Gets the size of the single block (in bytes).
+    /// </summary>
+    FORCE_INLINE int32 GetBlockSize() const
+    {
+        return _blockSize;
+    }
+
+    /// <summary>
+    /// Gets the amount of the currently allocated blocks.
+    /// </summary>
+    FORCE_INLINE int32 GetAllocatedCount() const
+    {
+        return _allocatedCount;
+    }
+
+    /// <summary>
+    /// Gets the total amount of the blocks in all slabs.
+    /// </summary>
+    FORCE_INLINE int32 GetCapacity() const
+    {
+        return _slabs.Count() * _slabBlocks;
+    }
+
+public:
+    /// <summary>
+    /// Allocates the block from the pool.
+    /// </summary>
+    /// <returns>The pointer to the block memory (16-byte aligned) or null if failed.</returns>
+    void* Allocate();
+
+    /// <summary>
+    /// Returns the block to the pool.
+    /// </summary>
+    /// <param name="ptr">The pointer to the block memory (allocated from this pool).</param>
+    void Free(void* ptr);
+
+    /// <summary>
+    /// Ensures that the pool has capacity for the given amount of the blocks (allocates slabs up-front to prevent hitches during gameplay).
+    /// </summary>
+    /// <param name="count">The minimum amount of the blocks.</param>
+    void Reserve(int32 count);
+
+    /// <summary>
+    /// Gets the pool that allocated the given block.
+    /// </summary>
+    /// <param name="ptr">The pointer to the block memory (allocated from any pool).</param>
+    /// <returns>The owning pool.</returns>
+    FORCE_INLINE static PoolAllocator* GetPool(void* ptr)
+    {
+        return *(PoolAllocator**)((byte*)ptr - HeaderSize);
+    }
+
+private:
+    // Every block is prefixed with the pointer to the owning pool (padded to keep the block memory aligned)
+    static constexpr int32 HeaderSize = 16;
+
+    int32 GetStride() const;
+    bool AllocateSlab();
+};
@@ -0,0 +1,303 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ThreadCacheAllocator.h"
+#include "Engine/Core/Math/Math.h"
+
+// The size of the memory span (power of two) with the small blocks of a single size class
+#define TCA_SPAN_SIZE (64 * 1024)
+
+// The size of the span header (keeps the blocks 16-byte aligned)
+#define TCA_SPAN_HEADER_SIZE 16
+
+// The amount of the spans reserved from the system at once
+#define TCA_SEGMENT_SPANS 32
+
+// The maximum size of the small block (larger allocations go to the platform allocator)
+#define TCA_MAX_SMALL_SIZE (16 * 1024)
+
+// The amount of the size classes (8 classes with 16 bytes step up to 128 bytes, then 4 classes per power of two up to the max small size)
+#define TCA_SIZE_CLASSES 36
+
+// The size of the blocks batch (in bytes) exchanged between the thread cache and the global pool at once
+#define TCA_BATCH_SIZE (32 * 1024)
+
+namespace
+{
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+        // The next batch in the global pool (valid only for the first block of the batch).
+        FreeBlock* NextBatch;
+    };
+
+    struct SpanHeader
+    {
+        int32 SizeClass;
+    };
+
+    struct SpinLock
+    {
+        volatile int32 Value;
+
+        void Lock()
+        {
+            int32 spins = 0;
+            while (Platform::InterlockedCompareExchange(&Value, 1, 0) != 0)
+            {
+                if (++spins > 64)
+                    Platform::Sleep(0);
+            }
+        }
+
+        void Unlock()
+        {
+            Platform::AtomicStore(&Value, 0);
+        }
+    };
+
+    struct SizeClassPool
+    {
+        SpinLock Locker;
+        FreeBlock* Batches;
+        volatile int64 BlocksCount;
+    };
+
+    struct ThreadCache
+    {
+        FreeBlock* Blocks[TCA_SIZE_CLASSES];
+        int32 Counts[TCA_SIZE_CLASSES];
+    };
+
+    // Global state is zero-initialized so the allocator can be used during the static initialization
+    SizeClassPool Pools[TCA_SIZE_CLASSES];
+    SpinLock SegmentsLocker;
+    byte* SpansStart;
+    byte* SpansEnd;
+    volatile int64 ReservedBytes;
+
+    // Maps aligned addresses to the spans of the small blocks (one leaf with a byte per span for every 4GB of the 48-bit address space)
+    byte* SpansMap[1 << 16];
+
+    THREADLOCAL ThreadCache Cache;
+
+    FORCE_INLINE int32 GetSizeClass(uint64 size)
+    {
+        if (size <= 128)
+            return (int32)((size + 15) >> 4) - 1;
+        const int32 log2 = (int32)Math::FloorLog2((uint32)(size - 1));
+        return 8 + (log2 - 7) * 4 + (int32)((size - 1) >> (log2 - 2)) - 4;
+    }
+
+    FORCE_INLINE int32 GetBlockSize(int32 sizeClass)
+    {
+        if (sizeClass < 8)
+            return (sizeClass + 1) * 16;
+        sizeClass -= 8;
+        return (5 + (sizeClass & 3)) << (5 + (sizeClass >> 2));
+    }
+
+    FORCE_INLINE int32 GetBatchCount(int32 sizeClass)
+    {
+        return Math::Clamp(TCA_BATCH_SIZE / GetBlockSize(sizeClass), 2, 256);
+    }
+
+    FORCE_INLINE bool IsSmallBlock(const void* ptr)
+    {
+        const uint64 address = (uint64)(uintptr)ptr;
+        if (address >> 48)
+            return false;
+        const byte* leaf = SpansMap[address >> 32];
+        return leaf && leaf[(address >> 16) & 0xffff];
+    }
+
+    byte* AllocateSpan()
+    {
+        SegmentsLocker.Lock();
+        if (SpansStart == SpansEnd)
+        {
+            // Reserve a new segment of spans (aligned to the span size)
+            const uint64 size = (TCA_SEGMENT_SPANS + 1) * TCA_SPAN_SIZE;
+            byte* segment = (byte*)Platform::AllocatePages(size / 4096, 4096);
+            if (!segment)
+            {
+                SegmentsLocker.Unlock();
+                return nullptr;
+            }
+            byte* start = (byte*)(((uintptr)segment + TCA_SPAN_SIZE - 1) & ~(uintptr)(TCA_SPAN_SIZE - 1));
+            byte* end = (byte*)(((uintptr)segment + size) & ~(uintptr)(TCA_SPAN_SIZE - 1));
+            if (((uint64)(uintptr)end - 1) >> 48)
+            {
+                // Not supported address range
+                Platform::FreePages(segment);
+                SegmentsLocker.Unlock();
+                return nullptr;
+            }
+
+            // Register spans
+            for (byte* span = start; span < end; span += TCA_SPAN_SIZE)
+            {
+                const uint64 address = (uint64)(uintptr)span;
+                byte* leaf = SpansMap[address >> 32];
+                if (!leaf)
+                {
+                    leaf = (byte*)Platform::Allocate(1 << 16, 16);
+                    if (!leaf)
+                    {
+                        end = span;
+                        break;
+                    }
+                    Platform::MemoryClear(leaf, 1 << 16);
+                    Platform::MemoryBarrier();
+                    SpansMap[address >> 32] = leaf;
+                }
+                leaf[(address >> 16) & 0xffff] = 1;
+            }
+            SpansStart = start;
+            SpansEnd = end;
+            Platform::InterlockedAdd(&ReservedBytes, (int64)(end - start));
+            if (start == end)
+            {
+                SegmentsLocker.Unlock();
+                return nullptr;
+            }
+        }
+        byte* span = SpansStart;
+        SpansStart += TCA_SPAN_SIZE;
+        SegmentsLocker.Unlock();
+        return span;
+    }
+
+    void PushBatch(int32 sizeClass, FreeBlock* batch, int32 count)
+    {
+        SizeClassPool& pool = Pools[sizeClass];
+        pool.Locker.Lock();
+        batch->NextBatch = pool.Batches;
+        pool.Batches = batch;
+        pool.Locker.Unlock();
+        Platform::InterlockedAdd(&pool.BlocksCount, count);
+    }
+
+    FreeBlock* Refill(ThreadCache& cache, int32 sizeClass)
+    {
+        // Take the batch of blocks from the global pool
+        SizeClassPool& pool = Pools[sizeClass];
+        pool.Locker.Lock();
+        FreeBlock* batch = pool.Batches;
+        if (batch)
+            pool.Batches = batch->NextBatch;
+        pool.Locker.Unlock();
+        int32 count = 0;
+        if (batch)
+        {
+            for (const FreeBlock* block = batch; block; block = block->Next)
+                count++;
+            Platform::InterlockedAdd(&pool.BlocksCount, -count);
+        }
+        else
+        {
+            // Split a new span into blocks
+            byte* span = AllocateSpan();
+            if (!span)
+                return nullptr;
+            ((SpanHeader*)span)->SizeClass = sizeClass;
+            const int32 blockSize = GetBlockSize(sizeClass);
+            count = (TCA_SPAN_SIZE - TCA_SPAN_HEADER_SIZE) / blockSize;
+            for (int32 i = count - 1; i >= 0; i--)
+            {
+                FreeBlock* block = (FreeBlock*)(span + TCA_SPAN_HEADER_SIZE + i * blockSize);
+                block->Next = batch;
+                batch = block;
+            }
+        }
+        cache.Blocks[sizeClass] = batch;
+        cache.Counts[sizeClass] = count;
+        return batch;
+    }
+}
+
+void* ThreadCacheAllocator::Allocate(uint64 size, uint64 alignment)
+{
+    if (size - 1 >= TCA_MAX_SMALL_SIZE || alignment > 16)
+        return Platform::Allocate(size, alignment);
+    const int32 sizeClass = GetSizeClass(size);
+    ThreadCache& cache = Cache;
+    FreeBlock* block = cache.Blocks[sizeClass];
+    if (!block)
+    {
+        block = Refill(cache, sizeClass);
+        if (!block)
+            return Platform::Allocate(size, alignment);
+    }
+    cache.Blocks[sizeClass] = block->Next;
+    cache.Counts[sizeClass]--;
+#if COMPILE_WITH_PROFILER
+    Platform::OnMemoryAlloc(block, size);
+#endif
+    return block;
+}
+
+void ThreadCacheAllocator::Free(void* ptr)
+{
+    if (!IsSmallBlock(ptr))
+    {
+        Platform::Free(ptr);
+        return;
+    }
+#if COMPILE_WITH_PROFILER
+    Platform::OnMemoryFree(ptr);
+#endif
+    const SpanHeader* span = (const SpanHeader*)((uintptr)ptr & ~(uintptr)(TCA_SPAN_SIZE - 1));
+    const int32 sizeClass = span->SizeClass;
+    ThreadCache& cache = Cache;
+    FreeBlock* block = (FreeBlock*)ptr;
+    block->Next = cache.Blocks[sizeClass];
+    cache.Blocks[sizeClass] = block;
+    const int32 batchCount = GetBatchCount(sizeClass);
+    if (++cache.Counts[sizeClass] > batchCount * 2)
+    {
+        // Move the batch of blocks to the global pool (to be reused by other threads)
+        FreeBlock* last = block;
+        for (int32 i = 1; i < batchCount; i++)
+            last = last->Next;
+        cache.Blocks[sizeClass] = last->Next;
+        cache.Counts[sizeClass] -= batchCount;
+        last->Next = nullptr;
+        PushBatch(sizeClass, block, batchCount);
+    }
+}
+
+void ThreadCacheAllocator::FlushThreadCache()
+{
+    ThreadCache& cache = Cache;
+    for (int32 sizeClass = 0; sizeClass < TCA_SIZE_CLASSES; sizeClass++)
+    {
+        const int32 batchCount = GetBatchCount(sizeClass);
+        FreeBlock* block = cache.Blocks[sizeClass];
+        while (block)
+        {
+            FreeBlock* batch = block;
+            FreeBlock* last = block;
+            int32 count = 1;
+            for (; count < batchCount && last->Next; count++)
+                last = last->Next;
+            block = last->Next;
+            last->Next = nullptr;
+            PushBatch(sizeClass, batch, count);
+        }
+        cache.Blocks[sizeClass] = nullptr;
+        cache.Counts[sizeClass] = 0;
+    }
+}
+
+ThreadCacheAllocator::Stats ThreadCacheAllocator::GetStats()
+{
+    Stats stats;
+    stats.ReservedBytes = (uint64)Platform::AtomicRead(&ReservedBytes);
+    stats.PooledBytes = 0;
+    for (int32 sizeClass = 0; sizeClass < TCA_SIZE_CLASSES; sizeClass++)
+        stats.PooledBytes += (uint64)Platform::AtomicRead(&Pools[sizeClass].BlocksCount) * GetBlockSize(sizeClass);
+    SegmentsLocker.Lock();
+    stats.UnusedBytes = (uint64)(SpansEnd - SpansStart);
+    SegmentsLocker.Unlock();
+    return stats;
+}
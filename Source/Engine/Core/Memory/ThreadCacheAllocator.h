@@ -0,0 +1,71 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Platform/Platform.h"
+
+/// <summary>
+/// The scalable memory allocator with per-thread caches of the small memory blocks (up to 16kB). Small blocks are grouped into size classes and carved from the 64kB spans, threads allocate and free them without locking (the global pool of each size class is accessed only to exchange the whole batches of blocks). Larger or over-aligned allocations go to the platform allocator (malloc/free).
+/// </summary>
+/// <remarks>
+/// Used as the engine Allocator when USE_THREAD_CACHE_ALLOCATOR is enabled (see -useThreadCacheAllocator build tool option). Spans are never released back to the system and stay assigned to their size class.
+/// </remarks>
+class FLAXENGINE_API ThreadCacheAllocator
+{
+public:
+    /// <summary>
+    /// The allocator statistics.
+    /// </summary>
+    struct Stats
+    {
+        /// <summary>
+        /// The amount of the memory (in bytes) reserved from the system for the small blocks.
+        /// </summary>
+        uint64 ReservedBytes;
+
+        /// <summary>
+        /// The amount of the memory (in bytes) of the free small blocks in the global pools (excluding per-thread caches).
+        /// </summary>
+        uint64 PooledBytes;
+
+        /// <summary>
+        /// The amount of the memory (in bytes) of the spans that have not been used yet.
+        /// </summary>
+        uint64 UnusedBytes;
+    };
+
+public:
+    /// <summary>
+    /// Allocates memory on a specified alignment boundary.
+    /// </summary>
+    /// <param name="size">The size of the allocation (in bytes).</param>
+    /// <param name="alignment">The memory alignment (in bytes). Must be an integer power of 2.</param>
+    /// <returns>The pointer to the allocated chunk of the memory. The pointer is a multiple of alignment.</returns>
+    static void* Allocate(uint64 size, uint64 alignment = 16);
+
+    /// <summary>
+    /// Frees a block of allocated memory.
+    /// </summary>
+    /// <param name="ptr">A pointer to the memory block to deallocate.</param>
+    static void Free(void* ptr);
+
+    /// <summary>
+    /// Returns the cached free blocks of the current thread to the global pools. Called by the engine before the thread exits.
+    /// </summary>
+    static void FlushThreadCache();
+
+    /// <summary>
+    /// Gets the allocator statistics.
+    /// </summary>
+    static Stats GetStats();
+
+    /// <summary>
+    /// Gets the name of the allocator.
+    /// </summary>
+    /// <returns>The name.</returns>
+    static const Char* Name()
+    {
+        return TEXT("ThreadCache");
+    }
+};
@@ -2,6 +2,7 @@
 
 #include "ObjectsRemovalService.h"
 #include "Utilities.h"
+#include "Collections/Array.h"
 #include "Collections/Dictionary.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
@@ -14,6 +15,11 @@ const Char* HertzSizesData[] = { TEXT("Hz"), TEXT("KHz"), TEXT("MHz"), TEXT("GHz
 Span<const Char*> Utilities::Private::BytesSizes(BytesSizesData, ARRAY_COUNT(BytesSizesData));
 Span<const Char*> Utilities::Private::HertzSizes(HertzSizesData, ARRAY_COUNT(HertzSizesData));
 
+// The amount of objects deleted between checks of the update time budget
+#define OBJECTS_REMOVAL_BATCH_SIZE 32
+
+float ObjectsRemovalService::UpdateTimeBudget = 2.0f;
+
 namespace
 {
     CriticalSection PoolLocker;
@@ -21,6 +27,63 @@ namespace
     float LastUpdateGameTime;
     Dictionary<Object*, float> Pool(8192);
     uint64 PoolCounter = 0;
+
+    void FlushPool(float dt, float gameDelta, double timeBudget)
+    {
+        PROFILE_CPU_NAMED("ObjectsRemovalService.Flush");
+
+        PoolLocker.Lock();
+        PoolCounter = 0;
+        const double startTime = timeBudget > 0.0 ? Platform::GetTimeSeconds() : 0.0;
+
+        // Update timeouts and gather objects that timed out (they stay in the pool until deleted so objects deleted by other objects are skipped)
+        Array<Object*> toDelete;
+        for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
+        {
+            auto& bucket = *i;
+            Object* obj = bucket.Key;
+            const float ttl = bucket.Value - ((obj->Flags & ObjectFlags::UseGameTimeForDelete) != ObjectFlags::None ? gameDelta : dt);
+            bucket.Value = ttl;
+            if (ttl <= 0.0f)
+                toDelete.Add(obj);
+        }
+
+        // Delete objects in batches
+        while (toDelete.HasItems())
+        {
+            for (int32 i = 0; i < toDelete.Count(); i++)
+            {
+                // Leave remaining objects in the pool for the next update when running out of time
+                if (timeBudget > 0.0 && i % OBJECTS_REMOVAL_BATCH_SIZE == OBJECTS_REMOVAL_BATCH_SIZE - 1 && Platform::GetTimeSeconds() - startTime >= timeBudget)
+                {
+                    PoolLocker.Unlock();
+                    return;
+                }
+
+                Object* obj = toDelete[i];
+                const auto it = Pool.Find(obj);
+                if (it.IsNotEnd() && it->Value <= 0.0f)
+                {
+                    Pool.Remove(it);
+                    obj->OnDeleteObject();
+                }
+            }
+            toDelete.Clear();
+
+            // If any object was added to the pool while removing objects (by this thread) then retry removing any nested objects (but without delta time)
+            if (PoolCounter != 0)
+            {
+                PoolCounter = 0;
+                for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
+                {
+                    if (i->Value <= 0.0f)
+                        toDelete.Add(i->Key);
+                }
+            }
+        }
+
+        PoolLocker.Unlock();
+    }
 }
 
 class ObjectsRemoval : public EngineService
@@ -69,47 +132,7 @@ void ObjectsRemovalService::Add(Object* obj, float timeToLive, bool useGameTime)
 
 void ObjectsRemovalService::Flush(float dt, float gameDelta)
 {
-    PROFILE_CPU();
-
-    PoolLocker.Lock();
-    PoolCounter = 0;
-
-    // Update timeouts and delete objects that timed out
-    for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
-    {
-        auto& bucket = *i;
-        Object* obj = bucket.Key;
-        const float ttl = bucket.Value - ((obj->Flags & ObjectFlags::UseGameTimeForDelete) != ObjectFlags::None ? gameDelta : dt);
-        if (ttl <= 0.0f)
-        {
-            Pool.Remove(i);
-            obj->OnDeleteObject();
-        }
-        else
-        {
-            bucket.Value = ttl;
-        }
-    }
-
-    // If any object was added to the pool while removing objects (by this thread) then retry removing any nested objects (but without delta time)
-    if (PoolCounter != 0)
-    {
-    RETRY:
-        PoolCounter = 0;
-        for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
-        {
-            if (i->Value <= 0.0f)
-            {
-                Object* obj = i->Key;
-                Pool.Remove(i);
-                obj->OnDeleteObject();
-            }
-        }
-        if (PoolCounter != 0)
-            goto RETRY;
-    }
-
-    PoolLocker.Unlock();
+    FlushPool(dt, gameDelta, 0.0);
 }
 
 bool ObjectsRemoval::Init()
@@ -129,7 +152,7 @@ void ObjectsRemoval::LateUpdate()
     float gameDelta = Time::Update.DeltaTime.GetTotalSeconds();
     if (Time::GetGamePaused())
         gameDelta = 0;
-    ObjectsRemovalService::Flush(dt, gameDelta);
+    FlushPool(dt, gameDelta, ObjectsRemovalService::UpdateTimeBudget * 0.001);
     LastUpdate = now;
 }
 
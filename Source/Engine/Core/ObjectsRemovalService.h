@@ -10,6 +10,11 @@
 class FLAXENGINE_API ObjectsRemovalService
 {
 public:
+    /// <summary>
+    /// The time budget (in milliseconds) for deleting objects during a single engine update. Timed out objects that don't fit into the budget stay in the pool and get deleted during the next updates (spreads the cost of mass destruction such as level unload over a few frames). Use 0 to disable the limit.
+    /// </summary>
+    static float UpdateTimeBudget;
+
     /// <summary>
     /// Determines whether object has been registered in the pool for the removing.
     /// </summary>
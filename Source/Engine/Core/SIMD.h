@@ -4,12 +4,17 @@
 
 #include "Engine/Platform/Platform.h"
 #if PLATFORM_SIMD_SSE2
-#ifdef _WIN32
 #include <xmmintrin.h>
-#endif
+#include <emmintrin.h>
 #else
 #include <math.h>
 #endif
+#if PLATFORM_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 #if PLATFORM_SIMD_SSE2
 
@@ -33,6 +38,11 @@ namespace SIMD
         return _mm_load_ps((const float*)(src));
     }
 
+    FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+    {
+        return _mm_loadu_ps((const float*)(src));
+    }
+
     FORCE_INLINE SimdVector4 Splat(float value)
     {
         return _mm_set_ps1(value);
@@ -92,6 +102,27 @@ namespace SIMD
     {
         return _mm_max_ps(a, b);
     }
+
+    FORCE_INLINE SimdVector4 Less(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_cmplt_ps(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 And(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_and_ps(a, b);
+    }
+
+    FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_or_ps(a, b);
+    }
+
+    // Picks components from a where mask is set (as returned by comparison functions), otherwise from b
+    FORCE_INLINE SimdVector4 Select(SimdVector4 mask, SimdVector4 a, SimdVector4 b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
 }
 
 #else
@@ -118,6 +149,11 @@ namespace SIMD
 		return *(const SimdVector4*)src;
 	}
 
+	FORCE_INLINE SimdVector4 LoadUnaligned(const void* src)
+	{
+		return *(const SimdVector4*)src;
+	}
+
 	FORCE_INLINE SimdVector4 Splat(float value)
 	{
 		return { value, value, value, value };
@@ -234,6 +270,114 @@ namespace SIMD
 			a.W > b.W ? a.W : b.W
 		};
 	}
+
+	FORCE_INLINE SimdVector4 Less(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			a.X < b.X ? -1.0f : 0.0f,
+			a.Y < b.Y ? -1.0f : 0.0f,
+			a.Z < b.Z ? -1.0f : 0.0f,
+			a.W < b.W ? -1.0f : 0.0f
+		};
+	}
+
+	// Logical operations on masks (as returned by comparison functions)
+	FORCE_INLINE SimdVector4 And(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			a.X < 0 && b.X < 0 ? -1.0f : 0.0f,
+			a.Y < 0 && b.Y < 0 ? -1.0f : 0.0f,
+			a.Z < 0 && b.Z < 0 ? -1.0f : 0.0f,
+			a.W < 0 && b.W < 0 ? -1.0f : 0.0f
+		};
+	}
+
+	FORCE_INLINE SimdVector4 Or(SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			a.X < 0 || b.X < 0 ? -1.0f : 0.0f,
+			a.Y < 0 || b.Y < 0 ? -1.0f : 0.0f,
+			a.Z < 0 || b.Z < 0 ? -1.0f : 0.0f,
+			a.W < 0 || b.W < 0 ? -1.0f : 0.0f
+		};
+	}
+
+	// Picks components from a where mask is set (as returned by comparison functions), otherwise from b
+	FORCE_INLINE SimdVector4 Select(SimdVector4 mask, SimdVector4 a, SimdVector4 b)
+	{
+		return
+		{
+			mask.X < 0 ? a.X : b.X,
+			mask.Y < 0 ? a.Y : b.Y,
+			mask.Z < 0 ? a.Z : b.Z,
+			mask.W < 0 ? a.W : b.W
+		};
+	}
 }
 
 #endif
+
+namespace SIMD
+{
+    // Compares 16 bytes (unaligned) with the value and returns the bit mask of the matching bytes (bit N is set when N-th byte is equal to the value)
+    FORCE_INLINE uint32 MatchBytes16(const void* src, byte value)
+    {
+#if PLATFORM_SIMD_SSE2
+        const __m128i data = _mm_loadu_si128((const __m128i*)src);
+        return (uint32)_mm_movemask_epi8(_mm_cmpeq_epi8(data, _mm_set1_epi8((char)value)));
+#elif PLATFORM_SIMD_NEON
+        static const uint8 bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t mask = vandq_u8(vceqq_u8(vld1q_u8((const uint8*)src), vdupq_n_u8(value)), vld1q_u8(bits));
+        const uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(mask)));
+        return (uint32)vgetq_lane_u64(sum, 0) | ((uint32)vgetq_lane_u64(sum, 1) << 8);
+#else
+        const byte* data = (const byte*)src;
+        uint32 result = 0;
+        for (int32 i = 0; i < 16; i++)
+            result |= (uint32)(data[i] == value) << i;
+        return result;
+#endif
+    }
+
+    // Returns the bit mask of 16 bytes (unaligned) that have the highest bit set (bit N is set when N-th byte is larger or equal to 0x80)
+    FORCE_INLINE uint32 MatchBytesHighBit16(const void* src)
+    {
+#if PLATFORM_SIMD_SSE2
+        return (uint32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)src));
+#elif PLATFORM_SIMD_NEON
+        static const uint8 bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t mask = vandq_u8(vcltq_s8(vld1q_s8((const int8*)src), vdupq_n_s8(0)), vld1q_u8(bits));
+        const uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(mask)));
+        return (uint32)vgetq_lane_u64(sum, 0) | ((uint32)vgetq_lane_u64(sum, 1) << 8);
+#else
+        const byte* data = (const byte*)src;
+        uint32 result = 0;
+        for (int32 i = 0; i < 16; i++)
+            result |= (uint32)(data[i] >> 7) << i;
+        return result;
+#endif
+    }
+
+    // Returns the index of the lowest set bit in the mask returned by the bytes matching functions (mask cannot be zero)
+    FORCE_INLINE int32 FirstMatch(uint32 mask)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctz(mask);
+#elif defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return (int32)index;
+#else
+        int32 index = 0;
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+}
@@ -17,7 +17,7 @@ String::String(const StringView& str)
     if (_length != 0)
     {
         ASSERT(_length > 0);
-        _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+        _data = AllocateData(_length);
         _data[_length] = 0;
         Platform::MemoryCopy(_data, str.Get(), _length * sizeof(Char));
     }
@@ -43,14 +43,21 @@ void String::Set(const Char* chars, int32 length)
     }
     else
     {
+        // Short text is copied via temporary storage first (chars can point to the inline buffer of this string)
+        Char tmp[InlineCapacity];
         Char* data = nullptr;
         if (length != 0)
         {
-            data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            data = length < InlineCapacity ? tmp : (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
             Platform::MemoryCopy(data, chars, length * sizeof(Char));
             data[length] = 0;
         }
-        Platform::Free(_data);
+        FreeData(_data);
+        if (data == tmp)
+        {
+            Platform::MemoryCopy(_inline, tmp, (length + 1) * sizeof(Char));
+            data = _inline;
+        }
         _data = data;
         _length = length;
     }
@@ -60,10 +67,10 @@ void String::Set(const char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        FreeData(_data);
         if (length != 0)
         {
-            _data = (Char*)Platform::Allocate((length + 1) * sizeof(Char), 16);
+            _data = AllocateData(length);
             _data[length] = 0;
         }
         else
@@ -78,8 +85,21 @@ void String::Set(const char* chars, int32 length)
 
 void String::SetUTF8(const char* chars, int32 length)
 {
-    Platform::Free(_data);
-    _data = StringUtils::ConvertUTF82UTF16(chars, length, _length);
+    // Converted text uses the global allocator so copy it into the string storage (inline or Platform memory)
+    int32 utf16Length;
+    Char* utf16 = StringUtils::ConvertUTF82UTF16(chars, length, utf16Length);
+    FreeData(_data);
+    _length = utf16Length;
+    if (utf16Length != 0)
+    {
+        _data = AllocateData(utf16Length);
+        Platform::MemoryCopy(_data, utf16, (utf16Length + 1) * sizeof(Char));
+        Allocator::Free(utf16);
+    }
+    else
+    {
+        _data = nullptr;
+    }
 }
 
 void String::Append(const Char* chars, int32 count)
@@ -87,17 +107,18 @@ void String::Append(const Char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
+    Char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void String::Append(const char* chars, int32 count)
@@ -105,18 +126,19 @@ void String::Append(const char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
+    Char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(Char));
     StringUtils::ConvertANSI2UTF16(chars, _data + oldLength, count, _length);
     _length += oldLength;
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 String& String::operator+=(const StringView& str)
@@ -147,23 +169,23 @@ void String::Insert(int32 startIndex, const String& other)
         return;
     }
 
-    const auto oldData = _data;
+    Char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void String::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
     const auto oldLength = _length;
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
@@ -173,14 +195,16 @@ void String::Remove(int32 startIndex, int32 length)
         return;
     }
 
+    Char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     _length = oldLength - length;
-    _data = (Char*)Platform::Allocate((_length + 1) * sizeof(Char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(Char));
     Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, (_length - startIndex) * sizeof(Char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void String::Split(Char c, Array<String>& results) const
@@ -375,14 +399,21 @@ void StringAnsi::Set(const char* chars, int32 length)
     }
     else
     {
+        // Short text is copied via temporary storage first (chars can point to the inline buffer of this string)
+        char tmp[InlineCapacity];
         char* data = nullptr;
         if (length != 0)
         {
-            data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            data = length < InlineCapacity ? tmp : (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
             Platform::MemoryCopy(data, chars, length * sizeof(char));
             data[length] = 0;
         }
-        Platform::Free(_data);
+        FreeData(_data);
+        if (data == tmp)
+        {
+            Platform::MemoryCopy(_inline, tmp, (length + 1) * sizeof(char));
+            data = _inline;
+        }
         _data = data;
         _length = length;
     }
@@ -392,10 +423,10 @@ void StringAnsi::Set(const Char* chars, int32 length)
 {
     if (length != _length)
     {
-        Platform::Free(_data);
+        FreeData(_data);
         if (length != 0)
         {
-            _data = (char*)Platform::Allocate((length + 1) * sizeof(char), 16);
+            _data = AllocateData(length);
             _data[length] = 0;
         }
         else
@@ -414,17 +445,18 @@ void StringAnsi::Append(const char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
+    char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     Platform::MemoryCopy(_data + oldLength, chars, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void StringAnsi::Append(const Char* chars, int32 count)
@@ -432,17 +464,18 @@ void StringAnsi::Append(const Char* chars, int32 count)
     if (count == 0)
         return;
 
-    const auto oldData = _data;
+    char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + count;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, oldLength * sizeof(char));
     StringUtils::ConvertUTF162ANSI(chars, _data + oldLength, count * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 StringAnsi& StringAnsi::operator+=(const StringAnsiView& str)
@@ -507,23 +540,23 @@ void StringAnsi::Insert(int32 startIndex, const StringAnsi& other)
         return;
     }
 
-    const auto oldData = _data;
+    char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     const auto oldLength = _length;
 
     _length = oldLength + otherLength;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
     Platform::MemoryCopy(_data + startIndex, other.Get(), otherLength * sizeof(char));
     Platform::MemoryCopy(_data + startIndex + otherLength, oldData + startIndex, (oldLength - startIndex) * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void StringAnsi::Remove(int32 startIndex, int32 length)
 {
-    const auto oldData = _data;
     const auto oldLength = _length;
     ASSERT(startIndex >= 0 && startIndex + length <= oldLength);
 
@@ -533,14 +566,16 @@ void StringAnsi::Remove(int32 startIndex, int32 length)
         return;
     }
 
+    char tmp[InlineCapacity];
+    const auto oldData = DetachData(tmp);
     _length = oldLength - length;
-    _data = (char*)Platform::Allocate((_length + 1) * sizeof(char), 16);
+    _data = AllocateData(_length);
 
     Platform::MemoryCopy(_data, oldData, startIndex * sizeof(char));
-    Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, length * sizeof(char));
+    Platform::MemoryCopy(_data + startIndex, oldData + startIndex + length, (_length - startIndex) * sizeof(char));
     _data[_length] = 0;
 
-    Platform::Free(oldData);
+    FreeDetachedData(oldData, tmp);
 }
 
 void StringAnsi::Split(char c, Array<StringAnsi>& results) const
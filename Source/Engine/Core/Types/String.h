@@ -6,15 +6,21 @@
 #include "Engine/Platform/StringUtils.h"
 #include "Engine/Core/Formatting.h"
 
+// The size of the inline characters storage (in bytes) within the string object. Short strings keep characters inline to avoid heap allocations (small-string optimization).
+#define STRING_INLINE_SIZE 20
+
 /// <summary>
-/// Represents text as a sequence of characters. Container uses a single dynamic memory allocation to store the characters data. Characters sequence is always null-terminated.
+/// Represents text as a sequence of characters. Container uses a single dynamic memory allocation to store the characters data (short strings are stored inline without allocation). Characters sequence is always null-terminated.
 /// </summary>
 template<typename T>
 class StringBase
 {
 protected:
+    static constexpr int32 InlineCapacity = STRING_INLINE_SIZE / sizeof(T);
+
     T* _data = nullptr;
     int32 _length = 0;
+    T _inline[InlineCapacity];
 
 public:
     typedef T CharType;
@@ -24,7 +30,7 @@ class StringBase
     /// </summary>
     ~StringBase()
     {
-        Platform::Free(_data);
+        FreeData(_data);
     }
 
 public:
@@ -33,11 +39,57 @@ class StringBase
     /// </summary>
     void Clear()
     {
-        Platform::Free(_data);
+        FreeData(_data);
         _data = nullptr;
         _length = 0;
     }
 
+protected:
+    // Gets the characters buffer for the given length (excluding null-terminator). Short strings use the inline storage.
+    FORCE_INLINE T* AllocateData(int32 length)
+    {
+        return length < InlineCapacity ? _inline : (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+    }
+
+    // Frees the characters buffer (if it's allocated on the heap).
+    FORCE_INLINE void FreeData(T* data)
+    {
+        if (data != _inline)
+            Platform::Free(data);
+    }
+
+    // Gets the characters buffer to read from during reallocation. Inline characters are copied into the temporary storage (inline buffer gets overwritten). Release it with FreeDetachedData.
+    FORCE_INLINE T* DetachData(T* tmp)
+    {
+        if (_data != _inline)
+            return _data;
+        Platform::MemoryCopy(tmp, _inline, (_length + 1) * sizeof(T));
+        return tmp;
+    }
+
+    FORCE_INLINE static void FreeDetachedData(T* data, T* tmp)
+    {
+        if (data != tmp)
+            Platform::Free(data);
+    }
+
+    // Moves the characters from the other string (takes the heap buffer or copies the inline characters).
+    FORCE_INLINE void MoveData(StringBase& other)
+    {
+        if (other._data == other._inline)
+        {
+            _data = _inline;
+            Platform::MemoryCopy(_inline, other._inline, (other._length + 1) * sizeof(T));
+        }
+        else
+        {
+            _data = other._data;
+        }
+        _length = other._length;
+        other._data = nullptr;
+        other._length = 0;
+    }
+
 public:
     /// <summary>
     /// Gets the character at the specific index.
@@ -334,10 +386,10 @@ class StringBase
         ASSERT(length >= 0);
         if (length == _length)
             return;
-        Platform::Free(_data);
+        FreeData(_data);
         if (length != 0)
         {
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            _data = AllocateData(length);
             _data[length] = 0;
         }
         else
@@ -472,9 +524,10 @@ class StringBase
             }
 
             const auto oldLength = _length;
-            const auto oldData = _data;
+            T tmp[InlineCapacity];
+            const auto oldData = DetachData(tmp);
             _length += replacedCount * (replacementTextLength - searchTextLength);
-            _data = (T*)Platform::Allocate((_length + 1) * sizeof(T), 16);
+            _data = AllocateData(_length);
 
             T* writePosition = _data;
             readPosition = oldData;
@@ -497,7 +550,7 @@ class StringBase
             Platform::MemoryCopy(writePosition, readPosition, writeOffset * sizeof(T));
 
             _data[_length] = 0;
-            Platform::Free(oldData);
+            FreeDetachedData(oldData, tmp);
         }
 
         return replacedCount;
@@ -528,13 +581,14 @@ class StringBase
         ASSERT(length >= 0);
         if (_length != length)
         {
-            const auto oldData = _data;
+            T tmp[InlineCapacity];
+            const auto oldData = DetachData(tmp);
             const auto minLength = _length < length ? _length : length;
             _length = length;
-            _data = (T*)Platform::Allocate((length + 1) * sizeof(T), 16);
+            _data = AllocateData(length);
             Platform::MemoryCopy(_data, oldData, minLength * sizeof(T));
             _data[length] = 0;
-            Platform::Free(oldData);
+            FreeDetachedData(oldData, tmp);
         }
     }
 };
@@ -572,10 +626,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     /// <param name="str">The double reference to the string.</param>
     String(String&& str) noexcept
     {
-        _data = str._data;
-        _length = str._length;
-        str._data = nullptr;
-        str._length = 0;
+        MoveData(str);
     }
 
     /// <summary>
@@ -758,7 +809,7 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     {
         String result;
         result._length = a.Length() + 1;
-        result._data = (Char*)Platform::Allocate((result._length + 1) * sizeof(Char), 16);
+        result._data = result.AllocateData(result._length);
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(Char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -775,11 +826,8 @@ API_CLASS(InBuild) class FLAXENGINE_API String : public StringBase<Char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
-            _length = s._length;
-            s._data = nullptr;
-            s._length = 0;
+            FreeData(_data);
+            MoveData(s);
         }
         return *this;
     }
@@ -1276,10 +1324,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     /// <param name="str">The double reference to the string.</param>
     StringAnsi(StringAnsi&& str) noexcept
     {
-        _data = str._data;
-        _length = str._length;
-        str._data = nullptr;
-        str._length = 0;
+        MoveData(str);
     }
 
     /// <summary>
@@ -1455,7 +1500,7 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     {
         StringAnsi result;
         result._length = a.Length() + 1;
-        result._data = (char*)Platform::Allocate((result._length + 1) * sizeof(char), 16);
+        result._data = result.AllocateData(result._length);
         Platform::MemoryCopy(result._data, a.Get(), a.Length() * sizeof(char));
         result._data[a.Length()] = b;
         result._data[result._length] = 0;
@@ -1472,11 +1517,8 @@ API_CLASS(InBuild) class FLAXENGINE_API StringAnsi : public StringBase<char>
     {
         if (this != &s)
         {
-            Platform::Free(_data);
-            _data = s._data;
-            _length = s._length;
-            s._data = nullptr;
-            s._length = 0;
+            FreeData(_data);
+            MoveData(s);
         }
         return *this;
     }
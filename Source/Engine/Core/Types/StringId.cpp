@@ -0,0 +1,99 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "StringId.h"
+#include "String.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/CriticalSection.h"
+
+// The size of the memory chunk used to allocate interned texts (larger texts use dedicated allocations)
+#define STRING_ID_CHUNK_SIZE (16 * 1024)
+
+StringId StringId::Empty;
+
+namespace
+{
+    CriticalSection InternLocker;
+    // Keys are views of the texts stored in entries
+    Dictionary<StringView, const StringId::Entry*> InternTable;
+    byte* ChunkPos = nullptr;
+    byte* ChunkEnd = nullptr;
+
+    const StringId::Entry* Intern(const StringView& text)
+    {
+        const StringId::Entry* entry;
+        if (InternTable.TryGet(text, entry))
+            return entry;
+
+        // Allocate a new entry (entries are never released)
+        const uint64 size = Math::AlignUp<uint64>(sizeof(StringId::Entry) + text.Length() * sizeof(Char), sizeof(void*));
+        byte* memory;
+        if (size * 4 > STRING_ID_CHUNK_SIZE)
+        {
+            memory = (byte*)Allocator::Allocate(size);
+        }
+        else
+        {
+            if (ChunkPos + size > ChunkEnd)
+            {
+                ChunkPos = (byte*)Allocator::Allocate(STRING_ID_CHUNK_SIZE);
+                ChunkEnd = ChunkPos + STRING_ID_CHUNK_SIZE;
+            }
+            memory = ChunkPos;
+            ChunkPos += size;
+        }
+        auto e = (StringId::Entry*)memory;
+        e->Hash = GetHash(text);
+        e->Length = text.Length();
+        Platform::MemoryCopy(e->Text, text.Get(), text.Length() * sizeof(Char));
+        e->Text[text.Length()] = 0;
+        InternTable.Add(StringView(e->Text, e->Length), e);
+        return e;
+    }
+}
+
+StringId::StringId(const StringView& text)
+{
+    if (text.HasChars())
+    {
+        InternLocker.Lock();
+        _entry = Intern(text);
+        InternLocker.Unlock();
+    }
+}
+
+StringId::StringId(const StringAnsiView& text)
+{
+    if (text.HasChars())
+    {
+        const String str(text);
+        InternLocker.Lock();
+        _entry = Intern(str);
+        InternLocker.Unlock();
+    }
+}
+
+StringId StringId::Find(const StringView& text)
+{
+    const Entry* entry = nullptr;
+    if (text.HasChars())
+    {
+        InternLocker.Lock();
+        InternTable.TryGet(text, entry);
+        InternLocker.Unlock();
+    }
+    return StringId(entry);
+}
+
+int32 StringId::GetInternedCount()
+{
+    InternLocker.Lock();
+    const int32 result = InternTable.Count();
+    InternLocker.Unlock();
+    return result;
+}
+
+String StringId::ToString() const
+{
+    return _entry ? String(_entry->Text, _entry->Length) : String::Empty;
+}
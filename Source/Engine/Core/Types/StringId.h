@@ -0,0 +1,159 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "StringView.h"
+#include "Engine/Core/Templates.h"
+
+/// <summary>
+/// The interned string identifier (eg. tag name, graph parameter name or RPC name). The text is stored once in the engine-wide table so identifiers compare and hash in O(1) (by pointer). Comparison is case-sensitive. The interned texts live for the whole engine lifetime.
+/// </summary>
+class FLAXENGINE_API StringId
+{
+public:
+    struct Entry
+    {
+        uint32 Hash;
+        int32 Length;
+        // The null-terminated text (allocated together with the entry).
+        Char Text[1];
+    };
+
+private:
+    const Entry* _entry = nullptr;
+
+    FORCE_INLINE StringId(const Entry* entry)
+        : _entry(entry)
+    {
+    }
+
+public:
+    /// <summary>
+    /// Instance of the empty identifier.
+    /// </summary>
+    static StringId Empty;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="StringId"/> class (empty).
+    /// </summary>
+    StringId() = default;
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="StringId"/> class. Interns the text if it's not added yet.
+    /// </summary>
+    /// <param name="text">The identifier text.</param>
+    explicit StringId(const StringView& text);
+
+    /// <summary>
+    /// Initializes a new instance of the <see cref="StringId"/> class. Interns the text if it's not added yet.
+    /// </summary>
+    /// <param name="text">The identifier text.</param>
+    explicit StringId(const StringAnsiView& text);
+
+public:
+    /// <summary>
+    /// Finds the identifier of the already interned text. Doesn't add a new text to the table (eg. for lookups with user input).
+    /// </summary>
+    /// <param name="text">The identifier text.</param>
+    /// <returns>The found identifier or empty if the text is not interned.</returns>
+    static StringId Find(const StringView& text);
+
+    /// <summary>
+    /// Gets the amount of the interned texts.
+    /// </summary>
+    static int32 GetInternedCount();
+
+public:
+    /// <summary>
+    /// Returns true if identifier is empty.
+    /// </summary>
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return _entry == nullptr;
+    }
+
+    /// <summary>
+    /// Returns true if identifier is not empty.
+    /// </summary>
+    FORCE_INLINE bool HasChars() const
+    {
+        return _entry != nullptr;
+    }
+
+    /// <summary>
+    /// Gets the length of the identifier text.
+    /// </summary>
+    FORCE_INLINE int32 Length() const
+    {
+        return _entry ? _entry->Length : 0;
+    }
+
+    /// <summary>
+    /// Gets the pointer to the null-terminated identifier text (always valid).
+    /// </summary>
+    FORCE_INLINE const Char* GetText() const
+    {
+        return _entry ? _entry->Text : TEXT("");
+    }
+
+    /// <summary>
+    /// Gets the identifier text hash code (cached).
+    /// </summary>
+    FORCE_INLINE uint32 GetHashCode() const
+    {
+        return _entry ? _entry->Hash : 0;
+    }
+
+    /// <summary>
+    /// Gets the view of the identifier text.
+    /// </summary>
+    FORCE_INLINE StringView ToStringView() const
+    {
+        return _entry ? StringView(_entry->Text, _entry->Length) : StringView::Empty;
+    }
+
+    String ToString() const;
+
+public:
+    FORCE_INLINE bool operator==(const StringId& other) const
+    {
+        return _entry == other._entry;
+    }
+
+    FORCE_INLINE bool operator!=(const StringId& other) const
+    {
+        return _entry != other._entry;
+    }
+};
+
+template<>
+struct TIsPODType<StringId>
+{
+    enum { Value = true };
+};
+
+inline uint32 GetHash(const StringId& key)
+{
+    return key.GetHashCode();
+}
+
+namespace fmt
+{
+    template<>
+    struct formatter<StringId, Char>
+    {
+        template<typename ParseContext>
+        auto parse(ParseContext& ctx)
+        {
+            return ctx.begin();
+        }
+
+        template<typename FormatContext>
+        auto format(const StringId& v, FormatContext& ctx) -> decltype(ctx.out())
+        {
+            const Char* text = v.GetText();
+            return fmt::detail::copy_str<Char>(text, text + v.Length(), ctx.out());
+        }
+    };
+}
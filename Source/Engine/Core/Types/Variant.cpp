@@ -465,7 +465,11 @@ FLAXENGINE_API uint32 GetHash(const VariantType& key)
     return hash;
 }
 
+#if USE_LARGE_WORLDS
 static_assert(sizeof(Variant) <= 40, "Invalid Variant size!");
+#else
+static_assert(sizeof(Variant) <= 56, "Invalid Variant size!");
+#endif
 static_assert(sizeof(Variant::AsData) >= sizeof(Float2), "Invalid Variant data size!");
 static_assert(sizeof(Variant::AsData) >= sizeof(Float3), "Invalid Variant data size!");
 static_assert(sizeof(Variant::AsData) >= sizeof(Float4), "Invalid Variant data size!");
@@ -482,6 +486,8 @@ static_assert(sizeof(Variant::AsData) >= sizeof(Guid), "Invalid Variant data siz
 static_assert(sizeof(Variant::AsData) >= sizeof(BoundingSphere), "Invalid Variant data size!");
 static_assert(sizeof(Variant::AsData) >= sizeof(BoundingBox), "Invalid Variant data size!");
 static_assert(sizeof(Variant::AsData) >= sizeof(Ray), "Invalid Variant data size!");
+static_assert(sizeof(Variant::AsData) >= sizeof(Double4), "Invalid Variant data size!");
+static_assert(sizeof(Variant::AsData) >= sizeof(Transform), "Invalid Variant data size!");
 #endif
 static_assert(sizeof(Variant::AsData) >= sizeof(Array<Variant, HeapAllocation>), "Invalid Variant data size!");
 
@@ -539,8 +545,15 @@ Variant::Variant(Variant&& other) noexcept
     case VariantType::Structure:
     case VariantType::Blob:
     case VariantType::String:
-    case VariantType::Transform:
     case VariantType::Matrix:
+    case VariantType::Typename:
+#if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
+    case VariantType::BoundingSphere:
+    case VariantType::BoundingBox:
+    case VariantType::Ray:
+#endif
         AsBlob.Data = other.AsBlob.Data;
         AsBlob.Length = other.AsBlob.Length;
         other.AsBlob.Data = nullptr;
@@ -754,9 +767,13 @@ Variant::Variant(const Double3& v)
 Variant::Variant(const Double4& v)
     : Type(VariantType::Double4)
 {
+#if USE_LARGE_WORLDS
     AsBlob.Length = sizeof(Double4);
     AsBlob.Data = Allocator::Allocate(AsBlob.Length);
     *(Double4*)AsBlob.Data = v;
+#else
+    *(Double4*)AsData = v;
+#endif
 }
 
 Variant::Variant(const Int2& v)
@@ -822,9 +839,13 @@ Variant::Variant(const BoundingBox& v)
 Variant::Variant(const Transform& v)
     : Type(VariantType::Transform)
 {
+#if USE_LARGE_WORLDS
     AsBlob.Length = sizeof(Transform);
     AsBlob.Data = Allocator::Allocate(AsBlob.Length);
     *(Transform*)AsBlob.Data = v;
+#else
+    *(Transform*)AsData = v;
+#endif
 }
 
 Variant::Variant(const Ray& v)
@@ -976,11 +997,11 @@ Variant::~Variant()
         break;
     case VariantType::String:
     case VariantType::Blob:
-    case VariantType::Transform:
     case VariantType::Matrix:
     case VariantType::Typename:
-    case VariantType::Double4:
 #if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
@@ -1011,11 +1032,11 @@ Variant& Variant::operator=(Variant&& other)
     case VariantType::String:
     case VariantType::Structure:
     case VariantType::Blob:
-    case VariantType::Transform:
     case VariantType::Matrix:
     case VariantType::Typename:
-    case VariantType::Double4:
 #if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
@@ -1073,11 +1094,11 @@ Variant& Variant::operator=(const Variant& other)
         break;
     case VariantType::String:
     case VariantType::Blob:
-    case VariantType::Transform:
     case VariantType::Matrix:
     case VariantType::Typename:
-    case VariantType::Double4:
 #if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
@@ -1175,9 +1196,7 @@ bool Variant::operator==(const Variant& other) const
             return AsObject == other.AsObject;
         case VariantType::Structure:
         case VariantType::Blob:
-        case VariantType::Transform:
         case VariantType::Matrix:
-        case VariantType::Double4:
             return AsBlob.Length == other.AsBlob.Length && Platform::MemoryCompare(AsBlob.Data, other.AsBlob.Data, AsBlob.Length) == 0;
         case VariantType::Asset:
             return AsAsset == other.AsAsset;
@@ -1197,6 +1216,10 @@ bool Variant::operator==(const Variant& other) const
             return *(Double2*)AsData == *(Double2*)other.AsData;
         case VariantType::Double3:
             return *(Double3*)AsData == *(Double3*)other.AsData;
+        case VariantType::Double4:
+            return AsDouble4() == other.AsDouble4();
+        case VariantType::Transform:
+            return AsTransform() == other.AsTransform();
         case VariantType::Color:
             return *(Color*)AsData == *(Color*)other.AsData;
         case VariantType::Quaternion:
@@ -2122,7 +2145,7 @@ Variant::operator Transform() const
     switch (Type.Type)
     {
     case VariantType::Transform:
-        return *(Transform*)AsBlob.Data;
+        return AsTransform();
     case VariantType::Structure:
         if (StringUtils::Compare(Type.TypeName, Transform::TypeInitializer.GetType().Fullname.Get()) == 0)
             return *(Transform*)AsBlob.Data;
@@ -2222,9 +2245,22 @@ const Double3& Variant::AsDouble3() const
     return *(const Double3*)AsData;
 }
 
+Double4& Variant::AsDouble4()
+{
+#if USE_LARGE_WORLDS
+    return *(Double4*)AsBlob.Data;
+#else
+    return *(Double4*)AsData;
+#endif
+}
+
 const Double4& Variant::AsDouble4() const
 {
+#if USE_LARGE_WORLDS
     return *(const Double4*)AsBlob.Data;
+#else
+    return *(const Double4*)AsData;
+#endif
 }
 
 const Int2& Variant::AsInt2() const
@@ -2318,12 +2354,20 @@ const Ray& Variant::AsRay() const
 
 Transform& Variant::AsTransform()
 {
+#if USE_LARGE_WORLDS
     return *(Transform*)AsBlob.Data;
+#else
+    return *(Transform*)AsData;
+#endif
 }
 
 const Transform& Variant::AsTransform() const
 {
+#if USE_LARGE_WORLDS
     return *(const Transform*)AsBlob.Data;
+#else
+    return *(const Transform*)AsData;
+#endif
 }
 
 const Matrix& Variant::AsMatrix() const
@@ -2366,11 +2410,11 @@ void Variant::SetType(const VariantType& type)
         break;
     case VariantType::String:
     case VariantType::Blob:
-    case VariantType::Transform:
     case VariantType::Matrix:
     case VariantType::Typename:
-    case VariantType::Double4:
 #if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
@@ -2409,11 +2453,15 @@ void Variant::SetType(const VariantType& type)
     case VariantType::Asset:
         AsAsset = nullptr;
         break;
+#if USE_LARGE_WORLDS
     case VariantType::Double4:
         AsBlob.Data = Allocator::Allocate(sizeof(Double4));
         AsBlob.Length = sizeof(Double4);
         break;
-#if USE_LARGE_WORLDS
+    case VariantType::Transform:
+        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
+        AsBlob.Length = sizeof(Transform);
+        break;
     case VariantType::BoundingSphere:
         AsBlob.Data = Allocator::Allocate(sizeof(BoundingSphere));
         AsBlob.Length = sizeof(BoundingSphere);
@@ -2427,10 +2475,6 @@ void Variant::SetType(const VariantType& type)
         AsBlob.Length = sizeof(Ray);
         break;
 #endif
-    case VariantType::Transform:
-        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
-        AsBlob.Length = sizeof(Transform);
-        break;
     case VariantType::Matrix:
         AsBlob.Data = Allocator::Allocate(sizeof(Matrix));
         AsBlob.Length = sizeof(Matrix);
@@ -2478,11 +2522,11 @@ void Variant::SetType(VariantType&& type)
         break;
     case VariantType::String:
     case VariantType::Blob:
-    case VariantType::Transform:
     case VariantType::Matrix:
     case VariantType::Typename:
-    case VariantType::Double4:
 #if USE_LARGE_WORLDS
+    case VariantType::Transform:
+    case VariantType::Double4:
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
@@ -2521,11 +2565,15 @@ void Variant::SetType(VariantType&& type)
     case VariantType::Asset:
         AsAsset = nullptr;
         break;
+#if USE_LARGE_WORLDS
     case VariantType::Double4:
         AsBlob.Data = Allocator::Allocate(sizeof(Double4));
         AsBlob.Length = sizeof(Double4);
         break;
-#if USE_LARGE_WORLDS
+    case VariantType::Transform:
+        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
+        AsBlob.Length = sizeof(Transform);
+        break;
     case VariantType::BoundingSphere:
         AsBlob.Data = Allocator::Allocate(sizeof(BoundingSphere));
         AsBlob.Length = sizeof(BoundingSphere);
@@ -2539,10 +2587,6 @@ void Variant::SetType(VariantType&& type)
         AsBlob.Length = sizeof(Ray);
         break;
 #endif
-    case VariantType::Transform:
-        AsBlob.Data = Allocator::Allocate(sizeof(Transform));
-        AsBlob.Length = sizeof(Transform);
-        break;
     case VariantType::Matrix:
         AsBlob.Data = Allocator::Allocate(sizeof(Matrix));
         AsBlob.Length = sizeof(Matrix);
@@ -2796,7 +2840,7 @@ String Variant::ToString() const
     case VariantType::BoundingBox:
         return AsBoundingBox().ToString();
     case VariantType::Transform:
-        return (*(Transform*)AsBlob.Data).ToString();
+        return AsTransform().ToString();
     case VariantType::Ray:
         return AsRay().ToString();
     case VariantType::Matrix:
@@ -2966,7 +3010,10 @@ void Variant::InvertInline()
     case VariantType::Uint16:
     case VariantType::Double2:
     case VariantType::Double3:
+#if !USE_LARGE_WORLDS
     case VariantType::Double4:
+    case VariantType::Transform:
+#endif
         static_assert(sizeof(data) >= sizeof(AsData), "Invalid memory size.");
         Platform::MemoryCopy(data, AsData, sizeof(AsData));
         break;
@@ -2974,8 +3021,9 @@ void Variant::InvertInline()
     case VariantType::BoundingSphere:
     case VariantType::BoundingBox:
     case VariantType::Ray:
-#endif
+    case VariantType::Double4:
     case VariantType::Transform:
+#endif
     case VariantType::Matrix:
         ASSERT(sizeof(data) >= AsBlob.Length);
         Platform::MemoryCopy(data, AsBlob.Data, AsBlob.Length);
@@ -3859,7 +3907,7 @@ bool Variant::NearEqual(const Variant& a, const Variant& b, float epsilon)
     case VariantType::Double3:
         return Double3::NearEqual(*(Double3*)a.AsData, *(Double3*)b.AsData, epsilon);
     case VariantType::Double4:
-        return Double4::NearEqual(*(Double4*)a.AsBlob.Data, *(Double4*)b.AsBlob.Data, epsilon);
+        return Double4::NearEqual(a.AsDouble4(), b.AsDouble4(), epsilon);
     case VariantType::Color:
         return Color::NearEqual(*(Color*)a.AsData, *(Color*)b.AsData, epsilon);
     case VariantType::BoundingSphere:
@@ -3871,7 +3919,7 @@ bool Variant::NearEqual(const Variant& a, const Variant& b, float epsilon)
     case VariantType::BoundingBox:
         return BoundingBox::NearEqual(a.AsBoundingBox(), b.AsBoundingBox(), epsilon);
     case VariantType::Transform:
-        return Transform::NearEqual(*(Transform*)a.AsBlob.Data, *(Transform*)b.AsBlob.Data, epsilon);
+        return Transform::NearEqual(a.AsTransform(), b.AsTransform(), epsilon);
     case VariantType::Ray:
         return Ray::NearEqual(a.AsRay(), b.AsRay(), epsilon);
     default:
@@ -3912,7 +3960,7 @@ Variant Variant::Lerp(const Variant& a, const Variant& b, float alpha)
     case VariantType::Double3:
         return Double3::Lerp(*(Double3*)a.AsData, *(Double3*)b.AsData, alpha);
     case VariantType::Double4:
-        return Double4::Lerp(*(Double4*)a.AsBlob.Data, *(Double4*)b.AsBlob.Data, alpha);
+        return Double4::Lerp(a.AsDouble4(), b.AsDouble4(), alpha);
     case VariantType::Color:
         return Color::Lerp(*(Color*)a.AsData, *(Color*)b.AsData, alpha);
     case VariantType::Quaternion:
@@ -3922,7 +3970,7 @@ Variant Variant::Lerp(const Variant& a, const Variant& b, float alpha)
     case VariantType::Rectangle:
         return Rectangle(Float2::Lerp((*(Rectangle*)a.AsData).Location, (*(Rectangle*)b.AsData).Location, alpha), Float2::Lerp((*(Rectangle*)a.AsData).Size, (*(Rectangle*)b.AsData).Size, alpha));
     case VariantType::Transform:
-        return Variant(Transform::Lerp(*(Transform*)a.AsBlob.Data, *(Transform*)b.AsBlob.Data, alpha));
+        return Variant(Transform::Lerp(a.AsTransform(), b.AsTransform(), alpha));
     case VariantType::BoundingBox:
         return Variant(BoundingBox(Vector3::Lerp(a.AsBoundingBox().Minimum, b.AsBoundingBox().Minimum, alpha), Vector3::Lerp(a.AsBoundingBox().Maximum, b.AsBoundingBox().Maximum, alpha)));
     case VariantType::Ray:
@@ -174,7 +174,12 @@ API_STRUCT(InBuild) struct FLAXENGINE_API Variant
 
         Dictionary<Variant, Variant, HeapAllocation>* AsDictionary;
 
+#if USE_LARGE_WORLDS
         byte AsData[24];
+#else
+        // Fits Transform and Double4 to store them inline without a heap allocation (Matrix still uses AsBlob)
+        byte AsData[40];
+#endif
     };
 
 public:
@@ -327,6 +332,7 @@ API_STRUCT(InBuild) struct FLAXENGINE_API Variant
     const Float4& AsFloat4() const;
     const Double2& AsDouble2() const;
     const Double3& AsDouble3() const;
+    Double4& AsDouble4();
     const Double4& AsDouble4() const;
     const Int2& AsInt2() const;
     const Int3& AsInt3() const;
@@ -381,8 +387,19 @@ API_STRUCT(InBuild) struct FLAXENGINE_API Variant
     // Frees the object or data owned by this Variant container (eg. structure or object).
     void DeleteValue();
 
-    FORCE_INLINE Variant Cast(const VariantType& to) const
+    FORCE_INLINE Variant Cast(const VariantType& to) const&
+    {
+        // Fast-path for in-built types that skips the conversion
+        if (Type.Type == to.Type && !Type.TypeName && !to.TypeName)
+            return *this;
+        return Cast(*this, to);
+    }
+
+    FORCE_INLINE Variant Cast(const VariantType& to) &&
     {
+        // Fast-path that moves the temporary value (eg. graph box value) if it's already of the target type
+        if (Type == to)
+            return MoveTemp(*this);
         return Cast(*this, to);
     }
 
@@ -18,6 +18,7 @@
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/DynamicBuffer.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Animations/AnimationUtils.h"
@@ -52,6 +53,8 @@
 #define DEBUG_DRAW_ARC_RESOLUTION 32
 //
 #define DEBUG_DRAW_TRIANGLE_SPHERE_RESOLUTION 12
+//
+#define DEBUG_DRAW_INITIAL_INSTANCES_CAPACITY 256
 
 struct DebugSphereCache
 {
@@ -127,6 +130,35 @@ PACK_STRUCT(struct Vertex {
     Color32 Color;
     });
 
+PACK_STRUCT(struct ShapeInstance {
+    Float4 Row0;
+    Float4 Row1;
+    Float4 Row2;
+    Color32 Color;
+    });
+
+struct DebugShape
+{
+    ShapeInstance Instance;
+    float TimeLeft;
+};
+
+// Unit meshes of the shapes drawn with instancing
+enum class DebugShapeMesh
+{
+    SphereLOD0 = 0,
+    SphereLOD1,
+    SphereLOD2,
+    Box,
+    MAX
+};
+
+struct DebugDrawCall
+{
+    int32 StartVertex;
+    int32 VertexCount;
+};
+
 PACK_STRUCT(struct Data {
     Matrix ViewProjection;
     Float2 Padding;
@@ -181,17 +213,27 @@ struct PsData
 };
 
 template<typename T>
-void UpdateList(float dt, Array<T>& list)
+bool UpdateList(float dt, Array<T>& list)
 {
-    for (int32 i = 0; i < list.Count() && list.HasItems(); i++)
+    // Remove expired items in a single pass (preserves the order)
+    T* items = list.Get();
+    const int32 count = list.Count();
+    int32 dst = 0;
+    for (int32 i = 0; i < count; i++)
     {
-        list[i].TimeLeft -= dt;
-        if (list[i].TimeLeft <= 0)
+        T& e = items[i];
+        e.TimeLeft -= dt;
+        if (e.TimeLeft > 0)
         {
-            list.RemoveAt(i);
-            i--;
+            if (dst != i)
+                items[dst] = MoveTemp(e);
+            dst++;
         }
     }
+    if (dst == count)
+        return false;
+    list.Resize(dst);
+    return true;
 }
 
 void TeleportList(const Float3& delta, Array<DebugLine>& list)
@@ -229,6 +271,29 @@ void TeleportList(const Float3& delta, Array<DebugText3D>& list)
     }
 }
 
+FORCE_INLINE void TeleportInstance(const Float3& delta, ShapeInstance& instance)
+{
+    instance.Row0.W += delta.X;
+    instance.Row1.W += delta.Y;
+    instance.Row2.W += delta.Z;
+}
+
+void TeleportList(const Float3& delta, Array<DebugShape>& list)
+{
+    for (auto& v : list)
+    {
+        TeleportInstance(delta, v.Instance);
+    }
+}
+
+void TeleportList(const Float3& delta, Array<ShapeInstance>& list)
+{
+    for (auto& v : list)
+    {
+        TeleportInstance(delta, v);
+    }
+}
+
 struct DebugDrawData
 {
     Array<DebugLine> DefaultLines;
@@ -241,10 +306,24 @@ struct DebugDrawData
     Array<DebugText2D> OneFrameText2D;
     Array<DebugText3D> DefaultText3D;
     Array<DebugText3D> OneFrameText3D;
+    Array<DebugShape> DefaultShapes[(int32)DebugShapeMesh::MAX];
+    Array<ShapeInstance> OneFrameShapes[(int32)DebugShapeMesh::MAX];
+
+    // GPU-resident vertex buffer with the persistent (duration > 0) lines and triangles (uploaded only when they change)
+    GPUBuffer* PersistentVB = nullptr;
+    bool PersistentDirty = true;
+    DebugDrawCall PersistentLines = { 0, 0 };
+    DebugDrawCall PersistentTriangles = { 0, 0 };
+    DebugDrawCall PersistentWireTriangles = { 0, 0 };
+
+    ~DebugDrawData()
+    {
+        SAFE_DELETE_GPU_RESOURCE(PersistentVB);
+    }
 
     inline int32 Count() const
     {
-        return LinesCount() + TrianglesCount() + TextCount();
+        return LinesCount() + TrianglesCount() + TextCount() + ShapesCount();
     }
 
     inline int32 LinesCount() const
@@ -262,6 +341,19 @@ struct DebugDrawData
         return DefaultText2D.Count() + OneFrameText2D.Count() + DefaultText3D.Count() + OneFrameText3D.Count();
     }
 
+    inline int32 ShapesCount() const
+    {
+        int32 result = 0;
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+            result += DefaultShapes[i].Count() + OneFrameShapes[i].Count();
+        return result;
+    }
+
+    inline bool IsPersistentDirty() const
+    {
+        return PersistentDirty || PersistentLines.VertexCount != DefaultLines.Count() * 2 || PersistentTriangles.VertexCount != DefaultTriangles.Count() * 3 || PersistentWireTriangles.VertexCount != DefaultWireTriangles.Count() * 3;
+    }
+
     inline void Add(const DebugTriangle& t)
     {
         if (t.TimeLeft > 0)
@@ -280,11 +372,16 @@ struct DebugDrawData
 
     inline void Update(float deltaTime)
     {
-        UpdateList(deltaTime, DefaultLines);
-        UpdateList(deltaTime, DefaultTriangles);
-        UpdateList(deltaTime, DefaultWireTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultLines);
+        PersistentDirty |= UpdateList(deltaTime, DefaultTriangles);
+        PersistentDirty |= UpdateList(deltaTime, DefaultWireTriangles);
         UpdateList(deltaTime, DefaultText2D);
         UpdateList(deltaTime, DefaultText3D);
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+        {
+            UpdateList(deltaTime, DefaultShapes[i]);
+            OneFrameShapes[i].Clear();
+        }
 
         OneFrameLines.Clear();
         OneFrameTriangles.Clear();
@@ -303,6 +400,12 @@ struct DebugDrawData
         TeleportList(delta, OneFrameWireTriangles);
         TeleportList(delta, DefaultText3D);
         TeleportList(delta, OneFrameText3D);
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+        {
+            TeleportList(delta, DefaultShapes[i]);
+            TeleportList(delta, OneFrameShapes[i]);
+        }
+        PersistentDirty = true;
     }
 
     inline void Clear()
@@ -317,6 +420,12 @@ struct DebugDrawData
         OneFrameText2D.Clear();
         DefaultText3D.Clear();
         OneFrameText3D.Clear();
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+        {
+            DefaultShapes[i].Clear();
+            OneFrameShapes[i].Clear();
+        }
+        PersistentDirty = true;
     }
 
     inline void Release()
@@ -331,6 +440,13 @@ struct DebugDrawData
         OneFrameText2D.Resize(0);
         DefaultText3D.Resize(0);
         OneFrameText3D.Resize(0);
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+        {
+            DefaultShapes[i].Resize(0);
+            OneFrameShapes[i].Resize(0);
+        }
+        SAFE_DELETE_GPU_RESOURCE(PersistentVB);
+        PersistentDirty = true;
     }
 };
 
@@ -355,7 +471,12 @@ namespace
     PsData DebugDrawPsWireTrianglesDepthTest;
     PsData DebugDrawPsTrianglesDefault;
     PsData DebugDrawPsTrianglesDepthTest;
+    PsData DebugDrawPsShapesDefault;
+    PsData DebugDrawPsShapesDepthTest;
     DynamicVertexBuffer* DebugDrawVB = nullptr;
+    DynamicVertexBuffer* DebugDrawInstancesVB = nullptr;
+    GPUBuffer* DebugDrawShapesVB = nullptr;
+    DebugDrawCall ShapeMeshes[(int32)DebugShapeMesh::MAX];
     Float3 CircleCache[DEBUG_DRAW_CIRCLE_VERTICES];
     Array<Float3> SphereTriangleCache;
     DebugSphereCache SphereCache[3];
@@ -369,6 +490,8 @@ namespace
         DebugDrawPsWireTrianglesDepthTest.Release();
         DebugDrawPsTrianglesDefault.Release();
         DebugDrawPsTrianglesDepthTest.Release();
+        DebugDrawPsShapesDefault.Release();
+        DebugDrawPsShapesDepthTest.Release();
     }
 
 #endif
@@ -394,12 +517,6 @@ int32 BoxLineIndicesCache[] =
     // @formatter:on
 };
 
-struct DebugDrawCall
-{
-    int32 StartVertex;
-    int32 VertexCount;
-};
-
 DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
 {
     DebugDrawCall drawCall;
@@ -410,20 +527,27 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<Vertex>& list)
     return drawCall;
 }
 
-DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugLine>& list)
+Vertex* WriteVertices(Vertex* dst, const Array<DebugLine>& list)
 {
-    DebugDrawCall drawCall;
-    drawCall.StartVertex = vertexCounter;
-    drawCall.VertexCount = list.Count() * 2;
-    vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(list.Count() * 2);
-    for (int32 i = 0, j = 0; i < list.Count(); i++)
+    for (int32 i = 0; i < list.Count(); i++)
     {
         const DebugLine& l = list.Get()[i];
-        dst[j++] = { l.Start, l.Color };
-        dst[j++] = { l.End, l.Color };
+        *dst++ = { l.Start, l.Color };
+        *dst++ = { l.End, l.Color };
     }
-    return drawCall;
+    return dst;
+}
+
+Vertex* WriteVertices(Vertex* dst, const Array<DebugTriangle>& list)
+{
+    for (int32 i = 0; i < list.Count(); i++)
+    {
+        const DebugTriangle& l = list.Get()[i];
+        *dst++ = { l.V0, l.Color };
+        *dst++ = { l.V1, l.Color };
+        *dst++ = { l.V2, l.Color };
+    }
+    return dst;
 }
 
 DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
@@ -432,28 +556,95 @@ DebugDrawCall WriteList(int32& vertexCounter, const Array<DebugTriangle>& list)
     drawCall.StartVertex = vertexCounter;
     drawCall.VertexCount = list.Count() * 3;
     vertexCounter += drawCall.VertexCount;
-    Vertex* dst = DebugDrawVB->WriteReserve<Vertex>(list.Count() * 3);
-    for (int32 i = 0, j = 0; i < list.Count(); i++)
-    {
-        const DebugTriangle& l = list.Get()[i];
-        dst[j++] = { l.V0, l.Color };
-        dst[j++] = { l.V1, l.Color };
-        dst[j++] = { l.V2, l.Color };
-    }
+    WriteVertices(DebugDrawVB->WriteReserve<Vertex>(drawCall.VertexCount), list);
     return drawCall;
 }
 
-template<typename T, typename U>
-DebugDrawCall WriteLists(int32& vertexCounter, const Array<T>& listA, const Array<U>& listB)
+DebugDrawCall WriteInstances(int32& instanceCounter, const Array<DebugShape>& listA, const Array<ShapeInstance>& listB)
 {
-    const DebugDrawCall drawCallA = WriteList(vertexCounter, listA);
-    const DebugDrawCall drawCallB = WriteList(vertexCounter, listB);
     DebugDrawCall drawCall;
-    drawCall.StartVertex = drawCallA.StartVertex;
-    drawCall.VertexCount = drawCallA.VertexCount + drawCallB.VertexCount;
+    drawCall.StartVertex = instanceCounter;
+    drawCall.VertexCount = listA.Count() + listB.Count();
+    if (drawCall.VertexCount == 0)
+        return drawCall;
+    instanceCounter += drawCall.VertexCount;
+    ShapeInstance* dst = DebugDrawInstancesVB->WriteReserve<ShapeInstance>(drawCall.VertexCount);
+    for (int32 i = 0; i < listA.Count(); i++)
+        *dst++ = listA.Get()[i].Instance;
+    Platform::MemoryCopy(dst, listB.Get(), listB.Count() * sizeof(ShapeInstance));
     return drawCall;
 }
 
+void UpdatePersistent(GPUContext* context, DebugDrawData& data)
+{
+    if (!data.IsPersistentDirty())
+        return;
+    data.PersistentDirty = false;
+    data.PersistentLines = { 0, data.DefaultLines.Count() * 2 };
+    data.PersistentTriangles = { data.PersistentLines.VertexCount, data.DefaultTriangles.Count() * 3 };
+    data.PersistentWireTriangles = { data.PersistentTriangles.StartVertex + data.PersistentTriangles.VertexCount, data.DefaultWireTriangles.Count() * 3 };
+    const int32 count = data.PersistentWireTriangles.StartVertex + data.PersistentWireTriangles.VertexCount;
+    if (count == 0)
+        return;
+    PROFILE_CPU_NAMED("Persistent");
+
+    // Prepare vertices
+    Array<Vertex> vertices;
+    vertices.Resize(count);
+    Vertex* dst = vertices.Get();
+    dst = WriteVertices(dst, data.DefaultLines);
+    dst = WriteVertices(dst, data.DefaultTriangles);
+    WriteVertices(dst, data.DefaultWireTriangles);
+
+    // Upload to GPU (grow with a slack to reduce reallocations when adding more primitives)
+    const uint32 size = count * sizeof(Vertex);
+    if (!data.PersistentVB)
+        data.PersistentVB = GPUDevice::Instance->CreateBuffer(TEXT("DebugDraw.PersistentVB"));
+    if (data.PersistentVB->GetSize() < size && data.PersistentVB->Init(GPUBufferDescription::Vertex(sizeof(Vertex), Math::RoundUpToPowerOf2(count))))
+    {
+        LOG(Warning, "Failed to allocate debug draw buffer.");
+        data.PersistentLines.VertexCount = data.PersistentTriangles.VertexCount = data.PersistentWireTriangles.VertexCount = 0;
+        return;
+    }
+    context->UpdateBuffer(data.PersistentVB, vertices.Get(), size);
+}
+
+FORCE_INLINE void DrawCall(GPUContext* context, GPUBuffer* vb, const DebugDrawCall& drawCall)
+{
+    if (drawCall.VertexCount)
+    {
+        context->BindVB(ToSpan(&vb, 1));
+        context->Draw(drawCall.StartVertex, drawCall.VertexCount);
+    }
+}
+
+void DrawShapes(GPUContext* context, const DebugDrawCall* drawCalls)
+{
+    GPUBuffer* vbs[2] = { DebugDrawShapesVB, DebugDrawInstancesVB->GetBuffer() };
+    context->BindVB(ToSpan(vbs, 2));
+    for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+    {
+        const DebugDrawCall& mesh = ShapeMeshes[i];
+        const DebugDrawCall& instances = drawCalls[i];
+        if (instances.VertexCount)
+            context->DrawInstanced(mesh.VertexCount, instances.VertexCount, instances.StartVertex, mesh.StartVertex);
+    }
+}
+
+FORCE_INLINE void AddShape(DebugShapeMesh mesh, const Float3& center, const Float3& xAxis, const Float3& yAxis, const Float3& zAxis, const Color& color, float duration, bool depthTest)
+{
+    ShapeInstance instance;
+    instance.Row0 = Float4(xAxis.X, yAxis.X, zAxis.X, center.X);
+    instance.Row1 = Float4(xAxis.Y, yAxis.Y, zAxis.Y, center.Y);
+    instance.Row2 = Float4(xAxis.Z, yAxis.Z, zAxis.Z, center.Z);
+    instance.Color = Color32(color);
+    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
+    if (duration > 0)
+        debugDrawData.DefaultShapes[(int32)mesh].Add({ instance, duration });
+    else
+        debugDrawData.OneFrameShapes[(int32)mesh].Add(instance);
+}
+
 FORCE_INLINE DebugTriangle* AppendTriangles(int32 count, float duration, bool depthTest)
 {
     Array<DebugTriangle>* list;
@@ -675,15 +866,49 @@ void DebugDrawService::Update()
         desc.Wireframe = true;
         failed |= DebugDrawPsWireTrianglesDepthTest.Create(desc);
 
+        // Instanced shapes
+        desc.Wireframe = false;
+        desc.VS = shader->GetVS("VS_Instanced");
+        desc.PrimitiveTopology = PrimitiveTopologyType::Line;
+        desc.PS = shader->GetPS("PS", 0);
+        failed |= DebugDrawPsShapesDefault.Create(desc);
+        desc.PS = shader->GetPS("PS", 2);
+        failed |= DebugDrawPsShapesDepthTest.Create(desc);
+
         if (failed)
         {
             LOG(Fatal, "Cannot setup DebugDraw service!");
         }
     }
 
-    // Vertex buffer
+    // Vertex buffers
     if (DebugDrawVB == nullptr)
         DebugDrawVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_VB_CAPACITY * sizeof(Vertex)), (uint32)sizeof(Vertex), TEXT("DebugDraw.VB"));
+    if (DebugDrawInstancesVB == nullptr)
+        DebugDrawInstancesVB = New<DynamicVertexBuffer>((uint32)(DEBUG_DRAW_INITIAL_INSTANCES_CAPACITY * sizeof(ShapeInstance)), (uint32)sizeof(ShapeInstance), TEXT("DebugDraw.Instances"));
+    if (DebugDrawShapesVB == nullptr)
+    {
+        // Build unit meshes of the instanced shapes (sphere LODs and box)
+        Array<Vertex> vertices;
+        const Color32 white = Color32::White;
+        for (int32 lod = 0; lod < 3; lod++)
+        {
+            const auto& cache = SphereCache[lod];
+            ShapeMeshes[lod] = { vertices.Count(), cache.Vertices.Count() };
+            for (const Float3& v : cache.Vertices)
+                vertices.Add({ v, white });
+        }
+        Float3 corners[8];
+        BoundingBox(Float3(-1.0f), Float3(1.0f)).GetCorners(corners);
+        ShapeMeshes[(int32)DebugShapeMesh::Box] = { vertices.Count(), ARRAY_COUNT(BoxLineIndicesCache) };
+        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache); i++)
+            vertices.Add({ corners[BoxLineIndicesCache[i]], white });
+        DebugDrawShapesVB = GPUDevice::Instance->CreateBuffer(TEXT("DebugDraw.Shapes"));
+        if (DebugDrawShapesVB->Init(GPUBufferDescription::Vertex(sizeof(Vertex), vertices.Count(), vertices.Get())))
+        {
+            LOG(Fatal, "Cannot setup DebugDraw service!");
+        }
+    }
 }
 
 void DebugDrawService::Dispose()
@@ -700,7 +925,11 @@ void DebugDrawService::Dispose()
     DebugDrawPsWireTrianglesDepthTest.Release();
     DebugDrawPsTrianglesDefault.Release();
     DebugDrawPsTrianglesDepthTest.Release();
+    DebugDrawPsShapesDefault.Release();
+    DebugDrawPsShapesDepthTest.Release();
     SAFE_DELETE(DebugDrawVB);
+    SAFE_DELETE(DebugDrawInstancesVB);
+    SAFE_DELETE_GPU_RESOURCE(DebugDrawShapesVB);
     DebugDrawShader = nullptr;
 }
 
@@ -744,7 +973,7 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     const int32 debugDrawDefaultCount = Context->DebugDrawDefault.Count();
     if (DebugDrawShader == nullptr || !DebugDrawShader->IsLoaded() || debugDrawDepthTestCount + debugDrawDefaultCount == 0 || DebugDrawPsWireTrianglesDepthTest.Depth == nullptr)
         return;
-    if (renderContext.Buffers == nullptr || !DebugDrawVB)
+    if (renderContext.Buffers == nullptr || !DebugDrawVB || !DebugDrawShapesVB)
         return;
     auto context = GPUDevice::Instance->GetMainContext();
     const RenderView& view = renderContext.View;
@@ -764,21 +993,37 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     if (target == nullptr && renderContext.Task)
         target = renderContext.Task->GetOutputView();
 
-    // Fill vertex buffer and upload data
+    // Fill vertex buffers and upload data
     DebugDrawCall depthTestLines, defaultLines, depthTestTriangles, defaultTriangles, depthTestWireTriangles, defaultWireTriangles;
+    DebugDrawCall depthTestShapes[(int32)DebugShapeMesh::MAX], defaultShapes[(int32)DebugShapeMesh::MAX];
     {
         PROFILE_CPU_NAMED("Update Buffer");
+
+        // Persistent primitives are kept in GPU memory and updated only when they change
+        UpdatePersistent(context, Context->DebugDrawDepthTest);
+        UpdatePersistent(context, Context->DebugDrawDefault);
+
         DebugDrawVB->Clear();
         int32 vertexCounter = 0;
-        depthTestLines = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultLines, Context->DebugDrawDepthTest.OneFrameLines);
-        defaultLines = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultLines, Context->DebugDrawDefault.OneFrameLines);
-        depthTestTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultTriangles, Context->DebugDrawDepthTest.OneFrameTriangles);
-        defaultTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultTriangles, Context->DebugDrawDefault.OneFrameTriangles);
-        depthTestWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDepthTest.DefaultWireTriangles, Context->DebugDrawDepthTest.OneFrameWireTriangles);
-        defaultWireTriangles = WriteLists(vertexCounter, Context->DebugDrawDefault.DefaultWireTriangles, Context->DebugDrawDefault.OneFrameWireTriangles);
+        depthTestLines = WriteList(vertexCounter, Context->DebugDrawDepthTest.OneFrameLines);
+        defaultLines = WriteList(vertexCounter, Context->DebugDrawDefault.OneFrameLines);
+        depthTestTriangles = WriteList(vertexCounter, Context->DebugDrawDepthTest.OneFrameTriangles);
+        defaultTriangles = WriteList(vertexCounter, Context->DebugDrawDefault.OneFrameTriangles);
+        depthTestWireTriangles = WriteList(vertexCounter, Context->DebugDrawDepthTest.OneFrameWireTriangles);
+        defaultWireTriangles = WriteList(vertexCounter, Context->DebugDrawDefault.OneFrameWireTriangles);
+
+        DebugDrawInstancesVB->Clear();
+        int32 instanceCounter = 0;
+        for (int32 i = 0; i < (int32)DebugShapeMesh::MAX; i++)
+        {
+            depthTestShapes[i] = WriteInstances(instanceCounter, Context->DebugDrawDepthTest.DefaultShapes[i], Context->DebugDrawDepthTest.OneFrameShapes[i]);
+            defaultShapes[i] = WriteInstances(instanceCounter, Context->DebugDrawDefault.DefaultShapes[i], Context->DebugDrawDefault.OneFrameShapes[i]);
+        }
+
         {
             PROFILE_CPU_NAMED("Flush");
             DebugDrawVB->Flush(context);
+            DebugDrawInstancesVB->Flush(context);
         }
     }
 
@@ -795,7 +1040,8 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     auto vb = DebugDrawVB->GetBuffer();
 
     // Draw with depth test
-    if (depthTestLines.VertexCount + depthTestTriangles.VertexCount + depthTestWireTriangles.VertexCount > 0)
+    const DebugDrawData& depthTestData = Context->DebugDrawDepthTest;
+    if (depthTestData.LinesCount() + depthTestData.TrianglesCount() + depthTestData.ShapesCount() > 0)
     {
         if (data.EnableDepthTest)
             context->BindSR(0, renderContext.Buffers->DepthBuffer);
@@ -804,30 +1050,38 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
         context->SetRenderTarget(depthBuffer ? depthBuffer : (data.EnableDepthTest ? nullptr : renderContext.Buffers->DepthBuffer->View()), target);
 
         // Lines
-        if (depthTestLines.VertexCount)
+        if (depthTestLines.VertexCount + depthTestData.PersistentLines.VertexCount)
         {
             auto state = data.EnableDepthTest ? &DebugDrawPsLinesDepthTest : &DebugDrawPsLinesDefault;
             context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestLines.StartVertex, depthTestLines.VertexCount);
+            DrawCall(context, depthTestData.PersistentVB, depthTestData.PersistentLines);
+            DrawCall(context, vb, depthTestLines);
+        }
+
+        // Shapes
+        if (depthTestData.ShapesCount())
+        {
+            auto state = data.EnableDepthTest ? &DebugDrawPsShapesDepthTest : &DebugDrawPsShapesDefault;
+            context->SetState(state->Get(enableDepthWrite, true));
+            DrawShapes(context, depthTestShapes);
         }
 
         // Wire Triangles
-        if (depthTestWireTriangles.VertexCount)
+        if (depthTestWireTriangles.VertexCount + depthTestData.PersistentWireTriangles.VertexCount)
         {
             auto state = data.EnableDepthTest ? &DebugDrawPsWireTrianglesDepthTest : &DebugDrawPsWireTrianglesDefault;
             context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestWireTriangles.StartVertex, depthTestWireTriangles.VertexCount);
+            DrawCall(context, depthTestData.PersistentVB, depthTestData.PersistentWireTriangles);
+            DrawCall(context, vb, depthTestWireTriangles);
         }
 
         // Triangles
-        if (depthTestTriangles.VertexCount)
+        if (depthTestTriangles.VertexCount + depthTestData.PersistentTriangles.VertexCount)
         {
             auto state = data.EnableDepthTest ? &DebugDrawPsTrianglesDepthTest : &DebugDrawPsTrianglesDefault;
             context->SetState(state->Get(enableDepthWrite, true));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(depthTestTriangles.StartVertex, depthTestTriangles.VertexCount);
+            DrawCall(context, depthTestData.PersistentVB, depthTestData.PersistentTriangles);
+            DrawCall(context, vb, depthTestTriangles);
         }
 
         if (data.EnableDepthTest)
@@ -835,32 +1089,40 @@ void DebugDraw::Draw(RenderContext& renderContext, GPUTextureView* target, GPUTe
     }
 
     // Draw without depth
-    if (defaultLines.VertexCount + defaultTriangles.VertexCount + defaultWireTriangles.VertexCount > 0)
+    const DebugDrawData& defaultData = Context->DebugDrawDefault;
+    if (defaultData.LinesCount() + defaultData.TrianglesCount() + defaultData.ShapesCount() > 0)
     {
         context->SetRenderTarget(target);
 
         // Lines
-        if (defaultLines.VertexCount)
+        if (defaultLines.VertexCount + defaultData.PersistentLines.VertexCount)
         {
             context->SetState(DebugDrawPsLinesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultLines.StartVertex, defaultLines.VertexCount);
+            DrawCall(context, defaultData.PersistentVB, defaultData.PersistentLines);
+            DrawCall(context, vb, defaultLines);
+        }
+
+        // Shapes
+        if (defaultData.ShapesCount())
+        {
+            context->SetState(DebugDrawPsShapesDefault.Get(false, false));
+            DrawShapes(context, defaultShapes);
         }
 
         // Wire Triangles
-        if (defaultWireTriangles.VertexCount)
+        if (defaultWireTriangles.VertexCount + defaultData.PersistentWireTriangles.VertexCount)
         {
             context->SetState(DebugDrawPsWireTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultWireTriangles.StartVertex, defaultWireTriangles.VertexCount);
+            DrawCall(context, defaultData.PersistentVB, defaultData.PersistentWireTriangles);
+            DrawCall(context, vb, defaultWireTriangles);
         }
 
         // Triangles
-        if (defaultTriangles.VertexCount)
+        if (defaultTriangles.VertexCount + defaultData.PersistentTriangles.VertexCount)
         {
             context->SetState(DebugDrawPsTrianglesDefault.Get(false, false));
-            context->BindVB(ToSpan(&vb, 1));
-            context->Draw(defaultTriangles.StartVertex, defaultTriangles.VertexCount);
+            DrawCall(context, defaultData.PersistentVB, defaultData.PersistentTriangles);
+            DrawCall(context, vb, defaultTriangles);
         }
     }
 
@@ -1183,36 +1445,10 @@ void DebugDraw::DrawBezier(const Vector3& p1, const Vector3& p2, const Vector3&
 
 void DebugDraw::DrawWireBox(const BoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit box
+    const Float3 center = box.GetCenter() - Context->Origin;
+    const Float3 extents = box.GetSize() * 0.5f;
+    AddShape(DebugShapeMesh::Box, center, Float3(extents.X, 0, 0), Float3(0, extents.Y, 0), Float3(0, 0, extents.Z), color, duration, depthTest);
 }
 
 void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& color, float duration, bool depthTest)
@@ -1251,36 +1487,12 @@ void DebugDraw::DrawWireFrustum(const BoundingFrustum& frustum, const Color& col
 
 void DebugDraw::DrawWireBox(const OrientedBoundingBox& box, const Color& color, float duration, bool depthTest)
 {
-    // Get corners
-    Vector3 corners[8];
-    box.GetCorners(corners);
-    for (Vector3& c : corners)
-        c -= Context->Origin;
-
-    // Draw lines
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Start = corners[BoxLineIndicesCache[i++]];
-            l.End = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        // TODO: draw lines as strips to reuse vertices with a single draw call
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (uint32 i = 0; i < ARRAY_COUNT(BoxLineIndicesCache);)
-        {
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = corners[BoxLineIndicesCache[i++]];
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit box
+    const Float3 center = box.Transformation.Translation - Context->Origin;
+    const Float3 xAxis = box.Transformation.LocalToWorldVector(Vector3(box.Extents.X, 0, 0));
+    const Float3 yAxis = box.Transformation.LocalToWorldVector(Vector3(0, box.Extents.Y, 0));
+    const Float3 zAxis = box.Transformation.LocalToWorldVector(Vector3(0, 0, box.Extents.Z));
+    AddShape(DebugShapeMesh::Box, center, xAxis, yAxis, zAxis, color, duration, depthTest);
 }
 
 void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
@@ -1296,31 +1508,9 @@ void DebugDraw::DrawWireSphere(const BoundingSphere& sphere, const Color& color,
         index = 1;
     else
         index = 2;
-    auto& cache = SphereCache[index];
 
-    // Draw lines of the unit sphere after linear transform
-    auto& debugDrawData = depthTest ? Context->DebugDrawDepthTest : Context->DebugDrawDefault;
-    if (duration > 0)
-    {
-        DebugLine l = { Float3::Zero, Float3::Zero, Color32(color), duration };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Start = centerF + cache.Vertices.Get()[i++] * radiusF;
-            l.End = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.DefaultLines.Add(l);
-        }
-    }
-    else
-    {
-        Vertex l = { Float3::Zero, Color32(color) };
-        for (int32 i = 0; i < cache.Vertices.Count();)
-        {
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-            l.Position = centerF + cache.Vertices.Get()[i++] * radiusF;
-            debugDrawData.OneFrameLines.Add(l);
-        }
-    }
+    // Draw instanced unit sphere
+    AddShape((DebugShapeMesh)index, centerF, Float3(radiusF, 0, 0), Float3(0, radiusF, 0), Float3(0, 0, radiusF), color, duration, depthTest);
 }
 
 void DebugDraw::DrawSphere(const BoundingSphere& sphere, const Color& color, float duration, bool depthTest)
@@ -127,12 +127,14 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-novsync ", NoVSync);
     PARSE_BOOL_SWITCH("-nolog ", NoLog);
     PARSE_BOOL_SWITCH("-std ", Std);
+    PARSE_BOOL_SWITCH("-logasync ", LogAsync);
 #if !BUILD_RELEASE
     PARSE_ARG_SWITCH("-debug ", DebuggerAddress);
     PARSE_BOOL_SWITCH("-debugwait ", WaitForDebugger);
 #endif
 #if PLATFORM_HAS_HEADLESS_MODE
     PARSE_BOOL_SWITCH("-headless ", Headless);
+    PARSE_BOOL_SWITCH("-server ", Server);
 #endif
     PARSE_BOOL_SWITCH("-d3d12 ", D3D12);
     PARSE_BOOL_SWITCH("-d3d11 ", D3D11);
@@ -145,6 +147,19 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_BOOL_SWITCH("-monolog ", MonoLog);
     PARSE_BOOL_SWITCH("-mute ", Mute);
     PARSE_BOOL_SWITCH("-lowdpi ", LowDPI);
+    PARSE_BOOL_SWITCH("-recordpso ", RecordPSO);
+    PARSE_BOOL_SWITCH("-profilememory ", ProfileMemory);
+    PARSE_ARG_SWITCH("-profilecapturespike ", ProfileCaptureSpike);
+    PARSE_ARG_SWITCH("-profilecaptureseconds ", ProfileCaptureSeconds);
+    PARSE_ARG_SWITCH("-profilecapture ", ProfileCapture);
+    PARSE_ARG_SWITCH("-profilespikeframes ", ProfileSpikeFrames);
+    PARSE_ARG_SWITCH("-profilespikes ", ProfileSpikes);
+    PARSE_BOOL_SWITCH("-profilelocks ", ProfileLocks);
+    PARSE_BOOL_SWITCH("-profilegpustats ", ProfileGPUStats);
+    PARSE_ARG_SWITCH("-perftestpath ", PerfTestPath);
+    PARSE_ARG_SWITCH("-perftestreport ", PerfTestReport);
+    PARSE_ARG_SWITCH("-perftestbudget ", PerfTestBudget);
+    PARSE_ARG_SWITCH("-perftest ", PerfTest);
 
 #if USE_EDITOR
 
@@ -156,6 +171,7 @@ bool CommandLine::Parse(const Char* cmdLine)
     PARSE_ARG_SWITCH("-build ", Build);
     PARSE_BOOL_SWITCH("-skipcompile ", SkipCompile);
     PARSE_BOOL_SWITCH("-shaderdebug ", ShaderDebug);
+    PARSE_ARG_SWITCH("-sharedshadercache ", SharedShaderCache);
     PARSE_ARG_OPT_SWITCH("-play ", Play);
 
 #endif
@@ -49,6 +49,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Std;
 
+        /// <summary>
+        /// -logasync (write log messages on a background thread with batched file writes)
+        /// </summary>
+        Nullable<bool> LogAsync;
+
 #if !BUILD_RELEASE
 
         /// <summary>
@@ -70,6 +75,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> Headless;
 
+        /// <summary>
+        /// -server (runs as a dedicated server: headless with Null rendering and audio backends, client-only services are skipped and frames are not drawn)
+        /// </summary>
+        Nullable<bool> Server;
+
 #endif
 
         /// <summary>
@@ -127,6 +137,71 @@ class CommandLine
         /// </summary>
         Nullable<bool> LowDPI;
 
+        /// <summary>
+        /// -recordpso (records the used pipeline states into the manifest used to precompile them in the background on the next game startup)
+        /// </summary>
+        Nullable<bool> RecordPSO;
+
+        /// <summary>
+        /// -profilememory (enables memory allocations tracking per engine subsystem, see ProfilerMemory)
+        /// </summary>
+        Nullable<bool> ProfileMemory;
+
+        /// <summary>
+        /// -profilecapture !path! (streams the profiler events to the capture file, see ProfilerCapture)
+        /// </summary>
+        Nullable<String> ProfileCapture;
+
+        /// <summary>
+        /// -profilecapturespike !ms! (captures the profiler events only around the first frame that took longer than the specified time, used with -profilecapture)
+        /// </summary>
+        Nullable<String> ProfileCaptureSpike;
+
+        /// <summary>
+        /// -profilecaptureseconds !seconds! (the time window captured before and after the frame spike, used with -profilecapturespike)
+        /// </summary>
+        Nullable<String> ProfileCaptureSeconds;
+
+        /// <summary>
+        /// -profilespikes !ms! (runs the profiler spike detector that saves the last frames events to the Logs folder after every frame that took longer than the specified time, see ProfilerCapture)
+        /// </summary>
+        Nullable<String> ProfileSpikes;
+
+        /// <summary>
+        /// -profilespikeframes !count! (the amount of the last frames saved by the profiler spike detector, used with -profilespikes)
+        /// </summary>
+        Nullable<String> ProfileSpikeFrames;
+
+        /// <summary>
+        /// -profilelocks (enables the locks contention profiling and prints the stats to the log on exit, see ProfilerLocks)
+        /// </summary>
+        Nullable<bool> ProfileLocks;
+
+        /// <summary>
+        /// -profilegpustats (enables the pipeline statistics queries for GPU profiler events, see ProfilerGPU::PipelineStatistics)
+        /// </summary>
+        Nullable<bool> ProfileGPUStats;
+
+        /// <summary>
+        /// -perftest !scene! (runs the scene performance test and exits, scene can be specified by the asset ID or path, see PerformanceTest)
+        /// </summary>
+        Nullable<String> PerfTest;
+
+        /// <summary>
+        /// -perftestpath !path! (the camera path file flown during the scene performance test, used with -perftest)
+        /// </summary>
+        Nullable<String> PerfTestPath;
+
+        /// <summary>
+        /// -perftestreport !path! (the output report file of the scene performance test, used with -perftest)
+        /// </summary>
+        Nullable<String> PerfTestReport;
+
+        /// <summary>
+        /// -perftestbudget !ms! (fails the scene performance test with exit code 1 if 95th percentile of the frame time exceeds the budget, used with -perftest)
+        /// </summary>
+        Nullable<String> PerfTestBudget;
+
 #if USE_EDITOR
 
         /// <summary>
@@ -169,6 +244,11 @@ class CommandLine
         /// </summary>
         Nullable<bool> ShaderDebug;
 
+        /// <summary>
+        /// -sharedshadercache !path! (path to the shared shaders cache folder, eg. on the network drive, used to reuse the shaders compiled on the other machines)
+        /// </summary>
+        Nullable<String> SharedShaderCache;
+
         /// <summary>
         /// -play !guid! ( Scene to play, can be empty to use default )
         /// </summary>
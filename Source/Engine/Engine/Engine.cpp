@@ -11,6 +11,7 @@
 #include "Engine/Core/Core.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/ObjectsRemovalService.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Platform/Window.h"
@@ -20,6 +21,7 @@
 #include "Engine/Threading/MainThreadTask.h"
 #include "Engine/Threading/ThreadRegistry.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPUSwapChain.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/JsonAsset.h"
@@ -27,6 +29,7 @@
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Threading/TaskGraph.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -52,10 +55,14 @@ namespace EngineImpl
     String CommandLine = nullptr;
     int32 Fps = 0, FpsAccumulatedFrames = 0;
     double FpsAccumulated = 0.0;
+    bool AsyncPhysicsPending = false;
 
     void InitLog();
     void InitPaths();
     void InitMainWindow();
+    void WaitForNextTick();
+    void WaitForTime(double time);
+    void WaitForFrameLatency();
 }
 
 DateTime Engine::StartupTime;
@@ -86,6 +93,9 @@ int32 Engine::Main(const Char* cmdLine)
         Platform::Fatal(TEXT("Invalid command line."));
         return -1;
     }
+#if COMPILE_WITH_PROFILER
+    ProfilerMemory::Enabled = CommandLine::Options.ProfileMemory.IsTrue();
+#endif
 
 #if FLAX_TESTS
     // Configure engine for test running environment
@@ -94,6 +104,15 @@ int32 Engine::Main(const Char* cmdLine)
     CommandLine::Options.Mute = true;
     CommandLine::Options.Std = true;
 #endif
+#if PLATFORM_HAS_HEADLESS_MODE
+    if (CommandLine::Options.Server.IsTrue())
+    {
+        // Configure engine for dedicated server
+        CommandLine::Options.Headless = true;
+        CommandLine::Options.Null = true;
+        CommandLine::Options.Mute = true;
+    }
+#endif
 
     if (Platform::Init())
     {
@@ -163,10 +182,20 @@ int32 Engine::Main(const Char* cmdLine)
 
     // Main engine loop
     const bool useSleep = true; // TODO: this should probably be a platform setting
+    const bool isDedicatedServer = IsDedicatedServer();
     while (!ShouldExit())
     {
         // Reduce CPU usage by introducing idle time if the engine is running very fast and has enough time to spend
-        if ((useSleep && Time::UpdateFPS > ZeroTolerance) || !Platform::GetHasFocus())
+        if (isDedicatedServer)
+        {
+            EngineImpl::WaitForNextTick();
+        }
+        else if (Time::LowLatencyMode && Time::UpdateFPS > ZeroTolerance && Platform::GetHasFocus())
+        {
+            // Precisely wait for the next tick to reduce frame-time jitter
+            EngineImpl::WaitForTime(Time::GetNextTick());
+        }
+        else if ((useSleep && Time::UpdateFPS > ZeroTolerance) || !Platform::GetHasFocus())
         {
             double nextTick = Time::GetNextTick();
             double timeToTick = nextTick - Platform::GetTimeSeconds();
@@ -179,6 +208,9 @@ int32 Engine::Main(const Char* cmdLine)
             }
         }
 
+        // Collect results of the asynchronous physics simulation started after the previous frame (does nothing if not running), before any events that can be handled by scripts
+        Physics::CollectResults();
+
         // App paused logic
         if (Platform::GetIsPaused())
         {
@@ -193,6 +225,12 @@ int32 Engine::Main(const Char* cmdLine)
             OnUnpause();
         }
 
+        // Wait for the swap chain to be ready for a new frame so the input gets sampled as late as possible
+        if (Time::LowLatencyMode && !isDedicatedServer)
+        {
+            EngineImpl::WaitForFrameLatency();
+        }
+
         // Use the same time for all ticks to improve synchronization
         const double time = Platform::GetTimeSeconds();
 
@@ -208,6 +246,13 @@ int32 Engine::Main(const Char* cmdLine)
             OnUpdate();
             OnLateUpdate();
             Time::OnEndUpdate();
+#if !LOG_ENABLE_AUTO_FLUSH
+            // Flush log file every fourth update (dedicated server doesn't draw frames)
+            if (isDedicatedServer && UpdateCount % 4 == 0)
+            {
+                LOG_FLUSH();
+            }
+#endif
         }
 
         // Start physics simulation
@@ -219,12 +264,23 @@ int32 Engine::Main(const Char* cmdLine)
         }
 
         // Draw frame
-        if (Time::OnBeginDraw(time))
+        if (!isDedicatedServer && Time::OnBeginDraw(time))
         {
             OnDraw();
             Time::OnEndDraw();
             FrameMark;
         }
+
+        // Start asynchronous physics simulation after drawing (rendering reads physics state, eg. cloth particles or debug shapes), results are collected on the next update
+        if (EngineImpl::AsyncPhysicsPending)
+        {
+            EngineImpl::AsyncPhysicsPending = false;
+            const float dt = Time::Physics.DeltaTime.GetTotalSeconds();
+            Physics::Simulate(dt);
+        }
+
+        // Release frame-scoped memory
+        FrameAllocation::NextFrame();
     }
 
     // Call on exit event
@@ -281,7 +337,7 @@ void Engine::OnFixedUpdate()
     // Update services
     EngineService::OnFixedUpdate();
 
-    if (!Time::GetGamePaused())
+    if (!Time::GetGamePaused() && !Physics::AsyncSimulation)
     {
         const float dt = Time::Physics.DeltaTime.GetTotalSeconds();
         Physics::Simulate(dt);
@@ -303,6 +359,9 @@ void Engine::OnLateFixedUpdate()
 
     // Update services
     EngineService::OnLateFixedUpdate();
+
+    // Queue physics simulation to run in the background until the next update (scripts, services and rendering don't run during the simulation so physic objects state can be accessed as usual)
+    EngineImpl::AsyncPhysicsPending = !Time::GetGamePaused() && Physics::AsyncSimulation;
 }
 
 void Engine::OnUpdate()
@@ -400,6 +459,15 @@ bool Engine::IsHeadless()
 #endif
 }
 
+bool Engine::IsDedicatedServer()
+{
+#if PLATFORM_HAS_HEADLESS_MODE
+    return CommandLine::Options.Server.IsTrue();
+#else
+    return false;
+#endif
+}
+
 bool Engine::IsReady()
 {
     return EngineImpl::IsReady;
@@ -505,9 +573,11 @@ void Engine::OnExit()
 
     // Cleanup
     ObjectsRemovalService::ForceFlush();
+    FrameAllocation::Dispose();
 #if COMPILE_WITH_PROFILER
     ProfilerCPU::Dispose();
     ProfilerGPU::Dispose();
+    ProfilerMemory::Dispose();
 #endif
 
     // Close logging service
@@ -643,6 +713,43 @@ void EngineImpl::InitPaths()
     Platform::SetWorkingDirectory(Globals::ProjectFolder);
 }
 
+void EngineImpl::WaitForNextTick()
+{
+    // Dedicated server ticks only game logic and physics
+    double nextTick = MAX_double;
+    if (Time::UpdateFPS > ZeroTolerance)
+        nextTick = Time::Update.NextBegin;
+    if (Time::PhysicsFPS > ZeroTolerance && Time::Physics.NextBegin < nextTick)
+        nextTick = Time::Physics.NextBegin;
+    if (nextTick == MAX_double)
+        return;
+    WaitForTime(nextTick);
+}
+
+void EngineImpl::WaitForTime(double time)
+{
+    if (time <= 0.0)
+        return;
+    PROFILE_CPU_NAMED("Idle");
+
+    // Sleep less than needed (some platforms may sleep slightly more than requested) and yield for the remaining time
+    const double timeToTick = time - Platform::GetTimeSeconds();
+    if (timeToTick > 0.002)
+        Platform::Sleep((int32)((timeToTick - 0.001) * 1000.0));
+    while (Platform::GetTimeSeconds() < time && !Engine::ShouldExit())
+        Platform::Sleep(0);
+}
+
+void EngineImpl::WaitForFrameLatency()
+{
+    GPUSwapChain* swapChain = Engine::MainWindow ? Engine::MainWindow->GetSwapChain() : nullptr;
+    if (swapChain)
+    {
+        PROFILE_CPU_NAMED("WaitForFrameLatency");
+        swapChain->WaitForFrameLatency();
+    }
+}
+
 void EngineImpl::InitMainWindow()
 {
 #if PLATFORM_HAS_HEADLESS_MODE
@@ -142,6 +142,9 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Engine);
     // Returns true if engine is running without main window (aka headless mode).
     API_PROPERTY() static bool IsHeadless();
 
+    // Returns true if engine is running as a dedicated server (headless mode without rendering, audio and other client-only services, game and physics are updated with sleep-based pacing).
+    API_PROPERTY() static bool IsDedicatedServer();
+
     // True if Engine is ready to work (init and not disposing)
     static bool IsReady();
 
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "EngineService.h"
+#include "Engine.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Core/Collections/Sorting.h"
@@ -18,7 +19,10 @@ static bool CompareEngineServices(EngineService* const& a, EngineService* const&
         ZoneScoped; \
         auto& services = GetServices(); \
         for (int32 i = 0; i < services.Count(); i++) \
-            services[i]->name(); \
+        { \
+            if (services[i]->IsInitialized || !services[i]->ClientOnly) \
+                services[i]->name(); \
+        } \
     }
 #define DEFINE_ENGINE_SERVICE_EVENT_INVERTED(name) \
     void EngineService::name() { } \
@@ -27,7 +31,10 @@ static bool CompareEngineServices(EngineService* const& a, EngineService* const&
         ZoneScoped; \
         auto& services = GetServices(); \
         for (int32 i = 0; i < services.Count(); i++) \
-            services[i]->name(); \
+        { \
+            if (services[i]->IsInitialized || !services[i]->ClientOnly) \
+                services[i]->name(); \
+        } \
     }
 
 DEFINE_ENGINE_SERVICE_EVENT(FixedUpdate);
@@ -49,10 +56,11 @@ void EngineService::Sort()
     Sorting::QuickSort(services.Get(), services.Count(), &CompareEngineServices);
 }
 
-EngineService::EngineService(const Char* name, int32 order)
+EngineService::EngineService(const Char* name, int32 order, bool clientOnly)
 {
     Name = name;
     Order = order;
+    ClientOnly = clientOnly;
 
     auto& services = GetServices();
     services.Add(this);
@@ -72,10 +80,16 @@ void EngineService::OnInit()
 
     // Init services from front to back
     auto& services = GetServices();
+    const bool isDedicatedServer = Engine::IsDedicatedServer();
     for (int32 i = 0; i < services.Count(); i++)
     {
         const auto service = services[i];
         const StringView name(service->Name);
+        if (isDedicatedServer && service->ClientOnly)
+        {
+            LOG(Info, "Skip {0} (dedicated server)", name);
+            continue;
+        }
 #if TRACY_ENABLE
         ZoneScoped;
         int32 nameBufferLength = 0;
@@ -30,7 +30,7 @@ class EngineService
 
 protected:
 
-    EngineService(const Char* name, int32 order = 0);
+    EngineService(const Char* name, int32 order = 0, bool clientOnly = false);
 
 public:
 
@@ -39,6 +39,9 @@ class EngineService
     const Char* Name;
     int32 Order;
 
+    // True if service is used only by the game client (eg. rendering) and it's skipped when running as a dedicated server (see Engine::IsDedicatedServer).
+    bool ClientOnly;
+
 #define DECLARE_ENGINE_SERVICE_EVENT(result, name) virtual result name(); static void On##name();
     DECLARE_ENGINE_SERVICE_EVENT(bool, Init);
     DECLARE_ENGINE_SERVICE_EVENT(void, FixedUpdate);
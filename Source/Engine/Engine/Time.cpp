@@ -21,6 +21,7 @@ float Time::UpdateFPS = 60.0f;
 float Time::PhysicsFPS = 60.0f;
 float Time::DrawFPS = 60.0f;
 float Time::TimeScale = 1.0f;
+bool Time::LowLatencyMode = false;
 Time::TickData Time::Update;
 Time::FixedStepTickData Time::Physics;
 Time::TickData Time::Draw;
@@ -51,6 +52,7 @@ void TimeSettings::Apply()
     Time::PhysicsFPS = PhysicsFPS;
     Time::DrawFPS = DrawFPS;
     Time::TimeScale = TimeScale;
+    Time::LowLatencyMode = LowLatencyMode;
     ::MaxUpdateDeltaTime = MaxUpdateDeltaTime;
 }
 
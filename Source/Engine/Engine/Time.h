@@ -132,6 +132,11 @@ API_CLASS(Static) class FLAXENGINE_API Time
     /// </summary>
     API_FIELD() static float TimeScale;
 
+    /// <summary>
+    /// Enables low-latency frame pacing: engine loop precisely waits for the next tick (instead of the coarse sleeps), waits for the swap chain to be ready for a new frame and then samples the input right before updating and rendering it. Reduces input-to-display latency and frame-time jitter at the cost of higher CPU usage while idle.
+    /// </summary>
+    API_FIELD() static bool LowLatencyMode;
+
 public:
     /// <summary>
     /// The game logic updating data.
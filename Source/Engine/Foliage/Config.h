@@ -5,6 +5,7 @@
 class Foliage;
 class FoliageCluster;
 class FoliageType;
+class FoliageDrawCache;
 struct FoliageInstance;
 
 // Enable/disable foliage editing and changing at runtime. If your game need to use procedural foliage then enable this option.
@@ -11,8 +11,12 @@
 #include "Engine/Threading/JobSystem.h"
 #if FOLIAGE_USE_DRAW_CALLS_BATCHING
 #include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/HZBOcclusion.h"
+#include "Engine/Renderer/FoliageCullingPass.h"
+#include "FoliageDrawCache.h"
 #endif
 #endif
 #include "Engine/Level/SceneQuery.h"
@@ -141,6 +145,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     if (Float3::Distance(lodView->Position, cluster->TotalBoundsSphere.Center - lodView->Origin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
         return;
     const Vector3 viewOrigin = renderContext.View.Origin;
+    const HZBOcclusion* occlusion = renderContext.View.Occlusion;
 
     //DebugDraw::DrawBox(cluster->Bounds, Color::Red);
 
@@ -155,7 +160,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
+		if (renderContext.View.CullingFrustum.Intersects(box) && !(occlusion && occlusion->IsOccluded(cluster->Children[idx]->TotalBounds))) \
 			DrawCluster(renderContext, cluster->Children[idx], type, drawCallsLists, result)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
@@ -262,6 +267,303 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     }
 }
 
+void Foliage::DrawBatch(RenderContext& renderContext, const FoliageType& type, const Mesh& mesh, BatchedDrawCall& batch, DrawPass typeDrawModes, GPUBuffer* indirectArgsBuffer, uint32 indirectArgsOffset) const
+{
+    const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
+    const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+    const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+    const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & batch.DrawCall.Material->GetDrawModes();
+    const InstanceData* instances = batch.GetInstancesData();
+    const int32 instancesCount = batch.GetInstancesCount();
+
+    // Setup draw call
+    mesh.GetDrawCallGeometry(batch.DrawCall);
+    batch.DrawCall.InstanceCount = 1;
+    if (indirectArgsBuffer)
+    {
+        // Instances count and offset are written by GPU culling
+        batch.DrawCall.InstanceCount = 0;
+        batch.DrawCall.Draw.IndirectArgsBuffer = indirectArgsBuffer;
+        batch.DrawCall.Draw.IndirectArgsOffset = indirectArgsOffset;
+    }
+    auto& firstInstance = instances[0];
+    batch.DrawCall.ObjectPosition = firstInstance.InstanceOrigin;
+    batch.DrawCall.PerInstanceRandom = firstInstance.PerInstanceRandom;
+    auto lightmapArea = firstInstance.InstanceLightmapArea.ToFloat4();
+    batch.DrawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+    batch.DrawCall.Surface.LODDitherFactor = firstInstance.LODDitherFactor;
+    batch.DrawCall.World.SetRow1(Float4(firstInstance.InstanceTransform1, 0.0f));
+    batch.DrawCall.World.SetRow2(Float4(firstInstance.InstanceTransform2, 0.0f));
+    batch.DrawCall.World.SetRow3(Float4(firstInstance.InstanceTransform3, 0.0f));
+    batch.DrawCall.World.SetRow4(Float4(firstInstance.InstanceOrigin, 1.0f));
+    batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
+    batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+    batch.DrawCall.Surface.Skinning = nullptr;
+    batch.DrawCall.WorldDeterminantSign = 1;
+#if USE_EDITOR
+    if (renderContext.View.Mode == ViewMode::LightmapUVsDensity)
+        batch.DrawCall.Surface.LODDitherFactor = type.ScaleInLightmap; // See LightmapUVsDensityMaterialShader
+#endif
+
+    if (EnumHasAnyFlags(drawModes, DrawPass::Forward))
+    {
+        // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
+        DrawCall drawCall = batch.DrawCall;
+        for (int32 j = 0; j < instancesCount; j++)
+        {
+            auto& instance = instances[j];
+            drawCall.ObjectPosition = instance.InstanceOrigin;
+            drawCall.PerInstanceRandom = instance.PerInstanceRandom;
+            lightmapArea = instance.InstanceLightmapArea.ToFloat4();
+            drawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+            drawCall.Surface.LODDitherFactor = instance.LODDitherFactor;
+            drawCall.World.SetRow1(Float4(instance.InstanceTransform1, 0.0f));
+            drawCall.World.SetRow2(Float4(instance.InstanceTransform2, 0.0f));
+            drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
+            drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
+            const int32 drawCallIndex = renderContext.List->DrawCalls.Add(drawCall);
+            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
+        }
+    }
+
+    // Add draw call batch
+    const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+
+    // Add draw call to proper draw lists
+    if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
+    {
+        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+    }
+    if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+    {
+        if (entry.ReceiveDecals)
+            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+        else
+            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
+    }
+    if (EnumHasAnyFlags(drawModes, DrawPass::Distortion))
+    {
+        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Distortion].PreBatchedDrawCalls.Add(batchIndex);
+    }
+    if (EnumHasAnyFlags(drawModes, DrawPass::MotionVectors) && (_staticFlags & StaticFlags::Transform) == StaticFlags::None)
+    {
+        renderContext.List->DrawCallsLists[(int32)DrawCallsListType::MotionVectors].PreBatchedDrawCalls.Add(batchIndex);
+    }
+}
+
+bool Foliage::CanUseDrawCache(const FoliageType& type) const
+{
+    // Cached instances don't store lightmaps (per-instance lightmap textures would split the continuous ranges)
+    if (!type.UseDrawCache || !type.Root)
+        return false;
+    return !(EnumHasAnyFlags(_staticFlags, StaticFlags::Lightmap) && _scene && _scene->LightmapsData.GetLightmaps()->HasItems());
+}
+
+bool Foliage::CanUseGPUCulling(const RenderContextBatch* renderContextBatch, const FoliageType& type, DrawCallsList* drawCallsLists) const
+{
+    if (!renderContextBatch || !FoliageCullingPass::Instance()->CanUse(*renderContextBatch))
+        return false;
+
+    // Indirect draws are supported only via instancing and without sorting (no transparency)
+    for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
+    {
+        for (const auto& drawCall : drawCallsLists[lod])
+        {
+            MaterialBase* material = drawCall.DrawCall.Material;
+            if (!material)
+                continue;
+            IMaterial::InstancingHandler handler;
+            if (!material->CanUseInstancing(handler) || EnumHasAnyFlags(material->GetDrawModes(), DrawPass::Forward))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool Foliage::UpdateDrawCache(FoliageType& type, const RenderView& view, bool withCullingData)
+{
+    if (!type._drawCache)
+        type._drawCache = New<FoliageDrawCache>();
+    auto& cache = *type._drawCache;
+    const uint64 frame = Engine::FrameCount;
+    if (!cache.IsDirty && cache.Origin == view.Origin && (cache.HasCullingData || !withCullingData))
+    {
+        cache.LastFrameUsed = frame;
+        return false;
+    }
+    if (cache.LastFrameUsed == frame)
+    {
+        // Cache is already used by the other view in this frame (eg. with a different origin) so fallback to default drawing
+        return true;
+    }
+    PROFILE_CPU_NAMED("Update Draw Cache");
+
+    // Write instances in order of the leaf clusters
+    cache.Instances.Clear();
+    cache.Clusters.Clear();
+    cache.CullingInstances.Clear();
+    cache.Origin = view.Origin;
+    WriteDrawCache(cache, type.Root, view.Origin, withCullingData);
+    if (cache.Upload(withCullingData))
+    {
+        LOG(Error, "Failed to create foliage instances buffer.");
+        cache.IsDirty = true;
+        return true;
+    }
+    cache.IsDirty = false;
+    cache.LastFrameUsed = frame;
+    return false;
+}
+
+void Foliage::WriteDrawCache(FoliageDrawCache& cache, FoliageCluster* cluster, const Vector3& origin, bool withCullingData) const
+{
+    if (cluster->Children[0])
+    {
+        // Use the same order as in DrawClusterCached
+        WriteDrawCache(cache, cluster->Children[0], origin, withCullingData);
+        WriteDrawCache(cache, cluster->Children[1], origin, withCullingData);
+        WriteDrawCache(cache, cluster->Children[2], origin, withCullingData);
+        WriteDrawCache(cache, cluster->Children[3], origin, withCullingData);
+        return;
+    }
+    cluster->DrawCacheStart = cache.Instances.Count();
+    cluster->DrawCacheCount = cluster->Instances.Count();
+    cluster->DrawCacheRadius = 0.0f;
+    for (int32 i = 0; i < cluster->Instances.Count(); i++)
+    {
+        const FoliageInstance& instance = *cluster->Instances.Get()[i];
+        cluster->DrawCacheRadius = Math::Max(cluster->DrawCacheRadius, (float)instance.Bounds.Radius);
+        auto& instanceData = cache.Instances.AddOne();
+        Matrix world;
+        const Transform transform = _transform.LocalToWorld(instance.Transform);
+        const Float3 translation = transform.Translation - origin;
+        Matrix::Transformation(transform.Scale, transform.Orientation, translation, world);
+        instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
+        instanceData.PerInstanceRandom = instance.Random;
+        instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
+        instanceData.LODDitherFactor = 0.0f;
+        instanceData.InstanceTransform2 = Float3(world.M21, world.M22, world.M23);
+        instanceData.InstanceTransform3 = Float3(world.M31, world.M32, world.M33);
+        instanceData.InstanceLightmapArea = Half4(instance.Lightmap.UVsArea);
+        if (withCullingData)
+        {
+            auto& cullingData = cache.CullingInstances.AddOne();
+            cullingData.Center = Float3(instance.Bounds.Center - origin);
+            cullingData.Radius = (float)instance.Bounds.Radius;
+            cullingData.CullDistance = instance.CullDistance;
+            Platform::MemoryClear(cullingData.Dummy0, sizeof(cullingData.Dummy0));
+        }
+    }
+    if (withCullingData && cluster->DrawCacheCount != 0)
+    {
+        auto& clusterData = cache.Clusters.AddOne();
+        clusterData.BoundsMin = Float3(cluster->TotalBounds.Minimum - origin);
+        clusterData.InstancesStart = cluster->DrawCacheStart;
+        clusterData.BoundsMax = Float3(cluster->TotalBounds.Maximum - origin);
+        clusterData.InstancesCount = cluster->DrawCacheCount;
+        clusterData.SphereCenter = Float3(cluster->TotalBoundsSphere.Center - origin);
+        clusterData.SphereRadius = (float)cluster->TotalBoundsSphere.Radius;
+        clusterData.MaxCullDistance = cluster->MaxCullDistance;
+        Platform::MemoryClear(clusterData.Dummy0, sizeof(clusterData.Dummy0));
+    }
+}
+
+void Foliage::DrawClusterCached(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCacheRanges* ranges) const
+{
+    // Skip clusters that around too far from view
+    const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+    if (Float3::Distance(lodView->Position, cluster->TotalBoundsSphere.Center - lodView->Origin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
+        return;
+    const Vector3 viewOrigin = renderContext.View.Origin;
+
+    if (cluster->Children[0])
+    {
+        // Draw visible children
+        const HZBOcclusion* occlusion = renderContext.View.Occlusion;
+        BoundingBox box;
+#define DRAW_CLUSTER(idx) \
+        box = cluster->Children[idx]->TotalBounds; \
+        box.Minimum -= viewOrigin; \
+        box.Maximum -= viewOrigin; \
+		if (renderContext.View.CullingFrustum.Intersects(box) && !(occlusion && occlusion->IsOccluded(cluster->Children[idx]->TotalBounds))) \
+			DrawClusterCached(renderContext, cluster->Children[idx], type, ranges)
+        DRAW_CLUSTER(0);
+        DRAW_CLUSTER(1);
+        DRAW_CLUSTER(2);
+        DRAW_CLUSTER(3);
+#undef 	DRAW_CLUSTER
+    }
+    else if (cluster->DrawCacheCount != 0)
+    {
+        // Select a proper LOD index for the whole cluster (based on the closest instance)
+        BoundingBox box = cluster->TotalBounds;
+        box.Minimum -= viewOrigin;
+        box.Maximum -= viewOrigin;
+        const Float3 closestPoint = CollisionsHelper::ClosestPointBoxPoint(box, lodView->Position);
+        const auto model = type.Model.Get();
+        int32 lodIndex = RenderTools::ComputeModelLOD(model, closestPoint, cluster->DrawCacheRadius, renderContext);
+        if (lodIndex == -1)
+            return;
+        lodIndex += renderContext.View.ModelLODBias;
+        lodIndex = model->ClampLODIndex(lodIndex);
+
+        // Merge with the previous range if continuous
+        auto& lodRanges = ranges[lodIndex];
+        if (lodRanges.HasItems() && lodRanges.Last().X + lodRanges.Last().Y == cluster->DrawCacheStart)
+            lodRanges.Last().Y += cluster->DrawCacheCount;
+        else
+            lodRanges.Add(Int2(cluster->DrawCacheStart, cluster->DrawCacheCount));
+    }
+}
+
+bool Foliage::DrawCachedGPU(const RenderContextBatch& renderContextBatch, RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists, DrawPass typeDrawModes) const
+{
+    // Collect meshes to draw (single indirect draw call per mesh of each LOD)
+    const FoliageDrawCache& cache = *type._drawCache;
+    Array<FoliageCullingBatch, InlinedAllocation<32>> cullingBatches;
+    Array<const Mesh*, InlinedAllocation<32>> meshes;
+    for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
+    {
+        const auto& lodMeshes = type.Model->LODs[lod].Meshes;
+        for (int32 meshIndex = 0; meshIndex < lodMeshes.Count(); meshIndex++)
+        {
+            if (!drawCallsLists[lod][meshIndex].DrawCall.Material)
+                continue;
+            const Mesh& mesh = lodMeshes.Get()[meshIndex];
+            auto& cullingBatch = cullingBatches.AddOne();
+            cullingBatch.IndicesCount = mesh.GetTriangleCount() * 3;
+            cullingBatch.StartIndex = 0;
+            cullingBatch.LOD = lod;
+            cullingBatch.Dummy0 = 0;
+            meshes.Add(&mesh);
+        }
+    }
+    if (meshes.IsEmpty())
+        return true;
+
+    // Cull instances on GPU (after draw calls collection)
+    auto cullingPass = FoliageCullingPass::Instance();
+    const int32 argsStart = cullingPass->AddCull(renderContextBatch, renderContext, cache, type.Model.Get(), cullingBatches.Get(), cullingBatches.Count());
+    if (argsStart == -1)
+        return false;
+
+    // Submit indirect draw calls that use the visible instances buffer
+    for (int32 i = 0; i < meshes.Count(); i++)
+    {
+        const Mesh& mesh = *meshes[i];
+        const int32 lod = cullingBatches[i].LOD;
+        BatchedDrawCall batch;
+        batch.DrawCall.Material = drawCallsLists[lod][mesh.GetIndex()].DrawCall.Material;
+        batch.DrawCall.Surface.Lightmap = nullptr;
+        batch.InstanceBuffer = cullingPass->GetInstancesBuffer();
+        batch.InstanceBufferData = cache.Instances.Get();
+        batch.InstanceBufferOffset = 0;
+        batch.InstanceBufferCount = cache.Instances.Count();
+        DrawBatch(renderContext, type, mesh, batch, typeDrawModes, cullingPass->GetArgsBuffer(), (argsStart + i) * sizeof(GPUDrawIndexedIndirectArgs));
+    }
+    return true;
+}
+
 #else
 
 void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw)
@@ -271,6 +573,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
     if (Float3::Distance(lodView->Position, cluster->TotalBoundsSphere.Center - lodView->Origin) - (float)cluster->TotalBoundsSphere.Radius > cluster->MaxCullDistance)
         return;
     const Vector3 viewOrigin = renderContext.View.Origin;
+    const HZBOcclusion* occlusion = renderContext.View.Occlusion;
 
     //DebugDraw::DrawBox(cluster->Bounds, Color::Red);
 
@@ -285,7 +588,7 @@ void Foliage::DrawCluster(RenderContext& renderContext, FoliageCluster* cluster,
         box = cluster->Children[idx]->TotalBounds; \
         box.Minimum -= viewOrigin; \
         box.Maximum -= viewOrigin; \
-		if (renderContext.View.CullingFrustum.Intersects(box)) \
+		if (renderContext.View.CullingFrustum.Intersects(box) && !(occlusion && occlusion->IsOccluded(cluster->Children[idx]->TotalBounds))) \
 			DrawCluster(renderContext, cluster->Children[idx], draw)
         DRAW_CLUSTER(0);
         DRAW_CLUSTER(1);
@@ -403,18 +706,18 @@ void Foliage::DrawClusterGlobalSA(GlobalSurfaceAtlasPass* globalSA, const Vector
 void Foliage::DrawFoliageJob(int32 i)
 {
     PROFILE_CPU();
-    const FoliageType& type = FoliageTypes[i];
+    FoliageType& type = FoliageTypes[i];
     if (type.IsReady() && type.Model->CanBeRendered())
     {
         DrawCallsList drawCallsLists[MODEL_MAX_LODS];
         for (RenderContext& renderContext : _renderContextBatch->Contexts)
-            DrawType(renderContext, type, drawCallsLists);
+            DrawType(renderContext, type, drawCallsLists, _renderContextBatch);
     }
 }
 
 #endif
 
-void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists)
+void Foliage::DrawType(RenderContext& renderContext, FoliageType& type, DrawCallsList* drawCallsLists, const RenderContextBatch* renderContextBatch)
 {
     if (!type.Root || !FOLIAGE_CAN_DRAW(renderContext, type))
         return;
@@ -461,6 +764,47 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         }
     }
 
+    const bool useDrawCache = CanUseDrawCache(type);
+    const bool useGPUCulling = useDrawCache && CanUseGPUCulling(renderContextBatch, type, drawCallsLists);
+    if (useDrawCache && !UpdateDrawCache(type, renderContext.View, useGPUCulling))
+    {
+        // Cull instances and select their LODs on GPU
+        if (useGPUCulling && DrawCachedGPU(*renderContextBatch, renderContext, type, drawCallsLists, typeDrawModes))
+            return;
+
+        // Draw visible clusters of the foliage type using cached instances (continuous ranges of the instances buffer per LOD)
+        DrawCacheRanges ranges[MODEL_MAX_LODS];
+        DrawClusterCached(renderContext, type.Root, type, ranges);
+
+        // Submit draw calls for each range of instances
+        const FoliageDrawCache& cache = *type._drawCache;
+        for (int32 lod = 0; lod < type.Model->LODs.Count(); lod++)
+        {
+            const auto& lodRanges = ranges[lod];
+            if (lodRanges.IsEmpty())
+                continue;
+            const auto& meshes = type.Model->LODs[lod].Meshes;
+            for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+            {
+                const auto& drawCall = drawCallsLists[lod][meshIndex];
+                if (!drawCall.DrawCall.Material)
+                    continue;
+                for (const Int2& range : lodRanges)
+                {
+                    BatchedDrawCall batch;
+                    batch.DrawCall.Material = drawCall.DrawCall.Material;
+                    batch.DrawCall.Surface.Lightmap = nullptr;
+                    batch.InstanceBuffer = cache.InstanceBuffer;
+                    batch.InstanceBufferData = cache.Instances.Get() + range.X;
+                    batch.InstanceBufferOffset = range.X;
+                    batch.InstanceBufferCount = range.Y;
+                    DrawBatch(renderContext, type, meshes.Get()[meshIndex], batch, typeDrawModes);
+                }
+            }
+        }
+        return;
+    }
+
     // Draw instances of the foliage type
     BatchedDrawCalls result;
     DrawCluster(renderContext, type.Root, type, drawCallsLists, result);
@@ -471,78 +815,7 @@ void Foliage::DrawType(RenderContext& renderContext, const FoliageType& type, Dr
         auto& batch = e.Value;
         if (batch.Instances.IsEmpty())
             continue;
-        const auto& mesh = *e.Key.Geo;
-        const auto& entry = type.Entries[mesh.GetMaterialSlotIndex()];
-        const MaterialSlot& slot = type.Model->MaterialSlots[mesh.GetMaterialSlotIndex()];
-        const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
-        const auto drawModes = typeDrawModes & renderContext.View.GetShadowsDrawPassMask(shadowsMode) & batch.DrawCall.Material->GetDrawModes();
-
-        // Setup draw call
-        mesh.GetDrawCallGeometry(batch.DrawCall);
-        batch.DrawCall.InstanceCount = 1;
-        auto& firstInstance = batch.Instances[0];
-        batch.DrawCall.ObjectPosition = firstInstance.InstanceOrigin;
-        batch.DrawCall.PerInstanceRandom = firstInstance.PerInstanceRandom;
-        auto lightmapArea = firstInstance.InstanceLightmapArea.ToFloat4();
-        batch.DrawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
-        batch.DrawCall.Surface.LODDitherFactor = firstInstance.LODDitherFactor;
-        batch.DrawCall.World.SetRow1(Float4(firstInstance.InstanceTransform1, 0.0f));
-        batch.DrawCall.World.SetRow2(Float4(firstInstance.InstanceTransform2, 0.0f));
-        batch.DrawCall.World.SetRow3(Float4(firstInstance.InstanceTransform3, 0.0f));
-        batch.DrawCall.World.SetRow4(Float4(firstInstance.InstanceOrigin, 1.0f));
-        batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
-        batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
-        batch.DrawCall.Surface.Skinning = nullptr;
-        batch.DrawCall.WorldDeterminantSign = 1;
-#if USE_EDITOR
-        if (renderContext.View.Mode == ViewMode::LightmapUVsDensity)
-            batch.DrawCall.Surface.LODDitherFactor = type.ScaleInLightmap; // See LightmapUVsDensityMaterialShader
-#endif
-
-        if (EnumHasAnyFlags(drawModes, DrawPass::Forward))
-        {
-            // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
-            DrawCall drawCall = batch.DrawCall;
-            for (int32 j = 0; j < batch.Instances.Count(); j++)
-            {
-                auto& instance = batch.Instances[j];
-                drawCall.ObjectPosition = instance.InstanceOrigin;
-                drawCall.PerInstanceRandom = instance.PerInstanceRandom;
-                lightmapArea = instance.InstanceLightmapArea.ToFloat4();
-                drawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
-                drawCall.Surface.LODDitherFactor = instance.LODDitherFactor;
-                drawCall.World.SetRow1(Float4(instance.InstanceTransform1, 0.0f));
-                drawCall.World.SetRow2(Float4(instance.InstanceTransform2, 0.0f));
-                drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
-                drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
-                const int32 drawCallIndex = renderContext.List->DrawCalls.Add(drawCall);
-                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
-            }
-        }
-
-        // Add draw call batch
-        const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
-
-        // Add draw call to proper draw lists
-        if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
-        {
-            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
-        }
-        if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
-        {
-            if (entry.ReceiveDecals)
-                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
-            else
-                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
-        }
-        if (EnumHasAnyFlags(drawModes, DrawPass::Distortion))
-        {
-            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Distortion].PreBatchedDrawCalls.Add(batchIndex);
-        }
-        if (EnumHasAnyFlags(drawModes, DrawPass::MotionVectors) && (_staticFlags & StaticFlags::Transform) == StaticFlags::None)
-        {
-            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::MotionVectors].PreBatchedDrawCalls.Add(batchIndex);
-        }
+        DrawBatch(renderContext, type, *e.Key.Geo, batch, typeDrawModes);
     }
 #else
     DrawCluster(renderContext, type.Root, draw);
@@ -729,6 +1002,10 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
     PROFILE_CPU();
     auto& type = FoliageTypes[index];
     ASSERT(type.IsReady());
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    if (type._drawCache)
+        type._drawCache->IsDirty = true;
+#endif
 
     // Update bounds for instances using this type
     bool hasAnyInstance = false;
@@ -825,6 +1102,13 @@ void Foliage::OnFoliageTypeModelLoaded(int32 index)
 void Foliage::RebuildClusters()
 {
     PROFILE_CPU();
+#if !FOLIAGE_USE_SINGLE_QUAD_TREE && FOLIAGE_USE_DRAW_CALLS_BATCHING
+    for (auto& type : FoliageTypes)
+    {
+        if (type._drawCache)
+            type._drawCache->IsDirty = true;
+    }
+#endif
 
     // Faster path if foliage is empty or no types is ready
     bool anyTypeReady = false;
@@ -1208,7 +1492,7 @@ void Foliage::Draw(RenderContext& renderContext)
 #else
     for (auto& type : FoliageTypes)
     {
-        DrawType(renderContext, type, drawCallsLists);
+        DrawType(renderContext, type, drawCallsLists, nullptr);
     }
 #endif
 }
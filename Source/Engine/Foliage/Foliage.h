@@ -172,6 +172,14 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     typedef Dictionary<DrawKey, struct BatchedDrawCall, class RendererAllocation> BatchedDrawCalls;
     void DrawInstance(RenderContext& renderContext, FoliageInstance& instance, const FoliageType& type, Model* model, int32 lod, float lodDitherFactor, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCallsList* drawCallsLists, BatchedDrawCalls& result) const;
+    void DrawBatch(RenderContext& renderContext, const FoliageType& type, const Mesh& mesh, struct BatchedDrawCall& batch, DrawPass typeDrawModes, GPUBuffer* indirectArgsBuffer = nullptr, uint32 indirectArgsOffset = 0) const;
+    typedef Array<Int2, class RendererAllocation> DrawCacheRanges;
+    bool CanUseDrawCache(const FoliageType& type) const;
+    bool CanUseGPUCulling(const RenderContextBatch* renderContextBatch, const FoliageType& type, DrawCallsList* drawCallsLists) const;
+    bool UpdateDrawCache(FoliageType& type, const RenderView& view, bool withCullingData);
+    void WriteDrawCache(FoliageDrawCache& cache, FoliageCluster* cluster, const Vector3& origin, bool withCullingData) const;
+    void DrawClusterCached(RenderContext& renderContext, FoliageCluster* cluster, const FoliageType& type, DrawCacheRanges* ranges) const;
+    bool DrawCachedGPU(const RenderContextBatch& renderContextBatch, RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists, DrawPass typeDrawModes) const;
 #else
     void DrawCluster(RenderContext& renderContext, FoliageCluster* cluster, Mesh::DrawInfo& draw);
 #endif
@@ -181,7 +189,7 @@ API_CLASS() class FLAXENGINE_API Foliage final : public Actor
     void DrawFoliageJob(int32 i);
     RenderContextBatch* _renderContextBatch;
 #endif
-    void DrawType(RenderContext& renderContext, const FoliageType& type, DrawCallsList* drawCallsLists);
+    void DrawType(RenderContext& renderContext, FoliageType& type, DrawCallsList* drawCallsLists, const RenderContextBatch* renderContextBatch);
 
 public:
     /// <summary>
@@ -16,6 +16,9 @@ void FoliageCluster::Init(const BoundingBox& bounds)
     Children[3] = nullptr;
 
     Instances.Clear();
+    DrawCacheStart = 0;
+    DrawCacheCount = 0;
+    DrawCacheRadius = 0.0f;
 }
 
 void FoliageCluster::UpdateTotalBoundsAndCullDistance()
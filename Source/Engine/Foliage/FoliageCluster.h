@@ -43,6 +43,21 @@ class FLAXENGINE_API FoliageCluster
     /// </summary>
     Array<FoliageInstance*, FixedAllocation<FOLIAGE_CLUSTER_CAPACITY>> Instances;
 
+    /// <summary>
+    /// The index of the first instance of this cluster in the foliage type draw cache (valid only for leaf clusters when using cached drawing).
+    /// </summary>
+    int32 DrawCacheStart;
+
+    /// <summary>
+    /// The amount of instances of this cluster in the foliage type draw cache (valid only for leaf clusters when using cached drawing).
+    /// </summary>
+    int32 DrawCacheCount;
+
+    /// <summary>
+    /// The maximum bounds radius of the instances in this cluster (valid only for leaf clusters when using cached drawing). Used for the cluster LOD selection.
+    /// </summary>
+    float DrawCacheRadius;
+
 public:
     /// <summary>
     /// Initializes this instance.
@@ -0,0 +1,58 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FoliageDrawCache.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Renderer/RenderList.h"
+
+FoliageDrawCache::~FoliageDrawCache()
+{
+    SAFE_DELETE_GPU_RESOURCE(InstanceBuffer);
+    SAFE_DELETE_GPU_RESOURCE(ClustersBuffer);
+    SAFE_DELETE_GPU_RESOURCE(CullingInstancesBuffer);
+}
+
+bool FoliageDrawCache::Upload(bool withCullingData)
+{
+    HasCullingData = false;
+    ClustersCount = 0;
+    if (Instances.IsEmpty())
+    {
+        SAFE_DELETE_GPU_RESOURCE(InstanceBuffer);
+        SAFE_DELETE_GPU_RESOURCE(ClustersBuffer);
+        SAFE_DELETE_GPU_RESOURCE(CullingInstancesBuffer);
+        return false;
+    }
+    if (!InstanceBuffer)
+        InstanceBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.InstanceBuffer"));
+    if (!withCullingData)
+    {
+        SAFE_DELETE_GPU_RESOURCE(ClustersBuffer);
+        SAFE_DELETE_GPU_RESOURCE(CullingInstancesBuffer);
+        return InstanceBuffer->Init(GPUBufferDescription::Vertex(sizeof(InstanceData), Instances.Count(), Instances.Get()));
+    }
+
+    // GPU culling reads the instances data as raw buffer and copies the visible ones into the output vertex buffer
+    const auto instancesFlags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::ShaderResource | GPUBufferFlags::RawBuffer;
+    if (InstanceBuffer->Init(GPUBufferDescription::Buffer(Instances.Count() * sizeof(InstanceData), instancesFlags, PixelFormat::R32_Typeless, Instances.Get(), sizeof(InstanceData))))
+        return true;
+    if (!ClustersBuffer)
+        ClustersBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.ClustersBuffer"));
+    if (!CullingInstancesBuffer)
+        CullingInstancesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("Foliage.CullingInstancesBuffer"));
+    auto desc = GPUBufferDescription::Structured(Clusters.Count(), sizeof(FoliageCullingCluster));
+    desc.InitData = Clusters.Get();
+    if (ClustersBuffer->Init(desc))
+        return true;
+    desc = GPUBufferDescription::Structured(CullingInstances.Count(), sizeof(FoliageCullingInstance));
+    desc.InitData = CullingInstances.Get();
+    if (CullingInstancesBuffer->Init(desc))
+        return true;
+    ClustersCount = Clusters.Count();
+    HasCullingData = true;
+
+    // Release CPU copy of the culling data (used only by GPU)
+    Clusters.SetCapacity(0, false);
+    CullingInstances.SetCapacity(0, false);
+    return false;
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Config.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Vector3.h"
+
+class GPUBuffer;
+struct InstanceData;
+
+/// <summary>
+/// The leaf cluster data used by the GPU culling of the cached foliage (see FoliageCullingPass). Positions are relative to the cache origin.
+/// </summary>
+PACK_STRUCT(struct FoliageCullingCluster {
+    Float3 BoundsMin;
+    uint32 InstancesStart;
+    Float3 BoundsMax;
+    uint32 InstancesCount;
+    Float3 SphereCenter;
+    float SphereRadius;
+    float MaxCullDistance;
+    uint32 Dummy0[3];
+    });
+
+/// <summary>
+/// The instance data used by the GPU culling of the cached foliage (see FoliageCullingPass). Positions are relative to the cache origin.
+/// </summary>
+PACK_STRUCT(struct FoliageCullingInstance {
+    Float3 Center;
+    float Radius;
+    float CullDistance;
+    uint32 Dummy0[3];
+    });
+
+/// <summary>
+/// The persistent instances data of the foliage type used by the cached drawing mode (see FoliageType::UseDrawCache). Instances are stored in order of the quad-tree leaf clusters so each cluster maps into a continuous range of the instances buffer.
+/// </summary>
+class FoliageDrawCache
+{
+public:
+    /// <summary>
+    /// The instances buffer (in GPU memory).
+    /// </summary>
+    GPUBuffer* InstanceBuffer = nullptr;
+
+    /// <summary>
+    /// The instances data (CPU copy of the instances buffer).
+    /// </summary>
+    Array<InstanceData> Instances;
+
+    /// <summary>
+    /// The leaf clusters culling data buffer (in GPU memory). Created only if GPU culling is used.
+    /// </summary>
+    GPUBuffer* ClustersBuffer = nullptr;
+
+    /// <summary>
+    /// The instances culling data buffer (in GPU memory). Created only if GPU culling is used.
+    /// </summary>
+    GPUBuffer* CullingInstancesBuffer = nullptr;
+
+    /// <summary>
+    /// The leaf clusters culling data (released after upload).
+    /// </summary>
+    Array<FoliageCullingCluster> Clusters;
+
+    /// <summary>
+    /// The instances culling data (released after upload).
+    /// </summary>
+    Array<FoliageCullingInstance> CullingInstances;
+
+    /// <summary>
+    /// The amount of leaf clusters in the culling data buffer.
+    /// </summary>
+    int32 ClustersCount = 0;
+
+    /// <summary>
+    /// The origin of the view used to cache instances transformations (world matrices are relative to it).
+    /// </summary>
+    Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The last frame when cache was used for drawing.
+    /// </summary>
+    uint64 LastFrameUsed = 0;
+
+    /// <summary>
+    /// True if cache has to be rebuilt (eg. foliage clusters were modified).
+    /// </summary>
+    bool IsDirty = true;
+
+    /// <summary>
+    /// True if cache contains the data for the GPU culling (clusters and instances bounds).
+    /// </summary>
+    bool HasCullingData = false;
+
+public:
+    ~FoliageDrawCache();
+
+    /// <summary>
+    /// Uploads the instances data into the GPU buffer.
+    /// </summary>
+    /// <param name="withCullingData">True if upload the GPU culling data (Clusters and CullingInstances), otherwise the culling buffers will be released.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Upload(bool withCullingData);
+};
@@ -5,6 +5,7 @@
 #include "Engine/Core/Random.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Foliage.h"
+#include "FoliageDrawCache.h"
 
 FoliageType::FoliageType()
     : ScriptingObject(SpawnParams(Guid::New(), TypeInitializer))
@@ -15,6 +16,7 @@ FoliageType::FoliageType()
 
     ReceiveDecals = true;
     UseDensityScaling = false;
+    UseDrawCache = false;
     PlacementAlignToNormal = true;
     PlacementRandomYaw = true;
 
@@ -22,6 +24,11 @@ FoliageType::FoliageType()
     Model.Loaded.Bind<FoliageType, &FoliageType::OnModelLoaded>(this);
 }
 
+FoliageType::~FoliageType()
+{
+    SAFE_DELETE(_drawCache);
+}
+
 FoliageType& FoliageType::operator=(const FoliageType& other)
 {
     Foliage = other.Foliage;
@@ -46,6 +53,9 @@ FoliageType& FoliageType::operator=(const FoliageType& other)
     DensityScalingScale = other.DensityScalingScale;
     ReceiveDecals = other.ReceiveDecals;
     UseDensityScaling = other.UseDensityScaling;
+    UseDrawCache = other.UseDrawCache;
+    if (_drawCache)
+        _drawCache->IsDirty = true;
     PlacementAlignToNormal = other.PlacementAlignToNormal;
     PlacementRandomYaw = other.PlacementRandomYaw;
     return *this;
@@ -150,6 +160,7 @@ void FoliageType::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(ShadowsMode);
     SERIALIZE_BIT(ReceiveDecals);
     SERIALIZE_BIT(UseDensityScaling);
+    SERIALIZE_BIT(UseDrawCache);
     SERIALIZE(DensityScalingScale);
 
     SERIALIZE(PaintDensity);
@@ -190,6 +201,7 @@ void FoliageType::Deserialize(DeserializeStream& stream, ISerializeModifier* mod
     DESERIALIZE(ShadowsMode);
     DESERIALIZE_BIT(ReceiveDecals);
     DESERIALIZE_BIT(UseDensityScaling);
+    DESERIALIZE_BIT(UseDrawCache);
     DESERIALIZE(DensityScalingScale);
 
     DESERIALIZE(PaintDensity);
@@ -47,6 +47,7 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     friend Foliage;
 private:
     uint8 _isReady : 1;
+    FoliageDrawCache* _drawCache = nullptr;
 
 public:
     /// <summary>
@@ -60,6 +61,8 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
         *this = other;
     }
 
+    ~FoliageType();
+
     FoliageType& operator=(const FoliageType& other);
 
 public:
@@ -197,6 +200,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API FoliageType : public ScriptingOb
     /// </summary>
     API_FIELD() int8 UseDensityScaling : 1;
 
+    /// <summary>
+    /// If checked, instances data will be cached in GPU memory and only clusters culling and LOD selection will be performed per-frame. Greatly reduces CPU cost of drawing dense foliage at cost of the coarser culling and LOD selection (per cluster, without LOD transitions). If GPU-driven rendering is enabled, culling and LOD selection are performed per-instance on GPU (opaque materials only). Not used by the foliage with baked lightmaps.
+    /// </summary>
+    API_FIELD() int8 UseDrawCache : 1;
+
     /// <summary>
     /// If checked, instances will be aligned to normal of the placed surface.
     /// </summary>
@@ -0,0 +1,83 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "CopyQueueGPUTasksExecutor.h"
+#include "GPUTasksContext.h"
+#include "GPUTask.h"
+#include "GPUTasksManager.h"
+#include "Engine/Graphics/GPUDevice.h"
+
+CopyQueueGPUTasksExecutor::CopyQueueGPUTasksExecutor()
+    : _copyContext(nullptr)
+    , _copyContextChecked(false)
+    , _copySyncPoint(0)
+{
+}
+
+String CopyQueueGPUTasksExecutor::ToString() const
+{
+    return TEXT("Copy Queue GPU Async Executor");
+}
+
+void CopyQueueGPUTasksExecutor::FrameBegin()
+{
+    DefaultGPUTasksExecutor::FrameBegin();
+
+    // Ensure to have valid async copy context (if supported)
+    if (!_copyContextChecked)
+    {
+        _copyContextChecked = true;
+        GPUContext* copyContext = GPUDevice::Instance->GetCopyContext();
+        if (copyContext)
+        {
+            _copyContext = New<GPUTasksContext>(copyContext);
+            _contextList.Add(_copyContext);
+        }
+    }
+
+    if (_copyContext)
+        _copyContext->OnFrameBegin();
+}
+
+void CopyQueueGPUTasksExecutor::FrameEnd()
+{
+    ASSERT(_context != nullptr);
+    if (!_copyContext)
+    {
+        DefaultGPUTasksExecutor::FrameEnd();
+        return;
+    }
+
+    // Wait for the uploads submitted in the previous frame (the next frame graphics commands can use them)
+    GPUContext* mainContext = _context->GPU;
+    if (_copySyncPoint != 0)
+    {
+        mainContext->WaitForSyncPoint(_copyContext->GPU, _copySyncPoint);
+        _copySyncPoint = 0;
+    }
+
+    // Upload tasks are executed on the transfer queue and the other ones (eg. copies that read rendered data back) on the main context
+    GPUTask* buffer[32];
+    const int32 count = GPUDevice::Instance->GetTasksManager()->RequestWork(buffer, 32);
+    int32 copyTasksCount = 0;
+    for (int32 i = 0; i < count; i++)
+    {
+        GPUTask* task = buffer[i];
+        const GPUTask::Type type = task->GetType();
+        if (type == GPUTask::Type::UploadTexture || type == GPUTask::Type::UploadBuffer)
+        {
+            _copyContext->Run(task);
+            copyTasksCount++;
+        }
+        else
+        {
+            _context->Run(task);
+        }
+    }
+
+    // Submit uploads to be executed after the graphics commands of this frame
+    if (copyTasksCount != 0)
+        _copySyncPoint = _copyContext->GPU->Submit();
+
+    _copyContext->OnFrameEnd();
+    _context->OnFrameEnd();
+}
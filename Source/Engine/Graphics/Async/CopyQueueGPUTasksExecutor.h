@@ -0,0 +1,31 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "DefaultGPUTasksExecutor.h"
+
+/// <summary>
+/// GPU async job executor that performs the upload tasks (eg. texture streaming mips uploads) on the async copy context (dedicated GPU transfer queue) so they overlap with the graphics work instead of being serialized on the main context. Other tasks are executed on the main context like in the default executor. Fallbacks to the default executor behaviour if graphics backend doesn't support the async copy context.
+/// </summary>
+/// <remarks>
+/// The upload commands recorded at the end of the frame are executed on the transfer queue after the graphics commands of that frame and in parallel to the next frame. The graphics queue waits for them on the GPU at the end of the next frame, before the upload tasks get synchronized (eg. streamed mips become resident).
+/// </remarks>
+class CopyQueueGPUTasksExecutor : public DefaultGPUTasksExecutor
+{
+protected:
+    GPUTasksContext* _copyContext;
+    bool _copyContextChecked;
+    uint64 _copySyncPoint;
+
+public:
+    /// <summary>
+    /// Init
+    /// </summary>
+    CopyQueueGPUTasksExecutor();
+
+public:
+    // [DefaultGPUTasksExecutor]
+    String ToString() const override;
+    void FrameBegin() override;
+    void FrameEnd() override;
+};
@@ -24,6 +24,14 @@ GPUTasksContext::GPUTasksContext(GPUDevice* device)
 #endif
 }
 
+GPUTasksContext::GPUTasksContext(GPUContext* context)
+    : _tasksDone(64)
+    , _totalTasksDoneCount(0)
+{
+    _currentSyncPoint = 10;
+    GPU = context;
+}
+
 GPUTasksContext::~GPUTasksContext()
 {
     ASSERT(IsInMainThread());
@@ -27,6 +27,12 @@ class GPUTasksContext
     /// <param name="device">The graphics device.</param>
     GPUTasksContext(GPUDevice* device);
 
+    /// <summary>
+    /// Initializes a new instance of the <see cref="GPUTasksContext"/> class.
+    /// </summary>
+    /// <param name="context">The GPU commands context used for tasks execution (eg. async copy context). Not owned by the tasks context.</param>
+    GPUTasksContext(GPUContext* context);
+
     /// <summary>
     /// Finalizes an instance of the <see cref="GPUTasksContext"/> class.
     /// </summary>
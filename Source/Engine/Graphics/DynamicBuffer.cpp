@@ -8,6 +8,108 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Threading/Threading.h"
+#include "Async/GPUSyncPoint.h"
+
+// The amount of frames the upload ring memory is split into (GPU has some latency so memory used by the previous frames cannot be overriden)
+#define DYNAMIC_BUFFER_RING_FRAMES (GPU_ASYNC_LATENCY + 1)
+
+// The initial size (in bytes) of the upload ring memory per-frame
+#define DYNAMIC_BUFFER_RING_FRAME_SIZE (4 * 1024 * 1024)
+
+namespace
+{
+    // Persistently mapped upload memory shared by all dynamic buffers. Linearly allocated within the current frame range which is reused after GPU is done with it.
+    struct UploadRing
+    {
+        CriticalSection Locker;
+        GPUBuffer* Buffer = nullptr;
+        byte* Mapped = nullptr;
+        uint32 FrameSize = 0;
+        uint32 FrameOffset = 0;
+        uint32 RequiredFrameSize = DYNAMIC_BUFFER_RING_FRAME_SIZE;
+        uint64 Frame = 0;
+        bool Unsupported = false;
+
+        void Release()
+        {
+            if (Mapped)
+            {
+                Buffer->Unmap();
+                Mapped = nullptr;
+            }
+            SAFE_DELETE_GPU_RESOURCE(Buffer);
+            FrameSize = 0;
+        }
+
+        bool Upload(GPUContext* context, GPUBuffer* buffer, const byte* data, uint32 size, uint32 dstOffset = 0)
+        {
+            ScopeLock lock(Locker);
+            if (Unsupported)
+                return true;
+            const uint64 frame = Engine::FrameCount;
+            if (frame != Frame)
+            {
+                // Begin new frame range
+                Frame = frame;
+                FrameOffset = 0;
+                if (FrameSize < RequiredFrameSize)
+                {
+                    // Resize ring memory (the old buffer gets released after GPU is done with it)
+                    Release();
+                    if (Init(RequiredFrameSize))
+                        return true;
+                }
+            }
+            const uint32 offset = Math::AlignUp<uint32>(FrameOffset, 16);
+            if (offset + size > FrameSize)
+            {
+                // Fallback to the regular update and grow ring for the next frames
+                RequiredFrameSize = Math::Max(RequiredFrameSize, Math::RoundUpToPowerOf2(offset + size));
+                return true;
+            }
+            FrameOffset = offset + size;
+            const uint32 ringOffset = (uint32)(Frame % DYNAMIC_BUFFER_RING_FRAMES) * FrameSize + offset;
+
+            // Write data directly into the mapped memory and copy it on the GPU
+            Platform::MemoryCopy(Mapped + ringOffset, data, size);
+            context->CopyBuffer(buffer, Buffer, size, dstOffset, ringOffset);
+            return false;
+        }
+
+    private:
+        bool Init(uint32 frameSize)
+        {
+            // Persistently mapped upload buffers are not supported on D3D11 (mapping dynamic buffers with discard is already a driver-managed ring there)
+            const RendererType rendererType = GPUDevice::Instance->GetRendererType();
+            if (rendererType == RendererType::DirectX10 || rendererType == RendererType::DirectX10_1 || rendererType == RendererType::DirectX11 || rendererType == RendererType::Null)
+            {
+                Unsupported = true;
+                return true;
+            }
+            Buffer = GPUDevice::Instance->CreateBuffer(TEXT("DynamicBuffer.UploadRing"));
+            if (Buffer->Init(GPUBufferDescription::Buffer(frameSize * DYNAMIC_BUFFER_RING_FRAMES, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, 0, GPUResourceUsage::StagingUpload)))
+            {
+                LOG(Warning, "Failed to create dynamic buffers upload ring. Size: {0}", Utilities::BytesToText(frameSize * DYNAMIC_BUFFER_RING_FRAMES));
+                SAFE_DELETE_GPU_RESOURCE(Buffer);
+                Unsupported = true;
+                return true;
+            }
+            Mapped = (byte*)Buffer->Map(GPUResourceMapMode::Write);
+            if (!Mapped)
+            {
+                SAFE_DELETE_GPU_RESOURCE(Buffer);
+                Unsupported = true;
+                return true;
+            }
+            FrameSize = frameSize;
+            return false;
+        }
+    };
+
+    UploadRing Ring;
+}
 
 DynamicBuffer::DynamicBuffer(uint32 initialCapacity, uint32 stride, const String& name)
     : _buffer(nullptr)
@@ -49,7 +151,9 @@ void DynamicBuffer::Flush()
         if (GPUDevice::Instance->IsRendering())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_buffer, Data.Get(), size);
+            GPUContext* context = GPUDevice::Instance->GetMainContext();
+            if (Ring.Upload(context, _buffer, Data.Get(), size))
+                context->UpdateBuffer(_buffer, Data.Get(), size);
             RenderContext::GPULocker.Unlock();
         }
         else
@@ -83,7 +187,34 @@ void DynamicBuffer::Flush(GPUContext* context)
         }
 
         // Upload data to the buffer
-        context->UpdateBuffer(_buffer, Data.Get(), size);
+        if (Ring.Upload(context, _buffer, Data.Get(), size))
+            context->UpdateBuffer(_buffer, Data.Get(), size);
+    }
+}
+
+void DynamicBuffer::Flush(uint32 offset, uint32 size)
+{
+    // Upload the whole data if buffer has to be created or resized
+    const uint32 dataSize = Data.Count();
+    if (_buffer == nullptr || _buffer->GetSize() < dataSize || offset >= dataSize)
+    {
+        Flush();
+        return;
+    }
+    size = Math::Min(size, dataSize - offset);
+
+    // Partial update is done via the upload ring memory copy (mapping dynamic buffer discards its contents)
+    if (GPUDevice::Instance->IsRendering())
+    {
+        RenderContext::GPULocker.Lock();
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        if (Ring.Upload(context, _buffer, Data.Get() + offset, size, offset))
+            context->UpdateBuffer(_buffer, Data.Get(), dataSize);
+        RenderContext::GPULocker.Unlock();
+    }
+    else
+    {
+        _buffer->SetData(Data.Get(), dataSize);
     }
 }
 
@@ -93,6 +224,13 @@ void DynamicBuffer::Dispose()
     Data.Resize(0);
 }
 
+void DynamicBuffer::ReleaseUploadRing()
+{
+    ScopeLock lock(Ring.Locker);
+    Ring.Release();
+    Ring.Unsupported = false;
+}
+
 void DynamicStructuredBuffer::InitDesc(GPUBufferDescription& desc, int32 numElements)
 {
     desc = GPUBufferDescription::Structured(numElements, _stride, _isUnorderedAccess);
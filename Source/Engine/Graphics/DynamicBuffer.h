@@ -105,11 +105,23 @@ class FLAXENGINE_API DynamicBuffer
     /// <param name="context">The GPU command list context to use for data uploading.</param>
     void Flush(class GPUContext* context);
 
+    /// <summary>
+    /// Unlock buffer and flush only the modified range of the data with a buffer (it will be ready for an immediate draw). The rest of the buffer contents has to be already uploaded by the previous flush. Uploads the whole data if partial update is not supported or buffer needs to be resized.
+    /// </summary>
+    /// <param name="offset">The offset (in bytes) of the modified data range.</param>
+    /// <param name="size">The size (in bytes) of the modified data range.</param>
+    void Flush(uint32 offset, uint32 size);
+
     /// <summary>
     /// Disposes the buffer resource and clears the used memory.
     /// </summary>
     void Dispose();
 
+    /// <summary>
+    /// Releases the persistently mapped upload memory shared by all dynamic buffers (used to upload the data during rendering without mapping the buffers on each flush). Called by the graphics device on dispose.
+    /// </summary>
+    static void ReleaseUploadRing();
+
 protected:
     virtual void InitDesc(GPUBufferDescription& desc, int32 numElements) = 0;
 };
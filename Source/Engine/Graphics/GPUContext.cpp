@@ -64,6 +64,23 @@ void GPUContext::Draw(GPUTextureView* rt)
     DrawFullscreenTriangle();
 }
 
+void GPUContext::SetShadingRateImage(GPUTexture* rateImage)
+{
+}
+
+void GPUContext::ExecuteDeferred(const Span<GPUContext*>& contexts)
+{
+}
+
+uint64 GPUContext::Submit()
+{
+    return 0;
+}
+
+void GPUContext::WaitForSyncPoint(GPUContext* context, uint64 syncPoint)
+{
+}
+
 void GPUContext::SetResourceState(GPUResource* resource, uint64 state, int32 subresource)
 {
 }
@@ -119,6 +119,10 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
 
 protected:
     double _lastRenderTime = -1;
+    bool _isDeferred = false;
+    bool _isAsyncCompute = false;
+    bool _isAsyncCopy = false;
+    GPUTexture* _shadingRateImage = nullptr;
     GPUContext(GPUDevice* device);
 
 public:
@@ -130,6 +134,30 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
         return _device;
     }
 
+    /// <summary>
+    /// Checks if it's a deferred context that records commands on a worker thread (in parallel to the main context). Deferred contexts are executed in order by the main context via ExecuteDeferred.
+    /// </summary>
+    FORCE_INLINE bool IsDeferred() const
+    {
+        return _isDeferred;
+    }
+
+    /// <summary>
+    /// Checks if it's an async compute context that records compute commands executed on a separate GPU queue (in parallel to the graphics work of the main context). See GPUDevice::GetComputeContext.
+    /// </summary>
+    FORCE_INLINE bool IsAsyncCompute() const
+    {
+        return _isAsyncCompute;
+    }
+
+    /// <summary>
+    /// Checks if it's an async copy context that records copy and upload commands executed on a separate GPU transfer queue (in parallel to the graphics work of the main context). See GPUDevice::GetCopyContext.
+    /// </summary>
+    FORCE_INLINE bool IsAsyncCopy() const
+    {
+        return _isAsyncCopy;
+    }
+
 public:
     /// <summary>
     /// Begins new frame and enters commands collecting mode.
@@ -581,6 +609,21 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// <param name="scissorRect">The scissor rectangle (in pixels).</param>
     API_FUNCTION() virtual void SetScissor(API_PARAM(Ref) const Rectangle& scissorRect) = 0;
 
+    /// <summary>
+    /// Sets the shading rate image that controls the pixel shading rate of the following draw calls (Variable Rate Shading). Ignored if device doesn't support it (see GPULimits::HasVariableRateShading).
+    /// </summary>
+    /// <remarks>The texture uses R8_UInt format with a single texel per GPULimits::VariableRateShadingTileSize pixels tile. Texel value encodes the shading rate as (log2(width) &lt;&lt; 2) | log2(height) (eg. 0 for 1x1, 5 for 2x2).</remarks>
+    /// <param name="rateImage">The shading rate image or null to disable it (full rate shading).</param>
+    API_FUNCTION() virtual void SetShadingRateImage(GPUTexture* rateImage);
+
+    /// <summary>
+    /// Gets the shading rate image used by the draw calls (null if not used).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE GPUTexture* GetShadingRateImage() const
+    {
+        return _shadingRateImage;
+    }
+
 public:
     /// <summary>
     /// Sets the graphics pipeline state.
@@ -609,6 +652,26 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUContext : public ScriptingObj
     /// </summary>
     API_FUNCTION() virtual void Flush() = 0;
 
+    /// <summary>
+    /// Submits the commands recorded by this context and then the commands recorded by the deferred contexts (in the given order). Deferred contexts are reset and can be used to record commands again. Called on the main context from the rendering thread after all the deferred contexts finished recording.
+    /// </summary>
+    /// <param name="contexts">The deferred contexts to execute.</param>
+    virtual void ExecuteDeferred(const Span<GPUContext*>& contexts);
+
+    /// <summary>
+    /// Submits the commands recorded so far to the GPU (without waiting for them) and returns the sync point that can be waited by the other contexts (see WaitForSyncPoint). For async compute and async copy contexts, the main context commands recorded before are submitted first and the async commands are executed after them.
+    /// </summary>
+    /// <remarks>Resources used by the submitted async compute commands cannot be used by the other contexts until they wait for the sync point.</remarks>
+    /// <returns>The sync point value or 0 if not supported.</returns>
+    virtual uint64 Submit();
+
+    /// <summary>
+    /// Inserts the GPU-side wait for the commands of the other context (executed on a different GPU queue) to reach the given sync point. The commands recorded by this context after this call are executed after that. CPU doesn't stall.
+    /// </summary>
+    /// <param name="context">The other context (eg. async compute context).</param>
+    /// <param name="syncPoint">The sync point returned by the Submit of the other context.</param>
+    virtual void WaitForSyncPoint(GPUContext* context, uint64 syncPoint);
+
     /// <summary>
     /// Sets the state of the resource (or subresource).
     /// </summary>
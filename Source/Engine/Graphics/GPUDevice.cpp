@@ -1,6 +1,8 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "GPUDevice.h"
+#include "GPUContext.h"
+#include "DynamicBuffer.h"
 #include "RenderTargetPool.h"
 #include "GPUPipelineState.h"
 #include "GPUResourceProperty.h"
@@ -22,7 +24,11 @@
 #include "Engine/Engine/CommandLine.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/Thread.h"
+#include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Threading/IRunnable.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Scripting/Enums.h"
 
@@ -99,6 +105,23 @@ bool GPUPipelineState::Init(const Description& desc)
     CHECK_STAGE(PS);
 #undef CHECK_STAGE
 
+    // Calculate stable description hash (don't use shader pointers)
+    _hash = ((uint32)desc.DepthEnable << 0) | ((uint32)desc.DepthWriteEnable << 1) | ((uint32)desc.DepthClipEnable << 2) | ((uint32)desc.StencilEnable << 3) | ((uint32)desc.Wireframe << 4);
+    CombineHash(_hash, (uint32)desc.DepthFunc);
+    CombineHash(_hash, (uint32)desc.StencilReadMask | ((uint32)desc.StencilWriteMask << 8));
+    CombineHash(_hash, (uint32)desc.StencilFunc);
+    CombineHash(_hash, (uint32)desc.StencilFailOp | ((uint32)desc.StencilDepthFailOp << 8) | ((uint32)desc.StencilPassOp << 16));
+    CombineHash(_hash, (uint32)desc.PrimitiveTopology);
+    CombineHash(_hash, (uint32)desc.CullMode);
+    CombineHash(_hash, ::GetHash(desc.BlendMode));
+#define HASH_STAGE(stage) CombineHash(_hash, desc.stage ? desc.stage->GetHash() : 0)
+    HASH_STAGE(VS);
+    HASH_STAGE(HS);
+    HASH_STAGE(DS);
+    HASH_STAGE(GS);
+    HASH_STAGE(PS);
+#undef HASH_STAGE
+
 #if USE_EDITOR
     // Estimate somehow performance cost of this pipeline state for the content profiling
     const int32 textureLookupCost = 20;
@@ -291,6 +314,60 @@ void GPUResource::OnDeleteObject()
 
 double GPUResourceView::DummyLastRenderTime = -1;
 
+namespace
+{
+    struct PendingPresent
+    {
+        RenderTask* Task;
+        bool VSync;
+    };
+
+    // Frame pipelining state (protected by the device locker)
+    Array<PendingPresent> PendingPresents;
+    volatile int64 PresentPending = 0;
+
+    // Render thread state
+    Thread* RenderThread = nullptr;
+    CriticalSection RenderThreadLocker;
+    ConditionVariable RenderThreadSignal;
+    bool RenderThreadRequest = false;
+    bool RenderThreadExit = false;
+}
+
+class GPURenderThread : public IRunnable
+{
+public:
+    // [IRunnable]
+    String ToString() const override
+    {
+        return TEXT("GPURenderThread");
+    }
+
+    int32 Run() override
+    {
+        while (true)
+        {
+            RenderThreadLocker.Lock();
+            while (!RenderThreadRequest && !RenderThreadExit)
+                RenderThreadSignal.Wait(RenderThreadLocker);
+            const bool exit = RenderThreadExit;
+            RenderThreadRequest = false;
+            RenderThreadLocker.Unlock();
+            if (exit)
+                break;
+
+            // Present the last frame while the main thread updates the next one
+            GPUDevice::Instance->WaitForPresent();
+        }
+        return 0;
+    }
+
+    void AfterWork(bool wasKilled) override
+    {
+        Delete(this);
+    }
+};
+
 struct GPUDevice::PrivateData
 {
     AssetReference<Shader> QuadShader;
@@ -303,6 +380,12 @@ struct GPUDevice::PrivateData
     AssetReference<Texture> DefaultWhiteTexture;
     AssetReference<Texture> DefaultBlackTexture;
     GPUTasksManager TasksManager;
+    Array<GPUContext*> DeferredContexts;
+    bool DeferredContextsUnsupported = false;
+    GPUContext* ComputeContext = nullptr;
+    bool ComputeContextUnsupported = false;
+    GPUContext* CopyContext = nullptr;
+    bool CopyContextUnsupported = false;
 };
 
 GPUDevice* GPUDevice::Instance = nullptr;
@@ -478,6 +561,19 @@ void GPUDevice::DumpResourcesToLog() const
 
 void GPUDevice::preDispose()
 {
+    // Stop the render thread
+    if (RenderThread)
+    {
+        RenderThreadLocker.Lock();
+        RenderThreadExit = true;
+        RenderThreadSignal.NotifyAll();
+        RenderThreadLocker.Unlock();
+        RenderThread->Join();
+        Delete(RenderThread);
+        RenderThread = nullptr;
+    }
+    WaitForPresent();
+
     Locker.Lock();
     RenderTargetPool::Flush();
 
@@ -490,6 +586,20 @@ void GPUDevice::preDispose()
     SAFE_DELETE_GPU_RESOURCE(_res->PS_CopyLinear);
     SAFE_DELETE_GPU_RESOURCE(_res->PS_Clear);
     SAFE_DELETE_GPU_RESOURCE(_res->FullscreenTriangleVB);
+    DynamicBuffer::ReleaseUploadRing();
+    for (GPUContext* context : _res->DeferredContexts)
+        Delete(context);
+    _res->DeferredContexts.Clear();
+    if (_res->ComputeContext)
+    {
+        Delete(_res->ComputeContext);
+        _res->ComputeContext = nullptr;
+    }
+    if (_res->CopyContext)
+    {
+        Delete(_res->CopyContext);
+        _res->CopyContext = nullptr;
+    }
 
     Locker.Unlock();
 
@@ -562,7 +672,15 @@ void GPUDevice::DrawEnd()
             }
 
             anyVSync |= vsync;
-            task->OnPresent(vsync);
+            if (Graphics::EnableFramePipelining && task->SwapChain->CanPresentAsync())
+            {
+                // Present on the render thread
+                PendingPresents.Add({ task, vsync });
+            }
+            else
+            {
+                task->OnPresent(vsync);
+            }
             presentCount++;
         }
     }
@@ -581,12 +699,56 @@ void GPUDevice::DrawEnd()
     ProfilerGPU::OnPresentTime((float)((presentEnd - presentStart) * 1000.0));
 #endif
 
+    // Kick the render thread to present the swap chains once the device gets unlocked at the frame end (main thread continues with the next frame)
+    if (PendingPresents.HasItems())
+    {
+        Platform::AtomicStore(&PresentPending, 1);
+        if (!RenderThread)
+            RenderThread = Thread::Create(New<GPURenderThread>(), TEXT("Render Thread"), ThreadPriority::AboveNormal);
+        if (RenderThread)
+        {
+            RenderThreadLocker.Lock();
+            RenderThreadRequest = true;
+            RenderThreadSignal.NotifyOne();
+            RenderThreadLocker.Unlock();
+        }
+        else
+        {
+            WaitForPresent();
+        }
+    }
+
     _wasVSyncUsed = anyVSync;
     _isRendering = false;
 
     RenderTargetPool::Flush();
 }
 
+void GPUDevice::WaitForPresent()
+{
+    if (Platform::AtomicRead(&PresentPending) == 0)
+        return;
+    PROFILE_CPU();
+
+    // Device locker is held by the render thread during the present so this waits for it to end (or the calling thread performs it if the render thread has not picked it yet)
+    ScopeLock lock(Locker);
+    if (PendingPresents.HasItems())
+    {
+        PROFILE_CPU_NAMED("Present");
+#if COMPILE_WITH_PROFILER
+        const double presentStart = Platform::GetTimeSeconds();
+#endif
+        for (const PendingPresent& e : PendingPresents)
+            e.Task->OnPresent(e.VSync);
+        PendingPresents.Clear();
+#if COMPILE_WITH_PROFILER
+        const double presentEnd = Platform::GetTimeSeconds();
+        ProfilerGPU::OnPresentTime((float)((presentEnd - presentStart) * 1000.0));
+#endif
+    }
+    Platform::AtomicStore(&PresentPending, 0);
+}
+
 void GPUDevice::RenderBegin()
 {
 #if COMPILE_WITH_PROFILER
@@ -601,6 +763,79 @@ void GPUDevice::RenderEnd()
 #endif
 }
 
+GPUContext* GPUDevice::GetDeferredContext(int32 index)
+{
+    ASSERT(index >= 0);
+    ScopeLock lock(Locker);
+    while (index >= _res->DeferredContexts.Count() && !_res->DeferredContextsUnsupported)
+    {
+        GPUContext* context = CreateDeferredContext();
+        if (!context)
+        {
+            _res->DeferredContextsUnsupported = true;
+            break;
+        }
+        _res->DeferredContexts.Add(context);
+    }
+    return index < _res->DeferredContexts.Count() ? _res->DeferredContexts[index] : nullptr;
+}
+
+GPUContext* GPUDevice::CreateDeferredContext()
+{
+    return nullptr;
+}
+
+GPUContext* GPUDevice::GetComputeContext()
+{
+    ScopeLock lock(Locker);
+    if (!_res->ComputeContext && !_res->ComputeContextUnsupported)
+    {
+        _res->ComputeContext = CreateComputeContext();
+        _res->ComputeContextUnsupported = _res->ComputeContext == nullptr;
+    }
+    return _res->ComputeContext;
+}
+
+GPUContext* GPUDevice::CreateComputeContext()
+{
+    return nullptr;
+}
+
+GPUContext* GPUDevice::GetCopyContext()
+{
+    ScopeLock lock(Locker);
+    if (!_res->CopyContext && !_res->CopyContextUnsupported)
+    {
+        _res->CopyContext = CreateCopyContext();
+        _res->CopyContextUnsupported = _res->CopyContext == nullptr;
+    }
+    return _res->CopyContext;
+}
+
+GPUContext* GPUDevice::CreateCopyContext()
+{
+    return nullptr;
+}
+
+GPUTexture* GPUDevice::CreateTransientTexture(const StringView& name)
+{
+    return CreateTexture(name);
+}
+
+bool GPUDevice::BeginTransientTexture(GPUTexture* texture)
+{
+    return false;
+}
+
+void GPUDevice::EndTransientTexture(GPUTexture* texture)
+{
+}
+
+bool GPUDevice::QueryMemoryBudget(uint64& budget, uint64& usage) const
+{
+    return true;
+}
+
 GPUTasksContext* GPUDevice::CreateTasksContext()
 {
     return New<GPUTasksContext>(this);
@@ -613,6 +848,11 @@ GPUTasksExecutor* GPUDevice::CreateTasksExecutor()
 
 void GPUDevice::Draw()
 {
+    PROFILE_MEM(Graphics);
+
+    // Ensure the previous frame got presented before drawing the next one
+    WaitForPresent();
+
     DrawBegin();
 
     auto context = GetMainContext();
@@ -653,6 +893,41 @@ uint64 GPUDevice::GetMemoryUsage() const
     return result;
 }
 
+GPUDevice::MemoryStats GPUDevice::GetMemoryStats() const
+{
+    MemoryStats result;
+    _resourcesLock.Lock();
+    for (int32 i = 0; i < _resources.Count(); i++)
+    {
+        const GPUResource* resource = _resources[i];
+        const uint64 memoryUsage = resource->GetMemoryUsage();
+        switch (resource->GetResourceType())
+        {
+        case GPUResourceType::RenderTarget:
+            result.RenderTargets += memoryUsage;
+            break;
+        case GPUResourceType::Texture:
+        case GPUResourceType::CubeTexture:
+        case GPUResourceType::VolumeTexture:
+            result.Textures += memoryUsage;
+            break;
+        case GPUResourceType::Buffer:
+            result.Buffers += memoryUsage;
+            break;
+        default:
+            result.Other += memoryUsage;
+            break;
+        }
+    }
+    _resourcesLock.Unlock();
+    if (QueryMemoryBudget(result.Budget, result.BudgetUsage))
+    {
+        result.Budget = 0;
+        result.BudgetUsage = 0;
+    }
+    return result;
+}
+
 Array<GPUResource*> GPUDevice::GetResources() const
 {
     _resourcesLock.Lock();
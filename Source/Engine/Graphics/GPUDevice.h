@@ -75,6 +75,44 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
         API_FIELD() uint32 RefreshRate;
     };
 
+    /// <summary>
+    /// Describes the GPU memory usage (per resource category) and the video memory budget reported by the OS.
+    /// </summary>
+    API_STRUCT() struct MemoryStats
+    {
+        DECLARE_SCRIPTING_TYPE_NO_SPAWN(MemoryStats);
+
+        /// <summary>
+        /// The amount of memory (in bytes) used by the textures (excluding render targets). Includes the streamed textures at their current residency.
+        /// </summary>
+        API_FIELD() uint64 Textures = 0;
+
+        /// <summary>
+        /// The amount of memory (in bytes) used by the render targets.
+        /// </summary>
+        API_FIELD() uint64 RenderTargets = 0;
+
+        /// <summary>
+        /// The amount of memory (in bytes) used by the buffers.
+        /// </summary>
+        API_FIELD() uint64 Buffers = 0;
+
+        /// <summary>
+        /// The amount of memory (in bytes) used by the other resources (eg. shaders).
+        /// </summary>
+        API_FIELD() uint64 Other = 0;
+
+        /// <summary>
+        /// The local video memory budget (in bytes) given by the OS to the application (can change at runtime, eg. when other applications use the GPU memory). Zero if not supported by the graphics backend.
+        /// </summary>
+        API_FIELD() uint64 Budget = 0;
+
+        /// <summary>
+        /// The current local video memory usage (in bytes) of the application reported by the OS (includes the driver internal allocations). Zero if not supported by the graphics backend.
+        /// </summary>
+        API_FIELD() uint64 BudgetUsage = 0;
+    };
+
     /// <summary>
     /// The singleton instance of the graphics device.
     /// </summary>
@@ -210,6 +248,25 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() virtual GPUContext* GetMainContext() = 0;
 
+    /// <summary>
+    /// Gets the deferred GPU context from the device pool (created on the first use). Deferred contexts record commands on worker threads in parallel and are executed in order by the main context (see GPUContext::ExecuteDeferred).
+    /// </summary>
+    /// <param name="index">The context index (each worker recording in parallel has to use a different context).</param>
+    /// <returns>The deferred context or null if not supported by the graphics backend.</returns>
+    GPUContext* GetDeferredContext(int32 index);
+
+    /// <summary>
+    /// Gets the async compute GPU context (created on the first use). Async compute context records compute commands on the rendering thread that are executed on a separate GPU queue in parallel to the graphics work (see GPUContext::Submit and GPUContext::WaitForSyncPoint).
+    /// </summary>
+    /// <returns>The async compute context or null if not supported by the graphics backend.</returns>
+    GPUContext* GetComputeContext();
+
+    /// <summary>
+    /// Gets the async copy GPU context (created on the first use). Async copy context records copy and upload commands on the rendering thread that are executed on a separate GPU transfer queue in parallel to the graphics work (see GPUContext::Submit and GPUContext::WaitForSyncPoint).
+    /// </summary>
+    /// <returns>The async copy context or null if not supported by the graphics backend.</returns>
+    GPUContext* GetCopyContext();
+
     /// <summary>
     /// Gets the adapter device.
     /// </summary>
@@ -225,6 +282,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     API_PROPERTY() uint64 GetMemoryUsage() const;
 
+    /// <summary>
+    /// Gets the GPU memory usage statistics (per resource category) and the current video memory budget reported by the OS.
+    /// </summary>
+    API_PROPERTY() MemoryStats GetMemoryStats() const;
+
     /// <summary>
     /// Gets the list with all active GPU resources.
     /// </summary>
@@ -309,6 +371,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// </summary>
     virtual void WaitForGPU() = 0;
 
+    /// <summary>
+    /// Waits for the pending presentation of the last frame swap chains (see Graphics::EnableFramePipelining). Performs it on the calling thread if the render thread has not started it yet. Has to be called before resizing or releasing the swap chain.
+    /// </summary>
+    void WaitForPresent();
+
 public:
     void AddResource(GPUResource* resource);
     void RemoveResource(GPUResource* resource);
@@ -349,6 +416,26 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// <returns>The texture.</returns>
     API_FUNCTION() virtual GPUTexture* CreateTexture(const StringView& name = StringView::Empty) = 0;
 
+    /// <summary>
+    /// Creates the transient texture that can share (alias) the memory with other transient textures which are not used at the same time (eg. temporary render targets within a frame). The texture usage has to be marked with BeginTransientTexture/EndTransientTexture and its contents are undefined at the beginning of each use.
+    /// </summary>
+    /// <param name="name">The resource name.</param>
+    /// <returns>The texture.</returns>
+    virtual GPUTexture* CreateTransientTexture(const StringView& name = StringView::Empty);
+
+    /// <summary>
+    /// Marks the beginning of the transient texture usage (first use). Fails if the texture memory is used by other active transient texture.
+    /// </summary>
+    /// <param name="texture">The transient texture.</param>
+    /// <returns>True if texture cannot be used now (memory is already in use), otherwise false.</returns>
+    virtual bool BeginTransientTexture(GPUTexture* texture);
+
+    /// <summary>
+    /// Marks the end of the transient texture usage (last use). The texture memory can be reused by other transient textures after that.
+    /// </summary>
+    /// <param name="texture">The transient texture.</param>
+    virtual void EndTransientTexture(GPUTexture* texture);
+
     /// <summary>
     /// Creates the shader.
     /// </summary>
@@ -396,6 +483,32 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API GPUDevice : public ScriptingObje
     /// <returns>The constant buffer.</returns>
     virtual GPUConstantBuffer* CreateConstantBuffer(uint32 size, const StringView& name = StringView::Empty) = 0;
 
+    /// <summary>
+    /// Creates the deferred GPU context used to record commands on a worker thread.
+    /// </summary>
+    /// <returns>The deferred context or null if not supported by the graphics backend.</returns>
+    virtual GPUContext* CreateDeferredContext();
+
+    /// <summary>
+    /// Creates the async compute GPU context used to execute compute commands on a separate GPU queue.
+    /// </summary>
+    /// <returns>The async compute context or null if not supported by the graphics backend.</returns>
+    virtual GPUContext* CreateComputeContext();
+
+    /// <summary>
+    /// Creates the async copy GPU context used to execute copy and upload commands on a separate GPU transfer queue.
+    /// </summary>
+    /// <returns>The async copy context or null if not supported by the graphics backend.</returns>
+    virtual GPUContext* CreateCopyContext();
+
+    /// <summary>
+    /// Queries the local video memory budget and the current usage from the OS (eg. via DXGI or VK_EXT_memory_budget).
+    /// </summary>
+    /// <param name="budget">The result memory budget (in bytes).</param>
+    /// <param name="usage">The result memory usage (in bytes).</param>
+    /// <returns>True if failed or not supported by the graphics backend, otherwise false.</returns>
+    virtual bool QueryMemoryBudget(uint64& budget, uint64& usage) const;
+
     /// <summary>
     /// Creates the GPU tasks context.
     /// </summary>
@@ -279,6 +279,21 @@ API_STRUCT() struct GPULimits
     /// </summary>
     API_FIELD() bool HasTypedUAVLoad;
 
+    /// <summary>
+    /// True if device supports bindless resources (shader resource views are accessible in shaders from the global descriptors table via GPUResourceView::GetBindlessIndex). Disabled by default on DirectX 12 (see DX12_USE_BINDLESS).
+    /// </summary>
+    API_FIELD() bool HasBindless;
+
+    /// <summary>
+    /// True if device supports Variable Rate Shading controlled by the shading rate image (screen-space texture with per-tile shading rate, see GPUContext::SetShadingRateImage).
+    /// </summary>
+    API_FIELD() bool HasVariableRateShading;
+
+    /// <summary>
+    /// True if device supports pipeline statistics queries (shader invocations and primitives counts, see GPUTimerQuery::CollectPipelineStatistics).
+    /// </summary>
+    API_FIELD() bool HasPipelineStatistics;
+
     /// <summary>
     /// The maximum amount of texture mip levels.
     /// </summary>
@@ -318,4 +333,9 @@ API_STRUCT() struct GPULimits
     /// The maximum degree of anisotropic filtering used for texture sampling.
     /// </summary>
     API_FIELD() float MaximumSamplerAnisotropy;
+
+    /// <summary>
+    /// The size (in pixels) of the screen-space tile that uses a single texel of the shading rate image. Zero if Variable Rate Shading is not supported.
+    /// </summary>
+    API_FIELD() int32 VariableRateShadingTileSize;
 };
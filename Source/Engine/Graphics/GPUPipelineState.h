@@ -168,6 +168,7 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUPipelineState : public GPUResource
 
 protected:
     ShaderBindings _meta;
+    uint32 _hash = 0;
 
     GPUPipelineState();
 
@@ -207,6 +208,14 @@ API_CLASS(Sealed) class FLAXENGINE_API GPUPipelineState : public GPUResource
         return _meta.UsedUAsMask;
     }
 
+    /// <summary>
+    /// Gets the hash of the pipeline state description (shader programs bytecode and render states). It's stable across the game sessions and used to identify the pipeline state in GPUPipelineStateManifest.
+    /// </summary>
+    FORCE_INLINE uint32 GetHash() const
+    {
+        return _hash;
+    }
+
 public:
     /// <summary>
     /// Returns true if pipeline state is valid and ready to use
@@ -0,0 +1,127 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUPipelineStateManifest.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Threading/Threading.h"
+
+#define PSO_MANIFEST_MAGIC 0x4D4F5350
+#define PSO_MANIFEST_VERSION 1
+
+namespace
+{
+    CriticalSection Locker;
+    String ManifestPath;
+    int32 VariantSize = 0;
+    bool Recording = false;
+    bool Modified = false;
+    Dictionary<uint32, Array<byte>> States;
+}
+
+void GPUPipelineStateManifest::Init(const StringView& backendName, int32 variantSize)
+{
+    ScopeLock lock(Locker);
+    ManifestPath = Globals::ProjectContentFolder / String::Format(TEXT("PipelineStates.{0}.manifest"), backendName);
+    VariantSize = variantSize;
+    Recording = CommandLine::Options.RecordPSO.IsTrue();
+    Modified = false;
+    States.Clear();
+    if (!FileSystem::FileExists(ManifestPath))
+        return;
+
+    // Load manifest
+    Array<byte> data;
+    if (File::ReadAllBytes(ManifestPath, data) || data.Count() < 4 * sizeof(uint32))
+        return;
+    MemoryReadStream stream(data.Get(), data.Count());
+    uint32 magic, version, size;
+    int32 statesCount;
+    stream.ReadUint32(&magic);
+    stream.ReadUint32(&version);
+    stream.ReadUint32(&size);
+    stream.ReadInt32(&statesCount);
+    if (magic != PSO_MANIFEST_MAGIC || version != PSO_MANIFEST_VERSION || size != (uint32)VariantSize)
+    {
+        LOG(Warning, "Skipping invalid or outdated pipeline states manifest {0}", ManifestPath);
+        return;
+    }
+    States.EnsureCapacity(statesCount);
+    for (int32 i = 0; i < statesCount; i++)
+    {
+        uint32 hash;
+        int32 variantsCount;
+        if (stream.GetLength() - stream.GetPosition() < 2 * sizeof(uint32))
+            break;
+        stream.ReadUint32(&hash);
+        stream.ReadInt32(&variantsCount);
+        const uint32 variantsSize = variantsCount * VariantSize;
+        if (variantsCount <= 0 || stream.GetLength() - stream.GetPosition() < variantsSize)
+            break;
+        States[hash].Set(stream.Move<byte>(variantsSize), variantsSize);
+    }
+    LOG(Info, "Loaded {0} pipeline states from manifest {1}", States.Count(), ManifestPath);
+}
+
+void GPUPipelineStateManifest::Dispose()
+{
+    ScopeLock lock(Locker);
+    if (Recording && Modified)
+    {
+        // Save manifest
+        MemoryWriteStream stream(1024 + States.Count() * (VariantSize + 8));
+        stream.WriteUint32(PSO_MANIFEST_MAGIC);
+        stream.WriteUint32(PSO_MANIFEST_VERSION);
+        stream.WriteUint32(VariantSize);
+        stream.WriteInt32(States.Count());
+        for (const auto& e : States)
+        {
+            stream.WriteUint32(e.Key);
+            stream.WriteInt32(e.Value.Count() / VariantSize);
+            stream.WriteBytes(e.Value.Get(), e.Value.Count());
+        }
+        if (File::WriteAllBytes(ManifestPath, stream.GetHandle(), stream.GetPosition()))
+            LOG(Warning, "Failed to save pipeline states manifest {0}", ManifestPath);
+        else
+            LOG(Info, "Saved {0} pipeline states to manifest {1}", States.Count(), ManifestPath);
+    }
+    States.Clear();
+    Modified = false;
+}
+
+bool GPUPipelineStateManifest::IsRecording()
+{
+    return Recording;
+}
+
+void GPUPipelineStateManifest::Record(uint32 stateHash, const void* variant)
+{
+    if (!Recording)
+        return;
+    ScopeLock lock(Locker);
+    Array<byte>& variants = States[stateHash];
+    for (int32 i = 0; i < variants.Count(); i += VariantSize)
+    {
+        if (Platform::MemoryCompare(variants.Get() + i, variant, VariantSize) == 0)
+            return;
+    }
+    variants.Add((const byte*)variant, VariantSize);
+    Modified = true;
+}
+
+bool GPUPipelineStateManifest::GetVariants(uint32 stateHash, Array<byte>& variants)
+{
+    ScopeLock lock(Locker);
+    const Array<byte>* e = States.TryGet(stateHash);
+    if (e && e->HasItems())
+    {
+        variants = *e;
+        return true;
+    }
+    return false;
+}
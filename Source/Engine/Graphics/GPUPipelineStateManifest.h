@@ -0,0 +1,49 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Collections/Array.h"
+
+/// <summary>
+/// The manifest of the pipeline state variants used by the game (eg. render targets formats used with each pipeline state). Gathered during playtests (with -recordpso command line switch) and used on the next game startup to precompile the pipelines in the background when pipeline states get created (to reduce the hitches on the first draw).
+/// </summary>
+/// <remarks>
+/// Pipeline states are identified with GPUPipelineState::GetHash. Variants are backend-specific keys (plain data of a fixed size).
+/// </remarks>
+class FLAXENGINE_API GPUPipelineStateManifest
+{
+public:
+    /// <summary>
+    /// Loads the manifest for the given graphics backend. Called by the graphics device during initialization.
+    /// </summary>
+    /// <param name="backendName">The graphics backend name (eg. DX12). Each backend has a separate manifest file.</param>
+    /// <param name="variantSize">The size (in bytes) of the pipeline state variant key.</param>
+    static void Init(const StringView& backendName, int32 variantSize);
+
+    /// <summary>
+    /// Saves the recorded manifest (if recording is enabled). Called by the graphics device on dispose.
+    /// </summary>
+    static void Dispose();
+
+    /// <summary>
+    /// Returns true if the used pipeline states are recorded into the manifest.
+    /// </summary>
+    static bool IsRecording();
+
+    /// <summary>
+    /// Records the pipeline state variant that has been used. Does nothing if recording is disabled.
+    /// </summary>
+    /// <param name="stateHash">The pipeline state hash.</param>
+    /// <param name="variant">The pipeline state variant key data (of size specified on init).</param>
+    static void Record(uint32 stateHash, const void* variant);
+
+    /// <summary>
+    /// Gets the recorded variants for the given pipeline state.
+    /// </summary>
+    /// <param name="stateHash">The pipeline state hash.</param>
+    /// <param name="variants">The output variant keys data (tightly packed).</param>
+    /// <returns>True if pipeline state has any recorded variants, otherwise false.</returns>
+    static bool GetVariants(uint32 stateHash, Array<byte>& variants);
+};
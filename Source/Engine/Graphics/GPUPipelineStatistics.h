@@ -0,0 +1,65 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The GPU pipeline statistics (shader invocations and primitives counts) gathered by the query between its Begin and End calls. Helps to tell if the rendering pass is geometry-bound (high vertex invocations per rasterized primitive), pixel-bound (high pixel shader invocations) or compute-bound.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API GPUPipelineStatistics
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(GPUPipelineStatistics);
+
+    /// <summary>
+    /// The amount of vertices read by the input assembler.
+    /// </summary>
+    API_FIELD() uint64 InputVertices;
+
+    /// <summary>
+    /// The amount of primitives read by the input assembler.
+    /// </summary>
+    API_FIELD() uint64 InputPrimitives;
+
+    /// <summary>
+    /// The amount of vertex shader invocations.
+    /// </summary>
+    API_FIELD() uint64 VSInvocations;
+
+    /// <summary>
+    /// The amount of geometry shader invocations.
+    /// </summary>
+    API_FIELD() uint64 GSInvocations;
+
+    /// <summary>
+    /// The amount of primitives sent to the rasterizer (after the clipping).
+    /// </summary>
+    API_FIELD() uint64 RasterizedPrimitives;
+
+    /// <summary>
+    /// The amount of pixel shader invocations.
+    /// </summary>
+    API_FIELD() uint64 PSInvocations;
+
+    /// <summary>
+    /// The amount of hull shader invocations.
+    /// </summary>
+    API_FIELD() uint64 HSInvocations;
+
+    /// <summary>
+    /// The amount of domain shader invocations.
+    /// </summary>
+    API_FIELD() uint64 DSInvocations;
+
+    /// <summary>
+    /// The amount of compute shader invocations.
+    /// </summary>
+    API_FIELD() uint64 CSInvocations;
+};
+
+template<>
+struct TIsPODType<GPUPipelineStatistics>
+{
+    enum { Value = true };
+};
@@ -205,4 +205,13 @@ API_CLASS(Abstract, NoSpawn, Attributes="HideInEditor") class FLAXENGINE_API GPU
     /// Gets the native pointer to the underlying view. It's a platform-specific handle.
     /// </summary>
     virtual void* GetNativePtr() const = 0;
+
+    /// <summary>
+    /// Gets the index of the shader resource view in the global bindless descriptors table (see GPULimits::HasBindless). The index can change when view gets recreated so it should be read when writing it to the shader constants.
+    /// </summary>
+    /// <returns>The bindless index or -1 if not supported.</returns>
+    virtual int32 GetBindlessIndex() const
+    {
+        return -1;
+    }
 };
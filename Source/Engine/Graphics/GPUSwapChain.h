@@ -118,6 +118,15 @@ class FLAXENGINE_API GPUSwapChain : public GPUResource
         return GetWidth() > 0 && (_window->IsVisible() || _window->_showAfterFirstPaint);
     }
 
+    /// <summary>
+    /// Checks if the back buffer can be presented from the render thread (see Graphics::EnableFramePipelining).
+    /// </summary>
+    /// <returns>True if can present the back buffer from the render thread, otherwise false (eg. window has to be shown after the first paint).</returns>
+    FORCE_INLINE bool CanPresentAsync() const
+    {
+        return !_window->_showAfterFirstPaint;
+    }
+
 public:
     /// <summary>
     /// Creates GPU async task that will gather render target data from the GPU.
@@ -147,6 +156,13 @@ class FLAXENGINE_API GPUSwapChain : public GPUResource
     /// <param name="vsync">True if use vertical synchronization to lock frame rate.</param>
     virtual void Present(bool vsync);
 
+    /// <summary>
+    /// Waits until the swap chain is ready to accept a new frame (limits the amount of queued frames when using the frame latency waitable object). Used by the low-latency frame pacing (see Time::LowLatencyMode) to sample the input as late as possible.
+    /// </summary>
+    virtual void WaitForFrameLatency()
+    {
+    }
+
     /// <summary>
     /// Resize output back buffer.
     /// </summary>
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "GPUResource.h"
+#include "GPUPipelineStatistics.h"
 
 /// <summary>
 /// Represents a GPU query that measures execution time of GPU operations.
@@ -19,6 +20,12 @@ class FLAXENGINE_API GPUTimerQuery : public GPUResource
     {
     }
 
+public:
+    /// <summary>
+    /// True if collect the pipeline statistics between Begin/End calls (if supported by the device, see GPULimits::HasPipelineStatistics). Has to be set before calling Begin.
+    /// </summary>
+    bool CollectPipelineStatistics = false;
+
 public:
     /// <summary>
     /// Starts the counter.
@@ -42,6 +49,16 @@ class FLAXENGINE_API GPUTimerQuery : public GPUResource
     /// <returns>The time in milliseconds.</returns>
     virtual float GetResult() = 0;
 
+    /// <summary>
+    /// Gets the pipeline statistics gathered between Begin/End calls. Valid only if query has result and was started with CollectPipelineStatistics enabled.
+    /// </summary>
+    /// <param name="result">The output statistics.</param>
+    /// <returns>True if got the data, otherwise false.</returns>
+    virtual bool GetPipelineStatistics(GPUPipelineStatistics& result)
+    {
+        return false;
+    }
+
 public:
     // [GPUResource]
     String ToString() const override
@@ -18,6 +18,16 @@ Quality Graphics::VolumetricFogQuality = Quality::High;
 Quality Graphics::ShadowsQuality = Quality::Medium;
 Quality Graphics::ShadowMapsQuality = Quality::Medium;
 bool Graphics::AllowCSMBlending = false;
+bool Graphics::EnableCachedShadowCascades = false;
+bool Graphics::EnableClusteredLighting = false;
+bool Graphics::EnableVariableRateShading = false;
+bool Graphics::EnableGPUDrivenRendering = false;
+bool Graphics::EnableOcclusionCulling = false;
+bool Graphics::EnableComputeSkinning = false;
+bool Graphics::EnableParallelDrawCalls = false;
+bool Graphics::EnableAsyncCompute = false;
+bool Graphics::EnableAutoInstancing = false;
+bool Graphics::EnableFramePipelining = false;
 Quality Graphics::GlobalSDFQuality = Quality::High;
 Quality Graphics::GIQuality = Quality::High;
 PostProcessSettings Graphics::PostProcessSettings;
@@ -66,6 +76,16 @@ void GraphicsSettings::Apply()
     Graphics::ShadowsQuality = ShadowsQuality;
     Graphics::ShadowMapsQuality = ShadowMapsQuality;
     Graphics::AllowCSMBlending = AllowCSMBlending;
+    Graphics::EnableCachedShadowCascades = EnableCachedShadowCascades;
+    Graphics::EnableClusteredLighting = EnableClusteredLighting;
+    Graphics::EnableVariableRateShading = EnableVariableRateShading;
+    Graphics::EnableGPUDrivenRendering = EnableGPUDrivenRendering;
+    Graphics::EnableOcclusionCulling = EnableOcclusionCulling;
+    Graphics::EnableComputeSkinning = EnableComputeSkinning;
+    Graphics::EnableParallelDrawCalls = EnableParallelDrawCalls;
+    Graphics::EnableAsyncCompute = EnableAsyncCompute;
+    Graphics::EnableAutoInstancing = EnableAutoInstancing;
+    Graphics::EnableFramePipelining = EnableFramePipelining;
     Graphics::GlobalSDFQuality = GlobalSDFQuality;
     Graphics::GIQuality = GIQuality;
     Graphics::PostProcessSettings = ::PostProcessSettings();
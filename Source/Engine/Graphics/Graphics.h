@@ -53,6 +53,56 @@ API_CLASS(Static) class FLAXENGINE_API Graphics
     /// </summary>
     API_FIELD() static bool AllowCSMBlending;
 
+    /// <summary>
+    /// Enables caching of the far directional light shadow cascades that are updated at a staggered rate (instead of every frame).
+    /// </summary>
+    API_FIELD() static bool EnableCachedShadowCascades;
+
+    /// <summary>
+    /// Enables clustered deferred lighting that draws all local lights without shadows in a single pass using the clustered lights grid (instead of a separate pass per light).
+    /// </summary>
+    API_FIELD() static bool EnableClusteredLighting;
+
+    /// <summary>
+    /// Enables Variable Rate Shading that reduces the pixel shading rate of the scene geometry in the screen areas with low contrast or fast motion (if supported by the graphics backend).
+    /// </summary>
+    API_FIELD() static bool EnableVariableRateShading;
+
+    /// <summary>
+    /// Enables GPU-driven rendering of the static models (culling and draw arguments generation on GPU with indirect drawing).
+    /// </summary>
+    API_FIELD() static bool EnableGPUDrivenRendering;
+
+    /// <summary>
+    /// Enables occlusion culling of the objects using the hierarchical depth buffer (HZB) from the previous frames.
+    /// </summary>
+    API_FIELD() static bool EnableOcclusionCulling;
+
+    /// <summary>
+    /// Enables skinning of the animated models with compute shaders (skinned vertices are cached and drawn as static geometry in all passes).
+    /// </summary>
+    API_FIELD() static bool EnableComputeSkinning;
+
+    /// <summary>
+    /// Enables recording of the large draw calls lists in parallel on the worker threads using the deferred GPU contexts (if supported by the graphics backend).
+    /// </summary>
+    API_FIELD() static bool EnableParallelDrawCalls;
+
+    /// <summary>
+    /// Enables executing some of the compute passes on the async compute queue to overlap with the graphics work (if supported by the graphics backend).
+    /// </summary>
+    API_FIELD() static bool EnableAsyncCompute;
+
+    /// <summary>
+    /// Enables automatic instancing of the static models that use the same model and materials (grouped into spatial clusters that are culled and drawn together).
+    /// </summary>
+    API_FIELD() static bool EnableAutoInstancing;
+
+    /// <summary>
+    /// Enables frame pipelining: the swap chains are presented on a dedicated render thread while the main thread proceeds with the next frame update. Hides the present (and vertical synchronization) wait time behind the game logic at the cost of up to one frame of additional latency.
+    /// </summary>
+    API_FIELD() static bool EnableFramePipelining;
+
     /// <summary>
     /// The Global SDF quality. Controls the volume texture resolution and amount of cascades to use.
     /// </summary>
@@ -24,6 +24,13 @@ DrawPass DecalMaterialShader::GetDrawModes() const
     return DrawPass::GBuffer;
 }
 
+bool DecalMaterialShader::CanUseInstancing(InstancingHandler& handler) const
+{
+    // Decals are batched by GBufferPass (instances data is written into the vertex buffer, draw calls handler is not used)
+    handler = { nullptr, nullptr, nullptr };
+    return _cache.OutsideInstanced != nullptr;
+}
+
 void DecalMaterialShader::Bind(BindParameters& params)
 {
     // Prepare
@@ -35,7 +42,8 @@ void DecalMaterialShader::Bind(BindParameters& params)
     auto materialData = reinterpret_cast<DecalMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DecalMaterialShaderData), cb.Length() - sizeof(DecalMaterialShaderData));
     int32 srv = 0;
-    const bool isCameraInside = OrientedBoundingBox(Vector3::Half, params.FirstDrawCall->World).Contains(view.Position) == ContainmentType::Contains;
+    const bool isInstanced = params.DrawCallsCount > 1;
+    const bool isCameraInside = !isInstanced && OrientedBoundingBox(Vector3::Half, params.FirstDrawCall->World).Contains(view.Position) == ContainmentType::Contains;
 
     // Setup parameters
     MaterialParameter::BindMeta bindMeta;
@@ -76,8 +84,8 @@ void DecalMaterialShader::Bind(BindParameters& params)
         context->BindCB(0, _cb);
     }
 
-    // Bind pipeline
-    context->SetState(isCameraInside ? _cache.Inside : _cache.Outside);
+    // Bind pipeline (instanced decals are drawn only when camera is outside their volume)
+    context->SetState(isInstanced ? _cache.OutsideInstanced : isCameraInside ? _cache.Inside : _cache.Outside);
 }
 
 void DecalMaterialShader::Unload()
@@ -151,5 +159,19 @@ bool DecalMaterialShader::Load()
         return true;
     }
 
+    // Instanced decals (optional, materials compiled with older templates don't have this permutation)
+    psDesc0.CullMode = CullMode::Normal;
+    psDesc0.VS = _shader->GetVS("VS_Decal", 1);
+    psDesc0.PS = _shader->GetPS("PS_Decal", 1);
+    if (psDesc0.VS && psDesc0.PS)
+    {
+        _cache.OutsideInstanced = GPUDevice::Instance->CreatePipelineState();
+        if (_cache.OutsideInstanced->Init(psDesc0))
+        {
+            LOG(Warning, "Failed to create decal material pipeline state.");
+            SAFE_DELETE_GPU_RESOURCE(_cache.OutsideInstanced);
+        }
+    }
+
     return false;
 }
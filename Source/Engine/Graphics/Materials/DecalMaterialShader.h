@@ -14,11 +14,13 @@ class DecalMaterialShader : public MaterialShader
     {
         GPUPipelineState* Inside = nullptr;
         GPUPipelineState* Outside = nullptr;
+        GPUPipelineState* OutsideInstanced = nullptr;
 
         FORCE_INLINE void Release()
         {
             SAFE_DELETE_GPU_RESOURCE(Inside);
             SAFE_DELETE_GPU_RESOURCE(Outside);
+            SAFE_DELETE_GPU_RESOURCE(OutsideInstanced);
         }
     };
 
@@ -38,6 +40,7 @@ class DecalMaterialShader : public MaterialShader
 public:
     // [MaterialShader]
     DrawPass GetDrawModes() const override;
+    bool CanUseInstancing(InstancingHandler& handler) const override;
     void Bind(BindParameters& params) override;
     void Unload() override;
 
@@ -19,11 +19,12 @@
 PACK_STRUCT(struct DeferredMaterialShaderData {
     Matrix WorldMatrix;
     Matrix PrevWorldMatrix;
-    Float2 Dummy0;
+    Float3 GeometryOrigin;
     float LODDitherFactor;
-    float PerInstanceRandom;
     Float3 GeometrySize;
     float WorldDeterminantSign;
+    float PerInstanceRandom;
+    Float3 Dummy0;
     });
 
 DrawPass DeferredMaterialShader::GetDrawModes() const
@@ -49,7 +50,9 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Array<byte, InlinedAllocation<1024>> cbDataLocal;
+    Span<byte> cb = GetCBData(context, cbDataLocal);
+    byte* cbData = cb.Get();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(DeferredMaterialShaderData));
     auto materialData = reinterpret_cast<DeferredMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(DeferredMaterialShaderData), cb.Length() - sizeof(DeferredMaterialShaderData));
@@ -76,6 +79,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
         materialData->LODDitherFactor = drawCall.Surface.LODDitherFactor;
         materialData->PerInstanceRandom = drawCall.PerInstanceRandom;
         materialData->GeometrySize = drawCall.Surface.GeometrySize;
+        materialData->GeometryOrigin = drawCall.Surface.GeometryOrigin;
     }
 
     // Check if is using mesh skinning
@@ -96,7 +100,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData);
         context->BindCB(0, _cb);
     }
 
@@ -116,7 +120,7 @@ void DeferredMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    const auto cache = drawCall.Surface.CompressedPositions ? (params.DrawCallsCount == 1 ? &_cacheCompressed : &_cacheCompressedInstanced) : (params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced);
     PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap, useSkinning, perBoneMotionBlur);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
@@ -132,18 +136,20 @@ void DeferredMaterialShader::Unload()
 
     _cache.Release();
     _cacheInstanced.Release();
+    _cacheCompressed.Release();
+    _cacheCompressedInstanced.Release();
 }
 
 bool DeferredMaterialShader::Load()
 {
     bool failed = false;
-    auto psDesc = GPUPipelineState::Description::Default;
-    psDesc.DepthWriteEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthWrite) == MaterialFeaturesFlags::None;
+    auto psDescBase = GPUPipelineState::Description::Default;
+    psDescBase.DepthWriteEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthWrite) == MaterialFeaturesFlags::None;
     if (EnumHasAnyFlags(_info.FeaturesFlags, MaterialFeaturesFlags::DisableDepthTest))
     {
-        psDesc.DepthFunc = ComparisonFunc::Always;
-        if (!psDesc.DepthWriteEnable)
-            psDesc.DepthEnable = false;
+        psDescBase.DepthFunc = ComparisonFunc::Always;
+        if (!psDescBase.DepthWriteEnable)
+            psDescBase.DepthEnable = false;
     }
 
 #if GPU_ALLOW_TESSELLATION_SHADERS
@@ -151,94 +157,115 @@ bool DeferredMaterialShader::Load()
     const bool useTess = _info.TessellationMode != TessellationMethod::None && GPUDevice::Instance->Limits.HasTessellation;
     if (useTess)
     {
-        psDesc.HS = _shader->GetHS("HS");
-        psDesc.DS = _shader->GetDS("DS");
+        psDescBase.HS = _shader->GetHS("HS");
+        psDescBase.DS = _shader->GetDS("DS");
     }
 #endif
 
-    // GBuffer Pass
-    psDesc.VS = _shader->GetVS("VS");
-    failed |= psDesc.VS == nullptr;
-    psDesc.PS = _shader->GetPS("PS_GBuffer");
-    _cache.Default.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS", 1);
-    failed |= psDesc.VS == nullptr;
-    _cacheInstanced.Default.Init(psDesc);
-
-    // GBuffer Pass with lightmap (pixel shader permutation for USE_LIGHTMAP=1)
-    psDesc.VS = _shader->GetVS("VS");
-    failed |= psDesc.VS == nullptr;
-    psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
-    _cache.DefaultLightmap.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS", 1);
-    failed |= psDesc.VS == nullptr;
-    _cacheInstanced.DefaultLightmap.Init(psDesc);
-
-    // GBuffer Pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
-    psDesc.PS = _shader->GetPS("PS_GBuffer");
-    _cache.DefaultSkinned.Init(psDesc);
+    // Vertex shader permutations are: USE_INSTANCING (+1) and USE_COMPRESSED_POSITIONS (+2), skinned meshes use full-precision positions only
+    for (int32 compressed = 0; compressed < 2; compressed++)
+    {
+        Cache& cache = compressed ? _cacheCompressed : _cache;
+        Cache& cacheInstanced = compressed ? _cacheCompressedInstanced : _cacheInstanced;
+        const int32 vs = compressed ? 2 : 0;
+        auto psDesc = psDescBase;
+
+        // GBuffer Pass
+        psDesc.VS = _shader->GetVS("VS", vs);
+        failed |= psDesc.VS == nullptr;
+        psDesc.PS = _shader->GetPS("PS_GBuffer");
+        cache.Default.Init(psDesc);
+        psDesc.VS = _shader->GetVS("VS", vs + 1);
+        failed |= psDesc.VS == nullptr;
+        cacheInstanced.Default.Init(psDesc);
+
+        // GBuffer Pass with lightmap (pixel shader permutation for USE_LIGHTMAP=1)
+        psDesc.VS = _shader->GetVS("VS", vs);
+        failed |= psDesc.VS == nullptr;
+        psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
+        cache.DefaultLightmap.Init(psDesc);
+        psDesc.VS = _shader->GetVS("VS", vs + 1);
+        failed |= psDesc.VS == nullptr;
+        cacheInstanced.DefaultLightmap.Init(psDesc);
+
+        // GBuffer Pass with skinning
+        if (!compressed)
+        {
+            psDesc.VS = _shader->GetVS("VS_Skinned");
+            psDesc.PS = _shader->GetPS("PS_GBuffer");
+            cache.DefaultSkinned.Init(psDesc);
+        }
 
 #if USE_EDITOR
-    if (_shader->HasShader("PS_QuadOverdraw"))
-    {
-        // Quad Overdraw
-        psDesc.VS = _shader->GetVS("VS");
-        psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS", 1);
-        _cacheInstanced.Depth.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.QuadOverdrawSkinned.Init(psDesc);
-    }
+        if (_shader->HasShader("PS_QuadOverdraw"))
+        {
+            // Quad Overdraw
+            psDesc.VS = _shader->GetVS("VS", vs);
+            psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
+            cache.QuadOverdraw.Init(psDesc);
+            psDesc.VS = _shader->GetVS("VS", vs + 1);
+            cacheInstanced.Depth.Init(psDesc);
+            if (!compressed)
+            {
+                psDesc.VS = _shader->GetVS("VS_Skinned");
+                cache.QuadOverdrawSkinned.Init(psDesc);
+            }
+        }
 #endif
 
-    // Motion Vectors pass
-    psDesc.DepthWriteEnable = false;
-    psDesc.DepthEnable = true;
-    psDesc.DepthFunc = ComparisonFunc::LessEqual;
-    psDesc.VS = _shader->GetVS("VS");
-    psDesc.PS = _shader->GetPS("PS_MotionVectors");
-    _cache.MotionVectors.Init(psDesc);
-
-    // Motion Vectors pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.MotionVectorsSkinned.Init(psDesc);
-
-    // Motion Vectors pass with skinning (with per-bone motion blur)
-    psDesc.VS = _shader->GetVS("VS_Skinned", 1);
-    _cache.MotionVectorsSkinnedPerBone.Init(psDesc);
-
-    // Depth Pass
-    psDesc.CullMode = CullMode::TwoSided;
-    psDesc.DepthClipEnable = false;
-    psDesc.DepthWriteEnable = true;
-    psDesc.DepthEnable = true;
-    psDesc.DepthFunc = ComparisonFunc::Less;
-    psDesc.HS = nullptr;
-    psDesc.DS = nullptr;
-    GPUShaderProgramVS* instancedDepthPassVS;
-    if (EnumHasAnyFlags(_info.UsageFlags, MaterialUsageFlags::UseMask | MaterialUsageFlags::UsePositionOffset))
-    {
-        // Materials with masking need full vertex buffer to get texcoord used to sample textures for per pixel masking.
-        // Materials with world pos offset need full VB to apply offset using texcoord etc.
-        psDesc.VS = _shader->GetVS("VS");
-        instancedDepthPassVS = _shader->GetVS("VS", 1);
-        psDesc.PS = _shader->GetPS("PS_Depth");
-    }
-    else
-    {
-        psDesc.VS = _shader->GetVS("VS_Depth");
-        instancedDepthPassVS = _shader->GetVS("VS_Depth", 1);
-        psDesc.PS = nullptr;
-    }
-    _cache.Depth.Init(psDesc);
-    psDesc.VS = instancedDepthPassVS;
-    _cacheInstanced.Depth.Init(psDesc);
+        // Motion Vectors pass
+        psDesc.DepthWriteEnable = false;
+        psDesc.DepthEnable = true;
+        psDesc.DepthFunc = ComparisonFunc::LessEqual;
+        psDesc.VS = _shader->GetVS("VS", vs);
+        psDesc.PS = _shader->GetPS("PS_MotionVectors");
+        cache.MotionVectors.Init(psDesc);
+
+        if (!compressed)
+        {
+            // Motion Vectors pass with skinning
+            psDesc.VS = _shader->GetVS("VS_Skinned");
+            cache.MotionVectorsSkinned.Init(psDesc);
+
+            // Motion Vectors pass with skinning (with per-bone motion blur)
+            psDesc.VS = _shader->GetVS("VS_Skinned", 1);
+            cache.MotionVectorsSkinnedPerBone.Init(psDesc);
+        }
+
+        // Depth Pass
+        psDesc.CullMode = CullMode::TwoSided;
+        psDesc.DepthClipEnable = false;
+        psDesc.DepthWriteEnable = true;
+        psDesc.DepthEnable = true;
+        psDesc.DepthFunc = ComparisonFunc::Less;
+        psDesc.HS = nullptr;
+        psDesc.DS = nullptr;
+        GPUShaderProgramVS* instancedDepthPassVS;
+        if (EnumHasAnyFlags(_info.UsageFlags, MaterialUsageFlags::UseMask | MaterialUsageFlags::UsePositionOffset))
+        {
+            // Materials with masking need full vertex buffer to get texcoord used to sample textures for per pixel masking.
+            // Materials with world pos offset need full VB to apply offset using texcoord etc.
+            psDesc.VS = _shader->GetVS("VS", vs);
+            instancedDepthPassVS = _shader->GetVS("VS", vs + 1);
+            psDesc.PS = _shader->GetPS("PS_Depth");
+        }
+        else
+        {
+            psDesc.VS = _shader->GetVS("VS_Depth", vs);
+            instancedDepthPassVS = _shader->GetVS("VS_Depth", vs + 1);
+            psDesc.PS = nullptr;
+        }
+        cache.Depth.Init(psDesc);
+        psDesc.VS = instancedDepthPassVS;
+        cacheInstanced.Depth.Init(psDesc);
 
-    // Depth Pass with skinning
-    psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DepthSkinned.Init(psDesc);
+        // Depth Pass with skinning
+        if (!compressed)
+        {
+            psDesc.VS = _shader->GetVS("VS_Skinned");
+            cache.DepthSkinned.Init(psDesc);
+        }
+    }
 
     return failed;
 }
@@ -20,11 +20,12 @@
 PACK_STRUCT(struct ForwardMaterialShaderData {
     Matrix WorldMatrix;
     Matrix PrevWorldMatrix;
-    Float2 Dummy0;
+    Float3 GeometryOrigin;
     float LODDitherFactor;
-    float PerInstanceRandom;
     Float3 GeometrySize;
     float WorldDeterminantSign;
+    float PerInstanceRandom;
+    Float3 Dummy0;
     });
 
 DrawPass ForwardMaterialShader::GetDrawModes() const
@@ -86,6 +87,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
         materialData->LODDitherFactor = drawCall.Surface.LODDitherFactor;
         materialData->PerInstanceRandom = drawCall.PerInstanceRandom;
         materialData->GeometrySize = drawCall.Surface.GeometrySize;
+        materialData->GeometryOrigin = drawCall.Surface.GeometryOrigin;
     }
 
     // Bind constants
@@ -111,7 +113,7 @@ void ForwardMaterialShader::Bind(BindParameters& params)
             cullMode = CullMode::Normal;
     }
     ASSERT_LOW_LAYER(!(useSkinning && params.DrawCallsCount > 1)); // No support for instancing skinned meshes
-    const auto cacheObj = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    const auto cacheObj = drawCall.Surface.CompressedPositions ? (params.DrawCallsCount == 1 ? &_cacheCompressed : &_cacheCompressedInstanced) : (params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced);
     PipelineStateCache* psCache = cacheObj->GetPS(view.Pass, useSkinning);
     ASSERT(psCache);
     GPUPipelineState* state = psCache->GetPS(cullMode, wireframe);
@@ -127,98 +129,121 @@ void ForwardMaterialShader::Unload()
 
     _cache.Release();
     _cacheInstanced.Release();
+    _cacheCompressed.Release();
+    _cacheCompressedInstanced.Release();
 }
 
 bool ForwardMaterialShader::Load()
 {
     _drawModes = DrawPass::Depth | DrawPass::Forward | DrawPass::QuadOverdraw;
 
-    auto psDesc = GPUPipelineState::Description::Default;
-    psDesc.DepthEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthTest) == MaterialFeaturesFlags::None;
-    psDesc.DepthWriteEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthWrite) == MaterialFeaturesFlags::None;
+    auto psDescBase = GPUPipelineState::Description::Default;
+    psDescBase.DepthEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthTest) == MaterialFeaturesFlags::None;
+    psDescBase.DepthWriteEnable = (_info.FeaturesFlags & MaterialFeaturesFlags::DisableDepthWrite) == MaterialFeaturesFlags::None;
 
 #if GPU_ALLOW_TESSELLATION_SHADERS
     // Check if use tessellation (both material and runtime supports it)
     const bool useTess = _info.TessellationMode != TessellationMethod::None && GPUDevice::Instance->Limits.HasTessellation;
     if (useTess)
     {
-        psDesc.HS = _shader->GetHS("HS");
-        psDesc.DS = _shader->GetDS("DS");
+        psDescBase.HS = _shader->GetHS("HS");
+        psDescBase.DS = _shader->GetDS("DS");
     }
 #endif
 
-#if USE_EDITOR
-    if (_shader->HasShader("PS_QuadOverdraw"))
+    // Vertex shader permutations are: USE_INSTANCING (+1) and USE_COMPRESSED_POSITIONS (+2), skinned meshes use full-precision positions only
+    for (int32 compressed = 0; compressed < 2; compressed++)
     {
-        // Quad Overdraw
-        psDesc.VS = _shader->GetVS("VS");
-        psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
-        _cache.QuadOverdraw.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS", 1);
-        _cacheInstanced.Depth.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.QuadOverdrawSkinned.Init(psDesc);
-    }
-#endif
+        Cache& cache = compressed ? _cacheCompressed : _cache;
+        Cache& cacheInstanced = compressed ? _cacheCompressedInstanced : _cacheInstanced;
+        const int32 vs = compressed ? 2 : 0;
+        auto psDesc = psDescBase;
 
-    // Check if use transparent distortion pass
-    if (_shader->HasShader("PS_Distortion"))
-    {
-        _drawModes |= DrawPass::Distortion;
+#if USE_EDITOR
+        if (_shader->HasShader("PS_QuadOverdraw"))
+        {
+            // Quad Overdraw
+            psDesc.VS = _shader->GetVS("VS", vs);
+            psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
+            cache.QuadOverdraw.Init(psDesc);
+            psDesc.VS = _shader->GetVS("VS", vs + 1);
+            cacheInstanced.Depth.Init(psDesc);
+            if (!compressed)
+            {
+                psDesc.VS = _shader->GetVS("VS_Skinned");
+                cache.QuadOverdrawSkinned.Init(psDesc);
+            }
+        }
+#endif
 
-        // Accumulate Distortion Pass
-        psDesc.VS = _shader->GetVS("VS");
-        psDesc.PS = _shader->GetPS("PS_Distortion");
-        psDesc.BlendMode = BlendingMode::Add;
+        // Check if use transparent distortion pass
+        if (_shader->HasShader("PS_Distortion"))
+        {
+            _drawModes |= DrawPass::Distortion;
+
+            // Accumulate Distortion Pass
+            psDesc.VS = _shader->GetVS("VS", vs);
+            psDesc.PS = _shader->GetPS("PS_Distortion");
+            psDesc.BlendMode = BlendingMode::Add;
+            psDesc.DepthWriteEnable = false;
+            cache.Distortion.Init(psDesc);
+            //psDesc.VS = _shader->GetVS("VS", vs + 1);
+            //cacheInstanced.Distortion.Init(psDesc);
+            if (!compressed)
+            {
+                psDesc.VS = _shader->GetVS("VS_Skinned");
+                cache.DistortionSkinned.Init(psDesc);
+            }
+        }
+
+        // Forward Pass
+        psDesc.VS = _shader->GetVS("VS", vs);
+        if (psDesc.VS == nullptr)
+            return true;
+        psDesc.PS = _shader->GetPS("PS_Forward");
         psDesc.DepthWriteEnable = false;
-        _cache.Distortion.Init(psDesc);
-        //psDesc.VS = _shader->GetVS("VS", 1);
-        //_cacheInstanced.Distortion.Init(psDesc);
-        psDesc.VS = _shader->GetVS("VS_Skinned");
-        _cache.DistortionSkinned.Init(psDesc);
-    }
-
-    // Forward Pass
-    psDesc.VS = _shader->GetVS("VS");
-    if (psDesc.VS == nullptr)
-        return true;
-    psDesc.PS = _shader->GetPS("PS_Forward");
-    psDesc.DepthWriteEnable = false;
-    psDesc.BlendMode = BlendingMode::AlphaBlend;
-    switch (_info.BlendMode)
-    {
-    case MaterialBlendMode::Transparent:
         psDesc.BlendMode = BlendingMode::AlphaBlend;
-        break;
-    case MaterialBlendMode::Additive:
-        psDesc.BlendMode = BlendingMode::Additive;
-        break;
-    case MaterialBlendMode::Multiply:
-        psDesc.BlendMode = BlendingMode::Multiply;
-        break;
+        switch (_info.BlendMode)
+        {
+        case MaterialBlendMode::Transparent:
+            psDesc.BlendMode = BlendingMode::AlphaBlend;
+            break;
+        case MaterialBlendMode::Additive:
+            psDesc.BlendMode = BlendingMode::Additive;
+            break;
+        case MaterialBlendMode::Multiply:
+            psDesc.BlendMode = BlendingMode::Multiply;
+            break;
+        }
+        cache.Default.Init(psDesc);
+        //psDesc.VS = _shader->GetVS("VS", vs + 1);
+        //cacheInstanced.Default.Init(psDesc);
+        if (!compressed)
+        {
+            psDesc.VS = _shader->GetVS("VS_Skinned");
+            cache.DefaultSkinned.Init(psDesc);
+        }
+
+        // Depth Pass
+        psDesc = GPUPipelineState::Description::Default;
+        psDesc.CullMode = CullMode::TwoSided;
+        psDesc.DepthClipEnable = false;
+        psDesc.DepthWriteEnable = true;
+        psDesc.DepthEnable = true;
+        psDesc.DepthFunc = ComparisonFunc::Less;
+        psDesc.HS = nullptr;
+        psDesc.DS = nullptr;
+        psDesc.VS = _shader->GetVS("VS", vs);
+        psDesc.PS = _shader->GetPS("PS_Depth");
+        cache.Depth.Init(psDesc);
+        psDesc.VS = _shader->GetVS("VS", vs + 1);
+        cacheInstanced.Depth.Init(psDesc);
+        if (!compressed)
+        {
+            psDesc.VS = _shader->GetVS("VS_Skinned");
+            cache.DepthSkinned.Init(psDesc);
+        }
     }
-    _cache.Default.Init(psDesc);
-    //psDesc.VS = _shader->GetVS("VS", 1);
-    //_cacheInstanced.Default.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DefaultSkinned.Init(psDesc);
-
-    // Depth Pass
-    psDesc = GPUPipelineState::Description::Default;
-    psDesc.CullMode = CullMode::TwoSided;
-    psDesc.DepthClipEnable = false;
-    psDesc.DepthWriteEnable = true;
-    psDesc.DepthEnable = true;
-    psDesc.DepthFunc = ComparisonFunc::Less;
-    psDesc.HS = nullptr;
-    psDesc.DS = nullptr;
-    psDesc.VS = _shader->GetVS("VS");
-    psDesc.PS = _shader->GetPS("PS_Depth");
-    _cache.Depth.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS", 1);
-    _cacheInstanced.Depth.Init(psDesc);
-    psDesc.VS = _shader->GetVS("VS_Skinned");
-    _cache.DepthSkinned.Init(psDesc);
 
     return false;
 }
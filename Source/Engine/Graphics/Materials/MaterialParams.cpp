@@ -14,6 +14,7 @@
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #include "Engine/Scripting/Enums.h"
 #include "Engine/Streaming/Streaming.h"
+#include "Engine/Threading/Threading.h"
 
 bool MaterialInfo8::operator==(const MaterialInfo8& other) const
 {
@@ -166,6 +167,12 @@ Variant MaterialParameter::GetValue() const
     }
 }
 
+void MaterialParameter::SetIsOverride(bool value)
+{
+    _override = value;
+    MaterialParams::InvalidateBindCache();
+}
+
 void MaterialParameter::SetValue(const Variant& value)
 {
     bool invalidType = false;
@@ -275,6 +282,7 @@ void MaterialParameter::SetValue(const Variant& value)
     {
         LOG(Error, "Invalid material parameter value type {0} to set (param type: {1})", value.Type, ScriptingEnum::ToString(_type));
     }
+    MaterialParams::InvalidateBindCache();
 }
 
 void MaterialParameter::Bind(BindMeta& meta) const
@@ -594,19 +602,128 @@ int32 MaterialParams::GetVersionHash() const
     return _versionHash;
 }
 
-void MaterialParams::Bind(MaterialParamsLink* link, MaterialParameter::BindMeta& meta)
+namespace
 {
-    ASSERT(link && link->This);
-    for (int32 i = 0; i < link->This->Count(); i++)
+    // Incremented on every parameters modification to invalidate all bind caches (parameters are modified rarely compared to binding them for every draw)
+    int64 BindCacheVersion = 0;
+    CriticalSection BindCacheLocker;
+
+    // Gets the size of the parameter data in the constant buffer, returns 0 for parameters that need to be bound for every draw (resources or values that change dynamically)
+    int32 GetConstantSize(const MaterialParameter& param)
+    {
+        switch (param.GetParameterType())
+        {
+        case MaterialParameterType::Bool:
+        case MaterialParameterType::Integer:
+        case MaterialParameterType::Float:
+            return sizeof(int32);
+        case MaterialParameterType::Vector2:
+            return sizeof(Float2);
+        case MaterialParameterType::Vector3:
+            return sizeof(Float3);
+        case MaterialParameterType::Vector4:
+        case MaterialParameterType::Color:
+        case MaterialParameterType::ChannelMask:
+            return sizeof(Float4);
+        case MaterialParameterType::Matrix:
+            return sizeof(Matrix);
+        default:
+            return 0;
+        }
+    }
+
+    FORCE_INLINE const MaterialParameter& ResolveParameter(MaterialParamsLink* link, int32 index)
     {
         MaterialParamsLink* l = link;
-        while (l->Down && !l->This->At(i).IsOverride())
+        while (l->Down && !l->This->At(index).IsOverride())
         {
             l = l->Down;
         }
+        return l->This->At(index);
+    }
+}
+
+void MaterialParams::Bind(MaterialParamsLink* link, MaterialParameter::BindMeta& meta)
+{
+    ASSERT(link && link->This);
+    BindCache& cache = link->This->_bindCache;
+
+    // Rebuild cache when any parameters were modified (baked constants and the list of parameters to bind dynamically)
+    const int64 version = Platform::AtomicRead(&BindCacheVersion);
+    if (Platform::AtomicRead(&cache.Version) != version)
+    {
+        ScopeLock lock(BindCacheLocker);
+        if (cache.Version != version)
+        {
+            PROFILE_CPU_NAMED("Build Material Params Cache");
+            cache.Chain.Clear();
+            for (MaterialParamsLink* l = link; l; l = l->Down)
+                cache.Chain.Add(l->This);
+            cache.Dynamic.Clear();
+            cache.ConstantsStart = MAX_int32;
+            cache.ConstantsEnd = 0;
+            const int32 count = link->This->Count();
+            for (int32 i = 0; i < count; i++)
+            {
+                const MaterialParameter& param = ResolveParameter(link, i);
+                const int32 size = GetConstantSize(param);
+                if (size == 0)
+                {
+                    cache.Dynamic.Add(&param);
+                    continue;
+                }
+                cache.ConstantsStart = Math::Min<int32>(cache.ConstantsStart, param.GetBindOffset());
+                cache.ConstantsEnd = Math::Max<int32>(cache.ConstantsEnd, param.GetBindOffset() + size);
+            }
+            if (cache.ConstantsEnd == 0)
+                cache.ConstantsStart = 0;
+            cache.Constants.Resize(cache.ConstantsEnd, false);
+            Platform::MemoryClear(cache.Constants.Get(), cache.Constants.Count());
+            MaterialParameter::BindMeta bakeMeta;
+            bakeMeta.Context = nullptr;
+            bakeMeta.Constants = ToSpan(cache.Constants);
+            bakeMeta.Input = nullptr;
+            bakeMeta.Buffers = nullptr;
+            bakeMeta.CanSampleDepth = false;
+            bakeMeta.CanSampleGBuffer = false;
+            for (int32 i = 0; i < count; i++)
+            {
+                const MaterialParameter& param = ResolveParameter(link, i);
+                if (GetConstantSize(param) != 0)
+                    param.Bind(bakeMeta);
+            }
+            Platform::AtomicStore(&cache.Version, version);
+        }
+    }
+
+    // Validate that cache was created for the same parameters link chain (eg. material instance bound as a base of the other instance)
+    bool validChain = true;
+    {
+        int32 chainIndex = 0;
+        for (MaterialParamsLink* l = link; l && validChain; l = l->Down, chainIndex++)
+            validChain = chainIndex < cache.Chain.Count() && cache.Chain.Get()[chainIndex] == l->This;
+        validChain &= chainIndex == cache.Chain.Count();
+    }
+    if (!validChain)
+    {
+        for (int32 i = 0; i < link->This->Count(); i++)
+            ResolveParameter(link, i).Bind(meta);
+        return;
+    }
 
-        l->This->At(i).Bind(meta);
+    // Copy baked constants and bind the other parameters
+    if (cache.ConstantsEnd > cache.ConstantsStart)
+    {
+        ASSERT_LOW_LAYER(meta.Constants.Get() && meta.Constants.Length() >= cache.ConstantsEnd);
+        Platform::MemoryCopy(meta.Constants.Get() + cache.ConstantsStart, cache.Constants.Get() + cache.ConstantsStart, cache.ConstantsEnd - cache.ConstantsStart);
     }
+    for (const MaterialParameter* param : cache.Dynamic)
+        param->Bind(meta);
+}
+
+void MaterialParams::InvalidateBindCache()
+{
+    Platform::InterlockedIncrement(&BindCacheVersion);
 }
 
 void MaterialParams::Clone(MaterialParams& result)
@@ -621,12 +738,14 @@ void MaterialParams::Clone(MaterialParams& result)
     }
 
     result._versionHash = _versionHash;
+    InvalidateBindCache();
 }
 
 void MaterialParams::Dispose()
 {
     Resize(0);
     _versionHash = 0;
+    InvalidateBindCache();
 }
 
 bool MaterialParams::Load(ReadStream* stream)
@@ -1069,7 +1188,27 @@ bool MaterialParams::HasContentLoaded() const
     return result;
 }
 
+void MaterialParams::ReportStreamingFeedback(float size) const
+{
+    for (int32 i = 0; i < Count(); i++)
+    {
+        const MaterialParameter& param = At(i);
+        switch (param._type)
+        {
+        case MaterialParameterType::NormalMap:
+        case MaterialParameterType::Texture:
+        case MaterialParameterType::CubeTexture:
+            if (param._asAsset)
+                ((TextureBase*)param._asAsset.Get())->StreamingTexture()->ReportFeedback(size);
+            break;
+        default:
+            break;
+        }
+    }
+}
+
 void MaterialParams::UpdateHash()
 {
     _versionHash = rand();
+    InvalidateBindCache();
 }
@@ -259,10 +259,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API MaterialParameter : public ScriptingObje
     /// <summary>
     /// Sets the value override mode.
     /// </summary>
-    API_PROPERTY() void SetIsOverride(bool value)
-    {
-        _override = value;
-    }
+    API_PROPERTY() void SetIsOverride(bool value);
 
     /// <summary>
     /// Gets the parameter resource graphics pipeline binding register index.
@@ -355,7 +352,19 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
 {
     friend MaterialInstance;
 private:
+    // The parameters resolved for binding via the link chain starting at this collection (rebuilt after any parameters modification).
+    struct BindCache
+    {
+        int64 Version = -1;
+        int32 ConstantsStart = 0;
+        int32 ConstantsEnd = 0;
+        Array<const MaterialParams*, InlinedAllocation<4>> Chain;
+        Array<byte> Constants;
+        Array<const MaterialParameter*> Dynamic;
+    };
+
     int32 _versionHash = 0;
+    BindCache _bindCache;
 
 public:
     MaterialParameter* Get(const Guid& id);
@@ -377,6 +386,11 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
     /// <param name="meta">The bind meta.</param>
     static void Bind(MaterialParamsLink* link, MaterialParameter::BindMeta& meta);
 
+    /// <summary>
+    /// Invalidates the cached parameters bindings (constants baked per parameters link chain). Called automatically when modifying the parameters.
+    /// </summary>
+    static void InvalidateBindCache();
+
     /// <summary>
     /// Clones the parameters list.
     /// </summary>
@@ -428,6 +442,12 @@ class FLAXENGINE_API MaterialParams : public Array<MaterialParameter>
 
     bool HasContentLoaded() const;
 
+    /// <summary>
+    /// Reports the rendering feedback to the streaming of the textures used by the parameters (see StreamingTexture::ReportFeedback).
+    /// </summary>
+    /// <param name="size">The size of the geometry on the screen (in pixels).</param>
+    void ReportStreamingFeedback(float size) const;
+
 private:
     void UpdateHash();
 };
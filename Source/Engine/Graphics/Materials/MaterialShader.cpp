@@ -10,6 +10,7 @@
 #include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Threading/Threading.h"
 #include "DecalMaterialShader.h"
 #include "PostFxMaterialShader.h"
 #include "ForwardMaterialShader.h"
@@ -93,12 +94,23 @@ void IMaterial::BindParameters::BindViewData()
     GPUContext->BindCB(1, PerViewConstants);
 }
 
+namespace
+{
+    // Draw calls can be recorded in parallel (with deferred GPU contexts) so pipeline states creation is synchronized
+    CriticalSection PipelineStateCacheLocker;
+}
+
 GPUPipelineState* MaterialShader::PipelineStateCache::InitPS(CullMode mode, bool wireframe)
 {
+    ScopeLock lock(PipelineStateCacheLocker);
+    const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
+    if (PS[index])
+        return PS[index];
     Desc.CullMode = mode;
     Desc.Wireframe = wireframe;
     auto ps = GPUDevice::Instance->CreatePipelineState();
     ps->Init(Desc);
+    PS[index] = ps;
     return ps;
 }
 
@@ -244,6 +256,14 @@ bool MaterialShader::Load(MemoryReadStream& shaderCacheStream, const MaterialInf
     return false;
 }
 
+Span<byte> MaterialShader::GetCBData(const GPUContext* context, Array<byte, InlinedAllocation<1024>>& local)
+{
+    if (!context->IsDeferred())
+        return Span<byte>(_cbData.Get(), _cbData.Count());
+    local.Set(_cbData.Get(), _cbData.Count());
+    return Span<byte>(local.Get(), local.Count());
+}
+
 void MaterialShader::Unload()
 {
     _isLoaded = false;
@@ -10,7 +10,7 @@
 /// <summary>
 /// Current materials shader version.
 /// </summary>
-#define MATERIAL_GRAPH_VERSION 163
+#define MATERIAL_GRAPH_VERSION 168
 
 class Material;
 class GPUShader;
@@ -43,7 +43,7 @@ class MaterialShader : public IMaterial
             const int32 index = static_cast<int32>(mode) + (wireframe ? 3 : 0);
             auto ps = PS[index];
             if (!ps)
-                PS[index] = ps = InitPS(mode, wireframe);
+                ps = InitPS(mode, wireframe);
             return ps;
         }
 
@@ -102,6 +102,9 @@ class MaterialShader : public IMaterial
     bool Load(MemoryReadStream& shaderCacheStream, const MaterialInfo& info);
     virtual bool Load() = 0;
 
+    // Gets the constants buffer data to write during binding. Deferred contexts (recording draw calls in parallel) write to the local copy of the data.
+    Span<byte> GetCBData(const GPUContext* context, Array<byte, InlinedAllocation<1024>>& local);
+
 public:
     // [IMaterial]
     const MaterialInfo& GetInfo() const override;
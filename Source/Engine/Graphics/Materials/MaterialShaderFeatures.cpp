@@ -4,6 +4,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ForwardPass.h"
 #include "Engine/Renderer/ShadowsPass.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
 #if USE_EDITOR
@@ -23,6 +24,9 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
     const int32 envProbeShaderRegisterIndex = srv + 0;
     const int32 skyLightShaderRegisterIndex = srv + 1;
     const int32 dirLightShaderRegisterIndex = srv + 2;
+    const int32 lightGridLightsShaderRegisterIndex = srv + 3;
+    const int32 lightGridCellsShaderRegisterIndex = srv + 4;
+    const int32 lightGridIndicesShaderRegisterIndex = srv + 5;
     const bool canUseShadow = view.Pass != DrawPass::Depth;
 
     // Set fog input
@@ -98,26 +102,43 @@ void ForwardShadingFeature::Bind(MaterialShader::BindParameters& params, Span<by
         params.GPUContext->UnBindSR(envProbeShaderRegisterIndex);
     }
 
-    // Set local lights
+    // Set local lights (use clustered lights grid if available, otherwise pick a few lights affecting the object)
     data.LocalLightsCount = 0;
-    const BoundingSphere objectBounds(drawCall.ObjectPosition, drawCall.ObjectRadius);
-    // TODO: optimize lights searching for a transparent material - use spatial cache for renderer to find it
-    for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    const auto lightGrid = ForwardPass::Instance()->GetLightGrid(params.RenderContext);
+    if (lightGrid)
     {
-        const auto& light = cache->PointLights[i];
-        if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
-        {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
-        }
+        data.LightGridSize = lightGrid->Size;
+        data.LightGridEnabled = 1;
+        data.LightGridParams = lightGrid->Params;
+        params.GPUContext->BindSR(lightGridLightsShaderRegisterIndex, lightGrid->Lights->View());
+        params.GPUContext->BindSR(lightGridCellsShaderRegisterIndex, lightGrid->Cells->View());
+        params.GPUContext->BindSR(lightGridIndicesShaderRegisterIndex, lightGrid->Indices->View());
     }
-    for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+    else
     {
-        const auto& light = cache->SpotLights[i];
-        if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+        data.LightGridEnabled = 0;
+        params.GPUContext->UnBindSR(lightGridLightsShaderRegisterIndex);
+        params.GPUContext->UnBindSR(lightGridCellsShaderRegisterIndex);
+        params.GPUContext->UnBindSR(lightGridIndicesShaderRegisterIndex);
+        const BoundingSphere objectBounds(drawCall.ObjectPosition, drawCall.ObjectRadius);
+        // TODO: optimize lights searching for a transparent material - use spatial cache for renderer to find it
+        for (int32 i = 0; i < cache->PointLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
         {
-            light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
-            data.LocalLightsCount++;
+            const auto& light = cache->PointLights[i];
+            if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
+        }
+        for (int32 i = 0; i < cache->SpotLights.Count() && data.LocalLightsCount < MaxLocalLights; i++)
+        {
+            const auto& light = cache->SpotLights[i];
+            if (CollisionsHelper::SphereIntersectsSphere(objectBounds, BoundingSphere(light.Position, light.Radius)))
+            {
+                light.SetupLightData(&data.LocalLights[data.LocalLightsCount], false);
+                data.LocalLightsCount++;
+            }
         }
     }
 
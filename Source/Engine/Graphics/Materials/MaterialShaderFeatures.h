@@ -25,7 +25,7 @@ struct ForwardShadingFeature : MaterialShaderFeature
 {
     enum { MaxLocalLights = 4 };
 
-    enum { SRVs = 3 };
+    enum { SRVs = 6 };
 
     PACK_STRUCT(struct Data
         {
@@ -37,6 +37,9 @@ struct ForwardShadingFeature : MaterialShaderFeature
         Float3 Dummy2;
         uint32 LocalLightsCount;
         LightData LocalLights[MaxLocalLights];
+        Int3 LightGridSize;
+        uint32 LightGridEnabled;
+        Float4 LightGridParams;
         });
 
     static void Bind(MaterialShader::BindParameters& params, Span<byte>& cb, int32& srv);
@@ -45,7 +45,9 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     auto context = params.GPUContext;
     auto& view = params.RenderContext.View;
     auto& drawCall = *params.FirstDrawCall;
-    Span<byte> cb(_cbData.Get(), _cbData.Count());
+    Array<byte, InlinedAllocation<1024>> cbDataLocal;
+    Span<byte> cb = GetCBData(context, cbDataLocal);
+    byte* cbData = cb.Get();
     ASSERT_LOW_LAYER(cb.Length() >= sizeof(TerrainMaterialShaderData));
     auto materialData = reinterpret_cast<TerrainMaterialShaderData*>(cb.Get());
     cb = Span<byte>(cb.Get() + sizeof(TerrainMaterialShaderData), cb.Length() - sizeof(TerrainMaterialShaderData));
@@ -95,7 +97,7 @@ void TerrainMaterialShader::Bind(BindParameters& params)
     // Bind constants
     if (_cb)
     {
-        context->UpdateCB(_cb, _cbData.Get());
+        context->UpdateCB(_cb, cbData);
         context->BindCB(0, _cb);
     }
 
@@ -114,7 +116,9 @@ void TerrainMaterialShader::Bind(BindParameters& params)
         else
             cullMode = CullMode::Normal;
     }
-    const PipelineStateCache* psCache = _cache.GetPS(view.Pass, useLightmap);
+    // Instanced draws use the chunks culled on GPU (see TerrainCullingPass)
+    const auto cache = params.DrawCallsCount == 1 ? &_cache : &_cacheInstanced;
+    const PipelineStateCache* psCache = cache->GetPS(view.Pass, useLightmap);
     ASSERT(psCache);
     GPUPipelineState* state = ((PipelineStateCache*)psCache)->GetPS(cullMode, wireframe);
 
@@ -128,6 +132,7 @@ void TerrainMaterialShader::Unload()
     MaterialShader::Unload();
 
     _cache.Release();
+    _cacheInstanced.Release();
 }
 
 bool TerrainMaterialShader::Load()
@@ -165,17 +170,25 @@ bool TerrainMaterialShader::Load()
     psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_GBuffer");
     _cache.Default.Init(psDesc);
+    psDesc.VS = _shader->GetVS("VS", 1);
+    _cacheInstanced.Default.Init(psDesc);
 
     // GBuffer Pass with lightmap (use pixel shader permutation for USE_LIGHTMAP=1)
+    psDesc.VS = _shader->GetVS("VS");
     psDesc.PS = _shader->GetPS("PS_GBuffer", 1);
     _cache.DefaultLightmap.Init(psDesc);
+    psDesc.VS = _shader->GetVS("VS", 1);
+    _cacheInstanced.DefaultLightmap.Init(psDesc);
 
 #if USE_EDITOR
     if (_shader->HasShader("PS_QuadOverdraw"))
     {
         // Quad Overdraw
+        psDesc.VS = _shader->GetVS("VS");
         psDesc.PS = _shader->GetPS("PS_QuadOverdraw");
         _cache.QuadOverdraw.Init(psDesc);
+        psDesc.VS = _shader->GetVS("VS", 1);
+        _cacheInstanced.QuadOverdraw.Init(psDesc);
     }
 #endif
 
@@ -190,7 +203,10 @@ bool TerrainMaterialShader::Load()
     psDesc.DS = nullptr;
     // TODO: masked terrain materials (depth pass should clip holes)
     psDesc.PS = nullptr;
+    psDesc.VS = _shader->GetVS("VS");
     _cache.Depth.Init(psDesc);
+    psDesc.VS = _shader->GetVS("VS", 1);
+    _cacheInstanced.Depth.Init(psDesc);
 
     return false;
 }
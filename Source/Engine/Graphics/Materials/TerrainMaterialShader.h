@@ -51,6 +51,7 @@ class TerrainMaterialShader : public MaterialShader
 
 private:
     Cache _cache;
+    Cache _cacheInstanced;
 
 public:
     /// <summary>
@@ -13,6 +13,13 @@
 // Maximum amount of meshes per model LOD
 #define MODEL_MAX_MESHES 4096
 
+// The maximum amount of vertices and triangles per meshlet (cluster of mesh triangles used for GPU culling)
+#define MODEL_MESHLET_MAX_VERTICES 64
+#define MODEL_MESHLET_MAX_TRIANGLES 124
+
+// The minimum amount of mesh triangles to build meshlets for it (smaller meshes are culled only per-instance)
+#define MODEL_MESHLET_MIN_TRIANGLES 4096
+
 // Enable/disable precise mesh collision testing (with in-build vertex buffer caching, this will increase memory usage)
 #define USE_PRECISE_MESH_INTERSECTS (USE_EDITOR)
 
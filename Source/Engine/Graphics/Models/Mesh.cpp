@@ -121,6 +121,14 @@ namespace
         return mesh->UpdateTriangles(triangleCount, ib);
     }
 #endif
+
+    void ReportStreamingFeedback(const RenderView& view, const Mesh::DrawInfo& info, MaterialBase* material)
+    {
+        // Pass the size of the mesh on the screen to the textures streaming
+        const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(info.Bounds.Center, (float)info.Bounds.Radius, view);
+        const float size = 2.0f * Math::Sqrt(screenRadiusSquared) * view.ScreenSize.Y;
+        material->ReportStreamingFeedback(size);
+    }
 }
 
 bool Mesh::HasVertexColors() const
@@ -133,6 +141,7 @@ bool Mesh::UpdateMesh(uint32 vertexCount, uint32 triangleCount, const VB0Element
     auto model = (Model*)_model;
 
     Unload();
+    _meshlets.Resize(0);
 
     // Setup GPU resources
     model->LODs[_lodIndex]._verticesCount -= _vertices;
@@ -181,6 +190,7 @@ bool Mesh::UpdateTriangles(uint32 triangleCount, const void* ib, bool use16BitIn
 
     // Initialize
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
+    _meshlets.Resize(0);
     _indexBuffer = indexBuffer;
     _triangles = triangleCount;
     _use16BitIndexBuffer = use16BitIndices;
@@ -196,6 +206,7 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _materialSlotIndex = materialSlotIndex;
     _use16BitIndexBuffer = false;
     _hasLightmapUVs = hasLightmapUVs;
+    _compressedPositions = false;
     _box = box;
     _sphere = sphere;
     _vertices = 0;
@@ -206,12 +217,55 @@ void Mesh::Init(Model* model, int32 lodIndex, int32 index, int32 materialSlotInd
     _indexBuffer = nullptr;
 }
 
+void Mesh::SetMeshlets(const Meshlet* meshlets, int32 count)
+{
+    _meshlets.Set(meshlets, count);
+}
+
+void Mesh::SetCompressedPositions(bool value)
+{
+    _compressedPositions = value;
+}
+
+GPUBuffer* Mesh::GetFullPrecisionVertexBuffer() const
+{
+    if (!_compressedPositions || _fullPrecisionVertexBuffer)
+        return _fullPrecisionVertexBuffer ? _fullPrecisionVertexBuffer : _vertexBuffers[0];
+    PROFILE_CPU();
+    ScopeLock lock(GetModel()->Locker);
+    if (!_fullPrecisionVertexBuffer)
+    {
+        // Create the vertex buffer from the asset data on the first use
+        BytesContainer data;
+        int32 count;
+        if (DownloadDataCPU(MeshBufferType::Vertex0, data, count))
+        {
+            LOG(Error, "Failed to get vertex positions of the mesh.");
+            return _vertexBuffers[0];
+        }
+#if GPU_ENABLE_RESOURCE_NAMING
+        const String name = GetModel()->GetPath() + TEXT(".VB0.FullPrecision");
+#else
+        const String name;
+#endif
+        GPUBuffer* buffer = GPUDevice::Instance->CreateBuffer(name);
+        if (buffer->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), count, data.Get())))
+        {
+            SAFE_DELETE_GPU_RESOURCE(buffer);
+            return _vertexBuffers[0];
+        }
+        _fullPrecisionVertexBuffer = buffer;
+    }
+    return _fullPrecisionVertexBuffer;
+}
+
 Mesh::~Mesh()
 {
     // Release buffers
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[0]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
+    SAFE_DELETE_GPU_RESOURCE(_fullPrecisionVertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
 }
 
@@ -225,6 +279,23 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
     GPUBuffer* vertexBuffer1 = nullptr;
     GPUBuffer* vertexBuffer2 = nullptr;
     GPUBuffer* indexBuffer = nullptr;
+    Array<uint32> ib32;
+    Array<VB0CompressedElementType> vb0Compressed;
+    if (_compressedPositions)
+    {
+        // Quantize positions to 16-bit within the mesh bounds (decoded in the shader with GeometrySize and GeometryOrigin)
+        PROFILE_CPU_NAMED("Compress Positions");
+        const Float3 origin = _box.Minimum;
+        const Float3 size = _box.GetSize();
+        const Float3 invSize(size.X > ZeroTolerance ? 1.0f / size.X : 0.0f, size.Y > ZeroTolerance ? 1.0f / size.Y : 0.0f, size.Z > ZeroTolerance ? 1.0f / size.Z : 0.0f);
+        const float halfStep = 0.5f / MAX_uint16; // RGBA16UNorm truncates so round to the nearest value
+        vb0Compressed.EnsureCapacity(vertices);
+        for (uint32 i = 0; i < vertices; i++)
+        {
+            const Float3 position = (((const VB0ElementType*)vb0)[i].Position - origin) * invSize;
+            vb0Compressed.Add(VB0CompressedElementType(Math::Min(Math::Saturate(position.X) + halfStep, 1.0f), Math::Min(Math::Saturate(position.Y) + halfStep, 1.0f), Math::Min(Math::Saturate(position.Z) + halfStep, 1.0f), 0.0f));
+        }
+    }
 
     // Create GPU buffers
 #if GPU_ENABLE_RESOURCE_NAMING
@@ -233,7 +304,12 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
 #define MESH_BUFFER_NAME(postfix) String::Empty
 #endif
     vertexBuffer0 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB0"));
-    if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertices, vb0)))
+    if (_compressedPositions)
+    {
+        if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0CompressedElementType), vertices, vb0Compressed.Get())))
+            goto ERROR_LOAD_END;
+    }
+    else if (vertexBuffer0->Init(GPUBufferDescription::Vertex(sizeof(VB0ElementType), vertices, vb0)))
         goto ERROR_LOAD_END;
     vertexBuffer1 = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".VB1"));
     if (vertexBuffer1->Init(GPUBufferDescription::Vertex(sizeof(VB1ElementType), vertices, vb1)))
@@ -245,7 +321,22 @@ bool Mesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const void*
             goto ERROR_LOAD_END;
     }
     indexBuffer = GPUDevice::Instance->CreateBuffer(MESH_BUFFER_NAME(".IB"));
-    if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
+    if (_meshlets.HasItems())
+    {
+        // Meshlets culling reads the triangles in the shader via raw view (32-bit indices only)
+        if (use16BitIndexBuffer)
+        {
+            ib32.Resize(indicesCount);
+            for (uint32 i = 0; i < indicesCount; i++)
+                ib32.Get()[i] = ((const uint16*)ib)[i];
+            ib = ib32.Get();
+            ibStride = sizeof(uint32);
+            use16BitIndexBuffer = false;
+        }
+        if (indexBuffer->Init(GPUBufferDescription::Raw(ib, indicesCount * ibStride, GPUBufferFlags::IndexBuffer | GPUBufferFlags::ShaderResource)))
+            goto ERROR_LOAD_END;
+    }
+    else if (indexBuffer->Init(GPUBufferDescription::Index(ibStride, indicesCount, ib)))
         goto ERROR_LOAD_END;
 
     // Init collision proxy
@@ -288,6 +379,7 @@ void Mesh::Unload()
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[0]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[1]);
     SAFE_DELETE_GPU_RESOURCE(_vertexBuffers[2]);
+    SAFE_DELETE_GPU_RESOURCE(_fullPrecisionVertexBuffer);
     SAFE_DELETE_GPU_RESOURCE(_indexBuffer);
     _triangles = 0;
     _vertices = 0;
@@ -365,7 +457,7 @@ bool Mesh::Intersects(const Ray& ray, const Transform& transform, Real& distance
 void Mesh::GetDrawCallGeometry(DrawCall& drawCall) const
 {
     drawCall.Geometry.IndexBuffer = _indexBuffer;
-    drawCall.Geometry.VertexBuffers[0] = _vertexBuffers[0];
+    drawCall.Geometry.VertexBuffers[0] = GetFullPrecisionVertexBuffer();
     drawCall.Geometry.VertexBuffers[1] = _vertexBuffers[1];
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
     drawCall.Geometry.VertexBuffersOffsets[0] = 0;
@@ -380,7 +472,8 @@ void Mesh::Render(GPUContext* context) const
     if (!IsInitialized())
         return;
 
-    context->BindVB(ToSpan((GPUBuffer**)_vertexBuffers, 3));
+    GPUBuffer* vb[3] = { GetFullPrecisionVertexBuffer(), _vertexBuffers[1], _vertexBuffers[2] };
+    context->BindVB(ToSpan(vb, 3));
     context->BindIB(_indexBuffer);
     context->DrawIndexedInstanced(_triangles * 3, 1, 0, 0, 0);
 }
@@ -406,6 +499,8 @@ void Mesh::Draw(const RenderContext& renderContext, MaterialBase* material, cons
     drawCall.ObjectPosition = drawCall.World.GetTranslation();
     drawCall.ObjectRadius = (float)_sphere.Radius * drawCall.World.GetScaleVector().GetAbsolute().MaxValue();
     drawCall.Surface.GeometrySize = _box.GetSize();
+    drawCall.Surface.GeometryOrigin = _box.Minimum;
+    drawCall.Surface.CompressedPositions = _compressedPositions;
     drawCall.Surface.PrevWorld = world;
     drawCall.Surface.Lightmap = nullptr;
     drawCall.Surface.LightmapUVsArea = Rectangle::Empty;
@@ -440,6 +535,8 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
         material = GPUDevice::Instance->GetDefaultMaterial();
     if (!material || !material->IsSurface())
         return;
+    if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer))
+        ReportStreamingFeedback(renderContext.View, info, material);
 
     // Check if skip rendering
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
@@ -455,7 +552,12 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
     if (info.Deformation)
     {
-        info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, drawCall.Geometry.VertexBuffers[0]);
+        // Deformers operate on full-precision positions so keep the compressed buffer unless positions were deformed
+        GPUBuffer* vb0 = GetFullPrecisionVertexBuffer();
+        GPUBuffer* vb0Deformed = vb0;
+        info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, vb0Deformed);
+        if (vb0Deformed != vb0)
+            drawCall.Geometry.VertexBuffers[0] = vb0Deformed;
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex1, drawCall.Geometry.VertexBuffers[1]);
     }
     if (info.VertexColors && info.VertexColors[_lodIndex])
@@ -474,6 +576,8 @@ void Mesh::Draw(const RenderContext& renderContext, const DrawInfo& info, float
     drawCall.ObjectPosition = drawCall.World.GetTranslation();
     drawCall.ObjectRadius = (float)info.Bounds.Radius; // TODO: should it be kept in sync with ObjectPosition?
     drawCall.Surface.GeometrySize = _box.GetSize();
+    drawCall.Surface.GeometryOrigin = _box.Minimum;
+    drawCall.Surface.CompressedPositions = _compressedPositions && drawCall.Geometry.VertexBuffers[0] == _vertexBuffers[0];
     drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
     drawCall.Surface.Lightmap = (info.Flags & StaticFlags::Lightmap) != StaticFlags::None ? info.Lightmap : nullptr;
     drawCall.Surface.LightmapUVsArea = info.LightmapUVs ? *info.LightmapUVs : Rectangle::Empty;
@@ -510,6 +614,7 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
         material = GPUDevice::Instance->GetDefaultMaterial();
     if (!material || !material->IsSurface())
         return;
+    ReportStreamingFeedback(renderContextBatch.GetMainContext().View, info, material);
 
     // Setup draw call
     DrawCall drawCall;
@@ -519,7 +624,12 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     drawCall.Geometry.VertexBuffers[2] = _vertexBuffers[2];
     if (info.Deformation)
     {
-        info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, drawCall.Geometry.VertexBuffers[0]);
+        // Deformers operate on full-precision positions so keep the compressed buffer unless positions were deformed
+        GPUBuffer* vb0 = GetFullPrecisionVertexBuffer();
+        GPUBuffer* vb0Deformed = vb0;
+        info.Deformation->RunDeformers(this, MeshBufferType::Vertex0, vb0Deformed);
+        if (vb0Deformed != vb0)
+            drawCall.Geometry.VertexBuffers[0] = vb0Deformed;
         info.Deformation->RunDeformers(this, MeshBufferType::Vertex1, drawCall.Geometry.VertexBuffers[1]);
     }
     if (info.VertexColors && info.VertexColors[_lodIndex])
@@ -538,6 +648,8 @@ void Mesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& in
     drawCall.ObjectPosition = drawCall.World.GetTranslation();
     drawCall.ObjectRadius = (float)info.Bounds.Radius; // TODO: should it be kept in sync with ObjectPosition?
     drawCall.Surface.GeometrySize = _box.GetSize();
+    drawCall.Surface.GeometryOrigin = _box.Minimum;
+    drawCall.Surface.CompressedPositions = _compressedPositions && drawCall.Geometry.VertexBuffers[0] == _vertexBuffers[0];
     drawCall.Surface.PrevWorld = info.DrawState->PrevWorld;
     drawCall.Surface.Lightmap = (info.Flags & StaticFlags::Lightmap) != StaticFlags::None ? info.Lightmap : nullptr;
     drawCall.Surface.LightmapUVsArea = info.LightmapUVs ? *info.LightmapUVs : Rectangle::Empty;
@@ -569,7 +681,7 @@ bool Mesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
         buffer = _indexBuffer;
         break;
     case MeshBufferType::Vertex0:
-        buffer = _vertexBuffers[0];
+        buffer = GetFullPrecisionVertexBuffer();
         break;
     case MeshBufferType::Vertex1:
         buffer = _vertexBuffers[1];
@@ -590,7 +702,7 @@ Task* Mesh::DownloadDataGPUAsync(MeshBufferType type, BytesContainer& result) co
         buffer = _indexBuffer;
         break;
     case MeshBufferType::Vertex0:
-        buffer = _vertexBuffers[0];
+        buffer = GetFullPrecisionVertexBuffer();
         break;
     case MeshBufferType::Vertex1:
         buffer = _vertexBuffers[1];
@@ -20,8 +20,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
     DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(Mesh, MeshBase);
 protected:
     bool _hasLightmapUVs;
+    bool _compressedPositions = false;
     GPUBuffer* _vertexBuffers[3] = {};
+    mutable GPUBuffer* _fullPrecisionVertexBuffer = nullptr;
     GPUBuffer* _indexBuffer = nullptr;
+    Array<Meshlet> _meshlets;
 #if USE_PRECISE_MESH_INTERSECTS
     CollisionProxy _collisionProxy;
 #endif
@@ -91,6 +94,40 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Mesh : public MeshBase
         return _hasLightmapUVs;
     }
 
+    /// <summary>
+    /// Gets the meshlets (clusters of triangles stored in contiguous index buffer ranges) used for the fine-grained GPU culling. Empty if mesh has no meshlets.
+    /// </summary>
+    FORCE_INLINE const Array<Meshlet>& GetMeshlets() const
+    {
+        return _meshlets;
+    }
+
+    /// <summary>
+    /// Sets the meshlets of the mesh. Must be called before loading the mesh buffers (index buffer of the mesh with meshlets is readable by the shaders).
+    /// </summary>
+    /// <param name="meshlets">The meshlets data.</param>
+    /// <param name="count">The amount of meshlets.</param>
+    void SetMeshlets(const Meshlet* meshlets, int32 count);
+
+    /// <summary>
+    /// Determines whether this mesh uses the vertex positions quantized to 16-bit within the mesh bounds (vertex buffer 0 contains VB0CompressedElementType elements decoded by the surface materials).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool HasCompressedPositions() const
+    {
+        return _compressedPositions;
+    }
+
+    /// <summary>
+    /// Sets the vertex positions compression mode of the mesh. Must be called before loading the mesh buffers.
+    /// </summary>
+    /// <param name="value">True if quantize the vertex positions to 16-bit within the mesh bounds, otherwise false.</param>
+    void SetCompressedPositions(bool value);
+
+    /// <summary>
+    /// Gets the vertex buffer 0 with full-precision positions (VB0ElementType). For meshes with compressed positions it's created on the first use from the asset data to be used by the rendering features that don't decode the positions (eg. spline models, mesh particles or lightmaps baking).
+    /// </summary>
+    GPUBuffer* GetFullPrecisionVertexBuffer() const;
+
 #if USE_PRECISE_MESH_INTERSECTS
     /// <summary>
     /// Gets the collision proxy used by the mesh.
@@ -3,6 +3,8 @@
 #include "MeshDeformation.h"
 #include "Engine/Graphics/Models/MeshBase.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Threading/Threading.h"
 
 struct Key
 {
@@ -29,6 +31,24 @@ FORCE_INLINE static uint32 GetKey(int32 lodIndex, int32 meshIndex, MeshBufferTyp
     return key.Value;
 }
 
+struct MeshDeformation::PendingDeformation
+{
+    MeshDeformation* Owner;
+    uint32 Key;
+    const MeshBase* Mesh;
+    MeshDeformationData* Deformation;
+    uint32 VertexStride;
+    uint32 UploadMinIndex;
+    uint32 UploadMaxIndex;
+    bool Failed;
+};
+
+namespace
+{
+    int64 DeferredScopes = 0;
+    CriticalSection PendingLocker;
+}
+
 void MeshDeformation::GetBounds(int32 lodIndex, int32 meshIndex, BoundingBox& bounds) const
 {
     const auto key = GetKey(lodIndex, meshIndex, MeshBufferType::Vertex0);
@@ -45,7 +65,10 @@ void MeshDeformation::GetBounds(int32 lodIndex, int32 meshIndex, BoundingBox& bo
 void MeshDeformation::Clear()
 {
     for (MeshDeformationData* e : _deformations)
+    {
+        RemovePending(e);
         Delete(e);
+    }
     _deformations.Clear();
 }
 
@@ -82,17 +105,26 @@ void MeshDeformation::Dirty(int32 lodIndex, int32 meshIndex, MeshBufferType type
     }
 }
 
-void MeshDeformation::AddDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer)
+void MeshDeformation::AddDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer, MeshDeformerFlags flags)
 {
     const auto key = GetKey(lodIndex, meshIndex, type);
-    _deformers[key].Bind(deformer);
+    DeformerEntry& e = _deformers[key];
+    if (EnumHasAnyFlags(flags, MeshDeformerFlags::GPU))
+        e.GPUDeformers.Bind(deformer);
+    else if (EnumHasAnyFlags(flags, MeshDeformerFlags::Async))
+        e.AsyncDeformers.Bind(deformer);
+    else
+        e.Deformers.Bind(deformer);
     Dirty(lodIndex, meshIndex, type);
 }
 
 void MeshDeformation::RemoveDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer)
 {
     const auto key = GetKey(lodIndex, meshIndex, type);
-    _deformers[key].Unbind(deformer);
+    DeformerEntry& e = _deformers[key];
+    e.Deformers.Unbind(deformer);
+    e.AsyncDeformers.Unbind(deformer);
+    e.GPUDeformers.Unbind(deformer);
     Dirty(lodIndex, meshIndex, type);
 }
 
@@ -119,48 +151,168 @@ void MeshDeformation::RunDeformers(const MeshBase* mesh, MeshBufferType type, GP
             // Auto-recycle unused deformations
             if (deformation)
             {
+                RemovePending(deformation);
                 _deformations.Remove(deformation);
                 Delete(deformation);
             }
             _deformers.Remove(key);
             return;
         }
+        const bool useCPU = e->Deformers.IsBinded() || e->AsyncDeformers.IsBinded();
         if (!deformation)
         {
             deformation = New<MeshDeformationData>(key, type, vertexStride);
-            deformation->VertexBuffer.Data.Resize(vertexBuffer->GetSize());
+            if (useCPU)
+                deformation->VertexBuffer.Data.Resize(vertexBuffer->GetSize());
             deformation->Bounds = mesh->GetBox();
             _deformations.Add(deformation);
         }
 
         if (deformation->Dirty)
         {
-            // Get original mesh vertex buffer data (cached on CPU)
-            BytesContainer vertexData;
-            int32 vertexCount;
-            if (mesh->DownloadDataCPU(type, vertexData, vertexCount))
-                return;
-            ASSERT(vertexData.Length() / vertexCount == vertexStride);
-
-            // Init dirty range with valid data (use the dirty range from the previous update to be cleared with initial data)
-            deformation->VertexBuffer.Data.Resize(vertexData.Length());
-            const uint32 dirtyDataStart = Math::Min<uint32>(deformation->DirtyMinIndex, vertexCount - 1) * vertexStride;
-            const uint32 dirtyDataLength = Math::Min<uint32>(deformation->DirtyMaxIndex - deformation->DirtyMinIndex + 1, vertexCount) * vertexStride;
-            Platform::MemoryCopy(deformation->VertexBuffer.Data.Get() + dirtyDataStart, vertexData.Get() + dirtyDataStart, dirtyDataLength);
-
             // Reset dirty state
-            deformation->DirtyMinIndex = MAX_uint32 - 1;
-            deformation->DirtyMaxIndex = 0;
             deformation->Dirty = false;
 
-            // Run deformers
-            (*e)(mesh, *deformation);
+            // Run GPU deformers (they write vertices into the override buffer)
+            if (e->GPUDeformers.IsBinded())
+                e->GPUDeformers(mesh, *deformation);
+
+            // Skip CPU data when deformer writes vertices directly on the GPU
+            if (!deformation->OverrideBuffer && useCPU)
+            {
+                PendingDeformation pending;
+                pending.Owner = this;
+                pending.Key = key;
+                pending.Mesh = mesh;
+                pending.Deformation = deformation;
+                pending.VertexStride = vertexStride;
+                pending.Failed = false;
 
-            // Upload modified vertex data to the GPU
-            deformation->VertexBuffer.Flush();
+                // Defer thread-safe deformers to run them in parallel after the draw calls collection (vertex buffer has to exist and fit the data to be bound for drawing now)
+                const GPUBuffer* deformedBuffer = deformation->VertexBuffer.GetBuffer();
+                if (Platform::AtomicRead(&DeferredScopes) != 0 && !e->Deformers.IsBinded() && deformedBuffer && deformedBuffer->GetSize() >= (uint32)deformation->VertexBuffer.Data.Count())
+                {
+                    ScopeLock lock(PendingLocker);
+                    GetPending().Add(pending);
+                }
+                else if (!Deform(pending))
+                {
+                    Upload(pending);
+                }
+            }
         }
 
         // Override vertex buffer for draw call
-        vertexBuffer = deformation->VertexBuffer.GetBuffer();
+        if (deformation->OverrideBuffer)
+            vertexBuffer = deformation->OverrideBuffer;
+        else if (useCPU && deformation->VertexBuffer.GetBuffer())
+            vertexBuffer = deformation->VertexBuffer.GetBuffer();
+    }
+}
+
+void MeshDeformation::BeginDeferred()
+{
+    Platform::InterlockedIncrement(&DeferredScopes);
+}
+
+void MeshDeformation::EndDeferred()
+{
+    if (Platform::InterlockedDecrement(&DeferredScopes) != 0)
+        return;
+    Array<PendingDeformation> pending;
+    PendingLocker.Lock();
+    pending.Swap(GetPending());
+    PendingLocker.Unlock();
+    if (pending.IsEmpty())
+        return;
+    PROFILE_CPU();
+
+    // Run deformers in parallel
+    if (pending.Count() == 1)
+    {
+        pending[0].Failed = Deform(pending[0]);
+    }
+    else
+    {
+        Function<void(int32)> job = [&pending](int32 index)
+        {
+            pending[index].Failed = Deform(pending[index]);
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, pending.Count()));
+    }
+
+    // Upload modified vertex data to the GPU
+    for (PendingDeformation& e : pending)
+    {
+        if (!e.Failed)
+            Upload(e);
+    }
+}
+
+Array<MeshDeformation::PendingDeformation>& MeshDeformation::GetPending()
+{
+    static Array<PendingDeformation> pending;
+    return pending;
+}
+
+bool MeshDeformation::Deform(PendingDeformation& pending)
+{
+    MeshDeformationData* deformation = pending.Deformation;
+    const uint32 vertexStride = pending.VertexStride;
+
+    // Get original mesh vertex buffer data (cached on CPU)
+    BytesContainer vertexData;
+    int32 vertexCount;
+    if (pending.Mesh->DownloadDataCPU(deformation->Type, vertexData, vertexCount) || vertexCount == 0)
+    {
+        deformation->Dirty = true;
+        return true;
+    }
+    ASSERT(vertexData.Length() / vertexCount == vertexStride);
+
+    // Init dirty range with valid data (use the dirty range from the previous update to be cleared with initial data)
+    deformation->VertexBuffer.Data.Resize(vertexData.Length());
+    const uint32 prevMinIndex = Math::Min<uint32>(deformation->DirtyMinIndex, vertexCount - 1);
+    const uint32 prevMaxIndex = Math::Min<uint32>(deformation->DirtyMaxIndex, vertexCount - 1);
+    if (prevMinIndex <= prevMaxIndex)
+        Platform::MemoryCopy(deformation->VertexBuffer.Data.Get() + prevMinIndex * vertexStride, vertexData.Get() + prevMinIndex * vertexStride, (prevMaxIndex - prevMinIndex + 1) * vertexStride);
+
+    // Run deformers
+    deformation->DirtyMinIndex = MAX_uint32 - 1;
+    deformation->DirtyMaxIndex = 0;
+    const DeformerEntry& e = pending.Owner->_deformers.At(pending.Key);
+    if (e.Deformers.IsBinded())
+        e.Deformers(pending.Mesh, *deformation);
+    if (e.AsyncDeformers.IsBinded())
+        e.AsyncDeformers(pending.Mesh, *deformation);
+
+    // Upload the range restored with the original data and the range modified by deformers (whole buffer if deformer didn't specify it)
+    if (deformation->DirtyMinIndex > deformation->DirtyMaxIndex)
+    {
+        pending.UploadMinIndex = 0;
+        pending.UploadMaxIndex = vertexCount - 1;
+    }
+    else
+    {
+        pending.UploadMinIndex = Math::Min<uint32>(Math::Min(prevMinIndex, deformation->DirtyMinIndex), vertexCount - 1);
+        pending.UploadMaxIndex = Math::Min<uint32>(Math::Max(prevMaxIndex, deformation->DirtyMaxIndex), vertexCount - 1);
+    }
+    return false;
+}
+
+void MeshDeformation::Upload(PendingDeformation& pending)
+{
+    const uint32 vertexStride = pending.VertexStride;
+    pending.Deformation->VertexBuffer.Flush(pending.UploadMinIndex * vertexStride, (pending.UploadMaxIndex - pending.UploadMinIndex + 1) * vertexStride);
+}
+
+void MeshDeformation::RemovePending(const MeshDeformationData* deformation)
+{
+    ScopeLock lock(PendingLocker);
+    auto& pending = GetPending();
+    for (int32 i = pending.Count() - 1; i >= 0; i--)
+    {
+        if (pending[i].Deformation == deformation)
+            pending.RemoveAt(i);
     }
 }
@@ -14,12 +14,22 @@ struct MeshDeformationData
 {
     uint64 Key;
     MeshBufferType Type;
+
+    /// <summary>
+    /// The range of the vertices modified by the deformers. Restored with the original mesh data before the next deformation and used to upload only the modified part of the vertex buffer (full buffer is uploaded if deformer doesn't set it).
+    /// </summary>
     uint32 DirtyMinIndex = 0;
     uint32 DirtyMaxIndex = MAX_uint32 - 1;
+
     bool Dirty = true;
     BoundingBox Bounds;
     DynamicVertexBuffer VertexBuffer;
 
+    /// <summary>
+    /// The custom vertex buffer to draw mesh with instead of the dynamic vertex buffer (eg. written by the GPU deformer such as the cloth simulation). Skips mesh data download and upload to the GPU when set by the deformer.
+    /// </summary>
+    GPUBuffer* OverrideBuffer = nullptr;
+
     MeshDeformationData(uint64 key, MeshBufferType type, uint32 stride)
         : Key(key)
         , Type(type)
@@ -34,13 +44,42 @@ struct MeshDeformationData
     }
 };
 
+/// <summary>
+/// The mesh deformer execution options.
+/// </summary>
+enum class MeshDeformerFlags
+{
+    // Deformer runs on the CPU within the mesh drawing (on the thread that draws the mesh).
+    None = 0,
+    // Deformer runs on the CPU and is thread-safe so it can be executed on the Job System (in parallel with the other deformers) after the draw calls collection and before the rendering.
+    Async = 1,
+    // Deformer writes vertices on the GPU (eg. with a compute shader) into the MeshDeformationData::OverrideBuffer so the CPU vertex data is not used (not allocated nor uploaded).
+    GPU = 2,
+};
+
+DECLARE_ENUM_OPERATORS(MeshDeformerFlags);
+
 /// <summary>
 /// The mesh deformation utility for editing or morphing models dynamically at runtime (eg. via Blend Shapes or Cloth).
 /// </summary>
 class FLAXENGINE_API MeshDeformation
 {
 private:
-    Dictionary<uint32, Delegate<const MeshBase*, MeshDeformationData&>> _deformers;
+    struct DeformerEntry
+    {
+        Delegate<const MeshBase*, MeshDeformationData&> Deformers;
+        Delegate<const MeshBase*, MeshDeformationData&> AsyncDeformers;
+        Delegate<const MeshBase*, MeshDeformationData&> GPUDeformers;
+
+        bool IsBinded() const
+        {
+            return Deformers.IsBinded() || AsyncDeformers.IsBinded() || GPUDeformers.IsBinded();
+        }
+    };
+
+    struct PendingDeformation;
+
+    Dictionary<uint32, DeformerEntry> _deformers;
     Array<MeshDeformationData*> _deformations;
 
 public:
@@ -48,13 +87,30 @@ class FLAXENGINE_API MeshDeformation
     {
         Clear();
     }
-    
+
     void GetBounds(int32 lodIndex, int32 meshIndex, BoundingBox& bounds) const;
     void Clear();
     void Dirty();
     void Dirty(int32 lodIndex, int32 meshIndex, MeshBufferType type);
     void Dirty(int32 lodIndex, int32 meshIndex, MeshBufferType type, const BoundingBox& bounds);
-    void AddDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer);
+    void AddDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer, MeshDeformerFlags flags = MeshDeformerFlags::None);
     void RemoveDeformer(int32 lodIndex, int32 meshIndex, MeshBufferType type, const Function<void(const MeshBase* mesh, MeshDeformationData& deformation)>& deformer);
     void RunDeformers(const MeshBase* mesh, MeshBufferType type, GPUBuffer*& vertexBuffer);
+
+public:
+    /// <summary>
+    /// Begins the deferred deformers execution (eg. for the draw calls collection). Deformers with Async flag are queued instead of running within the mesh drawing.
+    /// </summary>
+    static void BeginDeferred();
+
+    /// <summary>
+    /// Ends the deferred deformers execution. Runs the queued deformers in parallel on the Job System and uploads the modified vertices to the GPU.
+    /// </summary>
+    static void EndDeferred();
+
+private:
+    static Array<PendingDeformation>& GetPending();
+    static bool Deform(PendingDeformation& pending);
+    static void Upload(PendingDeformation& pending);
+    void RemovePending(const MeshDeformationData* deformation);
 };
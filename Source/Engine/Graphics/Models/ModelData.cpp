@@ -25,6 +25,7 @@ void MeshData::Clear()
     BlendIndices.Clear();
     BlendWeights.Clear();
     BlendShapes.Clear();
+    Meshlets.Clear();
 }
 
 void MeshData::EnsureCapacity(int32 vertices, int32 indices, bool preserveContents, bool withColors, bool withSkin)
@@ -53,6 +54,7 @@ void MeshData::SwapBuffers(MeshData& other)
     BlendIndices.Swap(other.BlendIndices);
     BlendWeights.Swap(other.BlendWeights);
     BlendShapes.Swap(other.BlendShapes);
+    Meshlets.Swap(other.Meshlets);
 }
 
 void MeshData::Release()
@@ -69,6 +71,7 @@ void MeshData::Release()
     BlendIndices.Resize(0);
     BlendWeights.Resize(0);
     BlendShapes.Resize(0);
+    Meshlets.Resize(0);
 }
 
 void MeshData::InitFromModelVertices(ModelVertex19* vertices, uint32 verticesCount)
@@ -937,22 +940,31 @@ bool ModelData::Pack2AnimationHeader(WriteStream* stream, int32 animIndex) const
     }
 
     // Info
-    stream->WriteInt32(103); // Header version (for fast version upgrades without serialization format change)
+    stream->WriteInt32(104); // Header version (for fast version upgrades without serialization format change)
     stream->WriteDouble(anim.Duration);
     stream->WriteDouble(anim.FramesPerSecond);
     stream->WriteByte((byte)anim.RootMotionFlags);
     stream->WriteString(anim.RootNodeName, 13);
 
-    // Animation channels
+    // Animation channels (long animations store keyframes in time segments, see AnimationData::SerializeSegment)
+    Array<float, FixedAllocation<ANIM_STREAMING_MAX_SEGMENTS + 1>> segments;
+    anim.GetStreamingSegments(segments);
+    const int32 segmentsCount = Math::Max(segments.Count() - 1, 0);
     stream->WriteInt32(anim.Channels.Count());
+    stream->WriteInt32(segmentsCount);
     for (int32 i = 0; i < anim.Channels.Count(); i++)
     {
         auto& channel = anim.Channels[i];
         stream->WriteString(channel.NodeName, 172);
-        Serialization::Serialize(*stream, channel.Position);
-        Serialization::Serialize(*stream, channel.Rotation);
-        Serialization::Serialize(*stream, channel.Scale);
+        if (segmentsCount == 0)
+        {
+            Serialization::Serialize(*stream, channel.Position);
+            Serialization::Serialize(*stream, channel.Rotation);
+            Serialization::Serialize(*stream, channel.Scale);
+        }
     }
+    if (segmentsCount != 0)
+        stream->WriteBytes(segments.Get(), segments.Count() * sizeof(float));
 
     // Animation events
     stream->WriteInt32(anim.Events.Count());
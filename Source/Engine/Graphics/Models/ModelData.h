@@ -90,6 +90,11 @@ class FLAXENGINE_API MeshData
     /// </summary>
     Array<BlendShape> BlendShapes;
 
+    /// <summary>
+    /// Meshlets (clusters of triangles) used for the GPU culling. Each meshlet references a contiguous range of the index buffer. Optional.
+    /// </summary>
+    Array<Meshlet> Meshlets;
+
     /// <summary>
     /// Global translation for this mesh to be at it's local origin.
     /// </summary>
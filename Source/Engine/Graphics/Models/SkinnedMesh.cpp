@@ -3,15 +3,18 @@
 #include "SkinnedMesh.h"
 #include "MeshDeformation.h"
 #include "ModelInstanceEntry.h"
+#include "SkinnedMeshDrawData.h"
 #include "Engine/Content/Assets/Material.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/ComputeSkinningPass.h"
 #include "Engine/Serialization/MemoryReadStream.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
@@ -81,6 +84,30 @@ void SkeletonData::Dispose()
     Bones.Resize(0);
 }
 
+namespace
+{
+    bool SetupComputeSkinning(const SkinnedMesh* mesh, const SkinnedMesh::DrawInfo& info, DrawCall& drawCall, DrawPass& skinnedDrawModes)
+    {
+        // Skip meshes with deformed vertices (eg. blend shapes)
+        if (!info.Skinning || drawCall.Geometry.VertexBuffers[0] != mesh->GetVertexBuffer() || !ComputeSkinningPass::Instance()->CanUse())
+            return false;
+        GPUBuffer *vb0, *vb1;
+        if (ComputeSkinningPass::Instance()->GetSkinnedVertices(mesh, info.Skinning, vb0, vb1))
+            return false;
+
+        // Draw skinned vertices as a static geometry
+        drawCall.Geometry.VertexBuffers[0] = vb0;
+        drawCall.Geometry.VertexBuffers[1] = vb1;
+        drawCall.Geometry.VertexBuffers[2] = nullptr;
+        drawCall.Surface.Skinning = nullptr;
+
+        // Per-bone motion vectors need the previous frame bones so only that pass uses the vertex shader skinning
+        const bool perBoneMotionBlur = info.Skinning->PrevBoneMatrices && info.Skinning->PrevBoneMatrices->IsAllocated();
+        skinnedDrawModes = perBoneMotionBlur ? skinnedDrawModes & DrawPass::MotionVectors : DrawPass::None;
+        return true;
+    }
+}
+
 void SkinnedMesh::Init(SkinnedModel* model, int32 lodIndex, int32 index, int32 materialSlotIndex, const BoundingBox& box, const BoundingSphere& sphere)
 {
     _model = model;
@@ -120,7 +147,14 @@ bool SkinnedMesh::Load(uint32 vertices, uint32 triangles, const void* vb0, const
 #else
 	vertexBuffer = GPUDevice::Instance->CreateBuffer(String::Empty);
 #endif
-    if (vertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0)))
+    if (GPUDevice::Instance->Limits.HasCompute)
+    {
+        // Compute skinning reads the vertices as raw buffer
+        const auto flags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::ShaderResource | GPUBufferFlags::RawBuffer;
+        if (vertexBuffer->Init(GPUBufferDescription::Buffer(vertices * sizeof(VB0SkinnedElementType), flags, PixelFormat::R32_Typeless, vb0, sizeof(VB0SkinnedElementType))))
+            goto ERROR_LOAD_END;
+    }
+    else if (vertexBuffer->Init(GPUBufferDescription::Vertex(sizeof(VB0SkinnedElementType), vertices, vb0)))
         goto ERROR_LOAD_END;
 
     // Create index buffer
@@ -257,7 +291,16 @@ void SkinnedMesh::Draw(const RenderContext& renderContext, const DrawInfo& info,
     drawCall.PerInstanceRandom = info.PerInstanceRandom;
 
     // Push draw call to the render list
-    renderContext.List->AddDrawCall(renderContext, drawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
+    DrawPass skinnedDrawModes = drawModes;
+    DrawCall staticDrawCall = drawCall;
+    if (SetupComputeSkinning(this, info, staticDrawCall, skinnedDrawModes))
+    {
+        const DrawPass staticDrawModes = drawModes & ~skinnedDrawModes;
+        if (staticDrawModes != DrawPass::None)
+            renderContext.List->AddDrawCall(renderContext, staticDrawModes, StaticFlags::None, staticDrawCall, entry.ReceiveDecals, info.SortOrder);
+    }
+    if (skinnedDrawModes != DrawPass::None)
+        renderContext.List->AddDrawCall(renderContext, skinnedDrawModes, StaticFlags::None, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawInfo& info, float lodDitherFactor) const
@@ -302,8 +345,19 @@ void SkinnedMesh::Draw(const RenderContextBatch& renderContextBatch, const DrawI
     // Push draw call to the render lists
     const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
     const auto drawModes = info.DrawModes & material->GetDrawModes();
-    if (drawModes != DrawPass::None)
-        renderContextBatch.GetMainContext().List->AddDrawCall(renderContextBatch, drawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
+    if (drawModes == DrawPass::None)
+        return;
+    RenderList* list = renderContextBatch.GetMainContext().List;
+    DrawPass skinnedDrawModes = drawModes;
+    DrawCall staticDrawCall = drawCall;
+    if (SetupComputeSkinning(this, info, staticDrawCall, skinnedDrawModes))
+    {
+        const DrawPass staticDrawModes = drawModes & ~skinnedDrawModes;
+        if (staticDrawModes != DrawPass::None)
+            list->AddDrawCall(renderContextBatch, staticDrawModes, StaticFlags::None, shadowsMode, info.Bounds, staticDrawCall, entry.ReceiveDecals, info.SortOrder);
+    }
+    if (skinnedDrawModes != DrawPass::None)
+        list->AddDrawCall(renderContextBatch, skinnedDrawModes, StaticFlags::None, shadowsMode, info.Bounds, drawCall, entry.ReceiveDecals, info.SortOrder);
 }
 
 bool SkinnedMesh::DownloadDataGPU(MeshBufferType type, BytesContainer& result) const
@@ -42,6 +42,14 @@ API_CLASS(NoSpawn) class FLAXENGINE_API SkinnedMesh : public MeshBase
         return (SkinnedModel*)_model;
     }
 
+    /// <summary>
+    /// Gets the vertex buffer (skinned vertices layout).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetVertexBuffer() const
+    {
+        return _vertexBuffer;
+    }
+
     /// <summary>
     /// Determines whether this mesh is initialized (has vertex and index buffers initialized).
     /// </summary>
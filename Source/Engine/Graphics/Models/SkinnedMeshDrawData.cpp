@@ -15,6 +15,11 @@ SkinnedMeshDrawData::~SkinnedMeshDrawData()
 {
     SAFE_DELETE_GPU_RESOURCE(BoneMatrices);
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    for (SkinnedVertices& e : SkinnedBuffers)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.VB0);
+        SAFE_DELETE_GPU_RESOURCE(e.VB1);
+    }
 }
 
 void SkinnedMeshDrawData::Setup(int32 bonesCount)
@@ -34,8 +39,15 @@ void SkinnedMeshDrawData::Setup(int32 bonesCount)
     BonesCount = bonesCount;
     _hasValidData = false;
     _isDirty = false;
+    _version++;
     Data.Resize(BoneMatrices->GetSize());
     SAFE_DELETE_GPU_RESOURCE(PrevBoneMatrices);
+    for (SkinnedVertices& e : SkinnedBuffers)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.VB0);
+        SAFE_DELETE_GPU_RESOURCE(e.VB1);
+    }
+    SkinnedBuffers.Clear();
 }
 
 void SkinnedMeshDrawData::SetData(const Matrix* bones, bool dropHistory)
@@ -84,4 +96,5 @@ void SkinnedMeshDrawData::OnDataChanged(bool dropHistory)
 
     _isDirty = true;
     _hasValidData = true;
+    _version++;
 }
@@ -5,6 +5,8 @@
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Graphics/GPUBuffer.h"
 
+class SkinnedMesh;
+
 /// <summary>
 /// Data storage for the skinned meshes rendering
 /// </summary>
@@ -13,6 +15,7 @@ class FLAXENGINE_API SkinnedMeshDrawData
 private:
     bool _hasValidData = false;
     bool _isDirty = false;
+    uint32 _version = 0;
 
 public:
     /// <summary>
@@ -35,6 +38,24 @@ class FLAXENGINE_API SkinnedMeshDrawData
     /// </summary>
     Array<byte> Data;
 
+    /// <summary>
+    /// The skinned vertices of the mesh cached by the compute skinning (see ComputeSkinningPass).
+    /// </summary>
+    struct SkinnedVertices
+    {
+        const SkinnedMesh* Mesh;
+        // The skinned positions (static mesh VB0 layout).
+        GPUBuffer* VB0;
+        // The skinned texcoords, normals and tangents (static mesh VB1 layout).
+        GPUBuffer* VB1;
+        uint32 Version;
+    };
+
+    /// <summary>
+    /// The skinned vertices cached per mesh (for the meshes drawn with compute skinning).
+    /// </summary>
+    Array<SkinnedVertices> SkinnedBuffers;
+
 public:
     /// <summary>
     /// Initializes a new instance of the <see cref="SkinnedMeshDrawData"/> class.
@@ -63,6 +84,14 @@ class FLAXENGINE_API SkinnedMeshDrawData
         return _isDirty;
     }
 
+    /// <summary>
+    /// Gets the bones data version. Incremented on every bones data modification.
+    /// </summary>
+    FORCE_INLINE uint32 GetVersion() const
+    {
+        return _version;
+    }
+
     /// <summary>
     /// Setups the data container for the specified bones amount.
     /// </summary>
@@ -146,6 +146,26 @@ typedef VB1ElementType18 VB1ElementType;
 typedef VB2ElementType18 VB2ElementType;
 //
 
+// The vertex buffer 0 element with the position quantized to 16-bit within the mesh bounds (used by meshes with compressed positions, W is unused)
+typedef RGBA16UNorm VB0CompressedElementType;
+
+// The cluster of the mesh triangles (contiguous range in the index buffer) used for the fine-grained GPU culling
+PACK_STRUCT(struct Meshlet
+    {
+    // The bounding sphere center (in mesh local-space).
+    Float3 Center;
+    // The bounding sphere radius.
+    float Radius;
+    // The normalized axis of the triangle normals cone.
+    Float3 ConeAxis;
+    // The sine of the normals cone half-angle used for backface culling (1 disables cone culling).
+    float ConeCutoff;
+    // The first index of the meshlet triangles in the mesh index buffer.
+    uint32 StartIndex;
+    // The amount of the meshlet triangles.
+    uint32 TrianglesCount;
+    });
+
 // Vertex structure for all skinned models (versioned)
 PACK_STRUCT(struct SkinnedModelVertex1
     {
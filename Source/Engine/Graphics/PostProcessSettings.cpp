@@ -33,6 +33,7 @@ void GlobalIlluminationSettings::BlendWith(GlobalIlluminationSettings& other, fl
     BLEND_FLOAT(TemporalResponse);
     BLEND_FLOAT(Distance);
     BLEND_COL(FallbackIrradiance);
+    BLEND_INT(RaysBudget);
 }
 
 void BloomSettings::BlendWith(BloomSettings& other, float weight)
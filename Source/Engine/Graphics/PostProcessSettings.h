@@ -323,10 +323,15 @@ API_ENUM(Attributes="Flags") enum class GlobalIlluminationSettingsOverride : int
     /// </summary>
     BounceIntensity = 1 << 5,
 
+    /// <summary>
+    /// Overrides <see cref="GlobalIlluminationSettings.RaysBudget"/> property.
+    /// </summary>
+    RaysBudget = 1 << 6,
+
     /// <summary>
     /// All properties.
     /// </summary>
-    All = Mode | Intensity | TemporalResponse | Distance | FallbackIrradiance | BounceIntensity,
+    All = Mode | Intensity | TemporalResponse | Distance | FallbackIrradiance | BounceIntensity | RaysBudget,
 };
 
 /// <summary>
@@ -380,6 +385,12 @@ API_STRUCT() struct FLAXENGINE_API GlobalIlluminationSettings : ISerializable
     API_FIELD(Attributes="EditorOrder(40), PostProcessSetting((int)GlobalIlluminationSettingsOverride.FallbackIrradiance)")
     Color FallbackIrradiance = Color::Black;
 
+    /// <summary>
+    /// The maximum amount of rays (in thousands) traced by the Global Illumination probes per-frame. Probes further away from the camera get updated less frequently to fit within the budget (newly activated probes are always updated). Use 0 to update all probes every frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(50), Limit(0, 100000), PostProcessSetting((int)GlobalIlluminationSettingsOverride.RaysBudget)")
+    int32 RaysBudget = 0;
+
 public:
     /// <summary>
     /// Blends the settings using given weight.
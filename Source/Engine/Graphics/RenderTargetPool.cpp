@@ -52,6 +52,10 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
         auto& e = TemporaryRTs[i];
         if (!e.IsOccupied && e.DescriptionHash == descHash)
         {
+            // Skip targets which memory is aliased with the other target in use
+            if (GPUDevice::Instance->BeginTransientTexture(e.RT))
+                continue;
+
             // Mark as used
             e.IsOccupied = true;
             return e.RT;
@@ -65,15 +69,16 @@ GPUTexture* RenderTargetPool::Get(const GPUTextureDescription& desc)
     }
 #endif
 
-    // Create new rt
+    // Create new rt (temporary targets are used only between Get and Release so memory can be shared between targets that are not used at the same time)
     const String name = TEXT("TemporaryRT_") + StringUtils::ToString(TemporaryRTs.Count());
-    GPUTexture* rt = GPUDevice::Instance->CreateTexture(name);
+    GPUTexture* rt = GPUDevice::Instance->CreateTransientTexture(name);
     if (rt->Init(desc))
     {
         Delete(rt);
         LOG(Error, "Cannot create temporary render target. Description: {0}", desc.ToString());
         return nullptr;
     }
+    GPUDevice::Instance->BeginTransientTexture(rt); // New texture is placed in the memory not used by the active targets
 
     // Create temporary rt entry
     Entry e;
@@ -98,6 +103,7 @@ void RenderTargetPool::Release(GPUTexture* rt)
             // Mark as free
             ASSERT(e.IsOccupied);
             e.IsOccupied = false;
+            GPUDevice::Instance->EndTransientTexture(rt);
             e.LastFrameReleased = Engine::FrameCount;
             return;
         }
@@ -4,6 +4,7 @@
 #include "RenderBuffers.h"
 #include "GPUDevice.h"
 #include "GPUSwapChain.h"
+#include "GPUTimerQuery.h"
 #include "PostProcessEffect.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Debug/DebugLog.h"
@@ -67,6 +68,10 @@ RenderTask::~RenderTask()
     TasksLocker.Lock();
     Tasks.Remove(this);
     TasksLocker.Unlock();
+
+    // Task can be still used by the pending present on the render thread
+    if (GPUDevice::Instance)
+        GPUDevice::Instance->WaitForPresent();
 }
 
 bool RenderTask::CanDraw() const
@@ -152,6 +157,8 @@ SceneRenderTask::~SceneRenderTask()
         Buffers->DeleteObjectNow();
     if (_customActorsScene)
         Delete(_customActorsScene);
+    for (auto& query : _dynamicResolutionQueries)
+        SAFE_DELETE_GPU_RESOURCE(query);
 }
 
 void SceneRenderTask::CameraCut()
@@ -372,6 +379,9 @@ void SceneRenderTask::OnBegin(GPUContext* context)
         View.CopyFrom(Camera, &viewport);
     }
 
+    // Adjust rendering resolution to the GPU performance
+    UpdateDynamicResolution();
+
     // Setup render buffers for the output rendering resolution
     if (Output)
     {
@@ -386,8 +396,25 @@ void SceneRenderTask::OnBegin(GPUContext* context)
 void SceneRenderTask::OnRender(GPUContext* context)
 {
     if (!IsCustomRendering && Buffers && Buffers->GetWidth() > 0)
+    {
+        // Measure the scene rendering time for the dynamic resolution
+        GPUTimerQuery* query = nullptr;
+        if (DynamicResolution)
+        {
+            auto& slot = _dynamicResolutionQueries[_dynamicResolutionQueryIndex];
+            if (!slot)
+                slot = GPUDevice::Instance->CreateTimerQuery();
+            query = slot;
+            _dynamicResolutionQueryIndex = (_dynamicResolutionQueryIndex + 1) % ARRAY_COUNT(_dynamicResolutionQueries);
+            query->Begin();
+        }
+
         Renderer::Render(this);
 
+        if (query)
+            query->End();
+    }
+
     RenderTask::OnRender(context);
 }
 
@@ -408,6 +435,57 @@ void SceneRenderTask::OnEnd(GPUContext* context)
     View.Projection = View.NonJitteredProjection;
 }
 
+void SceneRenderTask::UpdateDynamicResolution()
+{
+    if (!DynamicResolution)
+    {
+        _dynamicResolutionFrames = 0;
+        _dynamicResolutionTime = 0.0f;
+        return;
+    }
+    _dynamicResolutionFrames++;
+
+    // Use the oldest timer query (GPU runs a few frames behind the CPU so the latest ones are not ready yet)
+    GPUTimerQuery* query = _dynamicResolutionQueries[_dynamicResolutionQueryIndex];
+    if (!query || !query->HasResult())
+        return;
+    const float gpuTime = query->GetResult();
+
+    // Skip queries issued before the last resolution change
+    if (_dynamicResolutionFrames <= (int32)ARRAY_COUNT(_dynamicResolutionQueries))
+        return;
+    _dynamicResolutionTime = _dynamicResolutionTime > 0.0f ? Math::Lerp(_dynamicResolutionTime, gpuTime, 0.2f) : gpuTime;
+    const float targetTime = Math::Max(DynamicResolutionTargetTime, 1.0f);
+    const float minScale = Math::Clamp(DynamicResolutionMin, 0.1f, 1.0f);
+    const float maxScale = Math::Clamp(DynamicResolutionMax, minScale, 1.0f);
+
+    // GPU time scales linearly with the pixels count so resolution scale changes with a square root of the time ratio
+    float scale = RenderingPercentage;
+    if (gpuTime > targetTime * 0.95f)
+    {
+        // Drop resolution immediately when getting close to the budget (based on the latest time, not the average)
+        scale *= Math::Sqrt(targetTime * 0.85f / gpuTime);
+        scale = Math::Max(scale, RenderingPercentage - 0.2f);
+        scale = Math::Floor(scale * 20.0f) / 20.0f;
+    }
+    else if (_dynamicResolutionTime < targetTime * 0.75f && _dynamicResolutionFrames > DynamicResolutionIncreaseFrames)
+    {
+        // Raise resolution slowly (based on the average time) when there is enough headroom
+        scale *= Math::Sqrt(targetTime * 0.85f / Math::Max(_dynamicResolutionTime, 0.01f));
+        scale = Math::Min(scale, RenderingPercentage + 0.1f);
+        scale = Math::Floor(scale * 20.0f) / 20.0f;
+    }
+    scale = Math::Clamp(scale, minScale, maxScale);
+
+    // Snapping to the fixed steps prevents reallocating render buffers every frame
+    if (Math::NotNearEqual(scale, RenderingPercentage))
+    {
+        RenderingPercentage = scale;
+        _dynamicResolutionFrames = 0;
+        _dynamicResolutionTime = 0.0f;
+    }
+}
+
 bool SceneRenderTask::Resize(int32 width, int32 height)
 {
     if (Output && Output->Resize(width, height))
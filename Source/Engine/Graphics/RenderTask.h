@@ -101,7 +101,7 @@ API_CLASS() class FLAXENGINE_API RenderTask : public ScriptingObject
     API_EVENT() Delegate<RenderTask*, GPUContext*> End;
 
     /// <summary>
-    /// Action fired just after frame present.
+    /// Action fired just after frame present. When using frame pipelining the present happens on a render thread (see Graphics::EnableFramePipelining).
     /// </summary>
     API_EVENT() Delegate<RenderTask*> Present;
 
@@ -135,7 +135,7 @@ API_CLASS() class FLAXENGINE_API RenderTask : public ScriptingObject
     virtual void OnEnd(GPUContext* context);
 
     /// <summary>
-    /// Presents frame to the output.
+    /// Presents frame to the output. When using frame pipelining it's called on a render thread (see Graphics::EnableFramePipelining).
     /// </summary>
     /// <param name="vsync">True if use vertical synchronization to lock frame rate.</param>
     virtual void OnPresent(bool vsync);
@@ -202,6 +202,11 @@ API_ENUM() enum class RenderingUpscaleLocation
     /// The up-scaling happens before the post processing after scene rendering (after geometry, lighting, volumetrics, transparency and SSR/SSAO).
     /// </summary>
     BeforePostProcessingPass = 1,
+
+    /// <summary>
+    /// The up-scaling is performed by the Temporal Anti-Aliasing pass which reconstructs the output resolution image from the jittered lower resolution frames (happens before the post processing). Uses BeforePostProcessingPass location if Temporal Anti-Aliasing is not active.
+    /// </summary>
+    TemporalAntiAliasingPass = 2,
 };
 
 /// <summary>
@@ -213,6 +218,10 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     DECLARE_SCRIPTING_TYPE(SceneRenderTask);
 protected:
     class SceneRendering* _customActorsScene = nullptr;
+    class GPUTimerQuery* _dynamicResolutionQueries[3] = {};
+    int32 _dynamicResolutionQueryIndex = 0;
+    int32 _dynamicResolutionFrames = 0;
+    float _dynamicResolutionTime = 0.0f;
 
 public:
     /// <summary>
@@ -271,6 +280,31 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     /// </summary>
     API_FIELD() RenderingUpscaleLocation UpscaleLocation = RenderingUpscaleLocation::AfterAntiAliasingPass;
 
+    /// <summary>
+    /// If checked, the RenderingPercentage will be adjusted automatically (within DynamicResolutionMin-DynamicResolutionMax range) based on the GPU time of the task rendering to match the DynamicResolutionTargetTime. Use with TemporalAntiAliasingPass upscale location to reconstruct the full output resolution.
+    /// </summary>
+    API_FIELD() bool DynamicResolution = false;
+
+    /// <summary>
+    /// The target GPU time (in milliseconds) of the task rendering used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionTargetTime = 16.0f;
+
+    /// <summary>
+    /// The minimum rendering resolution scale used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMin = 0.5f;
+
+    /// <summary>
+    /// The maximum rendering resolution scale used by the dynamic resolution.
+    /// </summary>
+    API_FIELD() float DynamicResolutionMax = 1.0f;
+
+    /// <summary>
+    /// The minimum amount of frames between increasing the rendering resolution by the dynamic resolution. Resolution is decreased as soon as the GPU time gets over the budget to prevent frame drops, but raised back slowly to reduce render buffers reallocations.
+    /// </summary>
+    API_FIELD() int32 DynamicResolutionIncreaseFrames = 30;
+
 public:
     /// <summary>
     /// The custom set of actors to render. Used when ActorsSources::CustomActors flag is active.
@@ -410,6 +444,9 @@ API_CLASS() class FLAXENGINE_API SceneRenderTask : public RenderTask
     void OnBegin(GPUContext* context) override;
     void OnRender(GPUContext* context) override;
     void OnEnd(GPUContext* context) override;
+
+private:
+    void UpdateDynamicResolution();
 };
 
 /// <summary>
@@ -514,6 +551,11 @@ API_STRUCT(NoDefault) struct RenderContextBatch
     /// </summary>
     API_FIELD() bool EnableAsync = true;
 
+    /// <summary>
+    /// Enables GPU-driven rendering of the static models (objects that are culled and drawn on GPU are skipped when collecting draw calls).
+    /// </summary>
+    API_FIELD() bool EnableGPUDriven = false;
+
     RenderContextBatch() = default;
     RenderContextBatch(SceneRenderTask* task);
     RenderContextBatch(const RenderContext& context);
@@ -13,6 +13,9 @@
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Engine/Time.h"
 
+// The relative margin of the object screen size around the LOD switch threshold within which the previous LOD is kept (prevents LOD popping)
+#define MODEL_LOD_HYSTERESIS 0.1f
+
 const Char* ToString(RendererType value)
 {
     const Char* result;
@@ -438,6 +441,32 @@ int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, flo
     return 0;
 }
 
+int32 RenderTools::ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext, int32 prevLOD)
+{
+    const int32 lodIndex = ComputeModelLOD(model, origin, radius, renderContext);
+    if (prevLOD < 0 || lodIndex < 0 || lodIndex == prevLOD || prevLOD >= model->LODs.Count())
+        return lodIndex;
+
+    // Keep the previous LOD until the screen size goes past the switch threshold by the hysteresis margin
+    const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
+    const float screenRadiusSquared = ComputeBoundsScreenRadiusSquared(origin, radius, *lodView) * renderContext.View.ModelLODDistanceFactorSqrt;
+    if (lodIndex > prevLOD)
+    {
+        // Switching to the lower quality LOD (object got smaller than the threshold)
+        const float threshold = Math::Square(model->LODs[lodIndex].ScreenSize * 0.5f);
+        if (screenRadiusSquared > threshold * Math::Square(1.0f - MODEL_LOD_HYSTERESIS))
+            return prevLOD;
+    }
+    else
+    {
+        // Switching to the higher quality LOD (object got bigger than the threshold)
+        const float threshold = Math::Square(model->LODs[prevLOD].ScreenSize * 0.5f);
+        if (screenRadiusSquared < threshold * Math::Square(1.0f + MODEL_LOD_HYSTERESIS))
+            return prevLOD;
+    }
+    return lodIndex;
+}
+
 int32 RenderTools::ComputeSkinnedModelLOD(const SkinnedModel* model, const Float3& origin, float radius, const RenderContext& renderContext)
 {
     const auto lodView = (renderContext.LodProxyView ? renderContext.LodProxyView : &renderContext.View);
@@ -90,6 +90,17 @@ API_CLASS(Static) class FLAXENGINE_API RenderTools
     /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
     API_FUNCTION() static int32 ComputeModelLOD(const Model* model, API_PARAM(Ref) const Float3& origin, float radius, API_PARAM(Ref) const RenderContext& renderContext);
 
+    /// <summary>
+    /// Computes the model LOD index to use during rendering. Applies the hysteresis to the LOD switch thresholds to prevent LOD popping when the object screen size oscillates around the threshold.
+    /// </summary>
+    /// <param name="model">The model.</param>
+    /// <param name="origin">The bounds origin.</param>
+    /// <param name="radius">The bounds radius.</param>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="prevLOD">The LOD index selected for the object in the previous frame (or -1 if unknown).</param>
+    /// <returns>The zero-based LOD index. Returns -1 if model should not be rendered.</returns>
+    static int32 ComputeModelLOD(const Model* model, const Float3& origin, float radius, const RenderContext& renderContext, int32 prevLOD);
+
     /// <summary>
     /// Computes the skinned model LOD index to use during rendering.
     /// </summary>
@@ -21,8 +21,11 @@ void RenderView::Prepare(RenderContext& renderContext)
     IsTaaResolved = false;
     if (renderContext.List->Setup.UseTemporalAAJitter)
     {
-        // Move to the next frame
-        const int MaxSampleCount = 8;
+        // Move to the next frame (temporal upscaling uses longer jitter sequence to cover all output pixels with the lower resolution samples)
+        int32 MaxSampleCount = 8;
+        const SceneRenderTask* task = renderContext.Task;
+        if (task && task->RenderingPercentage < 1.0f && task->UpscaleLocation == RenderingUpscaleLocation::TemporalAntiAliasingPass)
+            MaxSampleCount = Math::Clamp((int32)Math::Ceil(8.0f / (task->RenderingPercentage * task->RenderingPercentage)), 8, 64);
         if (++TaaFrameIndex >= MaxSampleCount)
             TaaFrameIndex = 0;
 
@@ -16,6 +16,7 @@ class Camera;
 class RenderList;
 class RenderTask;
 class SceneRenderTask;
+class HZBOcclusion;
 
 /// <summary>
 /// Rendering view description that defines how to render the objects (camera placement, rendering properties, etc.).
@@ -225,6 +226,11 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API RenderView
     /// </summary>
     API_FIELD() float ModelLODDistanceFactorSqrt;
 
+    /// <summary>
+    /// The occlusion culling data (hierarchical depth buffer from the previous frames) used to skip drawing objects hidden behind other geometry. Null if view doesn't use occlusion culling.
+    /// </summary>
+    const HZBOcclusion* Occlusion = nullptr;
+
     /// <summary>
     /// Prepares view for rendering a scene. Called before rendering so other parts can reuse calculated value.
     /// </summary>
@@ -6,6 +6,7 @@
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Utilities/Crc.h"
 
 GPUShaderProgramsContainer::GPUShaderProgramsContainer()
     : _shaders(64)
@@ -119,6 +120,7 @@ bool GPUShader::Create(MemoryReadStream& stream)
 
             // Read bindings
             stream.ReadBytes(&initializer.Bindings, sizeof(ShaderBindings));
+            initializer.Hash = Crc::MemCrc32(cache, cacheSize);
 
             // Create shader program
             if (type == ShaderStage::Compute && !hasCompute)
@@ -39,6 +39,7 @@ struct GPUShaderProgramInitializer
     StringAnsi Name;
     ShaderBindings Bindings;
     ShaderFlags Flags;
+    uint32 Hash;
 #if !BUILD_RELEASE
     GPUShader* Owner;
 #endif
@@ -53,6 +54,7 @@ class FLAXENGINE_API GPUShaderProgram
     StringAnsi _name;
     ShaderBindings _bindings;
     ShaderFlags _flags;
+    uint32 _hash;
 #if !BUILD_RELEASE
     GPUShader* _owner;
 #endif
@@ -62,6 +64,7 @@ class FLAXENGINE_API GPUShaderProgram
         _name = initializer.Name;
         _bindings = initializer.Bindings;
         _flags = initializer.Flags;
+        _hash = initializer.Hash;
 #if !BUILD_RELEASE
         _owner = initializer.Owner;
 #endif
@@ -100,6 +103,14 @@ class FLAXENGINE_API GPUShaderProgram
         return _flags;
     }
 
+    /// <summary>
+    /// Gets the hash of the shader program bytecode. It's stable across the game sessions (can be used to identify the program in the persistent caches).
+    /// </summary>
+    FORCE_INLINE uint32 GetHash() const
+    {
+        return _hash;
+    }
+
 public:
     /// <summary>
     /// Gets shader program stage type.
@@ -146,6 +146,44 @@ uint64 StreamingTexture::GetTotalMemoryUsage() const
     return RenderTools::CalculateTextureMemoryUsage(_header.Format, _header.Width, _header.Height, _header.MipLevels) * arraySize;
 }
 
+void StreamingTexture::ReportFeedback(float size) const
+{
+    const int32 mipLevels = _header.MipLevels;
+    if (mipLevels <= 0)
+        return;
+
+    // Find the smallest mip that covers the given screen size
+    const float maxSize = (float)Math::Max(_header.Width, _header.Height);
+    const int32 mipIndex = size >= maxSize ? 0 : Math::FloorToInt(Math::Log2(maxSize / Math::Max(size, 1.0f)));
+    ReportFeedbackResidency(mipLevels - mipIndex);
+}
+
+void StreamingTexture::ReportFeedbackResidency(int32 residency) const
+{
+    const int32 mipLevels = _header.MipLevels;
+    if (mipLevels <= 0)
+        return;
+    residency = Math::Clamp(residency, 1, mipLevels);
+
+    // Keep the highest value reported
+    int64 prev = Platform::AtomicRead(&_feedbackResidency);
+    while (residency > prev)
+    {
+        const int64 value = Platform::InterlockedCompareExchange(&_feedbackResidency, (int64)residency, prev);
+        if (value == prev)
+            break;
+        prev = value;
+    }
+}
+
+int32 StreamingTexture::ConsumeFeedback()
+{
+    const int32 residency = (int32)Platform::InterlockedExchange(&_feedbackResidency, 0);
+    if (residency > 0)
+        _lastFeedbackResidency = residency;
+    return _lastFeedbackResidency;
+}
+
 String StreamingTexture::ToString() const
 {
     return _texture->ToString();
@@ -166,6 +204,15 @@ int32 StreamingTexture::GetAllocatedResidency() const
     return _texture->MipLevels();
 }
 
+uint64 StreamingTexture::GetMemoryUsage(int32 residency) const
+{
+    if (residency <= 0)
+        return 0;
+    const int32 mipIndex = _header.MipLevels - residency;
+    const uint64 arraySize = _header.IsCubeMap ? 6 : 1;
+    return RenderTools::CalculateTextureMemoryUsage(_header.Format, Math::Max(_header.Width >> mipIndex, 1), Math::Max(_header.Height >> mipIndex, 1), residency) * arraySize;
+}
+
 bool StreamingTexture::CanBeUpdated() const
 {
     // Streaming Texture cannot be updated if:
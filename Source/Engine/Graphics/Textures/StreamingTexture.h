@@ -22,6 +22,9 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     int32 _minMipCountBlockCompressed;
     bool _isBlockCompressed;
     Array<Task*, FixedAllocation<16>> _streamingTasks;
+    mutable volatile int64 _feedbackResidency = 0;
+    int32 _lastFeedbackResidency = 0;
+    mutable bool _forceFeedback = false;
 
 public:
     StreamingTexture(ITextureOwner* owner, const String& name);
@@ -156,6 +159,41 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     /// <returns>The amount of bytes.</returns>
     uint64 GetTotalMemoryUsage() const;
 
+    /// <summary>
+    /// Reports the rendering feedback for the texture streaming (see TextureGroup::UseRenderingFeedback). Called when drawing the geometry that uses this texture. Thread-safe.
+    /// </summary>
+    /// <param name="size">The size of the geometry on the screen (in pixels).</param>
+    void ReportFeedback(float size) const;
+
+    /// <summary>
+    /// Reports the rendering feedback for the texture streaming (see TextureGroup::UseRenderingFeedback) with the residency needed by the rendering. Thread-safe.
+    /// </summary>
+    /// <param name="residency">The mip levels count needed by the rendering.</param>
+    void ReportFeedbackResidency(int32 residency) const;
+
+    /// <summary>
+    /// Gets a value indicating whether the rendering feedback limits this texture quality regardless of the texture group options.
+    /// </summary>
+    FORCE_INLINE bool GetForceFeedback() const
+    {
+        return _forceFeedback;
+    }
+
+    /// <summary>
+    /// Sets a value indicating whether the rendering feedback limits this texture quality regardless of the texture group options. Can be used by the systems that manage own textures (eg. terrain heightmaps and splatmaps).
+    /// </summary>
+    /// <param name="value">True if use the rendering feedback, otherwise false.</param>
+    FORCE_INLINE void SetForceFeedback(bool value) const
+    {
+        _forceFeedback = value;
+    }
+
+    /// <summary>
+    /// Gets the residency needed by the rendering (the highest one reported since the last call). Returns the last reported value if there was no feedback since the last call or 0 if texture has never reported any feedback.
+    /// </summary>
+    /// <returns>The mip levels count needed by the rendering.</returns>
+    int32 ConsumeFeedback();
+
 public:
     FORCE_INLINE GPUTexture* operator->() const
     {
@@ -170,6 +208,7 @@ class FLAXENGINE_API StreamingTexture : public Object, public StreamableResource
     int32 GetMaxResidency() const override;
     int32 GetCurrentResidency() const override;
     int32 GetAllocatedResidency() const override;
+    uint64 GetMemoryUsage(int32 residency) const override;
     bool CanBeUpdated() const override;
     Task* UpdateAllocation(int32 residency) override;
     Task* CreateStreamingTask(int32 residency) override;
@@ -409,7 +409,7 @@ void GPUContextDX11::BindIB(GPUBuffer* indexBuffer)
     if (ibDX11 != _ibHandle)
     {
         _ibHandle = ibDX11;
-        _context->IASetIndexBuffer(ibDX11->GetBuffer(), RenderToolsDX::ToDxgiFormat(ibDX11->GetFormat()), 0);
+        _context->IASetIndexBuffer(ibDX11->GetBuffer(), ibDX11->GetStride() == 4 ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT, 0);
     }
 }
 
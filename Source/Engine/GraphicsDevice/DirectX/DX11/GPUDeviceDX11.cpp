@@ -363,6 +363,9 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = true;
             limits.HasMultisampleDepthAsSRV = true;
             limits.HasTypedUAVLoad = featureDataD3D11Options2.TypedUAVLoadAdditionalFormats != 0;
+            limits.HasBindless = false;
+            limits.HasVariableRateShading = false;
+            limits.HasPipelineStatistics = true;
             limits.MaximumMipLevelsCount = D3D11_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D11_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D11_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -371,6 +374,7 @@ bool GPUDeviceDX11::Init()
             limits.MaximumTexture3DSize = D3D11_REQ_TEXTURE3D_U_V_OR_W_DIMENSION;
             limits.MaximumTextureCubeSize = D3D11_REQ_TEXTURECUBE_DIMENSION;
             limits.MaximumSamplerAnisotropy = D3D11_DEFAULT_MAX_ANISOTROPY;
+            limits.VariableRateShadingTileSize = 0;
         }
         else
         {
@@ -387,6 +391,9 @@ bool GPUDeviceDX11::Init()
             limits.HasReadOnlyDepth = createdFeatureLevel == D3D_FEATURE_LEVEL_10_1;
             limits.HasMultisampleDepthAsSRV = false;
             limits.HasTypedUAVLoad = false;
+            limits.HasBindless = false;
+            limits.HasVariableRateShading = false;
+            limits.HasPipelineStatistics = true;
             limits.MaximumMipLevelsCount = D3D10_REQ_MIP_LEVELS;
             limits.MaximumTexture1DSize = D3D10_REQ_TEXTURE1D_U_DIMENSION;
             limits.MaximumTexture1DArraySize = D3D10_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -395,6 +402,7 @@ bool GPUDeviceDX11::Init()
             limits.MaximumTexture3DSize = D3D10_REQ_TEXTURE3D_U_V_OR_W_DIMENSION;
             limits.MaximumTextureCubeSize = D3D10_REQ_TEXTURECUBE_DIMENSION;
             limits.MaximumSamplerAnisotropy = D3D10_DEFAULT_MAX_ANISOTROPY;
+            limits.VariableRateShadingTileSize = 0;
         }
 
         for (int32 i = 0; i < static_cast<int32>(PixelFormat::MAX); i++)
@@ -43,6 +43,8 @@ GPUTimerQueryDX11::~GPUTimerQueryDX11()
         _endQuery->Release();
     if (_disjointQuery)
         _disjointQuery->Release();
+    if (_statsQuery)
+        _statsQuery->Release();
 }
 
 void GPUTimerQueryDX11::OnReleaseGPU()
@@ -50,6 +52,8 @@ void GPUTimerQueryDX11::OnReleaseGPU()
     SAFE_RELEASE(_beginQuery);
     SAFE_RELEASE(_endQuery);
     SAFE_RELEASE(_disjointQuery);
+    SAFE_RELEASE(_statsQuery);
+    _statsStarted = false;
 }
 
 ID3D11Resource* GPUTimerQueryDX11::GetResource()
@@ -63,6 +67,25 @@ void GPUTimerQueryDX11::Begin()
     context->Begin(_disjointQuery);
     context->End(_beginQuery);
 
+    // Create pipeline statistics query on demand (used only by profiler when enabled)
+    _statsStarted = false;
+    if (CollectPipelineStatistics)
+    {
+        if (!_statsQuery)
+        {
+            D3D11_QUERY_DESC queryDesc;
+            queryDesc.Query = D3D11_QUERY_PIPELINE_STATISTICS;
+            queryDesc.MiscFlags = 0;
+            if (FAILED(_device->GetDevice()->CreateQuery(&queryDesc, &_statsQuery)))
+                _statsQuery = nullptr;
+        }
+        if (_statsQuery)
+        {
+            context->Begin(_statsQuery);
+            _statsStarted = true;
+        }
+    }
+
     _endCalled = false;
 }
 
@@ -72,6 +95,8 @@ void GPUTimerQueryDX11::End()
         return;
 
     auto context = _device->GetIM();
+    if (_statsStarted)
+        context->End(_statsQuery);
     context->End(_endQuery);
     context->End(_disjointQuery);
 
@@ -85,7 +110,10 @@ bool GPUTimerQueryDX11::HasResult()
         return false;
 
     D3D11_QUERY_DATA_TIMESTAMP_DISJOINT disjointData;
-    return _device->GetIM()->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) == S_OK;
+    auto context = _device->GetIM();
+    if (_statsStarted && context->GetData(_statsQuery, nullptr, 0, 0) != S_OK)
+        return false;
+    return context->GetData(_disjointQuery, &disjointData, sizeof(disjointData), 0) == S_OK;
 }
 
 float GPUTimerQueryDX11::GetResult()
@@ -128,4 +156,23 @@ float GPUTimerQueryDX11::GetResult()
     return _timeDelta;
 }
 
+bool GPUTimerQueryDX11::GetPipelineStatistics(GPUPipelineStatistics& result)
+{
+    if (!_statsStarted || !_endCalled)
+        return false;
+    D3D11_QUERY_DATA_PIPELINE_STATISTICS data;
+    if (_device->GetIM()->GetData(_statsQuery, &data, sizeof(data), 0) != S_OK)
+        return false;
+    result.InputVertices = data.IAVertices;
+    result.InputPrimitives = data.IAPrimitives;
+    result.VSInvocations = data.VSInvocations;
+    result.GSInvocations = data.GSInvocations;
+    result.RasterizedPrimitives = data.CPrimitives;
+    result.PSInvocations = data.PSInvocations;
+    result.HSInvocations = data.HSInvocations;
+    result.DSInvocations = data.DSInvocations;
+    result.CSInvocations = data.CSInvocations;
+    return true;
+}
+
 #endif
@@ -146,6 +146,11 @@ void CommandQueueDX12::WaitForGPU()
     _fence.WaitCPU(value);
 }
 
+void CommandQueueDX12::WaitForQueue(CommandQueueDX12* queue, uint64 fenceValue)
+{
+    queue->_fence.WaitGPU(this, fenceValue);
+}
+
 uint64 CommandQueueDX12::ExecuteCommandList(ID3D12CommandList* list)
 {
     VALIDATE_DIRECTX_CALL((static_cast<ID3D12GraphicsCommandList*>(list))->Close());
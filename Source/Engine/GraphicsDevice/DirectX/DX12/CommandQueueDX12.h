@@ -184,6 +184,13 @@ class CommandQueueDX12
     /// </summary>
     void WaitForGPU();
 
+    /// <summary>
+    /// Inserts the GPU-side wait for the other queue to step over given fence value (commands submitted to this queue after that are executed once the other queue reaches the fence).
+    /// </summary>
+    /// <param name="queue">The other queue to wait for.</param>
+    /// <param name="fenceValue">The fence value of the other queue to wait.</param>
+    void WaitForQueue(CommandQueueDX12* queue, uint64 fenceValue);
+
 public:
 
     /// <summary>
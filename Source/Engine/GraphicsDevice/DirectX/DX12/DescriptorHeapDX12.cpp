@@ -4,7 +4,9 @@
 
 #include "DescriptorHeapDX12.h"
 #include "GPUDeviceDX12.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
 
 D3D12_CPU_DESCRIPTOR_HANDLE DescriptorHeapWithSlotsDX12::Slot::CPU() const
 {
@@ -23,6 +25,17 @@ void DescriptorHeapWithSlotsDX12::Slot::CreateSRV(GPUDeviceDX12* device, ID3D12R
     if (Heap == nullptr)
         device->Heap_CBV_SRV_UAV.AllocateSlot(Heap, Index);
     device->GetDevice()->CreateShaderResourceView(resource, desc, CPU());
+
+    // Copy descriptor into the bindless table (use a new index as the old one can be still in use by the GPU)
+    if (device->Limits.HasBindless)
+    {
+        if (BindlessIndex != MAX_uint32)
+            device->RingHeap_CBV_SRV_UAV.ReleaseStatic(BindlessIndex);
+        if (device->RingHeap_CBV_SRV_UAV.AllocateStatic(BindlessIndex))
+            BindlessIndex = MAX_uint32;
+        else
+            device->GetDevice()->CopyDescriptorsSimple(1, device->RingHeap_CBV_SRV_UAV.CPU(BindlessIndex), CPU(), D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
+    }
 }
 
 void DescriptorHeapWithSlotsDX12::Slot::CreateRTV(GPUDeviceDX12* device, ID3D12Resource* resource, D3D12_RENDER_TARGET_VIEW_DESC* desc)
@@ -50,6 +63,11 @@ void DescriptorHeapWithSlotsDX12::Slot::Release()
 {
     if (Heap)
     {
+        if (BindlessIndex != MAX_uint32)
+        {
+            Heap->_device->RingHeap_CBV_SRV_UAV.ReleaseStatic(BindlessIndex);
+            BindlessIndex = MAX_uint32;
+        }
         Heap->ReleaseSlot(Index);
         Heap = nullptr;
     }
@@ -178,13 +196,16 @@ void DescriptorHeapWithSlotsDX12::OnReleaseGPU()
     _descriptorsCount = 0;
 }
 
-DescriptorHeapRingBufferDX12::DescriptorHeapRingBufferDX12(GPUDeviceDX12* device, D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 descriptorsCount, bool shaderVisible)
+DescriptorHeapRingBufferDX12::DescriptorHeapRingBufferDX12(GPUDeviceDX12* device, D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 descriptorsCount, bool shaderVisible, uint32 staticDescriptorsCount)
     : _device(device)
     , _heap(nullptr)
     , _type(type)
     , _descriptorsCount(descriptorsCount)
+    , _staticCount(staticDescriptorsCount)
     , _shaderVisible(shaderVisible)
+    , _staticNext(0)
 {
+    ASSERT(_staticCount < _descriptorsCount);
 }
 
 bool DescriptorHeapRingBufferDX12::Init()
@@ -199,7 +220,8 @@ bool DescriptorHeapRingBufferDX12::Init()
     LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
 
     // Setup
-    _firstFree = 0;
+    _firstFree = _staticCount;
+    _staticNext = 0;
     _beginCPU = _heap->GetCPUDescriptorHandleForHeapStart();
     if (_shaderVisible)
         _beginGPU = _heap->GetGPUDescriptorHandleForHeapStart();
@@ -214,6 +236,7 @@ bool DescriptorHeapRingBufferDX12::Init()
 DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateTable(uint32 numDesc)
 {
     Allocation result;
+    ScopeLock lock(_locker);
 
     // Move the ring buffer pointer
     uint32 index = _firstFree;
@@ -222,9 +245,9 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
     // Check for overflow
     if (_firstFree >= _descriptorsCount)
     {
-        // Move to the begin
-        index = 0;
-        _firstFree = numDesc;
+        // Move to the begin (after the static descriptors)
+        index = _staticCount;
+        _firstFree = _staticCount + numDesc;
     }
 
     // Set pointers
@@ -234,10 +257,47 @@ DescriptorHeapRingBufferDX12::Allocation DescriptorHeapRingBufferDX12::AllocateT
     return result;
 }
 
+bool DescriptorHeapRingBufferDX12::AllocateStatic(uint32& index)
+{
+    ScopeLock lock(_locker);
+
+    // Reuse the released descriptors that are no longer used by the GPU
+    const uint64 frame = Engine::FrameCount;
+    for (int32 i = 0; i < _staticPendingFree.Count(); i++)
+    {
+        if (_staticPendingFree[i].Second <= frame)
+        {
+            _staticFree.Add(_staticPendingFree[i].First);
+            _staticPendingFree.RemoveAtKeepOrder(i--);
+        }
+    }
+    if (_staticFree.HasItems())
+    {
+        index = _staticFree.Pop();
+        return false;
+    }
+    if (_staticNext < _staticCount)
+    {
+        index = _staticNext++;
+        return false;
+    }
+    return true;
+}
+
+void DescriptorHeapRingBufferDX12::ReleaseStatic(uint32 index)
+{
+    ScopeLock lock(_locker);
+    ASSERT_LOW_LAYER(index < _staticCount);
+    _staticPendingFree.Add(ToPair(index, Engine::FrameCount + DX12_BACK_BUFFER_COUNT + 1));
+}
+
 void DescriptorHeapRingBufferDX12::OnReleaseGPU()
 {
     DX_SAFE_RELEASE_CHECK(_heap, 0);
     _firstFree = 0;
+    _staticNext = 0;
+    _staticFree.Resize(0);
+    _staticPendingFree.Resize(0);
 }
 
 #endif
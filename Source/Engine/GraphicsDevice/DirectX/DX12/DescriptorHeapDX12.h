@@ -5,7 +5,9 @@
 #if GRAPHICS_API_DIRECTX12
 
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Types/Pair.h"
 #include "Engine/Graphics/GPUResource.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "../IncludeDirectXHeaders.h"
 
 class DescriptorHeapPoolDX12;
@@ -22,6 +24,7 @@ class DescriptorHeapWithSlotsDX12 : public GPUResource
     {
         DescriptorHeapWithSlotsDX12* Heap = nullptr;
         uint32 Index;
+        uint32 BindlessIndex = MAX_uint32; // Index of the descriptor copy in the bindless descriptors table (static part of the shader-visible ring buffer heap)
 
         FORCE_INLINE bool IsValid() const
         {
@@ -151,11 +154,16 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
     uint32 _incrementSize;
     uint32 _descriptorsCount;
     uint32 _firstFree;
+    uint32 _staticCount;
     bool _shaderVisible;
+    CriticalSection _locker;
+    Array<uint32> _staticFree;
+    Array<Pair<uint32, uint64>> _staticPendingFree;
+    uint32 _staticNext;
 
 public:
 
-    DescriptorHeapRingBufferDX12(GPUDeviceDX12* device, D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 descriptorsCount, bool shaderVisible);
+    DescriptorHeapRingBufferDX12(GPUDeviceDX12* device, D3D12_DESCRIPTOR_HEAP_TYPE type, uint32 descriptorsCount, bool shaderVisible, uint32 staticDescriptorsCount = 0);
 
 public:
 
@@ -164,9 +172,37 @@ class DescriptorHeapRingBufferDX12 : public GPUResource
         return _heap;
     }
 
+    FORCE_INLINE D3D12_CPU_DESCRIPTOR_HANDLE CPU(uint32 index) const
+    {
+        D3D12_CPU_DESCRIPTOR_HANDLE handle;
+        handle.ptr = _beginCPU.ptr + (SIZE_T)(index * _incrementSize);
+        return handle;
+    }
+
+    /// <summary>
+    /// Gets the GPU handle to the begin of the static descriptors range (used as a bindless descriptors table).
+    /// </summary>
+    FORCE_INLINE D3D12_GPU_DESCRIPTOR_HANDLE GetStaticGPU() const
+    {
+        return _beginGPU;
+    }
+
     bool Init();
     Allocation AllocateTable(uint32 numDesc);
 
+    /// <summary>
+    /// Allocates the single descriptor within the static heap range (persistent, not overriden by the ring buffer tables).
+    /// </summary>
+    /// <param name="index">The output descriptor index (from the heap start).</param>
+    /// <returns>True if failed (eg. static range is full), otherwise false.</returns>
+    bool AllocateStatic(uint32& index);
+
+    /// <summary>
+    /// Releases the static descriptor. Descriptor gets reused after a few frames to ensure GPU doesn't access it anymore.
+    /// </summary>
+    /// <param name="index">The descriptor index (from the heap start).</param>
+    void ReleaseStatic(uint32 index);
+
 public:
 
     // [GPUResourceDX12]
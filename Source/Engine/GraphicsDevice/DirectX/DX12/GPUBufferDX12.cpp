@@ -115,31 +115,29 @@ bool GPUBufferDX12::OnInit()
         resourceDesc.Flags |= D3D12XBOX_RESOURCE_FLAG_ALLOW_INDIRECT_BUFFER;
 #endif
 
-    // Create allocation description
-    D3D12_HEAP_PROPERTIES heapProperties;
+    // Pick the memory heap type
+    D3D12_HEAP_TYPE heapType;
     switch (_desc.Usage)
     {
     case GPUResourceUsage::StagingUpload:
-        heapProperties.Type = D3D12_HEAP_TYPE_UPLOAD;
+        heapType = D3D12_HEAP_TYPE_UPLOAD;
         break;
     case GPUResourceUsage::StagingReadback:
-        heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
+        heapType = D3D12_HEAP_TYPE_READBACK;
         break;
     default:
-        heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
+        heapType = D3D12_HEAP_TYPE_DEFAULT;
     }
-    heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-    heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-    heapProperties.CreationNodeMask = 1;
-    heapProperties.VisibleNodeMask = 1;
 
     // Create resource
     ID3D12Resource* resource;
+    HeapAllocationDX12 allocation;
     D3D12_RESOURCE_STATES initialState = D3D12_RESOURCE_STATE_COMMON;
-    VALIDATE_DIRECTX_CALL(_device->GetDevice()->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, nullptr, IID_PPV_ARGS(&resource)));
+    VALIDATE_DIRECTX_CALL(_device->HeapAllocator.CreateResource(heapType, resourceDesc, initialState, nullptr, &resource, allocation));
 
     // Set state
     initResource(resource, initialState, 1);
+    _allocation = allocation;
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = _desc.Size;
     int32 numElements = _desc.GetElementsCount();
@@ -83,6 +83,10 @@ class GPUBufferViewDX12 : public GPUBufferView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() const override
+    {
+        return _srv.BindlessIndex != MAX_uint32 ? (int32)_srv.BindlessIndex : -1;
+    }
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
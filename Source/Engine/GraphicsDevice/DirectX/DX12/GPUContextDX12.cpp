@@ -58,10 +58,14 @@ static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartIndex) == OFFSET_OF(D3D
 static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartVertex) == OFFSET_OF(D3D12_DRAW_INDEXED_ARGUMENTS, BaseVertexLocation), "Wrong offset for GPUDrawIndexedIndirectArgs::StartVertex");
 static_assert(OFFSET_OF(GPUDrawIndexedIndirectArgs, StartInstance) == OFFSET_OF(D3D12_DRAW_INDEXED_ARGUMENTS, StartInstanceLocation), "Wrong offset for GPUDrawIndexedIndirectArgs::StartInstance");
 
-GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type)
+GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type, bool isDeferred)
     : GPUContext(device)
     , _device(device)
+    , _queue(type == D3D12_COMMAND_LIST_TYPE_COMPUTE ? device->GetComputeQueue() : type == D3D12_COMMAND_LIST_TYPE_COPY ? device->GetCopyQueue() : device->GetCommandQueue())
     , _commandList(nullptr)
+#if DX12_USE_VARIABLE_RATE_SHADING
+    , _commandList5(nullptr)
+#endif
     , _currentAllocator(nullptr)
     , _currentState(nullptr)
     , _currentCompute(nullptr)
@@ -80,17 +84,31 @@ GPUContextDX12::GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE ty
     , _rtDepth(nullptr)
     , _ibHandle(nullptr)
 {
+    _isDeferred = isDeferred;
+    _isAsyncCompute = type == D3D12_COMMAND_LIST_TYPE_COMPUTE;
+    _isAsyncCopy = type == D3D12_COMMAND_LIST_TYPE_COPY;
     FrameFenceValues[0] = 0;
     FrameFenceValues[1] = 0;
-    _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+    _currentAllocator = _queue->RequestAllocator();
     VALIDATE_DIRECTX_CALL(device->GetDevice()->CreateCommandList(0, type, _currentAllocator, nullptr, IID_PPV_ARGS(&_commandList)));
 #if GPU_ENABLE_RESOURCE_NAMING
     _commandList->SetName(TEXT("GPUContextDX12::CommandList"));
 #endif
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (type == D3D12_COMMAND_LIST_TYPE_DIRECT && device->Limits.HasVariableRateShading)
+        _commandList->QueryInterface(IID_PPV_ARGS(&_commandList5));
+#endif
 }
 
 GPUContextDX12::~GPUContextDX12()
 {
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (_commandList5)
+    {
+        _commandList5->Release();
+        _commandList5 = nullptr;
+    }
+#endif
     DX_SAFE_RELEASE_CHECK(_commandList, 0);
 }
 
@@ -145,11 +163,76 @@ void GPUContextDX12::AddUAVBarrier()
 #endif
 }
 
+void GPUContextDX12::AddAliasingBarrier(ResourceOwnerDX12* resource)
+{
+    if (_rbBufferSize == DX12_RB_BUFFER_SIZE)
+        flushRBs();
+
+#if DX12_ENABLE_RESOURCE_BARRIERS_DEBUGGING
+    const auto info = String::Format(TEXT("[DX12 Resource Barrier]: Aliasing"));
+    Log::Logger::Write(LogType::Info, info);
+#endif
+
+    D3D12_RESOURCE_BARRIER barrier;
+    barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_ALIASING;
+    barrier.Flags = D3D12_RESOURCE_BARRIER_FLAG_NONE;
+    barrier.Aliasing.pResourceBefore = nullptr;
+    barrier.Aliasing.pResourceAfter = resource->GetResource();
+#if DX12_ENABLE_RESOURCE_BARRIERS_BATCHING
+    _rbBuffer[_rbBufferSize++] = barrier;
+#else
+    _commandList->ResourceBarrier(1, &barrier);
+#endif
+}
+
+void GPUContextDX12::initResourceMemory(ResourceOwnerDX12* resource)
+{
+    if (resource->_aliasOnFirstUse)
+    {
+        // Resource memory could be used by other resources so activate it first
+        resource->_aliasOnFirstUse = false;
+        AddAliasingBarrier(resource);
+    }
+    if (resource->_discardOnFirstUse)
+    {
+        // Render targets and depth buffers memory have to be initialized in the render target or depth write state
+        resource->_discardOnFirstUse = false;
+        const D3D12_RESOURCE_DESC desc = resource->GetResource()->GetDesc();
+        SetResourceState(resource, desc.Flags & D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL ? D3D12_RESOURCE_STATE_DEPTH_WRITE : D3D12_RESOURCE_STATE_RENDER_TARGET);
+        flushRBs();
+        _commandList->DiscardResource(resource->GetResource(), nullptr);
+    }
+}
+
 void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex)
 {
     auto nativeResource = resource->GetResource();
     if (nativeResource == nullptr)
         return;
+    if ((resource->_discardOnFirstUse || resource->_aliasOnFirstUse) && !_isDeferred && !_isAsyncCopy)
+    {
+        // Initialize the placed resource memory (deferred and copy contexts are handled by the main context before execution)
+        initResourceMemory(resource);
+    }
+    if (_isDeferred || _isAsyncCompute || _isAsyncCopy)
+    {
+        // Compute queue supports only non-pixel shader resource reads
+        if (_isAsyncCompute)
+            after &= ~(D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_DEPTH_READ);
+
+        // Track the whole resource state locally (the first state is transitioned by the main context before executing this context commands)
+        DeferredResourceState* deferredState = _deferredStates.TryGet(resource);
+        if (!deferredState)
+        {
+            _deferredStates.Add(resource, { after, after });
+        }
+        else if (ResourceStateDX12::IsTransitionNeeded(deferredState->Current, after))
+        {
+            AddTransitionBarrier(resource, deferredState->Current, after, D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+            deferredState->Current = after;
+        }
+        return;
+    }
     auto& state = resource->State;
     if (subresourceIndex == -1)
     {
@@ -202,13 +285,34 @@ void GPUContextDX12::SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURC
     }
 }
 
+void GPUContextDX12::SetResourceStateExact(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after)
+{
+    auto& state = resource->State;
+    if (!state.IsInitializated() || resource->GetResource() == nullptr)
+        return;
+    for (int32 i = 0; i < state.GetSubresourcesCount(); i++)
+    {
+        const D3D12_RESOURCE_STATES before = state.GetSubresourceState(i);
+        if (before != after)
+        {
+            if (state.AreAllSubresourcesSame())
+            {
+                AddTransitionBarrier(resource, before, after, D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES);
+                break;
+            }
+            AddTransitionBarrier(resource, before, after, i);
+        }
+    }
+    state.SetResourceState(after);
+}
+
 void GPUContextDX12::Reset()
 {
     // The command list persists, but we must request a new allocator
     ASSERT(_commandList != nullptr);
     if (_currentAllocator == nullptr)
     {
-        _currentAllocator = _device->GetCommandQueue()->RequestAllocator();
+        _currentAllocator = _queue->RequestAllocator();
         _commandList->Reset(_currentAllocator, nullptr);
     }
 
@@ -234,9 +338,12 @@ void GPUContextDX12::Reset()
     Platform::MemoryClear(_uaHandles, sizeof(_uaHandles));
     Platform::MemoryClear(_vbHandles, sizeof(_vbHandles));
     _ibHandle = nullptr;
+    _shadingRateImage = nullptr;
     Platform::MemoryClear(&_cbHandles, sizeof(_cbHandles));
     Platform::MemoryClear(&_samplers, sizeof(_samplers));
     _swapChainsUsed = 0;
+    _deferredStates.Clear();
+    _deferredCBs.Clear();
 
     ForceRebindDescriptors();
 }
@@ -244,7 +351,7 @@ void GPUContextDX12::Reset()
 uint64 GPUContextDX12::Execute(bool waitForCompletion)
 {
     ASSERT(_currentAllocator != nullptr);
-    auto queue = _device->GetCommandQueue();
+    auto queue = _queue;
 
     // Flush remaining and buffered commands
     FlushState();
@@ -285,6 +392,17 @@ void GPUContextDX12::GetActiveHeapDescriptor(const D3D12_CPU_DESCRIPTOR_HANDLE&
     _device->GetDevice()->CopyDescriptorsSimple(1, descriptor.CPU, cpuHandle, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 }
 
+D3D12_GPU_VIRTUAL_ADDRESS GPUContextDX12::GetCBAddress(GPUConstantBufferDX12* cb) const
+{
+    if (_isDeferred)
+    {
+        const D3D12_GPU_VIRTUAL_ADDRESS* address = _deferredCBs.TryGet(cb);
+        if (address)
+            return *address;
+    }
+    return cb->GPUAddress;
+}
+
 void GPUContextDX12::flushSRVs()
 {
     uint32 srMask;
@@ -459,8 +577,9 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                const D3D12_GPU_VIRTUAL_ADDRESS address = GetCBAddress(cb);
+                ASSERT(address != 0);
+                _commandList->SetGraphicsRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -472,8 +591,9 @@ void GPUContextDX12::flushCBs()
             const auto cb = _cbHandles[i];
             if (cb)
             {
-                ASSERT(cb->GPUAddress != 0);
-                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, cb->GPUAddress);
+                const D3D12_GPU_VIRTUAL_ADDRESS address = GetCBAddress(cb);
+                ASSERT(address != 0);
+                _commandList->SetComputeRootConstantBufferView(DX12_ROOT_SIGNATURE_CB + i, address);
             }
         }
     }
@@ -1010,7 +1130,10 @@ void GPUContextDX12::UpdateCB(GPUConstantBuffer* cb, const void* data)
     Platform::MemoryCopy(allocation.CPUAddress, data, allocation.Size);
 
     // Cache GPU address of the allocation
-    cbDX12->GPUAddress = allocation.GPUAddress;
+    if (_isDeferred)
+        _deferredCBs[cbDX12] = allocation.GPUAddress;
+    else
+        cbDX12->GPUAddress = allocation.GPUAddress;
 
     // Mark CB slot as dirty if this CB is binded to the pipeline
     for (uint32 i = 0; i < ARRAY_COUNT(_cbHandles); i++)
@@ -1164,6 +1287,32 @@ GPUPipelineState* GPUContextDX12::GetState() const
     return _currentState;
 }
 
+void GPUContextDX12::SetShadingRateImage(GPUTexture* rateImage)
+{
+#if DX12_USE_VARIABLE_RATE_SHADING
+    if (!_commandList5 || _shadingRateImage == rateImage)
+        return;
+    _shadingRateImage = rateImage;
+    if (rateImage)
+    {
+        ASSERT_LOW_LAYER(rateImage->Format() == PixelFormat::R8_UInt);
+        auto textureDX12 = static_cast<GPUTextureDX12*>(rateImage);
+        SetResourceState(textureDX12, D3D12_RESOURCE_STATE_SHADING_RATE_SOURCE);
+        flushRBs();
+
+        // Use the per-tile shading rate from the image (ignore per-draw and per-primitive rates)
+        const D3D12_SHADING_RATE_COMBINER combiners[D3D12_RS_SET_SHADING_RATE_COMBINER_COUNT] = { D3D12_SHADING_RATE_COMBINER_PASSTHROUGH, D3D12_SHADING_RATE_COMBINER_OVERRIDE };
+        _commandList5->RSSetShadingRate(D3D12_SHADING_RATE_1X1, combiners);
+        _commandList5->RSSetShadingRateImage(textureDX12->GetResource());
+    }
+    else
+    {
+        _commandList5->RSSetShadingRate(D3D12_SHADING_RATE_1X1, nullptr);
+        _commandList5->RSSetShadingRateImage(nullptr);
+    }
+#endif
+}
+
 void GPUContextDX12::SetState(GPUPipelineState* state)
 {
     if (_currentState != state)
@@ -1183,6 +1332,7 @@ void GPUContextDX12::ClearState()
     ResetUA();
     ResetCB();
     SetState(nullptr);
+    SetShadingRateImage(nullptr);
 
     FlushState();
 
@@ -1210,6 +1360,75 @@ void GPUContextDX12::Flush()
     Reset();
 }
 
+void GPUContextDX12::ExecuteDeferred(const Span<GPUContext*>& contexts)
+{
+    ASSERT(!_isDeferred);
+    for (GPUContext* e : contexts)
+    {
+        auto context = static_cast<GPUContextDX12*>(e);
+        ASSERT(context && context->IsDeferred());
+
+        // Transition resources into the states expected by the deferred commands
+        for (const auto& state : context->_deferredStates)
+            SetResourceState(state.Key, state.Value.First);
+
+        // Submit commands recorded so far to keep the order
+        Execute(false);
+        Reset();
+
+        // Submit deferred commands
+        context->Execute(false);
+        for (const auto& state : context->_deferredStates)
+            state.Key->State.SetResourceState(state.Value.Current);
+        context->Reset();
+    }
+}
+
+uint64 GPUContextDX12::Submit()
+{
+    ASSERT(!_isDeferred);
+    if (!_isAsyncCompute && !_isAsyncCopy)
+    {
+        const uint64 fenceValue = Execute(false);
+        Reset();
+        return fenceValue;
+    }
+
+    // Transition resources into the states expected by the async commands and submit the graphics commands recorded so far
+    auto mainContext = _device->GetMainContextDX12();
+    for (const auto& state : _deferredStates)
+    {
+        if (_isAsyncCopy && (state.Key->_discardOnFirstUse || state.Key->_aliasOnFirstUse))
+            mainContext->initResourceMemory(state.Key);
+        mainContext->SetResourceStateExact(state.Key, state.Value.First);
+    }
+    const uint64 graphicsFenceValue = mainContext->Execute(false);
+    mainContext->Reset();
+
+    // Submit async commands (executed after the graphics commands that use the same resources)
+    _queue->WaitForQueue(mainContext->_queue, graphicsFenceValue);
+    const uint64 fenceValue = Execute(false);
+    for (const auto& state : _deferredStates)
+    {
+        // Resources used on the copy queue decay to the common state after the commands execution
+        state.Key->State.SetResourceState(_isAsyncCopy ? D3D12_RESOURCE_STATE_COMMON : state.Value.Current);
+    }
+    Reset();
+    return fenceValue;
+}
+
+void GPUContextDX12::WaitForSyncPoint(GPUContext* context, uint64 syncPoint)
+{
+    auto other = static_cast<GPUContextDX12*>(context);
+    if (!other || syncPoint == 0 || other->_queue == _queue)
+        return;
+
+    // Submit commands recorded so far (only the commands submitted after the wait are blocked)
+    Execute(false);
+    Reset();
+    _queue->WaitForQueue(other->_queue, syncPoint);
+}
+
 void GPUContextDX12::UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset)
 {
     ASSERT(data);
@@ -1452,13 +1671,27 @@ void GPUContextDX12::SetResourceState(GPUResource* resource, uint64 state, int32
 
 void GPUContextDX12::ForceRebindDescriptors()
 {
+    // Copy queue doesn't use root signature nor descriptors
+    if (_isAsyncCopy)
+        return;
+
     // Bind Root Signature
-    _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
+    if (!_isAsyncCompute)
+        _commandList->SetGraphicsRootSignature(_device->GetRootSignature());
     _commandList->SetComputeRootSignature(_device->GetRootSignature());
 
     // Bind heaps
     ID3D12DescriptorHeap* ppHeaps[] = {_device->RingHeap_CBV_SRV_UAV.GetHeap(), _device->RingHeap_Sampler.GetHeap()};
     _commandList->SetDescriptorHeaps(ARRAY_COUNT(ppHeaps), ppHeaps);
+
+    // Bind bindless descriptors table
+    if (_device->Limits.HasBindless)
+    {
+        const D3D12_GPU_DESCRIPTOR_HANDLE bindless = _device->RingHeap_CBV_SRV_UAV.GetStaticGPU();
+        if (!_isAsyncCompute)
+            _commandList->SetGraphicsRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+        _commandList->SetComputeRootDescriptorTable(DX12_ROOT_SIGNATURE_BINDLESS, bindless);
+    }
 }
 
 #endif
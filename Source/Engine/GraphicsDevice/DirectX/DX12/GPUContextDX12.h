@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "IShaderResourceDX12.h"
 #include "DescriptorHeapDX12.h"
 #include "../IncludeDirectXHeaders.h"
@@ -21,6 +22,15 @@ class GPUTextureViewDX12;
 /// </summary>
 #define DX12_RB_BUFFER_SIZE 16
 
+/// <summary>
+/// Enables using Variable Rate Shading with the shading rate image (tier 2)
+/// </summary>
+#if PLATFORM_WINDOWS
+#define DX12_USE_VARIABLE_RATE_SHADING 1
+#else
+#define DX12_USE_VARIABLE_RATE_SHADING 0
+#endif
+
 /// <summary>
 /// GPU Commands Context implementation for DirectX 12
 /// </summary>
@@ -34,8 +44,18 @@ class GPUContextDX12 : public GPUContext
 
 private:
 
+    struct DeferredResourceState
+    {
+        D3D12_RESOURCE_STATES First;
+        D3D12_RESOURCE_STATES Current;
+    };
+
     GPUDeviceDX12* _device;
+    CommandQueueDX12* _queue;
     ID3D12GraphicsCommandList* _commandList;
+#if DX12_USE_VARIABLE_RATE_SHADING
+    ID3D12GraphicsCommandList5* _commandList5;
+#endif
     ID3D12CommandAllocator* _currentAllocator;
     GPUPipelineStateDX12* _currentState;
     GPUShaderProgramCS* _currentCompute;
@@ -69,9 +89,14 @@ class GPUContextDX12 : public GPUContext
     GPUConstantBufferDX12* _cbHandles[GPU_MAX_CB_BINDED];
     GPUSamplerDX12* _samplers[GPU_MAX_SAMPLER_BINDED - GPU_STATIC_SAMPLERS_COUNT];
 
+    // Deferred context tracks the resources states locally (the initial states are transitioned by the main context before executing the commands) and the constant buffers data (shared with other contexts recording in parallel)
+    // Async compute context tracks the resources states locally too (compute queue cannot transition from/to graphics-only states)
+    Dictionary<ResourceOwnerDX12*, DeferredResourceState> _deferredStates;
+    Dictionary<GPUConstantBufferDX12*, D3D12_GPU_VIRTUAL_ADDRESS> _deferredCBs;
+
 public:
 
-    GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type);
+    GPUContextDX12(GPUDeviceDX12* device, D3D12_COMMAND_LIST_TYPE type, bool isDeferred = false);
     ~GPUContextDX12();
 
 public:
@@ -99,6 +124,12 @@ class GPUContextDX12 : public GPUContext
     /// </summary>
     void AddUAVBarrier();
 
+    /// <summary>
+    /// Adds the aliasing barrier that activates the resource placed in the memory shared with other resources. Supports batching barriers.
+    /// </summary>
+    /// <param name="resource">The resource.</param>
+    void AddAliasingBarrier(ResourceOwnerDX12* resource);
+
     /// <summary>
     /// Set DirectX 12 resource state using resource barrier
     /// </summary>
@@ -107,6 +138,13 @@ class GPUContextDX12 : public GPUContext
     /// <param name="subresourceIndex">The subresource index. Use -1 to apply for the whole resource.</param>
     void SetResourceState(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after, int32 subresourceIndex = -1);
 
+    /// <summary>
+    /// Set DirectX 12 resource state (of all subresources) to exactly match the given state (doesn't merge read states).
+    /// </summary>
+    /// <param name="resource">Resource to use</param>
+    /// <param name="after">The target state to resource have.</param>
+    void SetResourceStateExact(ResourceOwnerDX12* resource, D3D12_RESOURCE_STATES after);
+
     /// <summary>
     /// Reset commands list and request new allocator for commands
     /// </summary>
@@ -135,6 +173,7 @@ class GPUContextDX12 : public GPUContext
 protected:
 
     void GetActiveHeapDescriptor(const D3D12_CPU_DESCRIPTOR_HANDLE& cpuHandle, Descriptor& descriptor);
+    D3D12_GPU_VIRTUAL_ADDRESS GetCBAddress(GPUConstantBufferDX12* cb) const;
 
 private:
 
@@ -144,6 +183,7 @@ class GPUContextDX12 : public GPUContext
     void flushCBs();
     void flushSamplers();
     void flushRBs();
+    void initResourceMemory(ResourceOwnerDX12* resource);
     void flushPS();
     void OnDrawCall();
 
@@ -189,11 +229,15 @@ class GPUContextDX12 : public GPUContext
     void DrawIndexedInstancedIndirect(GPUBuffer* bufferForArgs, uint32 offsetForArgs) override;
     void SetViewport(const Viewport& viewport) override;
     void SetScissor(const Rectangle& scissorRect) override;
+    void SetShadingRateImage(GPUTexture* rateImage) override;
     GPUPipelineState* GetState() const override;
     void SetState(GPUPipelineState* state) override;
     void ClearState() override;
     void FlushState() override;
     void Flush() override;
+    void ExecuteDeferred(const Span<GPUContext*>& contexts) override;
+    uint64 Submit() override;
+    void WaitForSyncPoint(GPUContext* context, uint64 syncPoint) override;
     void UpdateBuffer(GPUBuffer* buffer, const void* data, uint32 size, uint32 offset) override;
     void CopyBuffer(GPUBuffer* dstBuffer, GPUBuffer* srcBuffer, uint32 size, uint32 dstOffset, uint32 srcOffset) override;
     void UpdateTexture(GPUTexture* texture, int32 arrayIndex, int32 mipIndex, const void* data, uint32 rowPitch, uint32 slicePitch) override;
@@ -13,6 +13,9 @@
 #include "GPUSwapChainDX12.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Graphics/GPUPipelineStateManifest.h"
+#include "Engine/Graphics/Async/CopyQueueGPUTasksExecutor.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Profiler/ProfilerCPU.h"
@@ -22,6 +25,8 @@
 #include "CommandQueueDX12.h"
 #include "Engine/Core/Utilities.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
 #include "CommandSignatureDX12.h"
 
 static bool CheckDX12Support(IDXGIAdapter* adapter)
@@ -227,12 +232,13 @@ GPUDeviceDX12::GPUDeviceDX12(IDXGIFactory4* dxgiFactory, GPUAdapterDX* adapter)
     , _commandQueue(nullptr)
     , _mainContext(nullptr)
     , UploadBuffer(nullptr)
+    , HeapAllocator(this)
     , TimestampQueryHeap(this, D3D12_QUERY_HEAP_TYPE_TIMESTAMP, DX12_BACK_BUFFER_COUNT * 1024)
     , Heap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 4 * 1024, false)
     , Heap_RTV(this, D3D12_DESCRIPTOR_HEAP_TYPE_RTV, 1 * 1024, false)
     , Heap_DSV(this, D3D12_DESCRIPTOR_HEAP_TYPE_DSV, 64, false)
     , Heap_Sampler(this, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 128, false)
-    , RingHeap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 512 * 1024, true)
+    , RingHeap_CBV_SRV_UAV(this, D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV, 512 * 1024 + DX12_BINDLESS_DESCRIPTORS_COUNT, true, DX12_BINDLESS_DESCRIPTORS_COUNT)
     , RingHeap_Sampler(this, D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER, 1 * 1024, true)
 {
 }
@@ -303,6 +309,9 @@ bool GPUDeviceDX12::Init()
         return true;
     }
     UpdateOutputs(adapter);
+#if PLATFORM_WINDOWS
+    adapter->QueryInterface(IID_PPV_ARGS(&_adapterDXGI));
+#endif
 
     ComPtr<IDXGIFactory5> factory5;
     _factoryDXGI->QueryInterface(IID_PPV_ARGS(&factory5));
@@ -368,6 +377,12 @@ bool GPUDeviceDX12::Init()
     LOG(Info, "Resource Binding Tier: {0}", (int32)options.ResourceBindingTier);
     LOG(Info, "Conservative Rasterization Tier: {0}", (int32)options.ConservativeRasterizationTier);
     LOG(Info, "Resource Heap Tier: {0}", (int32)options.ResourceHeapTier);
+#if DX12_USE_VARIABLE_RATE_SHADING
+    D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+    if (FAILED(_device->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6))))
+        options6.VariableShadingRateTier = D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+    LOG(Info, "Variable Shading Rate Tier: {0}", (int32)options6.VariableShadingRateTier);
+#endif
 
     // Init device limits
     {
@@ -385,6 +400,15 @@ bool GPUDeviceDX12::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = true;
         limits.HasTypedUAVLoad = options.TypedUAVLoadAdditionalFormats != 0;
+        limits.HasBindless = DX12_USE_BINDLESS && options.ResourceBindingTier >= D3D12_RESOURCE_BINDING_TIER_2;
+#if DX12_USE_VARIABLE_RATE_SHADING
+        limits.HasVariableRateShading = options6.VariableShadingRateTier >= D3D12_VARIABLE_SHADING_RATE_TIER_2;
+        limits.VariableRateShadingTileSize = limits.HasVariableRateShading ? (int32)options6.ShadingRateImageTileSize : 0;
+#else
+        limits.HasVariableRateShading = false;
+        limits.VariableRateShadingTileSize = 0;
+#endif
+        limits.HasPipelineStatistics = false; // TODO: add pipeline statistics queries for D3D12 (queries must begin and end within the same command list)
         limits.MaximumMipLevelsCount = D3D12_REQ_MIP_LEVELS;
         limits.MaximumTexture1DSize = D3D12_REQ_TEXTURE1D_U_DIMENSION;
         limits.MaximumTexture1DArraySize = D3D12_REQ_TEXTURE1D_ARRAY_AXIS_DIMENSION;
@@ -503,7 +527,7 @@ bool GPUDeviceDX12::Init()
     // TODO: maybe create set of different root signatures? for UAVs, for compute, for simple drawing, for post fx?
     {
         // Descriptor tables
-        D3D12_DESCRIPTOR_RANGE r[3]; // SRV+UAV+Sampler
+        D3D12_DESCRIPTOR_RANGE r[4]; // SRV+UAV+Sampler+Bindless SRV
         {
             D3D12_DESCRIPTOR_RANGE& range = r[0];
             range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
@@ -528,9 +552,17 @@ bool GPUDeviceDX12::Init()
             range.RegisterSpace = 0;
             range.OffsetInDescriptorsFromTableStart = D3D12_DESCRIPTOR_RANGE_OFFSET_APPEND;
         }
+        {
+            D3D12_DESCRIPTOR_RANGE& range = r[3];
+            range.RangeType = D3D12_DESCRIPTOR_RANGE_TYPE_SRV;
+            range.NumDescriptors = DX12_BINDLESS_DESCRIPTORS_COUNT;
+            range.BaseShaderRegister = 0;
+            range.RegisterSpace = 1;
+            range.OffsetInDescriptorsFromTableStart = 0;
+        }
 
         // Root parameters
-        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 3];
+        D3D12_ROOT_PARAMETER rootParameters[GPU_MAX_CB_BINDED + 4];
         for (int32 i = 0; i < GPU_MAX_CB_BINDED; i++)
         {
             // CB
@@ -564,6 +596,14 @@ bool GPUDeviceDX12::Init()
             rootParam.DescriptorTable.NumDescriptorRanges = 1;
             rootParam.DescriptorTable.pDescriptorRanges = &r[2];
         }
+        {
+            // Bindless SRVs (used only if device supports it)
+            D3D12_ROOT_PARAMETER& rootParam = rootParameters[DX12_ROOT_SIGNATURE_BINDLESS];
+            rootParam.ParameterType = D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE;
+            rootParam.ShaderVisibility = D3D12_SHADER_VISIBILITY_ALL;
+            rootParam.DescriptorTable.NumDescriptorRanges = 1;
+            rootParam.DescriptorTable.pDescriptorRanges = &r[3];
+        }
 
         // Static samplers
         D3D12_STATIC_SAMPLER_DESC staticSamplers[6];
@@ -654,7 +694,7 @@ bool GPUDeviceDX12::Init()
 
         // Init
         D3D12_ROOT_SIGNATURE_DESC rootSignatureDesc;
-        rootSignatureDesc.NumParameters = ARRAY_COUNT(rootParameters);
+        rootSignatureDesc.NumParameters = Limits.HasBindless ? ARRAY_COUNT(rootParameters) : ARRAY_COUNT(rootParameters) - 1;
         rootSignatureDesc.pParameters = rootParameters;
         rootSignatureDesc.NumStaticSamplers = ARRAY_COUNT(staticSamplers);
         rootSignatureDesc.pStaticSamplers = staticSamplers;
@@ -692,6 +732,12 @@ bool GPUDeviceDX12::Init()
         DispatchIndirectCommandSignature->Finalize();
     }
 
+    // Pipeline states caching
+#if DX12_USE_PIPELINE_LIBRARY
+    initPipelineLibrary();
+#endif
+    GPUPipelineStateManifest::Init(TEXT("DX12"), sizeof(GPUPipelineStateKeyDX12));
+
     _state = DeviceState::Ready;
     return GPUDeviceDX::Init();
 }
@@ -766,6 +812,12 @@ void GPUDeviceDX12::Dispose()
     // Release all late dispose resources (if state is Disposing all are released)
     updateRes2Dispose();
 
+    // Save pipeline states caches
+    GPUPipelineStateManifest::Dispose();
+#if DX12_USE_PIPELINE_LIBRARY
+    releasePipelineLibrary();
+#endif
+
     // Clear pipeline objects
     for (auto& srv : _nullSrv)
         srv.Release();
@@ -779,14 +831,20 @@ void GPUDeviceDX12::Dispose()
     RingHeap_CBV_SRV_UAV.ReleaseGPU();
     RingHeap_Sampler.ReleaseGPU();
     SAFE_DELETE(UploadBuffer);
+    HeapAllocator.ReleaseGPU();
     SAFE_DELETE(DrawIndirectCommandSignature);
     SAFE_DELETE(_mainContext);
+    SAFE_DELETE(_computeQueue);
+    SAFE_DELETE(_copyQueue);
     SAFE_DELETE(_commandQueue);
 
     // Clear DirectX stuff
     SAFE_DELETE(_adapter);
     SAFE_RELEASE(_device);
     SAFE_RELEASE(_factoryDXGI);
+#if PLATFORM_WINDOWS
+    SAFE_RELEASE(_adapterDXGI);
+#endif
 
     // Base
     GPUDeviceDX::Dispose();
@@ -795,8 +853,112 @@ void GPUDeviceDX12::Dispose()
     _state = DeviceState::Disposed;
 }
 
+#if DX12_USE_PIPELINE_LIBRARY
+
+void GetPipelineLibraryPath(String& path)
+{
+#if USE_EDITOR
+    path = Globals::ProjectCacheFolder / TEXT("DX12PipelineLibrary.cache");
+#else
+    path = Globals::ProductLocalFolder / TEXT("DX12PipelineLibrary.cache");
+#endif
+}
+
+void GPUDeviceDX12::initPipelineLibrary()
+{
+    ComPtr<ID3D12Device1> device1;
+    if (FAILED(_device->QueryInterface(IID_PPV_ARGS(&device1))))
+        return;
+
+    // Load cached library data
+    String path;
+    GetPipelineLibraryPath(path);
+    if (FileSystem::FileExists(path))
+    {
+        LOG(Info, "Trying to load DirectX 12 pipeline library file {0}", path);
+        File::ReadAllBytes(path, PipelineLibraryData);
+    }
+
+    // Create library (fallback to the empty one if cached data is invalid, eg. after driver update)
+    HRESULT result = E_FAIL;
+    if (PipelineLibraryData.HasItems())
+    {
+        result = device1->CreatePipelineLibrary(PipelineLibraryData.Get(), PipelineLibraryData.Count(), IID_PPV_ARGS(&PipelineLibrary));
+        if (FAILED(result))
+        {
+            LOG(Info, "Discarding outdated DirectX 12 pipeline library (result: 0x{0:x})", (uint32)result);
+            PipelineLibraryData.Resize(0);
+        }
+    }
+    if (FAILED(result))
+    {
+        result = device1->CreatePipelineLibrary(nullptr, 0, IID_PPV_ARGS(&PipelineLibrary));
+        if (FAILED(result))
+        {
+            // Pipeline library is optional (eg. not supported by the driver)
+            PipelineLibrary = nullptr;
+        }
+    }
+    PipelineLibraryModified = false;
+}
+
+void GPUDeviceDX12::releasePipelineLibrary()
+{
+    if (PipelineLibrary && PipelineLibraryModified)
+    {
+        // Save library data
+        Array<byte> data;
+        data.Resize((int32)PipelineLibrary->GetSerializedSize());
+        const HRESULT result = PipelineLibrary->Serialize(data.Get(), data.Count());
+        LOG_DIRECTX_RESULT(result);
+        if (SUCCEEDED(result))
+        {
+            String path;
+            GetPipelineLibraryPath(path);
+            File::WriteAllBytes(path, data);
+        }
+    }
+    SAFE_RELEASE(PipelineLibrary);
+    PipelineLibraryData.Resize(0);
+    PipelineLibraryModified = false;
+}
+
+#endif
+
+HRESULT GPUDeviceDX12::CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const Char* name, ID3D12PipelineState** state)
+{
+#if DX12_USE_PIPELINE_LIBRARY
+    if (PipelineLibrary)
+    {
+        // Try to load the compiled pipeline from the cache
+        HRESULT result;
+        {
+            ScopeLock lock(PipelineLibraryLocker);
+            result = PipelineLibrary->LoadGraphicsPipeline(name, &desc, IID_PPV_ARGS(state));
+        }
+        if (SUCCEEDED(result))
+            return result;
+
+        // Compile pipeline (outside the lock to support creating pipelines in parallel) and store it in the library
+        result = _device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(state));
+        if (SUCCEEDED(result))
+        {
+            ScopeLock lock(PipelineLibraryLocker);
+            if (SUCCEEDED(PipelineLibrary->StorePipeline(name, *state)))
+                PipelineLibraryModified = true;
+        }
+        return result;
+    }
+#endif
+    return _device->CreateGraphicsPipelineState(&desc, IID_PPV_ARGS(state));
+}
+
 void GPUDeviceDX12::WaitForGPU()
 {
+    if (_computeQueue)
+        _computeQueue->WaitForGPU();
+    if (_copyQueue)
+        _copyQueue->WaitForGPU();
     _commandQueue->WaitForGPU();
 }
 
@@ -805,6 +967,21 @@ GPUTexture* GPUDeviceDX12::CreateTexture(const StringView& name)
     return New<GPUTextureDX12>(this, name);
 }
 
+GPUTexture* GPUDeviceDX12::CreateTransientTexture(const StringView& name)
+{
+    return New<GPUTextureDX12>(this, name, true);
+}
+
+bool GPUDeviceDX12::BeginTransientTexture(GPUTexture* texture)
+{
+    return static_cast<GPUTextureDX12*>(texture)->BeginTransient();
+}
+
+void GPUDeviceDX12::EndTransientTexture(GPUTexture* texture)
+{
+    static_cast<GPUTextureDX12*>(texture)->EndTransient();
+}
+
 GPUShader* GPUDeviceDX12::CreateShader(const StringView& name)
 {
     return New<GPUShaderDX12>(this, name);
@@ -840,7 +1017,73 @@ GPUConstantBuffer* GPUDeviceDX12::CreateConstantBuffer(uint32 size, const String
     return New<GPUConstantBufferDX12>(this, size, name);
 }
 
+GPUContext* GPUDeviceDX12::CreateDeferredContext()
+{
+    auto context = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_DIRECT, true);
+    context->Reset();
+    return context;
+}
+
+GPUContext* GPUDeviceDX12::CreateComputeContext()
+{
+    if (!_computeQueue)
+    {
+        _computeQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+        if (_computeQueue->Init())
+        {
+            LOG(Warning, "Failed to create async compute queue.");
+            SAFE_DELETE(_computeQueue);
+            return nullptr;
+        }
+    }
+    auto context = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COMPUTE);
+    context->Reset();
+    return context;
+}
+
+GPUContext* GPUDeviceDX12::CreateCopyContext()
+{
+    if (!_copyQueue)
+    {
+        _copyQueue = New<CommandQueueDX12>(this, D3D12_COMMAND_LIST_TYPE_COPY);
+        if (_copyQueue->Init())
+        {
+            LOG(Warning, "Failed to create async copy queue.");
+            SAFE_DELETE(_copyQueue);
+            return nullptr;
+        }
+    }
+    auto context = New<GPUContextDX12>(this, D3D12_COMMAND_LIST_TYPE_COPY);
+    context->Reset();
+    return context;
+}
+
+bool GPUDeviceDX12::QueryMemoryBudget(uint64& budget, uint64& usage) const
+{
+#if PLATFORM_WINDOWS
+    DXGI_QUERY_VIDEO_MEMORY_INFO info;
+    if (_adapterDXGI && SUCCEEDED(_adapterDXGI->QueryVideoMemoryInfo(0, DXGI_MEMORY_SEGMENT_GROUP_LOCAL, &info)))
+    {
+        budget = info.Budget;
+        usage = info.CurrentUsage;
+        return false;
+    }
+#endif
+    return true;
+}
+
+GPUTasksExecutor* GPUDeviceDX12::CreateTasksExecutor()
+{
+    // Upload tasks (eg. texture streaming) use the dedicated copy queue
+    return New<CopyQueueGPUTasksExecutor>();
+}
+
 void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, uint32 safeFrameCount)
+{
+    AddResourceToLateRelease(resource, HeapAllocationDX12(), safeFrameCount);
+}
+
+void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, const HeapAllocationDX12& allocation, uint32 safeFrameCount)
 {
     if (resource == nullptr)
         return;
@@ -850,6 +1093,7 @@ void GPUDeviceDX12::AddResourceToLateRelease(IGraphicsUnknown* resource, uint32
     // Add to the list
     DisposeResourceEntry entry;
     entry.Resource = resource;
+    entry.Allocation = allocation;
     entry.TargetFrame = Engine::FrameCount + safeFrameCount;
     _res2Dispose.Add(entry);
 }
@@ -866,7 +1110,7 @@ void GPUDeviceDX12::updateRes2Dispose()
     _res2DisposeLock.Lock();
     for (int32 i = _res2Dispose.Count() - 1; i >= 0 && i < _res2Dispose.Count(); i--)
     {
-        const DisposeResourceEntry& entry = _res2Dispose[i];
+        DisposeResourceEntry& entry = _res2Dispose[i];
         if (entry.TargetFrame <= currentFrame)
         {
             auto refs = entry.Resource->Release();
@@ -874,6 +1118,7 @@ void GPUDeviceDX12::updateRes2Dispose()
             {
                 LOG(Error, "Late release resource has not been fully released. References left: {0}", refs);
             }
+            HeapAllocator.Free(entry.Allocation);
             _res2Dispose.RemoveAt(i);
         }
     }
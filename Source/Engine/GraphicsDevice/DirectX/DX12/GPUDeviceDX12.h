@@ -10,6 +10,7 @@
 #include "ResourceOwnerDX12.h"
 #include "QueryHeapDX12.h"
 #include "DescriptorHeapDX12.h"
+#include "HeapAllocatorDX12.h"
 
 #if PLATFORM_WINDOWS
 #define DX12_BACK_BUFFER_COUNT 3
@@ -21,6 +22,26 @@
 #define DX12_ROOT_SIGNATURE_SR (GPU_MAX_CB_BINDED+0)
 #define DX12_ROOT_SIGNATURE_UA (GPU_MAX_CB_BINDED+1)
 #define DX12_ROOT_SIGNATURE_SAMPLER (GPU_MAX_CB_BINDED+2)
+#define DX12_ROOT_SIGNATURE_BINDLESS (GPU_MAX_CB_BINDED+3)
+
+// Enables the bindless table with the copies of all shader resource views (bound to every command list, use only when shaders read the bindless indices)
+#ifndef DX12_USE_BINDLESS
+#define DX12_USE_BINDLESS 0
+#endif
+
+// The amount of the shader resource descriptors reserved for the bindless table (static part of the shader-visible heap)
+#if DX12_USE_BINDLESS
+#define DX12_BINDLESS_DESCRIPTORS_COUNT (128 * 1024)
+#else
+#define DX12_BINDLESS_DESCRIPTORS_COUNT 0
+#endif
+
+// Enables using the pipeline library to persistently cache the compiled pipeline states between the game sessions
+#if PLATFORM_WINDOWS
+#define DX12_USE_PIPELINE_LIBRARY 1
+#else
+#define DX12_USE_PIPELINE_LIBRARY 0
+#endif
 
 class Engine;
 class WindowsWindow;
@@ -43,6 +64,7 @@ class GPUDeviceDX12 : public GPUDeviceDX
     struct DisposeResourceEntry
     {
         IGraphicsUnknown* Resource;
+        HeapAllocationDX12 Allocation;
         uint64 TargetFrame;
     };
 
@@ -51,12 +73,17 @@ class GPUDeviceDX12 : public GPUDeviceDX
     // Private Stuff
     ID3D12Device* _device;
     IDXGIFactory4* _factoryDXGI;
+#if PLATFORM_WINDOWS
+    IDXGIAdapter3* _adapterDXGI = nullptr;
+#endif
     CriticalSection _res2DisposeLock;
     Array<DisposeResourceEntry> _res2Dispose;
 
     // Pipeline
     ID3D12RootSignature* _rootSignature;
     CommandQueueDX12* _commandQueue;
+    CommandQueueDX12* _computeQueue = nullptr;
+    CommandQueueDX12* _copyQueue = nullptr;
     GPUContextDX12* _mainContext;
 
     // Heaps
@@ -76,6 +103,11 @@ class GPUDeviceDX12 : public GPUDeviceDX
     /// </summary>
     UploadBufferDX12* UploadBuffer;
 
+    /// <summary>
+    /// The memory heaps allocator for the placed resources (textures and buffers).
+    /// </summary>
+    HeapAllocatorDX12 HeapAllocator;
+
     /// <summary>
     /// The timestamp queries heap.
     /// </summary>
@@ -86,6 +118,37 @@ class GPUDeviceDX12 : public GPUDeviceDX
     CommandSignatureDX12* DrawIndexedIndirectCommandSignature = nullptr;
     CommandSignatureDX12* DrawIndirectCommandSignature = nullptr;
 
+#if DX12_USE_PIPELINE_LIBRARY
+    /// <summary>
+    /// The pipeline library used to store and load the compiled pipeline states (persistent cache saved on device dispose). Null if not supported.
+    /// </summary>
+    ID3D12PipelineLibrary* PipelineLibrary = nullptr;
+
+    /// <summary>
+    /// The pipeline library serialized data (has to be valid for the library lifetime).
+    /// </summary>
+    Array<byte> PipelineLibraryData;
+
+    /// <summary>
+    /// The pipeline library access locker (pipeline states can be created from multiple threads).
+    /// </summary>
+    CriticalSection PipelineLibraryLocker;
+
+    /// <summary>
+    /// True if any new pipeline state has been stored in the library.
+    /// </summary>
+    bool PipelineLibraryModified = false;
+#endif
+
+    /// <summary>
+    /// Creates the graphics pipeline state. Uses the pipeline library to load the cached pipeline (if available).
+    /// </summary>
+    /// <param name="desc">The pipeline state description.</param>
+    /// <param name="name">The unique pipeline name (used to identify the pipeline within the library).</param>
+    /// <param name="state">The output pipeline state.</param>
+    /// <returns>The result code.</returns>
+    HRESULT CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC& desc, const Char* name, ID3D12PipelineState** state);
+
     D3D12_CPU_DESCRIPTOR_HANDLE NullSRV(D3D12_SRV_DIMENSION dimension) const;
     D3D12_CPU_DESCRIPTOR_HANDLE NullUAV() const;
 
@@ -120,6 +183,22 @@ class GPUDeviceDX12 : public GPUDeviceDX
         return _commandQueue;
     }
 
+    /// <summary>
+    /// Gets async compute command queue (null if async compute context has not been created).
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetComputeQueue() const
+    {
+        return _computeQueue;
+    }
+
+    /// <summary>
+    /// Gets async copy command queue (null if async copy context has not been created).
+    /// </summary>
+    FORCE_INLINE CommandQueueDX12* GetCopyQueue() const
+    {
+        return _copyQueue;
+    }
+
     /// <summary>
     /// Gets DirectX 12 command queue object.
     /// </summary>
@@ -155,6 +234,9 @@ class GPUDeviceDX12 : public GPUDeviceDX
     // Add resource to late release service (will be released after 'safeFrameCount' frames)
     void AddResourceToLateRelease(IGraphicsUnknown* resource, uint32 safeFrameCount = DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT);
 
+    // Add resource to late release service (will be released after 'safeFrameCount' frames) and free its heap memory allocation after that
+    void AddResourceToLateRelease(IGraphicsUnknown* resource, const HeapAllocationDX12& allocation, uint32 safeFrameCount = DX12_RESOURCE_DELETE_SAFE_FRAMES_COUNT);
+
     static FORCE_INLINE uint32 GetMaxMSAAQuality(uint32 sampleCount)
     {
         if (sampleCount <= 8)
@@ -173,6 +255,10 @@ class GPUDeviceDX12 : public GPUDeviceDX
     void updateFrameEvents();
 #endif
     void updateRes2Dispose();
+#if DX12_USE_PIPELINE_LIBRARY
+    void initPipelineLibrary();
+    void releasePipelineLibrary();
+#endif
 
 public:
 
@@ -191,6 +277,9 @@ class GPUDeviceDX12 : public GPUDeviceDX
     void Dispose() final override;
     void WaitForGPU() override;
     GPUTexture* CreateTexture(const StringView& name) override;
+    GPUTexture* CreateTransientTexture(const StringView& name) override;
+    bool BeginTransientTexture(GPUTexture* texture) override;
+    void EndTransientTexture(GPUTexture* texture) override;
     GPUShader* CreateShader(const StringView& name) override;
     GPUPipelineState* CreatePipelineState() override;
     GPUTimerQuery* CreateTimerQuery() override;
@@ -198,6 +287,11 @@ class GPUDeviceDX12 : public GPUDeviceDX
     GPUSampler* CreateSampler() override;
     GPUSwapChain* CreateSwapChain(Window* window) override;
     GPUConstantBuffer* CreateConstantBuffer(uint32 size, const StringView& name) override;
+    GPUContext* CreateDeferredContext() override;
+    GPUContext* CreateComputeContext() override;
+    GPUContext* CreateCopyContext() override;
+    GPUTasksExecutor* CreateTasksExecutor() override;
+    bool QueryMemoryBudget(uint64& budget, uint64& usage) const override;
 };
 
 /// <summary>
@@ -8,6 +8,9 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Graphics/GPUPipelineStateManifest.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/Threading.h"
 
 static D3D12_STENCIL_OP ToStencilOp(StencilOperation value)
 {
@@ -45,6 +48,17 @@ bool GPUPipelineStateDX12::IsValid() const
     return !!_memoryUsage;
 }
 
+namespace
+{
+    // Pipeline states can be used from multiple threads when recording commands with deferred contexts
+    CriticalSection StatesLocker;
+
+    FORCE_INLINE uint32 GetKeyHash(const GPUPipelineStateKeyDX12& key)
+    {
+        return GetHash(key);
+    }
+}
+
 ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, int32 rtCount, GPUTextureViewDX12** rtHandles)
 {
     // Validate
@@ -60,32 +74,45 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     for (int32 i = rtCount; i < GPU_MAX_RT_BINDED; i++)
         key.RTVsFormats[i] = PixelFormat::Unknown;
 
+    return GetState(key);
+}
+
+ID3D12PipelineState* GPUPipelineStateDX12::GetState(const GPUPipelineStateKeyDX12& key)
+{
     // Try reuse cached version
     ID3D12PipelineState* state = nullptr;
-    if (_states.TryGet(key, state))
     {
+        ScopeLock lock(StatesLocker);
+        if (_states.TryGet(key, state))
+        {
 #if BUILD_DEBUG
-        // Verify
-        GPUPipelineStateKeyDX12 refKey;
-        _states.KeyOf(state, &refKey);
-        ASSERT(refKey == key);
+            // Verify
+            GPUPipelineStateKeyDX12 refKey;
+            _states.KeyOf(state, &refKey);
+            ASSERT(refKey == key);
 #endif
-        return state;
+            return state;
+        }
     }
 
     PROFILE_CPU_NAMED("Create Pipeline State");
 
-    // Update description to match the pipeline
-    _desc.NumRenderTargets = key.RTsCount;
+    // Record the used variant to precompile it on the next startup
+    GPUPipelineStateManifest::Record(GetHash(), &key);
+
+    // Update description to match the pipeline (use local copy to support creating multiple pipelines in parallel)
+    D3D12_GRAPHICS_PIPELINE_STATE_DESC desc = _desc;
+    desc.NumRenderTargets = key.RTsCount;
     for (int32 i = 0; i < GPU_MAX_RT_BINDED; i++)
-        _desc.RTVFormats[i] = RenderToolsDX::ToDxgiFormat(key.RTVsFormats[i]);
-    _desc.SampleDesc.Count = static_cast<UINT>(key.MSAA);
-    _desc.SampleDesc.Quality = key.MSAA == MSAALevel::None ? 0 : GPUDeviceDX12::GetMaxMSAAQuality((int32)key.MSAA);
-    _desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
-    _desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
+        desc.RTVFormats[i] = RenderToolsDX::ToDxgiFormat(key.RTVsFormats[i]);
+    desc.SampleDesc.Count = static_cast<UINT>(key.MSAA);
+    desc.SampleDesc.Quality = key.MSAA == MSAALevel::None ? 0 : GPUDeviceDX12::GetMaxMSAAQuality((int32)key.MSAA);
+    desc.SampleMask = D3D12_DEFAULT_SAMPLE_MASK;
+    desc.DSVFormat = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindDepthStencilFormat(key.DepthFormat));
 
     // Create object
-    const HRESULT result = _device->GetDevice()->CreateGraphicsPipelineState(&_desc, IID_PPV_ARGS(&state));
+    const String pipelineName = String::Format(TEXT("{0:08x}-{1:08x}"), GetHash(), GetKeyHash(key));
+    const HRESULT result = _device->CreateGraphicsPipelineState(desc, *pipelineName, &state);
     LOG_DIRECTX_RESULT(result);
     if (FAILED(result))
         return nullptr;
@@ -122,7 +149,14 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
     SetDebugObjectName(state, name.Get(), name.Count() - 1);
 #endif
 
-    // Cache it
+    // Cache it (pipeline could be created by the other thread in the meantime)
+    ScopeLock lock(StatesLocker);
+    ID3D12PipelineState* existing = nullptr;
+    if (_states.TryGet(key, existing))
+    {
+        _device->AddResourceToLateRelease(state);
+        return existing;
+    }
     _states.Add(key, state);
 
     return state;
@@ -130,6 +164,13 @@ ID3D12PipelineState* GPUPipelineStateDX12::GetState(GPUTextureViewDX12* depth, i
 
 void GPUPipelineStateDX12::OnReleaseGPU()
 {
+    if (_warmupTask)
+    {
+        _warmupTask->Wait();
+        _warmupTask = nullptr;
+    }
+    _warmupKeys.Resize(0);
+    ScopeLock lock(StatesLocker);
     for (auto i = _states.Begin(); i.IsNotEnd(); ++i)
     {
         _device->AddResourceToLateRelease(i->Value);
@@ -257,7 +298,23 @@ bool GPUPipelineStateDX12::Init(const Description& desc)
     // Set non-zero memory usage
     _memoryUsage = sizeof(D3D12_GRAPHICS_PIPELINE_STATE_DESC);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+
+    // Precompile the pipeline variants recorded in the manifest in the background
+    Array<byte> variants;
+    if (GPUPipelineStateManifest::GetVariants(GetHash(), variants))
+    {
+        _warmupKeys.Set((const GPUPipelineStateKeyDX12*)variants.Get(), variants.Count() / sizeof(GPUPipelineStateKeyDX12));
+        _warmupTask = Task::StartNew([this]
+        {
+            PROFILE_CPU_NAMED("Pipeline State Warmup");
+            for (const GPUPipelineStateKeyDX12& key : _warmupKeys)
+                GetState(key);
+        });
+    }
+
+    return false;
 }
 
 #endif
@@ -11,6 +11,7 @@
 #include "../IncludeDirectXHeaders.h"
 
 class GPUTextureViewDX12;
+class Task;
 
 struct GPUPipelineStateKeyDX12
 {
@@ -49,6 +50,8 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
 
     Dictionary<GPUPipelineStateKeyDX12, ID3D12PipelineState*> _states;
     D3D12_GRAPHICS_PIPELINE_STATE_DESC _desc;
+    Array<GPUPipelineStateKeyDX12> _warmupKeys;
+    Task* _warmupTask = nullptr;
 
 public:
 
@@ -68,6 +71,13 @@ class GPUPipelineStateDX12 : public GPUResourceDX12<GPUPipelineState>
     /// <returns>DirectX 12 graphics pipeline state object</returns>
     ID3D12PipelineState* GetState(GPUTextureViewDX12* depth, int32 rtCount, GPUTextureViewDX12** rtHandles);
 
+    /// <summary>
+    /// Gets DirectX 12 graphics pipeline state object for the given pipeline variant key. Uses caching. Can be called from any thread.
+    /// </summary>
+    /// <param name="key">The pipeline state variant key.</param>
+    /// <returns>DirectX 12 graphics pipeline state object</returns>
+    ID3D12PipelineState* GetState(const GPUPipelineStateKeyDX12& key);
+
 public:
 
     // [GPUPipelineState]
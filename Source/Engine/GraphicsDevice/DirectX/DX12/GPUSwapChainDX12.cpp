@@ -6,6 +6,7 @@
 #include "GPUContextDX12.h"
 #include "../IncludeDirectXHeaders.h"
 #include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Engine/Time.h"
 
 void BackBufferDX12::Setup(GPUSwapChainDX12* window, ID3D12Resource* backbuffer)
 {
@@ -73,6 +74,13 @@ void GPUSwapChainDX12::OnReleaseGPU()
     // Release data
     releaseBackBuffer();
     _backBuffers.Resize(0);
+#if PLATFORM_WINDOWS
+    if (_frameLatencyWaitable)
+    {
+        CloseHandle(_frameLatencyWaitable);
+        _frameLatencyWaitable = nullptr;
+    }
+#endif
     if (_swapChain)
     {
         _device->AddResourceToLateRelease(_swapChain);
@@ -199,6 +207,10 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
 #endif
         if (_allowTearing)
             swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+#if PLATFORM_WINDOWS
+        if (Time::LowLatencyMode)
+            swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+#endif
         DXGI_SWAP_CHAIN_FULLSCREEN_DESC fullscreenDesc;
         if (_device->Outputs.HasItems())
         {
@@ -228,6 +240,16 @@ bool GPUSwapChainDX12::Resize(int32 width, int32 height)
         _swapChain->SetBackgroundColor((const DXGI_RGBA*)Color::Black.Raw);
         _backBuffers.Resize(swapChainDesc.BufferCount);
 
+#if PLATFORM_WINDOWS
+        if (swapChainDesc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT)
+        {
+            // Limit the amount of queued frames (low-latency frame pacing waits for the swap chain before sampling the input)
+            VALIDATE_DIRECTX_CALL(_swapChain->SetMaximumFrameLatency(1));
+            _frameLatencyWaitable = _swapChain->GetFrameLatencyWaitableObject();
+            _frameLatencyWait = true;
+        }
+#endif
+
         // Disable DXGI changes to the window
         VALIDATE_DIRECTX_CALL(dxgiFactory->MakeWindowAssociation(_windowHandle, DXGI_MWA_NO_ALT_ENTER));
     }
@@ -382,6 +404,9 @@ void GPUSwapChainDX12::Present(bool vsync)
     }
     const HRESULT res = _swapChain->Present(vsync ? 1 : 0, presentFlags);
     LOG_DIRECTX_RESULT(res);
+#if PLATFORM_WINDOWS
+    _frameLatencyWait = true;
+#endif
 
     // Base
     GPUSwapChain::Present(vsync);
@@ -391,6 +416,20 @@ void GPUSwapChainDX12::Present(bool vsync)
 #endif
 }
 
+#if PLATFORM_WINDOWS
+
+void GPUSwapChainDX12::WaitForFrameLatency()
+{
+    // Waitable object gets signaled once per presented frame (skip if nothing presented to not block on it)
+    if (_frameLatencyWaitable && _frameLatencyWait)
+    {
+        _frameLatencyWait = false;
+        WaitForSingleObjectEx(_frameLatencyWaitable, 1000, TRUE);
+    }
+}
+
+#endif
+
 GPUTextureView* GPUSwapChainDX12::GetBackBufferView()
 {
     return &_backBuffers[_currentFrameIndex].Handle;
@@ -64,6 +64,10 @@ class GPUSwapChainDX12 : public GPUResourceDX12<GPUSwapChain>
     int32 _currentFrameIndex;
 #if PLATFORM_XBOX_SCARLETT || PLATFORM_XBOX_ONE
     D3D12XBOX_FRAME_PIPELINE_TOKEN _framePipelineToken;
+#endif
+#if PLATFORM_WINDOWS
+    HANDLE _frameLatencyWaitable = nullptr;
+    bool _frameLatencyWait = false;
 #endif
     Array<BackBufferDX12, FixedAllocation<4>> _backBuffers;
 
@@ -107,6 +111,9 @@ class GPUSwapChainDX12 : public GPUResourceDX12<GPUSwapChain>
 #endif
     void End(RenderTask* task) override;
     void Present(bool vsync) override;
+#if PLATFORM_WINDOWS
+    void WaitForFrameLatency() override;
+#endif
     bool Resize(int32 width, int32 height) override;
     void CopyBackbuffer(GPUContext* context, GPUTexture* dst) override;
 
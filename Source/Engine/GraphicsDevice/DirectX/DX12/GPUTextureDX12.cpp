@@ -83,7 +83,6 @@ bool GPUTextureDX12::OnInit()
     _dxgiFormatUAV = RenderToolsDX::ToDxgiFormat(PixelFormatExtensions::FindUnorderedAccessFormat(format));
 
     // Cache properties
-    auto device = _device->GetDevice();
     bool useSRV = IsShaderResource();
     bool useDSV = IsDepthStencil();
     bool useRTV = IsRenderTarget();
@@ -94,12 +93,6 @@ bool GPUTextureDX12::OnInit()
     {
         // Initialize as a buffer
         const int32 totalSize = ComputeBufferTotalSize(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
-        D3D12_HEAP_PROPERTIES heapProperties;
-        heapProperties.Type = D3D12_HEAP_TYPE_READBACK;
-        heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-        heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-        heapProperties.CreationNodeMask = 1;
-        heapProperties.VisibleNodeMask = 1;
         D3D12_RESOURCE_DESC resourceDesc;
         resourceDesc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
         resourceDesc.Alignment = 0;
@@ -112,9 +105,11 @@ bool GPUTextureDX12::OnInit()
         resourceDesc.SampleDesc.Quality = 0;
         resourceDesc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
         resourceDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
-        auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&resource));
+        HeapAllocationDX12 allocation;
+        auto result = _device->HeapAllocator.CreateResource(D3D12_HEAP_TYPE_READBACK, resourceDesc, D3D12_RESOURCE_STATE_COPY_DEST, nullptr, &resource, allocation);
         LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
         initResource(resource, D3D12_RESOURCE_STATE_COPY_DEST, 1);
+        _allocation = allocation;
         DX_SET_DEBUG_NAME(_resource, GetName());
         _memoryUsage = totalSize;
         return false;
@@ -154,14 +149,6 @@ bool GPUTextureDX12::OnInit()
         resourceDesc.Flags |= D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
     }
 
-    // Create heap properties
-    D3D12_HEAP_PROPERTIES heapProperties;
-    heapProperties.Type = D3D12_HEAP_TYPE_DEFAULT;
-    heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
-    heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
-    heapProperties.CreationNodeMask = 1;
-    heapProperties.VisibleNodeMask = 1;
-
     // Create clear value (used by render targets and depth stencil buffers)
     D3D12_CLEAR_VALUE* clearValuePtr = nullptr;
     D3D12_CLEAR_VALUE clearValue;
@@ -182,14 +169,22 @@ bool GPUTextureDX12::OnInit()
     if (IsRegularTexture())
         initialState = D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE | D3D12_RESOURCE_STATE_NON_PIXEL_SHADER_RESOURCE;
 
-    // Create texture
-    auto result = device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &resourceDesc, initialState, clearValuePtr, IID_PPV_ARGS(&resource));
+    // Create texture (placed within the shared memory heap if possible, transient textures can alias memory with other transient textures)
+    HeapAllocationDX12 allocation;
+    HRESULT result;
+    if (_isTransient && !IsRegularTexture())
+        result = _device->HeapAllocator.CreateTransientResource(resourceDesc, initialState, clearValuePtr, &resource, allocation);
+    else
+        result = _device->HeapAllocator.CreateResource(D3D12_HEAP_TYPE_DEFAULT, resourceDesc, initialState, clearValuePtr, &resource, allocation);
     LOG_DIRECTX_RESULT_WITH_RETURN(result, true);
 
     // Set state
     bool isRead = useSRV || useUAV;
     bool isWrite = useDSV || useRTV || useUAV;
     initResource(resource, initialState, resourceDesc, isRead && isWrite);
+    _allocation = allocation;
+    _discardOnFirstUse = allocation.IsValid() && (useRTV || useDSV);
+    _aliasOnFirstUse = allocation.IsTransient;
     DX_SET_DEBUG_NAME(_resource, GetName());
     _memoryUsage = calculateMemoryUsage();
 
@@ -244,8 +239,31 @@ void GPUTextureDX12::OnResidentMipsChanged()
         view.SetSRV(srDesc);
 }
 
+bool GPUTextureDX12::BeginTransient()
+{
+    if (!_allocation.IsTransient || _isTransientActive)
+        return false;
+    if (_device->HeapAllocator.BeginTransient(_allocation))
+        return true;
+    _isTransientActive = true;
+
+    // Memory could be used by the other transient textures since the last use so initialize it again
+    _aliasOnFirstUse = true;
+    _discardOnFirstUse = IsRenderTarget() || IsDepthStencil();
+    return false;
+}
+
+void GPUTextureDX12::EndTransient()
+{
+    if (!_isTransientActive)
+        return;
+    _isTransientActive = false;
+    _device->HeapAllocator.EndTransient(_allocation);
+}
+
 void GPUTextureDX12::OnReleaseGPU()
 {
+    EndTransient();
     _handlesPerMip.Resize(0, false);
     _handlesPerSlice.Resize(0, false);
     _handleArray.Release();
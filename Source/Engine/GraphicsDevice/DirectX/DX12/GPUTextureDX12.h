@@ -104,6 +104,10 @@ class GPUTextureViewDX12 : public GPUTextureView, public IShaderResourceDX12
     {
         return (void*)(IShaderResourceDX12*)this;
     }
+    int32 GetBindlessIndex() const override
+    {
+        return _srv.BindlessIndex != MAX_uint32 ? (int32)_srv.BindlessIndex : -1;
+    }
 
     // [IShaderResourceDX12]
     bool IsDepthStencilResource() const override
@@ -144,11 +148,14 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
     DXGI_FORMAT _dxgiFormatSRV;
     DXGI_FORMAT _dxgiFormatRTV;
     DXGI_FORMAT _dxgiFormatUAV;
+    bool _isTransient;
+    bool _isTransientActive = false;
 
 public:
 
-    GPUTextureDX12(GPUDeviceDX12* device, const StringView& name)
+    GPUTextureDX12(GPUDeviceDX12* device, const StringView& name, bool isTransient = false)
         : GPUResourceDX12<GPUTexture>(device, name)
+        , _isTransient(isTransient)
     {
     }
 
@@ -156,6 +163,19 @@ class GPUTextureDX12 : public GPUResourceDX12<GPUTexture>, public ResourceOwnerD
 
     void initHandles();
 
+public:
+
+    /// <summary>
+    /// Marks the beginning of the transient texture usage (see GPUDevice::BeginTransientTexture).
+    /// </summary>
+    /// <returns>True if texture memory is already used by other transient texture, otherwise false.</returns>
+    bool BeginTransient();
+
+    /// <summary>
+    /// Marks the end of the transient texture usage (see GPUDevice::EndTransientTexture).
+    /// </summary>
+    void EndTransient();
+
 public:
 
     // [GPUTexture]
@@ -0,0 +1,343 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "HeapAllocatorDX12.h"
+#include "GPUDeviceDX12.h"
+#include "Engine/GraphicsDevice/DirectX/RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
+#include "Engine/Core/Log.h"
+
+HeapAllocatorDX12::HeapAllocatorDX12(GPUDeviceDX12* device)
+    : _device(device)
+    , _heapsSize(0)
+{
+}
+
+HRESULT HeapAllocatorDX12::CreateResource(D3D12_HEAP_TYPE heapType, const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue, ID3D12Resource** resource, HeapAllocationDX12& allocation)
+{
+    auto device = _device->GetDevice();
+    allocation = HeapAllocationDX12();
+
+    // Pick the heap category (resource heap tier 1 doesn't allow to mix buffers with textures and render targets with other textures)
+    const bool isBuffer = desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER;
+    const bool isTarget = (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0;
+    const D3D12_HEAP_FLAGS heapFlags = isBuffer ? D3D12_HEAP_FLAG_ALLOW_ONLY_BUFFERS : (isTarget ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES);
+
+    // Multisampled textures require bigger heap alignment and CPU-accessible heaps support only buffers so use committed resources for those
+    if (desc.SampleDesc.Count <= 1 && (isBuffer || heapType == D3D12_HEAP_TYPE_DEFAULT))
+    {
+        // Small textures can use the smaller placement alignment
+        D3D12_RESOURCE_DESC placedDesc = desc;
+        D3D12_RESOURCE_ALLOCATION_INFO info;
+        if (!isBuffer && !isTarget)
+        {
+            placedDesc.Alignment = D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT;
+            info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+            if (info.Alignment != D3D12_SMALL_RESOURCE_PLACEMENT_ALIGNMENT)
+            {
+                placedDesc.Alignment = 0;
+                info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+            }
+        }
+        else
+        {
+            info = device->GetResourceAllocationInfo(0, 1, &placedDesc);
+        }
+
+        // Big resources are created as committed to keep the heaps fragmentation low
+        if (info.SizeInBytes != UINT64_MAX && info.SizeInBytes <= DX12_HEAP_BLOCK_SIZE / 4)
+        {
+            if (!Allocate(heapType, heapFlags, info.SizeInBytes, info.Alignment, allocation))
+            {
+                const auto block = (Block*)allocation.Block;
+                const HRESULT result = device->CreatePlacedResource(block->Heap, allocation.Offset, &placedDesc, initialState, clearValue, IID_PPV_ARGS(resource));
+                if (SUCCEEDED(result))
+                    return result;
+                Free(allocation);
+            }
+        }
+    }
+
+    // Fallback to a committed resource
+    D3D12_HEAP_PROPERTIES heapProperties;
+    heapProperties.Type = heapType;
+    heapProperties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+    heapProperties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+    heapProperties.CreationNodeMask = 1;
+    heapProperties.VisibleNodeMask = 1;
+    return device->CreateCommittedResource(&heapProperties, D3D12_HEAP_FLAG_NONE, &desc, initialState, clearValue, IID_PPV_ARGS(resource));
+}
+
+HRESULT HeapAllocatorDX12::CreateTransientResource(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue, ID3D12Resource** resource, HeapAllocationDX12& allocation)
+{
+    auto device = _device->GetDevice();
+    allocation = HeapAllocationDX12();
+    const bool isTarget = (desc.Flags & (D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET | D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL)) != 0;
+    const D3D12_HEAP_FLAGS heapFlags = isTarget ? D3D12_HEAP_FLAG_ALLOW_ONLY_RT_DS_TEXTURES : D3D12_HEAP_FLAG_ALLOW_ONLY_NON_RT_DS_TEXTURES;
+    const D3D12_RESOURCE_ALLOCATION_INFO info = device->GetResourceAllocationInfo(0, 1, &desc);
+    if (info.SizeInBytes != UINT64_MAX)
+    {
+        ScopeLock lock(_locker);
+
+        // Find the memory range that is not used by any active transient resource
+        TransientBlock* block = nullptr;
+        uint64 offset = 0;
+        for (TransientBlock* e : _transientBlocks)
+        {
+            if (e->Flags == heapFlags && !FindTransientOffset(e, info.SizeInBytes, info.Alignment, offset))
+            {
+                block = e;
+                break;
+            }
+        }
+        if (!block)
+        {
+            // Create a new heap (with alignment that supports multisampled textures)
+            D3D12_HEAP_DESC heapDesc;
+            heapDesc.SizeInBytes = Math::Max<uint64>(DX12_TRANSIENT_HEAP_SIZE, (info.SizeInBytes + D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT - 1) & ~((uint64)D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT - 1));
+            heapDesc.Properties.Type = D3D12_HEAP_TYPE_DEFAULT;
+            heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+            heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+            heapDesc.Properties.CreationNodeMask = 1;
+            heapDesc.Properties.VisibleNodeMask = 1;
+            heapDesc.Alignment = D3D12_DEFAULT_MSAA_RESOURCE_PLACEMENT_ALIGNMENT;
+            heapDesc.Flags = heapFlags;
+            ID3D12Heap* heap;
+            const HRESULT result = device->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap));
+            LOG_DIRECTX_RESULT(result);
+            if (SUCCEEDED(result))
+            {
+                block = New<TransientBlock>();
+                block->Heap = heap;
+                block->Flags = heapFlags;
+                block->Size = heapDesc.SizeInBytes;
+                block->ResourcesCount = 0;
+                _transientBlocks.Add(block);
+                _heapsSize += block->Size;
+                offset = 0;
+            }
+        }
+        if (block)
+        {
+            const HRESULT result = device->CreatePlacedResource(block->Heap, offset, &desc, initialState, clearValue, IID_PPV_ARGS(resource));
+            if (SUCCEEDED(result))
+            {
+                block->ResourcesCount++;
+                allocation.Block = block;
+                allocation.Offset = offset;
+                allocation.Size = info.SizeInBytes;
+                allocation.IsTransient = true;
+                return result;
+            }
+        }
+    }
+
+    // Fallback to a regular resource (without aliasing)
+    return CreateResource(D3D12_HEAP_TYPE_DEFAULT, desc, initialState, clearValue, resource, allocation);
+}
+
+bool HeapAllocatorDX12::BeginTransient(const HeapAllocationDX12& allocation)
+{
+    ASSERT(allocation.IsTransient);
+    ScopeLock lock(_locker);
+    const auto block = (TransientBlock*)allocation.Block;
+    for (const Range& range : block->ActiveRanges)
+    {
+        if (allocation.Offset < range.Offset + range.Size && range.Offset < allocation.Offset + allocation.Size)
+            return true;
+    }
+    block->ActiveRanges.Add({ allocation.Offset, allocation.Size });
+    return false;
+}
+
+void HeapAllocatorDX12::EndTransient(const HeapAllocationDX12& allocation)
+{
+    ASSERT(allocation.IsTransient);
+    ScopeLock lock(_locker);
+    const auto block = (TransientBlock*)allocation.Block;
+    for (int32 i = 0; i < block->ActiveRanges.Count(); i++)
+    {
+        const Range& range = block->ActiveRanges[i];
+        if (range.Offset == allocation.Offset && range.Size == allocation.Size)
+        {
+            block->ActiveRanges.RemoveAtKeepOrder(i);
+            break;
+        }
+    }
+}
+
+void HeapAllocatorDX12::Free(HeapAllocationDX12& allocation)
+{
+    if (!allocation.IsValid())
+        return;
+    ScopeLock lock(_locker);
+    if (allocation.IsTransient)
+    {
+        // Release heap when the last resource placed within it gets released
+        const auto block = (TransientBlock*)allocation.Block;
+        block->ResourcesCount--;
+        if (block->ResourcesCount == 0)
+        {
+            _heapsSize -= block->Size;
+            block->Heap->Release();
+            _transientBlocks.Remove(block);
+            Delete(block);
+        }
+        allocation = HeapAllocationDX12();
+        return;
+    }
+    const auto block = (Block*)allocation.Block;
+    block->UsedSize -= allocation.Size;
+
+    // Insert the free range and merge it with the neighbours
+    int32 index = 0;
+    while (index < block->FreeRanges.Count() && block->FreeRanges[index].Offset < allocation.Offset)
+        index++;
+    block->FreeRanges.Insert(index, { allocation.Offset, allocation.Size });
+    if (index + 1 < block->FreeRanges.Count() && block->FreeRanges[index].Offset + block->FreeRanges[index].Size == block->FreeRanges[index + 1].Offset)
+    {
+        block->FreeRanges[index].Size += block->FreeRanges[index + 1].Size;
+        block->FreeRanges.RemoveAt(index + 1);
+    }
+    if (index > 0 && block->FreeRanges[index - 1].Offset + block->FreeRanges[index - 1].Size == block->FreeRanges[index].Offset)
+    {
+        block->FreeRanges[index - 1].Size += block->FreeRanges[index].Size;
+        block->FreeRanges.RemoveAt(index);
+    }
+    allocation = HeapAllocationDX12();
+
+    // Release empty heap unless it's the last one of that kind (prevents heaps creation spikes when resources are recreated)
+    if (block->UsedSize == 0)
+    {
+        for (const Block* e : _blocks)
+        {
+            if (e != block && e->Type == block->Type && e->Flags == block->Flags)
+            {
+                _heapsSize -= block->Size;
+                block->Heap->Release();
+                _blocks.Remove(block);
+                Delete(block);
+                break;
+            }
+        }
+    }
+}
+
+void HeapAllocatorDX12::ReleaseGPU()
+{
+    ScopeLock lock(_locker);
+    for (Block* block : _blocks)
+    {
+        if (block->UsedSize != 0)
+        {
+            LOG(Warning, "Releasing memory heap with {0} bytes still in use.", block->UsedSize);
+        }
+        block->Heap->Release();
+        Delete(block);
+    }
+    _blocks.Clear();
+    for (TransientBlock* block : _transientBlocks)
+    {
+        block->Heap->Release();
+        Delete(block);
+    }
+    _transientBlocks.Clear();
+    _heapsSize = 0;
+}
+
+bool HeapAllocatorDX12::Allocate(D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, uint64 size, uint64 alignment, HeapAllocationDX12& allocation)
+{
+    ScopeLock lock(_locker);
+
+    // Find the first free range that can fit the allocation
+    for (int32 attempt = 0; attempt < 2; attempt++)
+    {
+        for (Block* block : _blocks)
+        {
+            if (block->Type != heapType || block->Flags != heapFlags || block->Size - block->UsedSize < size)
+                continue;
+            for (int32 i = 0; i < block->FreeRanges.Count(); i++)
+            {
+                const Range range = block->FreeRanges[i];
+                const uint64 offset = (range.Offset + alignment - 1) & ~(alignment - 1);
+                const uint64 end = range.Offset + range.Size;
+                if (offset + size > end)
+                    continue;
+
+                // Split the range (alignment padding stays free)
+                block->FreeRanges.RemoveAt(i);
+                if (offset + size < end)
+                    block->FreeRanges.Insert(i, { offset + size, end - offset - size });
+                if (offset > range.Offset)
+                    block->FreeRanges.Insert(i, { range.Offset, offset - range.Offset });
+                block->UsedSize += size;
+                allocation.Block = block;
+                allocation.Offset = offset;
+                allocation.Size = size;
+                return false;
+            }
+        }
+
+        // Create a new heap
+        if (attempt == 0)
+        {
+            D3D12_HEAP_DESC heapDesc;
+            heapDesc.SizeInBytes = DX12_HEAP_BLOCK_SIZE;
+            heapDesc.Properties.Type = heapType;
+            heapDesc.Properties.CPUPageProperty = D3D12_CPU_PAGE_PROPERTY_UNKNOWN;
+            heapDesc.Properties.MemoryPoolPreference = D3D12_MEMORY_POOL_UNKNOWN;
+            heapDesc.Properties.CreationNodeMask = 1;
+            heapDesc.Properties.VisibleNodeMask = 1;
+            heapDesc.Alignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+            heapDesc.Flags = heapFlags;
+            ID3D12Heap* heap;
+            const HRESULT result = _device->GetDevice()->CreateHeap(&heapDesc, IID_PPV_ARGS(&heap));
+            if (FAILED(result))
+            {
+                LOG_DIRECTX_RESULT(result);
+                return true;
+            }
+            auto block = New<Block>();
+            block->Heap = heap;
+            block->Type = heapType;
+            block->Flags = heapFlags;
+            block->Size = DX12_HEAP_BLOCK_SIZE;
+            block->UsedSize = 0;
+            block->FreeRanges.Add({ 0, DX12_HEAP_BLOCK_SIZE });
+            _blocks.Add(block);
+            _heapsSize += DX12_HEAP_BLOCK_SIZE;
+        }
+    }
+    return true;
+}
+
+bool HeapAllocatorDX12::FindTransientOffset(const TransientBlock* block, uint64 size, uint64 alignment, uint64& offset)
+{
+    // Pick the lowest offset (at the heap start or right after any active range) that doesn't overlap with the active ranges
+    bool failed = true;
+    for (int32 i = -1; i < block->ActiveRanges.Count(); i++)
+    {
+        uint64 candidate = i < 0 ? 0 : block->ActiveRanges[i].Offset + block->ActiveRanges[i].Size;
+        candidate = (candidate + alignment - 1) & ~(alignment - 1);
+        if (candidate + size > block->Size || (!failed && candidate >= offset))
+            continue;
+        bool overlaps = false;
+        for (const Range& range : block->ActiveRanges)
+        {
+            if (candidate < range.Offset + range.Size && range.Offset < candidate + size)
+            {
+                overlaps = true;
+                break;
+            }
+        }
+        if (!overlaps)
+        {
+            offset = candidate;
+            failed = false;
+        }
+    }
+    return failed;
+}
+
+#endif
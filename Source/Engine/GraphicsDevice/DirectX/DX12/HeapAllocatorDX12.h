@@ -0,0 +1,155 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if GRAPHICS_API_DIRECTX12
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "../IncludeDirectXHeaders.h"
+
+class GPUDeviceDX12;
+
+// The size of the single memory heap used to suballocate placed resources (bigger resources are created as committed)
+#define DX12_HEAP_BLOCK_SIZE (64 * 1024 * 1024)
+
+// The default size of the memory heap used to alias transient textures (bigger textures get the dedicated heap)
+#define DX12_TRANSIENT_HEAP_SIZE (256 * 1024 * 1024)
+
+/// <summary>
+/// The placed resource memory allocation info (range within the memory heap block).
+/// </summary>
+struct HeapAllocationDX12
+{
+    /// <summary>
+    /// The memory heap block that owns the allocation (null if resource has not been placed in any heap, eg. committed resource).
+    /// </summary>
+    void* Block = nullptr;
+
+    /// <summary>
+    /// The allocation offset (in bytes) from the heap start.
+    /// </summary>
+    uint64 Offset = 0;
+
+    /// <summary>
+    /// The allocation size (in bytes).
+    /// </summary>
+    uint64 Size = 0;
+
+    /// <summary>
+    /// True if allocation is within the transient heap (memory range can be shared by the multiple resources that are not used at the same time).
+    /// </summary>
+    bool IsTransient = false;
+
+    FORCE_INLINE bool IsValid() const
+    {
+        return Block != nullptr;
+    }
+};
+
+/// <summary>
+/// GPU memory allocator for DirectX 12 that creates resources as placed within the big memory heaps (instead of a separate committed allocation per resource). Reduces the allocation overhead and the memory fragmentation.
+/// </summary>
+class HeapAllocatorDX12
+{
+private:
+
+    struct Range
+    {
+        uint64 Offset;
+        uint64 Size;
+    };
+
+    struct Block
+    {
+        ID3D12Heap* Heap;
+        D3D12_HEAP_TYPE Type;
+        D3D12_HEAP_FLAGS Flags;
+        uint64 Size;
+        uint64 UsedSize;
+        Array<Range> FreeRanges; // Sorted by the offset
+    };
+
+    struct TransientBlock
+    {
+        ID3D12Heap* Heap;
+        D3D12_HEAP_FLAGS Flags;
+        uint64 Size;
+        int32 ResourcesCount;
+        Array<Range> ActiveRanges; // Memory ranges used by the active transient resources
+    };
+
+    GPUDeviceDX12* _device;
+    CriticalSection _locker;
+    Array<Block*> _blocks;
+    Array<TransientBlock*> _transientBlocks;
+    uint64 _heapsSize;
+
+public:
+
+    HeapAllocatorDX12(GPUDeviceDX12* device);
+
+public:
+
+    /// <summary>
+    /// Gets the total size (in bytes) of the allocated memory heaps.
+    /// </summary>
+    FORCE_INLINE uint64 GetHeapsSize() const
+    {
+        return _heapsSize;
+    }
+
+    /// <summary>
+    /// Creates the resource. Uses the placed resource within the shared heap if possible, otherwise fallbacks to the committed resource.
+    /// </summary>
+    /// <param name="heapType">The memory heap type.</param>
+    /// <param name="desc">The resource description.</param>
+    /// <param name="initialState">The initial resource state.</param>
+    /// <param name="clearValue">The optimized clear value (optional).</param>
+    /// <param name="resource">The output resource.</param>
+    /// <param name="allocation">The output heap allocation (invalid if resource is committed). Has to be freed after releasing the resource.</param>
+    /// <returns>The result code.</returns>
+    HRESULT CreateResource(D3D12_HEAP_TYPE heapType, const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue, ID3D12Resource** resource, HeapAllocationDX12& allocation);
+
+    /// <summary>
+    /// Creates the transient texture resource placed within the shared heap memory that is not used by any active transient resource (memory can be aliased with the inactive ones). Fallbacks to the regular resource creation (without aliasing) if failed.
+    /// </summary>
+    /// <param name="desc">The resource description.</param>
+    /// <param name="initialState">The initial resource state.</param>
+    /// <param name="clearValue">The optimized clear value (optional).</param>
+    /// <param name="resource">The output resource.</param>
+    /// <param name="allocation">The output heap allocation. Has to be freed after releasing the resource.</param>
+    /// <returns>The result code.</returns>
+    HRESULT CreateTransientResource(const D3D12_RESOURCE_DESC& desc, D3D12_RESOURCE_STATES initialState, const D3D12_CLEAR_VALUE* clearValue, ID3D12Resource** resource, HeapAllocationDX12& allocation);
+
+    /// <summary>
+    /// Marks the transient allocation memory as used.
+    /// </summary>
+    /// <param name="allocation">The transient allocation.</param>
+    /// <returns>True if memory range is already used by the other active transient allocation, otherwise false.</returns>
+    bool BeginTransient(const HeapAllocationDX12& allocation);
+
+    /// <summary>
+    /// Marks the transient allocation memory as unused.
+    /// </summary>
+    /// <param name="allocation">The transient allocation.</param>
+    void EndTransient(const HeapAllocationDX12& allocation);
+
+    /// <summary>
+    /// Frees the heap allocation. The resource placed in that memory range has to be already released (and not used by the GPU).
+    /// </summary>
+    /// <param name="allocation">The allocation.</param>
+    void Free(HeapAllocationDX12& allocation);
+
+    /// <summary>
+    /// Releases all the memory heaps.
+    /// </summary>
+    void ReleaseGPU();
+
+private:
+
+    bool Allocate(D3D12_HEAP_TYPE heapType, D3D12_HEAP_FLAGS heapFlags, uint64 size, uint64 alignment, HeapAllocationDX12& allocation);
+    static bool FindTransientOffset(const TransientBlock* block, uint64 size, uint64 alignment, uint64& offset);
+};
+
+#endif
@@ -27,11 +27,15 @@ void ResourceOwnerDX12::releaseResource(uint32 safeFrameCount)
         OnRelease(this);
 
         auto resource = _resource;
+        const auto allocation = _allocation;
         _resource = nullptr;
         _subresourcesCount = 0;
+        _allocation = HeapAllocationDX12();
+        _discardOnFirstUse = false;
+        _aliasOnFirstUse = false;
         State.Release();
 
-        ((GPUDeviceDX12*)GPUDevice::Instance)->AddResourceToLateRelease(resource, safeFrameCount);
+        ((GPUDeviceDX12*)GPUDevice::Instance)->AddResourceToLateRelease(resource, allocation, safeFrameCount);
     }
 }
 
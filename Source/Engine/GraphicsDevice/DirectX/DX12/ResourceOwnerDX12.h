@@ -5,6 +5,7 @@
 #include "Engine/Core/Delegate.h"
 #include "Engine/Graphics/GPUResourceState.h"
 #include "../IncludeDirectXHeaders.h"
+#include "HeapAllocatorDX12.h"
 
 #if GRAPHICS_API_DIRECTX12
 
@@ -62,10 +63,15 @@ class ResourceOwnerDX12
 
     ID3D12Resource* _resource;
     uint32 _subresourcesCount;
+    HeapAllocationDX12 _allocation;
+    bool _discardOnFirstUse; // Placed render targets and depth buffers need to be initialized before use (memory may contain data of the previously placed resources)
+    bool _aliasOnFirstUse; // Transient resources need the aliasing barrier before use (memory could be used by the other transient resources)
 
     ResourceOwnerDX12()
         : _resource(nullptr)
         , _subresourcesCount(0)
+        , _discardOnFirstUse(false)
+        , _aliasOnFirstUse(false)
     {
     }
 
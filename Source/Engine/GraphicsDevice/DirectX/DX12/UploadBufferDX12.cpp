@@ -6,6 +6,7 @@
 #include "GPUTextureDX12.h"
 #include "GPUContextDX12.h"
 #include "../RenderToolsDX.h"
+#include "Engine/Threading/Threading.h"
 
 UploadBufferDX12::UploadBufferDX12(GPUDeviceDX12* device)
     : _device(device)
@@ -34,6 +35,7 @@ DynamicAllocation UploadBufferDX12::Allocate(uint64 size, uint64 align)
     const bool useDefaultSize = size <= DX12_DEFAULT_UPLOAD_PAGE_SIZE;
     const uint64 pageSize = useDefaultSize ? DX12_DEFAULT_UPLOAD_PAGE_SIZE : size;
     const uint64 alignedSize = Math::AlignUpWithMask(size, alignmentMask);
+    ScopeLock lock(_locker);
 
     // Align the allocation
     _currentOffset = Math::AlignUpWithMask(_currentOffset, alignmentMask);
@@ -140,6 +142,8 @@ bool UploadBufferDX12::UploadTexture(GPUContextDX12* context, ID3D12Resource* te
 
 void UploadBufferDX12::BeginGeneration(uint64 generation)
 {
+    ScopeLock lock(_locker);
+
     // Restore ready pages to be reused
     for (int32 i = 0; _usedPages.HasItems() && i < _usedPages.Count(); i++)
     {
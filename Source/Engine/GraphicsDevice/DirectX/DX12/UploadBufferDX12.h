@@ -160,6 +160,7 @@ class UploadBufferDX12
     UploadBufferPageDX12* _currentPage;
     uint64 _currentOffset;
     uint64 _currentGeneration;
+    CriticalSection _locker;
 
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _freePages;
     Array<UploadBufferPageDX12*, InlinedAllocation<64>> _usedPages;
@@ -30,6 +30,9 @@
 #define VULKAN_ENABLE_API_DUMP 0
 #define VULKAN_RESET_QUERY_POOLS 0
 #define VULKAN_HASH_POOLS_WITH_LAYOUT_TYPES 1
+#ifndef VULKAN_USE_DESCRIPTOR_SET_CACHE
+#define VULKAN_USE_DESCRIPTOR_SET_CACHE 1
+#endif
 #define VULKAN_USE_DEBUG_LAYER GPU_ENABLE_DIAGNOSTICS
 #define VULKAN_USE_DEBUG_DATA (GPU_ENABLE_DIAGNOSTICS && COMPILE_WITH_DEV_ENV)
 
@@ -182,6 +182,14 @@ bool DescriptorPoolVulkan::AllocateDescriptorSets(const VkDescriptorSetAllocateI
     return vkAllocateDescriptorSets(_device->Device, &allocateInfo, result) == VK_SUCCESS;
 }
 
+void DescriptorPoolVulkan::FreeDescriptorSets(uint32 count, const VkDescriptorSet* sets)
+{
+    if (count != 0)
+    {
+        VALIDATE_VULKAN_RESULT(vkFreeDescriptorSets(_device->Device, _handle, count, sets));
+    }
+}
+
 TypedDescriptorPoolSetVulkan::~TypedDescriptorPoolSetVulkan()
 {
     for (auto pool = _poolListHead; pool;)
@@ -319,6 +327,173 @@ void DescriptorPoolsManagerVulkan::GC()
     }
 }
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+
+// The amount of frames after which the unused cached descriptor sets get freed
+#define VULKAN_DESCRIPTOR_SET_CACHE_UNUSED_FRAMES 120
+
+bool DescriptorSetCacheVulkan::Entry::HasReference(uint64 handle) const
+{
+    for (const VkDescriptorImageInfo& e : ImageInfo)
+    {
+        if ((uint64)e.imageView == handle || (uint64)e.sampler == handle)
+            return true;
+    }
+    for (const VkDescriptorBufferInfo& e : BufferInfo)
+    {
+        if ((uint64)e.buffer == handle)
+            return true;
+    }
+    for (const VkBufferView& e : TexelBufferView)
+    {
+        if ((uint64)e == handle)
+            return true;
+    }
+    return false;
+}
+
+bool DescriptorSetCacheVulkan::Entry::Equals(const DescriptorSetWriteContainerVulkan& writes) const
+{
+    return ImageInfo.Count() == writes.DescriptorImageInfo.Count() &&
+            BufferInfo.Count() == writes.DescriptorBufferInfo.Count() &&
+            TexelBufferView.Count() == writes.DescriptorTexelBufferView.Count() &&
+            Platform::MemoryCompare(ImageInfo.Get(), writes.DescriptorImageInfo.Get(), ImageInfo.Count() * sizeof(VkDescriptorImageInfo)) == 0 &&
+            Platform::MemoryCompare(BufferInfo.Get(), writes.DescriptorBufferInfo.Get(), BufferInfo.Count() * sizeof(VkDescriptorBufferInfo)) == 0 &&
+            Platform::MemoryCompare(TexelBufferView.Get(), writes.DescriptorTexelBufferView.Get(), TexelBufferView.Count() * sizeof(VkBufferView)) == 0;
+}
+
+DescriptorSetCacheVulkan::DescriptorSetCacheVulkan(GPUDeviceVulkan* device)
+    : _device(device)
+{
+}
+
+DescriptorSetCacheVulkan::~DescriptorSetCacheVulkan()
+{
+    // Pools destruction frees all the sets
+    _entries.ClearDelete();
+    _pendingFree.ClearDelete();
+    for (auto& e : _pools)
+        e.Value.ClearDelete();
+    _pools.Clear();
+}
+
+uint32 DescriptorSetCacheVulkan::GetWritesHash(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes)
+{
+    uint32 hash = GetHash(layout);
+    CombineHash(hash, (uint32)(uintptr)&layout);
+    hash = Crc::MemCrc32(writes.DescriptorImageInfo.Get(), writes.DescriptorImageInfo.Count() * sizeof(VkDescriptorImageInfo), hash);
+    hash = Crc::MemCrc32(writes.DescriptorBufferInfo.Get(), writes.DescriptorBufferInfo.Count() * sizeof(VkDescriptorBufferInfo), hash);
+    hash = Crc::MemCrc32(writes.DescriptorTexelBufferView.Get(), writes.DescriptorTexelBufferView.Count() * sizeof(VkBufferView), hash);
+    return hash;
+}
+
+bool DescriptorSetCacheVulkan::GetDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, VkDescriptorSet* outSets, bool& needsWrite)
+{
+    if (layout.Handles.IsEmpty())
+    {
+        needsWrite = false;
+        return false;
+    }
+    const uint32 hash = GetWritesHash(layout, writes);
+    ScopeLock lock(_locker);
+
+    // Try to reuse the cached sets
+    Entry* entry;
+    if (_entries.TryGet(hash, entry))
+    {
+        if (entry->Layout == &layout && entry->Equals(writes))
+        {
+            entry->LastFrameUsed = Engine::FrameCount;
+            Platform::MemoryCopy(outSets, entry->Sets.Get(), entry->Sets.Count() * sizeof(VkDescriptorSet));
+            needsWrite = false;
+            return false;
+        }
+
+        // Hash collision so replace the old entry
+        _entries.Remove(hash);
+        _pendingFree.Add(entry);
+    }
+
+    // Allocate a new sets from the persistent pools
+    auto& pools = _pools[&layout];
+    DescriptorPoolVulkan* pool = nullptr;
+    for (int32 i = pools.Count() - 1; i >= 0; i--)
+    {
+        if (pools[i]->AllocateDescriptorSets(layout.AllocateInfo, outSets))
+        {
+            pool = pools[i];
+            break;
+        }
+    }
+    if (!pool)
+    {
+        pool = New<DescriptorPoolVulkan>(_device, layout);
+        pools.Add(pool);
+        if (!pool->AllocateDescriptorSets(layout.AllocateInfo, outSets))
+            return true;
+    }
+    pool->Track(layout);
+
+    // Cache the sets
+    entry = New<Entry>();
+    entry->Layout = &layout;
+    entry->Pool = pool;
+    entry->Sets.Set(outSets, layout.Handles.Count());
+    entry->ImageInfo = writes.DescriptorImageInfo;
+    entry->BufferInfo = writes.DescriptorBufferInfo;
+    entry->TexelBufferView = writes.DescriptorTexelBufferView;
+    entry->LastFrameUsed = Engine::FrameCount;
+    _entries.Add(hash, entry);
+    needsWrite = true;
+    return false;
+}
+
+void DescriptorSetCacheVulkan::OnResourceDestroy(uint64 handle)
+{
+    ScopeLock lock(_locker);
+    for (auto i = _entries.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (i->Value->HasReference(handle))
+        {
+            // Sets can be still in use by the GPU so free them later
+            _pendingFree.Add(i->Value);
+            _entries.Remove(i);
+        }
+    }
+}
+
+void DescriptorSetCacheVulkan::GC()
+{
+    ScopeLock lock(_locker);
+    const uint64 frame = Engine::FrameCount;
+    for (auto i = _entries.Begin(); i.IsNotEnd(); ++i)
+    {
+        if (frame - i->Value->LastFrameUsed > VULKAN_DESCRIPTOR_SET_CACHE_UNUSED_FRAMES)
+        {
+            _pendingFree.Add(i->Value);
+            _entries.Remove(i);
+        }
+    }
+    for (int32 i = _pendingFree.Count() - 1; i >= 0; i--)
+    {
+        Entry* entry = _pendingFree[i];
+        if (frame - entry->LastFrameUsed > VULKAN_RESOURCE_DELETE_SAFE_FRAMES_COUNT)
+        {
+            _pendingFree.RemoveAt(i);
+            FreeEntry(entry);
+        }
+    }
+}
+
+void DescriptorSetCacheVulkan::FreeEntry(Entry* entry)
+{
+    entry->Pool->FreeDescriptorSets(entry->Sets.Count(), entry->Sets.Get());
+    entry->Pool->TrackRemoveUsage(*entry->Layout);
+    Delete(entry);
+}
+
+#endif
+
 PipelineLayoutVulkan::PipelineLayoutVulkan(GPUDeviceVulkan* device, const DescriptorSetLayoutInfoVulkan& layout)
     : Device(device)
     , Handle(VK_NULL_HANDLE)
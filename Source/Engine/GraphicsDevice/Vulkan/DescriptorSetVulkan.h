@@ -154,6 +154,7 @@ class DescriptorPoolVulkan
     void TrackRemoveUsage(const DescriptorSetLayoutVulkan& layout);
     void Reset();
     bool AllocateDescriptorSets(const VkDescriptorSetAllocateInfo& descriptorSetAllocateInfo, VkDescriptorSet* result);
+    void FreeDescriptorSets(uint32 count, const VkDescriptorSet* sets);
 };
 
 class DescriptorPoolSetContainerVulkan;
@@ -240,6 +241,69 @@ class DescriptorPoolsManagerVulkan
     void GC();
 };
 
+struct DescriptorSetWriteContainerVulkan;
+
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+
+/// <summary>
+/// Cache of the descriptor sets that reuses sets with the same layout and bound resources across the draws and frames (skips sets allocation and descriptors update).
+/// </summary>
+class DescriptorSetCacheVulkan
+{
+private:
+    struct Entry
+    {
+        const DescriptorSetLayoutVulkan* Layout;
+        DescriptorPoolVulkan* Pool;
+        Array<VkDescriptorSet, FixedAllocation<DescriptorSet::Max>> Sets;
+        Array<VkDescriptorImageInfo> ImageInfo;
+        Array<VkDescriptorBufferInfo> BufferInfo;
+        Array<VkBufferView> TexelBufferView;
+        uint64 LastFrameUsed;
+
+        bool HasReference(uint64 handle) const;
+        bool Equals(const DescriptorSetWriteContainerVulkan& writes) const;
+    };
+
+    GPUDeviceVulkan* _device;
+    CriticalSection _locker;
+    Dictionary<uint32, Entry*> _entries;
+    Dictionary<const DescriptorSetLayoutVulkan*, Array<DescriptorPoolVulkan*>> _pools;
+    Array<Entry*> _pendingFree;
+
+public:
+    DescriptorSetCacheVulkan(GPUDeviceVulkan* device);
+    ~DescriptorSetCacheVulkan();
+
+public:
+    /// <summary>
+    /// Gets the descriptor sets for the given layout and bound resources. Reuses the cached sets if possible, otherwise allocates new ones that have to be written by the caller.
+    /// </summary>
+    /// <param name="layout">The descriptor sets layout.</param>
+    /// <param name="writes">The descriptor writes with the bound resources.</param>
+    /// <param name="outSets">The output descriptor sets (one per set layout).</param>
+    /// <param name="needsWrite">The output flag set if sets are new and descriptors have to be written.</param>
+    /// <returns>True if failed to allocate sets, otherwise false.</returns>
+    bool GetDescriptorSets(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes, VkDescriptorSet* outSets, bool& needsWrite);
+
+    /// <summary>
+    /// Invalidates all the cached sets that reference the given resource (image view, buffer, buffer view or sampler). Called before releasing the resource.
+    /// </summary>
+    /// <param name="handle">The Vulkan resource handle.</param>
+    void OnResourceDestroy(uint64 handle);
+
+    /// <summary>
+    /// Frees the unused sets (invalidated or not used for a long time).
+    /// </summary>
+    void GC();
+
+private:
+    static uint32 GetWritesHash(const DescriptorSetLayoutVulkan& layout, const DescriptorSetWriteContainerVulkan& writes);
+    void FreeEntry(Entry* entry);
+};
+
+#endif
+
 class PipelineLayoutVulkan
 {
 public:
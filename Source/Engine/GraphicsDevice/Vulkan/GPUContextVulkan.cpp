@@ -585,6 +585,19 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
 
     bool needsWrite = false;
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    // Update descriptors
+    UpdateDescriptorSets(*pipelineState->DescriptorInfo, pipelineState->DSWriter, needsWrite);
+
+    // Reuse the cached sets or allocate new ones (written only once)
+    if (_device->DescriptorSetCache->GetDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, pipelineState->DescriptorSetHandles.Get(), needsWrite))
+        return;
+    if (needsWrite)
+    {
+        pipelineState->DSWriter.SetDescriptorSet(pipelineState->DescriptorSetHandles[DescriptorSet::Compute]);
+        vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
+    }
+#else
     // No current descriptor pools set - acquire one and reset
     const bool newDescriptorPool = pipelineState->AcquirePoolSet(cmdBuffer);
     needsWrite |= newDescriptorPool;
@@ -604,6 +617,7 @@ void GPUContextVulkan::UpdateDescriptorSets(ComputePipelineStateVulkan* pipeline
 
         vkUpdateDescriptorSets(_device->Device, pipelineState->DSWriteContainer.DescriptorWrites.Count(), pipelineState->DSWriteContainer.DescriptorWrites.Get(), 0, nullptr);
     }
+#endif
 }
 
 void GPUContextVulkan::OnDrawCall()
@@ -618,8 +632,15 @@ void GPUContextVulkan::OnDrawCall()
 
     if (pipelineState->HasDescriptorsPerStageMask)
     {
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+        // Lazy init
+        if (!pipelineState->DescriptorSetsLayout)
+            pipelineState->GetLayout();
+        bool needsWrite = false;
+#else
         // Get descriptor pools set
         bool needsWrite = pipelineState->AcquirePoolSet(cmdBuffer);
+#endif
 
         // Update descriptors for every used shader stage
         uint32 remainingHasDescriptorsPerStageMask = pipelineState->HasDescriptorsPerStageMask;
@@ -630,11 +651,19 @@ void GPUContextVulkan::OnDrawCall()
             remainingHasDescriptorsPerStageMask >>= 1;
         }
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+        // Reuse the cached sets or allocate new ones (written only once)
+        if (_device->DescriptorSetCache->GetDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DSWriteContainer, pipelineState->DescriptorSetHandles.Get(), needsWrite))
+            return;
+#else
         // Allocate sets if need to
         //if (needsWrite) // TODO: write on change only?
+        if (!pipelineState->CurrentTypedDescriptorPoolSet->AllocateDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DescriptorSetHandles.Get()))
+            return;
+        needsWrite = true;
+#endif
+        if (needsWrite)
         {
-            if (!pipelineState->CurrentTypedDescriptorPoolSet->AllocateDescriptorSets(*pipelineState->DescriptorSetsLayout, pipelineState->DescriptorSetHandles.Get()))
-                return;
             uint32 remainingStagesMask = pipelineState->HasDescriptorsPerStageMask;
             uint32 stage = 0;
             while (remainingStagesMask)
@@ -1044,7 +1073,7 @@ void GPUContextVulkan::BindIB(GPUBuffer* indexBuffer)
 {
     const auto cmdBuffer = _cmdBufferManager->GetCmdBuffer();
     const auto ibVulkan = static_cast<GPUBufferVulkan*>(indexBuffer)->GetHandle();
-    vkCmdBindIndexBuffer(cmdBuffer->GetHandle(), ibVulkan, 0, indexBuffer->GetFormat() == PixelFormat::R32_UInt ? VK_INDEX_TYPE_UINT32 : VK_INDEX_TYPE_UINT16);
+    vkCmdBindIndexBuffer(cmdBuffer->GetHandle(), ibVulkan, 0, indexBuffer->GetStride() == 4 ? VK_INDEX_TYPE_UINT32 : VK_INDEX_TYPE_UINT16);
 }
 
 void GPUContextVulkan::BindSampler(int32 slot, GPUSampler* sampler)
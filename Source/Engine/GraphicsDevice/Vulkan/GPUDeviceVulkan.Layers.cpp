@@ -44,6 +44,9 @@ static const char* GInstanceExtensions[] =
 #endif
 #if defined(VK_KHR_display) && 0
     VK_KHR_DISPLAY_EXTENSION_NAME,
+#endif
+#if VK_EXT_memory_budget && VK_KHR_get_physical_device_properties2 && !PLATFORM_APPLE_FAMILY
+    VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME,
 #endif
     nullptr
 };
@@ -62,6 +65,9 @@ static const char* GDeviceExtensions[] =
 #endif
 #if VK_KHR_sampler_mirror_clamp_to_edge
     VK_KHR_SAMPLER_MIRROR_CLAMP_TO_EDGE_EXTENSION_NAME,
+#endif
+#if VK_EXT_memory_budget
+    VK_EXT_MEMORY_BUDGET_EXTENSION_NAME,
 #endif
     nullptr
 };
@@ -585,6 +591,9 @@ void GPUDeviceVulkan::ParseOptionalDeviceExtensions(const Array<const char*>& de
 #if VULKAN_USE_VALIDATION_CACHE
     OptionalDeviceExtensions.HasEXTValidationCache = RenderToolsVulkan::HasExtension(deviceExtensions, VK_EXT_VALIDATION_CACHE_EXTENSION_NAME);
 #endif
+#if VK_EXT_memory_budget && VK_KHR_get_physical_device_properties2
+    OptionalDeviceExtensions.HasEXTMemoryBudget = RenderToolsVulkan::HasExtension(deviceExtensions, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) && RenderToolsVulkan::HasExtension(InstanceExtensions, VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+#endif
 }
 
 #endif
@@ -28,6 +28,7 @@
 #include "Engine/Platform/File.h"
 #include "Engine/Graphics/Textures/GPUSamplerDescription.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Graphics/GPUPipelineStateManifest.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Engine/Globals.h"
 #include "Engine/Engine/CommandLine.h"
@@ -409,6 +410,12 @@ void DeferredDeletionQueueVulkan::EnqueueGenericResource(Type type, uint64 handl
 {
     ASSERT_LOW_LAYER(handle != 0);
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    // Invalidate cached descriptor sets that use this resource
+    if (_device->DescriptorSetCache && (type == Buffer || type == BufferView || type == ImageView || type == Sampler))
+        _device->DescriptorSetCache->OnResourceDestroy(handle);
+#endif
+
     Entry entry;
     _device->GraphicsQueue->GetLastSubmittedInfo(entry.CmdBuffer, entry.FenceCounter);
     entry.Handle = handle;
@@ -1259,6 +1266,7 @@ GPUDeviceVulkan::~GPUDeviceVulkan()
 
 RenderPassVulkan* GPUDeviceVulkan::GetOrCreateRenderPass(RenderTargetLayoutVulkan& layout)
 {
+    ScopeLock lock(_renderPassesLock); // Render passes can be created from the pipeline states warmup
     RenderPassVulkan* renderPass;
     if (_renderPasses.TryGet(layout, renderPass))
         return renderPass;
@@ -1706,6 +1714,9 @@ bool GPUDeviceVulkan::Init()
         limits.HasReadOnlyDepth = true;
         limits.HasMultisampleDepthAsSRV = !!PhysicalDeviceFeatures.sampleRateShading;
         limits.HasTypedUAVLoad = true;
+        limits.HasBindless = false; // TODO: add bindless support for Vulkan (descriptor indexing)
+        limits.HasVariableRateShading = false; // TODO: add Variable Rate Shading support for Vulkan (VK_KHR_fragment_shading_rate attachment in render passes)
+        limits.HasPipelineStatistics = false; // TODO: add pipeline statistics queries for Vulkan (queries cannot span render pass instances)
         limits.MaximumMipLevelsCount = Math::Min(static_cast<int32>(log2(PhysicalDeviceLimits.maxImageDimension2D)), GPU_MAX_TEXTURE_MIP_LEVELS);
         limits.MaximumTexture1DSize = PhysicalDeviceLimits.maxImageDimension1D;
         limits.MaximumTexture1DArraySize = PhysicalDeviceLimits.maxImageArrayLayers;
@@ -1714,6 +1725,7 @@ bool GPUDeviceVulkan::Init()
         limits.MaximumTexture3DSize = PhysicalDeviceLimits.maxImageDimension3D;
         limits.MaximumTextureCubeSize = PhysicalDeviceLimits.maxImageDimensionCube;
         limits.MaximumSamplerAnisotropy = PhysicalDeviceLimits.maxSamplerAnisotropy;
+        limits.VariableRateShadingTileSize = 0;
 
         for (int32 i = 0; i < static_cast<int32>(PixelFormat::MAX); i++)
         {
@@ -1843,6 +1855,17 @@ bool GPUDeviceVulkan::Init()
 #endif
 #undef INIT_FUNC
         VmaAllocatorCreateInfo allocatorInfo = {};
+#if VMA_MEMORY_BUDGET
+        vulkanFunctions.vkGetPhysicalDeviceMemoryProperties2KHR = nullptr;
+#if VK_EXT_memory_budget && VK_KHR_get_physical_device_properties2
+        if (OptionalDeviceExtensions.HasEXTMemoryBudget && vkGetPhysicalDeviceMemoryProperties2KHR)
+        {
+            // Use the OS memory budget (instead of the estimated one)
+            vulkanFunctions.vkGetPhysicalDeviceMemoryProperties2KHR = vkGetPhysicalDeviceMemoryProperties2KHR;
+            allocatorInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+        }
+#endif
+#endif
         allocatorInfo.vulkanApiVersion = VULKAN_API_VERSION;
         allocatorInfo.physicalDevice = gpu;
         allocatorInfo.instance = Instance;
@@ -1882,6 +1905,9 @@ bool GPUDeviceVulkan::Init()
     FenceManager.Init(this);
     UniformBufferUploader = New<UniformBufferUploaderVulkan>(this);
     DescriptorPoolsManager = New<DescriptorPoolsManagerVulkan>(this);
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    DescriptorSetCache = New<DescriptorSetCacheVulkan>(this);
+#endif
     MainContext = New<GPUContextVulkan>(this, GraphicsQueue);
     if (vkCreatePipelineCache)
     {
@@ -1943,6 +1969,7 @@ bool GPUDeviceVulkan::Init()
         LOG_VULKAN_RESULT(result);
     }
 #endif
+    GPUPipelineStateManifest::Init(TEXT("Vulkan"), sizeof(RenderTargetLayoutVulkan));
 
     _state = DeviceState::Ready;
     return GPUDevice::Init();
@@ -1957,6 +1984,9 @@ void GPUDeviceVulkan::DrawBegin()
     DeferredDeletionQueue.ReleaseResources();
     StagingManager.ProcessPendingFree();
     DescriptorPoolsManager->GC();
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    DescriptorSetCache->GC();
+#endif
 }
 
 void GPUDeviceVulkan::Dispose()
@@ -1975,6 +2005,7 @@ void GPUDeviceVulkan::Dispose()
 
     // Pre dispose
     preDispose();
+    GPUPipelineStateManifest::Dispose();
 
     // Clear stuff
     _framebuffers.ClearDelete();
@@ -1985,6 +2016,9 @@ void GPUDeviceVulkan::Dispose()
     TimestampQueryPools.ClearDelete();
     SAFE_DELETE_GPU_RESOURCE(UniformBufferUploader);
     Delete(DescriptorPoolsManager);
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    SAFE_DELETE(DescriptorSetCache);
+#endif
     SAFE_DELETE(MainContext);
     if (TransferQueue != GraphicsQueue && ComputeQueue != TransferQueue)
         SAFE_DELETE(TransferQueue);
@@ -2080,6 +2114,29 @@ GPUConstantBuffer* GPUDeviceVulkan::CreateConstantBuffer(uint32 size, const Stri
     return New<GPUConstantBufferVulkan>(this, size);
 }
 
+bool GPUDeviceVulkan::QueryMemoryBudget(uint64& budget, uint64& usage) const
+{
+    if (!Allocator)
+        return true;
+
+    // Sum the device local memory heaps (budget is estimated by the allocator if VK_EXT_memory_budget is not supported)
+    const VkPhysicalDeviceMemoryProperties* memoryProperties;
+    vmaGetMemoryProperties(Allocator, &memoryProperties);
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS];
+    vmaGetBudget(Allocator, budgets);
+    budget = 0;
+    usage = 0;
+    for (uint32 i = 0; i < memoryProperties->memoryHeapCount; i++)
+    {
+        if (memoryProperties->memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT)
+        {
+            budget += budgets[i].budget;
+            usage += budgets[i].usage;
+        }
+    }
+    return budget == 0;
+}
+
 SemaphoreVulkan::SemaphoreVulkan(GPUDeviceVulkan* device)
     : _device(device)
 {
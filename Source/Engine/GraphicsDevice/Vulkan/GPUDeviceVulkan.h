@@ -26,6 +26,7 @@ class FenceManagerVulkan;
 class GPUDeviceVulkan;
 class UniformBufferUploaderVulkan;
 class DescriptorPoolsManagerVulkan;
+class DescriptorSetCacheVulkan;
 
 class SemaphoreVulkan
 {
@@ -372,6 +373,7 @@ class GPUDeviceVulkan : public GPUDevice
 
 private:
     CriticalSection _fenceLock;
+    CriticalSection _renderPassesLock;
     mutable void* _nativePtr[2];
 
     Dictionary<RenderTargetLayoutVulkan, RenderPassVulkan*> _renderPasses;
@@ -402,6 +404,9 @@ class GPUDeviceVulkan : public GPUDevice
         uint32 HasMirrorClampToEdge : 1;
 #if VULKAN_USE_VALIDATION_CACHE
         uint32 HasEXTValidationCache : 1;
+#endif
+#if VK_EXT_memory_budget && VK_KHR_get_physical_device_properties2
+        uint32 HasEXTMemoryBudget : 1;
 #endif
     };
 
@@ -515,6 +520,13 @@ class GPUDeviceVulkan : public GPUDevice
     /// </summary>
     DescriptorPoolsManagerVulkan* DescriptorPoolsManager = nullptr;
 
+#if VULKAN_USE_DESCRIPTOR_SET_CACHE
+    /// <summary>
+    /// The descriptor sets cache (reuses sets with the same bound resources across draws and frames).
+    /// </summary>
+    DescriptorSetCacheVulkan* DescriptorSetCache = nullptr;
+#endif
+
     /// <summary>
     /// The physical device limits.
     /// </summary>
@@ -610,6 +622,7 @@ class GPUDeviceVulkan : public GPUDevice
     GPUSampler* CreateSampler() override;
     GPUSwapChain* CreateSwapChain(Window* window) override;
     GPUConstantBuffer* CreateConstantBuffer(uint32 size, const StringView& name) override;
+    bool QueryMemoryBudget(uint64& budget, uint64& usage) const override;
 };
 
 /// <summary>
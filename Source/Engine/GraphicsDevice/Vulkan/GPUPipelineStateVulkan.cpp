@@ -8,6 +8,9 @@
 #include "GPUShaderProgramVulkan.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Graphics/GPUPipelineStateManifest.h"
+#include "Engine/Threading/Task.h"
+#include "Engine/Threading/Threading.h"
 
 static VkStencilOp ToVulkanStencilOp(const StencilOperation value)
 {
@@ -158,38 +161,55 @@ PipelineLayoutVulkan* GPUPipelineStateVulkan::GetLayout()
     return _layout;
 }
 
+namespace
+{
+    // Pipelines can be created from the background warmup task
+    CriticalSection PipelinesLocker;
+}
+
 VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
 {
     ASSERT(renderPass);
 
     // Try reuse cached version
     VkPipeline pipeline = VK_NULL_HANDLE;
-    if (_pipelines.TryGet(renderPass, pipeline))
     {
+        ScopeLock lock(PipelinesLocker);
+        if (_pipelines.TryGet(renderPass, pipeline))
+        {
 #if BUILD_DEBUG
-        // Verify
-        RenderPassVulkan* refKey = nullptr;
-        _pipelines.KeyOf(pipeline, &refKey);
-        ASSERT(refKey == renderPass);
+            // Verify
+            RenderPassVulkan* refKey = nullptr;
+            _pipelines.KeyOf(pipeline, &refKey);
+            ASSERT(refKey == renderPass);
 #endif
-        return pipeline;
+            return pipeline;
+        }
+
+        // Check if has missing layout
+        if (_desc.layout == VK_NULL_HANDLE)
+        {
+            _desc.layout = GetLayout()->Handle;
+        }
     }
 
     PROFILE_CPU_NAMED("Create Pipeline");
 
-    // Update description to match the pipeline
-    _descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
-    _descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
-    _desc.renderPass = renderPass->Handle;
+    // Record the used variant to precompile it on the next startup
+    GPUPipelineStateManifest::Record(GetHash(), &renderPass->Layout);
 
-    // Check if has missing layout
-    if (_desc.layout == VK_NULL_HANDLE)
-    {
-        _desc.layout = GetLayout()->Handle;
-    }
+    // Update description to match the pipeline (use local copy to support creating multiple pipelines in parallel)
+    VkGraphicsPipelineCreateInfo desc = _desc;
+    VkPipelineColorBlendStateCreateInfo descColorBlend = _descColorBlend;
+    VkPipelineMultisampleStateCreateInfo descMultisample = _descMultisample;
+    descColorBlend.attachmentCount = renderPass->Layout.RTsCount;
+    descMultisample.rasterizationSamples = (VkSampleCountFlagBits)renderPass->Layout.MSAA;
+    desc.pColorBlendState = &descColorBlend;
+    desc.pMultisampleState = &descMultisample;
+    desc.renderPass = renderPass->Handle;
 
     // Create object
-    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &_desc, nullptr, &pipeline);
+    const VkResult result = vkCreateGraphicsPipelines(_device->Device, _device->PipelineCache, 1, &desc, nullptr, &pipeline);
     LOG_VULKAN_RESULT(result);
     if (result != VK_SUCCESS)
     {
@@ -201,7 +221,14 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
         return VK_NULL_HANDLE;
     }
 
-    // Cache it
+    // Cache it (pipeline could be created by the other thread in the meantime)
+    ScopeLock lock(PipelinesLocker);
+    VkPipeline existing = VK_NULL_HANDLE;
+    if (_pipelines.TryGet(renderPass, existing))
+    {
+        _device->DeferredDeletionQueue.EnqueueResource(DeferredDeletionQueueVulkan::Type::Pipeline, pipeline);
+        return existing;
+    }
     _pipelines.Add(renderPass, pipeline);
 
     return pipeline;
@@ -209,6 +236,12 @@ VkPipeline GPUPipelineStateVulkan::GetState(RenderPassVulkan* renderPass)
 
 void GPUPipelineStateVulkan::OnReleaseGPU()
 {
+    if (_warmupTask)
+    {
+        _warmupTask->Wait();
+        _warmupTask = nullptr;
+    }
+    _warmupLayouts.Resize(0);
     DSWriteContainer.Release();
     if (CurrentTypedDescriptorPoolSet)
     {
@@ -439,7 +472,24 @@ bool GPUPipelineStateVulkan::Init(const Description& desc)
     // Set non-zero memory usage
     _memoryUsage = sizeof(VkGraphicsPipelineCreateInfo);
 
-    return GPUPipelineState::Init(desc);
+    if (GPUPipelineState::Init(desc))
+        return true;
+
+    // Precompile the pipeline variants recorded in the manifest in the background (render passes include the render targets size so warmup mostly fills the pipeline cache)
+    Array<byte> variants;
+    if (GPUPipelineStateManifest::GetVariants(GetHash(), variants))
+    {
+        _desc.layout = GetLayout()->Handle;
+        _warmupLayouts.Set((const RenderTargetLayoutVulkan*)variants.Get(), variants.Count() / sizeof(RenderTargetLayoutVulkan));
+        _warmupTask = Task::StartNew([this]
+        {
+            PROFILE_CPU_NAMED("Pipeline State Warmup");
+            for (RenderTargetLayoutVulkan& layout : _warmupLayouts)
+                GetState(_device->GetOrCreateRenderPass(layout));
+        });
+    }
+
+    return false;
 }
 
 #endif
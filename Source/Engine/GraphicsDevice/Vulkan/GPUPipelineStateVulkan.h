@@ -10,6 +10,7 @@
 #if GRAPHICS_API_VULKAN
 
 class PipelineLayoutVulkan;
+class Task;
 
 class ComputePipelineStateVulkan
 {
@@ -105,6 +106,8 @@ class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
     VkPipelineColorBlendStateCreateInfo _descColorBlend;
     VkPipelineColorBlendAttachmentState _descColorBlendAttachments[GPU_MAX_RT_BINDED];
     PipelineLayoutVulkan* _layout;
+    Array<RenderTargetLayoutVulkan> _warmupLayouts;
+    Task* _warmupTask = nullptr;
 
 public:
     /// <summary>
@@ -181,7 +184,7 @@ class GPUPipelineStateVulkan : public GPUResourceVulkan<GPUPipelineState>
     PipelineLayoutVulkan* GetLayout();
 
     /// <summary>
-    /// Gets the Vulkan graphics pipeline object for the given rendering state. Uses depth buffer and render targets formats and multi-sample levels to setup a proper PSO. Uses caching.
+    /// Gets the Vulkan graphics pipeline object for the given rendering state. Uses depth buffer and render targets formats and multi-sample levels to setup a proper PSO. Uses caching. Can be called from any thread.
     /// </summary>
     /// <param name="renderPass">The render pass.</param>
     /// <returns>Vulkan graphics pipeline object.</returns>
@@ -14,6 +14,7 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Cache.h"
 #include "Engine/Core/Collections/CollectionPoolCache.h"
+#include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Debug/Exceptions/JsonParseException.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
@@ -637,6 +638,87 @@ void Actor::SetTransform(const Transform& value)
     }
 }
 
+void Actor::GetTransforms(const Span<Actor*>& actors, Array<Transform>& transforms)
+{
+    transforms.Resize(actors.Length(), false);
+    for (int32 i = 0; i < actors.Length(); i++)
+    {
+        const Actor* actor = actors[i];
+        transforms.Get()[i] = actor ? actor->_transform : Transform::Identity;
+    }
+}
+
+namespace
+{
+    Transform GetBatchedWorldTransform(const Actor* actor, const Dictionary<const Actor*, int32>& batch, const Span<Transform>& transforms)
+    {
+        int32 index;
+        if (batch.TryGet(actor, index))
+            return transforms[index];
+        const Actor* parent = actor->GetParent();
+        if (parent)
+            return GetBatchedWorldTransform(parent, batch, transforms).LocalToWorld(actor->GetLocalTransform());
+        return actor->GetLocalTransform();
+    }
+}
+
+void Actor::SetTransforms(const Span<Actor*>& actors, const Span<Transform>& transforms)
+{
+    CHECK(actors.Length() == transforms.Length());
+    PROFILE_CPU();
+    for (int32 i = 0; i < transforms.Length(); i++)
+    {
+        CHECK(!transforms[i].IsNanOrInfinity());
+    }
+
+    // Map actors to the batch index (the last one wins for duplicated actors)
+    Dictionary<const Actor*, int32> batch(actors.Length());
+    for (int32 i = 0; i < actors.Length(); i++)
+    {
+        if (actors[i])
+            batch[actors[i]] = i;
+    }
+
+    // Update local transformations (relative to the new parent transformations) without propagating changes yet
+    Array<Actor*> roots(actors.Length());
+    HashSet<const Actor*> dirtyRoots(actors.Length());
+    for (int32 i = 0; i < actors.Length(); i++)
+    {
+        Actor* actor = actors[i];
+        if (!actor || batch[actor] != i)
+            continue;
+        const Transform& value = transforms[i];
+        const Actor* root = nullptr;
+        for (const Actor* e = actor->_parent; e; e = e->_parent)
+        {
+            if (batch.ContainsKey(e))
+                root = e;
+        }
+        if (root)
+        {
+            // Parent transformation can be changed within this batch so get it first, changes will be propagated from the top-most batched parent
+            GetBatchedWorldTransform(actor->_parent, batch, transforms).WorldToLocal(value, actor->_localTransform);
+            dirtyRoots.Add(root);
+            continue;
+        }
+        roots.Add(actor);
+        if (Vector3::NearEqual(actor->_transform.Translation, value.Translation) && Quaternion::NearEqual(actor->_transform.Orientation, value.Orientation, ACTOR_ORIENTATION_EPSILON) && Float3::NearEqual(actor->_transform.Scale, value.Scale))
+            continue;
+        if (actor->_parent)
+            actor->_parent->_transform.WorldToLocal(value, actor->_localTransform);
+        else
+            actor->_localTransform = value;
+        dirtyRoots.Add(actor);
+    }
+
+    // Propagate changes from the top-most actors (updates their sub-trees, including the batched children)
+    for (Actor* actor : roots)
+    {
+        if (dirtyRoots.Contains(actor))
+            actor->OnTransformChanged();
+    }
+}
+
 void Actor::SetPosition(const Vector3& value)
 {
     CHECK(!value.IsNanOrInfinity());
@@ -468,7 +468,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets the actor's world transformation.
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoSerialize")
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoSerialize")
     FORCE_INLINE const Transform& GetTransform() const
     {
         return _transform;
@@ -480,10 +480,24 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <param name="value">The value to set.</param>
     API_PROPERTY() void SetTransform(const Transform& value);
 
+    /// <summary>
+    /// Gets the world transformations of the multiple actors at once.
+    /// </summary>
+    /// <param name="actors">The actors.</param>
+    /// <param name="transforms">The output world transformations (identity for null actors).</param>
+    API_FUNCTION() static void GetTransforms(const Span<Actor*>& actors, API_PARAM(Out) Array<Transform>& transforms);
+
+    /// <summary>
+    /// Sets the world transformations of the multiple actors at once. Transformation changes get propagated in the hierarchy once per batch (eg. child actors of the actors from the batch are updated once, even if parent and child are both in the batch).
+    /// </summary>
+    /// <param name="actors">The actors (null actors are skipped).</param>
+    /// <param name="transforms">The world transformations to set (the same length as actors).</param>
+    API_FUNCTION() static void SetTransforms(const Span<Actor*>& actors, const Span<Transform>& transforms);
+
     /// <summary>
     /// Gets the actor's world transform position.
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoSerialize")
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoSerialize")
     FORCE_INLINE Vector3 GetPosition() const
     {
         return _transform.Translation;
@@ -498,7 +512,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets actor orientation in 3D space
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoSerialize")
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoSerialize")
     FORCE_INLINE Quaternion GetOrientation() const
     {
         return _transform.Orientation;
@@ -513,7 +527,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets actor scale in 3D space.
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoSerialize")
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoSerialize")
     FORCE_INLINE Float3 GetScale() const
     {
         return _transform.Scale;
@@ -549,7 +563,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets actor direction vector (forward vector).
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoSerialize") FORCE_INLINE Float3 GetDirection() const
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoSerialize") FORCE_INLINE Float3 GetDirection() const
     {
         return Float3::Transform(Float3::Forward, GetOrientation());
     }
@@ -569,7 +583,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets local transform of the actor in parent actor space.
     /// </summary>
-    API_PROPERTY(Attributes="HideInEditor, NoAnimate")
+    API_PROPERTY(FastCall, Attributes="HideInEditor, NoAnimate")
     FORCE_INLINE Transform GetLocalTransform() const
     {
         return _localTransform;
@@ -584,7 +598,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets local position of the actor in parent actor space.
     /// </summary>
-    API_PROPERTY(Attributes="EditorDisplay(\"Transform\", \"Position\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Vector3), \"0,0,0\"), EditorOrder(-30), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+PositionEditor\")")
+    API_PROPERTY(FastCall, Attributes="EditorDisplay(\"Transform\", \"Position\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Vector3), \"0,0,0\"), EditorOrder(-30), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+PositionEditor\")")
     FORCE_INLINE Vector3 GetLocalPosition() const
     {
         return _localTransform.Translation;
@@ -600,7 +614,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// Gets local rotation of the actor in parent actor space.
     /// </summary>
     /// <code>Actor.LocalOrientation *= Quaternion.Euler(0, 10 * Time.DeltaTime, 0)</code>
-    API_PROPERTY(Attributes="EditorDisplay(\"Transform\", \"Rotation\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Quaternion), \"0,0,0,1\"), EditorOrder(-20), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+OrientationEditor\")")
+    API_PROPERTY(FastCall, Attributes="EditorDisplay(\"Transform\", \"Rotation\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Quaternion), \"0,0,0,1\"), EditorOrder(-20), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+OrientationEditor\")")
     FORCE_INLINE Quaternion GetLocalOrientation() const
     {
         return _localTransform.Orientation;
@@ -615,7 +629,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Actor : public SceneObject
     /// <summary>
     /// Gets local scale vector of the actor in parent actor space.
     /// </summary>
-    API_PROPERTY(Attributes="EditorDisplay(\"Transform\", \"Scale\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Float3), \"1,1,1\"), Limit(float.MinValue, float.MaxValue, 0.01f), EditorOrder(-10), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+ScaleEditor\")")
+    API_PROPERTY(FastCall, Attributes="EditorDisplay(\"Transform\", \"Scale\"), VisibleIf(\"ShowTransform\"), DefaultValue(typeof(Float3), \"1,1,1\"), Limit(float.MinValue, float.MaxValue, 0.01f), EditorOrder(-10), NoSerialize, CustomEditorAlias(\"FlaxEditor.CustomEditors.Editors.ActorTransformEditor+ScaleEditor\")")
     FORCE_INLINE Float3 GetLocalScale() const
     {
         return _localTransform.Scale;
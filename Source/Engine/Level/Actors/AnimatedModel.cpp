@@ -442,7 +442,7 @@ void AnimatedModel::SetBlendShapeWeight(const StringView& name, float value)
                             blendShapeMesh.LODIndex = mesh.GetLODIndex();
                             blendShapeMesh.MeshIndex = mesh.GetIndex();
                             blendShapeMesh.Usages = 1;
-                            _deformation->AddDeformer(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformer);
+                            _deformation->AddDeformer(blendShapeMesh.LODIndex, blendShapeMesh.MeshIndex, MeshBufferType::Vertex0, deformer, MeshDeformerFlags::Async);
                         }
                         break;
                     }
@@ -776,9 +776,18 @@ void AnimatedModel::OnAnimationUpdated_Async()
     // Update asynchronous stuff
     const auto& skeleton = SkinnedModel->Skeleton;
 
+    // Copy pose from the instance that shares it via pose cache
+    if (_poseCacheSource)
+    {
+        ANIM_GRAPH_PROFILE_EVENT("Copy Cached Pose");
+        const auto& sourceInstance = _poseCacheSource->GraphInstance;
+        GraphInstance.NodesPose = sourceInstance.NodesPose;
+        GraphInstance.RootTransform = sourceInstance.RootTransform;
+        GraphInstance.RootMotion = sourceInstance.RootMotion;
+    }
     // Copy pose from the master
     // TODO: support retargetting master pose to current pose
-    if (_masterPose && _masterPose->SkinnedModel->Skeleton.Nodes.Count() == skeleton.Nodes.Count())
+    else if (_masterPose && _masterPose->SkinnedModel->Skeleton.Nodes.Count() == skeleton.Nodes.Count())
     {
         ANIM_GRAPH_PROFILE_EVENT("Copy Master Pose");
         const auto& masterInstance = _masterPose->GraphInstance;
@@ -787,7 +796,8 @@ void AnimatedModel::OnAnimationUpdated_Async()
         GraphInstance.RootMotion = masterInstance.RootMotion;
     }
 
-    // Calculate the final bones transformations and update skinning
+    // Calculate the final bones transformations and update skinning (bones are shared when using pose cache)
+    if (!_poseCacheSource)
     {
         ANIM_GRAPH_PROFILE_EVENT("Final Pose");
         const int32 bonesCount = skeleton.Bones.Count();
@@ -805,12 +815,32 @@ void AnimatedModel::OnAnimationUpdated_Async()
     }
 
     UpdateBounds();
+
+    // Calculate sockets transformations (applied in the synchronous update)
+    _hasSockets = false;
+    for (int32 i = 0; i < Children.Count(); i++)
+    {
+        auto socket = dynamic_cast<BoneSocket*>(Children[i]);
+        if (socket)
+        {
+            socket->UpdatePose();
+            _hasSockets = true;
+        }
+    }
 }
 
 void AnimatedModel::OnAnimationUpdated_Sync()
 {
     // Update synchronous stuff
-    UpdateSockets();
+    if (_hasSockets)
+    {
+        for (int32 i = 0; i < Children.Count(); i++)
+        {
+            auto socket = dynamic_cast<BoneSocket*>(Children[i]);
+            if (socket)
+                socket->ApplyPose();
+        }
+    }
     ApplyRootMotion(GraphInstance.RootMotion);
     if (!_isDuringUpdateEvent)
     {
@@ -821,6 +851,24 @@ void AnimatedModel::OnAnimationUpdated_Sync()
     }
 }
 
+bool AnimatedModel::HasSyncUpdate() const
+{
+    // Skip synchronous update if there are no sockets, events, root motion nor listeners
+    const Transform& rootMotion = GraphInstance.RootMotion;
+    return _hasSockets ||
+            GraphInstance.HasAnimEvents() ||
+            AnimationUpdated.IsBinded() ||
+            !rootMotion.Translation.IsZero() ||
+            !rootMotion.Orientation.IsIdentity();
+}
+
+SkinnedMeshDrawData& AnimatedModel::GetSkinningData()
+{
+    if (_poseCacheSource && _poseCacheSource->SkinnedModel == SkinnedModel)
+        return _poseCacheSource->_skinningData;
+    return _skinningData;
+}
+
 void AnimatedModel::OnAnimationUpdated()
 {
     ANIM_GRAPH_PROFILE_EVENT("OnAnimationUpdated");
@@ -901,7 +949,13 @@ void AnimatedModel::Update()
         break;
     }
     if (updateAnim && (UpdateWhenOffscreen || _lastMinDstSqr < MAX_Real))
+    {
+        // Update the animation level of detail
+        GraphInstance.LOD = AnimationLODDistance > 0.0f && _lastMinDstSqr >= (Real)AnimationLODDistance * AnimationLODDistance ? 1 : 0;
+        GraphInstance.LODNodesMask = GraphInstance.LOD > 0 && AnimationLODMask && AnimationLODMask->IsLoaded() ? &AnimationLODMask->GetNodesMask() : nullptr;
+
         UpdateAnimation();
+    }
 
     _lastMinDstSqr = MAX_Real;
 }
@@ -920,19 +974,24 @@ void AnimatedModel::Draw(RenderContext& renderContext)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
-    if (_skinningData.IsReady())
+    SkinnedMeshDrawData& skinningData = GetSkinningData();
+    if (skinningData.IsReady())
     {
         // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.World = &world;
         draw.DrawState = &_drawState;
         draw.Deformation = _deformation;
@@ -963,19 +1022,24 @@ void AnimatedModel::Draw(RenderContextBatch& renderContextBatch)
     GEOMETRY_DRAW_STATE_EVENT_BEGIN(_drawState, world);
 
     _lastMinDstSqr = Math::Min(_lastMinDstSqr, Vector3::DistanceSquared(_transform.Translation, renderContext.View.WorldPosition));
-    if (_skinningData.IsReady())
+    SkinnedMeshDrawData& skinningData = GetSkinningData();
+    if (skinningData.IsReady())
     {
         // Flush skinning data with GPU
-        if (_skinningData.IsDirty())
+        if (skinningData.IsDirty())
         {
             RenderContext::GPULocker.Lock();
-            GPUDevice::Instance->GetMainContext()->UpdateBuffer(_skinningData.BoneMatrices, _skinningData.Data.Get(), _skinningData.Data.Count());
+            if (skinningData.IsDirty())
+            {
+                GPUDevice::Instance->GetMainContext()->UpdateBuffer(skinningData.BoneMatrices, skinningData.Data.Get(), skinningData.Data.Count());
+                skinningData.OnFlush();
+            }
             RenderContext::GPULocker.Unlock();
         }
 
         SkinnedMesh::DrawInfo draw;
         draw.Buffer = &Entries;
-        draw.Skinning = &_skinningData;
+        draw.Skinning = &skinningData;
         draw.World = &world;
         draw.DrawState = &_drawState;
         draw.Deformation = _deformation;
@@ -1095,6 +1159,10 @@ void AnimatedModel::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(UpdateWhenOffscreen);
     SERIALIZE(UpdateSpeed);
     SERIALIZE(UpdateMode);
+    SERIALIZE(AnimationLODDistance);
+    SERIALIZE(AnimationLODMask);
+    SERIALIZE(UsePoseCache);
+    SERIALIZE(PoseCacheTimeQuantum);
     SERIALIZE(BoundsScale);
     SERIALIZE(CustomBounds);
     SERIALIZE(LODBias);
@@ -1122,6 +1190,10 @@ void AnimatedModel::Deserialize(DeserializeStream& stream, ISerializeModifier* m
     DESERIALIZE(UpdateWhenOffscreen);
     DESERIALIZE(UpdateSpeed);
     DESERIALIZE(UpdateMode);
+    DESERIALIZE(AnimationLODDistance);
+    DESERIALIZE(AnimationLODMask);
+    DESERIALIZE(UsePoseCache);
+    DESERIALIZE(PoseCacheTimeQuantum);
     DESERIALIZE(BoundsScale);
     DESERIALIZE(CustomBounds);
     DESERIALIZE(LODBias);
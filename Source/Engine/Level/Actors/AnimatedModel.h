@@ -5,6 +5,7 @@
 #include "ModelInstanceActor.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
 #include "Engine/Content/Assets/AnimationGraph.h"
+#include "Engine/Content/Assets/SkeletonMask.h"
 #include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Core/Delegate.h"
@@ -68,9 +69,12 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     uint32 _counter;
     Real _lastMinDstSqr;
     bool _isDuringUpdateEvent = false;
+    bool _hasSockets = false;
     uint64 _lastUpdateFrame;
     mutable MeshDeformation* _deformation = nullptr;
     ScriptingObjectReference<AnimatedModel> _masterPose;
+    ScriptingObjectReference<AnimatedModel> _poseCacheSource;
+    float _poseCacheTime = 0.0f;
     Array<Pair<String, float>> _blendShapeWeights;
     Array<BlendShapeMesh> _blendShapeMeshes;
 
@@ -119,6 +123,30 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     API_FIELD(Attributes="EditorOrder(50), DefaultValue(AnimationUpdateMode.Auto), EditorDisplay(\"Skinned Model\")")
     AnimationUpdateMode UpdateMode = AnimationUpdateMode::Auto;
 
+    /// <summary>
+    /// The distance (from the closest view) at which the animation switches to the reduced level of detail that skips expensive graph nodes (eg. IK solvers, Multi Blend 2D blending) and samples only nodes from the Animation LOD Mask. Value 0 disables it.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(51), DefaultValue(0.0f), Limit(0), EditorDisplay(\"Skinned Model\", \"Animation LOD Distance\")")
+    float AnimationLODDistance = 0.0f;
+
+    /// <summary>
+    /// The skeleton mask with nodes to animate at the reduced animation level of detail. Other nodes use the reference pose. If not set, all nodes are animated.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(52), DefaultValue(null), EditorDisplay(\"Skinned Model\", \"Animation LOD Mask\")")
+    AssetReference<SkeletonMask> AnimationLODMask;
+
+    /// <summary>
+    /// If checked, the animation pose is shared between the instances that use the same skinned model, animation graph and parameters and that play in sync (within Pose Cache Time Quantum). Only one of them evaluates the graph and the bones, others reuse its pose and bones buffer (anim events are invoked only by the evaluated instance). Use it for dense crowds of background characters.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(53), DefaultValue(false), EditorDisplay(\"Skinned Model\", \"Use Pose Cache\")")
+    bool UsePoseCache = false;
+
+    /// <summary>
+    /// The time quantum (in seconds) used to match the playback of the instances that use the pose cache. Higher values share the pose between more instances at cost of the animation accuracy.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(54), DefaultValue(0.1f), Limit(0.001f), EditorDisplay(\"Skinned Model\", \"Pose Cache Time Quantum\"), VisibleIf(nameof(UsePoseCache))")
+    float PoseCacheTimeQuantum = 0.1f;
+
     /// <summary>
     /// The master scale parameter for the actor bounding box. Helps reducing mesh flickering effect on screen edges.
     /// </summary>
@@ -408,6 +436,8 @@ class FLAXENGINE_API AnimatedModel : public ModelInstanceActor
     void UpdateSockets();
     void OnAnimationUpdated_Async();
     void OnAnimationUpdated_Sync();
+    bool HasSyncUpdate() const;
+    SkinnedMeshDrawData& GetSkinningData();
     void OnAnimationUpdated();
 
     void OnSkinnedModelChanged();
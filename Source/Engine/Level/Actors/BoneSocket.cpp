@@ -9,6 +9,7 @@ BoneSocket::BoneSocket(const SpawnParams& params)
     : Actor(params)
     , _index(-1)
     , _useScale(false)
+    , _hasPose(false)
 {
 }
 
@@ -33,6 +34,13 @@ void BoneSocket::SetUseScale(bool value)
 
 void BoneSocket::UpdateTransformation()
 {
+    UpdatePose();
+    ApplyPose();
+}
+
+void BoneSocket::UpdatePose()
+{
+    _hasPose = false;
     const auto parent = dynamic_cast<AnimatedModel*>(GetParent());
     if (parent && parent->SkinnedModel)
     {
@@ -45,14 +53,22 @@ void BoneSocket::UpdateTransformation()
         }
 
         auto& nodes = parent->GraphInstance.NodesPose;
-        Transform t;
         if (nodes.IsValidIndex(_index))
-            nodes.Get()[_index].Decompose(t);
+            nodes.Get()[_index].Decompose(_pose);
         else
-            t = parent->SkinnedModel->Skeleton.GetNodeTransform(_index);
+            _pose = parent->SkinnedModel->Skeleton.GetNodeTransform(_index);
         if (!_useScale)
-            t.Scale = _localTransform.Scale;
-        SetLocalTransform(t);
+            _pose.Scale = _localTransform.Scale;
+        _hasPose = true;
+    }
+}
+
+void BoneSocket::ApplyPose()
+{
+    if (_hasPose)
+    {
+        _hasPose = false;
+        SetLocalTransform(_pose);
     }
 }
 
@@ -15,6 +15,8 @@ class FLAXENGINE_API BoneSocket : public Actor
     String _node;
     int32 _index;
     bool _useScale;
+    bool _hasPose;
+    Transform _pose;
 
 public:
     /// <summary>
@@ -54,6 +56,16 @@ class FLAXENGINE_API BoneSocket : public Actor
     API_FUNCTION()
     void UpdateTransformation();
 
+    /// <summary>
+    /// Calculates the actor transformation based on a skeleton node without applying it (see ApplyPose). Can be called from the async animation update.
+    /// </summary>
+    void UpdatePose();
+
+    /// <summary>
+    /// Applies the actor transformation calculated by UpdatePose. Must be called from the main thread.
+    /// </summary>
+    void ApplyPose();
+
 public:
     // [Actor]
 #if USE_EDITOR
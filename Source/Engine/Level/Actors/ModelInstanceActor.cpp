@@ -19,8 +19,8 @@ void ModelInstanceActor::SetEntries(const Array<ModelInstanceEntry>& value)
         anyChanged |= Entries[i] != value[i];
         Entries[i] = value[i];
     }
-    if (anyChanged && _sceneRenderingKey != -1)
-        GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
+    if (anyChanged)
+        OnEntriesChanged();
 }
 
 void ModelInstanceActor::SetMaterial(int32 entryIndex, MaterialBase* material)
@@ -32,8 +32,7 @@ void ModelInstanceActor::SetMaterial(int32 entryIndex, MaterialBase* material)
     if (Entries[entryIndex].Material == material)
         return;
     Entries[entryIndex].Material = material;
-    if (_sceneRenderingKey != -1)
-        GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
+    OnEntriesChanged();
 }
 
 MaterialInstance* ModelInstanceActor::CreateAndSetVirtualMaterialInstance(int32 entryIndex)
@@ -43,8 +42,7 @@ MaterialInstance* ModelInstanceActor::CreateAndSetVirtualMaterialInstance(int32
     CHECK_RETURN(material && !material->WaitForLoaded(), nullptr);
     MaterialInstance* result = material->CreateVirtualInstance();
     Entries[entryIndex].Material = result;
-    if (_sceneRenderingKey != -1)
-        GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
+    OnEntriesChanged();
     return result;
 }
 
@@ -52,6 +50,12 @@ void ModelInstanceActor::WaitForModelLoad()
 {
 }
 
+void ModelInstanceActor::OnEntriesChanged()
+{
+    if (_sceneRenderingKey != -1)
+        GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
+}
+
 void ModelInstanceActor::OnLayerChanged()
 {
     if (_sceneRenderingKey != -1)
@@ -138,6 +138,7 @@ API_CLASS(Abstract) class FLAXENGINE_API ModelInstanceActor : public Actor
 
 protected:
     virtual void WaitForModelLoad();
+    virtual void OnEntriesChanged();
 
 public:
     // [Actor]
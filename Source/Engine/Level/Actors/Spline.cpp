@@ -6,6 +6,35 @@
 #include "Engine/Core/Math/Matrix.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 
+// The amount of samples per spline segment used to approximate its length
+#define SPLINE_ARC_LENGTH_SAMPLES 19
+
+namespace
+{
+    float GetSegmentLength(const BezierCurveKeyframe<Transform>& a, const BezierCurveKeyframe<Transform>& b, const Vector3& scale, float* samples = nullptr)
+    {
+        float sum = 0.0f;
+        constexpr float step = 1.0f / (float)SPLINE_ARC_LENGTH_SAMPLES;
+        Vector3 prevPoint = a.Value.Translation * scale;
+        const float length = Math::Abs(b.Time - a.Time);
+        Vector3 leftTangent, rightTangent;
+        AnimationUtils::GetTangent(a.Value.Translation, a.TangentOut.Translation, length, leftTangent);
+        AnimationUtils::GetTangent(b.Value.Translation, b.TangentIn.Translation, length, rightTangent);
+        for (int32 slice = 1; slice <= SPLINE_ARC_LENGTH_SAMPLES; slice++)
+        {
+            const float t = (float)slice * step;
+            Vector3 pos;
+            AnimationUtils::Bezier(a.Value.Translation, leftTangent, rightTangent, b.Value.Translation, t, pos);
+            pos *= scale;
+            sum += (float)Vector3::Distance(pos, prevPoint);
+            prevPoint = pos;
+            if (samples)
+                samples[slice - 1] = sum;
+        }
+        return sum;
+    }
+}
+
 Spline::Spline(const SpawnParams& params)
     : Actor(params)
     , _localBounds(Vector3::Zero, Vector3::Zero)
@@ -148,31 +177,14 @@ float Spline::GetSplineDuration() const
 
 float Spline::GetSplineLength() const
 {
+    const int32 count = Curve.GetKeyframes().Count();
+    if (count < 2)
+        return 0.0f;
+    if (_arcLengths.Count() == (count - 1) * SPLINE_ARC_LENGTH_SAMPLES + 1 && _arcLengthsScale == _transform.Scale)
+        return _arcLengths.Last();
     float sum = 0.0f;
-    constexpr int32 slices = 20;
-    constexpr float step = 1.0f / (float)(slices - 1);
-    const Vector3 scale = _transform.Scale;
-    for (int32 i = 1; i < Curve.GetKeyframes().Count(); i++)
-    {
-        const auto& a = Curve[i - 1];
-        const auto& b = Curve[i];
-        Vector3 prevPoint = a.Value.Translation * scale;
-
-        const float length = Math::Abs(b.Time - a.Time);
-        Vector3 leftTangent, rightTangent;
-        AnimationUtils::GetTangent(a.Value.Translation, a.TangentOut.Translation, length, leftTangent);
-        AnimationUtils::GetTangent(b.Value.Translation, b.TangentIn.Translation, length, rightTangent);
-
-        for (int32 slice = 1; slice < slices; slice++)
-        {
-            const float t = (float)slice * step;
-            Vector3 pos;
-            AnimationUtils::Bezier(a.Value.Translation, leftTangent, rightTangent, b.Value.Translation, t, pos);
-            pos *= scale;
-            sum += (float)Vector3::Distance(pos, prevPoint);
-            prevPoint = pos;
-        }
-    }
+    for (int32 i = 1; i < count; i++)
+        sum += GetSegmentLength(Curve[i - 1], Curve[i], _transform.Scale);
     return sum;
 }
 
@@ -181,30 +193,43 @@ float Spline::GetSplineSegmentLength(int32 index) const
     if (index == 0)
         return 0.0f;
     CHECK_RETURN(index > 0 && index < GetSplinePointsCount(), 0.0f);
-    float sum = 0.0f;
-    constexpr int32 slices = 20;
-    constexpr float step = 1.0f / (float)(slices - 1);
-    const auto& a = Curve[index - 1];
-    const auto& b = Curve[index];
-    const Vector3 scale = _transform.Scale;
-    Vector3 prevPoint = a.Value.Translation * scale;
-    {
-        const float length = Math::Abs(b.Time - a.Time);
-        Vector3 leftTangent, rightTangent;
-        AnimationUtils::GetTangent(a.Value.Translation, a.TangentOut.Translation, length, leftTangent);
-        AnimationUtils::GetTangent(b.Value.Translation, b.TangentIn.Translation, length, rightTangent);
+    if (_arcLengths.Count() == (GetSplinePointsCount() - 1) * SPLINE_ARC_LENGTH_SAMPLES + 1 && _arcLengthsScale == _transform.Scale)
+        return _arcLengths[index * SPLINE_ARC_LENGTH_SAMPLES] - _arcLengths[(index - 1) * SPLINE_ARC_LENGTH_SAMPLES];
+    return GetSegmentLength(Curve[index - 1], Curve[index], _transform.Scale);
+}
 
-        for (int32 slice = 1; slice < slices; slice++)
-        {
-            const float t = (float)slice * step;
-            Vector3 pos;
-            AnimationUtils::Bezier(a.Value.Translation, leftTangent, rightTangent, b.Value.Translation, t, pos);
-            pos *= scale;
-            sum += (float)Vector3::Distance(pos, prevPoint);
-            prevPoint = pos;
-        }
+float Spline::GetSplineTimeAtDistance(float distance) const
+{
+    const int32 count = Curve.GetKeyframes().Count();
+    if (count < 2)
+        return count != 0 ? Curve[0].Time : 0.0f;
+    if (_arcLengths.Count() != (count - 1) * SPLINE_ARC_LENGTH_SAMPLES + 1 || _arcLengthsScale != _transform.Scale)
+        const_cast<Spline*>(this)->UpdateArcLengths();
+    if (distance <= 0.0f)
+        return Curve[0].Time;
+    if (distance >= _arcLengths.Last())
+        return Curve[count - 1].Time;
+
+    // Find the first sample after the distance
+    int32 low = 1, high = _arcLengths.Count() - 1;
+    while (low < high)
+    {
+        const int32 mid = (low + high) / 2;
+        if (_arcLengths[mid] < distance)
+            low = mid + 1;
+        else
+            high = mid;
     }
-    return sum;
+
+    // Interpolate time between samples (curve is evaluated linearly in time within a segment)
+    const int32 segment = (low - 1) / SPLINE_ARC_LENGTH_SAMPLES;
+    const int32 sample = (low - 1) % SPLINE_ARC_LENGTH_SAMPLES;
+    const float prevDistance = _arcLengths[low - 1];
+    const float sampleLength = _arcLengths[low] - prevDistance;
+    const float alpha = ((float)sample + (sampleLength > ZeroTolerance ? (distance - prevDistance) / sampleLength : 0.0f)) / (float)SPLINE_ARC_LENGTH_SAMPLES;
+    const auto& a = Curve[segment];
+    const auto& b = Curve[segment + 1];
+    return Math::Lerp(a.Time, b.Time, alpha);
 }
 
 float Spline::GetSplineTime(int32 index) const
@@ -465,9 +490,33 @@ void Spline::UpdateSpline()
     GetLocalToWorldMatrix(world);
     BoundingBox::Transform(_localBounds, world, _box);
 
+    UpdateArcLengths();
+
     SplineUpdated();
 }
 
+void Spline::UpdateArcLengths()
+{
+    // Cache the distance along the spline at the uniformly sampled points of each segment
+    const int32 count = Curve.GetKeyframes().Count();
+    _arcLengthsScale = _transform.Scale;
+    if (count < 2)
+    {
+        _arcLengths.Clear();
+        return;
+    }
+    _arcLengths.Resize((count - 1) * SPLINE_ARC_LENGTH_SAMPLES + 1);
+    _arcLengths[0] = 0.0f;
+    for (int32 i = 1; i < count; i++)
+    {
+        float* samples = _arcLengths.Get() + (i - 1) * SPLINE_ARC_LENGTH_SAMPLES + 1;
+        const float start = samples[-1];
+        GetSegmentLength(Curve[i - 1], Curve[i], _arcLengthsScale, samples);
+        for (int32 j = 0; j < SPLINE_ARC_LENGTH_SAMPLES; j++)
+            samples[j] += start;
+    }
+}
+
 #if !COMPILE_WITHOUT_CSHARP
 
 void Spline::GetKeyframes(MArray* data)
@@ -540,6 +589,10 @@ void Spline::OnTransformChanged()
     GetLocalToWorldMatrix(world);
     BoundingBox::Transform(_localBounds, world, _box);
     BoundingSphere::FromBox(_box, _sphere);
+
+    // Distances are affected by the actor scale
+    if (_arcLengthsScale != _transform.Scale)
+        UpdateArcLengths();
 }
 
 void Spline::Initialize()
@@ -557,6 +610,7 @@ void Spline::Initialize()
     Matrix world;
     GetLocalToWorldMatrix(world);
     BoundingBox::Transform(_localBounds, world, _box);
+    UpdateArcLengths();
 }
 
 void Spline::Serialize(SerializeStream& stream, const void* otherObj)
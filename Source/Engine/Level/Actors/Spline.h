@@ -16,6 +16,8 @@ class FLAXENGINE_API Spline : public Actor
 private:
     bool _loop = false;
     BoundingBox _localBounds;
+    Vector3 _arcLengthsScale = Vector3::One;
+    Array<float> _arcLengths;
 
 public:
     /// <summary>
@@ -188,6 +190,13 @@ class FLAXENGINE_API Spline : public Actor
     /// <returns>The spline time.</returns>
     API_FUNCTION() float GetSplineTimeClosestToPoint(const Vector3& point) const;
 
+    /// <summary>
+    /// Gets the spline time at the given distance along the spline (from the start). Uses the cached arc-length table.
+    /// </summary>
+    /// <param name="distance">The distance along the spline (in world-space units). Clamped to range 0-GetSplineLength().</param>
+    /// <returns>The spline time.</returns>
+    API_FUNCTION() float GetSplineTimeAtDistance(float distance) const;
+
     /// <summary>
     /// Calculates the closest point to the given location.
     /// </summary>
@@ -369,6 +378,8 @@ class FLAXENGINE_API Spline : public Actor
 #endif
 
 private:
+    void UpdateArcLengths();
+
     // Internal bindings
 #if !COMPILE_WITHOUT_CSHARP
     API_FUNCTION(NoProxy) void GetKeyframes(MArray* data);
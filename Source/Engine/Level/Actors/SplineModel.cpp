@@ -16,12 +16,16 @@
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Threading/JobSystem.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 
 #define SPLINE_RESOLUTION 32.0f
 
+// The amount of spline segments processed by a single job when updating the spline model
+#define SPLINE_SEGMENTS_PER_JOB 16
+
 SplineModel::SplineModel(const SpawnParams& params)
     : ModelInstanceActor(params)
 {
@@ -176,33 +180,38 @@ void SplineModel::OnSplineUpdated()
     }
     _meshMinZ = (float)localModelBounds.Minimum.Z;
     _meshMaxZ = (float)localModelBounds.Maximum.Z;
-    Transform chunkLocal, chunkWorld, leftTangent, rightTangent;
-    Array<Vector3> segmentPoints;
-    segmentPoints.Resize(chunksPerSegment);
-    for (int32 segment = 0; segment < segments; segment++)
+    const int32 jobsCount = Math::DivideAndRoundUp(segments, SPLINE_SEGMENTS_PER_JOB);
+    JobSystem::Execute([&](int32 job)
     {
-        auto& instance = _instances[segment];
-        const auto& start = keyframes[segment];
-        const auto& end = keyframes[segment + 1];
-        const float length = end.Time - start.Time;
-        AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
-        AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
-
-        // Find maximum scale over the segment spline and collect the segment positions for bounds
-        segmentPoints.Clear();
-        segmentPoints.Add(end.Value.Translation);
-        float maxScale = end.Value.Scale.GetAbsolute().MaxValue();
-        for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+        Transform chunkLocal, chunkWorld, leftTangent, rightTangent;
+        Array<Vector3> segmentPoints;
+        segmentPoints.EnsureCapacity(chunksPerSegment + 1);
+        const int32 segmentsEnd = Math::Min(job * SPLINE_SEGMENTS_PER_JOB + SPLINE_SEGMENTS_PER_JOB, segments);
+        for (int32 segment = job * SPLINE_SEGMENTS_PER_JOB; segment < segmentsEnd; segment++)
         {
-            const float alpha = (float)chunk * chunksPerSegmentInv;
-            AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, chunkLocal);
-            splineTransform.LocalToWorld(chunkLocal, chunkWorld);
-            segmentPoints.Add(chunkWorld.Translation);
-            maxScale = Math::Max(maxScale, chunkWorld.Scale.GetAbsolute().MaxValue());
+            auto& instance = _instances[segment];
+            const auto& start = keyframes[segment];
+            const auto& end = keyframes[segment + 1];
+            const float length = end.Time - start.Time;
+            AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
+            AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
+
+            // Find maximum scale over the segment spline and collect the segment positions for bounds
+            segmentPoints.Clear();
+            segmentPoints.Add(end.Value.Translation);
+            float maxScale = end.Value.Scale.GetAbsolute().MaxValue();
+            for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+            {
+                const float alpha = (float)chunk * chunksPerSegmentInv;
+                AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, chunkLocal);
+                splineTransform.LocalToWorld(chunkLocal, chunkWorld);
+                segmentPoints.Add(chunkWorld.Translation);
+                maxScale = Math::Max(maxScale, chunkWorld.Scale.GetAbsolute().MaxValue());
+            }
+            BoundingSphere::FromPoints(segmentPoints.Get(), segmentPoints.Count(), instance.Sphere);
+            instance.Sphere.Radius *= maxScale * _boundsScale;
         }
-        BoundingSphere::FromPoints(segmentPoints.Get(), segmentPoints.Count(), instance.Sphere);
-        instance.Sphere.Radius *= maxScale * _boundsScale;
-    }
+    }, jobsCount);
 
     // Update deformation buffer during next drawing
     _deformationDirty = true;
@@ -246,49 +255,57 @@ void SplineModel::UpdateDeformationBuffer()
         _deformationBufferData = Allocator::Allocate(size);
     _chunksPerSegment = (float)chunksPerSegment;
 
-    // Update pre-calculated matrices for spline chunks
-    auto ptr = (Matrix3x4*)_deformationBufferData;
+    // Update pre-calculated matrices for spline chunks (segments are written to separate ranges of the buffer so they can be processed in parallel)
     const float chunksPerSegmentInv = 1.0f / (float)chunksPerSegment;
-    Matrix m;
-    Transform transform, leftTangent, rightTangent;
-    for (int32 segment = 0; segment < segments; segment++)
+    const int32 jobsCount = Math::DivideAndRoundUp(segments, SPLINE_SEGMENTS_PER_JOB);
+    JobSystem::Execute([&](int32 job)
     {
-        auto& instance = _instances[segment];
-        const auto& start = keyframes[segment];
-        const auto& end = keyframes[segment + 1];
-        const float length = end.Time - start.Time;
-        AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
-        AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
-        for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+        Matrix m;
+        Transform transform, leftTangent, rightTangent;
+        const int32 segmentsEnd = Math::Min(job * SPLINE_SEGMENTS_PER_JOB + SPLINE_SEGMENTS_PER_JOB, segments);
+        for (int32 segment = job * SPLINE_SEGMENTS_PER_JOB; segment < segmentsEnd; segment++)
         {
-            const float alpha = (chunk == chunksPerSegment - 1) ? 1.0f : ((float)chunk * chunksPerSegmentInv);
-
-            // Evaluate transformation at the curve
-            AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, transform);
-
-            // Apply spline direction (from position 1st derivative)
-            Vector3 direction;
-            AnimationUtils::BezierFirstDerivative(start.Value.Translation, leftTangent.Translation, rightTangent.Translation, end.Value.Translation, alpha, direction);
-            direction.Normalize();
-            Quaternion orientation;
-            if (direction.IsZero())
-                orientation = Quaternion::Identity;
-            else if (Vector3::Dot(direction, Vector3::Up) >= 0.999f)
-                Quaternion::RotationAxis(Vector3::Left, PI_HALF, orientation);
-            else
-                Quaternion::LookRotation(direction, Vector3::Cross(Vector3::Cross(direction, Vector3::Up), direction), orientation);
-            transform.Orientation = orientation * transform.Orientation;
-
-            // Write transform into deformation buffer
-            transform.GetWorld(m);
-            ptr->SetMatrixTranspose(m);
-            ptr++;
+            auto ptr = (Matrix3x4*)_deformationBufferData + segment * chunksPerSegment;
+            auto& instance = _instances[segment];
+            const auto& start = keyframes[segment];
+            const auto& end = keyframes[segment + 1];
+            const float length = end.Time - start.Time;
+            AnimationUtils::GetTangent(start.Value, start.TangentOut, length, leftTangent);
+            AnimationUtils::GetTangent(end.Value, end.TangentIn, length, rightTangent);
+            for (int32 chunk = 0; chunk < chunksPerSegment; chunk++)
+            {
+                const float alpha = (chunk == chunksPerSegment - 1) ? 1.0f : ((float)chunk * chunksPerSegmentInv);
+
+                // Evaluate transformation at the curve
+                AnimationUtils::Bezier(start.Value, leftTangent, rightTangent, end.Value, alpha, transform);
+
+                // Apply spline direction (from position 1st derivative)
+                Vector3 direction;
+                AnimationUtils::BezierFirstDerivative(start.Value.Translation, leftTangent.Translation, rightTangent.Translation, end.Value.Translation, alpha, direction);
+                direction.Normalize();
+                Quaternion orientation;
+                if (direction.IsZero())
+                    orientation = Quaternion::Identity;
+                else if (Vector3::Dot(direction, Vector3::Up) >= 0.999f)
+                    Quaternion::RotationAxis(Vector3::Left, PI_HALF, orientation);
+                else
+                    Quaternion::LookRotation(direction, Vector3::Cross(Vector3::Cross(direction, Vector3::Up), direction), orientation);
+                transform.Orientation = orientation * transform.Orientation;
+
+                // Write transform into deformation buffer
+                transform.GetWorld(m);
+                ptr->SetMatrixTranspose(m);
+                ptr++;
+            }
+            instance.RotDeterminant = m.RotDeterminant();
         }
-        instance.RotDeterminant = m.RotDeterminant();
-    }
+    }, jobsCount);
 
     // Add last transformation to prevent issues when sampling spline deformation buffer with alpha=1
     {
+        Matrix m;
+        Transform transform, leftTangent, rightTangent;
+        auto ptr = (Matrix3x4*)_deformationBufferData + segments * chunksPerSegment;
         const auto& start = keyframes[segments - 1];
         const auto& end = keyframes[segments];
         const float length = end.Time - start.Time;
@@ -12,6 +12,7 @@
 #include "Engine/Level/Prefabs/PrefabManager.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/GPUDrivenRenderingPass.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
 #include "Engine/Utilities/Encryption.h"
 #if USE_EDITOR
@@ -229,6 +230,7 @@ void StaticModel::OnModelChanged()
         _residencyChangedModel = nullptr;
         Model->ResidencyChanged.Unbind<StaticModel, &StaticModel::OnModelResidencyChanged>(this);
     }
+    GPUDrivenRenderingPass::Instance()->Unregister(this);
     RemoveVertexColors();
     Entries.Release();
     if (Model && !Model->IsLoaded())
@@ -282,10 +284,32 @@ void StaticModel::UpdateBounds()
         _box = BoundingBox(_transform.Translation);
     }
     BoundingSphere::FromBox(_box, _sphere);
+    GPUDrivenRenderingPass::Instance()->Unregister(this);
     if (_sceneRenderingKey != -1)
         GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
 }
 
+bool StaticModel::CanUseGPUDrivenRendering() const
+{
+    // Only static objects that can be instanced (no per-instance buffers nor lightmap)
+    return HasStaticFlag(StaticFlags::Transform) &&
+            _vertexColorsCount == 0 &&
+            _deformation == nullptr &&
+            !(HasStaticFlag(StaticFlags::Lightmap) && HasLightmap()) &&
+            Model && Model->IsLoaded();
+}
+
+bool StaticModel::CanUseAutoInstancing() const
+{
+    // Only static objects without per-instance buffers and custom sorting (lightmap is passed per-instance), mirrored objects need a different culling mode so skip them too
+    return HasStaticFlag(StaticFlags::Transform) &&
+            _transform.Scale.X * _transform.Scale.Y * _transform.Scale.Z > 0 &&
+            _vertexColorsCount == 0 &&
+            _deformation == nullptr &&
+            _sortOrder == 0 &&
+            Model && Model->IsLoaded();
+}
+
 void StaticModel::FlushVertexColors()
 {
     RenderContext::GPULocker.Lock();
@@ -371,6 +395,14 @@ void StaticModel::Draw(RenderContextBatch& renderContextBatch)
 {
     if (!Model || !Model->IsLoaded())
         return;
+    if (renderContextBatch.EnableGPUDriven && CanUseGPUDrivenRendering())
+    {
+        // Skip drawing on CPU if model is culled and drawn on GPU, otherwise start using it from the next frame
+        GPUDrivenRenderingPass* gpuDriven = GPUDrivenRenderingPass::Instance();
+        if (gpuDriven->IsDrawn(this))
+            return;
+        gpuDriven->Register(this);
+    }
     const RenderContext& renderContext = renderContextBatch.GetMainContext();
     Matrix world;
     GetLocalToWorldMatrix(world);
@@ -672,6 +704,7 @@ void StaticModel::OnDisable()
     // Skip ModelInstanceActor (add to SceneRendering manually)
     Actor::OnDisable();
 
+    GPUDrivenRenderingPass::Instance()->Unregister(this);
     if (_sceneRenderingKey != -1)
     {
         GetSceneRendering()->RemoveActor(this, _sceneRenderingKey);
@@ -688,3 +721,11 @@ void StaticModel::WaitForModelLoad()
     if (Model)
         Model->WaitForLoaded();
 }
+
+void StaticModel::OnEntriesChanged()
+{
+    GPUDrivenRenderingPass::Instance()->Unregister(this);
+
+    // Base
+    ModelInstanceActor::OnEntriesChanged();
+}
@@ -14,6 +14,8 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Model\"), ActorToolbox(\"Visuals\")
 class FLAXENGINE_API StaticModel : public ModelInstanceActor
 {
     DECLARE_SCENE_OBJECT(StaticModel);
+    friend class GPUDrivenRenderingPass;
+    friend class SceneRenderingInstancing;
 private:
     GeometryDrawStateData _drawState;
     float _scaleInLightmap;
@@ -27,6 +29,8 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     GPUBuffer* _vertexColorsBuffer[MODEL_MAX_LODS];
     Model* _residencyChangedModel = nullptr;
     mutable MeshDeformation* _deformation = nullptr;
+    int32 _gpuDrivenKey = -1;
+    bool _gpuDrivenQueued = false;
 
 public:
     /// <summary>
@@ -158,6 +162,8 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     void OnModelLoaded();
     void OnModelResidencyChanged();
     void FlushVertexColors();
+    bool CanUseGPUDrivenRendering() const;
+    bool CanUseAutoInstancing() const;
 
 public:
     // [ModelInstanceActor]
@@ -180,4 +186,5 @@ class FLAXENGINE_API StaticModel : public ModelInstanceActor
     void OnEnable() override;
     void OnDisable() override;
     void WaitForModelLoad() override;
+    void OnEntriesChanged() override;
 };
@@ -0,0 +1,150 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ActorsPool.h"
+#include "Actor.h"
+#include "Level.h"
+#include "Prefabs/Prefab.h"
+#include "Prefabs/PrefabManager.h"
+#include "Scene/Scene.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Scripting/Scripting.h"
+#include "Engine/Scripting/ScriptingObjectReference.h"
+
+namespace
+{
+    // Released prefab instances (per prefab asset ID), references get cleared if the pooled actor gets deleted
+    Dictionary<Guid, Array<ScriptingObjectReference<Actor>>> Pools;
+
+    void OnSceneUnloading(Scene* scene, const Guid& sceneId)
+    {
+        // Pooled actors get deleted with their scene so remove them from the pools
+        for (auto it = Pools.Begin(); it.IsNotEnd(); ++it)
+        {
+            auto& pool = it->Value;
+            for (int32 i = pool.Count() - 1; i >= 0; i--)
+            {
+                const Actor* actor = pool[i].Get();
+                if (!actor || actor->GetScene() == scene)
+                    pool.RemoveAtKeepOrder(i);
+            }
+            if (pool.IsEmpty())
+                Pools.Remove(it);
+        }
+    }
+
+    void OnScriptsReloading()
+    {
+        // Pooled instances use the old scripting types so they cannot be reused after the reload
+        ActorsPool::Clear();
+    }
+}
+
+class ActorsPoolService : public EngineService
+{
+public:
+    ActorsPoolService()
+        : EngineService(TEXT("Actors Pool"))
+    {
+    }
+
+    bool Init() override
+    {
+        Level::SceneUnloading.Bind(OnSceneUnloading);
+        Scripting::ScriptsReloading.Bind(OnScriptsReloading);
+        return false;
+    }
+
+    void Dispose() override
+    {
+        Level::SceneUnloading.Unbind(OnSceneUnloading);
+        Scripting::ScriptsReloading.Unbind(OnScriptsReloading);
+        Pools.Clear();
+    }
+};
+
+ActorsPoolService ActorsPoolServiceInstance;
+
+Actor* ActorsPool::Spawn(Prefab* prefab, Actor* parent, const Transform& transform)
+{
+    if (prefab == nullptr)
+        return nullptr;
+    PROFILE_CPU();
+
+    // Reuse the released instance
+    auto* pool = Pools.TryGet(prefab->GetID());
+    while (pool && pool->HasItems())
+    {
+        Actor* actor = pool->Pop().Get();
+        if (!actor)
+            continue;
+        if (parent && actor->GetParent() != parent)
+            actor->SetParent(parent, false, false);
+        actor->SetTransform(transform);
+        actor->SetIsActive(true);
+        return actor;
+    }
+
+    // Spawn a new instance
+    if (!parent)
+        parent = Level::Scenes.HasItems() ? (Actor*)Level::Scenes[0] : nullptr;
+    return PrefabManager::SpawnPrefab(prefab, parent, transform);
+}
+
+void ActorsPool::Release(Actor* actor)
+{
+    if (actor == nullptr)
+        return;
+    if (!actor->IsPrefabRoot())
+    {
+        actor->DeleteObject();
+        return;
+    }
+    actor->SetIsActive(false);
+    Pools[actor->GetPrefabID()].Add(actor);
+}
+
+void ActorsPool::Prewarm(Prefab* prefab, Actor* parent, int32 count)
+{
+    if (prefab == nullptr)
+        return;
+    PROFILE_CPU();
+    if (!parent)
+        parent = Level::Scenes.HasItems() ? (Actor*)Level::Scenes[0] : nullptr;
+    for (int32 i = GetPooledCount(prefab); i < count; i++)
+    {
+        Actor* actor = PrefabManager::SpawnPrefab(prefab, parent, Transform::Identity);
+        if (!actor)
+            break;
+        Release(actor);
+    }
+}
+
+int32 ActorsPool::GetPooledCount(Prefab* prefab)
+{
+    int32 result = 0;
+    const auto* pool = prefab ? Pools.TryGet(prefab->GetID()) : nullptr;
+    if (pool)
+    {
+        for (const auto& e : *pool)
+        {
+            if (e.Get())
+                result++;
+        }
+    }
+    return result;
+}
+
+void ActorsPool::Clear()
+{
+    for (auto& e : Pools)
+    {
+        for (const auto& actor : e.Value)
+        {
+            if (actor.Get())
+                actor->DeleteObject();
+        }
+    }
+    Pools.Clear();
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+class Actor;
+class Prefab;
+
+/// <summary>
+/// The actors pooling utility for spawn-heavy gameplay (eg. bullets or pickups). Released prefab instances are deactivated and kept in the scene to be reused by the next spawn of the same prefab which skips the full re-initialization (prefab deserialization, objects registration, managed objects creation and BeginPlay).
+/// </summary>
+/// <remarks>
+/// Reused actors keep their state (properties modified during gameplay are not reset), use OnEnable/OnDisable events of the scripts to reset the gameplay state. Must be used from the main thread only.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ActorsPool
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ActorsPool);
+
+    /// <summary>
+    /// Spawns the instance of the prefab. Reuses the released instance of the same prefab if available, otherwise spawns a new one.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="parent">The parent actor to add spawned object instance. Can be null to use the first loaded scene.</param>
+    /// <param name="transform">The spawn transformation in the world space.</param>
+    /// <returns>The spawned actor (prefab root) or null if failed.</returns>
+    API_FUNCTION() static Actor* Spawn(Prefab* prefab, Actor* parent, const Transform& transform);
+
+    /// <summary>
+    /// Releases the prefab instance back to the pool. Actor gets deactivated and can be reused by the next Spawn of the same prefab. Actors that are not prefab instance roots are destroyed.
+    /// </summary>
+    /// <param name="actor">The actor to release (prefab instance root).</param>
+    API_FUNCTION() static void Release(Actor* actor);
+
+    /// <summary>
+    /// Spawns the inactive instances of the prefab up-front (eg. on level load) to prevent hitches during gameplay.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="parent">The parent actor to add spawned object instances. Can be null to use the first loaded scene.</param>
+    /// <param name="count">The amount of the instances to have in the pool.</param>
+    API_FUNCTION() static void Prewarm(Prefab* prefab, Actor* parent, int32 count);
+
+    /// <summary>
+    /// Gets the amount of the released instances of the prefab that are ready for reuse.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <returns>The pooled instances count.</returns>
+    API_FUNCTION() static int32 GetPooledCount(Prefab* prefab);
+
+    /// <summary>
+    /// Destroys all pooled actors.
+    /// </summary>
+    API_FUNCTION() static void Clear();
+};
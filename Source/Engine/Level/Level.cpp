@@ -5,6 +5,7 @@
 #include "LargeWorlds.h"
 #include "SceneQuery.h"
 #include "SceneObjectsFactory.h"
+#include "SignificanceManager.h"
 #include "Scene/Scene.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Cache.h"
@@ -23,6 +24,7 @@
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/FileSystem.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Script.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Scripting/ManagedCLR/MAssembly.h"
@@ -34,6 +36,7 @@
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Serialization/JsonBinary.h"
 #include "Prefabs/Prefab.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
@@ -92,6 +95,11 @@ class SceneAction
     {
         return true;
     }
+
+    virtual bool IsDone() const
+    {
+        return true;
+    }
 };
 
 #if USE_EDITOR
@@ -110,6 +118,7 @@ namespace LevelImpl
     Array<SceneAction*> _sceneActions;
     CriticalSection _sceneActionsLocker;
     DateTime _lastSceneLoadTime(0);
+    double _sceneActionsDeadline = 0.0;
 #if USE_EDITOR
     Array<ScriptsReloadObject> ScriptsReloadObjects;
 #endif
@@ -149,6 +158,7 @@ LevelService LevelServiceInstanceService;
 CriticalSection Level::ScenesLock;
 Array<Scene*> Level::Scenes;
 bool Level::TickEnabled = true;
+float Level::AsyncSceneLoadTimeBudget = 5.0f;
 Delegate<Actor*> Level::ActorSpawned;
 Delegate<Actor*> Level::ActorDeleted;
 Delegate<Actor*, Actor*> Level::ActorParentChanged;
@@ -273,6 +283,7 @@ void LayersAndTagsSettings::Apply()
 
 void LevelService::Update()
 {
+    SignificanceManager::OnUpdate();
     TICK_LEVEL(Update, "Level::Update")
     TICK_LEVEL_EDITOR(Update)
 }
@@ -302,6 +313,10 @@ void LevelService::LateFixedUpdate()
 void LevelService::Dispose()
 {
     ScopeLock lock(_sceneActionsLocker);
+    ScopeLock scenesLock(Level::ScenesLock);
+
+    // Cancel pending actions (eg. scene loading that is in progress)
+    _sceneActions.ClearDelete();
 
     // Unload scenes
     unloadScenes();
@@ -386,11 +401,74 @@ void Level::CollectPostFxVolumes(RenderContext& renderContext)
     }
 }
 
+// Scene loading state that can be resumed (used to split the async scene loading into multiple frames)
+class SceneLoader
+{
+public:
+    enum class Stages
+    {
+        Begin,
+        Spawn,
+        SpawnWait,
+        SetupPrefabs,
+        Deserialize,
+        Synchronize,
+        Initialize,
+        BeginPlay,
+        Loaded,
+    };
+
+    rapidjson_flax::Value& Data;
+    int32 EngineBuild;
+    Stages Stage = Stages::Begin;
+    int32 StageIndex = 0;
+    int32 DataCount = 0;
+    int64 SpawnLabel = 0;
+    int64 volatile SpawnDone = 0;
+    Stopwatch Timer;
+    Guid SceneId;
+    Scene* LoadedScene = nullptr;
+    Array<Actor*> InjectedSceneChildren;
+    CollectionPoolCache<ISerializeModifier, Cache::ISerializeModifierClearCallback>::ScopeCache Modifier;
+    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache SceneObjects;
+    SceneObjectsFactory::Context Context;
+    SceneObjectsFactory::PrefabSyncData SyncData;
+
+    SceneLoader(rapidjson_flax::Value& data, int32 engineBuild)
+        : Data(data)
+        , EngineBuild(engineBuild)
+        , Modifier(Cache::ISerializeModifier.Get())
+        , SceneObjects(ActorsCache::SceneObjectsListCache.Get())
+        , Context(Modifier.Value)
+        , SyncData(*SceneObjects.Value, data, Modifier.Value)
+    {
+    }
+
+    ~SceneLoader();
+
+    FORCE_INLINE bool IsDone() const
+    {
+        return Stage == Stages::Loaded;
+    }
+
+    /// <summary>
+    /// Performs the scene loading until it's done or the time limit is reached (at least one step is always performed).
+    /// </summary>
+    /// <param name="deadline">The time limit (in seconds, see Platform::GetTimeSeconds) or 0 to load the whole scene at once.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Tick(double deadline);
+
+private:
+    bool Begin();
+    void Spawn(int32 index);
+};
+
 class LoadSceneAction : public SceneAction
 {
 public:
     Guid SceneId;
     AssetReference<JsonAsset> SceneAsset;
+    mutable SceneLoader* Loader = nullptr;
 
     LoadSceneAction(const Guid& sceneId, JsonAsset* sceneAsset)
     {
@@ -398,6 +476,12 @@ class LoadSceneAction : public SceneAction
         SceneAsset = sceneAsset;
     }
 
+    ~LoadSceneAction()
+    {
+        if (Loader)
+            Delete(Loader);
+    }
+
     bool CanDo() const override
     {
         return SceneAsset == nullptr || SceneAsset->IsLoaded();
@@ -405,26 +489,46 @@ class LoadSceneAction : public SceneAction
 
     bool Do() const override
     {
-        // Now to deserialize scene in a proper way we need to load scripting
-        if (!Scripting::IsEveryAssemblyLoaded())
+        if (!Loader)
         {
-            LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
+            // Now to deserialize scene in a proper way we need to load scripting
+            if (!Scripting::IsEveryAssemblyLoaded())
+            {
+                LOG(Error, "Scripts must be compiled without any errors in order to load a scene.");
 #if USE_EDITOR
-            Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
+                Platform::Error(TEXT("Scripts must be compiled without any errors in order to load a scene. Please fix it."));
 #endif
-            CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
-            return true;
+                CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                return true;
+            }
+
+            if (SceneAsset == nullptr || SceneAsset->WaitForLoaded())
+            {
+                LOG(Error, "Cannot load scene asset.");
+                CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
+                return true;
+            }
+            Loader = New<SceneLoader>(*SceneAsset->Data, SceneAsset->DataEngineBuild);
         }
 
-        // Load scene
-        if (Level::loadScene(SceneAsset))
+        // Load scene (can take multiple frames)
+        const bool failed = Loader->Tick(_sceneActionsDeadline);
+        if (failed)
         {
             LOG(Error, "Failed to deserialize scene {0}", SceneId);
             CallSceneEvent(SceneEventType::OnSceneLoadError, nullptr, SceneId);
-            return true;
         }
+        if (failed || Loader->IsDone())
+        {
+            Delete(Loader);
+            Loader = nullptr;
+        }
+        return failed;
+    }
 
-        return false;
+    bool IsDone() const override
+    {
+        return Loader == nullptr;
     }
 };
 
@@ -765,10 +869,16 @@ void LevelImpl::flushActions()
 {
     ScopeLock lock(_sceneActionsLocker);
 
+    // Limit the time spent on the scene loading (spread over multiple frames)
+    _sceneActionsDeadline = Level::AsyncSceneLoadTimeBudget > 0.0f ? Platform::GetTimeSeconds() + Level::AsyncSceneLoadTimeBudget * 0.001 : 0.0;
+
     while (_sceneActions.HasItems() && _sceneActions.First()->CanDo())
     {
-        const auto action = _sceneActions.Dequeue();
+        const auto action = _sceneActions.First();
         action->Do();
+        if (!action->IsDone())
+            break; // Continue in the next frame
+        _sceneActions.RemoveAtKeepOrder(0);
         Delete(action);
     }
 }
@@ -838,16 +948,28 @@ bool Level::loadScene(const BytesContainer& sceneData, Scene** outScene)
         return true;
     }
 
-    // Parse scene JSON file
+    // Parse scene JSON file (or binary json from cooked game)
     rapidjson_flax::Document document;
+    if (JsonBinary::IsBinary(sceneData.Get(), sceneData.Length()))
     {
-        PROFILE_CPU_NAMED("Json.Parse");
-        document.Parse(sceneData.Get<char>(), sceneData.Length());
+        PROFILE_CPU_NAMED("Json.ParseBinary");
+        if (JsonBinary::Parse(document, sceneData.Get(), sceneData.Length()))
+        {
+            LOG(Error, "Invalid binary scene data.");
+            return true;
+        }
     }
-    if (document.HasParseError())
+    else
     {
-        Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
-        return true;
+        {
+            PROFILE_CPU_NAMED("Json.Parse");
+            document.Parse(sceneData.Get<char>(), sceneData.Length());
+        }
+        if (document.HasParseError())
+        {
+            Log::JsonParseException(document.GetParseError(), document.GetErrorOffset());
+            return true;
+        }
     }
 
     ScopeLock lock(ScenesLock);
@@ -868,11 +990,230 @@ bool Level::loadScene(rapidjson_flax::Document& document, Scene** outScene)
 
 bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** outScene)
 {
-    PROFILE_CPU_NAMED("Level.LoadScene");
     if (outScene)
         *outScene = nullptr;
+    SceneLoader loader(data, engineBuild);
+    if (loader.Tick(0.0))
+        return true;
+    if (outScene)
+        *outScene = loader.LoadedScene;
+    return false;
+}
+
+SceneLoader::~SceneLoader()
+{
+    if (Stage == Stages::SpawnWait)
+    {
+        // Wait for the spawn jobs to end
+        Level::ScenesLock.Unlock();
+        JobSystem::Wait(SpawnLabel);
+        while (Platform::AtomicRead(&SpawnDone) == 0)
+            Platform::Sleep(0); // Continuation can be still running
+        Level::ScenesLock.Lock();
+    }
+    if (LoadedScene && Stage != Stages::Loaded)
+    {
+        // Loading has been canceled so remove the spawned objects (the ones not linked to the scene are not removed with it)
+        for (SceneObject* obj : *SceneObjects.Value)
+        {
+            if (obj && obj != LoadedScene && obj->GetParent() == nullptr)
+                obj->DeleteObject();
+        }
+        LoadedScene->DeleteObject();
+    }
+}
+
+bool SceneLoader::Tick(double deadline)
+{
+    PROFILE_CPU_NAMED("Level.LoadScene");
+    PROFILE_MEM(Level);
+#define CHECK_TIME() if (deadline > 0.0 && Platform::GetTimeSeconds() >= deadline) return false
+    while (Stage != Stages::Loaded)
+    {
+        switch (Stage)
+        {
+        case Stages::Begin:
+            if (Begin())
+                return true;
+            break;
+        case Stages::Spawn:
+        {
+            PROFILE_CPU_NAMED("Spawn");
+            if (Context.Async)
+            {
+                // Spawn objects on job threads
+                SpawnLabel = JobSystem::Dispatch([this](int32 i)
+                {
+                    Spawn(i + 1); // Start from 1. at index [0] was scene
+                }, DataCount - 1);
+                if (deadline > 0.0)
+                {
+                    // Don't block the main thread and check for the jobs end in the next frames
+                    JobSystem::AddContinuation(SpawnLabel, [this]
+                    {
+                        Platform::AtomicStore(&SpawnDone, 1);
+                    });
+                    Stage = Stages::SpawnWait;
+                    return false;
+                }
+                Level::ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
+                JobSystem::Wait(SpawnLabel);
+                Level::ScenesLock.Lock();
+            }
+            else
+            {
+                for (; StageIndex < DataCount; StageIndex++)
+                {
+                    Spawn(StageIndex);
+                    if (deadline > 0.0 && Platform::GetTimeSeconds() >= deadline)
+                    {
+                        StageIndex++;
+                        break;
+                    }
+                }
+                if (StageIndex < DataCount)
+                    return false;
+            }
+            Stage = Stages::SetupPrefabs;
+            break;
+        }
+        case Stages::SpawnWait:
+            if (Platform::AtomicRead(&SpawnDone) == 0)
+                return false;
+            Stage = Stages::SetupPrefabs;
+            break;
+        case Stages::SetupPrefabs:
+            // Capture prefab instances in a scene to restore any missing objects (eg. newly added objects to prefab that are missing in scene file)
+            SceneObjectsFactory::SetupPrefabInstances(Context, SyncData);
+            // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SynchronizeNewPrefabInstances(Context, SyncData);
+            Stage = Stages::Deserialize;
+            StageIndex = 1; // Start from 1. at index [0] was scene
+            break;
+        case Stages::Deserialize:
+        {
+            // Load all scene objects
+            // TODO: before doing full async for scene objects fix:
+            // TODO: - fix Actor's Scripts and Children order when loading objects data out of order via async jobs
+            // TODO: - add _loadNoAsync flag to SceneObject or Actor to handle non-async loading for those types (eg. UIControl/UICanvas)
+            PROFILE_CPU_NAMED("Deserialize");
+            SceneObject** objects = SceneObjects->Get();
+            const bool wasAsync = Context.Async;
+            Context.Async = false;
+            Scripting::ObjectsLookupIdMapping.Set(&Modifier->IdsMapping);
+            for (; StageIndex < DataCount; StageIndex++)
+            {
+                auto obj = objects[StageIndex];
+                if (obj)
+                    SceneObjectsFactory::Deserialize(Context, obj, Data[StageIndex]);
+                if (deadline > 0.0 && Platform::GetTimeSeconds() >= deadline)
+                {
+                    StageIndex++;
+                    break;
+                }
+            }
+            Scripting::ObjectsLookupIdMapping.Set(nullptr);
+            Context.Async = wasAsync;
+            if (StageIndex < DataCount)
+                return false;
+            Stage = Stages::Synchronize;
+            break;
+        }
+        case Stages::Synchronize:
+        {
+            // Add injected children of scene (via OnSceneLoading) into sceneObjects to be initialized
+            for (auto child : InjectedSceneChildren)
+            {
+                Array<SceneObject*> injectedSceneObjects;
+                injectedSceneObjects.Add(child);
+                SceneQuery::GetAllSceneObjects(child, injectedSceneObjects);
+                for (auto o : injectedSceneObjects)
+                {
+                    if (!o->IsRegistered())
+                        o->RegisterObject();
+                    SceneObjects->Add(o);
+                }
+            }
+
+            // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
+            // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
+            SceneObjectsFactory::SynchronizePrefabInstances(Context, SyncData);
+
+            // Cache transformations
+            {
+                PROFILE_CPU_NAMED("Cache Transform");
+
+                LoadedScene->OnTransformChanged();
+            }
+            Stage = Stages::Initialize;
+            StageIndex = 0;
+            break;
+        }
+        case Stages::Initialize:
+        {
+            // Initialize scene objects
+            PROFILE_CPU_NAMED("Initialize");
+            SceneObject** objects = SceneObjects->Get();
+            for (; StageIndex < SceneObjects->Count(); StageIndex++)
+            {
+                SceneObject* obj = objects[StageIndex];
+                if (obj)
+                {
+                    obj->Initialize();
+
+                    // Delete objects without parent
+                    if (StageIndex != 0 && obj->GetParent() == nullptr)
+                    {
+                        LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
+                        obj->DeleteObject();
+                    }
+                }
+                if (deadline > 0.0 && Platform::GetTimeSeconds() >= deadline)
+                {
+                    StageIndex++;
+                    break;
+                }
+            }
+            if (StageIndex < SceneObjects->Count())
+                return false;
+            SyncData.InitNewObjects();
+            Stage = Stages::BeginPlay;
+            break;
+        }
+        case Stages::BeginPlay:
+        {
+            // Link scene and call init
+            {
+                PROFILE_CPU_NAMED("BeginPlay");
+
+                ScopeLock lock(Level::ScenesLock);
+                Level::Scenes.Add(LoadedScene);
+                SceneBeginData beginData;
+                LoadedScene->BeginPlay(&beginData);
+                beginData.OnDone();
+            }
+            Stage = Stages::Loaded;
+
+            // Fire event
+            CallSceneEvent(SceneEventType::OnSceneLoaded, LoadedScene, SceneId);
+
+            Timer.Stop();
+            LOG(Info, "Scene loaded in {0}ms", Timer.GetMilliseconds());
+            return false;
+        }
+        default:
+            return true;
+        }
+        CHECK_TIME();
+    }
+#undef CHECK_TIME
+    return false;
+}
+
+bool SceneLoader::Begin()
+{
     LOG(Info, "Loading scene...");
-    Stopwatch stopwatch;
+    Timer.Start();
     _lastSceneLoadTime = DateTime::Now();
 
     // Here whole scripting backend should be loaded for current project
@@ -893,217 +1234,74 @@ bool Level::loadScene(rapidjson_flax::Value& data, int32 engineBuild, Scene** ou
     }
 
     // Peek meta
-    if (engineBuild < 6000)
+    if (EngineBuild < 6000)
     {
         LOG(Error, "Invalid serialized engine build.");
         return true;
     }
-    if (!data.IsArray())
+    if (!Data.IsArray())
     {
         LOG(Error, "Invalid Data member.");
         return true;
     }
 
     // Peek scene node value (it's the first actor serialized)
-    auto sceneId = JsonTools::GetGuid(data[0], "ID");
-    if (!sceneId.IsValid())
+    SceneId = JsonTools::GetGuid(Data[0], "ID");
+    if (!SceneId.IsValid())
     {
         LOG(Error, "Invalid scene id.");
         return true;
     }
-    auto modifier = Cache::ISerializeModifier.Get();
-    modifier->EngineBuild = engineBuild;
+    Modifier->EngineBuild = EngineBuild;
 
     // Skip is that scene is already loaded
-    if (FindScene(sceneId) != nullptr)
+    if (Level::FindScene(SceneId) != nullptr)
     {
-        LOG(Info, "Scene {0} is already loaded.", sceneId);
+        LOG(Info, "Scene {0} is already loaded.", SceneId);
+        Stage = Stages::Loaded;
         return false;
     }
 
     // Create scene actor
     // Note: the first object in the scene file data is a Scene Actor
-    auto scene = New<Scene>(ScriptingObjectSpawnParams(sceneId, Scene::TypeInitializer));
-    scene->RegisterObject();
-    scene->Deserialize(data[0], modifier.Value);
+    LoadedScene = New<Scene>(ScriptingObjectSpawnParams(SceneId, Scene::TypeInitializer));
+    LoadedScene->RegisterObject();
+    LoadedScene->Deserialize(Data[0], Modifier.Value);
 
     // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoading, scene, sceneId);
+    CallSceneEvent(SceneEventType::OnSceneLoading, LoadedScene, SceneId);
 
     // Get any injected children of the scene.
-    Array<Actor*> injectedSceneChildren = scene->Children;
+    InjectedSceneChildren = LoadedScene->Children;
 
     // Loaded scene objects list
-    CollectionPoolCache<ActorsCache::SceneObjectsListType>::ScopeCache sceneObjects = ActorsCache::SceneObjectsListCache.Get();
-    const int32 dataCount = (int32)data.Size();
-    sceneObjects->Resize(dataCount);
-    sceneObjects->At(0) = scene;
+    DataCount = (int32)Data.Size();
+    SceneObjects->Resize(DataCount);
+    SceneObjects->At(0) = LoadedScene;
 
     // Spawn all scene objects
-    SceneObjectsFactory::Context context(modifier.Value);
-    context.Async = JobSystem::GetThreadsCount() > 1 && dataCount > 10;
+    Context.Async = JobSystem::GetThreadsCount() > 1 && DataCount > 10;
+    Stage = Stages::Spawn;
+    StageIndex = 1; // Start from 1. at index [0] was scene
+    return false;
+}
+
+void SceneLoader::Spawn(int32 index)
+{
+    auto& stream = Data[index];
+    auto obj = SceneObjectsFactory::Spawn(Context, stream);
+    SceneObjects->Get()[index] = obj;
+    if (obj)
     {
-        PROFILE_CPU_NAMED("Spawn");
-        SceneObject** objects = sceneObjects->Get();
-        if (context.Async)
-        {
-            ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
-            JobSystem::Execute([&](int32 i)
-            {
-                i++; // Start from 1. at index [0] was scene
-                auto& stream = data[i];
-                auto obj = SceneObjectsFactory::Spawn(context, stream);
-                objects[i] = obj;
-                if (obj)
-                {
-                    obj->RegisterObject();
+        obj->RegisterObject();
 #if USE_EDITOR
-                    // Auto-create C# objects for all actors in Editor during scene load when running in async (so main thread already has all of them)
-                    obj->CreateManaged();
+        // Auto-create C# objects for all actors in Editor during scene load when running in async (so main thread already has all of them)
+        if (Context.Async)
+            obj->CreateManaged();
 #endif
-                }
-                else
-                    SceneObjectsFactory::HandleObjectDeserializationError(stream);
-            }, dataCount - 1);
-            ScenesLock.Lock();
-        }
-        else
-        {
-            for (int32 i = 1; i < dataCount; i++) // start from 1. at index [0] was scene
-            {
-                auto& stream = data[i];
-                auto obj = SceneObjectsFactory::Spawn(context, stream);
-                sceneObjects->At(i) = obj;
-                if (obj)
-                    obj->RegisterObject();
-                else
-                    SceneObjectsFactory::HandleObjectDeserializationError(stream);
-            }
-        }
     }
-
-    // Capture prefab instances in a scene to restore any missing objects (eg. newly added objects to prefab that are missing in scene file)
-    SceneObjectsFactory::PrefabSyncData prefabSyncData(*sceneObjects.Value, data, modifier.Value);
-    SceneObjectsFactory::SetupPrefabInstances(context, prefabSyncData);
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizeNewPrefabInstances(context, prefabSyncData);
-
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on multiple threads at once
-
-    // Load all scene objects
-    {
-        PROFILE_CPU_NAMED("Deserialize");
-        SceneObject** objects = sceneObjects->Get();
-        bool wasAsync = context.Async;
-        context.Async = false; // TODO: before doing full async for scene objects fix:
-        // TODO: - fix Actor's Scripts and Children order when loading objects data out of order via async jobs
-        // TODO: - add _loadNoAsync flag to SceneObject or Actor to handle non-async loading for those types (eg. UIControl/UICanvas)
-        if (context.Async)
-        {
-            ScenesLock.Unlock(); // Unlock scenes from Main Thread so Job Threads can use it to safely setup actors hierarchy (see Actor::Deserialize)
-            JobSystem::Execute([&](int32 i)
-            {
-                i++; // Start from 1. at index [0] was scene
-                auto obj = objects[i];
-                if (obj)
-                {
-                    auto& idMapping = Scripting::ObjectsLookupIdMapping.Get();
-                    idMapping = &context.GetModifier()->IdsMapping;
-                    SceneObjectsFactory::Deserialize(context, obj, data[i]);
-                    idMapping = nullptr;
-                }
-            }, dataCount - 1);
-            ScenesLock.Lock();
-        }
-        else
-        {
-            Scripting::ObjectsLookupIdMapping.Set(&modifier.Value->IdsMapping);
-            for (int32 i = 1; i < dataCount; i++) // start from 1. at index [0] was scene
-            {
-                auto& objData = data[i];
-                auto obj = objects[i];
-                if (obj)
-                    SceneObjectsFactory::Deserialize(context, obj, objData);
-            }
-            Scripting::ObjectsLookupIdMapping.Set(nullptr);
-        }
-        context.Async = wasAsync;
-    }
-
-    // /\ all above this has to be done on multiple threads at once
-    // \/ all below this has to be done on an any thread
-
-    // Add injected children of scene (via OnSceneLoading) into sceneObjects to be initialized
-    for (auto child : injectedSceneChildren)
-    {
-        Array<SceneObject*> injectedSceneObjects;
-        injectedSceneObjects.Add(child);
-        SceneQuery::GetAllSceneObjects(child, injectedSceneObjects);
-        for (auto o : injectedSceneObjects)
-        {
-            if (!o->IsRegistered())
-                o->RegisterObject();
-            sceneObjects->Add(o);
-        }
-    }
-
-    // Synchronize prefab instances (prefab may have objects removed or reordered so deserialized instances need to synchronize with it)
-    // TODO: resave and force sync scenes during game cooking so this step could be skipped in game
-    SceneObjectsFactory::SynchronizePrefabInstances(context, prefabSyncData);
-
-    // Cache transformations
-    {
-        PROFILE_CPU_NAMED("Cache Transform");
-
-        scene->OnTransformChanged();
-    }
-
-    // Initialize scene objects
-    {
-        PROFILE_CPU_NAMED("Initialize");
-
-        SceneObject** objects = sceneObjects->Get();
-        for (int32 i = 0; i < sceneObjects->Count(); i++)
-        {
-            SceneObject* obj = objects[i];
-            if (obj)
-            {
-                obj->Initialize();
-
-                // Delete objects without parent
-                if (i != 0 && obj->GetParent() == nullptr)
-                {
-                    LOG(Warning, "Scene object {0} {1} has missing parent object after load. Removing it.", obj->GetID(), obj->ToString());
-                    obj->DeleteObject();
-                }
-            }
-        }
-        prefabSyncData.InitNewObjects();
-    }
-
-    // /\ all above this has to be done on an any thread
-    // \/ all below this has to be done on a main thread
-
-    // Link scene and call init
-    {
-        PROFILE_CPU_NAMED("BeginPlay");
-
-        ScopeLock lock(ScenesLock);
-        Scenes.Add(scene);
-        SceneBeginData beginData;
-        scene->BeginPlay(&beginData);
-        beginData.OnDone();
-    }
-
-    // Fire event
-    CallSceneEvent(SceneEventType::OnSceneLoaded, scene, sceneId);
-
-    stopwatch.Stop();
-    LOG(Info, "Scene loaded in {0}ms", stopwatch.GetMilliseconds());
-    if (outScene)
-        *outScene = scene;
-    return false;
+    else
+        SceneObjectsFactory::HandleObjectDeserializationError(stream);
 }
 
 bool LevelImpl::saveScene(Scene* scene)
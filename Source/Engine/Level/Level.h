@@ -50,6 +50,11 @@ API_CLASS(Static) class FLAXENGINE_API Level
     /// </summary>
     API_FIELD() static bool TickEnabled;
 
+    /// <summary>
+    /// The maximum time (in milliseconds) that the async scene loading can spend on a main thread per frame. Loading is split into multiple frames (spawn, deserialize, initialize, begin play stages) to prevent hitches. Use 0 to load the whole scene within a single frame.
+    /// </summary>
+    API_FIELD() static float AsyncSceneLoadTimeBudget;
+
 public:
     /// <summary>
     /// Occurs when new actor gets spawned to the game.
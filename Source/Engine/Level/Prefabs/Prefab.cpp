@@ -9,13 +9,16 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Scripting/Scripting.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 
 REGISTER_JSON_ASSET(Prefab, "FlaxEngine.Prefab", true);
 
 Prefab::Prefab(const SpawnParams& params, const AssetInfo* info)
     : JsonAssetBase(params, info)
     , _isCreatingDefaultInstance(false)
+    , _hasSpawnCache(false)
     , _defaultInstance(nullptr)
+    , _rootObjectIndex(0)
     , ObjectsCount(0)
 {
 }
@@ -94,10 +97,47 @@ SceneObject* Prefab::GetDefaultInstance(const Guid& objectId)
     return result;
 }
 
+void Prefab::GetSpawnCache(int32& rootObjectIndex, const ScriptingTypeHandle*& objectsTypes)
+{
+    ScopeLock lock(Locker);
+    if (!_hasSpawnCache)
+    {
+        PROFILE_CPU();
+
+        // Find root object
+        const Guid rootObjectId = GetRootObjectId();
+        _rootObjectIndex = ObjectsIds.Find(rootObjectId);
+
+        // Resolve objects types to skip type name lookup on every spawn
+        const auto& data = *Data;
+        _objectsTypes.Resize(ObjectsCount);
+        for (int32 i = 0; i < ObjectsCount; i++)
+        {
+            ScriptingTypeHandle type;
+            auto& objData = data[i];
+            const auto typeNameMember = objData.FindMember("TypeName");
+            if (typeNameMember != objData.MemberEnd() && typeNameMember->value.IsString() && !objData.HasMember("PrefabObjectID"))
+            {
+                type = Scripting::FindScriptingType(typeNameMember->value.GetStringAnsiView());
+                if (type && !SceneObject::TypeInitializer.IsAssignableFrom(type))
+                    type = ScriptingTypeHandle(); // Let factory report the error
+            }
+            _objectsTypes[i] = type;
+        }
+        _hasSpawnCache = true;
+    }
+    rootObjectIndex = _rootObjectIndex;
+    objectsTypes = _objectsTypes.Get();
+}
+
 void Prefab::DeleteDefaultInstance()
 {
     ScopeLock lock(Locker);
     ObjectsCache.Clear();
+
+    // Types can be reloaded with scripts so reset cached spawn data
+    _hasSpawnCache = false;
+    _objectsTypes.Clear();
     if (_defaultInstance)
     {
         _defaultInstance->DeleteObject();
@@ -183,6 +223,8 @@ void Prefab::unload(bool isReloading)
 
     ObjectsCount = 0;
     ObjectsIds.Resize(0);
+    _hasSpawnCache = false;
+    _objectsTypes.Resize(0);
     NestedPrefabs.Resize(0);
     ObjectsDataCache.Clear();
     ObjectsDataCache.SetCapacity(0);
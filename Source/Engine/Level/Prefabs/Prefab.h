@@ -18,7 +18,10 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     DECLARE_ASSET_HEADER(Prefab);
 private:
     bool _isCreatingDefaultInstance;
+    bool _hasSpawnCache;
     Actor* _defaultInstance;
+    int32 _rootObjectIndex;
+    Array<ScriptingTypeHandle> _objectsTypes;
 
 public:
     /// <summary>
@@ -65,6 +68,13 @@ API_CLASS(NoSpawn) class FLAXENGINE_API Prefab : public JsonAssetBase
     /// <returns>The object of the prefab loaded from the prefab. Contains the default values. It's not added to gameplay but deserialized with postLoad and init event fired.</returns>
     API_FUNCTION() SceneObject* GetDefaultInstance(API_PARAM(Ref) const Guid& objectId);
 
+    /// <summary>
+    /// Caches the data used by the prefab spawning (root object index and resolved objects types). Skips if already done. Asset must be loaded.
+    /// </summary>
+    /// <param name="rootObjectIndex">The index of the root object in the prefab data.</param>
+    /// <param name="objectsTypes">The resolved types of the objects (matches ObjectsIds order). Empty handle if object type has to be resolved from its data (eg. nested prefab instance).</param>
+    void GetSpawnCache(int32& rootObjectIndex, const ScriptingTypeHandle*& objectsTypes);
+
 #if USE_EDITOR
     /// <summary>
     /// Applies the difference from the prefab object instance, saves the changes and synchronizes them with the active instances of the prefab asset.
@@ -124,6 +124,14 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     auto& data = *prefab->Data;
     SceneObjectsFactory::Context context(modifier.Value);
     LogContextScope logContext(prefabId);
+    int32 rootObjectIndex;
+    const ScriptingTypeHandle* objectsTypes;
+    prefab->GetSpawnCache(rootObjectIndex, objectsTypes);
+    const Guid* objectsIds = prefab->ObjectsIds.Get();
+
+    // Synchronization is needed only for nested prefabs instances
+    if (prefab->NestedPrefabs.IsEmpty())
+        withSynchronization = false;
 
     // Deserialize prefab objects
     auto prevIdMapping = Scripting::ObjectsLookupIdMapping.Get();
@@ -131,7 +139,7 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     for (int32 i = 0; i < dataCount; i++)
     {
         auto& stream = data[i];
-        SceneObject* obj = SceneObjectsFactory::Spawn(context, stream);
+        SceneObject* obj = objectsTypes[i] ? SceneObjectsFactory::Spawn(context, objectsIds[i], objectsTypes[i]) : SceneObjectsFactory::Spawn(context, stream);
         sceneObjects->At(i) = obj;
         if (obj)
             obj->RegisterObject();
@@ -165,12 +173,8 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
 
     // Pick prefab root object
     Actor* root = nullptr;
-    const Guid prefabRootObjectId = prefab->GetRootObjectId();
-    for (int32 i = 0; i < dataCount && !root; i++)
-    {
-        if (JsonTools::GetGuid(data[i], "ID") == prefabRootObjectId)
-            root = dynamic_cast<Actor*>(sceneObjects->At(i));
-    }
+    if (rootObjectIndex != -1)
+        root = dynamic_cast<Actor*>(sceneObjects->At(rootObjectIndex));
     if (!root)
     {
         // Fallback to the first actor that has no parent
@@ -270,12 +274,11 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     // Link objects to prefab (only deserialized from prefab data)
     for (int32 i = 0; i < dataCount; i++)
     {
-        auto& stream = data[i];
         SceneObject* obj = sceneObjects->At(i);
         if (!obj)
             continue;
 
-        const Guid prefabObjectId = JsonTools::GetGuid(stream, "ID");
+        const Guid prefabObjectId = objectsIds[i];
         if (objectsCache)
             objectsCache->Add(prefabObjectId, obj);
         obj->LinkPrefab(prefabId, prefabObjectId);
@@ -299,6 +302,30 @@ Actor* PrefabManager::SpawnPrefab(Prefab* prefab, const Transform& transform, Ac
     return root;
 }
 
+Array<Actor*> PrefabManager::SpawnPrefabs(Prefab* prefab, const Array<Transform>& transforms, Actor* parent)
+{
+    PROFILE_CPU_NAMED("Prefab.SpawnBatch");
+    Array<Actor*> result;
+    if (prefab == nullptr)
+    {
+        Log::ArgumentNullException();
+        return result;
+    }
+    if (prefab->WaitForLoaded())
+    {
+        LOG(Warning, "Waiting for prefab asset be loaded failed. {0}", prefab->ToString());
+        return result;
+    }
+    if (!parent)
+        parent = Level::Scenes.Count() != 0 ? Level::Scenes.Get()[0] : nullptr;
+
+    // Prefab data and spawn cache are shared by all instances so only objects creation and deserialization is done per-instance
+    result.Resize(transforms.Count());
+    for (int32 i = 0; i < transforms.Count(); i++)
+        result.Get()[i] = SpawnPrefab(prefab, transforms.Get()[i], parent, nullptr);
+    return result;
+}
+
 #if USE_EDITOR
 
 bool PrefabManager::CreatePrefab(Actor* targetActor, const StringView& outputPath, bool autoLink)
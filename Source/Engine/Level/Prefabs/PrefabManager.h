@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingType.h"
+#include "Engine/Core/Collections/Array.h"
 
 class Prefab;
 class Actor;
@@ -102,6 +103,15 @@ API_CLASS(Static) class FLAXENGINE_API PrefabManager
     /// <returns>The created actor (root) or null if failed.</returns>
     static Actor* SpawnPrefab(Prefab* prefab, const Transform& transform, Actor* parent, Dictionary<Guid, SceneObject*, HeapAllocation>* objectsCache, bool withSynchronization = true);
 
+    /// <summary>
+    /// Spawns the multiple instances of the prefab objects at once (eg. projectiles). Faster than spawning instances one-by-one.
+    /// </summary>
+    /// <param name="prefab">The prefab asset.</param>
+    /// <param name="transforms">The instances transformations (one instance is spawned per transform).</param>
+    /// <param name="parent">The parent actor to add spawned objects instances. Can be null to use the first loaded scene.</param>
+    /// <returns>The created actors (roots). Contains null for instances that failed to spawn.</returns>
+    API_FUNCTION() static Array<Actor*> SpawnPrefabs(Prefab* prefab, const Array<Transform>& transforms, Actor* parent = nullptr);
+
 #if USE_EDITOR
 
     /// <summary>
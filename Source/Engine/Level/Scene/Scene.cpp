@@ -13,6 +13,7 @@
 #include "Engine/Navigation/NavMeshBoundsVolume.h"
 #include "Engine/Navigation/NavMesh.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Serialization/Serialization.h"
 #if USE_EDITOR
 #include "Engine/Engine/Globals.h"
@@ -68,9 +69,11 @@ Scene::Scene(const SpawnParams& params)
     : Actor(params)
     , LightmapsData(this)
     , CSGData(this)
+    , HLODData(this)
 {
     // Default name
     _name = TEXT("Scene");
+    PROFILE_LOCK(Rendering.Locker, "SceneRendering::Locker");
 
     // Link events
     CSGData.CollisionData.Changed.Bind<Scene, &Scene::OnCsgCollisionDataChanged>(this);
@@ -142,6 +145,17 @@ Array<Guid> Scene::GetAssetReferences() const
     return result;
 }
 
+bool Scene::BuildHLOD()
+{
+    return HLODData.Build();
+}
+
+void Scene::ClearHLOD()
+{
+    HLODData.Clear();
+    Rendering.SetHLOD(nullptr);
+}
+
 #endif
 
 MeshCollider* Scene::TryGetCsgCollider()
@@ -287,6 +301,12 @@ void Scene::Serialize(SerializeStream& stream, const void* otherObj)
         stream.JKEY("CSG");
         stream.Object(&CSGData, other ? &other->CSGData : nullptr);
     }
+
+    if (HLODData.HasData())
+    {
+        stream.JKEY("HLOD");
+        stream.Object(&HLODData, other ? &other->HLODData : nullptr);
+    }
 }
 
 void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -297,6 +317,8 @@ void Scene::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
     Info.Deserialize(stream, modifier);
     LightmapsData.LoadLightmaps(Info.Lightmaps);
     CSGData.DeserializeIfExists(stream, "CSG", modifier);
+    HLODData.DeserializeIfExists(stream, "HLOD", modifier);
+    Rendering.SetHLOD(&HLODData);
 
     // [Deprecated on 13.01.2021, expires on 13.01.2023]
     if (modifier->EngineBuild <= 6215 && Navigation.Meshes.IsEmpty())
@@ -337,6 +359,8 @@ void Scene::OnDeleteObject()
     LightmapsData.UnloadLightmaps();
     CSGData.Model = nullptr;
     CSGData.CollisionData = nullptr;
+    Rendering.SetHLOD(nullptr);
+    HLODData.Clear();
 
     // Base
     Actor::OnDeleteObject();
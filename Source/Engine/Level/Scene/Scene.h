@@ -6,6 +6,7 @@
 #include "../SceneInfo.h"
 #include "SceneLightmapsData.h"
 #include "SceneCSGData.h"
+#include "SceneHLODData.h"
 #include "SceneRendering.h"
 #include "SceneTicking.h"
 #include "SceneNavigation.h"
@@ -19,6 +20,7 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
 {
     friend class Level;
     friend class ReloadScriptsAction;
+    friend class SceneLoader;
     DECLARE_SCENE_OBJECT(Scene);
 
     /// <summary>
@@ -57,6 +59,11 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// </summary>
     CSG::SceneCSGData CSGData;
 
+    /// <summary>
+    /// The HLOD data container for this scene.
+    /// </summary>
+    SceneHLODData HLODData;
+
     /// <summary>
     /// Gets the lightmap settings (per scene).
     /// </summary>
@@ -105,6 +112,17 @@ API_CLASS() class FLAXENGINE_API Scene : public Actor
     /// <returns>The collection of the asset ids referenced by this asset.</returns>
     API_FUNCTION() Array<Guid, HeapAllocation> GetAssetReferences() const;
 
+    /// <summary>
+    /// Builds the HLOD clusters for the scene. Nearby static models are merged into the simplified proxy models that are drawn instead of the whole clusters in the distance. Supported only in Editor.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() bool BuildHLOD();
+
+    /// <summary>
+    /// Removes the HLOD clusters from the scene. Supported only in Editor.
+    /// </summary>
+    API_FUNCTION() void ClearHLOD();
+
 #endif
 
 private:
@@ -0,0 +1,315 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneHLODData.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Serialization/Serialization.h"
+#if USE_EDITOR
+#include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Graphics/Models/ModelData.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#if COMPILE_WITH_ASSETS_IMPORTER
+#include "Engine/ContentImporters/AssetsImportingManager.h"
+#endif
+#if COMPILE_WITH_MODEL_TOOL
+#include "Engine/Tools/ModelTool/ModelTool.h"
+#endif
+#endif
+
+#if USE_EDITOR
+
+// The size of the grid cell used to group static models into HLOD clusters (in world units)
+#define HLOD_CELL_SIZE 10000.0f
+
+// The minimum amount of static models in a cell to create HLOD cluster
+#define HLOD_MIN_ACTORS 4
+
+// The minimum distance to swap cluster actors for the proxy model (in world units)
+#define HLOD_MIN_DISTANCE 20000.0f
+
+// The distance to swap cluster actors for the proxy model (as a factor of the cluster bounds radius)
+#define HLOD_DISTANCE_SCALE 4.0f
+
+// The amount of triangles to keep while simplifying the proxy model geometry
+#define HLOD_TRIANGLE_REDUCTION 0.3f
+
+// The simplification error of the proxy model geometry (relative to the merged mesh size)
+#define HLOD_TARGET_ERROR 0.02f
+
+namespace
+{
+    void CollectStaticModels(Actor* actor, Array<StaticModel*>& result)
+    {
+        if (!actor->GetIsActive())
+            return;
+
+        // Skip types that derive from the static model since they might override drawing
+        if (actor->GetTypeHandle() == StaticModel::TypeInitializer && actor->HasStaticFlag(StaticFlags::Transform))
+        {
+            auto staticModel = (StaticModel*)actor;
+            const auto model = staticModel->Model.Get();
+            if (model && !model->WaitForLoaded() && !model->IsVirtual() && model->LODs.HasItems() && !staticModel->HasVertexColors())
+                result.Add(staticModel);
+        }
+
+        for (Actor* child : actor->Children)
+            CollectStaticModels(child, result);
+    }
+
+    bool MergeMeshes(StaticModel* actor, const Vector3& origin, ModelData& modelData, Dictionary<Guid, int32>& materialToMesh)
+    {
+        // Use the lowest LOD since proxy is drawn only from the distance
+        const auto model = actor->Model.Get();
+        const auto& lod = model->LODs.Last();
+        Transform transform = actor->GetTransform();
+        transform.Translation -= origin;
+        Matrix world;
+        transform.GetWorld(world);
+        const bool flipWinding = world.GetDeterminant() < 0.0f;
+        for (const auto& mesh : lod.Meshes)
+        {
+            const int32 slotIndex = mesh.GetMaterialSlotIndex();
+            if (slotIndex < 0 || slotIndex >= actor->Entries.Count() || !actor->Entries[slotIndex].Visible)
+                continue;
+            MaterialBase* material = actor->GetMaterial(slotIndex);
+            if (!material)
+                continue;
+
+            // Download mesh data
+            BytesContainer vb0, vb1, ib;
+            int32 vertexCount, vb1Count, indexCount;
+            if (mesh.DownloadDataCPU(MeshBufferType::Vertex0, vb0, vertexCount) ||
+                mesh.DownloadDataCPU(MeshBufferType::Vertex1, vb1, vb1Count) ||
+                mesh.DownloadDataCPU(MeshBufferType::Index, ib, indexCount) ||
+                vertexCount != vb1Count)
+            {
+                LOG(Warning, "Failed to get mesh data of the model '{0}' used by '{1}'", model->ToString(), actor->ToString());
+                return true;
+            }
+            MeshData meshData;
+            meshData.InitFromModelVertices((VB0ElementType18*)vb0.Get(), (VB1ElementType18*)vb1.Get(), vertexCount);
+            meshData.Indices.Resize(indexCount);
+            if (mesh.Use16BitIndexBuffer())
+            {
+                const uint16* ib16 = (const uint16*)ib.Get();
+                for (int32 i = 0; i < indexCount; i++)
+                    meshData.Indices.Get()[i] = ib16[i];
+            }
+            else
+            {
+                Platform::MemoryCopy(meshData.Indices.Get(), ib.Get(), indexCount * sizeof(uint32));
+            }
+            if (flipWinding)
+            {
+                for (int32 i = 0; i + 2 < indexCount; i += 3)
+                    Swap(meshData.Indices.Get()[i + 1], meshData.Indices.Get()[i + 2]);
+            }
+            meshData.LightmapUVs.Clear();
+            meshData.TransformBuffer(world);
+
+            // Merge geometry that uses the same material into a single mesh
+            int32 meshIndex;
+            if (!materialToMesh.TryGet(material->GetID(), meshIndex))
+            {
+                meshIndex = modelData.LODs[0].Meshes.Count();
+                materialToMesh.Add(material->GetID(), meshIndex);
+                auto& slot = modelData.Materials.AddOne();
+                slot.Name = material->GetPath();
+                slot.AssetID = material->GetID();
+                slot.ShadowsMode = actor->Entries[slotIndex].ShadowsMode & model->MaterialSlots[slotIndex].ShadowsMode;
+                auto dstMesh = New<MeshData>();
+                dstMesh->MaterialSlotIndex = meshIndex;
+                dstMesh->Name = String::Format(TEXT("HLOD_{0}"), meshIndex);
+                modelData.LODs[0].Meshes.Add(dstMesh);
+                Swap(*dstMesh, meshData);
+            }
+            else
+            {
+                modelData.LODs[0].Meshes[meshIndex]->Merge(meshData);
+            }
+        }
+        return false;
+    }
+}
+
+#endif
+
+SceneHLODData::SceneHLODData(Scene* scene)
+    : _scene(scene)
+    , BuildTime(0)
+{
+}
+
+bool SceneHLODData::HasData() const
+{
+    return Clusters.HasItems();
+}
+
+void SceneHLODData::Clear()
+{
+    Clusters.Clear();
+}
+
+bool SceneHLODData::IsProxyActive(const Cluster& cluster, const RenderView& view)
+{
+    if (view.IsOfflinePass || !cluster.Proxy || !cluster.Proxy->IsLoaded())
+        return false;
+    const Real distance = cluster.Bounds.Distance(view.Position + view.Origin);
+    return distance >= cluster.Distance * view.ModelLODDistanceFactor;
+}
+
+#if USE_EDITOR
+
+bool SceneHLODData::Build()
+{
+#if COMPILE_WITH_ASSETS_IMPORTER
+    PROFILE_CPU();
+    const auto startTime = DateTime::NowUTC();
+
+    // Group static models into grid cells
+    Array<StaticModel*> actors;
+    CollectStaticModels(_scene, actors);
+    Dictionary<Int3, Array<StaticModel*>> cells;
+    for (StaticModel* actor : actors)
+    {
+        const Vector3 center = actor->GetBox().GetCenter();
+        const Int3 cell((int32)Math::Floor(center.X / HLOD_CELL_SIZE), (int32)Math::Floor(center.Y / HLOD_CELL_SIZE), (int32)Math::Floor(center.Z / HLOD_CELL_SIZE));
+        cells[cell].Add(actor);
+    }
+
+    // Build proxy model for each cluster (reuse existing asset ids to keep references valid across the rebuilds)
+    const String sceneDataFolderPath = _scene->GetDataFolderPath();
+    Array<Cluster> clusters;
+    for (auto& cell : cells)
+    {
+        const auto& cellActors = cell.Value;
+        if (cellActors.Count() < HLOD_MIN_ACTORS)
+            continue;
+        BoundingBox bounds = cellActors[0]->GetBox();
+        for (int32 i = 1; i < cellActors.Count(); i++)
+            BoundingBox::Merge(bounds, cellActors[i]->GetBox(), bounds);
+        const Vector3 origin = bounds.GetCenter();
+
+        PROFILE_CPU_NAMED("Build Cluster");
+        ModelData modelData;
+        modelData.LODs.Resize(1);
+        Dictionary<Guid, int32> materialToMesh;
+        DrawPass drawModes = DrawPass::None;
+        bool failed = false;
+        for (StaticModel* actor : cellActors)
+        {
+            failed |= MergeMeshes(actor, origin, modelData, materialToMesh);
+            drawModes |= actor->DrawModes;
+        }
+        if (failed || modelData.LODs[0].Meshes.IsEmpty())
+            continue;
+#if COMPILE_WITH_MODEL_TOOL
+        for (MeshData* mesh : modelData.LODs[0].Meshes)
+            ModelTool::SimplifyMesh(*mesh, HLOD_TRIANGLE_REDUCTION, HLOD_TARGET_ERROR);
+#endif
+
+        const int32 clusterIndex = clusters.Count();
+        Guid proxyId = clusterIndex < Clusters.Count() ? Clusters[clusterIndex].Proxy.GetID() : Guid::Empty;
+        if (!proxyId.IsValid())
+            proxyId = Guid::New();
+        const String proxyPath = sceneDataFolderPath / String::Format(TEXT("HLOD_{0}"), clusterIndex) + ASSET_FILES_EXTENSION_WITH_DOT;
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateModelTag, proxyPath, proxyId, &modelData))
+        {
+            LOG(Warning, "Failed to import HLOD proxy model");
+            return true;
+        }
+
+        auto& cluster = clusters.AddOne();
+        cluster.Bounds = bounds;
+        cluster.Origin = origin;
+        cluster.Distance = Math::Max(HLOD_MIN_DISTANCE, (float)bounds.GetSize().Length() * 0.5f * HLOD_DISTANCE_SCALE);
+        cluster.DrawModes = drawModes;
+        cluster.Proxy = proxyId;
+        cluster.Actors.EnsureCapacity(cellActors.Count());
+        for (StaticModel* actor : cellActors)
+            cluster.Actors.Add(actor->GetID());
+    }
+    Swap(Clusters, clusters);
+    BuildTime = DateTime::NowUTC();
+    _scene->Rendering.SetHLOD(this);
+
+    const auto endTime = DateTime::NowUTC();
+    LOG(Info, "HLOD build for scene {0} in {1} ms ({2} clusters, {3} static models)", _scene->GetName(), (int32)(endTime - startTime).GetTotalMilliseconds(), Clusters.Count(), actors.Count());
+    return false;
+#else
+    LOG(Warning, "HLOD building is not supported on this platform.");
+    return true;
+#endif
+}
+
+#endif
+
+void SceneHLODData::Serialize(SerializeStream& stream, const void* otherObj)
+{
+    stream.JKEY("Clusters");
+    stream.StartArray();
+    for (const Cluster& cluster : Clusters)
+    {
+        stream.StartObject();
+        stream.JKEY("Bounds");
+        stream.BoundingBox(cluster.Bounds);
+        stream.JKEY("Origin");
+        stream.Vector3(cluster.Origin);
+        stream.JKEY("Distance");
+        stream.Float(cluster.Distance);
+        stream.JKEY("DrawModes");
+        stream.Enum(cluster.DrawModes);
+        stream.JKEY("Proxy");
+        stream.Guid(cluster.Proxy.GetID());
+        stream.JKEY("Actors");
+        stream.StartArray();
+        for (const Guid& id : cluster.Actors)
+            stream.Guid(id);
+        stream.EndArray();
+        stream.EndObject();
+    }
+    stream.EndArray();
+}
+
+void SceneHLODData::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
+{
+    Clusters.Clear();
+    const auto clusters = SERIALIZE_FIND_MEMBER(stream, "Clusters");
+    if (clusters == stream.MemberEnd() || !clusters->value.IsArray())
+        return;
+    Clusters.Resize(clusters->value.Size());
+    for (rapidjson::SizeType i = 0; i < clusters->value.Size(); i++)
+    {
+        Cluster& cluster = Clusters[i];
+        cluster.Bounds = BoundingBox::Zero;
+        cluster.Origin = Vector3::Zero;
+        cluster.Distance = 0.0f;
+        cluster.DrawModes = DrawPass::Default;
+        cluster.DrawState = GeometryDrawStateData();
+        cluster.Actors.Clear();
+        DeserializeCluster(clusters->value[i], cluster, modifier);
+    }
+}
+
+void SceneHLODData::DeserializeCluster(DeserializeStream& stream, Cluster& cluster, ISerializeModifier* modifier)
+{
+    if (!stream.IsObject())
+        return;
+    DESERIALIZE_MEMBER(Bounds, cluster.Bounds);
+    DESERIALIZE_MEMBER(Origin, cluster.Origin);
+    DESERIALIZE_MEMBER(Distance, cluster.Distance);
+    DESERIALIZE_MEMBER(DrawModes, cluster.DrawModes);
+    DESERIALIZE_MEMBER(Proxy, cluster.Proxy);
+    const auto actors = SERIALIZE_FIND_MEMBER(stream, "Actors");
+    if (actors != stream.MemberEnd() && actors->value.IsArray())
+    {
+        cluster.Actors.Resize(actors->value.Size());
+        for (rapidjson::SizeType i = 0; i < actors->value.Size(); i++)
+            Serialization::Deserialize(actors->value[i], cluster.Actors[i], modifier);
+    }
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Content/AssetReference.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Graphics/Models/ModelInstanceEntry.h"
+#include "Engine/Renderer/DrawCall.h"
+
+class Scene;
+
+/// <summary>
+/// Hierarchical LOD (HLOD) data container (used per scene). Contains the clusters of nearby static models that are replaced with a single merged and simplified proxy model when viewed from the distance.
+/// </summary>
+class FLAXENGINE_API SceneHLODData : public ISerializable
+{
+public:
+    /// <summary>
+    /// The cluster of static models drawn with a single proxy model beyond the distance.
+    /// </summary>
+    struct Cluster
+    {
+        /// <summary>
+        /// The world-space bounds of the cluster actors.
+        /// </summary>
+        BoundingBox Bounds;
+
+        /// <summary>
+        /// The world-space origin of the proxy model geometry (proxy vertices are stored relative to it).
+        /// </summary>
+        Vector3 Origin;
+
+        /// <summary>
+        /// The minimum distance from the view to the cluster bounds to draw the proxy model instead of the cluster actors.
+        /// </summary>
+        float Distance;
+
+        /// <summary>
+        /// The draw passes of the proxy model (combined from the cluster actors).
+        /// </summary>
+        DrawPass DrawModes;
+
+        /// <summary>
+        /// The proxy model (merged and simplified geometry of the cluster actors).
+        /// </summary>
+        AssetReference<Model> Proxy;
+
+        /// <summary>
+        /// The cluster actors (identifiers of the static models replaced by the proxy).
+        /// </summary>
+        Array<Guid> Actors;
+
+        // Runtime drawing state of the proxy model
+        ModelInstanceEntries Entries;
+        GeometryDrawStateData DrawState;
+    };
+
+private:
+    Scene* _scene;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SceneHLODData"/> class.
+    /// </summary>
+    /// <param name="scene">The parent scene.</param>
+    SceneHLODData(Scene* scene);
+
+public:
+    /// <summary>
+    /// HLOD building action time (in UTC format). Invalid if not build by active engine instance.
+    /// </summary>
+    DateTime BuildTime;
+
+    /// <summary>
+    /// The HLOD clusters.
+    /// </summary>
+    Array<Cluster> Clusters;
+
+public:
+    /// <summary>
+    /// Determines whether this container has HLOD data.
+    /// </summary>
+    bool HasData() const;
+
+    /// <summary>
+    /// Removes all clusters.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Checks if the cluster proxy model should be drawn instead of the cluster actors for the given view.
+    /// </summary>
+    /// <param name="cluster">The cluster.</param>
+    /// <param name="view">The view used for the LOD selection (in space relative to view origin).</param>
+    /// <returns>True if the proxy model should be drawn, otherwise false.</returns>
+    static bool IsProxyActive(const Cluster& cluster, const struct RenderView& view);
+
+#if USE_EDITOR
+    /// <summary>
+    /// Builds the HLOD clusters for the scene. Groups nearby static models into grid cells, merges their geometry (the lowest LOD of each model) per material and simplifies it into the proxy model assets saved in the scene data folder.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Build();
+#endif
+
+private:
+    static void DeserializeCluster(DeserializeStream& stream, Cluster& cluster, ISerializeModifier* modifier);
+
+public:
+    // [ISerializable]
+    void Serialize(SerializeStream& stream, const void* otherObj) override;
+    void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+};
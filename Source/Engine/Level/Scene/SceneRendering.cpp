@@ -3,12 +3,20 @@
 #define SCENE_RENDERING_USE_PROFILER_PER_ACTOR 0
 
 #include "SceneRendering.h"
+#include "SceneHLODData.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderView.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/HZBOcclusion.h"
 #include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Core/SIMD.h"
+
+// The amount of actors processed at once by the draw job (culled in SIMD batches)
+#define DRAW_ACTORS_BLOCK_SIZE 64
 
 ISceneRenderingListener::~ISceneRenderingListener()
 {
@@ -27,11 +35,11 @@ void ISceneRenderingListener::ListenSceneRendering(SceneRendering* scene)
     }
 }
 
-FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<BoundingFrustum>& frustums)
+FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<BoundingFrustum>& frustums, int32 start = 0)
 {
     const int32 count = frustums.Count();
     const BoundingFrustum* data = frustums.Get();
-    for (int32 i = 0; i < count; i++)
+    for (int32 i = start; i < count; i++)
     {
         if (data[i].Intersects(bounds))
             return true;
@@ -39,6 +47,65 @@ FORCE_INLINE bool FrustumsListCull(const BoundingSphere& bounds, const Array<Bou
     return false;
 }
 
+FORCE_INLINE bool UseStaticTree(const SceneRendering::DrawActor& e)
+{
+    return !e.NoCulling && e.Actor->HasStaticFlag(StaticFlags::Transform);
+}
+
+// Tests spheres (in SoA layout, relative to the view origin) against planes of all frustums (6 planes per frustum). Outputs visibility bitmask per sphere (bit N is set if sphere is visible in view N, views above 63 share the last bit).
+void CullSpheres(const float* centerX, const float* centerY, const float* centerZ, const float* radius, int32 count, const Float4* planes, int32 frustumsCount, uint64* masks)
+{
+    int32 i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const SimdVector4 x = SIMD::LoadUnaligned(centerX + i);
+        const SimdVector4 y = SIMD::LoadUnaligned(centerY + i);
+        const SimdVector4 z = SIMD::LoadUnaligned(centerZ + i);
+        const SimdVector4 r = SIMD::Sub(SIMD::Splat(0.0f), SIMD::LoadUnaligned(radius + i));
+        uint64 mask0 = 0, mask1 = 0, mask2 = 0, mask3 = 0;
+        for (int32 frustumIndex = 0; frustumIndex < frustumsCount; frustumIndex++)
+        {
+            const Float4* frustumPlanes = planes + frustumIndex * 6;
+            SimdVector4 outside = SIMD::Splat(0.0f);
+            for (int32 planeIndex = 0; planeIndex < 6; planeIndex++)
+            {
+                const Float4& plane = frustumPlanes[planeIndex];
+                SimdVector4 distance = SIMD::Mul(x, SIMD::Splat(plane.X));
+                distance = SIMD::Add(distance, SIMD::Mul(y, SIMD::Splat(plane.Y)));
+                distance = SIMD::Add(distance, SIMD::Mul(z, SIMD::Splat(plane.Z)));
+                distance = SIMD::Add(distance, SIMD::Splat(plane.W));
+                outside = SIMD::Or(outside, SIMD::Less(distance, r));
+            }
+            const int32 visible = ~SIMD::MoveMask(outside);
+            const uint64 bit = 1ull << Math::Min(frustumIndex, 63);
+            mask0 |= visible & 1 ? bit : 0;
+            mask1 |= visible & 2 ? bit : 0;
+            mask2 |= visible & 4 ? bit : 0;
+            mask3 |= visible & 8 ? bit : 0;
+        }
+        masks[i + 0] = mask0;
+        masks[i + 1] = mask1;
+        masks[i + 2] = mask2;
+        masks[i + 3] = mask3;
+    }
+    for (; i < count; i++)
+    {
+        uint64 mask = 0;
+        for (int32 frustumIndex = 0; frustumIndex < frustumsCount; frustumIndex++)
+        {
+            const Float4* frustumPlanes = planes + frustumIndex * 6;
+            bool visible = true;
+            for (int32 planeIndex = 0; planeIndex < 6 && visible; planeIndex++)
+            {
+                const Float4& plane = frustumPlanes[planeIndex];
+                visible = centerX[i] * plane.X + centerY[i] * plane.Y + centerZ[i] * plane.Z + plane.W >= -radius[i];
+            }
+            mask |= visible ? 1ull << Math::Min(frustumIndex, 63) : 0;
+        }
+        masks[i] = mask;
+    }
+}
+
 void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory category)
 {
     ScopeLock lock(Locker);
@@ -56,17 +123,50 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
         // Release additional lock
         Locker.Unlock();
     }
+    if (category == SceneDrawAsync && _instancingEnabled != Graphics::EnableAutoInstancing)
+    {
+        // Move actors between instancing clusters and regular culling lists
+        PROFILE_CPU_NAMED("Update Auto Instancing");
+        _instancingEnabled = Graphics::EnableAutoInstancing;
+        auto& actors = Actors[(int32)category];
+        for (int32 key = 0; key < actors.Count(); key++)
+        {
+            auto& e = actors.Get()[key];
+            if (e.Actor)
+            {
+                RemoveDrawActor(e, category);
+                AddDrawActor(e, category, key);
+            }
+        }
+    }
     auto& view = renderContextBatch.GetMainContext().View;
     auto& list = Actors[(int32)category];
     _drawListData = list.Get();
-    _drawListSize = list.Count();
     _drawBatch = &renderContextBatch;
+    _drawOcclusion = category == SceneDraw || category == SceneDrawAsync ? view.Occlusion : nullptr;
 
     // Setup frustum data
     const int32 frustumsCount = renderContextBatch.Contexts.Count();
     _drawFrustumsData.Resize(frustumsCount);
+    _drawFrustumsPlanes.Resize(frustumsCount * 6);
     for (int32 i = 0; i < frustumsCount; i++)
-        _drawFrustumsData.Get()[i] = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
+    {
+        const BoundingFrustum& frustum = renderContextBatch.Contexts.Get()[i].View.CullingFrustum;
+        _drawFrustumsData.Get()[i] = frustum;
+        for (int32 planeIndex = 0; planeIndex < 6; planeIndex++)
+        {
+            const Plane plane = frustum.GetPlane(planeIndex);
+            _drawFrustumsPlanes.Get()[i * 6 + planeIndex] = Float4(plane.Normal, (float)plane.D);
+        }
+    }
+
+    // Collect actors to draw (dynamic actors go first and use SIMD culling, static actors are pre-culled hierarchically and get precise culling within draw job)
+    auto& dynamicActors = _dynamicActors[(int32)category];
+    _drawDynamicList = &dynamicActors;
+    _drawListKeys.Clear();
+    _drawListKeys.Add(dynamicActors.Keys);
+    _staticTree[(int32)category].Query(_drawFrustumsData, view.Origin, _drawListKeys);
+    _drawListSize = _drawListKeys.Count();
 
     // Draw all visual components
     _drawListIndex = -1;
@@ -83,6 +183,16 @@ void SceneRendering::Draw(RenderContextBatch& renderContextBatch, DrawCategory c
         // Scene is small so draw on a main-thread
         DrawActorsJob(0);
     }
+    if (category == SceneDrawAsync && _instancing.GetInstancesCount() != 0)
+    {
+        // Draw clusters of the instanced static models
+        _instancing.Draw(renderContextBatch, _drawFrustumsData, _drawOcclusion);
+    }
+    if (category == SceneDraw && _hlod && !renderContextBatch.EnableGPUDriven)
+    {
+        // Draw proxy models of the distant HLOD clusters (cluster actors are skipped in the SceneDrawAsync category)
+        DrawHLOD(renderContextBatch);
+    }
 
 #if USE_EDITOR
     if (EnumHasAnyFlags(view.Pass, DrawPass::GBuffer) && category == SceneDraw)
@@ -132,11 +242,53 @@ void SceneRendering::Clear()
     _listeners.Clear();
     for (auto& e : Actors)
         e.Clear();
+    for (auto& e : _staticTree)
+        e.Clear();
+    for (auto& e : _dynamicActors)
+        e.Clear();
+    _instancing.Clear();
+    _hlod = nullptr;
+    _hlodActors.Clear();
 #if USE_EDITOR
     PhysicsDebug.Clear();
 #endif
 }
 
+void SceneRendering::SetHLOD(SceneHLODData* data)
+{
+    ScopeLock lock(Locker);
+    _hlod = data && data->HasData() ? data : nullptr;
+    _hlodActors.Clear();
+    if (_hlod)
+    {
+        for (int32 clusterIndex = 0; clusterIndex < _hlod->Clusters.Count(); clusterIndex++)
+        {
+            for (const Guid& id : _hlod->Clusters[clusterIndex].Actors)
+                _hlodActors[id] = clusterIndex;
+        }
+    }
+
+    // Update existing actors (cluster actors are not instanced to be skipped when proxy is drawn)
+    for (int32 category = 0; category < MAX; category++)
+    {
+        auto& list = Actors[category];
+        for (int32 key = 0; key < list.Count(); key++)
+        {
+            auto& e = list.Get()[key];
+            if (!e.Actor)
+                continue;
+            int32 cluster = -1;
+            _hlodActors.TryGet(e.Actor->GetID(), cluster);
+            if (cluster != e.HLODCluster)
+            {
+                RemoveDrawActor(e, category);
+                e.HLODCluster = cluster;
+                AddDrawActor(e, category, key);
+            }
+        }
+    }
+}
+
 void SceneRendering::AddActor(Actor* a, int32& key)
 {
     if (key != -1)
@@ -158,6 +310,9 @@ void SceneRendering::AddActor(Actor* a, int32& key)
     e.LayerMask = a->GetLayerMask();
     e.Bounds = a->GetSphere();
     e.NoCulling = a->_drawNoCulling;
+    e.HLODCluster = -1;
+    _hlodActors.TryGet(a->GetID(), e.HLODCluster);
+    AddDrawActor(e, category, key);
     for (auto* listener : _listeners)
         listener->OnSceneRenderingAddActor(a);
 }
@@ -176,6 +331,20 @@ void SceneRendering::UpdateActor(Actor* a, int32& key)
             listener->OnSceneRenderingUpdateActor(a, e.Bounds);
         e.LayerMask = a->GetLayerMask();
         e.Bounds = a->GetSphere();
+        if (e.InstanceIndex != -1 || CanUseInstancing(e, category) || UseStaticTree(e) != (e.TreeLeaf != -1))
+        {
+            // Static flags changed so move actor between static and dynamic lists (instanced actors are moved to the cluster matching the new state)
+            RemoveDrawActor(e, category);
+            AddDrawActor(e, category, key);
+        }
+        else if (e.TreeLeaf != -1)
+        {
+            _staticTree[category].Update(e.TreeLeaf, e.Bounds);
+        }
+        else if (e.DynamicIndex != -1)
+        {
+            _dynamicActors[category].Set(e.DynamicIndex, e.Bounds);
+        }
     }
 }
 
@@ -191,6 +360,7 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
         {
             for (auto* listener : _listeners)
                 listener->OnSceneRenderingRemoveActor(a);
+            RemoveDrawActor(e, category);
             e.Actor = nullptr;
             e.LayerMask = 0;
         }
@@ -198,9 +368,102 @@ void SceneRendering::RemoveActor(Actor* a, int32& key)
     key = -1;
 }
 
-#define FOR_EACH_BATCH_ACTOR const int64 count = _drawListSize; while (true) { const int64 index = Platform::InterlockedIncrement(&_drawListIndex); if (index >= count) break; auto e = _drawListData[index];
-#define CHECK_ACTOR ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || FrustumsListCull(e.Bounds, _drawFrustumsData)))
-#define CHECK_ACTOR_SINGLE_FRUSTUM ((view.RenderLayersMask.Mask & e.LayerMask) && (e.NoCulling || view.CullingFrustum.Intersects(e.Bounds)))
+bool SceneRendering::CanUseInstancing(const DrawActor& e, int32 category) const
+{
+    return _instancingEnabled && category == SceneDrawAsync && !e.NoCulling && e.HLODCluster == -1 && SceneRenderingInstancing::CanInstance(e.Actor);
+}
+
+void SceneRendering::AddDrawActor(DrawActor& e, int32 category, int32 key)
+{
+    e.InstanceIndex = CanUseInstancing(e, category) ? _instancing.Add(e.Actor, e.Bounds, e.LayerMask) : -1;
+    if (e.InstanceIndex != -1)
+    {
+        e.TreeLeaf = -1;
+        e.DynamicIndex = -1;
+    }
+    else if (UseStaticTree(e))
+    {
+        e.TreeLeaf = _staticTree[category].Add(e.Bounds, key);
+        e.DynamicIndex = -1;
+    }
+    else
+    {
+        e.TreeLeaf = -1;
+        e.DynamicIndex = _dynamicActors[category].Add(key, e.Bounds);
+    }
+}
+
+void SceneRendering::RemoveDrawActor(DrawActor& e, int32 category)
+{
+    if (e.InstanceIndex != -1)
+    {
+        _instancing.Remove(e.InstanceIndex);
+    }
+    else if (e.TreeLeaf != -1)
+    {
+        _staticTree[category].Remove(e.TreeLeaf);
+    }
+    else if (e.DynamicIndex != -1)
+    {
+        const int32 movedKey = _dynamicActors[category].RemoveAt(e.DynamicIndex);
+        if (movedKey != -1)
+            Actors[category][movedKey].DynamicIndex = e.DynamicIndex;
+    }
+    e.TreeLeaf = -1;
+    e.DynamicIndex = -1;
+    e.InstanceIndex = -1;
+}
+
+int32 SceneRendering::DynamicActorsList::Add(int32 key, const BoundingSphere& bounds)
+{
+    const int32 index = Keys.Count();
+    Keys.Add(key);
+    CenterX.AddOne();
+    CenterY.AddOne();
+    CenterZ.AddOne();
+    Radius.AddOne();
+    Set(index, bounds);
+    return index;
+}
+
+void SceneRendering::DynamicActorsList::Set(int32 index, const BoundingSphere& bounds)
+{
+    CenterX.Get()[index] = bounds.Center.X;
+    CenterY.Get()[index] = bounds.Center.Y;
+    CenterZ.Get()[index] = bounds.Center.Z;
+    Radius.Get()[index] = (float)bounds.Radius;
+}
+
+int32 SceneRendering::DynamicActorsList::RemoveAt(int32 index)
+{
+    const int32 last = Keys.Count() - 1;
+    int32 movedKey = -1;
+    if (index != last)
+    {
+        movedKey = Keys.Get()[last];
+        Keys.Get()[index] = movedKey;
+        CenterX.Get()[index] = CenterX.Get()[last];
+        CenterY.Get()[index] = CenterY.Get()[last];
+        CenterZ.Get()[index] = CenterZ.Get()[last];
+        Radius.Get()[index] = Radius.Get()[last];
+    }
+    Keys.RemoveLast();
+    CenterX.RemoveLast();
+    CenterY.RemoveLast();
+    CenterZ.RemoveLast();
+    Radius.RemoveLast();
+    return movedKey;
+}
+
+void SceneRendering::DynamicActorsList::Clear()
+{
+    Keys.Clear();
+    CenterX.Clear();
+    CenterY.Clear();
+    CenterZ.Clear();
+    Radius.Clear();
+}
+
 #if SCENE_RENDERING_USE_PROFILER_PER_ACTOR
 #define DRAW_ACTOR(mode) PROFILE_CPU_ACTOR(e.Actor); e.Actor->Draw(mode)
 #else
@@ -212,43 +475,73 @@ void SceneRendering::DrawActorsJob(int32)
     PROFILE_CPU();
     auto& mainContext = _drawBatch->GetMainContext();
     const auto& view = mainContext.View;
-    if (view.IsOfflinePass)
+    const bool useMainContext = !view.IsOfflinePass && _drawFrustumsData.Count() == 1;
+    const int64 count = _drawListSize;
+    const int32* keys = _drawListKeys.Get();
+    const HZBOcclusion* occlusion = _drawOcclusion;
+    const DynamicActorsList& dynamicList = *_drawDynamicList;
+    const SceneHLODData::Cluster* hlodClusters = _hlod && !_drawBatch->EnableGPUDriven ? _hlod->Clusters.Get() : nullptr;
+    const RenderView& lodView = mainContext.LodProxyView ? *mainContext.LodProxyView : view;
+    const int32 dynamicCount = dynamicList.Count();
+    uint64 masks[DRAW_ACTORS_BLOCK_SIZE];
+    float centerX[DRAW_ACTORS_BLOCK_SIZE], centerY[DRAW_ACTORS_BLOCK_SIZE], centerZ[DRAW_ACTORS_BLOCK_SIZE];
+    while (true)
     {
-        // Offline pass with additional static flags culling
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) != StaticFlags::None)
+        const int64 block = Platform::InterlockedIncrement(&_drawListIndex);
+        const int32 start = (int32)(block * DRAW_ACTORS_BLOCK_SIZE);
+        if (start >= count)
+            break;
+        const int32 end = (int32)Math::Min<int64>(start + DRAW_ACTORS_BLOCK_SIZE, count);
+
+        // Batch-cull dynamic actors (stored first in the draw list with the same order as in SoA bounds list)
+        if (start < dynamicCount)
+        {
+            const int32 cullCount = Math::Min(end, dynamicCount) - start;
+            for (int32 i = 0; i < cullCount; i++)
             {
-                DRAW_ACTOR(*_drawBatch);
+                // Move bounds into the view-relative space to keep the precision in large worlds
+                centerX[i] = (float)(dynamicList.CenterX.Get()[start + i] - view.Origin.X);
+                centerY[i] = (float)(dynamicList.CenterY.Get()[start + i] - view.Origin.Y);
+                centerZ[i] = (float)(dynamicList.CenterZ.Get()[start + i] - view.Origin.Z);
             }
+            CullSpheres(centerX, centerY, centerZ, dynamicList.Radius.Get() + start, cullCount, _drawFrustumsPlanes.Get(), _drawFrustumsData.Count(), masks);
         }
-    }
-    else if (view.Origin.IsZero() && _drawFrustumsData.Count() == 1)
-    {
-        // Fast path for no origin shifting with a single context
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR_SINGLE_FRUSTUM)
+
+        for (int32 index = start; index < end; index++)
+        {
+            const DrawActor& e = _drawListData[keys[index]];
+            if (!(view.RenderLayersMask.Mask & e.LayerMask))
+                continue;
+            if (!e.NoCulling)
             {
-                DRAW_ACTOR(mainContext);
+                // Occlusion culling is done against the main view only (skip actors that are visible in other views, eg. shadow projections)
+                if (index < dynamicCount)
+                {
+                    const uint64 mask = masks[index - start];
+                    if (mask == 0)
+                        continue;
+                    if (occlusion && (mask & ~1ull) == 0 && occlusion->IsOccluded(e.Bounds))
+                        continue;
+                }
+                else
+                {
+                    BoundingSphere bounds = e.Bounds;
+                    bounds.Center -= view.Origin;
+                    if (!FrustumsListCull(bounds, _drawFrustumsData))
+                        continue;
+                    if (occlusion && occlusion->IsOccluded(e.Bounds) && !FrustumsListCull(bounds, _drawFrustumsData, 1))
+                        continue;
+                }
             }
-        }
-    }
-    else if (view.Origin.IsZero())
-    {
-        // Fast path for no origin shifting
-        FOR_EACH_BATCH_ACTOR
-            if (CHECK_ACTOR)
+            if (view.IsOfflinePass && (e.Actor->GetStaticFlags() & view.StaticFlagsMask) == StaticFlags::None)
+                continue;
+            if (e.HLODCluster != -1 && hlodClusters && SceneHLODData::IsProxyActive(hlodClusters[e.HLODCluster], lodView))
+                continue;
+            if (useMainContext)
             {
-                DRAW_ACTOR(*_drawBatch);
+                DRAW_ACTOR(mainContext);
             }
-        }
-    }
-    else
-    {
-        // Generic case
-        FOR_EACH_BATCH_ACTOR
-            e.Bounds.Center -= view.Origin;
-            if (CHECK_ACTOR)
+            else
             {
                 DRAW_ACTOR(*_drawBatch);
             }
@@ -256,6 +549,48 @@ void SceneRendering::DrawActorsJob(int32)
     }
 }
 
-#undef FOR_EACH_BATCH_ACTOR
-#undef CHECK_ACTOR
 #undef DRAW_ACTOR
+
+void SceneRendering::DrawHLOD(RenderContextBatch& renderContextBatch)
+{
+    PROFILE_CPU();
+    const RenderContext& renderContext = renderContextBatch.GetMainContext();
+    const RenderView& view = renderContext.View;
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+    for (auto& cluster : _hlod->Clusters)
+    {
+        if (!SceneHLODData::IsProxyActive(cluster, lodView))
+            continue;
+        BoundingSphere bounds;
+        BoundingSphere::FromBox(cluster.Bounds, bounds);
+        if (_drawOcclusion && _drawOcclusion->IsOccluded(bounds) && !FrustumsListCull(BoundingSphere(bounds.Center - view.Origin, bounds.Radius), _drawFrustumsData, 1))
+            continue;
+        bounds.Center -= view.Origin;
+        if (!FrustumsListCull(bounds, _drawFrustumsData))
+            continue;
+        Model* proxy = cluster.Proxy.Get();
+        cluster.Entries.SetupIfInvalid(proxy);
+        Matrix world;
+        Matrix::Translation((Float3)(cluster.Origin - view.Origin), world);
+        GEOMETRY_DRAW_STATE_EVENT_BEGIN(cluster.DrawState, world);
+
+        Mesh::DrawInfo draw;
+        draw.Buffer = &cluster.Entries;
+        draw.World = &world;
+        draw.DrawState = &cluster.DrawState;
+        draw.Deformation = nullptr;
+        draw.Lightmap = nullptr;
+        draw.LightmapUVs = nullptr;
+        draw.Flags = StaticFlags::FullyStatic & ~StaticFlags::Lightmap;
+        draw.DrawModes = cluster.DrawModes;
+        draw.Bounds = bounds;
+        draw.PerInstanceRandom = 0.0f;
+        draw.LODBias = 0;
+        draw.ForcedLOD = -1;
+        draw.SortOrder = 0;
+        draw.VertexColors = nullptr;
+        proxy->Draw(renderContextBatch, draw);
+
+        GEOMETRY_DRAW_STATE_EVENT_END(cluster.DrawState, world);
+    }
+}
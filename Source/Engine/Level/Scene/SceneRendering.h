@@ -4,13 +4,18 @@
 
 #include "Engine/Core/Delegate.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Math/BoundingSphere.h"
 #include "Engine/Core/Math/BoundingFrustum.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "SceneRenderingTree.h"
+#include "SceneRenderingInstancing.h"
 
 class SceneRenderTask;
 class SceneRendering;
+class HZBOcclusion;
+class SceneHLODData;
 struct PostProcessSettings;
 struct RenderContext;
 struct RenderContextBatch;
@@ -75,6 +80,14 @@ class FLAXENGINE_API SceneRendering
         uint32 LayerMask;
         int8 NoCulling : 1;
         BoundingSphere Bounds;
+        // Index of the leaf in the static actors tree (-1 if actor is dynamic and uses linear culling).
+        int32 TreeLeaf;
+        // Index in the dynamic actors list (-1 if actor is static and uses hierarchical culling).
+        int32 DynamicIndex;
+        // Index of the instance in the auto-instancing clusters (-1 if actor is drawn separately).
+        int32 InstanceIndex;
+        // Index of the HLOD cluster that contains this actor (-1 if actor is not a part of any cluster).
+        int32 HLODCluster;
     };
 
     /// <summary>
@@ -104,6 +117,39 @@ class FLAXENGINE_API SceneRendering
     friend ISceneRenderingListener;
     Array<ISceneRenderingListener*, InlinedAllocation<8>> _listeners;
 
+    // List of dynamic actors with SoA copy of their bounds (indexed by DrawActor::DynamicIndex) for SIMD culling (centers are in world-space, converted to the view-relative floats before culling)
+    struct DynamicActorsList
+    {
+        Array<int32> Keys;
+        Array<Real> CenterX;
+        Array<Real> CenterY;
+        Array<Real> CenterZ;
+        Array<float> Radius;
+
+        FORCE_INLINE int32 Count() const
+        {
+            return Keys.Count();
+        }
+
+        int32 Add(int32 key, const BoundingSphere& bounds);
+        void Set(int32 index, const BoundingSphere& bounds);
+        // Removes the item by swapping it with the last one. Returns the key of the moved item or -1.
+        int32 RemoveAt(int32 index);
+        void Clear();
+    };
+
+    // Actors with static transform are culled hierarchically via BVH, others are culled linearly
+    SceneRenderingTree _staticTree[MAX];
+    DynamicActorsList _dynamicActors[MAX];
+
+    // Static models that use the same model and materials are grouped into clusters and drawn with instancing (see Graphics::EnableAutoInstancing)
+    SceneRenderingInstancing _instancing;
+    bool _instancingEnabled = false;
+
+    // HLOD clusters of static models which are swapped for a single proxy model draw in the distance
+    SceneHLODData* _hlod = nullptr;
+    Dictionary<Guid, int32> _hlodActors;
+
 public:
     /// <summary>
     /// Draws the scene. Performs the optimized actors culling and draw calls submission for the current render pass (defined by the render view).
@@ -123,6 +169,12 @@ class FLAXENGINE_API SceneRendering
     /// </summary>
     void Clear();
 
+    /// <summary>
+    /// Sets the HLOD clusters data used to draw the distant groups of static models with a single proxy model.
+    /// </summary>
+    /// <param name="data">The HLOD data (can be null to disable HLOD).</param>
+    void SetHLOD(SceneHLODData* data);
+
 public:
     void AddActor(Actor* a, int32& key);
     void UpdateActor(Actor* a, int32& key);
@@ -184,10 +236,18 @@ class FLAXENGINE_API SceneRendering
 
 private:
     Array<BoundingFrustum> _drawFrustumsData;
+    Array<Float4> _drawFrustumsPlanes;
+    Array<int32> _drawListKeys;
     DrawActor* _drawListData;
+    DynamicActorsList* _drawDynamicList;
     int64 _drawListSize;
     volatile int64 _drawListIndex;
     RenderContextBatch* _drawBatch;
+    const HZBOcclusion* _drawOcclusion;
 
+    bool CanUseInstancing(const DrawActor& e, int32 category) const;
+    void AddDrawActor(DrawActor& e, int32 category, int32 key);
+    void RemoveDrawActor(DrawActor& e, int32 category);
     void DrawActorsJob(int32);
+    void DrawHLOD(RenderContextBatch& renderContextBatch);
 };
@@ -0,0 +1,577 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneRenderingInstancing.h"
+#include "Scene.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/RenderView.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/HZBOcclusion.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The size of the grid cell used to group instances into clusters (in world units)
+#define INSTANCING_CELL_SIZE 4000.0f
+
+// The maximum amount of instances in a single cluster (cell gets more clusters if it's full)
+#define INSTANCING_CLUSTER_CAPACITY 128
+
+// The minimum amount of visible clusters to draw them via Job System
+#define INSTANCING_ASYNC_THRESHOLD 8
+
+namespace
+{
+    void DrawInstancesBatch(RenderContext& renderContext, const Mesh& mesh, const ModelInstanceEntry& entry, BatchedDrawCall& batch, DrawPass drawModes)
+    {
+        const InstanceData* instances = batch.GetInstancesData();
+        const int32 instancesCount = batch.GetInstancesCount();
+
+        // Setup draw call
+        mesh.GetDrawCallGeometry(batch.DrawCall);
+        batch.DrawCall.InstanceCount = 1;
+        auto& firstInstance = instances[0];
+        batch.DrawCall.ObjectPosition = firstInstance.InstanceOrigin;
+        batch.DrawCall.PerInstanceRandom = firstInstance.PerInstanceRandom;
+        auto lightmapArea = firstInstance.InstanceLightmapArea.ToFloat4();
+        batch.DrawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+        batch.DrawCall.Surface.LODDitherFactor = 0.0f;
+        batch.DrawCall.World.SetRow1(Float4(firstInstance.InstanceTransform1, 0.0f));
+        batch.DrawCall.World.SetRow2(Float4(firstInstance.InstanceTransform2, 0.0f));
+        batch.DrawCall.World.SetRow3(Float4(firstInstance.InstanceTransform3, 0.0f));
+        batch.DrawCall.World.SetRow4(Float4(firstInstance.InstanceOrigin, 1.0f));
+        batch.DrawCall.Surface.PrevWorld = batch.DrawCall.World;
+        batch.DrawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+        batch.DrawCall.Surface.Skinning = nullptr;
+        batch.DrawCall.WorldDeterminantSign = 1;
+
+        if (EnumHasAnyFlags(drawModes, DrawPass::Forward))
+        {
+            // Transparency requires sorting by depth so convert back the batched draw call into normal draw calls (RenderList impl will handle this)
+            DrawCall drawCall = batch.DrawCall;
+            for (int32 j = 0; j < instancesCount; j++)
+            {
+                auto& instance = instances[j];
+                drawCall.ObjectPosition = instance.InstanceOrigin;
+                drawCall.PerInstanceRandom = instance.PerInstanceRandom;
+                lightmapArea = instance.InstanceLightmapArea.ToFloat4();
+                drawCall.Surface.LightmapUVsArea = *(Rectangle*)&lightmapArea;
+                drawCall.World.SetRow1(Float4(instance.InstanceTransform1, 0.0f));
+                drawCall.World.SetRow2(Float4(instance.InstanceTransform2, 0.0f));
+                drawCall.World.SetRow3(Float4(instance.InstanceTransform3, 0.0f));
+                drawCall.World.SetRow4(Float4(instance.InstanceOrigin, 1.0f));
+                drawCall.Surface.PrevWorld = drawCall.World;
+                const int32 drawCallIndex = renderContext.List->DrawCalls.Add(drawCall);
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(drawCallIndex);
+            }
+        }
+
+        // Add draw call batch
+        const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+
+        // Add draw call to proper draw lists (static objects don't write motion vectors)
+        if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
+        {
+            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+        }
+        if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+        {
+            if (entry.ReceiveDecals)
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+            else
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].PreBatchedDrawCalls.Add(batchIndex);
+        }
+        if (EnumHasAnyFlags(drawModes, DrawPass::Distortion))
+        {
+            renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Distortion].PreBatchedDrawCalls.Add(batchIndex);
+        }
+    }
+}
+
+bool SceneRenderingInstancing::CanInstance(const Actor* a)
+{
+    // Skip types that derive from the static model since they might override drawing
+    if (a->GetTypeHandle() != StaticModel::TypeInitializer)
+        return false;
+    return ((const StaticModel*)a)->CanUseAutoInstancing();
+}
+
+int32 SceneRenderingInstancing::Add(Actor* a, const BoundingSphere& bounds, uint32 layerMask)
+{
+    auto actor = (StaticModel*)a;
+    const int32 group = GetGroup(actor);
+    if (group == -1)
+        return -1;
+    const int32 clusterIndex = GetCluster(group, bounds.Center);
+
+    // Allocate instance
+    int32 index;
+    if (_freeInstance != -1)
+    {
+        index = _freeInstance;
+        _freeInstance = _instances[index].ClusterIndex;
+    }
+    else
+    {
+        index = _instances.Count();
+        _instances.AddOne();
+    }
+    Instance& instance = _instances[index];
+    instance.Actor = actor;
+    instance.Bounds = bounds;
+    instance.WorldTransform = actor->GetTransform();
+    instance.LightmapArea = Half4(actor->Lightmap.UVsArea);
+    instance.PerInstanceRandom = actor->GetPerInstanceRandom();
+    instance.LayerMask = layerMask;
+    instance.Cluster = clusterIndex;
+
+    // Insert into cluster
+    Cluster& cluster = _clusters[clusterIndex];
+    instance.ClusterIndex = cluster.Instances.Count();
+    cluster.Instances.Add(index);
+    if (!cluster.BoundsDirty)
+    {
+        cluster.BoundsDirty = true;
+        _dirtyClusters.Add(clusterIndex);
+    }
+    _instancesCount++;
+    return index;
+}
+
+void SceneRenderingInstancing::Remove(int32 index)
+{
+    Instance& instance = _instances[index];
+    const int32 clusterIndex = instance.Cluster;
+    const int32 slot = instance.ClusterIndex;
+    Cluster& cluster = _clusters[clusterIndex];
+
+    // Remove from cluster by swapping with the last instance
+    const int32 last = cluster.Instances.Last();
+    cluster.Instances[slot] = last;
+    _instances[last].ClusterIndex = slot;
+    cluster.Instances.RemoveLast();
+
+    // Free instance
+    instance.Actor = nullptr;
+    instance.Cluster = -1;
+    instance.ClusterIndex = _freeInstance;
+    _freeInstance = index;
+    _instancesCount--;
+
+    if (cluster.Instances.IsEmpty())
+    {
+        RemoveCluster(clusterIndex);
+    }
+    else if (!cluster.BoundsDirty)
+    {
+        cluster.BoundsDirty = true;
+        _dirtyClusters.Add(clusterIndex);
+    }
+}
+
+void SceneRenderingInstancing::Clear()
+{
+    _instances.Clear();
+    _groups.Clear();
+    _clusters.Clear();
+    _freeGroups.Clear();
+    _freeClusters.Clear();
+    _freeInstance = -1;
+    _instancesCount = 0;
+    _groupsMap.Clear();
+    _clustersMap.Clear();
+    _tree.Clear();
+    _dirtyClusters.Clear();
+    _drawClusters.Clear();
+}
+
+void SceneRenderingInstancing::Draw(RenderContextBatch& renderContextBatch, const Array<BoundingFrustum>& frustums, const HZBOcclusion* occlusion)
+{
+    PROFILE_CPU();
+
+    // Update bounds of the modified clusters
+    for (const int32 clusterIndex : _dirtyClusters)
+    {
+        Cluster& cluster = _clusters[clusterIndex];
+        if (cluster.BoundsDirty && cluster.Group != -1)
+            UpdateBounds(cluster, clusterIndex);
+        cluster.BoundsDirty = false;
+    }
+    _dirtyClusters.Clear();
+    if (_tree.GetLeavesCount() == 0)
+        return;
+
+    // Cull clusters hierarchically
+    const RenderView& view = renderContextBatch.GetMainContext().View;
+    _drawClusters.Clear();
+    _tree.Query(frustums, view.Origin, _drawClusters);
+    if (_drawClusters.IsEmpty())
+        return;
+    _drawBatch = &renderContextBatch;
+    _drawFrustums = &frustums;
+    _drawOcclusion = occlusion;
+
+    // Offline passes, GPU-driven rendering and global passes use the regular per-actor drawing
+    _drawFallback = view.IsOfflinePass || renderContextBatch.EnableGPUDriven || EnumHasAnyFlags(view.Pass, DrawPass::GlobalSDF | DrawPass::GlobalSurfaceAtlas);
+#if USE_EDITOR
+    _drawFallback |= view.Mode == ViewMode::LightmapUVsDensity || view.Mode == ViewMode::LODPreview;
+#endif
+
+    // Draw visible clusters
+    if (_drawClusters.Count() >= INSTANCING_ASYNC_THRESHOLD && renderContextBatch.EnableAsync)
+    {
+        Function<void(int32)> func;
+        func.Bind<SceneRenderingInstancing, &SceneRenderingInstancing::DrawClusterJob>(this);
+        const uint64 waitLabel = JobSystem::Dispatch(func, _drawClusters.Count());
+        renderContextBatch.WaitLabels.Add(waitLabel);
+    }
+    else
+    {
+        for (int32 i = 0; i < _drawClusters.Count(); i++)
+            DrawClusterJob(i);
+    }
+}
+
+uint32 SceneRenderingInstancing::GetEntriesHash(const Array<ModelInstanceEntry>& entries)
+{
+    uint32 hash = (uint32)entries.Count();
+    for (const ModelInstanceEntry& e : entries)
+    {
+        uint32 entryHash = (uint32)((uintptr)e.Material.Get() >> 3);
+        entryHash ^= (uint32)e.ShadowsMode << 16 | (uint32)e.Visible << 24 | (uint32)e.ReceiveDecals << 25;
+        hash ^= entryHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+int32 SceneRenderingInstancing::GetGroup(StaticModel* actor)
+{
+    GroupKey key;
+    key.Model = actor->Model.Get();
+    key.DrawModes = actor->DrawModes;
+    key.LightmapIndex = actor->HasStaticFlag(StaticFlags::Lightmap) && actor->HasLightmap() ? actor->Lightmap.TextureIndex : -1;
+    key.EntriesHash = GetEntriesHash(actor->Entries);
+    int32 index;
+    if (_groupsMap.TryGet(key, index))
+    {
+        // Entries hash collisions are very unlikely so just don't instance such actors
+        const Group& group = _groups[index];
+        if (group.Entries.Count() != actor->Entries.Count())
+            return -1;
+        for (int32 i = 0; i < group.Entries.Count(); i++)
+        {
+            if (group.Entries[i] != actor->Entries[i])
+                return -1;
+        }
+        return index;
+    }
+
+    // Allocate group
+    if (_freeGroups.HasItems())
+    {
+        index = _freeGroups.Pop();
+    }
+    else
+    {
+        index = _groups.Count();
+        _groups.AddOne();
+    }
+    Group& group = _groups[index];
+    group.Model = key.Model;
+    group.DrawModes = key.DrawModes;
+    group.LightmapIndex = key.LightmapIndex;
+    group.EntriesHash = key.EntriesHash;
+    group.Entries = actor->Entries;
+    group.ClustersCount = 0;
+    _groupsMap.Add(key, index);
+    return index;
+}
+
+int32 SceneRenderingInstancing::GetCluster(int32 group, const Vector3& position)
+{
+    ClusterKey key;
+    key.Group = group;
+    key.Cell = Int3((int32)Math::Floor(position.X / INSTANCING_CELL_SIZE), (int32)Math::Floor(position.Y / INSTANCING_CELL_SIZE), (int32)Math::Floor(position.Z / INSTANCING_CELL_SIZE));
+    for (key.Slot = 0;; key.Slot++)
+    {
+        int32 index;
+        if (!_clustersMap.TryGet(key, index))
+            break;
+        if (_clusters[index].Instances.Count() < INSTANCING_CLUSTER_CAPACITY)
+            return index;
+    }
+
+    // Allocate cluster
+    int32 index;
+    if (_freeClusters.HasItems())
+    {
+        index = _freeClusters.Pop();
+    }
+    else
+    {
+        index = _clusters.Count();
+        _clusters.AddOne();
+    }
+    Cluster& cluster = _clusters[index];
+    cluster.Group = group;
+    cluster.Cell = key.Cell;
+    cluster.Slot = key.Slot;
+    cluster.TreeLeaf = -1;
+    cluster.BoundsDirty = false;
+    cluster.Bounds = BoundingBox(position);
+    cluster.Instances.Clear();
+    _clustersMap.Add(key, index);
+    _groups[group].ClustersCount++;
+    return index;
+}
+
+void SceneRenderingInstancing::RemoveCluster(int32 clusterIndex)
+{
+    Cluster& cluster = _clusters[clusterIndex];
+    if (cluster.TreeLeaf != -1)
+        _tree.Remove(cluster.TreeLeaf);
+    ClusterKey clusterKey;
+    clusterKey.Group = cluster.Group;
+    clusterKey.Cell = cluster.Cell;
+    clusterKey.Slot = cluster.Slot;
+    _clustersMap.Remove(clusterKey);
+
+    // Free group if it's not used anymore
+    Group& group = _groups[cluster.Group];
+    if (--group.ClustersCount == 0)
+    {
+        GroupKey groupKey;
+        groupKey.Model = group.Model;
+        groupKey.DrawModes = group.DrawModes;
+        groupKey.LightmapIndex = group.LightmapIndex;
+        groupKey.EntriesHash = group.EntriesHash;
+        _groupsMap.Remove(groupKey);
+        group.Model = nullptr;
+        group.Entries.Resize(0);
+        _freeGroups.Add(cluster.Group);
+    }
+
+    cluster.Group = -1;
+    cluster.TreeLeaf = -1;
+    cluster.Instances.Clear();
+    _freeClusters.Add(clusterIndex);
+}
+
+void SceneRenderingInstancing::UpdateBounds(Cluster& cluster, int32 clusterIndex)
+{
+    BoundingBox::FromSphere(_instances[cluster.Instances[0]].Bounds, cluster.Bounds);
+    for (int32 i = 1; i < cluster.Instances.Count(); i++)
+    {
+        BoundingBox box;
+        BoundingBox::FromSphere(_instances[cluster.Instances[i]].Bounds, box);
+        BoundingBox::Merge(cluster.Bounds, box, cluster.Bounds);
+    }
+    BoundingSphere sphere;
+    BoundingSphere::FromBox(cluster.Bounds, sphere);
+    if (cluster.TreeLeaf == -1)
+        cluster.TreeLeaf = _tree.Add(sphere, clusterIndex);
+    else
+        _tree.Update(cluster.TreeLeaf, sphere);
+}
+
+void SceneRenderingInstancing::DrawClusterJob(int32 i)
+{
+    const Cluster& cluster = _clusters[_drawClusters[i]];
+    if (_drawFallback)
+        DrawClusterFallback(cluster);
+    else
+        DrawCluster(cluster);
+}
+
+void SceneRenderingInstancing::DrawClusterFallback(const Cluster& cluster)
+{
+    auto& mainContext = _drawBatch->GetMainContext();
+    const RenderView& view = mainContext.View;
+    const Array<BoundingFrustum>& frustums = *_drawFrustums;
+    const bool useMainContext = !view.IsOfflinePass && frustums.Count() == 1;
+    for (const int32 instanceIndex : cluster.Instances)
+    {
+        const Instance& instance = _instances[instanceIndex];
+        if (!(view.RenderLayersMask.Mask & instance.LayerMask))
+            continue;
+        BoundingSphere bounds = instance.Bounds;
+        bounds.Center -= view.Origin;
+        int32 frustumIndex = 0;
+        while (frustumIndex < frustums.Count() && !frustums[frustumIndex].Intersects(bounds))
+            frustumIndex++;
+        if (frustumIndex == frustums.Count())
+            continue;
+        if (view.IsOfflinePass && (instance.Actor->GetStaticFlags() & view.StaticFlagsMask) == StaticFlags::None)
+            continue;
+        if (useMainContext)
+            instance.Actor->Draw(mainContext);
+        else
+            instance.Actor->Draw(*_drawBatch);
+    }
+}
+
+void SceneRenderingInstancing::DrawCluster(const Cluster& cluster)
+{
+    const Group& group = _groups[cluster.Group];
+    Model* model = group.Model;
+    if (!model->IsLoaded() || !model->CanBeRendered())
+        return;
+    PROFILE_CPU_ASSET(model);
+    Scene* scene = _instances[cluster.Instances[0]].Actor->GetScene();
+    Lightmap* lightmap = group.LightmapIndex != -1 && scene ? scene->LightmapsData.GetReadyLightmap(group.LightmapIndex) : nullptr;
+
+    // Get the layout of the batches for all LODs meshes
+    int32 meshesStart[MODEL_MAX_LODS];
+    int32 meshesCount = 0;
+    for (int32 lod = 0; lod < model->LODs.Count(); lod++)
+    {
+        meshesStart[lod] = meshesCount;
+        meshesCount += model->LODs[lod].Meshes.Count();
+    }
+    Array<BatchedDrawCall, RendererAllocation> batches;
+    Array<DrawPass, RendererAllocation> batchesDrawModes;
+    Array<float, RendererAllocation> batchesScreenSize;
+    BoundingSphere clusterBounds;
+    BoundingSphere::FromBox(cluster.Bounds, clusterBounds);
+
+    for (int32 contextIndex = 0; contextIndex < _drawBatch->Contexts.Count(); contextIndex++)
+    {
+        RenderContext& renderContext = _drawBatch->Contexts[contextIndex];
+        const RenderView& view = renderContext.View;
+        const DrawPass typeDrawModes = group.DrawModes & view.Pass;
+        if (typeDrawModes == DrawPass::None)
+            continue;
+        BoundingSphere bounds = clusterBounds;
+        bounds.Center -= view.Origin;
+        if (!view.CullingFrustum.Intersects(bounds))
+            continue;
+
+        // Initialize draw calls for all LODs meshes (select material and draw modes)
+        bool anyMaterial = false;
+        batches.Clear();
+        batches.Resize(meshesCount);
+        batchesDrawModes.Resize(meshesCount);
+        for (int32 lod = 0; lod < model->LODs.Count(); lod++)
+        {
+            const auto& meshes = model->LODs[lod].Meshes;
+            for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+            {
+                const Mesh& mesh = meshes.Get()[meshIndex];
+                BatchedDrawCall& batch = batches[meshesStart[lod] + meshIndex];
+                batch.DrawCall.Material = nullptr;
+                const ModelInstanceEntry& entry = group.Entries[mesh.GetMaterialSlotIndex()];
+                if (!entry.Visible || !mesh.IsInitialized())
+                    continue;
+                const MaterialSlot& slot = model->MaterialSlots[mesh.GetMaterialSlotIndex()];
+
+                // Select material
+                MaterialBase* material;
+                if (entry.Material && entry.Material->IsLoaded())
+                    material = entry.Material;
+                else if (slot.Material && slot.Material->IsLoaded())
+                    material = slot.Material;
+                else
+                    material = GPUDevice::Instance->GetDefaultMaterial();
+                if (!material || !material->IsSurface())
+                    continue;
+
+                // Select draw modes
+                const auto shadowsMode = entry.ShadowsMode & slot.ShadowsMode;
+                const auto drawModes = typeDrawModes & view.GetShadowsDrawPassMask(shadowsMode) & material->GetDrawModes();
+                if (drawModes == DrawPass::None)
+                    continue;
+
+                batch.DrawCall.Material = material;
+                batch.DrawCall.ObjectRadius = (float)clusterBounds.Radius;
+                batch.DrawCall.Surface.Lightmap = lightmap;
+                batchesDrawModes[meshesStart[lod] + meshIndex] = drawModes;
+                anyMaterial = true;
+            }
+        }
+        if (!anyMaterial)
+            continue;
+        const bool reportStreaming = contextIndex == 0 && EnumHasAnyFlags(view.Pass, DrawPass::GBuffer);
+        if (reportStreaming)
+        {
+            batchesScreenSize.Resize(meshesCount);
+            Platform::MemoryClear(batchesScreenSize.Get(), meshesCount * sizeof(float));
+        }
+
+        // Cull instances and add them to the batches of their LOD
+        for (const int32 instanceIndex : cluster.Instances)
+        {
+            const Instance& instance = _instances[instanceIndex];
+            if (!(view.RenderLayersMask.Mask & instance.LayerMask))
+                continue;
+            BoundingSphere instanceBounds = instance.Bounds;
+            instanceBounds.Center -= view.Origin;
+            if (!view.CullingFrustum.Intersects(instanceBounds))
+                continue;
+            if (contextIndex == 0 && _drawOcclusion && _drawOcclusion->IsOccluded(instance.Bounds))
+                continue;
+            StaticModel* actor = instance.Actor;
+            if (!actor->CanUseAutoInstancing())
+            {
+                // Actor state changed (eg. vertex colors painted) so draw it separately until it gets updated
+                actor->Draw(renderContext);
+                continue;
+            }
+
+            // Select LOD
+            int32 lodIndex = actor->_forcedLod;
+            if (lodIndex == -1)
+            {
+                lodIndex = RenderTools::ComputeModelLOD(model, instanceBounds.Center, (float)instanceBounds.Radius, renderContext);
+                if (lodIndex == -1)
+                    continue;
+                lodIndex += actor->_lodBias;
+            }
+            lodIndex += view.ModelLODBias;
+            lodIndex = model->ClampLODIndex(lodIndex);
+
+            // Add instance to the batches
+            Matrix world;
+            const Float3 translation = instance.WorldTransform.Translation - view.Origin;
+            Matrix::Transformation(instance.WorldTransform.Scale, instance.WorldTransform.Orientation, translation, world);
+            float screenSize = 0.0f;
+            if (reportStreaming)
+                screenSize = 2.0f * Math::Sqrt(RenderTools::ComputeBoundsScreenRadiusSquared(instanceBounds.Center, (float)instanceBounds.Radius, view)) * view.ScreenSize.Y;
+            const int32 meshesEnd = meshesStart[lodIndex] + model->LODs[lodIndex].Meshes.Count();
+            for (int32 batchIndex = meshesStart[lodIndex]; batchIndex < meshesEnd; batchIndex++)
+            {
+                BatchedDrawCall& batch = batches[batchIndex];
+                if (!batch.DrawCall.Material)
+                    continue;
+                auto& instanceData = batch.Instances.AddOne();
+                instanceData.InstanceOrigin = Float3(world.M41, world.M42, world.M43);
+                instanceData.PerInstanceRandom = instance.PerInstanceRandom;
+                instanceData.InstanceTransform1 = Float3(world.M11, world.M12, world.M13);
+                instanceData.LODDitherFactor = 0.0f;
+                instanceData.InstanceTransform2 = Float3(world.M21, world.M22, world.M23);
+                instanceData.InstanceTransform3 = Float3(world.M31, world.M32, world.M33);
+                instanceData.InstanceLightmapArea = instance.LightmapArea;
+                if (reportStreaming)
+                    batchesScreenSize[batchIndex] = Math::Max(batchesScreenSize[batchIndex], screenSize);
+            }
+        }
+
+        // Submit draw calls with valid instances added
+        for (int32 lod = 0; lod < model->LODs.Count(); lod++)
+        {
+            const auto& meshes = model->LODs[lod].Meshes;
+            for (int32 meshIndex = 0; meshIndex < meshes.Count(); meshIndex++)
+            {
+                const int32 batchIndex = meshesStart[lod] + meshIndex;
+                BatchedDrawCall& batch = batches[batchIndex];
+                if (batch.Instances.IsEmpty())
+                    continue;
+                const Mesh& mesh = meshes.Get()[meshIndex];
+                if (reportStreaming)
+                    ((MaterialBase*)batch.DrawCall.Material)->ReportStreamingFeedback(batchesScreenSize[batchIndex]);
+                DrawInstancesBatch(renderContext, mesh, group.Entries[mesh.GetMaterialSlotIndex()], batch, batchesDrawModes[batchIndex]);
+            }
+        }
+    }
+}
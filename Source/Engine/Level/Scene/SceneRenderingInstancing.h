@@ -0,0 +1,190 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/Half.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Graphics/Enums.h"
+#include "Engine/Graphics/Models/ModelInstanceEntry.h"
+#include "SceneRenderingTree.h"
+
+class Actor;
+class Model;
+class StaticModel;
+class HZBOcclusion;
+struct RenderContextBatch;
+
+/// <summary>
+/// Automatic instancing of the static models used by Scene Rendering. Groups static actors that use the same model, materials and lightmap texture into spatial clusters which are culled hierarchically as a whole and drawn with a single instanced draw call per mesh (similar to the foliage clusters).
+/// </summary>
+/// <remarks>Instances in a cluster draw without LOD transitions (each instance selects its own LOD). Actors that stop being instancable (eg. vertex colors painted or deformation used) are drawn separately until their next update.</remarks>
+class FLAXENGINE_API SceneRenderingInstancing
+{
+public:
+    struct Instance
+    {
+        StaticModel* Actor;
+        BoundingSphere Bounds;
+        Transform WorldTransform;
+        Half4 LightmapArea;
+        float PerInstanceRandom;
+        uint32 LayerMask;
+        // Index of the cluster (-1 for unused entry).
+        int32 Cluster;
+        // Index in the cluster instances list (or the next free entry index for unused entry).
+        int32 ClusterIndex;
+    };
+
+    struct Group
+    {
+        Model* Model;
+        DrawPass DrawModes;
+        int32 LightmapIndex;
+        uint32 EntriesHash;
+        Array<ModelInstanceEntry> Entries;
+        int32 ClustersCount;
+    };
+
+    struct Cluster
+    {
+        int32 Group;
+        Int3 Cell;
+        int32 Slot;
+        int32 TreeLeaf;
+        bool BoundsDirty;
+        BoundingBox Bounds;
+        Array<int32> Instances;
+    };
+
+private:
+    struct GroupKey
+    {
+        Model* Model;
+        DrawPass DrawModes;
+        int32 LightmapIndex;
+        uint32 EntriesHash;
+
+        bool operator==(const GroupKey& other) const
+        {
+            return Model == other.Model && DrawModes == other.DrawModes && LightmapIndex == other.LightmapIndex && EntriesHash == other.EntriesHash;
+        }
+
+        friend uint32 GetHash(const GroupKey& key)
+        {
+            uint32 hash = (uint32)((uintptr)key.Model >> 3);
+            hash ^= (uint32)key.DrawModes + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= (uint32)key.LightmapIndex + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= key.EntriesHash + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            return hash;
+        }
+    };
+
+    struct ClusterKey
+    {
+        int32 Group;
+        Int3 Cell;
+        int32 Slot;
+
+        bool operator==(const ClusterKey& other) const
+        {
+            return Group == other.Group && Cell == other.Cell && Slot == other.Slot;
+        }
+
+        friend uint32 GetHash(const ClusterKey& key)
+        {
+            uint32 hash = (uint32)key.Group;
+            hash ^= (uint32)key.Cell.X * 73856093u + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= (uint32)key.Cell.Y * 19349663u + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= (uint32)key.Cell.Z * 83492791u + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            hash ^= (uint32)key.Slot;
+            return hash;
+        }
+    };
+
+    Array<Instance> _instances;
+    Array<Group> _groups;
+    Array<Cluster> _clusters;
+    Array<int32> _freeGroups;
+    Array<int32> _freeClusters;
+    int32 _freeInstance = -1;
+    int32 _instancesCount = 0;
+    Dictionary<GroupKey, int32> _groupsMap;
+    Dictionary<ClusterKey, int32> _clustersMap;
+    SceneRenderingTree _tree;
+    Array<int32> _dirtyClusters;
+
+    // Per-draw state
+    Array<int32> _drawClusters;
+    RenderContextBatch* _drawBatch = nullptr;
+    const Array<BoundingFrustum>* _drawFrustums = nullptr;
+    const HZBOcclusion* _drawOcclusion = nullptr;
+    bool _drawFallback = false;
+
+public:
+    /// <summary>
+    /// Gets the amount of instanced actors.
+    /// </summary>
+    FORCE_INLINE int32 GetInstancesCount() const
+    {
+        return _instancesCount;
+    }
+
+    /// <summary>
+    /// Gets the amount of clusters.
+    /// </summary>
+    FORCE_INLINE int32 GetClustersCount() const
+    {
+        return _tree.GetLeavesCount();
+    }
+
+    /// <summary>
+    /// Checks if the actor can be drawn via automatic instancing (static model with static transform and without per-instance buffers).
+    /// </summary>
+    /// <param name="a">The actor.</param>
+    /// <returns>True if actor can be instanced, otherwise false.</returns>
+    static bool CanInstance(const Actor* a);
+
+    /// <summary>
+    /// Adds the actor to the cluster of instances that use the same model and materials.
+    /// </summary>
+    /// <param name="a">The actor (see CanInstance).</param>
+    /// <param name="bounds">The actor bounds.</param>
+    /// <param name="layerMask">The actor layer mask.</param>
+    /// <returns>The instance index (used to remove it), or -1 if actor cannot be instanced.</returns>
+    int32 Add(Actor* a, const BoundingSphere& bounds, uint32 layerMask);
+
+    /// <summary>
+    /// Removes the instance from its cluster.
+    /// </summary>
+    /// <param name="index">The instance index.</param>
+    void Remove(int32 index);
+
+    /// <summary>
+    /// Clears all instances and clusters.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Culls the clusters and draws visible instances.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <param name="frustums">The frustums of the batch contexts (in space relative to view origin).</param>
+    /// <param name="occlusion">The occlusion culling of the main view (optional).</param>
+    void Draw(RenderContextBatch& renderContextBatch, const Array<BoundingFrustum>& frustums, const HZBOcclusion* occlusion);
+
+private:
+    static uint32 GetEntriesHash(const Array<ModelInstanceEntry>& entries);
+    int32 GetGroup(StaticModel* actor);
+    int32 GetCluster(int32 group, const Vector3& position);
+    void RemoveCluster(int32 cluster);
+    void UpdateBounds(Cluster& cluster, int32 clusterIndex);
+    void DrawClusterJob(int32 i);
+    void DrawClusterFallback(const Cluster& cluster);
+    void DrawCluster(const Cluster& cluster);
+};
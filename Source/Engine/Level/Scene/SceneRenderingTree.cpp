@@ -0,0 +1,385 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SceneRenderingTree.h"
+#include "Engine/Core/Math/Math.h"
+
+namespace
+{
+    FORCE_INLINE Real GetArea(const BoundingBox& box)
+    {
+        const Vector3 size = box.Maximum - box.Minimum;
+        return 2.0f * (size.X * size.Y + size.Y * size.Z + size.Z * size.X);
+    }
+
+    FORCE_INLINE BoundingBox GetMerged(const BoundingBox& a, const BoundingBox& b)
+    {
+        BoundingBox result;
+        BoundingBox::Merge(a, b, result);
+        return result;
+    }
+
+    FORCE_INLINE bool IsContained(const BoundingBox& container, const BoundingBox& box)
+    {
+        return container.Minimum.X <= box.Minimum.X && container.Minimum.Y <= box.Minimum.Y && container.Minimum.Z <= box.Minimum.Z &&
+                box.Maximum.X <= container.Maximum.X && box.Maximum.Y <= container.Maximum.Y && box.Maximum.Z <= container.Maximum.Z;
+    }
+}
+
+int32 SceneRenderingTree::Add(const BoundingSphere& bounds, int32 key)
+{
+    const int32 leaf = AllocateNode();
+    Node& node = _nodes[leaf];
+    BoundingBox::FromSphere(bounds, node.Bounds);
+    node.Height = 0;
+    node.Key = key;
+    InsertLeaf(leaf);
+    _leavesCount++;
+    return leaf;
+}
+
+void SceneRenderingTree::Update(int32 leaf, const BoundingSphere& bounds)
+{
+    ASSERT_LOW_LAYER(leaf >= 0 && leaf < _nodes.Count() && _nodes[leaf].IsLeaf());
+    BoundingBox box;
+    BoundingBox::FromSphere(bounds, box);
+    if (IsContained(_nodes[leaf].Bounds, box))
+        return;
+    RemoveLeaf(leaf);
+    _nodes[leaf].Bounds = box;
+    InsertLeaf(leaf);
+}
+
+void SceneRenderingTree::Remove(int32 leaf)
+{
+    ASSERT_LOW_LAYER(leaf >= 0 && leaf < _nodes.Count() && _nodes[leaf].IsLeaf());
+    RemoveLeaf(leaf);
+    FreeNode(leaf);
+    _leavesCount--;
+}
+
+void SceneRenderingTree::Clear()
+{
+    _nodes.Clear();
+    _root = -1;
+    _freeList = -1;
+    _leavesCount = 0;
+}
+
+void SceneRenderingTree::Query(const Array<BoundingFrustum>& frustums, const Vector3& origin, Array<int32>& keys)
+{
+    if (_root == -1)
+        return;
+    const int32 frustumsCount = frustums.Count();
+    const BoundingFrustum* frustumsData = frustums.Get();
+    const bool useOrigin = !origin.IsZero();
+    _stack.Clear();
+    _stack.Add(_root);
+    while (_stack.HasItems())
+    {
+        const int32 index = _stack.Pop();
+        const Node& node = _nodes.Get()[index];
+        if (node.IsLeaf())
+        {
+            // Leaves are tested precisely by the caller
+            keys.Add(node.Key);
+            continue;
+        }
+        const BoundingBox bounds = useOrigin ? BoundingBox(node.Bounds.Minimum - origin, node.Bounds.Maximum - origin) : node.Bounds;
+        bool intersects = false, contains = false;
+        for (int32 i = 0; i < frustumsCount && !contains; i++)
+        {
+            const ContainmentType containment = frustumsData[i].Contains(bounds);
+            intersects |= containment != ContainmentType::Disjoint;
+            contains |= containment == ContainmentType::Contains;
+        }
+        if (contains)
+        {
+            // Whole subtree is visible
+            CollectLeaves(index, keys);
+        }
+        else if (intersects)
+        {
+            _stack.Add(node.Child0);
+            _stack.Add(node.Child1);
+        }
+    }
+}
+
+int32 SceneRenderingTree::AllocateNode()
+{
+    int32 index;
+    if (_freeList != -1)
+    {
+        index = _freeList;
+        _freeList = _nodes[index].Parent;
+    }
+    else
+    {
+        index = _nodes.Count();
+        _nodes.AddOne();
+    }
+    Node& node = _nodes[index];
+    node.Parent = -1;
+    node.Child0 = -1;
+    node.Child1 = -1;
+    node.Height = 0;
+    node.Key = -1;
+    return index;
+}
+
+void SceneRenderingTree::FreeNode(int32 node)
+{
+    Node& n = _nodes[node];
+    n.Parent = _freeList;
+    n.Height = -1;
+    n.Key = -1;
+    _freeList = node;
+}
+
+void SceneRenderingTree::InsertLeaf(int32 leaf)
+{
+    if (_root == -1)
+    {
+        _root = leaf;
+        _nodes[leaf].Parent = -1;
+        return;
+    }
+
+    // Find the best sibling for the new leaf (using surface area heuristic)
+    const BoundingBox leafBounds = _nodes[leaf].Bounds;
+    int32 index = _root;
+    while (!_nodes[index].IsLeaf())
+    {
+        const Node& node = _nodes[index];
+        const Real area = GetArea(node.Bounds);
+        const Real combinedArea = GetArea(GetMerged(node.Bounds, leafBounds));
+
+        // Cost of creating a new parent for this node and the new leaf
+        const Real cost = 2.0f * combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        const Real inheritanceCost = 2.0f * (combinedArea - area);
+
+        // Cost of descending into children
+        Real childCost[2];
+        const int32 children[2] = { node.Child0, node.Child1 };
+        for (int32 i = 0; i < 2; i++)
+        {
+            const Node& child = _nodes[children[i]];
+            const Real mergedArea = GetArea(GetMerged(child.Bounds, leafBounds));
+            childCost[i] = (child.IsLeaf() ? mergedArea : mergedArea - GetArea(child.Bounds)) + inheritanceCost;
+        }
+        if (cost < childCost[0] && cost < childCost[1])
+            break;
+        index = childCost[0] < childCost[1] ? children[0] : children[1];
+    }
+    const int32 sibling = index;
+
+    // Create a new parent
+    const int32 oldParent = _nodes[sibling].Parent;
+    const int32 newParent = AllocateNode();
+    {
+        Node& parent = _nodes[newParent];
+        parent.Parent = oldParent;
+        parent.Bounds = GetMerged(leafBounds, _nodes[sibling].Bounds);
+        parent.Height = _nodes[sibling].Height + 1;
+        parent.Child0 = sibling;
+        parent.Child1 = leaf;
+    }
+    if (oldParent != -1)
+    {
+        Node& parent = _nodes[oldParent];
+        if (parent.Child0 == sibling)
+            parent.Child0 = newParent;
+        else
+            parent.Child1 = newParent;
+    }
+    else
+    {
+        _root = newParent;
+    }
+    _nodes[sibling].Parent = newParent;
+    _nodes[leaf].Parent = newParent;
+
+    // Walk back up the tree fixing heights and bounds
+    index = _nodes[leaf].Parent;
+    while (index != -1)
+    {
+        index = Balance(index);
+        Node& node = _nodes[index];
+        const Node& child0 = _nodes[node.Child0];
+        const Node& child1 = _nodes[node.Child1];
+        node.Height = 1 + Math::Max(child0.Height, child1.Height);
+        node.Bounds = GetMerged(child0.Bounds, child1.Bounds);
+        index = node.Parent;
+    }
+}
+
+void SceneRenderingTree::RemoveLeaf(int32 leaf)
+{
+    if (leaf == _root)
+    {
+        _root = -1;
+        return;
+    }
+
+    const int32 parent = _nodes[leaf].Parent;
+    const int32 grandParent = _nodes[parent].Parent;
+    const int32 sibling = _nodes[parent].Child0 == leaf ? _nodes[parent].Child1 : _nodes[parent].Child0;
+    if (grandParent != -1)
+    {
+        // Destroy parent and connect sibling to grandparent
+        Node& node = _nodes[grandParent];
+        if (node.Child0 == parent)
+            node.Child0 = sibling;
+        else
+            node.Child1 = sibling;
+        _nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        // Adjust ancestor bounds
+        int32 index = grandParent;
+        while (index != -1)
+        {
+            index = Balance(index);
+            Node& n = _nodes[index];
+            const Node& child0 = _nodes[n.Child0];
+            const Node& child1 = _nodes[n.Child1];
+            n.Bounds = GetMerged(child0.Bounds, child1.Bounds);
+            n.Height = 1 + Math::Max(child0.Height, child1.Height);
+            index = n.Parent;
+        }
+    }
+    else
+    {
+        _root = sibling;
+        _nodes[sibling].Parent = -1;
+        FreeNode(parent);
+    }
+    _nodes[leaf].Parent = -1;
+}
+
+int32 SceneRenderingTree::Balance(int32 a)
+{
+    // Performs a left or right rotation if node A is imbalanced (returns the new root index)
+    Node& nodeA = _nodes[a];
+    if (nodeA.IsLeaf() || nodeA.Height < 2)
+        return a;
+    const int32 b = nodeA.Child0;
+    const int32 c = nodeA.Child1;
+    Node& nodeB = _nodes[b];
+    Node& nodeC = _nodes[c];
+    const int32 balance = nodeC.Height - nodeB.Height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        const int32 f = nodeC.Child0;
+        const int32 g = nodeC.Child1;
+        Node& nodeF = _nodes[f];
+        Node& nodeG = _nodes[g];
+
+        // Swap A and C
+        nodeC.Child0 = a;
+        nodeC.Parent = nodeA.Parent;
+        nodeA.Parent = c;
+        if (nodeC.Parent != -1)
+        {
+            Node& parent = _nodes[nodeC.Parent];
+            if (parent.Child0 == a)
+                parent.Child0 = c;
+            else
+                parent.Child1 = c;
+        }
+        else
+        {
+            _root = c;
+        }
+
+        // Rotate
+        if (nodeF.Height > nodeG.Height)
+        {
+            nodeC.Child1 = f;
+            nodeA.Child1 = g;
+            nodeG.Parent = a;
+            nodeA.Bounds = GetMerged(nodeB.Bounds, nodeG.Bounds);
+            nodeC.Bounds = GetMerged(nodeA.Bounds, nodeF.Bounds);
+            nodeA.Height = 1 + Math::Max(nodeB.Height, nodeG.Height);
+            nodeC.Height = 1 + Math::Max(nodeA.Height, nodeF.Height);
+        }
+        else
+        {
+            nodeC.Child1 = g;
+            nodeA.Child1 = f;
+            nodeF.Parent = a;
+            nodeA.Bounds = GetMerged(nodeB.Bounds, nodeF.Bounds);
+            nodeC.Bounds = GetMerged(nodeA.Bounds, nodeG.Bounds);
+            nodeA.Height = 1 + Math::Max(nodeB.Height, nodeF.Height);
+            nodeC.Height = 1 + Math::Max(nodeA.Height, nodeG.Height);
+        }
+        return c;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        const int32 d = nodeB.Child0;
+        const int32 e = nodeB.Child1;
+        Node& nodeD = _nodes[d];
+        Node& nodeE = _nodes[e];
+
+        // Swap A and B
+        nodeB.Child0 = a;
+        nodeB.Parent = nodeA.Parent;
+        nodeA.Parent = b;
+        if (nodeB.Parent != -1)
+        {
+            Node& parent = _nodes[nodeB.Parent];
+            if (parent.Child0 == a)
+                parent.Child0 = b;
+            else
+                parent.Child1 = b;
+        }
+        else
+        {
+            _root = b;
+        }
+
+        // Rotate
+        if (nodeD.Height > nodeE.Height)
+        {
+            nodeB.Child1 = d;
+            nodeA.Child0 = e;
+            nodeE.Parent = a;
+            nodeA.Bounds = GetMerged(nodeC.Bounds, nodeE.Bounds);
+            nodeB.Bounds = GetMerged(nodeA.Bounds, nodeD.Bounds);
+            nodeA.Height = 1 + Math::Max(nodeC.Height, nodeE.Height);
+            nodeB.Height = 1 + Math::Max(nodeA.Height, nodeD.Height);
+        }
+        else
+        {
+            nodeB.Child1 = e;
+            nodeA.Child0 = d;
+            nodeD.Parent = a;
+            nodeA.Bounds = GetMerged(nodeC.Bounds, nodeD.Bounds);
+            nodeB.Bounds = GetMerged(nodeA.Bounds, nodeE.Bounds);
+            nodeA.Height = 1 + Math::Max(nodeC.Height, nodeD.Height);
+            nodeB.Height = 1 + Math::Max(nodeA.Height, nodeE.Height);
+        }
+        return b;
+    }
+
+    return a;
+}
+
+void SceneRenderingTree::CollectLeaves(int32 node, Array<int32>& keys)
+{
+    const Node& n = _nodes.Get()[node];
+    if (n.IsLeaf())
+    {
+        keys.Add(n.Key);
+        return;
+    }
+    CollectLeaves(n.Child0, keys);
+    CollectLeaves(n.Child1, keys);
+}
@@ -0,0 +1,108 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+/// <summary>
+/// Incrementally updated bounding volume hierarchy (dynamic AABB tree) used by Scene Rendering to perform hierarchical culling of the static actors.
+/// </summary>
+/// <remarks>Leaves hold a user key (index of the actor in the Scene Rendering list). Tree is balanced with tree rotations on insertion and removal.</remarks>
+class FLAXENGINE_API SceneRenderingTree
+{
+public:
+    struct Node
+    {
+        BoundingBox Bounds;
+        int32 Parent;
+        int32 Child0;
+        int32 Child1;
+        // Node height in the tree (0 for leaves, -1 for unused nodes).
+        int32 Height;
+        // Leaf key (-1 for internal nodes).
+        int32 Key;
+
+        FORCE_INLINE bool IsLeaf() const
+        {
+            return Child0 == -1;
+        }
+    };
+
+private:
+    Array<Node> _nodes;
+    int32 _root = -1;
+    int32 _freeList = -1;
+    int32 _leavesCount = 0;
+    Array<int32> _stack;
+
+public:
+    /// <summary>
+    /// Gets the amount of leaves in the tree.
+    /// </summary>
+    FORCE_INLINE int32 GetLeavesCount() const
+    {
+        return _leavesCount;
+    }
+
+    /// <summary>
+    /// Gets the tree height (0 if empty or with a single leaf).
+    /// </summary>
+    FORCE_INLINE int32 GetHeight() const
+    {
+        return _root != -1 ? _nodes[_root].Height : 0;
+    }
+
+    /// <summary>
+    /// Gets the key of the leaf.
+    /// </summary>
+    FORCE_INLINE int32 GetKey(int32 leaf) const
+    {
+        return _nodes[leaf].Key;
+    }
+
+public:
+    /// <summary>
+    /// Adds a leaf to the tree.
+    /// </summary>
+    /// <param name="bounds">The leaf bounds.</param>
+    /// <param name="key">The leaf key.</param>
+    /// <returns>The leaf node index (used to update or remove it).</returns>
+    int32 Add(const BoundingSphere& bounds, int32 key);
+
+    /// <summary>
+    /// Updates the leaf bounds. Reinserts the leaf only if the new bounds are not contained by the current node bounds.
+    /// </summary>
+    /// <param name="leaf">The leaf node index.</param>
+    /// <param name="bounds">The leaf bounds.</param>
+    void Update(int32 leaf, const BoundingSphere& bounds);
+
+    /// <summary>
+    /// Removes the leaf from the tree.
+    /// </summary>
+    /// <param name="leaf">The leaf node index.</param>
+    void Remove(int32 leaf);
+
+    /// <summary>
+    /// Clears the tree.
+    /// </summary>
+    void Clear();
+
+    /// <summary>
+    /// Collects keys of all leaves that intersect with any of the given frustums. Subtrees fully contained by any frustum are collected without further testing.
+    /// </summary>
+    /// <param name="frustums">The frustums list (in space relative to origin).</param>
+    /// <param name="origin">The world origin of the frustums.</param>
+    /// <param name="keys">The output keys (appended).</param>
+    void Query(const Array<BoundingFrustum>& frustums, const Vector3& origin, Array<int32>& keys);
+
+private:
+    int32 AllocateNode();
+    void FreeNode(int32 node);
+    void InsertLeaf(int32 leaf);
+    void RemoveLeaf(int32 leaf);
+    int32 Balance(int32 a);
+    void CollectLeaves(int32 node, Array<int32>& keys);
+};
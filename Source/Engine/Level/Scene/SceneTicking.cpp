@@ -3,16 +3,89 @@
 #include "SceneTicking.h"
 #include "Scene.h"
 #include "Engine/Scripting/Script.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
+
+// The amount of thread-safe scripts updated by a single job
+#define SCENE_TICKING_PARALLEL_BATCH 64
+
+bool SceneTicking::TickList::IsEmpty() const
+{
+    for (const Group& group : _groups)
+    {
+        if (!group.Callees.IsEmpty())
+            return false;
+    }
+    return true;
+}
+
+void SceneTicking::TickList::Add(const Tick& tick)
+{
+    for (Group& group : _groups)
+    {
+        if (group.Function == tick.FunctionObj)
+        {
+            group.Callees.Add(tick.Callee);
+            return;
+        }
+    }
+    Group& group = _groups.AddOne();
+    group.Function = tick.FunctionObj;
+    group.Callees.Add(tick.Callee);
+}
+
+void SceneTicking::TickList::Remove(void* callee)
+{
+    for (Group& group : _groups)
+    {
+        if (group.Callees.Remove(callee))
+            break;
+    }
+}
+
+void SceneTicking::TickList::Compact()
+{
+    for (Group& group : _groups)
+        group.Callees.Compact();
+}
+
+void SceneTicking::TickList::Call()
+{
+    // Skip compaction when ticks are called recursively (eg. tick of one scene updates another scene)
+    if (_callDepth++ == 0)
+        Compact();
+
+    // Note: ticks can be added or removed during the call so access the data via index
+    for (int32 groupIndex = 0; groupIndex < _groups.Count(); groupIndex++)
+    {
+        const Tick::SignatureObj function = _groups.Get()[groupIndex].Function;
+        for (int32 i = 0; i < _groups.Get()[groupIndex].Callees.Count(); i++)
+        {
+            void* callee = _groups.Get()[groupIndex].Callees.Get()[i];
+            if (callee)
+                function(callee);
+        }
+    }
+    _callDepth--;
+}
+
+void SceneTicking::TickList::Clear()
+{
+    _groups.Clear();
+}
 
 SceneTicking::TickData::TickData(int32 capacity)
     : Scripts(capacity)
-    , Ticks(capacity)
 {
 }
 
 void SceneTicking::TickData::AddScript(Script* script)
 {
-    Scripts.Add(script);
+    if (script->_threadSafeUpdate)
+        ScriptsParallel.Add(script);
+    else
+        Scripts.Add(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Add(script);
@@ -21,7 +94,10 @@ void SceneTicking::TickData::AddScript(Script* script)
 
 void SceneTicking::TickData::RemoveScript(Script* script)
 {
-    Scripts.Remove(script);
+    if (script->_threadSafeUpdate)
+        ScriptsParallel.Remove(script);
+    else
+        Scripts.Remove(script);
 #if USE_EDITOR
     if (script->_executeInEditor)
         ScriptsExecuteInEditor.Remove(script);
@@ -30,44 +106,96 @@ void SceneTicking::TickData::RemoveScript(Script* script)
 
 void SceneTicking::TickData::RemoveTick(void* callee)
 {
-    for (int32 i = 0; i < Ticks.Count(); i++)
-    {
-        if (Ticks.Get()[i].Callee == callee)
-        {
-            Ticks.RemoveAt(i);
-            break;
-        }
-    }
+    Ticks.Remove(callee);
+}
+
+void SceneTicking::TickData::RemoveTickParallel(void* callee)
+{
+    TicksParallel.Remove(callee);
 }
 
 void SceneTicking::TickData::Tick()
 {
-    TickScripts(Scripts);
+    RunScripts(Scripts);
 
-    for (int32 i = 0; i < Ticks.Count(); i++)
-        Ticks.Get()[i].Call();
+    TickParallel();
+
+    Ticks.Call();
 }
 
-#if USE_EDITOR
+void SceneTicking::TickData::RunScripts(ObjectsList<Script>& scripts)
+{
+    // Scripts added during update will be called in the next tick
+    scripts.Compact();
+    TickScripts(scripts, 0, scripts.Count());
+}
 
-void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
+void SceneTicking::TickData::TickParallel()
 {
-    for (int32 i = 0; i < TicksExecuteInEditor.Count(); i++)
+    if (ScriptsParallel.IsEmpty() && TicksParallel.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Parallel");
+    ScriptsParallel.Compact();
+    TicksParallel.Compact();
+
+    // Split work into jobs (each job updates a range of the scripts or callees of a single tick function)
+    struct Job
     {
-        if (TicksExecuteInEditor.Get()[i].Callee == callee)
+        int32 Group; // -1 for scripts
+        int32 Start;
+        int32 End;
+    };
+    Array<Job, InlinedAllocation<64>> jobs;
+    for (int32 start = 0; start < ScriptsParallel.Count(); start += SCENE_TICKING_PARALLEL_BATCH)
+        jobs.Add({ -1, start, Math::Min(start + SCENE_TICKING_PARALLEL_BATCH, ScriptsParallel.Count()) });
+    const auto& groups = TicksParallel.GetGroups();
+    for (int32 groupIndex = 0; groupIndex < groups.Count(); groupIndex++)
+    {
+        const int32 count = groups[groupIndex].Callees.Count();
+        for (int32 start = 0; start < count; start += SCENE_TICKING_PARALLEL_BATCH)
+            jobs.Add({ groupIndex, start, Math::Min(start + SCENE_TICKING_PARALLEL_BATCH, count) });
+    }
+    const auto runJob = [this, &jobs, &groups](int32 jobIndex)
+    {
+        const Job& job = jobs.Get()[jobIndex];
+        if (job.Group == -1)
         {
-            TicksExecuteInEditor.RemoveAt(i);
-            break;
+            TickScripts(ScriptsParallel, job.Start, job.End);
+            return;
         }
+        const auto& group = groups.Get()[job.Group];
+        void* const* callees = group.Callees.Get();
+        for (int32 i = job.Start; i < job.End; i++)
+        {
+            if (callees[i])
+                group.Function(callees[i]);
+        }
+    };
+    if (jobs.Count() == 1 || JobSystem::GetThreadsCount() <= 1)
+    {
+        // Not worth the jobs overhead
+        for (int32 i = 0; i < jobs.Count(); i++)
+            runJob(i);
+        return;
     }
+
+    // Note: scripts and ticks lists cannot be modified during the parallel phase (would require hierarchy changes which are not thread-safe)
+    const int64 label = JobSystem::Dispatch(runJob, jobs.Count());
+    JobSystem::Wait(label);
+}
+
+#if USE_EDITOR
+
+void SceneTicking::TickData::RemoveTickExecuteInEditor(void* callee)
+{
+    TicksExecuteInEditor.Remove(callee);
 }
 
 void SceneTicking::TickData::TickExecuteInEditor()
 {
-    TickScripts(ScriptsExecuteInEditor);
+    RunScripts(ScriptsExecuteInEditor);
 
-    for (int32 i = 0; i < TicksExecuteInEditor.Count(); i++)
-        TicksExecuteInEditor.Get()[i].Call();
+    TicksExecuteInEditor.Call();
 }
 
 #endif
@@ -75,7 +203,9 @@ void SceneTicking::TickData::TickExecuteInEditor()
 void SceneTicking::TickData::Clear()
 {
     Scripts.Clear();
+    ScriptsParallel.Clear();
     Ticks.Clear();
+    TicksParallel.Clear();
 #if USE_EDITOR
     ScriptsExecuteInEditor.Clear();
     TicksExecuteInEditor.Clear();
@@ -87,11 +217,13 @@ SceneTicking::FixedUpdateTickData::FixedUpdateTickData()
 {
 }
 
-void SceneTicking::FixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::FixedUpdateTickData::TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end)
 {
-    for (auto* script : scripts)
+    for (int32 i = start; i < end; i++)
     {
-        script->OnFixedUpdate();
+        Script* script = scripts.Get()[i];
+        if (script)
+            script->OnFixedUpdate();
     }
 }
 
@@ -100,11 +232,14 @@ SceneTicking::UpdateTickData::UpdateTickData()
 {
 }
 
-void SceneTicking::UpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::UpdateTickData::TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end)
 {
-    for (auto* script : scripts)
+    const float time = Time::GetGameTime();
+    for (int32 i = start; i < end; i++)
     {
-        script->OnUpdate();
+        Script* script = scripts.Get()[i];
+        if (script && script->CanUpdate(time))
+            script->OnUpdate();
     }
 }
 
@@ -113,10 +248,18 @@ SceneTicking::LateUpdateTickData::LateUpdateTickData()
 {
 }
 
-void SceneTicking::LateUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateUpdateTickData::TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end)
 {
-    for (auto* script : scripts)
+    const float time = Time::GetGameTime();
+    for (int32 i = start; i < end; i++)
     {
+        Script* script = scripts.Get()[i];
+        if (!script)
+            continue;
+
+        // Late update follows the update throttling (or uses own if script has no update)
+        if (script->_tickUpdate ? script->_skipLateUpdate : !script->CanUpdate(time))
+            continue;
         script->OnLateUpdate();
     }
 }
@@ -126,17 +269,20 @@ SceneTicking::LateFixedUpdateTickData::LateFixedUpdateTickData()
 {
 }
 
-void SceneTicking::LateFixedUpdateTickData::TickScripts(const Array<Script*>& scripts)
+void SceneTicking::LateFixedUpdateTickData::TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end)
 {
-    for (auto* script : scripts)
+    for (int32 i = start; i < end; i++)
     {
-        script->OnLateFixedUpdate();
+        Script* script = scripts.Get()[i];
+        if (script)
+            script->OnLateFixedUpdate();
     }
 }
 
 void SceneTicking::AddScript(Script* obj)
 {
     ASSERT_LOW_LAYER(obj && obj->GetParent() && obj->GetParent()->GetScene());
+    obj->_lastUpdateTime = Time::GetGameTime();
     if (obj->_tickFixedUpdate)
         FixedUpdate.AddScript(obj);
     if (obj->_tickUpdate)
@@ -4,6 +4,7 @@
 
 #include "Engine/Level/Types.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
 
 /// <summary>
 /// Scene gameplay updating helper subsystem that boosts the level ticking by providing efficient objects cache.
@@ -42,21 +43,147 @@ class FLAXENGINE_API SceneTicking
     };
 
     /// <summary>
-    /// Ticking data container.
+    /// Objects list with a fast removal. Removed objects leave empty slots (null) that are compacted later on (keeps the objects order).
+    /// </summary>
+    template<typename T>
+    class ObjectsList
+    {
+    private:
+        Array<T*> _items;
+        Dictionary<T*, int32> _indices;
+        int32 _removedCount = 0;
+
+    public:
+        explicit ObjectsList(int32 capacity = 0)
+            : _items(capacity)
+        {
+        }
+
+        /// <summary>
+        /// Gets the amount of the slots (including the empty ones).
+        /// </summary>
+        FORCE_INLINE int32 Count() const
+        {
+            return _items.Count();
+        }
+
+        /// <summary>
+        /// Gets the slots data (empty slots are null).
+        /// </summary>
+        FORCE_INLINE T* const* Get() const
+        {
+            return _items.Get();
+        }
+
+        FORCE_INLINE bool IsEmpty() const
+        {
+            return _indices.IsEmpty();
+        }
+
+        bool Add(T* obj)
+        {
+            if (_indices.ContainsKey(obj))
+                return false;
+            _indices.Add(obj, _items.Count());
+            _items.Add(obj);
+            return true;
+        }
+
+        bool Remove(T* obj)
+        {
+            int32 index;
+            if (!_indices.TryGet(obj, index))
+                return false;
+            _indices.Remove(obj);
+            _items.Get()[index] = nullptr;
+            _removedCount++;
+            return true;
+        }
+
+        /// <summary>
+        /// Removes the empty slots. Cannot be called during objects iteration.
+        /// </summary>
+        void Compact()
+        {
+            if (_removedCount == 0)
+                return;
+            T** items = _items.Get();
+            int32 count = 0;
+            for (int32 i = 0; i < _items.Count(); i++)
+            {
+                T* obj = items[i];
+                if (!obj)
+                    continue;
+                if (count != i)
+                {
+                    items[count] = obj;
+                    _indices[obj] = count;
+                }
+                count++;
+            }
+            _items.Resize(count);
+            _removedCount = 0;
+        }
+
+        void Clear()
+        {
+            _items.Clear();
+            _indices.Clear();
+            _removedCount = 0;
+        }
+    };
+
+    /// <summary>
+    /// Tick functions list. Ticks are grouped by the function so it's called over the contiguous callees.
+    /// </summary>
+    class FLAXENGINE_API TickList
+    {
+    public:
+        struct Group
+        {
+            Tick::SignatureObj Function;
+            ObjectsList<void> Callees;
+        };
+
+    private:
+        Array<Group> _groups;
+        int32 _callDepth = 0;
+
+    public:
+        FORCE_INLINE const Array<Group>& GetGroups() const
+        {
+            return _groups;
+        }
+
+        bool IsEmpty() const;
+        void Add(const Tick& tick);
+        void Remove(void* callee);
+        void Compact();
+        void Call();
+        void Clear();
+    };
+
+    /// <summary>
+    /// Ticking data container. Tick is executed in phases: main thread scripts, thread-safe scripts and parallel ticks (spread over Job System threads), main thread ticks.
     /// </summary>
     class FLAXENGINE_API TickData
     {
     public:
-        Array<Script*> Scripts;
-        Array<Tick> Ticks;
+        ObjectsList<Script> Scripts;
+        ObjectsList<Script> ScriptsParallel;
+        TickList Ticks;
+        TickList TicksParallel;
 #if USE_EDITOR
-        Array<Script*> ScriptsExecuteInEditor;
-        Array<Tick> TicksExecuteInEditor;
+        ObjectsList<Script> ScriptsExecuteInEditor;
+        TickList TicksExecuteInEditor;
 #endif
 
         TickData(int32 capacity);
 
-        virtual void TickScripts(const Array<Script*>& scripts) = 0;
+        /// <summary>
+        /// Updates the scripts from the given range of the list (skips empty slots).
+        /// </summary>
+        virtual void TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end) = 0;
 
         void AddScript(Script* script);
         void RemoveScript(Script* script);
@@ -70,6 +197,19 @@ class FLAXENGINE_API SceneTicking
         }
 
         void RemoveTick(void* callee);
+
+        /// <summary>
+        /// Adds the tick function that can be executed in parallel to the other parallel ticks and thread-safe scripts (on a job thread).
+        /// </summary>
+        template<class T, void(T::*Method)()>
+        void AddTickParallel(T* callee)
+        {
+            SceneTicking::Tick tick;
+            tick.Bind<T, Method>(callee);
+            TicksParallel.Add(tick);
+        }
+
+        void RemoveTickParallel(void* callee);
         void Tick();
 
 #if USE_EDITOR
@@ -86,34 +226,38 @@ class FLAXENGINE_API SceneTicking
 #endif
 
         void Clear();
+
+    private:
+        void RunScripts(ObjectsList<Script>& scripts);
+        void TickParallel();
     };
 
     class FLAXENGINE_API FixedUpdateTickData : public TickData
     {
     public:
         FixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end) override;
     };
 
     class FLAXENGINE_API UpdateTickData : public TickData
     {
     public:
         UpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end) override;
     };
 
     class FLAXENGINE_API LateUpdateTickData : public TickData
     {
     public:
         LateUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end) override;
     };
 
     class FLAXENGINE_API LateFixedUpdateTickData : public TickData
     {
     public:
         LateFixedUpdateTickData();
-        void TickScripts(const Array<Script*>& scripts) override;
+        void TickScripts(const ObjectsList<Script>& scripts, int32 start, int32 end) override;
     };
 
 public:
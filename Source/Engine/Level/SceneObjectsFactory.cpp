@@ -242,6 +242,17 @@ SceneObject* SceneObjectsFactory::Spawn(Context& context, const ISerializable::D
     return obj;
 }
 
+SceneObject* SceneObjectsFactory::Spawn(Context& context, const Guid& id, const ScriptingTypeHandle& type)
+{
+    Guid objectId = id;
+    context.GetModifier()->IdsMapping.TryGet(objectId, objectId);
+    const ScriptingObjectSpawnParams params(objectId, type);
+    const auto obj = (SceneObject*)type.GetType().Script.Spawn(params);
+    if (obj == nullptr)
+        LOG(Warning, "Failed to spawn object of type {0}.", type.ToString(true));
+    return obj;
+}
+
 void SceneObjectsFactory::Deserialize(Context& context, SceneObject* obj, ISerializable::DeserializeStream& stream)
 {
 #if ENABLE_ASSERTION
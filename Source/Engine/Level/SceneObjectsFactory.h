@@ -46,6 +46,14 @@ class FLAXENGINE_API SceneObjectsFactory
     /// <param name="stream">The serialized data stream.</param>
     static SceneObject* Spawn(Context& context, const ISerializable::DeserializeStream& stream);
 
+    /// <summary>
+    /// Creates the scene object of the given type (eg. resolved and cached from the object data by the prefab). Does not perform deserialization.
+    /// </summary>
+    /// <param name="context">The serialization context.</param>
+    /// <param name="id">The serialized object identifier (remapped by the context modifier).</param>
+    /// <param name="type">The object type.</param>
+    static SceneObject* Spawn(Context& context, const Guid& id, const ScriptingTypeHandle& type);
+
     /// <summary>
     /// Deserializes the scene object from the specified data value.
     /// </summary>
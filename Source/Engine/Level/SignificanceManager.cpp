@@ -0,0 +1,46 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "SignificanceManager.h"
+#include "Actors/Camera.h"
+#include "Engine/Core/Math/BoundingFrustum.h"
+
+namespace
+{
+    bool HasView = false;
+    Vector3 ViewPosition;
+    BoundingFrustum ViewFrustum;
+}
+
+bool SignificanceManager::Enabled = true;
+float SignificanceManager::NearDistance = 5000.0f;
+float SignificanceManager::FarDistance = 50000.0f;
+int32 SignificanceManager::MaxTickInterval = 8;
+int32 SignificanceManager::OffScreenTickInterval = 4;
+
+int32 SignificanceManager::GetTickInterval(const BoundingSphere& sphere)
+{
+    if (!Enabled || !HasView)
+        return 1;
+    int32 interval = 1;
+    const float distance = (float)Math::Max(Vector3::Distance(ViewPosition, sphere.Center) - sphere.Radius, (Real)0);
+    if (distance > NearDistance && MaxTickInterval > 1)
+    {
+        const float alpha = Math::Saturate((distance - NearDistance) / Math::Max(FarDistance - NearDistance, 1.0f));
+        interval = 1 + Math::RoundToInt(alpha * (float)(MaxTickInterval - 1));
+    }
+    if (OffScreenTickInterval > interval && ViewFrustum.Contains(sphere) == ContainmentType::Disjoint)
+        interval = OffScreenTickInterval;
+    return Math::Clamp(interval, 1, 255);
+}
+
+void SignificanceManager::OnUpdate()
+{
+    // Cache the view to use during scripts ticking (can run on multiple threads)
+    const Camera* camera = Camera::GetMainCamera();
+    HasView = camera != nullptr;
+    if (camera)
+    {
+        ViewPosition = camera->GetPosition();
+        ViewFrustum = camera->GetFrustum();
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The objects significance manager. Lowers update frequency of far-away or off-screen scripts (that have significance enabled) based on the distance to the main camera.
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API SignificanceManager
+{
+DECLARE_SCRIPTING_TYPE_NO_SPAWN(SignificanceManager);
+    friend class LevelService;
+
+    /// <summary>
+    /// True if significance-based update throttling is enabled, otherwise scripts are updated using only their tick interval.
+    /// </summary>
+    API_FIELD() static bool Enabled;
+
+    /// <summary>
+    /// The distance (from the main camera to the object bounds) below which objects are updated every frame.
+    /// </summary>
+    API_FIELD() static float NearDistance;
+
+    /// <summary>
+    /// The distance (from the main camera to the object bounds) at which objects are updated with the maximum tick interval.
+    /// </summary>
+    API_FIELD() static float FarDistance;
+
+    /// <summary>
+    /// The maximum update interval (in frames) used for the far-away objects.
+    /// </summary>
+    API_FIELD() static int32 MaxTickInterval;
+
+    /// <summary>
+    /// The update interval (in frames) used for the objects outside the main camera view. Use 1 to disable throttling of the off-screen objects.
+    /// </summary>
+    API_FIELD() static int32 OffScreenTickInterval;
+
+public:
+    /// <summary>
+    /// Gets the update interval (in frames) for the object of the given bounds. Uses main camera from the current frame.
+    /// </summary>
+    /// <param name="sphere">The object bounds (in world-space).</param>
+    /// <returns>The update interval (in frames). Value 1 means to update every frame.</returns>
+    API_FUNCTION() static int32 GetTickInterval(const BoundingSphere& sphere);
+
+private:
+    static void OnUpdate();
+};
@@ -3,6 +3,8 @@
 #include "Tags.h"
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Types/StringId.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Serialization/SerializationFwd.h"
 
 Array<String> Tags::List;
@@ -10,6 +12,37 @@ Array<String> Tags::List;
 FLAXENGINE_API String* TagsListDebug = nullptr;
 #endif
 
+namespace
+{
+    // Tag name to index lookup (rebuilt when tags list gets modified externally)
+    Dictionary<StringId, int32> TagsLookup;
+    int32 TagsLookupCount = 0;
+
+    void RebuildTagsLookup()
+    {
+        TagsLookup.Clear();
+        for (int32 i = 0; i < Tags::List.Count(); i++)
+            TagsLookup[StringId(Tags::List[i])] = i;
+        TagsLookupCount = Tags::List.Count();
+    }
+
+    int32 FindTagIndex(const StringId& tagName)
+    {
+        if (TagsLookupCount != Tags::List.Count())
+            RebuildTagsLookup();
+        int32 index;
+        if (!TagsLookup.TryGet(tagName, index))
+            return -1;
+        if (Tags::List[index] != tagName.ToStringView())
+        {
+            RebuildTagsLookup();
+            if (!TagsLookup.TryGet(tagName, index))
+                return -1;
+        }
+        return index;
+    }
+}
+
 const String& Tag::ToString() const
 {
     const int32 index = (int32)Index - 1;
@@ -43,11 +76,14 @@ Tag Tags::Get(const StringView& tagName)
 {
     if (tagName.IsEmpty())
         return Tag();
-    Tag tag(List.Find(tagName) + 1);
-    if (tag.Index == 0 && tagName.HasChars())
+    const StringId tagId(tagName);
+    Tag tag(FindTagIndex(tagId) + 1);
+    if (tag.Index == 0)
     {
         List.AddOne() = tagName;
         tag.Index = List.Count();
+        TagsLookup[tagId] = List.Count() - 1;
+        TagsLookupCount = List.Count();
 #if !BUILD_RELEASE
         TagsListDebug = List.Get();
 #endif
@@ -57,7 +93,8 @@ Tag Tags::Get(const StringView& tagName)
 
 Tag Tags::Find(const StringView& tagName)
 {
-    return Tag(List.Find(tagName) + 1);
+    const StringId tagId = StringId::Find(tagName);
+    return tagId.HasChars() ? Tag(FindTagIndex(tagId) + 1) : Tag();
 }
 
 Array<Tag> Tags::GetSubTags(Tag parentTag)
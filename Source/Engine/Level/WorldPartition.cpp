@@ -0,0 +1,288 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "WorldPartition.h"
+#include "Level.h"
+#include "Scene/Scene.h"
+#include "Actors/Camera.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+struct WorldPartitionCellData
+{
+    WorldPartitionCell Cell;
+    WorldPartitionCellState State;
+};
+
+struct WorldPartitionLoadRequest
+{
+    int32 Index;
+    Real Distance;
+
+    bool operator<(const WorldPartitionLoadRequest& other) const
+    {
+        return Distance < other.Distance;
+    }
+};
+
+namespace
+{
+    // Note: cells are guarded with Level::ScenesLock (scene events are called under it)
+    Array<WorldPartitionCellData> Cells;
+
+    // Streaming sources from the last update (guarded with own lock to be accessed from the streaming jobs)
+    CriticalSection SourcesLocker;
+    Array<Vector3> LastSources;
+
+    int32 FindCell(const Guid& sceneId)
+    {
+        for (int32 i = 0; i < Cells.Count(); i++)
+        {
+            if (Cells.Get()[i].Cell.SceneId == sceneId)
+                return i;
+        }
+        return -1;
+    }
+
+    void SetCellState(const Guid& sceneId, WorldPartitionCellState state)
+    {
+        ScopeLock lock(Level::ScenesLock);
+        const int32 index = FindCell(sceneId);
+        if (index != -1)
+            Cells[index].State = state;
+    }
+
+    void UnloadCell(WorldPartitionCellData& cell)
+    {
+        Scene* scene = Level::FindScene(cell.Cell.SceneId);
+        if (scene)
+        {
+            Level::UnloadSceneAsync(scene);
+            cell.State = WorldPartitionCellState::Unloading;
+        }
+        else
+        {
+            cell.State = WorldPartitionCellState::Unloaded;
+        }
+    }
+}
+
+class WorldPartitionService : public EngineService
+{
+public:
+    WorldPartitionService()
+        : EngineService(TEXT("World Partition"), 210)
+    {
+    }
+
+    bool Init() override;
+    void Update() override;
+    void Dispose() override;
+
+    static void OnSceneLoaded(Scene* scene, const Guid& sceneId);
+    static void OnSceneLoadError(Scene* scene, const Guid& sceneId);
+    static void OnSceneUnloaded(Scene* scene, const Guid& sceneId);
+};
+
+WorldPartitionService WorldPartitionServiceInstance;
+
+bool WorldPartition::Enabled = true;
+float WorldPartition::CellSize = 25600.0f;
+float WorldPartition::LoadDistance = 25600.0f;
+float WorldPartition::UnloadDistance = 38400.0f;
+int32 WorldPartition::MaxLoadingCells = 2;
+bool WorldPartition::UseMainCamera = true;
+Array<Vector3> WorldPartition::Sources;
+
+Int3 WorldPartition::GetCellCoordinate(const Vector3& position)
+{
+    const Real cellSize = (Real)Math::Max(CellSize, 1.0f);
+    return Int3((int32)Math::Floor(position.X / cellSize), (int32)Math::Floor(position.Y / cellSize), (int32)Math::Floor(position.Z / cellSize));
+}
+
+BoundingBox WorldPartition::GetCellBounds(const Int3& coordinate)
+{
+    const Real cellSize = (Real)Math::Max(CellSize, 1.0f);
+    const Vector3 min((Real)coordinate.X * cellSize, (Real)coordinate.Y * cellSize, (Real)coordinate.Z * cellSize);
+    return BoundingBox(min, min + cellSize);
+}
+
+void WorldPartition::AddCell(const Guid& sceneId, const BoundingBox& bounds)
+{
+    ScopeLock lock(Level::ScenesLock);
+    const int32 index = FindCell(sceneId);
+    if (index != -1)
+    {
+        // Update bounds and retry loading if it failed before
+        auto& cell = Cells[index];
+        cell.Cell.Bounds = bounds;
+        if (cell.State == WorldPartitionCellState::Failed)
+            cell.State = WorldPartitionCellState::Unloaded;
+        return;
+    }
+    auto& cell = Cells.AddOne();
+    cell.Cell.SceneId = sceneId;
+    cell.Cell.Bounds = bounds;
+    cell.State = Level::FindScene(sceneId) ? WorldPartitionCellState::Loaded : WorldPartitionCellState::Unloaded;
+}
+
+bool WorldPartition::RemoveCell(const Guid& sceneId, bool unload)
+{
+    ScopeLock lock(Level::ScenesLock);
+    const int32 index = FindCell(sceneId);
+    if (index == -1)
+        return false;
+    if (unload)
+        UnloadCell(Cells[index]);
+    Cells.RemoveAtKeepOrder(index);
+    return true;
+}
+
+void WorldPartition::ClearCells(bool unload)
+{
+    ScopeLock lock(Level::ScenesLock);
+    if (unload)
+    {
+        for (auto& cell : Cells)
+            UnloadCell(cell);
+    }
+    Cells.Clear();
+}
+
+Array<WorldPartitionCell> WorldPartition::GetCells()
+{
+    ScopeLock lock(Level::ScenesLock);
+    Array<WorldPartitionCell> result;
+    result.Resize(Cells.Count());
+    for (int32 i = 0; i < Cells.Count(); i++)
+        result.Get()[i] = Cells.Get()[i].Cell;
+    return result;
+}
+
+WorldPartitionCellState WorldPartition::GetCellState(const Guid& sceneId)
+{
+    ScopeLock lock(Level::ScenesLock);
+    const int32 index = FindCell(sceneId);
+    return index != -1 ? Cells.Get()[index].State : WorldPartitionCellState::Unloaded;
+}
+
+Array<Vector3> WorldPartition::GetStreamingSources()
+{
+    ScopeLock lock(SourcesLocker);
+    return LastSources;
+}
+
+bool WorldPartitionService::Init()
+{
+    Level::SceneLoaded.Bind<&WorldPartitionService::OnSceneLoaded>();
+    Level::SceneLoadError.Bind<&WorldPartitionService::OnSceneLoadError>();
+    Level::SceneUnloaded.Bind<&WorldPartitionService::OnSceneUnloaded>();
+    return false;
+}
+
+void WorldPartitionService::Update()
+{
+    // Gather streaming sources (also for the other systems, even if cells streaming is disabled)
+    Array<Vector3, InlinedAllocation<16>> sources;
+    sources.Add(WorldPartition::Sources);
+    if (WorldPartition::UseMainCamera)
+    {
+        const Camera* camera = Camera::GetMainCamera();
+        if (camera)
+            sources.Add(camera->GetPosition());
+    }
+    SourcesLocker.Lock();
+    LastSources.Set(sources.Get(), sources.Count());
+    SourcesLocker.Unlock();
+
+    ScopeLock lock(Level::ScenesLock);
+    if (!WorldPartition::Enabled || Cells.IsEmpty() || sources.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("WorldPartition.Update");
+
+    // Update cells
+    const Real loadDistance = (Real)WorldPartition::LoadDistance;
+    const Real unloadDistance = (Real)Math::Max(WorldPartition::UnloadDistance, WorldPartition::LoadDistance);
+    Array<WorldPartitionLoadRequest, InlinedAllocation<64>> requests;
+    int32 loadingCount = 0;
+    for (int32 i = 0; i < Cells.Count(); i++)
+    {
+        auto& cell = Cells.Get()[i];
+        Real distance = MAX_Real;
+        for (const Vector3& source : sources)
+            distance = Math::Min(distance, cell.Cell.Bounds.Distance(source));
+        switch (cell.State)
+        {
+        case WorldPartitionCellState::Unloaded:
+            if (distance <= loadDistance)
+                requests.Add({ i, distance });
+            break;
+        case WorldPartitionCellState::Loading:
+            if (Level::FindScene(cell.Cell.SceneId))
+                cell.State = WorldPartitionCellState::Loaded; // Scene was already loaded so there is no event
+            else
+                loadingCount++;
+            break;
+        case WorldPartitionCellState::Loaded:
+            if (distance > unloadDistance)
+                UnloadCell(cell);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Load the closest cells first
+    if (requests.HasItems() && loadingCount < WorldPartition::MaxLoadingCells)
+    {
+        Sorting::QuickSort(requests.Get(), requests.Count());
+        for (int32 i = 0; i < requests.Count() && loadingCount < WorldPartition::MaxLoadingCells; i++)
+        {
+            auto& cell = Cells[requests[i].Index];
+            if (Level::FindScene(cell.Cell.SceneId))
+            {
+                // Scene has been loaded from outside
+                cell.State = WorldPartitionCellState::Loaded;
+                continue;
+            }
+            if (Level::LoadSceneAsync(cell.Cell.SceneId))
+            {
+                LOG(Warning, "Failed to load world partition cell {0}", cell.Cell.SceneId);
+                cell.State = WorldPartitionCellState::Failed;
+                continue;
+            }
+            cell.State = WorldPartitionCellState::Loading;
+            loadingCount++;
+        }
+    }
+}
+
+void WorldPartitionService::Dispose()
+{
+    Level::SceneLoaded.Unbind<&WorldPartitionService::OnSceneLoaded>();
+    Level::SceneLoadError.Unbind<&WorldPartitionService::OnSceneLoadError>();
+    Level::SceneUnloaded.Unbind<&WorldPartitionService::OnSceneUnloaded>();
+    ScopeLock lock(Level::ScenesLock);
+    Cells.Resize(0);
+    WorldPartition::Sources.Resize(0);
+    SourcesLocker.Lock();
+    LastSources.Resize(0);
+    SourcesLocker.Unlock();
+}
+
+void WorldPartitionService::OnSceneLoaded(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, WorldPartitionCellState::Loaded);
+}
+
+void WorldPartitionService::OnSceneLoadError(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, WorldPartitionCellState::Failed);
+}
+
+void WorldPartitionService::OnSceneUnloaded(Scene* scene, const Guid& sceneId)
+{
+    SetCellState(sceneId, WorldPartitionCellState::Unloaded);
+}
@@ -0,0 +1,150 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/Int3.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// The world partition cell streaming state.
+/// </summary>
+API_ENUM() enum class WorldPartitionCellState
+{
+    // Cell scene is not loaded.
+    Unloaded,
+    // Cell scene is during async loading.
+    Loading,
+    // Cell scene is loaded.
+    Loaded,
+    // Cell scene is during async unloading.
+    Unloading,
+    // Cell scene failed to load (it won't be streamed again until cell gets re-added).
+    Failed,
+};
+
+/// <summary>
+/// The world partition cell. Part of the level stored as a separate scene asset that can be streamed in/out at runtime.
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API WorldPartitionCell
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(WorldPartitionCell);
+
+    /// <summary>
+    /// The cell scene asset ID.
+    /// </summary>
+    API_FIELD() Guid SceneId;
+
+    /// <summary>
+    /// The cell bounds (in world-space). Used to calculate the distance to the streaming sources.
+    /// </summary>
+    API_FIELD() BoundingBox Bounds;
+};
+
+/// <summary>
+/// The world partition service. Streams the level cells (sub-scenes) in and out based on the distance to the streaming sources (eg. player cameras or server-side player positions). Uses async scene loading which is spread over multiple frames.
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API WorldPartition
+{
+DECLARE_SCRIPTING_TYPE_NO_SPAWN(WorldPartition);
+
+    /// <summary>
+    /// True if cells streaming is enabled, otherwise cells state will be kept.
+    /// </summary>
+    API_FIELD() static bool Enabled;
+
+    /// <summary>
+    /// The size of the single grid cell (in world units). Used to calculate grid cells coordinates and bounds.
+    /// </summary>
+    API_FIELD() static float CellSize;
+
+    /// <summary>
+    /// The distance (from the cell bounds to the closest streaming source) at which cell gets loaded.
+    /// </summary>
+    API_FIELD() static float LoadDistance;
+
+    /// <summary>
+    /// The distance (from the cell bounds to the closest streaming source) at which cell gets unloaded. Should be larger than load distance to prevent cells reloading when streaming source moves around the cell edge.
+    /// </summary>
+    API_FIELD() static float UnloadDistance;
+
+    /// <summary>
+    /// The maximum amount of cells loaded at once. Scenes are loaded one-by-one so higher values only increase the loading queue.
+    /// </summary>
+    API_FIELD() static int32 MaxLoadingCells;
+
+    /// <summary>
+    /// True if use the main camera position as a streaming source (in addition to the custom sources).
+    /// </summary>
+    API_FIELD() static bool UseMainCamera;
+
+    /// <summary>
+    /// The custom streaming sources locations (in world-space). Can be used to stream cells around players on a server or for multiple local players.
+    /// </summary>
+    API_FIELD() static Array<Vector3> Sources;
+
+public:
+    /// <summary>
+    /// Gets the grid cell coordinates that contain the given location.
+    /// </summary>
+    /// <param name="position">The location (in world-space).</param>
+    /// <returns>The cell coordinates.</returns>
+    API_FUNCTION() static Int3 GetCellCoordinate(const Vector3& position);
+
+    /// <summary>
+    /// Gets the grid cell bounds.
+    /// </summary>
+    /// <param name="coordinate">The cell coordinates.</param>
+    /// <returns>The cell bounds (in world-space).</returns>
+    API_FUNCTION() static BoundingBox GetCellBounds(const Int3& coordinate);
+
+    /// <summary>
+    /// Registers the cell for streaming.
+    /// </summary>
+    /// <param name="sceneId">The cell scene asset ID.</param>
+    /// <param name="bounds">The cell bounds (in world-space).</param>
+    API_FUNCTION() static void AddCell(const Guid& sceneId, const BoundingBox& bounds);
+
+    /// <summary>
+    /// Registers the grid cell for streaming.
+    /// </summary>
+    /// <param name="sceneId">The cell scene asset ID.</param>
+    /// <param name="coordinate">The cell coordinates.</param>
+    API_FUNCTION() static void AddCell(const Guid& sceneId, const Int3& coordinate)
+    {
+        AddCell(sceneId, GetCellBounds(coordinate));
+    }
+
+    /// <summary>
+    /// Unregisters the cell from streaming.
+    /// </summary>
+    /// <param name="sceneId">The cell scene asset ID.</param>
+    /// <param name="unload">True if unload the cell scene if it's loaded.</param>
+    /// <returns>True if cell has been removed, otherwise false.</returns>
+    API_FUNCTION() static bool RemoveCell(const Guid& sceneId, bool unload = true);
+
+    /// <summary>
+    /// Unregisters all cells from streaming.
+    /// </summary>
+    /// <param name="unload">True if unload the loaded cell scenes.</param>
+    API_FUNCTION() static void ClearCells(bool unload = true);
+
+    /// <summary>
+    /// Gets the registered cells.
+    /// </summary>
+    API_FUNCTION() static Array<WorldPartitionCell> GetCells();
+
+    /// <summary>
+    /// Gets the cell streaming state.
+    /// </summary>
+    /// <param name="sceneId">The cell scene asset ID.</param>
+    /// <returns>The cell state (unloaded if cell is not registered).</returns>
+    API_FUNCTION() static WorldPartitionCellState GetCellState(const Guid& sceneId);
+
+    /// <summary>
+    /// Gets the streaming sources locations (custom sources and the main camera) gathered during the last update. Can be used by other systems to stream the content around the same locations (eg. terrain collision). Thread-safe.
+    /// </summary>
+    API_FUNCTION() static Array<Vector3> GetStreamingSources();
+};
@@ -7,6 +7,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Config/GameSettings.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Platform/CriticalSection.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
@@ -27,41 +28,78 @@ class LocalizationService : public EngineService
     {
     }
 
+    // Lookup of the localized strings for the current language. Contains only the unique ids with the messages resolved from all tables (including fallbacks), packed into a single text buffer.
+    struct LookupText
+    {
+        int32 Offset;
+        int32 Length;
+    };
+
+    struct LookupEntry
+    {
+        LookupText Id;
+        int32 FirstMessage;
+        int32 MessagesCount;
+    };
+
+    CriticalSection LookupLocker;
+    uint32 LookupVersion = 1;
+    uint32 LookupBuiltVersion = 0;
+    Array<Char> LookupTextBuffer;
+    Array<LookupText> LookupMessages;
+    Array<LookupEntry> LookupEntries;
+    Dictionary<StringView, int32> LookupMap;
+
     void OnLocalizationChanged();
 
-    const String& Get(const String& id, int32 index, const String& fallback) const
+    FORCE_INLINE StringView GetLookupText(const LookupText& text) const
     {
-        if (id.IsEmpty())
-            return fallback;
+        return StringView(LookupTextBuffer.Get() + text.Offset, text.Length);
+    }
 
-        // Try current tables
-        for (auto& e : LocalizedStringTables)
-        {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
-        }
+    LookupText AddLookupText(const StringView& text)
+    {
+        LookupText result = { LookupTextBuffer.Count(), text.Length() };
+        LookupTextBuffer.Add(text.Get(), text.Length());
+        return result;
+    }
 
-        // Try fallback tables for current tables
-        for (auto& e : LocalizedStringTables)
-        {
-            const auto table = e.Get();
-            const auto fallbackTable = table ? table->FallbackTable.Get() : nullptr;
-            const auto messages = fallbackTable ? fallbackTable->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
-        }
+    void BuildLookup();
 
-        // Try fallback language tables
-        for (auto& e : FallbackStringTables)
+    // Gets the lookup entry index for the message id (validates the cached index first). Returns -1 if missing. Requires LookupLocker to be locked.
+    int32 FindLookup(const StringView& id, int32& cachedLookup, uint32& cachedVersion)
+    {
+        if (LookupBuiltVersion != LookupVersion)
+            BuildLookup();
+        if (cachedVersion != LookupBuiltVersion || (cachedLookup != -1 && GetLookupText(LookupEntries[cachedLookup].Id) != id))
         {
-            const auto table = e.Get();
-            const auto messages = table ? table->Entries.TryGet(id) : nullptr;
-            if (messages && messages->Count() > index)
-                return messages->At(index);
+            const int32* lookup = LookupMap.TryGet(id);
+            cachedLookup = lookup ? *lookup : -1;
+            cachedVersion = LookupBuiltVersion;
         }
+        return cachedLookup;
+    }
 
+    // Gets the message from the lookup entry. Requires LookupLocker to be locked.
+    bool GetLookup(int32 lookup, int32 index, StringView& result) const
+    {
+        if (lookup == -1 || index < 0)
+            return false;
+        const LookupEntry& entry = LookupEntries[lookup];
+        if (index >= entry.MessagesCount)
+            return false;
+        result = GetLookupText(LookupMessages[entry.FirstMessage + index]);
+        return true;
+    }
+
+    String Get(const StringView& id, int32 index, const String& fallback, int32& cachedLookup, uint32& cachedVersion)
+    {
+        if (id.IsEmpty())
+            return fallback;
+        ScopeLock lock(LookupLocker);
+        StringView result;
+        if (GetLookup(FindLookup(id, cachedLookup, cachedVersion), index, result))
+            return result;
         return fallback;
     }
 
@@ -89,12 +127,16 @@ void LocalizationSettings::Deserialize(DeserializeStream& stream, ISerializeModi
 LocalizedString::LocalizedString(const LocalizedString& other)
     : Id(other.Id)
     , Value(other.Value)
+    , _lookup(other._lookup)
+    , _lookupVersion(other._lookupVersion)
 {
 }
 
 LocalizedString::LocalizedString(LocalizedString&& other) noexcept
     : Id(MoveTemp(other.Id))
     , Value(MoveTemp(other.Value))
+    , _lookup(other._lookup)
+    , _lookupVersion(other._lookupVersion)
 {
 }
 
@@ -114,6 +156,8 @@ LocalizedString& LocalizedString::operator=(const LocalizedString& other)
     {
         Id = other.Id;
         Value = other.Value;
+        _lookup = other._lookup;
+        _lookupVersion = other._lookupVersion;
     }
     return *this;
 }
@@ -124,6 +168,8 @@ LocalizedString& LocalizedString::operator=(LocalizedString&& other) noexcept
     {
         Id = MoveTemp(other.Id);
         Value = MoveTemp(other.Value);
+        _lookup = other._lookup;
+        _lookupVersion = other._lookupVersion;
     }
     return *this;
 }
@@ -144,18 +190,103 @@ LocalizedString& LocalizedString::operator=(String&& value) noexcept
 
 String LocalizedString::ToString() const
 {
-    return Localization::GetString(Id, Value);
+    return Instance.Get(Id, 0, Value, _lookup, _lookupVersion);
 }
 
 String LocalizedString::ToStringPlural(int32 n) const
 {
-    return Localization::GetPluralString(Id, n, Value);
+    CHECK_RETURN(n >= 1, String::Format(Value.GetText(), n));
+    const String format = Instance.Get(Id, n - 1, Value, _lookup, _lookupVersion);
+    return String::Format(format.GetText(), n);
+}
+
+void LocalizationService::BuildLookup()
+{
+    PROFILE_CPU();
+    LookupBuiltVersion = LookupVersion;
+    LookupTextBuffer.Clear();
+    LookupMessages.Clear();
+    LookupEntries.Clear();
+    LookupMap.Clear();
+
+    // Collect tables in the order of lookup (current language tables, their fallback tables, fallback language tables)
+    Array<const LocalizedStringTable*, InlinedAllocation<32>> tables;
+    for (auto& e : LocalizedStringTables)
+    {
+        const auto table = e.Get();
+        if (table && table->IsLoaded() && !tables.Contains(table))
+            tables.Add(table);
+    }
+    for (auto& e : LocalizedStringTables)
+    {
+        const auto table = e.Get();
+        const auto fallbackTable = table ? table->FallbackTable.Get() : nullptr;
+        if (fallbackTable && fallbackTable->IsLoaded() && !tables.Contains(fallbackTable))
+            tables.Add(fallbackTable);
+    }
+    for (auto& e : FallbackStringTables)
+    {
+        const auto table = e.Get();
+        if (table && table->IsLoaded() && !tables.Contains(table))
+            tables.Add(table);
+    }
+
+    // Collect unique ids with the largest messages count
+    Dictionary<StringView, int32> ids;
+    int32 textLength = 0;
+    for (const LocalizedStringTable* table : tables)
+    {
+        for (auto& e : table->Entries)
+        {
+            int32* messagesCount = ids.TryGet(e.Key);
+            if (messagesCount)
+            {
+                *messagesCount = Math::Max(*messagesCount, e.Value.Count());
+            }
+            else
+            {
+                ids.Add(e.Key, e.Value.Count());
+                textLength += e.Key.Length();
+            }
+            for (const String& message : e.Value)
+                textLength += message.Length();
+        }
+    }
+    LookupEntries.EnsureCapacity(ids.Count());
+    LookupTextBuffer.EnsureCapacity(textLength);
+
+    // Resolve messages for each id (first table that contains the message with a given index)
+    for (auto& e : ids)
+    {
+        LookupEntry& entry = LookupEntries.AddOne();
+        entry.Id = AddLookupText(e.Key);
+        entry.FirstMessage = LookupMessages.Count();
+        entry.MessagesCount = e.Value;
+        for (int32 index = 0; index < e.Value; index++)
+        {
+            for (const LocalizedStringTable* table : tables)
+            {
+                const auto messages = table->Entries.TryGet(e.Key);
+                if (messages && messages->Count() > index)
+                {
+                    LookupMessages.Add(AddLookupText(messages->At(index)));
+                    break;
+                }
+            }
+        }
+    }
+
+    // Map ids into entries (after text buffer is filled so it doesn't get reallocated)
+    LookupMap.EnsureCapacity(LookupEntries.Count());
+    for (int32 i = 0; i < LookupEntries.Count(); i++)
+        LookupMap.Add(GetLookupText(LookupEntries[i].Id), i);
 }
 
 void LocalizationService::OnLocalizationChanged()
 {
     PROFILE_CPU();
 
+    Localization::InvalidateLookup();
     Instance.LocalizedStringTables.Clear();
     Instance.FallbackStringTables.Clear();
     const StringView en(TEXT("en"));
@@ -317,12 +448,24 @@ void Localization::SetCurrentLanguageCulture(const CultureInfo& value)
 
 String Localization::GetString(const String& id, const String& fallback)
 {
-    return Instance.Get(id, 0, fallback);
+    int32 lookup = -1;
+    uint32 lookupVersion = 0;
+    return Instance.Get(id, 0, fallback, lookup, lookupVersion);
 }
 
 String Localization::GetPluralString(const String& id, int32 n, const String& fallback)
 {
     CHECK_RETURN(n >= 1, String::Format(fallback.GetText(), n));
-    const String& format = Instance.Get(id, n - 1, fallback);
+    int32 lookup = -1;
+    uint32 lookupVersion = 0;
+    const String format = Instance.Get(id, n - 1, fallback, lookup, lookupVersion);
     return String::Format(format.GetText(), n);
 }
+
+void Localization::InvalidateLookup()
+{
+    ScopeLock lock(Instance.LookupLocker);
+    Instance.LookupVersion++;
+    if (Instance.LookupVersion == 0)
+        Instance.LookupVersion++;
+}
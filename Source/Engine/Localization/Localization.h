@@ -59,4 +59,9 @@ API_CLASS(Static) class FLAXENGINE_API Localization
     /// <param name="fallback">The optional fallback string value to use if localized string is missing.</param>
     /// <returns>The localized text.</returns>
     API_FUNCTION() static String GetPluralString(const String& id, int32 n, const String& fallback = String::Empty);
+
+    /// <summary>
+    /// Invalidates the lookup of the localized strings (built from the current language tables on the first use). Called automatically when localization changes or string tables get modified via AddString/AddPluralString or reloaded. Call it after modifying the table Entries directly.
+    /// </summary>
+    static void InvalidateLookup();
 };
@@ -22,6 +22,11 @@ API_CLASS(Sealed) class FLAXENGINE_API LocalizedString
     /// </summary>
     API_FIELD() String Value;
 
+private:
+    // Cached index of the localized strings lookup entry for the current Id (see Localization)
+    mutable int32 _lookup = -1;
+    mutable uint32 _lookupVersion = 0;
+
 public:
     LocalizedString() = default;
     LocalizedString(const LocalizedString& other);
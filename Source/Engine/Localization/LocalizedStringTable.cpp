@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "LocalizedStringTable.h"
+#include "Localization.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Serialization/JsonWriters.h"
 #include "Engine/Serialization/SerializationFwd.h"
@@ -23,6 +24,7 @@ void LocalizedStringTable::AddString(const StringView& id, const StringView& val
     auto& values = Entries[id];
     values.Resize(1);
     values[0] = value;
+    Localization::InvalidateLookup();
 }
 
 void LocalizedStringTable::AddPluralString(const StringView& id, const StringView& value, int32 n)
@@ -31,6 +33,7 @@ void LocalizedStringTable::AddPluralString(const StringView& id, const StringVie
     auto& values = Entries[id];
     values.Resize(Math::Max(values.Count(), n + 1));
     values[n] = value;
+    Localization::InvalidateLookup();
 }
 
 String LocalizedStringTable::GetString(const String& id) const
@@ -86,6 +89,7 @@ Asset::LoadResult LocalizedStringTable::loadAsset()
             }
         }
     }
+    Localization::InvalidateLookup();
 
     return result;
 }
@@ -98,6 +102,7 @@ void LocalizedStringTable::unload(bool isReloading)
     Locale.Clear();
     FallbackTable = nullptr;
     Entries.Clear();
+    Localization::InvalidateLookup();
 }
 
 void LocalizedStringTable::OnGetData(rapidjson_flax::StringBuffer& buffer) const
@@ -8,8 +8,27 @@
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/recastnavigation/DetourCrowd.h>
 
+namespace
+{
+    void CrowdParallelFor(void* userData, void (*job)(void* context, const int jobIndex), void* context, const int jobs)
+    {
+        if (!IsInMainThread())
+        {
+            // Crowd updated from a job thread so don't use nested jobs
+            for (int32 i = 0; i < jobs; i++)
+                job(context, i);
+            return;
+        }
+        JobSystem::Execute([job, context](int32 jobIndex)
+        {
+            job(context, jobIndex);
+        }, jobs);
+    }
+}
+
 NavCrowd::NavCrowd(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -82,7 +101,14 @@ bool NavCrowd::Init(float maxAgentRadius, int32 maxAgents, NavMeshRuntime* navMe
         }
     }
 
-    return !_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh());
+    if (!_crowd->init(maxAgents, maxAgentRadius, navMesh->GetNavMesh()))
+        return true;
+
+    // Use parallel update for large crowds
+    const int32 jobs = JobSystem::GetThreadsCount();
+    if (maxAgents >= DT_CROWD_MIN_PARALLEL_AGENTS && jobs > 1)
+        _crowd->setParallelFor(CrowdParallelFor, nullptr, jobs);
+    return false;
 }
 
 int32 NavCrowd::AddAgent(const Vector3& position, const NavAgentProperties& properties)
@@ -151,6 +177,64 @@ void NavCrowd::SetAgentMoveTarget(int32 id, const Vector3& position)
     _crowd->requestMoveTarget(id, startPoly, nearestPt.Raw);
 }
 
+void NavCrowd::GetAgentsPositions(const Span<int32>& ids, Array<Vector3>& positions) const
+{
+    positions.Resize(ids.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const dtCrowdAgent* agent = _crowd->getAgent(ids.Get()[i]);
+        positions.Get()[i] = agent ? Vector3(Float3(agent->npos)) : Vector3::Zero;
+    }
+}
+
+void NavCrowd::SetAgentsPositions(const Span<int32>& ids, const Span<Vector3>& positions)
+{
+    CHECK(ids.Length() == positions.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        dtCrowdAgent* agent = _crowd->getEditableAgent(ids.Get()[i]);
+        if (agent)
+            *(Float3*)agent->npos = Float3(positions.Get()[i]);
+    }
+}
+
+void NavCrowd::GetAgentsVelocities(const Span<int32>& ids, Array<Vector3>& velocities) const
+{
+    velocities.Resize(ids.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const dtCrowdAgent* agent = _crowd->getAgent(ids.Get()[i]);
+        velocities.Get()[i] = agent ? Vector3(Float3(agent->vel)) : Vector3::Zero;
+    }
+}
+
+void NavCrowd::SetAgentsVelocities(const Span<int32>& ids, const Span<Vector3>& velocities)
+{
+    CHECK(ids.Length() == velocities.Length());
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        dtCrowdAgent* agent = _crowd->getEditableAgent(ids.Get()[i]);
+        if (agent)
+            *(Float3*)agent->vel = Float3(velocities.Get()[i]);
+    }
+}
+
+void NavCrowd::SetAgentsMoveTargets(const Span<int32>& ids, const Span<Vector3>& positions)
+{
+    CHECK(ids.Length() == positions.Length());
+    const float* extent = _crowd->getQueryExtents();
+    const dtQueryFilter* filter = _crowd->getFilter(0);
+    const dtNavMeshQuery* query = _crowd->getNavMeshQuery();
+    for (int32 i = 0; i < ids.Length(); i++)
+    {
+        const Float3 pointNavMesh = positions.Get()[i];
+        dtPolyRef startPoly = 0;
+        Float3 nearestPt = pointNavMesh;
+        query->findNearestPoly(pointNavMesh.Raw, extent, filter, &startPoly, &nearestPt.X);
+        _crowd->requestMoveTarget(ids.Get()[i], startPoly, nearestPt.Raw);
+    }
+}
+
 void NavCrowd::SetAgentMoveVelocity(int32 id, const Vector3& velocity)
 {
     const Float3 v = velocity;
@@ -3,6 +3,8 @@
 #pragma once
 
 #include "Engine/Scripting/ScriptingObject.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
 #include "NavigationTypes.h"
 
 class NavMesh;
@@ -111,13 +113,50 @@ API_CLASS() class FLAXENGINE_API NavCrowd : public ScriptingObject
     /// <param name="id">The agent ID.</param>
     API_FUNCTION() void ResetAgentMove(int32 id);
 
+public:
+    /// <summary>
+    /// Gets the agents current positions.
+    /// </summary>
+    /// <param name="ids">The agents IDs.</param>
+    /// <param name="positions">The result agents positions (matching the input IDs order).</param>
+    API_FUNCTION() void GetAgentsPositions(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& positions) const;
+
+    /// <summary>
+    /// Sets the agents current positions.
+    /// </summary>
+    /// <param name="ids">The agents IDs.</param>
+    /// <param name="positions">The agents positions (matching the input IDs order).</param>
+    API_FUNCTION() void SetAgentsPositions(const Span<int32>& ids, const Span<Vector3>& positions);
+
+    /// <summary>
+    /// Gets the agents current velocities (direction * speed).
+    /// </summary>
+    /// <param name="ids">The agents IDs.</param>
+    /// <param name="velocities">The result agents velocities (matching the input IDs order).</param>
+    API_FUNCTION() void GetAgentsVelocities(const Span<int32>& ids, API_PARAM(Out) Array<Vector3>& velocities) const;
+
+    /// <summary>
+    /// Sets the agents current velocities (direction * speed).
+    /// </summary>
+    /// <param name="ids">The agents IDs.</param>
+    /// <param name="velocities">The agents velocities (matching the input IDs order).</param>
+    API_FUNCTION() void SetAgentsVelocities(const Span<int32>& ids, const Span<Vector3>& velocities);
+
+    /// <summary>
+    /// Updates the agents movement target positions.
+    /// </summary>
+    /// <param name="ids">The agents IDs.</param>
+    /// <param name="positions">The agents target positions (matching the input IDs order).</param>
+    API_FUNCTION() void SetAgentsMoveTargets(const Span<int32>& ids, const Span<Vector3>& positions);
+
+public:
     /// <summary>
     /// Removes the agent of the given ID.
     /// </summary>
     API_FUNCTION() void RemoveAgent(int32 id);
 
     /// <summary>
-    /// Updates the steering and positions of all agents.
+    /// Updates the steering and positions of all agents. Large crowds run the per-agent update phases (neighbours, steering, avoidance, integration and collisions) in parallel via Job System.
     /// </summary>
     /// <param name="dt">The simulation update delta time (in seconds).</param>
     API_FUNCTION() void Update(float dt);
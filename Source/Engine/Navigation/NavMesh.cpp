@@ -78,6 +78,7 @@ void NavMesh::ClearData()
         IsDataDirty = true;
         Data.TileSize = 0.0f;
         Data.Tiles.Resize(0);
+        Data.TileCache = {};
     }
 }
 
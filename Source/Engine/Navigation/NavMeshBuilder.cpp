@@ -21,11 +21,13 @@
 #include "Engine/Terrain/TerrainPatch.h"
 #include "Engine/Terrain/Terrain.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
 #include <ThirdParty/recastnavigation/Recast.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/recastnavigation/DetourTileCacheBuilder.h>
 
 int32 BoxTrianglesIndicesCache[] =
 {
@@ -59,6 +61,7 @@ struct OffMeshLink
     float Radius;
     bool BiDir;
     int32 Id;
+    BoundingBox Bounds;
 };
 
 struct Modifier
@@ -67,88 +70,53 @@ struct Modifier
     NavAreaProperties* NavArea;
 };
 
-struct NavSceneRasterizer
+// The navigation geometry of a single actor (or terrain patch) in navmesh space. Extracted on the first use and shared by all tiles that overlap it.
+struct NavGeometry
 {
-    NavMesh* NavMesh;
-    BoundingBox TileBoundsNavMesh;
-    Matrix WorldToNavMesh;
-    rcContext* Context;
-    rcConfig* Config;
-    rcHeightfield* Heightfield;
-    float WalkableThreshold;
+    ScriptingObjectReference<Actor> Actor;
+    int32 PatchIndex = -1;
+    BoundingBox BoundsNavMesh;
+    CriticalSection Locker;
+    int64 volatile Extracted = 0;
     Array<Float3> VertexBuffer;
     Array<int32> IndexBuffer;
-    Array<OffMeshLink>* OffMeshLinks;
-    Array<Modifier>* Modifiers;
-    const bool IsWorldToNavMeshIdentity;
+    Array<unsigned char> Areas;
+};
+
+// The navigation geometry collected once per build of the dirty region (shared by all tiles built in that region).
+struct NavGeometryCache
+{
+    ::NavMesh* NavMesh;
+    Matrix WorldToNavMesh;
+    bool IsWorldToNavMeshIdentity;
+    float WalkableThreshold;
+    Array<NavGeometry*> Geometry;
+    Array<OffMeshLink> OffMeshLinks;
+    Array<Modifier> Modifiers;
+    int64 volatile RefCount = 1;
 
-    NavSceneRasterizer(::NavMesh* navMesh, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, rcContext* context, rcConfig* config, rcHeightfield* heightfield, Array<OffMeshLink>* offMeshLinks, Array<Modifier>* modifiers)
-        : TileBoundsNavMesh(tileBoundsNavMesh)
+    NavGeometryCache(::NavMesh* navMesh, const Matrix& worldToNavMesh, const rcConfig& config)
+        : NavMesh(navMesh)
         , WorldToNavMesh(worldToNavMesh)
         , IsWorldToNavMeshIdentity(worldToNavMesh.IsIdentity())
+        , WalkableThreshold(Math::Cos(config.walkableSlopeAngle * DegreesToRadians))
     {
-        NavMesh = navMesh;
-        Context = context;
-        Config = config;
-        Heightfield = heightfield;
-        WalkableThreshold = Math::Cos(config->walkableSlopeAngle * DegreesToRadians);
-        OffMeshLinks = offMeshLinks;
-        Modifiers = modifiers;
     }
 
-    void RasterizeTriangles()
+    ~NavGeometryCache()
     {
-        auto& vb = VertexBuffer;
-        auto& ib = IndexBuffer;
-        if (vb.IsEmpty() || ib.IsEmpty())
-            return;
-        PROFILE_CPU();
-
-        // Rasterize triangles
-        const Float3* vbData = vb.Get();
-        const int32* ibData = ib.Get();
-        Float3 v0, v1, v2;
-        if (IsWorldToNavMeshIdentity)
-        {
-            // Faster path
-            for (int32 i0 = 0; i0 < ib.Count();)
-            {
-                v0 = vbData[ibData[i0++]];
-                v1 = vbData[ibData[i0++]];
-                v2 = vbData[ibData[i0++]];
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
-
-                auto n = Float3::Cross(v0 - v1, v0 - v2);
-                n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
-            }
-        }
-        else
-        {
-            // Transform vertices from world space into the navmesh space
-            const Matrix worldToNavMesh = WorldToNavMesh;
-            for (int32 i0 = 0; i0 < ib.Count();)
-            {
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v0);
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v1);
-                Float3::Transform(vbData[ibData[i0++]], worldToNavMesh, v2);
-#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
-                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
-#endif
+        Geometry.ClearDelete();
+    }
 
-                auto n = Float3::Cross(v0 - v1, v0 - v2);
-                n.Normalize();
-                const char area = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
-                rcRasterizeTriangle(Context, &v0.X, &v1.X, &v2.X, area, *Heightfield);
-            }
-        }
+    void AddRef()
+    {
+        Platform::InterlockedIncrement(&RefCount);
+    }
 
-        // Clear after use
-        vb.Clear();
-        ib.Clear();
+    void Release()
+    {
+        if (Platform::InterlockedDecrement(&RefCount) == 0)
+            Delete(this);
     }
 
     static void TriangulateBox(Array<Float3>& vb, Array<int32>& ib, const OrientedBoundingBox& box)
@@ -222,114 +190,209 @@ struct NavSceneRasterizer
         }
     }
 
-    void Rasterize(Actor* actor)
+    // Collects the navigation actors within the given bounds (called on a main thread).
+    void Collect(const BoundingBox& boundsNavMesh)
     {
-        if (const auto* boxCollider = dynamic_cast<BoxCollider*>(actor))
+        PROFILE_CPU_NAMED("CollectActors");
+        ScopeLock lock(Level::ScenesLock);
+        for (Scene* scene : Level::Scenes)
+        {
+            for (::Actor* actor : scene->Navigation.Actors)
+            {
+                BoundingBox actorBoxNavMesh;
+                BoundingBox::Transform(actor->GetBox(), WorldToNavMesh, actorBoxNavMesh);
+                if (actorBoxNavMesh.Intersects(boundsNavMesh) &&
+                    actor->IsActiveInHierarchy() &&
+                    EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Navigation))
+                {
+                    Collect(actor, actorBoxNavMesh, boundsNavMesh);
+                }
+            }
+        }
+    }
+
+    void Collect(::Actor* actor, const BoundingBox& actorBoxNavMesh, const BoundingBox& boundsNavMesh)
+    {
+        if (const auto* collider = dynamic_cast<Collider*>(actor))
         {
-            if (boxCollider->GetIsTrigger())
+            if (collider->GetIsTrigger())
                 return;
-            PROFILE_CPU_NAMED("BoxCollider");
+            if (dynamic_cast<const BoxCollider*>(collider) || dynamic_cast<const SphereCollider*>(collider) || dynamic_cast<const CapsuleCollider*>(collider) || dynamic_cast<const MeshCollider*>(collider) || dynamic_cast<const SplineCollider*>(collider))
+            {
+                auto geometry = New<NavGeometry>();
+                geometry->Actor = actor;
+                geometry->BoundsNavMesh = actorBoxNavMesh;
+                Geometry.Add(geometry);
+            }
+        }
+        else if (auto* terrain = dynamic_cast<Terrain*>(actor))
+        {
+            for (int32 patchIndex = 0; patchIndex < terrain->GetPatchesCount(); patchIndex++)
+            {
+                const auto patch = terrain->GetPatch(patchIndex);
+                BoundingBox patchBoundsNavMesh;
+                BoundingBox::Transform(patch->GetBounds(), WorldToNavMesh, patchBoundsNavMesh);
+                if (!patchBoundsNavMesh.Intersects(boundsNavMesh))
+                    continue;
+                auto geometry = New<NavGeometry>();
+                geometry->Actor = actor;
+                geometry->PatchIndex = patchIndex;
+                geometry->BoundsNavMesh = patchBoundsNavMesh;
+                Geometry.Add(geometry);
+            }
+        }
+        else if (const auto* navLink = dynamic_cast<NavLink*>(actor))
+        {
+            OffMeshLink link;
+            link.Start = navLink->GetTransform().LocalToWorld(navLink->Start);
+            Float3::Transform(link.Start, WorldToNavMesh, link.Start);
+            link.End = navLink->GetTransform().LocalToWorld(navLink->End);
+            Float3::Transform(link.End, WorldToNavMesh, link.End);
+            link.Radius = navLink->Radius;
+            link.BiDir = navLink->BiDirectional;
+            link.Id = GetHash(navLink->GetID());
+            link.Bounds = actorBoxNavMesh;
+            OffMeshLinks.Add(link);
+        }
+        else if (const auto* navModifierVolume = dynamic_cast<NavModifierVolume*>(actor))
+        {
+            if (navModifierVolume->AgentsMask.IsNavMeshSupported(NavMesh->Properties))
+            {
+                Modifier modifier;
+                OrientedBoundingBox bounds = navModifierVolume->GetOrientedBox();
+                bounds.Transform(WorldToNavMesh);
+                bounds.GetBoundingBox(modifier.Bounds);
+                modifier.NavArea = navModifierVolume->GetNavArea();
+                Modifiers.Add(modifier);
+            }
+        }
+    }
 
+    // Extracts the geometry triangles (called on a job thread by the first tile that uses it).
+    void Extract(NavGeometry& geometry)
+    {
+        auto& vb = geometry.VertexBuffer;
+        auto& ib = geometry.IndexBuffer;
+        ::Actor* actor = geometry.Actor.Get();
+        if (!actor)
+            return;
+        if (const auto* boxCollider = dynamic_cast<BoxCollider*>(actor))
+        {
+            PROFILE_CPU_NAMED("BoxCollider");
             const OrientedBoundingBox box = boxCollider->GetOrientedBox();
-            TriangulateBox(VertexBuffer, IndexBuffer, box);
-            RasterizeTriangles();
+            TriangulateBox(vb, ib, box);
         }
         else if (const auto* sphereCollider = dynamic_cast<SphereCollider*>(actor))
         {
-            if (sphereCollider->GetIsTrigger())
-                return;
             PROFILE_CPU_NAMED("SphereCollider");
-
             const BoundingSphere sphere = sphereCollider->GetSphere();
-            TriangulateSphere(VertexBuffer, IndexBuffer, sphere);
-            RasterizeTriangles();
+            TriangulateSphere(vb, ib, sphere);
         }
         else if (const auto* capsuleCollider = dynamic_cast<CapsuleCollider*>(actor))
         {
-            if (capsuleCollider->GetIsTrigger())
-                return;
             PROFILE_CPU_NAMED("CapsuleCollider");
-
             const BoundingBox box = capsuleCollider->GetBox();
-            TriangulateBox(VertexBuffer, IndexBuffer, box);
-            RasterizeTriangles();
+            TriangulateBox(vb, ib, box);
         }
         else if (const auto* meshCollider = dynamic_cast<MeshCollider*>(actor))
         {
-            if (meshCollider->GetIsTrigger())
-                return;
             PROFILE_CPU_NAMED("MeshCollider");
-
             auto collisionData = meshCollider->CollisionData.Get();
             if (!collisionData || collisionData->WaitForLoaded())
                 return;
-
-            collisionData->ExtractGeometry(VertexBuffer, IndexBuffer);
+            collisionData->ExtractGeometry(vb, ib);
             Matrix meshColliderToWorld;
             meshCollider->GetLocalToWorldMatrix(meshColliderToWorld);
-            for (auto& v : VertexBuffer)
+            for (auto& v : vb)
                 Float3::Transform(v, meshColliderToWorld, v);
-            RasterizeTriangles();
         }
-        else if (const auto* splineCollider = dynamic_cast<SplineCollider*>(actor))
+        else if (auto* splineCollider = dynamic_cast<SplineCollider*>(actor))
         {
-            if (splineCollider->GetIsTrigger())
-                return;
             PROFILE_CPU_NAMED("SplineCollider");
-
             auto collisionData = splineCollider->CollisionData.Get();
             if (!collisionData || collisionData->WaitForLoaded())
                 return;
-
-            splineCollider->ExtractGeometry(VertexBuffer, IndexBuffer);
-            RasterizeTriangles();
+            splineCollider->ExtractGeometry(vb, ib);
         }
-        else if (const auto* terrain = dynamic_cast<Terrain*>(actor))
+        else if (auto* terrain = dynamic_cast<Terrain*>(actor))
         {
             PROFILE_CPU_NAMED("Terrain");
-
-            for (int32 patchIndex = 0; patchIndex < terrain->GetPatchesCount(); patchIndex++)
-            {
-                const auto patch = terrain->GetPatch(patchIndex);
-                BoundingBox patchBoundsNavMesh;
-                BoundingBox::Transform(patch->GetBounds(), WorldToNavMesh, patchBoundsNavMesh);
-                if (!patchBoundsNavMesh.Intersects(TileBoundsNavMesh))
-                    continue;
-
-                // TODO: get collision only from tile area
-                patch->ExtractCollisionGeometry(VertexBuffer, IndexBuffer);
-                RasterizeTriangles();
-            }
+            const auto patch = terrain->GetPatch(geometry.PatchIndex);
+            if (!patch)
+                return;
+            // TODO: get collision only from tiles area
+            patch->ExtractCollisionGeometry(vb, ib);
         }
-        else if (const auto* navLink = dynamic_cast<NavLink*>(actor))
+        if (vb.IsEmpty() || ib.IsEmpty())
         {
-            PROFILE_CPU_NAMED("NavLink");
+            vb.Clear();
+            ib.Clear();
+            return;
+        }
 
-            OffMeshLink link;
-            link.Start = navLink->GetTransform().LocalToWorld(navLink->Start);
-            Float3::Transform(link.Start, WorldToNavMesh, link.Start);
-            link.End = navLink->GetTransform().LocalToWorld(navLink->End);
-            Float3::Transform(link.End, WorldToNavMesh, link.End);
-            link.Radius = navLink->Radius;
-            link.BiDir = navLink->BiDirectional;
-            link.Id = GetHash(navLink->GetID());
+        // Transform vertices from world space into the navmesh space
+        if (!IsWorldToNavMeshIdentity)
+        {
+            const Matrix worldToNavMesh = WorldToNavMesh;
+            for (auto& v : vb)
+                Float3::Transform(v, worldToNavMesh, v);
+        }
 
-            OffMeshLinks->Add(link);
+        // Mark triangles walkability
+        const int32 trianglesCount = ib.Count() / 3;
+        geometry.Areas.Resize(trianglesCount);
+        const Float3* vbData = vb.Get();
+        const int32* ibData = ib.Get();
+        for (int32 i = 0; i < trianglesCount; i++)
+        {
+            const Float3& v0 = vbData[ibData[i * 3 + 0]];
+            const Float3& v1 = vbData[ibData[i * 3 + 1]];
+            const Float3& v2 = vbData[ibData[i * 3 + 2]];
+            auto n = Float3::Cross(v0 - v1, v0 - v2);
+            n.Normalize();
+            geometry.Areas[i] = n.Y > WalkableThreshold ? RC_WALKABLE_AREA : RC_NULL_AREA;
         }
-        else if (const auto* navModifierVolume = dynamic_cast<NavModifierVolume*>(actor))
+    }
+
+    // Rasterizes the geometry overlapping the tile into the heightfield and gathers the tile links and modifiers.
+    void Rasterize(rcContext* context, rcHeightfield* heightfield, const BoundingBox& tileBoundsNavMesh, Array<OffMeshLink>& offMeshLinks, Array<Modifier>& modifiers)
+    {
+        PROFILE_CPU_NAMED("RasterizeGeometry");
+        for (NavGeometry* geometry : Geometry)
         {
-            if (navModifierVolume->AgentsMask.IsNavMeshSupported(NavMesh->Properties))
+            if (!geometry->BoundsNavMesh.Intersects(tileBoundsNavMesh))
+                continue;
+            if (Platform::AtomicRead(&geometry->Extracted) == 0)
             {
-                PROFILE_CPU_NAMED("NavModifierVolume");
-
-                Modifier modifier;
-                OrientedBoundingBox bounds = navModifierVolume->GetOrientedBox();
-                bounds.Transform(WorldToNavMesh);
-                bounds.GetBoundingBox(modifier.Bounds);
-                modifier.NavArea = navModifierVolume->GetNavArea();
-
-                Modifiers->Add(modifier);
+                ScopeLock lock(geometry->Locker);
+                if (Platform::AtomicRead(&geometry->Extracted) == 0)
+                {
+                    Extract(*geometry);
+                    Platform::AtomicStore(&geometry->Extracted, 1);
+                }
+            }
+            if (geometry->Areas.IsEmpty())
+                continue;
+#if NAV_MESH_BUILD_DEBUG_DRAW_GEOMETRY
+            for (int32 i0 = 0; i0 < geometry->IndexBuffer.Count();)
+            {
+                const Float3& v0 = geometry->VertexBuffer[geometry->IndexBuffer[i0++]];
+                const Float3& v1 = geometry->VertexBuffer[geometry->IndexBuffer[i0++]];
+                const Float3& v2 = geometry->VertexBuffer[geometry->IndexBuffer[i0++]];
+                DEBUG_DRAW_TRIANGLE(v0, v1, v2, Color::Orange.AlphaMultiplied(0.3f), 1.0f, true);
             }
+#endif
+            rcRasterizeTriangles(context, &geometry->VertexBuffer.Get()->X, geometry->VertexBuffer.Count(), geometry->IndexBuffer.Get(), geometry->Areas.Get(), geometry->Areas.Count(), *heightfield);
+        }
+        for (const OffMeshLink& link : OffMeshLinks)
+        {
+            if (link.Bounds.Intersects(tileBoundsNavMesh))
+                offMeshLinks.Add(link);
+        }
+        for (const Modifier& modifier : Modifiers)
+        {
+            if (modifier.Bounds.Intersects(tileBoundsNavMesh))
+                modifiers.Add(modifier);
         }
     }
 };
@@ -403,7 +466,122 @@ void RemoveTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int
     runtime->RemoveTile(x, y, layer);
 }
 
-bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize, rcConfig& config)
+void RemoveTiles(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, int32 minLayer)
+{
+    ScopeLock lock(runtime->Locker);
+
+    // Remove all tile layers at the given location (starting from the given layer)
+    for (int32 i = navMesh->Data.Tiles.Count() - 1; i >= 0; i--)
+    {
+        auto& tile = navMesh->Data.Tiles[i];
+        if (tile.PosX == x && tile.PosY == y && tile.Layer >= minLayer)
+        {
+            runtime->RemoveTile(x, y, tile.Layer);
+            navMesh->Data.Tiles.RemoveAt(i);
+            navMesh->IsDataDirty = true;
+        }
+    }
+}
+
+bool GenerateTileLayers(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, rcConfig& config, rcContext& context, rcCompactHeightfield* compactHeightfield)
+{
+    rcHeightfieldLayerSet* layerSet = rcAllocHeightfieldLayerSet();
+    if (!layerSet)
+    {
+        LOG(Warning, "Could not generate navmesh: Out of memory for heightfield layers.");
+        return true;
+    }
+    {
+        PROFILE_CPU_NAMED("BuildHeightfieldLayers");
+        if (!rcBuildHeightfieldLayers(&context, *compactHeightfield, config.borderSize, config.walkableHeight, *layerSet))
+        {
+            LOG(Warning, "Could not generate navmesh: Could not build heightfield layers.");
+            return true;
+        }
+    }
+    rcFreeCompactHeightfield(compactHeightfield);
+
+    // Compress layers (navmesh tiles are built from them at runtime by the tile cache)
+    const int32 layersCount = layerSet->nlayers;
+    Array<BytesContainer> layersData;
+    layersData.Resize(layersCount);
+    {
+        PROFILE_CPU_NAMED("BuildTileCacheLayers");
+        for (int32 i = 0; i < layersCount; i++)
+        {
+            const rcHeightfieldLayer& layer = layerSet->layers[i];
+            dtTileCacheLayerHeader header;
+            header.magic = DT_TILECACHE_MAGIC;
+            header.version = DT_TILECACHE_VERSION;
+            header.tx = x;
+            header.ty = y;
+            header.tlayer = i;
+            rcVcopy(header.bmin, layer.bmin);
+            rcVcopy(header.bmax, layer.bmax);
+            header.width = (unsigned char)layer.width;
+            header.height = (unsigned char)layer.height;
+            header.minx = (unsigned char)layer.minx;
+            header.maxx = (unsigned char)layer.maxx;
+            header.miny = (unsigned char)layer.miny;
+            header.maxy = (unsigned char)layer.maxy;
+            header.hmin = (unsigned short)layer.hmin;
+            header.hmax = (unsigned short)layer.hmax;
+            unsigned char* data = nullptr;
+            int dataSize = 0;
+            if (dtStatusFailed(dtBuildTileCacheLayer(NavMeshRuntime::GetTileCacheCompressor(), &header, layer.heights, layer.areas, layer.cons, &data, &dataSize)))
+            {
+                LOG(Warning, "Could not generate navmesh: Could not build tile cache layer.");
+                rcFreeHeightfieldLayerSet(layerSet);
+                return true;
+            }
+            layersData[i].Copy(data, dataSize);
+            dtFree(data);
+        }
+    }
+    rcFreeHeightfieldLayerSet(layerSet);
+
+    {
+        PROFILE_CPU_NAMED("CreateTiles");
+
+        ScopeLock lock(runtime->Locker);
+
+        // Remove layers that are not used anymore
+        RemoveTiles(navMesh, runtime, x, y, layersCount);
+
+        navMesh->IsDataDirty = true;
+        for (int32 layer = 0; layer < layersCount; layer++)
+        {
+            NavMeshTileData* tile = nullptr;
+            for (int32 i = 0; i < navMesh->Data.Tiles.Count(); i++)
+            {
+                auto& e = navMesh->Data.Tiles[i];
+                if (e.PosX == x && e.PosY == y && e.Layer == layer)
+                {
+                    tile = &e;
+                    break;
+                }
+            }
+            if (!tile)
+            {
+                // Add new tile
+                tile = &navMesh->Data.Tiles.AddOne();
+                tile->PosX = x;
+                tile->PosY = y;
+                tile->Layer = layer;
+            }
+
+            // Copy data to the tile
+            tile->Data.Copy(layersData[layer]);
+
+            // Add tile to navmesh
+            runtime->AddTile(navMesh, *tile);
+        }
+    }
+
+    return false;
+}
+
+bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, NavGeometryCache* geometry, int32 x, int32 y, BoundingBox& tileBoundsNavMesh, rcConfig& config)
 {
     rcContext context;
     int32 layer = 0;
@@ -430,37 +608,7 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
 
     Array<OffMeshLink> offMeshLinks;
     Array<Modifier> modifiers;
-    {
-        PROFILE_CPU_NAMED("RasterizeGeometry");
-        NavSceneRasterizer rasterizer(navMesh, tileBoundsNavMesh, worldToNavMesh, &context, &config, heightfield, &offMeshLinks, &modifiers);
-
-        // Collect actors to rasterize
-        Array<Actor*> actors;
-        {
-            PROFILE_CPU_NAMED("CollectActors");
-            ScopeLock lock(Level::ScenesLock);
-            for (Scene* scene : Level::Scenes)
-            {
-                for (Actor* actor : scene->Navigation.Actors)
-                {
-                    BoundingBox actorBoxNavMesh;
-                    BoundingBox::Transform(actor->GetBox(), rasterizer.WorldToNavMesh, actorBoxNavMesh);
-                    if (actorBoxNavMesh.Intersects(rasterizer.TileBoundsNavMesh) &&
-                        actor->IsActiveInHierarchy() &&
-                        EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Navigation))
-                    {
-                        actors.Add(actor);
-                    }
-                }
-            }
-        }
-
-        // Rasterize actors
-        for (Actor* actor : actors)
-        {
-            rasterizer.Rasterize(actor);
-        }
-    }
+    geometry->Rasterize(&context, heightfield, tileBoundsNavMesh, offMeshLinks, modifiers);
 
     {
         PROFILE_CPU_NAMED("FilterHeightfield");
@@ -505,6 +653,12 @@ bool GenerateTile(NavMesh* navMesh, NavMeshRuntime* runtime, int32 x, int32 y, B
         }
     }
 
+    if (navMesh->Data.TileCache.Enabled)
+    {
+        // Tile cache is not used when there are off-mesh links (see BuildDirtyBounds)
+        return GenerateTileLayers(navMesh, runtime, x, y, config, context, compactHeightfield);
+    }
+
     {
         PROFILE_CPU_NAMED("BuildDistanceField");
         if (!rcBuildDistanceField(&context, *compactHeightfield))
@@ -746,11 +900,10 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     Scene* Scene;
     ScriptingObjectReference<NavMesh> NavMesh;
     NavMeshRuntime* Runtime;
+    NavGeometryCache* Geometry;
     BoundingBox TileBoundsNavMesh;
-    Matrix WorldToNavMesh;
     int32 X;
     int32 Y;
-    float TileSize;
     rcConfig Config;
 
 public:
@@ -758,10 +911,11 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     bool Run() override
     {
         PROFILE_CPU_NAMED("BuildNavMeshTile");
+        PROFILE_MEM(Navigation);
         const auto navMesh = NavMesh.Get();
         if (!navMesh)
             return false;
-        if (GenerateTile(NavMesh, Runtime, X, Y, TileBoundsNavMesh, WorldToNavMesh, TileSize, Config))
+        if (GenerateTile(NavMesh, Runtime, Geometry, X, Y, TileBoundsNavMesh, Config))
         {
             LOG(Warning, "Failed to generate navmesh tile at {0}x{1}.", X, Y);
         }
@@ -771,10 +925,17 @@ class NavMeshTileBuildTask : public ThreadPoolTask
     void OnEnd() override
     {
         // Remove from tasks list
-        ScopeLock lock(NavBuildTasksLocker);
-        NavBuildTasks.Remove(this);
-        if (NavBuildTasks.IsEmpty())
-            NavBuildTasksMaxCount = 0;
+        {
+            ScopeLock lock(NavBuildTasksLocker);
+            NavBuildTasks.Remove(this);
+            if (NavBuildTasks.IsEmpty())
+                NavBuildTasksMaxCount = 0;
+        }
+        if (Geometry)
+        {
+            Geometry->Release();
+            Geometry = nullptr;
+        }
     }
 };
 
@@ -840,7 +1001,7 @@ float NavMeshBuilder::GetNavMeshBuildingProgress()
     return result;
 }
 
-void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh, const Matrix& worldToNavMesh, float tileSize)
+void BuildTileAsync(NavMesh* navMesh, NavGeometryCache* geometry, const int32 x, const int32 y, const rcConfig& config, const BoundingBox& tileBoundsNavMesh)
 {
     NavMeshRuntime* runtime = navMesh->GetRuntime();
     NavBuildTasksLocker.Lock();
@@ -861,11 +1022,11 @@ void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConf
     task->Scene = navMesh->GetScene();
     task->NavMesh = navMesh;
     task->Runtime = runtime;
+    task->Geometry = geometry;
+    geometry->AddRef();
     task->X = x;
     task->Y = y;
     task->TileBoundsNavMesh = tileBoundsNavMesh;
-    task->WorldToNavMesh = worldToNavMesh;
-    task->TileSize = tileSize;
     task->Config = config;
     NavBuildTasks.Add(task);
     NavBuildTasksMaxCount++;
@@ -876,6 +1037,20 @@ void BuildTileAsync(NavMesh* navMesh, const int32 x, const int32 y, const rcConf
     task->Start();
 }
 
+bool HasNavLinks()
+{
+    ScopeLock lock(Level::ScenesLock);
+    for (Scene* scene : Level::Scenes)
+    {
+        for (Actor* actor : scene->Navigation.Actors)
+        {
+            if (dynamic_cast<NavLink*>(actor) && actor->IsActiveInHierarchy() && EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Navigation))
+                return true;
+        }
+    }
+    return false;
+}
+
 void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBounds, bool rebuild)
 {
     const float tileSize = GetTileSize();
@@ -896,11 +1071,43 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
     const int32 tilesX = tilesMax.X - tilesMin.X;
     const int32 tilesY = tilesMax.Z - tilesMin.Z;
 
+    // Initialize nav mesh configuration
+    rcConfig config;
+    InitConfig(config, navMesh);
+
+    // Setup tile cache (compressed tiles layers are used to build navmesh tiles at runtime with the dynamic obstacles)
+    NavMeshTileCacheParams tileCache = {};
+    auto& settings = *NavigationSettings::Get();
+    if (settings.UseTileCache)
+    {
+        if (config.tileSize > 255)
+        {
+            LOG(Warning, "Navmesh tile cache supports tile size up to 255 cells (current: {0}). Using static navmesh tiles instead.", config.tileSize);
+        }
+        else if (HasNavLinks())
+        {
+            LOG(Warning, "Navmesh tile cache doesn't support off-mesh links (Nav Link actors). Using static navmesh tiles instead.");
+        }
+        else
+        {
+            auto& agent = navMesh->Properties.Agent;
+            tileCache.Enabled = 1;
+            tileCache.CellSize = config.cs;
+            tileCache.CellHeight = config.ch;
+            tileCache.TileCells = config.tileSize;
+            tileCache.WalkableHeight = agent.Height;
+            tileCache.WalkableRadius = agent.Radius;
+            tileCache.WalkableClimb = agent.StepHeight;
+            tileCache.MaxSimplificationError = config.maxSimplificationError;
+        }
+    }
+
     {
         PROFILE_CPU_NAMED("Prepare");
 
         // Prepare scene data and navmesh
         rebuild |= Math::NotNearEqual(navMesh->Data.TileSize, tileSize);
+        rebuild |= Platform::MemoryCompare(&navMesh->Data.TileCache, &tileCache, sizeof(NavMeshTileCacheParams)) != 0;
         if (rebuild)
         {
             // Remove all tiles from navmesh runtime
@@ -910,6 +1117,7 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
 
             // Remove all tiles from navmesh data
             navMesh->Data.TileSize = tileSize;
+            navMesh->Data.TileCache = tileCache;
             navMesh->Data.Tiles.Clear();
             navMesh->Data.Tiles.EnsureCapacity(tilesX * tilesX);
             navMesh->IsDataDirty = true;
@@ -922,11 +1130,17 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
         }
     }
 
-    // Initialize nav mesh configuration
-    rcConfig config;
-    InitConfig(config, navMesh);
-
-    // Generate all tiles that intersect with the navigation volume bounds
+    // Collect the navigation geometry once for all tiles (including the tiles border)
+    const float tileBorderSize = (1.0f + (float)config.borderSize) * config.cs;
+    BoundingBox geometryBoundsNavMesh = dirtyBoundsAligned;
+    geometryBoundsNavMesh.Minimum -= tileBorderSize;
+    geometryBoundsNavMesh.Maximum += tileBorderSize;
+    geometryBoundsNavMesh.Minimum.Y = -NAV_MESH_TILE_MAX_EXTENT;
+    geometryBoundsNavMesh.Maximum.Y = NAV_MESH_TILE_MAX_EXTENT;
+    NavGeometryCache* geometry = New<NavGeometryCache>(navMesh, worldToNavMesh, config);
+    geometry->Collect(geometryBoundsNavMesh);
+
+    // Generate all tiles that intersect with the navigation volume bounds (tiles are built in parallel via Thread Pool and added to the navmesh one-by-one once ready)
     {
         PROFILE_CPU_NAMED("StartBuildingTiles");
 
@@ -937,15 +1151,16 @@ void BuildDirtyBounds(Scene* scene, NavMesh* navMesh, const BoundingBox& dirtyBo
                 BoundingBox tileBoundsNavMesh;
                 if (GetNavMeshTileBounds(scene, navMesh, x, y, tileSize, tileBoundsNavMesh, worldToNavMesh))
                 {
-                    BuildTileAsync(navMesh, x, y, config, tileBoundsNavMesh, worldToNavMesh, tileSize);
+                    BuildTileAsync(navMesh, geometry, x, y, config, tileBoundsNavMesh);
                 }
                 else
                 {
-                    RemoveTile(navMesh, runtime, x, y, 0);
+                    RemoveTiles(navMesh, runtime, x, y, 0);
                 }
             }
         }
     }
+    geometry->Release();
 }
 
 void BuildDirtyBounds(Scene* scene, const BoundingBox& dirtyBounds, bool rebuild)
@@ -9,10 +9,11 @@ void NavMeshData::Save(WriteStream& stream)
 {
     // Write header
     NavMeshDataHeader header;
-    header.Version = 1;
+    header.Version = 2;
     header.TileSize = TileSize;
     header.TilesCount = Tiles.Count();
     stream.Write(header);
+    stream.Write(TileCache);
 
     // Write tiles
     for (int32 tileIndex = 0; tileIndex < Tiles.Count(); tileIndex++)
@@ -50,7 +51,7 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
 
     // Read header
     const auto header = stream.Move<NavMeshDataHeader>();
-    if (header->Version != 1)
+    if (header->Version != 1 && header->Version != 2)
     {
         LOG(Warning, "Invalid valid navmesh data version {0}.", header->Version);
         return true;
@@ -62,6 +63,10 @@ bool NavMeshData::Load(BytesContainer& data, bool copyData)
     }
     TileSize = header->TileSize;
     Tiles.Resize(header->TilesCount);
+    if (header->Version >= 2)
+        TileCache = *stream.Move<NavMeshTileCacheParams>();
+    else
+        TileCache = {};
 
     // Read tiles
     for (int32 tileIndex = 0; tileIndex < Tiles.Count(); tileIndex++)
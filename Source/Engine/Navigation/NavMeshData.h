@@ -30,6 +30,23 @@ struct NavMeshDataHeader
     int32 TilesCount;
 };
 
+/// <summary>
+/// The navmesh tile cache parameters used to build the compressed layers (navmesh space).
+/// </summary>
+struct NavMeshTileCacheParams
+{
+    // True if tiles contain the compressed tile cache layers, otherwise tiles contain the ready-to-use navmesh data.
+    int32 Enabled;
+    float CellSize;
+    float CellHeight;
+    // The size of the tile (in cells).
+    int32 TileCells;
+    float WalkableHeight;
+    float WalkableRadius;
+    float WalkableClimb;
+    float MaxSimplificationError;
+};
+
 class NavMeshData
 {
 public:
@@ -43,6 +60,11 @@ class NavMeshData
     /// </summary>
     Array<NavMeshTileData> Tiles;
 
+    /// <summary>
+    /// The tile cache parameters. If enabled, then tiles contain the compressed heightfield layers that are used to build the navmesh tiles at runtime (supports dynamic obstacles).
+    /// </summary>
+    NavMeshTileCacheParams TileCache = {};
+
 public:
     /// <summary>
     /// Saves the navmesh tiles to the specified stream.
@@ -6,25 +6,177 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include "Engine/Threading/Threading.h"
 #include <ThirdParty/recastnavigation/DetourNavMesh.h>
+#include <ThirdParty/recastnavigation/DetourNavMeshBuilder.h>
 #include <ThirdParty/recastnavigation/DetourNavMeshQuery.h>
+#include <ThirdParty/recastnavigation/DetourTileCache.h>
+#include <ThirdParty/recastnavigation/DetourTileCacheBuilder.h>
 #include <ThirdParty/recastnavigation/RecastAlloc.h>
+#include <ThirdParty/LZ4/lz4.h>
 
 #define MAX_NODES 2048
+#define MAX_PATH_REQUESTS_NODES 8192
 #define USE_DATA_LINK 0
 #define USE_NAV_MESH_ALLOC 1
+#define MAX_TILE_CACHE_UPDATES 16
 // TODO: try not using USE_NAV_MESH_ALLOC
 
 namespace
 {
+    struct TileCacheCompressor : dtTileCacheCompressor
+    {
+        int maxCompressedSize(const int bufferSize) override
+        {
+            return LZ4_compressBound(bufferSize);
+        }
+
+        dtStatus compress(const unsigned char* buffer, const int bufferSize, unsigned char* compressed, const int maxCompressedSize, int* compressedSize) override
+        {
+            *compressedSize = LZ4_compress_default((const char*)buffer, (char*)compressed, bufferSize, maxCompressedSize);
+            return *compressedSize > 0 ? DT_SUCCESS : DT_FAILURE;
+        }
+
+        dtStatus decompress(const unsigned char* compressed, const int compressedSize, unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+        {
+            *bufferSize = LZ4_decompress_safe((const char*)compressed, (char*)buffer, compressedSize, maxBufferSize);
+            return *bufferSize >= 0 ? DT_SUCCESS : DT_FAILURE;
+        }
+    };
+
+    struct TileCacheMeshProcess : dtTileCacheMeshProcess
+    {
+        void process(dtNavMeshCreateParams* params, unsigned char* polyAreas, unsigned short* polyFlags) override
+        {
+            // Match the flags used by the navmesh builder
+            for (int i = 0; i < params->polyCount; i++)
+                polyFlags[i] = polyAreas[i] != DT_TILECACHE_NULL_AREA ? 1 : 0;
+        }
+    };
+
+    TileCacheCompressor TileCacheCompressorInstance;
+    TileCacheMeshProcess TileCacheMeshProcessInstance;
+    dtTileCacheAlloc TileCacheAllocInstance;
+
     FORCE_INLINE void InitFilter(dtQueryFilter& filter)
     {
         Platform::MemoryCopy(filter.m_areaCost, NavMeshRuntime::NavAreasCosts, sizeof(NavMeshRuntime::NavAreasCosts));
         static_assert(sizeof(dtQueryFilter::m_areaCost) == sizeof(NavMeshRuntime::NavAreasCosts), "Invalid navmesh area cost list.");
     }
+
+    bool BuildPath(const NavMeshProperties& properties, const dtNavMeshQuery* query, dtStatus findPathStatus, dtPolyRef startPoly, const Vector3& startPosition, const Float3& startPositionNavMesh, Float3 endPositionNavMesh, const dtPolyRef* path, int32 pathSize, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+    {
+        Quaternion invRotation;
+        Quaternion::Invert(properties.Rotation, invRotation);
+
+        if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
+        {
+            resultFlags |= NavMeshPathFlags::PartialPath;
+            // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
+            resultPath.Resize(2);
+            resultPath[0] = startPosition;
+            query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
+            resultPath[1] = endPositionNavMesh;
+            Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
+        }
+        else
+        {
+            int pathPointsCount = 0;
+            Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
+            const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
+            if (dtStatusFailed(findStraightPathStatus))
+            {
+                return false;
+            }
+            resultPath.Resize(pathPointsCount);
+            for (int32 i = 0; i < pathPointsCount; i++)
+            {
+                Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
+            }
+        }
+
+        return true;
+    }
 }
 
+struct NavMeshPathRequest
+{
+    Vector3 StartPosition;
+    Vector3 EndPosition;
+    Float3 StartPositionNavMesh;
+    Float3 EndPositionNavMesh;
+    dtPolyRef StartPoly;
+    dtQueryFilter Filter;
+    NavMeshPathRequestState State;
+    NavMeshPathFlags Flags;
+    Array<Vector3, HeapAllocation> Path;
+};
+
+// Concurrent navmesh read access. Multiple queries can run at once (each using a separate query object from the pool) unless navmesh is being modified.
+struct NavMeshQueryScope
+{
+    const NavMeshRuntime* Runtime;
+    dtNavMeshQuery* Query = nullptr;
+    bool Locked = false;
+
+    NavMeshQueryScope(const NavMeshRuntime* runtime, bool acquireQuery = true)
+        : Runtime(runtime)
+    {
+        Platform::InterlockedIncrement(&runtime->_queriesActive);
+        if (Platform::AtomicRead(&runtime->_modifying) != 0)
+        {
+            // Navmesh is being modified so wait for it (or it's the same thread that modifies it)
+            Platform::InterlockedDecrement(&runtime->_queriesActive);
+            runtime->Locker.Lock();
+            Locked = true;
+        }
+        if (acquireQuery && runtime->_navMesh)
+            Query = runtime->AcquireQuery();
+    }
+
+    ~NavMeshQueryScope()
+    {
+        if (Query)
+            Runtime->ReleaseQuery(Query);
+        if (Locked)
+            Runtime->Locker.Unlock();
+        else
+            Platform::InterlockedDecrement(&Runtime->_queriesActive);
+    }
+
+    FORCE_INLINE operator bool() const
+    {
+        return Query != nullptr;
+    }
+
+    FORCE_INLINE dtNavMeshQuery* operator->() const
+    {
+        return Query;
+    }
+};
+
+// Exclusive navmesh write access. Waits for the active queries to end.
+struct NavMeshModifyScope
+{
+    NavMeshRuntime* Runtime;
+
+    NavMeshModifyScope(NavMeshRuntime* runtime)
+        : Runtime(runtime)
+    {
+        runtime->Locker.Lock();
+        Platform::InterlockedIncrement(&runtime->_modifying);
+        while (Platform::AtomicRead(&runtime->_queriesActive) != 0)
+            Platform::Sleep(0);
+    }
+
+    ~NavMeshModifyScope()
+    {
+        Platform::InterlockedDecrement(&Runtime->_modifying);
+        Runtime->Locker.Unlock();
+    }
+};
+
 NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     : ScriptingObject(SpawnParams(Guid::New(), NavMeshRuntime::TypeInitializer))
     , Properties(properties)
@@ -32,12 +184,15 @@ NavMeshRuntime::NavMeshRuntime(const NavMeshProperties& properties)
     _navMesh = nullptr;
     _navMeshQuery = dtAllocNavMeshQuery();
     _tileSize = 0;
+    PROFILE_LOCK(Locker, "NavMeshRuntime::Locker");
 }
 
 NavMeshRuntime::~NavMeshRuntime()
 {
     Dispose();
     dtFreeNavMeshQuery(_navMeshQuery);
+    for (auto& e : _pathRequests)
+        Delete(e.Value);
 }
 
 int32 NavMeshRuntime::GetTilesCapacity() const
@@ -47,9 +202,8 @@ int32 NavMeshRuntime::GetTilesCapacity() const
 
 bool NavMeshRuntime::FindDistanceToWall(const Vector3& startPosition, NavMeshHit& hitInfo, float maxDistance) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -79,9 +233,8 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
 {
     resultPath.Clear();
     resultFlags = NavMeshPathFlags::None;
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -107,43 +260,13 @@ bool NavMeshRuntime::FindPath(const Vector3& startPosition, const Vector3& endPo
         return false;
     }
 
-    Quaternion invRotation;
-    Quaternion::Invert(Properties.Rotation, invRotation);
-
-    if (pathSize == 1 && dtStatusDetail(findPathStatus, DT_PARTIAL_RESULT))
-    {
-        resultFlags |= NavMeshPathFlags::PartialPath;
-        // TODO: skip adding 2nd end point if it's not reachable (use navmesh raycast check? or physics check? or local Z distance check?)
-        resultPath.Resize(2);
-        resultPath[0] = startPosition;
-        query->closestPointOnPolyBoundary(startPoly, &endPositionNavMesh.X, &endPositionNavMesh.X);
-        resultPath[1] = endPositionNavMesh;
-        Vector3::Transform(resultPath[1], invRotation, resultPath[1]);
-    }
-    else
-    {
-        int pathPointsCount = 0;
-        Float3 pathPoints[NAV_MESH_PATH_MAX_SIZE];
-        const auto findStraightPathStatus = query->findStraightPath(&startPositionNavMesh.X, &endPositionNavMesh.X, path, pathSize, (float*)&pathPoints, nullptr, nullptr, &pathPointsCount, NAV_MESH_PATH_MAX_SIZE, DT_STRAIGHTPATH_AREA_CROSSINGS);
-        if (dtStatusFailed(findStraightPathStatus))
-        {
-            return false;
-        }
-        resultPath.Resize(pathPointsCount);
-        for (int32 i = 0; i < pathPointsCount; i++)
-        {
-            Vector3::Transform(pathPoints[i], invRotation, resultPath[i]);
-        }
-    }
-
-    return true;
+    return BuildPath(Properties, query.Query, findPathStatus, startPoly, startPosition, startPositionNavMesh, endPositionNavMesh, path, pathSize, resultPath, resultFlags);
 }
 
 bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPosition) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -174,9 +297,8 @@ bool NavMeshRuntime::TestPath(const Vector3& startPosition, const Vector3& endPo
 
 bool NavMeshRuntime::FindClosestPoint(const Vector3& point, Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -200,9 +322,8 @@ bool NavMeshRuntime::FindClosestPoint(const Vector3& point, Vector3& result) con
 
 bool NavMeshRuntime::FindRandomPoint(Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -222,9 +343,8 @@ bool NavMeshRuntime::FindRandomPoint(Vector3& result) const
 
 bool NavMeshRuntime::FindRandomPointAroundCircle(const Vector3& center, float radius, Vector3& result) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -252,9 +372,8 @@ bool NavMeshRuntime::FindRandomPointAroundCircle(const Vector3& center, float ra
 
 bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPosition, NavMeshHit& hitInfo) const
 {
-    ScopeLock lock(Locker);
-    const auto query = GetNavMeshQuery();
-    if (!query || !_navMesh)
+    NavMeshQueryScope query(this);
+    if (!query)
         return false;
 
     dtQueryFilter filter;
@@ -288,9 +407,236 @@ bool NavMeshRuntime::RayCast(const Vector3& startPosition, const Vector3& endPos
     return result;
 }
 
+uint32 NavMeshRuntime::RequestPath(const Vector3& startPosition, const Vector3& endPosition)
+{
+    auto request = New<NavMeshPathRequest>();
+    request->StartPosition = startPosition;
+    request->EndPosition = endPosition;
+    request->State = NavMeshPathRequestState::Pending;
+    request->Flags = NavMeshPathFlags::None;
+    ScopeLock lock(_pathRequestsLocker);
+    uint32 id = ++_pathRequestsCounter;
+    if (id == 0)
+        id = ++_pathRequestsCounter;
+    _pathRequests.Add(id, request);
+    _pathRequestsQueue.Add(id);
+    return id;
+}
+
+NavMeshPathRequestState NavMeshRuntime::GetPathRequestState(uint32 requestId)
+{
+    ScopeLock lock(_pathRequestsLocker);
+    NavMeshPathRequest* request;
+    if (_pathRequests.TryGet(requestId, request))
+        return request->State;
+    return NavMeshPathRequestState::Invalid;
+}
+
+NavMeshPathRequestState NavMeshRuntime::GetPathRequestResult(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags)
+{
+    resultPath.Clear();
+    resultFlags = NavMeshPathFlags::None;
+    ScopeLock lock(_pathRequestsLocker);
+    NavMeshPathRequest* request;
+    if (!_pathRequests.TryGet(requestId, request))
+        return NavMeshPathRequestState::Invalid;
+    const NavMeshPathRequestState state = request->State;
+    if (state != NavMeshPathRequestState::Pending)
+    {
+        resultPath = MoveTemp(request->Path);
+        resultFlags = request->Flags;
+        _pathRequests.Remove(requestId);
+        Delete(request);
+    }
+    return state;
+}
+
+void NavMeshRuntime::CancelPathRequest(uint32 requestId)
+{
+    ScopeLock lock(_pathRequestsLocker);
+    NavMeshPathRequest* request;
+    if (!_pathRequests.TryGet(requestId, request))
+        return;
+    if (request->State == NavMeshPathRequestState::Pending)
+    {
+        if (_pathRequestActive == requestId)
+            _pathRequestActive = 0;
+        else
+            _pathRequestsQueue.Remove(requestId);
+    }
+    _pathRequests.Remove(requestId);
+    Delete(request);
+}
+
+void NavMeshRuntime::UpdatePathRequests(int32 maxIterations)
+{
+    ScopeLock lock(_pathRequestsLocker);
+    if (_pathRequestActive == 0 && _pathRequestsQueue.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("NavMeshRuntime.UpdatePathRequests");
+    NavMeshQueryScope scope(this, false);
+    dtNavMeshQuery* query = _navMeshQuery;
+    if (_pathRequestActive != 0 && _pathRequestVersion != _navMeshVersion)
+    {
+        // Navmesh has been reinitialized so restart the request
+        _pathRequestsQueue.Insert(0, _pathRequestActive);
+        _pathRequestActive = 0;
+    }
+    while (maxIterations > 0)
+    {
+        NavMeshPathRequest* request;
+        if (_pathRequestActive == 0)
+        {
+            // Start the next request
+            if (_pathRequestsQueue.IsEmpty())
+                break;
+            const uint32 id = _pathRequestsQueue[0];
+            _pathRequestsQueue.RemoveAtKeepOrder(0);
+            request = _pathRequests[id];
+            request->State = NavMeshPathRequestState::Failed;
+            if (!_navMesh)
+                continue;
+            InitFilter(request->Filter);
+            Float3 extent = Properties.DefaultQueryExtent;
+            Float3::Transform(request->StartPosition, Properties.Rotation, request->StartPositionNavMesh);
+            Float3::Transform(request->EndPosition, Properties.Rotation, request->EndPositionNavMesh);
+            request->StartPoly = 0;
+            if (!dtStatusSucceed(query->findNearestPoly(&request->StartPositionNavMesh.X, &extent.X, &request->Filter, &request->StartPoly, nullptr)))
+                continue;
+            dtPolyRef endPoly = 0;
+            if (!dtStatusSucceed(query->findNearestPoly(&request->EndPositionNavMesh.X, &extent.X, &request->Filter, &endPoly, nullptr)))
+                continue;
+            if (dtStatusFailed(query->initSlicedFindPath(request->StartPoly, endPoly, &request->StartPositionNavMesh.X, &request->EndPositionNavMesh.X, &request->Filter)))
+                continue;
+            request->State = NavMeshPathRequestState::Pending;
+            _pathRequestActive = id;
+            _pathRequestVersion = _navMeshVersion;
+        }
+        else
+        {
+            request = _pathRequests[_pathRequestActive];
+        }
+
+        // Perform the pathfinding iterations
+        int doneIterations = 0;
+        dtStatus status = query->updateSlicedFindPath(maxIterations, &doneIterations);
+        maxIterations -= Math::Max(doneIterations, 1);
+        if (dtStatusInProgress(status))
+            continue;
+        _pathRequestActive = 0;
+        request->State = NavMeshPathRequestState::Failed;
+        if (dtStatusFailed(status))
+            continue;
+
+        // Build the result path
+        dtPolyRef path[NAV_MESH_PATH_MAX_SIZE];
+        int32 pathSize;
+        status = query->finalizeSlicedFindPath(path, &pathSize, NAV_MESH_PATH_MAX_SIZE);
+        if (dtStatusFailed(status))
+            continue;
+        if (BuildPath(Properties, query, status, request->StartPoly, request->StartPosition, request->StartPositionNavMesh, request->EndPositionNavMesh, path, pathSize, request->Path, request->Flags))
+            request->State = NavMeshPathRequestState::Succeeded;
+    }
+}
+
+uint32 NavMeshRuntime::AddObstacle(const Vector3& position, float radius, float height)
+{
+    NavMeshObstacle obstacle;
+    obstacle.Ref = 0;
+    obstacle.IsBox = false;
+    Float3::Transform(position, Properties.Rotation, obstacle.Position);
+    obstacle.Size = Float3(radius, height, 0.0f);
+    obstacle.Yaw = 0.0f;
+    NavMeshModifyScope lock(this);
+    AddObstacleInternal(obstacle);
+    if (_tileCache && obstacle.Ref == 0)
+        return 0;
+    uint32 id = ++_obstaclesCounter;
+    if (id == 0)
+        id = ++_obstaclesCounter;
+    _obstacles.Add(id, obstacle);
+    return id;
+}
+
+uint32 NavMeshRuntime::AddBoxObstacle(const Vector3& center, const Vector3& halfExtents, float yaw)
+{
+    NavMeshObstacle obstacle;
+    obstacle.Ref = 0;
+    obstacle.IsBox = true;
+    Float3::Transform(center, Properties.Rotation, obstacle.Position);
+    obstacle.Size = halfExtents;
+    obstacle.Yaw = yaw * DegreesToRadians;
+    NavMeshModifyScope lock(this);
+    AddObstacleInternal(obstacle);
+    if (_tileCache && obstacle.Ref == 0)
+        return 0;
+    uint32 id = ++_obstaclesCounter;
+    if (id == 0)
+        id = ++_obstaclesCounter;
+    _obstacles.Add(id, obstacle);
+    return id;
+}
+
+void NavMeshRuntime::RemoveObstacle(uint32 obstacleId)
+{
+    NavMeshModifyScope lock(this);
+    NavMeshObstacle obstacle;
+    if (!_obstacles.TryGet(obstacleId, obstacle))
+        return;
+    _obstacles.Remove(obstacleId);
+    if (!_tileCache || obstacle.Ref == 0)
+        return;
+    dtStatus result;
+    for (int32 i = 0; i <= MAX_TILE_CACHE_UPDATES; i++)
+    {
+        result = _tileCache->removeObstacle(obstacle.Ref);
+        if (!dtStatusDetail(result, DT_BUFFER_TOO_SMALL) || !_navMesh)
+            break;
+
+        // Requests queue is full so flush it (requests are processed once pending tiles are rebuilt)
+        _tileCache->update(0.0f, _navMesh);
+    }
+    if (dtStatusFailed(result))
+    {
+        LOG(Warning, "Could not remove obstacle from navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE);
+        return;
+    }
+    _tileCacheDirty = true;
+}
+
+void NavMeshRuntime::UpdateTileCache()
+{
+    if (!_tileCacheDirty)
+        return;
+    PROFILE_CPU_NAMED("NavMeshRuntime.UpdateTileCache");
+    NavMeshModifyScope lock(this);
+    if (!_tileCache || !_navMesh)
+    {
+        _tileCacheDirty = false;
+        return;
+    }
+
+    // Rebuild the tiles touched by the obstacles changes (limited amount of tiles per-frame)
+    bool upToDate = false;
+    for (int32 i = 0; i < MAX_TILE_CACHE_UPDATES && !upToDate; i++)
+    {
+        if (dtStatusFailed(_tileCache->update(0.0f, _navMesh, &upToDate)))
+        {
+            LOG(Warning, "Failed to update navmesh {0} tile cache", Properties.Name);
+            break;
+        }
+    }
+    _tileCacheDirty = !upToDate;
+}
+
+dtTileCacheCompressor* NavMeshRuntime::GetTileCacheCompressor()
+{
+    return &TileCacheCompressorInstance;
+}
+
 void NavMeshRuntime::SetTileSize(float tileSize)
 {
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
 
     // Skip if the same or invalid
     if (Math::NearEqual(_tileSize, tileSize) || tileSize < 1)
@@ -307,7 +653,7 @@ void NavMeshRuntime::SetTileSize(float tileSize)
 
 void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
 {
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
     const int32 newTilesCount = _tiles.Count() + tilesToAddCount;
     const int32 capacity = GetTilesCapacity();
     if (newTilesCount <= capacity)
@@ -338,12 +684,14 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     // Initialize nav mesh
     if (!_navMesh)
         _navMesh = dtAllocNavMesh();
+    _navMeshVersion++;
+    ClearQueries();
     if (dtStatusFailed(_navMesh->init(&params)))
     {
         LOG(Error, "Navmesh {0} init failed", Properties.Name);
         return;
     }
-    if (dtStatusFailed(_navMeshQuery->init(_navMesh, MAX_NODES)))
+    if (dtStatusFailed(_navMeshQuery->init(_navMesh, MAX_PATH_REQUESTS_NODES)))
     {
         LOG(Error, "Navmesh query {0} init failed", Properties.Name);
     }
@@ -354,6 +702,8 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
     // Restore previous tiles
     for (auto& tile : _tiles)
     {
+        if (tile.Compressed)
+            continue;
         const int32 dataSize = tile.Data.Length();
 #if USE_NAV_MESH_ALLOC
         const auto flags = DT_TILE_FREE_DATA;
@@ -369,6 +719,12 @@ void NavMeshRuntime::EnsureCapacity(int32 tilesToAddCount)
             LOG(Warning, "Could not add tile ({2}x{3}, layer {4}) to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tile.X, tile.Y, tile.Layer);
         }
     }
+
+    // Restore compressed tiles (tile cache capacity has to match the navmesh)
+    if (_tileCache)
+    {
+        InitTileCache(_tileCacheParams, newCapacity);
+    }
 }
 
 void NavMeshRuntime::AddTiles(NavMesh* navMesh)
@@ -378,7 +734,7 @@ void NavMeshRuntime::AddTiles(NavMesh* navMesh)
         return;
     auto& data = navMesh->Data;
     PROFILE_CPU_NAMED("NavMeshRuntime.AddTiles");
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
 
     // Validate data (must match navmesh) or init navmesh to match the tiles options
     if (_navMesh)
@@ -409,7 +765,7 @@ void NavMeshRuntime::AddTile(NavMesh* navMesh, NavMeshTileData& tileData)
     ASSERT(navMesh);
     auto& data = navMesh->Data;
     PROFILE_CPU_NAMED("NavMeshRuntime.AddTile");
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
 
     // Validate data (must match navmesh) or init navmesh to match the tiles options
     if (_navMesh)
@@ -444,25 +800,17 @@ void NavMeshRuntime::RemoveTiles(NavMesh* navMesh)
 
 void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
 {
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
     if (!_navMesh)
         return;
     PROFILE_CPU_NAMED("NavMeshRuntime.RemoveTile");
 
-    const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
-    if (tileRef == 0)
-        return;
-
-    if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
-    {
-        LOG(Warning, "Failed to remove tile ({1}x{2}, layer {3}) from navmesh {0}", Properties.Name, x, y, layer);
-    }
-
     for (int32 i = 0; i < _tiles.Count(); i++)
     {
         auto& tile = _tiles[i];
         if (tile.X == x && tile.Y == y && tile.Layer == layer)
         {
+            RemoveTileInternal(x, y, layer, tile.Compressed);
             _tiles.RemoveAt(i);
             break;
         }
@@ -471,7 +819,7 @@ void NavMeshRuntime::RemoveTile(int32 x, int32 y, int32 layer)
 
 void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMesh, const NavMeshTile& tile, void* customData), void* userData)
 {
-    ScopeLock lock(Locker);
+    NavMeshModifyScope lock(this);
     ASSERT(prediction);
     if (!_navMesh)
         return;
@@ -482,19 +830,7 @@ void NavMeshRuntime::RemoveTiles(bool (*prediction)(const NavMeshRuntime* navMes
         auto& tile = _tiles[i];
         if (prediction(this, tile, userData))
         {
-            const auto tileRef = _navMesh->getTileRefAt(tile.X, tile.Y, tile.Layer);
-            if (tileRef == 0)
-            {
-                LOG(Warning, "Missing navmesh {3} tile at {0}x{1}, layer: {2}", tile.X, tile.Y, tile.Layer, Properties.Name);
-            }
-            else
-            {
-                if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
-                {
-                    LOG(Warning, "Failed to remove tile ({1}x{2}, layer {3}) from navmesh {0}", Properties.Name, tile.X, tile.Y, tile.Layer);
-                }
-            }
-
+            RemoveTileInternal(tile.X, tile.Y, tile.Layer, tile.Compressed);
             _tiles.RemoveAt(i--);
         }
     }
@@ -609,39 +945,107 @@ void NavMeshRuntime::DebugDraw()
 
 void NavMeshRuntime::Dispose()
 {
+    NavMeshModifyScope lock(this);
+    if (_tileCache)
+    {
+        dtFreeTileCache(_tileCache);
+        _tileCache = nullptr;
+        _tileCacheDirty = false;
+
+        // Keep the obstacles to be added again once the tile cache gets created
+        for (auto& e : _obstacles)
+            e.Value.Ref = 0;
+    }
     if (_navMesh)
     {
         dtFreeNavMesh(_navMesh);
         _navMesh = nullptr;
+        _navMeshVersion++;
     }
+    ClearQueries();
     _tiles.Resize(0);
 }
 
-void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData)
+dtNavMeshQuery* NavMeshRuntime::AcquireQuery() const
 {
-    // Check if that tile has been added to navmesh
-    NavMeshTile* tile = nullptr;
-    const auto tileRef = _navMesh->getTileRefAt(tileData.PosX, tileData.PosY, tileData.Layer);
-    if (tileRef)
+    _queriesLocker.Lock();
+    dtNavMeshQuery* query = _queriesPool.HasItems() ? _queriesPool.Pop() : nullptr;
+    _queriesLocker.Unlock();
+    if (!query)
     {
-        // Remove any existing tile at that location
-        if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+        query = dtAllocNavMeshQuery();
+        if (dtStatusFailed(query->init(_navMesh, MAX_NODES)))
         {
-            LOG(Warning, "Failed to remove tile from navmesh {0}", Properties.Name);
+            LOG(Error, "Navmesh query {0} init failed", Properties.Name);
+            dtFreeNavMeshQuery(query);
+            query = nullptr;
         }
+    }
+    return query;
+}
+
+void NavMeshRuntime::ReleaseQuery(dtNavMeshQuery* query) const
+{
+    ScopeLock lock(_queriesLocker);
+    _queriesPool.Add(query);
+}
 
-        // Reuse tile data container
-        for (int32 i = 0; i < _tiles.Count(); i++)
+void NavMeshRuntime::ClearQueries()
+{
+    // Called when navmesh gets modified (no query is in use) so the next queries run on a new navmesh
+    ScopeLock lock(_queriesLocker);
+    for (dtNavMeshQuery* query : _queriesPool)
+        dtFreeNavMeshQuery(query);
+    _queriesPool.Clear();
+}
+
+void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData)
+{
+    const bool compressed = navMesh->Data.TileCache.Enabled != 0;
+    if (compressed)
+    {
+        // Compressed tiles are built via tile cache that uses the same parameters for all tiles
+        if (!_tileCache)
+        {
+            if (InitTileCache(navMesh->Data.TileCache, GetTilesCapacity()))
+                return;
+        }
+        else if (Platform::MemoryCompare(&_tileCacheParams, &navMesh->Data.TileCache, sizeof(NavMeshTileCacheParams)) != 0)
         {
-            auto& e = _tiles[i];
-            if (e.X == tileData.PosX && e.Y == tileData.PosY && e.Layer == tileData.Layer)
+            bool hasCompressedTiles = false;
+            for (const auto& e : _tiles)
+                hasCompressedTiles |= e.Compressed;
+            if (hasCompressedTiles)
             {
-                tile = &e;
-                break;
+                LOG(Warning, "Cannot add compressed tile ({1}x{2}, layer {3}) to navmesh {0}. Tile cache parameters don't match.", Properties.Name, tileData.PosX, tileData.PosY, tileData.Layer);
+                return;
             }
+
+            // None of the tiles use the old parameters so recreate the tile cache
+            if (InitTileCache(navMesh->Data.TileCache, GetTilesCapacity()))
+                return;
         }
     }
-    if (!tile)
+
+    // Check if that tile has been added to navmesh
+    NavMeshTile* tile = nullptr;
+    for (int32 i = 0; i < _tiles.Count(); i++)
+    {
+        auto& e = _tiles[i];
+        if (e.X == tileData.PosX && e.Y == tileData.PosY && e.Layer == tileData.Layer)
+        {
+            // Reuse tile data container
+            tile = &e;
+            break;
+        }
+    }
+    if (tile)
+    {
+        // Remove any existing tile at that location (compressed tile gets replaced in the tile cache)
+        if (!tile->Compressed || !compressed)
+            RemoveTileInternal(tile->X, tile->Y, tile->Layer, tile->Compressed);
+    }
+    else
     {
         // Add tile
         tile = &_tiles.AddOne();
@@ -652,11 +1056,17 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
     tile->X = tileData.PosX;
     tile->Y = tileData.PosY;
     tile->Layer = tileData.Layer;
+    tile->Compressed = compressed;
 #if USE_DATA_LINK
 	tile->Data.Link(tileData.Data);
 #else
     tile->Data.Copy(tileData.Data);
 #endif
+    if (compressed)
+    {
+        AddCompressedTile(*tile);
+        return;
+    }
 
     // Add tile to navmesh
     const int32 dataSize = tile->Data.Length();
@@ -674,3 +1084,125 @@ void NavMeshRuntime::AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData
         LOG(Warning, "Could not add tile ({2}x{3}, layer {4}) to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tileData.PosX, tileData.PosY, tileData.Layer);
     }
 }
+
+void NavMeshRuntime::AddCompressedTile(NavMeshTile& tile)
+{
+    // Replace any existing layer at that location
+    dtCompressedTileRef tileRef = _tileCache->getTileRef(_tileCache->getTileAt(tile.X, tile.Y, tile.Layer));
+    if (tileRef)
+        _tileCache->removeTile(tileRef, nullptr, nullptr);
+
+    // Add layer to the tile cache
+    const int32 dataSize = tile.Data.Length();
+    const auto data = (byte*)dtAlloc(dataSize, DT_ALLOC_PERM);
+    Platform::MemoryCopy(data, tile.Data.Get(), dataSize);
+    auto result = _tileCache->addTile(data, dataSize, DT_COMPRESSEDTILE_FREE_DATA, &tileRef);
+    if (dtStatusFailed(result))
+    {
+        dtFree(data);
+        LOG(Warning, "Could not add compressed tile ({2}x{3}, layer {4}) to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tile.X, tile.Y, tile.Layer);
+        return;
+    }
+
+    // Build navmesh tile from it (with obstacles carved)
+    result = _tileCache->buildNavMeshTile(tileRef, _navMesh);
+    if (dtStatusFailed(result))
+    {
+        LOG(Warning, "Could not build tile ({2}x{3}, layer {4}) for navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE, tile.X, tile.Y, tile.Layer);
+    }
+}
+
+bool NavMeshRuntime::InitTileCache(const NavMeshTileCacheParams& params, int32 capacity)
+{
+    PROFILE_CPU_NAMED("NavMeshRuntime.InitTileCache");
+    if (_tileCache)
+        dtFreeTileCache(_tileCache);
+    _tileCache = dtAllocTileCache();
+    _tileCacheParams = params;
+
+    // Initialize tile cache to match the navmesh
+    dtTileCacheParams tileCacheParams;
+    Platform::MemoryClear(&tileCacheParams, sizeof(tileCacheParams));
+    tileCacheParams.cs = params.CellSize;
+    tileCacheParams.ch = params.CellHeight;
+    tileCacheParams.width = params.TileCells;
+    tileCacheParams.height = params.TileCells;
+    tileCacheParams.walkableHeight = params.WalkableHeight;
+    tileCacheParams.walkableRadius = params.WalkableRadius;
+    tileCacheParams.walkableClimb = params.WalkableClimb;
+    tileCacheParams.maxSimplificationError = params.MaxSimplificationError;
+    tileCacheParams.maxTiles = Math::Max(capacity, 1);
+    tileCacheParams.maxObstacles = Math::Clamp(NavigationSettings::Get()->MaxObstacles, 1, (int32)MAX_uint16);
+    if (dtStatusFailed(_tileCache->init(&tileCacheParams, &TileCacheAllocInstance, &TileCacheCompressorInstance, &TileCacheMeshProcessInstance)))
+    {
+        LOG(Error, "Navmesh {0} tile cache init failed", Properties.Name);
+        dtFreeTileCache(_tileCache);
+        _tileCache = nullptr;
+        return true;
+    }
+
+    // Restore obstacles (queued and carved during next update)
+    for (auto& e : _obstacles)
+    {
+        e.Value.Ref = 0;
+        AddObstacleInternal(e.Value);
+    }
+
+    // Restore compressed tiles
+    for (auto& tile : _tiles)
+    {
+        if (tile.Compressed)
+            AddCompressedTile(tile);
+    }
+
+    return false;
+}
+
+void NavMeshRuntime::AddObstacleInternal(NavMeshObstacle& obstacle)
+{
+    if (!_tileCache)
+        return;
+    dtObstacleRef obstacleRef = 0;
+    dtStatus result;
+    for (int32 i = 0; i <= MAX_TILE_CACHE_UPDATES; i++)
+    {
+        if (obstacle.IsBox)
+            result = _tileCache->addBoxObstacle(&obstacle.Position.X, &obstacle.Size.X, obstacle.Yaw, &obstacleRef);
+        else
+            result = _tileCache->addObstacle(&obstacle.Position.X, obstacle.Size.X, obstacle.Size.Y, &obstacleRef);
+        if (!dtStatusDetail(result, DT_BUFFER_TOO_SMALL) || !_navMesh)
+            break;
+
+        // Requests queue is full so flush it (requests are processed once pending tiles are rebuilt)
+        _tileCache->update(0.0f, _navMesh);
+    }
+    if (dtStatusFailed(result))
+    {
+        LOG(Warning, "Could not add obstacle to navmesh {0} (error: {1})", Properties.Name, result & ~DT_FAILURE);
+        return;
+    }
+    obstacle.Ref = obstacleRef;
+    _tileCacheDirty = true;
+}
+
+void NavMeshRuntime::RemoveTileInternal(int32 x, int32 y, int32 layer, bool compressed)
+{
+    if (compressed && _tileCache)
+    {
+        const dtCompressedTileRef tileRef = _tileCache->getTileRef(_tileCache->getTileAt(x, y, layer));
+        if (tileRef)
+            _tileCache->removeTile(tileRef, nullptr, nullptr);
+    }
+
+    const auto tileRef = _navMesh->getTileRefAt(x, y, layer);
+    if (tileRef == 0)
+    {
+        // Compressed tile can have empty navmesh tile (eg. fully carved by obstacles)
+        if (!compressed)
+            LOG(Warning, "Missing navmesh {3} tile at {0}x{1}, layer: {2}", x, y, layer, Properties.Name);
+    }
+    else if (dtStatusFailed(_navMesh->removeTile(tileRef, nullptr, nullptr)))
+    {
+        LOG(Warning, "Failed to remove tile ({1}x{2}, layer {3}) from navmesh {0}", Properties.Name, x, y, layer);
+    }
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "NavMeshData.h"
@@ -10,7 +11,10 @@
 
 class dtNavMesh;
 class dtNavMeshQuery;
+class dtTileCache;
+struct dtTileCacheCompressor;
 class NavMesh;
+struct NavMeshPathRequest;
 
 /// <summary>
 /// The navigation mesh tile data.
@@ -23,6 +27,24 @@ class FLAXENGINE_API NavMeshTile
     int32 Layer;
     NavMesh* NavMesh;
     BytesContainer Data;
+    // True if tile data is a compressed tile cache layer (navmesh tile is built from it at runtime), otherwise data contains the navmesh tile.
+    bool Compressed;
+};
+
+/// <summary>
+/// The navigation mesh dynamic obstacle (carved from the navmesh tile cache).
+/// </summary>
+struct NavMeshObstacle
+{
+    // The tile cache obstacle reference (0 if not added yet).
+    uint32 Ref;
+    bool IsBox;
+    // The obstacle position (navmesh space). Cylinder bottom center or box center.
+    Float3 Position;
+    // The obstacle size (navmesh space). Cylinder (radius, height) or box half-extents.
+    Float3 Size;
+    // The box rotation around the up axis (in radians).
+    float Yaw;
 };
 
 /// <summary>
@@ -64,10 +86,34 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 #endif
 
 private:
+    friend struct NavMeshQueryScope;
+    friend struct NavMeshModifyScope;
     dtNavMesh* _navMesh;
     dtNavMeshQuery* _navMeshQuery;
     float _tileSize;
     Array<NavMeshTile> _tiles;
+    uint32 _navMeshVersion = 0;
+
+    // Pool of the queries used by the concurrent navmesh queries (eg. from multiple job threads)
+    mutable CriticalSection _queriesLocker;
+    mutable Array<dtNavMeshQuery*> _queriesPool;
+    mutable int64 volatile _queriesActive = 0;
+    int64 volatile _modifying = 0;
+
+    // Async path requests processed by the sliced pathfinding (see UpdatePathRequests)
+    CriticalSection _pathRequestsLocker;
+    Dictionary<uint32, NavMeshPathRequest*> _pathRequests;
+    Array<uint32> _pathRequestsQueue;
+    uint32 _pathRequestsCounter = 0;
+    uint32 _pathRequestActive = 0;
+    uint32 _pathRequestVersion = 0;
+
+    // Tile cache used by the compressed tiles to carve the dynamic obstacles (see NavigationSettings::UseTileCache)
+    dtTileCache* _tileCache = nullptr;
+    NavMeshTileCacheParams _tileCacheParams = {};
+    Dictionary<uint32, NavMeshObstacle> _obstacles;
+    uint32 _obstaclesCounter = 0;
+    bool _tileCacheDirty = false;
 
 public:
     NavMeshRuntime(const NavMeshProperties& properties);
@@ -97,6 +143,7 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
         return _navMesh;
     }
 
+    // Gets the navmesh query used by the async path requests processing (main thread only). Navmesh queries are using a pool of query objects to run concurrently.
     dtNavMeshQuery* GetNavMeshQuery() const
     {
         return _navMeshQuery;
@@ -190,6 +237,90 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo) const;
 
+public:
+    /// <summary>
+    /// Requests the async path finding between the two positions. Requests are processed by the navigation service update with the limited amount of work per-frame (see Navigation::MaxPathRequestsIterations) which prevents stalls when many agents request the path at once.
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <returns>The path request identifier used to query the result. Returns 0 if failed.</returns>
+    API_FUNCTION() uint32 RequestPath(const Vector3& startPosition, const Vector3& endPosition);
+
+    /// <summary>
+    /// Gets the async path request state.
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    /// <returns>The request state.</returns>
+    API_FUNCTION() NavMeshPathRequestState GetPathRequestState(uint32 requestId);
+
+    /// <summary>
+    /// Gets the async path request result. Releases the request if it has been completed (succeeded or failed).
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    /// <param name="resultPath">The result path. Valid only if request succeeded.</param>
+    /// <returns>The request state.</returns>
+    API_FUNCTION() NavMeshPathRequestState GetPathRequestResult(uint32 requestId, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath)
+    {
+        NavMeshPathFlags flags;
+        return GetPathRequestResult(requestId, resultPath, flags);
+    }
+
+    /// <summary>
+    /// Gets the async path request result. Releases the request if it has been completed (succeeded or failed).
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    /// <param name="resultPath">The result path. Valid only if request succeeded.</param>
+    /// <param name="resultFlags">The result path flags.</param>
+    /// <returns>The request state.</returns>
+    NavMeshPathRequestState GetPathRequestResult(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath, NavMeshPathFlags& resultFlags);
+
+    /// <summary>
+    /// Cancels the async path request (pending or completed) and releases it.
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    API_FUNCTION() void CancelPathRequest(uint32 requestId);
+
+    /// <summary>
+    /// Processes the pending async path requests.
+    /// </summary>
+    /// <param name="maxIterations">The maximum amount of the pathfinding iterations to perform.</param>
+    void UpdatePathRequests(int32 maxIterations);
+
+public:
+    /// <summary>
+    /// Adds the dynamic cylinder obstacle that carves the navmesh (only tiles built with the tile cache are affected). Affected tiles are rebuilt during the navigation service update.
+    /// </summary>
+    /// <param name="position">The obstacle bottom center position (in world-space).</param>
+    /// <param name="radius">The obstacle radius.</param>
+    /// <param name="height">The obstacle height.</param>
+    /// <returns>The obstacle identifier used to remove it. Returns 0 if failed.</returns>
+    API_FUNCTION() uint32 AddObstacle(const Vector3& position, float radius, float height);
+
+    /// <summary>
+    /// Adds the dynamic box obstacle that carves the navmesh (only tiles built with the tile cache are affected). Affected tiles are rebuilt during the navigation service update.
+    /// </summary>
+    /// <param name="center">The obstacle box center position (in world-space).</param>
+    /// <param name="halfExtents">The obstacle box half-extents (relative to the navmesh rotation).</param>
+    /// <param name="yaw">The obstacle box rotation around the navmesh up axis (in degrees).</param>
+    /// <returns>The obstacle identifier used to remove it. Returns 0 if failed.</returns>
+    API_FUNCTION() uint32 AddBoxObstacle(const Vector3& center, const Vector3& halfExtents, float yaw = 0.0f);
+
+    /// <summary>
+    /// Removes the dynamic obstacle.
+    /// </summary>
+    /// <param name="obstacleId">The obstacle identifier.</param>
+    API_FUNCTION() void RemoveObstacle(uint32 obstacleId);
+
+    /// <summary>
+    /// Rebuilds the tiles affected by the dynamic obstacles changes.
+    /// </summary>
+    void UpdateTileCache();
+
+    /// <summary>
+    /// Gets the compressor used by the navmesh tile cache layers.
+    /// </summary>
+    static dtTileCacheCompressor* GetTileCacheCompressor();
+
 public:
     /// <summary>
     /// Sets the size of the tile (if not assigned). Disposes the mesh if added tiles have different size.
@@ -248,4 +379,11 @@ API_CLASS(NoSpawn) class FLAXENGINE_API NavMeshRuntime : public ScriptingObject
 
 private:
     void AddTileInternal(NavMesh* navMesh, NavMeshTileData& tileData);
+    void AddCompressedTile(NavMeshTile& tile);
+    bool InitTileCache(const NavMeshTileCacheParams& params, int32 capacity);
+    void AddObstacleInternal(NavMeshObstacle& obstacle);
+    void RemoveTileInternal(int32 x, int32 y, int32 layer, bool compressed);
+    dtNavMeshQuery* AcquireQuery() const;
+    void ReleaseQuery(dtNavMeshQuery* query) const;
+    void ClearQueries();
 };
@@ -168,13 +168,12 @@ class NavigationService : public EngineService
     }
 
     bool Init() override;
-#if COMPILE_WITH_NAV_MESH_BUILDER
     void Update() override;
-#endif
     void Dispose() override;
 };
 
 NavigationService NavigationServiceInstance;
+int32 Navigation::MaxPathRequestsIterations = 1024;
 
 void* dtAllocDefault(size_t size, dtAllocHint)
 {
@@ -248,6 +247,8 @@ void NavigationSettings::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(MaxEdgeError);
     DESERIALIZE(DetailSamplingDist);
     DESERIALIZE(MaxDetailSamplingError);
+    DESERIALIZE(UseTileCache);
+    DESERIALIZE(MaxObstacles);
     if (modifier->EngineBuild >= 6215)
     {
         DESERIALIZE(NavMeshes);
@@ -283,15 +284,22 @@ bool NavigationService::Init()
     return false;
 }
 
-#if COMPILE_WITH_NAV_MESH_BUILDER
-
 void NavigationService::Update()
 {
+#if COMPILE_WITH_NAV_MESH_BUILDER
     NavMeshBuilder::Update();
-}
-
 #endif
 
+    for (auto navMesh : NavMeshes)
+    {
+        // Rebuild tiles affected by the dynamic obstacles
+        navMesh->UpdateTileCache();
+
+        // Process async path requests
+        navMesh->UpdatePathRequests(Navigation::MaxPathRequestsIterations);
+    }
+}
+
 void NavigationService::Dispose()
 {
     // Release nav meshes
@@ -353,6 +361,27 @@ bool Navigation::RayCast(const Vector3& startPosition, const Vector3& endPositio
     return NavMeshes.First()->RayCast(startPosition, endPosition, hitInfo);
 }
 
+uint32 Navigation::RequestPath(const Vector3& startPosition, const Vector3& endPosition)
+{
+    if (NavMeshes.IsEmpty())
+        return 0;
+    return NavMeshes.First()->RequestPath(startPosition, endPosition);
+}
+
+NavMeshPathRequestState Navigation::GetPathRequestResult(uint32 requestId, Array<Vector3, HeapAllocation>& resultPath)
+{
+    resultPath.Clear();
+    if (NavMeshes.IsEmpty())
+        return NavMeshPathRequestState::Invalid;
+    return NavMeshes.First()->GetPathRequestResult(requestId, resultPath);
+}
+
+void Navigation::CancelPathRequest(uint32 requestId)
+{
+    if (NavMeshes.HasItems())
+        NavMeshes.First()->CancelPathRequest(requestId);
+}
+
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
 bool Navigation::IsBuildingNavMesh()
@@ -13,6 +13,11 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
 {
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(Navigation);
 public:
+    /// <summary>
+    /// The maximum amount of the pathfinding iterations performed every frame to process the async path requests (per navmesh). Higher values reduce the requests latency but increase the update time.
+    /// </summary>
+    API_FIELD() static int32 MaxPathRequestsIterations;
+
     /// <summary>
     /// Finds the distance from the specified start position to the nearest polygon wall.
     /// </summary>
@@ -84,6 +89,28 @@ API_CLASS(Static) class FLAXENGINE_API Navigation
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCast(const Vector3& startPosition, const Vector3& endPosition, API_PARAM(Out) NavMeshHit& hitInfo);
 
+    /// <summary>
+    /// Requests the async path finding between the two positions. Requests are processed over multiple frames (see MaxPathRequestsIterations).
+    /// </summary>
+    /// <param name="startPosition">The start position.</param>
+    /// <param name="endPosition">The end position.</param>
+    /// <returns>The path request identifier used to query the result. Returns 0 if failed.</returns>
+    API_FUNCTION() static uint32 RequestPath(const Vector3& startPosition, const Vector3& endPosition);
+
+    /// <summary>
+    /// Gets the async path request result. Releases the request if it has been completed (succeeded or failed).
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    /// <param name="resultPath">The result path. Valid only if request succeeded.</param>
+    /// <returns>The request state.</returns>
+    API_FUNCTION() static NavMeshPathRequestState GetPathRequestResult(uint32 requestId, API_PARAM(Out) Array<Vector3, HeapAllocation>& resultPath);
+
+    /// <summary>
+    /// Cancels the async path request (pending or completed) and releases it.
+    /// </summary>
+    /// <param name="requestId">The path request identifier.</param>
+    API_FUNCTION() static void CancelPathRequest(uint32 requestId);
+
 public:
 #if COMPILE_WITH_NAV_MESH_BUILDER
 
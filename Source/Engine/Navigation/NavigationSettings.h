@@ -81,6 +81,18 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="Limit(0, 3), EditorOrder(290), EditorDisplay(\"Nav Mesh Options\")")
     float MaxDetailSamplingError = 1.0f;
 
+    /// <summary>
+    /// If checked, navmesh tiles are stored as compressed heightfield layers (tile cache) which are used to build the navmesh at runtime. Supports adding dynamic obstacles (eg. doors or destructible walls) that re-build only the affected tiles. Uses less memory for the navmesh data but tiles don't use the detail mesh (surface height follows the navmesh polygons only). Off-mesh links are not supported so scenes with Nav Link actors use static navmesh tiles instead.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(300), EditorDisplay(\"Nav Mesh Options\")")
+    bool UseTileCache = false;
+
+    /// <summary>
+    /// The maximum amount of the dynamic obstacles in the navmesh tile cache (per navmesh).
+    /// </summary>
+    API_FIELD(Attributes="Limit(1, 65535), EditorOrder(310), EditorDisplay(\"Nav Mesh Options\"), VisibleIf(nameof(UseTileCache))")
+    int32 MaxObstacles = 1024;
+
 public:
     /// <summary>
     /// The configuration for navmeshes.
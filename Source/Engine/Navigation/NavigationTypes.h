@@ -133,6 +133,21 @@ API_STRUCT() struct FLAXENGINE_API NavAgentMask
     }
 };
 
+/// <summary>
+/// The navigation mesh async path request state.
+/// </summary>
+API_ENUM() enum class NavMeshPathRequestState
+{
+    // Invalid or unknown request (eg. already released).
+    Invalid,
+    // Request is waiting in a queue or it's during processing.
+    Pending,
+    // Path has been found (it may be partial).
+    Succeeded,
+    // Failed to find the path.
+    Failed,
+};
+
 /// <summary>
 /// The result information for navigation mesh queries.
 /// </summary>
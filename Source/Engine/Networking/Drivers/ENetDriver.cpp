@@ -33,23 +33,56 @@ ENetPacketFlag ChannelTypeToPacketFlag(const NetworkChannelType channel)
     return static_cast<ENetPacketFlag>(flag);
 }
 
-void SendPacketToPeer(ENetPeer* peer, const NetworkChannelType channelType, const NetworkMessage& message)
+void ENET_CALLBACK OnSentPacketFree(void* packetPtr)
+{
+    // Recycle the message that was referenced by the packet
+    const ENetPacket* packet = (const ENetPacket*)packetPtr;
+    NetworkPeer* host = (NetworkPeer*)packet->userData;
+    const uint32 messageId = (uint32)((packet->data - host->MessageBuffer) / host->Config.MessageSize);
+    host->RecycleMessage(NetworkMessage(packet->data, messageId, host->Config.MessageSize, 0, 0));
+}
+
+void OnReceivedMessageRelease(void* packet)
+{
+    enet_packet_destroy((ENetPacket*)packet);
+}
+
+ENetPacket* CreatePacket(NetworkPeer* host, const NetworkChannelType channelType, const NetworkMessage& message)
 {
     // Covert our channel type to the internal ENet packet flags
     const ENetPacketFlag flag = ChannelTypeToPacketFlag(channelType);
 
-    // This will copy the data into the packet when ENET_PACKET_FLAG_NO_ALLOCATE is not set.
-    // Tho, we cannot use it, because we're releasing the message right after the send - and the packet might not
-    // be sent, yet. To avoid data corruption, we're just using the copy method. We might fix that later, but I'll take
-    // the smaller risk.
-    ENetPacket* packet = enet_packet_create(message.Buffer, message.Length, flag);
+    // Reference the pooled message memory directly (message is retained until ENet releases the packet). Packets are refcounted by ENet so the same data can be sent to multiple peers without copies.
+    // Fallback to copying the data when pool is running low (eg. reliable packets waiting for acknowledgement could exhaust it).
+    if (host->MessagePool.Count() > host->Config.MessagePoolSize / 4 && message.Buffer == host->GetMessageBuffer(message.MessageId))
+    {
+        ENetPacket* packet = enet_packet_create(message.Buffer, message.Length, (ENetPacketFlag)(flag | ENET_PACKET_FLAG_NO_ALLOCATE));
+        if (packet)
+        {
+            host->RetainMessage(message);
+            packet->userData = host;
+            packet->freeCallback = OnSentPacketFree;
+        }
+        return packet;
+    }
+    return enet_packet_create(message.Buffer, message.Length, flag);
+}
 
+void SendPacketToPeer(ENetPeer* peer, ENetPacket* packet)
+{
     // And send it!
     enet_peer_send(peer, 0, packet);
 
     // TODO: To reduce latency, we can use `enet_host_flush` to flush all packets. Maybe some API, like NetworkManager::FlushQueues()?
 }
 
+void ReleasePacket(ENetPacket* packet)
+{
+    // Destroy packet if it was not queued for sending by any peer
+    if (packet && packet->referenceCount == 0)
+        enet_packet_destroy(packet);
+}
+
 ENetDriver::ENetDriver(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -194,9 +227,8 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
             break;
         case ENET_EVENT_TYPE_RECEIVE:
             eventPtr.EventType = NetworkEventType::Message;
-            eventPtr.Message = _networkHost->CreateMessage();
-            eventPtr.Message.Length = event.packet->dataLength;
-            Platform::MemoryCopy(eventPtr.Message.Buffer, event.packet->data, event.packet->dataLength);
+            // Use packet data directly (packet gets destroyed when message is recycled)
+            eventPtr.Message = _networkHost->CreateMessage(event.packet->data, (uint32)event.packet->dataLength, OnReceivedMessageRelease, event.packet);
             break;
         default:
             break;
@@ -213,7 +245,9 @@ bool ENetDriver::PopEvent(NetworkEvent& eventPtr)
 void ENetDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message)
 {
     ASSERT(!IsServer());
-    SendPacketToPeer(_peer, channelType, message);
+    ENetPacket* packet = CreatePacket(_networkHost, channelType, message);
+    SendPacketToPeer(_peer, packet);
+    ReleasePacket(packet);
 }
 
 void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target)
@@ -222,7 +256,9 @@ void ENetDriver::SendMessage(NetworkChannelType channelType, const NetworkMessag
     ENetPeer* peer;
     if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
     {
-        SendPacketToPeer(peer, channelType, message);
+        ENetPacket* packet = CreatePacket(_networkHost, channelType, message);
+        SendPacketToPeer(peer, packet);
+        ReleasePacket(packet);
     }
 }
 
@@ -230,13 +266,18 @@ void ENetDriver::SendMessage(const NetworkChannelType channelType, const Network
 {
     ASSERT(IsServer());
     ENetPeer* peer;
+    ENetPacket* packet = nullptr;
     for (NetworkConnection target : targets)
     {
         if (_peerMap.TryGet(target.ConnectionId, peer) && peer && peer->state == ENET_PEER_STATE_CONNECTED)
         {
-            SendPacketToPeer(peer, channelType, message);
+            // Share a single packet between all targets
+            if (!packet)
+                packet = CreatePacket(_networkHost, channelType, message);
+            SendPacketToPeer(peer, packet);
         }
     }
+    ReleasePacket(packet);
 }
 
 NetworkDriverStats ENetDriver::GetStats()
@@ -0,0 +1,721 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "UdpDriver.h"
+#include "Engine/Networking/NetworkChannelType.h"
+#include "Engine/Networking/NetworkMessage.h"
+#include "Engine/Networking/NetworkPeer.h"
+#include "Engine/Networking/NetworkStats.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/ThreadSpawner.h"
+
+// Maximum amount of datagrams to read or write with a single call
+#define UDP_DRIVER_BATCH_SIZE 64
+// Maximum distance (in sequence numbers) of the reliable messages buffered when received out of order
+#define UDP_DRIVER_RELIABLE_WINDOW 1024
+// Interval (in seconds) of the connection requests send by the client
+#define UDP_DRIVER_CONNECT_INTERVAL 0.25
+// Interval (in seconds) after which an empty packet is sent to keep the connection alive
+#define UDP_DRIVER_PING_INTERVAL 1.0
+// Minimum time (in seconds) after which not acknowledged reliable packet is sent again
+#define UDP_DRIVER_MIN_RESEND_TIME 0.03
+// Magic number to identify the protocol in connection requests
+#define UDP_DRIVER_PROTOCOL_ID 0x31504455
+
+enum class UdpPacketType : uint8
+{
+    Connect = 1,
+    Accept,
+    Disconnect,
+    Data,
+    Ack,
+    Ping,
+};
+
+PACK_STRUCT(struct UdpPacketHeader
+    {
+    UdpPacketType Type;
+    uint8 Channel;
+    uint16 Sequence;
+    uint32 ConnectionId;
+    uint32 Token;
+    });
+
+PACK_STRUCT(struct UdpPacketAck
+    {
+    // The next expected reliable sequence (all previous were received).
+    uint16 Sequence;
+    // Bit mask of out-of-order received packets after the sequence (bit N = Sequence + 1 + N).
+    uint32 Mask;
+    });
+
+struct UdpPendingPacket
+{
+    uint16 Sequence;
+    bool Resent;
+    double SendTime;
+    Array<byte> Data;
+};
+
+struct UdpConnection
+{
+    uint32 Id = 0;
+    uint32 Token = 0;
+    NetworkEndPoint EndPoint;
+    bool Connected = false;
+    double LastReceiveTime = 0.0;
+    double LastSendTime = 0.0;
+    double ConnectTime = 0.0;
+    float RTT = 100.0f;
+    uint32 TotalDataSent = 0;
+    uint32 TotalDataReceived = 0;
+
+    // Reliable messages sending
+    uint16 NextReliableSequence = 0;
+    Array<UdpPendingPacket> PendingPackets;
+
+    // Reliable messages receiving
+    uint16 NextReceiveSequence = 0;
+    bool AckDirty = false;
+    Dictionary<uint16, Array<byte>> OutOfOrderPackets;
+
+    // Unreliable ordered messages
+    uint16 NextUnreliableSequence = 0;
+    uint16 LastUnreliableSequence = 0;
+    bool HasUnreliableSequence = false;
+};
+
+namespace
+{
+    FORCE_INLINE bool SequenceGreater(uint16 a, uint16 b)
+    {
+        return (int16)(a - b) > 0;
+    }
+
+    bool IsReliable(NetworkChannelType channelType)
+    {
+        return channelType == NetworkChannelType::Reliable || channelType == NetworkChannelType::ReliableOrdered;
+    }
+}
+
+UdpDriver::UdpDriver(const SpawnParams& params)
+    : ScriptingObject(params)
+{
+}
+
+UdpDriver::~UdpDriver()
+{
+    Dispose();
+}
+
+bool UdpDriver::Initialize(NetworkPeer* host, const NetworkConfig& config)
+{
+    _host = host;
+    _config = config;
+    const int32 datagramSize = sizeof(UdpPacketHeader) + config.MessageSize;
+    _recvData.Resize(datagramSize * UDP_DRIVER_BATCH_SIZE);
+    _recvQueue.Resize(UDP_DRIVER_BATCH_SIZE);
+    LOG(Info, "Initialized UDP driver");
+    return false;
+}
+
+void UdpDriver::Dispose()
+{
+    StopIO();
+    ScopeLock lock(_locker);
+    if (_hasSocket)
+    {
+        // Notify remote peers (best-effort)
+        if (_serverConnection)
+            CloseConnection(_serverConnection, false);
+        for (auto& e : _connections)
+            CloseConnection(e.Value, false);
+        Flush();
+        Network::DestroySocket(_socket);
+        _hasSocket = false;
+        LOG(Info, "UDP driver stopped!");
+    }
+    _connections.ClearDelete();
+    _serverConnection = nullptr;
+    _events.Clear();
+    _eventsStart = 0;
+    _eventsData.Clear();
+    _sendData.Clear();
+    _sendQueue.Clear();
+}
+
+bool UdpDriver::Listen()
+{
+    ScopeLock lock(_locker);
+    _isServer = true;
+    if (CreateSocket(true))
+        return false;
+    LOG(Info, "Created UDP server!");
+    StartIO();
+    return true;
+}
+
+bool UdpDriver::Connect()
+{
+    LOG(Info, "Connecting using UDP...");
+    ScopeLock lock(_locker);
+    _isServer = false;
+    if (CreateSocket(false))
+        return false;
+
+    // Start connection handshake (see UpdateConnections)
+    auto connection = New<UdpConnection>();
+    if (Network::CreateEndPoint(_config.Address, StringUtils::ToString(_config.Port), NetworkIPVersion::IPv4, connection->EndPoint, false))
+    {
+        LOG(Error, "Invalid end point.");
+        Delete(connection);
+        Network::DestroySocket(_socket);
+        _hasSocket = false;
+        return false;
+    }
+    const double time = Platform::GetTimeSeconds();
+    connection->Token = (uint32)Platform::GetTimeCycles() ^ (uint32)(uintptr)connection;
+    connection->LastReceiveTime = time;
+    connection->ConnectTime = time - UDP_DRIVER_CONNECT_INTERVAL;
+    _serverConnection = connection;
+    StartIO();
+    return true;
+}
+
+void UdpDriver::Disconnect()
+{
+    ScopeLock lock(_locker);
+    if (_serverConnection)
+    {
+        CloseConnection(_serverConnection, false);
+        Flush();
+        Delete(_serverConnection);
+        _serverConnection = nullptr;
+        LOG(Info, "Disconnected");
+    }
+}
+
+void UdpDriver::Disconnect(const NetworkConnection& connection)
+{
+    ScopeLock lock(_locker);
+    UdpConnection* udpConnection;
+    if (_connections.TryGet(connection.ConnectionId, udpConnection))
+    {
+        CloseConnection(udpConnection, false);
+        Flush();
+        _connections.Remove(connection.ConnectionId);
+        Delete(udpConnection);
+    }
+    else
+    {
+        LOG(Error, "Failed to kick connection({0}). Connection not found!", connection.ConnectionId);
+    }
+}
+
+bool UdpDriver::PopEvent(NetworkEvent& eventPtr)
+{
+    ScopeLock lock(_locker);
+    if (!_hasSocket)
+        return false;
+    if (_eventsStart == _events.Count() && !UseIOThread)
+    {
+        // Process incoming data only when all events were consumed
+        _events.Clear();
+        _eventsStart = 0;
+        _eventsData.Clear();
+        ProcessIO();
+    }
+    if (_eventsStart == _events.Count())
+    {
+        // No events
+        _events.Clear();
+        _eventsStart = 0;
+        _eventsData.Clear();
+        return false;
+    }
+
+    const Event& e = _events[_eventsStart++];
+    eventPtr.EventType = e.Type;
+    eventPtr.Sender.ConnectionId = e.ConnectionId;
+    if (e.Type == NetworkEventType::Message)
+    {
+        eventPtr.Message = _host->CreateMessage();
+        eventPtr.Message.Length = e.DataLength;
+        Platform::MemoryCopy(eventPtr.Message.Buffer, _eventsData.Get() + e.DataStart, e.DataLength);
+    }
+    return true;
+}
+
+void UdpDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message)
+{
+    ASSERT(!_isServer);
+    ScopeLock lock(_locker);
+    if (_serverConnection && _serverConnection->Connected)
+        QueueMessage(_serverConnection, channelType, message);
+}
+
+void UdpDriver::SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target)
+{
+    ASSERT(_isServer);
+    ScopeLock lock(_locker);
+    UdpConnection* connection;
+    if (_connections.TryGet(target.ConnectionId, connection))
+        QueueMessage(connection, channelType, message);
+}
+
+void UdpDriver::SendMessage(const NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets)
+{
+    ASSERT(_isServer);
+    ScopeLock lock(_locker);
+    UdpConnection* connection;
+    for (NetworkConnection target : targets)
+    {
+        if (_connections.TryGet(target.ConnectionId, connection))
+            QueueMessage(connection, channelType, message);
+    }
+}
+
+NetworkDriverStats UdpDriver::GetStats()
+{
+    return GetStats({ 0 });
+}
+
+NetworkDriverStats UdpDriver::GetStats(NetworkConnection target)
+{
+    NetworkDriverStats stats;
+    ScopeLock lock(_locker);
+    UdpConnection* connection = _serverConnection;
+    if (!connection)
+        _connections.TryGet(target.ConnectionId, connection);
+    if (!connection && _connections.HasItems())
+        connection = _connections.Begin()->Value;
+    if (connection)
+    {
+        stats.RTT = connection->RTT;
+        stats.TotalDataSent = connection->TotalDataSent;
+        stats.TotalDataReceived = connection->TotalDataReceived;
+    }
+    return stats;
+}
+
+bool UdpDriver::CreateSocket(bool bind)
+{
+    if (_hasSocket)
+        return true;
+    if (Network::CreateSocket(_socket, NetworkProtocol::Udp, NetworkIPVersion::IPv4))
+    {
+        LOG(Error, "Failed to create UDP socket!");
+        return true;
+    }
+
+    // Use larger buffers to handle bursts of high-rate traffic
+    Network::SetSocketOption(_socket, NetworkSocketOption::SendBuffer, 4 * 1024 * 1024);
+    Network::SetSocketOption(_socket, NetworkSocketOption::RecvBuffer, 4 * 1024 * 1024);
+
+    if (bind)
+    {
+        NetworkEndPoint endPoint;
+        const String address = _config.Address == TEXT("any") ? String::Empty : _config.Address;
+        if (Network::CreateEndPoint(address, StringUtils::ToString(_config.Port), NetworkIPVersion::IPv4, endPoint, true) || Network::BindSocket(_socket, endPoint))
+        {
+            LOG(Error, "Failed to bind UDP socket!");
+            Network::DestroySocket(_socket);
+            return true;
+        }
+    }
+    _hasSocket = true;
+    return false;
+}
+
+void UdpDriver::StartIO()
+{
+    if (UseIOThread && !_thread)
+    {
+        Platform::AtomicStore(&_exitThread, 0);
+        Function<int32()> func;
+        func.Bind<UdpDriver, &UdpDriver::IOThread>(this);
+        _thread = ThreadSpawner::Start(func, TEXT("UDP Driver"), ThreadPriority::AboveNormal);
+    }
+}
+
+void UdpDriver::StopIO()
+{
+    if (_thread)
+    {
+        Platform::AtomicStore(&_exitThread, 1);
+        _thread->Join();
+        Delete(_thread);
+        _thread = nullptr;
+    }
+}
+
+int32 UdpDriver::IOThread()
+{
+    while (Platform::AtomicRead(&_exitThread) == 0)
+    {
+        {
+            ScopeLock lock(_locker);
+            ProcessIO();
+        }
+        Platform::Sleep(1);
+    }
+    return 0;
+}
+
+void UdpDriver::ProcessIO()
+{
+    PROFILE_CPU();
+    if (!_hasSocket)
+        return;
+    const double time = Platform::GetTimeSeconds();
+    Receive(time);
+    UpdateConnections(time);
+    Flush();
+}
+
+void UdpDriver::Receive(double time)
+{
+    const uint32 datagramSize = sizeof(UdpPacketHeader) + _config.MessageSize;
+    int32 count;
+    do
+    {
+        for (int32 i = 0; i < UDP_DRIVER_BATCH_SIZE; i++)
+        {
+            NetworkDatagram& datagram = _recvQueue[i];
+            datagram.Data = _recvData.Get() + i * datagramSize;
+            datagram.Length = datagramSize;
+        }
+        count = Network::ReadSocketBatch(_socket, _recvQueue.Get(), UDP_DRIVER_BATCH_SIZE);
+        for (int32 i = 0; i < count; i++)
+            HandleDatagram(_recvQueue[i], time);
+    } while (count == UDP_DRIVER_BATCH_SIZE);
+}
+
+void UdpDriver::UpdateConnections(double time)
+{
+    // Client connection handshake
+    UdpConnection* connection = _serverConnection;
+    if (connection && !connection->Connected)
+    {
+        if (time - connection->LastReceiveTime > Timeout)
+        {
+            LOG(Warning, "Failed to connect to {0}:{1}", _config.Address, _config.Port);
+            AddEvent(NetworkEventType::Timeout, connection);
+            Delete(connection);
+            _serverConnection = nullptr;
+        }
+        else if (time - connection->ConnectTime >= UDP_DRIVER_CONNECT_INTERVAL)
+        {
+            connection->ConnectTime = time;
+            const uint32 protocolId = UDP_DRIVER_PROTOCOL_ID;
+            QueuePacket(connection, (uint8)UdpPacketType::Connect, 0, 0, (const byte*)&protocolId, sizeof(protocolId));
+        }
+        return;
+    }
+
+    const auto updateConnection = [this, time](UdpConnection* connection)
+    {
+        if (time - connection->LastReceiveTime > Timeout)
+        {
+            // Connection lost
+            AddEvent(NetworkEventType::Timeout, connection);
+            return true;
+        }
+
+        // Resend not acknowledged reliable packets
+        const double resendTime = Math::Max(connection->RTT * 0.002, UDP_DRIVER_MIN_RESEND_TIME);
+        for (UdpPendingPacket& packet : connection->PendingPackets)
+        {
+            if (time - packet.SendTime >= resendTime)
+            {
+                packet.SendTime = time;
+                packet.Resent = true;
+                const UdpPacketHeader& header = *(const UdpPacketHeader*)packet.Data.Get();
+                QueuePacket(connection, (uint8)header.Type, header.Channel, header.Sequence, packet.Data.Get() + sizeof(UdpPacketHeader), packet.Data.Count() - sizeof(UdpPacketHeader));
+            }
+        }
+
+        // Acknowledge received reliable packets (once per update)
+        if (connection->AckDirty)
+        {
+            connection->AckDirty = false;
+            UdpPacketAck ack;
+            ack.Sequence = connection->NextReceiveSequence;
+            ack.Mask = 0;
+            for (uint32 i = 0; i < 32; i++)
+            {
+                if (connection->OutOfOrderPackets.ContainsKey((uint16)(ack.Sequence + 1 + i)))
+                    ack.Mask |= 1u << i;
+            }
+            QueuePacket(connection, (uint8)UdpPacketType::Ack, 0, 0, (const byte*)&ack, sizeof(ack));
+        }
+
+        // Keep connection alive
+        if (time - connection->LastSendTime >= UDP_DRIVER_PING_INTERVAL)
+            QueuePacket(connection, (uint8)UdpPacketType::Ping, 0, 0, nullptr, 0);
+        return false;
+    };
+    if (connection)
+    {
+        if (updateConnection(connection))
+        {
+            Delete(connection);
+            _serverConnection = nullptr;
+        }
+    }
+    for (auto it = _connections.Begin(); it.IsNotEnd(); ++it)
+    {
+        if (updateConnection(it->Value))
+        {
+            Delete(it->Value);
+            _connections.Remove(it);
+        }
+    }
+}
+
+void UdpDriver::Flush()
+{
+    if (_sendQueue.IsEmpty())
+        return;
+
+    // Datagrams data was stored as offsets into the send buffer (it could be resized when adding packets)
+    for (NetworkDatagram& datagram : _sendQueue)
+        datagram.Data = _sendData.Get() + (uintptr)datagram.Data;
+    int32 sent = 0;
+    while (sent < _sendQueue.Count())
+    {
+        const int32 result = Network::WriteSocketBatch(_socket, _sendQueue.Get() + sent, _sendQueue.Count() - sent);
+        if (result <= 0)
+            break;
+        sent += result;
+    }
+    _sendQueue.Clear();
+    _sendData.Clear();
+}
+
+void UdpDriver::HandleDatagram(const NetworkDatagram& datagram, double time)
+{
+    if (datagram.Length < sizeof(UdpPacketHeader))
+        return;
+    const UdpPacketHeader& header = *(const UdpPacketHeader*)datagram.Data;
+    const byte* data = datagram.Data + sizeof(UdpPacketHeader);
+    const uint32 length = datagram.Length - sizeof(UdpPacketHeader);
+
+    // Find the connection
+    UdpConnection* connection = nullptr;
+    if (_isServer)
+    {
+        if (header.Type == UdpPacketType::Connect)
+        {
+            if (length != sizeof(uint32) || *(const uint32*)data != UDP_DRIVER_PROTOCOL_ID)
+                return;
+
+            // Check if it's a repeated request (eg. accept packet was lost)
+            for (auto& e : _connections)
+            {
+                if (e.Value->Token == header.Token && Platform::MemoryCompare(e.Value->EndPoint.Data, datagram.EndPoint.Data, sizeof(datagram.EndPoint.Data)) == 0)
+                {
+                    connection = e.Value;
+                    break;
+                }
+            }
+            if (!connection)
+            {
+                if (_connections.Count() >= _config.ConnectionsLimit)
+                    return;
+                connection = New<UdpConnection>();
+                connection->Id = _nextConnectionId++;
+                connection->Token = header.Token;
+                connection->EndPoint = datagram.EndPoint;
+                connection->Connected = true;
+                connection->LastReceiveTime = time;
+                _connections.Add(connection->Id, connection);
+                AddEvent(NetworkEventType::Connected, connection);
+            }
+            QueuePacket(connection, (uint8)UdpPacketType::Accept, 0, 0, nullptr, 0);
+            return;
+        }
+        _connections.TryGet(header.ConnectionId, connection);
+    }
+    else if (_serverConnection)
+    {
+        connection = _serverConnection;
+        if (header.Type == UdpPacketType::Accept && !connection->Connected && header.Token == connection->Token)
+        {
+            connection->Id = header.ConnectionId;
+            connection->Connected = true;
+            connection->LastReceiveTime = time;
+            AddEvent(NetworkEventType::Connected, connection);
+            return;
+        }
+    }
+    if (!connection || !connection->Connected || header.Token != connection->Token || header.ConnectionId != connection->Id)
+        return;
+    connection->LastReceiveTime = time;
+    connection->TotalDataReceived += datagram.Length;
+
+    switch (header.Type)
+    {
+    case UdpPacketType::Disconnect:
+        AddEvent(NetworkEventType::Disconnected, connection);
+        if (connection == _serverConnection)
+            _serverConnection = nullptr;
+        else
+            _connections.Remove(connection->Id);
+        Delete(connection);
+        break;
+    case UdpPacketType::Data:
+        HandleData(connection, (NetworkChannelType)header.Channel, header.Sequence, data, length);
+        break;
+    case UdpPacketType::Ack:
+        HandleAck(connection, data, length, time);
+        break;
+    default:
+        break;
+    }
+}
+
+void UdpDriver::HandleData(UdpConnection* connection, NetworkChannelType channelType, uint16 sequence, const byte* data, uint32 length)
+{
+    if (length > _config.MessageSize)
+        return;
+    if (IsReliable(channelType))
+    {
+        // All reliable messages are delivered in order (the same as ENet driver)
+        connection->AckDirty = true;
+        const int16 distance = (int16)(sequence - connection->NextReceiveSequence);
+        if (distance < 0)
+            return; // Duplicate
+        if (distance > 0)
+        {
+            // Buffer until missing packets arrive
+            if (distance < UDP_DRIVER_RELIABLE_WINDOW && !connection->OutOfOrderPackets.ContainsKey(sequence))
+                connection->OutOfOrderPackets[sequence].Set(data, length);
+            return;
+        }
+        AddEvent(NetworkEventType::Message, connection, data, length);
+        connection->NextReceiveSequence++;
+        Array<byte>* next;
+        while ((next = connection->OutOfOrderPackets.TryGet(connection->NextReceiveSequence)) != nullptr)
+        {
+            AddEvent(NetworkEventType::Message, connection, next->Get(), next->Count());
+            connection->OutOfOrderPackets.Remove(connection->NextReceiveSequence);
+            connection->NextReceiveSequence++;
+        }
+    }
+    else if (channelType == NetworkChannelType::UnreliableOrdered)
+    {
+        // Drop messages older than the last received one
+        if (connection->HasUnreliableSequence && !SequenceGreater(sequence, connection->LastUnreliableSequence))
+            return;
+        connection->HasUnreliableSequence = true;
+        connection->LastUnreliableSequence = sequence;
+        AddEvent(NetworkEventType::Message, connection, data, length);
+    }
+    else
+    {
+        AddEvent(NetworkEventType::Message, connection, data, length);
+    }
+}
+
+void UdpDriver::HandleAck(UdpConnection* connection, const byte* data, uint32 length, double time)
+{
+    if (length != sizeof(UdpPacketAck))
+        return;
+    const UdpPacketAck& ack = *(const UdpPacketAck*)data;
+    for (int32 i = connection->PendingPackets.Count() - 1; i >= 0; i--)
+    {
+        const UdpPendingPacket& packet = connection->PendingPackets[i];
+        const int16 distance = (int16)(packet.Sequence - ack.Sequence);
+        if (distance < 0 || (distance > 0 && distance <= 32 && (ack.Mask & (1u << (distance - 1))) != 0))
+        {
+            if (!packet.Resent)
+            {
+                // Update round trip time estimate (in milliseconds)
+                const float rtt = (float)((time - packet.SendTime) * 1000.0);
+                connection->RTT = connection->RTT * 0.875f + rtt * 0.125f;
+            }
+            connection->PendingPackets.RemoveAtKeepOrder(i);
+        }
+    }
+}
+
+void UdpDriver::AddEvent(NetworkEventType type, const UdpConnection* connection, const byte* data, uint32 length)
+{
+    Event& e = _events.AddOne();
+    e.Type = type;
+    e.ConnectionId = connection->Id;
+    e.DataStart = _eventsData.Count();
+    e.DataLength = (int32)length;
+    if (length)
+        _eventsData.Add(data, (int32)length);
+}
+
+void UdpDriver::QueuePacket(UdpConnection* connection, uint8 type, uint8 channel, uint16 sequence, const byte* data, uint32 length)
+{
+    UdpPacketHeader header;
+    header.Type = (UdpPacketType)type;
+    header.Channel = channel;
+    header.Sequence = sequence;
+    header.ConnectionId = connection->Id;
+    header.Token = connection->Token;
+
+    // Store data offset instead of a pointer (see Flush)
+    NetworkDatagram& datagram = _sendQueue.AddOne();
+    datagram.Data = (byte*)(uintptr)_sendData.Count();
+    datagram.Length = sizeof(header) + length;
+    datagram.EndPoint = connection->EndPoint;
+    _sendData.Add((const byte*)&header, sizeof(header));
+    if (length)
+        _sendData.Add(data, (int32)length);
+    connection->LastSendTime = Platform::GetTimeSeconds();
+    connection->TotalDataSent += datagram.Length;
+
+    // Send in batches
+    if (_sendQueue.Count() >= UDP_DRIVER_BATCH_SIZE)
+        Flush();
+}
+
+void UdpDriver::QueueMessage(UdpConnection* connection, NetworkChannelType channelType, const NetworkMessage& message)
+{
+    if (!connection->Connected)
+        return;
+    uint16 sequence = 0;
+    if (IsReliable(channelType))
+    {
+        // Keep a copy of the packet for resending until it gets acknowledged
+        sequence = connection->NextReliableSequence++;
+        UdpPendingPacket& packet = connection->PendingPackets.AddOne();
+        packet.Sequence = sequence;
+        packet.Resent = false;
+        packet.SendTime = Platform::GetTimeSeconds();
+        UdpPacketHeader header;
+        header.Type = UdpPacketType::Data;
+        header.Channel = (uint8)channelType;
+        header.Sequence = sequence;
+        header.ConnectionId = connection->Id;
+        header.Token = connection->Token;
+        packet.Data.Set((const byte*)&header, sizeof(header));
+        packet.Data.Add(message.Buffer, (int32)message.Length);
+    }
+    else if (channelType == NetworkChannelType::UnreliableOrdered)
+    {
+        sequence = connection->NextUnreliableSequence++;
+    }
+    QueuePacket(connection, (uint8)UdpPacketType::Data, (uint8)channelType, sequence, message.Buffer, message.Length);
+}
+
+void UdpDriver::CloseConnection(UdpConnection* connection, bool notify)
+{
+    if (connection->Connected)
+    {
+        // Send disconnect packet few times as it's unreliable
+        for (int32 i = 0; i < 3; i++)
+            QueuePacket(connection, (uint8)UdpPacketType::Disconnect, 0, 0, nullptr, 0);
+    }
+    if (notify)
+        AddEvent(NetworkEventType::Disconnected, connection);
+    connection->Connected = false;
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Networking/Types.h"
+#include "Engine/Networking/INetworkDriver.h"
+#include "Engine/Networking/NetworkConnection.h"
+#include "Engine/Networking/NetworkConfig.h"
+#include "Engine/Networking/NetworkEvent.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Platform/Network.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Scripting/ScriptingObject.h"
+
+struct UdpConnection;
+
+/// <summary>
+/// Low-level network transport interface implementation based on UDP sockets with a lightweight reliability layer (acknowledgements, resending and ordering of reliable messages). Batches sockets I/O to reduce system calls (eg. sendmmsg/recvmmsg on Linux) and can process it on a dedicated thread.
+/// </summary>
+API_CLASS(Namespace="FlaxEngine.Networking", Sealed) class FLAXENGINE_API UdpDriver : public ScriptingObject, public INetworkDriver
+{
+    DECLARE_SCRIPTING_TYPE(UdpDriver);
+
+private:
+    struct Event
+    {
+        NetworkEventType Type;
+        uint32 ConnectionId;
+        int32 DataStart;
+        int32 DataLength;
+    };
+
+    NetworkPeer* _host = nullptr;
+    NetworkConfig _config;
+    NetworkSocket _socket;
+    bool _hasSocket = false;
+    bool _isServer = false;
+    uint32 _nextConnectionId = 1;
+    UdpConnection* _serverConnection = nullptr;
+    Dictionary<uint32, UdpConnection*> _connections;
+    CriticalSection _locker;
+    Thread* _thread = nullptr;
+    volatile int64 _exitThread = 0;
+    Array<Event> _events;
+    int32 _eventsStart = 0;
+    Array<byte> _eventsData;
+    Array<byte> _sendData;
+    Array<NetworkDatagram> _sendQueue;
+    Array<byte> _recvData;
+    Array<NetworkDatagram> _recvQueue;
+
+public:
+    ~UdpDriver();
+
+    /// <summary>
+    /// If checked, sockets I/O (receiving, sending, resending and acknowledging of reliable messages) is processed on a dedicated thread, otherwise it's processed when polling events.
+    /// </summary>
+    API_FIELD() bool UseIOThread = false;
+
+    /// <summary>
+    /// Time (in seconds) after which the connection is dropped when nothing was received from it.
+    /// </summary>
+    API_FIELD() float Timeout = 10.0f;
+
+public:
+    // [INetworkDriver]
+    String DriverName() override
+    {
+        return String("UdpDriver");
+    }
+
+    bool Initialize(NetworkPeer* host, const NetworkConfig& config) override;
+    void Dispose() override;
+    bool Listen() override;
+    bool Connect() override;
+    void Disconnect() override;
+    void Disconnect(const NetworkConnection& connection) override;
+    bool PopEvent(NetworkEvent& eventPtr) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, NetworkConnection target) override;
+    void SendMessage(NetworkChannelType channelType, const NetworkMessage& message, const Array<NetworkConnection, HeapAllocation>& targets) override;
+    NetworkDriverStats GetStats() override;
+    NetworkDriverStats GetStats(NetworkConnection target) override;
+
+private:
+    bool CreateSocket(bool bind);
+    void StartIO();
+    void StopIO();
+    int32 IOThread();
+    void ProcessIO();
+    void Receive(double time);
+    void UpdateConnections(double time);
+    void Flush();
+    void HandleDatagram(const NetworkDatagram& datagram, double time);
+    void HandleData(UdpConnection* connection, NetworkChannelType channelType, uint16 sequence, const byte* data, uint32 length);
+    void HandleAck(UdpConnection* connection, const byte* data, uint32 length, double time);
+    void AddEvent(NetworkEventType type, const UdpConnection* connection, const byte* data = nullptr, uint32 length = 0);
+    void QueuePacket(UdpConnection* connection, uint8 type, uint8 channel, uint16 sequence, const byte* data, uint32 length);
+    void QueueMessage(UdpConnection* connection, NetworkChannelType channelType, const NetworkMessage& message);
+    void CloseConnection(UdpConnection* connection, bool notify);
+};
@@ -19,6 +19,8 @@ enum class NetworkMessageIDs : uint8
     ObjectDespawn,
     ObjectRole,
     ObjectRpc,
+    ObjectReplicateAck,
+    ObjectRpcBatch,
 
     MAX,
 };
@@ -38,6 +40,14 @@ class NetworkInternal
     static void OnNetworkMessageObjectDespawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRole(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
     static void OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+    static void OnNetworkMessageObjectRpcBatch(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer);
+
+    // Gets the hash of the local RPCs table (used to validate that batched RPCs indices match on both sides).
+    static uint32 GetRpcTableHash();
+
+    // Sets the hash of the RPCs table of the remote peer (server when called on client), received during connection handshake.
+    static void SetRemoteRpcTableHash(uint32 clientId, uint32 hash);
 
 #if COMPILE_WITH_PROFILER
 
@@ -47,10 +57,14 @@ class NetworkInternal
         uint16 DataSize = 0;
         uint16 MessageSize = 0;
         uint16 Receivers = 0;
+        uint16 ReceivedCount = 0;
+        uint32 ReceivedDataSize = 0;
+        float SerializeTime = 0.0f;
+        float DeserializeTime = 0.0f;
     };
 
     /// <summary>
-    /// Enables network usage profiling tools. Captures network objects replication and RPCs send statistics.
+    /// Enables network usage profiling tools. Captures network objects replication and RPCs send and receive statistics (per object type and per RPC).
     /// </summary>
     static bool EnableProfiling;
 
@@ -13,9 +13,10 @@
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Scripting/Scripting.h"
 
-#define NETWORK_PROTOCOL_VERSION 3
+#define NETWORK_PROTOCOL_VERSION 4
 
 float NetworkManager::NetworkFPS = 60.0f;
 NetworkPeer* NetworkManager::Peer = nullptr;
@@ -45,6 +46,7 @@ PACK_STRUCT(struct NetworkMessageHandshake
     uint32 GameProtocolVersion;
     byte Platform;
     byte Architecture;
+    uint32 RpcTableHash;
     uint16 PayloadDataSize;
     });
 
@@ -53,6 +55,7 @@ PACK_STRUCT(struct NetworkMessageHandshakeReply
     NetworkMessageIDs ID = NetworkMessageIDs::HandshakeReply;
     uint32 ClientId;
     int32 Result;
+    uint32 RpcTableHash;
     });
 
 void OnNetworkMessageHandshake(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
@@ -78,6 +81,7 @@ void OnNetworkMessageHandshake(NetworkEvent& event, NetworkClient* client, Netwo
     NetworkMessageHandshakeReply replyData;
     replyData.Result = connectionData.Result;
     replyData.ClientId = client->ClientId;
+    replyData.RpcTableHash = NetworkInternal::GetRpcTableHash();
     NetworkMessage msgReply = peer->BeginSendMessage();
     msgReply.WriteStructure(replyData);
     peer->EndSendMessage(NetworkChannelType::ReliableOrdered, msgReply, event.Sender);
@@ -94,6 +98,7 @@ void OnNetworkMessageHandshake(NetworkEvent& event, NetworkClient* client, Netwo
     {
         client->State = NetworkConnectionState::Connected;
         LOG(Info, "Client id={0} connected", event.Sender.ConnectionId);
+        NetworkInternal::SetRemoteRpcTableHash(client->ClientId, msgData.RpcTableHash);
         NetworkManager::ClientConnected(client);
         NetworkInternal::NetworkReplicatorClientConnected(client);
     }
@@ -115,6 +120,7 @@ void OnNetworkMessageHandshakeReply(NetworkEvent& event, NetworkClient* client,
     // Client got connected with server
     NetworkManager::LocalClientId = msgData.ClientId;
     NetworkManager::LocalClient->ClientId = msgData.ClientId;
+    NetworkInternal::SetRemoteRpcTableHash(NetworkManager::ServerClientId, msgData.RpcTableHash);
     NetworkManager::LocalClient->State = NetworkConnectionState::Connected;
     NetworkManager::State = NetworkConnectionState::Connected;
     NetworkManager::StateChanged();
@@ -135,6 +141,8 @@ namespace
         NetworkInternal::OnNetworkMessageObjectDespawn,
         NetworkInternal::OnNetworkMessageObjectRole,
         NetworkInternal::OnNetworkMessageObjectRpc,
+        NetworkInternal::OnNetworkMessageObjectReplicateAck,
+        NetworkInternal::OnNetworkMessageObjectRpcBatch,
     };
 }
 
@@ -375,6 +383,7 @@ void NetworkManagerService::Update()
     if (NetworkManager::Mode == NetworkManagerMode::Offline || (float)(currentTime - LastUpdateTime) < minDeltaTime || !peer)
         return;
     PROFILE_CPU();
+    PROFILE_MEM(Networking);
     LastUpdateTime = currentTime;
     NetworkManager::Frame++;
     NetworkInternal::NetworkReplicatorPreUpdate();
@@ -412,6 +421,7 @@ void NetworkManagerService::Update()
                 msgData.GameProtocolVersion = GameProtocolVersion;
                 msgData.Platform = (byte)connectionData.Platform;
                 msgData.Architecture = (byte)connectionData.Architecture;
+                msgData.RpcTableHash = NetworkInternal::GetRpcTableHash();
                 msgData.PayloadDataSize = (uint16)connectionData.PayloadData.Count();
                 NetworkMessage msg = peer->BeginSendMessage();
                 msg.WriteStructure(msgData);
@@ -61,6 +61,8 @@ bool NetworkPeer::Initialize(const NetworkConfig& config)
     // Warmup message pool
     for (uint32 messageId = Config.MessagePoolSize; messageId > 0; messageId --)
         MessagePool.Push(messageId);
+    MessageSlots.Resize(Config.MessagePoolSize + 1);
+    Platform::MemoryClear(MessageSlots.Get(), MessageSlots.Count() * sizeof(MessageSlot));
 
     // Setup network driver
     if (NetworkDriver->Initialize(this, Config))
@@ -89,8 +91,8 @@ void NetworkPeer::CreateMessageBuffers()
 
     const uint32 pageSize = Platform::GetCPUInfo().PageSize;
 
-    // Calculate total size in bytes
-    const uint64 totalSize = static_cast<uint64>(Config.MessagePoolSize) * Config.MessageSize;
+    // Calculate total size in bytes (message ids start from 1)
+    const uint64 totalSize = static_cast<uint64>(Config.MessagePoolSize + 1) * Config.MessageSize;
 
     // Calculate the amount of pages that we need
     const uint32 numPages = totalSize > pageSize ? Math::CeilToInt(totalSize / static_cast<float>(pageSize)) : 1;
@@ -140,16 +142,48 @@ bool NetworkPeer::PopEvent(NetworkEvent& eventRef)
 NetworkMessage NetworkPeer::CreateMessage()
 {
     const uint32 messageId = MessagePool.Pop();
+    MessageSlot& slot = MessageSlots[messageId];
+    slot.RefCount = 1;
+    slot.Release = nullptr;
     uint8* messageBuffer = GetMessageBuffer(messageId);
     return NetworkMessage(messageBuffer, messageId, Config.MessageSize, 0, 0);
 }
 
+NetworkMessage NetworkPeer::CreateMessage(uint8* buffer, uint32 length, ReleaseMessageFunc release, void* userData)
+{
+    const uint32 messageId = MessagePool.Pop();
+    MessageSlot& slot = MessageSlots[messageId];
+    slot.RefCount = 1;
+    slot.Release = release;
+    slot.UserData = userData;
+    return NetworkMessage(buffer, messageId, length, length, 0);
+}
+
+void NetworkPeer::RetainMessage(const NetworkMessage& message)
+{
+    ASSERT(message.IsValid());
+    MessageSlot& slot = MessageSlots[message.MessageId];
+    ASSERT(slot.RefCount > 0);
+    slot.RefCount++;
+}
+
 void NetworkPeer::RecycleMessage(const NetworkMessage& message)
 {
     ASSERT(message.IsValid());
 #ifdef BUILD_DEBUG
     ASSERT(MessagePool.Contains(message.MessageId) == false);
 #endif
+    MessageSlot& slot = MessageSlots[message.MessageId];
+    ASSERT(slot.RefCount > 0);
+    if (--slot.RefCount != 0)
+        return; // Message is still in use
+
+    // Release external memory
+    if (slot.Release)
+    {
+        slot.Release(slot.UserData);
+        slot.Release = nullptr;
+    }
 
     // Return the message id
     MessagePool.Push(message.MessageId);
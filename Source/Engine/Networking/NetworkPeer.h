@@ -19,11 +19,23 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     API_FIELD(ReadOnly) static Array<NetworkPeer*> Peers;
 
 public:
+    typedef void (*ReleaseMessageFunc)(void* userData);
+
+    struct MessageSlot
+    {
+        // The amount of references to the message (message returns to the pool once it reaches 0).
+        int32 RefCount;
+        // The optional callback to release the external message memory (eg. network driver packet).
+        ReleaseMessageFunc Release;
+        void* UserData;
+    };
+
     int HostId = -1;
     NetworkConfig Config;
 
     uint8* MessageBuffer = nullptr;
     Array<uint32, HeapAllocation> MessagePool;
+    Array<MessageSlot, HeapAllocation> MessageSlots;
 
 public:
     /// <summary>
@@ -75,7 +87,24 @@ API_CLASS(sealed, NoSpawn, Namespace = "FlaxEngine.Networking") class FLAXENGINE
     API_FUNCTION() NetworkMessage CreateMessage();
 
     /// <summary>
-    /// Returns given message to the pool.
+    /// Acquires new message from the pool that uses external memory (eg. received packet data) to avoid copying it into the pooled buffer.
+    /// </summary>
+    /// <param name="buffer">The message data.</param>
+    /// <param name="length">The message data length (in bytes).</param>
+    /// <param name="release">The callback invoked when message gets recycled to release the external memory. Can be null.</param>
+    /// <param name="userData">The custom user data passed to the release callback.</param>
+    /// <returns>The acquired message.</returns>
+    /// <remarks>Make sure to recycle the message to this peer once it is no longer needed!</remarks>
+    NetworkMessage CreateMessage(uint8* buffer, uint32 length, ReleaseMessageFunc release, void* userData);
+
+    /// <summary>
+    /// Adds a reference to the message so it stays valid after the next RecycleMessage call. Can be used by network drivers to send message data without a copy (eg. the same buffer to multiple targets) and recycle it once the transport doesn't use it anymore.
+    /// </summary>
+    /// <param name="message">The message.</param>
+    API_FUNCTION() void RetainMessage(const NetworkMessage& message);
+
+    /// <summary>
+    /// Returns given message to the pool. Message is reused once all references to it are released (see RetainMessage).
     /// </summary>
     /// <remarks>Make sure that this message belongs to the peer and has not been recycled already (debug build checks for this)!</remarks>
     API_FUNCTION() void RecycleMessage(const NetworkMessage& message);
@@ -148,8 +148,8 @@ void NetworkReplicationNode::Update(NetworkReplicationHierarchyUpdateResult* res
             }
             if (targetClients && obj.Object)
             {
-                // Replicate this frame
-                result->AddObject(obj.Object, targetClients);
+                // Replicate this frame (objects with higher replication rate get higher priority)
+                result->AddObject(obj.Object, targetClients, Math::Min(obj.ReplicationFPS / networkFPS, 1.0f));
             }
 
             // Calculate frames until next replication
@@ -261,3 +261,235 @@ void NetworkReplicationGridNode::Update(NetworkReplicationHierarchyUpdateResult*
         }
     }
 }
+
+Int3 NetworkReplicationSpatialNode::GetCell(const Vector3& position) const
+{
+    return Int3(Math::FloorToInt((float)(position.X / CellSize)), Math::FloorToInt((float)(position.Y / CellSize)), Math::FloorToInt((float)(position.Z / CellSize)));
+}
+
+NetworkReplicationSpatialNode::Entry* NetworkReplicationSpatialNode::FindEntry(ScriptingObject* obj)
+{
+    Int3 coord;
+    if (_objectToCell.TryGet(obj, coord))
+    {
+        for (Entry& e : _cells[coord].Entries)
+        {
+            if (e.Object == obj)
+                return &e;
+        }
+    }
+    return nullptr;
+}
+
+void NetworkReplicationSpatialNode::AddObject(NetworkReplicationHierarchyObject obj)
+{
+    if (obj.ReplicationFPS > ZeroTolerance) // > 0
+    {
+        // Randomize initial replication update to spread rep rates more evenly for large scenes that register all objects within the same frame
+        obj.ReplicationUpdatesLeft = NetworkReplicationNodeObjectCounter++ % Math::Clamp(Math::RoundToInt(NetworkManager::NetworkFPS / obj.ReplicationFPS), 1, 60);
+    }
+
+    Vector3 position = Vector3::Zero;
+    if (const Actor* actor = obj.GetActor())
+        position = actor->GetPosition();
+    const Int3 coord = GetCell(position);
+    Cell& cell = _cells[coord];
+    Entry& e = cell.Entries.AddOne();
+    e.Object = obj;
+    e.Position = position;
+    e.Replicate = false;
+    e.Culled = false;
+    cell.MaxCullDistance = Math::Max(cell.MaxCullDistance, obj.CullDistance);
+    _maxCullDistance = Math::Max(_maxCullDistance, obj.CullDistance);
+    _objectToCell[obj.Object.Get()] = coord;
+}
+
+bool NetworkReplicationSpatialNode::RemoveObject(ScriptingObject* obj)
+{
+    Int3 coord;
+    if (!_objectToCell.TryGet(obj, coord))
+        return false;
+    Cell& cell = _cells[coord];
+    for (int32 i = 0; i < cell.Entries.Count(); i++)
+    {
+        if (cell.Entries[i].Object == obj)
+        {
+            cell.Entries.RemoveAt(i);
+            if (cell.Entries.IsEmpty())
+                _cells.Remove(coord);
+            _objectToCell.Remove(obj);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NetworkReplicationSpatialNode::GetObject(ScriptingObject* obj, NetworkReplicationHierarchyObject& result)
+{
+    if (const Entry* e = FindEntry(obj))
+    {
+        result = e->Object;
+        return true;
+    }
+    return false;
+}
+
+bool NetworkReplicationSpatialNode::DirtyObject(ScriptingObject* obj)
+{
+    Entry* e = FindEntry(obj);
+    if (e)
+    {
+        // Indicate for manual sync (see logic in NetworkReplicationNode::Update) or replicate it next frame
+        e->Object.ReplicationUpdatesLeft = e->Object.ReplicationFPS < -ZeroTolerance ? 1 : 0;
+    }
+    return e != nullptr;
+}
+
+void NetworkReplicationSpatialNode::UpdateClient(NetworkReplicationHierarchyUpdateResult* result, int32 clientIndex, const Vector3& location)
+{
+    // Visit only cells within the maximum culling range around the client (or all cells if it's cheaper)
+    const Real cellRadius = CellSize * 0.867f; // sqrt(3)/2
+    const int32 range = Math::CeilToInt(_maxCullDistance / CellSize);
+    const int32 rangeCellsCount = (range * 2 + 1) * (range * 2 + 1) * (range * 2 + 1);
+    const auto visitCell = [&](const Int3& coord, Cell& cell)
+    {
+        const Vector3 cellCenter = Vector3(coord) * CellSize + CellSize * 0.5f;
+        const Real cellDistance = Vector3::Distance(cellCenter, location) - cellRadius;
+        if (cellDistance >= cell.MaxCullDistance)
+            return;
+        for (Entry& e : cell.Entries)
+        {
+            if (e.Culled && Vector3::DistanceSquared(e.Position, location) < Math::Square(e.Object.CullDistance))
+                e.TargetClients.SetBit(clientIndex);
+        }
+    };
+    if (rangeCellsCount >= _cells.Count())
+    {
+        for (auto& e : _cells)
+            visitCell(e.Key, e.Value);
+    }
+    else
+    {
+        const Int3 center = GetCell(location);
+        for (int32 z = -range; z <= range; z++)
+        {
+            for (int32 y = -range; y <= range; y++)
+            {
+                for (int32 x = -range; x <= range; x++)
+                {
+                    const Int3 coord(center.X + x, center.Y + y, center.Z + z);
+                    if (Cell* cell = _cells.TryGet(coord))
+                        visitCell(coord, *cell);
+                }
+            }
+        }
+    }
+}
+
+void NetworkReplicationSpatialNode::Update(NetworkReplicationHierarchyUpdateResult* result)
+{
+    CHECK(result);
+    const float networkFPS = NetworkManager::NetworkFPS / result->ReplicationScale;
+
+    // Sync objects locations with cells and pick objects to replicate this frame
+    NetworkClientsMask clientsWithoutLocation = result->GetClientsMask();
+    for (int32 clientIndex = 0; clientIndex < result->_clients.Count(); clientIndex++)
+    {
+        if (result->_clients[clientIndex].HasLocation)
+            clientsWithoutLocation.UnsetBit(clientIndex);
+    }
+    _moves.Clear();
+    for (auto& c : _cells)
+    {
+        for (Entry& e : c.Value.Entries)
+        {
+            NetworkReplicationHierarchyObject& obj = e.Object;
+            e.Replicate = false;
+            e.Culled = false;
+            if (obj.ReplicationFPS < -ZeroTolerance) // < 0
+            {
+                if (obj.ReplicationUpdatesLeft)
+                {
+                    // Marked as dirty to sync manually
+                    obj.ReplicationUpdatesLeft = 0;
+                    e.Replicate = true;
+                    e.TargetClients = result->GetClientsMask();
+                }
+            }
+            else if (obj.ReplicationFPS < ZeroTolerance) // == 0
+            {
+                // Always relevant
+                e.Replicate = true;
+                e.TargetClients = result->GetClientsMask();
+            }
+            else if (obj.ReplicationUpdatesLeft > 0)
+            {
+                // Move to the next frame
+                obj.ReplicationUpdatesLeft--;
+            }
+            else
+            {
+                // Replicate this frame (culled against clients locations)
+                e.Replicate = true;
+                e.Culled = result->_clientsHaveLocation && obj.CullDistance > 0.0f;
+                e.TargetClients = e.Culled ? clientsWithoutLocation : result->GetClientsMask();
+
+                // Calculate frames until next replication
+                obj.ReplicationUpdatesLeft = (uint16)Math::Clamp<int32>(Math::RoundToInt(networkFPS / obj.ReplicationFPS) - 1, 0, MAX_uint16);
+            }
+
+            // Update object location
+            if (const Actor* actor = obj.GetActor())
+            {
+                e.Position = actor->GetPosition();
+                const Int3 coord = GetCell(e.Position);
+                if (coord != c.Key)
+                    _moves.Add({ obj.Object.Get(), c.Key, coord });
+            }
+        }
+    }
+
+    // Move objects between cells
+    for (const Move& move : _moves)
+    {
+        Cell& from = _cells[move.From];
+        for (int32 i = 0; i < from.Entries.Count(); i++)
+        {
+            if (from.Entries[i].Object == move.Object)
+            {
+                Cell& to = _cells[move.To];
+                to.Entries.Add(from.Entries[i]);
+                to.MaxCullDistance = Math::Max(to.MaxCullDistance, from.Entries[i].Object.CullDistance);
+                from.Entries.RemoveAt(i);
+                _objectToCell[move.Object] = move.To;
+                break;
+            }
+        }
+        if (from.Entries.IsEmpty())
+            _cells.Remove(move.From);
+    }
+
+    // Find relevant objects around each client
+    if (result->_clientsHaveLocation)
+    {
+        for (int32 clientIndex = 0; clientIndex < result->_clients.Count(); clientIndex++)
+        {
+            const auto& client = result->_clients[clientIndex];
+            if (client.HasLocation)
+                UpdateClient(result, clientIndex, client.Location);
+        }
+    }
+
+    // Output objects to replicate
+    for (const auto& c : _cells)
+    {
+        for (const Entry& e : c.Value.Entries)
+        {
+            if (e.Replicate && e.TargetClients && e.Object.Object)
+            {
+                const float priority = e.Object.ReplicationFPS > ZeroTolerance ? Math::Min(e.Object.ReplicationFPS / networkFPS, 1.0f) : 1.0f;
+                result->AddObject(e.Object.Object, e.TargetClients, priority);
+            }
+        }
+    }
+}
@@ -115,6 +115,7 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     friend class NetworkInternal;
     friend class NetworkReplicationNode;
     friend class NetworkReplicationGridNode;
+    friend class NetworkReplicationSpatialNode;
 
 private:
     struct Client
@@ -127,6 +128,7 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     {
         ScriptingObject* Object;
         NetworkClientsMask TargetClients;
+        float Priority;
     };
 
     bool _clientsHaveLocation;
@@ -146,6 +148,7 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = NetworkClientsMask::All;
+        e.Priority = 1.0f;
     }
 
     // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client). Mask matches NetworkManager::Clients.
@@ -154,6 +157,16 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
         Entry& e = _entries.AddOne();
         e.Object = obj;
         e.TargetClients = targetClients;
+        e.Priority = 1.0f;
+    }
+
+    // Adds object to the update results. Defines specific clients to receive the update (server-only, unused on client) and the replication priority (used by the replication scheduler when NetworkReplicator::ReplicationBudget is set, higher values are sent first). Mask matches NetworkManager::Clients.
+    API_FUNCTION() void AddObject(ScriptingObject* obj, NetworkClientsMask targetClients, float priority)
+    {
+        Entry& e = _entries.AddOne();
+        e.Object = obj;
+        e.TargetClients = targetClients;
+        e.Priority = priority;
     }
 
     // Gets amount of the clients to use. Matches NetworkManager::Clients.
@@ -261,6 +274,58 @@ API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkRepli
     void Update(NetworkReplicationHierarchyUpdateResult* result) override;
 };
 
+/// <summary>
+/// Network replication hierarchy node with spatial hashing for interest management. Keeps objects in hashed 3D grid cells (updated incrementally as objects move) and for each client visits only the cells within the culling range, so relevancy cost scales with the objects density around clients rather than the total objects count multiplied by clients count.
+/// </summary>
+API_CLASS(Namespace = "FlaxEngine.Networking") class FLAXENGINE_API NetworkReplicationSpatialNode : public NetworkReplicationNode
+{
+    DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(NetworkReplicationSpatialNode, NetworkReplicationNode);
+
+private:
+    struct Entry
+    {
+        NetworkReplicationHierarchyObject Object;
+        Vector3 Position;
+        NetworkClientsMask TargetClients;
+        bool Replicate;
+        bool Culled;
+    };
+
+    struct Cell
+    {
+        Array<Entry> Entries;
+        float MaxCullDistance = 0.0f;
+    };
+
+    struct Move
+    {
+        ScriptingObject* Object;
+        Int3 From;
+        Int3 To;
+    };
+
+    float _maxCullDistance = 0.0f;
+    Dictionary<Int3, Cell> _cells;
+    Dictionary<ScriptingObject*, Int3> _objectToCell;
+    Array<Move> _moves;
+
+    Int3 GetCell(const Vector3& position) const;
+    Entry* FindEntry(ScriptingObject* obj);
+    void UpdateClient(NetworkReplicationHierarchyUpdateResult* result, int32 clientIndex, const Vector3& location);
+
+public:
+    /// <summary>
+    /// Size of the grid cell (in world units). Should be close to the typical objects culling distance (too small cells increase the amount of cells to visit per client, too large cells increase the amount of objects to test).
+    /// </summary>
+    API_FIELD() float CellSize = 5000.0f;
+
+    void AddObject(NetworkReplicationHierarchyObject obj) override;
+    bool RemoveObject(ScriptingObject* obj) override;
+    bool GetObject(ScriptingObject* obj, NetworkReplicationHierarchyObject& result) override;
+    bool DirtyObject(ScriptingObject* obj) override;
+    void Update(NetworkReplicationHierarchyUpdateResult* result) override;
+};
+
 /// <summary>
 /// Defines the network objects replication hierarchy (tree structure) that controls chunking and configuration of the game objects replication.
 /// Contains only 'owned' objects. It's used by the networking system only on a main thread.
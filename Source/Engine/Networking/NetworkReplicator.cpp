@@ -16,6 +16,7 @@
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
 #include "Engine/Core/Collections/ChunkedArray.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Engine/EngineService.h"
@@ -28,7 +29,9 @@
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Scripting/ScriptingObjectReference.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Threading/ThreadLocal.h"
+#include "Engine/Utilities/Crc.h"
 #if USE_EDITOR
 #include "FlaxEngine.Gen.h"
 #endif
@@ -43,6 +46,16 @@ bool NetworkReplicator::EnableLog = false;
 #define NETWORK_REPLICATOR_LOG(messageType, format, ...)
 #endif
 
+bool NetworkReplicator::EnableDeltaCompression = false;
+bool NetworkReplicator::EnableParallelReplication = false;
+int32 NetworkReplicator::ReplicationBudget = 0;
+bool NetworkReplicator::EnableRpcBatching = true;
+
+// Amount of the last replicated states kept per object for delta compression baselines
+#define NETWORK_REPLICATOR_SNAPSHOTS 8
+#define NETWORK_REPLICATOR_JOBS_MIN_OBJECTS 32
+#define NETWORK_REPLICATOR_PRIORITY_DISTANCE 1000.0f
+
 #if COMPILE_WITH_PROFILER
 bool NetworkInternal::EnableProfiling = false;
 Dictionary<Pair<ScriptingTypeHandle, StringAnsiView>, NetworkInternal::ProfilerEvent> NetworkInternal::ProfilerEvents;
@@ -57,6 +70,8 @@ PACK_STRUCT(struct NetworkMessageObjectReplicate
     char ObjectTypeName[128]; // TODO: introduce networked-name to synchronize unique names as ushort (less data over network)
     uint16 DataSize;
     uint16 PartsCount;
+    uint32 BaselineFrame; // Owner frame of the state that data is delta-encoded against (0 if data contains the full state)
+    uint8 RequestAck : 1; // True if receiver should acknowledge the state (used as a baseline for the delta compression)
     });
 
 PACK_STRUCT(struct NetworkMessageObjectReplicatePart
@@ -68,6 +83,20 @@ PACK_STRUCT(struct NetworkMessageObjectReplicatePart
     uint16 PartStart;
     uint16 PartSize;
     Guid ObjectId; // TODO: introduce networked-ids to synchronize unique ids as ushort (less data over network)
+    uint32 BaselineFrame;
+    uint8 RequestAck : 1;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectReplicateAck
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectReplicateAck;
+    uint16 ItemsCount;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectReplicateAckItem
+    {
+    Guid ObjectId;
+    uint32 OwnerFrame;
     });
 
 PACK_STRUCT(struct NetworkMessageObjectSpawn
@@ -119,6 +148,26 @@ PACK_STRUCT(struct NetworkMessageObjectRpc
     uint16 ArgsSize;
     });
 
+PACK_STRUCT(struct NetworkMessageObjectRpcBatch
+    {
+    NetworkMessageIDs ID = NetworkMessageIDs::ObjectRpcBatch;
+    uint32 RpcTableHash;
+    uint16 ItemsCount;
+    });
+
+PACK_STRUCT(struct NetworkMessageObjectRpcBatchItem
+    {
+    Guid ObjectId;
+    uint16 RpcIndex;
+    uint16 ArgsSize;
+    });
+
+struct NetworkReplicationSnapshot
+{
+    uint32 OwnerFrame;
+    Array<byte> Data;
+};
+
 struct NetworkReplicatedObject
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -129,13 +178,19 @@ struct NetworkReplicatedObject
     NetworkObjectRole Role;
     uint8 Spawned : 1;
     uint8 Synced : 1;
+    uint8 Deferred : 1;
     DataContainer<uint32> TargetClientIds;
     INetworkObject* AsNetworkObject;
+    Array<NetworkReplicationSnapshot> Snapshots; // The last sent (server) or acknowledged (client) object states used for delta compression
+    Dictionary<uint32, uint32> AckedFrames; // The last acknowledged owner frame per client (server-only)
+    Dictionary<uint32, float> PendingPriority; // The accumulated priority per client of the deferred replication (server-only)
+    int32 JobIndex = -1;
 
     NetworkReplicatedObject()
     {
         Spawned = 0;
         Synced = 0;
+        Deferred = 0;
     }
 
     bool operator==(const NetworkReplicatedObject& other) const
@@ -177,9 +232,53 @@ struct ReplicateItem
     uint16 PartsLeft;
     uint32 OwnerFrame;
     uint32 OwnerClientId;
+    uint32 BaselineFrame;
+    bool RequestAck;
     Array<byte> Data;
 };
 
+struct ReplicationJobGroup
+{
+    uint32 BaselineFrame;
+    bool UseDelta;
+    Array<NetworkConnection> Targets;
+    Array<byte> DeltaData;
+};
+
+struct ReplicationJob
+{
+    NetworkReplicatedObject* Item = nullptr;
+    ScriptingObject* Object = nullptr;
+    NetworkStream* Stream = nullptr;
+    bool Failed = false;
+    float Priority = 0.0f;
+#if COMPILE_WITH_PROFILER
+    float SerializeTime = 0.0f;
+#endif
+    int32 GroupsCount = 0;
+    Array<NetworkConnection> Targets;
+    Array<uint32> TargetIds;
+    Array<bool> TargetsSent;
+    Array<ReplicationJobGroup> Groups; // Clients grouped by the acknowledged baseline (used with delta compression)
+};
+
+struct ReplicationCandidate
+{
+    uint32 ClientId;
+    int32 JobIndex;
+    int32 TargetIndex;
+    uint32 Size;
+    float Priority;
+
+    bool operator<(const ReplicationCandidate& other) const
+    {
+        // Sort by client and then by priority (from the highest)
+        if (ClientId != other.ClientId)
+            return ClientId < other.ClientId;
+        return Priority > other.Priority;
+    }
+};
+
 struct SpawnItem
 {
     ScriptingObjectReference<ScriptingObject> Object;
@@ -214,6 +313,18 @@ struct RpcItem
     NetworkRpcInfo Info;
     BytesContainer ArgsData;
     DataContainer<uint32> Targets;
+#if COMPILE_WITH_PROFILER
+    float SerializeTime;
+#endif
+};
+
+struct RpcBatch
+{
+    uint32 ClientId;
+    NetworkConnection Connection;
+    NetworkChannelType Channel;
+    uint16 ItemsCount;
+    Array<byte> Data;
 };
 
 namespace
@@ -228,10 +339,27 @@ namespace
     Dictionary<Guid, Guid> IdsRemappingTable;
     NetworkStream* CachedWriteStream = nullptr;
     NetworkStream* CachedReadStream = nullptr;
+#if COMPILE_WITH_PROFILER
+    double RpcSerializeStartTime = 0.0;
+#endif
     NetworkReplicationHierarchyUpdateResult* CachedReplicationResult = nullptr;
     NetworkReplicationHierarchy* Hierarchy = nullptr;
     Array<NetworkClient*> NewClients;
     Array<NetworkConnection> CachedTargets;
+    Array<uint32> CachedTargetIds; // Client ids matching CachedTargets (only from BuildCachedTargets with client ids lists)
+    Array<byte> CachedDeltaData;
+    Array<ReplicationJob> ReplicationJobs;
+    Array<ReplicationCandidate> ReplicationCandidates;
+    Dictionary<uint32, int32> CachedClientIndices;
+    Array<Guid> DeferredObjects; // Objects with replication deferred by the scheduler (see NetworkReplicator::ReplicationBudget)
+    Array<RpcBatch> RpcBatches; // Batched RPCs per target client and channel (see NetworkReplicator::EnableRpcBatching)
+    Array<NetworkConnection> CachedRpcTargets;
+    Array<NetworkRpcName> RpcIndexTable; // Sorted RPCs table used to index batched RPCs (the same on all peers with matching RPCs table)
+    Dictionary<NetworkRpcName, uint16> RpcIndexLookup;
+    uint32 RpcIndexTableHash = 0;
+    int32 RpcIndexTableCount = -1;
+    Dictionary<uint32, uint32> RemoteRpcTableHashes; // RPCs table hash of the remote peers (key is client id or server id on client)
+    Array<NetworkMessageObjectReplicateAckItem> ReplicationAcks;
     Dictionary<ScriptingTypeHandle, Serializer> SerializersTable;
 #if !COMPILE_WITHOUT_CSHARP
     Dictionary<StringAnsiView, StringAnsi*> CSharpCachedNames;
@@ -263,6 +391,9 @@ namespace
             if (i->Key.First.Module != flaxModule)
                 NetworkRpcInfo::RPCsTable.Remove(i);
         }
+        RpcIndexTableCount = -1;
+        RpcIndexTable.Clear();
+        RpcIndexLookup.Clear();
     }
 #endif
 }
@@ -392,6 +523,7 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const NetworkClien
 void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContainer<uint32>& clientIds, const uint32 excludedClientId = NetworkManager::ServerClientId, const NetworkClientsMask clientsMask = NetworkClientsMask::All)
 {
     CachedTargets.Clear();
+    CachedTargetIds.Clear();
     if (clientIds.IsValid())
     {
         for (int32 clientIndex = 0; clientIndex < clients.Count(); clientIndex++)
@@ -404,6 +536,7 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContaine
                     if (clientIds[i] == client->ClientId)
                     {
                         CachedTargets.Add(client->Connection);
+                        CachedTargetIds.Add(client->ClientId);
                         break;
                     }
                 }
@@ -416,7 +549,10 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContaine
         {
             const NetworkClient* client = clients.Get()[clientIndex];
             if (client->State == NetworkConnectionState::Connected && client->ClientId != excludedClientId && clientsMask.HasBit(clientIndex))
+            {
                 CachedTargets.Add(client->Connection);
+                CachedTargetIds.Add(client->ClientId);
+            }
         }
     }
 }
@@ -424,6 +560,7 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContaine
 void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContainer<uint32>& clientIds1, const Span<uint32>& clientIds2, const uint32 excludedClientId = NetworkManager::ServerClientId)
 {
     CachedTargets.Clear();
+    CachedTargetIds.Clear();
     if (clientIds1.IsValid())
     {
         if (clientIds2.IsValid())
@@ -441,6 +578,7 @@ void BuildCachedTargets(const Array<NetworkClient*>& clients, const DataContaine
                                 if (clientIds2[j] == client->ClientId)
                                 {
                                     CachedTargets.Add(client->Connection);
+                                    CachedTargetIds.Add(client->ClientId);
                                     break;
                                 }
                             }
@@ -473,6 +611,187 @@ FORCE_INLINE void GetNetworkName(char buffer[128], const StringAnsiView& name)
     buffer[name.Length()] = 0;
 }
 
+bool SortRpcNames(const NetworkRpcName& a, const NetworkRpcName& b)
+{
+    const int32 result = a.First.GetType().Fullname.Compare(b.First.GetType().Fullname);
+    if (result != 0)
+        return result < 0;
+    return a.Second.Compare(b.Second) < 0;
+}
+
+void UpdateRpcIndexTable()
+{
+    if (RpcIndexTableCount == NetworkRpcInfo::RPCsTable.Count())
+        return;
+    PROFILE_CPU();
+    RpcIndexTableCount = NetworkRpcInfo::RPCsTable.Count();
+
+    // Sort RPCs by name to get the same indices on all peers
+    RpcIndexTable.Clear();
+    for (const auto& e : NetworkRpcInfo::RPCsTable)
+        RpcIndexTable.Add(e.Key);
+    Sorting::QuickSort(RpcIndexTable.Get(), RpcIndexTable.Count(), SortRpcNames);
+    if (RpcIndexTable.Count() > MAX_uint16)
+        RpcIndexTable.Resize(MAX_uint16);
+
+    // Build lookup table and the hash of the whole table (including RPCs modes)
+    RpcIndexLookup.Clear();
+    RpcIndexTableHash = 0;
+    for (int32 i = 0; i < RpcIndexTable.Count(); i++)
+    {
+        const NetworkRpcName& name = RpcIndexTable[i];
+        const NetworkRpcInfo& info = NetworkRpcInfo::RPCsTable[name];
+        RpcIndexLookup.Add(name, (uint16)i);
+        const StringAnsiView& typeName = name.First.GetType().Fullname;
+        const byte mode = (byte)(info.Server | info.Client << 1 | info.Channel << 2);
+        RpcIndexTableHash = Crc::MemCrc32(typeName.Get(), typeName.Length(), RpcIndexTableHash);
+        RpcIndexTableHash = Crc::MemCrc32(name.Second.Get(), name.Second.Length(), RpcIndexTableHash);
+        RpcIndexTableHash = Crc::MemCrc32(&mode, sizeof(mode), RpcIndexTableHash);
+    }
+}
+
+FORCE_INLINE bool CanBatchRpc(uint32 clientId)
+{
+    const uint32* hash = RemoteRpcTableHashes.TryGet(clientId);
+    return hash && *hash == RpcIndexTableHash;
+}
+
+void FlushRpcBatch(NetworkPeer* peer, RpcBatch& batch, bool isClient)
+{
+    NetworkMessageObjectRpcBatch msgData;
+    msgData.RpcTableHash = RpcIndexTableHash;
+    msgData.ItemsCount = batch.ItemsCount;
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes(batch.Data.Get(), batch.Data.Count());
+    if (isClient)
+        peer->EndSendMessage(batch.Channel, msg);
+    else
+        peer->EndSendMessage(batch.Channel, msg, batch.Connection);
+    batch.ItemsCount = 0;
+    batch.Data.Clear();
+}
+
+void FlushRpcBatch(NetworkPeer* peer, uint32 clientId, NetworkChannelType channel, bool isClient)
+{
+    for (RpcBatch& batch : RpcBatches)
+    {
+        if (batch.ClientId == clientId && batch.Channel == channel)
+        {
+            if (batch.ItemsCount != 0)
+                FlushRpcBatch(peer, batch, isClient);
+            break;
+        }
+    }
+}
+
+void AddRpcBatchItem(NetworkPeer* peer, uint32 clientId, const NetworkConnection& connection, NetworkChannelType channel, const NetworkMessageObjectRpcBatchItem& itemData, const BytesContainer& args, bool isClient)
+{
+    RpcBatch* batch = nullptr;
+    for (RpcBatch& e : RpcBatches)
+    {
+        if (e.ClientId == clientId && e.Channel == channel)
+        {
+            batch = &e;
+            break;
+        }
+    }
+    if (!batch)
+    {
+        batch = &RpcBatches.AddOne();
+        batch->ClientId = clientId;
+        batch->Channel = channel;
+        batch->ItemsCount = 0;
+    }
+    batch->Connection = connection;
+
+    // Send the current batch if the next item won't fit into the message
+    const uint32 itemSize = sizeof(itemData) + args.Length();
+    if (batch->ItemsCount != 0 && sizeof(NetworkMessageObjectRpcBatch) + batch->Data.Count() + itemSize > peer->Config.MessageSize)
+        FlushRpcBatch(peer, *batch, isClient);
+
+    batch->Data.Add((const byte*)&itemData, sizeof(itemData));
+    batch->Data.Add(args.Get(), args.Length());
+    batch->ItemsCount++;
+}
+
+uint32 SendRpcMessage(NetworkPeer* peer, const RpcItem& e, const NetworkReplicatedObject& item, const ScriptingObject* obj, bool isClient, const Array<NetworkConnection>* targets)
+{
+    NetworkMessageObjectRpc msgData;
+    msgData.ObjectId = item.ObjectId;
+    msgData.ParentId = item.ParentId;
+    if (isClient)
+    {
+        // Remap local client object ids into server ids
+        IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
+        IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+    }
+    GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
+    GetNetworkName(msgData.RpcTypeName, e.Name.First.GetType().Fullname);
+    GetNetworkName(msgData.RpcName, e.Name.Second);
+    msgData.ArgsSize = (uint16)e.ArgsData.Length();
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
+    const uint32 messageSize = msg.Length;
+    const NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+    if (targets)
+        peer->EndSendMessage(channel, msg, *targets);
+    else
+        peer->EndSendMessage(channel, msg);
+    return messageSize;
+}
+
+void InvokeObjectRpc(NetworkReplicatedObject* e, const Guid& objectId, const NetworkRpcName& name, const NetworkRpcInfo& info, byte* args, uint16 argsSize, NetworkClient* client)
+{
+    if (e)
+    {
+        auto& item = *e;
+        ScriptingObject* obj = item.Object.Get();
+        if (!obj)
+            return;
+
+        // Validate RPC
+        if (info.Server && NetworkManager::IsClient())
+        {
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", name.First.ToString(), String(name.Second));
+            return;
+        }
+        if (info.Client && NetworkManager::IsServer())
+        {
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", name.First.ToString(), String(name.Second));
+            return;
+        }
+
+        // Setup message reading stream
+        if (CachedReadStream == nullptr)
+            CachedReadStream = New<NetworkStream>();
+        NetworkStream* stream = CachedReadStream;
+        stream->SenderId = client ? client->ClientId : NetworkManager::ServerClientId;
+        stream->Initialize(args, argsSize);
+
+        // Execute RPC
+#if COMPILE_WITH_PROFILER
+        const double startTime = NetworkInternal::EnableProfiling ? Platform::GetTimeSeconds() : 0.0;
+#endif
+        info.Execute(obj, stream, info.Tag);
+#if COMPILE_WITH_PROFILER
+        // Network stats recording
+        if (NetworkInternal::EnableProfiling)
+        {
+            auto& profileEvent = NetworkInternal::ProfilerEvents[name];
+            profileEvent.ReceivedCount++;
+            profileEvent.ReceivedDataSize += argsSize;
+            profileEvent.DeserializeTime += (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+        }
+#endif
+    }
+    else if (info.Channel != static_cast<uint8>(NetworkChannelType::Unreliable) && info.Channel != static_cast<uint8>(NetworkChannelType::UnreliableOrdered))
+    {
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", objectId, name.First.ToString(), String(name.Second));
+    }
+}
+
 void SetupObjectSpawnMessageItem(SpawnItem* e, NetworkMessage& msg)
 {
     ScriptingObject* obj = e->Object.Get();
@@ -695,6 +1014,267 @@ FORCE_INLINE void DirtyObjectImpl(NetworkReplicatedObject& item, ScriptingObject
         Hierarchy->DirtyObject(obj);
 }
 
+// Encodes the object state against the baseline state as a sequence of: [uint16 unchanged bytes count][uint16 changed bytes count][changed bytes]. Returns true if delta is not smaller than the state.
+bool EncodeDelta(const byte* data, const byte* baseline, uint32 size, Array<byte>& output)
+{
+    output.Clear();
+    uint32 pos = 0;
+    while (pos < size)
+    {
+        uint32 unchanged = 0;
+        while (pos < size && unchanged < MAX_uint16 && data[pos] == baseline[pos])
+        {
+            unchanged++;
+            pos++;
+        }
+        const uint32 changedStart = pos;
+        while (pos < size && pos - changedStart < MAX_uint16)
+        {
+            // Continue over short unchanged ranges to reduce encoding overhead
+            if (data[pos] == baseline[pos] && (pos + 4 > size || Platform::MemoryCompare(data + pos, baseline + pos, 4) == 0))
+                break;
+            pos++;
+        }
+        const uint16 header[2] = { (uint16)unchanged, (uint16)(pos - changedStart) };
+        output.Add((const byte*)header, sizeof(header));
+        output.Add(data + changedStart, pos - changedStart);
+        if ((uint32)output.Count() >= size)
+            return true;
+    }
+    return false;
+}
+
+// Decodes the object state from the delta (see EncodeDelta). Returns true if data is invalid.
+bool DecodeDelta(const byte* delta, uint32 deltaSize, const byte* baseline, uint32 size, Array<byte>& output)
+{
+    output.Set(baseline, size);
+    uint32 pos = 0, deltaPos = 0;
+    while (deltaPos + sizeof(uint16) * 2 <= deltaSize)
+    {
+        uint16 header[2];
+        Platform::MemoryCopy(header, delta + deltaPos, sizeof(header));
+        deltaPos += sizeof(header);
+        pos += header[0];
+        if (pos + header[1] > size || deltaPos + header[1] > deltaSize)
+            return true;
+        Platform::MemoryCopy(output.Get() + pos, delta + deltaPos, header[1]);
+        pos += header[1];
+        deltaPos += header[1];
+    }
+    return deltaPos != deltaSize;
+}
+
+NetworkReplicationSnapshot* FindSnapshot(NetworkReplicatedObject& item, uint32 ownerFrame)
+{
+    for (auto& e : item.Snapshots)
+    {
+        if (e.OwnerFrame == ownerFrame)
+            return &e;
+    }
+    return nullptr;
+}
+
+void SerializeReplicationJob(ReplicationJob& job)
+{
+    PROFILE_CPU_NAMED("SerializeObject");
+#if COMPILE_WITH_PROFILER
+    const double startTime = NetworkInternal::EnableProfiling ? Platform::GetTimeSeconds() : 0.0;
+#endif
+    NetworkStream* stream = job.Stream;
+    stream->Initialize();
+    job.Failed = NetworkReplicator::InvokeSerializer(job.Object->GetTypeHandle(), job.Object, stream, true);
+#if COMPILE_WITH_PROFILER
+    if (NetworkInternal::EnableProfiling)
+        job.SerializeTime = (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+#endif
+}
+
+void EncodeReplicationJob(ReplicationJob& job)
+{
+    PROFILE_CPU_NAMED("EncodeObject");
+    job.GroupsCount = 0;
+    if (job.Failed)
+        return;
+
+    // Group clients by the acknowledged baseline state
+    NetworkReplicatedObject& item = *job.Item;
+    NetworkStream* stream = job.Stream;
+    for (auto& group : job.Groups)
+        group.Targets.Clear();
+    for (int32 i = 0; i < job.Targets.Count(); i++)
+    {
+        const uint32* ackedFrame = item.AckedFrames.TryGet(job.TargetIds[i]);
+        const uint32 baselineFrame = ackedFrame && FindSnapshot(item, *ackedFrame) ? *ackedFrame : 0;
+        int32 groupIndex = 0;
+        while (groupIndex < job.GroupsCount && job.Groups[groupIndex].BaselineFrame != baselineFrame)
+            groupIndex++;
+        if (groupIndex == job.GroupsCount)
+        {
+            if (job.GroupsCount == job.Groups.Count())
+                job.Groups.AddOne();
+            job.Groups[job.GroupsCount++].BaselineFrame = baselineFrame;
+        }
+        job.Groups[groupIndex].Targets.Add(job.Targets[i]);
+    }
+
+    // Encode state against the baseline of each group
+    const uint32 size = stream->GetPosition();
+    for (int32 groupIndex = 0; groupIndex < job.GroupsCount; groupIndex++)
+    {
+        auto& group = job.Groups[groupIndex];
+        const NetworkReplicationSnapshot* baseline = group.BaselineFrame != 0 ? FindSnapshot(item, group.BaselineFrame) : nullptr;
+        group.UseDelta = baseline && baseline->Data.Count() == size && !EncodeDelta(stream->GetBuffer(), baseline->Data.Get(), size, group.DeltaData);
+    }
+}
+
+void RunReplicationJobs(void (*func)(ReplicationJob&), int32 jobsCount)
+{
+    if (NetworkReplicator::EnableParallelReplication && jobsCount >= NETWORK_REPLICATOR_JOBS_MIN_OBJECTS)
+    {
+        JobSystem::Execute([func](int32 i)
+        {
+            // Use the same objects ids mapping as the main thread (restore the previous mapping of the job thread after)
+            Scripting::IdsMappingTable* mapping = Scripting::ObjectsLookupIdMapping.Get();
+            Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
+            func(ReplicationJobs[i]);
+            Scripting::ObjectsLookupIdMapping.Set(mapping);
+        }, jobsCount);
+    }
+    else
+    {
+        for (int32 i = 0; i < jobsCount; i++)
+            func(ReplicationJobs[i]);
+    }
+}
+
+ReplicationJob& AddReplicationJob(int32& jobsCount, NetworkReplicatedObject& item, ScriptingObject* obj, float priority)
+{
+    if (item.AsNetworkObject)
+        item.AsNetworkObject->OnNetworkSerialize();
+    if (jobsCount == ReplicationJobs.Count())
+        ReplicationJobs.AddOne();
+    auto& job = ReplicationJobs[jobsCount++];
+    job.Item = &item;
+    job.Object = obj;
+    job.Priority = priority;
+    if (!job.Stream)
+        job.Stream = New<NetworkStream>();
+    job.Stream->SenderId = NetworkManager::LocalClientId;
+    return job;
+}
+
+// Limits the replicated data sent to each client to the budget. Objects are sent in order of the priority accumulated over the updates they were deferred.
+void ScheduleReplicationJobs(int32 jobsCount)
+{
+    PROFILE_CPU();
+    const auto& clients = NetworkManager::Clients;
+    CachedClientIndices.Clear();
+    for (int32 i = 0; i < clients.Count(); i++)
+        CachedClientIndices[clients[i]->ClientId] = i;
+
+    // Gather objects for each client with the current priority
+    ReplicationCandidates.Clear();
+    for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+    {
+        auto& job = ReplicationJobs[jobIndex];
+        job.TargetsSent.Clear();
+        if (job.Failed)
+            continue;
+        job.TargetsSent.Resize(job.Targets.Count());
+        const Actor* actor = NetworkReplicationHierarchyObject(job.Object).GetActor();
+        const uint32 size = job.Stream->GetPosition();
+        for (int32 i = 0; i < job.Targets.Count(); i++)
+        {
+            job.TargetsSent[i] = false;
+            const uint32 clientId = job.TargetIds[i];
+            float priority = job.Priority;
+            Vector3 location;
+            int32 clientIndex;
+            if (actor && CachedClientIndices.TryGet(clientId, clientIndex) && CachedReplicationResult->GetClientLocation(clientIndex, location))
+            {
+                // Closer objects are more important
+                const float distance = (float)Vector3::Distance(actor->GetPosition(), location);
+                priority /= 1.0f + distance / NETWORK_REPLICATOR_PRIORITY_DISTANCE;
+            }
+            if (const float* pending = job.Item->PendingPriority.TryGet(clientId))
+                priority += *pending;
+            auto& candidate = ReplicationCandidates.AddOne();
+            candidate.ClientId = clientId;
+            candidate.JobIndex = jobIndex;
+            candidate.TargetIndex = i;
+            candidate.Size = size;
+            candidate.Priority = priority;
+        }
+    }
+    Sorting::QuickSort(ReplicationCandidates);
+
+    // Fill the budget of each client (the first object always passes to prevent starvation of large objects)
+    const uint32 budget = (uint32)NetworkReplicator::ReplicationBudget;
+    uint32 clientId = MAX_uint32, clientBytes = 0;
+    for (const auto& candidate : ReplicationCandidates)
+    {
+        if (candidate.ClientId != clientId)
+        {
+            clientId = candidate.ClientId;
+            clientBytes = 0;
+        }
+        auto& job = ReplicationJobs[candidate.JobIndex];
+        NetworkReplicatedObject& item = *job.Item;
+        if (clientBytes == 0 || clientBytes + candidate.Size <= budget)
+        {
+            clientBytes += candidate.Size;
+            job.TargetsSent[candidate.TargetIndex] = true;
+            item.PendingPriority.Remove(clientId);
+        }
+        else
+        {
+            // Defer to the next update with the accumulated priority (staleness)
+            item.PendingPriority[clientId] = candidate.Priority;
+            if (!item.Deferred)
+            {
+                item.Deferred = 1;
+                DeferredObjects.Add(item.ObjectId);
+            }
+        }
+    }
+
+    // Remove deferred targets
+    for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+    {
+        auto& job = ReplicationJobs[jobIndex];
+        if (job.Failed)
+            continue;
+        for (int32 i = job.Targets.Count() - 1; i >= 0; i--)
+        {
+            if (!job.TargetsSent[i])
+            {
+                job.Targets.RemoveAtKeepOrder(i);
+                job.TargetIds.RemoveAtKeepOrder(i);
+            }
+        }
+        if (job.Targets.IsEmpty())
+            job.Failed = true;
+    }
+}
+
+void AddSnapshot(NetworkReplicatedObject& item, uint32 ownerFrame, const byte* data, uint32 dataSize)
+{
+    if (item.Snapshots.Count() >= NETWORK_REPLICATOR_SNAPSHOTS)
+    {
+        // Reuse the oldest snapshot (snapshots are added in order)
+        NetworkReplicationSnapshot snapshot = MoveTemp(item.Snapshots[0]);
+        item.Snapshots.RemoveAtKeepOrder(0);
+        item.Snapshots.Add(MoveTemp(snapshot));
+    }
+    else
+    {
+        item.Snapshots.AddOne();
+    }
+    auto& snapshot = item.Snapshots.Last();
+    snapshot.OwnerFrame = ownerFrame;
+    snapshot.Data.Set(data, dataSize);
+}
+
 template<typename MessageType>
 ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& msgData, uint16 partStart, uint16 partSize, uint32 senderClientId)
 {
@@ -717,6 +1297,8 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
         replicateItem->PartsLeft = msgData.PartsCount;
         replicateItem->OwnerFrame = msgData.OwnerFrame;
         replicateItem->OwnerClientId = senderClientId;
+        replicateItem->BaselineFrame = msgData.BaselineFrame;
+        replicateItem->RequestAck = msgData.RequestAck;
         replicateItem->Data.Resize(msgData.DataSize);
     }
 
@@ -730,7 +1312,7 @@ ReplicateItem* AddObjectReplicateItem(NetworkEvent& event, const MessageType& ms
     return replicateItem;
 }
 
-void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, byte* data, uint32 dataSize, uint32 senderClientId)
+void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, byte* data, uint32 dataSize, uint32 senderClientId, uint32 baselineFrame, bool requestAck)
 {
     ScriptingObject* obj = item.Object.Get();
     if (!obj)
@@ -743,8 +1325,32 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     // Drop object replication if it has old data (eg. newer message was already processed due to unordered channel usage)
     if (item.LastOwnerFrame >= ownerFrame)
         return;
+
+    // Decode delta-compressed state
+    const uint32 receivedSize = dataSize;
+    if (baselineFrame != 0)
+    {
+        const NetworkReplicationSnapshot* baseline = FindSnapshot(item, baselineFrame);
+        if (!baseline || DecodeDelta(data, dataSize, baseline->Data.Get(), baseline->Data.Count(), CachedDeltaData))
+        {
+            NETWORK_REPLICATOR_LOG(Warning, "[NetworkReplicator] Cannot decode object {} state (missing baseline {})", item.ToString(), baselineFrame);
+            return;
+        }
+        data = CachedDeltaData.Get();
+        dataSize = CachedDeltaData.Count();
+    }
     item.LastOwnerFrame = ownerFrame;
 
+    // Keep the state as a baseline for delta compression and acknowledge it
+    if (requestAck)
+    {
+        AddSnapshot(item, ownerFrame, data, dataSize);
+        auto& ack = ReplicationAcks.AddOne();
+        ack.ObjectId = item.ObjectId;
+        ack.OwnerFrame = ownerFrame;
+        IdsRemappingTable.KeyOf(ack.ObjectId, &ack.ObjectId);
+    }
+
     // Setup message reading stream
     if (CachedReadStream == nullptr)
         CachedReadStream = New<NetworkStream>();
@@ -753,12 +1359,26 @@ void InvokeObjectReplication(NetworkReplicatedObject& item, uint32 ownerFrame, b
     stream->SenderId = senderClientId;
 
     // Deserialize object
+#if COMPILE_WITH_PROFILER
+    const double startTime = NetworkInternal::EnableProfiling ? Platform::GetTimeSeconds() : 0.0;
+#endif
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
     const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, false);
     if (failed)
     {
         //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
     }
+#if COMPILE_WITH_PROFILER
+    // Network stats recording
+    if (NetworkInternal::EnableProfiling)
+    {
+        const Pair<ScriptingTypeHandle, StringAnsiView> name(obj->GetTypeHandle(), StringAnsiView::Empty);
+        auto& profileEvent = NetworkInternal::ProfilerEvents[name];
+        profileEvent.ReceivedCount++;
+        profileEvent.ReceivedDataSize += receivedSize;
+        profileEvent.DeserializeTime += (float)((Platform::GetTimeSeconds() - startTime) * 1000.0);
+    }
+#endif
 
     if (item.AsNetworkObject)
     {
@@ -1031,7 +1651,7 @@ void RPC_Execute_Managed(ScriptingObject* obj, NetworkStream* stream, void* tag)
     signature(obj, stream);
 }
 
-void NetworkReplicator::AddRPC(const ScriptingTypeHandle& typeHandle, const StringAnsiView& name, const Function<void(void*, void*)>& execute, bool isServer, bool isClient, NetworkChannelType channel)
+void NetworkReplicator::AddRPC(const ScriptingTypeHandle& typeHandle, const StringAnsiView& name, const Function<void(void*, void*)>& execute, bool isServer, bool isClient, NetworkChannelType channel, bool latestOnly)
 {
     if (!typeHandle)
         return;
@@ -1040,6 +1660,7 @@ void NetworkReplicator::AddRPC(const ScriptingTypeHandle& typeHandle, const Stri
     rpcInfo.Server = isServer;
     rpcInfo.Client = isClient;
     rpcInfo.Channel = (uint8)channel;
+    rpcInfo.LatestOnly = latestOnly;
     rpcInfo.Invoke = nullptr; // C# RPCs invoking happens on C# side (build-time code generation)
     rpcInfo.Execute = RPC_Execute_Managed;
     rpcInfo.Tag = (void*)*(SerializeFunc*)&execute;
@@ -1047,6 +1668,7 @@ void NetworkReplicator::AddRPC(const ScriptingTypeHandle& typeHandle, const Stri
     // Add to the global RPCs table
     const NetworkRpcName rpcName(typeHandle, GetCSharpCachedName(name));
     NetworkRpcInfo::RPCsTable[rpcName] = rpcInfo;
+    RpcIndexTableCount = -1;
 }
 
 bool NetworkReplicator::CSharpEndInvokeRPC(ScriptingObject* obj, const ScriptingTypeHandle& type, const StringAnsiView& name, NetworkStream* argsStream, MArray* targetIds)
@@ -1503,6 +2125,10 @@ NetworkStream* NetworkReplicator::BeginInvokeRPC()
     CachedWriteStream->Initialize();
     CachedWriteStream->SenderId = NetworkManager::LocalClientId;
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
+#if COMPILE_WITH_PROFILER
+    if (NetworkInternal::EnableProfiling)
+        RpcSerializeStartTime = Platform::GetTimeSeconds();
+#endif
     return CachedWriteStream;
 }
 
@@ -1515,13 +2141,34 @@ bool NetworkReplicator::EndInvokeRPC(ScriptingObject* obj, const ScriptingTypeHa
     if (!info || !obj || NetworkManager::IsOffline())
         return false;
     ObjectsLock.Lock();
-    auto& rpc = RpcQueue.AddOne();
+    RpcItem* rpcPtr = nullptr;
+    if (info->LatestOnly && (info->Channel == (uint8)NetworkChannelType::Unreliable || info->Channel == (uint8)NetworkChannelType::UnreliableOrdered))
+    {
+        // Override the previous call of this RPC (on the same object and with the same targets) within this network update
+        const NetworkRpcName rpcName(type, name);
+        for (RpcItem& e : RpcQueue)
+        {
+            if (e.Name == rpcName && e.Object == obj &&
+                e.Targets.Length() == targetIds.Length() &&
+                (targetIds.Length() == 0 || Platform::MemoryCompare(e.Targets.Get(), targetIds.Get(), targetIds.Length() * sizeof(uint32)) == 0))
+            {
+                rpcPtr = &e;
+                break;
+            }
+        }
+    }
+    if (!rpcPtr)
+        rpcPtr = &RpcQueue.AddOne();
+    auto& rpc = *rpcPtr;
     rpc.Object = obj;
     rpc.Name.First = type;
     rpc.Name.Second = name;
     rpc.Info = *info;
     rpc.ArgsData.Copy(Span<byte>(argsStream->GetBuffer(), argsStream->GetPosition()));
     rpc.Targets.Copy(targetIds);
+#if COMPILE_WITH_PROFILER
+    rpc.SerializeTime = NetworkInternal::EnableProfiling ? (float)((Platform::GetTimeSeconds() - RpcSerializeStartTime) * 1000.0) : 0.0f;
+#endif
     ObjectsLock.Unlock();
 
     // Check if skip local execution (eg. server rpc called from client or client rpc with specific targets)
@@ -1549,9 +2196,17 @@ void NetworkInternal::NetworkReplicatorClientDisconnected(NetworkClient* client)
 
     // Remove any objects owned by that client
     const uint32 clientId = client->ClientId;
+    RemoteRpcTableHashes.Remove(clientId);
+    for (int32 i = RpcBatches.Count() - 1; i >= 0; i--)
+    {
+        if (RpcBatches[i].ClientId == clientId)
+            RpcBatches.RemoveAt(i);
+    }
     for (auto it = Objects.Begin(); it.IsNotEnd(); ++it)
     {
         auto& item = it->Item;
+        item.AckedFrames.Remove(clientId);
+        item.PendingPriority.Remove(clientId);
         ScriptingObject* obj = item.Object.Get();
         if (obj && item.Spawned && item.OwnerClientId == clientId)
         {
@@ -1594,12 +2249,19 @@ void NetworkInternal::NetworkReplicatorClear()
     }
     Objects.Clear();
     RpcQueue.Clear();
+    RpcBatches.Clear();
+    RemoteRpcTableHashes.Clear();
     SpawnQueue.Clear();
     DespawnQueue.Clear();
     IdsRemappingTable.Clear();
     SAFE_DELETE(CachedWriteStream);
     SAFE_DELETE(CachedReadStream);
     SAFE_DELETE(CachedReplicationResult);
+    for (auto& job : ReplicationJobs)
+        SAFE_DELETE(job.Stream);
+    ReplicationJobs.Clear();
+    ReplicationCandidates.Clear();
+    DeferredObjects.Clear();
     NewClients.Clear();
     CachedTargets.Clear();
     DespawnedObjects.Clear();
@@ -1611,6 +2273,63 @@ void NetworkInternal::NetworkReplicatorPreUpdate()
     Scripting::ObjectsLookupIdMapping.Set(&IdsRemappingTable);
 }
 
+void SendObjectReplicateMessage(NetworkPeer* peer, NetworkMessageObjectReplicate& msgData, const byte* data, uint32 size, bool isClient, const Array<NetworkConnection>& targets, uint32& dataSize, uint32& messageSize)
+{
+    msgData.DataSize = size;
+    const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
+    const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
+    uint32 partsCount = 1;
+    uint32 dataStart = 0;
+    uint32 msgDataSize = size;
+    if (size > msgMaxData)
+    {
+        // Send msgMaxData within first message
+        msgDataSize = msgMaxData;
+        dataStart += msgMaxData;
+
+        // Send rest of the data in separate parts
+        partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+    }
+    else
+        dataStart += size;
+    ASSERT(partsCount <= MAX_uint8);
+    msgData.PartsCount = partsCount;
+    NetworkMessage msg = peer->BeginSendMessage();
+    msg.WriteStructure(msgData);
+    msg.WriteBytes(data, msgDataSize);
+    dataSize += msgDataSize;
+    messageSize += msg.Length;
+    if (isClient)
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+    else
+        peer->EndSendMessage(NetworkChannelType::Unreliable, msg, targets);
+
+    // Send all other parts
+    for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
+    {
+        NetworkMessageObjectReplicatePart msgDataPart;
+        msgDataPart.OwnerFrame = msgData.OwnerFrame;
+        msgDataPart.ObjectId = msgData.ObjectId;
+        msgDataPart.DataSize = msgData.DataSize;
+        msgDataPart.PartsCount = msgData.PartsCount;
+        msgDataPart.PartStart = dataStart;
+        msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
+        msgDataPart.BaselineFrame = msgData.BaselineFrame;
+        msgDataPart.RequestAck = msgData.RequestAck;
+        msg = peer->BeginSendMessage();
+        msg.WriteStructure(msgDataPart);
+        msg.WriteBytes(data + msgDataPart.PartStart, msgDataPart.PartSize);
+        messageSize += msg.Length;
+        dataSize += msgDataPart.PartSize;
+        dataStart += msgDataPart.PartSize;
+        if (isClient)
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+        else
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg, targets);
+    }
+    ASSERT_LOW_LAYER(dataStart == size);
+}
+
 void NetworkInternal::NetworkReplicatorUpdate()
 {
     PROFILE_CPU();
@@ -1788,7 +2507,7 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     auto& item = it->Item;
 
                     // Replicate from all collected parts data
-                    InvokeObjectReplication(item, e.OwnerFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId);
+                    InvokeObjectReplication(item, e.OwnerFrame, e.Data.Get(), e.Data.Count(), e.OwnerClientId, e.BaselineFrame, e.RequestAck);
                 }
             }
 
@@ -1832,14 +2551,28 @@ void NetworkInternal::NetworkReplicatorUpdate()
             CachedReplicationResult->AddObject(obj);
         }
     }
-    if (CachedReplicationResult->_entries.HasItems())
+    const bool useScheduler = !isClient && NetworkReplicator::ReplicationBudget > 0;
+    if (!useScheduler && DeferredObjects.HasItems())
+    {
+        // Scheduler got disabled so drop any deferred state
+        for (const Guid& id : DeferredObjects)
+        {
+            auto it = Objects.Find(id);
+            if (it.IsNotEnd())
+            {
+                it->Item.Deferred = 0;
+                it->Item.PendingPriority.Clear();
+            }
+        }
+        DeferredObjects.Clear();
+    }
+    if (CachedReplicationResult->_entries.HasItems() || DeferredObjects.HasItems())
     {
         PROFILE_CPU_NAMED("Replication");
-        if (CachedWriteStream == nullptr)
-            CachedWriteStream = New<NetworkStream>();
-        NetworkStream* stream = CachedWriteStream;
-        stream->SenderId = NetworkManager::LocalClientId;
-        // TODO: use Job System when replicated objects count is large
+        const bool deltaCompression = !isClient && NetworkReplicator::EnableDeltaCompression;
+
+        // Collect objects to replicate
+        int32 jobsCount = 0;
         for (auto& e : CachedReplicationResult->_entries)
         {
             ScriptingObject* obj = e.Object;
@@ -1856,19 +2589,83 @@ void NetworkInternal::NetworkReplicatorUpdate()
                     continue;
             }
 
-            if (item.AsNetworkObject)
-                item.AsNetworkObject->OnNetworkSerialize();
-
-            // Serialize object
-            stream->Initialize();
-            const bool failed = NetworkReplicator::InvokeSerializer(obj->GetTypeHandle(), obj, stream, true);
-            if (failed)
+            if (useScheduler)
+                item.JobIndex = jobsCount;
+            auto& job = AddReplicationJob(jobsCount, item, obj, e.Priority);
+            job.Targets = CachedTargets;
+            job.TargetIds = CachedTargetIds;
+        }
+        if (useScheduler && DeferredObjects.HasItems())
+        {
+            // Collect objects deferred by the scheduler for the clients that haven't received them yet
+            for (const Guid& id : DeferredObjects)
             {
-                //NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot serialize object {} of type {} (missing serialization logic)", item.ToString(), obj->GetType().ToString());
-                continue;
+                auto it = Objects.Find(id);
+                if (it.IsEnd())
+                    continue;
+                auto& item = it->Item;
+                item.Deferred = 0;
+                ScriptingObject* obj = item.Object.Get();
+                if (!obj || item.Role != NetworkObjectRole::OwnedAuthoritative)
+                {
+                    item.PendingPriority.Clear();
+                    continue;
+                }
+                ReplicationJob* job = item.JobIndex != -1 ? &ReplicationJobs[item.JobIndex] : nullptr;
+                for (auto i = item.PendingPriority.Begin(); i.IsNotEnd(); ++i)
+                {
+                    const NetworkClient* client = NetworkManager::GetClient(i->Key);
+                    if (!client || client->State != NetworkConnectionState::Connected)
+                    {
+                        item.PendingPriority.Remove(i);
+                        continue;
+                    }
+                    if (job && job->TargetIds.Contains(i->Key))
+                        continue;
+                    if (!job)
+                    {
+                        item.JobIndex = jobsCount;
+                        job = &AddReplicationJob(jobsCount, item, obj, 0.0f);
+                        job->Targets.Clear();
+                        job->TargetIds.Clear();
+                    }
+                    job->Targets.Add(client->Connection);
+                    job->TargetIds.Add(client->ClientId);
+                }
             }
+            DeferredObjects.Clear();
+        }
+
+        // Serialize objects
+        {
+            PROFILE_CPU_NAMED("Serialize");
+            RunReplicationJobs(SerializeReplicationJob, jobsCount);
+        }
 
-            // Send object to clients
+        // Limit the amount of data sent to each client
+        if (useScheduler)
+        {
+            for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+                ReplicationJobs[jobIndex].Item->JobIndex = -1;
+            ScheduleReplicationJobs(jobsCount);
+        }
+
+        // Encode deltas for each group of clients with the same baseline
+        if (deltaCompression)
+        {
+            PROFILE_CPU_NAMED("Encode");
+            RunReplicationJobs(EncodeReplicationJob, jobsCount);
+        }
+
+        // Send objects to clients (in the same order as objects were collected)
+        for (int32 jobIndex = 0; jobIndex < jobsCount; jobIndex++)
+        {
+            auto& job = ReplicationJobs[jobIndex];
+            if (job.Failed)
+                continue;
+            ScriptingObject* obj = job.Object;
+            auto& item = *job.Item;
+            NetworkStream* stream = job.Stream;
             const uint32 size = stream->GetPosition();
             ASSERT(size <= MAX_uint16);
             NetworkMessageObjectReplicate msgData;
@@ -1882,56 +2679,28 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
             }
             GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            msgData.DataSize = size;
-            const uint32 msgMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicate);
-            const uint32 partMaxData = peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicatePart);
-            uint32 partsCount = 1;
-            uint32 dataStart = 0;
-            uint32 msgDataSize = size;
-            if (size > msgMaxData)
+            msgData.BaselineFrame = 0;
+            msgData.RequestAck = 0;
+            uint32 dataSize = 0, messageSize = 0;
+            if (deltaCompression)
             {
-                // Send msgMaxData within first message
-                msgDataSize = msgMaxData;
-                dataStart += msgMaxData;
-
-                // Send rest of the data in separate parts
-                partsCount += Math::DivideAndRoundUp(size - dataStart, partMaxData);
+                // Send state encoded against the last state acknowledged by each client (clients with the same baseline receive the same message)
+                msgData.RequestAck = 1;
+                for (int32 groupIndex = 0; groupIndex < job.GroupsCount; groupIndex++)
+                {
+                    const auto& group = job.Groups[groupIndex];
+                    msgData.BaselineFrame = group.UseDelta ? group.BaselineFrame : 0;
+                    if (group.UseDelta)
+                        SendObjectReplicateMessage(peer, msgData, group.DeltaData.Get(), group.DeltaData.Count(), isClient, group.Targets, dataSize, messageSize);
+                    else
+                        SendObjectReplicateMessage(peer, msgData, stream->GetBuffer(), size, isClient, group.Targets, dataSize, messageSize);
+                }
+                AddSnapshot(item, msgData.OwnerFrame, stream->GetBuffer(), size);
             }
             else
-                dataStart += size;
-            ASSERT(partsCount <= MAX_uint8);
-            msgData.PartsCount = partsCount;
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(stream->GetBuffer(), msgDataSize);
-            uint32 dataSize = msgDataSize, messageSize = msg.Length;
-            if (isClient)
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
-            else
-                peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
-
-            // Send all other parts
-            for (uint32 partIndex = 1; partIndex < partsCount; partIndex++)
             {
-                NetworkMessageObjectReplicatePart msgDataPart;
-                msgDataPart.OwnerFrame = msgData.OwnerFrame;
-                msgDataPart.ObjectId = msgData.ObjectId;
-                msgDataPart.DataSize = msgData.DataSize;
-                msgDataPart.PartsCount = msgData.PartsCount;
-                msgDataPart.PartStart = dataStart;
-                msgDataPart.PartSize = Math::Min(size - dataStart, partMaxData);
-                msg = peer->BeginSendMessage();
-                msg.WriteStructure(msgDataPart);
-                msg.WriteBytes(stream->GetBuffer() + msgDataPart.PartStart, msgDataPart.PartSize);
-                messageSize += msg.Length;
-                dataSize += msgDataPart.PartSize;
-                dataStart += msgDataPart.PartSize;
-                if (isClient)
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
-                else
-                    peer->EndSendMessage(NetworkChannelType::Unreliable, msg, CachedTargets);
+                SendObjectReplicateMessage(peer, msgData, stream->GetBuffer(), size, isClient, job.Targets, dataSize, messageSize);
             }
-            ASSERT_LOW_LAYER(dataStart == size);
 
 #if COMPILE_WITH_PROFILER
             // Network stats recording
@@ -1942,15 +2711,34 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 profileEvent.Count++;
                 profileEvent.DataSize += dataSize;
                 profileEvent.MessageSize += messageSize;
-                profileEvent.Receivers += isClient ? 1 : CachedTargets.Count();
+                profileEvent.Receivers += isClient ? 1 : job.Targets.Count();
+                profileEvent.SerializeTime += job.SerializeTime;
             }
 #endif
         }
     }
 
+    // Acknowledge the received objects states (used by server as delta compression baselines)
+    if (isClient && ReplicationAcks.HasItems())
+    {
+        PROFILE_CPU_NAMED("ReplicationAcks");
+        const int32 maxItems = (int32)((peer->Config.MessageSize - sizeof(NetworkMessageObjectReplicateAck)) / sizeof(NetworkMessageObjectReplicateAckItem));
+        for (int32 start = 0; start < ReplicationAcks.Count(); start += maxItems)
+        {
+            NetworkMessageObjectReplicateAck msgData;
+            msgData.ItemsCount = (uint16)Math::Min(ReplicationAcks.Count() - start, maxItems);
+            NetworkMessage msg = peer->BeginSendMessage();
+            msg.WriteStructure(msgData);
+            msg.WriteBytes((uint8*)(ReplicationAcks.Get() + start), msgData.ItemsCount * sizeof(NetworkMessageObjectReplicateAckItem));
+            peer->EndSendMessage(NetworkChannelType::Unreliable, msg);
+        }
+        ReplicationAcks.Clear();
+    }
+
     // Invoke RPCs
     {
         PROFILE_CPU_NAMED("Rpc");
+        UpdateRpcIndexTable();
         for (auto& e : RpcQueue)
         {
             ScriptingObject* obj = e.Object.Get();
@@ -1969,24 +2757,24 @@ void NetworkInternal::NetworkReplicatorUpdate()
 
             // Send RPC message
             //NETWORK_REPLICATOR_LOG(Info, "[NetworkReplicator] Rpc {}::{} object ID={}", e.Name.First.ToString(), String(e.Name.Second), item.ToString());
-            NetworkMessageObjectRpc msgData;
-            msgData.ObjectId = item.ObjectId;
-            msgData.ParentId = item.ParentId;
-            if (isClient)
+            const NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+            const uint32 dataSize = e.ArgsData.Length();
+            uint32 messageSize = 0, receivers = 0;
+
+            // Check if RPC can be batched (object has to be already known by remote peers as batched message doesn't contain parent and type info)
+            NetworkMessageObjectRpcBatchItem batchItem;
+            const uint16* rpcIndex = nullptr;
+            if (NetworkReplicator::EnableRpcBatching && item.Spawned && sizeof(NetworkMessageObjectRpcBatch) + sizeof(NetworkMessageObjectRpcBatchItem) + dataSize <= peer->Config.MessageSize)
+                rpcIndex = RpcIndexLookup.TryGet(e.Name);
+            if (rpcIndex)
             {
-                // Remap local client object ids into server ids
-                IdsRemappingTable.KeyOf(msgData.ObjectId, &msgData.ObjectId);
-                IdsRemappingTable.KeyOf(msgData.ParentId, &msgData.ParentId);
+                batchItem.ObjectId = item.ObjectId;
+                if (isClient)
+                    IdsRemappingTable.KeyOf(batchItem.ObjectId, &batchItem.ObjectId);
+                batchItem.RpcIndex = *rpcIndex;
+                batchItem.ArgsSize = (uint16)dataSize;
             }
-            GetNetworkName(msgData.ObjectTypeName, obj->GetType().Fullname);
-            GetNetworkName(msgData.RpcTypeName, e.Name.First.GetType().Fullname);
-            GetNetworkName(msgData.RpcName, e.Name.Second);
-            msgData.ArgsSize = (uint16)e.ArgsData.Length();
-            NetworkMessage msg = peer->BeginSendMessage();
-            msg.WriteStructure(msgData);
-            msg.WriteBytes(e.ArgsData.Get(), e.ArgsData.Length());
-            uint32 dataSize = e.ArgsData.Length(), messageSize = msg.Length, receivers = 0;
-            NetworkChannelType channel = (NetworkChannelType)e.Info.Channel;
+
             if (e.Info.Server && isClient)
             {
                 // Client -> Server
@@ -1994,14 +2782,42 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 if (e.Targets.Length() != 0)
                     NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Server RPC '{}::{}' called with non-empty list of targets is not supported (only server will receive it)", e.Name.First.ToString(), e.Name.Second.ToString());
 #endif
-                peer->EndSendMessage(channel, msg);
+                if (rpcIndex && CanBatchRpc(NetworkManager::ServerClientId))
+                {
+                    AddRpcBatchItem(peer, NetworkManager::ServerClientId, NetworkConnection(), channel, batchItem, e.ArgsData, isClient);
+                    messageSize = sizeof(batchItem) + dataSize;
+                }
+                else
+                {
+                    // Keep order of the messages within the channel
+                    FlushRpcBatch(peer, NetworkManager::ServerClientId, channel, isClient);
+                    messageSize = SendRpcMessage(peer, e, item, obj, isClient, nullptr);
+                }
                 receivers = 1;
             }
             else if (e.Info.Client && (isServer || isHost))
             {
                 // Server -> Client(s)
                 BuildCachedTargets(NetworkManager::Clients, item.TargetClientIds, e.Targets, NetworkManager::LocalClientId);
-                peer->EndSendMessage(channel, msg, CachedTargets);
+                CachedRpcTargets.Clear();
+                for (int32 i = 0; i < CachedTargets.Count(); i++)
+                {
+                    const uint32 clientId = CachedTargetIds[i];
+                    if (rpcIndex && CanBatchRpc(clientId))
+                    {
+                        AddRpcBatchItem(peer, clientId, CachedTargets[i], channel, batchItem, e.ArgsData, isClient);
+                    }
+                    else
+                    {
+                        // Keep order of the messages within the channel
+                        FlushRpcBatch(peer, clientId, channel, isClient);
+                        CachedRpcTargets.Add(CachedTargets[i]);
+                    }
+                }
+                if (CachedRpcTargets.HasItems())
+                    messageSize = SendRpcMessage(peer, e, item, obj, isClient, &CachedRpcTargets);
+                else
+                    messageSize = sizeof(batchItem) + dataSize;
                 receivers = CachedTargets.Count();
             }
 
@@ -2014,10 +2830,18 @@ void NetworkInternal::NetworkReplicatorUpdate()
                 profileEvent.DataSize += dataSize;
                 profileEvent.MessageSize += messageSize;
                 profileEvent.Receivers += receivers;
+                profileEvent.SerializeTime += e.SerializeTime;
             }
 #endif
         }
         RpcQueue.Clear();
+
+        // Send the remaining batched RPCs
+        for (RpcBatch& batch : RpcBatches)
+        {
+            if (batch.ItemsCount != 0)
+                FlushRpcBatch(peer, batch, isClient);
+        }
     }
 
     // Clear networked objects mapping table
@@ -2045,7 +2869,7 @@ void NetworkInternal::OnNetworkMessageObjectReplicate(NetworkEvent& event, Netwo
     if (msgData.PartsCount == 1)
     {
         // Replicate
-        InvokeObjectReplication(item, msgData.OwnerFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId);
+        InvokeObjectReplication(item, msgData.OwnerFrame, event.Message.Buffer + event.Message.Position, msgData.DataSize, senderClientId, msgData.BaselineFrame, msgData.RequestAck);
     }
     else
     {
@@ -2069,6 +2893,28 @@ void NetworkInternal::OnNetworkMessageObjectReplicatePart(NetworkEvent& event, N
     AddObjectReplicateItem(event, msgData, msgData.PartStart, msgData.PartSize, senderClientId);
 }
 
+void NetworkInternal::OnNetworkMessageObjectReplicateAck(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    PROFILE_CPU();
+    NetworkMessageObjectReplicateAck msgData;
+    event.Message.ReadStructure(msgData);
+    if (!client)
+        return; // Only clients acknowledge server states
+    const auto* msgDataItems = (const NetworkMessageObjectReplicateAckItem*)event.Message.SkipBytes(msgData.ItemsCount * sizeof(NetworkMessageObjectReplicateAckItem));
+    ScopeLock lock(ObjectsLock);
+    for (int32 i = 0; i < msgData.ItemsCount; i++)
+    {
+        const NetworkMessageObjectReplicateAckItem& ack = msgDataItems[i];
+        auto it = Objects.Find(ack.ObjectId);
+        if (it.IsEnd())
+            continue;
+        auto& item = it->Item;
+        const uint32* ackedFrame = item.AckedFrames.TryGet(client->ClientId);
+        if (!ackedFrame || *ackedFrame < ack.OwnerFrame)
+            item.AckedFrames[client->ClientId] = ack.OwnerFrame;
+    }
+}
+
 void NetworkInternal::OnNetworkMessageObjectSpawn(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
 {
     PROFILE_CPU();
@@ -2223,45 +3069,61 @@ void NetworkInternal::OnNetworkMessageObjectRpc(NetworkEvent& event, NetworkClie
     NetworkRpcName name;
     name.First = Scripting::FindScriptingType(msgData.RpcTypeName);
     name.Second = msgData.RpcName;
-    const NetworkRpcInfo* info = NetworkRpcInfo::RPCsTable.TryGet(name);
-    if (!info)
+    const auto it = NetworkRpcInfo::RPCsTable.Find(name);
+    if (it == NetworkRpcInfo::RPCsTable.End())
     {
         NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown RPC {}::{} for object {}", String(msgData.RpcTypeName), String(msgData.RpcName), msgData.ObjectId);
         return;
     }
 
+    // Use name from the RPCs table as the received one points to the temporary message data
     NetworkReplicatedObject* e = ResolveObject(msgData.ObjectId, msgData.ParentId, msgData.ObjectTypeName);
-    if (e)
+    InvokeObjectRpc(e, msgData.ObjectId, it->Key, it->Value, event.Message.Buffer + event.Message.Position, msgData.ArgsSize, client);
+}
+
+void NetworkInternal::OnNetworkMessageObjectRpcBatch(NetworkEvent& event, NetworkClient* client, NetworkPeer* peer)
+{
+    PROFILE_CPU();
+    NetworkMessageObjectRpcBatch msgData;
+    event.Message.ReadStructure(msgData);
+    ScopeLock lock(ObjectsLock);
+    UpdateRpcIndexTable();
+    if (msgData.RpcTableHash != RpcIndexTableHash)
     {
-        auto& item = *e;
-        ScriptingObject* obj = item.Object.Get();
-        if (!obj)
-            return;
+        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Mismatching RPCs table in batched RPCs message");
+        return;
+    }
 
-        // Validate RPC
-        if (info->Server && NetworkManager::IsClient())
-        {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke server RPC {}::{} on client", String(msgData.RpcTypeName), String(msgData.RpcName));
-            return;
-        }
-        if (info->Client && NetworkManager::IsServer())
+    for (int32 i = 0; i < msgData.ItemsCount; i++)
+    {
+        NetworkMessageObjectRpcBatchItem itemData;
+        event.Message.ReadStructure(itemData);
+        byte* args = event.Message.Buffer + event.Message.Position;
+        if (itemData.RpcIndex >= RpcIndexTable.Count() || event.Message.Position + itemData.ArgsSize > event.Message.Length)
         {
-            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Cannot invoke client RPC {}::{} on server", String(msgData.RpcTypeName), String(msgData.RpcName));
+            NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Invalid batched RPCs message");
             return;
         }
+        event.Message.Position += itemData.ArgsSize;
 
-        // Setup message reading stream
-        if (CachedReadStream == nullptr)
-            CachedReadStream = New<NetworkStream>();
-        NetworkStream* stream = CachedReadStream;
-        stream->SenderId = client ? client->ClientId : NetworkManager::ServerClientId;
-        stream->Initialize(event.Message.Buffer + event.Message.Position, msgData.ArgsSize);
-
-        // Execute RPC
-        info->Execute(obj, stream, info->Tag);
-    }
-    else if (info->Channel != static_cast<uint8>(NetworkChannelType::Unreliable) && info->Channel != static_cast<uint8>(NetworkChannelType::UnreliableOrdered))
-    {
-        NETWORK_REPLICATOR_LOG(Error, "[NetworkReplicator] Unknown object {} RPC {}::{}", msgData.ObjectId, String(msgData.RpcTypeName), String(msgData.RpcName));
+        const NetworkRpcName& name = RpcIndexTable[itemData.RpcIndex];
+        const NetworkRpcInfo* info = NetworkRpcInfo::RPCsTable.TryGet(name);
+        if (!info)
+            continue;
+        NetworkReplicatedObject* e = ResolveObject(itemData.ObjectId);
+        InvokeObjectRpc(e, itemData.ObjectId, name, *info, args, itemData.ArgsSize, client);
     }
 }
+
+uint32 NetworkInternal::GetRpcTableHash()
+{
+    ScopeLock lock(ObjectsLock);
+    UpdateRpcIndexTable();
+    return RpcIndexTableHash;
+}
+
+void NetworkInternal::SetRemoteRpcTableHash(uint32 clientId, uint32 hash)
+{
+    ScopeLock lock(ObjectsLock);
+    RemoteRpcTableHashes[clientId] = hash;
+}
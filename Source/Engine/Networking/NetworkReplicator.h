@@ -42,6 +42,26 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     API_FIELD() static bool EnableLog;
 #endif
 
+    /// <summary>
+    /// Enables delta compression of the objects replicated by the server. Clients acknowledge the received object states and server encodes the next states against the last acknowledged one (per-client). Reduces the outgoing bandwidth of the server when replicated objects change only a part of their state. Server sends the full state to clients that haven't acknowledged any recent state.
+    /// </summary>
+    API_FIELD() static bool EnableDeltaCompression;
+
+    /// <summary>
+    /// Enables serialization of the replicated objects (and encoding of the per-client deltas) on the Job System when there is a large amount of objects to replicate. Messages are still sent from the main thread in the same order. Requires objects serialization code to be thread-safe.
+    /// </summary>
+    API_FIELD() static bool EnableParallelReplication;
+
+    /// <summary>
+    /// The maximum amount of the replicated objects data (in bytes) sent by the server to each client per network update. Objects that don't fit are deferred to the next updates and their priority (from replication rate and distance to the client) is accumulated so stale objects get sent first. Smooths the bandwidth usage when many objects get dirty at once. Use 0 to disable (unlimited).
+    /// </summary>
+    API_FIELD() static int32 ReplicationBudget;
+
+    /// <summary>
+    /// Enables coalescing of the RPCs sent within a single network update into one message per target and channel. Batched RPCs use a compact index (instead of type and method names) that is used only with peers that have matching RPCs table (validated during connection handshake), otherwise RPCs are sent separately as before.
+    /// </summary>
+    API_FIELD() static bool EnableRpcBatching;
+
     /// <summary>
     /// Gets the network replication hierarchy.
     /// </summary>
@@ -214,7 +234,7 @@ API_CLASS(static, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
 private:
 #if !COMPILE_WITHOUT_CSHARP
     API_FUNCTION(NoProxy) static void AddSerializer(const ScriptingTypeHandle& typeHandle, const Function<void(void*, void*)>& serialize, const Function<void(void*, void*)>& deserialize);
-    API_FUNCTION(NoProxy) static void AddRPC(const ScriptingTypeHandle& typeHandle, const StringAnsiView& name, const Function<void(void*, void*)>& execute, bool isServer, bool isClient, NetworkChannelType channel);
+    API_FUNCTION(NoProxy) static void AddRPC(const ScriptingTypeHandle& typeHandle, const StringAnsiView& name, const Function<void(void*, void*)>& execute, bool isServer, bool isClient, NetworkChannelType channel, bool latestOnly);
     API_FUNCTION(NoProxy) static bool CSharpEndInvokeRPC(ScriptingObject* obj, const ScriptingTypeHandle& type, const StringAnsiView& name, NetworkStream* argsStream, MArray* targetIds);
     static StringAnsiView GetCSharpCachedName(const StringAnsiView& name);
 #endif
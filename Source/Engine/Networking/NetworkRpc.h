@@ -40,6 +40,7 @@ struct FLAXENGINE_API NetworkRpcInfo
     uint8 Server : 1;
     uint8 Client : 1;
     uint8 Channel : 4;
+    uint8 LatestOnly : 1; // Unreliable RPC invoked many times within a single network update sends only the latest call (per object and targets)
     void (*Execute)(ScriptingObject* obj, NetworkStream* stream, void* tag);
     bool (*Invoke)(ScriptingObject* obj, void** args);
     void* Tag;
@@ -2,6 +2,49 @@
 
 #include "NetworkStream.h"
 #include "INetworkSerializable.h"
+#include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Math/Vector3.h"
+
+namespace
+{
+    FORCE_INLINE uint32 QuantizeFloat(float value, float min, float max, int32 bitsCount)
+    {
+        const uint32 maxValue = bitsCount >= 32 ? MAX_uint32 : (1u << bitsCount) - 1;
+        const float alpha = Math::Saturate((value - min) / (max - min));
+        return (uint32)((double)alpha * maxValue + 0.5);
+    }
+
+    FORCE_INLINE float DequantizeFloat(uint32 value, float min, float max, int32 bitsCount)
+    {
+        const uint32 maxValue = bitsCount >= 32 ? MAX_uint32 : (1u << bitsCount) - 1;
+        return min + (float)((double)value / maxValue) * (max - min);
+    }
+
+    void WriteVarInt(NetworkStream* stream, int32 value)
+    {
+        // Zig-zag encoding in 4-bit groups with a continuation bit
+        uint32 v = ((uint32)value << 1) ^ (uint32)(value >> 31);
+        do
+        {
+            const uint32 group = v & 0xf;
+            v >>= 4;
+            stream->WriteBits(group | (v != 0 ? 0x10 : 0), 5);
+        } while (v != 0);
+    }
+
+    int32 ReadVarInt(NetworkStream* stream)
+    {
+        uint32 v = 0;
+        for (int32 shift = 0; shift < 32; shift += 4)
+        {
+            const uint32 group = stream->ReadBits(5);
+            v |= (group & 0xf) << shift;
+            if ((group & 0x10) == 0)
+                break;
+        }
+        return (int32)(v >> 1) ^ -(int32)(v & 1);
+    }
+}
 
 NetworkStream::NetworkStream(const SpawnParams& params)
     : ScriptingObject(params)
@@ -37,6 +80,7 @@ void NetworkStream::Initialize(uint32 minCapacity)
 
     // Reset pointer to the start
     _position = _buffer;
+    _bitPosition = 0;
 }
 
 void NetworkStream::Initialize(byte* buffer, uint32 length)
@@ -45,9 +89,132 @@ void NetworkStream::Initialize(byte* buffer, uint32 length)
         Allocator::Free(_buffer);
     _position = _buffer = buffer;
     _length = length;
+    _bitPosition = 0;
     _allocated = false;
 }
 
+void NetworkStream::WriteBits(uint32 value, int32 bitsCount)
+{
+    ASSERT(bitsCount >= 0 && bitsCount <= 32);
+    while (bitsCount > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Start a new byte
+            const byte zero = 0;
+            WriteBytes(&zero, 1);
+        }
+        const int32 count = Math::Min(8 - _bitPosition, bitsCount);
+        *(_position - 1) |= (byte)((value & ((1u << count) - 1)) << _bitPosition);
+        value >>= count;
+        bitsCount -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+}
+
+uint32 NetworkStream::ReadBits(int32 bitsCount)
+{
+    ASSERT(bitsCount >= 0 && bitsCount <= 32);
+    uint32 result = 0;
+    int32 shift = 0;
+    while (bitsCount > 0)
+    {
+        if (_bitPosition == 0)
+        {
+            // Move to the next byte
+            ASSERT(GetLength() - GetPosition() >= 1);
+            _position++;
+        }
+        const int32 count = Math::Min(8 - _bitPosition, bitsCount);
+        const uint32 bits = (*(_position - 1) >> _bitPosition) & ((1u << count) - 1);
+        result |= bits << shift;
+        shift += count;
+        bitsCount -= count;
+        _bitPosition = (_bitPosition + count) & 7;
+    }
+    return result;
+}
+
+void NetworkStream::WriteFloatQuantized(float value, float min, float max, int32 bitsCount)
+{
+    ASSERT(bitsCount > 0 && max > min);
+    WriteBits(QuantizeFloat(value, min, max, bitsCount), bitsCount);
+}
+
+float NetworkStream::ReadFloatQuantized(float min, float max, int32 bitsCount)
+{
+    ASSERT(bitsCount > 0 && max > min);
+    return DequantizeFloat(ReadBits(bitsCount), min, max, bitsCount);
+}
+
+void NetworkStream::WriteQuaternionQuantized(const Quaternion& value, int32 bitsPerComponent)
+{
+    // Find the largest component (it can be reconstructed from the other three)
+    Quaternion q = value;
+    q.Normalize();
+    int32 largest = 0;
+    for (int32 i = 1; i < 4; i++)
+    {
+        if (Math::Abs(q.Raw[i]) > Math::Abs(q.Raw[largest]))
+            largest = i;
+    }
+
+    // Flip the sign so the largest is always positive (q and -q represent the same rotation)
+    const float sign = q.Raw[largest] < 0.0f ? -1.0f : 1.0f;
+
+    // Other components are within [-1/sqrt(2), 1/sqrt(2)] range
+    constexpr float range = 0.707107f;
+    WriteBits(largest, 2);
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+            WriteFloatQuantized(q.Raw[i] * sign, -range, range, bitsPerComponent);
+    }
+}
+
+Quaternion NetworkStream::ReadQuaternionQuantized(int32 bitsPerComponent)
+{
+    constexpr float range = 0.707107f;
+    Quaternion q;
+    const int32 largest = (int32)ReadBits(2);
+    float sumSquared = 0.0f;
+    for (int32 i = 0; i < 4; i++)
+    {
+        if (i != largest)
+        {
+            const float v = ReadFloatQuantized(-range, range, bitsPerComponent);
+            q.Raw[i] = v;
+            sumSquared += v * v;
+        }
+    }
+    q.Raw[largest] = Math::Sqrt(Math::Max(1.0f - sumSquared, 0.0f));
+    q.Normalize();
+    return q;
+}
+
+void NetworkStream::WritePositionQuantized(const Vector3& value, float cellSize, int32 bitsPerComponent)
+{
+    ASSERT(cellSize > 0.0f);
+    for (int32 i = 0; i < 3; i++)
+    {
+        const int32 cell = (int32)floor((double)value.Raw[i] / cellSize);
+        WriteVarInt(this, cell);
+        WriteFloatQuantized((float)(value.Raw[i] - (Real)cell * cellSize), 0.0f, cellSize, bitsPerComponent);
+    }
+}
+
+Vector3 NetworkStream::ReadPositionQuantized(float cellSize, int32 bitsPerComponent)
+{
+    ASSERT(cellSize > 0.0f);
+    Vector3 result;
+    for (int32 i = 0; i < 3; i++)
+    {
+        const int32 cell = ReadVarInt(this);
+        result.Raw[i] = (Real)cell * cellSize + ReadFloatQuantized(0.0f, cellSize, bitsPerComponent);
+    }
+    return result;
+}
+
 void NetworkStream::Read(INetworkSerializable& obj)
 {
     obj.Deserialize(this);
@@ -79,6 +246,7 @@ void NetworkStream::Close()
         Allocator::Free(_buffer);
     _position = _buffer = nullptr;
     _length = 0;
+    _bitPosition = 0;
     _allocated = false;
 }
 
@@ -96,10 +264,12 @@ void NetworkStream::SetPosition(uint32 seek)
 {
     ASSERT(_length > 0);
     _position = _buffer + seek;
+    _bitPosition = 0;
 }
 
 void NetworkStream::ReadBytes(void* data, uint32 bytes)
 {
+    _bitPosition = 0;
     if (bytes > 0)
     {
         ASSERT(data && GetLength() - GetPosition() >= bytes);
@@ -112,6 +282,7 @@ void NetworkStream::WriteBytes(const void* data, uint32 bytes)
 {
     // Calculate current position
     const uint32 position = GetPosition();
+    _bitPosition = 0;
 
     // Check if there is need to update a buffer size
     if (_length - position < bytes)
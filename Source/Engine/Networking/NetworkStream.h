@@ -18,6 +18,7 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
     byte* _buffer = nullptr;
     byte* _position = nullptr;
     uint32 _length = 0;
+    int32 _bitPosition = 0;
     bool _allocated = false;
 
 public:
@@ -69,6 +70,68 @@ API_CLASS(sealed, Namespace = "FlaxEngine.Networking") class FLAXENGINE_API Netw
         ReadBytes(data, bytes);
     }
 
+    /// <summary>
+    /// Writes the lowest bits of the value to the stream. Consecutive bit writes are packed together into bytes, any byte-level write starts from a next byte.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="bitsCount">The amount of bits to write (in range 0-32).</param>
+    API_FUNCTION() void WriteBits(uint32 value, int32 bitsCount);
+
+    /// <summary>
+    /// Reads the bits from the stream (written with WriteBits).
+    /// </summary>
+    /// <param name="bitsCount">The amount of bits to read (in range 0-32).</param>
+    /// <returns>The read value.</returns>
+    API_FUNCTION() uint32 ReadBits(int32 bitsCount);
+
+    /// <summary>
+    /// Writes the float value quantized into the given range using a specified amount of bits. Values outside the range are clamped.
+    /// </summary>
+    /// <param name="value">The value to write.</param>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bitsCount">The amount of bits to use (in range 1-32).</param>
+    API_FUNCTION() void WriteFloatQuantized(float value, float min, float max, int32 bitsCount);
+
+    /// <summary>
+    /// Reads the float value quantized into the given range (written with WriteFloatQuantized).
+    /// </summary>
+    /// <param name="min">The minimum value of the range.</param>
+    /// <param name="max">The maximum value of the range.</param>
+    /// <param name="bitsCount">The amount of bits to use (in range 1-32).</param>
+    /// <returns>The read value.</returns>
+    API_FUNCTION() float ReadFloatQuantized(float min, float max, int32 bitsCount);
+
+    /// <summary>
+    /// Writes the rotation using smallest-three compression (2 bits for the largest component index and 3 quantized components).
+    /// </summary>
+    /// <param name="value">The rotation to write (normalized).</param>
+    /// <param name="bitsPerComponent">The amount of bits per each of the 3 encoded components. Default value of 10 results in 32 bits for the whole rotation.</param>
+    API_FUNCTION() void WriteQuaternionQuantized(const Quaternion& value, int32 bitsPerComponent = 10);
+
+    /// <summary>
+    /// Reads the rotation written with smallest-three compression (written with WriteQuaternionQuantized).
+    /// </summary>
+    /// <param name="bitsPerComponent">The amount of bits per each of the 3 encoded components.</param>
+    /// <returns>The read rotation.</returns>
+    API_FUNCTION() Quaternion ReadQuaternionQuantized(int32 bitsPerComponent = 10);
+
+    /// <summary>
+    /// Writes the position quantized relative to the grid cell it's located in. Cell coordinates use variable-length encoding (small for positions near the origin) and the offset within the cell is quantized per-axis.
+    /// </summary>
+    /// <param name="value">The position to write.</param>
+    /// <param name="cellSize">The size of the grid cell (in world units).</param>
+    /// <param name="bitsPerComponent">The amount of bits per each offset component within the cell. Precision equals cellSize / (2^bitsPerComponent - 1).</param>
+    API_FUNCTION() void WritePositionQuantized(const Vector3& value, float cellSize = 1024.0f, int32 bitsPerComponent = 14);
+
+    /// <summary>
+    /// Reads the position quantized relative to the grid cell (written with WritePositionQuantized).
+    /// </summary>
+    /// <param name="cellSize">The size of the grid cell (in world units).</param>
+    /// <param name="bitsPerComponent">The amount of bits per each offset component within the cell.</param>
+    /// <returns>The read position.</returns>
+    API_FUNCTION() Vector3 ReadPositionQuantized(float cellSize = 1024.0f, int32 bitsPerComponent = 14);
+
     using ReadStream::Read;
     void Read(INetworkSerializable& obj);
     void Read(INetworkSerializable* obj);
@@ -0,0 +1,177 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/SIMD.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Vector4.h"
+
+/// <summary>
+/// Vectorized kernels for the common CPU particle modules. Particles data is stored interleaved (the same layout is used by the GPU for drawing) so kernels transpose the attributes of 4 particles into SIMD vectors (SoA), process them at once and write the results back.
+/// </summary>
+namespace ParticleKernels
+{
+    FORCE_INLINE SimdVector4 LoadFloat(const byte* ptr, int32 stride)
+    {
+        return SIMD::Load(*(const float*)ptr, *(const float*)(ptr + stride), *(const float*)(ptr + stride * 2), *(const float*)(ptr + stride * 3));
+    }
+
+    FORCE_INLINE void LoadFloat3(const byte* ptr, int32 stride, SimdVector4& x, SimdVector4& y, SimdVector4& z)
+    {
+        const float* p0 = (const float*)ptr;
+        const float* p1 = (const float*)(ptr + stride);
+        const float* p2 = (const float*)(ptr + stride * 2);
+        const float* p3 = (const float*)(ptr + stride * 3);
+        x = SIMD::Load(p0[0], p1[0], p2[0], p3[0]);
+        y = SIMD::Load(p0[1], p1[1], p2[1], p3[1]);
+        z = SIMD::Load(p0[2], p1[2], p2[2], p3[2]);
+    }
+
+    FORCE_INLINE void StoreFloat(byte* ptr, int32 stride, SimdVector4 value)
+    {
+        ALIGN_BEGIN(16) float data[4] ALIGN_END(16);
+        SIMD::Store(data, value);
+        for (int32 i = 0; i < 4; i++)
+            *(float*)(ptr + stride * i) = data[i];
+    }
+
+    FORCE_INLINE void StoreFloat3(byte* ptr, int32 stride, SimdVector4 x, SimdVector4 y, SimdVector4 z)
+    {
+        ALIGN_BEGIN(16) float data[3][4] ALIGN_END(16);
+        SIMD::Store(data[0], x);
+        SIMD::Store(data[1], y);
+        SIMD::Store(data[2], z);
+        for (int32 i = 0; i < 4; i++)
+        {
+            float* p = (float*)(ptr + stride * i);
+            p[0] = data[0][i];
+            p[1] = data[1][i];
+            p[2] = data[2][i];
+        }
+    }
+
+    /// <summary>
+    /// Adds a constant value to the float attribute of the particles (eg. age update).
+    /// </summary>
+    inline void AddFloat(byte* ptr, int32 stride, int32 count, float value)
+    {
+        const SimdVector4 v = SIMD::Splat(value);
+        for (; count >= 4; count -= 4, ptr += stride * 4)
+            StoreFloat(ptr, stride, SIMD::Add(LoadFloat(ptr, stride), v));
+        for (; count > 0; count--, ptr += stride)
+            *(float*)ptr += value;
+    }
+
+    /// <summary>
+    /// Adds a constant value to the Float3 attribute of the particles (eg. gravity or force applied to velocity).
+    /// </summary>
+    inline void AddFloat3(byte* ptr, int32 stride, int32 count, const Float3& value)
+    {
+        const SimdVector4 vx = SIMD::Splat(value.X);
+        const SimdVector4 vy = SIMD::Splat(value.Y);
+        const SimdVector4 vz = SIMD::Splat(value.Z);
+        SimdVector4 x, y, z;
+        for (; count >= 4; count -= 4, ptr += stride * 4)
+        {
+            LoadFloat3(ptr, stride, x, y, z);
+            StoreFloat3(ptr, stride, SIMD::Add(x, vx), SIMD::Add(y, vy), SIMD::Add(z, vz));
+        }
+        for (; count > 0; count--, ptr += stride)
+            *(Float3*)ptr += value;
+    }
+
+    /// <summary>
+    /// Adds the scaled Float3 attribute to the other Float3 attribute of the particles (eg. Euler integration of position with velocity).
+    /// </summary>
+    inline void AddScaledFloat3(byte* dstPtr, const byte* srcPtr, int32 stride, int32 count, float scale)
+    {
+        const SimdVector4 s = SIMD::Splat(scale);
+        SimdVector4 x, y, z, sx, sy, sz;
+        for (; count >= 4; count -= 4, dstPtr += stride * 4, srcPtr += stride * 4)
+        {
+            LoadFloat3(dstPtr, stride, x, y, z);
+            LoadFloat3(srcPtr, stride, sx, sy, sz);
+            StoreFloat3(dstPtr, stride, SIMD::Add(x, SIMD::Mul(sx, s)), SIMD::Add(y, SIMD::Mul(sy, s)), SIMD::Add(z, SIMD::Mul(sz, s)));
+        }
+        for (; count > 0; count--, dstPtr += stride, srcPtr += stride)
+            *(Float3*)dstPtr += *(const Float3*)srcPtr * scale;
+    }
+
+    /// <summary>
+    /// Applies the linear drag to the particles velocity: velocity *= max(0, 1 - drag * deltaTime * spriteArea / mass). Sprite size pointer is optional.
+    /// </summary>
+    inline void LinearDrag(byte* velocityPtr, const byte* massPtr, const byte* spriteSizePtr, int32 stride, int32 count, float dragDeltaTime)
+    {
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 one = SIMD::Splat(1.0f);
+        const SimdVector4 tolerance = SIMD::Splat(ZeroTolerance);
+        const SimdVector4 drag = SIMD::Splat(dragDeltaTime);
+        SimdVector4 x, y, z;
+        for (; count >= 4; count -= 4, velocityPtr += stride * 4, massPtr += stride * 4)
+        {
+            SimdVector4 particleDrag = drag;
+            if (spriteSizePtr)
+            {
+                particleDrag = SIMD::Mul(particleDrag, SIMD::Mul(LoadFloat(spriteSizePtr, stride), LoadFloat(spriteSizePtr + sizeof(float), stride)));
+                spriteSizePtr += stride * 4;
+            }
+            const SimdVector4 mass = SIMD::Max(LoadFloat(massPtr, stride), tolerance);
+            const SimdVector4 scale = SIMD::Max(SIMD::Sub(one, SIMD::Div(particleDrag, mass)), zero);
+            LoadFloat3(velocityPtr, stride, x, y, z);
+            StoreFloat3(velocityPtr, stride, SIMD::Mul(x, scale), SIMD::Mul(y, scale), SIMD::Mul(z, scale));
+        }
+        for (; count > 0; count--, velocityPtr += stride, massPtr += stride)
+        {
+            float particleDrag = dragDeltaTime;
+            if (spriteSizePtr)
+            {
+                particleDrag *= ((const Float2*)spriteSizePtr)->MulValues();
+                spriteSizePtr += stride;
+            }
+            *(Float3*)velocityPtr *= Math::Max(0.0f, 1.0f - particleDrag / Math::Max(*(const float*)massPtr, ZeroTolerance));
+        }
+    }
+
+    /// <summary>
+    /// Sets the attribute of the particles to a constant value (eg. color or size). Uses typed stores for the common attribute sizes.
+    /// </summary>
+    inline void SetValue(byte* ptr, int32 stride, int32 count, const void* value, int32 size)
+    {
+        switch (size)
+        {
+        case sizeof(float):
+        {
+            const float v = *(const float*)value;
+            for (; count > 0; count--, ptr += stride)
+                *(float*)ptr = v;
+            break;
+        }
+        case sizeof(Float2):
+        {
+            const Float2 v = *(const Float2*)value;
+            for (; count > 0; count--, ptr += stride)
+                *(Float2*)ptr = v;
+            break;
+        }
+        case sizeof(Float3):
+        {
+            const Float3 v = *(const Float3*)value;
+            for (; count > 0; count--, ptr += stride)
+                *(Float3*)ptr = v;
+            break;
+        }
+        case sizeof(Float4):
+        {
+            const Float4 v = *(const Float4*)value;
+            for (; count > 0; count--, ptr += stride)
+                *(Float4*)ptr = v;
+            break;
+        }
+        default:
+            for (; count > 0; count--, ptr += stride)
+                Platform::MemoryCopy(ptr, value, size);
+            break;
+        }
+    }
+}
@@ -1,9 +1,13 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "ParticleEmitterGraph.CPU.h"
+#include "ParticleEmitterGraph.CPU.Kernels.h"
 #include "Engine/Core/Random.h"
 #include "Engine/Utilities/Noise.h"
 #include "Engine/Core/Types/CommonValue.h"
+#include "Engine/Particles/ParticleEffect.h"
+#include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Threading/Threading.h"
 
 // ReSharper disable CppCStyleCast
 // ReSharper disable CppClangTidyClangDiagnosticCastAlign
@@ -47,6 +51,39 @@ namespace
             return VariantType::Pointer;
         }
     }
+
+    // Gets the snapshot of the Global SDF around the particles (sampled on a GPU and read back with a few frames of latency so the bounds are extended to cover the particles movement)
+    bool GetGlobalSDF(ParticleEmitterGraphCPUContext& context, const byte* positionPtr, int32 stride, int32 count, float radius, Matrix& localToWorld, Matrix& worldToLocal, GlobalSignDistanceFieldPass::CPUSnapshot& result)
+    {
+        if (count <= 0)
+            return false;
+        Float3 min = Float3::Maximum, max = Float3::Minimum;
+        for (int32 i = 0; i < count; i++, positionPtr += stride)
+        {
+            const Float3 position = *(const Float3*)positionPtr;
+            min = Float3::Min(min, position);
+            max = Float3::Max(max, position);
+        }
+        const float margin = Math::Max(radius, 0.0f) + Math::Max((max - min).MaxValue() * 0.1f, 50.0f);
+        BoundingBox bounds((Vector3)(min - margin), (Vector3)(max + margin));
+        if (context.Emitter->SimulationSpace == ParticlesSimulationSpace::Local)
+        {
+            context.Effect->GetLocalToWorldMatrix(localToWorld);
+            Matrix::Invert(localToWorld, worldToLocal);
+            BoundingBox::Transform(bounds, localToWorld, bounds);
+        }
+        else
+        {
+            localToWorld = worldToLocal = Matrix::Identity;
+        }
+        const auto sdf = GlobalSignDistanceFieldPass::Instance();
+        ScopeLock lock(sdf->CPUSnapshotsLocker);
+        const auto snapshot = sdf->GetCPUSnapshot(context.Data, bounds);
+        if (!snapshot)
+            return false;
+        result = *snapshot;
+        return true;
+    }
 }
 
 int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
@@ -118,6 +155,32 @@ int32 ParticleEmitterGraphCPUExecutor::ProcessSpawnModule(int32 index)
     return result;
 }
 
+void ParticleEmitterGraphCPUExecutor::ProcessKernel(const ParticleEmitterGraphCPUKernel& kernel, int32 particlesStart, int32 particlesEnd)
+{
+    auto& context = *Context.Get();
+    const auto buffer = context.Data->Buffer;
+    const auto& attributes = buffer->Layout->Attributes;
+    const int32 stride = buffer->Stride;
+    const int32 count = particlesEnd - particlesStart;
+    byte* start = buffer->GetParticleCPU(particlesStart);
+    byte* dataPtr = start + attributes[kernel.Attributes[0]].Offset;
+    switch (kernel.Type)
+    {
+    case ParticleEmitterGraphCPUKernel::Types::AddFloatPerSecond:
+        ParticleKernels::AddFloat(dataPtr, stride, count, kernel.Value.X * context.DeltaTime);
+        break;
+    case ParticleEmitterGraphCPUKernel::Types::AddFloat3PerSecond:
+        ParticleKernels::AddFloat3(dataPtr, stride, count, Float3(kernel.Value) * context.DeltaTime);
+        break;
+    case ParticleEmitterGraphCPUKernel::Types::LinearDrag:
+        ParticleKernels::LinearDrag(dataPtr, start + attributes[kernel.Attributes[1]].Offset, kernel.UseAttribute2 ? start + attributes[kernel.Attributes[2]].Offset : nullptr, stride, count, kernel.Value.X * context.DeltaTime);
+        break;
+    case ParticleEmitterGraphCPUKernel::Types::SetValue:
+        ParticleKernels::SetValue(dataPtr, stride, count, &kernel.Value, kernel.Size);
+        break;
+    }
+}
+
 void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd)
 {
     auto& context = *Context.Get();
@@ -191,12 +254,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     {
         PARTICLE_EMITTER_MODULE("Update Age");
         auto& attribute = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
-        byte* agePtr = start + attribute.Offset;
-        for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-        {
-            *((float*)agePtr) += context.DeltaTime;
-            agePtr += stride;
-        }
+        ParticleKernels::AddFloat(start + attribute.Offset, stride, particlesEnd - particlesStart, context.DeltaTime);
         break;
     }
     // Gravity/Force
@@ -220,11 +278,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Float3 force = (Float3)GetValue(box, 2);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                *((Float3*)velocityPtr) += force * context.DeltaTime;
-                velocityPtr += stride;
-            }
+            ParticleKernels::AddFloat3(velocityPtr, stride, particlesEnd - particlesStart, force * context.DeltaTime);
         }
         break;
     }
@@ -469,10 +523,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             INPUTS_FETCH();
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                LOGIC();
-            }
+            ParticleKernels::LinearDrag(velocityPtr, massPtr, spriteSizePtr, stride, particlesEnd - particlesStart, drag * context.DeltaTime);
         }
 #undef INPUTS_FETCH
 #undef LOGIC
@@ -562,11 +613,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Value value = GetValue(box, 4).Cast(type);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                Platform::MemoryCopy(dataPtr, &value.AsPointer, dataSize);
-                dataPtr += stride;
-            }
+            ParticleKernels::SetValue(dataPtr, stride, particlesEnd - particlesStart, &value.AsPointer, dataSize);
         }
         break;
     }
@@ -620,11 +667,7 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
         else
         {
             const Value value = GetValue(box, 2).Cast(type);
-            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
-            {
-                Platform::MemoryCopy(dataPtr, &value.AsPointer, dataSize);
-                dataPtr += stride;
-            }
+            ParticleKernels::SetValue(dataPtr, stride, particlesEnd - particlesStart, &value.AsPointer, dataSize);
         }
         break;
     }
@@ -1147,7 +1190,26 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     // Position (Global SDF)
     case 215:
     {
-        // Not supported
+        PARTICLE_EMITTER_MODULE("Position");
+        auto& positionAttr = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
+        byte* positionPtr = start + positionAttr.Offset;
+        Matrix localToWorld, worldToLocal;
+        GlobalSignDistanceFieldPass::CPUSnapshot sdf;
+        if (!GetGlobalSDF(context, positionPtr, stride, particlesEnd - particlesStart, 0.0f, localToWorld, worldToLocal, sdf))
+            break;
+        for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+        {
+            Float3 position;
+            Float3::Transform(*(Float3*)positionPtr, localToWorld, position);
+            Float3 gradient;
+            const float dist = sdf.SampleGradient((Vector3)position, gradient);
+            if (dist < MAX_float && !gradient.IsZero())
+            {
+                position -= Float3::Normalize(gradient) * dist;
+                Float3::Transform(position, worldToLocal, *(Float3*)positionPtr);
+            }
+            positionPtr += stride;
+        }
         break;
     }
 
@@ -1412,13 +1474,116 @@ void ParticleEmitterGraphCPUExecutor::ProcessModule(ParticleEmitterGraphCPUNode*
     // Conform to Global SDF
     case 335:
     {
-        // Not supported
+        PARTICLE_EMITTER_MODULE("Conform to Global SDF");
+        auto& positionAttr = context.Data->Buffer->Layout->Attributes[node->Attributes[0]];
+        auto& velocityAttr = context.Data->Buffer->Layout->Attributes[node->Attributes[1]];
+        auto& massAttr = context.Data->Buffer->Layout->Attributes[node->Attributes[2]];
+        byte* positionPtr = start + positionAttr.Offset;
+        byte* velocityPtr = start + velocityAttr.Offset;
+        byte* massPtr = start + massAttr.Offset;
+        Matrix localToWorld, worldToLocal;
+        GlobalSignDistanceFieldPass::CPUSnapshot sdf;
+        if (!GetGlobalSDF(context, positionPtr, stride, particlesEnd - particlesStart, 0.0f, localToWorld, worldToLocal, sdf))
+            break;
+        auto attractionSpeedBox = node->GetBox(0);
+        auto attractionForceBox = node->GetBox(1);
+        auto stickDistanceBox = node->GetBox(2);
+        auto stickForceBox = node->GetBox(3);
+#define INPUTS_FETCH() \
+	const float attractionSpeed = (float)GetValue(attractionSpeedBox, 2); \
+	const float attractionForce = (float)GetValue(attractionForceBox, 3); \
+	const float stickDistance = (float)GetValue(stickDistanceBox, 4); \
+	const float stickForce = (float)GetValue(stickForceBox, 5)
+#define LOGIC() \
+	Float3 position, gradient; \
+	Float3::Transform(*(Float3*)positionPtr, localToWorld, position); \
+	float dist = sdf.SampleGradient((Vector3)position, gradient); \
+	if (dist < MAX_float && !gradient.IsZero()) \
+	{ \
+		Float3 dir; \
+		Float3::TransformNormal(Float3::Normalize(gradient), worldToLocal, dir); \
+		dir.Normalize(); \
+		if (dist > 0) \
+			dir *= -1; \
+		Float3& velocity = *(Float3*)velocityPtr; \
+		float spdNormal = Float3::Dot(dir, velocity); \
+		float ratio = Math::SmoothStep(0.0f, stickDistance * 2.0f, Math::Abs(dist)); \
+		float tgtSpeed = attractionSpeed * ratio; \
+		float deltaSpeed = tgtSpeed - spdNormal; \
+		velocity += dir * (Math::Sign(deltaSpeed) * Math::Min(Math::Abs(deltaSpeed), context.DeltaTime * Math::Lerp(stickForce, attractionForce, ratio)) / Math::Max(*(float*)massPtr, ZeroTolerance)); \
+	} \
+	positionPtr += stride; \
+	velocityPtr += stride; \
+	massPtr += stride
+
+        if (node->UsePerParticleDataResolve())
+        {
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                context.ParticleIndex = particleIndex;
+                INPUTS_FETCH();
+                LOGIC();
+            }
+        }
+        else
+        {
+            INPUTS_FETCH();
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                LOGIC();
+            }
+        }
+#undef INPUTS_FETCH
+#undef LOGIC
         break;
     }
     // Collision (Global SDF)
     case 336:
     {
-        // Not supported
+        COLLISION_BEGIN();
+        Matrix localToWorld, worldToLocal;
+        GlobalSignDistanceFieldPass::CPUSnapshot sdf;
+        if (!GetGlobalSDF(context, positionPtr, stride, particlesEnd - particlesStart, (float)GetValue(radiusBox, 3), localToWorld, worldToLocal, sdf))
+            break;
+#define INPUTS_FETCH() \
+	COLLISION_INPUTS_FETCH()
+#define LOGIC() \
+	Float3 position = *(Float3*)positionPtr; \
+	Float3 velocity = *(Float3*)velocityPtr; \
+	Float3 nextPos = position + velocity * context.DeltaTime; \
+	Float3::Transform(nextPos, localToWorld, nextPos); \
+	float dist = sdf.SampleDistance((Vector3)nextPos); \
+	if (dist < radius) \
+	{ \
+		Float3::Transform(position, localToWorld, position); \
+		Float3 gradient; \
+		dist = sdf.SampleGradient((Vector3)position, gradient); \
+		Float3 n = Float3::Normalize(gradient); \
+		position += n * -(dist < MAX_float ? dist : 0.0f); \
+		Float3::Transform(position, worldToLocal, *(Float3*)positionPtr); \
+		Float3::TransformNormal(n, worldToLocal, n); \
+		n.Normalize(); \
+	COLLISION_LOGIC()
+
+        if (node->UsePerParticleDataResolve())
+        {
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                context.ParticleIndex = particleIndex;
+                INPUTS_FETCH();
+                LOGIC();
+            }
+        }
+        else
+        {
+            INPUTS_FETCH();
+            for (int32 particleIndex = particlesStart; particleIndex < particlesEnd; particleIndex++)
+            {
+                LOGIC();
+            }
+        }
+#undef INPUTS_FETCH
+#undef LOGIC
         break;
     }
 
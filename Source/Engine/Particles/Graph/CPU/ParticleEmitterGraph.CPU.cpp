@@ -1,12 +1,14 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "ParticleEmitterGraph.CPU.h"
+#include "ParticleEmitterGraph.CPU.Kernels.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Particles/ParticleEffect.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 ThreadLocal<ParticleEmitterGraphCPUContext*> ParticleEmitterGraphCPUExecutor::Context;
 
@@ -89,9 +91,130 @@ bool ParticleEmitterGraphCPU::Load(ReadStream* stream, bool loadMeta)
         }
     }
 
+    CompileUpdateKernels();
+
     return false;
 }
 
+void ParticleEmitterGraphCPU::CompileUpdateKernels()
+{
+    _updateKernels.Resize(UpdateModules.Count());
+    _parallelUpdate = true;
+    for (int32 i = 0; i < UpdateModules.Count(); i++)
+    {
+        const auto module = UpdateModules[i];
+        auto& kernel = _updateKernels[i];
+        kernel = ParticleEmitterGraphCPUKernel();
+
+        // Check if module processes particles independently so the particles range can be split across jobs (eg. kill modules remove particles)
+        switch (module->TypeID)
+        {
+        case 300:
+        case 301:
+        case 302:
+        case 303:
+        case 304:
+        case 305:
+        case 309:
+        case 310:
+        case 311:
+        case 330:
+        case 331:
+        case 332:
+        case 333:
+            break;
+        default:
+            if (module->TypeID < 350 || module->TypeID > 363)
+                _parallelUpdate = false;
+            break;
+        }
+
+        // Only modules with the input left unconnected can be folded (value is known at load time)
+        const auto box = module->TryGetBox(0);
+        if (box && box->HasConnection())
+            continue;
+        switch (module->TypeID)
+        {
+        // Update Age
+        case 300:
+            kernel.Type = ParticleEmitterGraphCPUKernel::Types::AddFloatPerSecond;
+            kernel.Attributes[0] = module->Attributes[0];
+            kernel.Value.X = 1.0f;
+            break;
+        // Gravity/Force
+        case 301:
+        case 304:
+            kernel.Type = ParticleEmitterGraphCPUKernel::Types::AddFloat3PerSecond;
+            kernel.Attributes[0] = module->Attributes[0];
+            kernel.Value = Float4((Float3)module->Values[2], 0.0f);
+            break;
+        // Linear Drag
+        case 310:
+            kernel.Type = ParticleEmitterGraphCPUKernel::Types::LinearDrag;
+            kernel.Attributes[0] = module->Attributes[0];
+            kernel.Attributes[1] = module->Attributes[1];
+            kernel.UseAttribute2 = module->Values[3].AsBool;
+            if (kernel.UseAttribute2)
+                kernel.Attributes[2] = module->Attributes[2];
+            kernel.Value.X = (float)module->Values[2];
+            break;
+        // Set Attribute
+        case 302:
+        // Set Position/Lifetime/Age/..
+        case 350:
+        case 351:
+        case 352:
+        case 353:
+        case 354:
+        case 355:
+        case 356:
+        case 357:
+        case 358:
+        case 359:
+        case 360:
+        case 361:
+        case 362:
+        case 363:
+        {
+            const auto& attribute = Layout.Attributes[module->Attributes[0]];
+            const int32 size = attribute.GetSize();
+            if (size > sizeof(Float4))
+                break;
+            VariantType::Types type;
+            switch (attribute.ValueType)
+            {
+            case ParticleAttribute::ValueTypes::Float:
+                type = VariantType::Float;
+                break;
+            case ParticleAttribute::ValueTypes::Float2:
+                type = VariantType::Float2;
+                break;
+            case ParticleAttribute::ValueTypes::Float3:
+                type = VariantType::Float3;
+                break;
+            case ParticleAttribute::ValueTypes::Float4:
+                type = VariantType::Float4;
+                break;
+            case ParticleAttribute::ValueTypes::Int:
+                type = VariantType::Int;
+                break;
+            case ParticleAttribute::ValueTypes::Uint:
+                type = VariantType::Uint;
+                break;
+            default:
+                continue;
+            }
+            const Variant value = module->Values[module->TypeID == 302 ? 4 : 2].Cast(VariantType(type));
+            kernel.Type = ParticleEmitterGraphCPUKernel::Types::SetValue;
+            kernel.Attributes[0] = module->Attributes[0];
+            kernel.Size = (byte)size;
+            Platform::MemoryCopy(&kernel.Value, &value.AsPointer, size);
+            break;
+        }
+        }
+    }
+}
+
 void ParticleEmitterGraphCPU::InitializeNode(Node* node)
 {
     // Skip if already initialized
@@ -427,6 +550,18 @@ void ParticleEmitterGraphCPUExecutor::Draw(ParticleEmitter* emitter, ParticleEff
     }
 }
 
+void ParticleEmitterGraphCPUExecutor::ProcessUpdateModules(int32 particlesStart, int32 particlesEnd)
+{
+    for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
+    {
+        const auto& kernel = _graph._updateKernels[i];
+        if (kernel.Type != ParticleEmitterGraphCPUKernel::Types::None)
+            ProcessKernel(kernel, particlesStart, particlesEnd);
+        else
+            ProcessModule(_graph.UpdateModules[i], particlesStart, particlesEnd);
+    }
+}
+
 void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleEffect* effect, ParticleEmitterInstance& data, float dt, bool canSpawn)
 {
     // Prepare data
@@ -438,9 +573,25 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
     if (cpu.Count > 0)
     {
         PROFILE_CPU_NAMED("Update");
-        for (int32 i = 0; i < _graph.UpdateModules.Count(); i++)
+        const int32 jobsCount = Math::Min(cpu.Count / PARTICLE_EMITTER_PARALLEL_UPDATE_BATCH_SIZE, JobSystem::GetThreadsCount());
+        if (_graph._parallelUpdate && jobsCount > 1)
+        {
+            // Split the particles range across jobs (each thread uses own graph context)
+            const int32 count = cpu.Count;
+            Function<void(int32)> job = [this, emitter, effect, &data, dt, count, jobsCount](int32 jobIndex)
+            {
+                PROFILE_CPU_NAMED("Update Job");
+                Init(emitter, effect, data, dt);
+                ProcessUpdateModules((int32)((int64)count * jobIndex / jobsCount), (int32)((int64)count * (jobIndex + 1) / jobsCount));
+            };
+            JobSystem::Wait(JobSystem::Dispatch(job, jobsCount));
+
+            // Restore the context in case this thread executed any of the jobs
+            Init(emitter, effect, data, dt);
+        }
+        else
         {
-            ProcessModule(_graph.UpdateModules[i], 0, cpu.Count);
+            ProcessUpdateModules(0, cpu.Count);
         }
     }
 
@@ -486,12 +637,7 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Euler Integration");
         byte* positionPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrPosition].Offset;
         byte* velocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)positionPtr) += *((Float3*)velocityPtr) * dt;
-            positionPtr += data.Buffer->Stride;
-            velocityPtr += data.Buffer->Stride;
-        }
+        ParticleKernels::AddScaledFloat3(positionPtr, velocityPtr, data.Buffer->Stride, cpu.Count, dt);
     }
 
     // Angular Euler Integration
@@ -500,12 +646,7 @@ void ParticleEmitterGraphCPUExecutor::Update(ParticleEmitter* emitter, ParticleE
         PROFILE_CPU_NAMED("Angular Euler Integration");
         byte* rotationPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrRotation].Offset;
         byte* angularVelocityPtr = cpu.Buffer.Get() + data.Buffer->Layout->Attributes[_graph._attrAngularVelocity].Offset;
-        for (int32 particleIndex = 0; particleIndex < cpu.Count; particleIndex++)
-        {
-            *((Float3*)rotationPtr) += *((Float3*)angularVelocityPtr) * dt;
-            rotationPtr += data.Buffer->Stride;
-            angularVelocityPtr += data.Buffer->Stride;
-        }
+        ParticleKernels::AddScaledFloat3(rotationPtr, angularVelocityPtr, data.Buffer->Stride, cpu.Count, dt);
     }
 
     // Spawn particles
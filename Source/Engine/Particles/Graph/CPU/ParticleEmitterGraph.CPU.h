@@ -30,6 +30,9 @@ class ParticleEmitterGraphCPUExecutor;
 
 #define PARTICLE_EMITTER_MAX_CALL_STACK 100
 
+// The minimum amount of particles per job when updating a single emitter in parallel
+#define PARTICLE_EMITTER_PARALLEL_UPDATE_BATCH_SIZE 4096
+
 class ParticleEmitterGraphCPUBox : public VisjectGraphBox
 {
 };
@@ -57,6 +60,32 @@ class ParticleEmitterGraphCPUNode : public ParticleEmitterGraphNode<VisjectGraph
     }
 };
 
+/// <summary>
+/// The particle module compiled at load time into a typed kernel with constant-folded inputs. Used to skip the graph interpretation for the common modules.
+/// </summary>
+struct ParticleEmitterGraphCPUKernel
+{
+    enum class Types : byte
+    {
+        // Not compiled, module is interpreted by the graph executor.
+        None,
+        // Attribute0 += Value.X * DeltaTime (eg. age update).
+        AddFloatPerSecond,
+        // Attribute0 += Value.XYZ * DeltaTime (eg. gravity).
+        AddFloat3PerSecond,
+        // Linear drag of the Attribute0 (velocity) with Attribute1 (mass) and optional Attribute2 (sprite size).
+        LinearDrag,
+        // Attribute0 = Value (eg. color or size).
+        SetValue,
+    };
+
+    Types Type = Types::None;
+    byte Size = 0;
+    byte Attributes[3] = { 0, 0, 0 };
+    bool UseAttribute2 = false;
+    Float4 Value = Float4::Zero;
+};
+
 /// <summary>
 /// The Particle Emitter Graph used to simulate CPU particles.
 /// </summary>
@@ -74,6 +103,10 @@ class ParticleEmitterGraphCPU : public ParticleEmitterGraph<VisjectGraph<Particl
     };
 
     Array<byte> _defaultParticleData;
+    Array<ParticleEmitterGraphCPUKernel, FixedAllocation<PARTICLE_EMITTER_MAX_MODULES>> _updateKernels;
+    bool _parallelUpdate = false;
+
+    void CompileUpdateKernels();
 
 public:
     // Size of the custom pre-node data buffer used for state tracking (eg. position on spiral arc progression).
@@ -195,6 +228,8 @@ class ParticleEmitterGraphCPUExecutor : public VisjectExecutor
 
     int32 ProcessSpawnModule(int32 index);
     void ProcessModule(ParticleEmitterGraphCPUNode* node, int32 particlesStart, int32 particlesEnd);
+    void ProcessKernel(const ParticleEmitterGraphCPUKernel& kernel, int32 particlesStart, int32 particlesEnd);
+    void ProcessUpdateModules(int32 particlesStart, int32 particlesEnd);
 
     FORCE_INLINE Value GetValue(Box* box, int32 defaultValueBoxIndex)
     {
@@ -60,6 +60,7 @@ bool GPUParticles::Init(ParticleEmitter* owner, MemoryReadStream& shaderCacheStr
         LOG(Warning, "Missing CS_Main shader.");
         return true;
     }
+    _dispatchArgsCS = _shader->GetCS("CS_DispatchArgs");
     const auto cb0 = _shader->GetCB(0);
     if (!cb0)
     {
@@ -98,6 +99,7 @@ void GPUParticles::Dispose()
 {
     // Cleanup
     _mainCS = nullptr;
+    _dispatchArgsCS = nullptr;
     SAFE_DELETE_GPU_RESOURCE(_shader);
     _cbData.Resize(0);
     _params.Dispose();
@@ -261,8 +263,20 @@ void GPUParticles::Execute(GPUContext* context, ParticleEmitter* emitter, Partic
     context->BindUA(0, data.Buffer->GPU.BufferSecondary->View());
 
     // Invoke Compute shader
-    const int32 threadGroupSize = 1024;
-    context->Dispatch(_mainCS, Math::Min(Math::DivideAndRoundUp(threads, threadGroupSize), GPU_MAX_CS_DISPATCH_THREAD_GROUPS), 1, 1);
+    GPUBuffer* dispatchArgsBuffer = data.Buffer->GPU.DispatchArgsBuffer;
+    if (_dispatchArgsCS && dispatchArgsBuffer)
+    {
+        // Generate the dispatch arguments on a GPU from the live particles counter (CPU estimate is only an upper bound)
+        context->BindUA(1, dispatchArgsBuffer->View());
+        context->Dispatch(_dispatchArgsCS, 1, 1, 1);
+        context->BindUA(1, nullptr);
+        context->DispatchIndirect(_mainCS, dispatchArgsBuffer, 0);
+    }
+    else
+    {
+        const int32 threadGroupSize = 1024;
+        context->Dispatch(_mainCS, Math::Min(Math::DivideAndRoundUp(threads, threadGroupSize), GPU_MAX_CS_DISPATCH_THREAD_GROUPS), 1, 1);
+    }
 
     // Copy custom data
     for (int32 i = 0; i < CustomDataSize; i += 4)
@@ -25,6 +25,7 @@ class GPUParticles
 private:
     GPUShader* _shader = nullptr;
     GPUShaderProgramCS* _mainCS = nullptr;
+    GPUShaderProgramCS* _dispatchArgsCS = nullptr;
     Array<byte> _cbData;
     MaterialParams _params;
 
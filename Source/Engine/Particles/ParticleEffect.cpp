@@ -254,6 +254,11 @@ int32 ParticleEffect::GetParticlesCount() const
     return Instance.GetParticlesCount();
 }
 
+float ParticleEffect::GetSignificance() const
+{
+    return _significance;
+}
+
 bool ParticleEffect::GetIsPlaying() const
 {
     return _isPlaying;
@@ -275,6 +280,7 @@ void ParticleEffect::UpdateSimulation(bool singleFrame)
 
     // Request update
     _lastUpdateFrame = Engine::UpdateCount;
+    _lastDrawDstSqr = _lastMinDstSqr;
     _lastMinDstSqr = MAX_Real;
     if (singleFrame)
         Instance.LastUpdateTime = (UseTimeScale ? Time::Update.Time : Time::Update.UnscaledTime).GetTotalSeconds();
@@ -430,7 +436,16 @@ void ParticleEffect::Update()
 
     // Skip if off-screen
     if (!UpdateWhenOffscreen && _lastMinDstSqr >= MAX_Real)
+    {
+        _isSleeping = true;
         return;
+    }
+    if (_isSleeping)
+    {
+        // Catch-up the time that passed while being off-screen
+        _isSleeping = false;
+        _fastForward = FastForwardWhenOnscreen && Instance.LastUpdateTime >= 0;
+    }
 
     if (UpdateMode == SimulationUpdateMode::FixedTimestep)
     {
@@ -443,6 +458,20 @@ void ParticleEffect::Update()
     UpdateSimulation();
 }
 
+void ParticleEffect::UpdateSignificance()
+{
+    // Effects not drawn during the last frame are the least significant
+    if (_lastDrawDstSqr >= MAX_Real)
+    {
+        _significance = 0.0f;
+        return;
+    }
+
+    // Approximate the screen size with the bounds radius to the view distance ratio
+    const Real distance = Math::Max(Math::Sqrt(_lastDrawDstSqr), (Real)1.0f);
+    _significance = (float)(Math::Max(_sphere.Radius, (Real)1.0f) / distance) * SignificanceScale;
+}
+
 #if USE_EDITOR
 
 #include "Editor/Editor.h"
@@ -620,8 +649,12 @@ void ParticleEffect::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE(IsLooping);
     SERIALIZE(PlayOnStart);
     SERIALIZE(UpdateWhenOffscreen);
+    SERIALIZE(FastForwardWhenOnscreen);
+    SERIALIZE(FastForwardTimestep);
+    SERIALIZE(FastForwardMaxDuration);
     SERIALIZE(DrawModes);
     SERIALIZE(SortOrder);
+    SERIALIZE(SignificanceScale);
 }
 
 void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -721,8 +754,12 @@ void ParticleEffect::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(IsLooping);
     DESERIALIZE(PlayOnStart);
     DESERIALIZE(UpdateWhenOffscreen);
+    DESERIALIZE(FastForwardWhenOnscreen);
+    DESERIALIZE(FastForwardTimestep);
+    DESERIALIZE(FastForwardMaxDuration);
     DESERIALIZE(DrawModes);
     DESERIALIZE(SortOrder);
+    DESERIALIZE(SignificanceScale);
 
     if (_parameters.HasItems())
     {
@@ -5,5 +5,7 @@ namespace FlaxEngine
     partial class ParticleEffect
     {
         private bool IsFixedTimestep => UpdateMode == SimulationUpdateMode.FixedTimestep;
+
+        private bool IsFastForward => !UpdateWhenOffscreen && FastForwardWhenOnscreen;
     }
 }
@@ -137,6 +137,7 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Visuals/Particle Effect\"), ActorTo
 class FLAXENGINE_API ParticleEffect : public Actor
 {
     DECLARE_SCENE_OBJECT(ParticleEffect);
+    friend class ParticlesSystem;
 public:
     /// <summary>
     /// The particles simulation update modes.
@@ -180,6 +181,10 @@ class FLAXENGINE_API ParticleEffect : public Actor
 private:
     uint64 _lastUpdateFrame;
     Real _lastMinDstSqr;
+    Real _lastDrawDstSqr = MAX_Real;
+    float _significance = 0.0f;
+    bool _isSleeping = false;
+    bool _fastForward = false;
     int32 _sceneRenderingKey = -1;
     uint32 _parametersVersion = 0; // Version number for _parameters to be in sync with Instance.ParametersVersion
     Array<ParticleEffectParameter> _parameters; // Cached for scripting API
@@ -248,6 +253,24 @@ class FLAXENGINE_API ParticleEffect : public Actor
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(true), EditorOrder(70)")
     bool UpdateWhenOffscreen = true;
 
+    /// <summary>
+    /// If true, the particle simulation sleeping off-screen (see UpdateWhenOffscreen) will be fast-forwarded when the actor gets visible again by simulating the time that passed with large steps. Otherwise, the time that passed is simulated with a single step.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(false), EditorOrder(71), VisibleIf(nameof(UpdateWhenOffscreen), true)")
+    bool FastForwardWhenOnscreen = false;
+
+    /// <summary>
+    /// The timestep (in seconds) of the simulation steps used to fast-forward the effect that was sleeping off-screen. Larger values are faster but less accurate.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(0.1f), EditorOrder(72), Limit(0.001f), VisibleIf(nameof(IsFastForward))")
+    float FastForwardTimestep = 0.1f;
+
+    /// <summary>
+    /// The maximum time (in seconds) to fast-forward the effect that was sleeping off-screen. The time above this limit is skipped (eg. looping effects reach the steady state after the particles lifetime).
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), DefaultValue(5.0f), EditorOrder(73), Limit(0), VisibleIf(nameof(IsFastForward))")
+    float FastForwardMaxDuration = 5.0f;
+
     /// <summary>
     /// The draw passes to use for rendering this object.
     /// </summary>
@@ -260,6 +283,12 @@ class FLAXENGINE_API ParticleEffect : public Actor
     API_FIELD(Attributes="EditorDisplay(\"Particle Effect\"), EditorOrder(80), DefaultValue(0)")
     int16 SortOrder = 0;
 
+    /// <summary>
+    /// The significance scale of the effect. Used to prioritize the simulation when particles budgets (see Graphics Settings) are exceeded. Use higher values for important effects (eg. player abilities) and lower for background effects.
+    /// </summary>
+    API_FIELD(Attributes="EditorDisplay("Particle Effect"), EditorOrder(85), DefaultValue(1.0f), Limit(0)")
+    float SignificanceScale = 1.0f;
+
 public:
     /// <summary>
     /// Gets the effect parameters collection. Those parameters are instanced from the <see cref="ParticleSystem"/> that contains a linear list of emitters and every emitter has a list of own parameters.
@@ -334,6 +363,11 @@ class FLAXENGINE_API ParticleEffect : public Actor
     /// </summary>
     API_PROPERTY() int32 GetParticlesCount() const;
 
+    /// <summary>
+    /// Gets the effect significance calculated during the last simulation update (based on the distance to the view, screen size, visibility and SignificanceScale). Value 0 indicates effect not visible.
+    /// </summary>
+    API_PROPERTY(Attributes="NoSerialize, HideInEditor") float GetSignificance() const;
+
     /// <summary>
     /// Gets whether or not the particle effect is playing.
     /// </summary>
@@ -389,6 +423,7 @@ class FLAXENGINE_API ParticleEffect : public Actor
 
 private:
     void Update();
+    void UpdateSignificance();
 #if USE_EDITOR
     void UpdateExecuteInEditor();
 #endif
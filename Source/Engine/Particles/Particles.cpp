@@ -3,8 +3,10 @@
 #include "Particles.h"
 #include "ParticleEffect.h"
 #include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/Shader.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Core/Collections/HashSet.h"
+#include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/Engine.h"
@@ -14,13 +16,14 @@
 #include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTools.h"
+#include "Engine/Graphics/Shaders/GPUConstantBuffer.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Renderer/DrawCall.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Threading/TaskGraph.h"
 #if COMPILE_WITH_GPU_PARTICLES
 #include "Engine/Threading/Threading.h"
-#include "Engine/Content/Assets/Shader.h"
 #include "Engine/Profiler/ProfilerGPU.h"
 #include "Engine/Renderer/Utils/BitonicSort.h"
 #endif
@@ -94,12 +97,14 @@ struct EmitterCache
 {
     double LastTimeUsed;
     ParticleBuffer* Buffer;
+    bool Preheated;
 };
 
 namespace ParticleManagerImpl
 {
     CriticalSection PoolLocker;
-    Dictionary<ParticleEmitter*, Array<EmitterCache>> Pool;
+    // Pooled buffers grouped by the size class and simulation mode (shared between the emitters)
+    Dictionary<uint64, Array<EmitterCache>> Pool;
     Array<ParticleEffect*> UpdateList;
 #if COMPILE_WITH_GPU_PARTICLES
     CriticalSection GpuUpdateListLocker;
@@ -110,6 +115,11 @@ namespace ParticleManagerImpl
 
 using namespace ParticleManagerImpl;
 
+FORCE_INLINE uint64 GetPoolKey(uint32 size, ParticlesSimulationMode mode)
+{
+    return ((uint64)size << 8) | (uint64)mode;
+}
+
 TaskGraphSystem* Particles::System = nullptr;
 bool Particles::EnableParticleBufferPooling = true;
 float Particles::ParticleBufferRecycleTimeout = 10.0f;
@@ -139,6 +149,8 @@ class ParticlesSystem : public TaskGraphSystem
 {
 public:
     float DeltaTime, UnscaledDeltaTime, Time, UnscaledTime;
+    float GetEffectTime(const ParticleEffect* effect) const;
+    void ApplyBudgets();
     void Job(int32 index);
     void Execute(TaskGraph* graph) override;
     void PostExecute(TaskGraph* graph) override;
@@ -161,6 +173,126 @@ void Particles::OnEffectDestroy(ParticleEffect* effect)
 
 typedef Array<int32, FixedAllocation<PARTICLE_EMITTER_MAX_MODULES>> RenderModulesIndices;
 
+// Those defines must match the HLSL
+#define RIBBON_NO_ORDER MAX_uint32
+#define RIBBON_NO_COUNTER MAX_uint32
+
+PACK_STRUCT(struct GPUParticlesRibbonData {
+    uint32 ParticleCounterOffset;
+    uint32 ParticlesCount;
+    uint32 ParticleStride;
+    uint32 ParticleCapacity;
+    int32 PositionOffset;
+    int32 SortKeyOffset;
+    uint32 OrderOffset;
+    uint32 VertexOffset;
+    uint32 DrawArgsOffset;
+    uint32 UseDistance;
+    Float2 Dummy0;
+    });
+
+AssetReference<Shader> GPUParticlesRibbon;
+GPUConstantBuffer* GPUParticlesRibbonCB;
+GPUShaderProgramCS* GPUParticlesRibbonCS;
+
+#if COMPILE_WITH_DEV_ENV
+
+void OnRibbonShaderReloading(Asset* obj)
+{
+    GPUParticlesRibbonCB = nullptr;
+    GPUParticlesRibbonCS = nullptr;
+}
+
+#endif
+
+bool InitGPUParticlesRibbon()
+{
+    // Ribbon geometry is generated with compute shader and drawn indirectly (fallback to the CPU if not supported or shader is not ready)
+    const auto& limits = GPUDevice::Instance->Limits;
+    if (!limits.HasCompute || !limits.HasDrawIndirect)
+        return true;
+    if (GPUParticlesRibbon == nullptr)
+    {
+        GPUParticlesRibbon = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ParticlesRibbon"));
+        if (GPUParticlesRibbon == nullptr)
+            return true;
+#if COMPILE_WITH_DEV_ENV
+        GPUParticlesRibbon.Get()->OnReloading.Bind<OnRibbonShaderReloading>();
+#endif
+    }
+    if (!GPUParticlesRibbon->IsLoaded())
+        return true;
+    if (!GPUParticlesRibbonCB)
+    {
+        const auto shader = GPUParticlesRibbon->GetShader();
+        GPUParticlesRibbonCS = shader->GetCS("CS_Ribbon");
+        GPUParticlesRibbonCB = shader->GetCB(0);
+        ASSERT(GPUParticlesRibbonCB && GPUParticlesRibbonCB->GetSize() == sizeof(GPUParticlesRibbonData));
+    }
+    return false;
+}
+
+void GenerateRibbonGPU(GPUContext* context, ParticleBuffer* buffer, ParticleEmitterGraphCPUNode* module, uint32 orderOffset, uint32 counterOffset, uint32 particlesCount)
+{
+    // Generate ribbon vertices and indirect draw arguments from the ordered particles
+    const auto& layout = buffer->Emitter->Graph.Layout;
+    const uint32 ribbonIndex = module->RibbonOrderOffset / buffer->Capacity;
+    GPUParticlesRibbonData data;
+    data.ParticleCounterOffset = counterOffset;
+    data.ParticlesCount = particlesCount;
+    data.ParticleStride = buffer->Stride;
+    data.ParticleCapacity = buffer->Capacity;
+    data.PositionOffset = layout.GetAttributeOffset(module->Attributes[0]);
+    data.SortKeyOffset = layout.GetAttributeOffset(module->Attributes[1]);
+    data.OrderOffset = orderOffset;
+    data.VertexOffset = ribbonIndex * buffer->Capacity * 2;
+    data.DrawArgsOffset = ribbonIndex * sizeof(GPUDrawIndexedIndirectArgs);
+    data.UseDistance = Math::IsZero(module->Values[3].AsFloat) ? 0 : 1;
+    context->UpdateCB(GPUParticlesRibbonCB, &data);
+    context->BindCB(0, GPUParticlesRibbonCB);
+    context->BindSR(0, buffer->GPU.Buffer->View());
+    context->BindSR(1, buffer->GPU.RibbonOrder->View());
+    context->BindUA(0, buffer->GPU.RibbonVertexBuffer->View());
+    context->BindUA(1, buffer->GPU.RibbonDrawArgsBuffer->View());
+    context->Dispatch(GPUParticlesRibbonCS, 1, 1, 1);
+    context->ResetUA();
+}
+
+void DrawRibbonGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCall& drawCall, DrawPass drawModes, StaticFlags staticFlags, ParticleEmitterGraphCPUNode* module, int16 sortOrder)
+{
+    const auto material = (MaterialBase*)module->Assets[0].Get();
+    const auto moduleDrawModes = module->Values.Count() > 6 ? (DrawPass)module->Values[6].AsInt : DrawPass::Default;
+    auto dp = drawModes & moduleDrawModes & material->GetDrawModes();
+    if (dp == DrawPass::None)
+        return;
+    drawCall.Material = material;
+
+    // Setup ribbon data (segments count is known only on a GPU so texture coordinates are precomputed in vertices)
+    auto& ribbon = drawCall.Particle.Ribbon;
+    ribbon.UVTilingDistance = module->Values[3].AsFloat;
+    ribbon.SegmentCount = 0;
+    const Float2 uvScale = module->Values[4].AsFloat2();
+    const Float2 uvOffset = module->Values[5].AsFloat2();
+    ribbon.UVScaleX = uvScale.X;
+    ribbon.UVScaleY = uvScale.Y;
+    ribbon.UVOffsetX = uvOffset.X;
+    ribbon.UVOffsetY = uvOffset.Y;
+
+    // Submit draw call
+    const uint32 ribbonIndex = module->RibbonOrderOffset / buffer->Capacity;
+    drawCall.Geometry.IndexBuffer = buffer->GPU.RibbonIndexBuffer;
+    drawCall.Geometry.VertexBuffers[0] = buffer->GPU.RibbonVertexBuffer;
+    drawCall.Geometry.VertexBuffers[1] = nullptr;
+    drawCall.Geometry.VertexBuffers[2] = nullptr;
+    drawCall.Geometry.VertexBuffersOffsets[0] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[1] = 0;
+    drawCall.Geometry.VertexBuffersOffsets[2] = 0;
+    drawCall.InstanceCount = 0;
+    drawCall.Draw.IndirectArgsBuffer = buffer->GPU.RibbonDrawArgsBuffer;
+    drawCall.Draw.IndirectArgsOffset = ribbonIndex * sizeof(GPUDrawIndexedIndirectArgs);
+    renderContext.List->AddDrawCall(renderContext, dp, staticFlags, drawCall, false, sortOrder);
+}
+
 void DrawEmitterCPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCall& drawCall, DrawPass drawModes, StaticFlags staticFlags, ParticleEmitterInstance& emitterData, const RenderModulesIndices& renderModulesIndices, int16 sortOrder)
 {
     // Skip if CPU buffer is empty
@@ -292,7 +424,32 @@ void DrawEmitterCPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
     int32 ribbonModulesDrawIndicesStart[PARTICLE_EMITTER_MAX_RIBBONS] = {};
     int32 ribbonModulesDrawIndicesCount[PARTICLE_EMITTER_MAX_RIBBONS] = {};
     int32 ribbonModulesSegmentCount[PARTICLE_EMITTER_MAX_RIBBONS] = {};
-    if (emitter->Graph.RibbonRenderingModules.HasItems())
+    bool useRibbonGPU = false;
+    if (emitter->Graph.RibbonRenderingModules.HasItems() && !InitGPUParticlesRibbon())
+    {
+        if (!buffer->GPU.RibbonVertexBuffer)
+            buffer->AllocateRibbonBuffers();
+        useRibbonGPU = buffer->GPU.RibbonVertexBuffer != nullptr;
+    }
+    if (useRibbonGPU)
+    {
+        // Generate ribbon geometry on a GPU (particles order is sorted during CPU simulation)
+        if (buffer->CPU.Count >= 2 && buffer->CPU.RibbonOrder.HasItems() && emitter->Graph.GetPositionAttributeOffset() != -1)
+        {
+            for (int32 index = 0; index < renderModulesIndices.Count(); index++)
+            {
+                auto module = emitter->Graph.RenderModules[renderModulesIndices[index]];
+                if (module->TypeID != 404 || ribbonModuleIndex >= PARTICLE_EMITTER_MAX_RIBBONS)
+                    continue;
+                const int32* ribbonOrderData = buffer->CPU.RibbonOrder.Get() + module->RibbonOrderOffset;
+                context->UpdateBuffer(buffer->GPU.RibbonOrder, ribbonOrderData, buffer->CPU.Count * sizeof(int32), module->RibbonOrderOffset * sizeof(int32));
+                GenerateRibbonGPU(context, buffer, module, module->RibbonOrderOffset, RIBBON_NO_COUNTER, buffer->CPU.Count);
+                ribbonModulesDrawIndicesCount[ribbonModuleIndex++] = 1;
+            }
+            ribbonModuleIndex = 0;
+        }
+    }
+    else if (emitter->Graph.RibbonRenderingModules.HasItems())
     {
         // Prepare ribbon data
         if (!buffer->GPU.RibbonIndexBufferDynamic)
@@ -480,6 +637,12 @@ void DrawEmitterCPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
         {
             if (ribbonModulesDrawIndicesCount[ribbonModuleIndex] == 0)
                 break;
+            if (useRibbonGPU)
+            {
+                DrawRibbonGPU(renderContext, buffer, drawCall, drawModes, staticFlags, module, sortOrder);
+                ribbonModuleIndex++;
+                break;
+            }
             const auto material = (MaterialBase*)module->Assets[0].Get();
             const auto moduleDrawModes = module->Values.Count() > 6 ? (DrawPass)module->Values[6].AsInt : DrawPass::Default;
             auto dp = drawModes & moduleDrawModes & material->GetDrawModes();
@@ -582,6 +745,7 @@ PACK_STRUCT(struct GPUParticlesSortingData {
 AssetReference<Shader> GPUParticlesSorting;
 GPUConstantBuffer* GPUParticlesSortingCB;
 GPUShaderProgramCS* GPUParticlesSortingCS[3];
+GPUShaderProgramCS* GPUParticlesSortingArgsCS;
 
 #if COMPILE_WITH_DEV_ENV
 
@@ -589,6 +753,7 @@ void OnShaderReloading(Asset* obj)
 {
     GPUParticlesSortingCB = nullptr;
     Platform::MemoryClear(GPUParticlesSortingCS, sizeof(GPUParticlesSortingCS));
+    GPUParticlesSortingArgsCS = nullptr;
 }
 
 #endif
@@ -598,6 +763,63 @@ void CleanupGPUParticlesSorting()
     GPUParticlesSorting = nullptr;
 }
 
+bool InitGPUParticlesSorting()
+{
+    if (GPUParticlesSorting == nullptr)
+    {
+        // TODO: preload shader if platform supports GPU particles
+        GPUParticlesSorting = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUParticlesSorting"));
+        if (GPUParticlesSorting == nullptr || GPUParticlesSorting->WaitForLoaded())
+            return true;
+#if COMPILE_WITH_DEV_ENV
+        GPUParticlesSorting.Get()->OnReloading.Bind<OnShaderReloading>();
+#endif
+    }
+    if (!GPUParticlesSortingCB)
+    {
+        const auto shader = GPUParticlesSorting->GetShader();
+        const StringAnsiView CS_Sort("CS_Sort");
+        GPUParticlesSortingCS[0] = shader->GetCS(CS_Sort, 0);
+        GPUParticlesSortingCS[1] = shader->GetCS(CS_Sort, 1);
+        GPUParticlesSortingCS[2] = shader->GetCS(CS_Sort, 2);
+        GPUParticlesSortingArgsCS = shader->GetCS("CS_DispatchArgs");
+        GPUParticlesSortingCB = shader->GetCB(0);
+        ASSERT(GPUParticlesSortingCB);
+    }
+    return false;
+}
+
+bool GenerateGPUParticlesSortingArgs(GPUContext* context, ParticleBuffer* buffer, const GPUParticlesSortingData& data)
+{
+    GPUBuffer* dispatchArgsBuffer = buffer->GPU.DispatchArgsBuffer;
+    if (!GPUParticlesSortingArgsCS || !dispatchArgsBuffer)
+        return false;
+    context->UpdateCB(GPUParticlesSortingCB, &data);
+    context->BindCB(0, GPUParticlesSortingCB);
+    context->BindSR(0, buffer->GPU.Buffer->View());
+    context->BindUA(0, dispatchArgsBuffer->View());
+    context->Dispatch(GPUParticlesSortingArgsCS, 1, 1, 1);
+    context->ResetUA();
+    return true;
+}
+
+void GenerateGPUParticlesSortingKeys(GPUContext* context, ParticleBuffer* buffer, const GPUParticlesSortingData& data, int32 permutationIndex, bool useDispatchIndirect)
+{
+    context->UpdateCB(GPUParticlesSortingCB, &data);
+    context->BindCB(0, GPUParticlesSortingCB);
+    context->BindSR(0, buffer->GPU.Buffer->View());
+    context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
+    if (useDispatchIndirect)
+    {
+        context->DispatchIndirect(GPUParticlesSortingCS[permutationIndex], buffer->GPU.DispatchArgsBuffer, sizeof(GPUDispatchIndirectArgs));
+    }
+    else
+    {
+        const int32 threadGroupSize = 1024;
+        context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+    }
+}
+
 void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCall& drawCall, DrawPass drawModes, StaticFlags staticFlags, ParticleEmitterInstance& emitterData, const RenderModulesIndices& renderModulesIndices, int16 sortOrder)
 {
     const auto context = GPUDevice::Instance->GetMainContext();
@@ -609,32 +831,21 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
         PROFILE_GPU_CPU_NAMED("Sort Particles");
 
         // Prepare pipeline
-        if (GPUParticlesSorting == nullptr)
-        {
-            // TODO: preload shader if platform supports GPU particles
-            GPUParticlesSorting = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUParticlesSorting"));
-            if (GPUParticlesSorting == nullptr || GPUParticlesSorting->WaitForLoaded())
-                return;
-#if COMPILE_WITH_DEV_ENV
-            GPUParticlesSorting.Get()->OnReloading.Bind<OnShaderReloading>();
-#endif
-        }
-        if (!GPUParticlesSortingCB)
-        {
-            const auto shader = GPUParticlesSorting->GetShader();
-            const StringAnsiView CS_Sort("CS_Sort");
-            GPUParticlesSortingCS[0] = shader->GetCS(CS_Sort, 0);
-            GPUParticlesSortingCS[1] = shader->GetCS(CS_Sort, 1);
-            GPUParticlesSortingCS[2] = shader->GetCS(CS_Sort, 2);
-            GPUParticlesSortingCB = shader->GetCB(0);
-            ASSERT(GPUParticlesSortingCB);
-        }
+        if (InitGPUParticlesSorting())
+            return;
 
         // Prepare sorting data
         if (!buffer->GPU.SortedIndices)
             buffer->AllocateSortBuffer();
         ASSERT(buffer->GPU.SortingKeysBuffer);
 
+        // Generate sorting keys dispatch arguments from the live particles counter (shared by all sorting modules)
+        GPUParticlesSortingData data;
+        data.ParticleCounterOffset = buffer->GPU.ParticleCounterOffset;
+        data.ParticleStride = buffer->Stride;
+        data.ParticleCapacity = buffer->Capacity;
+        const bool useDispatchIndirect = GenerateGPUParticlesSortingArgs(context, buffer, data);
+
         // Execute all sorting modules
         for (int32 moduleIndex = 0; moduleIndex < emitter->Graph.SortModules.Count(); moduleIndex++)
         {
@@ -642,10 +853,6 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
             const auto sortMode = static_cast<ParticleSortMode>(module->Values[2].AsInt);
 
             // Generate sorting keys based on sorting mode
-            GPUParticlesSortingData data;
-            data.ParticleCounterOffset = buffer->GPU.ParticleCounterOffset;
-            data.ParticleStride = buffer->Stride;
-            data.ParticleCapacity = buffer->Capacity;
             int32 permutationIndex;
             bool sortAscending;
             switch (sortMode)
@@ -701,19 +908,52 @@ void DrawEmitterGPU(RenderContext& renderContext, ParticleBuffer* buffer, DrawCa
                 return;
 #endif
             }
-            context->UpdateCB(GPUParticlesSortingCB, &data);
-            context->BindCB(0, GPUParticlesSortingCB);
-            context->BindSR(0, buffer->GPU.Buffer->View());
-            context->BindUA(0, buffer->GPU.SortingKeysBuffer->View());
-            // TODO: optimize it by using DispatchIndirect with shared invoke args generated after particles update
-            const int32 threadGroupSize = 1024;
-            context->Dispatch(GPUParticlesSortingCS[permutationIndex], Math::DivideAndRoundUp(buffer->GPU.ParticlesCountMax, threadGroupSize), 1, 1);
+            GenerateGPUParticlesSortingKeys(context, buffer, data, permutationIndex, useDispatchIndirect);
 
             // Perform sorting
             BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, sortAscending, buffer->GPU.SortedIndices);
         }
     }
 
+    // Generate and draw ribbons (particles are sorted by the ribbon sort key on a GPU)
+    if (emitter->Graph.RibbonRenderingModules.HasItems() && emitter->Graph.GetPositionAttributeOffset() != -1 && !InitGPUParticlesRibbon())
+    {
+        if (!buffer->GPU.RibbonVertexBuffer)
+            buffer->AllocateRibbonBuffers();
+        if (buffer->GPU.RibbonVertexBuffer)
+        {
+            PROFILE_GPU_CPU_NAMED("Ribbons");
+            bool hasSortingArgs = false, useDispatchIndirect = false;
+            GPUParticlesSortingData data;
+            data.ParticleCounterOffset = buffer->GPU.ParticleCounterOffset;
+            data.ParticleStride = buffer->Stride;
+            data.ParticleCapacity = buffer->Capacity;
+            for (int32 index = 0; index < renderModulesIndices.Count(); index++)
+            {
+                auto module = emitter->Graph.RenderModules[renderModulesIndices[index]];
+                if (module->TypeID != 404)
+                    continue;
+                uint32 orderOffset = RIBBON_NO_ORDER;
+                const int32 sortKeyOffset = emitter->Graph.Layout.GetAttributeOffset(module->Attributes[1]);
+                if (sortKeyOffset != -1 && !InitGPUParticlesSorting())
+                {
+                    // Sort particles by the key (sorted indices are written to the beginning of the order buffer and used right away)
+                    if (!hasSortingArgs)
+                    {
+                        hasSortingArgs = true;
+                        useDispatchIndirect = GenerateGPUParticlesSortingArgs(context, buffer, data);
+                    }
+                    data.CustomOffset = sortKeyOffset;
+                    GenerateGPUParticlesSortingKeys(context, buffer, data, 2, useDispatchIndirect);
+                    BitonicSort::Instance()->Sort(context, buffer->GPU.SortingKeysBuffer, buffer->GPU.Buffer, data.ParticleCounterOffset, true, buffer->GPU.RibbonOrder);
+                    orderOffset = 0;
+                }
+                GenerateRibbonGPU(context, buffer, module, orderOffset, buffer->GPU.ParticleCounterOffset, 0);
+                DrawRibbonGPU(renderContext, buffer, drawCall, drawModes, staticFlags, module, sortOrder);
+            }
+        }
+    }
+
     // Count draw calls to perform during this emitter rendering
     int32 drawCalls = 0;
     for (int32 index = 0; index < renderModulesIndices.Count(); index++)
@@ -1099,31 +1339,44 @@ ParticleBuffer* Particles::AcquireParticleBuffer(ParticleEmitter* emitter)
     if (emitter->EnablePooling && EnableParticleBufferPooling)
     {
         PoolLocker.Lock();
-        const auto entries = Pool.TryGet(emitter);
-        if (entries)
+        const uint64 key = GetPoolKey(ParticleBuffer::GetRequiredSize(emitter), emitter->SimulationMode);
+        const auto entries = Pool.TryGet(key);
+        if (entries && entries->HasItems())
         {
-            while (entries->HasItems())
+            // Prefer buffer created for this emitter, otherwise reuse the one from the other emitter of the same size class
+            int32 index = entries->Count() - 1;
+            for (int32 i = index; i >= 0; i--)
             {
-                // Reuse buffer
-                result = entries->Last().Buffer;
-                entries->RemoveLast();
-
-                // Remove old buffers
-                if (result->Version != emitter->Graph.Version)
+                const ParticleBuffer* buffer = entries->At(i).Buffer;
+                if (buffer->Emitter == emitter && buffer->Version == emitter->Graph.Version)
                 {
-                    Delete(result);
-                    result = nullptr;
-                    if (entries->IsEmpty())
-                    {
-                        Pool.Remove(emitter);
-                        break;
-                    }
+                    index = i;
+                    break;
                 }
             }
+            result = entries->At(index).Buffer;
+            entries->RemoveAtKeepOrder(index);
+            if (entries->IsEmpty())
+                Pool.Remove(key);
         }
         PoolLocker.Unlock();
     }
 
+    if (result && (result->Emitter != emitter || result->Version != emitter->Graph.Version))
+    {
+        // Reinitialize buffer for this emitter
+        if (result->Init(emitter))
+        {
+            Delete(result);
+            result = nullptr;
+        }
+    }
+    else if (result)
+    {
+        // Prepare buffer
+        result->Clear();
+    }
+
     if (!result)
     {
         // Create new buffer
@@ -1135,26 +1388,22 @@ ParticleBuffer* Particles::AcquireParticleBuffer(ParticleEmitter* emitter)
             return nullptr;
         }
     }
-    else
-    {
-        // Prepare buffer
-        result->Clear();
-    }
 
     return result;
 }
 
 void Particles::RecycleParticleBuffer(ParticleBuffer* buffer)
 {
-    if (buffer->Emitter->EnablePooling && EnableParticleBufferPooling)
+    if (buffer->Emitter->EnablePooling && EnableParticleBufferPooling && buffer->GPU.Buffer)
     {
         // Return to pool
         EmitterCache c;
         c.LastTimeUsed = Platform::GetTimeSeconds();
         c.Buffer = buffer;
+        c.Preheated = false;
 
         PoolLocker.Lock();
-        Pool[buffer->Emitter].Add(c);
+        Pool[GetPoolKey(buffer->GPU.Buffer->GetSize(), buffer->Mode)].Add(c);
         PoolLocker.Unlock();
     }
     else
@@ -1164,18 +1413,70 @@ void Particles::RecycleParticleBuffer(ParticleBuffer* buffer)
     }
 }
 
-void Particles::OnEmitterUnload(ParticleEmitter* emitter)
+void Particles::PreheatParticleBuffers(ParticleEmitter* emitter, int32 count)
 {
+    if (!emitter || !emitter->IsLoaded() || !emitter->EnablePooling || !EnableParticleBufferPooling || count <= 0)
+        return;
+    PROFILE_CPU();
+    const uint64 key = GetPoolKey(ParticleBuffer::GetRequiredSize(emitter), emitter->SimulationMode);
     PoolLocker.Lock();
-    const auto entries = Pool.TryGet(emitter);
+    const auto entries = Pool.TryGet(key);
+    int32 existing = 0;
     if (entries)
     {
-        for (int32 i = 0; i < entries->Count(); i++)
+        for (const EmitterCache& e : *entries)
+        {
+            if (e.Buffer->Emitter == emitter && e.Buffer->Version == emitter->Graph.Version)
+                existing++;
+        }
+    }
+    PoolLocker.Unlock();
+    for (int32 i = existing; i < count; i++)
+    {
+        auto buffer = New<ParticleBuffer>();
+        if (buffer->Init(emitter))
+        {
+            LOG(Error, "Failed to create particle buffer for emitter {0}", emitter->ToString());
+            Delete(buffer);
+            return;
+        }
+        EmitterCache c;
+        c.LastTimeUsed = Platform::GetTimeSeconds();
+        c.Buffer = buffer;
+        c.Preheated = true;
+        PoolLocker.Lock();
+        Pool[key].Add(c);
+        PoolLocker.Unlock();
+    }
+}
+
+void Particles::PreheatParticleSystemBuffers(ParticleSystem* system, int32 count)
+{
+    if (!system || system->WaitForLoaded())
+        return;
+    for (const auto& emitter : system->Emitters)
+    {
+        if (emitter && !emitter->WaitForLoaded())
+            PreheatParticleBuffers(emitter.Get(), count);
+    }
+}
+
+void Particles::OnEmitterUnload(ParticleEmitter* emitter)
+{
+    PoolLocker.Lock();
+    for (auto i = Pool.Begin(); i.IsNotEnd(); ++i)
+    {
+        auto& entries = i->Value;
+        for (int32 j = entries.Count() - 1; j >= 0; j--)
         {
-            Delete(entries->At(i).Buffer);
+            if (entries[j].Buffer->Emitter == emitter)
+            {
+                Delete(entries[j].Buffer);
+                entries.RemoveAt(j);
+            }
         }
-        entries->Clear();
-        Pool.Remove(emitter);
+        if (entries.IsEmpty())
+            Pool.Remove(i);
     }
     PoolLocker.Unlock();
 
@@ -1234,9 +1535,91 @@ void ParticleManagerService::Dispose()
     SAFE_DELETE(Particles::System);
 }
 
+// The update rate (in frames) of the visible effects that exceed the particles budgets
+#define PARTICLES_BUDGET_REDUCED_UPDATE_RATE 4
+
+// The maximum amount of simulation steps used to fast-forward the effect after sleeping off-screen
+#define PARTICLES_FAST_FORWARD_MAX_STEPS 100
+
+bool SortEffectsBySignificance(ParticleEffect* const& a, ParticleEffect* const& b)
+{
+    return a->GetSignificance() > b->GetSignificance();
+}
+
+float ParticlesSystem::GetEffectTime(const ParticleEffect* effect) const
+{
+    bool useTimeScale = effect->UseTimeScale;
+#if USE_EDITOR
+    if (!Editor::IsPlayMode)
+        useTimeScale = false;
+#endif
+    return useTimeScale ? Time : UnscaledTime;
+}
+
+void ParticlesSystem::ApplyBudgets()
+{
+    const auto* settings = GraphicsSettings::Get();
+    const int32 maxEmitters = settings->MaxSimulatedParticleEmitters;
+    const int32 maxParticles = settings->MaxSimulatedParticles;
+    const int32 maxGpuParticles = settings->MaxSimulatedGPUParticles;
+    if (maxEmitters <= 0 && maxParticles <= 0 && maxGpuParticles <= 0)
+        return;
+    PROFILE_CPU();
+
+    // Sort effects by significance to simulate the most important ones first
+    for (ParticleEffect* effect : UpdateList)
+        effect->UpdateSignificance();
+    Sorting::QuickSort(UpdateList.Get(), UpdateList.Count(), &SortEffectsBySignificance);
+
+    int32 totalEmitters = 0, totalParticles = 0, totalGpuParticles = 0, count = 0;
+    for (int32 i = 0; i < UpdateList.Count(); i++)
+    {
+        ParticleEffect* effect = UpdateList[i];
+
+        // Estimate the simulation cost (GPU particles count is the upper bound of the dispatched threads to skip readback)
+        int32 particles = 0, gpuParticles = 0;
+        for (const ParticleEmitterInstance& e : effect->Instance.Emitters)
+        {
+            if (!e.Buffer)
+                continue;
+            if (e.Buffer->Mode == ParticlesSimulationMode::CPU)
+                particles += e.Buffer->CPU.Count;
+            else
+                gpuParticles += e.Buffer->GPU.ParticlesCountMax;
+        }
+        particles += gpuParticles;
+        const int32 emitters = effect->Instance.Emitters.Count();
+
+        // Check if effect fits into the budgets (the most significant one is always simulated)
+        bool simulate = count == 0 ||
+                ((maxEmitters <= 0 || totalEmitters + emitters <= maxEmitters) &&
+                    (maxParticles <= 0 || totalParticles + particles <= maxParticles) &&
+                    (maxGpuParticles <= 0 || totalGpuParticles + gpuParticles <= maxGpuParticles));
+        if (!simulate && effect->_significance > 0.0f)
+        {
+            // Simulate visible effects at the lower rate (delta time accumulates in between)
+            simulate = (Engine::UpdateCount + effect->GetID().A) % PARTICLES_BUDGET_REDUCED_UPDATE_RATE == 0;
+        }
+        if (simulate)
+        {
+            totalEmitters += emitters;
+            totalParticles += particles;
+            totalGpuParticles += gpuParticles;
+            UpdateList[count++] = effect;
+        }
+        else if (effect->_significance <= 0.0f && effect->Instance.LastUpdateTime >= 0)
+        {
+            // Freeze not visible effects (skip the time that passed)
+            effect->Instance.LastUpdateTime = GetEffectTime(effect);
+        }
+    }
+    UpdateList.Resize(count);
+}
+
 void ParticlesSystem::Job(int32 index)
 {
     PROFILE_CPU_NAMED("Particles.Job");
+    PROFILE_MEM(Particles);
     auto effect = UpdateList[index];
     auto& instance = effect->Instance;
     const auto particleSystem = effect->ParticleSystem.Get();
@@ -1290,86 +1673,99 @@ void ParticlesSystem::Job(int32 index)
     //if (dt <= 1.0f / 240.0f)
     //    return;
     dt *= effect->SimulationSpeed;
-    instance.Time += dt;
-    const float fps = particleSystem->FramesPerSecond;
-    const float duration = (float)particleSystem->DurationFrames / fps;
-    if (instance.Time > duration)
+
+    // Fast-forward the simulation after sleeping off-screen (catch-up with large steps, time over the limit is skipped)
+    int32 substeps = 1;
+    if (effect->_fastForward)
     {
-        if (effect->IsLooping)
+        effect->_fastForward = false;
+        dt = Math::Min(dt, effect->FastForwardMaxDuration);
+        substeps = Math::Clamp(Math::CeilToInt(dt / Math::Max(effect->FastForwardTimestep, 0.001f)), 1, PARTICLES_FAST_FORWARD_MAX_STEPS);
+        dt /= (float)substeps;
+    }
+    for (int32 substep = 0; substep < substeps; substep++)
+    {
+        instance.Time += dt;
+        const float fps = particleSystem->FramesPerSecond;
+        const float duration = (float)particleSystem->DurationFrames / fps;
+        if (instance.Time > duration)
         {
-            // Loop
-            // TODO: accumulate (duration - instance.Time) into next update dt
-            instance.Time = 0;
-            for (int32 j = 0; j < instance.Emitters.Count(); j++)
+            if (effect->IsLooping)
             {
-                auto& e = instance.Emitters[j];
-                e.Time = 0;
-                for (auto& s : e.SpawnModulesData)
+                // Loop
+                // TODO: accumulate (duration - instance.Time) into next update dt
+                instance.Time = 0;
+                for (int32 j = 0; j < instance.Emitters.Count(); j++)
                 {
-                    s.NextSpawnTime = 0.0f;
+                    auto& e = instance.Emitters[j];
+                    e.Time = 0;
+                    for (auto& s : e.SpawnModulesData)
+                    {
+                        s.NextSpawnTime = 0.0f;
+                    }
                 }
             }
-        }
-        else
-        {
-            // End
-            instance.Time = duration;
-            for (auto& emitterInstance : instance.Emitters)
+            else
             {
-                if (emitterInstance.Buffer)
+                // End
+                instance.Time = duration;
+                for (auto& emitterInstance : instance.Emitters)
                 {
-                    Particles::RecycleParticleBuffer(emitterInstance.Buffer);
-                    emitterInstance.Buffer = nullptr;
+                    if (emitterInstance.Buffer)
+                    {
+                        Particles::RecycleParticleBuffer(emitterInstance.Buffer);
+                        emitterInstance.Buffer = nullptr;
+                    }
                 }
+                // Stop playing effect.
+                effect->Stop();
+                return;
             }
-            // Stop playing effect.
-            effect->Stop();
-            return;
         }
-    }
-    instance.LastUpdateTime = t;
+        instance.LastUpdateTime = t;
 
-    // Update all emitter tracks
-    for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
-    {
-        const auto& track = particleSystem->Tracks[j];
-        if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
-            continue;
-        auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
-        auto& data = instance.Emitters[track.AsEmitter.Index];
-        ASSERT(emitter && emitter->IsLoaded());
-        if (emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
-            continue;
-        PROFILE_CPU_ASSET(emitter);
+        // Update all emitter tracks
+        for (int32 j = 0; j < particleSystem->Tracks.Count(); j++)
+        {
+            const auto& track = particleSystem->Tracks[j];
+            if (track.Type != ParticleSystem::Track::Types::Emitter || track.Disabled)
+                continue;
+            auto emitter = particleSystem->Emitters[track.AsEmitter.Index].Get();
+            auto& data = instance.Emitters[track.AsEmitter.Index];
+            ASSERT(emitter && emitter->IsLoaded());
+            if (emitter->Capacity == 0 || emitter->Graph.Layout.Size == 0)
+                continue;
+            PROFILE_CPU_ASSET(emitter);
 
-        // Calculate new time position
-        const float startTime = (float)track.AsEmitter.StartFrame / fps;
-        const float durationTime = (float)track.AsEmitter.DurationFrames / fps;
-        const bool canSpawn = startTime <= instance.Time && instance.Time <= startTime + durationTime;
+            // Calculate new time position
+            const float startTime = (float)track.AsEmitter.StartFrame / fps;
+            const float durationTime = (float)track.AsEmitter.DurationFrames / fps;
+            const bool canSpawn = startTime <= instance.Time && instance.Time <= startTime + durationTime;
 
-        // Update instance data
-        data.Sync(effect->Instance, particleSystem, track.AsEmitter.Index);
-        if (!data.Buffer)
-        {
-            data.Buffer = Particles::AcquireParticleBuffer(emitter);
-        }
-        data.Time += dt;
+            // Update instance data
+            data.Sync(effect->Instance, particleSystem, track.AsEmitter.Index);
+            if (!data.Buffer)
+            {
+                data.Buffer = Particles::AcquireParticleBuffer(emitter);
+            }
+            data.Time += dt;
 
-        // Update particles simulation
-        switch (emitter->SimulationMode)
-        {
-        case ParticlesSimulationMode::CPU:
-            emitter->GraphExecutorCPU.Update(emitter, effect, data, dt, canSpawn);
-            updateBounds |= emitter->UseAutoBounds;
-            break;
+            // Update particles simulation
+            switch (emitter->SimulationMode)
+            {
+            case ParticlesSimulationMode::CPU:
+                emitter->GraphExecutorCPU.Update(emitter, effect, data, dt, canSpawn);
+                updateBounds |= emitter->UseAutoBounds;
+                break;
 #if COMPILE_WITH_GPU_PARTICLES
-        case ParticlesSimulationMode::GPU:
-            emitter->GPU.Update(emitter, effect, data, dt, canSpawn);
-            updateGpu = true;
-            break;
+            case ParticlesSimulationMode::GPU:
+                emitter->GPU.Update(emitter, effect, data, dt, canSpawn);
+                updateGpu = true;
+                break;
 #endif
-        default:
-            break;
+            default:
+                break;
+            }
         }
     }
 
@@ -1401,6 +1797,11 @@ void ParticlesSystem::Execute(TaskGraph* graph)
     Time = tickData.Time.GetTotalSeconds();
     UnscaledTime = tickData.UnscaledTime.GetTotalSeconds();
 
+    // Cull the least significant effects that exceed the particles budgets
+    ApplyBudgets();
+    if (UpdateList.Count() == 0)
+        return;
+
     // Schedule work to update all particles in async
     Function<void(int32)> job;
     job.Bind<ParticlesSystem, &ParticlesSystem::Job>(this);
@@ -1439,7 +1840,7 @@ void ParticlesSystem::PostExecute(TaskGraph* graph)
         for (int32 j = 0; j < entries.Count(); j++)
         {
             auto& e = entries[j];
-            if (timeSeconds - e.LastTimeUsed >= Particles::ParticleBufferRecycleTimeout)
+            if (!e.Preheated && timeSeconds - e.LastTimeUsed >= Particles::ParticleBufferRecycleTimeout)
             {
                 Delete(e.Buffer);
                 entries.RemoveAt(j--);
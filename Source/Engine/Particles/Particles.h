@@ -60,7 +60,7 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     static float ParticleBufferRecycleTimeout;
 
     /// <summary>
-    /// Acquires the free particle buffer for the emitter instance data.
+    /// Acquires the free particle buffer for the emitter instance data. Pooled buffers are shared between the emitters with the same simulation mode and particles data size class.
     /// </summary>
     /// <param name="emitter">The emitter.</param>
     /// <returns>The particle buffer.</returns>
@@ -72,6 +72,20 @@ API_CLASS(Static) class FLAXENGINE_API Particles
     /// <param name="buffer">The particle buffer.</param>
     static void RecycleParticleBuffer(ParticleBuffer* buffer);
 
+    /// <summary>
+    /// Pre-allocates the particle buffers for the emitter and puts them into the pool (eg. at level load to prevent the buffers allocation hitches on the first effect spawn). Preheated buffers are not released by the recycle timeout until used.
+    /// </summary>
+    /// <param name="emitter">The emitter.</param>
+    /// <param name="count">The amount of the pooled buffers to have for the emitter (eg. maximum amount of the effects using it spawned at once).</param>
+    API_FUNCTION() static void PreheatParticleBuffers(ParticleEmitter* emitter, int32 count = 1);
+
+    /// <summary>
+    /// Pre-allocates the particle buffers for all emitters of the particle system and puts them into the pool (eg. at level load to prevent the buffers allocation hitches on the first effect spawn). Preheated buffers are not released by the recycle timeout until used.
+    /// </summary>
+    /// <param name="system">The particle system.</param>
+    /// <param name="count">The amount of the pooled buffers to have per emitter (eg. maximum amount of the effects spawned at once).</param>
+    API_FUNCTION() static void PreheatParticleSystemBuffers(ParticleSystem* system, int32 count = 1);
+
     /// <summary>
     /// Called when emitter gets unloaded. Particle buffers using this emitter has to be cleared.
     /// </summary>
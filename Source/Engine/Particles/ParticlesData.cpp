@@ -3,6 +3,7 @@
 #include "ParticlesData.h"
 #include "ParticleEmitter.h"
 #include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/DynamicBuffer.h"
 
@@ -15,16 +16,53 @@ ParticleBuffer::~ParticleBuffer()
     SAFE_DELETE_GPU_RESOURCE(GPU.Buffer);
     SAFE_DELETE_GPU_RESOURCE(GPU.BufferSecondary);
     SAFE_DELETE_GPU_RESOURCE(GPU.IndirectDrawArgsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(GPU.DispatchArgsBuffer);
     SAFE_DELETE_GPU_RESOURCE(GPU.SortingKeysBuffer);
     SAFE_DELETE_GPU_RESOURCE(GPU.SortedIndices);
+    SAFE_DELETE_GPU_RESOURCE(GPU.RibbonOrder);
+    SAFE_DELETE_GPU_RESOURCE(GPU.RibbonVertexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(GPU.RibbonIndexBuffer);
+    SAFE_DELETE_GPU_RESOURCE(GPU.RibbonDrawArgsBuffer);
     SAFE_DELETE(GPU.RibbonIndexBufferDynamic);
     SAFE_DELETE(GPU.RibbonVertexBufferDynamic);
 }
 
+uint32 ParticleBuffer::GetSizeClass(uint32 size)
+{
+    // Round up to the power of two (with minimum size) so buffers of emitters with similar capacity and layout can be shared
+    return Math::RoundUpToPowerOf2(Math::Max<uint32>(size, 4 * 1024));
+}
+
+uint32 ParticleBuffer::GetRequiredSize(ParticleEmitter* emitter)
+{
+    uint32 size = emitter->Capacity * emitter->Graph.Layout.Size;
+#if COMPILE_WITH_GPU_PARTICLES
+    if (emitter->SimulationMode == ParticlesSimulationMode::GPU)
+        size += sizeof(uint32) + emitter->GPU.CustomDataSize;
+#endif
+    return emitter->EnablePooling ? GetSizeClass(size) : size;
+}
+
 bool ParticleBuffer::Init(ParticleEmitter* emitter)
 {
     ASSERT(emitter && emitter->IsLoaded());
 
+    // Release the resources specific to the previous emitter when reusing the buffer
+    if (Emitter)
+    {
+        SAFE_DELETE_GPU_RESOURCE(GPU.SortingKeysBuffer);
+        SAFE_DELETE_GPU_RESOURCE(GPU.SortedIndices);
+        SAFE_DELETE_GPU_RESOURCE(GPU.RibbonOrder);
+        SAFE_DELETE_GPU_RESOURCE(GPU.RibbonVertexBuffer);
+        SAFE_DELETE_GPU_RESOURCE(GPU.RibbonIndexBuffer);
+        SAFE_DELETE_GPU_RESOURCE(GPU.RibbonDrawArgsBuffer);
+        if (Mode != emitter->SimulationMode)
+        {
+            SAFE_DELETE_GPU_RESOURCE(GPU.Buffer);
+            SAFE_DELETE_GPU_RESOURCE(GPU.BufferSecondary);
+        }
+    }
+
     Version = emitter->Graph.Version;
     Capacity = emitter->Capacity;
     Emitter = emitter;
@@ -32,7 +70,14 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
     Stride = Layout->Size;
     Mode = emitter->SimulationMode;
 
+    // Existing data buffers are reused if they are big enough (eg. pooled buffer from the other emitter of the same size class)
     const int32 size = Capacity * Stride;
+    const uint32 allocationSize = GetRequiredSize(emitter);
+    if (GPU.Buffer && GPU.Buffer->GetSize() != allocationSize)
+    {
+        SAFE_DELETE_GPU_RESOURCE(GPU.Buffer);
+        SAFE_DELETE_GPU_RESOURCE(GPU.BufferSecondary);
+    }
     switch (Mode)
     {
     case ParticlesSimulationMode::CPU:
@@ -40,9 +85,12 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
         CPU.Count = 0;
         CPU.Buffer.Resize(size);
         CPU.RibbonOrder.Resize(0);
-        GPU.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer"));
-        if (GPU.Buffer->Init(GPUBufferDescription::Raw(size, GPUBufferFlags::ShaderResource, GPUResourceUsage::Dynamic)))
-            return true;
+        if (!GPU.Buffer)
+        {
+            GPU.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer"));
+            if (GPU.Buffer->Init(GPUBufferDescription::Raw(allocationSize, GPUBufferFlags::ShaderResource, GPUResourceUsage::Dynamic)))
+                return true;
+        }
         break;
     }
 #if COMPILE_WITH_GPU_PARTICLES
@@ -55,13 +103,23 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
         }
 
         // Particle data buffer: attributes + counter + custom data
-        GPU.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer A"));
-        if (GPU.Buffer->Init(GPUBufferDescription::Raw(size + sizeof(uint32) + emitter->GPU.CustomDataSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
-            return true;
-        GPU.BufferSecondary = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer B"));
-        if (GPU.BufferSecondary->Init(GPU.Buffer->GetDescription()))
-            return true;
-        GPU.IndirectDrawArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleIndirectDrawArgsBuffer"));
+        if (!GPU.Buffer)
+        {
+            GPU.Buffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer A"));
+            if (GPU.Buffer->Init(GPUBufferDescription::Raw(allocationSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess)))
+                return true;
+            GPU.BufferSecondary = GPUDevice::Instance->CreateBuffer(TEXT("ParticleBuffer B"));
+            if (GPU.BufferSecondary->Init(GPU.Buffer->GetDescription()))
+                return true;
+        }
+        if (!GPU.IndirectDrawArgsBuffer)
+            GPU.IndirectDrawArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleIndirectDrawArgsBuffer"));
+        if (!GPU.DispatchArgsBuffer)
+        {
+            GPU.DispatchArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleDispatchArgsBuffer"));
+            if (GPU.DispatchArgsBuffer->Init(GPUBufferDescription::Raw(2 * sizeof(GPUDispatchIndirectArgs), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+                return true;
+        }
         GPU.PendingClear = true;
         GPU.HasValidCount = false;
         GPU.ParticleCounterOffset = size;
@@ -78,7 +136,7 @@ bool ParticleBuffer::Init(ParticleEmitter* emitter)
 
 bool ParticleBuffer::AllocateSortBuffer()
 {
-    ASSERT(Emitter && GPU.SortedIndices == nullptr && GPU.SortingKeysBuffer == nullptr);
+    ASSERT(Emitter && GPU.SortedIndices == nullptr);
     if (Emitter->Graph.SortModules.IsEmpty())
         return false;
 
@@ -96,9 +154,12 @@ bool ParticleBuffer::AllocateSortBuffer()
     case ParticlesSimulationMode::GPU:
     {
         const int32 sortedIndicesSize = Capacity * sizeof(uint32) * Emitter->Graph.SortModules.Count();
-        GPU.SortingKeysBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleSortingKeysBuffer"));
-        if (GPU.SortingKeysBuffer->Init(GPUBufferDescription::Structured(Capacity, sizeof(float) + sizeof(uint32), true)))
-            return true;
+        if (!GPU.SortingKeysBuffer)
+        {
+            GPU.SortingKeysBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleSortingKeysBuffer"));
+            if (GPU.SortingKeysBuffer->Init(GPUBufferDescription::Structured(Capacity, sizeof(float) + sizeof(uint32), true)))
+                return true;
+        }
         GPU.SortedIndices = GPUDevice::Instance->CreateBuffer(TEXT("SortedIndices"));
         if (GPU.SortedIndices->Init(GPUBufferDescription::Buffer(sortedIndicesSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32))))
             return true;
@@ -113,6 +174,67 @@ bool ParticleBuffer::AllocateSortBuffer()
     return false;
 }
 
+bool ParticleBuffer::AllocateRibbonBuffers()
+{
+    ASSERT(Emitter && GPU.RibbonVertexBuffer == nullptr);
+    const int32 ribbonsCount = Emitter->Graph.RibbonRenderingModules.Count();
+    if (ribbonsCount == 0 || Capacity < 2)
+        return false;
+
+    // Ribbon order (uploaded from the CPU particles or sorted on a GPU)
+    const int32 orderSize = Capacity * sizeof(uint32) * ribbonsCount;
+    GPU.RibbonOrder = GPUDevice::Instance->CreateBuffer(TEXT("RibbonOrder"));
+    switch (Mode)
+    {
+    case ParticlesSimulationMode::CPU:
+        if (GPU.RibbonOrder->Init(GPUBufferDescription::Buffer(orderSize, GPUBufferFlags::ShaderResource, PixelFormat::R32_UInt, nullptr, sizeof(uint32), GPUResourceUsage::Dynamic)))
+            return true;
+        break;
+#if COMPILE_WITH_GPU_PARTICLES
+    case ParticlesSimulationMode::GPU:
+        if (GPU.RibbonOrder->Init(GPUBufferDescription::Buffer(orderSize, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_UInt, nullptr, sizeof(uint32))))
+            return true;
+        if (!GPU.SortingKeysBuffer)
+        {
+            GPU.SortingKeysBuffer = GPUDevice::Instance->CreateBuffer(TEXT("ParticleSortingKeysBuffer"));
+            if (GPU.SortingKeysBuffer->Init(GPUBufferDescription::Structured(Capacity, sizeof(float) + sizeof(uint32), true)))
+                return true;
+        }
+        break;
+#endif
+    default:
+        CRASH;
+        return true;
+    }
+
+    // Ribbon geometry (2 vertices per particle, 2 triangles per segment)
+    const uint32 vertexStride = sizeof(uint32) * 3 + sizeof(float);
+    GPU.RibbonVertexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RibbonVertexBuffer"));
+    if (GPU.RibbonVertexBuffer->Init(GPUBufferDescription::Buffer(Capacity * 2 * vertexStride * ribbonsCount, GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, nullptr, vertexStride)))
+        return true;
+    Array<uint32> indices;
+    indices.Resize((Capacity - 1) * 6);
+    for (int32 segment = 0, i = 0; segment < Capacity - 1; segment++)
+    {
+        const uint32 i0 = segment * 2;
+        const uint32 i1 = i0 + 2;
+        indices[i++] = i0;
+        indices[i++] = i0 + 1;
+        indices[i++] = i1;
+        indices[i++] = i0 + 1;
+        indices[i++] = i1 + 1;
+        indices[i++] = i1;
+    }
+    GPU.RibbonIndexBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RibbonIndexBuffer"));
+    if (GPU.RibbonIndexBuffer->Init(GPUBufferDescription::Index(sizeof(uint32), indices.Count(), indices.Get())))
+        return true;
+    GPU.RibbonDrawArgsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("RibbonDrawArgsBuffer"));
+    if (GPU.RibbonDrawArgsBuffer->Init(GPUBufferDescription::Raw(sizeof(GPUDrawIndexedIndirectArgs) * ribbonsCount, GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+        return true;
+
+    return false;
+}
+
 void ParticleBuffer::Clear()
 {
     switch (Mode)
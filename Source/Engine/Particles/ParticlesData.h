@@ -284,6 +284,11 @@ class FLAXENGINE_API ParticleBuffer
         /// </summary>
         GPUBuffer* IndirectDrawArgsBuffer = nullptr;
 
+        /// <summary>
+        /// The indirect dispatch arguments buffer used by the GPU particles to invoke the simulation and sorting keys generation based on the particles counter (without reading it back to the CPU). Contains two GPUDispatchIndirectArgs: simulation (live particles + spawn count) and sorting (live particles).
+        /// </summary>
+        GPUBuffer* DispatchArgsBuffer = nullptr;
+
         /// <summary>
         /// The GPU particles sorting buffer. Contains structure of particle index and the sorting key for every particle. Used to sort particles.
         /// </summary>
@@ -297,6 +302,26 @@ class FLAXENGINE_API ParticleBuffer
         /// </remarks>
         GPUBuffer* SortedIndices = nullptr;
 
+        /// <summary>
+        /// The ribbon particles order buffer (GPU side). Contains sorted particles indices for ribbon geometry generation on a GPU. Each ribbon module from the emitter uses a dedicated range of this buffer.
+        /// </summary>
+        GPUBuffer* RibbonOrder = nullptr;
+
+        /// <summary>
+        /// The ribbon particles rendering vertex buffer generated on a GPU. Each ribbon module from the emitter uses a dedicated range of this buffer (2 vertices per particle).
+        /// </summary>
+        GPUBuffer* RibbonVertexBuffer = nullptr;
+
+        /// <summary>
+        /// The ribbon particles rendering index buffer used with the geometry generated on a GPU (static, 2 triangles per segment).
+        /// </summary>
+        GPUBuffer* RibbonIndexBuffer = nullptr;
+
+        /// <summary>
+        /// The indirect draw command arguments buffer used by the ribbon particles geometry generated on a GPU (one per ribbon module).
+        /// </summary>
+        GPUBuffer* RibbonDrawArgsBuffer = nullptr;
+
         /// <summary>
         /// The ribbon particles rendering index buffer (dynamic GPU access).
         /// </summary>
@@ -340,18 +365,38 @@ class FLAXENGINE_API ParticleBuffer
     ~ParticleBuffer();
 
     /// <summary>
-    /// Initializes the particle buffer for the specified emitter.
+    /// Initializes the particle buffer for the specified emitter. Can be called on the already initialized buffer to reuse it for the other emitter (data buffers are kept if they match the required size).
     /// </summary>
     /// <param name="emitter">The emitter.</param>
     /// <returns>True if failed, otherwise false.</returns>
     bool Init(ParticleEmitter* emitter);
 
+    /// <summary>
+    /// Gets the size class of the particles data buffer (pooled buffers of the same size class are shared between the emitters).
+    /// </summary>
+    /// <param name="size">The required size of the particles data (in bytes).</param>
+    /// <returns>The allocation size (in bytes).</returns>
+    static uint32 GetSizeClass(uint32 size);
+
+    /// <summary>
+    /// Gets the size of the particles data buffer allocation for the specified emitter (rounded up to the size class if emitter uses pooling).
+    /// </summary>
+    /// <param name="emitter">The emitter.</param>
+    /// <returns>The allocation size (in bytes).</returns>
+    static uint32 GetRequiredSize(ParticleEmitter* emitter);
+
     /// <summary>
     /// Allocates the particles sorting indices buffer.
     /// </summary>
     /// <returns>True if failed, otherwise false.</returns>
     bool AllocateSortBuffer();
 
+    /// <summary>
+    /// Allocates the buffers used to generate the ribbon particles geometry on a GPU.
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool AllocateRibbonBuffers();
+
     /// <summary>
     /// Clears the particles from the buffer (prepares for the simulation).
     /// </summary>
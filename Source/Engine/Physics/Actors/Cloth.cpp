@@ -3,20 +3,27 @@
 #include "Cloth.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Ray.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/Time.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderTools.h"
-#include "Engine/Graphics/Models/MeshBase.h"
+#include "Engine/Graphics/Models/Mesh.h"
 #include "Engine/Graphics/Models/MeshDeformation.h"
+#include "Engine/Physics/Physics.h"
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Level/Actors/AnimatedModel.h"
 #include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Renderer/ClothSimulationPass.h"
 #if USE_EDITOR
 #include "Engine/Debug/DebugDraw.h"
 #endif
 
+// Scale of the GPU cloth constraints compliance (XPBD) for the fabric stiffness below 1
+#define CLOTH_GPU_COMPLIANCE_SCALE 0.001f
+
 Cloth::Cloth(const SpawnParams& params)
     : Actor(params)
 {
@@ -48,15 +55,19 @@ void Cloth::SetMesh(const ModelInstanceActor::MeshReference& value)
     if (_meshDeformation)
     {
         Function<void(const MeshBase*, MeshDeformationData&)> deformer;
-        deformer.Bind<Cloth, &Cloth::RunClothDeformer>(this);
+        if (_gpuCloth)
+            deformer.Bind<Cloth, &Cloth::RunGPUClothDeformer>(this);
+        else
+            deformer.Bind<Cloth, &Cloth::RunClothDeformer>(this);
         _meshDeformation->RemoveDeformer(_mesh.LODIndex, _mesh.MeshIndex, MeshBufferType::Vertex0, deformer);
+        _meshDeformation->RemoveDeformer(_mesh.LODIndex, _mesh.MeshIndex, MeshBufferType::Vertex1, deformer);
         _meshDeformation = nullptr;
     }
 
     _mesh = value;
     _mesh.Actor = nullptr; // Don't store this reference
 #if WITH_CLOTH
-    if (_cloth)
+    if (_cloth || _gpuCloth)
         Rebuild();
 #endif
 }
@@ -81,9 +92,12 @@ void Cloth::SetCollision(const CollisionSettings& value)
 
 void Cloth::SetSimulation(const SimulationSettings& value)
 {
+    const bool rebuild = _simulationSettings.UseGPU != value.UseGPU || (_gpuCloth && _simulationSettings.ComputeNormals != value.ComputeNormals);
     _simulationSettings = value;
 #if WITH_CLOTH
-    if (_cloth)
+    if ((_cloth || _gpuCloth) && rebuild)
+        Rebuild();
+    else if (_cloth)
         PhysicsBackend::SetClothSimulationSettings(_cloth, &value);
 #endif
 }
@@ -94,16 +108,18 @@ void Cloth::SetFabric(const FabricSettings& value)
 #if WITH_CLOTH
     if (_cloth)
         PhysicsBackend::SetClothFabricSettings(_cloth, &value);
+    else if (_gpuCloth)
+        Rebuild(); // Fabric is baked into the GPU constraints
 #endif
 }
 
 void Cloth::Rebuild()
 {
 #if WITH_CLOTH
-    if (_cloth)
+    if (_cloth || _gpuCloth)
     {
         // Remove old
-        if (IsDuringPlay())
+        if (IsDuringPlay() && _cloth)
             PhysicsBackend::RemoveCloth(GetPhysicsScene()->GetPhysicsScene(), _cloth);
         DestroyCloth();
     }
@@ -120,6 +136,8 @@ void Cloth::ClearInteria()
 #if WITH_CLOTH
     if (_cloth)
         PhysicsBackend::ClearClothInertia(_cloth);
+    if (_gpuCloth && GetParent())
+        _gpuCachedPosition = GetParent()->GetPosition();
 #endif
 }
 
@@ -490,7 +508,7 @@ void Cloth::OnParentChanged()
     Actor::OnParentChanged();
 
 #if WITH_CLOTH
-    if (_cloth)
+    if (_cloth || _gpuCloth)
         Rebuild();
 #endif
 }
@@ -571,6 +589,10 @@ bool Cloth::CreateCloth()
     desc.MaxDistancesData = _paint.Count() == desc.VerticesCount ? _paint.Get() : nullptr;
     desc.MaxDistancesStride = sizeof(float);
 
+    // Use GPU simulation for static models (skinned meshes require CPU simulation to follow the skeleton pose)
+    if (_simulationSettings.UseGPU && desc.VerticesStride == sizeof(VB0ElementType) && !Cast<AnimatedModel>(GetParent()) && ClothSimulationPass::Instance()->CanUse())
+        return CreateGPUCloth(desc);
+
     // Create cloth
     ASSERT(_cloth == nullptr);
     _cloth = PhysicsBackend::CreateCloth(desc);
@@ -589,9 +611,9 @@ bool Cloth::CreateCloth()
     {
         Function<void(const MeshBase*, MeshDeformationData&)> deformer;
         deformer.Bind<Cloth, &Cloth::RunClothDeformer>(this);
-        deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex0, deformer);
+        deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex0, deformer, MeshDeformerFlags::Async);
         if (_simulationSettings.ComputeNormals)
-            deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex1, deformer);
+            deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex1, deformer, MeshDeformerFlags::Async);
         _meshDeformation = deformation;
     }
 
@@ -608,7 +630,10 @@ void Cloth::DestroyCloth()
     if (_meshDeformation)
     {
         Function<void(const MeshBase*, MeshDeformationData&)> deformer;
-        deformer.Bind<Cloth, &Cloth::RunClothDeformer>(this);
+        if (_gpuCloth)
+            deformer.Bind<Cloth, &Cloth::RunGPUClothDeformer>(this);
+        else
+            deformer.Bind<Cloth, &Cloth::RunClothDeformer>(this);
         _meshDeformation->RemoveDeformer(_mesh.LODIndex, _mesh.MeshIndex, MeshBufferType::Vertex0, deformer);
         _meshDeformation->RemoveDeformer(_mesh.LODIndex, _mesh.MeshIndex, MeshBufferType::Vertex1, deformer);
         _meshDeformation = nullptr;
@@ -618,6 +643,11 @@ void Cloth::DestroyCloth()
         PhysicsBackend::DestroyCloth(_cloth);
         _cloth = nullptr;
     }
+    if (_gpuCloth)
+    {
+        Delete(_gpuCloth);
+        _gpuCloth = nullptr;
+    }
 #endif
 }
 
@@ -746,6 +776,9 @@ bool Cloth::OnPreUpdate()
         return true;
     if (!_simulationSettings.UpdateWhenOffscreen && _simulationSettings.CullDistance > 0)
     {
+        // Include the physics simulation LOD viewers (eg. server without rendering)
+        _lastMinDstSqr = Math::Min(_lastMinDstSqr, Physics::GetSimulationLODDistanceSquared(_transform.Translation));
+
         // Cull based on distance
         bool cull = false;
         if (_lastMinDstSqr >= Math::Square(_simulationSettings.CullDistance))
@@ -1053,3 +1086,234 @@ void Cloth::RunClothDeformer(const MeshBase* mesh, MeshDeformationData& deformat
     PhysicsBackend::UnlockClothParticles(_cloth);
 #endif
 }
+
+bool Cloth::CreateGPUCloth(const PhysicsClothDesc& desc)
+{
+#if WITH_CLOTH
+    PROFILE_CPU();
+    const int32 verticesCount = (int32)desc.VerticesCount;
+    const int32 trianglesCount = (int32)desc.IndicesCount / 3;
+    const bool indices16bit = desc.IndicesStride == sizeof(uint16);
+#define GET_INDEX(i) (indices16bit ? (uint32)((const uint16*)desc.IndicesData)[i] : ((const uint32*)desc.IndicesData)[i])
+#define GET_POS(i) *(const Float3*)((const byte*)desc.VerticesData + (i) * desc.VerticesStride)
+
+    // Setup particles
+    Array<Float4> particles;
+    particles.Resize(verticesCount);
+    for (int32 i = 0; i < verticesCount; i++)
+        particles[i] = Float4(GET_POS(i), desc.InvMassesData ? desc.InvMassesData[i] : 1.0f);
+
+    // Setup distance constraints from the mesh edges (stretch) and between the opposite vertices of the adjacent triangles (bending)
+    struct Constraint
+    {
+        uint32 Index0, Index1;
+        float RestLength, Compliance;
+    };
+    auto getCompliance = [](const FabricAxisSettings& axis)
+    {
+        const float stiffness = axis.Stiffness * axis.StiffnessMultiplier;
+        return stiffness > ZeroTolerance ? Math::Max(1.0f / stiffness - 1.0f, 0.0f) * CLOTH_GPU_COMPLIANCE_SCALE : -1.0f;
+    };
+    const float verticalCompliance = getCompliance(_fabricSettings.Vertical);
+    const float horizontalCompliance = getCompliance(_fabricSettings.Horizontal);
+    const float bendingCompliance = getCompliance(_fabricSettings.Bending);
+    Float3 up = GetParent() ? -(Float3)GetParent()->GetTransform().WorldToLocalVector(Physics::GetGravity()) : Float3::Zero;
+    if (up.LengthSquared() > ZeroTolerance)
+        up.Normalize();
+    else
+        up = Float3::Up;
+    Array<Constraint> constraints;
+    Dictionary<uint64, uint32> edges;
+    edges.EnsureCapacity(trianglesCount * 2);
+    for (int32 triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++)
+    {
+        const uint32 triangle[3] = { GET_INDEX(triangleIndex * 3), GET_INDEX(triangleIndex * 3 + 1), GET_INDEX(triangleIndex * 3 + 2) };
+        for (int32 edgeIndex = 0; edgeIndex < 3; edgeIndex++)
+        {
+            const uint32 i0 = triangle[edgeIndex];
+            const uint32 i1 = triangle[(edgeIndex + 1) % 3];
+            const uint32 opposite = triangle[(edgeIndex + 2) % 3];
+            const uint64 key = ((uint64)Math::Min(i0, i1) << 32) | (uint64)Math::Max(i0, i1);
+            uint32 otherOpposite;
+            Constraint constraint;
+            if (edges.TryGet(key, otherOpposite))
+            {
+                // Bending
+                constraint.Index0 = opposite;
+                constraint.Index1 = otherOpposite;
+                constraint.Compliance = bendingCompliance;
+            }
+            else
+            {
+                // Stretch (along or perpendicular to the gravity)
+                edges.Add(key, opposite);
+                constraint.Index0 = i0;
+                constraint.Index1 = i1;
+                const Float3 direction = Float3::Normalize(GET_POS(i1) - GET_POS(i0));
+                constraint.Compliance = Math::Abs(Float3::Dot(direction, up)) > 0.7f ? verticalCompliance : horizontalCompliance;
+            }
+            if (constraint.Compliance < 0.0f || constraint.Index0 == constraint.Index1)
+                continue;
+            constraint.RestLength = Float3::Distance(GET_POS(constraint.Index0), GET_POS(constraint.Index1));
+            constraints.Add(constraint);
+        }
+    }
+
+    // Split constraints into groups that don't share particles (graph coloring) to solve each group in parallel
+    Array<uint64> particleGroups;
+    particleGroups.Resize(verticesCount);
+    particleGroups.SetAll(0);
+    Array<int32> constraintGroups;
+    constraintGroups.Resize(constraints.Count());
+    int32 groupsCount = 0;
+    for (int32 i = 0; i < constraints.Count(); i++)
+    {
+        const Constraint& constraint = constraints[i];
+        const uint64 used = particleGroups[constraint.Index0] | particleGroups[constraint.Index1];
+        int32 group = 0;
+        while (group < 63 && (used & (1ull << group)) != 0)
+            group++;
+        particleGroups[constraint.Index0] |= 1ull << group;
+        particleGroups[constraint.Index1] |= 1ull << group;
+        constraintGroups[i] = group;
+        groupsCount = Math::Max(groupsCount, group + 1);
+    }
+    Array<Int2> groups;
+    groups.Resize(groupsCount);
+    for (Int2& group : groups)
+        group = Int2::Zero;
+    for (int32 group : constraintGroups)
+        groups[group].Y++;
+    for (int32 i = 1; i < groupsCount; i++)
+        groups[i].X = groups[i - 1].X + groups[i - 1].Y;
+    Array<Constraint> sortedConstraints;
+    sortedConstraints.Resize(constraints.Count());
+    Array<int32> groupsFill;
+    groupsFill.Resize(groupsCount);
+    groupsFill.SetAll(0);
+    for (int32 i = 0; i < constraints.Count(); i++)
+    {
+        const int32 group = constraintGroups[i];
+        sortedConstraints[groups[group].X + groupsFill[group]++] = constraints[i];
+    }
+
+    // Setup particles adjacency for normals (per-particle range of the triangles, followed by the triangles indices)
+    Array<uint32> adjacency;
+    adjacency.Resize(verticesCount * 2 + trianglesCount * 9);
+    Platform::MemoryClear(adjacency.Get(), adjacency.Count() * sizeof(uint32));
+    for (int32 i = 0; i < trianglesCount * 3; i++)
+        adjacency[GET_INDEX(i) * 2 + 1]++;
+    uint32 adjacencyOffset = verticesCount * 2;
+    for (int32 i = 0; i < verticesCount; i++)
+    {
+        adjacency[i * 2] = adjacencyOffset;
+        adjacencyOffset += adjacency[i * 2 + 1] * 3;
+    }
+    Array<uint32> adjacencyFill;
+    adjacencyFill.Resize(verticesCount);
+    adjacencyFill.SetAll(0);
+    for (int32 triangleIndex = 0; triangleIndex < trianglesCount; triangleIndex++)
+    {
+        const uint32 triangle[3] = { GET_INDEX(triangleIndex * 3), GET_INDEX(triangleIndex * 3 + 1), GET_INDEX(triangleIndex * 3 + 2) };
+        for (const uint32 vertexIndex : triangle)
+        {
+            uint32* dst = adjacency.Get() + adjacency[vertexIndex * 2] + adjacencyFill[vertexIndex]++ * 3;
+            dst[0] = triangle[0];
+            dst[1] = triangle[1];
+            dst[2] = triangle[2];
+        }
+    }
+#undef GET_INDEX
+#undef GET_POS
+
+    // Create GPU resources
+    ASSERT(_gpuCloth == nullptr);
+    _gpuCloth = New<GPUClothData>();
+    const Span<float> maxDistances = _paint.Count() == verticesCount ? ToSpan(_paint) : Span<float>();
+    if (_gpuCloth->Init(ToSpan(particles), maxDistances, Span<uint32>((uint32*)sortedConstraints.Get(), sortedConstraints.Count() * 4), ToSpan(adjacency)))
+    {
+        Delete(_gpuCloth);
+        _gpuCloth = nullptr;
+        return true;
+    }
+    _gpuCloth->ConstraintsGroups = MoveTemp(groups);
+    _gpuCachedPosition = GetParent()->GetPosition();
+
+    // Add cloth mesh deformer
+    const ModelInstanceActor::MeshReference mesh = GetMesh();
+    if (auto* deformation = mesh.Actor->GetMeshDeformation())
+    {
+        Function<void(const MeshBase*, MeshDeformationData&)> deformer;
+        deformer.Bind<Cloth, &Cloth::RunGPUClothDeformer>(this);
+        deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex0, deformer, MeshDeformerFlags::GPU);
+        if (_simulationSettings.ComputeNormals)
+            deformation->AddDeformer(mesh.LODIndex, mesh.MeshIndex, MeshBufferType::Vertex1, deformer, MeshDeformerFlags::GPU);
+        _meshDeformation = deformation;
+    }
+
+    _lastMinDstSqr = MAX_Real;
+#endif
+    return false;
+}
+
+void Cloth::RunGPUClothDeformer(const MeshBase* mesh, MeshDeformationData& deformation)
+{
+#if WITH_CLOTH
+    // Fallback to the original mesh data when cloth is not simulated
+    deformation.OverrideBuffer = nullptr;
+    if (!_gpuCloth || !IsActiveInHierarchy())
+        return;
+
+    // Keep running deformer to update mesh every frame (vertices are written on the GPU so it doesn't update the mesh data on the CPU)
+    deformation.Dirty = true;
+    if (deformation.Type == MeshBufferType::Vertex1)
+    {
+        // Use normals computed by the simulation
+        if (_gpuCloth->IsVB0Initialized && _gpuCloth->IsVB1Initialized)
+            deformation.OverrideBuffer = _gpuCloth->VB1;
+        return;
+    }
+
+    // Simulate once per frame (mesh can be drawn multiple times, eg. in shadow passes)
+    if (_gpuCloth->LastUpdateFrame != Engine::FrameCount)
+    {
+        _gpuCloth->LastUpdateFrame = Engine::FrameCount;
+        const float deltaTime = Math::Min(Time::GetDeltaTime(), 1.0f / 15.0f);
+        bool cull = deltaTime <= ZeroTolerance;
+        if (!_simulationSettings.UpdateWhenOffscreen && _simulationSettings.CullDistance > 0)
+        {
+            _lastMinDstSqr = Math::Min(_lastMinDstSqr, Physics::GetSimulationLODDistanceSquared(_transform.Translation));
+            cull |= _lastMinDstSqr >= Math::Square(_simulationSettings.CullDistance);
+            _lastMinDstSqr = MAX_Real;
+        }
+        if (!cull)
+        {
+            // Simulate in the model space (the same as mesh vertices)
+            const Transform& transform = GetParent()->GetTransform();
+            const Vector3 movement = transform.Translation - _gpuCachedPosition;
+            _gpuCachedPosition = transform.Translation;
+            const float minTeleportDistanceSq = Math::Square(1000.0f);
+            GPUClothStep step;
+            step.DeltaTime = deltaTime;
+            step.Substeps = Math::Clamp(Math::CeilToInt(_simulationSettings.SolverFrequency * deltaTime), 1, 16);
+            step.Gravity = transform.WorldToLocalVector(Physics::GetGravity() * _forceSettings.GravityScale);
+            step.InertiaOffset = movement.LengthSquared() < minTeleportDistanceSq ? (Float3)transform.WorldToLocalVector(movement * _forceSettings.LinearInertia) : Float3::Zero;
+            step.VelocityScale = Math::Pow(1.0f - _forceSettings.Damping, step.DeltaTime / (float)step.Substeps);
+            step.Wind = transform.WorldToLocalVector(_simulationSettings.WindVelocity);
+            step.AirDrag = _forceSettings.AirDragCoefficient * _forceSettings.AirDensity;
+            step.MaxDistance = _simulationSettings.MaxParticleDistance;
+            step.ComputeNormals = _simulationSettings.ComputeNormals;
+            ClothSimulationPass::Instance()->Simulate(*_gpuCloth, step, ((const Mesh*)mesh)->GetVertexBuffer(1));
+        }
+    }
+    if (_gpuCloth->IsVB0Initialized)
+    {
+        deformation.OverrideBuffer = _gpuCloth->VB0;
+
+        // Particles can move up to the max distance from the rest pose
+        deformation.Bounds = mesh->GetBox();
+        deformation.Bounds.Minimum -= _simulationSettings.MaxParticleDistance;
+        deformation.Bounds.Maximum += _simulationSettings.MaxParticleDistance;
+    }
+#endif
+}
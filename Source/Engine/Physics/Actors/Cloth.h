@@ -155,6 +155,11 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Physics/Cloth\"), ActorToolbox(\"Ph
         /// Wind velocity vector (direction and magnitude) in world coordinates. A greater magnitude applies a stronger wind force. Ensure that Air Drag and Air Lift coefficients are non-zero in order to apply wind force.
         /// </summary>
         API_FIELD() Vector3 WindVelocity = Vector3::Zero;
+
+        /// <summary>
+        /// Enables cloth simulation on the GPU with compute shaders (XPBD solver) that writes directly into the mesh vertex buffers without CPU mesh deformation. Supported only for cloth on static models (animated models use CPU simulation). GPU simulation doesn't collide with the scene and particles data can't be read back to the CPU.
+        /// </summary>
+        API_FIELD() bool UseGPU = false;
     };
 
     /// <summary>
@@ -228,6 +233,8 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Physics/Cloth\"), ActorToolbox(\"Ph
     ModelInstanceActor::MeshReference _mesh;
     MeshDeformation* _meshDeformation = nullptr;
     Array<float> _paint;
+    struct GPUClothData* _gpuCloth = nullptr;
+    Vector3 _gpuCachedPosition = Vector3::Zero;
 
 public:
     /// <summary>
@@ -371,4 +378,6 @@ API_CLASS(Attributes="ActorContextMenu(\"New/Physics/Cloth\"), ActorToolbox(\"Ph
     void DestroyCloth();
     void CalculateInvMasses(Array<float>& invMasses);
     void RunClothDeformer(const MeshBase* mesh, struct MeshDeformationData& deformation);
+    bool CreateGPUCloth(const struct PhysicsClothDesc& desc);
+    void RunGPUClothDeformer(const MeshBase* mesh, struct MeshDeformationData& deformation);
 };
@@ -26,6 +26,11 @@ RigidBody::RigidBody(const SpawnParams& params)
     , _updateMassWhenScaleChanges(false)
     , _overrideMass(false)
     , _isUpdatingTransform(false)
+    , _useSimulationLOD(true)
+    , _lodSleeping(false)
+    , _simulationTier(PhysicsSimulationTier::Near)
+    , _lodPositionIters(4)
+    , _lodVelocityIters(1)
 {
 }
 
@@ -101,6 +106,23 @@ void RigidBody::SetStartAwake(bool value)
     _startAwake = value;
 }
 
+void RigidBody::SetUseSimulationLOD(bool value)
+{
+    if (value == GetUseSimulationLOD())
+        return;
+    _useSimulationLOD = value;
+    if (_actor)
+    {
+        if (value)
+            Physics::AddSimulationLOD(this);
+        else
+        {
+            Physics::RemoveSimulationLOD(this);
+            SetSimulationTier(PhysicsSimulationTier::Near);
+        }
+    }
+}
+
 void RigidBody::SetUpdateMassWhenScaleChanges(bool value)
 {
     _updateMassWhenScaleChanges = value;
@@ -239,6 +261,42 @@ void RigidBody::WakeUp() const
         PhysicsBackend::RigidDynamicActorWakeUp(_actor);
 }
 
+void RigidBody::SetSimulationTier(PhysicsSimulationTier tier)
+{
+    if (_simulationTier == tier)
+        return;
+    const PhysicsSimulationTier previous = _simulationTier;
+    _simulationTier = tier;
+    if (!_actor)
+        return;
+
+    // Restore the previous tier state
+    if (previous == PhysicsSimulationTier::Mid)
+    {
+        PhysicsBackend::SetRigidDynamicActorSolverIterationCounts(_actor, _lodPositionIters, _lodVelocityIters);
+    }
+    else if (previous == PhysicsSimulationTier::Far && _lodSleeping)
+    {
+        _lodSleeping = false;
+        WakeUp();
+    }
+
+    // Apply the new tier state
+    if (tier == PhysicsSimulationTier::Mid)
+    {
+        int32 minPositionIters, minVelocityIters;
+        PhysicsBackend::GetRigidDynamicActorSolverIterationCounts(_actor, minPositionIters, minVelocityIters);
+        _lodPositionIters = (uint8)minPositionIters;
+        _lodVelocityIters = (uint8)minVelocityIters;
+        PhysicsBackend::SetRigidDynamicActorSolverIterationCounts(_actor, 1, 1);
+    }
+    else if (tier == PhysicsSimulationTier::Far)
+    {
+        _lodSleeping = !IsSleeping();
+        Sleep();
+    }
+}
+
 void RigidBody::UpdateMass()
 {
     if (_actor)
@@ -411,6 +469,7 @@ void RigidBody::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_BIT_MEMBER(UseCCD, _useCCD);
     SERIALIZE_BIT_MEMBER(EnableGravity, _enableGravity);
     SERIALIZE_BIT_MEMBER(StartAwake, _startAwake);
+    SERIALIZE_BIT_MEMBER(UseSimulationLOD, _useSimulationLOD);
     SERIALIZE_BIT_MEMBER(UpdateMassWhenScaleChanges, _updateMassWhenScaleChanges);
 }
 
@@ -434,6 +493,7 @@ void RigidBody::Deserialize(DeserializeStream& stream, ISerializeModifier* modif
     DESERIALIZE_BIT_MEMBER(UseCCD, _useCCD);
     DESERIALIZE_BIT_MEMBER(EnableGravity, _enableGravity);
     DESERIALIZE_BIT_MEMBER(StartAwake, _startAwake);
+    DESERIALIZE_BIT_MEMBER(UseSimulationLOD, _useSimulationLOD);
     DESERIALIZE_BIT_MEMBER(UpdateMassWhenScaleChanges, _updateMassWhenScaleChanges);
 }
 
@@ -516,6 +576,8 @@ void RigidBody::BeginPlay(SceneBeginData* data)
 
     // Update cached data
     UpdateBounds();
+    if (_useSimulationLOD)
+        Physics::AddSimulationLOD(this);
 
     // Base
     Actor::BeginPlay(data);
@@ -528,6 +590,11 @@ void RigidBody::EndPlay()
 
     if (_actor)
     {
+        if (_useSimulationLOD)
+            Physics::RemoveSimulationLOD(this);
+        _simulationTier = PhysicsSimulationTier::Near;
+        _lodSleeping = false;
+
         // Remove actor
         void* scene = GetPhysicsScene()->GetPhysicsScene();
         PhysicsBackend::RemoveSceneActor(scene, _actor);
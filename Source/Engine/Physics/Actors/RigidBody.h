@@ -38,6 +38,11 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     uint32 _updateMassWhenScaleChanges : 1;
     uint32 _overrideMass : 1;
     uint32 _isUpdatingTransform : 1;
+    uint32 _useSimulationLOD : 1;
+    uint32 _lodSleeping : 1;
+    PhysicsSimulationTier _simulationTier;
+    uint8 _lodPositionIters;
+    uint8 _lodVelocityIters;
 
 public:
     /// <summary>
@@ -139,6 +144,28 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     /// </summary>
     API_PROPERTY() void SetStartAwake(bool value);
 
+    /// <summary>
+    /// If checked, the rigidbody will use the distance-based simulation level of detail (see Physics Settings) to reduce the simulation cost when it's far from the viewers.
+    /// </summary>
+    API_PROPERTY(Attributes="EditorOrder(55), DefaultValue(true), EditorDisplay(\"Rigid Body\", \"Use Simulation LOD\")")
+    FORCE_INLINE bool GetUseSimulationLOD() const
+    {
+        return _useSimulationLOD != 0;
+    }
+
+    /// <summary>
+    /// If checked, the rigidbody will use the distance-based simulation level of detail (see Physics Settings) to reduce the simulation cost when it's far from the viewers.
+    /// </summary>
+    API_PROPERTY() void SetUseSimulationLOD(bool value);
+
+    /// <summary>
+    /// Gets the current simulation tier of the rigidbody (based on the distance to the simulation LOD viewers).
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE PhysicsSimulationTier GetSimulationTier() const
+    {
+        return _simulationTier;
+    }
+
     /// <summary>
     /// If true, it will update mass when actor scale changes.
     /// </summary>
@@ -471,6 +498,12 @@ class FLAXENGINE_API RigidBody : public Actor, public IPhysicsActor
     /// </summary>
     void UpdateScale();
 
+    /// <summary>
+    /// Changes the simulation tier of the rigidbody (mid-range bodies use the minimal solver iterations, far bodies are put to sleep and woken up when they get closer). Called by the physics simulation LOD.
+    /// </summary>
+    /// <param name="tier">The simulation tier.</param>
+    void SetSimulationTier(PhysicsSimulationTier tier);
+
     template<typename ColliderType = Collider, typename AllocationType = HeapAllocation>
     void GetColliders(Array<ColliderType*, AllocationType>& result) const
     {
@@ -6,8 +6,80 @@
 #include "Engine/Physics/PhysicsBackend.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
 #define CC_MIN_SIZE 0.001f
+#define CC_BATCH_MAX_ITERATIONS 4
+#define CC_BATCH_MAX_HITS 16
+#define CC_BATCH_JOB_SIZE 32
+
+namespace
+{
+    struct CharacterMove
+    {
+        PhysicsScene* Scene;
+        const PhysicsColliderActor* Collider;
+        Vector3 Position;
+        Vector3 Displacement;
+        Vector3 Up;
+        Quaternion Rotation;
+        float Radius;
+        float Height;
+        float ContactOffset;
+        float SlopeLimitCos;
+        float MinMoveDistance;
+        uint32 LayerMask;
+        int32 Flags;
+    };
+
+    void SolveCharacterMove(CharacterMove& move)
+    {
+        RayCastHit hits[CC_BATCH_MAX_HITS];
+        Vector3 position = move.Position;
+        Vector3 remaining = move.Displacement;
+        int32 flags = 0;
+        for (int32 iteration = 0; iteration < CC_BATCH_MAX_ITERATIONS; iteration++)
+        {
+            const float distance = (float)remaining.Length();
+            if (distance <= Math::Max(move.MinMoveDistance, ZeroTolerance))
+                break;
+            const Vector3 direction = remaining / distance;
+
+            // Find the closest blocking hit (skip self and surfaces that we're moving away from)
+            const int32 count = move.Scene->CapsuleCastAll(position, move.Radius, move.Height, direction, Span<RayCastHit>(hits, CC_BATCH_MAX_HITS), move.Rotation, distance + move.ContactOffset, move.LayerMask, false);
+            const RayCastHit* closest = nullptr;
+            for (int32 i = 0; i < count; i++)
+            {
+                const RayCastHit& hit = hits[i];
+                if (hit.Collider == move.Collider || Vector3::Dot(hit.Normal, direction) >= 0.0f)
+                    continue;
+                if (!closest || hit.Distance < closest->Distance)
+                    closest = &hit;
+            }
+            if (!closest)
+            {
+                position += remaining;
+                break;
+            }
+
+            // Move up to the contact (keep the contact offset gap) and slide along the surface with the remaining displacement
+            const float travel = Math::Max(closest->Distance - move.ContactOffset, 0.0f);
+            position += direction * travel;
+            const float normalUp = (float)Vector3::Dot(closest->Normal, move.Up);
+            if (normalUp >= move.SlopeLimitCos)
+                flags |= (int32)CharacterController::CollisionFlags::Below;
+            else if (normalUp <= -move.SlopeLimitCos)
+                flags |= (int32)CharacterController::CollisionFlags::Above;
+            else
+                flags |= (int32)CharacterController::CollisionFlags::Sides;
+            remaining -= direction * travel;
+            remaining -= closest->Normal * Vector3::Dot(remaining, closest->Normal);
+        }
+        move.Position = position;
+        move.Flags = flags;
+    }
+}
 
 CharacterController::CharacterController(const SpawnParams& params)
     : Collider(params)
@@ -175,6 +247,71 @@ CharacterController::CollisionFlags CharacterController::Move(const Vector3& dis
     return result;
 }
 
+void CharacterController::MoveBatch(const Array<CharacterController*>& controllers, const Span<Vector3>& displacements, Array<CollisionFlags>& results)
+{
+    PROFILE_CPU();
+    const int32 count = controllers.Count();
+    ASSERT(displacements.Length() >= count);
+    results.Resize(count, false);
+
+    // Gather the characters state (on the calling thread)
+    Array<CharacterMove> moves;
+    moves.Resize(count, false);
+    for (int32 i = 0; i < count; i++)
+    {
+        const CharacterController* controller = controllers[i];
+        CharacterMove& move = moves[i];
+        move.Scene = nullptr;
+        move.Flags = 0;
+        if (!controller || !controller->_controller)
+            continue;
+        const float scaling = controller->_cachedScale.GetAbsolute().MaxValue();
+        move.Scene = controller->GetPhysicsScene();
+        move.Collider = controller;
+        move.Position = PhysicsBackend::GetControllerPosition(controller->_controller);
+        move.Displacement = displacements[i];
+        move.Up = PhysicsBackend::GetControllerUpDirection(controller->_controller);
+        move.Rotation = Quaternion::FindBetween(Float3::Right, move.Up); // Capsule shape is aligned along X axis
+        move.ContactOffset = Math::Max(controller->_contactOffset, ZeroTolerance);
+        move.Radius = Math::Max(Math::Abs(controller->_radius) * scaling - move.ContactOffset, CC_MIN_SIZE);
+        move.Height = Math::Max(Math::Abs(controller->_height) * scaling, CC_MIN_SIZE);
+        move.SlopeLimitCos = Math::Cos(controller->_slopeLimit * DegreesToRadians);
+        move.MinMoveDistance = controller->_minMoveDistance;
+        move.LayerMask = Physics::LayerMasks[controller->GetLayer()];
+    }
+
+    // Solve movement (scene queries are read-only so they can run in parallel)
+    CharacterMove* movesPtr = moves.Get();
+    Function<void(int32)> job = [movesPtr, count](int32 jobIndex)
+    {
+        PROFILE_CPU_NAMED("CharacterController.MoveBatch");
+        const int32 start = jobIndex * CC_BATCH_JOB_SIZE;
+        const int32 end = Math::Min(start + CC_BATCH_JOB_SIZE, count);
+        for (int32 i = start; i < end; i++)
+        {
+            if (movesPtr[i].Scene)
+                SolveCharacterMove(movesPtr[i]);
+        }
+    };
+    const int32 jobsCount = Math::DivideAndRoundUp(count, CC_BATCH_JOB_SIZE);
+    if (jobsCount > 1)
+        JobSystem::Wait(JobSystem::Dispatch(job, jobsCount));
+    else if (jobsCount == 1)
+        job(0);
+
+    // Apply the results (on the calling thread)
+    for (int32 i = 0; i < count; i++)
+    {
+        CharacterController* controller = controllers[i];
+        const CharacterMove& move = moves[i];
+        results[i] = (CollisionFlags)move.Flags;
+        if (!move.Scene)
+            continue;
+        controller->_lastFlags = results[i];
+        controller->SetPosition(move.Position - controller->_center);
+    }
+}
+
 #if USE_EDITOR
 
 #include "Engine/Debug/DebugDraw.h"
@@ -4,6 +4,7 @@
 
 #include "Collider.h"
 #include "Engine/Physics/Actors/IPhysicsActor.h"
+#include "Engine/Core/Types/Span.h"
 
 /// <summary>
 /// Physical objects that allows to easily do player movement constrained by collisions without having to deal with a rigidbody.
@@ -179,6 +180,14 @@ class FLAXENGINE_API CharacterController : public Collider, public IPhysicsActor
     /// <returns>The collision flags. It can be used to trigger various character animations.</returns>
     API_FUNCTION() CollisionFlags Move(const Vector3& displacement);
 
+    /// <summary>
+    /// Moves the multiple characters at once using a simplified kinematic capsule solver (collide-and-slide with scene sweeps that skips the character controller manager). Solving runs in parallel on Job System threads and the characters are moved to the new locations on the calling thread afterwards. Suited for large crowds of agents. Compared to Move it doesn't climb steps and moved characters don't collide with each other's new locations within a batch.
+    /// </summary>
+    /// <param name="controllers">The characters to move.</param>
+    /// <param name="displacements">The displacement vectors (in world units), one per character (in the same order).</param>
+    /// <param name="results">The output collision flags, one per character (in the same order).</param>
+    API_FUNCTION() static void MoveBatch(const Array<CharacterController*>& controllers, const Span<Vector3>& displacements, API_PARAM(Out) Array<CollisionFlags>& results);
+
 protected:
     /// <summary>
     /// Creates the physics actor.
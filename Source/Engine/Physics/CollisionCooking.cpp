@@ -9,6 +9,105 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Utilities/Crc.h"
+
+// Increment to invalidate all cached collision data (eg. on cooking logic change)
+#define COLLISION_COOKING_CACHE_VERSION 1
+
+namespace
+{
+    CriticalSection CacheLocker;
+
+    String GetCachePath(uint32 key)
+    {
+#if USE_EDITOR
+        const String folder = Globals::ProjectCacheFolder / TEXT("Collision");
+#else
+        const String folder = Globals::ProductLocalFolder / TEXT("Cache/Collision");
+#endif
+        return folder / String::Format(TEXT("{0:x}.bin"), key);
+    }
+}
+
+bool CollisionCooking::UseCache = true;
+
+uint32 CollisionCooking::GetCacheKey(CollisionDataType type, const void* data, int32 length, uint32 crc)
+{
+    const uint32 header[3] = { COLLISION_COOKING_CACHE_VERSION, (uint32)type, (uint32)length };
+    crc = Crc::MemCrc32(header, sizeof(header), crc);
+    return Crc::MemCrc32(data, length, crc);
+}
+
+uint32 CollisionCooking::GetCacheKey(CollisionDataType type, const CookingInput& input, uint32 crc)
+{
+    const int32 options[3] = { (int32)input.ConvexFlags, input.ConvexVertexLimit, input.IndexCount };
+    crc = Crc::MemCrc32(options, sizeof(options), crc);
+    if (input.IndexData && input.IndexCount != 0)
+    {
+        const int32 indexStride = input.Is16bitIndexData ? sizeof(uint16) : sizeof(uint32);
+        crc = Crc::MemCrc32(input.IndexData, input.IndexCount * indexStride, crc);
+    }
+    return GetCacheKey(type, input.VertexData, input.VertexCount * sizeof(Float3), crc);
+}
+
+bool CollisionCooking::LoadCache(uint32 key, BytesContainer& output)
+{
+    if (!UseCache)
+        return true;
+    PROFILE_CPU();
+    const String path = GetCachePath(key);
+    ScopeLock lock(CacheLocker);
+    if (!FileSystem::FileExists(path))
+        return true;
+    return File::ReadAllBytes(path, output) || output.IsInvalid();
+}
+
+void CollisionCooking::SaveCache(uint32 key, const void* data, int32 length)
+{
+    if (!UseCache || length <= 0)
+        return;
+    PROFILE_CPU();
+    const String path = GetCachePath(key);
+    ScopeLock lock(CacheLocker);
+    const String folder = StringUtils::GetDirectoryName(path);
+    if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+        return;
+    if (File::WriteAllBytes(path, (const byte*)data, length))
+    {
+        LOG(Warning, "Failed to save cooked collision cache to '{0}'", path);
+    }
+}
+
+bool CollisionCooking::CookMeshes(CollisionDataType type, Span<CookingInput> inputs, Span<BytesContainer> outputs)
+{
+    PROFILE_CPU();
+    CHECK_RETURN(inputs.Length() == outputs.Length(), true);
+    if (type != CollisionDataType::ConvexMesh && type != CollisionDataType::TriangleMesh)
+    {
+        LOG(Warning, "Invalid collision data type.");
+        return true;
+    }
+    if (inputs.Length() == 0)
+        return false;
+    int64 failed = 0;
+    Function<void(int32)> job = [type, &inputs, &outputs, &failed](int32 index)
+    {
+        const bool result = type == CollisionDataType::ConvexMesh ? CookConvexMesh(inputs[index], outputs[index]) : CookTriangleMesh(inputs[index], outputs[index]);
+        if (result)
+            Platform::AtomicStore(&failed, 1);
+    };
+    if (inputs.Length() == 1)
+        job(0);
+    else
+        JobSystem::Wait(JobSystem::Dispatch(job, inputs.Length()));
+    return Platform::AtomicRead(&failed) != 0;
+}
 
 bool CollisionCooking::CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData)
 {
@@ -30,6 +30,11 @@ class CollisionCooking
         int32 ConvexVertexLimit = 255;
     };
 
+    /// <summary>
+    /// Enables the persistent cache of the cooked collision data (stored in the project cache folder in Editor or in the local product folder in game). Cooked meshes are identified by the hash of the input data so the repeated cooking of the same geometry (eg. procedural meshes or collision cooked at runtime) loads the cached result instead.
+    /// </summary>
+    static bool UseCache;
+
     /// <summary>
     /// Collision data cooking input argument format.
     /// </summary>
@@ -62,6 +67,15 @@ class CollisionCooking
     /// <returns>True if failed, otherwise false.</returns>
     static bool CookTriangleMesh(CookingInput& input, BytesContainer& output);
 
+    /// <summary>
+    /// Cooks multiple convex or triangle meshes in parallel using Job System. Each input mesh is cooked into the output container at the same index.
+    /// </summary>
+    /// <param name="type">The collision data type (convex or triangle mesh).</param>
+    /// <param name="inputs">The inputs.</param>
+    /// <param name="outputs">The outputs (the same length as inputs).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    static bool CookMeshes(CollisionDataType type, Span<CookingInput> inputs, Span<BytesContainer> outputs);
+
     /// <summary>
     /// Cooks a heightfield. The results are written to the stream. To create a heightfield object there is an option to precompute some of calculations done while loading the heightfield data.
     /// </summary>
@@ -80,6 +94,42 @@ class CollisionCooking
     /// <param name="outputData">The output data container.</param>
     /// <returns>True if failed, otherwise false.</returns>
     static bool CookCollision(const Argument& arg, CollisionData::SerializedOptions& outputOptions, BytesContainer& outputData);
+
+public:
+    /// <summary>
+    /// Calculates the cooked data cache key for the given input data.
+    /// </summary>
+    /// <param name="type">The cooked data type.</param>
+    /// <param name="data">The input data.</param>
+    /// <param name="length">The input data length (in bytes).</param>
+    /// <param name="crc">The initial hash value (eg. hash of the cooking options or other input data).</param>
+    /// <returns>The cache key.</returns>
+    static uint32 GetCacheKey(CollisionDataType type, const void* data, int32 length, uint32 crc = 0);
+
+    /// <summary>
+    /// Calculates the cooked data cache key for the given mesh cooking input.
+    /// </summary>
+    /// <param name="type">The cooked data type.</param>
+    /// <param name="input">The input.</param>
+    /// <param name="crc">The initial hash value (eg. physics backend version).</param>
+    /// <returns>The cache key.</returns>
+    static uint32 GetCacheKey(CollisionDataType type, const CookingInput& input, uint32 crc = 0);
+
+    /// <summary>
+    /// Loads the cooked data from the cache.
+    /// </summary>
+    /// <param name="key">The cache key.</param>
+    /// <param name="output">The output data.</param>
+    /// <returns>True if failed (eg. data is not cached), otherwise false.</returns>
+    static bool LoadCache(uint32 key, BytesContainer& output);
+
+    /// <summary>
+    /// Saves the cooked data to the cache.
+    /// </summary>
+    /// <param name="key">The cache key.</param>
+    /// <param name="data">The cooked data.</param>
+    /// <param name="length">The cooked data length (in bytes).</param>
+    static void SaveCache(uint32 key, const void* data, int32 length);
 };
 
 #endif
@@ -100,3 +100,73 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API Collision
         Swap(ThisVelocity, OtherVelocity);
     }
 };
+
+/// <summary>
+/// The type of the buffered physics event.
+/// </summary>
+API_ENUM() enum class CollisionEventType : byte
+{
+    /// <summary>
+    /// The colliders started touching each other (see OnCollisionEnter).
+    /// </summary>
+    CollisionEnter,
+
+    /// <summary>
+    /// The colliders stopped touching each other (see OnCollisionExit).
+    /// </summary>
+    CollisionExit,
+
+    /// <summary>
+    /// The collider entered the trigger (see OnTriggerEnter).
+    /// </summary>
+    TriggerEnter,
+
+    /// <summary>
+    /// The collider exited the trigger (see OnTriggerExit).
+    /// </summary>
+    TriggerExit,
+};
+
+/// <summary>
+/// Contains a compact collision or trigger event information stored in the physics scene events buffer (see PhysicsScene.BufferEvents).
+/// </summary>
+API_STRUCT(NoDefault) struct FLAXENGINE_API CollisionEvent
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(CollisionEvent);
+
+    /// <summary>
+    /// The event type.
+    /// </summary>
+    API_FIELD() CollisionEventType Type;
+
+    /// <summary>
+    /// The first collider (the trigger for trigger events).
+    /// </summary>
+    API_FIELD() PhysicsColliderActor* First;
+
+    /// <summary>
+    /// The second collider (the other collider for trigger events).
+    /// </summary>
+    API_FIELD() PhysicsColliderActor* Second;
+
+    /// <summary>
+    /// The total impulse applied to the contact pair to resolve the collision. Zero for trigger events.
+    /// </summary>
+    API_FIELD() Vector3 Impulse;
+
+    /// <summary>
+    /// The location of the first contact point in the world space. Zero for trigger events or if collision has no contacts.
+    /// </summary>
+    API_FIELD() Vector3 Point;
+
+    /// <summary>
+    /// The normal of the first contact point. Zero for trigger events or if collision has no contacts.
+    /// </summary>
+    API_FIELD() Vector3 Normal;
+};
+
+template<>
+struct TIsPODType<CollisionEvent>
+{
+    enum { Value = true };
+};
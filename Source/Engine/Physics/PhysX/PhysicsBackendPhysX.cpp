@@ -24,6 +24,7 @@
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #include "Engine/Serialization/WriteStream.h"
 #include <ThirdParty/PhysX/PxPhysicsAPI.h>
 #include <ThirdParty/PhysX/PxQueryFiltering.h>
@@ -78,6 +79,21 @@ struct ActionDataPhysX
     PxActor* Actor;
 };
 
+#if COMPILE_WITH_PROFILER
+
+// Simulation stages measured with PhysX profile zones
+enum class SimulationStagePhysX
+{
+    BroadPhase,
+    NarrowPhase,
+    Solver,
+    CCD,
+    Callbacks,
+    MAX
+};
+
+#endif
+
 struct ScenePhysX
 {
     PxScene* Scene = nullptr;
@@ -101,6 +117,10 @@ struct ScenePhysX
     nv::cloth::Solver* ClothSolver = nullptr;
     Array<nv::cloth::Cloth*> ClothsList;
 #endif
+#if COMPILE_WITH_PROFILER
+    int64 StageCycles[(int32)SimulationStagePhysX::MAX] = {};
+    float StageTimes[(int32)SimulationStagePhysX::MAX] = {};
+#endif
 
 #if WITH_VEHICLE
     void UpdateVehicles(float dt);
@@ -117,6 +137,7 @@ class AllocatorPhysX : public PxAllocatorCallback
     void* allocate(size_t size, const char* typeName, const char* filename, int line) override
     {
         ASSERT(size < 1024 * 1024 * 1024); // Prevent invalid allocation size
+        PROFILE_MEM(Physics);
         return Allocator::Allocate(size, 16);
     }
 
@@ -146,6 +167,83 @@ class AssertPhysX : public nv::cloth::PxAssertHandler
     }
 };
 
+#if COMPILE_WITH_PROFILER
+
+#define PHYSX_PROFILER_MAX_DEPTH 32
+
+struct ProfilerZonePhysX
+{
+    uint64 StartCycles;
+    uint64 ChildrenCycles;
+    int32 Stage;
+    int32 EventIndex;
+};
+
+THREADLOCAL ProfilerZonePhysX ProfilerZones[PHYSX_PROFILER_MAX_DEPTH];
+THREADLOCAL int32 ProfilerZonesCount = 0;
+
+class ProfilerPhysX : public PxProfilerCallback
+{
+public:
+    static int32 GetStage(const char* eventName, int32 parentStage)
+    {
+        // Match the PhysX zone names (eg. 'Sim.broadPhase', 'Sim.updateCCDMultiPass', 'Basic.solve') into stages, nested zones without a match use the parent stage
+        if (StringUtils::FindIgnoreCase(eventName, "ccd"))
+            return (int32)SimulationStagePhysX::CCD;
+        if (StringUtils::FindIgnoreCase(eventName, "callback"))
+            return (int32)SimulationStagePhysX::Callbacks;
+        if (StringUtils::FindIgnoreCase(eventName, "broadphase"))
+            return (int32)SimulationStagePhysX::BroadPhase;
+        if (StringUtils::FindIgnoreCase(eventName, "narrowphase") || StringUtils::FindIgnoreCase(eventName, "collide"))
+            return (int32)SimulationStagePhysX::NarrowPhase;
+        if (StringUtils::FindIgnoreCase(eventName, "solve") || StringUtils::FindIgnoreCase(eventName, "integrat") || StringUtils::FindIgnoreCase(eventName, "dynamics"))
+            return (int32)SimulationStagePhysX::Solver;
+        return parentStage;
+    }
+
+    void* zoneStart(const char* eventName, bool detached, uint64_t contextId) override
+    {
+        // Detached zones can end on a different thread so skip them
+        if (detached || ProfilerZonesCount >= PHYSX_PROFILER_MAX_DEPTH)
+            return nullptr;
+        const int32 parentStage = ProfilerZonesCount != 0 ? ProfilerZones[ProfilerZonesCount - 1].Stage : -1;
+        ProfilerZonePhysX& zone = ProfilerZones[ProfilerZonesCount++];
+        zone.Stage = GetStage(eventName, parentStage);
+        zone.EventIndex = ProfilerCPU::BeginEvent(eventName);
+        zone.ChildrenCycles = 0;
+        zone.StartCycles = Platform::GetTimeCycles();
+        return nullptr;
+    }
+
+    void zoneEnd(void* profilerData, const char* eventName, bool detached, uint64_t contextId) override
+    {
+        if (detached || ProfilerZonesCount == 0)
+            return;
+        const ProfilerZonePhysX& zone = ProfilerZones[--ProfilerZonesCount];
+        const uint64 cycles = Platform::GetTimeCycles() - zone.StartCycles;
+        ProfilerCPU::EndEvent(zone.EventIndex);
+
+        // Count only the exclusive time of the zone (nested zones are counted separately)
+        if (ProfilerZonesCount != 0)
+            ProfilerZones[ProfilerZonesCount - 1].ChildrenCycles += cycles;
+        if (zone.Stage == -1 || cycles <= zone.ChildrenCycles)
+            return;
+
+        // PhysX uses the scene object address as a profiling context
+        for (auto e : Physics::Scenes)
+        {
+            auto scenePhysX = (ScenePhysX*)e->GetPhysicsScene();
+            if (scenePhysX && (uint64)(uintptr)scenePhysX->Scene == contextId)
+            {
+                Platform::InterlockedAdd(&scenePhysX->StageCycles[zone.Stage], (int64)(cycles - zone.ChildrenCycles));
+                break;
+            }
+        }
+    }
+};
+
+#else
+
 class ProfilerPhysX : public PxProfilerCallback
 {
 public:
@@ -159,6 +257,8 @@ class ProfilerPhysX : public PxProfilerCallback
     }
 };
 
+#endif
+
 struct FabricSettings
 {
     int32 Refs;
@@ -536,6 +636,21 @@ class DynamicHitBuffer : public PxHitCallback<HitType>
 			hitInfo = hit.shape ? static_cast<PhysicsColliderActor*>(hit.shape->userData) : nullptr; \
 		}
 
+#define SCENE_QUERY_COLLECT_SPAN() const int32 count = Math::Min((int32)buffer.getNbAnyHits(), results.Length()); \
+		for (int32 i = 0; i < count; i++) \
+		{ \
+			const auto& hit = buffer.getAnyHit(i); \
+			P2C(hit, results[i]); \
+			results[i].Point += scenePhysX->Origin; \
+		}
+
+#define SCENE_QUERY_COLLECT_OVERLAP_SPAN() const int32 count = Math::Min((int32)buffer.getNbTouches(), results.Length()); \
+		for (int32 i = 0; i < count; i++) \
+		{ \
+			const auto& hit = buffer.getTouch(i); \
+			results[i] = hit.shape ? static_cast<PhysicsColliderActor*>(hit.shape->userData) : nullptr; \
+		}
+
 #define SCENE_QUERY_COLLECT_OVERLAP_COLLIDER() results.Clear();  \
 		results.Resize(buffer.getNbTouches(), false); \
 		for (int32 i = 0; i < results.Count(); i++) \
@@ -560,8 +675,8 @@ namespace
     ErrorPhysX ErrorCallback;
 #if WITH_CLOTH
     AssertPhysX AssertCallback;
-    ProfilerPhysX ProfilerCallback;
 #endif
+    ProfilerPhysX ProfilerCallback;
     PxTolerancesScale ToleranceScale;
     QueryFilterPhysX QueryFilter;
     CharacterQueryFilterPhysX CharacterQueryFilter;
@@ -1510,12 +1625,16 @@ bool CollisionCooking::CookConvexMesh(CookingInput& input, BytesContainer& outpu
         desc.flags |= PxConvexFlag::Enum::eSHIFT_VERTICES;
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
-    // Perform cooking
+    // Try to reuse the cached result
+    const uint32 cacheKey = GetCacheKey(CollisionDataType::ConvexMesh, input, PX_PHYSICS_VERSION);
+    if (!LoadCache(cacheKey, output))
+        return false;
+
+    // Perform cooking (use local cooking params to support cooking from multiple threads at once)
     PxDefaultMemoryOutputStream outputStream;
     PxConvexMeshCookingResult::Enum result;
-    if (!cooking->cookConvexMesh(desc, outputStream, &result))
+    if (!PxCookConvexMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Convex Mesh cooking failed. Error code: {0}, Input vertices count: {1}", (int32)result, input.VertexCount);
         return true;
@@ -1523,6 +1642,7 @@ bool CollisionCooking::CookConvexMesh(CookingInput& input, BytesContainer& outpu
 
     // Copy result
     output.Copy(outputStream.getData(), outputStream.getSize());
+    SaveCache(cacheKey, outputStream.getData(), outputStream.getSize());
 
     return false;
 }
@@ -1545,12 +1665,16 @@ bool CollisionCooking::CookTriangleMesh(CookingInput& input, BytesContainer& out
     desc.flags = input.Is16bitIndexData ? PxMeshFlag::e16_BIT_INDICES : (PxMeshFlag::Enum)0;
     PxCookingParams cookingParams = cooking->getParams();
     cookingParams.suppressTriangleMeshRemapTable = EnumHasAnyFlags(input.ConvexFlags, ConvexMeshGenerationFlags::SuppressFaceRemapTable);
-    cooking->setParams(cookingParams);
 
-    // Perform cooking
+    // Try to reuse the cached result
+    const uint32 cacheKey = GetCacheKey(CollisionDataType::TriangleMesh, input, PX_PHYSICS_VERSION);
+    if (!LoadCache(cacheKey, output))
+        return false;
+
+    // Perform cooking (use local cooking params to support cooking from multiple threads at once)
     PxDefaultMemoryOutputStream outputStream;
     PxTriangleMeshCookingResult::Enum result;
-    if (!cooking->cookTriangleMesh(desc, outputStream, &result))
+    if (!PxCookTriangleMesh(cookingParams, desc, outputStream, &result))
     {
         LOG(Warning, "Triangle Mesh cooking failed. Error code: {0}, Input vertices count: {1}, indices count: {2}", (int32)result, input.VertexCount, input.IndexCount);
         return true;
@@ -1558,6 +1682,7 @@ bool CollisionCooking::CookTriangleMesh(CookingInput& input, BytesContainer& out
 
     // Copy result
     output.Copy(outputStream.getData(), outputStream.getSize());
+    SaveCache(cacheKey, outputStream.getData(), outputStream.getSize());
 
     return false;
 }
@@ -1577,7 +1702,7 @@ bool CollisionCooking::CookHeightField(int32 cols, int32 rows, const PhysicsBack
 
     WriteStreamPhysX outputStream;
     outputStream.Stream = &stream;
-    if (!Cooking->cookHeightField(heightFieldDesc, outputStream))
+    if (!PxCookHeightField(heightFieldDesc, outputStream))
     {
         LOG(Warning, "Height Field collision cooking failed.");
         return true;
@@ -1633,6 +1758,9 @@ bool PhysicsBackend::Init()
     LOG(Info, "Setup NVIDIA PhysX {0}.{1}.{2}", PX_PHYSICS_VERSION_MAJOR, PX_PHYSICS_VERSION_MINOR, PX_PHYSICS_VERSION_BUGFIX);
     Foundation = PxCreateFoundation(PX_PHYSICS_VERSION, AllocatorCallback, ErrorCallback);
     CHECK_INIT(Foundation, "PxCreateFoundation failed!");
+#if COMPILE_WITH_PROFILER
+    PxSetProfilerCallback(&ProfilerCallback);
+#endif
 
     // Init debugger
     PxPvd* pvd = nullptr;
@@ -1939,10 +2067,28 @@ void PhysicsBackend::EndSimulateScene(void* scene)
 
     {
         PROFILE_CPU_NAMED("Physics.SendEvents");
+#if COMPILE_WITH_PROFILER
+        const uint64 sendEventsStart = Platform::GetTimeCycles();
+#endif
+        if (scenePhysX->EventsCallback.EventsBuffer)
+            scenePhysX->EventsCallback.EventsBuffer->Clear();
         scenePhysX->EventsCallback.SendTriggerEvents();
         scenePhysX->EventsCallback.SendCollisionEvents();
         scenePhysX->EventsCallback.SendJointEvents();
+#if COMPILE_WITH_PROFILER
+        scenePhysX->StageCycles[(int32)SimulationStagePhysX::Callbacks] += (int64)(Platform::GetTimeCycles() - sendEventsStart);
+#endif
+    }
+
+#if COMPILE_WITH_PROFILER
+    // Publish the simulation stages timings
+    const double cyclesToMs = 1000.0 / (double)Platform::GetClockFrequency();
+    for (int32 i = 0; i < (int32)SimulationStagePhysX::MAX; i++)
+    {
+        scenePhysX->StageTimes[i] = (float)((double)scenePhysX->StageCycles[i] * cyclesToMs);
+        scenePhysX->StageCycles[i] = 0;
     }
+#endif
 
     // Clear delta after simulation ended
     scenePhysX->LastDeltaTime = 0.0f;
@@ -2030,6 +2176,12 @@ void PhysicsBackend::SetSceneOrigin(void* scene, const Vector3& oldOrigin, const
     SceneOrigins[scenePhysX->Scene] = newOrigin;
 }
 
+void PhysicsBackend::SetSceneEventsBuffer(void* scene, Array<CollisionEvent>* buffer)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    scenePhysX->EventsCallback.EventsBuffer = buffer;
+}
+
 void PhysicsBackend::AddSceneActor(void* scene, void* actor)
 {
     auto scenePhysX = (ScenePhysX*)scene;
@@ -2079,6 +2231,11 @@ void PhysicsBackend::GetSceneStatistics(void* scene, PhysicsStatistics& result)
     result.LostPairs = px.nbLostPairs;
     result.NewTouches = px.nbNewTouches;
     result.LostTouches = px.nbLostTouches;
+    result.BroadPhaseTime = scenePhysX->StageTimes[(int32)SimulationStagePhysX::BroadPhase];
+    result.NarrowPhaseTime = scenePhysX->StageTimes[(int32)SimulationStagePhysX::NarrowPhase];
+    result.SolverTime = scenePhysX->StageTimes[(int32)SimulationStagePhysX::Solver];
+    result.CCDTime = scenePhysX->StageTimes[(int32)SimulationStagePhysX::CCD];
+    result.CallbacksTime = scenePhysX->StageTimes[(int32)SimulationStagePhysX::Callbacks];
 }
 
 #endif
@@ -2110,6 +2267,16 @@ bool PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector
     return true;
 }
 
+int32 PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP(false);
+    DynamicHitBuffer<PxRaycastHit> buffer;
+    if (!scenePhysX->Scene->raycast(C2P(origin - scenePhysX->Origin), C2P(direction), maxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::BoxCast(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_SWEEP_1();
@@ -2140,6 +2307,17 @@ bool PhysicsBackend::BoxCastAll(void* scene, const Vector3& center, const Vector
     return true;
 }
 
+int32 PhysicsBackend::BoxCastAll(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_SWEEP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxBoxGeometry geometry(C2P(halfExtents));
+    if (!scenePhysX->Scene->sweep(geometry, pose, C2P(direction), maxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::SphereCast(void* scene, const Vector3& center, const float radius, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_SWEEP_1();
@@ -2170,6 +2348,17 @@ bool PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const flo
     return true;
 }
 
+int32 PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const float radius, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_SWEEP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin));
+    const PxSphereGeometry geometry(radius);
+    if (!scenePhysX->Scene->sweep(geometry, pose, C2P(direction), maxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::CapsuleCast(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_SWEEP_1();
@@ -2200,6 +2389,17 @@ bool PhysicsBackend::CapsuleCastAll(void* scene, const Vector3& center, const fl
     return true;
 }
 
+int32 PhysicsBackend::CapsuleCastAll(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_SWEEP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxCapsuleGeometry geometry(radius, height * 0.5f);
+    if (!scenePhysX->Scene->sweep(geometry, pose, C2P(direction), maxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::ConvexCast(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN(convexMesh && convexMesh->GetOptions().Type == CollisionDataType::ConvexMesh, false)
@@ -2233,6 +2433,18 @@ bool PhysicsBackend::ConvexCastAll(void* scene, const Vector3& center, const Col
     return true;
 }
 
+int32 PhysicsBackend::ConvexCastAll(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN(convexMesh && convexMesh->GetOptions().Type == CollisionDataType::ConvexMesh, 0)
+    SCENE_QUERY_SETUP_SWEEP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxConvexMeshGeometry geometry((PxConvexMesh*)convexMesh->GetConvex(), PxMeshScale(C2P(scale)));
+    if (!scenePhysX->Scene->sweep(geometry, pose, C2P(direction), maxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::CheckBox(void* scene, const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_OVERLAP_1();
@@ -2322,6 +2534,17 @@ bool PhysicsBackend::OverlapBox(void* scene, const Vector3& center, const Vector
     return true;
 }
 
+int32 PhysicsBackend::OverlapBox(void* scene, const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_OVERLAP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxBoxGeometry geometry(C2P(halfExtents));
+    if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_OVERLAP_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::OverlapSphere(void* scene, const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_OVERLAP();
@@ -2333,6 +2556,17 @@ bool PhysicsBackend::OverlapSphere(void* scene, const Vector3& center, const flo
     return true;
 }
 
+int32 PhysicsBackend::OverlapSphere(void* scene, const Vector3& center, const float radius, Span<PhysicsColliderActor*> results, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_OVERLAP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin));
+    const PxSphereGeometry geometry(radius);
+    if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_OVERLAP_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::OverlapCapsule(void* scene, const Vector3& center, const float radius, const float height, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     SCENE_QUERY_SETUP_OVERLAP();
@@ -2344,6 +2578,17 @@ bool PhysicsBackend::OverlapCapsule(void* scene, const Vector3& center, const fl
     return true;
 }
 
+int32 PhysicsBackend::OverlapCapsule(void* scene, const Vector3& center, const float radius, const float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    SCENE_QUERY_SETUP_OVERLAP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxCapsuleGeometry geometry(radius, height * 0.5f);
+    if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_OVERLAP_SPAN();
+    return count;
+}
+
 bool PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN(convexMesh && convexMesh->GetOptions().Type == CollisionDataType::ConvexMesh, false)
@@ -2356,6 +2601,86 @@ bool PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const Col
     return true;
 }
 
+int32 PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN(convexMesh && convexMesh->GetOptions().Type == CollisionDataType::ConvexMesh, 0)
+    SCENE_QUERY_SETUP_OVERLAP();
+    const PxTransform pose(C2P(center - scenePhysX->Origin), C2P(rotation));
+    const PxConvexMeshGeometry geometry((PxConvexMesh*)convexMesh->GetConvex(), PxMeshScale(C2P(scale)));
+    if (!scenePhysX->Scene->overlap(geometry, pose, buffer, filterData, &QueryFilter))
+        return 0;
+    SCENE_QUERY_COLLECT_OVERLAP_SPAN();
+    return count;
+}
+
+void PhysicsBackend::QueryBatch(void* scene, const SceneQuery* queries, RayCastHit* results, int32 count)
+{
+    auto scenePhysX = (ScenePhysX*)scene;
+    Platform::MemoryClear(results, count * sizeof(RayCastHit));
+    if (scene == nullptr)
+        return;
+    PxQueryFilterData filterData;
+    filterData.flags |= PxQueryFlag::ePREFILTER;
+    for (int32 i = 0; i < count; i++)
+    {
+        const SceneQuery& query = queries[i];
+        RayCastHit& hitInfo = results[i];
+        const PxTransform pose(C2P(query.Origin - scenePhysX->Origin), C2P(query.Rotation));
+        filterData.data.word0 = query.LayerMask;
+        filterData.data.word1 = query.Type < SceneQueryType::OverlapSphere ? 1 : 0;
+        filterData.data.word2 = query.HitTriggers ? 1 : 0;
+        switch (query.Type)
+        {
+        case SceneQueryType::RayCast:
+        {
+            PxRaycastBuffer buffer;
+            if (scenePhysX->Scene->raycast(pose.p, C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter))
+            {
+                SCENE_QUERY_COLLECT_SINGLE();
+            }
+            break;
+        }
+        case SceneQueryType::SphereCast:
+        case SceneQueryType::BoxCast:
+        case SceneQueryType::CapsuleCast:
+        {
+            PxSweepBufferN<1> buffer;
+            bool hasHit;
+            if (query.Type == SceneQueryType::SphereCast)
+                hasHit = scenePhysX->Scene->sweep(PxSphereGeometry(query.Radius), PxTransform(pose.p), C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter);
+            else if (query.Type == SceneQueryType::BoxCast)
+                hasHit = scenePhysX->Scene->sweep(PxBoxGeometry(C2P(query.HalfExtents)), pose, C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter);
+            else
+                hasHit = scenePhysX->Scene->sweep(PxCapsuleGeometry(query.Radius, query.Height * 0.5f), pose, C2P(query.Direction), query.MaxDistance, buffer, SCENE_QUERY_FLAGS, filterData, &QueryFilter);
+            if (hasHit)
+            {
+                SCENE_QUERY_COLLECT_SINGLE();
+            }
+            break;
+        }
+        case SceneQueryType::OverlapSphere:
+        case SceneQueryType::OverlapBox:
+        case SceneQueryType::OverlapCapsule:
+        {
+            PxOverlapBufferN<1> buffer;
+            bool hasHit;
+            if (query.Type == SceneQueryType::OverlapSphere)
+                hasHit = scenePhysX->Scene->overlap(PxSphereGeometry(query.Radius), PxTransform(pose.p), buffer, filterData, &QueryFilter);
+            else if (query.Type == SceneQueryType::OverlapBox)
+                hasHit = scenePhysX->Scene->overlap(PxBoxGeometry(C2P(query.HalfExtents)), pose, buffer, filterData, &QueryFilter);
+            else
+                hasHit = scenePhysX->Scene->overlap(PxCapsuleGeometry(query.Radius, query.Height * 0.5f), pose, buffer, filterData, &QueryFilter);
+            if (hasHit && buffer.getNbAnyHits() != 0)
+            {
+                const auto& hit = buffer.getAnyHit(0);
+                hitInfo.Collider = hit.shape ? static_cast<PhysicsColliderActor*>(hit.shape->userData) : nullptr;
+            }
+            break;
+        }
+        }
+    }
+}
+
 PhysicsBackend::ActorFlags PhysicsBackend::GetActorFlags(void* actor)
 {
     auto actorPhysX = (PxActor*)actor;
@@ -2586,6 +2911,15 @@ void PhysicsBackend::SetRigidDynamicActorMaxDepenetrationVelocity(void* actor, f
     actorPhysX->setMaxDepenetrationVelocity(value);
 }
 
+void PhysicsBackend::GetRigidDynamicActorSolverIterationCounts(void* actor, int32& minPositionIters, int32& minVelocityIters)
+{
+    auto actorPhysX = (PxRigidDynamic*)actor;
+    PxU32 positionIters, velocityIters;
+    actorPhysX->getSolverIterationCounts(positionIters, velocityIters);
+    minPositionIters = (int32)positionIters;
+    minVelocityIters = (int32)velocityIters;
+}
+
 void PhysicsBackend::SetRigidDynamicActorSolverIterationCounts(void* actor, int32 minPositionIters, int32 minVelocityIters)
 {
     auto actorPhysX = (PxRigidDynamic*)actor;
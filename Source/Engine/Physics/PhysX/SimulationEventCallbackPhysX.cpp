@@ -25,6 +25,26 @@ namespace
             }
         }
     }
+
+    void AddCollisionEvent(Array<CollisionEvent>& buffer, CollisionEventType type, const Collision& c)
+    {
+        auto& e = buffer.AddOne();
+        e.Type = type;
+        e.First = c.ThisActor;
+        e.Second = c.OtherActor;
+        e.Impulse = c.Impulse;
+        e.Point = c.ContactsCount != 0 ? c.Contacts[0].Point : Vector3::Zero;
+        e.Normal = c.ContactsCount != 0 ? c.Contacts[0].Normal : Vector3::Zero;
+    }
+
+    void AddTriggerEvent(Array<CollisionEvent>& buffer, CollisionEventType type, const SimulationEventCallback::CollidersPair& c)
+    {
+        auto& e = buffer.AddOne();
+        e.Type = type;
+        e.First = c.First;
+        e.Second = c.Second;
+        e.Impulse = e.Point = e.Normal = Vector3::Zero;
+    }
 }
 
 void SimulationEventCallback::Clear()
@@ -40,6 +60,14 @@ void SimulationEventCallback::Clear()
 
 void SimulationEventCallback::SendCollisionEvents()
 {
+    if (EventsBuffer)
+    {
+        for (const auto& c : RemovedCollisions)
+            AddCollisionEvent(*EventsBuffer, CollisionEventType::CollisionExit, c);
+        for (const auto& c : NewCollisions)
+            AddCollisionEvent(*EventsBuffer, CollisionEventType::CollisionEnter, c);
+        return;
+    }
     for (auto& c : RemovedCollisions)
     {
         c.ThisActor->OnCollisionExit(c);
@@ -58,6 +86,14 @@ void SimulationEventCallback::SendCollisionEvents()
 
 void SimulationEventCallback::SendTriggerEvents()
 {
+    if (EventsBuffer)
+    {
+        for (const auto& c : LostTriggerPairs)
+            AddTriggerEvent(*EventsBuffer, CollisionEventType::TriggerExit, c);
+        for (const auto& c : NewTriggerPairs)
+            AddTriggerEvent(*EventsBuffer, CollisionEventType::TriggerEnter, c);
+        return;
+    }
     for (const auto& c : LostTriggerPairs)
     {
         c.First->OnTriggerExit(c.Second);
@@ -82,6 +118,15 @@ void SimulationEventCallback::OnColliderRemoved(PhysicsColliderActor* collider)
 {
     ClearColliderFromCollection(collider, NewTriggerPairs);
     ClearColliderFromCollection(collider, LostTriggerPairs);
+    if (EventsBuffer)
+    {
+        for (int32 i = EventsBuffer->Count() - 1; i >= 0; i--)
+        {
+            const CollisionEvent& e = EventsBuffer->At(i);
+            if (e.First == collider || e.Second == collider)
+                EventsBuffer->RemoveAt(i);
+        }
+    }
 }
 
 void SimulationEventCallback::OnJointRemoved(Joint* joint)
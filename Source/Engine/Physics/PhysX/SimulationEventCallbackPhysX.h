@@ -43,6 +43,11 @@ class SimulationEventCallback : public PxSimulationEventCallback
     /// </summary>
     Array<Joint*> BrokenJoints;
 
+    /// <summary>
+    /// The output buffer for the collision and trigger events. If set, events are stored in it instead of being sent to the colliders.
+    /// </summary>
+    Array<CollisionEvent>* EventsBuffer = nullptr;
+
 public:
     /// <summary>
     /// Clears the data.
@@ -6,15 +6,33 @@
 #include "PhysicalMaterial.h"
 #include "PhysicsSettings.h"
 #include "PhysicsStatistics.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Core/Math/Ray.h"
 #include "Engine/Engine/Time.h"
+#include "Engine/Level/Actor.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Physics/Actors/RigidBody.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+
+// The maximum amount of scene queries to perform by a single job in a batch
+#define PHYSICS_QUERY_BATCH_JOB_SIZE 64
 
 PhysicsScene* Physics::DefaultScene = nullptr;
 Array<PhysicsScene*> Physics::Scenes;
 uint32 Physics::LayerMasks[32];
+bool Physics::AsyncSimulation = false;
+Array<Vector3> Physics::SimulationLODViewers;
+
+namespace
+{
+    Array<RigidBody*> SimulationLODBodies;
+    Array<Vector3> SimulationLODViewersCache;
+}
 
 class PhysicsService : public EngineService
 {
@@ -27,6 +45,7 @@ class PhysicsService : public EngineService
     }
 
     bool Init() override;
+    void FixedUpdate() override;
     void LateUpdate() override;
     void Dispose() override;
 };
@@ -37,6 +56,7 @@ void PhysicsSettings::Apply()
 {
     Time::_physicsMaxDeltaTime = MaxDeltaTime;
     Platform::MemoryCopy(Physics::LayerMasks, LayerMasks, sizeof(LayerMasks));
+    Physics::AsyncSimulation = AsyncSimulation;
     Physics::SetGravity(DefaultGravity);
     Physics::SetBounceThresholdVelocity(BounceThresholdVelocity);
     Physics::SetEnableCCD(!DisableCCD);
@@ -63,7 +83,11 @@ void PhysicsSettings::Deserialize(DeserializeStream& stream, ISerializeModifier*
     DESERIALIZE(EnableSubstepping);
     DESERIALIZE(SubstepDeltaTime);
     DESERIALIZE(MaxSubsteps);
+    DESERIALIZE(AsyncSimulation);
     DESERIALIZE(QueriesHitTriggers);
+    DESERIALIZE(EnableSimulationLOD);
+    DESERIALIZE(SimulationLODMidDistance);
+    DESERIALIZE(SimulationLODFarDistance);
     DESERIALIZE(SupportCookingAtRuntime);
 
     const auto layers = stream.FindMember("LayerMasks");
@@ -95,6 +119,41 @@ bool PhysicsService::Init()
     return Physics::DefaultScene == nullptr;
 }
 
+void PhysicsService::FixedUpdate()
+{
+    if (SimulationLODBodies.IsEmpty())
+        return;
+    PROFILE_CPU_NAMED("Physics.SimulationLOD");
+
+    // Gather viewers
+    const auto& settings = *PhysicsSettings::Get();
+    SimulationLODViewersCache.Clear();
+    if (settings.EnableSimulationLOD)
+    {
+        if (Physics::SimulationLODViewers.HasItems())
+            SimulationLODViewersCache.Add(Physics::SimulationLODViewers);
+        else if (const Camera* camera = Camera::GetMainCamera())
+            SimulationLODViewersCache.Add(camera->GetPosition());
+    }
+
+    // Update bodies simulation tiers (no viewers means full simulation)
+    const Real midDistanceSqr = Math::Square((Real)settings.SimulationLODMidDistance);
+    const Real farDistanceSqr = Math::Square((Real)settings.SimulationLODFarDistance);
+    for (RigidBody* rigidBody : SimulationLODBodies)
+    {
+        PhysicsSimulationTier tier = PhysicsSimulationTier::Near;
+        if (SimulationLODViewersCache.HasItems())
+        {
+            const Real distanceSqr = Physics::GetSimulationLODDistanceSquared(rigidBody->GetPosition());
+            if (distanceSqr >= farDistanceSqr)
+                tier = PhysicsSimulationTier::Far;
+            else if (distanceSqr >= midDistanceSqr)
+                tier = PhysicsSimulationTier::Mid;
+        }
+        rigidBody->SetSimulationTier(tier);
+    }
+}
+
 void PhysicsService::LateUpdate()
 {
     Physics::FlushRequests();
@@ -115,6 +174,8 @@ void PhysicsService::Dispose()
     }
     Physics::Scenes.Resize(0);
     Physics::DefaultScene = nullptr;
+    SimulationLODBodies.Resize(0);
+    SimulationLODViewersCache.Resize(0);
 
     // Dispose backend
     PhysicsBackend::Shutdown();
@@ -149,6 +210,91 @@ PhysicsScene* Physics::FindScene(const StringView& name)
     return nullptr;
 }
 
+PhysicsScene* Physics::FindShard(const Vector3& position)
+{
+    for (PhysicsScene* scene : Scenes)
+    {
+        if (scene->GetShardBounds().Contains(position) != ContainmentType::Disjoint)
+            return scene;
+    }
+    return nullptr;
+}
+
+bool Physics::MigrateToShard(Actor* actor)
+{
+    CHECK_RETURN(actor, false);
+    PhysicsScene* shard = FindShard(actor->GetPosition());
+    if (shard == nullptr || shard == actor->GetPhysicsScene())
+        return false;
+    actor->SetPhysicsScene(shard);
+    return true;
+}
+
+bool Physics::RayCastShards(const Vector3& origin, const Vector3& direction, RayCastHit& hitInfo, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
+    const Ray ray(origin, direction);
+    bool hasHit = false;
+    RayCastHit hit;
+    for (PhysicsScene* scene : Scenes)
+    {
+        Real distance;
+        if (!scene->GetShardBounds().Intersects(ray, distance) || distance > maxDistance)
+            continue;
+        if (scene->RayCast(origin, direction, hit, maxDistance, layerMask, hitTriggers) && (!hasHit || hit.Distance < hitInfo.Distance))
+        {
+            hitInfo = hit;
+            hasHit = true;
+        }
+    }
+    return hasHit;
+}
+
+bool Physics::OverlapSphereShards(const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
+{
+    results.Clear();
+    const BoundingSphere sphere(center, radius);
+    Array<PhysicsColliderActor*> shardResults;
+    for (PhysicsScene* scene : Scenes)
+    {
+        if (scene->GetShardBounds().Intersects(sphere) && scene->OverlapSphere(center, radius, shardResults, layerMask, hitTriggers))
+            results.Add(shardResults);
+    }
+    return results.HasItems();
+}
+
+bool Physics::OverlapBoxShards(const Vector3& center, const Vector3& halfExtents, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    results.Clear();
+    BoundingBox box;
+    OrientedBoundingBox(halfExtents, Transform(center, rotation)).GetBoundingBox(box);
+    Array<PhysicsColliderActor*> shardResults;
+    for (PhysicsScene* scene : Scenes)
+    {
+        if (scene->GetShardBounds().Intersects(box) && scene->OverlapBox(center, halfExtents, shardResults, rotation, layerMask, hitTriggers))
+            results.Add(shardResults);
+    }
+    return results.HasItems();
+}
+
+Real Physics::GetSimulationLODDistanceSquared(const Vector3& position)
+{
+    Real result = MAX_Real;
+    for (const Vector3& viewer : SimulationLODViewersCache)
+        result = Math::Min(result, Vector3::DistanceSquared(position, viewer));
+    return result;
+}
+
+void Physics::AddSimulationLOD(RigidBody* rigidBody)
+{
+    SimulationLODBodies.Add(rigidBody);
+}
+
+void Physics::RemoveSimulationLOD(RigidBody* rigidBody)
+{
+    SimulationLODBodies.Remove(rigidBody);
+}
+
 bool Physics::GetAutoSimulation()
 {
     return !DefaultScene || DefaultScene->GetAutoSimulation();
@@ -251,6 +397,12 @@ bool Physics::RayCastAll(const Vector3& origin, const Vector3& direction, Array<
     return DefaultScene->RayCastAll(origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::RayCastAll(const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return DefaultScene->RayCastAll(origin, direction, results, maxDistance, layerMask, hitTriggers);
+}
+
 bool Physics::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -269,6 +421,12 @@ bool Physics::BoxCastAll(const Vector3& center, const Vector3& halfExtents, cons
     return DefaultScene->BoxCastAll(center, halfExtents, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return DefaultScene->BoxCastAll(center, halfExtents, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool Physics::SphereCast(const Vector3& center, const float radius, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -287,6 +445,12 @@ bool Physics::SphereCastAll(const Vector3& center, const float radius, const Vec
     return DefaultScene->SphereCastAll(center, radius, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::SphereCastAll(const Vector3& center, const float radius, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return DefaultScene->SphereCastAll(center, radius, direction, results, maxDistance, layerMask, hitTriggers);
+}
+
 bool Physics::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -305,6 +469,12 @@ bool Physics::CapsuleCastAll(const Vector3& center, const float radius, const fl
     return DefaultScene->CapsuleCastAll(center, radius, height, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::CapsuleCastAll(const Vector3& center, const float radius, const float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return DefaultScene->CapsuleCastAll(center, radius, height, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool Physics::ConvexCast(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -323,6 +493,12 @@ bool Physics::ConvexCastAll(const Vector3& center, const CollisionData* convexMe
     return DefaultScene->ConvexCastAll(center, convexMesh, scale, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 Physics::ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return DefaultScene->ConvexCastAll(center, convexMesh, scale, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool Physics::CheckBox(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->CheckBox(center, halfExtents, rotation, layerMask, hitTriggers);
@@ -368,21 +544,51 @@ bool Physics::OverlapBox(const Vector3& center, const Vector3& halfExtents, Arra
     return DefaultScene->OverlapBox(center, halfExtents, results, rotation, layerMask, hitTriggers);
 }
 
+int32 Physics::OverlapBox(const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->OverlapBox(center, halfExtents, results, rotation, layerMask, hitTriggers);
+}
+
 bool Physics::OverlapSphere(const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->OverlapSphere(center, radius, results, layerMask, hitTriggers);
 }
 
+int32 Physics::OverlapSphere(const Vector3& center, const float radius, Span<PhysicsColliderActor*> results, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->OverlapSphere(center, radius, results, layerMask, hitTriggers);
+}
+
 bool Physics::OverlapCapsule(const Vector3& center, const float radius, const float height, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->OverlapCapsule(center, radius, height, results, rotation, layerMask, hitTriggers);
 }
 
+int32 Physics::OverlapCapsule(const Vector3& center, const float radius, const float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->OverlapCapsule(center, radius, height, results, rotation, layerMask, hitTriggers);
+}
+
 bool Physics::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return DefaultScene->OverlapConvex(center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
 }
 
+int32 Physics::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return DefaultScene->OverlapConvex(center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
+}
+
+void Physics::QueryBatch(const Span<SceneQuery>& queries, Span<RayCastHit> results, bool useJobs)
+{
+    DefaultScene->QueryBatch(queries, results, useJobs);
+}
+
+void Physics::QueryBatch(const Span<SceneQuery>& queries, Array<RayCastHit>& results, bool useJobs)
+{
+    DefaultScene->QueryBatch(queries, results, useJobs);
+}
+
 PhysicsScene::PhysicsScene(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -467,7 +673,11 @@ bool PhysicsScene::Init(const StringView& name, const PhysicsSettings& settings)
     }
     _name = name;
     _scene = PhysicsBackend::CreateScene(settings);
-    return _scene == nullptr;
+    if (_scene == nullptr)
+        return true;
+    if (_bufferEvents)
+        PhysicsBackend::SetSceneEventsBuffer(_scene, &_events);
+    return false;
 }
 
 void PhysicsScene::Simulate(float dt)
@@ -489,6 +699,18 @@ void PhysicsScene::CollectResults()
     ASSERT(IsInMainThread());
     PhysicsBackend::EndSimulateScene(_scene);
     _isDuringSimulation = false;
+    if (_bufferEvents && _events.HasItems())
+        EventsBuffered(this);
+}
+
+void PhysicsScene::SetBufferEvents(bool value)
+{
+    if (_bufferEvents == value)
+        return;
+    _bufferEvents = value;
+    _events.Clear();
+    if (_scene)
+        PhysicsBackend::SetSceneEventsBuffer(_scene, value ? &_events : nullptr);
 }
 
 bool PhysicsScene::LineCast(const Vector3& start, const Vector3& end, uint32 layerMask, bool hitTriggers)
@@ -536,6 +758,12 @@ bool PhysicsScene::RayCastAll(const Vector3& origin, const Vector3& direction, A
     return PhysicsBackend::RayCastAll(_scene, origin, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::RayCastAll(const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return PhysicsBackend::RayCastAll(_scene, origin, direction, results, maxDistance, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::BoxCast(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -554,6 +782,12 @@ bool PhysicsScene::BoxCastAll(const Vector3& center, const Vector3& halfExtents,
     return PhysicsBackend::BoxCastAll(_scene, center, halfExtents, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return PhysicsBackend::BoxCastAll(_scene, center, halfExtents, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::SphereCast(const Vector3& center, const float radius, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -572,6 +806,12 @@ bool PhysicsScene::SphereCastAll(const Vector3& center, const float radius, cons
     return PhysicsBackend::SphereCastAll(_scene, center, radius, direction, results, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::SphereCastAll(const Vector3& center, const float radius, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return PhysicsBackend::SphereCastAll(_scene, center, radius, direction, results, maxDistance, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::CapsuleCast(const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -590,6 +830,12 @@ bool PhysicsScene::CapsuleCastAll(const Vector3& center, const float radius, con
     return PhysicsBackend::CapsuleCastAll(_scene, center, radius, height, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::CapsuleCastAll(const Vector3& center, const float radius, const float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return PhysicsBackend::CapsuleCastAll(_scene, center, radius, height, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::ConvexCast(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     CHECK_RETURN_DEBUG(direction.IsNormalized(), false);
@@ -608,6 +854,12 @@ bool PhysicsScene::ConvexCastAll(const Vector3& center, const CollisionData* con
     return PhysicsBackend::ConvexCastAll(_scene, center, convexMesh, scale, direction, results, rotation, maxDistance, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    CHECK_RETURN_DEBUG(direction.IsNormalized(), 0);
+    return PhysicsBackend::ConvexCastAll(_scene, center, convexMesh, scale, direction, results, rotation, maxDistance, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::CheckBox(const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::CheckBox(_scene, center, halfExtents, rotation, layerMask, hitTriggers);
@@ -653,17 +905,68 @@ bool PhysicsScene::OverlapBox(const Vector3& center, const Vector3& halfExtents,
     return PhysicsBackend::OverlapBox(_scene, center, halfExtents, results, rotation, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::OverlapBox(const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return PhysicsBackend::OverlapBox(_scene, center, halfExtents, results, rotation, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::OverlapSphere(const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::OverlapSphere(_scene, center, radius, results, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::OverlapSphere(const Vector3& center, const float radius, Span<PhysicsColliderActor*> results, uint32 layerMask, bool hitTriggers)
+{
+    return PhysicsBackend::OverlapSphere(_scene, center, radius, results, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::OverlapCapsule(const Vector3& center, const float radius, const float height, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::OverlapCapsule(_scene, center, radius, height, results, rotation, layerMask, hitTriggers);
 }
 
+int32 PhysicsScene::OverlapCapsule(const Vector3& center, const float radius, const float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return PhysicsBackend::OverlapCapsule(_scene, center, radius, height, results, rotation, layerMask, hitTriggers);
+}
+
 bool PhysicsScene::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return PhysicsBackend::OverlapConvex(_scene, center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
 }
+
+int32 PhysicsScene::OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return PhysicsBackend::OverlapConvex(_scene, center, convexMesh, scale, results, rotation, layerMask, hitTriggers);
+}
+
+void PhysicsScene::QueryBatch(const Span<SceneQuery>& queries, Span<RayCastHit> results, bool useJobs)
+{
+    PROFILE_CPU();
+    const int32 count = queries.Length();
+    ASSERT(results.Length() >= count);
+    if (!useJobs || count <= PHYSICS_QUERY_BATCH_JOB_SIZE)
+    {
+        PhysicsBackend::QueryBatch(_scene, queries.Get(), results.Get(), count);
+        return;
+    }
+
+    // Split the batch into jobs (scene queries are read-only so they can run in parallel)
+    void* scene = _scene;
+    const SceneQuery* queriesPtr = queries.Get();
+    RayCastHit* resultsPtr = results.Get();
+    Function<void(int32)> job = [scene, queriesPtr, resultsPtr, count](int32 jobIndex)
+    {
+        PROFILE_CPU_NAMED("Physics.QueryBatch");
+        const int32 start = jobIndex * PHYSICS_QUERY_BATCH_JOB_SIZE;
+        const int32 end = Math::Min(start + PHYSICS_QUERY_BATCH_JOB_SIZE, count);
+        PhysicsBackend::QueryBatch(scene, queriesPtr + start, resultsPtr + start, end - start);
+    };
+    JobSystem::Wait(JobSystem::Dispatch(job, Math::DivideAndRoundUp(count, PHYSICS_QUERY_BATCH_JOB_SIZE)));
+}
+
+void PhysicsScene::QueryBatch(const Span<SceneQuery>& queries, Array<RayCastHit>& results, bool useJobs)
+{
+    results.Resize(queries.Length(), false);
+    QueryBatch(queries, Span<RayCastHit>(results.Get(), results.Count()), useJobs);
+}
@@ -4,6 +4,10 @@
 
 #include "Engine/Core/Math/Quaternion.h"
 #include "Types.h"
+#include "Engine/Core/Types/Span.h"
+
+class Actor;
+class RigidBody;
 
 /// <summary>
 /// Physics simulation system.
@@ -32,6 +36,56 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// </summary>
     API_FUNCTION() static PhysicsScene* FindScene(const StringView& name);
 
+public:
+    /// <summary>
+    /// Finds the physics scene shard that contains the given location (see PhysicsScene.ShardBounds). All scenes are simulated in parallel so the world can be spatially partitioned into multiple scenes.
+    /// </summary>
+    /// <param name="position">The location in the world.</param>
+    /// <returns>The found shard or null if location is outside all shards.</returns>
+    API_FUNCTION() static PhysicsScene* FindShard(const Vector3& position);
+
+    /// <summary>
+    /// Moves the actor (with all children) into the physics scene shard that contains the actor location. Can be called after the object crosses the shard boundary. Doesn't change the scene if the location is outside all shards.
+    /// </summary>
+    /// <param name="actor">The actor to migrate.</param>
+    /// <returns>True if actor was moved into a different scene, otherwise false.</returns>
+    API_FUNCTION() static bool MigrateToShard(Actor* actor);
+
+    /// <summary>
+    /// Performs a raycast against objects in all physics scene shards the ray passes through, returns the closest hit.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The normalized direction of the ray.</param>
+    /// <param name="hitInfo">The result hit info. Valid only when method returns true.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>True if ray hits an matching object, otherwise false.</returns>
+    API_FUNCTION() static bool RayCastShards(const Vector3& origin, const Vector3& direction, API_PARAM(Out) RayCastHit& hitInfo, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Finds all colliders touching or inside of the given sphere in all physics scene shards that overlap with it.
+    /// </summary>
+    /// <param name="center">The sphere center.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    /// <param name="results">The result colliders that overlap with the given sphere. Valid only when method returns true.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>True if sphere overlaps any matching object, otherwise false.</returns>
+    API_FUNCTION() static bool OverlapSphereShards(const Vector3& center, float radius, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Finds all colliders touching or inside of the given box in all physics scene shards that overlap with it.
+    /// </summary>
+    /// <param name="center">The box center.</param>
+    /// <param name="halfExtents">The half size of the box in each direction.</param>
+    /// <param name="results">The result colliders that overlap with the given box. Valid only when method returns true.</param>
+    /// <param name="rotation">The box rotation.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>True if box overlaps any matching object, otherwise false.</returns>
+    API_FUNCTION() static bool OverlapBoxShards(const Vector3& center, const Vector3& halfExtents, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
 public:
     /// <summary>
     /// The automatic simulation feature. True if perform physics simulation after on fixed update by auto, otherwise user should do it.
@@ -72,6 +126,30 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// The collision layers masks. Used to define layer-based collision detection.
     /// </summary>
     static uint32 LayerMasks[32];
+
+    /// <summary>
+    /// The asynchronous simulation mode. If enabled, the physics simulation step is started after the frame rendering and runs in the background until the next update (or fixed update) that collects its results.
+    /// </summary>
+    API_FIELD() static bool AsyncSimulation;
+
+    /// <summary>
+    /// The locations of the viewers used by the distance-based simulation level of detail (eg. players positions on a server). If empty, the main camera location is used.
+    /// </summary>
+    API_FIELD() static Array<Vector3, HeapAllocation> SimulationLODViewers;
+
+    /// <summary>
+    /// Gets the squared distance from the location to the closest simulation LOD viewer. Returns MAX_Real if simulation LOD is disabled or there are no viewers.
+    /// </summary>
+    /// <param name="position">The location in the world.</param>
+    /// <returns>The squared distance to the closest viewer.</returns>
+    static Real GetSimulationLODDistanceSquared(const Vector3& position);
+
+    // Registers the rigidbody to be updated by the distance-based simulation level of detail.
+    static void AddSimulationLOD(RigidBody* rigidBody);
+
+    // Unregisters the rigidbody from the distance-based simulation level of detail.
+    static void RemoveSimulationLOD(RigidBody* rigidBody);
+
 public:
     /// <summary>
     /// Called during main engine loop to start physic simulation. Use CollectResults after.
@@ -162,6 +240,18 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a raycast against objects in the scene, returns results in a RayCastHit structure.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The normalized direction of the ray.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 RayCastAll(const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
@@ -203,6 +293,20 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if box hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a box geometry.
+    /// </summary>
+    /// <param name="center">The box center.</param>
+    /// <param name="halfExtents">The half size of the box in each direction.</param>
+    /// <param name="direction">The normalized direction in which cast a box.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The box rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a sphere geometry.
     /// </summary>
@@ -241,6 +345,19 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if sphere hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool SphereCastAll(const Vector3& center, float radius, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a sphere geometry.
+    /// </summary>
+    /// <param name="center">The sphere center.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    /// <param name="direction">The normalized direction in which cast a sphere.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 SphereCastAll(const Vector3& center, float radius, const Vector3& direction, Span<RayCastHit> results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a capsule geometry.
     /// </summary>
@@ -285,6 +402,21 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if capsule hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool CapsuleCastAll(const Vector3& center, float radius, float height, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a capsule geometry.
+    /// </summary>
+    /// <param name="center">The capsule center.</param>
+    /// <param name="radius">The radius of the capsule.</param>
+    /// <param name="height">The height of the capsule, excluding the top and bottom spheres.</param>
+    /// <param name="direction">The normalized direction in which cast a capsule.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The capsule rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 CapsuleCastAll(const Vector3& center, float radius, float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a convex mesh.
     /// </summary>
@@ -329,6 +461,21 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if convex mesh hits an matching object, otherwise false.</returns>
     API_FUNCTION() static bool ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a convex mesh.
+    /// </summary>
+    /// <param name="center">The convex mesh center.</param>
+    /// <param name="convexMesh">Collision data of the convex mesh.</param>
+    /// <param name="scale">The scale of the convex mesh.</param>
+    /// <param name="direction">The normalized direction in which cast a convex mesh.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The convex mesh rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Checks whether the given box overlaps with other colliders or not.
     /// </summary>
@@ -435,6 +582,18 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if box overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapBox(const Vector3& center, const Vector3& halfExtents, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given box.
+    /// </summary>
+    /// <param name="center">The box center.</param>
+    /// <param name="halfExtents">The half size of the box in each direction.</param>
+    /// <param name="rotation">The box rotation.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 OverlapBox(const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given sphere.
     /// </summary>
@@ -446,6 +605,17 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if sphere overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapSphere(const Vector3& center, float radius, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given sphere.
+    /// </summary>
+    /// <param name="center">The sphere center.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 OverlapSphere(const Vector3& center, float radius, Span<PhysicsColliderActor*> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given capsule.
     /// </summary>
@@ -459,6 +629,19 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <returns>True if capsule overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapCapsule(const Vector3& center, float radius, float height, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given capsule.
+    /// </summary>
+    /// <param name="center">The capsule center.</param>
+    /// <param name="radius">The radius of the capsule.</param>
+    /// <param name="height">The height of the capsule, excluding the top and bottom spheres.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The capsule rotation.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 OverlapCapsule(const Vector3& center, float radius, float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given convex mesh.
     /// </summary>
@@ -471,4 +654,33 @@ API_CLASS(Static) class FLAXENGINE_API Physics
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() static bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Finds all colliders touching or inside of the given convex mesh.
+    /// </summary>
+    /// <param name="center">The convex mesh center.</param>
+    /// <param name="convexMesh">Collision data of the convex mesh.</param>
+    /// <param name="scale">The scale of the convex mesh.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The convex mesh rotation.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    static int32 OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs the batch of the scene queries (raycasts, sweeps and overlaps) in a single call. Each query writes a single result (closest hit for casts, any overlapping collider for overlaps; results with null Collider indicate no hit). Large batches can be executed in parallel on Job System workers.
+    /// </summary>
+    /// <param name="queries">The queries to perform.</param>
+    /// <param name="results">The output results (one per query, in the same order). Must be at least as big as queries.</param>
+    /// <param name="useJobs">If set to <c>true</c> large batches will be split into jobs and executed on Job System threads, otherwise all queries will be performed on the calling thread.</param>
+    static void QueryBatch(const Span<SceneQuery>& queries, Span<RayCastHit> results, bool useJobs = true);
+
+    /// <summary>
+    /// Performs the batch of the scene queries (raycasts, sweeps and overlaps) in a single call. Each query writes a single result (closest hit for casts, any overlapping collider for overlaps; results with null Collider indicate no hit). Large batches can be executed in parallel on Job System workers.
+    /// </summary>
+    /// <param name="queries">The queries to perform.</param>
+    /// <param name="results">The output results (one per query, in the same order).</param>
+    /// <param name="useJobs">If set to <c>true</c> large batches will be split into jobs and executed on Job System threads, otherwise all queries will be performed on the calling thread.</param>
+    API_FUNCTION() static void QueryBatch(const Span<SceneQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, bool useJobs = true);
 };
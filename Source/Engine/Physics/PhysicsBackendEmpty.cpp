@@ -111,6 +111,10 @@ void PhysicsBackend::SetSceneOrigin(void* scene, const Vector3& oldOrigin, const
 {
 }
 
+void PhysicsBackend::SetSceneEventsBuffer(void* scene, Array<CollisionEvent>* buffer)
+{
+}
+
 void PhysicsBackend::AddSceneActor(void* scene, void* actor)
 {
 }
@@ -146,6 +150,11 @@ bool PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector
     return false;
 }
 
+int32 PhysicsBackend::RayCastAll(void* scene, const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::BoxCast(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -161,6 +170,11 @@ bool PhysicsBackend::BoxCastAll(void* scene, const Vector3& center, const Vector
     return false;
 }
 
+int32 PhysicsBackend::BoxCastAll(void* scene, const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::SphereCast(void* scene, const Vector3& center, const float radius, const Vector3& direction, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -176,6 +190,11 @@ bool PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const flo
     return false;
 }
 
+int32 PhysicsBackend::SphereCastAll(void* scene, const Vector3& center, const float radius, const Vector3& direction, Span<RayCastHit> results, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::CapsuleCast(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -191,6 +210,11 @@ bool PhysicsBackend::CapsuleCastAll(void* scene, const Vector3& center, const fl
     return false;
 }
 
+int32 PhysicsBackend::CapsuleCastAll(void* scene, const Vector3& center, const float radius, const float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::ConvexCast(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -206,6 +230,11 @@ bool PhysicsBackend::ConvexCastAll(void* scene, const Vector3& center, const Col
     return false;
 }
 
+int32 PhysicsBackend::ConvexCastAll(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation, const float maxDistance, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::CheckBox(void* scene, const Vector3& center, const Vector3& halfExtents, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return false;
@@ -251,21 +280,46 @@ bool PhysicsBackend::OverlapBox(void* scene, const Vector3& center, const Vector
     return false;
 }
 
+int32 PhysicsBackend::OverlapBox(void* scene, const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::OverlapSphere(void* scene, const Vector3& center, const float radius, Array<PhysicsColliderActor*>& results, uint32 layerMask, bool hitTriggers)
 {
     return false;
 }
 
+int32 PhysicsBackend::OverlapSphere(void* scene, const Vector3& center, const float radius, Span<PhysicsColliderActor*> results, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::OverlapCapsule(void* scene, const Vector3& center, const float radius, const float height, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return false;
 }
 
+int32 PhysicsBackend::OverlapCapsule(void* scene, const Vector3& center, const float radius, const float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
 bool PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Array<PhysicsColliderActor*>& results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
 {
     return false;
 }
 
+int32 PhysicsBackend::OverlapConvex(void* scene, const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation, uint32 layerMask, bool hitTriggers)
+{
+    return 0;
+}
+
+void PhysicsBackend::QueryBatch(void* scene, const SceneQuery* queries, RayCastHit* results, int32 count)
+{
+    Platform::MemoryClear(results, count * sizeof(RayCastHit));
+}
+
 PhysicsBackend::ActorFlags PhysicsBackend::GetActorFlags(void* actor)
 {
     return ActorFlags::None;
@@ -388,6 +442,12 @@ void PhysicsBackend::SetRigidDynamicActorMaxDepenetrationVelocity(void* actor, f
 {
 }
 
+void PhysicsBackend::GetRigidDynamicActorSolverIterationCounts(void* actor, int32& minPositionIters, int32& minVelocityIters)
+{
+    minPositionIters = 4;
+    minVelocityIters = 1;
+}
+
 void PhysicsBackend::SetRigidDynamicActorSolverIterationCounts(void* actor, int32 minPositionIters, int32 minVelocityIters)
 {
 }
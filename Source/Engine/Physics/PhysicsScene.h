@@ -4,8 +4,13 @@
 
 #include "Engine/Core/Math/Vector3.h"
 #include "Engine/Core/Math/Quaternion.h"
+#include "Engine/Core/Math/BoundingBox.h"
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Types.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Delegate.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Collisions.h"
 
 struct ActionData;
 struct RayCastHit;
@@ -29,6 +34,9 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     bool _autoSimulation = true;
     bool _isDuringSimulation = false;
     Vector3 _origin = Vector3::Zero;
+    BoundingBox _shardBounds = BoundingBox::Empty;
+    bool _bufferEvents = false;
+    Array<CollisionEvent> _events;
     void* _scene = nullptr;
 
 public:
@@ -100,6 +108,48 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// </summary>
     API_PROPERTY() void SetOrigin(const Vector3& value);
 
+    /// <summary>
+    /// Gets the world region simulated by this scene when used as a shard of the spatially partitioned physics world (see Physics.FindShard). Empty bounds (default) exclude the scene from sharding.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE BoundingBox GetShardBounds() const
+    {
+        return _shardBounds;
+    }
+
+    /// <summary>
+    /// Sets the world region simulated by this scene when used as a shard of the spatially partitioned physics world (see Physics.FindShard). Empty bounds (default) exclude the scene from sharding.
+    /// </summary>
+    API_PROPERTY() void SetShardBounds(const BoundingBox& value)
+    {
+        _shardBounds = value;
+    }
+
+    /// <summary>
+    /// Gets the collision events buffering mode. When enabled, the collision and trigger events are not sent to the colliders (OnCollisionEnter, OnTriggerEnter, etc.) but stored in a flat buffer (see BufferedEvents) that can be processed once per simulation step (see EventsBuffered). Reduces overhead of scenes with many contacts.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE bool GetBufferEvents() const
+    {
+        return _bufferEvents;
+    }
+
+    /// <summary>
+    /// Sets the collision events buffering mode. When enabled, the collision and trigger events are not sent to the colliders (OnCollisionEnter, OnTriggerEnter, etc.) but stored in a flat buffer (see BufferedEvents) that can be processed once per simulation step (see EventsBuffered). Reduces overhead of scenes with many contacts.
+    /// </summary>
+    API_PROPERTY() void SetBufferEvents(bool value);
+
+    /// <summary>
+    /// Gets the collision and trigger events from the last simulation step (valid only when using BufferEvents mode). Buffer is overriden by the next simulation.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE const Array<CollisionEvent>& GetBufferedEvents() const
+    {
+        return _events;
+    }
+
+    /// <summary>
+    /// Occurs after the simulation step results were collected when using BufferEvents mode and there are any buffered events. Called once per step with all events (see BufferedEvents).
+    /// </summary>
+    API_EVENT() Delegate<PhysicsScene*> EventsBuffered;
+
 #if COMPILE_WITH_PROFILER
     /// <summary>
     /// Gets the physics simulation statistics for the scene.
@@ -200,6 +250,18 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if ray hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool RayCastAll(const Vector3& origin, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a raycast against objects in the scene, returns results in a RayCastHit structure.
+    /// </summary>
+    /// <param name="origin">The origin of the ray.</param>
+    /// <param name="direction">The normalized direction of the ray.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 RayCastAll(const Vector3& origin, const Vector3& direction, Span<RayCastHit> results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a box geometry.
     /// </summary>
@@ -241,6 +303,20 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if box hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a box geometry.
+    /// </summary>
+    /// <param name="center">The box center.</param>
+    /// <param name="halfExtents">The half size of the box in each direction.</param>
+    /// <param name="direction">The normalized direction in which cast a box.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The box rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 BoxCastAll(const Vector3& center, const Vector3& halfExtents, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a sphere geometry.
     /// </summary>
@@ -279,6 +355,19 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if sphere hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool SphereCastAll(const Vector3& center, float radius, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a sphere geometry.
+    /// </summary>
+    /// <param name="center">The sphere center.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    /// <param name="direction">The normalized direction in which cast a sphere.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 SphereCastAll(const Vector3& center, float radius, const Vector3& direction, Span<RayCastHit> results, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a capsule geometry.
     /// </summary>
@@ -323,6 +412,21 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if capsule hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool CapsuleCastAll(const Vector3& center, float radius, float height, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a capsule geometry.
+    /// </summary>
+    /// <param name="center">The capsule center.</param>
+    /// <param name="radius">The radius of the capsule.</param>
+    /// <param name="height">The height of the capsule, excluding the top and bottom spheres.</param>
+    /// <param name="direction">The normalized direction in which cast a capsule.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The capsule rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 CapsuleCastAll(const Vector3& center, float radius, float height, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Performs a sweep test against objects in the scene using a convex mesh.
     /// </summary>
@@ -367,6 +471,21 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if convex mesh hits an matching object, otherwise false.</returns>
     API_FUNCTION() bool ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Performs a sweep test against objects in the scene using a convex mesh.
+    /// </summary>
+    /// <param name="center">The convex mesh center.</param>
+    /// <param name="convexMesh">Collision data of the convex mesh.</param>
+    /// <param name="scale">The scale of the convex mesh.</param>
+    /// <param name="direction">The normalized direction in which cast a convex mesh.</param>
+    /// <param name="results">The result hits buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The convex mesh rotation.</param>
+    /// <param name="maxDistance">The maximum distance the ray should check for collisions.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 ConvexCastAll(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, const Vector3& direction, Span<RayCastHit> results, const Quaternion& rotation = Quaternion::Identity, float maxDistance = MAX_float, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Checks whether the given box overlaps with other colliders or not.
     /// </summary>
@@ -473,6 +592,18 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if box overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapBox(const Vector3& center, const Vector3& halfExtents, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given box.
+    /// </summary>
+    /// <param name="center">The box center.</param>
+    /// <param name="halfExtents">The half size of the box in each direction.</param>
+    /// <param name="rotation">The box rotation.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 OverlapBox(const Vector3& center, const Vector3& halfExtents, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given sphere.
     /// </summary>
@@ -484,6 +615,17 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if sphere overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapSphere(const Vector3& center, float radius, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given sphere.
+    /// </summary>
+    /// <param name="center">The sphere center.</param>
+    /// <param name="radius">The radius of the sphere.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 OverlapSphere(const Vector3& center, float radius, Span<PhysicsColliderActor*> results, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given capsule.
     /// </summary>
@@ -497,6 +639,19 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <returns>True if capsule overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapCapsule(const Vector3& center, float radius, float height, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
 
+    /// <summary>
+    /// Finds all colliders touching or inside of the given capsule.
+    /// </summary>
+    /// <param name="center">The capsule center.</param>
+    /// <param name="radius">The radius of the capsule.</param>
+    /// <param name="height">The height of the capsule, excluding the top and bottom spheres.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The capsule rotation.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 OverlapCapsule(const Vector3& center, float radius, float height, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
     /// <summary>
     /// Finds all colliders touching or inside of the given convex mesh.
     /// </summary>
@@ -509,4 +664,33 @@ API_CLASS() class FLAXENGINE_API PhysicsScene : public ScriptingObject
     /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
     /// <returns>True if convex mesh overlaps any matching object, otherwise false.</returns>
     API_FUNCTION() bool OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, API_PARAM(Out) Array<PhysicsColliderActor*, HeapAllocation>& results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Finds all colliders touching or inside of the given convex mesh.
+    /// </summary>
+    /// <param name="center">The convex mesh center.</param>
+    /// <param name="convexMesh">Collision data of the convex mesh.</param>
+    /// <param name="scale">The scale of the convex mesh.</param>
+    /// <param name="results">The result colliders buffer (caller-owned). Query writes up to the buffer length results.</param>
+    /// <param name="rotation">The convex mesh rotation.</param>
+    /// <param name="layerMask">The layer mask used to filter the results.</param>
+    /// <param name="hitTriggers">If set to <c>true</c> triggers will be hit, otherwise will skip them.</param>
+    /// <returns>The amount of results written to the buffer (0 if nothing was hit).</returns>
+    int32 OverlapConvex(const Vector3& center, const CollisionData* convexMesh, const Vector3& scale, Span<PhysicsColliderActor*> results, const Quaternion& rotation = Quaternion::Identity, uint32 layerMask = MAX_uint32, bool hitTriggers = true);
+
+    /// <summary>
+    /// Performs the batch of the scene queries (raycasts, sweeps and overlaps) in a single call. Each query writes a single result (closest hit for casts, any overlapping collider for overlaps; results with null Collider indicate no hit). Large batches can be executed in parallel on Job System workers.
+    /// </summary>
+    /// <param name="queries">The queries to perform.</param>
+    /// <param name="results">The output results (one per query, in the same order). Must be at least as big as queries.</param>
+    /// <param name="useJobs">If set to <c>true</c> large batches will be split into jobs and executed on Job System threads, otherwise all queries will be performed on the calling thread.</param>
+    void QueryBatch(const Span<SceneQuery>& queries, Span<RayCastHit> results, bool useJobs = true);
+
+    /// <summary>
+    /// Performs the batch of the scene queries (raycasts, sweeps and overlaps) in a single call. Each query writes a single result (closest hit for casts, any overlapping collider for overlaps; results with null Collider indicate no hit). Large batches can be executed in parallel on Job System workers.
+    /// </summary>
+    /// <param name="queries">The queries to perform.</param>
+    /// <param name="results">The output results (one per query, in the same order).</param>
+    /// <param name="useJobs">If set to <c>true</c> large batches will be split into jobs and executed on Job System threads, otherwise all queries will be performed on the calling thread.</param>
+    API_FUNCTION() void QueryBatch(const Span<SceneQuery>& queries, API_PARAM(Out) Array<RayCastHit, HeapAllocation>& results, bool useJobs = true);
 };
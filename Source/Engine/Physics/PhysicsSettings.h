@@ -130,6 +130,12 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1020), EditorDisplay(\"Framerate\")")
     int32 MaxSubsteps = 5;
 
+    /// <summary>
+    /// Enables the asynchronous simulation mode. The physics simulation step runs in the background after the frame rendering (eg. while waiting for the next frame) and its results are collected on the next update, which removes the physics from the main thread critical path at the cost of a single step of latency.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1030), EditorDisplay(\"Framerate\")")
+    bool AsyncSimulation = false;
+
     /// <summary>
     /// Enables support for cooking physical collision shapes geometry at runtime. Use it to enable generating runtime terrain collision or convex mesh colliders.
     /// </summary>
@@ -148,6 +154,24 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings", NoConstructor) class
     API_FIELD(Attributes="EditorOrder(1200), EditorDisplay(\"Other\")")
     bool QueriesHitTriggers = true;
 
+    /// <summary>
+    /// Enables the distance-based simulation level of detail for rigidbodies (including vehicles and ragdolls) and cloths. Bodies far from the viewers (see Physics.SimulationLODViewers or main camera) are simulated with reduced quality or put to sleep.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1300), EditorDisplay(\"Simulation LOD\", \"Enable Simulation LOD\")")
+    bool EnableSimulationLOD = false;
+
+    /// <summary>
+    /// The distance from the closest viewer at which bodies enter the mid-range simulation tier (reduced solver iterations).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1310), Limit(0), EditorDisplay(\"Simulation LOD\", \"Mid Distance\"), VisibleIf(nameof(EnableSimulationLOD))")
+    float SimulationLODMidDistance = 5000.0f;
+
+    /// <summary>
+    /// The distance from the closest viewer at which bodies enter the far simulation tier (put to sleep until they get closer).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(1320), Limit(0), EditorDisplay(\"Simulation LOD\", \"Far Distance\"), VisibleIf(nameof(EnableSimulationLOD))")
+    float SimulationLODFarDistance = 20000.0f;
+
     /// <summary>
     /// The collision layers masks. Used to define layer-based collision detection.
     /// </summary>
@@ -32,6 +32,16 @@ API_STRUCT(NoDefault) struct FLAXENGINE_API PhysicsStatistics
     API_FIELD() uint32 NewTouches;
     // Number of lost touches during this frame.
     API_FIELD() uint32 LostTouches;
+    // Time spent in the broad phase during the last simulation (in milliseconds, summed over all threads).
+    API_FIELD() float BroadPhaseTime;
+    // Time spent in the narrow phase (contacts generation) during the last simulation (in milliseconds, summed over all threads).
+    API_FIELD() float NarrowPhaseTime;
+    // Time spent in the constraints solver and bodies integration during the last simulation (in milliseconds, summed over all threads).
+    API_FIELD() float SolverTime;
+    // Time spent in the continuous collision detection during the last simulation (in milliseconds, summed over all threads).
+    API_FIELD() float CCDTime;
+    // Time spent in the simulation callbacks and sending the physics events during the last simulation (in milliseconds, summed over all threads).
+    API_FIELD() float CallbacksTime;
 
     PhysicsStatistics()
     {
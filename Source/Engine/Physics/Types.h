@@ -5,6 +5,7 @@
 #include "Engine/Core/Config.h"
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Math/Quaternion.h"
 #include "Engine/Scripting/ScriptingType.h"
 
 struct PhysicsStatistics;
@@ -130,6 +131,27 @@ API_ENUM(Attributes="Flags") enum class RigidbodyConstraints
 
 DECLARE_ENUM_OPERATORS(RigidbodyConstraints);
 
+/// <summary>
+/// The distance-based physics simulation tier (level of detail) of the body.
+/// </summary>
+API_ENUM() enum class PhysicsSimulationTier : byte
+{
+    /// <summary>
+    /// Body is close to the viewers and it's simulated with full quality.
+    /// </summary>
+    Near,
+
+    /// <summary>
+    /// Body is in the mid-range and it's simulated with reduced solver quality.
+    /// </summary>
+    Mid,
+
+    /// <summary>
+    /// Body is far from the viewers and it's put to sleep (frozen until it gets closer or touched by other awake body).
+    /// </summary>
+    Far,
+};
+
 /// <summary>
 /// Raycast hit result data.
 /// </summary>
@@ -174,6 +196,105 @@ API_STRUCT(NoDefault) struct RayCastHit
     API_FIELD() Float2 UV;
 };
 
+/// <summary>
+/// The type of the physics scene query used by the batched queries.
+/// </summary>
+API_ENUM() enum class SceneQueryType : byte
+{
+    /// <summary>
+    /// Raycast (uses Origin, Direction and MaxDistance). Returns the closest hit.
+    /// </summary>
+    RayCast,
+
+    /// <summary>
+    /// Sphere sweep (uses Origin, Radius, Direction and MaxDistance). Returns the closest hit.
+    /// </summary>
+    SphereCast,
+
+    /// <summary>
+    /// Box sweep (uses Origin, HalfExtents, Rotation, Direction and MaxDistance). Returns the closest hit.
+    /// </summary>
+    BoxCast,
+
+    /// <summary>
+    /// Capsule sweep (uses Origin, Radius, Height, Rotation, Direction and MaxDistance). Returns the closest hit.
+    /// </summary>
+    CapsuleCast,
+
+    /// <summary>
+    /// Sphere overlap (uses Origin and Radius). Returns any overlapping collider (only Collider of the hit result is valid).
+    /// </summary>
+    OverlapSphere,
+
+    /// <summary>
+    /// Box overlap (uses Origin, HalfExtents and Rotation). Returns any overlapping collider (only Collider of the hit result is valid).
+    /// </summary>
+    OverlapBox,
+
+    /// <summary>
+    /// Capsule overlap (uses Origin, Radius, Height and Rotation). Returns any overlapping collider (only Collider of the hit result is valid).
+    /// </summary>
+    OverlapCapsule,
+};
+
+/// <summary>
+/// The physics scene query descriptor used by the batched queries (see Physics.QueryBatch).
+/// </summary>
+API_STRUCT() struct SceneQuery
+{
+    DECLARE_SCRIPTING_TYPE_MINIMAL(SceneQuery);
+
+    /// <summary>
+    /// The query type.
+    /// </summary>
+    API_FIELD() SceneQueryType Type = SceneQueryType::RayCast;
+
+    /// <summary>
+    /// The origin of the ray or the center of the shape (in world space).
+    /// </summary>
+    API_FIELD() Vector3 Origin = Vector3::Zero;
+
+    /// <summary>
+    /// The normalized direction of the ray or the shape sweep.
+    /// </summary>
+    API_FIELD() Vector3 Direction = Vector3::Forward;
+
+    /// <summary>
+    /// The maximum distance the ray or the shape should check for collisions.
+    /// </summary>
+    API_FIELD() float MaxDistance = MAX_float;
+
+    /// <summary>
+    /// The radius of the sphere or capsule.
+    /// </summary>
+    API_FIELD() float Radius = 0.0f;
+
+    /// <summary>
+    /// The height of the capsule, excluding the top and bottom spheres.
+    /// </summary>
+    API_FIELD() float Height = 0.0f;
+
+    /// <summary>
+    /// The half size of the box in each direction.
+    /// </summary>
+    API_FIELD() Vector3 HalfExtents = Vector3::Zero;
+
+    /// <summary>
+    /// The shape rotation.
+    /// </summary>
+    API_FIELD() Quaternion Rotation = Quaternion::Identity;
+
+    /// <summary>
+    /// The layer mask used to filter the results.
+    /// </summary>
+    API_FIELD() uint32 LayerMask = MAX_uint32;
+
+    /// <summary>
+    /// If set to <c>true</c> triggers will be hit, otherwise will skip them.
+    /// </summary>
+    API_FIELD() bool HitTriggers = true;
+};
+
 /// <summary>
 /// Physics collision shape variant for different shapes such as box, sphere, capsule.
 /// </summary>
@@ -129,6 +129,27 @@ class FLAXENGINE_API FileBase : public NonCopyable
     /// <returns>True if file is opened, otherwise false.</returns>
     virtual bool IsOpened() const = 0;
 
+    /// <summary>
+    /// Maps the whole file contents into the process memory. The mapping is copy-on-write (modifications are not written back to the file) and stays valid after closing the file until it's released with UnmapView.
+    /// </summary>
+    /// <param name="size">The mapped data size (in bytes).</param>
+    /// <returns>The pointer to the mapped file data or null if memory-mapping is not supported or failed.</returns>
+    virtual byte* MapView(uint32& size)
+    {
+        size = 0;
+        return nullptr;
+    }
+
+public:
+    /// <summary>
+    /// Releases the file mapping created with MapView.
+    /// </summary>
+    /// <param name="data">The pointer to the mapped file data.</param>
+    /// <param name="size">The mapped data size (in bytes).</param>
+    static void UnmapView(byte* data, uint32 size)
+    {
+    }
+
 public:
     static bool ReadAllBytes(const StringView& path, byte* data, int32 length);
     static bool ReadAllBytes(const StringView& path, Array<byte, HeapAllocation>& data);
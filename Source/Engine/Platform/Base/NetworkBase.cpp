@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "NetworkBase.h"
+#include "Engine/Platform/Network.h"
 
 bool NetworkBase::CreateSocket(NetworkSocket& socket, NetworkProtocol proto, NetworkIPVersion ipv)
 {
@@ -105,6 +106,31 @@ int32 NetworkBase::ReadSocket(NetworkSocket socket, byte* buffer, uint32 bufferS
     return -1;
 }
 
+int32 NetworkBase::WriteSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    // Fallback to separate writes
+    for (int32 i = 0; i < count; i++)
+    {
+        if (Network::WriteSocket(socket, datagrams[i].Data, datagrams[i].Length, &datagrams[i].EndPoint) == -1)
+            return i != 0 ? i : -1;
+    }
+    return count;
+}
+
+int32 NetworkBase::ReadSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    // Fallback to separate reads
+    int32 i = 0;
+    for (; i < count && Network::IsReadable(socket); i++)
+    {
+        const int32 size = Network::ReadSocket(socket, datagrams[i].Data, datagrams[i].Length, &datagrams[i].EndPoint);
+        if (size == -1)
+            return i != 0 ? i : -1;
+        datagrams[i].Length = (uint32)size;
+    }
+    return i;
+}
+
 bool NetworkBase::CreateEndPoint(const String& address, const String& port, NetworkIPVersion ipv, NetworkEndPoint& endPoint, bool bindable)
 {
     return true;
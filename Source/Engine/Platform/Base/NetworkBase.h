@@ -135,6 +135,19 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(NetworkSocketGroup)
     API_FIELD(Private) byte* Data = nullptr;
 };
 
+/// <summary>
+/// Network datagram descriptor used for batched UDP sockets I/O.
+/// </summary>
+struct FLAXENGINE_API NetworkDatagram
+{
+    /// <summary>The datagram data (or the buffer to read into).</summary>
+    byte* Data;
+    /// <summary>The datagram data length (or the buffer size when reading, replaced with the read bytes count).</summary>
+    uint32 Length;
+    /// <summary>The destination end point (or the source end point when reading).</summary>
+    NetworkEndPoint EndPoint;
+};
+
 /// <summary>
 /// Low-level networking implementation interface with Berkeley sockets.
 /// </summary>
@@ -314,6 +327,24 @@ class FLAXENGINE_API NetworkBase
     /// <returns>Returns -1 on error, otherwise bytes read.</returns>
     API_FUNCTION() static int32 ReadSocket(NetworkSocket socket, byte* buffer, uint32 bufferSize, NetworkEndPoint* endPoint = nullptr);
 
+    /// <summary>
+    /// Writes multiple datagrams to the UDP socket. Uses a single system call for the whole batch if supported by the platform.
+    /// </summary>
+    /// <param name="socket">The socket.</param>
+    /// <param name="datagrams">The datagrams to write.</param>
+    /// <param name="count">The amount of datagrams.</param>
+    /// <returns>Returns -1 on error, otherwise the amount of datagrams written.</returns>
+    static int32 WriteSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count);
+
+    /// <summary>
+    /// Reads multiple datagrams from the UDP socket without blocking. Uses a single system call for the whole batch if supported by the platform.
+    /// </summary>
+    /// <param name="socket">The socket.</param>
+    /// <param name="datagrams">The datagrams to read (with buffers to read into).</param>
+    /// <param name="count">The maximum amount of datagrams to read.</param>
+    /// <returns>Returns -1 on error, otherwise the amount of datagrams read (0 if there is no data to read).</returns>
+    static int32 ReadSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count);
+
     /// <summary>
     /// Creates an end point.
     /// </summary>
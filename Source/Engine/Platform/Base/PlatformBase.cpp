@@ -17,6 +17,7 @@
 #include "Engine/Core/Utilities.h"
 #if COMPILE_WITH_PROFILER
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #endif
 #include "Engine/Threading/Threading.h"
 #include "Engine/Engine/CommandLine.h"
@@ -215,6 +216,10 @@ void PlatformBase::OnMemoryAlloc(void* ptr, uint64 size)
             activeEvent.NativeMemoryAllocation += (int32)size;
         }
     }
+
+    // Track memory allocation per subsystem
+    if (ProfilerMemory::Enabled)
+        ProfilerMemory::OnAlloc(ptr, size);
 }
 
 void PlatformBase::OnMemoryFree(void* ptr)
@@ -226,6 +231,10 @@ void PlatformBase::OnMemoryFree(void* ptr)
     // Track memory allocation in Tracy
     tracy::Profiler::MemFree(ptr, false);
 #endif
+
+    // Track memory allocation per subsystem
+    if (ProfilerMemory::Enabled)
+        ProfilerMemory::OnFree(ptr);
 }
 
 #endif
@@ -4,6 +4,7 @@
 #include "Engine/Threading/IRunnable.h"
 #include "Engine/Threading/ThreadRegistry.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Memory/Memory.h"
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #if TRACY_ENABLE
 #include "Engine/Core/Math/Math.h"
@@ -111,6 +112,9 @@ int32 ThreadBase::Run()
     _isRunning = false;
     ThreadExiting(thread, exitCode);
     ThreadRegistry::Remove(thread);
+#if USE_THREAD_CACHE_ALLOCATOR
+    ThreadCacheAllocator::FlushThreadCache();
+#endif
     MCore::Thread::Exit(); // TODO: use mono_thread_detach instead of ext and unlink mono runtime from thread in ThreadExiting delegate
     // mono terminates the native thread..
 
@@ -142,6 +142,7 @@ void WindowBase::SetIsFullscreen(bool isFullscreen)
 
     if (_swapChain)
     {
+        GPUDevice::Instance->WaitForPresent();
         _swapChain->SetFullscreen(isFullscreen);
     }
 }
@@ -184,6 +185,8 @@ void WindowBase::OnDeleteObject()
 
     // Release resources
     SAFE_DELETE(RenderTask);
+    if (_swapChain && GPUDevice::Instance)
+        GPUDevice::Instance->WaitForPresent();
     SAFE_DELETE(_swapChain);
 
     // Base
@@ -399,7 +402,10 @@ void WindowBase::OnResize(int32 width, int32 height)
 {
     PROFILE_CPU_NAMED("GUI.OnResize");
     if (_swapChain)
+    {
+        GPUDevice::Instance->WaitForPresent();
         _swapChain->Resize(width, height);
+    }
     if (RenderTask)
         RenderTask->Resize(width, height);
     Resized({ static_cast<float>(width), static_cast<float>(height) });
@@ -413,7 +419,10 @@ void WindowBase::OnClosed()
 
     // Dispose swap chain (it will wait for GPU work to be done)
     if (_swapChain)
+    {
+        GPUDevice::Instance->WaitForPresent();
         _swapChain->ReleaseGPU();
+    }
 
     // Send event
     Closed();
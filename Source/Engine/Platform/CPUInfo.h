@@ -55,4 +55,14 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(CPUInfo);
     /// The CPU cache line size (in bytes).
     /// </summary>
     API_FIELD() uint32 CacheLineSize;
+
+    /// <summary>
+    /// The mask of the logical processors on the performance cores (for hybrid CPUs, otherwise 0).
+    /// </summary>
+    API_FIELD() uint64 PerformanceCoresMask;
+
+    /// <summary>
+    /// The mask of the logical processors on the efficiency cores (for hybrid CPUs, otherwise 0).
+    /// </summary>
+    API_FIELD() uint64 EfficiencyCoresMask;
 };
@@ -1175,6 +1175,33 @@ int parse_size(const char* str, uintmax_t* res, int* power)
     return rc;
 }
 
+// Reads the list of CPUs (eg. "0-7,16") from the given sysfs file into a logical processors mask
+static uint64 ReadCpuList(const char* path)
+{
+    uint64 mask = 0;
+    if (FILE* file = fopen(path, "r"))
+    {
+        int32 first, last;
+        while (fscanf(file, "%d", &first) == 1)
+        {
+            last = first;
+            int32 c = fgetc(file);
+            if (c == '-')
+            {
+                if (fscanf(file, "%d", &last) != 1)
+                    break;
+                c = fgetc(file);
+            }
+            for (int32 cpuIdx = Math::Max(first, 0); cpuIdx <= last && cpuIdx < 64; cpuIdx++)
+                mask |= 1ull << cpuIdx;
+            if (c != ',')
+                break;
+        }
+        fclose(file);
+    }
+    return mask;
+}
+
 class LinuxKeyboard : public Keyboard
 {
 public:
@@ -1809,7 +1836,14 @@ void LinuxPlatform::SetThreadPriority(ThreadPriority priority)
 
 void LinuxPlatform::SetThreadAffinityMask(uint64 affinityMask)
 {
-    // TODO: impl this
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+    {
+        if (affinityMask & (1ull << cpuIdx))
+            CPU_SET(cpuIdx, &cpus);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
 }
 
 void LinuxPlatform::Sleep(int32 milliseconds)
@@ -2009,6 +2043,41 @@ bool LinuxPlatform::Init()
         UnixCpu.ProcessorPackageCount = packagesCount;
         UnixCpu.ProcessorCoreCount = Math::Max(numberOfCores, 1);
         UnixCpu.LogicalProcessorCount = CPU_COUNT(&cpus);
+
+        // Detect hybrid CPU cores (Intel hybrid CPUs list core types, on other CPUs the efficiency cores have noticeably lower capacity)
+        UnixCpu.PerformanceCoresMask = ReadCpuList("/sys/devices/cpu_core/cpus");
+        UnixCpu.EfficiencyCoresMask = ReadCpuList("/sys/devices/cpu_atom/cpus");
+        if (UnixCpu.PerformanceCoresMask == 0 || UnixCpu.EfficiencyCoresMask == 0)
+        {
+            UnixCpu.PerformanceCoresMask = UnixCpu.EfficiencyCoresMask = 0;
+            uint32 cpusCapacity[64];
+            uint32 maxCapacity = 0;
+            for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+            {
+                cpusCapacity[cpuIdx] = 0;
+                if (!CPU_ISSET(cpuIdx, &cpus))
+                    continue;
+                sprintf(fileNameBuffer, "/sys/devices/system/cpu/cpu%d/cpu_capacity", cpuIdx);
+                if (FILE* capacityFile = fopen(fileNameBuffer, "r"))
+                {
+                    if (fscanf(capacityFile, "%u", &cpusCapacity[cpuIdx]) != 1)
+                        cpusCapacity[cpuIdx] = 0;
+                    fclose(capacityFile);
+                }
+                maxCapacity = Math::Max(maxCapacity, cpusCapacity[cpuIdx]);
+            }
+            for (int32 cpuIdx = 0; cpuIdx < 64; cpuIdx++)
+            {
+                if (cpusCapacity[cpuIdx] == 0)
+                    continue;
+                if (cpusCapacity[cpuIdx] * 5 < maxCapacity * 4)
+                    UnixCpu.EfficiencyCoresMask |= 1ull << cpuIdx;
+                else
+                    UnixCpu.PerformanceCoresMask |= 1ull << cpuIdx;
+            }
+            if (UnixCpu.EfficiencyCoresMask == 0)
+                UnixCpu.PerformanceCoresMask = 0;
+        }
     }
     else
     {
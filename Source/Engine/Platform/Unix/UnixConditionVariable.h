@@ -46,6 +46,15 @@ class FLAXENGINE_API UnixConditionVariable
     /// <param name="lock">The critical section locked by the current thread.</param>
     void Wait(const UnixCriticalSection& lock)
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (lock._profilerData)
+        {
+            const double start = ProfilerLocks::OnConditionWaitBegin(lock._profilerData);
+            pthread_cond_wait(&_cond, lock._mutexPtr);
+            ProfilerLocks::OnConditionWaitEnd(lock._profilerData, start);
+            return;
+        }
+#endif
         pthread_cond_wait(&_cond, lock._mutexPtr);
     }
 
@@ -64,6 +73,15 @@ class FLAXENGINE_API UnixConditionVariable
         ts.tv_nsec = tv.tv_usec * 1000 + 1000 * 1000 * (timeout % 1000);
         ts.tv_sec += ts.tv_nsec / (1000 * 1000 * 1000);
         ts.tv_nsec %= (1000 * 1000 * 1000);
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (lock._profilerData)
+        {
+            const double start = ProfilerLocks::OnConditionWaitBegin(lock._profilerData);
+            const bool result = pthread_cond_timedwait(&_cond, lock._mutexPtr, &ts) == 0;
+            ProfilerLocks::OnConditionWaitEnd(lock._profilerData, start);
+            return result;
+        }
+#endif
         return pthread_cond_timedwait(&_cond, lock._mutexPtr, &ts) == 0;
     }
 
@@ -5,6 +5,7 @@
 #if PLATFORM_UNIX
 
 #include "Engine/Platform/Platform.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 #include <pthread.h>
 
 class UnixConditionVariable;
@@ -15,10 +16,16 @@ class UnixConditionVariable;
 class FLAXENGINE_API UnixCriticalSection
 {
     friend UnixConditionVariable;
+#if COMPILE_WITH_LOCKS_PROFILER
+    friend ProfilerLocks;
+#endif
 private:
 
     pthread_mutex_t _mutex;
     pthread_mutex_t* _mutexPtr;
+#if COMPILE_WITH_LOCKS_PROFILER
+    mutable ProfilerLockData* _profilerData = nullptr;
+#endif
 #if BUILD_DEBUG
     pthread_t _owningThreadId;
 #endif
@@ -49,6 +56,10 @@ class FLAXENGINE_API UnixCriticalSection
     /// </summary>
     ~UnixCriticalSection()
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+            ProfilerLocks::OnUnregister(_profilerData);
+#endif
         pthread_mutex_destroy(&_mutex);
     }
 
@@ -59,6 +70,19 @@ class FLAXENGINE_API UnixCriticalSection
     /// </summary>
     NO_SANITIZE_THREAD void Lock() const
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+        {
+            if (pthread_mutex_trylock(_mutexPtr) != 0)
+            {
+                const ProfilerLocks::Wait wait = ProfilerLocks::OnWaitBegin(_profilerData);
+                pthread_mutex_lock(_mutexPtr);
+                ProfilerLocks::OnWaitEnd(_profilerData, wait);
+            }
+            ProfilerLocks::OnLocked(_profilerData);
+        }
+        else
+#endif
         pthread_mutex_lock(_mutexPtr);
 #if BUILD_DEBUG
         ((UnixCriticalSection*)this)->_owningThreadId = pthread_self();
@@ -71,7 +95,12 @@ class FLAXENGINE_API UnixCriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     NO_SANITIZE_THREAD bool TryLock() const
     {
-        return pthread_mutex_trylock(_mutexPtr) == 0;
+        const bool result = pthread_mutex_trylock(_mutexPtr) == 0;
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (result && _profilerData)
+            ProfilerLocks::OnLocked(_profilerData);
+#endif
+        return result;
     }
 
     /// <summary>
@@ -81,6 +110,10 @@ class FLAXENGINE_API UnixCriticalSection
     {
 #if BUILD_DEBUG
         ((UnixCriticalSection*)this)->_owningThreadId = 0;
+#endif
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+            ProfilerLocks::OnUnlocked(_profilerData);
 #endif
         pthread_mutex_unlock(_mutexPtr);
     }
@@ -15,6 +15,7 @@
 #endif
 #include <sys/file.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <cerrno>
@@ -157,4 +158,26 @@ bool UnixFile::IsOpened() const
     return _handle != -1;
 }
 
+byte* UnixFile::MapView(uint32& size)
+{
+    size = 0;
+    const uint32 fileSize = _handle != -1 ? GetSize() : 0;
+    if (fileSize == 0)
+        return nullptr;
+    void* data = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, _handle, 0);
+    if (data == MAP_FAILED)
+    {
+        LOG(Warning, "Failed to map file into memory, errno={}", errno);
+        return nullptr;
+    }
+    size = fileSize;
+    return (byte*)data;
+}
+
+void UnixFile::UnmapView(byte* data, uint32 size)
+{
+    if (data)
+        munmap(data, size);
+}
+
 #endif
@@ -51,6 +51,8 @@ class FLAXENGINE_API UnixFile : public FileBase
     uint32 GetPosition() const override;
     void SetPosition(uint32 seek) override;
     bool IsOpened() const override;
+    byte* MapView(uint32& size) override;
+    static void UnmapView(byte* data, uint32 size);
 };
 
 #endif
@@ -4,6 +4,7 @@
 
 #include "UnixNetwork.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Utilities/StringConverter.h"
 #include <stdio.h>
 #include <sys/types.h>
@@ -293,6 +294,122 @@ int32 UnixNetwork::ReadSocket(NetworkSocket socket, byte* buffer, uint32 bufferS
     return size;
 }
 
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+
+// Maximum amount of datagrams per single sendmmsg/recvmmsg call
+#define UNIX_NETWORK_BATCH_SIZE 64
+
+int32 UnixNetwork::WriteSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    auto& sock = *(UnixSocketData*)&socket.Data;
+    mmsghdr msgs[UNIX_NETWORK_BATCH_SIZE];
+    iovec iovecs[UNIX_NETWORK_BATCH_SIZE];
+    int32 written = 0;
+    while (written < count)
+    {
+        const int32 batchSize = Math::Min(count - written, UNIX_NETWORK_BATCH_SIZE);
+        memset(msgs, 0, sizeof(mmsghdr) * batchSize);
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            NetworkDatagram& datagram = datagrams[written + i];
+            iovecs[i].iov_base = datagram.Data;
+            iovecs[i].iov_len = datagram.Length;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = datagram.EndPoint.Data;
+            msgs[i].msg_hdr.msg_namelen = GetAddrSizeFromEP(datagram.EndPoint);
+        }
+        const int result = sendmmsg(sock.sockfd, msgs, batchSize, 0);
+        if (result <= 0)
+        {
+            if (written != 0)
+                break;
+            LOG(Error, "Unable to send data! Socket : {0} Datagrams : {1}", sock.sockfd, count);
+            LOG_UNIX_LAST_ERROR;
+            return -1;
+        }
+        written += result;
+        if (result < batchSize)
+            break;
+    }
+    return written;
+}
+
+int32 UnixNetwork::ReadSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    auto& sock = *(UnixSocketData*)&socket.Data;
+    mmsghdr msgs[UNIX_NETWORK_BATCH_SIZE];
+    iovec iovecs[UNIX_NETWORK_BATCH_SIZE];
+    int32 read = 0;
+    while (read < count)
+    {
+        const int32 batchSize = Math::Min(count - read, UNIX_NETWORK_BATCH_SIZE);
+        memset(msgs, 0, sizeof(mmsghdr) * batchSize);
+        for (int32 i = 0; i < batchSize; i++)
+        {
+            NetworkDatagram& datagram = datagrams[read + i];
+            iovecs[i].iov_base = datagram.Data;
+            iovecs[i].iov_len = datagram.Length;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+            msgs[i].msg_hdr.msg_name = datagram.EndPoint.Data;
+            msgs[i].msg_hdr.msg_namelen = sizeof(datagram.EndPoint.Data);
+        }
+        const int result = recvmmsg(sock.sockfd, msgs, batchSize, MSG_DONTWAIT, nullptr);
+        if (result < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || read != 0)
+                break;
+            LOG(Error, "Unable to read data! Socket : {0}", sock.sockfd);
+            LOG_UNIX_LAST_ERROR;
+            return -1;
+        }
+        for (int32 i = 0; i < result; i++)
+        {
+            NetworkDatagram& datagram = datagrams[read + i];
+            datagram.Length = msgs[i].msg_len;
+            datagram.EndPoint.IPVersion = ((const sockaddr*)datagram.EndPoint.Data)->sa_family == AF_INET6 ? NetworkIPVersion::IPv6 : NetworkIPVersion::IPv4;
+        }
+        read += result;
+        if (result < batchSize)
+            break;
+    }
+    return read;
+}
+
+#else
+
+int32 UnixNetwork::WriteSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    return NetworkBase::WriteSocketBatch(socket, datagrams, count);
+}
+
+int32 UnixNetwork::ReadSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count)
+{
+    // No batched reads so use separate non-blocking reads
+    auto& sock = *(UnixSocketData*)&socket.Data;
+    int32 read = 0;
+    for (; read < count; read++)
+    {
+        NetworkDatagram& datagram = datagrams[read];
+        socklen_t addrsize = sizeof(datagram.EndPoint.Data);
+        const ssize_t size = recvfrom(sock.sockfd, datagram.Data, datagram.Length, MSG_DONTWAIT, (sockaddr*)datagram.EndPoint.Data, &addrsize);
+        if (size < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || read != 0)
+                break;
+            LOG(Error, "Unable to read data! Socket : {0}", sock.sockfd);
+            LOG_UNIX_LAST_ERROR;
+            return -1;
+        }
+        datagram.Length = (uint32)size;
+        datagram.EndPoint.IPVersion = ((const sockaddr*)datagram.EndPoint.Data)->sa_family == AF_INET6 ? NetworkIPVersion::IPv6 : NetworkIPVersion::IPv4;
+    }
+    return read;
+}
+
+#endif
+
 bool UnixNetwork::CreateEndPoint(const String& address, const String& port, NetworkIPVersion ipv, NetworkEndPoint& endPoint, bool bindable)
 {
     int status;
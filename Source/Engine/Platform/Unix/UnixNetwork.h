@@ -21,6 +21,8 @@ class FLAXENGINE_API UnixNetwork : public NetworkBase
     static bool Accept(NetworkSocket& serverSocket, NetworkSocket& newSocket, NetworkEndPoint& newEndPoint);
     static int32 WriteSocket(NetworkSocket socket, byte* data, uint32 length, NetworkEndPoint* endPoint = nullptr);
     static int32 ReadSocket(NetworkSocket socket, byte* buffer, uint32 bufferSize, NetworkEndPoint* endPoint = nullptr);
+    static int32 WriteSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count);
+    static int32 ReadSocketBatch(NetworkSocket socket, NetworkDatagram* datagrams, int32 count);
     static bool CreateEndPoint(const String& address, const String& port, NetworkIPVersion ipv, NetworkEndPoint& endPoint, bool bindable = true);
 };
 
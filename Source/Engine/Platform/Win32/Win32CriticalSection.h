@@ -5,6 +5,7 @@
 #if PLATFORM_WIN32
 
 #include "WindowsMinimal.h"
+#include "Engine/Profiler/ProfilerLocks.h"
 
 class Win32ConditionVariable;
 
@@ -14,9 +15,15 @@ class Win32ConditionVariable;
 class FLAXENGINE_API Win32CriticalSection
 {
     friend Win32ConditionVariable;
+#if COMPILE_WITH_LOCKS_PROFILER
+    friend ProfilerLocks;
+#endif
 
 private:
     mutable Windows::CRITICAL_SECTION _criticalSection;
+#if COMPILE_WITH_LOCKS_PROFILER
+    mutable ProfilerLockData* _profilerData = nullptr;
+#endif
 
 private:
     Win32CriticalSection(const Win32CriticalSection&);
@@ -36,6 +43,10 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     ~Win32CriticalSection()
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+            ProfilerLocks::OnUnregister(_profilerData);
+#endif
         Windows::DeleteCriticalSection(&_criticalSection);
     }
 
@@ -45,6 +56,19 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     void Lock() const
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+        {
+            if (!Windows::TryEnterCriticalSection(&_criticalSection))
+            {
+                const ProfilerLocks::Wait wait = ProfilerLocks::OnWaitBegin(_profilerData);
+                Windows::EnterCriticalSection(&_criticalSection);
+                ProfilerLocks::OnWaitEnd(_profilerData, wait);
+            }
+            ProfilerLocks::OnLocked(_profilerData);
+            return;
+        }
+#endif
         Windows::EnterCriticalSection(&_criticalSection);
     }
 
@@ -54,7 +78,12 @@ class FLAXENGINE_API Win32CriticalSection
     /// <returns>True if calling thread took ownership of the critical section.</returns>
     bool TryLock() const
     {
-        return Windows::TryEnterCriticalSection(&_criticalSection) != 0;
+        const bool result = Windows::TryEnterCriticalSection(&_criticalSection) != 0;
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (result && _profilerData)
+            ProfilerLocks::OnLocked(_profilerData);
+#endif
+        return result;
     }
 
     /// <summary>
@@ -62,6 +91,10 @@ class FLAXENGINE_API Win32CriticalSection
     /// </summary>
     void Unlock() const
     {
+#if COMPILE_WITH_LOCKS_PROFILER
+        if (_profilerData)
+            ProfilerLocks::OnUnlocked(_profilerData);
+#endif
         Windows::LeaveCriticalSection(&_criticalSection);
     }
 };
@@ -108,4 +108,39 @@ bool Win32File::IsOpened() const
     return _handle != nullptr;
 }
 
+byte* Win32File::MapView(uint32& size)
+{
+    size = 0;
+#if PLATFORM_UWP
+    return nullptr;
+#else
+    const uint32 fileSize = GetSize();
+    if (!_handle || fileSize == 0)
+        return nullptr;
+    const HANDLE mapping = CreateFileMappingW(_handle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        LOG_WIN32_LAST_ERROR;
+        return nullptr;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (!data)
+        LOG_WIN32_LAST_ERROR;
+
+    // View keeps a reference to the mapping object
+    CloseHandle(mapping);
+    if (data)
+        size = fileSize;
+    return (byte*)data;
+#endif
+}
+
+void Win32File::UnmapView(byte* data, uint32 size)
+{
+#if !PLATFORM_UWP
+    if (data)
+        UnmapViewOfFile(data);
+#endif
+}
+
 #endif
@@ -145,6 +145,42 @@ bool Win32Platform::Init()
     }
     free(buffer);
 
+#if PLATFORM_WINDOWS
+    // Detect hybrid CPU cores (higher efficiency class means better performance)
+    {
+        DWORD coresInfoLength = 0;
+        GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &coresInfoLength);
+        byte* coresInfo = coresInfoLength != 0 ? (byte*)malloc(coresInfoLength) : nullptr;
+        if (coresInfo && GetLogicalProcessorInformationEx(RelationProcessorCore, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)coresInfo, &coresInfoLength))
+        {
+            BYTE maxEfficiencyClass = 0;
+            for (DWORD offset = 0; offset < coresInfoLength;)
+            {
+                const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(coresInfo + offset);
+                maxEfficiencyClass = Math::Max(maxEfficiencyClass, info->Processor.EfficiencyClass);
+                offset += info->Size;
+            }
+            if (maxEfficiencyClass != 0)
+            {
+                for (DWORD offset = 0; offset < coresInfoLength;)
+                {
+                    const auto info = (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)(coresInfo + offset);
+                    const GROUP_AFFINITY& affinity = info->Processor.GroupMask[0];
+                    if (affinity.Group == 0)
+                    {
+                        if (info->Processor.EfficiencyClass == maxEfficiencyClass)
+                            CpuInfo.PerformanceCoresMask |= (uint64)affinity.Mask;
+                        else
+                            CpuInfo.EfficiencyCoresMask |= (uint64)affinity.Mask;
+                    }
+                    offset += info->Size;
+                }
+            }
+        }
+        free(coresInfo);
+    }
+#endif
+
     // Set info about the CPU
     CpuInfo.ProcessorPackageCount = processorPackageCount;
     CpuInfo.ProcessorCoreCount = processorCoreCount;
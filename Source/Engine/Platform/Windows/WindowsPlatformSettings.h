@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Config/PlatformSettingsBase.h"
 #include "Engine/Scripting/SoftObjectReference.h"
+#include "Engine/Threading/ThreadRegistry.h"
 
 class Texture;
 
@@ -83,10 +84,31 @@ API_CLASS(sealed, Namespace="FlaxEditor.Content.Settings") class FLAXENGINE_API
     API_FIELD(Attributes="EditorOrder(2030), DefaultValue(false), EditorDisplay(\"Graphics\")")
     bool SupportVulkan = false;
 
+    /// <summary>
+    /// The placement of the main thread on the CPU cores (used on hybrid CPUs with performance and efficiency cores).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(3000), DefaultValue(ThreadPlacement.Performance), EditorDisplay(\"Threading\")")
+    ThreadPlacement MainThreadPlacement = ThreadPlacement::Performance;
+
+    /// <summary>
+    /// The placement of the Job System workers on the CPU cores (used by the rendering and other latency-critical work).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(3010), DefaultValue(ThreadPlacement.Performance), EditorDisplay(\"Threading\")")
+    ThreadPlacement WorkersPlacement = ThreadPlacement::Performance;
+
+    /// <summary>
+    /// The placement of the background threads on the CPU cores (Thread Pool used by the shaders compilation and other async tasks, and the content loading threads).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(3020), DefaultValue(ThreadPlacement.Efficiency), EditorDisplay(\"Threading\")")
+    ThreadPlacement BackgroundPlacement = ThreadPlacement::Efficiency;
+
     /// <summary>
     /// Gets the instance of the settings asset (default value if missing). Object returned by this method is always loaded with valid data to use.
     /// </summary>
     static WindowsPlatformSettings* Get();
+
+    // [SettingsBase]
+    void Apply() override;
 };
 
 #if PLATFORM_WINDOWS
@@ -0,0 +1,597 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "PerformanceTest.h"
+#include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/EngineService.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Engine/Time.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUAdapter.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Level/Level.h"
+#include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/Actors/Camera.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonTools.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include "Engine/Streaming/Streaming.h"
+
+// The camera path time step (in seconds) per measured frame. Path is sampled with a fixed step so every run renders the same views regardless of the framerate.
+#define PERF_TEST_TIME_STEP (1.0f / 60.0f)
+// The amount of frames measured when no camera path is used.
+#define PERF_TEST_DEFAULT_FRAMES 600
+// The minimum amount of frames rendered before measuring (after the scene load and content streaming).
+#define PERF_TEST_WARMUP_FRAMES 30
+// The maximum time (in seconds) to wait for the content streaming to finish before measuring.
+#define PERF_TEST_WARMUP_TIMEOUT 60.0f
+// The maximum time (in seconds) to wait for the scene to load.
+#define PERF_TEST_LOAD_TIMEOUT 120.0f
+
+namespace
+{
+    enum class PerformanceTestState
+    {
+        None,
+        Loading,
+        Warmup,
+        Measure,
+    };
+
+    struct CameraKeyframe
+    {
+        float Time;
+        Vector3 Position;
+        Quaternion Orientation;
+    };
+
+    struct FrameSample
+    {
+        float FrameTimeMs;
+        float UpdateTimeMs;
+        float PhysicsTimeMs;
+        float DrawCPUTimeMs;
+        float DrawGPUTimeMs;
+        float DrawCalls;
+        float Triangles;
+        float PipelineStateChanges;
+    };
+
+    struct MetricStats
+    {
+        float Avg, Min, Max, P50, P95, P99;
+    };
+
+    PerformanceTestState State = PerformanceTestState::None;
+    Guid SceneId;
+    String ReportPath;
+    bool ExitOnEnd = false;
+    float BudgetMs = 0.0f;
+    Array<CameraKeyframe> CameraPath;
+    Camera* TestCamera = nullptr;
+    double StateStartTime = 0.0, LastFrameTime = 0.0;
+    int32 StateFrames = 0, FramesToMeasure = 0;
+    Array<FrameSample> Samples;
+    uint64 PeakProcessMemory = 0, PeakGPUMemory = 0, PeakStreamingInFlightBytes = 0;
+    int32 PeakStreamingResources = 0;
+    StreamingStats StreamingStart;
+    float PrevUpdateFPS, PrevDrawFPS;
+    bool PrevUseVSync;
+    bool Recording = false;
+    double RecordingStartTime = 0.0;
+    Array<CameraKeyframe> RecordedPath;
+
+    bool LoadCameraPath(const StringView& path, Array<CameraKeyframe>& keyframes)
+    {
+        BytesContainer data;
+        if (File::ReadAllBytes(path, data))
+        {
+            LOG(Error, "Failed to load camera path file '{0}'", path);
+            return true;
+        }
+        rapidjson_flax::Document document;
+        document.Parse((const char*)data.Get(), data.Length());
+        if (document.HasParseError() || !document.IsObject())
+        {
+            LOG(Error, "Invalid camera path file '{0}'", path);
+            return true;
+        }
+        const auto keyframesMember = document.FindMember("Keyframes");
+        if (keyframesMember == document.MemberEnd() || !keyframesMember->value.IsArray())
+        {
+            LOG(Error, "Missing keyframes in camera path file '{0}'", path);
+            return true;
+        }
+        keyframes.Clear();
+        for (const auto& e : keyframesMember->value.GetArray())
+        {
+            CameraKeyframe& keyframe = keyframes.AddOne();
+            keyframe.Time = JsonTools::GetFloat(e, "Time", 0.0f);
+            keyframe.Position = Vector3::Zero;
+            keyframe.Orientation = Quaternion::Identity;
+            const auto position = e.FindMember("Position");
+            if (position != e.MemberEnd())
+                keyframe.Position = JsonTools::GetVector3(position->value);
+            const auto orientation = e.FindMember("Orientation");
+            if (orientation != e.MemberEnd())
+                keyframe.Orientation = JsonTools::GetQuaternion(orientation->value);
+        }
+        if (keyframes.IsEmpty())
+        {
+            LOG(Error, "Empty camera path file '{0}'", path);
+            return true;
+        }
+        return false;
+    }
+
+    void SampleCameraPath(float time, Vector3& position, Quaternion& orientation)
+    {
+        const CameraKeyframe* keyframes = CameraPath.Get();
+        const int32 count = CameraPath.Count();
+        int32 index = 0;
+        while (index + 1 < count && keyframes[index + 1].Time <= time)
+            index++;
+        const CameraKeyframe& a = keyframes[index];
+        if (index + 1 >= count || time <= a.Time)
+        {
+            position = a.Position;
+            orientation = a.Orientation;
+            return;
+        }
+        const CameraKeyframe& b = keyframes[index + 1];
+        const float alpha = Math::Saturate((time - a.Time) / Math::Max(b.Time - a.Time, ZeroTolerance));
+        position = Vector3::Lerp(a.Position, b.Position, alpha);
+        Quaternion::Slerp(a.Orientation, b.Orientation, alpha, orientation);
+    }
+
+    void UpdateTestCamera(int32 frame)
+    {
+        if (TestCamera == nullptr)
+            return;
+        Vector3 position;
+        Quaternion orientation;
+        SampleCameraPath((float)frame * PERF_TEST_TIME_STEP, position, orientation);
+        TestCamera->SetPosition(position);
+        TestCamera->SetOrientation(orientation);
+    }
+
+    MetricStats CalculateStats(Array<float>& values)
+    {
+        MetricStats result;
+        Platform::MemoryClear(&result, sizeof(result));
+        if (values.IsEmpty())
+            return result;
+        Sorting::QuickSort(values.Get(), values.Count());
+        double sum = 0.0;
+        for (const float e : values)
+            sum += e;
+        const int32 last = values.Count() - 1;
+        result.Avg = (float)(sum / values.Count());
+        result.Min = values[0];
+        result.Max = values[last];
+        result.P50 = values[last * 50 / 100];
+        result.P95 = values[last * 95 / 100];
+        result.P99 = values[last * 99 / 100];
+        return result;
+    }
+
+    MetricStats WriteMetric(JsonWriter& writer, const char* name, const float FrameSample::* field)
+    {
+        Array<float> values;
+        values.Resize(Samples.Count());
+        for (int32 i = 0; i < Samples.Count(); i++)
+            values[i] = Samples[i].*field;
+        const MetricStats stats = CalculateStats(values);
+        writer.Key(name);
+        writer.StartObject();
+        writer.JKEY("Avg");
+        writer.Float(stats.Avg);
+        writer.JKEY("Min");
+        writer.Float(stats.Min);
+        writer.JKEY("Max");
+        writer.Float(stats.Max);
+        writer.JKEY("P50");
+        writer.Float(stats.P50);
+        writer.JKEY("P95");
+        writer.Float(stats.P95);
+        writer.JKEY("P99");
+        writer.Float(stats.P99);
+        writer.EndObject();
+        return stats;
+    }
+
+    void WriteStreamingGroup(JsonWriter& writer, const char* name, const StreamingGroupStats& start, const StreamingGroupStats& end)
+    {
+        writer.Key(name);
+        writer.StartObject();
+        writer.JKEY("ResourcesCount");
+        writer.Int(end.ResourcesCount);
+        writer.JKEY("ResidentBytes");
+        writer.Uint64(end.ResidentBytes);
+        writer.JKEY("AverageRequestLatency");
+        writer.Float(end.AverageRequestLatency);
+        writer.JKEY("Evictions");
+        writer.Uint64(end.EvictionsCount - start.EvictionsCount);
+        writer.EndObject();
+    }
+
+    bool SaveReport(float& frameTimeP95)
+    {
+        rapidjson_flax::StringBuffer buffer;
+        PrettyJsonWriter writerObj(buffer);
+        JsonWriter& writer = writerObj;
+        auto device = GPUDevice::Instance;
+        const StreamingStats streaming = Streaming::GetStats();
+        writer.StartObject();
+        writer.JKEY("EngineVersion");
+        writer.String(FLAXENGINE_VERSION_TEXT);
+        writer.JKEY("Platform");
+        writer.String(ToString(PLATFORM_TYPE));
+        writer.JKEY("Renderer");
+        writer.String(ToString(device->GetRendererType()));
+        writer.JKEY("Adapter");
+        writer.String(device->GetAdapter() ? device->GetAdapter()->GetDescription() : String::Empty);
+        writer.JKEY("Date");
+        writer.String(DateTime::Now().ToString());
+        writer.JKEY("Scene");
+        writer.Guid(SceneId);
+        writer.JKEY("Frames");
+        writer.Int(Samples.Count());
+        writer.JKEY("Metrics");
+        writer.StartObject();
+        frameTimeP95 = WriteMetric(writer, "FrameTimeMs", &FrameSample::FrameTimeMs).P95;
+        WriteMetric(writer, "UpdateTimeMs", &FrameSample::UpdateTimeMs);
+        WriteMetric(writer, "PhysicsTimeMs", &FrameSample::PhysicsTimeMs);
+        WriteMetric(writer, "DrawCPUTimeMs", &FrameSample::DrawCPUTimeMs);
+        WriteMetric(writer, "DrawGPUTimeMs", &FrameSample::DrawGPUTimeMs);
+        WriteMetric(writer, "DrawCalls", &FrameSample::DrawCalls);
+        WriteMetric(writer, "Triangles", &FrameSample::Triangles);
+        WriteMetric(writer, "PipelineStateChanges", &FrameSample::PipelineStateChanges);
+        writer.EndObject();
+        writer.JKEY("Memory");
+        writer.StartObject();
+        writer.JKEY("PeakProcessMemory");
+        writer.Uint64(PeakProcessMemory);
+        writer.JKEY("PeakGPUMemory");
+        writer.Uint64(PeakGPUMemory);
+        writer.EndObject();
+        writer.JKEY("Streaming");
+        writer.StartObject();
+        writer.JKEY("ResourcesCount");
+        writer.Int(streaming.ResourcesCount);
+        writer.JKEY("PeakStreamingResourcesCount");
+        writer.Int(PeakStreamingResources);
+        writer.JKEY("PeakInFlightBytes");
+        writer.Uint64(PeakStreamingInFlightBytes);
+        WriteStreamingGroup(writer, "Textures", StreamingStart.Textures, streaming.Textures);
+        WriteStreamingGroup(writer, "Models", StreamingStart.Models, streaming.Models);
+        WriteStreamingGroup(writer, "Audio", StreamingStart.Audio, streaming.Audio);
+        writer.EndObject();
+        writer.EndObject();
+        return File::WriteAllBytes(ReportPath, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+    }
+
+    void SetState(PerformanceTestState state)
+    {
+        State = state;
+        StateStartTime = LastFrameTime = Platform::GetTimeSeconds();
+        StateFrames = 0;
+    }
+
+    void End(int32 exitCode)
+    {
+        if (TestCamera)
+        {
+            if (Camera::OverrideMainCamera.Get() == TestCamera)
+                Camera::OverrideMainCamera = nullptr;
+            TestCamera->DeleteObject();
+            TestCamera = nullptr;
+        }
+        if (State != PerformanceTestState::None)
+        {
+            Time::UpdateFPS = PrevUpdateFPS;
+            Time::DrawFPS = PrevDrawFPS;
+            Graphics::UseVSync = PrevUseVSync;
+        }
+        State = PerformanceTestState::None;
+        CameraPath.Clear();
+        Samples.Clear();
+        if (ExitOnEnd)
+        {
+            ExitOnEnd = false;
+            Engine::RequestExit(exitCode);
+        }
+    }
+
+    void Finish()
+    {
+        float frameTimeP95 = 0.0f;
+        int32 exitCode = 0;
+        if (SaveReport(frameTimeP95))
+        {
+            LOG(Error, "Failed to save performance test report to '{0}'", ReportPath);
+            exitCode = -1;
+        }
+        else
+        {
+            LOG(Info, "Performance test finished ({0} frames, frame time P95: {1} ms). Report saved to '{2}'", Samples.Count(), frameTimeP95, ReportPath);
+        }
+        if (exitCode == 0 && BudgetMs > 0.0f && frameTimeP95 > BudgetMs)
+        {
+            LOG(Error, "Performance test failed: frame time P95 {0} ms exceeds the budget of {1} ms", frameTimeP95, BudgetMs);
+            exitCode = 1;
+        }
+        End(exitCode);
+    }
+}
+
+class PerformanceTestService : public EngineService
+{
+public:
+    PerformanceTestService()
+        : EngineService(TEXT("Performance Test"), 10)
+    {
+    }
+
+    bool Init() override;
+    void Update() override;
+    void Dispose() override;
+};
+
+PerformanceTestService PerformanceTestServiceInstance;
+
+bool PerformanceTestService::Init()
+{
+    if (!CommandLine::Options.PerfTest.HasValue())
+        return false;
+
+    // Start performance test from the command line (scene can be specified by the asset ID or path)
+    const String& scene = CommandLine::Options.PerfTest.GetValue();
+    Guid sceneId;
+    if (Guid::Parse(scene, sceneId))
+    {
+        AssetInfo info;
+        if (!Content::GetAssetInfo(scene, info))
+        {
+            LOG(Error, "Missing performance test scene '{0}'", scene);
+            Engine::RequestExit(-1);
+            return false;
+        }
+        sceneId = info.ID;
+    }
+    String reportPath;
+    if (CommandLine::Options.PerfTestReport.HasValue())
+        reportPath = CommandLine::Options.PerfTestReport.GetValue();
+    else
+#if USE_EDITOR
+        reportPath = Globals::ProjectFolder / TEXT("Logs/PerformanceTest.json");
+#else
+        reportPath = Globals::ProductLocalFolder / TEXT("Logs/PerformanceTest.json");
+#endif
+    const String cameraPath = CommandLine::Options.PerfTestPath.HasValue() ? CommandLine::Options.PerfTestPath.GetValue() : String::Empty;
+    if (PerformanceTest::Start(sceneId, cameraPath, reportPath))
+    {
+        Engine::RequestExit(-1);
+        return false;
+    }
+    if (CommandLine::Options.PerfTestBudget.HasValue())
+        StringUtils::Parse(CommandLine::Options.PerfTestBudget.GetValue().Get(), &BudgetMs);
+    ExitOnEnd = true;
+    return false;
+}
+
+void PerformanceTestService::Update()
+{
+    const double now = Platform::GetTimeSeconds();
+
+    // Record camera path
+    if (Recording)
+    {
+        if (const Camera* camera = Camera::GetMainCamera())
+        {
+            CameraKeyframe& keyframe = RecordedPath.AddOne();
+            keyframe.Time = (float)(now - RecordingStartTime);
+            keyframe.Position = camera->GetPosition();
+            keyframe.Orientation = camera->GetOrientation();
+        }
+    }
+
+    if (State == PerformanceTestState::None)
+        return;
+    PROFILE_CPU();
+    switch (State)
+    {
+    case PerformanceTestState::Loading:
+    {
+        Scene* scene = Level::FindScene(SceneId);
+        if (scene == nullptr)
+        {
+            if (now - StateStartTime > PERF_TEST_LOAD_TIMEOUT)
+            {
+                LOG(Error, "Performance test failed to load scene {0}", SceneId);
+                End(-1);
+            }
+            break;
+        }
+
+        // Spawn camera that flies along the path
+        if (CameraPath.HasItems())
+        {
+            TestCamera = New<Camera>();
+            TestCamera->SetName(String(TEXT("PerformanceTestCamera")));
+            TestCamera->HideFlags = HideFlags::FullyHidden;
+            TestCamera->SetParent(scene, false);
+            Camera::OverrideMainCamera = TestCamera;
+            UpdateTestCamera(0);
+        }
+        LOG(Info, "Performance test scene loaded in {0}s, waiting for content streaming", (float)(now - StateStartTime));
+        SetState(PerformanceTestState::Warmup);
+        break;
+    }
+    case PerformanceTestState::Warmup:
+    {
+        // Wait for the content to be streamed in at the start of the path to not measure the initial loading
+        StateFrames++;
+        const StreamingStats streaming = Streaming::GetStats();
+        const bool timeout = now - StateStartTime > PERF_TEST_WARMUP_TIMEOUT;
+        if (StateFrames < PERF_TEST_WARMUP_FRAMES || (streaming.StreamingResourcesCount != 0 && !timeout))
+            break;
+        if (timeout)
+            LOG(Warning, "Performance test content streaming didn't finish in {0}s ({1} resources in progress)", PERF_TEST_WARMUP_TIMEOUT, streaming.StreamingResourcesCount);
+        StreamingStart = streaming;
+        PeakProcessMemory = PeakGPUMemory = PeakStreamingInFlightBytes = 0;
+        PeakStreamingResources = 0;
+        SetState(PerformanceTestState::Measure);
+        LOG(Info, "Performance test measuring {0} frames", FramesToMeasure);
+        break;
+    }
+    case PerformanceTestState::Measure:
+    {
+        // Stats are gathered by the profiling tools for the last frame
+        const auto& stats = ProfilingTools::Stats;
+        if (StateFrames != 0)
+        {
+            FrameSample& sample = Samples.AddOne();
+            sample.FrameTimeMs = (float)((now - LastFrameTime) * 1000.0);
+            sample.UpdateTimeMs = stats.UpdateTimeMs;
+            sample.PhysicsTimeMs = stats.PhysicsTimeMs;
+            sample.DrawCPUTimeMs = stats.DrawCPUTimeMs;
+            sample.DrawGPUTimeMs = stats.DrawGPUTimeMs;
+            sample.DrawCalls = (float)stats.DrawStats.DrawCalls;
+            sample.Triangles = (float)stats.DrawStats.Triangles;
+            sample.PipelineStateChanges = (float)stats.DrawStats.PipelineStateChanges;
+            const StreamingStats streaming = Streaming::GetStats();
+            PeakProcessMemory = Math::Max(PeakProcessMemory, stats.ProcessMemory.UsedPhysicalMemory);
+            PeakGPUMemory = Math::Max(PeakGPUMemory, stats.MemoryGPU.Used);
+            PeakStreamingInFlightBytes = Math::Max(PeakStreamingInFlightBytes, streaming.InFlightBytes);
+            PeakStreamingResources = Math::Max(PeakStreamingResources, streaming.StreamingResourcesCount);
+        }
+        LastFrameTime = now;
+        if (Samples.Count() >= FramesToMeasure)
+        {
+            Finish();
+            break;
+        }
+        StateFrames++;
+        UpdateTestCamera(StateFrames);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+void PerformanceTestService::Dispose()
+{
+    ExitOnEnd = false;
+    End(0);
+    Recording = false;
+    RecordedPath.Resize(0);
+}
+
+bool PerformanceTest::IsRunning()
+{
+    return State != PerformanceTestState::None;
+}
+
+bool PerformanceTest::IsRecording()
+{
+    return Recording;
+}
+
+bool PerformanceTest::Start(const Guid& sceneId, const StringView& cameraPath, const StringView& reportPath)
+{
+    if (State != PerformanceTestState::None)
+    {
+        LOG(Warning, "Performance test is already running");
+        return true;
+    }
+    if (cameraPath.HasChars())
+    {
+        if (LoadCameraPath(cameraPath, CameraPath))
+            return true;
+        FramesToMeasure = Math::Max((int32)Math::CeilToInt(CameraPath.Last().Time / PERF_TEST_TIME_STEP), 1);
+    }
+    else
+    {
+        CameraPath.Clear();
+        FramesToMeasure = PERF_TEST_DEFAULT_FRAMES;
+    }
+    if (!Level::FindScene(sceneId) && Level::LoadSceneAsync(sceneId))
+    {
+        LOG(Error, "Performance test failed to load scene {0}", sceneId);
+        return true;
+    }
+    LOG(Info, "Starting performance test of scene {0} (camera path: '{1}')", sceneId, cameraPath);
+    SceneId = sceneId;
+    ReportPath = reportPath;
+    Samples.Clear();
+    Samples.EnsureCapacity(FramesToMeasure);
+
+    // Measure the actual frame cost without the framerate limits
+    PrevUpdateFPS = Time::UpdateFPS;
+    PrevDrawFPS = Time::DrawFPS;
+    PrevUseVSync = Graphics::UseVSync;
+    Time::UpdateFPS = 0.0f;
+    Time::DrawFPS = 0.0f;
+    Graphics::UseVSync = false;
+    SetState(PerformanceTestState::Loading);
+    return false;
+}
+
+void PerformanceTest::Cancel()
+{
+    if (State == PerformanceTestState::None)
+        return;
+    LOG(Info, "Performance test canceled");
+    End(-1);
+}
+
+bool PerformanceTest::StartRecording()
+{
+    if (Recording)
+        return true;
+    Recording = true;
+    RecordingStartTime = Platform::GetTimeSeconds();
+    RecordedPath.Clear();
+    return false;
+}
+
+bool PerformanceTest::StopRecording(const StringView& path)
+{
+    if (!Recording)
+        return true;
+    Recording = false;
+    rapidjson_flax::StringBuffer buffer;
+    PrettyJsonWriter writerObj(buffer);
+    JsonWriter& writer = writerObj;
+    writer.StartObject();
+    writer.JKEY("Keyframes");
+    writer.StartArray();
+    for (const CameraKeyframe& e : RecordedPath)
+    {
+        writer.StartObject();
+        writer.JKEY("Time");
+        writer.Float(e.Time);
+        writer.JKEY("Position");
+        writer.Vector3(e.Position);
+        writer.JKEY("Orientation");
+        writer.Quaternion(e.Orientation);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    LOG(Info, "Saving camera path with {0} keyframes to '{1}'", RecordedPath.Count(), path);
+    RecordedPath.Clear();
+    return File::WriteAllBytes(path, (const byte*)buffer.GetString(), (int32)buffer.GetSize());
+}
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_PROFILER
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Scene-level performance test that loads a scene, flies the camera along the recorded path and collects the CPU/GPU frame times, render stats, memory and streaming metrics into a JSON report. Works with a real GPU and with the Null graphics device (headless) so it can be used on CI to catch content-driven performance regressions.
+/// </summary>
+/// <remarks>
+/// Can be started with '-perftest !sceneId!' command line argument (scene asset ID or path). Use '-perftestpath !path!' to fly the camera along the recorded path, '-perftestreport !path!' to control the report location (PerformanceTest.json in the Logs folder by default) and '-perftestbudget !ms!' to fail with exit code 1 if 95th percentile of the frame time exceeds the budget. Engine exits after the test finishes. Camera path can be recorded with StartRecording/StopRecording.
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API PerformanceTest
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(PerformanceTest);
+    friend class PerformanceTestService;
+
+public:
+    /// <summary>
+    /// Checks if the performance test is running (loading scene, warming up or measuring frames).
+    /// </summary>
+    API_PROPERTY() static bool IsRunning();
+
+    /// <summary>
+    /// Checks if the camera path recording is active.
+    /// </summary>
+    API_PROPERTY() static bool IsRecording();
+
+    /// <summary>
+    /// Starts the performance test. Loads the scene (if not loaded yet), waits for the content streaming to settle and measures the frames while flying the camera along the path.
+    /// </summary>
+    /// <param name="sceneId">The scene asset ID.</param>
+    /// <param name="cameraPath">The camera path file (recorded with StartRecording/StopRecording). If empty, the scene main camera is used and the test runs for a fixed amount of frames.</param>
+    /// <param name="reportPath">The output report file path (JSON).</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool Start(const Guid& sceneId, const StringView& cameraPath, const StringView& reportPath);
+
+    /// <summary>
+    /// Cancels the active performance test without writing the report.
+    /// </summary>
+    API_FUNCTION() static void Cancel();
+
+    /// <summary>
+    /// Starts recording the main camera path (position and orientation sampled every frame).
+    /// </summary>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartRecording();
+
+    /// <summary>
+    /// Stops recording the main camera path and saves it to the file (JSON).
+    /// </summary>
+    /// <param name="path">The output camera path file.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StopRecording(const StringView& path);
+};
+
+#endif
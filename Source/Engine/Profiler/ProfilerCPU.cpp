@@ -16,7 +16,8 @@ ProfilerCPU::EventBuffer::EventBuffer()
     _capacityMask = _capacity - 1;
     _data = NewArray<Event>(_capacity);
     _head = 0;
-    _count = 0;
+    _added = 0;
+    _removed = 0;
 }
 
 ProfilerCPU::EventBuffer::~EventBuffer()
@@ -29,19 +30,18 @@ void ProfilerCPU::EventBuffer::Extract(Array<Event>& data, bool withRemoval)
     data.Clear();
 
     // Peek ring buffer state
-    int32 count = _count;
+    const int64 added = Platform::AtomicRead(&_added);
+    int32 count = (int32)Math::Min<int64>(added - _removed, _capacity);
     const int32 capacity = _capacity;
 
     // Skip if empty
     if (count == 0)
         return;
 
-    // Fix iterators when buffer is full (begin == end)
+    // Fix iterators when buffer is full (begin == end), also skips the overwritten events
     if (count == capacity)
-    {
-        _count--;
         count--;
-    }
+    Platform::AtomicStore(&_removed, added - count);
 
     // Find the first item (skip non-root events)
     Iterator firstEvent = Begin();
@@ -88,7 +88,7 @@ void ProfilerCPU::EventBuffer::Extract(Array<Event>& data, bool withRemoval)
     if (withRemoval)
     {
         // Remove all the events between [Begin(), lastEvent]
-        _count -= (lastEvent.Index() - Begin().Index()) & _capacityMask;
+        Platform::AtomicStore(&_removed, _removed + ((lastEvent.Index() - Begin().Index()) & _capacityMask));
     }
 
     // Extract all the events between [firstEvent, lastEvent]
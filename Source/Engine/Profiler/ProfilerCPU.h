@@ -55,7 +55,7 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     };
 
     /// <summary>
-    /// Implements simple profiling events ring-buffer.
+    /// Implements simple profiling events ring-buffer. Written by the owning thread and read by the profiler (single-producer single-consumer), the oldest events get overwritten when buffer is full.
     /// </summary>
     class EventBuffer : public NonCopyable
     {
@@ -64,7 +64,13 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         int32 _capacity;
         int32 _capacityMask;
         int32 _head;
-        int32 _count;
+        byte _padding0[PLATFORM_CACHE_LINE_SIZE];
+        // Total amount of added events (written only by the owning thread)
+        int64 volatile _added;
+        byte _padding1[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+        // Total amount of removed events (written only by the reader in Extract)
+        int64 volatile _removed;
+        byte _padding2[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
 
     public:
         EventBuffer();
@@ -76,7 +82,7 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         /// </summary>
         FORCE_INLINE int32 GetCount() const
         {
-            return _count;
+            return (int32)Math::Min<int64>(Platform::AtomicRead(&_added) - Platform::AtomicRead(&_removed), _capacity);
         }
 
         /// <summary>
@@ -98,7 +104,7 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
         {
             const int32 index = _head;
             _head = (_head + 1) & _capacityMask;
-            _count = Math::Min(_count + 1, _capacity);
+            Platform::AtomicStore(&_added, _added + 1);
             return index;
         }
 
@@ -216,12 +222,12 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerCPU
     public:
         FORCE_INLINE Iterator Begin()
         {
-            return Iterator(this, (_head - _count) & _capacityMask);
+            return Iterator(this, (_head - GetCount()) & _capacityMask);
         }
 
         FORCE_INLINE Iterator Last()
         {
-            ASSERT(_count > 0);
+            ASSERT(GetCount() > 0);
             return Iterator(this, (_head - 1) & _capacityMask);
         }
 
@@ -0,0 +1,540 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerCapture.h"
+#include "ProfilingTools.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Types/StringBuilder.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Serialization/FileWriteStream.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+
+// Capture file header (magic number and version of the format)
+#define PROFILER_CAPTURE_MAGIC 0x50434646
+#define PROFILER_CAPTURE_VERSION 1
+
+// Amount of frames to wait after the spike before saving the frames ring buffer (GPU events and the events of the spike frame are extracted with latency)
+#define PROFILER_SPIKE_DUMP_DELAY 4
+
+// Maximum amount of spike dumps saved by the detector during a single session (to not fill the disk)
+#define PROFILER_SPIKE_MAX_DUMPS 32
+
+enum class CaptureRecord : byte
+{
+    // Name definition (used by the other records to reference the events and threads names): int32 id, string name
+    Name = 0,
+    // Frame begin: uint64 frame index, double time (in milliseconds), int32 fps, uint64 process memory, uint64 GPU memory
+    Frame = 1,
+    // CPU thread events: int32 thread name id, int32 count, events (double start, float duration, uint16 depth, int32 name id, int32 native allocation, int32 managed allocation)
+    ThreadEvents = 2,
+    // GPU events of the last resolved frame: int32 count, events (float duration, uint16 depth, int32 name id, int32 draw calls)
+    GPUEvents = 3,
+    // Network events: int32 count, events (int32 name id, uint16 count, uint16 data size, uint16 received count, uint32 received data size)
+    NetworkEvents = 4,
+};
+
+enum class CaptureMode
+{
+    Stream,
+    Spike,
+    SpikeDetector,
+};
+
+namespace
+{
+    struct SpikeFrame
+    {
+        double Time;
+        Array<byte> Data;
+    };
+
+    CriticalSection CaptureLocker;
+    bool Capturing = false;
+    bool ProfilerWasEnabled = false;
+    String CapturePath;
+    FileWriteStream* CaptureFile = nullptr;
+    MemoryWriteStream FrameData(64 * 1024);
+    Dictionary<String, int32> NameIds;
+    Array<String> Names;
+
+    // Spike capture mode
+    CaptureMode Mode = CaptureMode::Stream;
+    float SpikeThresholdMs = 0.0f;
+    double SpikeWindowMs = 0.0;
+    double SpikeEndTime = -1.0;
+    double LastFrameTime = -1.0;
+    Array<SpikeFrame> SpikeFrames;
+
+    // Spike detector mode (spike frames ring buffer is reused to not allocate memory every frame)
+    int32 DetectorHead = 0;
+    int32 DetectorCount = 0;
+    int32 DetectorDumpDelay = -1;
+    int32 DetectorCooldown = 0;
+    int32 DetectorDumps = 0;
+
+    int32 GetNameId(const StringView& name)
+    {
+        int32 id;
+        if (NameIds.TryGet(name, id))
+            return id;
+        id = Names.Count();
+        Names.Add(name);
+        NameIds.Add(name, id);
+        FrameData.WriteByte((byte)CaptureRecord::Name);
+        FrameData.WriteInt32(id);
+        FrameData.Write(name);
+        return id;
+    }
+
+    bool OpenFile()
+    {
+        CaptureFile = FileWriteStream::Open(CapturePath);
+        if (!CaptureFile)
+        {
+            LOG(Error, "Cannot open profiler capture file '{0}'", CapturePath);
+            return true;
+        }
+        CaptureFile->WriteInt32(PROFILER_CAPTURE_MAGIC);
+        CaptureFile->WriteInt32(PROFILER_CAPTURE_VERSION);
+
+        // Write all known names (frames that used them for the first time might be already dropped in spike mode)
+        for (int32 i = 0; i < Names.Count(); i++)
+        {
+            CaptureFile->WriteByte((byte)CaptureRecord::Name);
+            CaptureFile->WriteInt32(i);
+            CaptureFile->Write(Names[i]);
+        }
+        return false;
+    }
+
+    bool StartCapture(const StringView& path)
+    {
+        if (Capturing)
+            ProfilerCapture::Stop();
+        CapturePath = path;
+        NameIds.Clear();
+        Names.Clear();
+        FrameData.SetPosition(0);
+        LastFrameTime = -1.0;
+        SpikeEndTime = -1.0;
+        SpikeFrames.Clear();
+        DetectorHead = DetectorCount = DetectorCooldown = DetectorDumps = 0;
+        DetectorDumpDelay = -1;
+        if (Mode == CaptureMode::Stream && OpenFile())
+            return true;
+        ProfilerWasEnabled = ProfilingTools::GetEnabled();
+        ProfilingTools::SetEnabled(true);
+        Capturing = true;
+        return false;
+    }
+
+    double GetSpikeFrameTime(double time)
+    {
+        // Use the wall time between the frames or the GPU time if frame was GPU-bound
+        const double frameTime = LastFrameTime > 0.0 ? time - LastFrameTime : 0.0;
+        LastFrameTime = time;
+        return Math::Max(frameTime, (double)ProfilingTools::Stats.DrawGPUTimeMs);
+    }
+
+    void DumpSpikeDetectorFrames()
+    {
+        const String folder = CapturePath;
+        if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+        {
+            LOG(Warning, "Cannot create profiler spikes directory '{0}'", folder);
+            return;
+        }
+        CapturePath = folder / String::Format(TEXT("Spike_{0}_{1}.flaxprofile"), DateTime::Now().ToFileNameString(), Engine::FrameCount);
+        if (!OpenFile())
+        {
+            const int32 capacity = SpikeFrames.Count();
+            for (int32 i = 0; i < DetectorCount; i++)
+            {
+                const auto& e = SpikeFrames[(DetectorHead - DetectorCount + i + capacity) % capacity];
+                CaptureFile->WriteBytes(e.Data.Get(), e.Data.Count());
+            }
+            Delete(CaptureFile);
+            CaptureFile = nullptr;
+            LOG(Info, "Saved profiler spike capture to '{0}'", CapturePath);
+        }
+        CapturePath = folder;
+        DetectorDumps++;
+    }
+
+    void AppendJsonString(StringBuilder& sb, const StringView& str)
+    {
+        sb.Append(TEXT('\"'));
+        for (int32 i = 0; i < str.Length(); i++)
+        {
+            const Char c = str[i];
+            if (c == '\"' || c == '\\')
+                sb.Append(TEXT('\\'));
+            if (c >= 32)
+                sb.Append(c);
+        }
+        sb.Append(TEXT('\"'));
+    }
+}
+
+bool ProfilerCapture::IsCapturing()
+{
+    return Capturing;
+}
+
+bool ProfilerCapture::Start(const StringView& path)
+{
+    ScopeLock lock(CaptureLocker);
+    Mode = CaptureMode::Stream;
+    if (StartCapture(path))
+        return true;
+    LOG(Info, "Started profiler capture to '{0}'", path);
+    return false;
+}
+
+bool ProfilerCapture::StartSpike(const StringView& path, float thresholdMs, float seconds)
+{
+    ScopeLock lock(CaptureLocker);
+    Mode = CaptureMode::Spike;
+    SpikeThresholdMs = Math::Max(thresholdMs, 1.0f);
+    SpikeWindowMs = Math::Max(seconds, 0.1f) * 1000.0;
+    if (StartCapture(path))
+        return true;
+    LOG(Info, "Started profiler capture to '{0}' around the first frame spike over {1} ms", path, SpikeThresholdMs);
+    return false;
+}
+
+bool ProfilerCapture::StartSpikeDetector(const StringView& folder, float thresholdMs, int32 framesCount)
+{
+    ScopeLock lock(CaptureLocker);
+    Mode = CaptureMode::SpikeDetector;
+    SpikeThresholdMs = Math::Max(thresholdMs, 1.0f);
+    if (StartCapture(folder))
+        return true;
+    SpikeFrames.Resize(Math::Max(framesCount, PROFILER_SPIKE_DUMP_DELAY + 1));
+    LOG(Info, "Started profiler spike detector (frames over {0} ms, last {1} frames) to '{2}'", SpikeThresholdMs, SpikeFrames.Count(), folder);
+    return false;
+}
+
+void ProfilerCapture::Stop()
+{
+    ScopeLock lock(CaptureLocker);
+    if (!Capturing)
+        return;
+    Capturing = false;
+    ProfilingTools::SetEnabled(ProfilerWasEnabled);
+    if (CaptureFile)
+    {
+        LOG(Info, "Saved profiler capture to '{0}'", CapturePath);
+        Delete(CaptureFile);
+        CaptureFile = nullptr;
+    }
+    FrameData.SetPosition(0);
+    SpikeFrames.Resize(0);
+    NameIds.Clear();
+    Names.Resize(0);
+}
+
+void ProfilerCapture::OnUpdate()
+{
+    ScopeLock lock(CaptureLocker);
+    if (!Capturing)
+        return;
+    PROFILE_CPU();
+
+    // Serialize the frame (profiler events are already extracted by the profiling tools)
+    const double time = Platform::GetTimeSeconds() * 1000.0;
+    FrameData.SetPosition(0);
+    {
+        const auto& stats = ProfilingTools::Stats;
+        FrameData.WriteByte((byte)CaptureRecord::Frame);
+        FrameData.WriteUint64(Engine::FrameCount);
+        FrameData.WriteDouble(time);
+        FrameData.WriteInt32(stats.FPS);
+        FrameData.WriteUint64(stats.ProcessMemory.UsedPhysicalMemory);
+        FrameData.WriteUint64(stats.MemoryGPU.Used);
+    }
+    for (const auto& thread : ProfilingTools::EventsCPU)
+    {
+        if (thread.Events.IsEmpty())
+            continue;
+        const int32 threadId = GetNameId(thread.Name);
+        for (const auto& e : thread.Events)
+            GetNameId(StringView(e.Name));
+        FrameData.WriteByte((byte)CaptureRecord::ThreadEvents);
+        FrameData.WriteInt32(threadId);
+        FrameData.WriteInt32(thread.Events.Count());
+        for (const auto& e : thread.Events)
+        {
+            FrameData.WriteDouble(e.Start);
+            FrameData.WriteFloat((float)(e.End - e.Start));
+            FrameData.WriteUint16((uint16)e.Depth);
+            FrameData.WriteInt32(NameIds[StringView(e.Name)]);
+            FrameData.WriteInt32(e.NativeMemoryAllocation);
+            FrameData.WriteInt32(e.ManagedMemoryAllocation);
+        }
+    }
+    if (ProfilingTools::EventsGPU.HasItems())
+    {
+        for (const auto& e : ProfilingTools::EventsGPU)
+            GetNameId(StringView(e.Name ? e.Name : TEXT("")));
+        FrameData.WriteByte((byte)CaptureRecord::GPUEvents);
+        FrameData.WriteInt32(ProfilingTools::EventsGPU.Count());
+        for (const auto& e : ProfilingTools::EventsGPU)
+        {
+            FrameData.WriteFloat(e.Time);
+            FrameData.WriteUint16((uint16)e.Depth);
+            FrameData.WriteInt32(NameIds[StringView(e.Name ? e.Name : TEXT(""))]);
+            FrameData.WriteInt32((int32)e.Stats.DrawCalls);
+        }
+    }
+    if (ProfilingTools::EventsNetwork.HasItems())
+    {
+        for (const auto& e : ProfilingTools::EventsNetwork)
+            GetNameId(String((const char*)e.Name));
+        FrameData.WriteByte((byte)CaptureRecord::NetworkEvents);
+        FrameData.WriteInt32(ProfilingTools::EventsNetwork.Count());
+        for (const auto& e : ProfilingTools::EventsNetwork)
+        {
+            FrameData.WriteInt32(NameIds[String((const char*)e.Name)]);
+            FrameData.WriteUint16(e.Count);
+            FrameData.WriteUint16(e.DataSize);
+            FrameData.WriteUint16(e.ReceivedCount);
+            FrameData.WriteUint32(e.ReceivedDataSize);
+        }
+    }
+
+    if (Mode == CaptureMode::Stream)
+    {
+        CaptureFile->WriteBytes(FrameData.GetHandle(), FrameData.GetPosition());
+        return;
+    }
+    if (Mode == CaptureMode::SpikeDetector)
+    {
+        // Spike detector mode: keep the last frames in the ring buffer and save them after every detected spike
+        auto& frame = SpikeFrames[DetectorHead];
+        frame.Time = time;
+        frame.Data.Set(FrameData.GetHandle(), FrameData.GetPosition());
+        DetectorHead = (DetectorHead + 1) % SpikeFrames.Count();
+        DetectorCount = Math::Min(DetectorCount + 1, SpikeFrames.Count());
+        const double frameTime = GetSpikeFrameTime(time);
+        if (DetectorDumpDelay > 0)
+        {
+            if (--DetectorDumpDelay == 0)
+            {
+                DumpSpikeDetectorFrames();
+                DetectorDumpDelay = -1;
+                DetectorCooldown = SpikeFrames.Count();
+                if (DetectorDumps >= PROFILER_SPIKE_MAX_DUMPS)
+                {
+                    LOG(Info, "Profiler spike detector reached the limit of {0} captures", PROFILER_SPIKE_MAX_DUMPS);
+                    Stop();
+                }
+            }
+        }
+        else if (DetectorCooldown > 0)
+        {
+            DetectorCooldown--;
+        }
+        else if (frameTime > SpikeThresholdMs)
+        {
+            LOG(Info, "Profiler spike detector detected frame spike ({0} ms) at frame {1}", (float)frameTime, Engine::FrameCount);
+            DetectorDumpDelay = PROFILER_SPIKE_DUMP_DELAY;
+        }
+        return;
+    }
+
+    // Spike mode: keep the last frames in memory until spike happens, then save them and capture the following frames
+    if (CaptureFile)
+    {
+        CaptureFile->WriteBytes(FrameData.GetHandle(), FrameData.GetPosition());
+        if (time >= SpikeEndTime)
+            Stop();
+        return;
+    }
+    auto& frame = SpikeFrames.AddOne();
+    frame.Time = time;
+    frame.Data.Set(FrameData.GetHandle(), FrameData.GetPosition());
+    while (SpikeFrames.Count() > 1 && SpikeFrames[0].Time < time - SpikeWindowMs)
+        SpikeFrames.RemoveAtKeepOrder(0);
+    const double frameTime = GetSpikeFrameTime(time);
+    if (frameTime > SpikeThresholdMs)
+    {
+        LOG(Info, "Profiler capture detected frame spike ({0} ms) at frame {1}", (float)frameTime, Engine::FrameCount);
+        if (OpenFile())
+        {
+            Stop();
+            return;
+        }
+        for (const auto& e : SpikeFrames)
+            CaptureFile->WriteBytes(e.Data.Get(), e.Data.Count());
+        SpikeFrames.Resize(0);
+        SpikeEndTime = time + SpikeWindowMs;
+    }
+}
+
+bool ProfilerCapture::ExportChromeTrace(const StringView& capturePath, const StringView& outputPath)
+{
+    PROFILE_CPU();
+    Array<byte> data;
+    if (File::ReadAllBytes(capturePath, data))
+    {
+        LOG(Error, "Cannot read profiler capture file '{0}'", capturePath);
+        return true;
+    }
+    MemoryReadStream stream(data.Get(), data.Count());
+    int32 magic = 0, version = 0;
+    stream.ReadInt32(&magic);
+    stream.ReadInt32(&version);
+    if (magic != PROFILER_CAPTURE_MAGIC || version != PROFILER_CAPTURE_VERSION)
+    {
+        LOG(Error, "Invalid profiler capture file '{0}'", capturePath);
+        return true;
+    }
+
+    // Convert records into trace events (times are in microseconds, GPU events are placed sequentially from the frame start since only their durations are known)
+    Array<String> names;
+    Array<int32> threadsWithName;
+    Array<double, InlinedAllocation<32>> gpuCursor;
+    double frameTime = 0.0;
+    const int32 gpuThreadId = 0;
+    StringBuilder sb;
+    sb.Append(TEXT("{\"traceEvents\":[\n"));
+    sb.Append(TEXT("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"GPU\"}}"));
+#define GET_NAME(id) (id >= 0 && id < names.Count() ? StringView(names[id]) : StringView(TEXT("?")))
+    while (stream.GetPosition() < stream.GetLength())
+    {
+        byte record;
+        stream.ReadByte(&record);
+        switch ((CaptureRecord)record)
+        {
+        case CaptureRecord::Name:
+        {
+            int32 id;
+            stream.ReadInt32(&id);
+            if (id < 0)
+                return true;
+            if (id >= names.Count())
+                names.Resize(id + 1);
+            stream.Read(names[id]);
+            break;
+        }
+        case CaptureRecord::Frame:
+        {
+            uint64 frameIndex, processMemory, gpuMemory;
+            int32 fps;
+            stream.ReadUint64(&frameIndex);
+            stream.ReadDouble(&frameTime);
+            stream.ReadInt32(&fps);
+            stream.ReadUint64(&processMemory);
+            stream.ReadUint64(&gpuMemory);
+            sb.AppendFormat(TEXT(",\n{{\"name\":\"Frame {0}\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":{1}}}"), frameIndex, frameTime * 1000.0);
+            sb.AppendFormat(TEXT(",\n{{\"name\":\"Memory\",\"ph\":\"C\",\"pid\":1,\"ts\":{0},\"args\":{{\"Process\":{1},\"GPU\":{2}}}}}"), frameTime * 1000.0, processMemory, gpuMemory);
+            sb.AppendFormat(TEXT(",\n{{\"name\":\"FPS\",\"ph\":\"C\",\"pid\":1,\"ts\":{0},\"args\":{{\"FPS\":{1}}}}}"), frameTime * 1000.0, fps);
+            break;
+        }
+        case CaptureRecord::ThreadEvents:
+        {
+            int32 threadId, count;
+            stream.ReadInt32(&threadId);
+            stream.ReadInt32(&count);
+            const int32 tid = threadId + 1;
+            if (!threadsWithName.Contains(tid))
+            {
+                threadsWithName.Add(tid);
+                sb.AppendFormat(TEXT(",\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{0},\"args\":{{\"name\":"), tid);
+                AppendJsonString(sb, GET_NAME(threadId));
+                sb.Append(TEXT("}}"));
+            }
+            for (int32 i = 0; i < count; i++)
+            {
+                double start;
+                float duration;
+                uint16 depth;
+                int32 nameId, nativeAlloc, managedAlloc;
+                stream.ReadDouble(&start);
+                stream.ReadFloat(&duration);
+                stream.ReadUint16(&depth);
+                stream.ReadInt32(&nameId);
+                stream.ReadInt32(&nativeAlloc);
+                stream.ReadInt32(&managedAlloc);
+                sb.Append(TEXT(",\n{\"name\":"));
+                AppendJsonString(sb, GET_NAME(nameId));
+                sb.AppendFormat(TEXT(",\"cat\":\"CPU\",\"ph\":\"X\",\"pid\":1,\"tid\":{0},\"ts\":{1},\"dur\":{2}"), tid, start * 1000.0, duration * 1000.0);
+                if (nativeAlloc != 0 || managedAlloc != 0)
+                    sb.AppendFormat(TEXT(",\"args\":{{\"NativeAlloc\":{0},\"ManagedAlloc\":{1}}}"), nativeAlloc, managedAlloc);
+                sb.Append(TEXT('}'));
+            }
+            break;
+        }
+        case CaptureRecord::GPUEvents:
+        {
+            int32 count;
+            stream.ReadInt32(&count);
+            gpuCursor.Clear();
+            gpuCursor.Add(frameTime);
+            for (int32 i = 0; i < count; i++)
+            {
+                float duration;
+                uint16 depth;
+                int32 nameId, drawCalls;
+                stream.ReadFloat(&duration);
+                stream.ReadUint16(&depth);
+                stream.ReadInt32(&nameId);
+                stream.ReadInt32(&drawCalls);
+                while (gpuCursor.Count() <= depth + 1)
+                    gpuCursor.Add(gpuCursor.Last());
+                const double start = gpuCursor[depth];
+                gpuCursor[depth] = start + duration;
+                gpuCursor[depth + 1] = start;
+                sb.Append(TEXT(",\n{\"name\":"));
+                AppendJsonString(sb, GET_NAME(nameId));
+                sb.AppendFormat(TEXT(",\"cat\":\"GPU\",\"ph\":\"X\",\"pid\":1,\"tid\":{0},\"ts\":{1},\"dur\":{2},\"args\":{{\"DrawCalls\":{3}}}}}"), gpuThreadId, start * 1000.0, duration * 1000.0, drawCalls);
+            }
+            break;
+        }
+        case CaptureRecord::NetworkEvents:
+        {
+            int32 count;
+            stream.ReadInt32(&count);
+            uint32 sent = 0, received = 0;
+            for (int32 i = 0; i < count; i++)
+            {
+                int32 nameId;
+                uint16 eventsCount, dataSize, receivedCount;
+                uint32 receivedDataSize;
+                stream.ReadInt32(&nameId);
+                stream.ReadUint16(&eventsCount);
+                stream.ReadUint16(&dataSize);
+                stream.ReadUint16(&receivedCount);
+                stream.ReadUint32(&receivedDataSize);
+                sent += dataSize;
+                received += receivedDataSize;
+            }
+            sb.AppendFormat(TEXT(",\n{{\"name\":\"Network\",\"ph\":\"C\",\"pid\":1,\"ts\":{0},\"args\":{{\"Sent\":{1},\"Received\":{2}}}}}"), frameTime * 1000.0, sent, received);
+            break;
+        }
+        default:
+            LOG(Error, "Corrupted profiler capture file '{0}'", capturePath);
+            return true;
+        }
+    }
+#undef GET_NAME
+    sb.Append(TEXT("\n]}\n"));
+
+    if (File::WriteAllText(outputPath, sb, Encoding::UTF8))
+    {
+        LOG(Error, "Cannot save Chrome trace file '{0}'", outputPath);
+        return true;
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,69 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_PROFILER
+
+#include "Engine/Core/Types/String.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Profiler capture that streams the profiling events (CPU threads, GPU, memory and network) to a compact binary file. Works in every build with profiler (eg. development game or dedicated server), without the Editor.
+/// </summary>
+/// <remarks>
+/// Can be started with '-profilecapture !path!' command line argument. Use '-profilecapturespike !ms!' to capture only the frames around the first frame that took longer than the specified time (and '-profilecaptureseconds !seconds!' to control the captured time window). Use '-profilespikes !ms!' to run the spike detector that saves the last frames after every spike into the Logs folder (and '-profilespikeframes !count!' to control the amount of frames). Captured data can be exported into Chrome trace format (viewable in Chrome, Perfetto or Tracy via its import-chrome tool).
+/// </remarks>
+API_CLASS(Static) class FLAXENGINE_API ProfilerCapture
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerCapture);
+    friend class ProfilingToolsService;
+
+public:
+    /// <summary>
+    /// Checks if the capture is active (recording events or waiting for a frame spike).
+    /// </summary>
+    API_PROPERTY() static bool IsCapturing();
+
+    /// <summary>
+    /// Starts capturing the profiling events of every frame to the file.
+    /// </summary>
+    /// <param name="path">The output capture file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool Start(const StringView& path);
+
+    /// <summary>
+    /// Starts capturing the profiling events to the memory and saves them to the file around the first frame spike (frames before and after it).
+    /// </summary>
+    /// <param name="path">The output capture file path.</param>
+    /// <param name="thresholdMs">The frame duration (in milliseconds) that is considered as a spike.</param>
+    /// <param name="seconds">The captured time window (in seconds) before and after the spike.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartSpike(const StringView& path, float thresholdMs, float seconds = 2.0f);
+
+    /// <summary>
+    /// Starts the frame spike detector that keeps the events of the last frames in memory and saves them to a new file in the folder every time a frame exceeds the threshold. Can be left running in production builds to diagnose rare hitches.
+    /// </summary>
+    /// <param name="folder">The output folder for the spike capture files.</param>
+    /// <param name="thresholdMs">The frame duration (in milliseconds) that is considered as a spike. Frame duration is the time between frames or the GPU time of the frame (whichever is larger).</param>
+    /// <param name="framesCount">The amount of the last frames to keep in memory and save on spike.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool StartSpikeDetector(const StringView& folder, float thresholdMs, int32 framesCount = 300);
+
+    /// <summary>
+    /// Stops the capture and closes the file.
+    /// </summary>
+    API_FUNCTION() static void Stop();
+
+    /// <summary>
+    /// Exports the captured profiling events to the Chrome trace format (JSON).
+    /// </summary>
+    /// <param name="capturePath">The capture file path.</param>
+    /// <param name="outputPath">The output trace file path.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    API_FUNCTION() static bool ExportChromeTrace(const StringView& capturePath, const StringView& outputPath);
+
+private:
+    static void OnUpdate();
+};
+
+#endif
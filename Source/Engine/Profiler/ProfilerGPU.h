@@ -6,6 +6,7 @@
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "RenderStats.h"
+#include "Engine/Graphics/GPUPipelineStatistics.h"
 
 class GPUTimerQuery;
 
@@ -45,6 +46,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
         /// </summary>
         API_FIELD() RenderStatsData Stats;
 
+        /// <summary>
+        /// The pipeline statistics (shader invocations and primitives counts) for this event. Gathered only when PipelineStatistics is enabled and supported by the device, otherwise zeros.
+        /// </summary>
+        API_FIELD() GPUPipelineStatistics PipelineStats;
+
         /// <summary>
         /// The event execution time on a GPU (in milliseconds).
         /// </summary>
@@ -134,6 +140,11 @@ API_CLASS(Static) class FLAXENGINE_API ProfilerGPU
     /// </summary>
     API_FIELD() static bool Enabled;
 
+    /// <summary>
+    /// True if collect the pipeline statistics (shader invocations and primitives counts) for GPU profiler events (if supported by the device, see GPULimits::HasPipelineStatistics). Adds more queries overhead so it's disabled by default.
+    /// </summary>
+    API_FIELD() static bool PipelineStatistics;
+
     /// <summary>
     /// The current frame buffer to collect events.
     /// </summary>
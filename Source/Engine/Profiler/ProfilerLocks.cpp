@@ -0,0 +1,191 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ProfilerLocks.h"
+
+#if COMPILE_WITH_LOCKS_PROFILER
+
+#include "ProfilerCPU.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/Platform.h"
+
+namespace
+{
+    // Note: registry lock is not profiled (it's used by the profiler itself)
+    CriticalSection RegistryLocker;
+    Array<ProfilerLockData*> Registry;
+
+    void ClearStats(ProfilerLockData* data)
+    {
+        data->LockCount = 0;
+        data->ContentionCount = 0;
+        data->WaitTime = 0.0;
+        data->MaxWaitTime = 0.0;
+        data->HoldTime = 0.0;
+        data->MaxHoldTime = 0.0;
+        data->ConditionWaitTime = 0.0;
+    }
+
+    bool SortByWaitTime(const ProfilerLocks::LockStats& a, const ProfilerLocks::LockStats& b)
+    {
+        return a.WaitTimeMs > b.WaitTimeMs;
+    }
+}
+
+bool ProfilerLocks::Enabled = false;
+
+void ProfilerLocks::Register(const CriticalSection& lock, const char* name)
+{
+    ScopeLock registryLock(RegistryLocker);
+    if (lock._profilerData)
+    {
+        lock._profilerData->Name = name;
+        return;
+    }
+    auto data = New<ProfilerLockData>();
+    data->Name = name;
+    data->OwnerThreadId = 0;
+    data->LockTime = 0.0;
+    data->Depth = 0;
+    ClearStats(data);
+    Registry.Add(data);
+    lock._profilerData = data;
+}
+
+void ProfilerLocks::GetStats(Array<LockStats>& result)
+{
+    result.Clear();
+    ScopeLock registryLock(RegistryLocker);
+    for (const ProfilerLockData* data : Registry)
+    {
+        // Aggregate stats by name (eg. the same locker used by every scene)
+        LockStats* stats = nullptr;
+        for (auto& e : result)
+        {
+            if (StringUtils::Compare(e.Name, data->Name) == 0)
+            {
+                stats = &e;
+                break;
+            }
+        }
+        if (!stats)
+        {
+            stats = &result.AddOne();
+            Platform::MemoryClear(stats, sizeof(LockStats));
+            stats->Name = data->Name;
+        }
+        stats->InstancesCount++;
+        stats->LockCount += data->LockCount;
+        stats->ContentionCount += data->ContentionCount;
+        stats->WaitTimeMs += data->WaitTime;
+        stats->MaxWaitTimeMs = Math::Max(stats->MaxWaitTimeMs, data->MaxWaitTime);
+        stats->HoldTimeMs += data->HoldTime;
+        stats->MaxHoldTimeMs = Math::Max(stats->MaxHoldTimeMs, data->MaxHoldTime);
+        stats->ConditionWaitTimeMs += data->ConditionWaitTime;
+        if (data->OwnerThreadId != 0)
+            stats->OwnerThreadId = data->OwnerThreadId;
+    }
+    Sorting::QuickSort(result.Get(), result.Count(), &SortByWaitTime);
+}
+
+void ProfilerLocks::Reset()
+{
+    ScopeLock registryLock(RegistryLocker);
+    for (ProfilerLockData* data : Registry)
+        ClearStats(data);
+}
+
+void ProfilerLocks::Dump()
+{
+    Array<LockStats> stats;
+    GetStats(stats);
+    LOG(Info, "Locks profiling stats:");
+    for (const LockStats& e : stats)
+    {
+        if (e.LockCount == 0)
+            continue;
+        LOG(Info, "{0} (x{1}): locks: {2}, contended: {3}, wait: {4} ms (max {5} ms), hold: {6} ms (max {7} ms), condition wait: {8} ms",
+            String(e.Name), e.InstancesCount, e.LockCount, e.ContentionCount,
+            (float)e.WaitTimeMs, (float)e.MaxWaitTimeMs, (float)e.HoldTimeMs, (float)e.MaxHoldTimeMs, (float)e.ConditionWaitTimeMs);
+    }
+}
+
+void ProfilerLocks::OnUnregister(ProfilerLockData* data)
+{
+    ScopeLock registryLock(RegistryLocker);
+    Registry.Remove(data);
+    Delete(data);
+}
+
+ProfilerLocks::Wait ProfilerLocks::OnWaitBegin(ProfilerLockData* data)
+{
+    Wait wait;
+    if (Enabled)
+    {
+        wait.Start = Platform::GetTimeSeconds();
+        wait.Event = ProfilerCPU::BeginEvent(data->Name);
+    }
+    else
+    {
+        wait.Start = 0.0;
+        wait.Event = -1;
+    }
+    return wait;
+}
+
+void ProfilerLocks::OnWaitEnd(ProfilerLockData* data, const Wait& wait)
+{
+    // Called after acquiring the lock so stats can be updated without atomics
+    ProfilerCPU::EndEvent(wait.Event);
+    if (wait.Start > 0.0)
+    {
+        const double time = (Platform::GetTimeSeconds() - wait.Start) * 1000.0;
+        data->ContentionCount++;
+        data->WaitTime += time;
+        data->MaxWaitTime = Math::Max(data->MaxWaitTime, time);
+    }
+}
+
+void ProfilerLocks::OnLocked(ProfilerLockData* data)
+{
+    if (data->Depth++ != 0)
+        return;
+    data->OwnerThreadId = Platform::GetCurrentThreadID();
+    if (Enabled)
+    {
+        data->LockTime = Platform::GetTimeSeconds();
+        data->LockCount++;
+    }
+}
+
+void ProfilerLocks::OnUnlocked(ProfilerLockData* data)
+{
+    if (--data->Depth != 0)
+        return;
+    data->OwnerThreadId = 0;
+    if (data->LockTime > 0.0)
+    {
+        const double time = (Platform::GetTimeSeconds() - data->LockTime) * 1000.0;
+        data->LockTime = 0.0;
+        data->HoldTime += time;
+        data->MaxHoldTime = Math::Max(data->MaxHoldTime, time);
+    }
+}
+
+double ProfilerLocks::OnConditionWaitBegin(ProfilerLockData* data)
+{
+    // Condition variable releases the lock for the time of waiting (non-recursive lock is expected)
+    OnUnlocked(data);
+    return Enabled ? Platform::GetTimeSeconds() : 0.0;
+}
+
+void ProfilerLocks::OnConditionWaitEnd(ProfilerLockData* data, double start)
+{
+    OnLocked(data);
+    if (start > 0.0)
+        data->ConditionWaitTime += (Platform::GetTimeSeconds() - start) * 1000.0;
+}
+
+#endif
@@ -0,0 +1,121 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Platform/Types.h"
+
+// Enables locks contention profiling support in the platform critical sections (only named locks are profiled, see PROFILE_LOCK)
+#define COMPILE_WITH_LOCKS_PROFILER (COMPILE_WITH_PROFILER && (PLATFORM_WIN32 || PLATFORM_UNIX))
+
+#if COMPILE_WITH_LOCKS_PROFILER
+
+/// <summary>
+/// The profiling data of a single named lock. Modified only by the thread that owns the lock (stats reading is not synchronized).
+/// </summary>
+struct ProfilerLockData
+{
+    const char* Name;
+    uint64 OwnerThreadId;
+    double LockTime;
+    int32 Depth;
+    int64 LockCount;
+    int64 ContentionCount;
+    double WaitTime;
+    double MaxWaitTime;
+    double HoldTime;
+    double MaxHoldTime;
+    double ConditionWaitTime;
+};
+
+/// <summary>
+/// Provides locks contention profiling (wait and hold times of the named critical sections). Opt-in via '-profilelocks' command line argument or by setting Enabled property.
+/// </summary>
+class FLAXENGINE_API ProfilerLocks
+{
+public:
+    /// <summary>
+    /// The lock stats (aggregated for all locks with the same name).
+    /// </summary>
+    struct LockStats
+    {
+        // The lock name.
+        const char* Name;
+        // The amount of lock instances with that name.
+        int32 InstancesCount;
+        // The amount of locks acquires (excluding recursive locks).
+        int64 LockCount;
+        // The amount of locks acquires that had to wait for the other thread to release the lock.
+        int64 ContentionCount;
+        // The total time spent on waiting for the lock (in milliseconds).
+        double WaitTimeMs;
+        // The longest wait for the lock (in milliseconds).
+        double MaxWaitTimeMs;
+        // The total time the lock was held (in milliseconds).
+        double HoldTimeMs;
+        // The longest time the lock was held (in milliseconds).
+        double MaxHoldTimeMs;
+        // The total time spent on waiting for the condition variables using this lock (in milliseconds).
+        double ConditionWaitTimeMs;
+        // The ID of the thread that currently owns the lock (or the last lock instance with that name), zero if not locked.
+        uint64 OwnerThreadId;
+    };
+
+    /// <summary>
+    /// Wait token used to track the contended lock wait.
+    /// </summary>
+    struct Wait
+    {
+        double Start;
+        int32 Event;
+    };
+
+public:
+    /// <summary>
+    /// Enables locks profiling. Contended waits are also emitted as CPU profiler events.
+    /// </summary>
+    static bool Enabled;
+
+    /// <summary>
+    /// Assigns the name to the critical section to include it in the locks profiling.
+    /// </summary>
+    /// <param name="lock">The lock.</param>
+    /// <param name="name">The lock name (must be a static string).</param>
+    static void Register(const CriticalSection& lock, const char* name);
+
+    /// <summary>
+    /// Gets the stats of all the registered locks.
+    /// </summary>
+    /// <param name="result">The output stats (sorted by the wait time).</param>
+    static void GetStats(Array<LockStats, HeapAllocation>& result);
+
+    /// <summary>
+    /// Resets the stats of all the registered locks.
+    /// </summary>
+    static void Reset();
+
+    /// <summary>
+    /// Prints the locks stats to the log.
+    /// </summary>
+    static void Dump();
+
+public:
+    // Internal hooks used by the platform critical sections and condition variables
+    static void OnUnregister(ProfilerLockData* data);
+    static Wait OnWaitBegin(ProfilerLockData* data);
+    static void OnWaitEnd(ProfilerLockData* data, const Wait& wait);
+    static void OnLocked(ProfilerLockData* data);
+    static void OnUnlocked(ProfilerLockData* data);
+    static double OnConditionWaitBegin(ProfilerLockData* data);
+    static void OnConditionWaitEnd(ProfilerLockData* data, double start);
+};
+
+// Assigns the name to the critical section to profile its contention (no-op if locks profiling is not compiled)
+#define PROFILE_LOCK(lock, name) ProfilerLocks::Register(lock, name)
+
+#else
+
+// Assigns the name to the critical section to profile its contention (no-op if locks profiling is not compiled)
+#define PROFILE_LOCK(lock, name)
+
+#endif
@@ -0,0 +1,166 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_PROFILER
+
+#include "ProfilerMemory.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Platform/CriticalSection.h"
+#include <ThirdParty/tracy/tracy/Tracy.hpp>
+
+// The amount of the allocations table shards (each with a separate lock to reduce contention)
+#define PROFILER_MEMORY_SHARDS 16
+
+bool ProfilerMemory::Enabled = false;
+
+namespace
+{
+    struct AllocationData
+    {
+        uint64 Size;
+        ProfilerMemory::Groups Group;
+    };
+
+    struct AllocationsShard
+    {
+        CriticalSection Locker;
+        FlatDictionary<void*, AllocationData> Allocations;
+    };
+
+    struct GroupData
+    {
+        volatile int64 CurrentBytes;
+        volatile int64 PeakBytes;
+        volatile int64 FrameBytes;
+        volatile int64 FrameAllocations;
+        int64 LastFrameBytes;
+        int64 LastFrameAllocations;
+    };
+
+    AllocationsShard Shards[PROFILER_MEMORY_SHARDS];
+    GroupData GroupsData[(int32)ProfilerMemory::Groups::MAX];
+    THREADLOCAL ProfilerMemory::Groups CurrentGroup = ProfilerMemory::Groups::Unknown;
+    THREADLOCAL bool InsideTracking = false;
+
+    const char* GroupsPlotNames[] =
+    {
+        "Memory/Unknown",
+        "Memory/Rendering",
+        "Memory/Graphics",
+        "Memory/Physics",
+        "Memory/Content",
+        "Memory/Scripting",
+        "Memory/Audio",
+        "Memory/Animations",
+        "Memory/Particles",
+        "Memory/Level",
+        "Memory/Networking",
+        "Memory/UI",
+        "Memory/Navigation",
+    };
+    static_assert(ARRAY_COUNT(GroupsPlotNames) == (int32)ProfilerMemory::Groups::MAX, "Update memory groups names.");
+
+    FORCE_INLINE AllocationsShard& GetShard(void* ptr)
+    {
+        const uintptr address = (uintptr)ptr;
+        return Shards[((address >> 4) ^ (address >> 12)) & (PROFILER_MEMORY_SHARDS - 1)];
+    }
+}
+
+Array<ProfilerMemory::GroupStats> ProfilerMemory::GetStats()
+{
+    Array<GroupStats> result;
+    result.Resize((int32)Groups::MAX);
+    for (int32 i = 0; i < result.Count(); i++)
+    {
+        const GroupData& data = GroupsData[i];
+        GroupStats& stats = result[i];
+        stats.Group = (Groups)i;
+        stats.CurrentBytes = Platform::AtomicRead(&data.CurrentBytes);
+        stats.PeakBytes = Platform::AtomicRead(&data.PeakBytes);
+        stats.FrameBytes = data.LastFrameBytes;
+        stats.FrameAllocations = (int32)data.LastFrameAllocations;
+    }
+    return result;
+}
+
+ProfilerMemory::Groups ProfilerMemory::GetGroup()
+{
+    return CurrentGroup;
+}
+
+void ProfilerMemory::SetGroup(Groups group)
+{
+    CurrentGroup = group;
+}
+
+void ProfilerMemory::OnAlloc(void* ptr, uint64 size)
+{
+    if (InsideTracking)
+        return;
+    InsideTracking = true;
+
+    // Register allocation
+    const Groups group = CurrentGroup;
+    AllocationsShard& shard = GetShard(ptr);
+    shard.Locker.Lock();
+    shard.Allocations[ptr] = { size, group };
+    shard.Locker.Unlock();
+
+    // Update stats
+    GroupData& data = GroupsData[(int32)group];
+    const int64 current = Platform::InterlockedAdd(&data.CurrentBytes, (int64)size) + (int64)size;
+    if (current > Platform::AtomicRead(&data.PeakBytes))
+        Platform::AtomicStore(&data.PeakBytes, current);
+    Platform::InterlockedAdd(&data.FrameBytes, (int64)size);
+    Platform::InterlockedIncrement(&data.FrameAllocations);
+
+    InsideTracking = false;
+}
+
+void ProfilerMemory::OnFree(void* ptr)
+{
+    if (InsideTracking)
+        return;
+    InsideTracking = true;
+
+    // Unregister allocation (skip allocations made before tracking was enabled)
+    AllocationData allocation;
+    AllocationsShard& shard = GetShard(ptr);
+    shard.Locker.Lock();
+    const bool found = shard.Allocations.TryGet(ptr, allocation);
+    if (found)
+        shard.Allocations.Remove(ptr);
+    shard.Locker.Unlock();
+    if (found)
+        Platform::InterlockedAdd(&GroupsData[(int32)allocation.Group].CurrentBytes, -(int64)allocation.Size);
+
+    InsideTracking = false;
+}
+
+void ProfilerMemory::Update()
+{
+    if (!Enabled)
+        return;
+    for (int32 i = 0; i < (int32)Groups::MAX; i++)
+    {
+        GroupData& data = GroupsData[i];
+        data.LastFrameBytes = Platform::InterlockedExchange(&data.FrameBytes, 0);
+        data.LastFrameAllocations = Platform::InterlockedExchange(&data.FrameAllocations, 0);
+        TracyPlot(GroupsPlotNames[i], (int64_t)Platform::AtomicRead(&data.CurrentBytes));
+    }
+}
+
+void ProfilerMemory::Dispose()
+{
+    Enabled = false;
+    for (auto& shard : Shards)
+    {
+        shard.Locker.Lock();
+        InsideTracking = true;
+        shard.Allocations.SetCapacity(0, false);
+        InsideTracking = false;
+        shard.Locker.Unlock();
+    }
+}
+
+#endif
@@ -0,0 +1,143 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Types/BaseTypes.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+#if COMPILE_WITH_PROFILER
+
+/// <summary>
+/// Provides memory allocations tracking per engine subsystem. Allocations are assigned to the group active on the allocating thread (see PROFILE_MEM).
+/// </summary>
+API_CLASS(Static) class FLAXENGINE_API ProfilerMemory
+{
+    DECLARE_SCRIPTING_TYPE_NO_SPAWN(ProfilerMemory);
+public:
+    /// <summary>
+    /// The memory allocation groups (engine subsystems).
+    /// </summary>
+    API_ENUM() enum class Groups : uint8
+    {
+        // Not categorized allocations.
+        Unknown,
+        // Rendering allocations (render lists, passes and buffers).
+        Rendering,
+        // Graphics device allocations (resources and pipeline states).
+        Graphics,
+        // Physics simulation allocations.
+        Physics,
+        // Content assets allocations.
+        Content,
+        // Scripting allocations.
+        Scripting,
+        // Audio allocations.
+        Audio,
+        // Animations allocations.
+        Animations,
+        // Particles allocations.
+        Particles,
+        // Level and scene objects allocations.
+        Level,
+        // Networking allocations.
+        Networking,
+        // User interface allocations.
+        UI,
+        // Navigation allocations.
+        Navigation,
+
+        API_ENUM(Attributes="HideInEditor")
+        MAX
+    };
+
+    /// <summary>
+    /// The memory allocations group stats.
+    /// </summary>
+    API_STRUCT(NoDefault) struct GroupStats
+    {
+        DECLARE_SCRIPTING_TYPE_MINIMAL(GroupStats);
+
+        /// <summary>
+        /// The allocations group.
+        /// </summary>
+        API_FIELD() Groups Group;
+
+        /// <summary>
+        /// The amount of the currently allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 CurrentBytes;
+
+        /// <summary>
+        /// The peak amount of the allocated memory (in bytes).
+        /// </summary>
+        API_FIELD() int64 PeakBytes;
+
+        /// <summary>
+        /// The amount of the memory allocated during the last frame (in bytes).
+        /// </summary>
+        API_FIELD() int64 FrameBytes;
+
+        /// <summary>
+        /// The amount of the allocations during the last frame.
+        /// </summary>
+        API_FIELD() int32 FrameAllocations;
+    };
+
+    /// <summary>
+    /// Helper structure used to assign allocations to the group within a scope (restores the previous group on exit).
+    /// </summary>
+    struct GroupScope
+    {
+        Groups Previous;
+
+        GroupScope(Groups group)
+        {
+            Previous = GetGroup();
+            SetGroup(group);
+        }
+
+        ~GroupScope()
+        {
+            SetGroup(Previous);
+        }
+    };
+
+public:
+    /// <summary>
+    /// Enables the memory allocations tracking (adds overhead to every allocation, allocations made before enabling are not tracked). Can be enabled on startup with -profilememory command line switch.
+    /// </summary>
+    API_FIELD() static bool Enabled;
+
+    /// <summary>
+    /// Gets the memory allocations stats of all groups.
+    /// </summary>
+    /// <returns>The stats of each group (indexed by the group).</returns>
+    API_FUNCTION() static Array<GroupStats> GetStats();
+
+    /// <summary>
+    /// Gets the allocations group active on the current thread.
+    /// </summary>
+    static Groups GetGroup();
+
+    /// <summary>
+    /// Sets the allocations group active on the current thread.
+    /// </summary>
+    /// <param name="group">The group.</param>
+    static void SetGroup(Groups group);
+
+public:
+    static void OnAlloc(void* ptr, uint64 size);
+    static void OnFree(void* ptr);
+    static void Update();
+    static void Dispose();
+};
+
+// Assigns the memory allocations within the current scope to the given group (eg. PROFILE_MEM(Rendering))
+#define PROFILE_MEM(group) ProfilerMemory::GroupScope ProfileMem(ProfilerMemory::Groups::group)
+
+#else
+
+#define PROFILE_MEM(group)
+
+#endif
@@ -3,8 +3,13 @@
 #if COMPILE_WITH_PROFILER
 
 #include "ProfilingTools.h"
+#include "ProfilerMemory.h"
+#include "ProfilerCapture.h"
+#include "ProfilerLocks.h"
 #include "Engine/Core/Types/Pair.h"
 #include "Engine/Engine/Engine.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
 #include "Engine/Engine/Time.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Graphics/GPUDevice.h"
@@ -24,17 +29,58 @@ class ProfilingToolsService : public EngineService
         Platform::MemoryClear(&ProfilingTools::Stats, sizeof(ProfilingTools::MainStats));
     }
 
+    bool Init() override;
     void Update() override;
     void Dispose() override;
 };
 
 ProfilingToolsService ProfilingToolsServiceInstance;
 
+bool ProfilingToolsService::Init()
+{
+#if COMPILE_WITH_LOCKS_PROFILER
+    ProfilerLocks::Enabled = CommandLine::Options.ProfileLocks.IsTrue();
+#endif
+    if (CommandLine::Options.ProfileGPUStats.IsTrue())
+        ProfilerGPU::PipelineStatistics = true;
+
+    // Start profiler capture from the command line
+    if (CommandLine::Options.ProfileCapture.HasValue())
+    {
+        const String& path = CommandLine::Options.ProfileCapture.GetValue();
+        float spikeMs = 0.0f, seconds = 2.0f;
+        if (CommandLine::Options.ProfileCaptureSpike.HasValue())
+            StringUtils::Parse(CommandLine::Options.ProfileCaptureSpike.GetValue().Get(), &spikeMs);
+        if (CommandLine::Options.ProfileCaptureSeconds.HasValue())
+            StringUtils::Parse(CommandLine::Options.ProfileCaptureSeconds.GetValue().Get(), &seconds);
+        if (spikeMs > 0.0f)
+            ProfilerCapture::StartSpike(path, spikeMs, seconds);
+        else
+            ProfilerCapture::Start(path);
+    }
+    else if (CommandLine::Options.ProfileSpikes.HasValue())
+    {
+        float thresholdMs = 0.0f;
+        int32 framesCount = 300;
+        StringUtils::Parse(CommandLine::Options.ProfileSpikes.GetValue().Get(), &thresholdMs);
+        if (CommandLine::Options.ProfileSpikeFrames.HasValue())
+            StringUtils::Parse(CommandLine::Options.ProfileSpikeFrames.GetValue().Get(), &framesCount);
+#if USE_EDITOR
+        const String folder = Globals::ProjectFolder / TEXT("Logs");
+#else
+        const String folder = Globals::ProductLocalFolder / TEXT("Logs");
+#endif
+        ProfilerCapture::StartSpikeDetector(folder, thresholdMs, framesCount);
+    }
+    return false;
+}
+
 void ProfilingToolsService::Update()
 {
     ZoneScoped;
 
     // Capture stats
+    ProfilerMemory::Update();
     {
         auto& stats = ProfilingTools::Stats;
 
@@ -138,6 +184,10 @@ void ProfilingToolsService::Update()
             dst.DataSize = src.DataSize;
             dst.MessageSize = src.MessageSize;
             dst.Receivers = src.Receivers;
+            dst.ReceivedCount = src.ReceivedCount;
+            dst.ReceivedDataSize = src.ReceivedDataSize;
+            dst.SerializeTime = src.SerializeTime;
+            dst.DeserializeTime = src.DeserializeTime;
             const StringAnsiView& typeName = e.Key.First.GetType().Fullname;
             uint64 len = Math::Min<uint64>(typeName.Length(), ARRAY_COUNT(dst.Name) - 10);
             Platform::MemoryCopy(dst.Name, typeName.Get(), len);
@@ -159,6 +209,9 @@ void ProfilingToolsService::Update()
         NetworkInternal::ProfilerEvents.Clear();
     }
 
+    // Stream the frame events to the capture file
+    ProfilerCapture::OnUpdate();
+
 #if 0
     // Print CPU events to the log
     {
@@ -209,6 +262,12 @@ void ProfilingToolsService::Update()
 
 void ProfilingToolsService::Dispose()
 {
+    ProfilerCapture::Stop();
+#if COMPILE_WITH_LOCKS_PROFILER
+    if (ProfilerLocks::Enabled)
+        ProfilerLocks::Dump();
+    ProfilerLocks::Enabled = false;
+#endif
     ProfilingTools::EventsCPU.Clear();
     ProfilingTools::EventsCPU.SetCapacity(0);
     ProfilingTools::EventsGPU.SetCapacity(0);
@@ -120,6 +120,14 @@ API_CLASS(Static) class FLAXENGINE_API ProfilingTools
         API_FIELD() uint16 MessageSize;
         // Amount of peers that will receive this message.
         API_FIELD() uint16 Receivers;
+        // Amount of received occurrences.
+        API_FIELD() uint16 ReceivedCount;
+        // Received data size (in bytes).
+        API_FIELD() uint32 ReceivedDataSize;
+        // Total time spent on data serialization when sending (in milliseconds).
+        API_FIELD() float SerializeTime;
+        // Total time spent on data deserialization (including RPC execution) when receiving (in milliseconds).
+        API_FIELD() float DeserializeTime;
         API_FIELD(Private, NoArray) byte Name[120];
     };
 
@@ -7,6 +7,12 @@
 #include "Engine/Threading/Threading.h"
 #include "IncludeFreeType.h"
 
+// The maximum amount of cached text layouts per font (the least recently used ones get evicted)
+#define FONT_LAYOUT_CACHE_SIZE 256
+
+// The maximum length of the text to cache its layout (longer texts are usually edited and change often)
+#define FONT_LAYOUT_CACHE_MAX_TEXT 1024
+
 Array<AssetReference<FontAsset>, HeapAllocation> Font::FallbackFonts;
 
 Font::Font(FontAsset* parentAsset, float size)
@@ -31,11 +37,56 @@ Font::Font(FontAsset* parentAsset, float size)
 Font::~Font()
 {
     if (_asset)
+    {
         _asset->_fonts.Remove(this);
+        for (Font* font : _asset->_fonts)
+        {
+            if (font->_sdfFont == this)
+                font->_sdfFont = nullptr;
+        }
+    }
+}
+
+bool Font::IsSDF() const
+{
+    return _asset && EnumHasAnyFlags(_asset->GetOptions().Flags, FontFlags::SDF);
+}
+
+float Font::GetGlyphScale() const
+{
+    return IsSDF() ? _size / FontSDFSize : 1.0f;
 }
 
 void Font::GetCharacter(Char c, FontCharacterEntry& result, bool enableFallback)
 {
+    // Signed distance field fonts share glyphs rasterized at the fixed size so use them with scaled metrics
+    if (_size != FontSDFSize && IsSDF())
+    {
+        if (!_sdfFont)
+            _sdfFont = _asset->CreateFont(FontSDFSize);
+        if (_sdfFont)
+        {
+            _sdfFont->GetCharacter(c, result, enableFallback);
+            if (result.Font != _sdfFont)
+            {
+                // Fallback font has been used so get its character in this font size
+                FontAsset* fallbackAsset = result.Font->GetAsset();
+                Font* fallbackFont = fallbackAsset ? fallbackAsset->CreateFont(_size) : nullptr;
+                if (fallbackFont)
+                    fallbackFont->GetCharacter(c, result, false);
+                return;
+            }
+            const float scale = _size / FontSDFSize;
+            result.OffsetX = (int16)Math::RoundToInt(result.OffsetX * scale);
+            result.OffsetY = (int16)Math::RoundToInt(result.OffsetY * scale);
+            result.AdvanceX = (int16)Math::RoundToInt(result.AdvanceX * scale);
+            result.BearingY = (int16)Math::RoundToInt(result.BearingY * scale);
+            result.Height = (int16)Math::RoundToInt(result.Height * scale);
+            result.Font = this;
+            return;
+        }
+    }
+
     // Try to get the character or cache it if cannot be found
     if (!_characters.TryGet(c, result))
     {
@@ -117,9 +168,58 @@ void Font::Invalidate()
         FontManager::Invalidate(i->Value);
     }
     _characters.Clear();
+    _layoutCache.Clear();
 }
 
 void Font::ProcessText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
+{
+    if (text.Length() == 0)
+        return;
+    if (text.Length() > FONT_LAYOUT_CACHE_MAX_TEXT || outputLines.HasItems() || !_asset)
+    {
+        LayoutText(text, outputLines, layout);
+        return;
+    }
+
+    // Reuse the layout of the same text (eg. static labels are processed every frame)
+    // Note: bounds location doesn't affect the lines layout (text can be moved around without invalidating it)
+    TextLayoutOptions key = layout;
+    key.Bounds.Location = Float2::Zero;
+    uint32 hash = GetHash(text);
+    CombineHash(hash, GetHash(key.Bounds.Size.X));
+    CombineHash(hash, GetHash(key.Bounds.Size.Y));
+    CombineHash(hash, GetHash(key.Scale));
+    CombineHash(hash, (uint32)key.HorizontalAlignment | (uint32)key.VerticalAlignment << 8 | (uint32)key.TextWrapping << 16);
+    ScopeLock lock(_asset->Locker);
+    TextLayoutCache* cache = _layoutCache.TryGet(hash);
+    if (cache && cache->Layout == key && cache->FontScale == FontManager::FontScale && cache->Text == text)
+    {
+        cache->LastUsed = ++_layoutCacheCounter;
+        outputLines.Add(cache->Lines);
+        return;
+    }
+    if (!cache && _layoutCache.Count() >= FONT_LAYOUT_CACHE_SIZE)
+    {
+        // Evict the least recently used layout
+        auto lru = _layoutCache.Begin();
+        for (auto i = _layoutCache.Begin(); i.IsNotEnd(); ++i)
+        {
+            if (i->Value.LastUsed < lru->Value.LastUsed)
+                lru = i;
+        }
+        _layoutCache.Remove(lru);
+    }
+    cache = &_layoutCache[hash];
+    cache->Text = text;
+    cache->Layout = key;
+    cache->FontScale = FontManager::FontScale;
+    cache->LastUsed = ++_layoutCacheCounter;
+    cache->Lines.Clear();
+    LayoutText(text, cache->Lines, layout);
+    outputLines.Add(cache->Lines);
+}
+
+void Font::LayoutText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout)
 {
     int32 textLength = text.Length();
     if (textLength == 0)
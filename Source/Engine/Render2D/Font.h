@@ -15,6 +15,12 @@ struct FontTextureAtlasSlot;
 // The default DPI that engine is using
 #define DefaultDPI 96
 
+// The font size used to rasterize signed distance field glyphs (shared by all sizes of the font)
+#define FontSDFSize 32.0f
+
+// The distance (in pixels) of the signed distance field around the glyph edges
+#define FontSDFSpread 6
+
 /// <summary>
 /// The text range.
 /// </summary>
@@ -230,8 +236,18 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
 {
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(Font);
     friend FontAsset;
+    friend class FontManagerService;
 
 private:
+    struct TextLayoutCache
+    {
+        String Text;
+        TextLayoutOptions Layout;
+        float FontScale;
+        uint32 LastUsed;
+        Array<FontLineCache> Lines;
+    };
+
     FontAsset* _asset;
     float _size;
     int32 _height;
@@ -241,6 +257,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     bool _hasKerning;
     Dictionary<Char, FontCharacterEntry> _characters;
     mutable Dictionary<uint32, int32> _kerningTable;
+    Font* _sdfFont = nullptr;
+    Dictionary<uint32, TextLayoutCache> _layoutCache;
+    uint32 _layoutCacheCounter = 0;
 
 public:
     /// <summary>
@@ -309,6 +328,16 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
         return _lineGap;
     }
 
+    /// <summary>
+    /// Gets a value indicating whether font uses signed distance field glyphs (rasterized once and shared by all sizes of the font).
+    /// </summary>
+    API_PROPERTY() bool IsSDF() const;
+
+    /// <summary>
+    /// Gets the scale of the glyphs in the font atlas to this font size. Signed distance field fonts use glyphs rasterized at the fixed size, otherwise it's 1.
+    /// </summary>
+    API_PROPERTY() float GetGlyphScale() const;
+
 public:
     /// <summary>
     /// Gets character entry.
@@ -530,6 +559,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API Font : public ManagedScriptingOb
     /// </summary>
     void FlushFaceSize() const;
 
+private:
+    void LayoutText(const StringView& text, Array<FontLineCache>& outputLines, const TextLayoutOptions& layout);
+
 public:
     // [Object]
     String ToString() const override;
@@ -4,22 +4,43 @@
 #include "FontTextureAtlas.h"
 #include "FontAsset.h"
 #include "Font.h"
+#include "Render2D.h"
 #include "Engine/Platform/Platform.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Engine/EngineService.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "IncludeFreeType.h"
 #include <ThirdParty/freetype/ftsynth.h>
 #include <ThirdParty/freetype/ftbitmap.h>
 #include <ThirdParty/freetype/internal/ftdrv.h>
 
+struct GlyphTask
+{
+    AssetReference<FontAsset> Asset;
+    float Size;
+    Char Character;
+};
+
+struct GlyphResult
+{
+    AssetReference<FontAsset> Asset;
+    float Size;
+    FontCharacterEntry Entry;
+};
+
 namespace FontManagerImpl
 {
     FT_Library Library;
     CriticalSection Locker;
     Array<AssetReference<FontTextureAtlas>> Atlases;
     Array<byte> GlyphImageData;
+    Array<GlyphTask> GlyphTasks;
+    Array<GlyphResult> GlyphResults;
+    int64 GlyphsJobLabel = 0;
+    bool GlyphsJobActive = false;
 }
 
 using namespace FontManagerImpl;
@@ -33,12 +54,14 @@ class FontManagerService : public EngineService
     }
 
     bool Init() override;
+    void Update() override;
     void Dispose() override;
 };
 
 FontManagerService FontManagerServiceInstance;
 
 float FontManager::FontScale = 1.0f;
+bool FontManager::AsyncRasterization = true;
 
 FT_Library FontManager::GetLibrary()
 {
@@ -90,8 +113,59 @@ bool FontManagerService::Init()
     return false;
 }
 
+void FontManagerService::Update()
+{
+    // Pass glyphs rasterized in the background to the fonts
+    Array<GlyphResult> results;
+    {
+        ScopeLock lock(Locker);
+        if (GlyphResults.IsEmpty())
+            return;
+        results.Swap(GlyphResults);
+    }
+    PROFILE_CPU_NAMED("FontManager.Update");
+    for (GlyphResult& result : results)
+    {
+        FontAsset* asset = result.Asset.Get();
+        FontCharacterEntry* entry = nullptr;
+        if (asset)
+        {
+            ScopeLock lock(asset->Locker);
+            for (Font* font : asset->_fonts)
+            {
+                if (font->GetSize() == result.Size)
+                {
+                    entry = font->_characters.TryGet(result.Entry.Character);
+                    if (entry)
+                    {
+                        FontManager::Invalidate(*entry);
+                        result.Entry.Font = font;
+                        *entry = result.Entry;
+                    }
+                    break;
+                }
+            }
+        }
+        if (!entry)
+        {
+            // Font or character has been removed in the meantime
+            FontManager::Invalidate(result.Entry);
+        }
+    }
+    Render2D::InvalidateDrawLists();
+}
+
 void FontManagerService::Dispose()
 {
+    // Wait for the background glyphs rasterization to end
+    Locker.Lock();
+    GlyphTasks.Clear();
+    const bool waitForJob = GlyphsJobActive;
+    Locker.Unlock();
+    if (waitForJob)
+        JobSystem::Wait(GlyphsJobLabel);
+    GlyphResults.Clear();
+
     // Release font atlases
     Atlases.Resize(0);
 
@@ -109,23 +183,19 @@ void FontManagerService::Dispose()
 
 FontTextureAtlas* FontManager::GetAtlas(int32 index)
 {
+    ScopeLock lock(Locker);
     return index >= 0 && index < Atlases.Count() ? Atlases.Get()[index].Get() : nullptr;
 }
 
-bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
+uint32 GetGlyphLoadFlags(const FontOptions& options)
 {
-    ScopeLock lock(Locker);
-
-    const FontAsset* asset = font->GetAsset();
-    const FontOptions& options = asset->GetOptions();
-    const FT_Face face = asset->GetFTFace();
-    ASSERT(face != nullptr);
-    font->FlushFaceSize();
-
-    // Set load flags
     uint32 glyphFlags = FT_LOAD_NO_BITMAP;
-    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing);
-    if (useAA)
+    if (EnumHasAnyFlags(options.Flags, FontFlags::SDF))
+    {
+        // Distance field is scaled to any size so skip hinting
+        glyphFlags |= FT_LOAD_NO_HINTING;
+    }
+    else if (EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing))
     {
         switch (options.Hinting)
         {
@@ -151,7 +221,11 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     {
         glyphFlags |= FT_LOAD_TARGET_MONO | FT_LOAD_FORCE_AUTOHINT;
     }
+    return glyphFlags;
+}
 
+bool LoadGlyph(FT_Face face, const FontOptions& options, Char c)
+{
     // Get the index to the glyph in the font face
     const FT_UInt glyphIndex = FT_Get_Char_Index(face, c);
 #if !BUILD_RELEASE
@@ -161,14 +235,8 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     }
 #endif
 
-    // Init the character data
-    Platform::MemoryClear(&entry, sizeof(entry));
-    entry.Character = c;
-    entry.Font = font;
-    entry.IsValid = false;
-
     // Load the glyph
-    const FT_Error error = FT_Load_Glyph(face, glyphIndex, glyphFlags);
+    const FT_Error error = FT_Load_Glyph(face, glyphIndex, GetGlyphLoadFlags(options));
     if (error)
     {
         LOG_FT_ERROR(error);
@@ -184,9 +252,106 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     {
         FT_GlyphSlot_Oblique(face->glyph);
     }
+    return false;
+}
+
+void InitGlyphMetrics(FT_GlyphSlot glyph, FontCharacterEntry& entry)
+{
+    entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
+    entry.OffsetX = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingX);
+    entry.OffsetY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
+    entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
+    entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
+    entry.TextureIndex = MAX_uint8;
+    entry.IsValid = true;
+}
+
+// Computes 1D squared Euclidean distance transform (Felzenszwalb and Huttenlocher)
+void DistanceTransform1D(const float* f, float* d, int32* v, float* z, int32 n)
+{
+    int32 k = 0;
+    v[0] = 0;
+    z[0] = -MAX_float;
+    z[1] = MAX_float;
+    for (int32 q = 1; q < n; q++)
+    {
+        float s = ((f[q] + (float)(q * q)) - (f[v[k]] + (float)(v[k] * v[k]))) / (float)(2 * q - 2 * v[k]);
+        while (s <= z[k])
+        {
+            k--;
+            s = ((f[q] + (float)(q * q)) - (f[v[k]] + (float)(v[k] * v[k]))) / (float)(2 * q - 2 * v[k]);
+        }
+        k++;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = MAX_float;
+    }
+    k = 0;
+    for (int32 q = 0; q < n; q++)
+    {
+        while (z[k + 1] < (float)q)
+            k++;
+        d[q] = (float)((q - v[k]) * (q - v[k])) + f[v[k]];
+    }
+}
 
+// Computes 2D squared Euclidean distance to the closest pixels that are inside (or outside) the glyph
+void DistanceTransform2D(const Array<byte>& coverage, int32 width, int32 height, bool inside, Array<float>& distance)
+{
+    const int32 maxSize = Math::Max(width, height);
+    Array<float> f, d, z;
+    Array<int32> v;
+    f.Resize(maxSize);
+    d.Resize(maxSize);
+    z.Resize(maxSize + 1);
+    v.Resize(maxSize);
+    distance.Resize(width * height);
+    for (int32 i = 0; i < distance.Count(); i++)
+        distance.Get()[i] = (coverage.Get()[i] > 127) == inside ? 0.0f : 1e20f;
+    for (int32 x = 0; x < width; x++)
+    {
+        for (int32 y = 0; y < height; y++)
+            f[y] = distance[y * width + x];
+        DistanceTransform1D(f.Get(), d.Get(), v.Get(), z.Get(), height);
+        for (int32 y = 0; y < height; y++)
+            distance[y * width + x] = d[y];
+    }
+    for (int32 y = 0; y < height; y++)
+    {
+        DistanceTransform1D(&distance[y * width], d.Get(), v.Get(), z.Get(), width);
+        Platform::MemoryCopy(&distance[y * width], d.Get(), width * sizeof(float));
+    }
+}
+
+// Converts the glyph coverage into the signed distance field (with spread margin around the glyph)
+void GenerateSDF(Array<byte>& data, int32& width, int32& height)
+{
+    const int32 spread = FontSDFSpread;
+    const int32 sdfWidth = width + spread * 2;
+    const int32 sdfHeight = height + spread * 2;
+    Array<byte> coverage;
+    coverage.Resize(sdfWidth * sdfHeight);
+    coverage.SetAll(0);
+    for (int32 row = 0; row < height; row++)
+        Platform::MemoryCopy(&coverage[(row + spread) * sdfWidth + spread], &data[row * width], width);
+    Array<float> distanceToInside, distanceToOutside;
+    DistanceTransform2D(coverage, sdfWidth, sdfHeight, true, distanceToInside);
+    DistanceTransform2D(coverage, sdfWidth, sdfHeight, false, distanceToOutside);
+    data.Resize(sdfWidth * sdfHeight);
+    for (int32 i = 0; i < data.Count(); i++)
+    {
+        // Positive inside the glyph, 0.5 at the edge
+        const float signedDistance = Math::Sqrt(distanceToOutside.Get()[i]) - Math::Sqrt(distanceToInside.Get()[i]);
+        data.Get()[i] = (byte)Math::Clamp(Math::RoundToInt((0.5f + signedDistance / (float)(spread * 2)) * 255.0f), 0, 255);
+    }
+    width = sdfWidth;
+    height = sdfHeight;
+}
+
+void RenderGlyph(FT_GlyphSlot glyph, const FontOptions& options, Array<byte>& data, int32& width, int32& height, FontCharacterEntry& entry)
+{
     // Render glyph to the bitmap
-    FT_GlyphSlot glyph = face->glyph;
+    const bool useAA = EnumHasAnyFlags(options.Flags, FontFlags::AntiAliasing | FontFlags::SDF);
     FT_Render_Glyph(glyph, useAA ? FT_RENDER_MODE_NORMAL : FT_RENDER_MODE_MONO);
 
     FT_Bitmap* bitmap = &glyph->bitmap;
@@ -199,44 +364,26 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
         bitmap = &tmpBitmap;
     }
     ASSERT(bitmap && bitmap->pixel_mode == FT_PIXEL_MODE_GRAY);
-
-    // Fill the character data
-    entry.AdvanceX = Convert26Dot6ToRoundedPixel<int16>(glyph->advance.x);
     entry.OffsetY = glyph->bitmap_top;
     entry.OffsetX = glyph->bitmap_left;
-    entry.IsValid = true;
-    entry.BearingY = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.horiBearingY);
-    entry.Height = Convert26Dot6ToRoundedPixel<int16>(glyph->metrics.height);
 
     // Allocate memory
-    const int32 glyphWidth = bitmap->width;
-    const int32 glyphHeight = bitmap->rows;
-    GlyphImageData.Clear();
-    GlyphImageData.Resize(glyphWidth * glyphHeight);
-
-    // End for empty glyphs
-    if (GlyphImageData.IsEmpty())
-    {
-        entry.TextureIndex = MAX_uint8;
-        if (bitmap == &tmpBitmap)
-        {
-            FT_Bitmap_Done(Library, bitmap);
-            bitmap = nullptr;
-        }
-        return false;
-    }
+    width = bitmap->width;
+    height = bitmap->rows;
+    data.Clear();
+    data.Resize(width * height);
 
     // Copy glyph data after rasterization (row by row)
-    for (int32 row = 0; row < glyphHeight; row++)
+    for (int32 row = 0; row < height; row++)
     {
-        Platform::MemoryCopy(&GlyphImageData[row * glyphWidth], &bitmap->buffer[row * bitmap->pitch], glyphWidth);
+        Platform::MemoryCopy(&data[row * width], &bitmap->buffer[row * bitmap->pitch], width);
     }
 
     // Normalize gray scale images not using 256 colors
-    if (bitmap->num_grays != 256)
+    if (bitmap->num_grays != 256 && data.HasItems())
     {
         const int32 scale = 255 / (bitmap->num_grays - 1);
-        for (byte& pixel : GlyphImageData)
+        for (byte& pixel : data)
         {
             pixel *= scale;
         }
@@ -249,13 +396,31 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
         bitmap = nullptr;
     }
 
+    // Convert into distance field
+    if (EnumHasAnyFlags(options.Flags, FontFlags::SDF) && data.HasItems())
+    {
+        GenerateSDF(data, width, height);
+        entry.OffsetX -= FontSDFSpread;
+        entry.OffsetY += FontSDFSpread;
+    }
+}
+
+bool AddGlyphToAtlas(const Array<byte>& data, int32 width, int32 height, FontCharacterEntry& entry)
+{
+    // End for empty glyphs
+    if (data.IsEmpty())
+    {
+        entry.TextureIndex = MAX_uint8;
+        return false;
+    }
+
     // Find atlas for the character texture
     int32 atlasIndex = 0;
     const FontTextureAtlasSlot* slot = nullptr;
     for (; atlasIndex < Atlases.Count(); atlasIndex++)
     {
         // Add the character to the texture
-        slot = Atlases[atlasIndex]->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+        slot = Atlases[atlasIndex]->AddEntry(width, height, data);
 
         // Check result, if not null char has been added
         if (slot)
@@ -277,11 +442,11 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
         atlas->Init(fontAtlasSize, fontAtlasSize);
 
         // Add the character to the texture
-        slot = atlas->AddEntry(glyphWidth, glyphHeight, GlyphImageData);
+        slot = atlas->AddEntry(width, height, data);
     }
     if (slot == nullptr)
     {
-        LOG(Error, "Cannot find free space in texture atlases for character '{0}' from font {1} {2}. Size: {3}x{4}", c, String(face->family_name), String(face->style_name), glyphWidth, glyphHeight);
+        LOG(Error, "Cannot find free space in texture atlases for character '{0}'. Size: {1}x{2}", entry.Character, width, height);
         return true;
     }
 
@@ -293,7 +458,103 @@ bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
     entry.UVSize.X = static_cast<float>(slot->Width - 2 * padding);
     entry.UVSize.Y = static_cast<float>(slot->Height - 2 * padding);
     entry.Slot = slot;
+    return false;
+}
+
+void RasterizeGlyphsJob(int32)
+{
+    PROFILE_CPU_NAMED("Font.RasterizeGlyphs");
+    Array<byte> glyphImageData;
+    while (true)
+    {
+        // Pick the next glyph to rasterize
+        GlyphTask task;
+        {
+            ScopeLock lock(Locker);
+            if (GlyphTasks.IsEmpty())
+            {
+                GlyphsJobActive = false;
+                break;
+            }
+            task = GlyphTasks[0];
+            GlyphTasks.RemoveAtKeepOrder(0);
+        }
+        FontAsset* asset = task.Asset.Get();
+        if (!asset)
+            continue;
+
+        // Rasterize glyph (face cannot be used by multiple threads at once)
+        FontCharacterEntry entry;
+        Platform::MemoryClear(&entry, sizeof(entry));
+        entry.Character = task.Character;
+        int32 glyphWidth, glyphHeight;
+        {
+            ScopeLock assetLock(asset->Locker);
+            const FT_Face face = asset->GetFTFace();
+            if (!face)
+                continue;
+            FT_Set_Char_Size(face, 0, ConvertPixelTo26Dot6<FT_F26Dot6>(task.Size * FontManager::FontScale), DefaultDPI, DefaultDPI);
+            FT_Set_Transform(face, nullptr, nullptr);
+            const FontOptions& options = asset->GetOptions();
+            if (LoadGlyph(face, options, task.Character))
+                continue;
+            InitGlyphMetrics(face->glyph, entry);
+            RenderGlyph(face->glyph, options, glyphImageData, glyphWidth, glyphHeight, entry);
+        }
 
+        // Upload glyph to the atlas and pass it to the font on a main thread (see FontManagerService::Update)
+        ScopeLock lock(Locker);
+        if (AddGlyphToAtlas(glyphImageData, glyphWidth, glyphHeight, entry))
+            continue;
+        auto& result = GlyphResults.AddOne();
+        result.Asset = asset;
+        result.Size = task.Size;
+        result.Entry = entry;
+    }
+}
+
+bool FontManager::AddNewEntry(Font* font, Char c, FontCharacterEntry& entry)
+{
+    ScopeLock lock(Locker);
+
+    FontAsset* asset = font->GetAsset();
+    const FontOptions& options = asset->GetOptions();
+    const FT_Face face = asset->GetFTFace();
+    ASSERT(face != nullptr);
+    font->FlushFaceSize();
+
+    // Init the character data
+    Platform::MemoryClear(&entry, sizeof(entry));
+    entry.Character = c;
+    entry.Font = font;
+    entry.IsValid = false;
+
+    // Load the glyph
+    if (LoadGlyph(face, options, c))
+        return true;
+    FT_GlyphSlot glyph = face->glyph;
+    InitGlyphMetrics(glyph, entry);
+
+    // Rasterize glyph in the background (empty glyph is used until then)
+    if (AsyncRasterization && glyph->metrics.width > 0 && glyph->metrics.height > 0 && JobSystem::GetThreadsCount() > 0)
+    {
+        auto& task = GlyphTasks.AddOne();
+        task.Asset = asset;
+        task.Size = font->GetSize();
+        task.Character = c;
+        if (!GlyphsJobActive)
+        {
+            GlyphsJobActive = true;
+            GlyphsJobLabel = JobSystem::Dispatch(RasterizeGlyphsJob);
+        }
+        return false;
+    }
+
+    // Rasterize glyph
+    int32 glyphWidth, glyphHeight;
+    RenderGlyph(glyph, options, GlyphImageData, glyphWidth, glyphHeight, entry);
+    if (AddGlyphToAtlas(GlyphImageData, glyphWidth, glyphHeight, entry))
+        return true;
     return false;
 }
 
@@ -301,6 +562,8 @@ void FontManager::Invalidate(FontCharacterEntry& entry)
 {
     if (entry.TextureIndex == MAX_uint8)
         return;
+    ScopeLock lock(Locker);
+    Render2D::InvalidateDrawLists();
     auto atlas = Atlases[entry.TextureIndex];
     const uint32 padding = atlas->GetPaddingAmount();
     const uint32 slotX = static_cast<uint32>(entry.UV.X - padding);
@@ -312,6 +575,7 @@ void FontManager::Invalidate(FontCharacterEntry& entry)
 
 void FontManager::Flush()
 {
+    ScopeLock lock(Locker);
     for (const auto& atlas : Atlases)
     {
         atlas->Flush();
@@ -320,11 +584,13 @@ void FontManager::Flush()
 
 void FontManager::EnsureAtlasCreated(int32 index)
 {
+    ScopeLock lock(Locker);
     Atlases[index]->EnsureTextureCreated();
 }
 
 bool FontManager::IsDirty()
 {
+    ScopeLock lock(Locker);
     for (const auto atlas : Atlases)
     {
         if (atlas->IsDirty())
@@ -337,6 +603,7 @@ bool FontManager::IsDirty()
 
 bool FontManager::HasDataSyncWithGPU()
 {
+    ScopeLock lock(Locker);
     for (const auto atlas : Atlases)
     {
         if (atlas->HasDataSyncWithGPU() == false)
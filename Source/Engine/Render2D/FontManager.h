@@ -22,6 +22,11 @@ class FLAXENGINE_API FontManager
     /// </summary>
     static float FontScale;
 
+    /// <summary>
+    /// True if rasterize new characters in the background (on job system threads). Character metrics are available instantly (text layout is stable) but glyph is drawn empty until it's ready. Otherwise, characters get rasterized on the calling thread.
+    /// </summary>
+    static bool AsyncRasterization;
+
     /// <summary>
     /// Gets the FreeType library.
     /// </summary>
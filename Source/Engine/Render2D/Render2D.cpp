@@ -24,6 +24,10 @@
 #include "Engine/Core/Math/Half.h"
 #include "Engine/Core/Math/Math.h"
 #include "Engine/Engine/EngineService.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Utilities/RectPack.h"
 
 #if USE_EDITOR
 #define RENDER2D_CHECK_RENDERING_STATE \
@@ -46,6 +50,18 @@
 
 #define RENDER2D_BLUR_MAX_SAMPLES 64
 
+// The size of the runtime textures atlas page (in pixels)
+#define RENDER2D_ATLAS_SIZE 1024
+
+// The maximum size of the texture (in pixels) that can be placed in the runtime atlas
+#define RENDER2D_ATLAS_MAX_TEXTURE_SIZE 128
+
+// The maximum amount of the runtime atlas pages (all formats)
+#define RENDER2D_ATLAS_MAX_PAGES 8
+
+// The padding between textures in the runtime atlas (in pixels, keeps slots aligned to the compressed formats blocks)
+#define RENDER2D_ATLAS_PADDING 4
+
 // The format for the blur effect temporary buffer
 #define PS_Blur_Format PixelFormat::R8G8B8A8_UNorm
 
@@ -72,6 +88,7 @@ enum class DrawCallType : byte
     FillTexture,
     FillTexturePoint,
     DrawChar,
+    DrawCharSDF,
     DrawCharMaterial,
     Custom,
     Material,
@@ -162,6 +179,7 @@ struct CachedPSO
     GPUPipelineState* PS_Color_NoAlpha;
 
     GPUPipelineState* PS_Font;
+    GPUPipelineState* PS_FontSDF;
 
     GPUPipelineState* PS_BlurH;
     GPUPipelineState* PS_BlurV;
@@ -169,6 +187,10 @@ struct CachedPSO
 
     GPUPipelineState* PS_LineAA;
 
+    // Optional (null if bindless textures are not supported)
+    GPUPipelineState* PS_ImageBindless = nullptr;
+    GPUPipelineState* PS_ImagePointBindless = nullptr;
+
     bool Init(GPUShader* shader, bool useDepth);
     void Dispose();
 };
@@ -180,7 +202,82 @@ struct ClipMask
     Rectangle Bounds;
 };
 
-Render2D::RenderingFeatures Render2D::Features = RenderingFeatures::VertexSnapping | RenderingFeatures::FallbackFonts;
+// Recorded geometry and draw calls (vertices are in the final space so list can be replayed only with the same transform, clip and tint)
+struct Render2DDrawList
+{
+    Array<byte> Vertices;
+    Array<uint32> Indices; // Relative to the first vertex
+    Array<Render2DDrawCall> DrawCalls; // Relative to the first index
+    uint32 VerticesCount;
+    int64 Version;
+    Render2D::RenderingFeatures Features;
+    bool IsScissorsRectEnabled;
+    Matrix3x3 Transform;
+    ClipMask Clip;
+    Color Tint;
+};
+
+// Runtime textures atlas slot
+struct Render2DAtlasSlot : RectPack<Render2DAtlasSlot>
+{
+    Render2DAtlasSlot(uint32 x, uint32 y, uint32 width, uint32 height)
+        : RectPack<Render2DAtlasSlot>(x, y, width, height)
+    {
+    }
+
+    void OnInsert()
+    {
+    }
+
+    void OnFree()
+    {
+    }
+};
+
+// Runtime textures atlas page
+struct Render2DAtlasPage
+{
+    GPUTexture* Texture;
+    Render2DAtlasSlot Root;
+
+    Render2DAtlasPage()
+        : Texture(nullptr)
+        , Root(0, 0, RENDER2D_ATLAS_SIZE, RENDER2D_ATLAS_SIZE)
+    {
+    }
+
+    ~Render2DAtlasPage()
+    {
+        SAFE_DELETE_GPU_RESOURCE(Texture);
+    }
+};
+
+// Texture placed in the runtime atlas (or marked as not suitable for it)
+struct Render2DAtlasEntry
+{
+    GPUTexture* Source;
+    Render2DAtlasPage* Page;
+    Render2DAtlasSlot* Slot;
+    Float2 UVLocation;
+    Float2 UVSize;
+
+    void OnReleasing();
+};
+
+// Draw list recording start
+struct Render2DDrawListRecord
+{
+    int32 DrawCallsStart;
+    int32 VBDataStart;
+    int32 IBDataStart;
+    uint32 VBIndexStart;
+    uint32 IBIndexStart;
+    Matrix3x3 Transform;
+    ClipMask Clip;
+    Color Tint;
+};
+
+Render2D::RenderingFeatures Render2D::Features = RenderingFeatures::VertexSnapping | RenderingFeatures::FallbackFonts | RenderingFeatures::TextureAtlasing;
 
 namespace
 {
@@ -220,6 +317,16 @@ namespace
     DynamicIndexBuffer IB(RENDER2D_INITIAL_IB_CAPACITY, sizeof(uint32), TEXT("Render2D.IB"));
     uint32 VBIndex = 0;
     uint32 IBIndex = 0;
+
+    // Draw lists
+    Array<Render2DDrawList*> DrawLists;
+    Array<Render2DDrawListRecord, InlinedAllocation<8>> DrawListRecords;
+    int64 DrawListsVersion = 1;
+
+    // Batching
+    bool UseBindless = false;
+    Dictionary<GPUTexture*, Render2DAtlasEntry*> AtlasEntries;
+    Array<Render2DAtlasPage*> AtlasPages;
 }
 
 #define RENDER2D_WRITE_IB_QUAD(indices) \
@@ -402,6 +509,126 @@ void Write9SlicingRect(const Rectangle& rect, const Color& color, const Float4&
     WriteRect(Rectangle(upperLeft.GetBottomRight(), bottomRight.GetUpperLeft() - upperLeft.GetBottomRight()), color, upperRightUV, bottomRightUV);
 }
 
+void Render2DAtlasEntry::OnReleasing()
+{
+    Source->Releasing.Unbind<Render2DAtlasEntry, &Render2DAtlasEntry::OnReleasing>(this);
+    AtlasEntries.Remove(Source);
+    if (Slot)
+    {
+        Slot->Free();
+        Render2D::InvalidateDrawLists();
+    }
+    Delete(this);
+}
+
+bool CanUseAtlas(const GPUTexture* t)
+{
+    const int32 width = t->Width(), height = t->Height();
+    if (!t->IsRegularTexture() || t->IsStaging() || t->IsMultiSample() || t->Dimensions() != TextureDimensions::Texture || t->ArraySize() != 1 ||
+        width > RENDER2D_ATLAS_MAX_TEXTURE_SIZE || height > RENDER2D_ATLAS_MAX_TEXTURE_SIZE || width <= 0 || height <= 0)
+        return false;
+    if (PixelFormatExtensions::IsCompressed(t->Format()) && (width % 4 != 0 || height % 4 != 0))
+        return false; // Blocks can be copied only as a whole
+    return true;
+}
+
+Render2DAtlasPage* CreateAtlasPage(PixelFormat format)
+{
+    auto page = New<Render2DAtlasPage>();
+    page->Texture = GPUDevice::Instance->CreateTexture(TEXT("Render2D.Atlas"));
+    if (page->Texture->Init(GPUTextureDescription::New2D(RENDER2D_ATLAS_SIZE, RENDER2D_ATLAS_SIZE, 1, format, GPUTextureFlags::ShaderResource)))
+    {
+        Delete(page);
+        return nullptr;
+    }
+
+    // Clear the atlas so the padding around textures is transparent
+    uint32 rowPitch, slicePitch;
+    RenderTools::ComputePitch(format, RENDER2D_ATLAS_SIZE, RENDER2D_ATLAS_SIZE, rowPitch, slicePitch);
+    Array<byte> zeros;
+    zeros.Resize(slicePitch);
+    Platform::MemoryClear(zeros.Get(), slicePitch);
+    Context->UpdateTexture(page->Texture, 0, 0, zeros.Get(), rowPitch, slicePitch);
+
+    AtlasPages.Add(page);
+    return page;
+}
+
+// Gets the texture to use for drawing (eg. runtime atlas of small textures) with the UVs area of the original texture
+GPUTexture* GetAtlasTexture(GPUTexture* t, Float2& uvLocation, Float2& uvSize)
+{
+    uvLocation = Float2::Zero;
+    uvSize = Float2::One;
+    if (!t || EnumHasNoneFlags(Render2D::Features, Render2D::RenderingFeatures::TextureAtlasing))
+        return t;
+    Render2DAtlasEntry* entry;
+    if (!AtlasEntries.TryGet(t, entry))
+    {
+        // Wait for the texture data to be fully uploaded
+        if (!t->IsAllocated() || t->ResidentMipLevels() != t->MipLevels())
+            return t;
+        PROFILE_CPU_NAMED("Render2D.Atlas");
+
+        entry = New<Render2DAtlasEntry>();
+        entry->Source = t;
+        entry->Page = nullptr;
+        entry->Slot = nullptr;
+        AtlasEntries.Add(t, entry);
+        t->Releasing.Bind<Render2DAtlasEntry, &Render2DAtlasEntry::OnReleasing>(entry);
+        if (CanUseAtlas(t))
+        {
+            // Find a free space in the atlas pages of the same format
+            const uint32 width = Math::AlignUp<uint32>(t->Width(), 4);
+            const uint32 height = Math::AlignUp<uint32>(t->Height(), 4);
+            for (auto page : AtlasPages)
+            {
+                if (page->Texture->Format() == t->Format())
+                {
+                    entry->Slot = page->Root.Insert(width, height, RENDER2D_ATLAS_PADDING);
+                    if (entry->Slot)
+                    {
+                        entry->Page = page;
+                        break;
+                    }
+                }
+            }
+            if (!entry->Slot && AtlasPages.Count() < RENDER2D_ATLAS_MAX_PAGES)
+            {
+                auto page = CreateAtlasPage(t->Format());
+                if (page)
+                {
+                    entry->Slot = page->Root.Insert(width, height, RENDER2D_ATLAS_PADDING);
+                    entry->Page = entry->Slot ? page : nullptr;
+                }
+            }
+            if (entry->Slot)
+            {
+                // Copy texture top mip into the atlas
+                Context->CopyTexture(entry->Page->Texture, 0, entry->Slot->X, entry->Slot->Y, 0, t, 0);
+                const float invSize = 1.0f / RENDER2D_ATLAS_SIZE;
+                entry->UVLocation = Float2((float)entry->Slot->X, (float)entry->Slot->Y) * invSize;
+                entry->UVSize = Float2((float)t->Width(), (float)t->Height()) * invSize;
+            }
+        }
+    }
+    if (!entry->Slot)
+        return t;
+    uvLocation = entry->UVLocation;
+    uvSize = entry->UVSize;
+    return entry->Page->Texture;
+}
+
+void ClearAtlas()
+{
+    for (auto& e : AtlasEntries)
+    {
+        e.Key->Releasing.Unbind<Render2DAtlasEntry, &Render2DAtlasEntry::OnReleasing>(e.Value);
+        Delete(e.Value);
+    }
+    AtlasEntries.Clear();
+    AtlasPages.ClearDelete();
+}
+
 typedef bool (*CanDrawCallCallback)(const Render2DDrawCall&, const Render2DDrawCall&);
 
 bool CanDrawCallCallbackTrue(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
@@ -421,7 +648,8 @@ bool CanDrawCallCallbackRT(const Render2DDrawCall& d1, const Render2DDrawCall& d
 
 bool CanDrawCallCallbackTexture(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
 {
-    return d1.AsTexture.Ptr == d2.AsTexture.Ptr;
+    // Bindless textures are indexed per-vertex (see PS_ImageBindless)
+    return d1.AsTexture.Ptr == d2.AsTexture.Ptr || (UseBindless && d1.AsTexture.Ptr && d2.AsTexture.Ptr);
 }
 
 bool CanDrawCallCallbackChar(const Render2DDrawCall& d1, const Render2DDrawCall& d2)
@@ -453,6 +681,7 @@ CanDrawCallCallback CanDrawCallBatch[] =
     CanDrawCallCallbackTexture, // FillTexture,
     CanDrawCallCallbackTexture, // FillTexturePoint,
     CanDrawCallCallbackChar, // DrawChar,
+    CanDrawCallCallbackChar, // DrawCharSDF,
     CanDrawCallCallbackCharMaterial, // DrawCharMaterial,
     CanDrawCallCallbackFalse, // Custom,
     CanDrawCallCallbackMaterial, // Material,
@@ -514,6 +743,10 @@ bool CachedPSO::Init(GPUShader* shader, bool useDepth)
     PS_Font = GPUDevice::Instance->CreatePipelineState();
     if (PS_Font->Init(desc))
         return true;
+    desc.PS = shader->GetPS("PS_FontSDF");
+    PS_FontSDF = GPUDevice::Instance->CreatePipelineState();
+    if (PS_FontSDF->Init(desc))
+        return true;
     //
     desc.PS = shader->GetPS("PS_LineAA");
     PS_LineAA = GPUDevice::Instance->CreatePipelineState();
@@ -536,6 +769,20 @@ bool CachedPSO::Init(GPUShader* shader, bool useDepth)
     PS_Downscale = GPUDevice::Instance->CreatePipelineState();
     if (PS_Downscale->Init(desc))
         return true;
+    //
+    if (GPUDevice::Instance->Limits.HasBindless && shader->HasShader("PS_ImageBindless"))
+    {
+        desc.VS = shader->GetVS("VS");
+        desc.BlendMode = BlendingMode::AlphaBlend;
+        desc.PS = shader->GetPS("PS_ImageBindless");
+        PS_ImageBindless = GPUDevice::Instance->CreatePipelineState();
+        if (PS_ImageBindless->Init(desc))
+            return true;
+        desc.PS = shader->GetPS("PS_ImagePointBindless");
+        PS_ImagePointBindless = GPUDevice::Instance->CreatePipelineState();
+        if (PS_ImagePointBindless->Init(desc))
+            return true;
+    }
 
     Inited = true;
 
@@ -552,10 +799,13 @@ void CachedPSO::Dispose()
     SAFE_DELETE_GPU_RESOURCE(PS_Color);
     SAFE_DELETE_GPU_RESOURCE(PS_Color_NoAlpha);
     SAFE_DELETE_GPU_RESOURCE(PS_Font);
+    SAFE_DELETE_GPU_RESOURCE(PS_FontSDF);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurH);
     SAFE_DELETE_GPU_RESOURCE(PS_BlurV);
     SAFE_DELETE_GPU_RESOURCE(PS_Downscale);
     SAFE_DELETE_GPU_RESOURCE(PS_LineAA);
+    SAFE_DELETE_GPU_RESOURCE(PS_ImageBindless);
+    SAFE_DELETE_GPU_RESOURCE(PS_ImagePointBindless);
 
     Inited = false;
 }
@@ -564,7 +814,7 @@ class Render2DService : public EngineService
 {
 public:
     Render2DService()
-        : EngineService(TEXT("Render2D"), 10)
+        : EngineService(TEXT("Render2D"), 10, true)
     {
     }
 
@@ -594,6 +844,11 @@ void OnGUIShaderReloading(Asset* obj)
 
 #endif
 
+void OnAssetDisposing(Asset* asset)
+{
+    Render2D::InvalidateDrawLists();
+}
+
 bool Render2DService::Init()
 {
     // GUI Shader
@@ -606,6 +861,9 @@ bool Render2DService::Init()
 
     DrawCalls.EnsureCapacity(RENDER2D_INITIAL_DRAW_CALL_CAPACITY);
 
+    // Recorded draw lists reference textures and materials so invalidate them when assets get unloaded
+    Content::AssetDisposing.Bind<OnAssetDisposing>();
+
     return false;
 }
 
@@ -616,6 +874,10 @@ void Render2DService::Dispose()
     DrawCalls.Resize(0);
     Lines.Resize(0);
     Lines2.Resize(0);
+    Content::AssetDisposing.Unbind<OnAssetDisposing>();
+    DrawLists.ClearDelete();
+    DrawListRecords.Resize(0);
+    ClearAtlas();
 
     GUIShader = nullptr;
 
@@ -696,6 +958,7 @@ void Render2D::Begin(GPUContext* context, GPUTextureView* output, GPUTextureView
     IB.Clear();
     VBIndex = 0;
     IBIndex = 0;
+    DrawListRecords.Clear();
 }
 
 void Render2D::End()
@@ -729,6 +992,31 @@ void Render2D::End()
         shader = GUIShader->GetShader();
     }
 
+    // Prepare PSO
+    if (!PsoDepth.Inited)
+    {
+        PsoDepth.Init(GUIShader.Get()->GetShader(), true);
+        PsoNoDepth.Init(GUIShader.Get()->GetShader(), false);
+    }
+    CurrentPso = DepthBuffer ? &PsoDepth : &PsoNoDepth;
+
+    // Write bindless textures indices into vertices so draws with different textures can be batched
+    UseBindless = CurrentPso->PS_ImageBindless != nullptr;
+    if (UseBindless)
+    {
+        Render2DVertex* vertices = (Render2DVertex*)VB.Data.Get();
+        const uint32* indices = (const uint32*)IB.Data.Get();
+        for (const Render2DDrawCall& drawCall : DrawCalls)
+        {
+            if (drawCall.Type != DrawCallType::FillTexture && drawCall.Type != DrawCallType::FillTexturePoint)
+                continue;
+            // Note: index is read every frame because it can change when texture view gets recreated (eg. during mips streaming)
+            const int32 bindlessIndex = drawCall.AsTexture.Ptr ? drawCall.AsTexture.Ptr->View()->GetBindlessIndex() : -1;
+            for (uint32 i = 0; i < drawCall.CountIB; i++)
+                vertices[indices[drawCall.StartIB + i]].CustomData.X = (float)bindlessIndex;
+        }
+    }
+
     // Flush geometry buffers
     VB.Flush(Context);
     IB.Flush(Context);
@@ -746,14 +1034,6 @@ void Render2D::End()
     Context->UpdateCB(constantBuffer, &data);
     Context->BindCB(0, constantBuffer);
 
-    // Prepare PSO
-    if (!PsoDepth.Inited)
-    {
-        PsoDepth.Init(GUIShader.Get()->GetShader(), true);
-        PsoNoDepth.Init(GUIShader.Get()->GetShader(), false);
-    }
-    CurrentPso = DepthBuffer ? &PsoDepth : &PsoNoDepth;
-
     // Flush draw calls
     int32 batchStart = 0, batchSize = 0;
     IsScissorsRectEmpty = false;
@@ -972,16 +1252,20 @@ void DrawBatch(int32 startIndex, int32 count)
         break;
     case DrawCallType::FillTexture:
         Context->BindSR(0, d.AsTexture.Ptr);
-        Context->SetState(CurrentPso->PS_Image);
+        Context->SetState(UseBindless && d.AsTexture.Ptr ? CurrentPso->PS_ImageBindless : CurrentPso->PS_Image);
         break;
     case DrawCallType::FillTexturePoint:
         Context->BindSR(0, d.AsTexture.Ptr);
-        Context->SetState(CurrentPso->PS_ImagePoint);
+        Context->SetState(UseBindless && d.AsTexture.Ptr ? CurrentPso->PS_ImagePointBindless : CurrentPso->PS_ImagePoint);
         break;
     case DrawCallType::DrawChar:
         Context->BindSR(0, d.AsChar.Tex);
         Context->SetState(CurrentPso->PS_Font);
         break;
+    case DrawCallType::DrawCharSDF:
+        Context->BindSR(0, d.AsChar.Tex);
+        Context->SetState(CurrentPso->PS_FontSDF);
+        break;
     case DrawCallType::DrawCharMaterial:
     {
         // Apply and bind material
@@ -1228,12 +1512,15 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                 const float x = pointer.X + entry.OffsetX * scale;
                 const float y = pointer.Y + (font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                const float glyphScale = entry.Font->GetGlyphScale();
+                Rectangle charRect(x, y, entry.UVSize.X * glyphScale * scale, entry.UVSize.Y * glyphScale * scale);
 
                 Float2 upperLeftUV = entry.UV * invAtlasSize;
                 Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                 // Add draw call
+                if (!customMaterial)
+                    drawCall.Type = entry.Font->IsSDF() ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                 drawCall.StartIB = IBIndex;
                 drawCall.CountIB = 6;
                 DrawCalls.Add(drawCall);
@@ -1350,13 +1637,16 @@ void Render2D::DrawText(Font* font, const StringView& text, const Color& color,
                     const float x = pointer.X + entry.OffsetX * scale;
                     const float y = pointer.Y - entry.OffsetY * scale + Math::Ceil((font->GetHeight() + font->GetDescender()) * scale);
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    const float glyphScale = entry.Font->GetGlyphScale();
+                    Rectangle charRect(x, y, entry.UVSize.X * glyphScale * scale, entry.UVSize.Y * glyphScale * scale);
                     charRect.Offset(layout.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
                     Float2 rightBottomUV = (entry.UV + entry.UVSize) * invAtlasSize;
 
                     // Add draw call
+                    if (!customMaterial)
+                        drawCall.Type = entry.Font->IsSDF() ? DrawCallType::DrawCharSDF : DrawCallType::DrawChar;
                     drawCall.StartIB = IBIndex;
                     drawCall.CountIB = 6;
                     DrawCalls.Add(drawCall);
@@ -1578,26 +1868,19 @@ void Render2D::DrawTexture(GPUTexture* t, const Rectangle& rect, const Color& co
 {
     RENDER2D_CHECK_RENDERING_STATE;
 
+    Float2 uvLocation, uvSize;
     Render2DDrawCall drawCall;
     drawCall.Type = DrawCallType::FillTexture;
     drawCall.StartIB = IBIndex;
     drawCall.CountIB = 6;
-    drawCall.AsTexture.Ptr = t;
+    drawCall.AsTexture.Ptr = GetAtlasTexture(t, uvLocation, uvSize);
     DrawCalls.Add(drawCall);
-    WriteRect(rect, color);
+    WriteRect(rect, color, uvLocation, uvLocation + uvSize);
 }
 
 void Render2D::DrawTexture(TextureBase* t, const Rectangle& rect, const Color& color)
 {
-    RENDER2D_CHECK_RENDERING_STATE;
-
-    Render2DDrawCall drawCall;
-    drawCall.Type = DrawCallType::FillTexture;
-    drawCall.StartIB = IBIndex;
-    drawCall.CountIB = 6;
-    drawCall.AsTexture.Ptr = t ? t->GetTexture() : nullptr;
-    DrawCalls.Add(drawCall);
-    WriteRect(rect, color);
+    DrawTexture(t ? t->GetTexture() : nullptr, rect, color);
 }
 
 void Render2D::DrawSprite(const SpriteHandle& spriteHandle, const Rectangle& rect, const Color& color)
@@ -1619,12 +1902,13 @@ void Render2D::DrawTexturePoint(GPUTexture* t, const Rectangle& rect, const Colo
 {
     RENDER2D_CHECK_RENDERING_STATE;
 
+    Float2 uvLocation, uvSize;
     Render2DDrawCall& drawCall = DrawCalls.AddOne();
     drawCall.Type = DrawCallType::FillTexturePoint;
     drawCall.StartIB = IBIndex;
     drawCall.CountIB = 6;
-    drawCall.AsTexture.Ptr = t;
-    WriteRect(rect, color);
+    drawCall.AsTexture.Ptr = GetAtlasTexture(t, uvLocation, uvSize);
+    WriteRect(rect, color, uvLocation, uvLocation + uvSize);
 }
 
 void Render2D::DrawSpritePoint(const SpriteHandle& spriteHandle, const Rectangle& rect, const Color& color)
@@ -1646,26 +1930,28 @@ void Render2D::Draw9SlicingTexture(TextureBase* t, const Rectangle& rect, const
 {
     RENDER2D_CHECK_RENDERING_STATE;
 
+    Float2 uvLocation, uvSize;
     Render2DDrawCall drawCall;
     drawCall.Type = DrawCallType::FillTexture;
     drawCall.StartIB = IBIndex;
     drawCall.CountIB = 6 * 9;
-    drawCall.AsTexture.Ptr = t ? t->GetTexture() : nullptr;
+    drawCall.AsTexture.Ptr = GetAtlasTexture(t ? t->GetTexture() : nullptr, uvLocation, uvSize);
     DrawCalls.Add(drawCall);
-    Write9SlicingRect(rect, color, border, borderUVs);
+    Write9SlicingRect(rect, color, border, borderUVs, uvLocation, uvSize);
 }
 
 void Render2D::Draw9SlicingTexturePoint(TextureBase* t, const Rectangle& rect, const Float4& border, const Float4& borderUVs, const Color& color)
 {
     RENDER2D_CHECK_RENDERING_STATE;
 
+    Float2 uvLocation, uvSize;
     Render2DDrawCall drawCall;
     drawCall.Type = DrawCallType::FillTexturePoint;
     drawCall.StartIB = IBIndex;
     drawCall.CountIB = 6 * 9;
-    drawCall.AsTexture.Ptr = t ? t->GetTexture() : nullptr;
+    drawCall.AsTexture.Ptr = GetAtlasTexture(t ? t->GetTexture() : nullptr, uvLocation, uvSize);
     DrawCalls.Add(drawCall);
-    Write9SlicingRect(rect, color, border, borderUVs);
+    Write9SlicingRect(rect, color, border, borderUVs, uvLocation, uvSize);
 }
 
 void Render2D::Draw9SlicingSprite(const SpriteHandle& spriteHandle, const Rectangle& rect, const Float4& border, const Float4& borderUVs, const Color& color)
@@ -2018,3 +2304,121 @@ void Render2D::FillTriangle(const Float2& p0, const Float2& p1, const Float2& p2
     drawCall.CountIB = 3;
     WriteTri(p0, p1, p2, color, color, color);
 }
+
+void Render2D::BeginDrawList()
+{
+    RENDER2D_CHECK_RENDERING_STATE;
+
+    auto& record = DrawListRecords.AddOne();
+    record.DrawCallsStart = DrawCalls.Count();
+    record.VBDataStart = VB.Data.Count();
+    record.IBDataStart = IB.Data.Count();
+    record.VBIndexStart = VBIndex;
+    record.IBIndexStart = IBIndex;
+    record.Transform = TransformCached;
+    record.Clip = ClipLayersStack.Peek();
+    record.Tint = TintLayersStack.Peek();
+}
+
+uint32 Render2D::EndDrawList(uint32 drawList)
+{
+    if (!IsRendering() || DrawListRecords.IsEmpty())
+        return 0;
+    PROFILE_CPU();
+    const Render2DDrawListRecord record = DrawListRecords.Pop();
+
+    // Skip draw calls that use resources which can change between frames
+    const int32 drawCallsCount = DrawCalls.Count() - record.DrawCallsStart;
+    for (int32 i = 0; i < drawCallsCount; i++)
+    {
+        const DrawCallType type = DrawCalls.Get()[record.DrawCallsStart + i].Type;
+        if (type == DrawCallType::FillRT || type == DrawCallType::Custom)
+        {
+            FreeDrawList(drawList);
+            return 0;
+        }
+    }
+
+    // Get list
+    Render2DDrawList* list = drawList != 0 && drawList <= (uint32)DrawLists.Count() ? DrawLists[drawList - 1] : nullptr;
+    if (!list)
+    {
+        list = New<Render2DDrawList>();
+        drawList = DrawLists.Find(nullptr) + 1;
+        if (drawList != 0)
+            DrawLists[drawList - 1] = list;
+        else
+        {
+            DrawLists.Add(list);
+            drawList = DrawLists.Count();
+        }
+    }
+
+    // Copy geometry and draw calls (relative to the recording start)
+    list->Vertices.Set(VB.Data.Get() + record.VBDataStart, VB.Data.Count() - record.VBDataStart);
+    list->VerticesCount = VBIndex - record.VBIndexStart;
+    const uint32* indices = (const uint32*)(IB.Data.Get() + record.IBDataStart);
+    const int32 indicesCount = (int32)(IBIndex - record.IBIndexStart);
+    list->Indices.Resize(indicesCount, false);
+    for (int32 i = 0; i < indicesCount; i++)
+        list->Indices.Get()[i] = indices[i] - record.VBIndexStart;
+    list->DrawCalls.Set(DrawCalls.Get() + record.DrawCallsStart, drawCallsCount);
+    for (auto& drawCall : list->DrawCalls)
+        drawCall.StartIB -= record.IBIndexStart;
+    list->Version = DrawListsVersion;
+    list->Features = Features;
+    list->IsScissorsRectEnabled = IsScissorsRectEnabled;
+    list->Transform = record.Transform;
+    list->Clip = record.Clip;
+    list->Tint = record.Tint;
+    return drawList;
+}
+
+bool Render2D::DrawList(uint32 drawList)
+{
+    if (!IsRendering())
+        return true;
+    const Render2DDrawList* list = drawList != 0 && drawList <= (uint32)DrawLists.Count() ? DrawLists[drawList - 1] : nullptr;
+    if (!list ||
+        list->Version != DrawListsVersion ||
+        list->Features != Features ||
+        list->IsScissorsRectEnabled != IsScissorsRectEnabled ||
+        list->Tint != TintLayersStack.Peek() ||
+        Platform::MemoryCompare(&list->Transform, &TransformCached, sizeof(Matrix3x3)) != 0 ||
+        Platform::MemoryCompare(&list->Clip, &ClipLayersStack.Peek(), sizeof(ClipMask)) != 0)
+        return true;
+
+    // Append geometry and draw calls
+    VB.Write(list->Vertices.Get(), list->Vertices.Count());
+    uint32* indices = (uint32*)IB.WriteReserve(list->Indices.Count() * sizeof(uint32));
+    for (int32 i = 0; i < list->Indices.Count(); i++)
+        indices[i] = list->Indices.Get()[i] + VBIndex;
+    const int32 drawCallsStart = DrawCalls.Count();
+    DrawCalls.Add(list->DrawCalls);
+    for (int32 i = drawCallsStart; i < DrawCalls.Count(); i++)
+        DrawCalls.Get()[i].StartIB += IBIndex;
+    VBIndex += list->VerticesCount;
+    IBIndex += list->Indices.Count();
+    return false;
+}
+
+void Render2D::FreeDrawList(uint32 drawList)
+{
+    if (drawList != 0 && drawList <= (uint32)DrawLists.Count())
+    {
+        Delete(DrawLists[drawList - 1]);
+        DrawLists[drawList - 1] = nullptr;
+    }
+}
+
+void Render2D::InvalidateDrawLists()
+{
+    Platform::InterlockedIncrement(&DrawListsVersion);
+}
+
+void Render2D::InvalidateTexture(GPUTexture* t)
+{
+    Render2DAtlasEntry* entry;
+    if (t && AtlasEntries.TryGet(t, entry))
+        entry->OnReleasing();
+}
@@ -49,6 +49,11 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
         /// Enables automatic characters usage from fallback fonts.
         /// </summary>
         FallbackFonts = 2,
+
+        /// <summary>
+        /// Enables automatic packing of small textures into the runtime atlases so draw calls with different textures can be batched together. Atlas contains only the top mip of the texture. Textures modified at runtime (without the reallocation) need to be invalidated via InvalidateTexture.
+        /// </summary>
+        TextureAtlasing = 4,
     };
 
     struct CustomData
@@ -456,6 +461,43 @@ API_CLASS(Static) class FLAXENGINE_API Render2D
     /// <param name="p2">The third point.</param>
     /// <param name="color">The color.</param>
     API_FUNCTION() static void FillTriangle(const Float2& p0, const Float2& p1, const Float2& p2, const Color& color);
+
+public:
+    /// <summary>
+    /// Begins recording the draw calls into the draw list. Recorded geometry can be replayed in the next frames without issuing the drawing again (eg. for static UI). Recordings can be nested.
+    /// </summary>
+    API_FUNCTION() static void BeginDrawList();
+
+    /// <summary>
+    /// Ends recording the draw calls and stores them in the draw list (draw calls are still rendered in the current frame).
+    /// </summary>
+    /// <param name="drawList">The existing draw list handle to reuse or 0 to create a new one.</param>
+    /// <returns>The draw list handle or 0 if recorded draw calls cannot be cached (eg. use render targets or custom pipeline states which can change).</returns>
+    API_FUNCTION() static uint32 EndDrawList(uint32 drawList = 0);
+
+    /// <summary>
+    /// Draws the recorded draw list. Fails if the current transformation, clipping or tint is different than when recording or the list got invalidated (in that case draw calls need to be recorded again).
+    /// </summary>
+    /// <param name="drawList">The draw list handle.</param>
+    /// <returns>True if failed to draw (list has not been drawn), otherwise false.</returns>
+    API_FUNCTION() static bool DrawList(uint32 drawList);
+
+    /// <summary>
+    /// Releases the draw list.
+    /// </summary>
+    /// <param name="drawList">The draw list handle.</param>
+    API_FUNCTION() static void FreeDrawList(uint32 drawList);
+
+    /// <summary>
+    /// Invalidates all recorded draw lists (eg. after font characters or assets used by them have been modified).
+    /// </summary>
+    API_FUNCTION() static void InvalidateDrawLists();
+
+    /// <summary>
+    /// Removes the texture from the runtime atlas (see RenderingFeatures::TextureAtlasing). Should be called after modifying the texture contents so the atlas gets updated.
+    /// </summary>
+    /// <param name="t">The texture.</param>
+    API_FUNCTION() static void InvalidateTexture(GPUTexture* t);
 };
 
 DECLARE_ENUM_OPERATORS(Render2D::RenderingFeatures);
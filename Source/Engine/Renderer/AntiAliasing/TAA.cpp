@@ -19,6 +19,8 @@ PACK_STRUCT(struct Data
     float StationaryBlending;
     float MotionBlending;
     float Dummy0;
+    Float2 InputSize;
+    Float2 JitterUV;
     GBufferData GBuffer;
     });
 
@@ -53,6 +55,15 @@ bool TAA::setupResources()
         if (_psTAA->Init(psDesc))
             return true;
     }
+    if (!_psTAAUpscale)
+        _psTAAUpscale = GPUDevice::Instance->CreatePipelineState();
+    if (!_psTAAUpscale->IsValid())
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.PS = shader->GetPS("PS_Upscale");
+        if (_psTAAUpscale->Init(psDesc))
+            return true;
+    }
     return false;
 }
 
@@ -62,18 +73,32 @@ void TAA::Dispose()
     RendererPass::Dispose();
 
     SAFE_DELETE_GPU_RESOURCE(_psTAA);
+    SAFE_DELETE_GPU_RESOURCE(_psTAAUpscale);
     _shader = nullptr;
 }
 
 void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output)
+{
+    Render(renderContext, input, output, input->Width(), input->Height());
+}
+
+void TAA::Upscale(const RenderContext& renderContext, GPUTexture* input, GPUTexture* output)
+{
+    Render(renderContext, input, output->View(), output->Width(), output->Height());
+}
+
+void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output, int32 outputWidth, int32 outputHeight)
 {
     auto context = GPUDevice::Instance->GetMainContext();
+    const bool upscale = outputWidth != input->Width() || outputHeight != input->Height();
 
     // Ensure to have valid data
     if (checkIfSkipPass())
     {
         // Resources are missing. Do not perform rendering, just copy source frame.
         context->SetRenderTarget(output);
+        if (upscale)
+            context->SetViewportAndScissors((float)outputWidth, (float)outputHeight);
         context->Draw(input);
         return;
     }
@@ -81,10 +106,10 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
 
     PROFILE_GPU_CPU("Temporal Antialiasing");
 
-    // Get history buffers
+    // Get history buffers (at the output resolution)
     bool resetHistory = renderContext.Task->IsCameraCut;
     renderContext.Buffers->LastFrameTemporalAA = Engine::FrameCount;
-    const auto tempDesc = GPUTextureDescription::New2D(input->Width(), input->Height(), input->Format());
+    const auto tempDesc = GPUTextureDescription::New2D(outputWidth, outputHeight, input->Format());
     if (renderContext.Buffers->TemporalAA == nullptr)
     {
         // Missing temporal buffer
@@ -112,6 +137,8 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
         context->CopyTexture(inputHistory, 0, 0, 0, 0, input, 0);
 #else
         context->SetRenderTarget(inputHistory->View());
+        if (upscale)
+            context->SetViewportAndScissors((float)outputWidth, (float)outputHeight);
         context->Draw(input);
         context->ResetRenderTarget();
 #endif
@@ -122,11 +149,13 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
     Data data;
     data.ScreenSizeInv.X = renderContext.View.ScreenSize.Z;
     data.ScreenSizeInv.Y = renderContext.View.ScreenSize.W;
-    data.JitterInv.X = renderContext.View.TemporalAAJitter.X / (float)tempDesc.Width;
-    data.JitterInv.Y = renderContext.View.TemporalAAJitter.Y / (float)tempDesc.Height;
+    data.JitterInv.X = renderContext.View.TemporalAAJitter.X / (float)input->Width();
+    data.JitterInv.Y = renderContext.View.TemporalAAJitter.Y / (float)input->Height();
     data.Sharpness = settings.TAA_Sharpness;
     data.StationaryBlending = settings.TAA_StationaryBlending * blendStrength;
     data.MotionBlending = settings.TAA_MotionBlending * blendStrength;
+    data.InputSize = Float2((float)input->Width(), (float)input->Height());
+    data.JitterUV = Float2(renderContext.View.TemporalAAJitter.X * 0.5f, renderContext.View.TemporalAAJitter.Y * -0.5f);
     GBufferPass::SetInputs(renderContext.View, data.GBuffer);
     const auto cb = _shader->GetShader()->GetCB(0);
     context->UpdateCB(cb, &data);
@@ -138,7 +167,9 @@ void TAA::Render(const RenderContext& renderContext, GPUTexture* input, GPUTextu
 
     // Render
     context->SetRenderTarget(output);
-    context->SetState(_psTAA);
+    if (upscale)
+        context->SetViewportAndScissors((float)outputWidth, (float)outputHeight);
+    context->SetState(upscale ? _psTAAUpscale : _psTAA);
     context->DrawFullscreenTriangle();
 
     // Update the history
@@ -14,6 +14,7 @@ class TAA : public RendererPass<TAA>
 
     AssetReference<Shader> _shader;
     GPUPipelineState* _psTAA;
+    GPUPipelineState* _psTAAUpscale;
 
 public:
     /// <summary>
@@ -24,13 +25,24 @@ class TAA : public RendererPass<TAA>
     /// <param name="output">The output render target.</param>
     void Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output);
 
+    /// <summary>
+    /// Performs AA pass rendering for the input task with temporal upscaling of the jittered lower resolution frame into the output resolution (history is accumulated at the output resolution).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="input">The input render target (at the rendering resolution).</param>
+    /// <param name="output">The output render target (at the output resolution).</param>
+    void Upscale(const RenderContext& renderContext, GPUTexture* input, GPUTexture* output);
+
 private:
+    void Render(const RenderContext& renderContext, GPUTexture* input, GPUTextureView* output, int32 outputWidth, int32 outputHeight);
 
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj)
     {
         if (_psTAA)
             _psTAA->ReleaseGPU();
+        if (_psTAAUpscale)
+            _psTAAUpscale->ReleaseGPU();
         invalidateResources();
     }
 #endif
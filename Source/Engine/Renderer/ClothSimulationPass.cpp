@@ -0,0 +1,197 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ClothSimulationPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Models/Types.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Threading.h"
+
+// Those defines must match the HLSL
+#define CLOTH_THREAD_GROUP_SIZE 64
+
+namespace
+{
+    bool InitBuffer(GPUBuffer*& buffer, const Char* name, const void* data, uint32 size, GPUBufferFlags flags, uint32 stride = sizeof(float))
+    {
+        if (!buffer)
+            buffer = GPUDevice::Instance->CreateBuffer(name);
+        return buffer->Init(GPUBufferDescription::Buffer(size, flags | GPUBufferFlags::RawBuffer, PixelFormat::R32_Typeless, data, stride));
+    }
+}
+
+bool GPUClothData::Init(const Span<Float4>& particles, const Span<float>& maxDistances, const Span<uint32>& constraints, const Span<uint32>& adjacency)
+{
+    PROFILE_CPU();
+    ParticlesCount = particles.Length();
+    LastUpdateFrame = 0;
+    IsVB0Initialized = false;
+    IsVB1Initialized = false;
+    Array<Float4> restParticles;
+    restParticles.Resize(particles.Length());
+    for (int32 i = 0; i < particles.Length(); i++)
+        restParticles[i] = Float4(Float3(particles[i]), maxDistances.Length() == particles.Length() ? maxDistances[i] : 1.0f);
+    const uint32 particlesSize = particles.Length() * sizeof(Float4);
+    const auto dataFlags = GPUBufferFlags::ShaderResource;
+    const auto particlesFlags = GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess;
+    const auto outputFlags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess;
+    return InitBuffer(RestParticles, TEXT("Cloth.RestParticles"), restParticles.Get(), particlesSize, dataFlags) ||
+            InitBuffer(Constraints, TEXT("Cloth.Constraints"), constraints.Get(), Math::Max(constraints.Length(), 4) * sizeof(uint32), dataFlags) ||
+            InitBuffer(Adjacency, TEXT("Cloth.Adjacency"), adjacency.Get(), adjacency.Length() * sizeof(uint32), dataFlags) ||
+            InitBuffer(Particles, TEXT("Cloth.Particles"), particles.Get(), particlesSize, particlesFlags) ||
+            InitBuffer(PrevParticles, TEXT("Cloth.PrevParticles"), particles.Get(), particlesSize, particlesFlags) ||
+            InitBuffer(VB0, TEXT("Cloth.VB0"), nullptr, particles.Length() * sizeof(VB0ElementType), outputFlags, sizeof(VB0ElementType)) ||
+            InitBuffer(VB1, TEXT("Cloth.VB1"), nullptr, particles.Length() * sizeof(VB1ElementType), outputFlags, sizeof(VB1ElementType));
+}
+
+void GPUClothData::Release()
+{
+    SAFE_DELETE_GPU_RESOURCE(RestParticles);
+    SAFE_DELETE_GPU_RESOURCE(Constraints);
+    SAFE_DELETE_GPU_RESOURCE(Adjacency);
+    SAFE_DELETE_GPU_RESOURCE(Particles);
+    SAFE_DELETE_GPU_RESOURCE(PrevParticles);
+    SAFE_DELETE_GPU_RESOURCE(VB0);
+    SAFE_DELETE_GPU_RESOURCE(VB1);
+    ConstraintsGroups.Clear();
+    ParticlesCount = 0;
+    IsVB0Initialized = false;
+    IsVB1Initialized = false;
+}
+
+String ClothSimulationPass::ToString() const
+{
+    return TEXT("ClothSimulationPass");
+}
+
+bool ClothSimulationPass::Init()
+{
+    // Compute shaders support is required for this implementation
+    _isSupported = GPUDevice::Instance->Limits.HasCompute;
+    if (!_isSupported)
+        return false;
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ClothSimulation"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ClothSimulationPass, &ClothSimulationPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void ClothSimulationPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _shader = nullptr;
+}
+
+bool ClothSimulationPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csIntegrate = shader->GetCS("CS_Integrate");
+    _csSolveConstraints = shader->GetCS("CS_SolveConstraints");
+    _csConstrain = shader->GetCS("CS_Constrain");
+    _csOutputPositions = shader->GetCS("CS_OutputPositions");
+    _csOutputNormals = shader->GetCS("CS_OutputNormals");
+
+    return false;
+}
+
+bool ClothSimulationPass::CanUse() const
+{
+    return _isSupported && _shader;
+}
+
+bool ClothSimulationPass::Simulate(GPUClothData& data, const GPUClothStep& step, GPUBuffer* sourceVB1)
+{
+    if (data.ParticlesCount == 0 || !data.Particles || !data.VB0 || !data.VB1)
+        return true;
+    ScopeLock lock(RenderContext::GPULocker);
+    if (checkIfSkipPass())
+        return true;
+    PROFILE_CPU_NAMED("GPU Cloth");
+    GPUContext* context = GPUDevice::Instance->GetMainContext();
+    if (!data.IsVB1Initialized && sourceVB1 && sourceVB1->GetSize() == data.VB1->GetSize())
+    {
+        // Copy texcoords and lightmap UVs from the source mesh (normals and tangents are computed by the simulation)
+        context->CopyBuffer(data.VB1, sourceVB1, sourceVB1->GetSize());
+        data.IsVB1Initialized = true;
+    }
+
+    Data cbData;
+    Platform::MemoryClear(&cbData, sizeof(cbData));
+    cbData.Gravity = step.Gravity;
+    cbData.VelocityScale = step.VelocityScale;
+    cbData.Wind = step.Wind;
+    cbData.AirDrag = step.AirDrag;
+    cbData.ParticlesCount = (uint32)data.ParticlesCount;
+    cbData.MaxDistance = step.MaxDistance;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    const int32 particlesGroups = Math::DivideAndRoundUp(data.ParticlesCount, CLOTH_THREAD_GROUP_SIZE);
+    const int32 substeps = Math::Max(step.Substeps, 1);
+    context->BindCB(0, cb);
+    context->BindSR(0, data.RestParticles->View());
+    context->BindSR(1, data.Constraints->View());
+    context->BindUA(0, data.Particles->View());
+    context->BindUA(1, data.PrevParticles->View());
+    for (int32 substep = 0; substep < substeps; substep++)
+    {
+        // Integrate particles (apply the cloth movement inertia only once)
+        cbData.DeltaTime = step.DeltaTime / (float)substeps;
+        cbData.InertiaOffset = substep == 0 ? step.InertiaOffset : Float3::Zero;
+        cbData.ConstraintsOffset = cbData.ConstraintsCount = 0;
+        context->UpdateCB(cb, &cbData);
+        context->Dispatch(_csIntegrate, particlesGroups, 1, 1);
+
+        // Solve constraints (group by group)
+        for (const Int2& group : data.ConstraintsGroups)
+        {
+            cbData.ConstraintsOffset = (uint32)group.X;
+            cbData.ConstraintsCount = (uint32)group.Y;
+            context->UpdateCB(cb, &cbData);
+            context->Dispatch(_csSolveConstraints, Math::DivideAndRoundUp(group.Y, CLOTH_THREAD_GROUP_SIZE), 1, 1);
+        }
+
+        // Limit particles movement
+        context->Dispatch(_csConstrain, particlesGroups, 1, 1);
+    }
+    context->ResetUA();
+
+    // Write the results into the mesh vertex buffers
+    context->BindSR(2, data.Adjacency->View());
+    context->BindSR(3, data.Particles->View());
+    context->BindUA(0, data.VB0->View());
+    context->BindUA(1, data.VB1->View());
+    context->Dispatch(_csOutputPositions, particlesGroups, 1, 1);
+    data.IsVB0Initialized = true;
+    if (step.ComputeNormals && data.IsVB1Initialized)
+        context->Dispatch(_csOutputNormals, particlesGroups, 1, 1);
+    context->ResetUA();
+    context->ResetSR();
+    context->ResetCB();
+    return false;
+}
@@ -0,0 +1,177 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Math/Int2.h"
+
+class GPUBuffer;
+
+/// <summary>
+/// The cloth simulation data on the GPU (per cloth instance).
+/// </summary>
+struct FLAXENGINE_API GPUClothData
+{
+    /// <summary>
+    /// The particles rest pose (xyz: local-space position, w: max distance scale).
+    /// </summary>
+    GPUBuffer* RestParticles = nullptr;
+
+    /// <summary>
+    /// The distance constraints (particle 0, particle 1, rest length, compliance) sorted by the groups.
+    /// </summary>
+    GPUBuffer* Constraints = nullptr;
+
+    /// <summary>
+    /// The particles adjacency (triangles range per particle, followed by the triangles indices) used to compute normals.
+    /// </summary>
+    GPUBuffer* Adjacency = nullptr;
+
+    /// <summary>
+    /// The simulated particles (xyz: local-space position, w: inverse mass).
+    /// </summary>
+    GPUBuffer* Particles = nullptr;
+
+    /// <summary>
+    /// The particles positions from the previous simulation step.
+    /// </summary>
+    GPUBuffer* PrevParticles = nullptr;
+
+    /// <summary>
+    /// The output mesh positions vertex buffer (static mesh VB0 layout).
+    /// </summary>
+    GPUBuffer* VB0 = nullptr;
+
+    /// <summary>
+    /// The output mesh normals vertex buffer (static mesh VB1 layout, initialized from the source mesh).
+    /// </summary>
+    GPUBuffer* VB1 = nullptr;
+
+    /// <summary>
+    /// The ranges (offset and count) of the constraints groups. Constraints within a single group don't share particles so can be solved in parallel.
+    /// </summary>
+    Array<Int2> ConstraintsGroups;
+
+    /// <summary>
+    /// The amount of the simulated particles (mesh vertices).
+    /// </summary>
+    int32 ParticlesCount = 0;
+
+    /// <summary>
+    /// The frame number of the last simulation update.
+    /// </summary>
+    uint64 LastUpdateFrame = 0;
+
+    /// <summary>
+    /// True if the output positions vertex buffer contains the simulation results.
+    /// </summary>
+    bool IsVB0Initialized = false;
+
+    /// <summary>
+    /// True if the output normals vertex buffer contains the source mesh data.
+    /// </summary>
+    bool IsVB1Initialized = false;
+
+    ~GPUClothData()
+    {
+        Release();
+    }
+
+    /// <summary>
+    /// Initializes the GPU resources.
+    /// </summary>
+    /// <param name="particles">The particles (xyz: local-space position, w: inverse mass).</param>
+    /// <param name="maxDistances">The particles max distance scales.</param>
+    /// <param name="constraints">The constraints (particle 0, particle 1, rest length, compliance) sorted by the groups.</param>
+    /// <param name="adjacency">The particles adjacency data.</param>
+    /// <returns>True if failed, otherwise false.</returns>
+    bool Init(const Span<Float4>& particles, const Span<float>& maxDistances, const Span<uint32>& constraints, const Span<uint32>& adjacency);
+
+    /// <summary>
+    /// Releases the GPU resources.
+    /// </summary>
+    void Release();
+};
+
+/// <summary>
+/// The cloth simulation step parameters (in cloth local-space).
+/// </summary>
+struct GPUClothStep
+{
+    Float3 Gravity;
+    float DeltaTime;
+    Float3 InertiaOffset;
+    float VelocityScale;
+    Float3 Wind;
+    float AirDrag;
+    float MaxDistance;
+    int32 Substeps;
+    bool ComputeNormals;
+};
+
+/// <summary>
+/// Compute shader cloth simulation (XPBD). Simulates the cloth particles on the GPU and writes the results directly into the vertex buffers used to draw the cloth mesh (without readback to the CPU).
+/// </summary>
+class ClothSimulationPass : public RendererPass<ClothSimulationPass>
+{
+private:
+    PACK_STRUCT(struct Data {
+        Float3 Gravity;
+        float DeltaTime;
+        Float3 InertiaOffset;
+        float VelocityScale;
+        Float3 Wind;
+        float AirDrag;
+        uint32 ParticlesCount;
+        uint32 ConstraintsOffset;
+        uint32 ConstraintsCount;
+        float MaxDistance;
+        });
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csIntegrate = nullptr;
+    GPUShaderProgramCS* _csSolveConstraints = nullptr;
+    GPUShaderProgramCS* _csConstrain = nullptr;
+    GPUShaderProgramCS* _csOutputPositions = nullptr;
+    GPUShaderProgramCS* _csOutputNormals = nullptr;
+    bool _isSupported = false;
+
+public:
+    /// <summary>
+    /// Checks if the GPU cloth simulation can be used (device supports compute shaders).
+    /// </summary>
+    /// <returns>True if can simulate cloth with compute shader, otherwise false.</returns>
+    bool CanUse() const;
+
+    /// <summary>
+    /// Simulates the cloth and updates the output vertex buffers. Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="data">The cloth simulation data.</param>
+    /// <param name="step">The simulation step parameters.</param>
+    /// <param name="sourceVB1">The source mesh normals vertex buffer (copied to the output before computing normals).</param>
+    /// <returns>True if failed to simulate cloth (eg. resources not ready), otherwise false.</returns>
+    bool Simulate(GPUClothData& data, const GPUClothStep& step, GPUBuffer* sourceVB1);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csIntegrate = nullptr;
+        _csSolveConstraints = nullptr;
+        _csConstrain = nullptr;
+        _csOutputPositions = nullptr;
+        _csOutputNormals = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,159 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "ComputeSkinningPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Models/SkinnedMesh.h"
+#include "Engine/Graphics/Models/SkinnedMeshDrawData.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/Threading.h"
+
+// Those defines must match the HLSL
+#define COMPUTE_SKINNING_THREAD_GROUP_SIZE 64
+#define COMPUTE_SKINNING_GROUPS_PER_ROW 1024
+
+namespace
+{
+    bool InitBuffer(GPUBuffer*& buffer, const Char* name, uint32 stride, uint32 verticesCount)
+    {
+        if (!buffer)
+            buffer = GPUDevice::Instance->CreateBuffer(name);
+        const uint32 size = stride * verticesCount;
+        if (buffer->GetSize() == size)
+            return false;
+
+        // Skinned vertices are written by the compute shader directly into the vertex buffer
+        const auto flags = GPUBufferFlags::VertexBuffer | GPUBufferFlags::UnorderedAccess | GPUBufferFlags::RawBuffer;
+        return buffer->Init(GPUBufferDescription::Buffer(size, flags, PixelFormat::R32_Typeless, nullptr, stride));
+    }
+}
+
+String ComputeSkinningPass::ToString() const
+{
+    return TEXT("ComputeSkinningPass");
+}
+
+bool ComputeSkinningPass::Init()
+{
+    // Compute shaders support is required for this implementation
+    _isSupported = GPUDevice::Instance->Limits.HasCompute;
+    if (!_isSupported)
+        return false;
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/ComputeSkinning"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<ComputeSkinningPass, &ComputeSkinningPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void ComputeSkinningPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _shader = nullptr;
+}
+
+bool ComputeSkinningPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csSkin = shader->GetCS("CS_Skin");
+
+    return false;
+}
+
+bool ComputeSkinningPass::CanUse() const
+{
+    return Graphics::EnableComputeSkinning && _isSupported && _shader && _shader->IsLoaded();
+}
+
+bool ComputeSkinningPass::GetSkinnedVertices(const SkinnedMesh* mesh, SkinnedMeshDrawData* skinning, GPUBuffer*& vb0, GPUBuffer*& vb1)
+{
+    GPUBuffer* vertexBuffer = mesh->GetVertexBuffer();
+    if (!skinning->IsReady() || !vertexBuffer || !EnumHasAnyFlags(vertexBuffer->GetDescription().Flags, GPUBufferFlags::RawBuffer))
+        return true;
+    ScopeLock lock(RenderContext::GPULocker);
+    if (checkIfSkipPass())
+        return true;
+
+    // Find the cached vertices for this mesh
+    SkinnedMeshDrawData::SkinnedVertices* entry = nullptr;
+    for (auto& e : skinning->SkinnedBuffers)
+    {
+        if (e.Mesh == mesh)
+        {
+            entry = &e;
+            break;
+        }
+    }
+    if (!entry)
+    {
+        entry = &skinning->SkinnedBuffers.AddOne();
+        entry->Mesh = mesh;
+        entry->VB0 = nullptr;
+        entry->VB1 = nullptr;
+        entry->Version = skinning->GetVersion() + 1;
+    }
+
+    // Skip skinning if bones are the same as during the last update (eg. mesh drawn in many shadow passes)
+    const uint32 verticesCount = (uint32)mesh->GetVertexCount();
+    const bool isValid = entry->VB0 && entry->VB1 && entry->VB0->GetSize() == verticesCount * sizeof(VB0ElementType) && entry->VB1->GetSize() == verticesCount * sizeof(VB1ElementType);
+    if (!isValid || entry->Version != skinning->GetVersion())
+    {
+        PROFILE_CPU_NAMED("Compute Skinning");
+        if (InitBuffer(entry->VB0, TEXT("Skinning.VB0"), sizeof(VB0ElementType), verticesCount) ||
+            InitBuffer(entry->VB1, TEXT("Skinning.VB1"), sizeof(VB1ElementType), verticesCount))
+        {
+            entry->Version = skinning->GetVersion() + 1;
+            return true;
+        }
+        entry->Version = skinning->GetVersion();
+
+        // Skin vertices (bones are already flushed with the GPU before drawing)
+        GPUContext* context = GPUDevice::Instance->GetMainContext();
+        Data data;
+        Platform::MemoryClear(&data, sizeof(data));
+        data.VerticesCount = verticesCount;
+        const auto cb = _shader->GetShader()->GetCB(0);
+        context->UpdateCB(cb, &data);
+        context->BindCB(0, cb);
+        context->BindSR(0, vertexBuffer->View());
+        context->BindSR(1, skinning->BoneMatrices->View());
+        context->BindUA(0, entry->VB0->View());
+        context->BindUA(1, entry->VB1->View());
+        const int32 groupsCount = Math::DivideAndRoundUp((int32)verticesCount, COMPUTE_SKINNING_THREAD_GROUP_SIZE);
+        context->Dispatch(_csSkin, Math::Min(groupsCount, COMPUTE_SKINNING_GROUPS_PER_ROW), Math::DivideAndRoundUp(groupsCount, COMPUTE_SKINNING_GROUPS_PER_ROW), 1);
+        context->ResetUA();
+        context->ResetSR();
+        context->ResetCB();
+    }
+
+    vb0 = entry->VB0;
+    vb1 = entry->VB1;
+    return false;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+class SkinnedMesh;
+class SkinnedMeshDrawData;
+
+/// <summary>
+/// Compute shader skinning for the skinned meshes. Skins the mesh vertices once per bones update into the per-instance vertex buffers (cached in SkinnedMeshDrawData) that use the static mesh vertex layout, so all passes (GBuffer, depth, shadows) can draw them as a static geometry without skinning in the vertex shader.
+/// </summary>
+class ComputeSkinningPass : public RendererPass<ComputeSkinningPass>
+{
+private:
+    PACK_STRUCT(struct Data {
+        uint32 VerticesCount;
+        uint32 Dummy0[3];
+        });
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csSkin = nullptr;
+    bool _isSupported = false;
+
+public:
+    /// <summary>
+    /// Checks if the compute skinning can be used.
+    /// </summary>
+    /// <returns>True if can skin meshes with compute shader, otherwise false.</returns>
+    bool CanUse() const;
+
+    /// <summary>
+    /// Gets the skinned vertices of the mesh. Performs the skinning if the bones have been modified since the last update (or reuses the cached vertices). Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="mesh">The skinned mesh.</param>
+    /// <param name="skinning">The skinning data (bones and the cached vertices).</param>
+    /// <param name="vb0">The output skinned positions vertex buffer (static mesh VB0 layout).</param>
+    /// <param name="vb1">The output skinned texcoords, normals and tangents vertex buffer (static mesh VB1 layout).</param>
+    /// <returns>True if failed to skin mesh (eg. resources not ready), otherwise false.</returns>
+    bool GetSkinnedVertices(const SkinnedMesh* mesh, SkinnedMeshDrawData* skinning, GPUBuffer*& vb0, GPUBuffer*& vb1);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csSkin = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
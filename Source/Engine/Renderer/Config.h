@@ -82,7 +82,7 @@ PACK_STRUCT(struct LightData {
     float Radius;
     float FalloffExponent;
     float InverseSquared;
-    float Dummy0;
+    float SeparatePass;
     float RadiusInv;
     });
 
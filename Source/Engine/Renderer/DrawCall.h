@@ -191,6 +191,8 @@ struct DrawCall
             SkinnedMeshDrawData* Skinning;
             Float3 GeometrySize; // Object geometry size in the world (unscaled).
             float LODDitherFactor; // The model LOD transition dither progress.
+            Float3 GeometryOrigin; // Object geometry bounds minimum (unscaled), used to decode the compressed vertex positions.
+            bool CompressedPositions; // True if the vertex buffer 0 contains positions quantized within the geometry bounds (see Mesh::HasCompressedPositions).
             Matrix PrevWorld;
         } Surface;
 
@@ -319,6 +321,21 @@ struct GeometryDrawStateData
     /// Interpolated between 0-255 to smooth transition over several frames and reduce LOD changing artifacts.
     /// </summary>
     byte LODTransition = 255;
+
+    /// <summary>
+    /// The model LOD index (before LOD bias) selected for the LODView in the LODFrame. Reused by the views that use it as a LOD proxy (eg. shadow maps) and as a reference for the LOD switch hysteresis.
+    /// </summary>
+    char LOD = -1;
+
+    /// <summary>
+    /// The frame index of the cached LOD. In sync with Engine::FrameCount.
+    /// </summary>
+    uint64 LODFrame = 0;
+
+    /// <summary>
+    /// The render view used to select the cached LOD.
+    /// </summary>
+    const struct RenderView* LODView = nullptr;
 };
 
 template<>
@@ -0,0 +1,262 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "FoliageCullingPass.h"
+#include "RenderList.h"
+#include "HZBPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Foliage/FoliageDrawCache.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+
+// Those defines must match the HLSL
+#define FOLIAGE_CULLING_CLUSTER_SIZE 64
+#define FOLIAGE_CULLING_THREAD_GROUP_SIZE 64
+#define FOLIAGE_CULLING_GROUPS_PER_ROW 1024
+#define FOLIAGE_CULLING_MAX_LODS 8
+
+// The amount of counters used per cull request (visible instances count and offset per LOD)
+#define FOLIAGE_CULLING_REQUEST_COUNTERS (FOLIAGE_CULLING_MAX_LODS * 2)
+
+static_assert(FOLIAGE_CULLING_CLUSTER_SIZE >= FOLIAGE_CLUSTER_CAPACITY, "Foliage culling thread group has to cover all the instances of the cluster.");
+static_assert(MODEL_MAX_LODS <= FOLIAGE_CULLING_MAX_LODS, "Too many model LODs for foliage culling.");
+
+namespace
+{
+    bool EnsureBuffer(GPUBuffer* buffer, const GPUBufferDescription& desc)
+    {
+        if (buffer->GetSize() >= desc.Size)
+            return false;
+        return buffer->Init(desc);
+    }
+
+    void Dispatch(GPUContext* context, GPUShaderProgramCS* shader, int32 groupsCount)
+    {
+        // Split groups into rows to not exceed the limit of the thread groups per dimension
+        const int32 groupsX = Math::Min(groupsCount, FOLIAGE_CULLING_GROUPS_PER_ROW);
+        const int32 groupsY = Math::DivideAndRoundUp(groupsCount, FOLIAGE_CULLING_GROUPS_PER_ROW);
+        context->Dispatch(shader, groupsX, groupsY, 1);
+    }
+}
+
+String FoliageCullingPass::ToString() const
+{
+    return TEXT("FoliageCullingPass");
+}
+
+bool FoliageCullingPass::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    _isSupported = limits.HasCompute && limits.HasDrawIndirect;
+    if (!_isSupported)
+        return false;
+
+    // Create buffers (pointers are used by the draw calls before culling so buffers are resized in-place)
+    _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.Args"));
+    _batchesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.Batches"));
+    _countersBuffer = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.Counters"));
+    _visibleSlotsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.VisibleSlots"));
+    _instancesUAV = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.OutputInstances"));
+    _instances = GPUDevice::Instance->CreateBuffer(TEXT("FoliageCulling.InstancesVB"));
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/FoliageCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<FoliageCullingPass, &FoliageCullingPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void FoliageCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _requests.Resize(0);
+    _batches.Resize(0);
+    _instancesCount = 0;
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_batchesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_countersBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_visibleSlotsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_instancesUAV);
+    SAFE_DELETE_GPU_RESOURCE(_instances);
+    _shader = nullptr;
+}
+
+bool FoliageCullingPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csCull = shader->GetCS("CS_Cull");
+    _csPrepareArgs = shader->GetCS("CS_PrepareArgs");
+    _csWriteInstances = shader->GetCS("CS_WriteInstances");
+
+    return false;
+}
+
+bool FoliageCullingPass::CanUse(const RenderContextBatch& renderContextBatch) const
+{
+    return renderContextBatch.EnableGPUDriven && _isSupported && _shader && _shader->IsLoaded();
+}
+
+int32 FoliageCullingPass::AddCull(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext, const FoliageDrawCache& cache, const Model* model, const FoliageCullingBatch* batches, int32 batchesCount)
+{
+    if (!cache.HasCullingData || cache.ClustersCount == 0 || batchesCount == 0)
+        return -1;
+    const RenderView& view = renderContext.View;
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+    const Vector3 origin = cache.Origin;
+
+    // Setup constants (positions are relative to the cache origin)
+    Request request;
+    request.Cache = &cache;
+    request.HZB = nullptr;
+    Data& data = request.Constants;
+    Platform::MemoryClear(&data, sizeof(data));
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = view.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(plane.Normal, (float)(plane.D + Vector3::Dot(plane.Normal, origin - view.Origin)));
+    }
+    data.LODViewPosition = Float3(lodView.Origin - origin) + lodView.Position;
+    data.LODScreenMultiple = 0.5f * Math::Max(lodView.Projection.Values[0][0], lodView.Projection.Values[1][1]);
+    data.LODDistanceScale = lodView.Projection.Values[2][3];
+    data.ModelLODDistanceFactorSqrt = view.ModelLODDistanceFactorSqrt;
+    data.ModelLODBias = view.ModelLODBias;
+    data.LODsCount = model->LODs.Count();
+    data.MinScreenSize = model->MinScreenSize;
+    data.ClustersCount = cache.ClustersCount;
+    data.InstancesCount = cache.Instances.Count();
+    for (int32 lodIndex = 0; lodIndex < model->LODs.Count(); lodIndex++)
+        data.LODScreenSize[lodIndex] = model->LODs[lodIndex].ScreenSize;
+    data.ArgsCount = batchesCount;
+    data.MinLOD = model->HighestResidentLODIndex();
+
+    // Occlusion culling against the HZB from the previous frame (main view only)
+    if (&renderContext == &renderContextBatch.GetMainContext())
+    {
+        Matrix hzbViewProjection;
+        Vector3 hzbOrigin;
+        request.HZB = HZBPass::Instance()->GetHZB(renderContext, hzbViewProjection, hzbOrigin);
+        if (request.HZB)
+        {
+            Matrix::Transpose(hzbViewProjection, data.HZBViewProjection);
+            data.HZBOrigin = Float3(hzbOrigin - origin);
+            data.HZBSize = Float2((float)request.HZB->Width(), (float)request.HZB->Height());
+            data.HZBMipLevels = request.HZB->MipLevels();
+        }
+    }
+
+    // Allocate ranges in the shared buffers
+    ScopeLock lock(_locker);
+    data.VisibleOffset = _instancesCount;
+    data.CountersOffset = _requests.Count() * FOLIAGE_CULLING_REQUEST_COUNTERS;
+    data.ArgsStart = _batches.Count();
+    _instancesCount += cache.Instances.Count();
+    _batches.Add(batches, batchesCount);
+    _requests.Add(request);
+    return (int32)data.ArgsStart;
+}
+
+void FoliageCullingPass::Cull(RenderContextBatch& renderContextBatch)
+{
+    if (_requests.IsEmpty())
+        return;
+    auto context = GPUDevice::Instance->GetMainContext();
+    PROFILE_GPU_CPU("Foliage Culling");
+
+    // Prepare buffers
+    const int32 batchesCount = _batches.Count();
+    const uint32 argsSize = Math::RoundUpToPowerOf2(batchesCount) * sizeof(GPUDrawIndexedIndirectArgs);
+    const uint32 instancesCapacity = Math::RoundUpToPowerOf2(_instancesCount);
+    const uint32 instancesSize = instancesCapacity * sizeof(InstanceData);
+    const uint32 countersSize = _requests.Count() * FOLIAGE_CULLING_REQUEST_COUNTERS * sizeof(uint32);
+    if (EnsureBuffer(_argsBuffer, GPUBufferDescription::Raw(argsSize, GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+    {
+        LOG(Error, "Failed to create foliage culling buffers.");
+        _requests.Clear();
+        _batches.Clear();
+        _instancesCount = 0;
+        return;
+    }
+    if (checkIfSkipPass() ||
+        EnsureBuffer(_batchesBuffer, GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(batchesCount), sizeof(FoliageCullingBatch))) ||
+        EnsureBuffer(_countersBuffer, GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(countersSize), GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_visibleSlotsBuffer, GPUBufferDescription::Raw(instancesCapacity * sizeof(uint32), GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_instancesUAV, GPUBufferDescription::Raw(instancesSize, GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_instances, GPUBufferDescription::Vertex(sizeof(InstanceData), instancesCapacity)))
+    {
+        // Skip drawing of all batches (draw calls are already added)
+        Array<byte> zeros;
+        zeros.Resize(batchesCount * sizeof(GPUDrawIndexedIndirectArgs));
+        Platform::MemoryClear(zeros.Get(), zeros.Count());
+        context->UpdateBuffer(_argsBuffer, zeros.Get(), zeros.Count());
+        _requests.Clear();
+        _batches.Clear();
+        _instancesCount = 0;
+        return;
+    }
+
+    // Upload batches and reset counters
+    {
+        Array<uint32> counters;
+        counters.Resize(countersSize / sizeof(uint32));
+        Platform::MemoryClear(counters.Get(), countersSize);
+        context->UpdateBuffer(_countersBuffer, counters.Get(), countersSize);
+    }
+    context->UpdateBuffer(_batchesBuffer, _batches.Get(), batchesCount * sizeof(FoliageCullingBatch));
+
+    // Cull instances, allocate output ranges per LOD and write visible instances data (per request)
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->BindCB(0, cb);
+    context->BindSR(3, _batchesBuffer->View());
+    context->BindUA(0, _argsBuffer->View());
+    context->BindUA(1, _countersBuffer->View());
+    context->BindUA(2, _visibleSlotsBuffer->View());
+    context->BindUA(3, _instancesUAV->View());
+    for (const Request& request : _requests)
+    {
+        const FoliageDrawCache& cache = *request.Cache;
+        context->UpdateCB(cb, &request.Constants);
+        context->BindSR(0, cache.ClustersBuffer->View());
+        context->BindSR(1, cache.CullingInstancesBuffer->View());
+        context->BindSR(2, cache.InstanceBuffer->View());
+        context->BindSR(4, request.HZB);
+        Dispatch(context, _csCull, cache.ClustersCount);
+        context->Dispatch(_csPrepareArgs, 1, 1, 1);
+        Dispatch(context, _csWriteInstances, Math::DivideAndRoundUp(cache.Instances.Count(), FOLIAGE_CULLING_THREAD_GROUP_SIZE));
+    }
+
+    // Copy instances into the vertex buffer used for drawing
+    context->ResetUA();
+    context->ResetSR();
+    context->ResetCB();
+    context->CopyBuffer(_instances, _instancesUAV, _instancesCount * sizeof(InstanceData));
+
+    _requests.Clear();
+    _batches.Clear();
+    _instancesCount = 0;
+}
@@ -0,0 +1,139 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+
+class Model;
+class FoliageDrawCache;
+struct RenderContextBatch;
+
+/// <summary>
+/// The draw batch (single mesh of the model LOD) that uses the instances culled by the FoliageCullingPass.
+/// </summary>
+PACK_STRUCT(struct FoliageCullingBatch {
+    uint32 IndicesCount;
+    uint32 StartIndex;
+    uint32 LOD;
+    uint32 Dummy0;
+    });
+
+/// <summary>
+/// GPU culling pass for the cached foliage (see FoliageType::UseDrawCache). Culls the leaf clusters and their instances (distance, frustum, occlusion) and selects the instances LODs with compute shaders. Writes compacted per-LOD instances lists and the indirect draw arguments for every mesh batch.
+/// </summary>
+class FoliageCullingPass : public RendererPass<FoliageCullingPass>
+{
+private:
+    PACK_STRUCT(struct Data {
+        Float4 FrustumPlanes[6];
+        Float3 LODViewPosition;
+        float LODScreenMultiple;
+        float LODDistanceScale;
+        float ModelLODDistanceFactorSqrt;
+        int32 ModelLODBias;
+        uint32 LODsCount;
+        float MinScreenSize;
+        uint32 ClustersCount;
+        uint32 InstancesCount;
+        uint32 VisibleOffset;
+        float LODScreenSize[8];
+        uint32 CountersOffset;
+        uint32 ArgsStart;
+        uint32 ArgsCount;
+        uint32 MinLOD;
+        Float2 HZBSize;
+        uint32 HZBMipLevels;
+        float Dummy1;
+        Matrix HZBViewProjection;
+        Float3 HZBOrigin;
+        float Dummy2;
+        });
+
+    struct Request
+    {
+        const FoliageDrawCache* Cache;
+        GPUTexture* HZB;
+        Data Constants;
+    };
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csCull = nullptr;
+    GPUShaderProgramCS* _csPrepareArgs = nullptr;
+    GPUShaderProgramCS* _csWriteInstances = nullptr;
+    bool _isSupported = false;
+    CriticalSection _locker;
+    Array<Request> _requests;
+    Array<FoliageCullingBatch> _batches;
+    int32 _instancesCount = 0;
+    GPUBuffer* _argsBuffer = nullptr;
+    GPUBuffer* _batchesBuffer = nullptr;
+    GPUBuffer* _countersBuffer = nullptr;
+    GPUBuffer* _visibleSlotsBuffer = nullptr;
+    GPUBuffer* _instancesUAV = nullptr;
+    GPUBuffer* _instances = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the GPU culling can be used for the given render views batch.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <returns>True if can add cull requests for this batch, otherwise false.</returns>
+    bool CanUse(const RenderContextBatch& renderContextBatch) const;
+
+    /// <summary>
+    /// Adds the foliage cache to be culled for the given view. Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <param name="renderContext">The rendering context (view to cull for).</param>
+    /// <param name="cache">The foliage draw cache (with culling data).</param>
+    /// <param name="model">The foliage model.</param>
+    /// <param name="batches">The draw batches to write indirect draw arguments for.</param>
+    /// <param name="batchesCount">The draw batches count.</param>
+    /// <returns>The index of the first batch indirect draw arguments in the arguments buffer (see GetArgsBuffer), or -1 if failed.</returns>
+    int32 AddCull(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext, const FoliageDrawCache& cache, const Model* model, const FoliageCullingBatch* batches, int32 batchesCount);
+
+    /// <summary>
+    /// Performs the GPU culling for all requests added for this batch. Called after collecting draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    void Cull(RenderContextBatch& renderContextBatch);
+
+    /// <summary>
+    /// Gets the indirect draw arguments buffer (written by GPU culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetArgsBuffer() const
+    {
+        return _argsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the visible instances vertex buffer (written by GPU culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetInstancesBuffer() const
+    {
+        return _instances;
+    }
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csCull = nullptr;
+        _csPrepareArgs = nullptr;
+        _csWriteInstances = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
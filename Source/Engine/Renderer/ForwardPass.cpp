@@ -2,16 +2,83 @@
 
 #include "ForwardPass.h"
 #include "RenderList.h"
+#include "VariableRateShadingPass.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+
+// The clustered lights grid configuration
+#define LIGHT_GRID_TILE_SIZE 64
+#define LIGHT_GRID_DEPTH_SLICES 32
+#define LIGHT_GRID_MAX_LIGHTS 1024
+#define LIGHT_GRID_MAX_CELL_LIGHTS 32
+
+namespace
+{
+    struct LightGridBounds
+    {
+        Int3 Min, Max;
+    };
+
+    bool GetLightGridBounds(const RenderView& view, const Int3& gridSize, const Float4& gridParams, const Float3& position, float radius, LightGridBounds& result)
+    {
+        // Transform light sphere to the view-space and pick the depth slices range
+        Float3 center;
+        Float3::Transform(position, view.View, center);
+        const float minZ = center.Z - radius;
+        const float maxZ = center.Z + radius;
+        if (maxZ < view.Near || minZ > view.Far)
+            return false;
+        const auto getSlice = [&](float z)
+        {
+            return Math::Clamp((int32)(Math::Log2(Math::Max(z, view.Near)) * gridParams.Y + gridParams.Z), 0, gridSize.Z - 1);
+        };
+        result.Min.Z = getSlice(minZ);
+        result.Max.Z = getSlice(maxZ);
+
+        // Project light bounds corners to the screen and pick the tiles range
+        result.Min.X = result.Min.Y = 0;
+        result.Max.X = gridSize.X - 1;
+        result.Max.Y = gridSize.Y - 1;
+        if (minZ <= view.Near && !view.IsOrthographicProjection())
+            return true; // Camera is inside the light bounds
+        Float2 ndcMin(MAX_float), ndcMax(-MAX_float);
+        for (int32 i = 0; i < 8; i++)
+        {
+            const Float3 corner(center.X + (i & 1 ? radius : -radius), center.Y + (i & 2 ? radius : -radius), i & 4 ? maxZ : minZ);
+            Float4 projected;
+            Float3::Transform(corner, view.Projection, projected);
+            if (projected.W <= ZeroTolerance)
+                return true;
+            const Float2 ndc(projected.X / projected.W, projected.Y / projected.W);
+            ndcMin = Float2::Min(ndcMin, ndc);
+            ndcMax = Float2::Max(ndcMax, ndc);
+        }
+        if (ndcMax.X < -1.0f || ndcMin.X > 1.0f || ndcMax.Y < -1.0f || ndcMin.Y > 1.0f)
+            return false;
+
+        // NDC to tiles (Y is flipped in the screen-space)
+        const auto toTile = [](float ndc, int32 count, bool flip)
+        {
+            const float uv = flip ? 0.5f - ndc * 0.5f : ndc * 0.5f + 0.5f;
+            return Math::Clamp((int32)(uv * (float)count), 0, count - 1);
+        };
+        result.Min.X = toTile(ndcMin.X, gridSize.X, false);
+        result.Max.X = toTile(ndcMax.X, gridSize.X, false);
+        result.Min.Y = toTile(ndcMax.Y, gridSize.Y, true);
+        result.Max.Y = toTile(ndcMin.Y, gridSize.Y, true);
+        return true;
+    }
+}
 
 ForwardPass::ForwardPass()
     : _shader(nullptr)
@@ -69,6 +136,10 @@ void ForwardPass::Dispose()
 
     // Cleanup
     SAFE_DELETE_GPU_RESOURCE(_psApplyDistortion);
+    SAFE_DELETE(_lightGridLights);
+    SAFE_DELETE(_lightGridCells);
+    SAFE_DELETE(_lightGridIndices);
+    _lightGridList = nullptr;
     _shader = nullptr;
 }
 
@@ -118,7 +189,9 @@ void ForwardPass::Render(RenderContext& renderContext, GPUTexture* input, GPUTex
 
         // Render distortion pass
         view.Pass = DrawPass::Distortion;
+        context->SetShadingRateImage(VariableRateShadingPass::Instance()->GetShadingRateImage(renderContext));
         mainCache->ExecuteDrawCalls(renderContext, distortionList);
+        context->SetShadingRateImage(nullptr);
 
         // Copy combined frame with distortion from transparent materials
         context->SetViewportAndScissors((float)width, (float)height);
@@ -135,9 +208,140 @@ void ForwardPass::Render(RenderContext& renderContext, GPUTexture* input, GPUTex
 
     if (!forwardList.IsEmpty())
     {
+        // Prepare local lights for the forward shading
+        BuildLightGrid(renderContext);
+
         // Run forward pass
         view.Pass = DrawPass::Forward;
         context->SetRenderTarget(depthBufferHandle, output->View());
+        context->SetShadingRateImage(VariableRateShadingPass::Instance()->GetShadingRateImage(renderContext));
         mainCache->ExecuteDrawCalls(renderContext, forwardList, input->View());
+        context->SetShadingRateImage(nullptr);
+    }
+}
+
+void ForwardPass::Prepare()
+{
+    _lightGridList = nullptr;
+}
+
+void ForwardPass::BuildLightGrid(RenderContext& renderContext)
+{
+    auto cache = renderContext.List;
+    if (_lightGridList == cache)
+        return;
+    _lightGridList = nullptr;
+    if (GPUDevice::Instance->GetFeatureLevel() < FeatureLevel::SM5 || !renderContext.Buffers || cache->PointLights.Count() + cache->SpotLights.Count() == 0)
+        return;
+    PROFILE_CPU();
+    if (!_lightGridLights)
+    {
+        _lightGridLights = New<DynamicStructuredBuffer>(64u * (uint32)sizeof(LightData), (uint32)sizeof(LightData), false, TEXT("Forward.LightGridLights"));
+        _lightGridCells = New<DynamicTypedBuffer>(1024u * (uint32)sizeof(Int2), PixelFormat::R32G32_UInt, false, TEXT("Forward.LightGridCells"));
+        _lightGridIndices = New<DynamicTypedBuffer>(1024u * (uint32)sizeof(uint32), PixelFormat::R32_UInt, false, TEXT("Forward.LightGridIndices"));
     }
+    auto& view = renderContext.View;
+
+    // Setup grid (screen tiles and exponential depth slices)
+    LightGrid& grid = _lightGrid;
+    grid.Size.X = Math::DivideAndRoundUp(renderContext.Buffers->GetWidth(), LIGHT_GRID_TILE_SIZE);
+    grid.Size.Y = Math::DivideAndRoundUp(renderContext.Buffers->GetHeight(), LIGHT_GRID_TILE_SIZE);
+    grid.Size.Z = LIGHT_GRID_DEPTH_SLICES;
+    const float depthScale = (float)LIGHT_GRID_DEPTH_SLICES / Math::Log2(view.Far / view.Near);
+    grid.Params = Float4(1.0f / LIGHT_GRID_TILE_SIZE, depthScale, -Math::Log2(view.Near) * depthScale, 0.0f);
+    const int32 cellsCount = grid.Size.X * grid.Size.Y * grid.Size.Z;
+
+    // Collect the lights bounds within the grid
+    // Lights with shadows or IES profiles are drawn by LightPass separately, so mark them to be skipped by the clustered deferred lighting
+    Array<LightGridBounds, RendererAllocation> lightsBounds;
+    _lightGridLights->Clear();
+    int32 i = 0;
+    for (; i < cache->PointLights.Count() && lightsBounds.Count() < LIGHT_GRID_MAX_LIGHTS; i++)
+    {
+        const auto& light = cache->PointLights[i];
+        LightGridBounds bounds;
+        if (GetLightGridBounds(view, grid.Size, grid.Params, light.Position, light.Radius, bounds))
+        {
+            LightData* data = _lightGridLights->WriteReserve<LightData>(1);
+            light.SetupLightData(data, false);
+            data->SeparatePass = light.ShadowDataIndex != -1 || light.IESTexture ? 1.0f : 0.0f;
+            lightsBounds.Add(bounds);
+        }
+    }
+    grid.PointLightsCount = i;
+    for (i = 0; i < cache->SpotLights.Count() && lightsBounds.Count() < LIGHT_GRID_MAX_LIGHTS; i++)
+    {
+        const auto& light = cache->SpotLights[i];
+        LightGridBounds bounds;
+        if (GetLightGridBounds(view, grid.Size, grid.Params, light.Position, light.Radius, bounds))
+        {
+            LightData* data = _lightGridLights->WriteReserve<LightData>(1);
+            light.SetupLightData(data, false);
+            data->SeparatePass = light.ShadowDataIndex != -1 || light.IESTexture ? 1.0f : 0.0f;
+            lightsBounds.Add(bounds);
+        }
+    }
+    grid.SpotLightsCount = i;
+    if (lightsBounds.IsEmpty())
+        return;
+
+    // Count lights per cell
+    _lightGridCells->Clear();
+    Int2* cells = _lightGridCells->WriteReserve<Int2>(cellsCount);
+    Platform::MemoryClear(cells, cellsCount * sizeof(Int2));
+    for (const LightGridBounds& bounds : lightsBounds)
+    {
+        for (int32 z = bounds.Min.Z; z <= bounds.Max.Z; z++)
+        {
+            for (int32 y = bounds.Min.Y; y <= bounds.Max.Y; y++)
+            {
+                Int2* row = cells + (z * grid.Size.Y + y) * grid.Size.X;
+                for (int32 x = bounds.Min.X; x <= bounds.Max.X; x++)
+                    row[x].Y = Math::Min(row[x].Y + 1, LIGHT_GRID_MAX_CELL_LIGHTS);
+            }
+        }
+    }
+
+    // Allocate lights lists and fill them with indices
+    int32 indicesCount = 0;
+    for (int32 i = 0; i < cellsCount; i++)
+    {
+        cells[i].X = indicesCount;
+        indicesCount += cells[i].Y;
+        cells[i].Y = 0;
+    }
+    _lightGridIndices->Clear();
+    uint32* indices = _lightGridIndices->WriteReserve<uint32>(Math::Max(indicesCount, 1));
+    for (int32 lightIndex = 0; lightIndex < lightsBounds.Count(); lightIndex++)
+    {
+        const LightGridBounds& bounds = lightsBounds[lightIndex];
+        for (int32 z = bounds.Min.Z; z <= bounds.Max.Z; z++)
+        {
+            for (int32 y = bounds.Min.Y; y <= bounds.Max.Y; y++)
+            {
+                Int2* row = cells + (z * grid.Size.Y + y) * grid.Size.X;
+                for (int32 x = bounds.Min.X; x <= bounds.Max.X; x++)
+                {
+                    Int2& cell = row[x];
+                    if (cell.Y < LIGHT_GRID_MAX_CELL_LIGHTS)
+                        indices[cell.X + cell.Y++] = lightIndex;
+                }
+            }
+        }
+    }
+
+    // Upload data
+    auto context = GPUDevice::Instance->GetMainContext();
+    _lightGridLights->Flush(context);
+    _lightGridCells->Flush(context);
+    _lightGridIndices->Flush(context);
+    grid.Lights = _lightGridLights->GetBuffer();
+    grid.Cells = _lightGridCells->GetBuffer();
+    grid.Indices = _lightGridIndices->GetBuffer();
+    _lightGridList = cache;
+}
+
+const ForwardPass::LightGrid* ForwardPass::GetLightGrid(const RenderContext& renderContext) const
+{
+    return _lightGridList && _lightGridList == renderContext.List ? &_lightGrid : nullptr;
 }
@@ -6,15 +6,66 @@
 #include "RendererPass.h"
 #include "Engine/Content/Assets/Shader.h"
 
+class DynamicStructuredBuffer;
+class DynamicTypedBuffer;
+
 /// <summary>
 /// Forward rendering pass for transparent geometry.
 /// </summary>
 class ForwardPass : public RendererPass<ForwardPass>
 {
+public:
+
+    /// <summary>
+    /// The clustered lights grid (screen tiles and exponential depth slices) with lists of the local lights affecting each cluster. Used by the forward shading materials (eg. transparent surfaces and particles) to receive many local lights.
+    /// </summary>
+    struct LightGrid
+    {
+        /// <summary>
+        /// The grid size (tiles in X and Y, depth slices in Z).
+        /// </summary>
+        Int3 Size;
+
+        /// <summary>
+        /// The grid parameters: x: inverse tile size (in pixels), y: depth slice scale, z: depth slice bias (slice = log2(viewZ) * y + z).
+        /// </summary>
+        Float4 Params;
+
+        /// <summary>
+        /// The local lights data (StructuredBuffer of LightData).
+        /// </summary>
+        GPUBuffer* Lights;
+
+        /// <summary>
+        /// The clusters data (Buffer of uint2 with offset and count of the light indices).
+        /// </summary>
+        GPUBuffer* Cells;
+
+        /// <summary>
+        /// The light indices of all clusters (Buffer of uint).
+        /// </summary>
+        GPUBuffer* Indices;
+
+        /// <summary>
+        /// The amount of the point lights (from the start of the render list) processed by the grid. Lights after that (over the grid lights limit) are not included.
+        /// </summary>
+        int32 PointLightsCount;
+
+        /// <summary>
+        /// The amount of the spot lights (from the start of the render list) processed by the grid. Lights after that (over the grid lights limit) are not included.
+        /// </summary>
+        int32 SpotLightsCount;
+    };
+
 private:
 
     AssetReference<Shader> _shader;
     GPUPipelineState* _psApplyDistortion;
+    DynamicStructuredBuffer* _lightGridLights = nullptr;
+    DynamicTypedBuffer* _lightGridCells = nullptr;
+    DynamicTypedBuffer* _lightGridIndices = nullptr;
+    LightGrid _lightGrid;
+    const void* _lightGridList = nullptr;
 
 public:
 
@@ -33,6 +84,24 @@ class ForwardPass : public RendererPass<ForwardPass>
     /// <param name="output">The output frame.</param>
     void Render(RenderContext& renderContext, GPUTexture* input, GPUTexture* output);
 
+    /// <summary>
+    /// Prepares the pass for the view rendering (resets the lights grid built for the previous view).
+    /// </summary>
+    void Prepare();
+
+    /// <summary>
+    /// Builds the clustered lights grid for the local lights of the rendering view and uploads it to the GPU. Does nothing if grid has been already built for this view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    void BuildLightGrid(RenderContext& renderContext);
+
+    /// <summary>
+    /// Gets the clustered lights grid built for the rendering view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The lights grid or null if not built for this view (eg. not supported).</returns>
+    const LightGrid* GetLightGrid(const RenderContext& renderContext) const;
+
 private:
 
 #if COMPILE_WITH_DEV_ENV
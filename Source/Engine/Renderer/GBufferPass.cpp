@@ -2,6 +2,8 @@
 
 #include "GBufferPass.h"
 #include "RenderList.h"
+#include "GPUDrivenRenderingPass.h"
+#include "VariableRateShadingPass.h"
 #if USE_EDITOR
 #include "Engine/Renderer/Editor/VertexColors.h"
 #include "Engine/Renderer/Editor/LightmapUVsDensity.h"
@@ -9,6 +11,8 @@
 #include "Engine/Renderer/Editor/MaterialComplexity.h"
 #endif
 #include "Engine/Core/Collections/Sorting.h"
+#include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Graphics/DynamicBuffer.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/Shaders/GPUShader.h"
@@ -27,6 +31,19 @@ PACK_STRUCT(struct GBufferPassData{
     int32 ViewMode;
     });
 
+// Per-instance data of the decals drawn with instancing (see DecalInstance in Decal material template)
+struct DecalInstanceData
+{
+    Float3 Transform1;
+    Float3 Transform2;
+    Float3 Transform3;
+    Float3 Origin;
+    Float3 InvTransform1;
+    Float3 InvTransform2;
+    Float3 InvTransform3;
+    Float3 InvOrigin;
+};
+
 #if USE_EDITOR
 Dictionary<GPUBuffer*, const ModelLOD*> GBufferPass::IndexBufferToModelLOD;
 CriticalSection GBufferPass::Locker;
@@ -97,6 +114,7 @@ void GBufferPass::Dispose()
     _gBufferShader = nullptr;
     _skyModel = nullptr;
     _boxModel = nullptr;
+    SAFE_DELETE(_decalsInstances);
 #if USE_EDITOR
     SAFE_DELETE(_lightmapUVsDensity);
     SAFE_DELETE(_vertexColors);
@@ -203,16 +221,28 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     }
 #endif
 
-    // Draw objects that can get decals
-    context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
-    renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBuffer);
+    // Draw objects that can get decals (big lists can be recorded in parallel so setup the state of each used context)
+    GPUTexture* shadingRateImage = VariableRateShadingPass::Instance()->GetShadingRateImage(renderContext);
+    context->SetShadingRateImage(shadingRateImage);
+    const Viewport viewport = renderContext.Task->GetViewport();
+    GPUTextureView* depthBuffer = *renderContext.Buffers->DepthBuffer;
+    const Function<void(GPUContext*)> setupContext = [&](GPUContext* ctx)
+    {
+        ctx->SetViewportAndScissors(viewport);
+        ctx->SetRenderTarget(depthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+    };
+    context->SetRenderTarget(depthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+    renderContext.List->ExecuteDrawCallsParallel(renderContext, DrawCallsListType::GBuffer, setupContext);
+    GPUDrivenRenderingPass::Instance()->Draw(renderContext, DrawCallsListType::GBuffer);
 
     // Draw decals
     DrawDecals(renderContext, lightBuffer->View());
 
     // Draw objects that cannot get decals
-    context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
-    renderContext.List->ExecuteDrawCalls(renderContext, DrawCallsListType::GBufferNoDecals);
+    context->SetRenderTarget(depthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+    renderContext.List->ExecuteDrawCallsParallel(renderContext, DrawCallsListType::GBufferNoDecals, setupContext);
+    GPUDrivenRenderingPass::Instance()->Draw(renderContext, DrawCallsListType::GBufferNoDecals);
+    context->SetShadingRateImage(nullptr);
 
     GPUTexture* nullTexture = nullptr;
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::AfterGBufferPass, lightBuffer, nullTexture);
@@ -222,7 +252,9 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
     {
         PROFILE_GPU_CPU_NAMED("Sky");
         context->SetRenderTarget(*renderContext.Buffers->DepthBuffer, ToSpan(targetBuffers, ARRAY_COUNT(targetBuffers)));
+        context->SetShadingRateImage(shadingRateImage);
         DrawSky(renderContext, context);
+        context->SetShadingRateImage(nullptr);
     }
 
     context->ResetRenderTarget();
@@ -230,7 +262,9 @@ void GBufferPass::Fill(RenderContext& renderContext, GPUTexture* lightBuffer)
 
 bool SortDecal(Decal* const& a, Decal* const& b)
 {
-    return a->SortOrder < b->SortOrder;
+    if (a->SortOrder != b->SortOrder)
+        return a->SortOrder < b->SortOrder;
+    return a->Material.Get() < b->Material.Get();
 }
 
 void GBufferPass::RenderDebug(RenderContext& renderContext)
@@ -441,28 +475,70 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
     auto model = _boxModel.Get();
     auto buffers = renderContext.Buffers;
 
-    // Sort decals from the lowest order to the highest order
+    // Sort decals from the lowest order to the highest order (decals with the same order are grouped by material for batching)
     Sorting::QuickSort(decals.Get(), (int32)decals.Count(), &SortDecal);
 
-    // TODO: batch decals using the same material
-
-    // TODO: sort decals by the blending mode within the same order
-
     // Prepare
     DrawCall drawCall;
     MaterialBase::BindParameters bindParams(context, renderContext, drawCall);
     bindParams.BindViewData();
     drawCall.Material = nullptr;
     drawCall.WorldDeterminantSign = 1.0f;
-
-    // Draw all decals
+    const Mesh& mesh = model->LODs[0].Meshes[0];
+    const bool canUseInstancing = decals.Count() > 1 && mesh.IsInitialized();
+    Array<Matrix, RendererAllocation> worlds;
+    Array<bool, RendererAllocation> cameraInside;
+    worlds.Resize(decals.Count());
+    cameraInside.Resize(decals.Count());
+    if (canUseInstancing)
+    {
+        if (!_decalsInstances)
+            _decalsInstances = New<DynamicVertexBuffer>(64u * (uint32)sizeof(DecalInstanceData), (uint32)sizeof(DecalInstanceData), TEXT("GBuffer.DecalsInstances"));
+        _decalsInstances->Clear();
+    }
     for (int32 i = 0; i < decals.Count(); i++)
     {
         const auto decal = decals[i];
         ASSERT(decal && decal->Material);
         Transform transform = decal->GetTransform();
         transform.Scale *= decal->GetSize();
-        renderContext.View.GetWorldMatrix(transform, drawCall.World);
+        Matrix& world = worlds[i];
+        renderContext.View.GetWorldMatrix(transform, world);
+        cameraInside[i] = OrientedBoundingBox(Vector3::Half, world).Contains(renderContext.View.Position) == ContainmentType::Contains;
+        if (canUseInstancing)
+        {
+            // Write instance data for all decals (instanced batch uses the offset of its first decal)
+            Matrix invWorld;
+            Matrix::Invert(world, invWorld);
+            auto instance = _decalsInstances->WriteReserve<DecalInstanceData>(1);
+            instance->Transform1 = Float3(world.M11, world.M12, world.M13);
+            instance->Transform2 = Float3(world.M21, world.M22, world.M23);
+            instance->Transform3 = Float3(world.M31, world.M32, world.M33);
+            instance->Origin = Float3(world.M41, world.M42, world.M43);
+            instance->InvTransform1 = Float3(invWorld.M11, invWorld.M12, invWorld.M13);
+            instance->InvTransform2 = Float3(invWorld.M21, invWorld.M22, invWorld.M23);
+            instance->InvTransform3 = Float3(invWorld.M31, invWorld.M32, invWorld.M33);
+            instance->InvOrigin = Float3(invWorld.M41, invWorld.M42, invWorld.M43);
+        }
+    }
+    if (canUseInstancing)
+        _decalsInstances->Flush(context);
+
+    // Draw all decals (consecutive decals with the same material and order are drawn with a single instanced draw call, unless camera is inside the decal volume)
+    for (int32 i = 0; i < decals.Count();)
+    {
+        const auto decal = decals[i];
+        int32 batchSize = 1;
+        IMaterial::InstancingHandler handler;
+        if (canUseInstancing && !cameraInside[i] && decal->Material->CanUseInstancing(handler))
+        {
+            while (i + batchSize < decals.Count() &&
+                decals[i + batchSize]->Material.Get() == decal->Material.Get() &&
+                decals[i + batchSize]->SortOrder == decal->SortOrder &&
+                !cameraInside[i + batchSize])
+                batchSize++;
+        }
+        drawCall.World = worlds[i];
         drawCall.ObjectPosition = drawCall.World.GetTranslation();
         drawCall.ObjectRadius = (float)decal->GetSphere().Radius;
 
@@ -516,8 +592,20 @@ void GBufferPass::DrawDecals(RenderContext& renderContext, GPUTextureView* light
 
         // Draw decal
         drawCall.PerInstanceRandom = decal->GetPerInstanceRandom();
+        bindParams.DrawCallsCount = batchSize;
         decal->Material->Bind(bindParams);
-        model->Render(context);
+        if (batchSize > 1)
+        {
+            GPUBuffer* vb[2] = { mesh.GetFullPrecisionVertexBuffer(), _decalsInstances->GetBuffer() };
+            context->BindVB(ToSpan(vb, 2));
+            context->BindIB(mesh.GetIndexBuffer());
+            context->DrawIndexedInstanced(mesh.GetTriangleCount() * 3, batchSize, i, 0, 0);
+        }
+        else
+        {
+            model->Render(context);
+        }
+        i += batchSize;
     }
 
     context->ResetSR();
@@ -47,7 +47,7 @@ PACK_STRUCT(struct Data0
     GlobalSignDistanceFieldPass::ConstantsData GlobalSDF;
     GlobalSurfaceAtlasPass::ConstantsData GlobalSurfaceAtlas;
     GBufferData GBuffer;
-    float Padding0;
+    float ProbesUpdateRate;
     float ProbesDistanceLimit;
     float ResetBlend;
     float TemporalTime;
@@ -409,6 +409,18 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
         cascadeSkipUpdate[cascadeIndex] = !clear && (ddgiData.LastFrameUsed % cascadeFrequencies[cascadeIndex]) != 0;
     }
 
+    // Calculate the update rate of probes to fit within the rays budget (probes further away from the view are updated stochastically at the reduced rate)
+    float probesUpdateRate = 1.0f;
+    if (settings.RaysBudget > 0 && !clear)
+    {
+        int32 cascadesToUpdate = 0;
+        for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
+            cascadesToUpdate += cascadeSkipUpdate[cascadeIndex] ? 0 : 1;
+        const float raysCount = (float)cascadesToUpdate * (float)(probesCounts.X * probesCounts.Y * probesCounts.Z) * (float)probeRaysCount;
+        if (raysCount > 0.0f)
+            probesUpdateRate = Math::Clamp((float)settings.RaysBudget * 1000.0f / raysCount, 0.05f, 1.0f);
+    }
+
     // Compute scrolling (probes are placed around camera but are scrolling to increase stability during movement)
     for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
     {
@@ -473,6 +485,7 @@ bool DynamicDiffuseGlobalIlluminationPass::RenderInner(RenderContext& renderCont
         data.DDGI = ddgiData.Result.Constants;
         data.GlobalSDF = bindingDataSDF.Constants;
         data.GlobalSurfaceAtlas = bindingDataSurfaceAtlas.Constants;
+        data.ProbesUpdateRate = probesUpdateRate;
         data.ProbesDistanceLimit = 1.05f; // TODO: expose to be configurable?
         data.ResetBlend = clear ? 1.0f : 0.0f;
         for (int32 cascadeIndex = 0; cascadeIndex < cascadesCount; cascadeIndex++)
@@ -8,6 +8,7 @@
 #include "../ShadowsPass.h"
 #include "Engine/Core/Math/Matrix3x3.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
+#include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
@@ -34,6 +35,8 @@
 #define GLOBAL_SURFACE_ATLAS_TILE_SIZE_MIN 8 // The minimum size of the tile
 #define GLOBAL_SURFACE_ATLAS_TILE_SIZE_MAX 192 // The maximum size of the tile
 #define GLOBAL_SURFACE_ATLAS_TILE_PROJ_PLANE_OFFSET 0.1f // Small offset to prevent clipping with the closest triangles (shifts near and far planes)
+#define GLOBAL_SURFACE_ATLAS_REDRAW_BUDGET 0.125f // The maximum amount of atlas texels (as a fraction of the whole atlas) to redraw at a single frame (remaining dirty objects are redrawn in the next frames)
+#define GLOBAL_SURFACE_ATLAS_CACHE_TIMEOUT 60 // The amount of frames to keep tiles of the objects that are not used (eg. went out of the draw distance for a moment)
 #define GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES 0 // Forces to redraw all object tiles every frame
 #define GLOBAL_SURFACE_ATLAS_DEBUG_DRAW_OBJECTS 0 // Debug draws object bounds on redraw (and tile draw projection locations)
 #define GLOBAL_SURFACE_ATLAS_DEBUG_DRAW_CHUNKS 0 // Debug draws culled chunks bounds (non-empty)
@@ -123,12 +126,29 @@ struct GlobalSurfaceAtlasObject
     }
 };
 
+struct GlobalSurfaceAtlasDirtyObject
+{
+    void* ActorObject;
+    float Priority;
+
+    bool operator<(const GlobalSurfaceAtlasDirtyObject& other) const
+    {
+        // Higher priority goes first
+        return Priority > other.Priority;
+    }
+};
+
 struct GlobalSurfaceAtlasLight
 {
     uint64 LastFrameUsed = 0;
     uint64 LastFrameUpdated = 0;
 };
 
+namespace
+{
+    Array<GlobalSurfaceAtlasDirtyObject> DirtyObjectsPriority;
+}
+
 class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, public ISceneRenderingListener
 {
 public:
@@ -148,6 +168,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
     GlobalSurfaceAtlasPass::BindingData Result;
     GlobalSurfaceAtlasTile* AtlasTiles = nullptr; // TODO: optimize with a single allocation for atlas tiles
     Dictionary<void*, GlobalSurfaceAtlasObject> Objects;
+    Dictionary<void*, GlobalSurfaceAtlasObject> CachedObjects; // Unused objects with tiles still allocated within atlas (to be reused if object gets back in use soon)
     Dictionary<Guid, GlobalSurfaceAtlasLight> Lights;
     SamplesBuffer<uint32, 30> CulledObjectsUsageHistory;
 
@@ -172,6 +193,7 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
         LastFrameAtlasDefragmentation = Engine::FrameCount;
         SAFE_DELETE(AtlasTiles);
         Objects.Clear();
+        CachedObjects.Clear();
         Lights.Clear();
     }
 
@@ -204,6 +226,8 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
         if (a->HasStaticFlag(StaticFlags::Lightmap))
         {
             GlobalSurfaceAtlasObject* object = Objects.TryGet(a);
+            if (!object)
+                object = CachedObjects.TryGet(a);
             if (object)
             {
                 // Dirty object to redraw
@@ -220,6 +244,17 @@ class GlobalSurfaceAtlasCustomBuffer : public RenderBuffers::CustomBuffer, publi
 
     void OnSceneRenderingRemoveActor(Actor* a) override
     {
+        // Free cached tiles of the removed object (memory address can be reused by the new object)
+        GlobalSurfaceAtlasObject* object = CachedObjects.TryGet(a);
+        if (object)
+        {
+            for (auto& tile : object->Tiles)
+            {
+                if (tile)
+                    tile->Free();
+            }
+            CachedObjects.Remove(a);
+        }
     }
 
     void OnSceneRenderingClear(SceneRendering* scene) override
@@ -348,6 +383,7 @@ void GlobalSurfaceAtlasPass::Dispose()
 
     // Cleanup
     SAFE_DELETE(_vertexBuffer);
+    DirtyObjectsPriority.SetCapacity(0);
     SAFE_DELETE_GPU_RESOURCE(_culledObjectsSizeBuffer);
     SAFE_DELETE_GPU_RESOURCE(_psClear);
     SAFE_DELETE_GPU_RESOURCE(_psClearLighting);
@@ -523,17 +559,96 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
         for (auto it = surfaceAtlasData.Objects.Begin(); it.IsNotEnd(); ++it)
         {
             if (it->Value.LastFrameUsed != currentFrame)
+            {
+                // Keep tiles in the cache
+                surfaceAtlasData.CachedObjects.Add(it->Key, it->Value);
+                surfaceAtlasData.Objects.Remove(it);
+            }
+        }
+
+        // Free cached tiles after timeout or when atlas is running out of space
+        const bool atlasFull = currentFrame - surfaceAtlasData.LastFrameAtlasInsertFail < 10;
+        for (auto it = surfaceAtlasData.CachedObjects.Begin(); it.IsNotEnd(); ++it)
+        {
+            if (atlasFull || currentFrame - it->Value.LastFrameUsed >= GLOBAL_SURFACE_ATLAS_CACHE_TIMEOUT)
             {
                 for (auto& tile : it->Value.Tiles)
                 {
                     if (tile)
                         tile->Free();
                 }
-                surfaceAtlasData.Objects.Remove(it);
+                surfaceAtlasData.CachedObjects.Remove(it);
             }
         }
     }
 
+    // Limit the amount of tiles to redraw at a single frame (eg. after camera cut) by prioritizing objects with the screen coverage and staleness
+    int32 dirtyObjectsToDraw = _dirtyObjectsBuffer.Count();
+    if (_dirtyObjectsBuffer.Count() != 0 && !GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES)
+    {
+        const uint64 texelsBudget = (uint64)((float)resolution * (float)resolution * GLOBAL_SURFACE_ATLAS_REDRAW_BUDGET);
+        uint64 texelsTotal = 0;
+        for (void* actorObject : _dirtyObjectsBuffer)
+        {
+            const GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(actorObject);
+            if (!objectPtr)
+                continue;
+            for (auto* tile : objectPtr->Tiles)
+            {
+                if (tile)
+                    texelsTotal += tile->Width * tile->Height;
+            }
+        }
+        if (texelsTotal > texelsBudget)
+        {
+            PROFILE_CPU_NAMED("Prioritize Tiles");
+            DirtyObjectsPriority.Clear();
+            DirtyObjectsPriority.EnsureCapacity(_dirtyObjectsBuffer.Count());
+            for (void* actorObject : _dirtyObjectsBuffer)
+            {
+                const GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(actorObject);
+                if (!objectPtr)
+                    continue;
+                const float viewDistanceSq = Math::Max(Float3::DistanceSquared(objectPtr->Bounds.GetCenter(), renderContext.View.Position), 1.0f);
+                const float screenCoverage = objectPtr->Radius * objectPtr->Radius / viewDistanceSq;
+                const float staleness = (float)Math::Min<uint64>(currentFrame - objectPtr->LastFrameUpdated, 1000);
+                DirtyObjectsPriority.Add({ actorObject, screenCoverage * (1.0f + staleness * 0.1f) });
+            }
+            Sorting::QuickSort(DirtyObjectsPriority);
+
+            // Pick objects to draw within the budget (the remaining ones stay dirty for the next frame), objects with newly allocated tiles still need their tiles to be cleared
+            _dirtyObjectsBuffer.Clear();
+            texelsTotal = 0;
+            for (const auto& e : DirtyObjectsPriority)
+            {
+                const GlobalSurfaceAtlasObject& object = surfaceAtlasData.Objects.At(e.ActorObject);
+                uint64 texels = 0;
+                for (auto* tile : object.Tiles)
+                {
+                    if (tile)
+                        texels += tile->Width * tile->Height;
+                }
+                if (texelsTotal + texels > texelsBudget && _dirtyObjectsBuffer.HasItems())
+                    continue;
+                texelsTotal += texels;
+                _dirtyObjectsBuffer.Add(e.ActorObject);
+            }
+            dirtyObjectsToDraw = _dirtyObjectsBuffer.Count();
+            for (const auto& e : DirtyObjectsPriority)
+            {
+                if (surfaceAtlasData.Objects.At(e.ActorObject).LastFrameUpdated == 0 && !_dirtyObjectsBuffer.Contains(e.ActorObject))
+                    _dirtyObjectsBuffer.Add(e.ActorObject);
+            }
+            ZoneValue(dirtyObjectsToDraw);
+        }
+        for (int32 i = 0; i < dirtyObjectsToDraw; i++)
+        {
+            GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(_dirtyObjectsBuffer.Get()[i]);
+            if (objectPtr)
+                objectPtr->LastFrameUpdated = currentFrame;
+        }
+    }
+
     // Rasterize world geometry material properties into Global Surface Atlas
     if (_dirtyObjectsBuffer.Count() != 0)
     {
@@ -546,6 +661,7 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
         renderContextTiles.View.ModelLODBias += 100000;
         renderContextTiles.View.IsSingleFrame = true;
         renderContextTiles.View.IsCullingDisabled = true;
+        renderContextTiles.View.Occlusion = nullptr;
         renderContextTiles.View.Near = 0.0f;
         renderContextTiles.View.Prepare(renderContextTiles);
 
@@ -593,14 +709,14 @@ bool GlobalSurfaceAtlasPass::Render(RenderContext& renderContext, GPUContext* co
                 VB_DRAW();
             }
         }
-        // TODO: limit dirty objects count on a first frame (eg. collect overflown objects to be redirty next frame)
         auto& drawCallsListGBuffer = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer];
         auto& drawCallsListGBufferNoDecals = renderContextTiles.List->DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals];
         drawCallsListGBuffer.CanUseInstancing = false;
         drawCallsListGBufferNoDecals.CanUseInstancing = false;
         int32 tilesDrawn = 0;
-        for (void* actorObject : _dirtyObjectsBuffer)
+        for (int32 dirtyObjectIndex = 0; dirtyObjectIndex < dirtyObjectsToDraw; dirtyObjectIndex++)
         {
+            void* actorObject = _dirtyObjectsBuffer.Get()[dirtyObjectIndex];
             const GlobalSurfaceAtlasObject* objectPtr = surfaceAtlasData.Objects.TryGet(actorObject);
             if (!objectPtr)
                 continue;
@@ -1213,6 +1329,17 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
     const float distanceScale = Math::Lerp(1.0f, surfaceAtlasData.DistanceScaling, Math::InverseLerp(surfaceAtlasData.DistanceScalingStart, surfaceAtlasData.DistanceScalingEnd, (float)CollisionsHelper::DistanceSpherePoint(actorObjectBounds, surfaceAtlasData.ViewPosition)));
     const float tilesScale = surfaceAtlasData.TileTexelsPerWorldUnit * distanceScale * qualityScale;
     GlobalSurfaceAtlasObject* object = surfaceAtlasData.Objects.TryGet(actorObject);
+    if (!object)
+    {
+        // Reuse tiles of the object that has been unused for a short time
+        GlobalSurfaceAtlasObject* cachedObject = surfaceAtlasData.CachedObjects.TryGet(actorObject);
+        if (cachedObject)
+        {
+            object = &surfaceAtlasData.Objects[actorObject];
+            *object = *cachedObject;
+            surfaceAtlasData.CachedObjects.Remove(actorObject);
+        }
+    }
     bool anyTile = false, dirty = false;
     for (int32 tileIndex = 0; tileIndex < 6; tileIndex++)
     {
@@ -1261,6 +1388,7 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
             if (!object)
                 object = &surfaceAtlasData.Objects[actorObject];
             object->Tiles[tileIndex] = tile;
+            object->LastFrameUpdated = 0; // New tile needs to be drawn (and cleared)
             anyTile = true;
             dirty = true;
         }
@@ -1287,7 +1415,8 @@ void GlobalSurfaceAtlasPass::RasterizeActor(Actor* actor, void* actorObject, con
     object->Radius = (float)actorObjectBounds.Radius;
     if (dirty || GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES)
     {
-        object->LastFrameUpdated = surfaceAtlasData.CurrentFrame;
+        if (GLOBAL_SURFACE_ATLAS_DEBUG_FORCE_REDRAW_TILES)
+            object->LastFrameUpdated = surfaceAtlasData.CurrentFrame;
         object->LightingUpdateFrame = surfaceAtlasData.CurrentFrame;
         _dirtyObjectsBuffer.Add(actorObject);
     }
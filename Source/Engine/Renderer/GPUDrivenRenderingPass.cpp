@@ -0,0 +1,857 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "GPUDrivenRenderingPass.h"
+#include "RenderList.h"
+#include "HZBPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/MaterialBase.h"
+#include "Engine/Content/Assets/Model.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Level/Actors/StaticModel.h"
+#include "Engine/Threading/Threading.h"
+
+// Those defines must match the HLSL
+#define GPU_DRIVEN_THREAD_GROUP_SIZE 64
+#define GPU_DRIVEN_MAX_LODS 8
+#define GPU_DRIVEN_BATCH_MAIN 1
+#define GPU_DRIVEN_BATCH_SHADOWS 2
+#define GPU_DRIVEN_BATCH_MESHLETS 8
+
+// CPU-only batch flags
+#define GPU_DRIVEN_BATCH_RECEIVE_DECALS 4
+
+static_assert(MODEL_MAX_LODS <= GPU_DRIVEN_MAX_LODS, "Too many model LODs for GPU-driven rendering.");
+
+PACK_STRUCT(struct GPUDrivenData {
+    Float4 FrustumPlanes[6];
+    Float3 ViewOrigin;
+    uint32 InstancesCount;
+    Float3 LODViewPosition;
+    float LODScreenMultiple;
+    float LODDistanceScale;
+    float ModelLODDistanceFactorSqrt;
+    int32 ModelLODBias;
+    uint32 BatchesCount;
+    uint32 RenderLayersMask;
+    uint32 BatchFlagsMask;
+    Float2 HZBSize;
+    Matrix HZBViewProjection;
+    Float3 HZBOrigin;
+    uint32 HZBMipLevels;
+    Float3 ViewPosition;
+    uint32 MeshletsEnabled;
+    uint32 MeshletsOffset;
+    uint32 MeshletsCount;
+    uint32 MeshletBatch;
+    uint32 MeshletInstance;
+    uint32 MeshletConeCulling;
+    Float3 Dummy1;
+    });
+
+// The static instance data. Matches the shader type.
+PACK_STRUCT(struct GPUDrivenInstance {
+    Float3 Origin;
+    float PerInstanceRandom;
+    Float3 Transform1;
+    uint32 Group;
+    Float3 Transform2;
+    float Radius;
+    Float3 Transform3;
+    uint32 LayerMask;
+    Float3 Center;
+    int32 ForcedLOD;
+    int32 LODBias;
+    Float3 Dummy0;
+    });
+
+// The instances group (model with materials setup) data. Matches the shader type.
+PACK_STRUCT(struct GPUDrivenGroup {
+    float MinScreenSize;
+    uint32 LODsCount;
+    uint32 Dummy0[2];
+    float LODScreenSize[GPU_DRIVEN_MAX_LODS];
+    uint32 LODBatchStart[GPU_DRIVEN_MAX_LODS];
+    uint32 LODBatchCount[GPU_DRIVEN_MAX_LODS];
+    });
+
+// The draw batch (single mesh of the group LOD) data. Matches the shader type.
+PACK_STRUCT(struct GPUDrivenBatch {
+    uint32 IndicesCount;
+    uint32 StartIndex;
+    uint32 Flags;
+    uint32 MeshletIndicesOffset;
+    });
+
+static_assert(sizeof(Meshlet) == 40, "Invalid meshlet size. Must match the shader type.");
+
+namespace
+{
+    bool EnsureBuffer(GPUBuffer*& buffer, const Char* name, const GPUBufferDescription& desc)
+    {
+        if (!buffer)
+            buffer = GPUDevice::Instance->CreateBuffer(name);
+        if (buffer->GetSize() >= desc.Size)
+            return false;
+        return buffer->Init(desc);
+    }
+
+    bool CanUseMaterial(MaterialBase* material)
+    {
+        // Only GBuffer and shadow depth passes are drawn on GPU
+        IMaterial::InstancingHandler handler;
+        return material->IsLoaded() &&
+                material->IsSurface() &&
+                material->GetInfo().BlendMode == MaterialBlendMode::Opaque &&
+                !EnumHasAnyFlags(material->GetDrawModes(), DrawPass::Forward | DrawPass::Distortion) &&
+                material->CanUseInstancing(handler);
+    }
+}
+
+String GPUDrivenRenderingPass::ToString() const
+{
+    return TEXT("GPUDrivenRenderingPass");
+}
+
+bool GPUDrivenRenderingPass::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    _isSupported = limits.HasCompute && limits.HasDrawIndirect;
+    if (!_isSupported)
+        return false;
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/GPUDrivenRendering"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<GPUDrivenRenderingPass, &GPUDrivenRenderingPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void GPUDrivenRenderingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    for (StaticModel* actor : _pending)
+        actor->_gpuDrivenQueued = false;
+    for (const StaticInstance& instance : _instances)
+    {
+        if (instance.Actor)
+            instance.Actor->_gpuDrivenKey = -1;
+    }
+    _pending.Resize(0);
+    _instances.Resize(0);
+    _freeInstances.Resize(0);
+    _groups.Resize(0);
+    _batches.Resize(0);
+    _views.Resize(0);
+    for (ViewBuffers& buffers : _viewBuffers)
+    {
+        SAFE_DELETE_GPU_RESOURCE(buffers.Args);
+        SAFE_DELETE_GPU_RESOURCE(buffers.InstancesUAV);
+        SAFE_DELETE_GPU_RESOURCE(buffers.Instances);
+        SAFE_DELETE_GPU_RESOURCE(buffers.Indices);
+    }
+    _viewBuffers.Resize(0);
+    SAFE_DELETE_GPU_RESOURCE(_instancesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_groupsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_batchesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_visibleLODsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_countersBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_meshletsBuffer);
+    _shader = nullptr;
+}
+
+bool GPUDrivenRenderingPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(GPUDrivenData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, GPUDrivenData);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csClearArgs = shader->GetCS("CS_ClearArgs");
+    _csCull = shader->GetCS("CS_Cull");
+    _csCullMeshlets = shader->GetCS("CS_CullMeshlets");
+    _csPrepareArgs = shader->GetCS("CS_PrepareArgs");
+    _csWriteInstances = shader->GetCS("CS_WriteInstances");
+
+    return false;
+}
+
+bool GPUDrivenRenderingPass::Setup(RenderContextBatch& renderContextBatch)
+{
+    const RenderContext& mainContext = renderContextBatch.GetMainContext();
+    if (!Graphics::EnableGPUDrivenRendering || !_isSupported || mainContext.View.IsOfflinePass || checkIfSkipPass())
+        return false;
+    switch (mainContext.View.Mode)
+    {
+    case ViewMode::LightmapUVsDensity:
+    case ViewMode::VertexColors:
+    case ViewMode::PhysicsColliders:
+    case ViewMode::LODPreview:
+    case ViewMode::MaterialComplexity:
+    case ViewMode::QuadOverdraw:
+        // Debug views that override draw calls on CPU
+        return false;
+    default:
+        break;
+    }
+
+    // Models drawn on GPU are skipped on CPU in all views of the batch so the main view can use only GBuffer pass for them (static opaque models are not drawn in forward nor motion vectors passes)
+    if (!EnumHasAnyFlags(mainContext.View.Pass, DrawPass::GBuffer) ||
+        EnumHasAnyFlags(mainContext.View.Pass, DrawPass::Depth | DrawPass::GlobalSDF | DrawPass::GlobalSurfaceAtlas))
+        return false;
+    PROFILE_CPU();
+
+    // Views are collected per-frame (from all render tasks)
+    if (_frame != Engine::FrameCount)
+    {
+        _frame = Engine::FrameCount;
+        _views.Clear();
+    }
+
+    // Detect models that got modified (eg. mesh layout changed after asset reimport)
+    for (Group& group : _groups)
+    {
+        group.Invalid = false;
+        if (group.LODsCount != group.Model->LODs.Count())
+        {
+            group.Invalid = true;
+            continue;
+        }
+        for (int32 lodIndex = 0; lodIndex < group.LODsCount; lodIndex++)
+            group.Invalid |= group.MeshesCount[lodIndex] != group.Model->LODs[lodIndex].Meshes.Count();
+        group.Invalid |= group.MeshletsCount != GetMeshletsCount(group.Model);
+    }
+
+    // Instances can be unregistered from other threads (eg. when actor gets modified)
+    ScopeLock lock(_locker);
+
+    // Remove instances that changed their state
+    for (int32 key = 0; key < _instances.Count(); key++)
+    {
+        const StaticInstance& instance = _instances.Get()[key];
+        if (instance.Actor && !IsValid(instance))
+            RemoveInstance(key);
+    }
+
+    // Add new instances
+    for (StaticModel* actor : _pending)
+    {
+        actor->_gpuDrivenQueued = false;
+        if (actor->_gpuDrivenKey != -1 || !actor->CanUseGPUDrivenRendering())
+            continue;
+        const int32 group = GetGroup(actor);
+        if (group == -1)
+            continue;
+        int32 key;
+        if (_freeInstances.HasItems())
+        {
+            key = _freeInstances.Last();
+            _freeInstances.RemoveLast();
+        }
+        else
+        {
+            key = _instances.Count();
+            _instances.AddUninitialized(1);
+        }
+        StaticInstance& instance = _instances[key];
+        instance.Actor = actor;
+        instance.Group = group;
+        instance.LayerMask = actor->GetLayerMask();
+        instance.LODBias = actor->_lodBias;
+        instance.ForcedLOD = actor->_forcedLod;
+        instance.DrawModes = actor->DrawModes;
+        instance.Flags = actor->GetStaticFlags();
+        actor->_gpuDrivenKey = key;
+        _dirty = true;
+    }
+    _pending.Clear();
+
+    // Upload instances data
+    if (_dirty)
+    {
+        _dirty = false;
+        _version++;
+        Rebuild(GPUDevice::Instance->GetMainContext());
+    }
+
+    // Update groups state (drawing on GPU is possible only if all resources are ready)
+    for (Group& group : _groups)
+    {
+        const bool ready = IsReady(group);
+        if (group.Ready != ready)
+            _version++;
+        group.Ready = ready;
+    }
+
+    // Register views (culling is done after draw calls collection)
+    for (int32 i = 0; i < renderContextBatch.Contexts.Count(); i++)
+    {
+        const RenderContext& renderContext = renderContextBatch.Contexts.Get()[i];
+        auto& view = _views.AddOne();
+        view.List = renderContext.List;
+        view.Context = &renderContext;
+        view.LODContext = &mainContext;
+        view.Batch = &renderContextBatch;
+        view.FlagsMask = i == 0 ? GPU_DRIVEN_BATCH_MAIN : GPU_DRIVEN_BATCH_SHADOWS;
+        view.Meshlets = i == 0;
+        view.Culled = false;
+    }
+
+    return true;
+}
+
+void GPUDrivenRenderingPass::Cull(RenderContextBatch& renderContextBatch)
+{
+    if (_instancesCount == 0 || checkIfSkipPass())
+        return;
+    auto context = GPUDevice::Instance->GetMainContext();
+    PROFILE_GPU_CPU("GPU-Driven Culling");
+
+    for (int32 i = 0; i < _views.Count(); i++)
+    {
+        View& view = _views[i];
+        if (!view.Culled && view.Batch == &renderContextBatch)
+            CullView(context, view, i);
+    }
+
+    // Cleanup
+    context->ResetUA();
+    context->ResetSR();
+    context->ResetCB();
+}
+
+void GPUDrivenRenderingPass::Draw(const RenderContext& renderContext, DrawCallsListType listType)
+{
+    // Find the culled view (the latest one as render lists are pooled and can be reused by other render tasks within a frame)
+    int32 viewIndex = _views.Count() - 1;
+    for (; viewIndex >= 0; viewIndex--)
+    {
+        const View& view = _views.Get()[viewIndex];
+        if (view.List == renderContext.List && view.Culled)
+            break;
+    }
+    if (viewIndex < 0)
+        return;
+    const View& view = _views.Get()[viewIndex];
+    uint32 flagsMask;
+    switch (listType)
+    {
+    case DrawCallsListType::GBuffer:
+    case DrawCallsListType::GBufferNoDecals:
+        flagsMask = GPU_DRIVEN_BATCH_MAIN;
+        break;
+    case DrawCallsListType::Depth:
+        flagsMask = GPU_DRIVEN_BATCH_SHADOWS;
+        break;
+    default:
+        return;
+    }
+    if (view.FlagsMask != flagsMask)
+        return;
+    const bool receiveDecals = listType == DrawCallsListType::GBuffer;
+    auto context = GPUDevice::Instance->GetMainContext();
+    PROFILE_GPU_CPU("GPU-Driven Draw");
+    const ViewBuffers& buffers = _viewBuffers[viewIndex];
+
+    // Execute indirect draw calls (instances count and offset are written by GPU culling)
+    MaterialBase::BindParameters bindParams(context, renderContext);
+    bindParams.BindViewData();
+    DrawCall drawCall;
+    GPUBuffer* vb[4];
+    uint32 vbOffsets[4] = {};
+    vb[3] = buffers.Instances;
+    for (int32 batchIndex = 0; batchIndex < _batches.Count(); batchIndex++)
+    {
+        const Batch& batch = _batches.Get()[batchIndex];
+        if ((batch.Flags & view.FlagsMask) == 0)
+            continue;
+        if (view.FlagsMask == GPU_DRIVEN_BATCH_MAIN && ((batch.Flags & GPU_DRIVEN_BATCH_RECEIVE_DECALS) != 0) != receiveDecals)
+            continue;
+        const Group& group = _groups.Get()[batch.Group];
+        if (!group.Ready)
+            continue;
+        const Mesh& mesh = group.Model->LODs.Get()[batch.LOD].Meshes.Get()[batch.Mesh];
+
+        // Meshlets culling outputs the visible triangles into the compacted index buffer
+        const bool meshlets = view.Meshlets && (batch.Flags & GPU_DRIVEN_BATCH_MESHLETS) != 0;
+        drawCall.Geometry.IndexBuffer = meshlets ? buffers.Indices : mesh.GetIndexBuffer();
+        for (int32 i = 0; i < 3; i++)
+            drawCall.Geometry.VertexBuffers[i] = vb[i] = mesh.GetVertexBuffer(i);
+        drawCall.Material = group.Slots[mesh.GetMaterialSlotIndex()].Material;
+        drawCall.WorldDeterminantSign = group.WorldDeterminantSign;
+        drawCall.Surface.GeometrySize = mesh.GetBox().GetSize();
+        drawCall.Surface.GeometryOrigin = mesh.GetBox().Minimum;
+        drawCall.Surface.CompressedPositions = mesh.HasCompressedPositions();
+
+        // Draw calls count larger than 1 selects the instanced shader permutation
+        bindParams.FirstDrawCall = &drawCall;
+        bindParams.DrawCallsCount = 2;
+        drawCall.Material->Bind(bindParams);
+
+        context->BindIB(drawCall.Geometry.IndexBuffer);
+        context->BindVB(ToSpan(vb, 4), vbOffsets);
+        context->DrawIndexedInstancedIndirect(buffers.Args, batchIndex * sizeof(GPUDrawIndexedIndirectArgs));
+    }
+}
+
+bool GPUDrivenRenderingPass::IsDrawn(const StaticModel* actor) const
+{
+    const int32 key = actor->_gpuDrivenKey;
+    return key != -1 && _groups.Get()[_instances.Get()[key].Group].Ready;
+}
+
+void GPUDrivenRenderingPass::Register(StaticModel* actor)
+{
+    if (actor->_gpuDrivenQueued || actor->_gpuDrivenKey != -1)
+        return;
+    ScopeLock lock(_locker);
+    actor->_gpuDrivenQueued = true;
+    _pending.Add(actor);
+}
+
+void GPUDrivenRenderingPass::Unregister(StaticModel* actor)
+{
+    if (actor->_gpuDrivenKey == -1 && !actor->_gpuDrivenQueued)
+        return;
+    ScopeLock lock(_locker);
+    if (actor->_gpuDrivenKey != -1)
+        RemoveInstance(actor->_gpuDrivenKey);
+    if (actor->_gpuDrivenQueued)
+    {
+        actor->_gpuDrivenQueued = false;
+        _pending.Remove(actor);
+    }
+}
+
+bool GPUDrivenRenderingPass::IsValid(const StaticInstance& instance) const
+{
+    const StaticModel* actor = instance.Actor;
+    return !_groups[instance.Group].Invalid &&
+            actor->CanUseGPUDrivenRendering() &&
+            instance.LayerMask == actor->GetLayerMask() &&
+            instance.LODBias == actor->_lodBias &&
+            instance.ForcedLOD == actor->_forcedLod &&
+            instance.DrawModes == actor->DrawModes &&
+            instance.Flags == actor->GetStaticFlags();
+}
+
+int32 GPUDrivenRenderingPass::GetMeshletsCount(const Model* model)
+{
+    int32 count = 0;
+    for (const ModelLOD& lod : model->LODs)
+    {
+        for (const Mesh& mesh : lod.Meshes)
+            count += mesh.GetMeshlets().Count();
+    }
+    return count;
+}
+
+bool GPUDrivenRenderingPass::IsReady(const Group& group) const
+{
+    const Model* model = group.Model;
+    if (group.Invalid || !model->IsLoaded() || model->HighestResidentLODIndex() != 0)
+        return false;
+    for (const ModelLOD& lod : model->LODs)
+    {
+        for (const Mesh& mesh : lod.Meshes)
+        {
+            if (!mesh.IsInitialized())
+                return false;
+        }
+    }
+    for (const Slot& slot : group.Slots)
+    {
+        if (slot.Visible && !CanUseMaterial(slot.Material))
+            return false;
+    }
+    return true;
+}
+
+int32 GPUDrivenRenderingPass::GetGroup(StaticModel* actor)
+{
+    Model* model = actor->Model.Get();
+    const auto& materialSlots = model->MaterialSlots;
+    if (actor->Entries.Count() != materialSlots.Count() || model->LODs.Count() > MODEL_MAX_LODS)
+        return -1;
+
+    // Resolve materials setup
+    Array<Slot, InlinedAllocation<16>> slots;
+    slots.Resize(materialSlots.Count());
+    for (int32 i = 0; i < slots.Count(); i++)
+    {
+        const ModelInstanceEntry& entry = actor->Entries[i];
+        const MaterialSlot& materialSlot = materialSlots[i];
+        Slot& slot = slots[i];
+        slot.Material = entry.Material ? entry.Material.Get() : materialSlot.Material.Get();
+        if (!slot.Material)
+            slot.Material = GPUDevice::Instance->GetDefaultMaterial();
+        slot.ShadowsMode = entry.ShadowsMode & materialSlot.ShadowsMode;
+        slot.Visible = entry.Visible;
+        slot.ReceiveDecals = entry.ReceiveDecals;
+    }
+    Matrix world;
+    actor->GetLocalToWorldMatrix(world);
+    const float worldDeterminantSign = Math::FloatSelect(world.RotDeterminant(), 1, -1);
+
+    // Find matching group
+    for (int32 groupIndex = 0; groupIndex < _groups.Count(); groupIndex++)
+    {
+        const Group& group = _groups[groupIndex];
+        if (group.Invalid || group.Model != model || group.DrawModes != actor->DrawModes || group.WorldDeterminantSign != worldDeterminantSign)
+            continue;
+        bool match = true;
+        for (int32 i = 0; i < slots.Count() && match; i++)
+        {
+            const Slot& a = slots[i];
+            const Slot& b = group.Slots[i];
+            match = a.Material == b.Material && a.ShadowsMode == b.ShadowsMode && a.Visible == b.Visible && a.ReceiveDecals == b.ReceiveDecals;
+        }
+        if (match)
+            return groupIndex;
+    }
+
+    // Create a new group
+    Group& group = _groups.AddOne();
+    group.Model = model;
+    group.Slots.Set(slots.Get(), slots.Count());
+    group.DrawModes = actor->DrawModes;
+    group.WorldDeterminantSign = worldDeterminantSign;
+    group.InstancesCount = 0;
+    group.LODsCount = model->LODs.Count();
+    for (int32 lodIndex = 0; lodIndex < group.LODsCount; lodIndex++)
+        group.MeshesCount[lodIndex] = model->LODs[lodIndex].Meshes.Count();
+    group.MeshletsCount = GetMeshletsCount(model);
+    group.Ready = false;
+    group.Invalid = false;
+    return _groups.Count() - 1;
+}
+
+void GPUDrivenRenderingPass::RemoveInstance(int32 key)
+{
+    StaticInstance& instance = _instances[key];
+    instance.Actor->_gpuDrivenKey = -1;
+    instance.Actor = nullptr;
+    _freeInstances.Add(key);
+    _dirty = true;
+}
+
+void GPUDrivenRenderingPass::Rebuild(GPUContext* context)
+{
+    PROFILE_CPU();
+
+    // Remove unused groups
+    for (Group& group : _groups)
+        group.InstancesCount = 0;
+    for (const StaticInstance& instance : _instances)
+    {
+        if (instance.Actor)
+            _groups[instance.Group].InstancesCount++;
+    }
+    Array<int32> groupsRemap;
+    groupsRemap.Resize(_groups.Count());
+    int32 groupsCount = 0;
+    for (int32 groupIndex = 0; groupIndex < _groups.Count(); groupIndex++)
+    {
+        if (_groups[groupIndex].InstancesCount == 0)
+        {
+            groupsRemap[groupIndex] = -1;
+            continue;
+        }
+        groupsRemap[groupIndex] = groupsCount;
+        if (groupsCount != groupIndex)
+            _groups[groupsCount] = MoveTemp(_groups[groupIndex]);
+        groupsCount++;
+    }
+    _groups.Resize(groupsCount);
+    for (StaticInstance& instance : _instances)
+    {
+        if (instance.Actor)
+            instance.Group = groupsRemap[instance.Group];
+    }
+
+    // Build draw batches (for each mesh of each LOD)
+    _batches.Clear();
+    _outputCapacity = 0;
+    _meshletIndicesCount = 0;
+    Array<GPUDrivenGroup> groupsData;
+    Array<GPUDrivenBatch> batchesData;
+    Array<Meshlet> meshletsData;
+    groupsData.Resize(_groups.Count());
+    for (int32 groupIndex = 0; groupIndex < _groups.Count(); groupIndex++)
+    {
+        const Group& group = _groups[groupIndex];
+        const Model* model = group.Model;
+        GPUDrivenGroup& groupData = groupsData[groupIndex];
+        Platform::MemoryClear(&groupData, sizeof(groupData));
+        groupData.MinScreenSize = model->MinScreenSize;
+        groupData.LODsCount = group.LODsCount;
+        int32 maxBatchesPerLOD = 0;
+        for (int32 lodIndex = 0; lodIndex < group.LODsCount; lodIndex++)
+        {
+            const ModelLOD& lod = model->LODs[lodIndex];
+            groupData.LODScreenSize[lodIndex] = lod.ScreenSize;
+            groupData.LODBatchStart[lodIndex] = _batches.Count();
+            for (int32 meshIndex = 0; meshIndex < group.MeshesCount[lodIndex]; meshIndex++)
+            {
+                const Mesh& mesh = lod.Meshes[meshIndex];
+                const Slot& slot = group.Slots[mesh.GetMaterialSlotIndex()];
+                if (!slot.Visible)
+                    continue;
+                const DrawPass drawModes = group.DrawModes & slot.Material->GetDrawModes();
+                uint32 flags = 0;
+                if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+                    flags |= GPU_DRIVEN_BATCH_MAIN;
+                if (EnumHasAnyFlags(drawModes, DrawPass::Depth) && EnumHasAnyFlags(slot.ShadowsMode, ShadowsCastingMode::DynamicOnly))
+                    flags |= GPU_DRIVEN_BATCH_SHADOWS;
+                if (flags == 0)
+                    continue;
+                if (slot.ReceiveDecals)
+                    flags |= GPU_DRIVEN_BATCH_RECEIVE_DECALS;
+                auto& batch = _batches.AddOne();
+                batch.Group = groupIndex;
+                batch.LOD = lodIndex;
+                batch.Mesh = meshIndex;
+                batch.Instance = -1;
+                batch.MeshletsStart = 0;
+                batch.MeshletsCount = 0;
+                batch.ConeCulling = false;
+                auto& batchData = batchesData.AddOne();
+                batchData.IndicesCount = mesh.GetTriangleCount() * 3;
+                batchData.StartIndex = 0;
+                batchData.MeshletIndicesOffset = 0;
+
+                // Meshlets culling for the main view (only for single-instance groups as the visible triangles are compacted for the specific instance)
+                const auto& meshlets = mesh.GetMeshlets();
+                if (meshlets.HasItems() && group.InstancesCount == 1 && (flags & GPU_DRIVEN_BATCH_MAIN) != 0)
+                {
+                    flags |= GPU_DRIVEN_BATCH_MESHLETS;
+                    batch.MeshletsStart = meshletsData.Count();
+                    batch.MeshletsCount = meshlets.Count();
+                    batch.ConeCulling = slot.Material->GetInfo().CullMode == CullMode::Normal;
+                    meshletsData.Add(meshlets);
+                    batchData.MeshletIndicesOffset = _meshletIndicesCount;
+                    _meshletIndicesCount += batchData.IndicesCount;
+                }
+                batch.Flags = flags;
+                batchData.Flags = flags;
+            }
+            groupData.LODBatchCount[lodIndex] = _batches.Count() - groupData.LODBatchStart[lodIndex];
+            maxBatchesPerLOD = Math::Max(maxBatchesPerLOD, (int32)groupData.LODBatchCount[lodIndex]);
+        }
+        _outputCapacity += group.InstancesCount * maxBatchesPerLOD;
+    }
+
+    // Pack instances
+    Array<GPUDrivenInstance> instancesData;
+    Array<int32> groupsInstance;
+    instancesData.EnsureCapacity(_instances.Count() - _freeInstances.Count());
+    groupsInstance.Resize(_groups.Count());
+    for (const StaticInstance& instance : _instances)
+    {
+        if (!instance.Actor)
+            continue;
+        groupsInstance[instance.Group] = instancesData.Count();
+        Matrix world;
+        instance.Actor->GetLocalToWorldMatrix(world);
+        const BoundingSphere& sphere = instance.Actor->GetSphere();
+        auto& data = instancesData.AddOne();
+        data.Origin = Float3(world.M41, world.M42, world.M43);
+        data.PerInstanceRandom = instance.Actor->GetPerInstanceRandom();
+        data.Transform1 = Float3(world.M11, world.M12, world.M13);
+        data.Group = instance.Group;
+        data.Transform2 = Float3(world.M21, world.M22, world.M23);
+        data.Radius = (float)sphere.Radius;
+        data.Transform3 = Float3(world.M31, world.M32, world.M33);
+        data.LayerMask = instance.LayerMask;
+        data.Center = Float3(sphere.Center);
+        data.ForcedLOD = instance.ForcedLOD;
+        data.LODBias = instance.LODBias;
+        data.Dummy0 = Float3::Zero;
+    }
+    _instancesCount = instancesData.Count();
+    if (_instancesCount == 0)
+        return;
+    for (Batch& batch : _batches)
+    {
+        if (batch.Flags & GPU_DRIVEN_BATCH_MESHLETS)
+            batch.Instance = groupsInstance[batch.Group];
+    }
+
+    // Upload data to GPU
+    const int32 batchesCount = batchesData.Count();
+    if (EnsureBuffer(_instancesBuffer, TEXT("GPUDriven.Instances"), GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(_instancesCount), sizeof(GPUDrivenInstance))) ||
+        EnsureBuffer(_groupsBuffer, TEXT("GPUDriven.Groups"), GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(groupsData.Count()), sizeof(GPUDrivenGroup))) ||
+        EnsureBuffer(_batchesBuffer, TEXT("GPUDriven.Batches"), GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(Math::Max(batchesCount, 1)), sizeof(GPUDrivenBatch))) ||
+        EnsureBuffer(_visibleLODsBuffer, TEXT("GPUDriven.VisibleLODs"), GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(_instancesCount) * sizeof(uint32), GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_countersBuffer, TEXT("GPUDriven.Counters"), GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(Math::Max(batchesCount, 1)) * sizeof(uint32), GPUBufferFlags::UnorderedAccess)) ||
+        (meshletsData.HasItems() && EnsureBuffer(_meshletsBuffer, TEXT("GPUDriven.Meshlets"), GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(meshletsData.Count()), sizeof(Meshlet)))))
+    {
+        LOG(Error, "Failed to create GPU-driven rendering buffers.");
+        _instancesCount = 0;
+        return;
+    }
+    context->UpdateBuffer(_instancesBuffer, instancesData.Get(), instancesData.Count() * sizeof(GPUDrivenInstance));
+    context->UpdateBuffer(_groupsBuffer, groupsData.Get(), groupsData.Count() * sizeof(GPUDrivenGroup));
+    if (batchesCount != 0)
+        context->UpdateBuffer(_batchesBuffer, batchesData.Get(), batchesCount * sizeof(GPUDrivenBatch));
+    if (meshletsData.HasItems())
+        context->UpdateBuffer(_meshletsBuffer, meshletsData.Get(), meshletsData.Count() * sizeof(Meshlet));
+}
+
+void GPUDrivenRenderingPass::CullView(GPUContext* context, View& view, int32 viewIndex)
+{
+    const int32 batchesCount = _batches.Count();
+    if (batchesCount == 0 || _outputCapacity == 0)
+        return;
+
+    // Prepare per-view buffers
+    if (_viewBuffers.Count() <= viewIndex)
+        _viewBuffers.Resize(viewIndex + 1);
+    ViewBuffers& buffers = _viewBuffers[viewIndex];
+    const uint32 argsSize = Math::RoundUpToPowerOf2(batchesCount) * sizeof(GPUDrawIndexedIndirectArgs);
+    const uint32 instancesSize = Math::RoundUpToPowerOf2(_outputCapacity) * sizeof(InstanceData);
+    if (EnsureBuffer(buffers.Args, TEXT("GPUDriven.Args"), GPUBufferDescription::Raw(argsSize, GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(buffers.InstancesUAV, TEXT("GPUDriven.OutputInstances"), GPUBufferDescription::Raw(instancesSize, GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(buffers.Instances, TEXT("GPUDriven.InstancesVB"), GPUBufferDescription::Vertex(sizeof(InstanceData), instancesSize / sizeof(InstanceData))))
+    {
+        LOG(Error, "Failed to create GPU-driven rendering view buffers.");
+        return;
+    }
+    const bool meshlets = view.Meshlets && _meshletIndicesCount != 0;
+    if (meshlets)
+    {
+        // Combined raw/index buffer (written by the meshlets culling and used for drawing)
+        const uint32 indicesSize = Math::RoundUpToPowerOf2(_meshletIndicesCount) * sizeof(uint32);
+        if (EnsureBuffer(buffers.Indices, TEXT("GPUDriven.Indices"), GPUBufferDescription::Raw(indicesSize, GPUBufferFlags::IndexBuffer | GPUBufferFlags::UnorderedAccess)))
+        {
+            LOG(Error, "Failed to create GPU-driven rendering view buffers.");
+            return;
+        }
+    }
+
+    // Setup constants
+    const RenderView& renderView = view.Context->View;
+    const RenderContext& lodContext = *view.LODContext;
+    const RenderView& lodView = lodContext.LodProxyView ? *lodContext.LodProxyView : lodContext.View;
+    GPUDrivenData data;
+    for (int32 i = 0; i < 6; i++)
+    {
+        // Bake view origin into the plane distance to test world-space bounds
+        const Plane plane = renderView.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(plane.Normal, (float)(plane.D - Vector3::Dot(plane.Normal, renderView.Origin)));
+    }
+    data.ViewOrigin = Float3(renderView.Origin);
+    data.InstancesCount = _instancesCount;
+    data.LODViewPosition = Float3(lodView.Origin) + lodView.Position;
+    data.LODScreenMultiple = 0.5f * Math::Max(lodView.Projection.Values[0][0], lodView.Projection.Values[1][1]);
+    data.LODDistanceScale = lodView.Projection.Values[2][3];
+    data.ModelLODDistanceFactorSqrt = lodContext.View.ModelLODDistanceFactorSqrt;
+    data.ModelLODBias = lodContext.View.ModelLODBias;
+    data.BatchesCount = batchesCount;
+    data.RenderLayersMask = lodContext.View.RenderLayersMask.Mask;
+    data.BatchFlagsMask = view.FlagsMask;
+
+    // Occlusion culling against the HZB from the previous frame (main view only)
+    GPUTexture* hzb = nullptr;
+    if (view.Context == view.LODContext)
+    {
+        Matrix hzbViewProjection;
+        Vector3 hzbOrigin;
+        hzb = HZBPass::Instance()->GetHZB(*view.Context, hzbViewProjection, hzbOrigin);
+        if (hzb)
+        {
+            Matrix::Transpose(hzbViewProjection, data.HZBViewProjection);
+            data.HZBOrigin = Float3(hzbOrigin);
+        }
+    }
+    data.HZBSize = hzb ? Float2((float)hzb->Width(), (float)hzb->Height()) : Float2::Zero;
+    data.HZBMipLevels = hzb ? hzb->MipLevels() : 0;
+    data.ViewPosition = Float3(renderView.Origin + renderView.Position);
+    data.MeshletsEnabled = meshlets ? 1 : 0;
+    data.MeshletsOffset = 0;
+    data.MeshletsCount = 0;
+    data.MeshletBatch = 0;
+    data.MeshletInstance = 0;
+    data.MeshletConeCulling = 0;
+    data.Dummy1 = Float3::Zero;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->UpdateCB(cb, &data);
+    context->BindCB(0, cb);
+    context->BindSR(0, _instancesBuffer->View());
+    context->BindSR(1, _groupsBuffer->View());
+    context->BindSR(2, _batchesBuffer->View());
+    context->BindSR(3, hzb);
+    context->BindUA(0, buffers.Args->View());
+    context->BindUA(1, _countersBuffer->View());
+    context->BindUA(2, _visibleLODsBuffer->View());
+    context->BindUA(3, buffers.InstancesUAV->View());
+
+    // Reset draw arguments
+    context->Dispatch(_csClearArgs, Math::DivideAndRoundUp(batchesCount, GPU_DRIVEN_THREAD_GROUP_SIZE), 1, 1);
+
+    // Cull instances and count visible instances per batch
+    context->Dispatch(_csCull, Math::DivideAndRoundUp(_instancesCount, GPU_DRIVEN_THREAD_GROUP_SIZE), 1, 1);
+
+    // Cull meshlets of the visible instances and write the visible triangles
+    if (meshlets)
+    {
+        context->BindSR(4, _meshletsBuffer->View());
+        context->BindUA(4, buffers.Indices->View());
+        for (int32 batchIndex = 0; batchIndex < batchesCount; batchIndex++)
+        {
+            const Batch& batch = _batches.Get()[batchIndex];
+            if ((batch.Flags & GPU_DRIVEN_BATCH_MESHLETS) == 0)
+                continue;
+            const Mesh& mesh = _groups.Get()[batch.Group].Model->LODs.Get()[batch.LOD].Meshes.Get()[batch.Mesh];
+            GPUBuffer* meshIndices = mesh.GetIndexBuffer();
+            if (!meshIndices || !meshIndices->IsShaderResource())
+                continue;
+            data.MeshletsOffset = batch.MeshletsStart;
+            data.MeshletsCount = batch.MeshletsCount;
+            data.MeshletBatch = batchIndex;
+            data.MeshletInstance = batch.Instance;
+            data.MeshletConeCulling = batch.ConeCulling && renderView.IsPerspectiveProjection() ? 1 : 0;
+            context->UpdateCB(cb, &data);
+            context->BindSR(5, meshIndices->View());
+            context->Dispatch(_csCullMeshlets, Math::DivideAndRoundUp(batch.MeshletsCount, GPU_DRIVEN_THREAD_GROUP_SIZE), 1, 1);
+        }
+        context->UnBindSR(5);
+        context->UnBindSR(4);
+    }
+
+    // Allocate instances ranges for the batches
+    context->Dispatch(_csPrepareArgs, 1, 1, 1);
+
+    // Write visible instances data
+    context->Dispatch(_csWriteInstances, Math::DivideAndRoundUp(_instancesCount, GPU_DRIVEN_THREAD_GROUP_SIZE), 1, 1);
+
+    // Copy instances into the vertex buffer used for drawing
+    context->ResetUA();
+    context->UnBindSR(3);
+    context->CopyBuffer(buffers.Instances, buffers.InstancesUAV, instancesSize);
+    view.Culled = true;
+}
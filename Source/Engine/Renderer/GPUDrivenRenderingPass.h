@@ -0,0 +1,195 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Level/Types.h"
+
+class StaticModel;
+class Model;
+class MaterialBase;
+class RenderList;
+struct RenderContextBatch;
+enum class DrawCallsListType;
+
+/// <summary>
+/// GPU-driven rendering pass for static models. Keeps the static instances data in persistent GPU buffers (uploaded once when instances change), culls them on GPU with compute shaders (frustum, layers, LOD selection) and draws the visible instances per mesh batch with indirect draw calls.
+/// </summary>
+/// <remarks>Meshes with meshlets (generated on import) of the single-instance groups are culled per-meshlet in the main view (frustum, backface cone and occlusion) and drawn from the compacted index buffer with only the visible triangles.</remarks>
+/// <remarks>Only static, instancing-compatible models are handled (deferred materials without lightmaps, vertex colors and deformations). Other objects use CPU draw calls collection as usual.</remarks>
+class GPUDrivenRenderingPass : public RendererPass<GPUDrivenRenderingPass>
+{
+private:
+    struct Slot
+    {
+        MaterialBase* Material;
+        ShadowsCastingMode ShadowsMode;
+        bool Visible;
+        bool ReceiveDecals;
+    };
+
+    struct Group
+    {
+        ::Model* Model;
+        Array<Slot> Slots;
+        DrawPass DrawModes;
+        float WorldDeterminantSign;
+        int32 InstancesCount;
+        int32 LODsCount;
+        int32 MeshesCount[MODEL_MAX_LODS];
+        int32 MeshletsCount;
+        bool Ready;
+        bool Invalid;
+    };
+
+    // Snapshot of the actor state used to detect changes that require removing instance from GPU buffers.
+    struct StaticInstance
+    {
+        StaticModel* Actor;
+        int32 Group;
+        uint32 LayerMask;
+        int32 LODBias;
+        int32 ForcedLOD;
+        DrawPass DrawModes;
+        StaticFlags Flags;
+    };
+
+    struct Batch
+    {
+        int32 Group;
+        int32 LOD;
+        int32 Mesh;
+        uint32 Flags;
+        int32 Instance;
+        int32 MeshletsStart;
+        int32 MeshletsCount;
+        bool ConeCulling;
+    };
+
+    struct View
+    {
+        const RenderList* List;
+        const RenderContext* Context;
+        const RenderContext* LODContext;
+        const RenderContextBatch* Batch;
+        uint32 FlagsMask;
+        bool Meshlets;
+        bool Culled;
+    };
+
+    struct ViewBuffers
+    {
+        GPUBuffer* Args = nullptr;
+        GPUBuffer* InstancesUAV = nullptr;
+        GPUBuffer* Instances = nullptr;
+        GPUBuffer* Indices = nullptr;
+    };
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csClearArgs = nullptr;
+    GPUShaderProgramCS* _csCull = nullptr;
+    GPUShaderProgramCS* _csCullMeshlets = nullptr;
+    GPUShaderProgramCS* _csPrepareArgs = nullptr;
+    GPUShaderProgramCS* _csWriteInstances = nullptr;
+    bool _isSupported = false;
+    bool _dirty = false;
+    uint32 _version = 0;
+    uint64 _frame = 0;
+    CriticalSection _locker;
+    Array<StaticModel*> _pending;
+    Array<StaticInstance> _instances;
+    Array<int32> _freeInstances;
+    Array<Group> _groups;
+    Array<Batch> _batches;
+    Array<View> _views;
+    Array<ViewBuffers> _viewBuffers;
+    int32 _instancesCount = 0;
+    int32 _outputCapacity = 0;
+    int32 _meshletIndicesCount = 0;
+    GPUBuffer* _instancesBuffer = nullptr;
+    GPUBuffer* _groupsBuffer = nullptr;
+    GPUBuffer* _batchesBuffer = nullptr;
+    GPUBuffer* _visibleLODsBuffer = nullptr;
+    GPUBuffer* _countersBuffer = nullptr;
+    GPUBuffer* _meshletsBuffer = nullptr;
+
+public:
+    /// <summary>
+    /// Prepares the GPU-driven rendering for the render views batch. Processes the pending instances registrations and updates GPU buffers when needed. Called before collecting draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <returns>True if GPU-driven rendering can be used for this batch, otherwise false.</returns>
+    bool Setup(RenderContextBatch& renderContextBatch);
+
+    /// <summary>
+    /// Performs the GPU culling of the static instances for all views in the batch. Called after collecting draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    void Cull(RenderContextBatch& renderContextBatch);
+
+    /// <summary>
+    /// Draws the visible static instances into the given view (using indirect draw calls).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="listType">The draw calls list type.</param>
+    void Draw(const RenderContext& renderContext, DrawCallsListType listType);
+
+    /// <summary>
+    /// Gets the version of the GPU-driven instances data. Changes when the set of instances (or their readiness for drawing) gets modified. Can be used to invalidate cached rendering results (eg. static shadow maps).
+    /// </summary>
+    FORCE_INLINE uint32 GetVersion() const
+    {
+        return _version;
+    }
+
+    /// <summary>
+    /// Checks if the given model is drawn via GPU-driven rendering (thus can skip drawing on CPU). Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="actor">The model actor.</param>
+    /// <returns>True if actor is drawn on GPU, otherwise false.</returns>
+    bool IsDrawn(const StaticModel* actor) const;
+
+    /// <summary>
+    /// Queues the model to be added to the GPU-driven rendering (starting from the next batch setup). Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="actor">The model actor.</param>
+    void Register(StaticModel* actor);
+
+    /// <summary>
+    /// Removes the model from the GPU-driven rendering (eg. when it gets modified or disabled). Safe to call from other threads.
+    /// </summary>
+    /// <param name="actor">The model actor.</param>
+    void Unregister(StaticModel* actor);
+
+private:
+    bool IsValid(const StaticInstance& instance) const;
+    bool IsReady(const Group& group) const;
+    static int32 GetMeshletsCount(const Model* model);
+    int32 GetGroup(StaticModel* actor);
+    void RemoveInstance(int32 key);
+    void Rebuild(GPUContext* context);
+    void CullView(GPUContext* context, View& view, int32 viewIndex);
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csClearArgs = nullptr;
+        _csCull = nullptr;
+        _csCullMeshlets = nullptr;
+        _csPrepareArgs = nullptr;
+        _csWriteInstances = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
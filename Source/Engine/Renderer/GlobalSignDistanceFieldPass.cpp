@@ -6,6 +6,7 @@
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Engine/Engine.h"
 #include "Engine/Content/Content.h"
+#include "Engine/Graphics/GPUBuffer.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/Graphics.h"
@@ -25,11 +26,15 @@
 #define GLOBAL_SDF_RASTERIZE_GROUP_SIZE 8
 #define GLOBAL_SDF_RASTERIZE_CHUNK_SIZE 32 // Global SDF chunk size in voxels.
 #define GLOBAL_SDF_RASTERIZE_CHUNK_MARGIN 4 // The margin in voxels around objects for culling. Reduces artifacts but reduces performance.
+#define GLOBAL_SDF_RASTERIZE_CHUNKS_BUDGET 64 // The maximum amount of dirty chunks to rasterize in a cached cascade at a single update (remaining ones are updated in the next frames).
 #define GLOBAL_SDF_RASTERIZE_MIP_FACTOR 4 // Global SDF mip resolution downscale factor.
 #define GLOBAL_SDF_MIP_GROUP_SIZE 4
 #define GLOBAL_SDF_MIP_FLOODS 5 // Amount of flood fill passes for mip.
 #define GLOBAL_SDF_DEBUG_CHUNKS 0
 #define GLOBAL_SDF_DEBUG_FORCE_REDRAW 0 // Forces to redraw all SDF cascades every frame
+#define GLOBAL_SDF_CPU_SNAPSHOT_MAX_COUNT 32 // The maximum amount of CPU snapshots to sample at the single frame.
+#define GLOBAL_SDF_CPU_SNAPSHOT_LATENCY 3 // The amount of frames to wait before reading back the CPU snapshots (to prevent stalls).
+#define GLOBAL_SDF_CPU_SNAPSHOT_TIMEOUT 60 // The amount of frames after which unused CPU snapshots are removed.
 #define GLOBAL_SDF_ACTOR_IS_STATIC(actor) EnumHasAllFlags(actor->GetStaticFlags(), StaticFlags::Lightmap | StaticFlags::Transform)
 
 static_assert(GLOBAL_SDF_RASTERIZE_MODEL_MAX_COUNT % 4 == 0, "Must be multiple of 4 due to data packing for GPU constant buffer.");
@@ -102,8 +107,22 @@ struct RasterizeObject
     Transform LocalToWorld;
     BoundingBox ObjectBounds;
     Float4 LocalToUV;
+    uint32 Hash;
 };
 
+uint32 GetRasterizeObjectHash(const Actor* actor, const Transform& localToWorld, int32 residentMipLevels)
+{
+    uint32 hash = GetHash(actor);
+    CombineHash(hash, GetHash(localToWorld.Translation));
+    CombineHash(hash, GetHash(localToWorld.Orientation.X));
+    CombineHash(hash, GetHash(localToWorld.Orientation.Y));
+    CombineHash(hash, GetHash(localToWorld.Orientation.Z));
+    CombineHash(hash, GetHash(localToWorld.Orientation.W));
+    CombineHash(hash, GetHash(localToWorld.Scale));
+    CombineHash(hash, (uint32)residentMipLevels);
+    return hash;
+}
+
 constexpr int32 RasterizeChunkKeyHashResolution = GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
 
 struct RasterizeChunkKey
@@ -136,6 +155,13 @@ struct CascadeData
     BoundingBox Bounds;
     HashSet<RasterizeChunkKey> NonEmptyChunks;
     HashSet<RasterizeChunkKey> StaticChunks;
+    Dictionary<RasterizeChunkKey, uint32> DynamicChunks; // Chunks with dynamic objects with the hash of the objects rasterized into them (chunk is redrawn only if objects change)
+
+    FORCE_INLINE void ClearChunks()
+    {
+        StaticChunks.Clear();
+        DynamicChunks.Clear();
+    }
 
     FORCE_INLINE void OnSceneRenderingDirty(const BoundingBox& objectBounds)
     {
@@ -181,6 +207,9 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
     HashSet<ScriptingTypeHandle> ObjectTypes;
     HashSet<GPUTexture*> SDFTextures;
     GlobalSignDistanceFieldPass::BindingData Result;
+    GPUContext* AsyncContext = nullptr;
+    uint64 AsyncSyncPoint = 0;
+    GPUTexture* AsyncTmpMip = nullptr;
 
     ~GlobalSignDistanceFieldCustomBuffer()
     {
@@ -191,6 +220,16 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
         }
         RenderTargetPool::Release(Texture);
         RenderTargetPool::Release(TextureMip);
+        RenderTargetPool::Release(AsyncTmpMip);
+    }
+
+    void WaitForAsync(GPUContext* context)
+    {
+        // Temporary textures used on the async compute queue can be reused by the graphics queue only after it waits for the compute work
+        context->WaitForSyncPoint(AsyncContext, AsyncSyncPoint);
+        AsyncSyncPoint = 0;
+        RenderTargetPool::Release(AsyncTmpMip);
+        AsyncTmpMip = nullptr;
     }
 
     void OnSDFTextureDeleted(ScriptingObject* object)
@@ -212,7 +251,7 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
 
             // Clear static chunks cache
             for (auto& cascade : Cascades)
-                cascade.StaticChunks.Clear();
+                cascade.ClearChunks();
         }
     }
 
@@ -251,15 +290,104 @@ class GlobalSignDistanceFieldCustomBuffer : public RenderBuffers::CustomBuffer,
     void OnSceneRenderingClear(SceneRendering* scene) override
     {
         for (auto& cascade : Cascades)
-            cascade.StaticChunks.Clear();
+            cascade.ClearChunks();
     }
 };
 
+struct CPUSnapshotRequest
+{
+    BoundingBox Bounds;
+    uint64 LastRequestFrame;
+    bool Pending;
+    GlobalSignDistanceFieldPass::CPUSnapshot Snapshot;
+};
+
+struct CPUSnapshotReadback
+{
+    struct Item
+    {
+        const void* Owner;
+        BoundingBox Bounds;
+    };
+
+    GPUBuffer* Buffer = nullptr;
+    uint64 Frame = 0;
+    Array<Item> Items;
+};
+
 namespace
 {
     Dictionary<RasterizeChunkKey, RasterizeChunk> ChunksCache;
     Array<RasterizeObject> RasterizeObjectsCache;
     Dictionary<uint16, uint16> ObjectIndexToDataIndexCache;
+    Dictionary<const void*, CPUSnapshotRequest> CPUSnapshots;
+    CPUSnapshotReadback CPUSnapshotReadbacks[GLOBAL_SDF_CPU_SNAPSHOT_LATENCY + 1];
+
+    FORCE_INLINE float SampleSnapshotVoxel(const float* distances, int32 x, int32 y, int32 z)
+    {
+        constexpr int32 res = GlobalSignDistanceFieldPass::CPUSnapshotResolution;
+        return distances[(z * res + y) * res + x];
+    }
+
+    uint32 GetChunkHash(RasterizeChunkKey key)
+    {
+        // Combine hashes of all objects in all chunk layers
+        uint32 hash = 0;
+        const RasterizeObject* objects = RasterizeObjectsCache.Get();
+        while (const RasterizeChunk* chunk = ChunksCache.TryGet(key))
+        {
+            for (int32 i = 0; i < chunk->ModelsCount; i++)
+                CombineHash(hash, objects[chunk->Models[i]].Hash);
+            for (int32 i = 0; i < chunk->HeightfieldsCount; i++)
+                CombineHash(hash, objects[chunk->Heightfields[i]].Hash);
+            key.NextLayer();
+        }
+        return hash;
+    }
+}
+
+float GlobalSignDistanceFieldPass::CPUSnapshot::SampleDistance(const Vector3& position) const
+{
+    constexpr int32 res = CPUSnapshotResolution;
+    if (Distances.IsEmpty() || Bounds.Contains(position) == ContainmentType::Disjoint)
+        return MAX_float;
+    const Float3 coord = Float3::Clamp((Float3)(position - Bounds.Minimum) / VoxelSize, Float3::Zero, Float3((float)(res - 1)));
+    const Int3 c0 = Int3::Min(Int3(coord), Int3(res - 2));
+    const Float3 t = coord - Float3(c0);
+    const float* d = Distances.Get();
+#define SAMPLE(x, y, z) SampleSnapshotVoxel(d, c0.X + x, c0.Y + y, c0.Z + z)
+    const float d00 = Math::Lerp(SAMPLE(0, 0, 0), SAMPLE(1, 0, 0), t.X);
+    const float d10 = Math::Lerp(SAMPLE(0, 1, 0), SAMPLE(1, 1, 0), t.X);
+    const float d01 = Math::Lerp(SAMPLE(0, 0, 1), SAMPLE(1, 0, 1), t.X);
+    const float d11 = Math::Lerp(SAMPLE(0, 1, 1), SAMPLE(1, 1, 1), t.X);
+#undef SAMPLE
+    return Math::Lerp(Math::Lerp(d00, d10, t.Y), Math::Lerp(d01, d11, t.Y), t.Z);
+}
+
+float GlobalSignDistanceFieldPass::CPUSnapshot::SampleGradient(const Vector3& position, Float3& gradient) const
+{
+    gradient = Float3(0, 0.00001f, 0);
+    const float distance = SampleDistance(position);
+    if (distance >= MAX_float)
+        return distance;
+    const Vector3 offset = VoxelSize * 0.5f;
+    const float xp = SampleDistance(position + Vector3(offset.X, 0, 0));
+    const float xn = SampleDistance(position - Vector3(offset.X, 0, 0));
+    const float yp = SampleDistance(position + Vector3(0, offset.Y, 0));
+    const float yn = SampleDistance(position - Vector3(0, offset.Y, 0));
+    const float zp = SampleDistance(position + Vector3(0, 0, offset.Z));
+    const float zn = SampleDistance(position - Vector3(0, 0, offset.Z));
+    const auto derivative = [distance](float p, float n)
+    {
+        // Use one-sided difference at the snapshot bounds
+        if (p >= MAX_float)
+            p = distance;
+        if (n >= MAX_float)
+            n = distance;
+        return p - n;
+    };
+    gradient = Float3(derivative(xp, xn), derivative(yp, yn), derivative(zp, zn));
+    return distance;
 }
 
 String GlobalSignDistanceFieldPass::ToString() const
@@ -307,6 +435,7 @@ bool GlobalSignDistanceFieldPass::setupResources()
     _csRasterizeHeightfield = shader->GetCS("CS_RasterizeHeightfield");
     _csClearChunk = shader->GetCS("CS_ClearChunk");
     _csGenerateMip = shader->GetCS("CS_GenerateMip");
+    _csSampleVolume = shader->GetCS("CS_SampleVolume");
 
     // Init buffer
     if (!_objectsBuffer)
@@ -335,6 +464,7 @@ void GlobalSignDistanceFieldPass::OnShaderReloading(Asset* obj)
     _csRasterizeHeightfield = nullptr;
     _csClearChunk = nullptr;
     _csGenerateMip = nullptr;
+    _csSampleVolume = nullptr;
     _cb0 = nullptr;
     _cb1 = nullptr;
     invalidateResources();
@@ -350,6 +480,14 @@ void GlobalSignDistanceFieldPass::Dispose()
     SAFE_DELETE(_objectsBuffer);
     _objectsTextures.Resize(0);
     SAFE_DELETE_GPU_RESOURCE(_psDebug);
+    SAFE_DELETE_GPU_RESOURCE(_cpuSnapshotsBuffer);
+    for (auto& readback : CPUSnapshotReadbacks)
+    {
+        SAFE_DELETE_GPU_RESOURCE(readback.Buffer);
+        readback.Frame = 0;
+        readback.Items.Resize(0);
+    }
+    CPUSnapshots.SetCapacity(0);
     _shader = nullptr;
     ChunksCache.SetCapacity(0);
     RasterizeObjectsCache.SetCapacity(0);
@@ -380,9 +518,19 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
     const auto currentFrame = Engine::FrameCount;
     if (sdfData.LastFrameUsed == currentFrame)
     {
+        if (sdfData.AsyncSyncPoint)
+        {
+            // Wait for the async compute update to be done before the first use
+            sdfData.WaitForAsync(context);
+        }
         result = sdfData.Result;
         return false;
     }
+    if (sdfData.AsyncSyncPoint)
+    {
+        // Previous async update was not used so make the graphics queue wait for it before releasing its resources
+        sdfData.WaitForAsync(context->IsAsyncCompute() ? GPUDevice::Instance->GetMainContext() : context);
+    }
     sdfData.LastFrameUsed = currentFrame;
     PROFILE_GPU_CPU("Global SDF");
 
@@ -470,7 +618,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         for (auto& cascade : sdfData.Cascades)
         {
             cascade.NonEmptyChunks.Clear();
-            cascade.StaticChunks.Clear();
+            cascade.ClearChunks();
         }
         context->ClearUA(sdfData.Texture, Float4::One);
         context->ClearUA(sdfData.TextureMip, Float4::One);
@@ -530,10 +678,11 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         }
 
         // Check if cascade center has been moved
-        if (!(useCache && Float3::NearEqual(cascade.Position, center, cascadeVoxelSize)))
+        const bool cascadeCached = useCache && Float3::NearEqual(cascade.Position, center, cascadeVoxelSize);
+        if (!cascadeCached)
         {
             // TODO: optimize for moving camera (copy sdf for cached chunks)
-            cascade.StaticChunks.Clear();
+            cascade.ClearChunks();
         }
         cascade.Position = center;
         cascade.VoxelSize = cascadeVoxelSize;
@@ -602,6 +751,7 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
 
                 // Clear empty chunk
                 cascade.NonEmptyChunks.Remove(it);
+                cascade.DynamicChunks.Remove(key);
                 data.ChunkCoord = key.Coord * GLOBAL_SDF_RASTERIZE_CHUNK_SIZE;
                 context->UpdateCB(_cb1, &data);
                 context->Dispatch(_csClearChunk, chunkDispatchGroups, chunkDispatchGroups, chunkDispatchGroups);
@@ -612,28 +762,50 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         {
             PROFILE_GPU_CPU_NAMED("Rasterize Chunks");
 
-            // Update static chunks
+            // Update cached chunks (static chunks are redrawn only when invalidated, dynamic chunks when objects inside them change)
+            int32 chunksBudget = cascadeCached ? GLOBAL_SDF_RASTERIZE_CHUNKS_BUDGET : MAX_int32;
             for (auto it = chunks.Begin(); it.IsNotEnd(); ++it)
             {
                 auto& e = *it;
                 if (e.Key.Layer != 0)
                     continue;
+                bool skip;
                 if (e.Value.Dynamic)
                 {
                     // Remove static chunk with dynamic objects
                     cascade.StaticChunks.Remove(e.Key);
+
+                    // Skip updating dynamic chunk if objects didn't change
+                    const uint32 hash = GetChunkHash(e.Key);
+                    const uint32* prevHash = cascade.DynamicChunks.TryGet(e.Key);
+                    skip = (prevHash && *prevHash == hash) || chunksBudget <= 0;
+                    if (!skip)
+                    {
+                        cascade.DynamicChunks[e.Key] = hash;
+                        chunksBudget--;
+                    }
                 }
                 else if (cascade.StaticChunks.Contains(e.Key))
                 {
                     // Skip updating static chunk
-                    auto key = e.Key;
-                    while (chunks.Remove(key))
-                        key.NextLayer();
+                    skip = true;
                 }
                 else
                 {
-                    // Add to cache (render now but skip next frame)
-                    cascade.StaticChunks.Add(e.Key);
+                    // Add to cache (render now but skip next frame), leave dirty chunks above the budget for the next frames
+                    skip = chunksBudget <= 0;
+                    if (!skip)
+                    {
+                        cascade.StaticChunks.Add(e.Key);
+                        cascade.DynamicChunks.Remove(e.Key);
+                        chunksBudget--;
+                    }
+                }
+                if (skip)
+                {
+                    auto key = e.Key;
+                    while (chunks.Remove(key))
+                        key.NextLayer();
                 }
             }
 
@@ -884,7 +1056,10 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
         }
     }
 
-    RenderTargetPool::Release(tmpMip);
+    if (context->IsAsyncCompute())
+        sdfData.AsyncTmpMip = tmpMip;
+    else
+        RenderTargetPool::Release(tmpMip);
     if (anyDraw)
     {
         context->UnBindCB(1);
@@ -915,9 +1090,163 @@ bool GlobalSignDistanceFieldPass::Render(RenderContext& renderContext, GPUContex
     result.Constants.Resolution = (float)resolution;
     result.Constants.CascadesCount = cascadesCount;
     sdfData.Result = result;
+
+    // Sample volumes for the CPU queries
+    UpdateCPUSnapshots(renderContext, context, result);
+
     return false;
 }
 
+const GlobalSignDistanceFieldPass::CPUSnapshot* GlobalSignDistanceFieldPass::GetCPUSnapshot(const void* owner, const BoundingBox& bounds)
+{
+    if (!_supported)
+        return nullptr;
+    const uint64 frame = Engine::FrameCount;
+    CPUSnapshotRequest* request = CPUSnapshots.TryGet(owner);
+    if (!request)
+    {
+        request = &CPUSnapshots[owner];
+        request->Bounds = bounds;
+        request->LastRequestFrame = frame;
+        request->Pending = false;
+    }
+    else if (request->LastRequestFrame == frame)
+    {
+        // Merge multiple requests within a single frame (eg. emitter updated in parallel jobs)
+        BoundingBox::Merge(request->Bounds, bounds, request->Bounds);
+    }
+    else
+    {
+        request->Bounds = bounds;
+        request->LastRequestFrame = frame;
+    }
+    return request->Snapshot.Distances.HasItems() ? &request->Snapshot : nullptr;
+}
+
+void GlobalSignDistanceFieldPass::UpdateCPUSnapshots(RenderContext& renderContext, GPUContext* context, const BindingData& bindingData)
+{
+    ScopeLock lock(CPUSnapshotsLocker);
+    const uint64 frame = Engine::FrameCount;
+    constexpr int32 res = CPUSnapshotResolution;
+    constexpr int32 snapshotSize = res * res * res;
+
+    // Read back the sampled volumes
+    for (auto& readback : CPUSnapshotReadbacks)
+    {
+        if (readback.Items.IsEmpty() || frame - readback.Frame < GLOBAL_SDF_CPU_SNAPSHOT_LATENCY)
+            continue;
+        const float* data = (const float*)readback.Buffer->Map(GPUResourceMapMode::Read);
+        for (int32 i = 0; i < readback.Items.Count(); i++)
+        {
+            const auto& item = readback.Items[i];
+            CPUSnapshotRequest* request = CPUSnapshots.TryGet(item.Owner);
+            if (!request)
+                continue;
+            request->Pending = false;
+            if (!data)
+                continue;
+            auto& snapshot = request->Snapshot;
+            snapshot.Bounds = item.Bounds;
+            snapshot.VoxelSize = (Float3)item.Bounds.GetSize() / (float)(res - 1);
+            snapshot.Distances.Set(data + i * snapshotSize, snapshotSize);
+        }
+        if (data)
+            readback.Buffer->Unmap();
+        readback.Items.Clear();
+    }
+
+    // Sample volumes once per frame (using the first view that renders Global SDF)
+    if (_cpuSnapshotsFrame == frame || CPUSnapshots.IsEmpty() || !_csSampleVolume)
+        return;
+    _cpuSnapshotsFrame = frame;
+    CPUSnapshotReadback* readback = nullptr;
+    for (auto& e : CPUSnapshotReadbacks)
+    {
+        if (e.Items.IsEmpty())
+        {
+            readback = &e;
+            break;
+        }
+    }
+    if (!readback)
+        return;
+
+    // Prepare buffers
+    const uint32 size = GLOBAL_SDF_CPU_SNAPSHOT_MAX_COUNT * snapshotSize * sizeof(float);
+    if (!_cpuSnapshotsBuffer)
+        _cpuSnapshotsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("GlobalSDF.CPUSnapshots"));
+    if (!_cpuSnapshotsBuffer->IsAllocated() && _cpuSnapshotsBuffer->Init(GPUBufferDescription::Buffer(size, GPUBufferFlags::ShaderResource | GPUBufferFlags::UnorderedAccess, PixelFormat::R32_Float, nullptr, sizeof(float))))
+        return;
+    if (!readback->Buffer)
+        readback->Buffer = GPUDevice::Instance->CreateBuffer(TEXT("GlobalSDF.CPUSnapshotsReadback"));
+    if (!readback->Buffer->IsAllocated() && readback->Buffer->Init(GPUBufferDescription::Buffer(size, GPUBufferFlags::None, PixelFormat::Unknown, nullptr, sizeof(float), GPUResourceUsage::StagingReadback)))
+        return;
+
+    // Pick the requests used recently (remove the unused ones)
+    for (auto i = CPUSnapshots.Begin(); i.IsNotEnd(); ++i)
+    {
+        auto& request = i->Value;
+        if (frame - request.LastRequestFrame > GLOBAL_SDF_CPU_SNAPSHOT_TIMEOUT)
+        {
+            CPUSnapshots.Remove(i);
+            continue;
+        }
+        if (!request.Pending && frame - request.LastRequestFrame <= 1 && readback->Items.Count() < GLOBAL_SDF_CPU_SNAPSHOT_MAX_COUNT)
+        {
+            request.Pending = true;
+            readback->Items.Add({ i->Key, request.Bounds });
+        }
+    }
+    if (readback->Items.IsEmpty())
+        return;
+    PROFILE_GPU_CPU("CPU Snapshots");
+
+    // Sample Global SDF into the snapshot volumes
+    Data data;
+    Platform::MemoryClear(&data, sizeof(data));
+    data.GlobalSDF = bindingData.Constants;
+    context->UpdateCB(_cb0, &data);
+    context->BindCB(0, _cb0);
+    context->BindCB(1, _cb1);
+    context->BindSR(0, bindingData.Texture->ViewVolume());
+    context->BindSR(1, bindingData.TextureMip->ViewVolume());
+    context->BindUA(0, _cpuSnapshotsBuffer->View());
+    ModelsRasterizeData data1;
+    Platform::MemoryClear(&data1, sizeof(data1));
+    data1.CascadeResolution = res;
+    const int32 groups = Math::DivideAndRoundUp(res, GLOBAL_SDF_RASTERIZE_GROUP_SIZE);
+    for (int32 i = 0; i < readback->Items.Count(); i++)
+    {
+        const BoundingBox& bounds = readback->Items[i].Bounds;
+        data1.CascadeCoordToPosMul = (Float3)bounds.GetSize() / (float)(res - 1);
+        data1.CascadeCoordToPosAdd = (Float3)(bounds.Minimum - renderContext.View.Origin);
+        data1.ObjectsCount = i * snapshotSize;
+        context->UpdateCB(_cb1, &data1);
+        context->Dispatch(_csSampleVolume, groups, groups, groups);
+    }
+    context->ResetUA();
+    context->ResetSR();
+    context->UnBindCB(1);
+    context->CopyBuffer(readback->Buffer, _cpuSnapshotsBuffer, readback->Items.Count() * snapshotSize * sizeof(float));
+    readback->Frame = frame;
+}
+
+bool GlobalSignDistanceFieldPass::RenderAsync(RenderContext& renderContext, GPUContext* computeContext)
+{
+    BindingData bindingData;
+    const bool failed = Render(renderContext, computeContext, bindingData);
+
+    // Submit commands to run in parallel to the graphics work until the first use of the Global SDF in this frame (see Render)
+    const uint64 syncPoint = computeContext->Submit();
+    auto& sdfData = *renderContext.Buffers->GetCustomBuffer<GlobalSignDistanceFieldCustomBuffer>(TEXT("GlobalSignDistanceField"));
+    if (!failed || sdfData.AsyncTmpMip)
+    {
+        sdfData.AsyncContext = computeContext;
+        sdfData.AsyncSyncPoint = syncPoint;
+    }
+    return failed;
+}
+
 void GlobalSignDistanceFieldPass::RenderDebug(RenderContext& renderContext, GPUContext* context, GPUTexture* output)
 {
     BindingData bindingData;
@@ -972,6 +1301,7 @@ void GlobalSignDistanceFieldPass::RasterizeModelSDF(Actor* actor, const ModelBas
         data.SDF = &sdf;
         data.LocalToWorld = localToWorld;
         data.ObjectBounds = objectBounds;
+        data.Hash = GetRasterizeObjectHash(actor, localToWorld, residentMipLevels);
 
         // Inject object into the intersecting cascade chunks
         RasterizeChunkKey key;
@@ -1034,6 +1364,7 @@ void GlobalSignDistanceFieldPass::RasterizeHeightfield(Actor* actor, GPUTexture*
         data.LocalToWorld = localToWorld;
         data.ObjectBounds = objectBounds;
         data.LocalToUV = localToUV;
+        data.Hash = GetRasterizeObjectHash(actor, localToWorld, residentMipLevels);
 
         // Inject object into the intersecting cascade chunks
         RasterizeChunkKey key;
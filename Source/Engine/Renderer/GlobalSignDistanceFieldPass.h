@@ -4,6 +4,8 @@
 
 #include "RendererPass.h"
 #include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 
 /// <summary>
 /// Global Sign Distance Field (SDF) rendering pass. Composites scene geometry into series of 3D volume textures that cover the world around the camera for global distance field sampling.
@@ -29,6 +31,45 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
         ConstantsData Constants;
     };
 
+    // The resolution of the Global SDF snapshot volume read back to the CPU.
+    enum { CPUSnapshotResolution = 16 };
+
+    /// <summary>
+    /// The snapshot of the Global SDF distances sampled on a GPU within the volume and read back to the CPU. Used by the CPU systems (eg. CPU particles collisions) to perform batched distance queries.
+    /// </summary>
+    struct FLAXENGINE_API CPUSnapshot
+    {
+        /// <summary>
+        /// The world-space bounds of the snapshot volume.
+        /// </summary>
+        BoundingBox Bounds;
+
+        /// <summary>
+        /// The size of the snapshot voxel (distance between the samples).
+        /// </summary>
+        Float3 VoxelSize;
+
+        /// <summary>
+        /// The sampled distances (CPUSnapshotResolution^3 volume). Empty if snapshot is not ready.
+        /// </summary>
+        Array<float> Distances;
+
+        /// <summary>
+        /// Samples the distance to the closest surface at the given world location (returns large distance outside the snapshot bounds).
+        /// </summary>
+        float SampleDistance(const Vector3& position) const;
+
+        /// <summary>
+        /// Samples the distance to the closest surface and the gradient vector (derivative) at the given world location. Normalize it to get normal vector.
+        /// </summary>
+        float SampleGradient(const Vector3& position, Float3& gradient) const;
+    };
+
+    /// <summary>
+    /// The lock for the CPU snapshots access.
+    /// </summary>
+    CriticalSection CPUSnapshotsLocker;
+
 private:
     bool _supported = false;
     AssetReference<Shader> _shader;
@@ -53,6 +94,11 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     Vector3 _sdfDataOriginMin;
     Vector3 _sdfDataOriginMax;
 
+    // CPU snapshots
+    GPUShaderProgramCS* _csSampleVolume = nullptr;
+    GPUBuffer* _cpuSnapshotsBuffer = nullptr;
+    uint64 _cpuSnapshotsFrame = 0;
+
 public:
     /// <summary>
     /// Gets the Global SDF (only if enabled in Graphics Settings).
@@ -71,6 +117,14 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     /// <returns>True if failed to render (platform doesn't support it, out of video memory, disabled feature or effect is not ready), otherwise false.</returns>
     bool Render(RenderContext& renderContext, GPUContext* context, BindingData& result);
 
+    /// <summary>
+    /// Renders the Global SDF using the async compute context (executed in parallel to the graphics work). The next Render call in this frame (from any pass that uses Global SDF) waits for it on the GPU.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="computeContext">The async compute GPU context.</param>
+    /// <returns>True if failed to render (platform doesn't support it, out of video memory, disabled feature or effect is not ready), otherwise false.</returns>
+    bool RenderAsync(RenderContext& renderContext, GPUContext* computeContext);
+
     /// <summary>
     /// Renders the debug view.
     /// </summary>
@@ -79,6 +133,14 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     /// <param name="output">The output buffer.</param>
     void RenderDebug(RenderContext& renderContext, GPUContext* context, GPUTexture* output);
 
+    /// <summary>
+    /// Gets the Global SDF snapshot read back to the CPU for the owner object and requests its update for the given bounds. Snapshots are sampled after the Global SDF update and are available after a few frames of latency. Requests not updated for a while get removed. CPUSnapshotsLocker has to be locked while accessing the snapshot.
+    /// </summary>
+    /// <param name="owner">The snapshot owner (used only as a key).</param>
+    /// <param name="bounds">The world-space bounds of the volume to sample.</param>
+    /// <returns>The latest snapshot or null if not ready yet.</returns>
+    const CPUSnapshot* GetCPUSnapshot(const void* owner, const BoundingBox& bounds);
+
     void GetCullingData(BoundingBox& bounds) const
     {
         bounds = _cascadeCullingBounds;
@@ -90,6 +152,7 @@ class FLAXENGINE_API GlobalSignDistanceFieldPass : public RendererPass<GlobalSig
     void RasterizeHeightfield(Actor* actor, GPUTexture* heightfield, const Transform& localToWorld, const BoundingBox& objectBounds, const Float4& localToUV);
 
 private:
+    void UpdateCPUSnapshots(RenderContext& renderContext, GPUContext* context, const BindingData& bindingData);
 #if COMPILE_WITH_DEV_ENV
     void OnShaderReloading(Asset* obj);
 #endif
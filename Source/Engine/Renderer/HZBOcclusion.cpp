@@ -0,0 +1,120 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "HZBOcclusion.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/BoundingSphere.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Core/Math/Vector4.h"
+#include "Engine/Platform/Platform.h"
+
+void HZBOcclusion::Init(const byte* depth, uint32 rowPitch, int32 width, int32 height, const Matrix& viewProjection, const Vector3& origin)
+{
+    ASSERT(depth && width > 0 && height > 0 && width <= HZB_OCCLUSION_MAX_SIZE && height <= HZB_OCCLUSION_MAX_SIZE);
+    _width = width;
+    _height = height;
+    _viewProjection = viewProjection;
+    _origin = origin;
+
+    // Allocate mips
+    int32 size = 0;
+    _mipLevels = 0;
+    for (int32 mipWidth = width, mipHeight = height;; mipWidth = Math::Max(mipWidth >> 1, 1), mipHeight = Math::Max(mipHeight >> 1, 1))
+    {
+        _mipOffsets[_mipLevels++] = size;
+        size += mipWidth * mipHeight;
+        if (mipWidth == 1 && mipHeight == 1)
+            break;
+    }
+    _data.Resize(size, false);
+    float* data = _data.Get();
+
+    // Copy the top mip
+    for (int32 y = 0; y < height; y++)
+        Platform::MemoryCopy(data + y * width, depth + y * rowPitch, width * sizeof(float));
+
+    // Build mip chain (farthest depth of the 2x2 texels)
+    int32 srcWidth = width, srcHeight = height;
+    for (int32 mipIndex = 1; mipIndex < _mipLevels; mipIndex++)
+    {
+        const int32 dstWidth = Math::Max(srcWidth >> 1, 1), dstHeight = Math::Max(srcHeight >> 1, 1);
+        const float* src = data + _mipOffsets[mipIndex - 1];
+        float* dst = data + _mipOffsets[mipIndex];
+        for (int32 y = 0; y < dstHeight; y++)
+        {
+            const int32 y0 = Math::Min(y * 2, srcHeight - 1) * srcWidth;
+            const int32 y1 = Math::Min(y * 2 + 1, srcHeight - 1) * srcWidth;
+            for (int32 x = 0; x < dstWidth; x++)
+            {
+                const int32 x0 = Math::Min(x * 2, srcWidth - 1);
+                const int32 x1 = Math::Min(x * 2 + 1, srcWidth - 1);
+                dst[y * dstWidth + x] = Math::Max(Math::Max(src[y0 + x0], src[y0 + x1]), Math::Max(src[y1 + x0], src[y1 + x1]));
+            }
+        }
+        srcWidth = dstWidth;
+        srcHeight = dstHeight;
+    }
+}
+
+void HZBOcclusion::Reset()
+{
+    _mipLevels = 0;
+    _width = 0;
+    _height = 0;
+}
+
+bool HZBOcclusion::IsOccluded(const BoundingBox& bounds) const
+{
+    if (_mipLevels == 0)
+        return false;
+
+    // Project bounds corners to the screen
+    const Float3 min = bounds.Minimum - _origin;
+    const Float3 max = bounds.Maximum - _origin;
+    Float2 rectMin(MAX_float), rectMax(-MAX_float);
+    float minDepth = MAX_float;
+    for (int32 i = 0; i < 8; i++)
+    {
+        const Float3 corner(i & 1 ? max.X : min.X, i & 2 ? max.Y : min.Y, i & 4 ? max.Z : min.Z);
+        Float4 clip;
+        Float3::Transform(corner, _viewProjection, clip);
+        if (clip.W <= ZeroTolerance)
+            return false; // Intersects with the camera near plane
+        const float invW = 1.0f / clip.W;
+        const Float2 ndc(clip.X * invW, clip.Y * invW);
+        rectMin = Float2::Min(rectMin, ndc);
+        rectMax = Float2::Max(rectMax, ndc);
+        minDepth = Math::Min(minDepth, clip.Z * invW);
+    }
+    if (minDepth <= 0.0f || rectMax.X < -1.0f || rectMax.Y < -1.0f || rectMin.X > 1.0f || rectMin.Y > 1.0f)
+        return false;
+
+    // Convert to texels rect (flip Y to match texture space)
+    const int32 x0 = Math::Clamp((int32)((rectMin.X * 0.5f + 0.5f) * (float)_width), 0, _width - 1);
+    const int32 x1 = Math::Clamp((int32)((rectMax.X * 0.5f + 0.5f) * (float)_width), 0, _width - 1);
+    const int32 y0 = Math::Clamp((int32)((0.5f - rectMax.Y * 0.5f) * (float)_height), 0, _height - 1);
+    const int32 y1 = Math::Clamp((int32)((0.5f - rectMin.Y * 0.5f) * (float)_height), 0, _height - 1);
+
+    // Pick the mip that covers the rect with up to 2x2 texels
+    int32 mipIndex = 0;
+    while (mipIndex < _mipLevels - 1 && ((x1 >> mipIndex) - (x0 >> mipIndex) > 1 || (y1 >> mipIndex) - (y0 >> mipIndex) > 1))
+        mipIndex++;
+    const int32 mipWidth = Math::Max(_width >> mipIndex, 1);
+    const int32 mipHeight = Math::Max(_height >> mipIndex, 1);
+    const float* mip = _data.Get() + _mipOffsets[mipIndex];
+
+    // Sample the farthest depth of the area
+    float maxDepth = 0.0f;
+    for (int32 y = Math::Min(y0 >> mipIndex, mipHeight - 1); y <= Math::Min(y1 >> mipIndex, mipHeight - 1); y++)
+    {
+        for (int32 x = Math::Min(x0 >> mipIndex, mipWidth - 1); x <= Math::Min(x1 >> mipIndex, mipWidth - 1); x++)
+            maxDepth = Math::Max(maxDepth, mip[y * mipWidth + x]);
+    }
+    return minDepth > maxDepth;
+}
+
+bool HZBOcclusion::IsOccluded(const BoundingSphere& bounds) const
+{
+    BoundingBox box;
+    BoundingBox::FromSphere(bounds, box);
+    return IsOccluded(box);
+}
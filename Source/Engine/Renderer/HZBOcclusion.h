@@ -0,0 +1,88 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Math/Matrix.h"
+#include "Engine/Core/Math/Vector3.h"
+
+struct BoundingBox;
+struct BoundingSphere;
+
+// The maximum size of the hierarchical depth buffer copy used for occlusion queries on a CPU
+#define HZB_OCCLUSION_MAX_SIZE 256
+
+// The maximum amount of mip levels of the hierarchical depth buffer copy used for occlusion queries on a CPU
+#define HZB_OCCLUSION_MAX_MIPS 9
+
+/// <summary>
+/// CPU copy of the hierarchical depth buffer (HZB) used to perform occlusion culling of the objects. Each texel stores the farthest depth of the view area it covers.
+/// </summary>
+/// <remarks>Data comes from the previous frames (with latency of GPU readback), thus objects are tested against the view that was used to render the depth buffer. Queries are thread-safe (read-only).</remarks>
+class FLAXENGINE_API HZBOcclusion
+{
+private:
+    Array<float> _data;
+    int32 _mipOffsets[HZB_OCCLUSION_MAX_MIPS];
+    int32 _width = 0;
+    int32 _height = 0;
+    int32 _mipLevels = 0;
+    Matrix _viewProjection;
+    Vector3 _origin;
+
+public:
+    /// <summary>
+    /// Determines whether this instance has valid data for queries.
+    /// </summary>
+    FORCE_INLINE bool IsValid() const
+    {
+        return _mipLevels != 0;
+    }
+
+    /// <summary>
+    /// Gets the width of the top mip of the depth buffer (in texels).
+    /// </summary>
+    FORCE_INLINE int32 GetWidth() const
+    {
+        return _width;
+    }
+
+    /// <summary>
+    /// Gets the height of the top mip of the depth buffer (in texels).
+    /// </summary>
+    FORCE_INLINE int32 GetHeight() const
+    {
+        return _height;
+    }
+
+public:
+    /// <summary>
+    /// Initializes the occlusion data. Builds the mip chain from the given depth buffer data.
+    /// </summary>
+    /// <param name="depth">The depth buffer data (farthest depth per texel, row by row).</param>
+    /// <param name="rowPitch">The depth buffer data row pitch (in bytes).</param>
+    /// <param name="width">The depth buffer width (in texels).</param>
+    /// <param name="height">The depth buffer height (in texels).</param>
+    /// <param name="viewProjection">The view projection matrix used to render the depth buffer (relative to the origin).</param>
+    /// <param name="origin">The origin of the view used to render the depth buffer.</param>
+    void Init(const byte* depth, uint32 rowPitch, int32 width, int32 height, const Matrix& viewProjection, const Vector3& origin);
+
+    /// <summary>
+    /// Clears the occlusion data.
+    /// </summary>
+    void Reset();
+
+    /// <summary>
+    /// Checks if the given bounds are fully occluded by the depth buffer.
+    /// </summary>
+    /// <param name="bounds">The bounds (in world-space).</param>
+    /// <returns>True if bounds are occluded and object can be skipped from drawing, otherwise false.</returns>
+    bool IsOccluded(const BoundingBox& bounds) const;
+
+    /// <summary>
+    /// Checks if the given bounds are fully occluded by the depth buffer.
+    /// </summary>
+    /// <param name="bounds">The bounds (in world-space).</param>
+    /// <returns>True if bounds are occluded and object can be skipped from drawing, otherwise false.</returns>
+    bool IsOccluded(const BoundingSphere& bounds) const;
+};
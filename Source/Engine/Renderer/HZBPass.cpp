@@ -0,0 +1,266 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "HZBPass.h"
+#include "HZBOcclusion.h"
+#include "Engine/Core/Math/Vector2.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/TextureData.h"
+
+// The amount of frames after which the HZB readback is accessed on a CPU (prevents stalls when waiting for GPU)
+#define HZB_READBACK_LATENCY 2
+
+// The amount of the HZB readback textures (ring buffer)
+#define HZB_READBACK_COUNT (HZB_READBACK_LATENCY + 1)
+
+// The maximum age (in frames) of the HZB data that can be used for occlusion culling
+#define HZB_MAX_AGE 4
+
+PACK_STRUCT(struct HZBData {
+    Float2 InputSize;
+    Float2 InputScale;
+    });
+
+struct HZBReadback
+{
+    GPUTexture* Texture = nullptr;
+    uint64 Frame = 0;
+    Matrix ViewProjection;
+    Vector3 Origin;
+};
+
+class HZBCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* Texture = nullptr;
+    uint64 TextureFrame = 0;
+    Matrix ViewProjection;
+    Vector3 Origin;
+    HZBReadback Readbacks[HZB_READBACK_COUNT];
+    uint64 OcclusionFrame = 0;
+    HZBOcclusion Occlusion;
+
+    ~HZBCustomBuffer()
+    {
+        RenderTargetPool::Release(Texture);
+        for (auto& e : Readbacks)
+            SAFE_DELETE_GPU_RESOURCE(e.Texture);
+    }
+
+    void Reset()
+    {
+        TextureFrame = 0;
+        for (auto& e : Readbacks)
+            e.Frame = 0;
+        OcclusionFrame = 0;
+        Occlusion.Reset();
+    }
+};
+
+String HZBPass::ToString() const
+{
+    return TEXT("HZBPass");
+}
+
+bool HZBPass::Init()
+{
+    // Create pipeline state
+    _psDownscale = GPUDevice::Instance->CreatePipelineState();
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/HZB"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<HZBPass, &HZBPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool HZBPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(HZBData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, HZBData);
+        return true;
+    }
+
+    // Create pipeline state
+    GPUPipelineState::Description psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+    if (!_psDownscale->IsValid())
+    {
+        psDesc.PS = shader->GetPS("PS_Downscale");
+        if (_psDownscale->Init(psDesc))
+            return true;
+    }
+
+    return false;
+}
+
+void HZBPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    SAFE_DELETE_GPU_RESOURCE(_psDownscale);
+    _shader = nullptr;
+}
+
+bool HZBPass::IsEnabled(const RenderContext& renderContext)
+{
+    const RenderView& view = renderContext.View;
+    return Graphics::EnableOcclusionCulling &&
+            renderContext.Buffers &&
+            renderContext.Buffers->LinkedCustomBuffers == nullptr &&
+            !view.IsOfflinePass &&
+            !view.IsSingleFrame &&
+            !view.IsCullingDisabled &&
+            EnumHasAnyFlags(view.Pass, DrawPass::GBuffer);
+}
+
+const HZBOcclusion* HZBPass::GetOcclusion(const RenderContext& renderContext)
+{
+    if (!IsEnabled(renderContext))
+        return nullptr;
+    auto& buffer = *renderContext.Buffers->GetCustomBuffer<HZBCustomBuffer>(TEXT("HZB"));
+    const uint64 frame = Engine::FrameCount;
+    buffer.LastFrameUsed = frame;
+    if (renderContext.Task && renderContext.Task->IsCameraCut)
+    {
+        // Drop the history on camera cuts
+        buffer.Reset();
+        return nullptr;
+    }
+
+    // Pick the latest readback that should be already done on GPU
+    HZBReadback* readback = nullptr;
+    for (auto& e : buffer.Readbacks)
+    {
+        if (e.Frame != 0 && e.Frame + HZB_READBACK_LATENCY <= frame && (!readback || e.Frame > readback->Frame))
+            readback = &e;
+    }
+    if (readback && readback->Frame != buffer.OcclusionFrame)
+    {
+        PROFILE_CPU_NAMED("HZB Readback");
+        TextureMipData mipData;
+        if (readback->Texture->GetData(0, 0, mipData))
+        {
+            buffer.Reset();
+            return nullptr;
+        }
+        buffer.Occlusion.Init(mipData.Data.Get(), mipData.RowPitch, readback->Texture->Width(), readback->Texture->Height(), readback->ViewProjection, readback->Origin);
+        buffer.OcclusionFrame = readback->Frame;
+    }
+
+    // Skip too old data (eg. view was not rendered for a while)
+    if (!buffer.Occlusion.IsValid() || buffer.OcclusionFrame + HZB_READBACK_LATENCY + HZB_MAX_AGE < frame)
+        return nullptr;
+    return &buffer.Occlusion;
+}
+
+GPUTexture* HZBPass::GetHZB(const RenderContext& renderContext, Matrix& viewProjection, Vector3& origin) const
+{
+    if (!IsEnabled(renderContext) || (renderContext.Task && renderContext.Task->IsCameraCut))
+        return nullptr;
+    const auto buffer = renderContext.Buffers->FindCustomBuffer<HZBCustomBuffer>(TEXT("HZB"));
+    if (!buffer || !buffer->Texture || buffer->TextureFrame == 0 || buffer->TextureFrame + HZB_MAX_AGE < Engine::FrameCount)
+        return nullptr;
+    viewProjection = buffer->ViewProjection;
+    origin = buffer->Origin;
+    return buffer->Texture;
+}
+
+void HZBPass::Render(RenderContext& renderContext, GPUContext* context)
+{
+    GPUTexture* depthBuffer = renderContext.Buffers ? renderContext.Buffers->DepthBuffer : nullptr;
+    if (!IsEnabled(renderContext) || !depthBuffer || checkIfSkipPass())
+        return;
+    auto& buffer = *renderContext.Buffers->GetCustomBuffer<HZBCustomBuffer>(TEXT("HZB"));
+    const uint64 frame = Engine::FrameCount;
+    buffer.LastFrameUsed = frame;
+    if (buffer.TextureFrame == frame)
+        return;
+    PROFILE_GPU_CPU("HZB");
+    const RenderView& view = renderContext.View;
+
+    // Allocate texture (top mip is at power-of-two resolution below the depth buffer size to have exact 2x2 reduction in lower mips)
+    const int32 width = 1 << Math::FloorLog2(depthBuffer->Width());
+    const int32 height = 1 << Math::FloorLog2(depthBuffer->Height());
+    if (!buffer.Texture || buffer.Texture->Width() != width || buffer.Texture->Height() != height)
+    {
+        RenderTargetPool::Release(buffer.Texture);
+        buffer.Texture = RenderTargetPool::Get(GPUTextureDescription::New2D(width, height, 0, PixelFormat::R32_Float, GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget | GPUTextureFlags::PerMipViews));
+        RENDER_TARGET_POOL_SET_NAME(buffer.Texture, "HZB");
+        buffer.Reset();
+    }
+    const int32 mipLevels = buffer.Texture->MipLevels();
+
+    // Build mip chain (first mip is downscaled from the depth buffer)
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->ResetRenderTarget();
+    context->BindCB(0, cb);
+    context->SetState(_psDownscale);
+    GPUTextureView* input = depthBuffer->View();
+    Int2 inputSize(depthBuffer->Width(), depthBuffer->Height());
+    Int2 outputSize(width, height);
+    int32 readbackMip = -1;
+    for (int32 mipIndex = 0; mipIndex < mipLevels; mipIndex++)
+    {
+        HZBData data;
+        data.InputSize = Float2((float)inputSize.X, (float)inputSize.Y);
+        data.InputScale = data.InputSize / Float2((float)outputSize.X, (float)outputSize.Y);
+        context->UpdateCB(cb, &data);
+        context->SetRenderTarget(buffer.Texture->View(0, mipIndex));
+        context->SetViewportAndScissors((float)outputSize.X, (float)outputSize.Y);
+        context->BindSR(0, input);
+        context->DrawFullscreenTriangle();
+        context->ResetRenderTarget();
+        if (readbackMip == -1 && outputSize.X <= HZB_OCCLUSION_MAX_SIZE && outputSize.Y <= HZB_OCCLUSION_MAX_SIZE)
+            readbackMip = mipIndex;
+
+        // Move down
+        input = buffer.Texture->View(0, mipIndex);
+        inputSize = outputSize;
+        outputSize = Int2(Math::Max(outputSize.X >> 1, 1), Math::Max(outputSize.Y >> 1, 1));
+    }
+    context->UnBindSR(0);
+    context->UnBindCB(0);
+    Matrix::Multiply(view.View, view.NonJitteredProjection, buffer.ViewProjection);
+    buffer.Origin = view.Origin;
+    buffer.TextureFrame = frame;
+
+    // Copy the lower mip for readback on a CPU
+    HZBReadback& readback = buffer.Readbacks[frame % HZB_READBACK_COUNT];
+    const int32 readbackWidth = Math::Max(width >> readbackMip, 1);
+    const int32 readbackHeight = Math::Max(height >> readbackMip, 1);
+    if (!readback.Texture)
+        readback.Texture = GPUDevice::Instance->CreateTexture(TEXT("HZB.Readback"));
+    if (readback.Texture->Width() != readbackWidth || readback.Texture->Height() != readbackHeight)
+    {
+        if (readback.Texture->Init(GPUTextureDescription::New2D(readbackWidth, readbackHeight, 1, PixelFormat::R32_Float).ToStagingReadback()))
+        {
+            LOG(Error, "Failed to create HZB readback texture.");
+            readback.Frame = 0;
+            return;
+        }
+    }
+    context->CopyTexture(readback.Texture, 0, 0, 0, 0, buffer.Texture, readbackMip);
+    readback.Frame = frame;
+    readback.ViewProjection = buffer.ViewProjection;
+    readback.Origin = buffer.Origin;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+class HZBOcclusion;
+
+/// <summary>
+/// Hierarchical depth buffer (HZB) rendering pass. Builds the mip chain of the scene depth (with the farthest depth per texel) used for occlusion culling on GPU and on CPU (via the readback of the lower mip).
+/// </summary>
+class HZBPass : public RendererPass<HZBPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUPipelineState* _psDownscale = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the occlusion culling can be used by the given view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>True if occlusion culling can be used, otherwise false.</returns>
+    static bool IsEnabled(const RenderContext& renderContext);
+
+    /// <summary>
+    /// Gets the occlusion data for the CPU culling of the view (from the previous frames). Updates the data with the finished GPU readback. Called before collecting draw calls.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The occlusion data or null if not available.</returns>
+    const HZBOcclusion* GetOcclusion(const RenderContext& renderContext);
+
+    /// <summary>
+    /// Gets the hierarchical depth buffer texture of the view (from the previous frame) for the GPU culling.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="viewProjection">The output view projection matrix used to render the depth buffer (relative to the origin).</param>
+    /// <param name="origin">The output origin of the view used to render the depth buffer.</param>
+    /// <returns>The HZB texture or null if not available.</returns>
+    GPUTexture* GetHZB(const RenderContext& renderContext, Matrix& viewProjection, Vector3& origin) const;
+
+    /// <summary>
+    /// Renders the hierarchical depth buffer from the current scene depth and requests its readback to CPU.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    void Render(RenderContext& renderContext, GPUContext* context);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _psDownscale->ReleaseGPU();
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -3,6 +3,7 @@
 #include "LightPass.h"
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
+#include "ForwardPass.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/GPULimits.h"
@@ -11,6 +12,7 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Graphics.h"
 
 PACK_STRUCT(struct PerLight{
     LightData Light;
@@ -21,6 +23,12 @@ PACK_STRUCT(struct PerFrame{
     GBufferData GBuffer;
     });
 
+PACK_STRUCT(struct PerGrid{
+    Int3 LightGridSize;
+    uint32 Dummy0;
+    Float4 LightGridParams;
+    });
+
 String LightPass::ToString() const
 {
     return TEXT("LightPass");
@@ -34,6 +42,7 @@ bool LightPass::Init()
     _psLightPointInverted.CreatePipelineStates();
     _psLightSpotNormal.CreatePipelineStates();
     _psLightSpotInverted.CreatePipelineStates();
+    _psLightClustered.CreatePipelineStates();
     _psLightSkyNormal = GPUDevice::Instance->CreatePipelineState();
     _psLightSkyInverted = GPUDevice::Instance->CreatePipelineState();
 
@@ -77,6 +86,12 @@ bool LightPass::setupResources()
         REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 1, PerFrame);
         return true;
     }
+    const bool useClustered = GPUDevice::Instance->GetFeatureLevel() >= FeatureLevel::SM5;
+    if (useClustered && shader->GetCB(2)->GetSize() != sizeof(PerGrid))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 2, PerGrid);
+        return true;
+    }
 
     // Create pipeline stages
     GPUPipelineState::Description psDesc;
@@ -116,6 +131,14 @@ bool LightPass::setupResources()
         if (_psLightSpotNormal.Create(psDesc, shader, "PS_Spot"))
             return true;
     }
+    if (useClustered && !_psLightClustered.IsValid())
+    {
+        psDesc = GPUPipelineState::Description::DefaultFullscreenTriangle;
+        psDesc.BlendMode = BlendingMode::Add;
+        psDesc.BlendMode.RenderTargetWriteMask = BlendingMode::ColorWrite::RGB;
+        if (_psLightClustered.Create(psDesc, shader, "PS_Clustered"))
+            return true;
+    }
     if (!_psLightSkyNormal->IsValid() || !_psLightSkyInverted->IsValid())
     {
         psDesc = GPUPipelineState::Description::DefaultNoDepth;
@@ -145,6 +168,7 @@ void LightPass::Dispose()
     _psLightPointInverted.Delete();
     _psLightSpotNormal.Delete();
     _psLightSpotInverted.Delete();
+    _psLightClustered.Delete();
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyNormal);
     SAFE_DELETE_GPU_RESOURCE(_psLightSkyInverted);
     SAFE_DELETE_GPU_RESOURCE(_psClearDiffuse);
@@ -228,6 +252,34 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     context->BindSR(3, depthBufferSRV);
     context->BindSR(4, renderContext.Buffers->GBuffer3);
 
+    // Render local lights without shadows and IES profiles in a single pass using the clustered lights grid (shared with the forward shading)
+    const ForwardPass::LightGrid* lightGrid = nullptr;
+    if (Graphics::EnableClusteredLighting && _psLightClustered.IsValid())
+    {
+        ForwardPass::Instance()->BuildLightGrid(renderContext);
+        lightGrid = ForwardPass::Instance()->GetLightGrid(renderContext);
+    }
+    if (lightGrid)
+    {
+        PROFILE_GPU_CPU_NAMED("Clustered Lights");
+        PerGrid perGrid;
+        perGrid.LightGridSize = lightGrid->Size;
+        perGrid.Dummy0 = 0;
+        perGrid.LightGridParams = lightGrid->Params;
+        auto cb2 = lightShader->GetCB(2);
+        context->UpdateCB(cb2, &perGrid);
+        context->BindCB(1, cb1);
+        context->BindCB(2, cb2);
+        context->BindSR(8, lightGrid->Lights->View());
+        context->BindSR(9, lightGrid->Cells->View());
+        context->BindSR(10, lightGrid->Indices->View());
+        context->SetState(_psLightClustered.Get(disableSpecular));
+        context->DrawFullscreenTriangle();
+        context->UnBindSR(8);
+        context->UnBindSR(9);
+        context->UnBindSR(10);
+    }
+
     // Fullscreen shadow mask buffer
     GPUTexture* shadowMask = nullptr;
 #define GET_SHADOW_MASK() \
@@ -241,10 +293,12 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     // Render all point lights
     for (int32 lightIndex = 0; lightIndex < mainCache->PointLights.Count(); lightIndex++)
     {
+        auto& light = mainCache->PointLights[lightIndex];
+        if (lightGrid && lightIndex < lightGrid->PointLightsCount && light.ShadowDataIndex == -1 && !light.IESTexture)
+            continue; // Drawn by the clustered lighting
         PROFILE_GPU_CPU_NAMED("Point Light");
 
         // Cache data
-        auto& light = mainCache->PointLights[lightIndex];
         float lightRadius = light.Radius;
         Float3 lightPosition = light.Position;
         const bool renderShadow = useShadows && light.ShadowDataIndex != -1;
@@ -298,10 +352,12 @@ void LightPass::RenderLight(RenderContextBatch& renderContextBatch, GPUTextureVi
     // Render all spot lights
     for (int32 lightIndex = 0; lightIndex < mainCache->SpotLights.Count(); lightIndex++)
     {
+        auto& light = mainCache->SpotLights[lightIndex];
+        if (lightGrid && lightIndex < lightGrid->SpotLightsCount && light.ShadowDataIndex == -1 && !light.IESTexture)
+            continue; // Drawn by the clustered lighting
         PROFILE_GPU_CPU_NAMED("Spot Light");
 
         // Cache data
-        auto& light = mainCache->SpotLights[lightIndex];
         float lightRadius = light.Radius;
         Float3 lightPosition = light.Position;
         const bool renderShadow = useShadows && light.ShadowDataIndex != -1;
@@ -12,12 +12,18 @@
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/PostProcessEffect.h"
 #include "Engine/Profiler/Profiler.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Content/Assets/CubeTexture.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Level/Actors/PostFxVolume.h"
 
-static_assert(sizeof(DrawCall) <= 288, "Too big draw call data size.");
+// The minimum amount of draw batches to record them in parallel (small lists are faster to record on a single thread)
+#define RENDER_LIST_PARALLEL_BATCHES_MIN 256
+#define RENDER_LIST_PARALLEL_BATCHES_PER_CHUNK 128
+#define RENDER_LIST_PARALLEL_CHUNKS_MAX 8
+
+static_assert(sizeof(DrawCall) <= 304, "Too big draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Terrain), "Wrong draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Particle), "Wrong draw call data size.");
 static_assert(sizeof(DrawCall::Surface) >= sizeof(DrawCall::Custom), "Wrong draw call data size.");
@@ -54,6 +60,7 @@ void RendererDirectionalLightData::SetupLightData(LightData* data, bool useShado
     data->Radius = 0;
     data->FalloffExponent = 0;
     data->InverseSquared = 0;
+    data->SeparatePass = 0;
     data->RadiusInv = 0;
 }
 
@@ -71,6 +78,7 @@ void RendererSpotLightData::SetupLightData(LightData* data, bool useShadow) cons
     data->Radius = Radius;
     data->FalloffExponent = FallOffExponent;
     data->InverseSquared = UseInverseSquaredFalloff ? 1.0f : 0.0f;
+    data->SeparatePass = 0;
     data->RadiusInv = 1.0f / Radius;
 }
 
@@ -88,6 +96,7 @@ void RendererPointLightData::SetupLightData(LightData* data, bool useShadow) con
     data->Radius = Radius;
     data->FalloffExponent = FallOffExponent;
     data->InverseSquared = UseInverseSquaredFalloff ? 1.0f : 0.0f;
+    data->SeparatePass = 0;
     data->RadiusInv = 1.0f / Radius;
 }
 
@@ -105,6 +114,7 @@ void RendererSkyLightData::SetupLightData(LightData* data, bool useShadow) const
     data->Radius = Radius;
     data->FalloffExponent = 0;
     data->InverseSquared = 0;
+    data->SeparatePass = 0;
     data->RadiusInv = 1.0f / Radius;
 }
 
@@ -401,6 +411,7 @@ void RenderList::Clear()
     for (auto& list : DrawCallsLists)
         list.Clear();
     ShadowDepthDrawCallsList.Clear();
+    ShadowDepthStaticDrawCallsList.Clear();
     PointLights.Clear();
     SpotLights.Clear();
     SkyLights.Clear();
@@ -463,31 +474,31 @@ void RenderList::AddDrawCall(const RenderContext& renderContext, DrawPass drawMo
 
     // Append draw call data
     CalculateSortKey(renderContext, drawCall, sortOrder);
-    const int32 index = DrawCalls.Add(drawCall);
+    const int32 index = DrawCalls.AddLocal(drawCall);
 
     // Add draw call to proper draw lists
     if ((drawModes & DrawPass::Depth) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+        DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.AddLocal(index);
     }
     if ((drawModes & (DrawPass::GBuffer | DrawPass::GlobalSurfaceAtlas)) != DrawPass::None)
     {
         if (receivesDecals)
-            DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.AddLocal(index);
         else
-            DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.AddLocal(index);
     }
     if ((drawModes & DrawPass::Forward) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
+        DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.AddLocal(index);
     }
     if ((drawModes & DrawPass::Distortion) != DrawPass::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.Add(index);
+        DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.AddLocal(index);
     }
     if ((drawModes & DrawPass::MotionVectors) != DrawPass::None && (staticFlags & StaticFlags::Transform) == StaticFlags::None)
     {
-        DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.Add(index);
+        DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.AddLocal(index);
     }
 }
 
@@ -502,7 +513,7 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
 
     // Append draw call data
     CalculateSortKey(mainRenderContext, drawCall, sortOrder);
-    const int32 index = DrawCalls.Add(drawCall);
+    const int32 index = DrawCalls.AddLocal(drawCall);
 
     // Add draw call to proper draw lists
     DrawPass modes = drawModes & mainRenderContext.View.GetShadowsDrawPassMask(shadowsMode);
@@ -511,26 +522,26 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
     {
         if ((drawModes & DrawPass::Depth) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Depth].Indices.AddLocal(index);
         }
         if ((drawModes & (DrawPass::GBuffer | DrawPass::GlobalSurfaceAtlas)) != DrawPass::None)
         {
             if (receivesDecals)
-                DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.Add(index);
+                DrawCallsLists[(int32)DrawCallsListType::GBuffer].Indices.AddLocal(index);
             else
-                DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.Add(index);
+                DrawCallsLists[(int32)DrawCallsListType::GBufferNoDecals].Indices.AddLocal(index);
         }
         if ((drawModes & DrawPass::Forward) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Forward].Indices.AddLocal(index);
         }
         if ((drawModes & DrawPass::Distortion) != DrawPass::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::Distortion].Indices.AddLocal(index);
         }
         if ((drawModes & DrawPass::MotionVectors) != DrawPass::None && (staticFlags & StaticFlags::Transform) == StaticFlags::None)
         {
-            DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.Add(index);
+            DrawCallsLists[(int32)DrawCallsListType::MotionVectors].Indices.AddLocal(index);
         }
     }
     for (int32 i = 1; i < renderContextBatch.Contexts.Count(); i++)
@@ -540,7 +551,10 @@ void RenderList::AddDrawCall(const RenderContextBatch& renderContextBatch, DrawP
         drawModes = modes & renderContext.View.Pass;
         if (drawModes != DrawPass::None && renderContext.View.CullingFrustum.Intersects(bounds))
         {
-            renderContext.List->ShadowDepthDrawCallsList.Indices.Add(index);
+            if ((staticFlags & StaticFlags::Transform) != StaticFlags::None)
+                renderContext.List->ShadowDepthStaticDrawCallsList.Indices.AddLocal(index);
+            else
+                renderContext.List->ShadowDepthDrawCallsList.Indices.AddLocal(index);
         }
     }
 }
@@ -564,11 +578,60 @@ namespace
                 handler.CanBatch(a, b) &&
                 a.WorldDeterminantSign * b.WorldDeterminantSign > 0;
     }
+
+    FORCE_INLINE void FlushLocalIndices(DrawCallsList& list, const RenderListBuffer<DrawCall>::CompactRemap& remap)
+    {
+        list.Indices.FlushLocal();
+        RenderListBuffer<DrawCall>::RemapIndices(remap, list.Indices.Get(), list.Indices.Count());
+    }
+
+    /// <summary>
+    /// Copies the draw calls added via per-thread chunks into the buffers (all draw calls have to be added before sorting or drawing).
+    /// </summary>
+    FORCE_INLINE void FlushLocalList(RenderList* renderList, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls)
+    {
+        if (&drawCalls == &renderList->DrawCalls)
+            renderList->FlushLocal(); // Compacting draw calls changes the indices in all lists
+        else
+            list.Indices.FlushLocal(); // Draw calls of the other list (eg. main view for shadow projections) are flushed with the whole batch
+    }
+}
+
+void RenderList::FlushLocal()
+{
+    PROFILE_CPU();
+    RenderListBuffer<DrawCall>::CompactRemap remap;
+    DrawCalls.FlushLocal(&remap);
+    for (auto& list : DrawCallsLists)
+        FlushLocalIndices(list, remap);
+
+    // Shadow depth lists reference the main view draw calls (remapped when flushing the batch)
+    ShadowDepthDrawCallsList.Indices.FlushLocal();
+    ShadowDepthStaticDrawCallsList.Indices.FlushLocal();
+}
+
+void RenderList::FlushLocal(const RenderContextBatch& renderContextBatch)
+{
+    PROFILE_CPU();
+    RenderListBuffer<DrawCall>::CompactRemap mainRemap, remap;
+    renderContextBatch.GetMainContext().List->DrawCalls.FlushLocal(&mainRemap);
+    for (int32 i = 0; i < renderContextBatch.Contexts.Count(); i++)
+    {
+        RenderList* renderList = renderContextBatch.Contexts.Get()[i].List;
+        if (i != 0)
+            renderList->DrawCalls.FlushLocal(&remap);
+        const auto& listRemap = i != 0 ? remap : mainRemap;
+        for (auto& list : renderList->DrawCallsLists)
+            FlushLocalIndices(list, listRemap);
+        FlushLocalIndices(renderList->ShadowDepthDrawCallsList, mainRemap);
+        FlushLocalIndices(renderList->ShadowDepthStaticDrawCallsList, mainRemap);
+    }
 }
 
 void RenderList::SortDrawCalls(const RenderContext& renderContext, bool reverseDistance, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, bool stable)
 {
     PROFILE_CPU();
+    FlushLocalList(this, list, drawCalls);
     const auto* drawCallsData = drawCalls.Get();
     const auto* listData = list.Indices.Get();
     const int32 listSize = list.Indices.Count();
@@ -654,6 +717,17 @@ FORCE_INLINE bool CanUseInstancing(DrawPass pass)
 
 void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input)
 {
+    ExecuteDrawCalls(renderContext, list, drawCalls, input, nullptr);
+}
+
+void RenderList::ExecuteDrawCallsParallel(const RenderContext& renderContext, DrawCallsListType listType, const Function<void(GPUContext*)>& setup)
+{
+    ExecuteDrawCalls(renderContext, DrawCallsLists[(int32)listType], DrawCalls, nullptr, &setup);
+}
+
+void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, const Function<void(GPUContext*)>* setup)
+{
+    FlushLocalList(this, list, drawCalls);
     if (list.IsEmpty())
         return;
     PROFILE_GPU_CPU("Drawing");
@@ -678,16 +752,19 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
             if (batch.BatchSize > 1)
                 instancedBatchesCount += batch.BatchSize;
         }
+        bool anyInstanceBuffer = false;
         for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
-            if (batch.Instances.Count() > 1)
+            if (batch.InstanceBuffer)
+                anyInstanceBuffer = true;
+            else if (batch.Instances.Count() > 1)
                 instancedBatchesCount += batch.Instances.Count();
         }
         if (instancedBatchesCount == 0)
         {
-            // Faster path if none of the draw batches requires instancing
-            useInstancing = false;
+            // Faster path if none of the draw batches requires instancing (external instance buffers are already uploaded)
+            useInstancing = anyInstanceBuffer;
             goto DRAW;
         }
         _instanceBuffer.Clear();
@@ -726,16 +803,72 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
 
 DRAW:
 
+    // Split the batches into chunks recorded in parallel with deferred contexts (if supported by the graphics backend)
+    const int32 batchesCount = list.Batches.Count();
+    GPUContext* deferredContexts[RENDER_LIST_PARALLEL_CHUNKS_MAX];
+    int32 chunksCount = 0;
+    if (setup && Graphics::EnableParallelDrawCalls && batchesCount >= RENDER_LIST_PARALLEL_BATCHES_MIN)
+    {
+        const int32 maxChunks = Math::Min(JobSystem::GetThreadsCount(), RENDER_LIST_PARALLEL_CHUNKS_MAX, batchesCount / RENDER_LIST_PARALLEL_BATCHES_PER_CHUNK);
+        while (chunksCount < maxChunks && (deferredContexts[chunksCount] = GPUDevice::Instance->GetDeferredContext(chunksCount)))
+            chunksCount++;
+    }
+    if (chunksCount <= 1)
+    {
+        DrawBatches(renderContext, list, drawCalls, input, context, useInstancing, 0, batchesCount, true, 0);
+        return;
+    }
+
+    // Compute the instance buffer offset of each chunk (instanced batches are written in order)
+    const int32 chunkSize = Math::DivideAndRoundUp(batchesCount, chunksCount);
+    int32 chunkInstanceBufferOffsets[RENDER_LIST_PARALLEL_CHUNKS_MAX];
+    int32 instanceBufferOffset = 0;
+    for (int32 chunk = 0; chunk < chunksCount; chunk++)
+    {
+        chunkInstanceBufferOffsets[chunk] = instanceBufferOffset;
+        const int32 chunkEnd = Math::Min(chunk * chunkSize + chunkSize, batchesCount);
+        for (int32 i = chunk * chunkSize; i < chunkEnd; i++)
+        {
+            if (batchesData[i].BatchSize > 1)
+                instanceBufferOffset += batchesData[i].BatchSize;
+        }
+    }
+
+    // Record draw calls on job system threads (pre-batched draw calls go into the last chunk)
+    GPUTexture* shadingRateImage = context->GetShadingRateImage();
+    JobSystem::Execute([&](int32 chunk)
+    {
+        PROFILE_CPU_NAMED("Drawing Chunk");
+        GPUContext* deferredContext = deferredContexts[chunk];
+        (*setup)(deferredContext);
+        deferredContext->SetShadingRateImage(shadingRateImage);
+        deferredContext->ResetSR();
+        const int32 chunkStart = chunk * chunkSize;
+        const int32 chunkEnd = Math::Min(chunkStart + chunkSize, batchesCount);
+        DrawBatches(renderContext, list, drawCalls, input, deferredContext, useInstancing, chunkStart, chunkEnd, chunk == chunksCount - 1, chunkInstanceBufferOffsets[chunk]);
+    }, chunksCount);
+
+    // Submit the recorded commands in order and restore the main context state
+    context->ExecuteDeferred(ToSpan(deferredContexts, chunksCount));
+    (*setup)(context);
+    context->SetShadingRateImage(shadingRateImage);
+}
+
+void RenderList::DrawBatches(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, GPUContext* context, bool useInstancing, int32 batchesStart, int32 batchesEnd, bool drawPreBatched, int32 instanceBufferOffset)
+{
+    const auto* drawCallsData = drawCalls.Get();
+    const auto* listData = list.Indices.Get();
+    const auto* batchesData = list.Batches.Get();
+    const int32 preBatchedCount = drawPreBatched ? list.PreBatchedDrawCalls.Count() : 0;
     // Execute draw calls
     MaterialBase::BindParameters bindParams(context, renderContext);
     bindParams.Input = input;
     bindParams.BindViewData();
     if (useInstancing)
     {
-        int32 instanceBufferOffset = 0;
         GPUBuffer* vb[4];
         uint32 vbOffsets[4];
-        for (int32 i = 0; i < list.Batches.Count(); i++)
+        for (int32 i = batchesStart; i < batchesEnd; i++)
         {
             auto& batch = batchesData[i];
             const DrawCall& drawCall = drawCallsData[listData[batch.StartIndex]];
@@ -786,7 +919,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 }
             }
         }
-        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+        for (int32 i = 0; i < preBatchedCount; i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
             auto& drawCall = batch.DrawCall;
@@ -804,24 +937,45 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 vbOffsets[vbCount] = 0;
             }
 
+            // Indirect draw with external instances buffer uses the instanced shader permutation (instances count is written by GPU)
+            const int32 instancesCount = batch.GetInstancesCount();
             bindParams.FirstDrawCall = &drawCall;
-            bindParams.DrawCallsCount = batch.Instances.Count();
+            bindParams.DrawCallsCount = drawCall.InstanceCount == 0 && batch.InstanceBuffer ? 2 : instancesCount;
             drawCall.Material->Bind(bindParams);
 
             context->BindIB(drawCall.Geometry.IndexBuffer);
 
             if (drawCall.InstanceCount == 0)
             {
-                ASSERT_LOW_LAYER(batch.Instances.Count() == 1);
+                if (batch.InstanceBuffer)
+                {
+                    vbCount = 3;
+                    vb[vbCount] = batch.InstanceBuffer;
+                    vbOffsets[vbCount] = 0;
+                    vbCount++;
+                }
+                else
+                {
+                    ASSERT_LOW_LAYER(instancesCount == 1);
+                }
                 context->BindVB(ToSpan(vb, vbCount), vbOffsets);
                 context->DrawIndexedInstancedIndirect(drawCall.Draw.IndirectArgsBuffer, drawCall.Draw.IndirectArgsOffset);
             }
             else
             {
-                if (batch.Instances.Count() == 1)
+                if (instancesCount == 1)
                 {
                     context->BindVB(ToSpan(vb, vbCount), vbOffsets);
-                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, batch.Instances.Count(), 0, 0, drawCall.Draw.StartIndex);
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, 1, 0, 0, drawCall.Draw.StartIndex);
+                }
+                else if (batch.InstanceBuffer)
+                {
+                    vbCount = 3;
+                    vb[vbCount] = batch.InstanceBuffer;
+                    vbOffsets[vbCount] = 0;
+                    vbCount++;
+                    context->BindVB(ToSpan(vb, vbCount), vbOffsets);
+                    context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, instancesCount, batch.InstanceBufferOffset, 0, drawCall.Draw.StartIndex);
                 }
                 else
                 {
@@ -839,7 +993,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
     else
     {
         bindParams.DrawCallsCount = 1;
-        for (int32 i = 0; i < list.Batches.Count(); i++)
+        for (int32 i = batchesStart; i < batchesEnd; i++)
         {
             auto& batch = batchesData[i];
 
@@ -862,15 +1016,18 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 }
             }
         }
-        for (int32 i = 0; i < list.PreBatchedDrawCalls.Count(); i++)
+        for (int32 i = 0; i < preBatchedCount; i++)
         {
             auto& batch = BatchedDrawCalls.Get()[list.PreBatchedDrawCalls.Get()[i]];
+            if (batch.DrawCall.InstanceCount == 0 && batch.InstanceBuffer)
+                continue; // Instances culled on GPU can be drawn only with instancing
             auto drawCall = batch.DrawCall;
             drawCall.ObjectRadius = 0.0f;
             bindParams.FirstDrawCall = &drawCall;
-            const auto* instancesData = batch.Instances.Get();
+            const auto* instancesData = batch.GetInstancesData();
+            const int32 instancesCount = batch.GetInstancesCount();
 
-            for (int32 j = 0; j < batch.Instances.Count(); j++)
+            for (int32 j = 0; j < instancesCount; j++)
             {
                 auto& instance = instancesData[j];
                 drawCall.ObjectPosition = instance.InstanceOrigin;
@@ -889,7 +1046,7 @@ void RenderList::ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsL
                 context->DrawIndexedInstanced(drawCall.Draw.IndicesCount, drawCall.InstanceCount, 0, 0, drawCall.Draw.StartIndex);
             }
         }
-        if (list.Batches.IsEmpty() && list.Indices.Count() != 0)
+        if (drawPreBatched && list.Batches.IsEmpty() && list.Indices.Count() != 0)
         {
             // Draw calls list has nto been batched so execute draw calls separately
             for (int32 j = 0; j < list.Indices.Count(); j++)
@@ -234,6 +234,36 @@ struct BatchedDrawCall
 {
     DrawCall DrawCall;
     Array<struct InstanceData, RendererAllocation> Instances;
+
+    /// <summary>
+    /// The external instances buffer (persistent, eg. cached by foliage). If set, it's used instead of Instances list.
+    /// </summary>
+    GPUBuffer* InstanceBuffer = nullptr;
+
+    /// <summary>
+    /// The CPU copy of the external instances buffer range (used when instancing is not supported).
+    /// </summary>
+    const struct InstanceData* InstanceBufferData = nullptr;
+
+    /// <summary>
+    /// The offset of the first instance in the external instances buffer.
+    /// </summary>
+    int32 InstanceBufferOffset = 0;
+
+    /// <summary>
+    /// The amount of instances to draw from the external instances buffer.
+    /// </summary>
+    int32 InstanceBufferCount = 0;
+
+    FORCE_INLINE int32 GetInstancesCount() const
+    {
+        return InstanceBuffer ? InstanceBufferCount : Instances.Count();
+    }
+
+    FORCE_INLINE const struct InstanceData* GetInstancesData() const
+    {
+        return InstanceBuffer ? InstanceBufferData : Instances.Get();
+    }
 };
 
 /// <summary>
@@ -315,6 +345,11 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// </summary>
     DrawCallsList ShadowDepthDrawCallsList;
 
+    /// <summary>
+    /// The additional draw calls list for Depth drawing into Shadow Projections (of the objects with static transform) that use DrawCalls from main render context. Separated from ShadowDepthDrawCallsList to allow caching static shadow maps.
+    /// </summary>
+    DrawCallsList ShadowDepthStaticDrawCallsList;
+
     /// <summary>
     /// Light pass members - directional lights
     /// </summary>
@@ -511,6 +546,18 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="sortOrder">Object sorting key.</param>
     void AddDrawCall(const RenderContextBatch& renderContextBatch, DrawPass drawModes, StaticFlags staticFlags, ShadowsCastingMode shadowsMode, const BoundingSphere& bounds, DrawCall& drawCall, bool receivesDecals = true, int16 sortOrder = 0);
 
+    /// <summary>
+    /// Copies the draw calls added via per-thread chunks into the buffers. Call it once all drawing jobs are done and before reading any draw calls.
+    /// </summary>
+    void FlushLocal();
+
+    /// <summary>
+    /// Copies the draw calls added via per-thread chunks into the buffers of all render lists in the batch. Call it once all drawing jobs are done and before reading any draw calls.
+    /// </summary>
+    /// <remarks>Shadow projections reference the draw calls of the main view so their lists are updated when main view draw calls get compacted.</remarks>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    static void FlushLocal(const RenderContextBatch& renderContextBatch);
+
     /// <summary>
     /// Sorts the collected draw calls list.
     /// </summary>
@@ -563,6 +610,18 @@ API_CLASS(Sealed) class FLAXENGINE_API RenderList : public ScriptingObject
     /// <param name="drawCalls">The collected draw calls list.</param>
     /// <param name="input">The input scene color. It's optional and used in forward/postFx rendering.</param>
     void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input);
+
+    /// <summary>
+    /// Executes the collected draw calls. Big lists are split into chunks recorded in parallel by the job system threads using the deferred GPU contexts (if enabled in the graphics settings and supported by the graphics backend).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="listType">The collected draw calls list type.</param>
+    /// <param name="setup">The callback used to setup the GPU context state before drawing (eg. render targets and viewport). Called for each deferred context and for the main context after executing the deferred ones.</param>
+    void ExecuteDrawCallsParallel(const RenderContext& renderContext, DrawCallsListType listType, const Function<void(GPUContext*)>& setup);
+
+private:
+    void ExecuteDrawCalls(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, const Function<void(GPUContext*)>* setup);
+    void DrawBatches(const RenderContext& renderContext, DrawCallsList& list, const RenderListBuffer<DrawCall>& drawCalls, GPUTextureView* input, GPUContext* context, bool useInstancing, int32 batchesStart, int32 batchesEnd, bool drawPreBatched, int32 instanceBufferOffset);
 };
 
 /// <summary>
@@ -6,10 +6,13 @@
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Core/Memory/Memory.h"
 #include "Engine/Core/Memory/Allocation.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Threading/ThreadLocal.h"
 
 /// <summary>
 /// Template for dynamic array with variable capacity that support concurrent elements appending (atomic add).
 /// </summary>
+/// <remarks>Use AddLocal to append items via per-thread chunks (single atomic per chunk instead of per item). Local items become visible after FlushLocal.</remarks>
 /// <typeparam name="T">The type of elements in the array.</typeparam>
 /// <typeparam name="AllocationType">The type of memory allocator.</typeparam>
 template<typename T, typename AllocationType = HeapAllocation>
@@ -20,13 +23,44 @@ class RenderListBuffer
     typedef T ItemType;
     typedef typename AllocationType::template Data<T> AllocationData;
 
+    /// <summary>
+    /// The amount of items reserved at once by the thread when adding items via AddLocal.
+    /// </summary>
+    static constexpr int32 LocalChunkSize = 32;
+
+    /// <summary>
+    /// The range of items moved by the local chunks compaction.
+    /// </summary>
+    struct CompactRange
+    {
+        // Index of the first moved item (before compaction).
+        int32 Start;
+        // The amount of slots the items got moved by (towards the buffer start).
+        int32 Shift;
+    };
+
+    /// <summary>
+    /// The indices remapping after the local chunks compaction (ranges sorted by the start index).
+    /// </summary>
+    typedef Array<CompactRange, InlinedAllocation<PLATFORM_THREADS_LIMIT>> CompactRemap;
+
 private:
+    struct LocalChunk
+    {
+        // Index of the first reserved item in the buffer (-1 if not reserved).
+        int32 Base;
+        int32 Count;
+        T Items[LocalChunkSize];
+    };
+
     volatile int64 _count;
     volatile int64 _capacity;
     volatile int64 _threadsAdding = 0;
     volatile int64 _threadsResizing = 0;
+    volatile int64 _localPending = 0;
     AllocationData _allocation;
     CriticalSection _locker;
+    ThreadLocal<LocalChunk*> _localChunks;
 
 public:
     /// <summary>
@@ -141,6 +175,10 @@ class RenderListBuffer
     ~RenderListBuffer()
     {
         Memory::DestructItems(_allocation.Get(), (int32)_count);
+        Array<LocalChunk*, InlinedAllocation<PLATFORM_THREADS_LIMIT>> chunks;
+        _localChunks.GetValues(chunks);
+        for (LocalChunk* chunk : chunks)
+            Allocator::Free(chunk);
     }
 
 public:
@@ -234,6 +272,18 @@ class RenderListBuffer
         _locker.Lock();
         Memory::DestructItems(_allocation.Get(), (int32)_count);
         _count = 0;
+        if (Platform::AtomicRead(&_localPending))
+        {
+            // Discard pending local items
+            Array<LocalChunk*, InlinedAllocation<PLATFORM_THREADS_LIMIT>> chunks;
+            _localChunks.GetValues(chunks);
+            for (LocalChunk* chunk : chunks)
+            {
+                if (chunk)
+                    chunk->Base = -1;
+            }
+            _localPending = 0;
+        }
         _locker.Unlock();
     }
 
@@ -320,13 +370,144 @@ class RenderListBuffer
         return index;
     }
 
+    /// <summary>
+    /// Adds the specified item to the collection via the calling thread local chunk. Only a single atomic operation per chunk of items is performed, the items are copied into the collection once the chunk gets full or on FlushLocal.
+    /// </summary>
+    /// <remarks>The item data is not accessible via returned index until FlushLocal is called (which can also change the index, see its remapping output).</remarks>
+    /// <param name="item">The item to add.</param>
+    /// <returns>Index of the added element.</returns>
+    int32 AddLocal(const T& item)
+    {
+        static_assert(TIsTriviallyCopyConstructible<T>::Value, "Local adding supports only trivially copyable types.");
+        LocalChunk*& chunk = _localChunks.Get();
+        if (!chunk)
+        {
+            chunk = (LocalChunk*)Allocator::Allocate(sizeof(LocalChunk));
+            chunk->Base = -1;
+        }
+        if (chunk->Base == -1)
+        {
+            // Reserve a range of items for this thread
+            chunk->Base = AddOne(LocalChunkSize);
+            chunk->Count = 0;
+            Platform::InterlockedDecrement(&_threadsAdding);
+            Platform::AtomicStore(&_localPending, 1);
+        }
+        const int32 index = chunk->Base + chunk->Count;
+        chunk->Items[chunk->Count++] = item;
+        if (chunk->Count == LocalChunkSize)
+        {
+            // Copy the full chunk into the collection (safe with the concurrent resizing)
+            for (;;)
+            {
+                Platform::InterlockedIncrement(&_threadsAdding);
+                if (!Platform::AtomicRead(&_threadsResizing))
+                    break;
+                Platform::InterlockedDecrement(&_threadsAdding);
+                while (Platform::AtomicRead(&_threadsResizing))
+                    Platform::Sleep(0);
+            }
+            Platform::MemoryCopy(_allocation.Get() + chunk->Base, chunk->Items, sizeof(T) * LocalChunkSize);
+            Platform::InterlockedDecrement(&_threadsAdding);
+            chunk->Base = -1;
+        }
+        return index;
+    }
+
+    /// <summary>
+    /// Copies the pending items added via AddLocal into the collection and removes the unused slots of the reserved chunks. Must not be called when other threads are adding items.
+    /// </summary>
+    /// <remarks>Removing the unused slots changes the indices of the items added after the first reserved chunk. Use the output remapping to update the indices referencing items in this collection.</remarks>
+    /// <param name="remap">The output indices remapping (optional). Empty if indices didn't change.</param>
+    void FlushLocal(CompactRemap* remap = nullptr)
+    {
+        if (remap)
+            remap->Clear();
+        if (!Platform::AtomicRead(&_localPending))
+            return;
+        _locker.Lock();
+        Array<LocalChunk*, InlinedAllocation<PLATFORM_THREADS_LIMIT>> chunks;
+        _localChunks.GetValues(chunks);
+        for (int32 i = chunks.Count() - 1; i >= 0; i--)
+        {
+            if (!chunks[i] || chunks[i]->Base == -1)
+                chunks.RemoveAtKeepOrder(i);
+        }
+        T* data = _allocation.Get();
+        for (LocalChunk* chunk : chunks)
+            Platform::MemoryCopy(data + chunk->Base, chunk->Items, sizeof(T) * chunk->Count);
+        if (chunks.HasItems())
+        {
+            // Sort chunks by location (insertion sort, there is up to a single chunk per thread)
+            for (int32 i = 1; i < chunks.Count(); i++)
+            {
+                LocalChunk* chunk = chunks[i];
+                int32 j = i - 1;
+                for (; j >= 0 && chunks[j]->Base > chunk->Base; j--)
+                    chunks[j + 1] = chunks[j];
+                chunks[j + 1] = chunk;
+            }
+
+            // Move items over the unused slots
+            const int32 count = (int32)_count;
+            int32 dst = chunks[0]->Base + chunks[0]->Count;
+            for (int32 i = 0; i < chunks.Count(); i++)
+            {
+                int32 src = chunks[i]->Base + LocalChunkSize;
+                const int32 srcEnd = i + 1 < chunks.Count() ? chunks[i + 1]->Base + chunks[i + 1]->Count : count;
+                if (remap && src < srcEnd)
+                    remap->Add({ src, src - dst });
+                for (; src < srcEnd; src++)
+                    data[dst++] = data[src];
+            }
+            _count = dst;
+        }
+        for (LocalChunk* chunk : chunks)
+            chunk->Base = -1;
+        _localPending = 0;
+        _locker.Unlock();
+    }
+
+    /// <summary>
+    /// Updates the indices of items after the local chunks compaction (see FlushLocal).
+    /// </summary>
+    /// <param name="remap">The indices remapping.</param>
+    /// <param name="indices">The indices to update (of the items in the compacted collection).</param>
+    /// <param name="count">The amount of indices.</param>
+    static void RemapIndices(const CompactRemap& remap, int32* indices, int32 count)
+    {
+        if (remap.IsEmpty())
+            return;
+        const CompactRange* ranges = remap.Get();
+        const int32 rangesCount = remap.Count();
+        const int32 start = ranges[0].Start;
+        for (int32 i = 0; i < count; i++)
+        {
+            const int32 index = indices[i];
+            if (index < start)
+                continue;
+
+            // Find the last range starting before the index (binary search)
+            int32 low = 0, high = rangesCount - 1;
+            while (low < high)
+            {
+                const int32 mid = (low + high + 1) / 2;
+                if (ranges[mid].Start <= index)
+                    low = mid;
+                else
+                    high = mid - 1;
+            }
+            indices[i] = index - ranges[low].Shift;
+        }
+    }
+
 private:
-    int32 AddOne()
+    int32 AddOne(int32 size = 1)
     {
         Platform::InterlockedIncrement(&_threadsAdding);
         int32 count = (int32)Platform::AtomicRead(&_count);
         int32 capacity = (int32)Platform::AtomicRead(&_capacity);
-        const int32 minCapacity = GetMinCapacity(count);
+        const int32 minCapacity = GetMinCapacity(count + size - 1);
         if (minCapacity > capacity || Platform::AtomicRead(&_threadsResizing)) // Resize if not enough space or someone else is already doing it (don't add mid-resizing)
         {
             // Move from adding to resizing
@@ -362,7 +543,14 @@ class RenderListBuffer
             // Let other thread enter resizing-area
             _locker.Unlock();
         }
-        return (int32)Platform::InterlockedIncrement(&_count) - 1;
+        if (size == 1)
+            return (int32)Platform::InterlockedIncrement(&_count) - 1;
+        int64 index;
+        do
+        {
+            index = Platform::AtomicRead(&_count);
+        } while (Platform::InterlockedCompareExchange(&_count, index + size, index) != index);
+        return (int32)index;
     }
 
     FORCE_INLINE static int32 GetMinCapacity(int32 count)
@@ -2,6 +2,7 @@
 
 #include "Renderer.h"
 #include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/RenderTargetPool.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/RenderTask.h"
@@ -21,6 +22,13 @@
 #include "MotionBlurPass.h"
 #include "VolumetricFogPass.h"
 #include "HistogramPass.h"
+#include "GPUDrivenRenderingPass.h"
+#include "FoliageCullingPass.h"
+#include "TerrainCullingPass.h"
+#include "ComputeSkinningPass.h"
+#include "ClothSimulationPass.h"
+#include "HZBPass.h"
+#include "VariableRateShadingPass.h"
 #include "AtmospherePreCompute.h"
 #include "GlobalSignDistanceFieldPass.h"
 #include "GI/GlobalSurfaceAtlasPass.h"
@@ -33,8 +41,10 @@
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/Level.h"
 #include "Engine/Level/Scene/SceneRendering.h"
+#include "Engine/Graphics/Models/MeshDeformation.h"
 #include "Engine/Core/Config/GraphicsSettings.h"
 #include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 #if USE_EDITOR
 #include "Editor/Editor.h"
 #include "Editor/QuadOverdrawPass.h"
@@ -53,7 +63,7 @@ class RendererService : public EngineService
 {
 public:
     RendererService()
-        : EngineService(TEXT("Renderer"), 20)
+        : EngineService(TEXT("Renderer"), 20, true)
     {
     }
 
@@ -87,6 +97,13 @@ bool RendererService::Init()
     PassList.Add(TAA::Instance());
     PassList.Add(SMAA::Instance());
     PassList.Add(HistogramPass::Instance());
+    PassList.Add(GPUDrivenRenderingPass::Instance());
+    PassList.Add(FoliageCullingPass::Instance());
+    PassList.Add(TerrainCullingPass::Instance());
+    PassList.Add(ComputeSkinningPass::Instance());
+    PassList.Add(ClothSimulationPass::Instance());
+    PassList.Add(HZBPass::Instance());
+    PassList.Add(VariableRateShadingPass::Instance());
     PassList.Add(GlobalSignDistanceFieldPass::Instance());
     PassList.Add(GlobalSurfaceAtlasPass::Instance());
     PassList.Add(DynamicDiffuseGlobalIlluminationPass::Instance());
@@ -166,6 +183,7 @@ bool Renderer::IsReady()
 void Renderer::Render(SceneRenderTask* task)
 {
     PROFILE_GPU_CPU_NAMED("Render Frame");
+    PROFILE_MEM(Rendering);
 
     // Prepare GPU context
     auto context = GPUDevice::Instance->GetMainContext();
@@ -219,6 +237,7 @@ void Renderer::Render(SceneRenderTask* task)
 
     // Copy back the view (modified during rendering with rendering state like TAA frame index and jitter)
     task->View = renderContext.View;
+    task->View.Occlusion = nullptr;
 
     // Cleanup
     for (const auto& e : renderContextBatch.Contexts)
@@ -285,6 +304,7 @@ void Renderer::DrawActors(RenderContext& renderContext, const Array<Actor*>& cus
     {
         // Draw scene actors
         RenderContextBatch renderContextBatch(renderContext);
+        MeshDeformation::BeginDeferred();
         JobSystem::SetJobStartingOnDispatch(false);
         Level::DrawActors(renderContextBatch, SceneRendering::DrawCategory::SceneDraw);
         Level::DrawActors(renderContextBatch, SceneRendering::DrawCategory::SceneDrawAsync);
@@ -292,7 +312,11 @@ void Renderer::DrawActors(RenderContext& renderContext, const Array<Actor*>& cus
         for (const int64 label : renderContextBatch.WaitLabels)
             JobSystem::Wait(label);
         renderContextBatch.WaitLabels.Clear();
+        MeshDeformation::EndDeferred();
     }
+
+    // Copy draw calls added via per-thread chunks
+    renderContext.List->FlushLocal();
 }
 
 void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderContextBatch& renderContextBatch)
@@ -370,6 +394,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     renderContext.View.Prepare(renderContext);
     renderContext.Buffers->Prepare();
     ShadowsPass::Instance()->Prepare();
+    ForwardPass::Instance()->Prepare();
 
     // Build batch of render contexts (main view and shadow projections)
     {
@@ -378,6 +403,7 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         view.Pass = DrawPass::GBuffer | DrawPass::Forward | DrawPass::Distortion;
         if (setup.UseMotionVectors)
             view.Pass |= DrawPass::MotionVectors;
+        view.Occlusion = HZBPass::Instance()->GetOcclusion(renderContext);
         renderContextBatch.GetMainContext() = renderContext; // Sync render context in batch with the current value
 
         bool drawShadows = !isGBufferDebug && EnumHasAnyFlags(view.Flags, ViewFlags::Shadows) && ShadowsPass::Instance()->IsReady();
@@ -397,8 +423,10 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #if USE_EDITOR
         GBufferPass::Instance()->PreOverrideDrawCalls(renderContext);
 #endif
+        renderContextBatch.EnableGPUDriven = GPUDrivenRenderingPass::Instance()->Setup(renderContextBatch);
 
         // Dispatch drawing (via JobSystem - multiple job batches for every scene)
+        MeshDeformation::BeginDeferred();
         JobSystem::SetJobStartingOnDispatch(false);
         task->OnCollectDrawCalls(renderContextBatch, SceneRendering::DrawCategory::SceneDraw);
         task->OnCollectDrawCalls(renderContextBatch, SceneRendering::DrawCategory::SceneDrawAsync);
@@ -408,6 +436,10 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
         for (const uint64 label : renderContextBatch.WaitLabels)
             JobSystem::Wait(label);
         renderContextBatch.WaitLabels.Clear();
+        RenderList::FlushLocal(renderContextBatch);
+
+        // Run mesh deformers queued during drawing (in parallel, before rendering)
+        MeshDeformation::EndDeferred();
 
 #if USE_EDITOR
         GBufferPass::Instance()->OverrideDrawCalls(renderContext);
@@ -428,9 +460,18 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
             auto& shadowContext = renderContextBatch.Contexts[i];
             shadowContext.List->SortDrawCalls(shadowContext, false, DrawCallsListType::Depth);
             shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls);
+            shadowContext.List->SortDrawCalls(shadowContext, false, shadowContext.List->ShadowDepthStaticDrawCallsList, renderContext.List->DrawCalls);
         }
     }
 
+    // Cull static instances, cached foliage and terrain chunks on GPU
+    if (renderContextBatch.EnableGPUDriven)
+    {
+        GPUDrivenRenderingPass::Instance()->Cull(renderContextBatch);
+        FoliageCullingPass::Instance()->Cull(renderContextBatch);
+        TerrainCullingPass::Instance()->Cull(renderContextBatch);
+    }
+
     // Get the light accumulation buffer
     auto outputFormat = renderContext.Buffers->GetOutputFormat();
     auto tempFlags = GPUTextureFlags::ShaderResource | GPUTextureFlags::RenderTarget;
@@ -454,15 +495,28 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
 #endif
 
     // Global SDF rendering (can be used by materials later on)
+    GPUContext* computeContext = nullptr;
     if (graphicsSettings->EnableGlobalSDF && EnumHasAnyFlags(view.Flags, ViewFlags::GlobalSDF))
     {
-        GlobalSignDistanceFieldPass::BindingData bindingData;
-        GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
+        if (Graphics::EnableAsyncCompute && renderContext.View.Mode != ViewMode::GlobalSDF)
+            computeContext = GPUDevice::Instance->GetComputeContext();
+        if (!computeContext)
+        {
+            GlobalSignDistanceFieldPass::BindingData bindingData;
+            GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
+        }
     }
 
     // Fill GBuffer
     GBufferPass::Instance()->Fill(renderContext, lightBuffer);
 
+    // Update Global SDF on async compute (overlaps with the following passes until the lighting)
+    if (computeContext)
+        GlobalSignDistanceFieldPass::Instance()->RenderAsync(renderContext, computeContext);
+
+    // Build hierarchical depth buffer for occlusion culling in the next frames
+    HZBPass::Instance()->Render(renderContext, context);
+
     // Debug drawing
     if (renderContext.View.Mode == ViewMode::GlobalSDF)
         GlobalSignDistanceFieldPass::Instance()->RenderDebug(renderContext, context, lightBuffer);
@@ -495,6 +549,13 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     // Render ambient occlusion
     AmbientOcclusionPass::Instance()->Render(renderContext);
 
+    // Wait for the async compute work
+    if (computeContext)
+    {
+        GlobalSignDistanceFieldPass::BindingData bindingData;
+        GlobalSignDistanceFieldPass::Instance()->Render(renderContext, context, bindingData);
+    }
+
     // Check if use custom view mode
     if (isGBufferDebug)
     {
@@ -584,6 +645,9 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     renderContext.List->RunMaterialPostFxPass(context, renderContext, MaterialPostFxLocation::AfterForwardPass, frameBuffer, lightBuffer);
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::AfterForwardPass, frameBuffer, lightBuffer);
 
+    // Generate shading rate image for the next frame
+    VariableRateShadingPass::Instance()->Render(renderContext, context, frameBuffer);
+
     // Cleanup
     context->ResetRenderTarget();
     context->ResetSR();
@@ -607,16 +671,35 @@ void RenderInner(SceneRenderTask* task, RenderContext& renderContext, RenderCont
     renderContext.List->RunCustomPostFxPass(context, renderContext, PostProcessEffectLocation::BeforePostProcessingPass, frameBuffer, tempBuffer);
 
     // Temporal Anti-Aliasing (goes before post processing)
+    bool useUpscaling = task->RenderingPercentage < 1.0f;
+    const Viewport outputViewport = task->GetOutputViewport();
     if (aaMode == AntialiasingMode::TemporalAntialiasing)
     {
-        TAA::Instance()->Render(renderContext, frameBuffer, tempBuffer->View());
-        Swap(frameBuffer, tempBuffer);
+        if (useUpscaling && setup.UpscaleLocation == RenderingUpscaleLocation::TemporalAntiAliasingPass)
+        {
+            // Temporal upscaling to the output resolution
+            useUpscaling = false;
+            RenderTargetPool::Release(tempBuffer);
+            tempDesc.Width = (int32)outputViewport.Width;
+            tempDesc.Height = (int32)outputViewport.Height;
+            tempBuffer = RenderTargetPool::Get(tempDesc);
+            RENDER_TARGET_POOL_SET_NAME(tempBuffer, "TempBuffer");
+            context->ResetSR();
+            TAA::Instance()->Upscale(renderContext, frameBuffer, tempBuffer);
+            Swap(frameBuffer, tempBuffer);
+            RenderTargetPool::Release(tempBuffer);
+            tempBuffer = RenderTargetPool::Get(tempDesc);
+            RENDER_TARGET_POOL_SET_NAME(tempBuffer, "TempBuffer");
+        }
+        else
+        {
+            TAA::Instance()->Render(renderContext, frameBuffer, tempBuffer->View());
+            Swap(frameBuffer, tempBuffer);
+        }
     }
 
     // Upscaling after scene rendering but before post processing
-    bool useUpscaling = task->RenderingPercentage < 1.0f;
-    const Viewport outputViewport = task->GetOutputViewport();
-    if (useUpscaling && setup.UpscaleLocation == RenderingUpscaleLocation::BeforePostProcessingPass)
+    if (useUpscaling && setup.UpscaleLocation != RenderingUpscaleLocation::AfterAntiAliasingPass)
     {
         useUpscaling = false;
         RenderTargetPool::Release(tempBuffer);
@@ -3,11 +3,15 @@
 #include "ShadowsPass.h"
 #include "GBufferPass.h"
 #include "VolumetricFogPass.h"
+#include "GPUDrivenRenderingPass.h"
 #include "Engine/Graphics/Graphics.h"
 #include "Engine/Graphics/GPUContext.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/RenderBuffers.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderTools.h"
+#include "Engine/Engine/Engine.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Scripting/Enums.h"
 #if USE_EDITOR
@@ -17,6 +21,8 @@
 #define NormalOffsetScaleTweak 100.0f
 #define SpotLight_NearPlane 10.0f
 #define PointLight_NearPlane 10.0f
+#define StaticShadowMap_MinResolution 128
+#define StaticShadowMap_MaxUnusedFrames 60
 
 PACK_STRUCT(struct Data{
     GBufferData GBuffer;
@@ -29,6 +35,53 @@ PACK_STRUCT(struct Data{
     float ContactShadowsLength;
     });
 
+namespace
+{
+    uint32 GetShadowCasterHash(const DrawCall& drawCall)
+    {
+        uint32 hash = GetHash(drawCall.Material);
+        CombineHash(hash, drawCall.Geometry.IndexBuffer);
+        CombineHash(hash, drawCall.Geometry.VertexBuffers[0]);
+        CombineHash(hash, (uint32)drawCall.InstanceCount);
+        CombineHash(hash, (uint32)drawCall.Draw.StartIndex);
+        CombineHash(hash, (uint32)drawCall.Draw.IndicesCount);
+        const uint32* world = (const uint32*)&drawCall.World;
+        for (int32 i = 0; i < 16; i++)
+            CombineHash(hash, world[i]);
+        return hash;
+    }
+}
+
+class ShadowsCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    struct Cascade
+    {
+        bool Valid = false;
+        float Radius;
+        Float3 Center;
+        Matrix ShadowVP;
+    };
+
+    GPUTexture* ShadowMapCSM = nullptr;
+    Guid LightID;
+    Float3 LightDirection;
+    Vector3 Origin;
+    int32 CascadesCount = 0;
+    Cascade Cascades[MAX_CSM_CASCADES];
+
+    ~ShadowsCustomBuffer()
+    {
+        SAFE_DELETE_GPU_RESOURCE(ShadowMapCSM);
+    }
+
+    void Reset()
+    {
+        for (auto& e : Cascades)
+            e.Valid = false;
+    }
+};
+
 ShadowsPass::ShadowsPass()
     : _shader(nullptr)
     , _shadowMapsSizeCSM(0)
@@ -49,6 +102,8 @@ uint64 ShadowsPass::GetShadowMapsMemoryUsage() const
         result += _shadowMapCSM->GetMemoryUsage();
     if (_shadowMapCube)
         result += _shadowMapCube->GetMemoryUsage();
+    for (const auto& e : _cachedShadowMaps)
+        result += e.Value->ShadowMap->GetMemoryUsage();
 
     return result;
 }
@@ -197,6 +252,144 @@ void ShadowsPass::updateShadowMapSize()
     }
 }
 
+void ShadowsPass::releaseCachedShadowMaps()
+{
+    for (auto& e : _cachedShadowMaps)
+    {
+        SAFE_DELETE_GPU_RESOURCE(e.Value->ShadowMap);
+        Delete(e.Value);
+    }
+    _cachedShadowMaps.Clear();
+}
+
+ShadowsPass::CachedShadowMap* ShadowsPass::GetCachedShadowMap(const RenderContext& renderContext, const Guid& lightId, StaticFlags lightFlags, const Float3& lightPosition, float lightRadius, bool isCube, int32& resolution)
+{
+    resolution = _shadowMapsSizeCube;
+
+    // Cache shadow maps only for the static lights (offline passes are rendered once anyway)
+    const auto& view = renderContext.View;
+    if ((lightFlags & StaticFlags::Transform) == StaticFlags::None || view.IsOfflinePass || !lightId.IsValid())
+        return nullptr;
+
+    // Scale the shadow map resolution with the light size on the screen
+    const float screenRadius = Math::Sqrt(RenderTools::ComputeBoundsScreenRadiusSquared(lightPosition, lightRadius, view));
+    const int32 minResolution = Math::Min(StaticShadowMap_MinResolution, _shadowMapsSizeCube);
+    resolution = Math::Clamp(Math::RoundUpToPowerOf2((int32)((float)_shadowMapsSizeCube * Math::Saturate(screenRadius * 2.0f))), minResolution, _shadowMapsSizeCube);
+
+    // Get the cached shadow map for this light
+    CachedShadowMap* cache;
+    if (!_cachedShadowMaps.TryGet(lightId, cache))
+    {
+        cache = New<CachedShadowMap>();
+        cache->ShadowMap = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map Cached"));
+        cache->StaticHash = 0;
+        _cachedShadowMaps.Add(lightId, cache);
+    }
+    cache->LastFrameUsed = Engine::FrameCount;
+
+    // Resize the shadow map (cached shadows will be redrawn)
+    const GPUTexture* shadowMap = cache->ShadowMap;
+    if (!shadowMap->IsAllocated() || shadowMap->Width() != resolution || shadowMap->IsCubeMap() != isCube)
+    {
+        const auto flags = GPUTextureFlags::ShaderResource | GPUTextureFlags::DepthStencil;
+        const auto desc = isCube ? GPUTextureDescription::NewCube(resolution, _shadowMapFormat, flags) : GPUTextureDescription::New2D(resolution, resolution, _shadowMapFormat, flags);
+        cache->StaticHash = 0;
+        if (cache->ShadowMap->Init(desc))
+        {
+            LOG(Error, "Cannot setup shadow map '{0}' Size: {1}, format: {2}.", TEXT("Cached"), resolution, ScriptingEnum::ToString(_shadowMapFormat));
+            resolution = _shadowMapsSizeCube;
+            return nullptr;
+        }
+    }
+
+    return cache;
+}
+
+GPUTexture* ShadowsPass::RenderShadowMap(GPUContext* context, RenderContextBatch& renderContextBatch, const ShadowData& shadowData, GPUTexture*& tempShadowMap)
+{
+    RenderContext& renderContext = renderContextBatch.GetMainContext();
+    const auto& drawCalls = renderContext.List->DrawCalls;
+    CachedShadowMap* cache = shadowData.Cache;
+    tempShadowMap = nullptr;
+    const float resolution = (float)shadowData.Resolution;
+    context->SetViewportAndScissors(resolution, resolution);
+
+    if (!cache)
+    {
+        // Render all shadow casters
+        for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+        {
+            auto rt = _shadowMapCube->View(faceIndex);
+            context->ResetSR();
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            context->ClearDepth(rt);
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+            shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, drawCalls, nullptr);
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthStaticDrawCallsList, drawCalls, nullptr);
+            GPUDrivenRenderingPass::Instance()->Draw(shadowContext, DrawCallsListType::Depth);
+        }
+        return _shadowMapCube;
+    }
+
+    // Calculate the hash of the light projection and the static shadow casters (order-independent because draw calls are sorted by the distance to the main view)
+    uint32 staticHash = GPUDrivenRenderingPass::Instance()->GetVersion();
+    CombineHash(staticHash, (uint32)shadowData.Resolution);
+    bool hasDynamic = false;
+    for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+    {
+        const uint32* shadowVP = (const uint32*)&shadowData.Constants.ShadowVP[faceIndex];
+        for (int32 i = 0; i < 16; i++)
+            CombineHash(staticHash, shadowVP[i]);
+        const auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+        const auto& staticList = shadowContext.List->ShadowDepthStaticDrawCallsList;
+        const int32* indices = staticList.Indices.Get();
+        uint32 castersHash = 0;
+        for (int32 i = 0; i < staticList.Indices.Count(); i++)
+            castersHash += GetShadowCasterHash(drawCalls.Get()[indices[i]]);
+        CombineHash(staticHash, castersHash);
+        CombineHash(staticHash, (uint32)staticList.Indices.Count());
+        hasDynamic |= !shadowContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].IsEmpty() || !shadowContext.List->ShadowDepthDrawCallsList.IsEmpty();
+    }
+    if (staticHash == 0)
+        staticHash = 1;
+
+    // Redraw static shadow casters only when something changed within the light volume
+    if (cache->StaticHash != staticHash)
+    {
+        PROFILE_GPU_CPU_NAMED("Static Shadow Map");
+        cache->StaticHash = staticHash;
+        for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+        {
+            auto rt = cache->ShadowMap->View(faceIndex);
+            context->ResetSR();
+            context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+            context->ClearDepth(rt);
+            auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+            shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthStaticDrawCallsList, drawCalls, nullptr);
+            GPUDrivenRenderingPass::Instance()->Draw(shadowContext, DrawCallsListType::Depth);
+        }
+    }
+    if (!hasDynamic)
+        return cache->ShadowMap;
+
+    // Draw dynamic shadow casters on top of the copy of the static shadow map
+    tempShadowMap = RenderTargetPool::Get(cache->ShadowMap->GetDescription());
+    RENDER_TARGET_POOL_SET_NAME(tempShadowMap, "ShadowMap.Dynamic");
+    context->ResetSR();
+    context->ResetRenderTarget();
+    context->CopyResource(tempShadowMap, cache->ShadowMap);
+    for (int32 faceIndex = 0; faceIndex < shadowData.ContextCount; faceIndex++)
+    {
+        auto rt = tempShadowMap->View(faceIndex);
+        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
+        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
+        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, drawCalls, nullptr);
+    }
+    return tempShadowMap;
+}
+
 void ShadowsPass::SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext)
 {
     const auto& view = renderContext.View;
@@ -214,6 +407,7 @@ void ShadowsPass::SetupRenderContext(RenderContext& renderContext, RenderContext
     shadowView.ModelLODDistanceFactor = view.ModelLODDistanceFactor;
     shadowView.Pass = DrawPass::Depth;
     shadowView.Origin = view.Origin;
+    shadowView.Occlusion = nullptr;
     shadowContext.List = RenderList::GetFromPool();
     shadowContext.Buffers = renderContext.Buffers;
     shadowContext.Task = renderContext.Task;
@@ -330,9 +524,43 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     light.ShadowDataIndex = _shadowData.Count();
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
-    shadowData.ContextCount = csmCount;
+    shadowData.ContextCount = 0;
     shadowData.BlendCSM = blendCSM;
-    renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
+    shadowData.Resolution = _shadowMapsSizeCSM;
+    shadowData.Cache = nullptr;
+    shadowData.ShadowMap = _shadowMapCSM;
+
+    // Use the cached far cascades (stored in the view buffers, only for the first directional light) that are updated at a staggered rate
+    ShadowsCustomBuffer* cache = nullptr;
+    if (Graphics::EnableCachedShadowCascades && light.ShadowDataIndex == 0 && csmCount > 2 && renderContext.Buffers && !view.IsOfflinePass)
+    {
+        cache = renderContext.Buffers->GetCustomBuffer<ShadowsCustomBuffer>(TEXT("Shadows"));
+        cache->LastFrameUsed = Engine::FrameCount;
+        if (!cache->ShadowMapCSM)
+            cache->ShadowMapCSM = GPUDevice::Instance->CreateTexture(TEXT("Shadow Map CSM Cached"));
+        if (cache->ShadowMapCSM->Width() != _shadowMapsSizeCSM)
+        {
+            cache->Reset();
+            if (cache->ShadowMapCSM->Init(_shadowMapCSM->GetDescription()))
+            {
+                LOG(Error, "Cannot setup shadow map '{0}' Size: {1}, format: {2}.", TEXT("CSM Cached"), _shadowMapsSizeCSM, ScriptingEnum::ToString(_shadowMapFormat));
+                cache = nullptr;
+            }
+        }
+    }
+    if (cache)
+    {
+        // Invalidate cached cascades when light or view changes
+        if (cache->LightID != light.ID || cache->CascadesCount != csmCount || cache->LightDirection != lightDirection || cache->Origin != view.Origin || (renderContext.Task && renderContext.Task->IsCameraCut))
+        {
+            cache->Reset();
+            cache->LightID = light.ID;
+            cache->CascadesCount = csmCount;
+            cache->LightDirection = lightDirection;
+            cache->Origin = view.Origin;
+        }
+        shadowData.ShadowMap = cache->ShadowMapCSM;
+    }
 
     // Create the different view and projection matrices for each split
     float splitMinRatio = 0;
@@ -366,6 +594,7 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
         Float3 cascadeMinBoundLS;
         Float3 cascadeMaxBoundLS;
         Float3 target;
+        float cascadeRadius;
         {
             // Make sure we are using the same direction when stabilizing
             BoundingSphere boundingVS;
@@ -374,6 +603,11 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
             // Compute bounding box center
             Float3::TransformCoordinate(boundingVS.Center, view.IV, target);
             float boundingVSRadius = (float)boundingVS.Radius;
+            cascadeRadius = boundingVSRadius;
+
+            // Extend the cached cascades bounds to be able to reuse them when view moves
+            if (cache && cascadeIndex >= 2)
+                boundingVSRadius *= 1.1f;
             cascadeMaxBoundLS = Float3(boundingVSRadius);
             cascadeMinBoundLS = -cascadeMaxBoundLS;
 
@@ -388,6 +622,21 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
             }
         }
 
+        // Reuse the cached cascade if it still covers the view (far cascades are updated at lower rate: third cascade every 2nd frame, fourth cascade every 4th frame)
+        if (cache && cascadeIndex >= 2)
+        {
+            auto& cascade = cache->Cascades[cascadeIndex];
+            const uint64 updateInterval = 1ull << (cascadeIndex - 1);
+            if (cascade.Valid && Engine::FrameCount % updateInterval != cascadeIndex % updateInterval && Float3::Distance(target, cascade.Center) + cascadeRadius <= cascade.Radius)
+            {
+                shadowData.Constants.ShadowVP[cascadeIndex] = cascade.ShadowVP;
+                continue;
+            }
+            cascade.Valid = true;
+            cascade.Center = target;
+            cascade.Radius = cascadeMaxBoundLS.X;
+        }
+
         const auto nearClip = 0.0f;
         const auto farClip = cascadeMaxBoundLS.Z - cascadeMinBoundLS.Z;
 
@@ -429,10 +678,13 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
             Matrix m;
             Matrix::Multiply(shadowVP, T, m);
             Matrix::Transpose(m, shadowData.Constants.ShadowVP[cascadeIndex]);
+            if (cache)
+                cache->Cascades[cascadeIndex].ShadowVP = shadowData.Constants.ShadowVP[cascadeIndex];
         }
 
         // Setup context for cascade
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + cascadeIndex];
+        shadowData.CascadeIndices[shadowData.ContextCount++] = cascadeIndex;
+        auto& shadowContext = renderContextBatch.Contexts.AddOne();
         SetupRenderContext(renderContext, shadowContext);
         shadowContext.List->Clear();
         shadowContext.View.Position = -lightDirection * shadowsDistance + view.Position;
@@ -460,10 +712,13 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
     shadowData.ContextCount = 6;
+    shadowData.BlendCSM = false;
+    shadowData.Cache = GetCachedShadowMap(renderContext, light.ID, light.StaticFlags, light.Position, light.Radius, true, shadowData.Resolution);
+    shadowData.ShadowMap = nullptr;
     renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
 
     const auto& view = renderContext.View;
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
+    const auto shadowMapsSizeCube = (float)shadowData.Resolution;
 
     // Fade shadow on distance
     const float fadeDistance = Math::Max(light.ShadowsFadeDistance, 0.1f);
@@ -500,10 +755,13 @@ void ShadowsPass::SetupLight(RenderContext& renderContext, RenderContextBatch& r
     auto& shadowData = _shadowData.AddOne();
     shadowData.ContextIndex = renderContextBatch.Contexts.Count();
     shadowData.ContextCount = 1;
+    shadowData.BlendCSM = false;
+    shadowData.Cache = GetCachedShadowMap(renderContext, light.ID, light.StaticFlags, light.Position, light.Radius, false, shadowData.Resolution);
+    shadowData.ShadowMap = nullptr;
     renderContextBatch.Contexts.AddDefault(shadowData.ContextCount);
 
     const auto& view = renderContext.View;
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
+    const auto shadowMapsSizeCube = (float)shadowData.Resolution;
 
     // Fade shadow on distance
     const float fadeDistance = Math::Max(light.ShadowsFadeDistance, 0.1f);
@@ -545,6 +803,7 @@ void ShadowsPass::Dispose()
     _sphereModel = nullptr;
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCSM);
     SAFE_DELETE_GPU_RESOURCE(_shadowMapCube);
+    releaseCachedShadowMaps();
 }
 
 void ShadowsPass::Prepare()
@@ -567,6 +826,17 @@ void ShadowsPass::SetupShadows(RenderContext& renderContext, RenderContextBatch&
     auto shadowsQuality = Graphics::ShadowsQuality;
     maxShadowsQuality = Math::Clamp(Math::Min<int32>(static_cast<int32>(shadowsQuality), static_cast<int32>(view.MaxShadowsQuality)), 0, static_cast<int32>(Quality::MAX) - 1);
 
+    // Release cached shadow maps of the lights that are not used anymore
+    for (auto it = _cachedShadowMaps.Begin(); it.IsNotEnd(); ++it)
+    {
+        if (Engine::FrameCount - it->Value->LastFrameUsed > StaticShadowMap_MaxUnusedFrames)
+        {
+            SAFE_DELETE_GPU_RESOURCE(it->Value->ShadowMap);
+            Delete(it->Value);
+            _cachedShadowMaps.Remove(it);
+        }
+    }
+
     // Create shadow projections for lights
     for (auto& light : renderContext.List->DirectionalLights)
     {
@@ -629,21 +899,9 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 6 faces of the cube map
-    for (int32 faceIndex = 0; faceIndex < 6; faceIndex++)
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+    GPUTexture* tempShadowMap;
+    GPUTexture* shadowMap = RenderShadowMap(context, renderContextBatch, shadowData, tempShadowMap);
 
     // Restore GPU context
     context->ResetSR();
@@ -679,7 +937,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCube->ViewArray());
+    context->BindSR(5, shadowMap->ViewArray());
     context->SetRenderTarget(shadowMask);
     context->SetState(_psShadowPoint.Get(shadowQuality + (sperLight.ContactShadowsLength > ZeroTolerance ? 4 : 0)));
     _sphereModel->Render(context);
@@ -689,7 +947,8 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererP
     context->UnBindSR(5);
 
     // Render volumetric light with shadow
-    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, _shadowMapCube->ViewArray(), sperLight.LightShadow);
+    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, shadowMap->ViewArray(), sperLight.LightShadow);
+    RenderTargetPool::Release(tempShadowMap);
 }
 
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererSpotLightData& light, GPUTextureView* shadowMask)
@@ -707,21 +966,10 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     // TODO: here we can use lower shadows quality based on light distance to view (LOD switching) and per light setting for max quality
     int32 shadowQuality = maxShadowsQuality;
 
-    // Set up GPU context and render view
-    const auto shadowMapsSizeCube = (float)_shadowMapsSizeCube;
-    context->SetViewportAndScissors(shadowMapsSizeCube, shadowMapsSizeCube);
-
     // Render depth to all 1 face of the cube map
     constexpr int32 faceIndex = 0;
-    {
-        auto rt = _shadowMapCube->View(faceIndex);
-        context->ResetSR();
-        context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
-        context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + faceIndex];
-        shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
-        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
-    }
+    GPUTexture* tempShadowMap;
+    GPUTexture* shadowMap = RenderShadowMap(context, renderContextBatch, shadowData, tempShadowMap);
 
     // Restore GPU context
     context->ResetSR();
@@ -757,7 +1005,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCube->View(faceIndex));
+    context->BindSR(5, shadowMap->View(faceIndex));
     context->SetRenderTarget(shadowMask);
     context->SetState(_psShadowSpot.Get(shadowQuality + (sperLight.ContactShadowsLength > ZeroTolerance ? 4 : 0)));
     _sphereModel->Render(context);
@@ -767,7 +1015,8 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererS
     context->UnBindSR(5);
 
     // Render volumetric light with shadow
-    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, _shadowMapCube->View(faceIndex), sperLight.LightShadow);
+    VolumetricFogPass::Instance()->RenderLight(renderContext, context, light, shadowMap->View(faceIndex), sperLight.LightShadow);
+    RenderTargetPool::Release(tempShadowMap);
 }
 
 void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererDirectionalLightData& light, int32 index, GPUTextureView* shadowMask)
@@ -778,19 +1027,22 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     GPUContext* context = GPUDevice::Instance->GetMainContext();
     RenderContext& renderContext = renderContextBatch.GetMainContext();
     ShadowData& shadowData = _shadowData[light.ShadowDataIndex];
+    GPUTexture* shadowMap = shadowData.ShadowMap;
     const float shadowMapsSizeCSM = (float)_shadowMapsSizeCSM;
     context->SetViewportAndScissors(shadowMapsSizeCSM, shadowMapsSizeCSM);
 
-    // Render shadow map for each projection
-    for (int32 cascadeIndex = 0; cascadeIndex < shadowData.ContextCount; cascadeIndex++)
+    // Render shadow map for each projection (cached cascades are skipped)
+    for (int32 i = 0; i < shadowData.ContextCount; i++)
     {
-        const auto rt = _shadowMapCSM->View(cascadeIndex);
+        const auto rt = shadowMap->View(shadowData.CascadeIndices[i]);
         context->ResetSR();
         context->SetRenderTarget(rt, static_cast<GPUTextureView*>(nullptr));
         context->ClearDepth(rt);
-        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + cascadeIndex];
+        auto& shadowContext = renderContextBatch.Contexts[shadowData.ContextIndex + i];
         shadowContext.List->ExecuteDrawCalls(shadowContext, DrawCallsListType::Depth);
         shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        shadowContext.List->ExecuteDrawCalls(shadowContext, shadowContext.List->ShadowDepthStaticDrawCallsList, renderContext.List->DrawCalls, nullptr);
+        GPUDrivenRenderingPass::Instance()->Draw(shadowContext, DrawCallsListType::Depth);
     }
 
     // Restore GPU context
@@ -820,7 +1072,7 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
     context->UpdateCB(shader->GetCB(0), &sperLight);
     context->BindCB(0, shader->GetCB(0));
     context->BindCB(1, shader->GetCB(1));
-    context->BindSR(5, _shadowMapCSM->ViewArray());
+    context->BindSR(5, shadowMap->ViewArray());
     context->SetRenderTarget(shadowMask);
     context->SetState(_psShadowDir.Get(maxShadowsQuality + static_cast<int32>(Quality::MAX) * shadowData.BlendCSM + (sperLight.ContactShadowsLength > ZeroTolerance ? 8 : 0)));
     context->DrawFullscreenTriangle();
@@ -831,6 +1083,6 @@ void ShadowsPass::RenderShadow(RenderContextBatch& renderContextBatch, RendererD
 
     // Cache params for the volumetric fog or other effects that use dir light shadow sampling
     LastDirLightIndex = index;
-    LastDirLightShadowMap = _shadowMapCSM->ViewArray();
+    LastDirLightShadowMap = shadowMap->ViewArray();
     LastDirLight = sperLight.LightShadow;
 }
@@ -8,6 +8,7 @@
 #include "Engine/Content/Assets/Shader.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Core/Collections/Dictionary.h"
 
 /// <summary>
 /// Pixel format for fullscreen render target used for shadows calculations
@@ -42,11 +43,23 @@ class ShadowsPass : public RendererPass<ShadowsPass>
 {
 private:
 
+    // Cached shadow map of the static light with static geometry only (dynamic casters are drawn on top of a copy).
+    struct CachedShadowMap
+    {
+        GPUTexture* ShadowMap;
+        uint32 StaticHash;
+        uint64 LastFrameUsed;
+    };
+
     struct ShadowData
     {
         int32 ContextIndex;
         int32 ContextCount;
         bool BlendCSM;
+        int32 Resolution;
+        CachedShadowMap* Cache;
+        GPUTexture* ShadowMap;
+        int32 CascadeIndices[MAX_CSM_CASCADES];
         LightShadowData Constants;
     };
 
@@ -63,6 +76,7 @@ class ShadowsPass : public RendererPass<ShadowsPass>
     GPUTexture* _shadowMapCSM;
     GPUTexture* _shadowMapCube;
     Quality _currentShadowMapsQuality;
+    Dictionary<Guid, CachedShadowMap*> _cachedShadowMaps;
 
     // Shadow map rendering stuff
     AssetReference<Model> _sphereModel;
@@ -153,6 +167,9 @@ class ShadowsPass : public RendererPass<ShadowsPass>
 private:
 
     void updateShadowMapSize();
+    void releaseCachedShadowMaps();
+    CachedShadowMap* GetCachedShadowMap(const RenderContext& renderContext, const Guid& lightId, StaticFlags lightFlags, const Float3& lightPosition, float lightRadius, bool isCube, int32& resolution);
+    GPUTexture* RenderShadowMap(GPUContext* context, RenderContextBatch& renderContextBatch, const ShadowData& shadowData, GPUTexture*& tempShadowMap);
     void SetupRenderContext(RenderContext& renderContext, RenderContext& shadowContext);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererDirectionalLightData& light);
     void SetupLight(RenderContext& renderContext, RenderContextBatch& renderContextBatch, RendererPointLightData& light);
@@ -0,0 +1,241 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "TerrainCullingPass.h"
+#include "RenderList.h"
+#include "HZBPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Content/Assets/Shader.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Terrain/Terrain.h"
+
+// Those defines must match the HLSL
+#define TERRAIN_CULLING_THREAD_GROUP_SIZE 64
+#define TERRAIN_CULLING_GROUPS_PER_ROW 1024
+
+static_assert(TERRAIN_CULLING_SLOTS_PER_DRAW == Terrain::ChunksCount, "Terrain culling has to reserve an instance slot for every chunk of the patch.");
+
+namespace
+{
+    bool EnsureBuffer(GPUBuffer* buffer, const GPUBufferDescription& desc)
+    {
+        if (buffer->GetSize() >= desc.Size)
+            return false;
+        return buffer->Init(desc);
+    }
+
+    void Dispatch(GPUContext* context, GPUShaderProgramCS* shader, int32 threadsCount)
+    {
+        // Split groups into rows to not exceed the limit of the thread groups per dimension
+        const int32 groupsCount = Math::DivideAndRoundUp(threadsCount, TERRAIN_CULLING_THREAD_GROUP_SIZE);
+        const int32 groupsX = Math::Min(groupsCount, TERRAIN_CULLING_GROUPS_PER_ROW);
+        const int32 groupsY = Math::DivideAndRoundUp(groupsCount, TERRAIN_CULLING_GROUPS_PER_ROW);
+        context->Dispatch(shader, groupsX, groupsY, 1);
+    }
+}
+
+String TerrainCullingPass::ToString() const
+{
+    return TEXT("TerrainCullingPass");
+}
+
+bool TerrainCullingPass::Init()
+{
+    // Draw indirect and compute shaders support is required for this implementation
+    const auto& limits = GPUDevice::Instance->Limits;
+    _isSupported = limits.HasCompute && limits.HasDrawIndirect;
+    if (!_isSupported)
+        return false;
+
+    // Create buffers (pointers are used by the draw calls before culling so buffers are resized in-place)
+    _argsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.Args"));
+    _patchesBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.Patches"));
+    _lodsBuffer = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.LODs"));
+    _instancesUAV = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.OutputInstances"));
+    _instances = GPUDevice::Instance->CreateBuffer(TEXT("TerrainCulling.InstancesVB"));
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/TerrainCulling"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<TerrainCullingPass, &TerrainCullingPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+void TerrainCullingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _requests.Resize(0);
+    _patches.Resize(0);
+    _args.Resize(0);
+    _lodsCount = 0;
+    SAFE_DELETE_GPU_RESOURCE(_argsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_patchesBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_lodsBuffer);
+    SAFE_DELETE_GPU_RESOURCE(_instancesUAV);
+    SAFE_DELETE_GPU_RESOURCE(_instances);
+    _shader = nullptr;
+}
+
+bool TerrainCullingPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(Data))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, Data);
+        return true;
+    }
+
+    // Cache compute shaders
+    _csLOD = shader->GetCS("CS_LOD");
+    _csCull = shader->GetCS("CS_Cull");
+
+    return false;
+}
+
+bool TerrainCullingPass::CanUse(const RenderContextBatch& renderContextBatch) const
+{
+    return renderContextBatch.EnableGPUDriven && _isSupported && _shader && _shader->IsLoaded();
+}
+
+int32 TerrainCullingPass::AddCull(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext, GPUBuffer* chunks, int32 chunksCount, const Vector3& origin, const TerrainCullingPatch* patches, int32 patchesCount, const GPUDrawIndexedIndirectArgs* draws, int32 drawsCount, float chunkEdgeSize, float lodDistribution, int32 lodBias, int32 forcedLod)
+{
+    if (!chunks || chunksCount == 0 || drawsCount == 0)
+        return -1;
+    const RenderView& view = renderContext.View;
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+
+    // Setup constants (positions are relative to the chunks data origin)
+    Request request;
+    request.Chunks = chunks;
+    request.HZB = nullptr;
+    Data& data = request.Constants;
+    Platform::MemoryClear(&data, sizeof(data));
+    for (int32 i = 0; i < 6; i++)
+    {
+        const Plane plane = view.CullingFrustum.GetPlane(i);
+        data.FrustumPlanes[i] = Float4(plane.Normal, (float)(plane.D + Vector3::Dot(plane.Normal, origin - view.Origin)));
+    }
+    data.LODViewPosition = Float3(lodView.Origin - origin) + lodView.Position;
+    data.ChunkEdgeSizeInv = 1.0f / chunkEdgeSize;
+    data.LODDistribution = lodDistribution;
+    data.LODBias = lodBias;
+    data.ForcedLOD = forcedLod;
+    data.ChunksCount = chunksCount;
+    data.CullingDisabled = view.IsCullingDisabled ? 1 : 0;
+
+    // Occlusion culling against the HZB from the previous frame (main view only)
+    if (&renderContext == &renderContextBatch.GetMainContext())
+    {
+        Matrix hzbViewProjection;
+        Vector3 hzbOrigin;
+        request.HZB = HZBPass::Instance()->GetHZB(renderContext, hzbViewProjection, hzbOrigin);
+        if (request.HZB)
+        {
+            Matrix::Transpose(hzbViewProjection, data.HZBViewProjection);
+            data.HZBOrigin = Float3(hzbOrigin - origin);
+            data.HZBSize = Float2((float)request.HZB->Width(), (float)request.HZB->Height());
+            data.HZBMipLevels = request.HZB->MipLevels();
+        }
+    }
+
+    // Allocate ranges in the shared buffers
+    ScopeLock lock(_locker);
+    const int32 drawsStart = _args.Count();
+    data.PatchesStart = _patches.Count();
+    data.LODsOffset = _lodsCount;
+    data.DrawsStart = drawsStart;
+    _lodsCount += chunksCount;
+    _patches.Add(patches, patchesCount);
+    _args.Add(draws, drawsCount);
+    for (int32 i = drawsStart; i < _args.Count(); i++)
+    {
+        auto& args = _args.Get()[i];
+        args.InstanceCount = 0;
+        args.StartInstance = i * TERRAIN_CULLING_SLOTS_PER_DRAW;
+    }
+    _requests.Add(request);
+    return drawsStart;
+}
+
+void TerrainCullingPass::Cull(RenderContextBatch& renderContextBatch)
+{
+    if (_requests.IsEmpty())
+        return;
+    auto context = GPUDevice::Instance->GetMainContext();
+    PROFILE_GPU_CPU("Terrain Culling");
+
+    // Prepare buffers
+    const int32 drawsCount = _args.Count();
+    const uint32 argsSize = drawsCount * sizeof(GPUDrawIndexedIndirectArgs);
+    const uint32 instancesCapacity = Math::RoundUpToPowerOf2(drawsCount) * TERRAIN_CULLING_SLOTS_PER_DRAW;
+    if (EnsureBuffer(_argsBuffer, GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(drawsCount) * sizeof(GPUDrawIndexedIndirectArgs), GPUBufferFlags::Argument | GPUBufferFlags::UnorderedAccess)))
+    {
+        LOG(Error, "Failed to create terrain culling buffers.");
+        _requests.Clear();
+        _patches.Clear();
+        _args.Clear();
+        _lodsCount = 0;
+        return;
+    }
+    if (checkIfSkipPass() ||
+        EnsureBuffer(_patchesBuffer, GPUBufferDescription::Structured(Math::RoundUpToPowerOf2(_patches.Count()), sizeof(TerrainCullingPatch))) ||
+        EnsureBuffer(_lodsBuffer, GPUBufferDescription::Raw(Math::RoundUpToPowerOf2(_lodsCount) * sizeof(uint32), GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_instancesUAV, GPUBufferDescription::Raw(instancesCapacity * sizeof(TerrainCullingInstance), GPUBufferFlags::UnorderedAccess)) ||
+        EnsureBuffer(_instances, GPUBufferDescription::Vertex(sizeof(TerrainCullingInstance), instancesCapacity)))
+    {
+        // Skip drawing of all chunks (draw calls are already added and have zero instances count)
+        context->UpdateBuffer(_argsBuffer, _args.Get(), argsSize);
+        _requests.Clear();
+        _patches.Clear();
+        _args.Clear();
+        _lodsCount = 0;
+        return;
+    }
+
+    // Upload the draw arguments (with zero instances) and the patches
+    context->UpdateBuffer(_argsBuffer, _args.Get(), argsSize);
+    context->UpdateBuffer(_patchesBuffer, _patches.Get(), _patches.Count() * sizeof(TerrainCullingPatch));
+
+    // Select chunks LODs, then cull chunks and write visible instances (per request)
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->BindCB(0, cb);
+    context->BindSR(1, _patchesBuffer->View());
+    context->BindUA(0, _argsBuffer->View());
+    context->BindUA(1, _lodsBuffer->View());
+    context->BindUA(2, _instancesUAV->View());
+    for (const Request& request : _requests)
+    {
+        context->UpdateCB(cb, &request.Constants);
+        context->BindSR(0, request.Chunks->View());
+        context->BindSR(2, request.HZB);
+        Dispatch(context, _csLOD, request.Constants.ChunksCount);
+        Dispatch(context, _csCull, request.Constants.ChunksCount);
+    }
+
+    // Copy instances into the vertex buffer used for drawing
+    context->ResetUA();
+    context->ResetSR();
+    context->ResetCB();
+    context->CopyBuffer(_instances, _instancesUAV, drawsCount * TERRAIN_CULLING_SLOTS_PER_DRAW * sizeof(TerrainCullingInstance));
+
+    _requests.Clear();
+    _patches.Clear();
+    _args.Clear();
+    _lodsCount = 0;
+}
@@ -0,0 +1,171 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Platform/CriticalSection.h"
+
+struct RenderContextBatch;
+
+// The amount of instance slots reserved per terrain draw (terrain patch LOD). Matches the amount of chunks in a patch.
+#define TERRAIN_CULLING_SLOTS_PER_DRAW 16
+
+/// <summary>
+/// The terrain chunk data used by the GPU culling (positions are relative to the data origin).
+/// </summary>
+PACK_STRUCT(struct TerrainCullingChunk {
+    Float3 BoundsMin;
+    uint32 PatchIndex;
+    Float3 BoundsMax;
+    uint32 Dummy0;
+    Float3 SphereCenter;
+    uint32 Dummy1;
+    int32 Neighbors[4]; // Global indices of the neighbor chunks (bottom, left, right, top), the chunk index if has no neighbor
+    Float4 HeightmapUVScaleBias;
+    Float2 OffsetUV;
+    Float2 LocalOffset;
+    });
+
+/// <summary>
+/// The terrain patch data used by the GPU culling (per view).
+/// </summary>
+PACK_STRUCT(struct TerrainCullingPatch {
+    uint32 MinLOD; // The lowest LOD that can be used (based on the streamed heightmap mips)
+    uint32 MaxLOD; // The highest LOD that can be used
+    uint32 DrawsStart; // The index of the first patch draw within the request or -1 if patch is not drawn
+    uint32 DrawsMinLOD; // The LOD of the first patch draw (patch has one draw per LOD in range DrawsMinLOD-DrawsMaxLOD)
+    uint32 DrawsMaxLOD;
+    uint32 Dummy0;
+    uint32 Dummy1;
+    uint32 Dummy2;
+    });
+
+/// <summary>
+/// The visible terrain chunk instance data (written by GPU culling, read by the terrain material vertex shader).
+/// </summary>
+PACK_STRUCT(struct TerrainCullingInstance {
+    Float4 HeightmapUVScaleBias;
+    Float4 NeighborLOD;
+    Float2 OffsetUV;
+    Float2 LocalOffset;
+    });
+
+/// <summary>
+/// GPU culling pass for the terrain. Selects the chunks LOD (for all chunks of the terrain, to morph seamlessly between the neighbors), culls the chunks of the visible patches (frustum, occlusion) and writes their instance data with compute shaders. Every terrain patch is drawn with a single indirect instanced draw per LOD.
+/// </summary>
+class TerrainCullingPass : public RendererPass<TerrainCullingPass>
+{
+private:
+    PACK_STRUCT(struct Data {
+        Float4 FrustumPlanes[6];
+        Float3 LODViewPosition;
+        float ChunkEdgeSizeInv;
+        float LODDistribution;
+        int32 LODBias;
+        int32 ForcedLOD;
+        uint32 ChunksCount;
+        uint32 LODsOffset;
+        uint32 DrawsStart;
+        uint32 CullingDisabled;
+        uint32 PatchesStart;
+        Float2 HZBSize;
+        uint32 HZBMipLevels;
+        float Dummy1;
+        Matrix HZBViewProjection;
+        Float3 HZBOrigin;
+        float Dummy2;
+        });
+
+    struct Request
+    {
+        GPUBuffer* Chunks;
+        GPUTexture* HZB;
+        Data Constants;
+    };
+
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csLOD = nullptr;
+    GPUShaderProgramCS* _csCull = nullptr;
+    bool _isSupported = false;
+    CriticalSection _locker;
+    Array<Request> _requests;
+    Array<TerrainCullingPatch> _patches;
+    Array<GPUDrawIndexedIndirectArgs> _args;
+    int32 _lodsCount = 0;
+    GPUBuffer* _argsBuffer = nullptr;
+    GPUBuffer* _patchesBuffer = nullptr;
+    GPUBuffer* _lodsBuffer = nullptr;
+    GPUBuffer* _instancesUAV = nullptr;
+    GPUBuffer* _instances = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the GPU culling can be used for the given render views batch.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <returns>True if can add cull requests for this batch, otherwise false.</returns>
+    bool CanUse(const RenderContextBatch& renderContextBatch) const;
+
+    /// <summary>
+    /// Adds the terrain chunks to be culled for the given view. Safe to call from the drawing jobs.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    /// <param name="renderContext">The rendering context (view to cull for).</param>
+    /// <param name="chunks">The terrain chunks buffer (structured buffer with TerrainCullingChunk elements).</param>
+    /// <param name="chunksCount">The terrain chunks count.</param>
+    /// <param name="origin">The origin of the chunks data positions.</param>
+    /// <param name="patches">The terrain patches data (for this view).</param>
+    /// <param name="patchesCount">The terrain patches count.</param>
+    /// <param name="draws">The indirect draw arguments of the patches draws (instance count and offset are written by the culling).</param>
+    /// <param name="drawsCount">The patches draws count.</param>
+    /// <param name="chunkEdgeSize">The size of the chunk edge (in world units) used for the LOD selection.</param>
+    /// <param name="lodDistribution">The LOD distribution factor.</param>
+    /// <param name="lodBias">The LOD bias.</param>
+    /// <param name="forcedLod">The forced LOD or -1 if unused.</param>
+    /// <returns>The index of the first draw indirect arguments in the arguments buffer (see GetArgsBuffer), or -1 if failed.</returns>
+    int32 AddCull(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext, GPUBuffer* chunks, int32 chunksCount, const Vector3& origin, const TerrainCullingPatch* patches, int32 patchesCount, const GPUDrawIndexedIndirectArgs* draws, int32 drawsCount, float chunkEdgeSize, float lodDistribution, int32 lodBias, int32 forcedLod);
+
+    /// <summary>
+    /// Performs the GPU culling for all requests added for this batch. Called after collecting draw calls.
+    /// </summary>
+    /// <param name="renderContextBatch">The rendering context batch.</param>
+    void Cull(RenderContextBatch& renderContextBatch);
+
+    /// <summary>
+    /// Gets the indirect draw arguments buffer (written by GPU culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetArgsBuffer() const
+    {
+        return _argsBuffer;
+    }
+
+    /// <summary>
+    /// Gets the visible chunks instances vertex buffer (written by GPU culling).
+    /// </summary>
+    FORCE_INLINE GPUBuffer* GetInstancesBuffer() const
+    {
+        return _instances;
+    }
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csLOD = nullptr;
+        _csCull = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -0,0 +1,165 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "VariableRateShadingPass.h"
+#include "Engine/Content/Content.h"
+#include "Engine/Engine/Engine.h"
+#include "Engine/Graphics/Graphics.h"
+#include "Engine/Graphics/GPUContext.h"
+#include "Engine/Graphics/GPUDevice.h"
+#include "Engine/Graphics/GPULimits.h"
+#include "Engine/Graphics/RenderBuffers.h"
+#include "Engine/Graphics/RenderTargetPool.h"
+#include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+
+// Those defines must match the HLSL
+#define THREADGROUP_SIZE 8
+
+// The relative luminance difference between the neighbour pixels below which the shading rate can be halved (quartered below a quarter of it)
+#define VRS_CONTRAST_THRESHOLD 0.04f
+
+// The screen-space motion (in pixels per frame) that doubles the contrast threshold (fast-moving areas get blurred by the motion and temporal AA anyway)
+#define VRS_MOTION_THRESHOLD 8.0f
+
+// The maximum age (in frames) of the shading rate image that can be used for drawing
+#define VRS_MAX_AGE 2
+
+PACK_STRUCT(struct VariableRateShadingData {
+    Float2 InputSize;
+    float TileSize;
+    float ContrastThreshold;
+    float MotionThreshold;
+    Float3 Dummy0;
+    });
+
+class VariableRateShadingCustomBuffer : public RenderBuffers::CustomBuffer
+{
+public:
+    GPUTexture* Texture = nullptr;
+    uint64 TextureFrame = 0;
+
+    ~VariableRateShadingCustomBuffer()
+    {
+        RenderTargetPool::Release(Texture);
+    }
+};
+
+String VariableRateShadingPass::ToString() const
+{
+    return TEXT("VariableRateShadingPass");
+}
+
+bool VariableRateShadingPass::Init()
+{
+    // Skip if not supported
+    if (!GPUDevice::Instance->Limits.HasVariableRateShading)
+        return false;
+
+    // Load shader
+    _shader = Content::LoadAsyncInternal<Shader>(TEXT("Shaders/VariableRateShading"));
+    if (_shader == nullptr)
+        return true;
+#if COMPILE_WITH_DEV_ENV
+    _shader.Get()->OnReloading.Bind<VariableRateShadingPass, &VariableRateShadingPass::OnShaderReloading>(this);
+#endif
+
+    return false;
+}
+
+bool VariableRateShadingPass::setupResources()
+{
+    // Wait for shader
+    if (!_shader || !_shader->IsLoaded())
+        return true;
+    const auto shader = _shader->GetShader();
+
+    // Validate shader constant buffer size
+    if (shader->GetCB(0)->GetSize() != sizeof(VariableRateShadingData))
+    {
+        REPORT_INVALID_SHADER_PASS_CB_SIZE(shader, 0, VariableRateShadingData);
+        return true;
+    }
+
+    _csShadingRate = shader->GetCS("CS_ShadingRate");
+
+    return false;
+}
+
+void VariableRateShadingPass::Dispose()
+{
+    // Base
+    RendererPass::Dispose();
+
+    // Cleanup
+    _csShadingRate = nullptr;
+    _shader = nullptr;
+}
+
+bool VariableRateShadingPass::IsEnabled(const RenderContext& renderContext)
+{
+    const RenderView& view = renderContext.View;
+    return Graphics::EnableVariableRateShading &&
+            GPUDevice::Instance->Limits.HasVariableRateShading &&
+            renderContext.Buffers &&
+            !view.IsOfflinePass &&
+            !view.IsSingleFrame &&
+            view.Mode == ViewMode::Default;
+}
+
+GPUTexture* VariableRateShadingPass::GetShadingRateImage(const RenderContext& renderContext) const
+{
+    if (!IsEnabled(renderContext) || (renderContext.Task && renderContext.Task->IsCameraCut))
+        return nullptr;
+    const auto buffer = renderContext.Buffers->FindCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading"));
+    if (!buffer || !buffer->Texture || buffer->TextureFrame == 0 || buffer->TextureFrame + VRS_MAX_AGE < Engine::FrameCount)
+        return nullptr;
+
+    // Skip if image doesn't match the current render size (eg. after resize or dynamic resolution change)
+    const int32 tileSize = GPUDevice::Instance->Limits.VariableRateShadingTileSize;
+    if (buffer->Texture->Width() != Math::DivideAndRoundUp(renderContext.Buffers->GetWidth(), tileSize) ||
+        buffer->Texture->Height() != Math::DivideAndRoundUp(renderContext.Buffers->GetHeight(), tileSize))
+        return nullptr;
+    return buffer->Texture;
+}
+
+void VariableRateShadingPass::Render(RenderContext& renderContext, GPUContext* context, GPUTexture* frame)
+{
+    GPUTexture* motionVectors = renderContext.Buffers ? renderContext.Buffers->MotionVectors : nullptr;
+    if (!IsEnabled(renderContext) || checkIfSkipPass())
+        return;
+    auto& buffer = *renderContext.Buffers->GetCustomBuffer<VariableRateShadingCustomBuffer>(TEXT("VariableRateShading"));
+    const uint64 frameIndex = Engine::FrameCount;
+    buffer.LastFrameUsed = frameIndex;
+    if (buffer.TextureFrame == frameIndex)
+        return;
+    PROFILE_GPU_CPU("Variable Rate Shading");
+
+    // Allocate texture (single texel per screen tile)
+    const int32 tileSize = GPUDevice::Instance->Limits.VariableRateShadingTileSize;
+    const int32 width = Math::DivideAndRoundUp(frame->Width(), tileSize);
+    const int32 height = Math::DivideAndRoundUp(frame->Height(), tileSize);
+    if (!buffer.Texture || buffer.Texture->Width() != width || buffer.Texture->Height() != height)
+    {
+        RenderTargetPool::Release(buffer.Texture);
+        buffer.Texture = RenderTargetPool::Get(GPUTextureDescription::New2D(width, height, PixelFormat::R8_UInt, GPUTextureFlags::ShaderResource | GPUTextureFlags::UnorderedAccess));
+        RENDER_TARGET_POOL_SET_NAME(buffer.Texture, "VariableRateShading");
+    }
+
+    // Generate shading rate per tile
+    VariableRateShadingData data;
+    data.InputSize = Float2((float)frame->Width(), (float)frame->Height());
+    data.TileSize = (float)tileSize;
+    data.ContrastThreshold = VRS_CONTRAST_THRESHOLD;
+    data.MotionThreshold = motionVectors && motionVectors->IsAllocated() ? VRS_MOTION_THRESHOLD : 0.0f;
+    const auto cb = _shader->GetShader()->GetCB(0);
+    context->UpdateCB(cb, &data);
+    context->BindCB(0, cb);
+    context->BindSR(0, frame);
+    context->BindSR(1, data.MotionThreshold > 0.0f ? motionVectors->View() : nullptr);
+    context->BindUA(0, buffer.Texture->View());
+    context->Dispatch(_csShadingRate, Math::DivideAndRoundUp(width, THREADGROUP_SIZE), Math::DivideAndRoundUp(height, THREADGROUP_SIZE), 1);
+    context->ResetUA();
+    context->ResetSR();
+    context->UnBindCB(0);
+    buffer.TextureFrame = frameIndex;
+}
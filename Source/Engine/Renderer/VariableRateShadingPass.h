@@ -0,0 +1,57 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "RendererPass.h"
+
+/// <summary>
+/// Variable Rate Shading pass. Generates the shading rate image from the scene color luminance contrast and motion vectors to be used by the scene geometry drawing in the next frame (coarse shading of the flat or fast-moving screen areas).
+/// </summary>
+class VariableRateShadingPass : public RendererPass<VariableRateShadingPass>
+{
+private:
+    AssetReference<Shader> _shader;
+    GPUShaderProgramCS* _csShadingRate = nullptr;
+
+public:
+    /// <summary>
+    /// Checks if the Variable Rate Shading can be used by the given view.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>True if Variable Rate Shading can be used, otherwise false.</returns>
+    static bool IsEnabled(const RenderContext& renderContext);
+
+    /// <summary>
+    /// Gets the shading rate image of the view (generated in the previous frame) to be used by the scene geometry drawing (see GPUContext::SetShadingRateImage).
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <returns>The shading rate image or null if not available.</returns>
+    GPUTexture* GetShadingRateImage(const RenderContext& renderContext) const;
+
+    /// <summary>
+    /// Generates the shading rate image for the next frame from the current frame scene color and motion vectors.
+    /// </summary>
+    /// <param name="renderContext">The rendering context.</param>
+    /// <param name="context">The GPU context.</param>
+    /// <param name="frame">The scene color buffer (after forward pass).</param>
+    void Render(RenderContext& renderContext, GPUContext* context, GPUTexture* frame);
+
+private:
+#if COMPILE_WITH_DEV_ENV
+    void OnShaderReloading(Asset* obj)
+    {
+        _csShadingRate = nullptr;
+        invalidateResources();
+    }
+#endif
+
+public:
+    // [RendererPass]
+    String ToString() const override;
+    bool Init() override;
+    void Dispose() override;
+
+protected:
+    // [RendererPass]
+    bool setupResources() override;
+};
@@ -26,6 +26,11 @@ public sealed class NetworkRpcAttribute : Attribute
         /// </summary>
         public NetworkChannelType Channel;
 
+        /// <summary>
+        /// True if unreliable RPC invoked many times within a single network update should send only the latest call (per object and targets). Can be used for frequently sent state updates (eg. player input) to reduce network usage.
+        /// </summary>
+        public bool LatestOnly;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="NetworkRpcAttribute"/> class.
         /// </summary>
@@ -0,0 +1,23 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using System;
+
+namespace FlaxEngine
+{
+    /// <summary>
+    /// Marks a script as safe to be updated from multiple threads at once. Update, LateUpdate, FixedUpdate and LateFixedUpdate of such scripts are executed in parallel via Job System (after the other scripts of the same update stage and before the native actors ticking).
+    /// </summary>
+    /// <remarks>
+    /// Thread-safe scripts can read the world state and modify only their own data (or the owning actor transformation). They cannot add, remove, reparent or enable/disable objects, load scenes or access other thread-safe scripts state during update.
+    /// </remarks>
+    [AttributeUsage(AttributeTargets.Class)]
+    public sealed class ThreadSafeUpdateAttribute : Attribute
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ThreadSafeUpdateAttribute"/> class.
+        /// </summary>
+        public ThreadSafeUpdateAttribute()
+        {
+        }
+    }
+}
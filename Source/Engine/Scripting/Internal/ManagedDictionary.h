@@ -53,6 +53,8 @@ struct FLAXENGINE_API ManagedDictionary
     static MMethod* GetDictionaryKeys;
 #endif
 
+    mutable MMethod* _getItemMethod = nullptr;
+
 public:
     MObject* Instance;
 
@@ -130,27 +132,37 @@ struct FLAXENGINE_API ManagedDictionary
     static Dictionary<KeyType, ValueType> ToNative(MObject* managed)
     {
         Dictionary<KeyType, ValueType> result;
+        ToNative(managed, result);
+        return result;
+    }
+
+    /// <summary>
+    /// Converts the managed dictionary objects into the existing native dictionary collection (cleared before, reuses its memory if has enough capacity).
+    /// </summary>
+    /// <param name="managed">The managed dictionary object.</param>
+    /// <param name="result">The output dictionary.</param>
+    template<typename KeyType, typename ValueType, typename AllocationType>
+    static void ToNative(MObject* managed, Dictionary<KeyType, ValueType, AllocationType>& result)
+    {
+        result.Clear();
         const ManagedDictionary wrapper(managed);
         MArray* managedKeys = wrapper.GetKeys();
         if (managedKeys == nullptr)
-            return result;
-        int32 length = MCore::Array::GetLength(managedKeys);
-        Array<KeyType> keys;
-        keys.Resize(length);
+            return;
+        const int32 length = MCore::Array::GetLength(managedKeys);
         result.EnsureCapacity(length);
         MConverter<KeyType> keysConverter;
         MConverter<ValueType> valueConverter;
         MObject** managedKeysPtr = MCore::Array::GetAddress<MObject*>(managedKeys);
-        for (int32 i = 0; i < keys.Count(); i++)
+        KeyType key;
+        for (int32 i = 0; i < length; i++)
         {
-            KeyType& key = keys[i];
             MObject* keyManaged = managedKeysPtr[i];
             keysConverter.Unbox(key, keyManaged);
             MObject* valueManaged = wrapper.GetValue(keyManaged);
             ValueType& value = result[key];
             valueConverter.Unbox(value, valueManaged);
         }
-        return result;
     }
 
     static MTypeObject* GetClass(MType* keyType, MType* valueType)
@@ -253,9 +265,15 @@ struct FLAXENGINE_API ManagedDictionary
     MObject* GetValue(MObject* key) const
     {
         CHECK_RETURN(Instance, nullptr);
-        MClass* klass = MCore::Object::GetClass(Instance);
-        MMethod* getItemMethod = klass->GetMethod("System.Collections.IDictionary.get_Item", 1);
-        CHECK_RETURN(getItemMethod, nullptr);
+        MMethod* getItemMethod = _getItemMethod;
+        if (!getItemMethod)
+        {
+            // Cache the method lookup for multiple values reads (eg. when converting the whole dictionary)
+            MClass* klass = MCore::Object::GetClass(Instance);
+            getItemMethod = klass->GetMethod("System.Collections.IDictionary.get_Item", 1);
+            CHECK_RETURN(getItemMethod, nullptr);
+            _getItemMethod = getItemMethod;
+        }
         void* params[1];
         params[0] = key;
         return getItemMethod->Invoke(Instance, params, nullptr);
@@ -3,6 +3,7 @@
 #include "ManagedSerialization.h"
 #if USE_CSHARP
 #include "Engine/Core/Log.h"
+#include "Engine/Core/Collections/CollectionPoolCache.h"
 #include "Engine/Serialization/Json.h"
 #include "Engine/Serialization/JsonWriter.h"
 #include "Engine/Scripting/ManagedCLR/MException.h"
@@ -10,6 +11,12 @@
 #include "Engine/Scripting/ManagedCLR/MCore.h"
 #include "Engine/Scripting/Internal/StdTypesContainer.h"
 
+namespace
+{
+    // Reused json buffers to reduce memory allocations when deserializing many objects (eg. scripts during scene loading)
+    CollectionPoolCache<rapidjson_flax::StringBuffer> DeserializeBuffers;
+}
+
 void ManagedSerialization::Serialize(ISerializable::SerializeStream& stream, MObject* object)
 {
     if (!object)
@@ -87,11 +94,11 @@ void ManagedSerialization::Deserialize(ISerializable::DeserializeStream& stream,
         return;
 
     // Get serialized data
-    rapidjson_flax::StringBuffer buffer;
-    rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(buffer);
+    auto buffer = DeserializeBuffers.Get();
+    rapidjson_flax::Writer<rapidjson_flax::StringBuffer> writer(*buffer.Value);
     stream.Accept(writer);
 
-    Deserialize(StringAnsiView(buffer.GetString(), (int32)buffer.GetSize()), object);
+    Deserialize(StringAnsiView(buffer->GetString(), (int32)buffer->GetSize()), object);
 }
 
 void ManagedSerialization::Deserialize(const StringAnsiView& data, MObject* object)
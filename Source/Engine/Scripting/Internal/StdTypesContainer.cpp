@@ -42,6 +42,8 @@ void StdTypesContainer::Clear()
 
     ManagedArrayClass = nullptr;
 
+    ThreadSafeUpdateAttribute = nullptr;
+
 #if USE_EDITOR
     ExecuteInEditModeAttribute = nullptr;
 #endif
@@ -92,6 +94,8 @@ bool StdTypesContainer::Gather()
 
     GET_CLASS(FlaxEngine, ManagedArrayClass, "FlaxEngine.Interop.ManagedArray");
 
+    GET_CLASS(FlaxEngine, ThreadSafeUpdateAttribute, "FlaxEngine.ThreadSafeUpdateAttribute");
+
 #if USE_EDITOR
     GET_CLASS(FlaxEngine, ExecuteInEditModeAttribute, "FlaxEngine.ExecuteInEditModeAttribute");
 #endif
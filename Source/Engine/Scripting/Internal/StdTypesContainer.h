@@ -47,6 +47,8 @@ class FLAXENGINE_API StdTypesContainer : public Singleton<StdTypesContainer>
 
     MClass* ManagedArrayClass;
 
+    MClass* ThreadSafeUpdateAttribute;
+
 #if USE_EDITOR
     MClass* ExecuteInEditModeAttribute;
 #endif
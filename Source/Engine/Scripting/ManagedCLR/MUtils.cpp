@@ -446,6 +446,8 @@ Variant MUtils::UnboxVariant(MObject* value)
             case VariantType::Double2:
             case VariantType::Double3:
 #if !USE_LARGE_WORLDS
+            case VariantType::Double4:
+            case VariantType::Transform:
             case VariantType::BoundingSphere:
             case VariantType::BoundingBox:
             case VariantType::Ray:
@@ -458,10 +460,10 @@ Variant MUtils::UnboxVariant(MObject* value)
                     Platform::MemoryCopy(&a.AsData, (byte*)ptr + elementSize * i, elementSize);
                 }
                 break;
-            case VariantType::Transform:
             case VariantType::Matrix:
-            case VariantType::Double4:
 #if USE_LARGE_WORLDS
+            case VariantType::Double4:
+            case VariantType::Transform:
             case VariantType::BoundingSphere:
             case VariantType::BoundingBox:
             case VariantType::Ray:
@@ -607,7 +609,7 @@ MObject* MUtils::BoxVariant(const Variant& value)
     case VariantType::Double3:
         return MCore::Object::Box((void*)&value.AsData, Double3::TypeInitializer.GetClass());
     case VariantType::Double4:
-        return MCore::Object::Box((void*)&value.AsData, Double4::TypeInitializer.GetClass());
+        return MCore::Object::Box((void*)&value.AsDouble4(), Double4::TypeInitializer.GetClass());
     case VariantType::Color:
         return MCore::Object::Box((void*)&value.AsData, stdTypes.ColorClass);
     case VariantType::Guid:
@@ -631,7 +633,7 @@ MObject* MUtils::BoxVariant(const Variant& value)
     case VariantType::BoundingBox:
         return MCore::Object::Box((void*)&value.AsBoundingBox(), stdTypes.BoundingBoxClass);
     case VariantType::Transform:
-        return MCore::Object::Box(value.AsBlob.Data, stdTypes.TransformClass);
+        return MCore::Object::Box((void*)&value.AsTransform(), stdTypes.TransformClass);
     case VariantType::Matrix:
         return MCore::Object::Box(value.AsBlob.Data, stdTypes.MatrixClass);
     case VariantType::Blob:
@@ -699,6 +701,8 @@ MObject* MUtils::BoxVariant(const Variant& value)
                 case VariantType::Double2:
                 case VariantType::Double3:
 #if !USE_LARGE_WORLDS
+                case VariantType::Double4:
+                case VariantType::Transform:
                 case VariantType::BoundingSphere:
                 case VariantType::BoundingBox:
                 case VariantType::Ray:
@@ -707,10 +711,10 @@ MObject* MUtils::BoxVariant(const Variant& value)
                     for (int32 i = 0; i < array.Count(); i++)
                         Platform::MemoryCopy(managedPtr + elementSize * i, &array[i].AsData, elementSize);
                     break;
-                case VariantType::Transform:
                 case VariantType::Matrix:
-                case VariantType::Double4:
 #if USE_LARGE_WORLDS
+                case VariantType::Double4:
+                case VariantType::Transform:
                 case VariantType::BoundingSphere:
                 case VariantType::BoundingBox:
                 case VariantType::Ray:
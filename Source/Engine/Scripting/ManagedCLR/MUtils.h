@@ -481,19 +481,51 @@ namespace MUtils
     }
 
     /// <summary>
-    /// Converts the managed array into native array container object.
+    /// Copies contents from given native array into the managed array. Reuses the existing managed array if it matches the size and type, otherwise allocates a new one. Can be used to cache managed arrays that are passed to the scripting every frame to reduce the GC pressure.
+    /// </summary>
+    /// <remarks>The reused array contents are overwritten so it cannot be used by the managed code after the call (eg. stored in a field).</remarks>
+    /// <param name="data">The array object.</param>
+    /// <param name="valueClass">The array values type class.</param>
+    /// <param name="reuse">The existing managed array to reuse (can be null). Must be kept alive by the caller (eg. via GC handle).</param>
+    /// <returns>The output array (the reused one or a new allocation).</returns>
+    template<typename T>
+    MArray* ToArray(const Span<T>& data, const MClass* valueClass, MArray* reuse)
+    {
+        if (!valueClass)
+            return nullptr;
+        MArray* result = reuse;
+        if (!result || MCore::Array::GetLength(result) != data.Length() || MCore::Array::GetArrayClass(result) != MCore::Array::GetClass((MClass*)valueClass))
+            result = MCore::Array::New(valueClass, data.Length());
+        MConverter<T> converter;
+        converter.ToManagedArray(result, data);
+        return result;
+    }
+
+    /// <summary>
+    /// Converts the managed array into the existing native array (reuses its memory if has enough capacity).
     /// </summary>
     /// <param name="arrayObj">The managed array object.</param>
-    /// <returns>The output array.</returns>
-    template<typename T, typename AllocationType = HeapAllocation>
-    Array<T, AllocationType> ToArray(MArray* arrayObj)
+    /// <param name="result">The output array.</param>
+    template<typename T, typename AllocationType>
+    void ToArray(MArray* arrayObj, Array<T, AllocationType>& result)
     {
-        Array<T, AllocationType> result;
         const int32 length = arrayObj ? MCore::Array::GetLength(arrayObj) : 0;
         result.Resize(length);
         MConverter<T> converter;
         Span<T> resultSpan(result.Get(), length);
         converter.ToNativeArray(resultSpan, arrayObj);
+    }
+
+    /// <summary>
+    /// Converts the managed array into native array container object.
+    /// </summary>
+    /// <param name="arrayObj">The managed array object.</param>
+    /// <returns>The output array.</returns>
+    template<typename T, typename AllocationType = HeapAllocation>
+    Array<T, AllocationType> ToArray(MArray* arrayObj)
+    {
+        Array<T, AllocationType> result;
+        ToArray(arrayObj, result);
         return result;
     }
 
@@ -2,14 +2,15 @@
 
 #include "Script.h"
 #include "Engine/Core/Log.h"
-#if USE_EDITOR
 #include "Internal/StdTypesContainer.h"
 #include "ManagedCLR/MClass.h"
+#if USE_EDITOR
 #include "Editor/Editor.h"
 #endif
 #include "Scripting.h"
 #include "Engine/Level/Actor.h"
 #include "Engine/Level/Level.h"
+#include "Engine/Level/SignificanceManager.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Serialization/Serialization.h"
 #include "Engine/Threading/Threading.h"
@@ -30,7 +31,14 @@ Script::Script(const SpawnParams& params)
     , _wasAwakeCalled(false)
     , _wasStartCalled(false)
     , _wasEnableCalled(false)
+    , _tickSignificance(false)
+    , _skipLateUpdate(false)
+    , _tickInterval(1)
+    , _tickCountdown(1)
+    , _lastUpdateTime(0.0f)
+    , _updateDeltaTime(0.0f)
 {
+    _threadSafeUpdate = GetClass()->HasAttribute(StdTypesContainer::Instance()->ThreadSafeUpdateAttribute);
 #if USE_EDITOR
     _executeInEditor = GetClass()->HasAttribute(StdTypesContainer::Instance()->ExecuteInEditModeAttribute);
 #endif
@@ -171,6 +179,38 @@ void Script::SetOrderInParent(int32 index)
     }
 }
 
+void Script::SetTickInterval(int32 value)
+{
+    value = Math::Clamp(value, 1, 255);
+    _tickInterval = (uint8)value;
+
+    // Stagger updates of the scripts with the same interval
+    _tickCountdown = (uint8)(1 + GetHash(GetID()) % (uint32)value);
+}
+
+void Script::SetUseSignificance(bool value)
+{
+    _tickSignificance = value;
+}
+
+bool Script::CanUpdate(float time)
+{
+    if (_tickCountdown > 1)
+    {
+        _tickCountdown--;
+        _skipLateUpdate = 1;
+        return false;
+    }
+    int32 interval = _tickInterval;
+    if (_tickSignificance && _parent)
+        interval = Math::Max(interval, SignificanceManager::GetTickInterval(_parent->GetSphere()));
+    _tickCountdown = (uint8)interval;
+    _skipLateUpdate = 0;
+    _updateDeltaTime = time - _lastUpdateTime;
+    _lastUpdateTime = time;
+    return true;
+}
+
 void Script::SetupType()
 {
     // Enable tick functions based on the method overriden in C# or Visual Script
@@ -326,6 +366,18 @@ void Script::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_GET_OTHER_OBJ(Script);
 
     SERIALIZE_BIT_MEMBER(Enabled, _enabled);
+
+    // Skip the default ticking options to keep the scene files small
+    if (_tickInterval != (other ? other->_tickInterval : 1))
+    {
+        stream.JKEY("TickInterval");
+        stream.Int(_tickInterval);
+    }
+    if (_tickSignificance != (other ? other->_tickSignificance : 0))
+    {
+        stream.JKEY("UseSignificance");
+        stream.Bool(_tickSignificance != 0);
+    }
 }
 
 void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
@@ -335,6 +387,12 @@ void Script::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier
 
     DESERIALIZE_BIT_MEMBER(Enabled, _enabled);
     DESERIALIZE_MEMBER(PrefabID, _prefabID);
+    DESERIALIZE_BIT_MEMBER(UseSignificance, _tickSignificance);
+    {
+        const auto member = SERIALIZE_FIND_MEMBER(stream, "TickInterval");
+        if (member != stream.MemberEnd() && member->value.IsInt())
+            SetTickInterval(member->value.GetInt());
+    }
 
     {
         const auto member = SERIALIZE_FIND_MEMBER(stream, "ParentID");
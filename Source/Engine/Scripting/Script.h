@@ -23,9 +23,16 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     uint16 _wasAwakeCalled : 1;
     uint16 _wasStartCalled : 1;
     uint16 _wasEnableCalled : 1;
+    uint16 _threadSafeUpdate : 1;
+    uint16 _tickSignificance : 1;
+    uint16 _skipLateUpdate : 1;
 #if USE_EDITOR
     uint16 _executeInEditor : 1;
 #endif
+    uint8 _tickInterval;
+    uint8 _tickCountdown;
+    float _lastUpdateTime;
+    float _updateDeltaTime;
 
 public:
     /// <summary>
@@ -53,6 +60,42 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
     /// </summary>
     API_PROPERTY() void SetActor(Actor* value);
 
+    /// <summary>
+    /// Gets the script update interval (in frames). Value 1 updates script every frame, 2 every second frame, etc. Updates of the scripts are staggered across frames to prevent spikes. Affects OnUpdate and OnLateUpdate.
+    /// </summary>
+    API_PROPERTY(Attributes="HideInEditor")
+    FORCE_INLINE int32 GetTickInterval() const
+    {
+        return _tickInterval;
+    }
+
+    /// <summary>
+    /// Sets the script update interval (in frames). Value 1 updates script every frame, 2 every second frame, etc. Updates of the scripts are staggered across frames to prevent spikes. Affects OnUpdate and OnLateUpdate.
+    /// </summary>
+    API_PROPERTY() void SetTickInterval(int32 value);
+
+    /// <summary>
+    /// Gets value indicating if script update frequency is lowered for far-away or off-screen actors (see <see cref="SignificanceManager"/>).
+    /// </summary>
+    API_PROPERTY(Attributes="HideInEditor")
+    FORCE_INLINE bool GetUseSignificance() const
+    {
+        return _tickSignificance != 0;
+    }
+
+    /// <summary>
+    /// Sets value indicating if script update frequency is lowered for far-away or off-screen actors (see <see cref="SignificanceManager"/>).
+    /// </summary>
+    API_PROPERTY() void SetUseSignificance(bool value);
+
+    /// <summary>
+    /// Gets the game time elapsed since the previous script update (in seconds). Should be used instead of <see cref="Time.DeltaTime"/> by the scripts that don't update every frame.
+    /// </summary>
+    API_PROPERTY() FORCE_INLINE float GetUpdateDeltaTime() const
+    {
+        return _updateDeltaTime;
+    }
+
 public:
     /// <summary>
     /// Called after the object is loaded.
@@ -133,6 +176,7 @@ API_CLASS(Abstract) class FLAXENGINE_API Script : public SceneObject
 
 private:
     void SetupType();
+    bool CanUpdate(float time);
     void Start();
     void Enable();
     void Disable();
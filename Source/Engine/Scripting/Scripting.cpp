@@ -22,6 +22,7 @@
 #include "ManagedCLR/MException.h"
 #include "Internal/StdTypesContainer.h"
 #include "Engine/Core/LogContext.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
 #include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Core/Types/TimeSpan.h"
 #include "Engine/Core/Types/Stopwatch.h"
@@ -33,6 +34,7 @@
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Serialization/JsonTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Profiler/ProfilerMemory.h"
 
 extern void registerFlaxEngineInternalCalls();
 
@@ -58,7 +60,6 @@ namespace
 {
     MDomain* _rootDomain = nullptr;
     MDomain* _scriptsDomain = nullptr;
-    CriticalSection _objectsLocker;
 #define USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING 0
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     struct ScriptingObjectData
@@ -94,10 +95,45 @@ namespace
         }
     };
 
-    Dictionary<Guid, ScriptingObjectData> _objectsDictionary(1024 * 16);
+    typedef ScriptingObjectData ObjectsEntry;
 #else
-    Dictionary<Guid, ScriptingObject*> _objectsDictionary(1024 * 16);
+    typedef ScriptingObject* ObjectsEntry;
 #endif
+
+    // Objects registry is split into shards (selected by the object ID hash) with separate locks so lookups from many threads don't serialize on a single lock
+#define SCRIPTING_OBJECTS_SHARDS 64
+    struct ObjectsShard
+    {
+        CriticalSection Locker;
+        FlatDictionary<Guid, ObjectsEntry> Objects;
+
+        ObjectsShard()
+            : Objects(256)
+        {
+        }
+    };
+
+    ObjectsShard _objectsShards[SCRIPTING_OBJECTS_SHARDS];
+
+    FORCE_INLINE ObjectsShard& GetObjectsShard(const Guid& id)
+    {
+        // Use the highest bits of the hash (the lowest ones are used by the shard dictionary)
+        static_assert(SCRIPTING_OBJECTS_SHARDS == 64, "Update shard index bits.");
+        return _objectsShards[GetHash(id) >> 26];
+    }
+
+    // Locks all shards (in order) for the operations that can call into objects that modify the registry (eg. unregister itself)
+    void LockAllObjects()
+    {
+        for (int32 i = 0; i < SCRIPTING_OBJECTS_SHARDS; i++)
+            _objectsShards[i].Locker.Lock();
+    }
+
+    void UnlockAllObjects()
+    {
+        for (int32 i = SCRIPTING_OBJECTS_SHARDS - 1; i >= 0; i--)
+            _objectsShards[i].Locker.Unlock();
+    }
     bool _isEngineAssemblyLoaded = false;
     bool _hasGameModulesLoaded = false;
     MMethod* _method_Update = nullptr;
@@ -122,19 +158,22 @@ namespace
 
         // Destroy objects from game assemblies (eg. not released objects that might crash if persist in memory after reload)
         const auto flaxModule = GetBinaryModuleFlaxEngine();
-        _objectsLocker.Lock();
-        for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+        LockAllObjects();
+        for (ObjectsShard& shard : _objectsShards)
         {
-            auto obj = i->Value;
-            if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
-                continue;
+            for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+            {
+                auto obj = i->Value;
+                if (gameOnly && obj->GetTypeHandle().Module == flaxModule)
+                    continue;
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
-            LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
+                LOG(Info, "[OnScriptingDispose] obj = 0x{0:x}, {1}", (uint64)obj.Ptr, String(obj.TypeName));
 #endif
-            obj->OnScriptingDispose();
+                obj->OnScriptingDispose();
+            }
         }
-        _objectsLocker.Unlock();
+        UnlockAllObjects();
 
         // Release assets sourced from game assemblies
         Array<Asset*> assets = Content::GetAssets();
@@ -232,6 +271,7 @@ bool ScriptingService::Init()
 void ScriptingService::Update()
 {
     PROFILE_CPU_NAMED("Scripting::Update");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(Update);
 
 #ifdef USE_NETCORE
@@ -246,18 +286,21 @@ void ScriptingService::Update()
 void ScriptingService::LateUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateUpdate);
 }
 
 void ScriptingService::FixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::FixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(FixedUpdate);
 }
 
 void ScriptingService::LateFixedUpdate()
 {
     PROFILE_CPU_NAMED("Scripting::LateFixedUpdate");
+    PROFILE_MEM(Scripting);
     INVOKE_EVENT(LateFixedUpdate);
 }
 
@@ -725,9 +768,11 @@ void Scripting::Reload(bool canTriggerSceneReload)
 Array<ScriptingObject*, HeapAllocation> Scripting::GetObjects()
 {
     Array<ScriptingObject*> objects;
-    _objectsLocker.Lock();
-    _objectsDictionary.GetValues(objects);
-    _objectsLocker.Unlock();
+    for (ObjectsShard& shard : _objectsShards)
+    {
+        ScopeLock lock(shard.Locker);
+        shard.Objects.GetValues(objects);
+    }
     return objects;
 }
 
@@ -864,17 +909,18 @@ ScriptingObject* Scripting::FindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
+    ObjectsShard& shard = GetObjectsShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
     if (result)
     {
@@ -920,17 +966,18 @@ ScriptingObject* Scripting::TryFindObject(Guid id, const MClass* type)
     }
 
     // Try to find it
+    ObjectsShard& shard = GetObjectsShard(id);
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData data;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, data);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, data);
+    shard.Locker.Unlock();
     auto result = data.Ptr;
 #else
     ScriptingObject* result = nullptr;
-    _objectsLocker.Lock();
-    _objectsDictionary.TryGet(id, result);
-    _objectsLocker.Unlock();
+    shard.Locker.Lock();
+    shard.Objects.TryGet(id, result);
+    shard.Locker.Unlock();
 #endif
 
     // Check type
@@ -946,12 +993,15 @@ ScriptingObject* Scripting::TryFindObject(const MClass* type)
 {
     if (type == nullptr)
         return nullptr;
-    ScopeLock lock(_objectsLocker);
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (ObjectsShard& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetClass() == type)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetClass() == type)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -964,13 +1014,15 @@ ScriptingObject* Scripting::FindObject(const MObject* managedInstance)
 
     // TODO: optimize it by reading the unmanagedPtr or _internalId from managed Object property
 
-    ScopeLock lock(_objectsLocker);
-
-    for (auto i = _objectsDictionary.Begin(); i.IsNotEnd(); ++i)
+    for (ObjectsShard& shard : _objectsShards)
     {
-        const auto obj = i->Value;
-        if (obj->GetManagedInstance() == managedInstance)
-            return obj;
+        ScopeLock lock(shard.Locker);
+        for (auto i = shard.Objects.Begin(); i.IsNotEnd(); ++i)
+        {
+            const auto obj = i->Value;
+            if (obj->GetManagedInstance() == managedInstance)
+                return obj;
+        }
     }
     return nullptr;
 }
@@ -980,9 +1032,18 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     PROFILE_CPU();
     ASSERT(obj);
 
-    // Validate if object still exists
-    _objectsLocker.Lock();
-    if (_objectsDictionary.ContainsValue(obj))
+    // Validate if object still exists (object might be already deleted so search by the pointer)
+    LockAllObjects();
+    bool exists = false;
+    for (const ObjectsShard& shard : _objectsShards)
+    {
+        if (shard.Objects.ContainsValue(obj))
+        {
+            exists = true;
+            break;
+        }
+    }
+    if (exists)
     {
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
         LOG(Info, "[OnManagedInstanceDeleted] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
@@ -993,7 +1054,7 @@ void Scripting::OnManagedInstanceDeleted(ScriptingObject* obj)
     {
         //LOG(Warning, "Object finalization called for already removed object (address={0:x})", (uint64)obj);
     }
-    _objectsLocker.Unlock();
+    UnlockAllObjects();
 }
 
 bool Scripting::HasGameModulesLoaded()
@@ -1021,16 +1082,16 @@ bool Scripting::IsTypeFromGameScripts(const MClass* type)
 void Scripting::RegisterObject(ScriptingObject* obj)
 {
     const Guid id = obj->GetID();
-    ScopeLock lock(_objectsLocker);
+    ObjectsShard& shard = GetObjectsShard(id);
+    ScopeLock lock(shard.Locker);
 
-    //ASSERT(!_objectsDictionary.ContainsValue(obj));
 #if ENABLE_ASSERTION
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     ScriptingObjectData other;
-    if (_objectsDictionary.TryGet(id, other))
+    if (shard.Objects.TryGet(id, other))
 #else
     ScriptingObject* other;
-    if (_objectsDictionary.TryGet(id, other))
+    if (shard.Objects.TryGet(id, other))
 #endif
     {
         // Something went wrong...
@@ -1041,33 +1102,37 @@ void Scripting::RegisterObject(ScriptingObject* obj)
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[RegisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary[id] = obj;
+    shard.Objects[id] = obj;
 }
 
 void Scripting::UnregisterObject(ScriptingObject* obj)
 {
-    ScopeLock lock(_objectsLocker);
-
-    //ASSERT(!obj->_id.IsValid() || _objectsDictionary.ContainsValue(obj));
+    const Guid id = obj->GetID();
+    ObjectsShard& shard = GetObjectsShard(id);
+    ScopeLock lock(shard.Locker);
 
 #if USE_OBJECTS_DISPOSE_CRASHES_DEBUGGING
     LOG(Info, "[UnregisterObject] obj = 0x{0:x}, {1}", (uint64)obj, String(ScriptingObjectData(obj).TypeName));
 #endif
-    _objectsDictionary.Remove(obj->GetID());
+    shard.Objects.Remove(id);
 }
 
 void Scripting::OnObjectIdChanged(ScriptingObject* obj, const Guid& oldId)
 {
-    ScopeLock lock(_objectsLocker);
-
     ASSERT(obj && oldId.IsValid());
     ASSERT(obj->GetID() != oldId);
-    ASSERT(_objectsDictionary.ContainsKey(oldId));
-    //ASSERT(_objectsDictionary.ContainsValue(obj));
-    ASSERT(!_objectsDictionary.ContainsKey(obj->GetID()));
+    ObjectsShard& oldShard = GetObjectsShard(oldId);
+    ObjectsShard& newShard = GetObjectsShard(obj->GetID());
+
+    // Lock both shards in the registry order (the same as LockAllObjects)
+    ScopeLock lockA(&oldShard < &newShard ? oldShard.Locker : newShard.Locker);
+    ScopeLock lockB(&oldShard < &newShard ? newShard.Locker : oldShard.Locker);
+
+    ASSERT(oldShard.Objects.ContainsKey(oldId));
+    ASSERT(!newShard.Objects.ContainsKey(obj->GetID()));
 
-    _objectsDictionary.Remove(oldId);
-    _objectsDictionary.Add(obj->GetID(), obj);
+    oldShard.Objects.Remove(oldId);
+    newShard.Objects.Add(obj->GetID(), obj);
 }
 
 bool initFlaxEngine()
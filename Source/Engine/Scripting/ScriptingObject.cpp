@@ -8,6 +8,7 @@
 #include "Engine/Core/Log.h"
 #include "Engine/Core/LogContext.h"
 #include "Engine/Core/Types/Pair.h"
+#include "Engine/Core/Memory/PoolAllocator.h"
 #include "Engine/Utilities/StringConverter.h"
 #include "Engine/Content/Asset.h"
 #include "Engine/Content/Content.h"
@@ -30,6 +31,61 @@
 typedef Pair<ScriptingObject*, ScriptingTypeHandle> ScriptingObjectsInterfaceKey;
 Dictionary<ScriptingObjectsInterfaceKey, void*> ScriptingObjectsInterfaceWrappers;
 
+// The amount of the objects in a single memory slab of the pooled type
+#define SCRIPTING_OBJECTS_POOL_SLAB_SIZE 64
+
+volatile int64 ScriptingObjectsPool::_poolsCount = 0;
+
+namespace
+{
+    CriticalSection ScriptingObjectsPoolsLocker;
+    Dictionary<const ScriptingTypeInitializer*, PoolAllocator*> ScriptingObjectsPools;
+}
+
+void ScriptingObjectsPool::Reserve(const ScriptingTypeInitializer& type, int32 size, int32 count)
+{
+    ScriptingObjectsPoolsLocker.Lock();
+    PoolAllocator* pool;
+    if (!ScriptingObjectsPools.TryGet(&type, pool))
+    {
+        // Pools live for the whole engine lifetime (objects memory is reused by the next spawns)
+        pool = ::New<PoolAllocator>(size, SCRIPTING_OBJECTS_POOL_SLAB_SIZE);
+        ScriptingObjectsPools.Add(&type, pool);
+        Platform::InterlockedIncrement(&_poolsCount);
+    }
+    ASSERT(pool->GetBlockSize() == size);
+    ScriptingObjectsPoolsLocker.Unlock();
+    pool->Reserve(count);
+}
+
+int32 ScriptingObjectsPool::GetAllocatedCount(const ScriptingTypeInitializer& type)
+{
+    ScriptingObjectsPoolsLocker.Lock();
+    PoolAllocator* pool = nullptr;
+    ScriptingObjectsPools.TryGet(&type, pool);
+    ScriptingObjectsPoolsLocker.Unlock();
+    return pool ? pool->GetAllocatedCount() : 0;
+}
+
+void ScriptingObjectsPool::Free(void* ptr)
+{
+    PoolAllocator::GetPool(ptr)->Free(ptr);
+}
+
+void* ScriptingObjectsPool::Allocate(const ScriptingTypeInitializer& type)
+{
+    ScriptingObjectsPoolsLocker.Lock();
+    PoolAllocator* pool = nullptr;
+    ScriptingObjectsPools.TryGet(&type, pool);
+    ScriptingObjectsPoolsLocker.Unlock();
+    return pool ? pool->Allocate() : nullptr;
+}
+
+void ScriptingObjectsPool::OnSpawned(ScriptingObject* obj)
+{
+    obj->Flags |= ObjectFlags::IsPooled;
+}
+
 SerializableScriptingObject::SerializableScriptingObject(const SpawnParams& params)
     : ScriptingObject(params)
 {
@@ -451,6 +507,14 @@ void ScriptingObject::OnDeleteObject()
     if (IsRegistered())
         UnregisterObject();
 
+    if (EnumHasAnyFlags(Flags, ObjectFlags::IsPooled))
+    {
+        // Return memory to the type pool
+        Memory::DestructItem(this);
+        ScriptingObjectsPool::Free(this);
+        return;
+    }
+
     // Base
     Object::OnDeleteObject();
 }
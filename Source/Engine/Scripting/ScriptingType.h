@@ -362,6 +362,72 @@ struct ScriptingObjectSpawnParams
     }
 };
 
+/// <summary>
+/// The native scripting objects pooling utility. Objects of the pooled types spawned via scripting type (see ScriptingObject::NewObject) are allocated from the contiguous memory slabs and recycled on delete. Pooling is opt-in per native type (see Reserve).
+/// </summary>
+/// <remarks>
+/// Pooled objects have to be deleted via DeleteObject (eg. actor Destroy) and never with the Delete function.
+/// </remarks>
+class FLAXENGINE_API ScriptingObjectsPool
+{
+private:
+    static volatile int64 _poolsCount;
+
+public:
+    /// <summary>
+    /// Enables the objects pooling for the given native type and ensures that the pool has capacity for the given amount of the objects.
+    /// </summary>
+    /// <param name="type">The native type (eg. Actor::TypeInitializer).</param>
+    /// <param name="size">The native type size (in bytes).</param>
+    /// <param name="count">The minimum amount of the objects to reserve memory for.</param>
+    static void Reserve(const ScriptingTypeInitializer& type, int32 size, int32 count);
+
+    /// <summary>
+    /// Enables the objects pooling for the given native type and ensures that the pool has capacity for the given amount of the objects.
+    /// </summary>
+    /// <param name="count">The minimum amount of the objects to reserve memory for.</param>
+    template<typename T>
+    FORCE_INLINE static void Reserve(int32 count)
+    {
+        Reserve(T::TypeInitializer, sizeof(T), count);
+    }
+
+    /// <summary>
+    /// Gets the amount of the objects allocated from the pool of the given native type.
+    /// </summary>
+    /// <param name="type">The native type.</param>
+    /// <returns>The allocated objects count (0 if type is not pooled).</returns>
+    static int32 GetAllocatedCount(const ScriptingTypeInitializer& type);
+
+    /// <summary>
+    /// Creates a new object of the given native type (from the pool if type uses pooling).
+    /// </summary>
+    /// <param name="params">The object initialization parameters.</param>
+    /// <returns>The created object.</returns>
+    template<typename T>
+    static T* New(const ScriptingObjectSpawnParams& params)
+    {
+        if (Platform::AtomicRead(&_poolsCount) != 0)
+        {
+            void* memory = Allocate(T::TypeInitializer);
+            if (memory)
+            {
+                T* obj = new(memory) T(params);
+                OnSpawned(obj);
+                return obj;
+            }
+        }
+        return ::New<T>(params);
+    }
+
+    // Releases the memory of the pooled object (called after its destruction).
+    static void Free(void* ptr);
+
+private:
+    static void* Allocate(const ScriptingTypeInitializer& type);
+    static void OnSpawned(ScriptingObject* obj);
+};
+
 /// <summary>
 /// Helper define used to declare required components for native structures that have managed type.
 /// </summary>
@@ -387,7 +453,7 @@ struct ScriptingObjectSpawnParams
 /// </summary>
 #define DECLARE_SCRIPTING_TYPE(type) \
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(type); \
-    static type* Spawn(const SpawnParams& params) { return ::New<type>(params); } \
+    static type* Spawn(const SpawnParams& params) { return ScriptingObjectsPool::New<type>(params); } \
     explicit type() : type(SpawnParams(Guid::New(), type::TypeInitializer)) { } \
     explicit type(const SpawnParams& params)
 
@@ -396,7 +462,7 @@ struct ScriptingObjectSpawnParams
 /// </summary>
 #define DECLARE_SCRIPTING_TYPE_WITH_CONSTRUCTOR_IMPL(type, baseType) \
     DECLARE_SCRIPTING_TYPE_NO_SPAWN(type); \
-    static type* Spawn(const SpawnParams& params) { return ::New<type>(params); } \
+    static type* Spawn(const SpawnParams& params) { return ScriptingObjectsPool::New<type>(params); } \
     explicit type(const SpawnParams& params) : baseType(params) { } \
     explicit type() : baseType(SpawnParams(Guid::New(), type::TypeInitializer)) { }
 
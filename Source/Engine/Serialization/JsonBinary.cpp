@@ -0,0 +1,392 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "JsonBinary.h"
+#include "Json.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Platform/Platform.h"
+
+// The maximum supported depth of the nested objects and arrays
+#define JSON_BINARY_MAX_DEPTH 256
+
+namespace
+{
+    enum Tokens : byte
+    {
+        TokenNull,
+        TokenFalse,
+        TokenTrue,
+        TokenInt,
+        TokenUint,
+        TokenInt64,
+        TokenUint64,
+        TokenFloat,
+        TokenDouble,
+        TokenString,
+        TokenRaw,
+        TokenObject,
+        TokenArray,
+        TokenEnd,
+    };
+
+    struct Header
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 KeysCount;
+        uint32 KeysSize;
+    };
+
+    FORCE_INLINE uint64 ZigZagEncode(int64 value)
+    {
+        return ((uint64)value << 1) ^ (uint64)(value >> 63);
+    }
+
+    FORCE_INLINE int64 ZigZagDecode(uint64 value)
+    {
+        return (int64)(value >> 1) ^ -(int64)(value & 1);
+    }
+
+    void WriteVarInt(MemoryWriteStream& stream, uint64 value)
+    {
+        byte buffer[10];
+        int32 size = 0;
+        while (value >= 0x80)
+        {
+            buffer[size++] = (byte)(value | 0x80);
+            value >>= 7;
+        }
+        buffer[size++] = (byte)value;
+        stream.WriteBytes(buffer, size);
+    }
+
+    struct BinaryJsonReader
+    {
+        const byte* Position;
+        const byte* End;
+        Array<StringAnsiView> Keys;
+        bool Failed = true;
+
+        bool ReadVarInt(uint64& result)
+        {
+            result = 0;
+            for (int32 shift = 0; shift < 64 && Position < End; shift += 7)
+            {
+                const byte b = *Position++;
+                result |= (uint64)(b & 0x7f) << shift;
+                if ((b & 0x80) == 0)
+                    return false;
+            }
+            return true;
+        }
+
+        template<typename T>
+        bool ReadRaw(T& result)
+        {
+            if (Position + sizeof(T) > End)
+                return true;
+            Platform::MemoryCopy(&result, Position, sizeof(T));
+            Position += sizeof(T);
+            return false;
+        }
+
+        bool ReadString(const char*& str, uint32& length)
+        {
+            uint64 size;
+            if (ReadVarInt(size) || size > (uint64)(End - Position))
+                return true;
+            str = (const char*)Position;
+            length = (uint32)size;
+            Position += size;
+            return false;
+        }
+
+        bool ReadValue(rapidjson_flax::Document& handler, int32 depth)
+        {
+            if (Position >= End || depth > JSON_BINARY_MAX_DEPTH)
+                return true;
+            const byte token = *Position++;
+            uint64 u;
+            switch (token)
+            {
+            case TokenNull:
+                return !handler.Null();
+            case TokenFalse:
+                return !handler.Bool(false);
+            case TokenTrue:
+                return !handler.Bool(true);
+            case TokenInt:
+                return ReadVarInt(u) || !handler.Int((int32)ZigZagDecode(u));
+            case TokenUint:
+                return ReadVarInt(u) || !handler.Uint((uint32)u);
+            case TokenInt64:
+                return ReadVarInt(u) || !handler.Int64(ZigZagDecode(u));
+            case TokenUint64:
+                return ReadVarInt(u) || !handler.Uint64(u);
+            case TokenFloat:
+            {
+                float f;
+                return ReadRaw(f) || !handler.Double(f);
+            }
+            case TokenDouble:
+            {
+                double d;
+                return ReadRaw(d) || !handler.Double(d);
+            }
+            case TokenString:
+            {
+                const char* str;
+                uint32 length;
+                return ReadString(str, length) || !handler.String(str, length, true);
+            }
+            case TokenRaw:
+            {
+                // Raw json text is stored with the null-terminator
+                const char* str;
+                uint32 length;
+                if (ReadString(str, length) || length == 0 || str[length - 1] != 0)
+                    return true;
+                rapidjson::GenericStringStream<rapidjson::UTF8<>> stream(str);
+                rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, rapidjson_flax::FlaxAllocator> reader;
+                return reader.Parse<rapidjson::kParseStopWhenDoneFlag>(stream, handler).IsError();
+            }
+            case TokenObject:
+            {
+                uint32 size;
+                if (ReadRaw(size) || size > (uint32)(End - Position))
+                    return true;
+                const byte* end = Position + size;
+                if (!handler.StartObject())
+                    return true;
+                uint32 count = 0;
+                while (true)
+                {
+                    // Key index is stored with offset by 1 (0 is the end of the object)
+                    if (ReadVarInt(u))
+                        return true;
+                    if (u == 0)
+                        break;
+                    if (u > (uint64)Keys.Count())
+                        return true;
+                    const StringAnsiView& key = Keys.Get()[u - 1];
+                    if (!handler.Key(key.Get(), key.Length(), true) || ReadValue(handler, depth + 1))
+                        return true;
+                    count++;
+                }
+                return Position != end || !handler.EndObject(count);
+            }
+            case TokenArray:
+            {
+                uint32 size;
+                if (ReadRaw(size) || size > (uint32)(End - Position))
+                    return true;
+                const byte* end = Position + size;
+                if (!handler.StartArray())
+                    return true;
+                uint32 count = 0;
+                while (true)
+                {
+                    if (Position >= End)
+                        return true;
+                    if (*Position == TokenEnd)
+                    {
+                        Position++;
+                        break;
+                    }
+                    if (ReadValue(handler, depth + 1))
+                        return true;
+                    count++;
+                }
+                return Position != end || !handler.EndArray(count);
+            }
+            default:
+                return true;
+            }
+        }
+
+        bool operator()(rapidjson_flax::Document& handler)
+        {
+            Failed = ReadValue(handler, 0) || Position != End;
+            return !Failed;
+        }
+    };
+}
+
+BinaryJsonWriter::BinaryJsonWriter()
+    : _keysData(1024)
+    , _data(16 * 1024)
+{
+}
+
+void BinaryJsonWriter::GetData(Array<byte>& result) const
+{
+    ASSERT(_stack.IsEmpty());
+    Header header;
+    header.Magic = JSON_BINARY_MAGIC;
+    header.Version = JSON_BINARY_VERSION;
+    header.KeysCount = _keys.Count();
+    header.KeysSize = _keysData.GetPosition();
+    result.Resize(sizeof(Header) + _keysData.GetPosition() + _data.GetPosition(), false);
+    byte* ptr = result.Get();
+    Platform::MemoryCopy(ptr, &header, sizeof(Header));
+    ptr += sizeof(Header);
+    Platform::MemoryCopy(ptr, _keysData.GetHandle(), _keysData.GetPosition());
+    ptr += _keysData.GetPosition();
+    Platform::MemoryCopy(ptr, _data.GetHandle(), _data.GetPosition());
+}
+
+void BinaryJsonWriter::Key(const char* str, int32 length)
+{
+    const StringAnsiView key(str, length);
+    int32 index;
+    if (!_keys.TryGet(key, index))
+    {
+        index = _keys.Count();
+        _keys.Add(StringAnsi(key), index);
+        ::WriteVarInt(_keysData, length);
+        _keysData.WriteBytes(str, length);
+    }
+    WriteVarInt(index + 1);
+}
+
+void BinaryJsonWriter::String(const char* str, int32 length)
+{
+    _data.WriteByte(TokenString);
+    WriteVarInt(length);
+    _data.WriteBytes(str, length);
+}
+
+void BinaryJsonWriter::RawValue(const char* json, int32 length)
+{
+    _data.WriteByte(TokenRaw);
+    WriteVarInt(length + 1);
+    _data.WriteBytes(json, length);
+    _data.WriteByte(0);
+}
+
+void BinaryJsonWriter::Bool(bool d)
+{
+    _data.WriteByte(d ? TokenTrue : TokenFalse);
+}
+
+void BinaryJsonWriter::Int(int32 d)
+{
+    _data.WriteByte(TokenInt);
+    WriteVarInt(ZigZagEncode(d));
+}
+
+void BinaryJsonWriter::Int64(int64 d)
+{
+    _data.WriteByte(TokenInt64);
+    WriteVarInt(ZigZagEncode(d));
+}
+
+void BinaryJsonWriter::Uint(uint32 d)
+{
+    _data.WriteByte(TokenUint);
+    WriteVarInt(d);
+}
+
+void BinaryJsonWriter::Uint64(uint64 d)
+{
+    _data.WriteByte(TokenUint64);
+    WriteVarInt(d);
+}
+
+void BinaryJsonWriter::Float(float d)
+{
+    _data.WriteByte(TokenFloat);
+    _data.WriteFloat(d);
+}
+
+void BinaryJsonWriter::Double(double d)
+{
+    _data.WriteByte(TokenDouble);
+    _data.WriteDouble(d);
+}
+
+void BinaryJsonWriter::StartObject()
+{
+    BeginContainer(TokenObject);
+}
+
+void BinaryJsonWriter::EndObject()
+{
+    WriteVarInt(0);
+    EndContainer();
+}
+
+void BinaryJsonWriter::StartArray()
+{
+    BeginContainer(TokenArray);
+}
+
+void BinaryJsonWriter::EndArray(int32 count)
+{
+    _data.WriteByte(TokenEnd);
+    EndContainer();
+}
+
+void BinaryJsonWriter::WriteVarInt(uint64 value)
+{
+    ::WriteVarInt(_data, value);
+}
+
+void BinaryJsonWriter::BeginContainer(byte token)
+{
+    // Reserve space for the container size (written on end)
+    _data.WriteByte(token);
+    _stack.Add(_data.GetPosition());
+    _data.WriteUint32(0);
+}
+
+void BinaryJsonWriter::EndContainer()
+{
+    const uint32 start = _stack.Pop();
+    const uint32 size = _data.GetPosition() - start - sizeof(uint32);
+    Platform::MemoryCopy(_data.GetHandle() + start, &size, sizeof(uint32));
+}
+
+bool JsonBinary::IsBinary(const byte* data, int32 length)
+{
+    uint32 magic;
+    if (data == nullptr || length < (int32)sizeof(Header))
+        return false;
+    Platform::MemoryCopy(&magic, data, sizeof(uint32));
+    return magic == JSON_BINARY_MAGIC;
+}
+
+bool JsonBinary::Parse(rapidjson_flax::Document& document, const byte* data, int32 length)
+{
+    if (!IsBinary(data, length))
+        return true;
+    Header header;
+    Platform::MemoryCopy(&header, data, sizeof(Header));
+    if (header.Version != JSON_BINARY_VERSION)
+    {
+        LOG(Warning, "Unsupported binary json version {0}.", header.Version);
+        return true;
+    }
+    if (header.KeysSize > (uint32)length - sizeof(Header))
+        return true;
+
+    // Load keys table
+    BinaryJsonReader reader;
+    reader.Position = data + sizeof(Header);
+    reader.End = reader.Position + header.KeysSize;
+    reader.Keys.Resize(header.KeysCount, false);
+    for (uint32 i = 0; i < header.KeysCount; i++)
+    {
+        const char* str;
+        uint32 strLength;
+        if (reader.ReadString(str, strLength))
+            return true;
+        reader.Keys.Get()[i] = StringAnsiView(str, (int32)strLength);
+    }
+    if (reader.Position != reader.End)
+        return true;
+
+    // Load values (document handler builds objects and arrays with the exact size so there is no reallocations)
+    reader.End = data + length;
+    document.Populate(reader);
+    return reader.Failed;
+}
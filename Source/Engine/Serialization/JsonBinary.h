@@ -0,0 +1,90 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "JsonWriter.h"
+#include "JsonFwd.h"
+#include "MemoryWriteStream.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+
+// The magic code at the beginning of the binary json data (used to detect the format)
+#define JSON_BINARY_MAGIC 0x424A4C46
+
+// The version of the binary json format
+#define JSON_BINARY_VERSION 1
+
+/// <summary>
+/// Json writer that outputs compact binary json representation used by the cooked game data (eg. scenes and prefabs). Loading it skips the text tokenization, number parsing and string unescaping. All object keys are deduplicated into a single table and each object/array has its size in bytes stored so readers can skip over subtrees.
+/// </summary>
+/// <remarks>
+/// The binary data is loaded into the regular json document (see <see cref="JsonBinary::Parse"/>) so deserialization code is shared with text json. Editor and source-control data stays in the text json.
+/// </remarks>
+class FLAXENGINE_API BinaryJsonWriter : public JsonWriter
+{
+private:
+    MemoryWriteStream _keysData;
+    MemoryWriteStream _data;
+    Dictionary<StringAnsi, int32> _keys;
+    Array<uint32, InlinedAllocation<32>> _stack;
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="BinaryJsonWriter"/> class.
+    /// </summary>
+    BinaryJsonWriter();
+
+public:
+    /// <summary>
+    /// Gets the output data (header, keys table and the values). Valid only after writing the whole root value.
+    /// </summary>
+    /// <param name="result">The output data.</param>
+    void GetData(Array<byte>& result) const;
+
+public:
+    // [JsonWriter]
+    void Key(const char* str, int32 length) override;
+    void String(const char* str, int32 length) override;
+    void RawValue(const char* json, int32 length) override;
+    void Bool(bool d) override;
+    void Int(int32 d) override;
+    void Int64(int64 d) override;
+    void Uint(uint32 d) override;
+    void Uint64(uint64 d) override;
+    void Float(float d) override;
+    void Double(double d) override;
+    void StartObject() override;
+    void EndObject() override;
+    void StartArray() override;
+    void EndArray(int32 count = 0) override;
+
+private:
+    void WriteVarInt(uint64 value);
+    void BeginContainer(byte token);
+    void EndContainer();
+};
+
+/// <summary>
+/// Binary json format utilities.
+/// </summary>
+class FLAXENGINE_API JsonBinary
+{
+public:
+    /// <summary>
+    /// Checks if the given data is in the binary json format (otherwise it's text json).
+    /// </summary>
+    /// <param name="data">The data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <returns>True if data is binary json, otherwise false.</returns>
+    static bool IsBinary(const byte* data, int32 length);
+
+    /// <summary>
+    /// Loads the binary json data into the document.
+    /// </summary>
+    /// <param name="document">The output document.</param>
+    /// <param name="data">The data.</param>
+    /// <param name="length">The data length (in bytes).</param>
+    /// <returns>True if failed (invalid or corrupted data), otherwise false.</returns>
+    static bool Parse(rapidjson_flax::Document& document, const byte* data, int32 length);
+};
@@ -312,7 +312,7 @@ void Serialization::Deserialize(ISerializable::DeserializeStream& stream, Varian
         Deserialize(value, *(Double3*)v.AsData, modifier);
         break;
     case VariantType::Double4:
-        Deserialize(value, *(Double4*)v.AsBlob.Data, modifier);
+        Deserialize(value, v.AsDouble4(), modifier);
         break;
     case VariantType::Int2:
         Deserialize(value, *(Int2*)v.AsData, modifier);
@@ -420,7 +420,7 @@ void ReadStream::Read(Variant& data)
         ReadBytes(&data.AsData, sizeof(Double3));
         break;
     case VariantType::Double4:
-        ReadBytes(data.AsBlob.Data, sizeof(Double4));
+        ReadBytes(&data.AsDouble4(), sizeof(Double4));
         break;
     case VariantType::Color:
         ReadBytes(&data.AsData, sizeof(Color));
@@ -866,7 +866,7 @@ void WriteStream::Write(const Variant& data)
         WriteBytes(data.AsData, sizeof(Double3));
         break;
     case VariantType::Double4:
-        WriteBytes(data.AsBlob.Data, sizeof(Double4));
+        WriteBytes(&data.AsDouble4(), sizeof(Double4));
         break;
     case VariantType::Color:
         WriteBytes(data.AsData, sizeof(Color));
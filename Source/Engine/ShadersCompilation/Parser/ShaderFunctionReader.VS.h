@@ -109,9 +109,11 @@ namespace ShaderProcessing
                     return;
                 }
 
-                // Visible state
+                // Visible state (optionally negated with '!' prefix which is a separator for the tokenizer)
                 text.ReadToken(&token);
                 element.VisibleFlag = token.ToString();
+                if (*(token.Start - 1) == '!')
+                    element.VisibleFlag = "!" + element.VisibleFlag;
 
                 current.InputLayout.Add(element);
             }
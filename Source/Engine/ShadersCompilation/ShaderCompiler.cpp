@@ -342,6 +342,9 @@ bool ShaderCompiler::WriteCustomDataVS(ShaderCompilationContext* context, Shader
 
         // Parse using all input macros
         StringAnsi value = element.VisibleFlag;
+        const bool negate = value.StartsWith('!');
+        if (negate)
+            value = value.Substring(1);
         for (int32 j = 0; j < macros.Count() - 1; j++)
         {
             if (macros[j].Name == value)
@@ -354,12 +357,20 @@ bool ShaderCompiler::WriteCustomDataVS(ShaderCompilationContext* context, Shader
         if (value == "true" || value == "1")
         {
             // Visible
-            layoutSize++;
-            layoutVisible[i] = true;
+            if (!negate)
+            {
+                layoutSize++;
+                layoutVisible[i] = true;
+            }
         }
         else if (value == "false" || value == "0")
         {
             // Hidden
+            if (negate)
+            {
+                layoutSize++;
+                layoutVisible[i] = true;
+            }
         }
         else
         {
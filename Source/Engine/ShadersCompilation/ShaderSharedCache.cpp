@@ -0,0 +1,246 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#if COMPILE_WITH_SHADER_COMPILER
+
+#include "ShaderSharedCache.h"
+#include "ShadersCompilation.h"
+#include "Engine/Core/Log.h"
+#include "Engine/Core/Types/Guid.h"
+#include "Engine/Core/Types/DateTime.h"
+#include "Engine/Core/Types/TimeSpan.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Engine/CommandLine.h"
+#include "Engine/Engine/Globals.h"
+#include "Engine/Graphics/Shaders/GPUShader.h"
+#include "Engine/Platform/File.h"
+#include "Engine/Platform/FileSystem.h"
+#include "Engine/Platform/CriticalSection.h"
+#include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Serialization/MemoryReadStream.h"
+#include "Engine/Serialization/MemoryWriteStream.h"
+#include "Engine/Utilities/Crc.h"
+
+// Version of the shared cache entries format
+#define SHADER_SHARED_CACHE_VERSION 1
+
+// The age (in days) after which the local cache entries are removed
+#define SHADER_LOCAL_CACHE_MAX_AGE 14
+
+namespace
+{
+    struct IncludedFileHash
+    {
+        DateTime LastEditTime;
+        uint32 Hash;
+    };
+
+    // Cached hashes of the included files contents (to not read the same headers for every shader)
+    CriticalSection IncludesHashesLocker;
+    Dictionary<String, IncludedFileHash> IncludesHashes;
+
+    String GetLocalRoot()
+    {
+#if USE_EDITOR
+        return Globals::ProjectCacheFolder / TEXT("Shaders/Cache/Source");
+#else
+        return String::Empty;
+#endif
+    }
+
+    String GetRoot()
+    {
+#if USE_EDITOR
+        if (CommandLine::Options.SharedShaderCache.HasValue())
+            return CommandLine::Options.SharedShaderCache.GetValue();
+#endif
+        return GetLocalRoot();
+    }
+
+    bool GetIncludeHash(const String& path, uint32& hash)
+    {
+        if (!FileSystem::FileExists(path))
+            return true;
+        const DateTime lastEditTime = FileSystem::GetFileLastEditTime(path);
+        {
+            ScopeLock lock(IncludesHashesLocker);
+            const IncludedFileHash* cached = IncludesHashes.TryGet(path);
+            if (cached && cached->LastEditTime == lastEditTime)
+            {
+                hash = cached->Hash;
+                return false;
+            }
+        }
+        Array<byte> data;
+        if (File::ReadAllBytes(path, data))
+            return true;
+        hash = Crc::MemCrc32(data.Get(), data.Count());
+        ScopeLock lock(IncludesHashesLocker);
+        IncludesHashes[path] = { lastEditTime, hash };
+        return false;
+    }
+
+    void WriteKey(const ShaderCompilationOptions& options, MemoryWriteStream& key)
+    {
+        key.WriteInt32(GPU_SHADER_CACHE_VERSION);
+        key.WriteByte((byte)options.Profile);
+        key.WriteBool(options.NoOptimize);
+        key.WriteBool(options.GenerateDebugData);
+        key.WriteBool(options.TreatWarningsAsErrors);
+        if (options.GenerateDebugData)
+            key.WriteString(options.TargetName); // Debug data contains the source file name
+        key.WriteInt32(options.Macros.Count());
+        for (const ShaderMacro& macro : options.Macros)
+        {
+            key.WriteStringAnsi(StringAnsiView(macro.Name ? macro.Name : ""));
+            key.WriteStringAnsi(StringAnsiView(macro.Definition ? macro.Definition : ""));
+        }
+        key.WriteUint32(options.SourceLength);
+        key.WriteBytes(options.Source, options.SourceLength);
+    }
+
+    String GetEntryPath(const ShaderCompilationOptions& options, const MemoryWriteStream& key)
+    {
+        const uint32 hash = Crc::MemCrc32(key.GetHandle(), key.GetPosition());
+        return GetRoot() / ::ToString(options.Profile) / String::Format(TEXT("{0:x}_{1:x}.cache"), hash, key.GetPosition());
+    }
+}
+
+bool ShaderSharedCache::IsEnabled()
+{
+    return GetRoot().HasChars();
+}
+
+bool ShaderSharedCache::TryGet(const ShaderCompilationOptions& options)
+{
+    auto output = options.Output;
+    if (!IsEnabled() || output->GetPosition() != 0)
+        return false;
+    PROFILE_CPU();
+
+    // Find entry for the shader contents
+    MemoryWriteStream key(options.SourceLength + 1024);
+    WriteKey(options, key);
+    const String path = GetEntryPath(options, key);
+    if (!FileSystem::FileExists(path))
+        return false;
+    Array<byte> entry;
+    if (File::ReadAllBytes(path, entry) || entry.Count() < 8)
+        return false;
+    MemoryReadStream stream(entry.Get(), entry.Count());
+
+    // Validate the entry key (whole key is compared to prevent hash collisions)
+    int32 version, keyLength;
+    stream.ReadInt32(&version);
+    stream.ReadInt32(&keyLength);
+    if (version != SHADER_SHARED_CACHE_VERSION || keyLength != (int32)key.GetPosition() || stream.GetLength() - stream.GetPosition() < (uint32)keyLength)
+        return false;
+    if (Platform::MemoryCompare(stream.Move(keyLength), key.GetHandle(), keyLength) != 0)
+        return false;
+
+    // Validate the included files contents
+    int32 includesCount;
+    stream.ReadInt32(&includesCount);
+    Array<String> includes;
+    includes.Resize(includesCount);
+    for (int32 i = 0; i < includesCount; i++)
+    {
+        stream.ReadString(&includes[i], 11);
+        uint32 hash, localHash;
+        stream.ReadUint32(&hash);
+        if (GetIncludeHash(ShadersCompilation::ResolveShaderPath(includes[i]), localHash) || localHash != hash)
+            return false;
+    }
+
+    // Copy the compiled data and write the includes with the local files modification dates (see ShaderCompiler::Compile)
+    int32 dataLength;
+    stream.ReadInt32(&dataLength);
+    if (dataLength <= 0 || stream.GetLength() - stream.GetPosition() < (uint32)dataLength)
+        return false;
+    output->WriteBytes(stream.Move(dataLength), dataLength);
+    output->WriteInt32(includesCount);
+    for (const String& include : includes)
+    {
+        output->WriteString(include, 11);
+        const auto date = FileSystem::GetFileLastEditTime(ShadersCompilation::ResolveShaderPath(include));
+        output->Write(date);
+    }
+
+    return true;
+}
+
+void ShaderSharedCache::Set(const ShaderCompilationOptions& options)
+{
+    auto output = options.Output;
+    if (!IsEnabled() || output->GetPosition() < 8)
+        return;
+    PROFILE_CPU();
+
+    // Read the location of additional data that contains list of included source files
+    MemoryReadStream data(output->GetHandle(), output->GetPosition());
+    int32 version, additionalDataStart;
+    data.ReadInt32(&version);
+    data.ReadInt32(&additionalDataStart);
+    if (version != GPU_SHADER_CACHE_VERSION || additionalDataStart <= 0 || additionalDataStart > (int32)output->GetPosition())
+        return;
+    data.SetPosition(additionalDataStart);
+
+    // Write entry with the key, the includes contents hashes and the compiled data (without includes)
+    MemoryWriteStream key(options.SourceLength + 1024);
+    WriteKey(options, key);
+    MemoryWriteStream entry(key.GetPosition() + output->GetPosition() + 1024);
+    entry.WriteInt32(SHADER_SHARED_CACHE_VERSION);
+    entry.WriteInt32(key.GetPosition());
+    entry.WriteBytes(key.GetHandle(), key.GetPosition());
+    int32 includesCount;
+    data.ReadInt32(&includesCount);
+    entry.WriteInt32(includesCount);
+    for (int32 i = 0; i < includesCount; i++)
+    {
+        String include;
+        data.ReadString(&include, 11);
+        DateTime lastEditTime;
+        data.Read(lastEditTime);
+        uint32 hash;
+        if (GetIncludeHash(ShadersCompilation::ResolveShaderPath(include), hash))
+            return;
+        entry.WriteString(include, 11);
+        entry.WriteUint32(hash);
+    }
+    entry.WriteInt32(additionalDataStart);
+    entry.WriteBytes(output->GetHandle(), additionalDataStart);
+
+    // Save to the temporary file and move it to the target location to not expose partially written entries to the other machines
+    const String path = GetEntryPath(options, key);
+    const String folder = StringUtils::GetDirectoryName(path);
+    if (!FileSystem::DirectoryExists(folder) && FileSystem::CreateDirectory(folder))
+    {
+        LOG(Warning, "Cannot create shared shader cache directory '{0}'", folder);
+        return;
+    }
+    const String tempPath = path + TEXT(".") + Guid::New().ToString(Guid::FormatType::N);
+    if (entry.SaveToFile(tempPath) || FileSystem::MoveFile(path, tempPath, true))
+    {
+        LOG(Warning, "Cannot save shared shader cache entry '{0}'", path);
+        FileSystem::DeleteFile(tempPath);
+    }
+}
+
+void ShaderSharedCache::Cleanup()
+{
+    const String root = GetLocalRoot();
+    if (root.IsEmpty() || GetRoot() != root || !FileSystem::DirectoryExists(root))
+        return;
+    PROFILE_CPU();
+
+    // Remove entries that were not updated for a long time (eg. from old versions of the materials)
+    Array<String> files;
+    FileSystem::DirectoryGetFiles(files, root, TEXT("*"), DirectorySearchOption::AllDirectories);
+    const DateTime minEditTime = DateTime::NowUTC() - TimeSpan::FromDays(SHADER_LOCAL_CACHE_MAX_AGE);
+    for (const String& file : files)
+    {
+        if (FileSystem::GetFileLastEditTime(file) < minEditTime)
+            FileSystem::DeleteFile(file);
+    }
+}
+
+#endif
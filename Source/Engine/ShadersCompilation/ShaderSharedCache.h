@@ -0,0 +1,41 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#if COMPILE_WITH_SHADER_COMPILER
+
+#include "Config.h"
+#include "Engine/Core/Types/String.h"
+
+/// <summary>
+/// Shared shaders cache that can be used by multiple machines (eg. build servers and team members) via the network or local disk folder. Entries are addressed by content (shader source, macros, profile and compilation options) and validated against the included files contents, so they don't depend on the asset IDs or file timestamps.
+/// </summary>
+/// <remarks>Shared location is enabled with '-sharedshadercache !path!' command line argument. Otherwise, Editor uses the local cache in the project cache folder so shaders regenerated with unchanged source code (eg. material saved after graph edit that doesn't affect the generated code, or duplicated asset) are not compiled again.</remarks>
+class ShaderSharedCache
+{
+public:
+    /// <summary>
+    /// Checks if the shared cache is enabled.
+    /// </summary>
+    static bool IsEnabled();
+
+    /// <summary>
+    /// Tries to get the compiled shader cache from the shared cache. Writes the cache data to the compilation options output stream.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    /// <returns>True if found valid cache entry and written it to the output, otherwise false.</returns>
+    static bool TryGet(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Stores the compiled shader cache (written to the compilation options output stream) in the shared cache.
+    /// </summary>
+    /// <param name="options">The compilation options.</param>
+    static void Set(const ShaderCompilationOptions& options);
+
+    /// <summary>
+    /// Removes the old entries from the local cache (shared location is not modified).
+    /// </summary>
+    static void Cleanup();
+};
+
+#endif
@@ -5,6 +5,7 @@
 #include "ShadersCompilation.h"
 #include "ShaderCompilationContext.h"
 #include "ShaderDebugDataExporter.h"
+#include "ShaderSharedCache.h"
 #include "Config.h"
 #include "Parser/ShaderProcessing.h"
 #include "Parser/ShaderMeta.h"
@@ -148,6 +149,13 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
     const DateTime startTime = DateTime::NowUTC();
     const FeatureLevel featureLevel = RenderTools::GetFeatureLevel(options.Profile);
 
+    // Try to reuse the shader compiled on the other machine
+    if (ShaderSharedCache::TryGet(options))
+    {
+        LOG(Info, "Shader compilation '{0}' loaded from the shared cache (profile: {1})", options.TargetName, ::ToString(options.Profile));
+        return false;
+    }
+
     // Process shader source to collect metadata
     ShaderMeta meta;
     if (ShaderProcessing::Parser::Process(options.TargetName, options.Source, options.SourceLength, options.Macros, featureLevel, &meta))
@@ -205,6 +213,7 @@ bool ShadersCompilation::Compile(ShaderCompilationOptions& options)
         // Success
         const DateTime endTime = DateTime::NowUTC();
         LOG(Info, "Shader compilation '{0}' succeed in {1} ms (profile: {2})", options.TargetName, Math::CeilToInt(static_cast<float>((endTime - startTime).GetTotalMilliseconds())), ::ToString(options.Profile));
+        ShaderSharedCache::Set(options);
     }
 
     return result;
@@ -578,6 +587,9 @@ bool ShadersCompilationService::Init()
     RegisterShaderWatchers(Editor::Project, projects);
 #endif
 
+    // Remove old cached shaders
+    ShaderSharedCache::Cleanup();
+
     return false;
 }
 
@@ -31,6 +31,9 @@ bool ShadowsOfMordor::Builder::LightmapBuildCache::Init(const LightmapSettings*
 ShadowsOfMordor::Builder::SceneBuildCache::SceneBuildCache()
     : Scene(nullptr)
     , TempLightmapData(nullptr)
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    , PreviewLightmapData(nullptr)
+#endif
     , LightmapsCount(0)
     , HemispheresCount(0)
     , MergedHemispheresCount(0)
@@ -91,80 +94,82 @@ bool ShadowsOfMordor::Builder::SceneBuildCache::WaitForLightmaps()
 
 void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmaps()
 {
-    Texture* lightmaps[3];
     for (int32 lightmapIndex = 0; lightmapIndex < Lightmaps.Count(); lightmapIndex++)
+        UpdateLightmap(lightmapIndex, Lightmaps[lightmapIndex].LightmapData, false);
+}
+
+void ShadowsOfMordor::Builder::SceneBuildCache::UpdateLightmap(int32 lightmapIndex, GPUBuffer* data, bool preview)
+{
+    // Cache data
+    Texture* lightmaps[3];
+    auto lightmap = Scene->LightmapsData.GetLightmap(lightmapIndex);
+    ASSERT(lightmap);
+    lightmap->GetTextures(lightmaps);
+
+    // Download buffer data
+    if (data->DownloadData(ImportLightmapTextureData))
     {
-        // Cache data
-        auto& lightmapEntry = Lightmaps[lightmapIndex];
-        auto lightmap = Scene->LightmapsData.GetLightmap(lightmapIndex);
-        ASSERT(lightmap);
-        lightmap->GetTextures(lightmaps);
+        LOG(Error, "Cannot download LightmapData.");
+        return;
+    }
 
-        // Download buffer data
-        if (lightmapEntry.LightmapData->DownloadData(ImportLightmapTextureData))
-        {
-            LOG(Error, "Cannot download LightmapData.");
-            return;
-        }
+    // Import all textures but don't use file proxy to improve performance
+    for (int32 textureIndex = 0; textureIndex < NUM_SH_TARGETS; textureIndex++)
+    {
+        // Get asset name
+        String assetPath;
+        if (lightmaps[textureIndex])
+            assetPath = lightmaps[textureIndex]->GetPath();
+        else
+            Scene->LightmapsData.GetCachedLightmapPath(&assetPath, lightmapIndex, textureIndex);
 
-        // Import all textures but don't use file proxy to improve performance
-        for (int32 textureIndex = 0; textureIndex < NUM_SH_TARGETS; textureIndex++)
-        {
-            // Get asset name
-            String assetPath;
-            if (lightmaps[textureIndex])
-                assetPath = lightmaps[textureIndex]->GetPath();
-            else
-                Scene->LightmapsData.GetCachedLightmapPath(&assetPath, lightmapIndex, textureIndex);
-
-            // Import texture with custom options
+        // Import texture with custom options
 #if COMPILE_WITH_ASSETS_IMPORTER
-            Guid id = Guid::Empty;
-            ImportTexture::Options options;
-            options.Type = TextureFormatType::HdrRGBA;
-            options.IndependentChannels = true;
+        Guid id = Guid::Empty;
+        ImportTexture::Options options;
+        options.Type = TextureFormatType::HdrRGBA;
+        options.IndependentChannels = true;
 #if PLATFORM_WINDOWS
-            options.Compress = Scene->GetLightmapSettings().CompressLightmaps;
+        options.Compress = Scene->GetLightmapSettings().CompressLightmaps && !preview; // Skip compression of the previews to show them faster
 #else
-            options.Compress = false; // TODO: use better BC7 compressor that would handle alpha more precisely (otherwise lightmaps have artifacts, see TextureTool.stb.cpp)
+        options.Compress = false; // TODO: use better BC7 compressor that would handle alpha more precisely (otherwise lightmaps have artifacts, see TextureTool.stb.cpp)
 #endif
-            options.GenerateMipMaps = true;
-            options.IsAtlas = false;
-            options.sRGB = false;
-            options.NeverStream = false;
-            ImportLightmapIndex = lightmapIndex;
-            ImportLightmapTextureIndex = textureIndex;
-            options.InternalLoad.Bind<SceneBuildCache, &SceneBuildCache::onImportLightmap>(this);
-            if (AssetsImportingManager::Create(AssetsImportingManager::CreateTextureTag, assetPath, id, &options))
-            {
-                LOG(Error, "Cannot create new lightmap {0}:{1}", lightmapIndex, textureIndex);
-                return;
-            }
-            const auto result = Content::LoadAsync<Texture>(id);
-            if (result == nullptr)
+        options.GenerateMipMaps = true;
+        options.IsAtlas = false;
+        options.sRGB = false;
+        options.NeverStream = false;
+        ImportLightmapIndex = lightmapIndex;
+        ImportLightmapTextureIndex = textureIndex;
+        options.InternalLoad.Bind<SceneBuildCache, &SceneBuildCache::onImportLightmap>(this);
+        if (AssetsImportingManager::Create(AssetsImportingManager::CreateTextureTag, assetPath, id, &options))
+        {
+            LOG(Error, "Cannot create new lightmap {0}:{1}", lightmapIndex, textureIndex);
+            return;
+        }
+        const auto result = Content::LoadAsync<Texture>(id);
+        if (result == nullptr)
 #else
 #error "Cannot import lightmaps. Assets importer module iss missing."
-            auto result = nullptr;
+        auto result = nullptr;
 #endif
-            {
-                LOG(Error, "Cannot load new lightmap {0}:{1}", lightmapIndex, textureIndex);
-                return;
-            }
-
-            // Update lightmap
-            lightmap->UpdateTexture(result, textureIndex);
+        {
+            LOG(Error, "Cannot load new lightmap {0}:{1}", lightmapIndex, textureIndex);
+            return;
         }
 
+        // Update lightmap
+        lightmap->UpdateTexture(result, textureIndex);
+    }
+
 #if DEBUG_EXPORT_LIGHTMAPS_PREVIEW
-        // Temporary save lightmaps (after last bounce)
-        if (Builder->_giBounceRunningIndex == Builder->_bounceCount - 1)
-        {
-            exportLightmapPreview(this, lightmapIndex);
-        }
+    // Temporary save lightmaps (after last bounce)
+    if (Builder->_giBounceRunningIndex == Builder->_bounceCount - 1 && !preview)
+    {
+        exportLightmapPreview(this, lightmapIndex);
+    }
 #endif
 
-        ImportLightmapTextureData.Release();
-    }
+    ImportLightmapTextureData.Release();
 }
 
 bool ShadowsOfMordor::Builder::SceneBuildCache::Init(ShadowsOfMordor::Builder* builder, int32 index, ::Scene* scene)
@@ -177,6 +182,11 @@ bool ShadowsOfMordor::Builder::SceneBuildCache::Init(ShadowsOfMordor::Builder* b
     const auto elementsCount = atlasSize * atlasSize * NUM_SH_TARGETS;
     if (TempLightmapData->Init(GPUBufferDescription::Typed(elementsCount, HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT], true)))
         return true;
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    PreviewLightmapData = GPUDevice::Instance->CreateBuffer(TEXT("LightmapBuildCache.Preview"));
+    if (PreviewLightmapData->Init(GPUBufferDescription::Typed(elementsCount, HemispheresFormatToPixelFormat[HEMISPHERES_IRRADIANCE_FORMAT], true)))
+        return true;
+#endif
 
     LOG(Info, "Scene \'{0}\' quality: {1}", scene->GetName(), scene->Info.LightmapSettings.Quality);
     return false;
@@ -195,6 +205,9 @@ void ShadowsOfMordor::Builder::SceneBuildCache::Release()
     EntriesLocker.Unlock();
 
     SAFE_DELETE_GPU_RESOURCE(TempLightmapData);
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    SAFE_DELETE_GPU_RESOURCE(PreviewLightmapData);
+#endif
 }
 
 #if COMPILE_WITH_ASSETS_IMPORTER
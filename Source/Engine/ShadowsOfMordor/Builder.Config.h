@@ -46,6 +46,8 @@ namespace ShadowsOfMordor
 #define HEMISPHERES_IRRADIANCE_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
 #define HEMISPHERES_BAKE_STATE_SAVE 1
 #define HEMISPHERES_BAKE_STATE_SAVE_DELAY 300
+#define HEMISPHERES_PROGRESSIVE_PREVIEW 1
+#define HEMISPHERES_PROGRESSIVE_LEVELS 3
 #define CACHE_ENTRIES_PER_JOB 10
 #define CACHE_POSITIONS_FORMAT HEMISPHERES_FORMAT_R32G32B32A32
 #define CACHE_NORMALS_FORMAT HEMISPHERES_FORMAT_R16G16B16A16
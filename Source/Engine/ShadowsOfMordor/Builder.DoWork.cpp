@@ -43,7 +43,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
             // Continue the hemispheres rendering for the last scene from the cached position
             {
                 _workerActiveSceneIndex = firstScene;
-                if (runStage(RenderHemispheres, false))
+                if (renderHemispheres(false))
                     return true;
 
                 // Fill black holes with blurred data to prevent artifacts on the edges
@@ -71,7 +71,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
 
                 // Render all registered Hemispheres rendering
                 _workerStagePosition0 = 0;
-                if (runStage(RenderHemispheres))
+                if (renderHemispheres())
                     return true;
 
                 // Fill black holes with blurred data to prevent artifacts on the edges
@@ -119,7 +119,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
 
                 // Render all registered Hemispheres rendering
                 _workerStagePosition0 = 0;
-                if (runStage(RenderHemispheres))
+                if (renderHemispheres())
                     return true;
 
                 // Fill black holes with blurred data to prevent artifacts on the edges
@@ -274,7 +274,7 @@ bool ShadowsOfMordor::Builder::doWorkInner(DateTime buildStart)
 
             // Render all registered Hemispheres rendering
             _workerStagePosition0 = 0;
-            if (runStage(RenderHemispheres))
+            if (renderHemispheres())
                 return true;
 
             // Fill black holes with blurred data to prevent artifacts on the edges
@@ -171,6 +171,23 @@ void ShadowsOfMordor::Builder::generateHemispheres()
             }
         }
 
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+        // Order hemispheres from the coarse to the fine texels grid (keeps the order within the level) so the lightmap can be previewed before all texels are baked
+        {
+            Array<HemisphereData> hemispheres;
+            hemispheres.EnsureCapacity(lightmapEntry.Hemispheres.Count());
+            for (int32 level = 0; level < HEMISPHERES_PROGRESSIVE_LEVELS; level++)
+            {
+                for (const HemisphereData& hemisphere : lightmapEntry.Hemispheres)
+                {
+                    if (hemisphere.GetRefinementLevel() == level)
+                        hemispheres.Add(hemisphere);
+                }
+            }
+            lightmapEntry.Hemispheres = MoveTemp(hemispheres);
+        }
+#endif
+
         // Progress Point
         reportProgress(BuildProgressStep::GenerateHemispheresCache, (float)_workerStagePosition0 / lightmapsCount);
         if (checkBuildCancelled())
@@ -351,9 +351,21 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         {
             if (hemispheresToRenderLeft == 0)
                 break;
-            hemispheresToRenderLeft--;
             auto& hemisphere = lightmapEntry.Hemispheres[_workerStagePosition1];
 
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+            // Stop after finishing the refinement level of the lightmap in the first bounce to show its preview (lightmaps are not used by the first bounce)
+            const int32 refinementLevel = hemisphere.GetRefinementLevel();
+            if (_giBounceRunningIndex == 0 && _workerStagePosition1 != 0 && refinementLevel > lightmapEntry.PreviewLevel)
+            {
+                lightmapEntry.PreviewLevel = refinementLevel;
+                _previewLightmapIndex = _workerStagePosition0;
+                _wasStageDone = true;
+                break;
+            }
+#endif
+            hemispheresToRenderLeft--;
+
             // Create tangent frame
             Float3 tangent;
             Float3 c1 = Float3::Cross(hemisphere.Normal, Float3(0.0, 0.0, 1.0));
@@ -459,46 +471,8 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
     {
         PROFILE_GPU_CPU_NAMED("PostprocessLightmaps");
 
-        // Let's blur generated lightmaps to reduce amount of black artifacts and holes
-
-        // Prepare
         auto& lightmapEntry = scene->Lightmaps[_workerStagePosition0];
-        ShaderData shaderData;
-        shaderData.AtlasSize = atlasSize;
-        auto cb = _shader->GetShader()->GetCB(0);
-        context->UpdateCB(cb, &shaderData);
-        context->BindCB(0, cb);
-
-        // Blur empty lightmap texel to reduce black artifacts during sampling lightmap on objects
-        context->ResetRenderTarget();
-        context->BindSR(0, lightmapEntry.LightmapData->View());
-        context->BindUA(0, scene->TempLightmapData->View());
-        context->Dispatch(_shader->GetShader()->GetCS("CS_BlurEmpty"), atlasSize, atlasSize, 1);
-
-        // Swap temporary buffer used as output with lightmap entry data (these buffers are the same)
-        // So we can rewrite data from one buffer to another with custom sampling
-        Swap(scene->TempLightmapData, lightmapEntry.LightmapData);
-
-        // Keep blurring the empty lightmap texels (from background)
-        int32 blurPasses = 24;
-        if (context->GetDevice()->GetRendererType() == RendererType::DirectX12)
-            blurPasses = 0; // TODO: fix CS_Dilate passes on D3D12 (probably UAV synchronization issue)
-        for (int32 blurPassIndex = 0; blurPassIndex < blurPasses; blurPassIndex++)
-        {
-            context->ResetSR();
-            context->ResetUA();
-
-            context->BindSR(0, lightmapEntry.LightmapData->View());
-            context->BindUA(0, scene->TempLightmapData->View());
-            context->Dispatch(_shader->GetShader()->GetCS("CS_Dilate"), atlasSize, atlasSize, 1);
-
-            Swap(scene->TempLightmapData, lightmapEntry.LightmapData);
-        }
-        context->UnBindSR(0);
-        context->BindUA(0, lightmapEntry.LightmapData->View());
-
-        // Remove the BACKGROUND_TEXELS_MARK from the unused texels (see shader for more info)
-        context->Dispatch(_shader->GetShader()->GetCS("CS_Finalize"), atlasSize, atlasSize, 1);
+        postprocessLightmap(context, scene, lightmapEntry.LightmapData, lightmapEntry.LightmapData);
 
         // Move to another lightmap
         _workerStagePosition0++;
@@ -510,6 +484,19 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
         }
         break;
     }
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    case PreviewLightmap:
+    {
+        PROFILE_GPU_CPU_NAMED("PreviewLightmap");
+
+        // Postprocess the partially baked lightmap into the preview buffer (texels that are not baked yet are filled like the empty ones)
+        auto& lightmapEntry = scene->Lightmaps[_previewLightmapIndex];
+        postprocessLightmap(context, scene, lightmapEntry.LightmapData, scene->PreviewLightmapData);
+
+        _wasStageDone = true;
+        break;
+    }
+#endif
     }
 
     // Cleanup after rendering
@@ -527,6 +514,50 @@ void ShadowsOfMordor::Builder::onJobRender(GPUContext* context)
     }
 }
 
+void ShadowsOfMordor::Builder::postprocessLightmap(GPUContext* context, SceneBuildCache* scene, GPUBuffer* input, GPUBuffer*& output)
+{
+    // Let's blur generated lightmaps to reduce amount of black artifacts and holes
+
+    // Prepare
+    const int32 atlasSize = (int32)scene->GetSettings().AtlasSize;
+    ShaderData shaderData;
+    shaderData.AtlasSize = atlasSize;
+    auto cb = _shader->GetShader()->GetCB(0);
+    context->UpdateCB(cb, &shaderData);
+    context->BindCB(0, cb);
+
+    // Blur empty lightmap texel to reduce black artifacts during sampling lightmap on objects
+    context->ResetRenderTarget();
+    context->BindSR(0, input->View());
+    context->BindUA(0, scene->TempLightmapData->View());
+    context->Dispatch(_shader->GetShader()->GetCS("CS_BlurEmpty"), atlasSize, atlasSize, 1);
+
+    // Swap temporary buffer used as output with the output data (these buffers are the same)
+    // So we can rewrite data from one buffer to another with custom sampling
+    Swap(scene->TempLightmapData, output);
+
+    // Keep blurring the empty lightmap texels (from background)
+    int32 blurPasses = 24;
+    if (context->GetDevice()->GetRendererType() == RendererType::DirectX12)
+        blurPasses = 0; // TODO: fix CS_Dilate passes on D3D12 (probably UAV synchronization issue)
+    for (int32 blurPassIndex = 0; blurPassIndex < blurPasses; blurPassIndex++)
+    {
+        context->ResetSR();
+        context->ResetUA();
+
+        context->BindSR(0, output->View());
+        context->BindUA(0, scene->TempLightmapData->View());
+        context->Dispatch(_shader->GetShader()->GetCS("CS_Dilate"), atlasSize, atlasSize, 1);
+
+        Swap(scene->TempLightmapData, output);
+    }
+    context->UnBindSR(0);
+    context->BindUA(0, output->View());
+
+    // Remove the BACKGROUND_TEXELS_MARK from the unused texels (see shader for more info)
+    context->Dispatch(_shader->GetShader()->GetCS("CS_Finalize"), atlasSize, atlasSize, 1);
+}
+
 bool ShadowsOfMordor::Builder::checkBuildCancelled()
 {
     const bool wasCancelled = Platform::AtomicRead(&_wasBuildCancelled) != 0;
@@ -577,3 +608,30 @@ bool ShadowsOfMordor::Builder::runStage(BuildingStage stage, bool resetPosition)
 
     return wasCancelled;
 }
+
+bool ShadowsOfMordor::Builder::renderHemispheres(bool resetPosition)
+{
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    _previewLightmapIndex = -1;
+#endif
+    if (runStage(RenderHemispheres, resetPosition))
+        return true;
+
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+    // Update the lightmap preview after every refinement level and continue rendering from the last position
+    while (_previewLightmapIndex != -1)
+    {
+        if (runStage(PreviewLightmap, false))
+            return true;
+        if (waitForJobDataSync())
+            return true;
+        auto scene = _scenes[_workerActiveSceneIndex];
+        scene->UpdateLightmap(_previewLightmapIndex, scene->PreviewLightmapData, true);
+        _previewLightmapIndex = -1;
+        if (runStage(RenderHemispheres, false))
+            return true;
+    }
+#endif
+
+    return false;
+}
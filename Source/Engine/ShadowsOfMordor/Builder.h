@@ -97,6 +97,7 @@ namespace ShadowsOfMordor
             ClearLightmapData,
             RenderHemispheres,
             PostprocessLightmaps,
+            PreviewLightmap,
         };
 
         /// <summary>
@@ -109,6 +110,20 @@ namespace ShadowsOfMordor
 
             int16 TexelX;
             int16 TexelY;
+
+            /// <summary>
+            /// Gets the progressive refinement level of the hemisphere texel (0 for the coarsest texels grid). Hemispheres of the lower levels are rendered first.
+            /// </summary>
+            int32 GetRefinementLevel() const
+            {
+                for (int32 level = 0; level < HEMISPHERES_PROGRESSIVE_LEVELS - 1; level++)
+                {
+                    const int32 stride = 1 << (HEMISPHERES_PROGRESSIVE_LEVELS - 1 - level);
+                    if (TexelX % stride == 0 && TexelY % stride == 0)
+                        return level;
+                }
+                return HEMISPHERES_PROGRESSIVE_LEVELS - 1;
+            }
         };
 
         /// <summary>
@@ -121,6 +136,10 @@ namespace ShadowsOfMordor
             Array<int32> Entries;
             Array<HemisphereData> Hemispheres;
             GPUBuffer* LightmapData = nullptr;
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+            // The refinement level of the hemispheres for which the last preview was made
+            int32 PreviewLevel = 0;
+#endif
 #if HEMISPHERES_BAKE_STATE_SAVE
             // Restored data for the lightmap from the loaded state (copied to the LightmapData on first hemispheres render job)
             Array<byte> LightmapDataInit;
@@ -149,6 +168,9 @@ namespace ShadowsOfMordor
             LightmapUVsChartsCollection Charts;
             Array<LightmapBuildCache> Lightmaps;
             GPUBuffer* TempLightmapData;
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+            GPUBuffer* PreviewLightmapData;
+#endif
 
             // Stats
             int32 LightmapsCount;
@@ -183,6 +205,14 @@ namespace ShadowsOfMordor
             /// </summary>
             void UpdateLightmaps();
 
+            /// <summary>
+            /// Updates the lightmap textures data.
+            /// </summary>
+            /// <param name="lightmapIndex">The lightmap index.</param>
+            /// <param name="data">The lightmap data buffer (postprocessed).</param>
+            /// <param name="preview">True if update lightmap with the preview data (during baking), otherwise false.</param>
+            void UpdateLightmap(int32 lightmapIndex, GPUBuffer* data, bool preview);
+
             /// <summary>
             /// Initializes this instance.
             /// </summary>
@@ -238,6 +268,9 @@ namespace ShadowsOfMordor
         int32 _bounceCount;
         int32 _hemispheresPerJob;
         DateTime _hemispheresPerJobUpdateTime;
+#if HEMISPHERES_PROGRESSIVE_PREVIEW
+        int32 _previewLightmapIndex = -1;
+#endif
 #if HEMISPHERES_BAKE_STATE_SAVE
         DateTime _lastStateSaveTime;
         bool _firstStateSave;
@@ -314,6 +347,8 @@ namespace ShadowsOfMordor
         void onJobRender(GPUContext* context);
         bool checkBuildCancelled();
         bool runStage(BuildingStage stage, bool resetPosition = true);
+        bool renderHemispheres(bool resetPosition = true);
+        void postprocessLightmap(GPUContext* context, SceneBuildCache* scene, GPUBuffer* input, GPUBuffer*& output);
         bool initResources();
         void releaseResources();
         bool waitForJobDataSync();
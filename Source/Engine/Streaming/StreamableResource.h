@@ -79,6 +79,16 @@ class FLAXENGINE_API StreamableResource
     /// </summary>
     virtual int32 GetAllocatedResidency() const = 0;
 
+    /// <summary>
+    /// Gets the estimated memory usage (in bytes) of the resource data at the given residency level. Used by the streaming budgets (see StreamingBudget).
+    /// </summary>
+    /// <param name="residency">The residency level.</param>
+    /// <returns>The memory size (in bytes). Zero if unknown.</returns>
+    virtual uint64 GetMemoryUsage(int32 residency) const
+    {
+        return 0;
+    }
+
 public:
 
     /// <summary>
@@ -113,6 +123,8 @@ class FLAXENGINE_API StreamableResource
         double LastUpdateTime = 0.0;
         double TargetResidencyChangeTime = 0;
         int32 TargetResidency = 0;
+        uint64 InFlightBytes = 0;
+        double RequestTime = 0.0;
         bool Error = false;
         SamplesBuffer<float, 5> QualitySamples;
     };
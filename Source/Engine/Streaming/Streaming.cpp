@@ -10,6 +10,7 @@
 #include "Engine/Threading/Threading.h"
 #include "Engine/Threading/TaskGraph.h"
 #include "Engine/Threading/Task.h"
+#include "Engine/Content/Loading/ContentLoadTask.h"
 #include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/Textures/GPUSampler.h"
 #include "Engine/Serialization/Serialization.h"
@@ -21,6 +22,40 @@ namespace StreamingManagerImpl
     Array<StreamableResource*> Resources;
     Array<GPUSampler*, InlinedAllocation<32>> TextureGroupSamplers;
     GPUSampler* FallbackSampler = nullptr;
+
+    // Streaming budget and statistics state per group type (accessed within ResourcesLock)
+    struct GroupState
+    {
+        uint64 InFlightBytes = 0;
+        uint64 UploadBytes = 0;
+        uint64 ResidentBytes = 0;
+        float QualityScale = 1.0f;
+        float MemoryBudgetScale = 1.0f;
+        float AverageLatency = 0.0f;
+        uint64 EvictionsCount = 0;
+    };
+
+    GroupState GroupStates[StreamingGroup::Type_Count];
+
+    const StreamingBudget* GetBudget(StreamingGroup::Type type)
+    {
+        switch (type)
+        {
+        case StreamingGroup::Type::Textures:
+            return &Streaming::TexturesBudget;
+        case StreamingGroup::Type::Models:
+            return &Streaming::ModelsBudget;
+        case StreamingGroup::Type::Audio:
+            return &Streaming::AudioBudget;
+        default:
+            return nullptr;
+        }
+    }
+
+    FORCE_INLINE uint64 MegabytesToBytes(int32 value)
+    {
+        return (uint64)value * 1024 * 1024;
+    }
 }
 
 using namespace StreamingManagerImpl;
@@ -29,7 +64,7 @@ class StreamingService : public EngineService
 {
 public:
     StreamingService()
-        : EngineService(TEXT("Streaming"), 100)
+        : EngineService(TEXT("Streaming"), 100, true)
     {
     }
 
@@ -52,10 +87,16 @@ namespace
 StreamingService StreamingServiceInstance;
 
 Array<TextureGroup, InlinedAllocation<32>> Streaming::TextureGroups;
+StreamingBudget Streaming::TexturesBudget;
+StreamingBudget Streaming::ModelsBudget;
+StreamingBudget Streaming::AudioBudget;
 
 void StreamingSettings::Apply()
 {
     Streaming::TextureGroups = TextureGroups;
+    Streaming::TexturesBudget = TexturesBudget;
+    Streaming::ModelsBudget = ModelsBudget;
+    Streaming::AudioBudget = AudioBudget;
     SAFE_DELETE_GPU_RESOURCES(TextureGroupSamplers);
     TextureGroupSamplers.Resize(TextureGroups.Count(), false);
 }
@@ -63,6 +104,9 @@ void StreamingSettings::Apply()
 void StreamingSettings::Deserialize(DeserializeStream& stream, ISerializeModifier* modifier)
 {
     DESERIALIZE(TextureGroups);
+    DESERIALIZE(TexturesBudget);
+    DESERIALIZE(ModelsBudget);
+    DESERIALIZE(AudioBudget);
 }
 
 StreamableResource::StreamableResource(StreamingGroup* group)
@@ -109,6 +153,7 @@ void StreamableResource::StopStreaming()
     {
         ResourcesLock.Lock();
         Resources.Remove(this);
+        GroupStates[(int32)_group->GetType()].InFlightBytes -= Streaming.InFlightBytes;
         ResourcesLock.Unlock();
         Streaming = StreamingCache();
         _isStreaming = false;
@@ -117,6 +162,7 @@ void StreamableResource::StopStreaming()
 
 void UpdateResource(StreamableResource* resource, double currentTime)
 {
+    PROFILE_CPU();
     ASSERT(resource && resource->CanBeUpdated());
 
     // Pick group and handler dedicated for that resource
@@ -136,6 +182,12 @@ void UpdateResource(StreamableResource* resource, double currentTime)
     targetQuality = resource->Streaming.QualitySamples.Maximum();
     targetQuality = Math::Saturate(targetQuality);
 
+    // Lower the quality when over the memory budget (resources with lower quality, eg. further away, are lowered more)
+    auto& budgetState = GroupStates[(int32)group->GetType()];
+    const float qualityScale = Math::Min(budgetState.QualityScale, budgetState.MemoryBudgetScale);
+    if (qualityScale < 1.0f)
+        targetQuality = Math::Pow(targetQuality, 1.0f / qualityScale);
+
     // Calculate target residency level (discrete value)
     auto maxResidency = resource->GetMaxResidency();
     auto currentResidency = resource->GetCurrentResidency();
@@ -155,6 +207,28 @@ void UpdateResource(StreamableResource* resource, double currentTime)
     // Check if need to change resource current residency
     if (handler->RequiresStreaming(resource, currentResidency, targetResidency))
     {
+        PROFILE_CPU_NAMED("Streaming.Request");
+
+        // Calculate residency level to stream in (resources may want to increase/decrease it's quality in steps rather than at once)
+        int32 requestedResidency = handler->CalculateRequestedResidency(resource, targetResidency);
+
+        // Check the streaming limits (always allow a single request to not block the large resources)
+        uint64 streamingBytes = 0;
+        const StreamingBudget* budget = GetBudget(group->GetType());
+        if (budget && requestedResidency > currentResidency)
+        {
+            const uint64 currentBytes = resource->GetMemoryUsage(currentResidency);
+            streamingBytes = Math::Max(resource->GetMemoryUsage(requestedResidency), currentBytes) - currentBytes;
+            if ((budget->MaxInFlightMB != 0 && budgetState.InFlightBytes != 0 && budgetState.InFlightBytes + streamingBytes > MegabytesToBytes(budget->MaxInFlightMB)) ||
+                (budget->MaxUploadPerFrameMB != 0 && budgetState.UploadBytes != 0 && budgetState.UploadBytes + streamingBytes > MegabytesToBytes(budget->MaxUploadPerFrameMB)))
+            {
+                // Try again later
+                PROFILE_CPU_NAMED("Streaming.Defer");
+                resource->RequestStreamingUpdate();
+                return;
+            }
+        }
+
         // Check if need to change allocation for that resource
         if (allocatedResidency != targetResidency)
         {
@@ -175,13 +249,26 @@ void UpdateResource(StreamableResource* resource, double currentTime)
             }
         }
 
-        // Calculate residency level to stream in (resources may want to increase/decrease it's quality in steps rather than at once)
-        int32 requestedResidency = handler->CalculateRequestedResidency(resource, targetResidency);
-
         // Create streaming task (resource type specific)
         Task* streamingTask = resource->CreateStreamingTask(requestedResidency);
         if (streamingTask != nullptr)
         {
+            // Load streamed data after the assets that are needed now, unless resource is far from the target quality (eg. after camera teleport)
+            const auto priority = targetResidency - currentResidency > maxResidency / 2 ? ContentLoadTask::Priority::Normal : ContentLoadTask::Priority::Low;
+            for (Task* task = streamingTask; task; task = task->GetContinueWithTask())
+            {
+                if (auto contentTask = dynamic_cast<ContentLoadTask*>(task))
+                    contentTask->SetPriority(priority);
+            }
+
+            // Track data during streaming (released once resource can be updated again)
+            resource->Streaming.InFlightBytes = streamingBytes;
+            resource->Streaming.RequestTime = currentTime;
+            budgetState.InFlightBytes += streamingBytes;
+            budgetState.UploadBytes += streamingBytes;
+            if (requestedResidency < currentResidency)
+                budgetState.EvictionsCount++;
+
             streamingTask->Start();
         }
     }
@@ -233,6 +320,63 @@ void StreamingSystem::Job(int32 index)
     int32 resourcesUpdates = Math::Min(MaxResourcesPerUpdate, resourcesCount);
     const double currentTime = Platform::GetTimeSeconds();
 
+    // Update streaming budgets
+    bool updateResidentMemory = false;
+    for (int32 type = 0; type < StreamingGroup::Type_Count; type++)
+    {
+        auto& state = GroupStates[type];
+        const StreamingBudget* budget = GetBudget((StreamingGroup::Type)type);
+        state.UploadBytes = 0;
+        state.ResidentBytes = 0;
+        if (!budget || budget->MaxResidentMB == 0)
+            state.QualityScale = 1.0f;
+        else
+            updateResidentMemory = true;
+    }
+    for (StreamableResource* resource : Resources)
+    {
+        auto& state = GroupStates[(int32)resource->GetGroup()->GetType()];
+        if (resource->Streaming.RequestTime > 0.0 && resource->CanBeUpdated())
+        {
+            // Streaming request has been completed
+            const float latency = (float)(currentTime - resource->Streaming.RequestTime);
+            state.AverageLatency = state.AverageLatency > 0.0f ? Math::Lerp(state.AverageLatency, latency, 0.1f) : latency;
+            state.InFlightBytes -= resource->Streaming.InFlightBytes;
+            resource->Streaming.InFlightBytes = 0;
+            resource->Streaming.RequestTime = 0.0;
+        }
+        if (updateResidentMemory)
+            state.ResidentBytes += resource->GetMemoryUsage(resource->GetCurrentResidency());
+    }
+    if (updateResidentMemory)
+    {
+        for (int32 type = 0; type < StreamingGroup::Type_Count; type++)
+        {
+            // Smoothly lower the quality when over the budget and restore it when there is enough memory
+            auto& state = GroupStates[type];
+            const StreamingBudget* budget = GetBudget((StreamingGroup::Type)type);
+            if (!budget || budget->MaxResidentMB == 0)
+                continue;
+            const uint64 maxResidentBytes = MegabytesToBytes(budget->MaxResidentMB);
+            if (state.ResidentBytes > maxResidentBytes)
+                state.QualityScale = Math::Max(state.QualityScale - 0.01f, 0.1f);
+            else if (state.ResidentBytes < maxResidentBytes * 9 / 10)
+                state.QualityScale = Math::Min(state.QualityScale + 0.005f, 1.0f);
+        }
+    }
+
+    // Smoothly lower the quality of GPU resources when the application exceeds the video memory budget given by the OS (it can shrink at runtime, eg. when other applications use the GPU memory)
+    uint64 gpuBudget, gpuUsage;
+    const bool hasGpuBudget = !GPUDevice::Instance->QueryMemoryBudget(gpuBudget, gpuUsage) && gpuBudget != 0;
+    for (const auto type : { StreamingGroup::Type::Textures, StreamingGroup::Type::Models })
+    {
+        auto& state = GroupStates[(int32)type];
+        if (hasGpuBudget && gpuUsage > gpuBudget / 20 * 19)
+            state.MemoryBudgetScale = Math::Max(state.MemoryBudgetScale - 0.02f, 0.1f);
+        else if (!hasGpuBudget || gpuUsage < gpuBudget / 20 * 17)
+            state.MemoryBudgetScale = Math::Min(state.MemoryBudgetScale + 0.005f, 1.0f);
+    }
+
     // Update high priority queue and then rest of the resources
     // Note: resources in the update queue are updated always, while others only between specified intervals
     int32 resourcesChecks = resourcesCount;
@@ -270,13 +414,41 @@ void StreamingSystem::Execute(TaskGraph* graph)
 
 StreamingStats Streaming::GetStats()
 {
+    PROFILE_CPU();
     StreamingStats stats;
+    StreamingGroupStats* groupStats[StreamingGroup::Type_Count] = { nullptr, &stats.Textures, &stats.Models, &stats.Audio, &stats.Animations, &stats.Terrain };
     ResourcesLock.Lock();
     stats.ResourcesCount = Resources.Count();
     for (auto e : Resources)
     {
-        if (e->Streaming.TargetResidency > e->GetCurrentResidency())
+        const int32 currentResidency = e->GetCurrentResidency();
+        if (e->Streaming.TargetResidency > currentResidency)
             stats.StreamingResourcesCount++;
+        StreamingGroupStats* group = groupStats[(int32)e->GetGroup()->GetType()];
+        if (!group)
+            continue;
+        group->ResourcesCount++;
+        if (e->Streaming.TargetResidency > currentResidency)
+            group->StreamingInCount++;
+        else if (e->Streaming.TargetResidency < currentResidency)
+            group->StreamingOutCount++;
+        if (e->Streaming.RequestTime > 0.0)
+            group->PendingRequestsCount++;
+        group->ResidentBytes += e->GetMemoryUsage(currentResidency);
+        while (currentResidency >= group->ResidencyHistogram.Count())
+            group->ResidencyHistogram.Add(0);
+        group->ResidencyHistogram[currentResidency]++;
+    }
+    for (int32 type = 0; type < StreamingGroup::Type_Count; type++)
+    {
+        const auto& state = GroupStates[type];
+        stats.InFlightBytes += state.InFlightBytes;
+        if (StreamingGroupStats* group = groupStats[type])
+        {
+            group->InFlightBytes = state.InFlightBytes;
+            group->AverageRequestLatency = state.AverageLatency;
+            group->EvictionsCount = state.EvictionsCount;
+        }
     }
     ResourcesLock.Unlock();
     return stats;
@@ -5,9 +5,34 @@
 #include "Engine/Core/Collections/Array.h"
 #include "Engine/Scripting/ScriptingType.h"
 #include "TextureGroup.h"
+#include "StreamingBudget.h"
 
 class GPUSampler;
 
+// Streaming statistics container for a single streaming group (eg. textures).
+API_STRUCT(NoDefault) struct FLAXENGINE_API StreamingGroupStats
+{
+DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingGroupStats);
+    // Amount of active streamable resources.
+    API_FIELD() int32 ResourcesCount = 0;
+    // Amount of resources that are streaming in (target residency is higher than the current).
+    API_FIELD() int32 StreamingInCount = 0;
+    // Amount of resources that are streaming out (target residency is lower than the current).
+    API_FIELD() int32 StreamingOutCount = 0;
+    // Amount of streaming requests that are in progress (streaming queue depth).
+    API_FIELD() int32 PendingRequestsCount = 0;
+    // Amount of memory (in bytes) used by the resources at their current residency.
+    API_FIELD() uint64 ResidentBytes = 0;
+    // Amount of data (in bytes) that is during streaming in (pending data loading and GPU uploads).
+    API_FIELD() uint64 InFlightBytes = 0;
+    // Average time (in seconds) between starting the streaming request and its completion (smoothed over the recent requests).
+    API_FIELD() float AverageRequestLatency = 0.0f;
+    // Total amount of streaming requests that decreased the resource residency (eg. texture mips unloaded).
+    API_FIELD() uint64 EvictionsCount = 0;
+    // Amount of resources per current residency level (index is the residency, eg. loaded mips count for textures).
+    API_FIELD() Array<int32> ResidencyHistogram;
+};
+
 // Streaming service statistics container.
 API_STRUCT(NoDefault) struct FLAXENGINE_API StreamingStats
 {
@@ -16,6 +41,18 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingStats);
     API_FIELD() int32 ResourcesCount = 0;
     // Amount of resources that are during streaming in (target residency is higher that the current). Zero if all resources are streamed in.
     API_FIELD() int32 StreamingResourcesCount = 0;
+    // Amount of data (in bytes) that is during streaming in (pending data loading and GPU uploads).
+    API_FIELD() uint64 InFlightBytes = 0;
+    // Textures streaming statistics.
+    API_FIELD() StreamingGroupStats Textures;
+    // Models streaming statistics.
+    API_FIELD() StreamingGroupStats Models;
+    // Audio streaming statistics.
+    API_FIELD() StreamingGroupStats Audio;
+    // Animations streaming statistics.
+    API_FIELD() StreamingGroupStats Animations;
+    // Terrain (collision) streaming statistics.
+    API_FIELD() StreamingGroupStats Terrain;
 };
 
 /// <summary>
@@ -30,6 +67,21 @@ DECLARE_SCRIPTING_TYPE_NO_SPAWN(Streaming);
     /// </summary>
     API_FIELD() static Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// Textures streaming limits.
+    /// </summary>
+    API_FIELD() static StreamingBudget TexturesBudget;
+
+    /// <summary>
+    /// Models streaming limits.
+    /// </summary>
+    API_FIELD() static StreamingBudget ModelsBudget;
+
+    /// <summary>
+    /// Audio streaming limits.
+    /// </summary>
+    API_FIELD() static StreamingBudget AudioBudget;
+
     /// <summary>
     /// Gets streaming statistics.
     /// </summary>
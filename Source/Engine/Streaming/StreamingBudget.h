@@ -0,0 +1,33 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Core/ISerializable.h"
+#include "Engine/Scripting/ScriptingType.h"
+
+/// <summary>
+/// Settings container for the streaming limits of a group of resources (eg. textures). Used to smooth out the hitches when many resources change residency at once. Use 0 to disable a limit.
+/// </summary>
+API_STRUCT() struct StreamingBudget : ISerializable
+{
+API_AUTO_SERIALIZATION();
+DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingBudget);
+
+    /// <summary>
+    /// The maximum amount of data (in megabytes) that can be streamed in at once (pending data loading and GPU uploads). New streaming requests wait until the previous ones are done.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(10), Limit(0), EditorDisplay(null, \"Max In-Flight (MB)\")")
+    int32 MaxInFlightMB = 256;
+
+    /// <summary>
+    /// The maximum amount of data (in megabytes) that can be requested to stream in during a single frame.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(20), Limit(0), EditorDisplay(null, \"Max Upload Per Frame (MB)\")")
+    int32 MaxUploadPerFrameMB = 32;
+
+    /// <summary>
+    /// The maximum amount of memory (in megabytes) used by the streamed resources data. When exceeded, the streaming gradually lowers the quality of the resources (the lower target quality, eg. further away ones, the more it's lowered).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(30), Limit(0), EditorDisplay(null, \"Max Resident (MB)\")")
+    int32 MaxResidentMB = 0;
+};
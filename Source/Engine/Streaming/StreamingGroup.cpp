@@ -15,6 +15,8 @@ StreamingGroups::StreamingGroups()
     , _models(nullptr)
     , _skinnedModels(nullptr)
     , _audio(nullptr)
+    , _animations(nullptr)
+    , _terrain(nullptr)
     , _groups(8)
 {
     // Register in-build streaming groups
@@ -22,6 +24,8 @@ StreamingGroups::StreamingGroups()
     Add(_models = New<StreamingGroup>(StreamingGroup::Type::Models, New<ModelsStreamingHandler>()));
     Add(_skinnedModels = New<StreamingGroup>(StreamingGroup::Type::Models, New<SkinnedModelsStreamingHandler>()));
     Add(_audio = New<StreamingGroup>(StreamingGroup::Type::Audio, New<AudioStreamingHandler>()));
+    Add(_animations = New<StreamingGroup>(StreamingGroup::Type::Animations, New<AnimationsStreamingHandler>()));
+    Add(_terrain = New<StreamingGroup>(StreamingGroup::Type::Terrain, New<TerrainStreamingHandler>()));
 }
 
 StreamingGroups::~StreamingGroups()
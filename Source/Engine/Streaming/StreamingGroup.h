@@ -14,7 +14,7 @@ class FLAXENGINE_API StreamingGroup
 {
 public:
 
-    DECLARE_ENUM_4(Type, Custom, Textures, Models, Audio);
+    DECLARE_ENUM_6(Type, Custom, Textures, Models, Audio, Animations, Terrain);
 
 protected:
 
@@ -68,6 +68,8 @@ class FLAXENGINE_API StreamingGroups : public Singleton<StreamingGroups>
     StreamingGroup* _models;
     StreamingGroup* _skinnedModels;
     StreamingGroup* _audio;
+    StreamingGroup* _animations;
+    StreamingGroup* _terrain;
 
     Array<StreamingGroup*> _groups;
     Array<IStreamingHandler*> _handlers;
@@ -111,6 +113,22 @@ class FLAXENGINE_API StreamingGroups : public Singleton<StreamingGroups>
         return _audio;
     }
 
+    /// <summary>
+    /// Gets animations group.
+    /// </summary>
+    FORCE_INLINE StreamingGroup* Animations() const
+    {
+        return _animations;
+    }
+
+    /// <summary>
+    /// Gets terrain patches group (collision data).
+    /// </summary>
+    FORCE_INLINE StreamingGroup* Terrain() const
+    {
+        return _terrain;
+    }
+
 public:
 
     /// <summary>
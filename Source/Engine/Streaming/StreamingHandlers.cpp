@@ -7,9 +7,11 @@
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Content/Assets/SkinnedModel.h"
+#include "Engine/Content/Assets/Animation.h"
 #include "Engine/Audio/AudioClip.h"
 #include "Engine/Audio/Audio.h"
 #include "Engine/Audio/AudioSource.h"
+#include "Engine/Terrain/TerrainPatch.h"
 
 float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
 {
@@ -17,6 +19,7 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
     auto& texture = *(StreamingTexture*)resource;
     const TextureHeader& header = *texture.GetHeader();
     float result = 1.0f;
+    bool useFeedback = false;
     if (header.TextureGroup >= 0 && header.TextureGroup < Streaming::TextureGroups.Count())
     {
         // Quality based on texture group settings
@@ -29,6 +32,16 @@ float TexturesStreamingHandler::CalculateTargetQuality(StreamableResource* resou
         {
             result *= group.QualityIfInvisible;
         }
+
+        useFeedback = group.UseRenderingFeedback;
+    }
+
+    // Limit quality to the mips used by the rendering
+    if (useFeedback || texture.GetForceFeedback())
+    {
+        const int32 feedbackResidency = texture.ConsumeFeedback();
+        if (feedbackResidency > 0)
+            result = Math::Min(result, (float)feedbackResidency / (float)texture.TotalMipLevels());
     }
     return result;
 }
@@ -194,15 +207,20 @@ int32 AudioStreamingHandler::CalculateResidency(StreamableResource* resource, fl
         const auto src = Audio::Sources[sourceIndex];
         if (src->Clip == clip && src->GetState() != AudioSource::States::Stopped)
         {
-            // Stream the current and the next chunk if could be used in a while
+            // Stream the current chunk and the next chunks that will be played within the read-ahead time
             const int32 chunk = src->_streamingFirstChunk;
             ASSERT(Math::IsInRange(chunk, 0, chunksCount));
             chunksMask[chunk] = true;
-            
-            const float StreamingDstSec = 2.0f; // TODO: make it configurable via StreamingSettings
-            if (chunk + 1 < chunksCount && src->GetTime() + StreamingDstSec >= clip->GetBufferStartTime(src->_streamingFirstChunk))
+            const float readAheadTime = src->GetTime() + clip->GetStreamingReadAhead();
+            for (int32 i = chunk + 1; i < chunksCount && clip->GetBufferStartTime(i) <= readAheadTime; i++)
+            {
+                chunksMask[i] = true;
+            }
+
+            // Preload the first chunk when looped playback gets close to the end
+            if (src->GetIsLooping() && readAheadTime >= clip->GetLength())
             {
-                chunksMask[chunk + 1] = true;
+                chunksMask[0] = true;
             }
         }
     }
@@ -231,3 +249,52 @@ bool AudioStreamingHandler::RequiresStreaming(StreamableResource* resource, int3
     const auto clip = static_cast<AudioClip*>(resource);
     return clip->StreamingQueue.HasItems();
 }
+
+float AnimationsStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
+{
+    // Animations don't use quality but only residency
+    return 1.0f;
+}
+
+int32 AnimationsStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
+{
+    ASSERT(resource);
+    auto anim = static_cast<Animation*>(resource);
+
+    // Find segments required for the playback (fills the streaming queue)
+    return anim->UpdateStreamingSegments(Platform::GetTimeSeconds());
+}
+
+int32 AnimationsStreamingHandler::CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency)
+{
+    // No smoothing or slowdown in residency change
+    return targetResidency;
+}
+
+bool AnimationsStreamingHandler::RequiresStreaming(StreamableResource* resource, int32 currentResidency, int32 targetResidency)
+{
+    // Animations use streaming queue buffer to detect streaming request start
+    const auto anim = static_cast<Animation*>(resource);
+    return anim->StreamingQueue.HasItems();
+}
+
+float TerrainStreamingHandler::CalculateTargetQuality(StreamableResource* resource, double currentTime)
+{
+    ASSERT(resource);
+    auto patch = static_cast<TerrainPatch*>(resource);
+
+    // Quality based on the distance to the streaming sources
+    return patch->CalculateStreamingQuality();
+}
+
+int32 TerrainStreamingHandler::CalculateResidency(StreamableResource* resource, float quality)
+{
+    // Terrain patch has collision or not
+    return quality > ZeroTolerance ? 1 : 0;
+}
+
+int32 TerrainStreamingHandler::CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency)
+{
+    // No smoothing or slowdown in residency change
+    return targetResidency;
+}
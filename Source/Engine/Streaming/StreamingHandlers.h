@@ -52,3 +52,28 @@ class FLAXENGINE_API AudioStreamingHandler : public IStreamingHandler
     int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
     bool RequiresStreaming(StreamableResource* resource, int32 currentResidency, int32 targetResidency) override;
 };
+
+/// <summary>
+/// Implementation of IStreamingHandler for animation clips (streamed in time segments).
+/// </summary>
+class FLAXENGINE_API AnimationsStreamingHandler : public IStreamingHandler
+{
+public:
+    // [IStreamingHandler]
+    float CalculateTargetQuality(StreamableResource* resource, double currentTime) override;
+    int32 CalculateResidency(StreamableResource* resource, float quality) override;
+    int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+    bool RequiresStreaming(StreamableResource* resource, int32 currentResidency, int32 targetResidency) override;
+};
+
+/// <summary>
+/// Implementation of IStreamingHandler for terrain patches (collision streamed around the streaming sources).
+/// </summary>
+class FLAXENGINE_API TerrainStreamingHandler : public IStreamingHandler
+{
+public:
+    // [IStreamingHandler]
+    float CalculateTargetQuality(StreamableResource* resource, double currentTime) override;
+    int32 CalculateResidency(StreamableResource* resource, float quality) override;
+    int32 CalculateRequestedResidency(StreamableResource* resource, int32 targetResidency) override;
+};
@@ -4,6 +4,7 @@
 
 #include "Engine/Core/Config/Settings.h"
 #include "TextureGroup.h"
+#include "StreamingBudget.h"
 
 /// <summary>
 /// Content streaming settings.
@@ -19,6 +20,24 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(StreamingSettings);
     API_FIELD(Attributes="EditorOrder(100), EditorDisplay(\"Textures\")")
     Array<TextureGroup, InlinedAllocation<32>> TextureGroups;
 
+    /// <summary>
+    /// Textures streaming limits.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(200), EditorDisplay(\"Budgets\")")
+    StreamingBudget TexturesBudget;
+
+    /// <summary>
+    /// Models streaming limits.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(210), EditorDisplay(\"Budgets\")")
+    StreamingBudget ModelsBudget;
+
+    /// <summary>
+    /// Audio streaming limits.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(220), EditorDisplay(\"Budgets\")")
+    StreamingBudget AudioBudget;
+
 public:
 
     /// <summary>
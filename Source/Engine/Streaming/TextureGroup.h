@@ -71,6 +71,12 @@ DECLARE_SCRIPTING_TYPE_MINIMAL(TextureGroup);
     API_FIELD(Attributes="EditorOrder(50), Limit(-14, 14)")
     int32 MipLevelsBias = 0;
 
+    /// <summary>
+    /// Enables using the rendering feedback to limit the loaded mip levels for textures in this group. The geometry drawn with the material that uses the texture reports its size on the screen and the texture streams only the mips needed for that size (plus MipLevelsBias). Reduces memory usage of the textures used only by the distant objects.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(55)")
+    bool UseRenderingFeedback = false;
+
 #if USE_EDITOR
     /// <summary>
     /// The per-platform maximum amount of mip levels for textures in this group. Can be used to strip textures quality when cooking the game for a target platform.
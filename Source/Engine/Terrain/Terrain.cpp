@@ -2,6 +2,7 @@
 
 #include "Terrain.h"
 #include "TerrainPatch.h"
+#include "TerrainManager.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Ray.h"
 #include "Engine/Level/Scene/SceneRendering.h"
@@ -9,14 +10,25 @@
 #include "Engine/Physics/Physics.h"
 #include "Engine/Physics/PhysicalMaterial.h"
 #include "Engine/Physics/PhysicsBackend.h"
+#include "Engine/Graphics/GPUBuffer.h"
+#include "Engine/Graphics/GPUDevice.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Graphics/RenderTask.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
+#include "Engine/Graphics/Textures/StreamingTexture.h"
 #include "Engine/Level/Scene/Scene.h"
+#include "Engine/Level/WorldPartition.h"
 #include "Engine/Physics/PhysicsScene.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include "Engine/Renderer/GlobalSignDistanceFieldPass.h"
+#include "Engine/Renderer/HZBOcclusion.h"
+#include "Engine/Renderer/RenderList.h"
+#include "Engine/Renderer/TerrainCullingPass.h"
 #include "Engine/Renderer/GI/GlobalSurfaceAtlasPass.h"
+#if USE_EDITOR
+#include "Editor/Editor.h"
+#endif
 
 Terrain::Terrain(const SpawnParams& params)
     : PhysicsColliderActor(params)
@@ -38,6 +50,7 @@ Terrain::~Terrain()
 {
     // Cleanup
     _patches.ClearDelete();
+    SAFE_DELETE_GPU_RESOURCE(_cullingChunks);
 }
 
 void Terrain::UpdateBounds()
@@ -51,6 +64,7 @@ void Terrain::UpdateBounds()
         BoundingBox::Merge(_box, patch->_bounds, _box);
     }
     BoundingSphere::FromBox(_box, _sphere);
+    _cullingDirty = true;
     if (_sceneRenderingKey != -1)
         GetSceneRendering()->UpdateActor(this, _sceneRenderingKey);
 }
@@ -58,6 +72,7 @@ void Terrain::UpdateBounds()
 void Terrain::CacheNeighbors()
 {
     PROFILE_CPU();
+    _cullingDirty = true;
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
@@ -68,6 +83,16 @@ void Terrain::CacheNeighbors()
     }
 }
 
+bool Terrain::UseCollisionStreaming() const
+{
+#if USE_EDITOR
+    // Keep the collision when editing the scene (used by the terrain tools)
+    if (!Editor::IsPlayMode)
+        return false;
+#endif
+    return StreamCollision;
+}
+
 void Terrain::UpdateLayerBits()
 {
     if (_patches.IsEmpty())
@@ -515,11 +540,17 @@ void Terrain::Draw(RenderContextBatch& renderContextBatch)
     if (DrawSetup(renderContextBatch.GetMainContext()))
         return;
     HashSet<TerrainChunk*, RendererAllocation> drawnChunks;
+    const bool useGPUCulling = TerrainCullingPass::Instance()->CanUse(renderContextBatch);
     for (RenderContext& renderContext : renderContextBatch.Contexts)
     {
         const DrawPass drawModes = DrawModes & renderContext.View.Pass;
         if (drawModes == DrawPass::None)
             continue;
+
+        // Cull chunks and select their LODs on GPU
+        if (useGPUCulling && DrawGPU(renderContextBatch, renderContext))
+            continue;
+
         DrawImpl(renderContext, drawnChunks);
     }
 }
@@ -602,6 +633,7 @@ void Terrain::DrawImpl(RenderContext& renderContext, HashSet<TerrainChunk*, Rend
     // Frustum vs Box culling for patches
     const BoundingFrustum frustum = renderContext.View.CullingFrustum;
     const Vector3 origin = renderContext.View.Origin;
+    const HZBOcclusion* occlusion = renderContext.View.Occlusion;
     for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
     {
         const auto patch = _patches[patchIndex];
@@ -619,6 +651,10 @@ void Terrain::DrawImpl(RenderContext& renderContext, HashSet<TerrainChunk*, Rend
                 bounds = BoundingBox(chunk->_bounds.Minimum - origin, chunk->_bounds.Maximum - origin);
                 if (renderContext.View.IsCullingDisabled || frustum.Intersects(bounds))
                 {
+                    // Occlusion culling
+                    if (occlusion && occlusion->IsOccluded(chunk->_bounds))
+                        continue;
+
                     if (!drawnChunks.Contains(chunk) && !chunk->PrepareDraw(renderContext))
                         continue;
 
@@ -637,6 +673,214 @@ void Terrain::DrawImpl(RenderContext& renderContext, HashSet<TerrainChunk*, Rend
     }
 }
 
+bool Terrain::DrawGPU(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext)
+{
+    const RenderView& view = renderContext.View;
+#if USE_EDITOR
+    if (view.Mode == ViewMode::LightmapUVsDensity)
+        return false;
+#endif
+
+    // Indirect draws of the patches use the same material and no per-chunk lightmaps
+    const bool useLightmaps = EnumHasAnyFlags(_staticFlags, StaticFlags::Lightmap) && GetScene();
+    MaterialBase* material = Material.Get();
+    if (!material || !material->IsLoaded())
+        material = TerrainManager::GetDefaultTerrainMaterial();
+    if (!material || !material->IsReady() || !material->IsTerrain())
+        return false;
+    const DrawPass drawModes = DrawModes & view.Pass & material->GetDrawModes() & (DrawPass::Depth | DrawPass::GBuffer);
+    if (drawModes == DrawPass::None)
+        return false;
+    for (const TerrainPatch* patch : _patches)
+    {
+        for (int32 chunkIndex = 0; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+        {
+            const TerrainChunk& chunk = patch->Chunks[chunkIndex];
+            if (chunk.OverrideMaterial || (useLightmaps && chunk.HasLightmap()))
+                return false;
+        }
+    }
+
+    // Update chunks data (positions are relative to the main view origin)
+    const Vector3 origin = renderContextBatch.GetMainContext().View.Origin;
+    if ((_cullingDirty || _cullingOrigin != origin) && UpdateCullingChunks(origin))
+        return false;
+
+    // Frustum culling for patches and the LODs range estimation for the chunks of the visible patches (LOD of each chunk is selected on GPU)
+    const float chunkEdgeSize = _chunkSize * TERRAIN_UNITS_PER_VERTEX;
+    const RenderView& lodView = renderContext.LodProxyView ? *renderContext.LodProxyView : view;
+    const Vector3 lodViewPosition = lodView.Origin + lodView.Position;
+    Array<TerrainCullingPatch, RendererAllocation> patches;
+    Array<GPUDrawIndexedIndirectArgs, RendererAllocation> draws;
+    patches.Resize(_patches.Count());
+    DrawCall drawCall;
+    for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
+    {
+        TerrainPatch* patch = _patches.Get()[patchIndex];
+        TerrainCullingPatch& patchData = patches.Get()[patchIndex];
+        Platform::MemoryClear(&patchData, sizeof(patchData));
+        patchData.DrawsStart = MAX_uint32;
+        if (patch->Heightmap == nullptr || patch->Heightmap->GetTexture()->ResidentMipLevels() == 0)
+            continue;
+        const int32 lodCount = patch->Heightmap.Get()->StreamingTexture()->TotalMipLevels();
+        const int32 minStreamedLod = lodCount - patch->Heightmap.Get()->GetTexture()->ResidentMipLevels();
+        patchData.MinLOD = minStreamedLod;
+        patchData.MaxLOD = lodCount - 1;
+        const BoundingBox bounds(patch->_bounds.Minimum - view.Origin, patch->_bounds.Maximum - view.Origin);
+        if (!view.IsCullingDisabled && !view.CullingFrustum.Intersects(bounds))
+            continue;
+        int32 lodMin, lodMax;
+        if (_forcedLod >= 0)
+        {
+            lodMin = lodMax = _forcedLod;
+        }
+        else
+        {
+            // Chunks centers are inside the patch bounds
+            const Vector3 farthest = Vector3::Max(lodViewPosition - patch->_bounds.Minimum, patch->_bounds.Maximum - lodViewPosition);
+            lodMin = (int32)Math::Pow((float)patch->_bounds.Distance(lodViewPosition) / chunkEdgeSize, _lodDistribution) + _lodBias;
+            lodMax = (int32)Math::Pow((float)farthest.Length() / chunkEdgeSize, _lodDistribution) + _lodBias;
+        }
+
+        // Report the needed heightmap and splatmaps mips to the streaming (for the closest chunk that uses the highest quality)
+        if (EnumHasAnyFlags(view.Pass, DrawPass::GBuffer))
+        {
+            const TerrainChunk* closestChunk = &patch->Chunks[0];
+            for (int32 chunkIndex = 1; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+            {
+                const TerrainChunk* chunk = &patch->Chunks[chunkIndex];
+                if (Vector3::DistanceSquared(chunk->_sphere.Center, lodViewPosition) < Vector3::DistanceSquared(closestChunk->_sphere.Center, lodViewPosition))
+                    closestChunk = chunk;
+            }
+            closestChunk->ReportStreamingFeedback(renderContext, Math::Clamp(lodMin, 0, lodCount - 1));
+        }
+
+        // Add a single draw per LOD
+        lodMin = Math::Clamp(lodMin, minStreamedLod, lodCount - 1);
+        lodMax = Math::Clamp(lodMax, lodMin, lodCount - 1);
+        patchData.DrawsStart = draws.Count();
+        patchData.DrawsMinLOD = lodMin;
+        patchData.DrawsMaxLOD = lodMax;
+        for (int32 lod = lodMin; lod <= lodMax; lod++)
+        {
+            if (TerrainManager::GetChunkGeometry(drawCall, _chunkSize, lod))
+                return false;
+            auto& args = draws.AddOne();
+            args.IndicesCount = drawCall.Draw.IndicesCount;
+            args.InstanceCount = 0;
+            args.StartIndex = drawCall.Draw.StartIndex;
+            args.StartVertex = 0;
+            args.StartInstance = 0;
+        }
+    }
+    if (draws.IsEmpty())
+        return true;
+
+    // Cull chunks on GPU (after draw calls collection)
+    auto cullingPass = TerrainCullingPass::Instance();
+    const int32 drawsStart = cullingPass->AddCull(renderContextBatch, renderContext, _cullingChunks, _patches.Count() * Terrain::ChunksCount, origin, patches.Get(), patches.Count(), draws.Get(), draws.Count(), chunkEdgeSize, _lodDistribution, _lodBias, _forcedLod);
+    if (drawsStart == -1)
+        return false;
+
+    // Submit indirect draw calls that use the visible chunks instances buffer
+    for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
+    {
+        const TerrainCullingPatch& patchData = patches.Get()[patchIndex];
+        if (patchData.DrawsStart == MAX_uint32)
+            continue;
+        const TerrainPatch* patch = _patches.Get()[patchIndex];
+        Transform patchTransform;
+        patchTransform.Translation = patch->_offset + Vector3(0, patch->_yOffset, 0);
+        patchTransform.Orientation = Quaternion::Identity;
+        patchTransform.Scale = Float3(1.0f, patch->_yHeight, 1.0f);
+        patchTransform = _transform.LocalToWorld(patchTransform);
+        for (int32 lod = (int32)patchData.DrawsMinLOD; lod <= (int32)patchData.DrawsMaxLOD; lod++)
+        {
+            BatchedDrawCall batch;
+            DrawCall& patchDrawCall = batch.DrawCall;
+            TerrainManager::GetChunkGeometry(patchDrawCall, _chunkSize, lod);
+            patchDrawCall.InstanceCount = 0;
+            patchDrawCall.Draw.IndirectArgsBuffer = cullingPass->GetArgsBuffer();
+            patchDrawCall.Draw.IndirectArgsOffset = (drawsStart + patchData.DrawsStart + lod - patchData.DrawsMinLOD) * sizeof(GPUDrawIndexedIndirectArgs);
+            patchDrawCall.Material = material;
+            view.GetWorldMatrix(patchTransform, patchDrawCall.World);
+            patchDrawCall.ObjectPosition = patchDrawCall.World.GetTranslation();
+            patchDrawCall.ObjectRadius = (float)(patch->_bounds.GetSize().Length() * 0.5f);
+            patchDrawCall.Terrain.Patch = patch;
+            patchDrawCall.Terrain.HeightmapUVScaleBias = Float4::Zero;
+            patchDrawCall.Terrain.OffsetUV = Vector2::Zero;
+            patchDrawCall.Terrain.CurrentLOD = (float)lod;
+            patchDrawCall.Terrain.ChunkSizeNextLOD = (float)(((_chunkSize + 1) >> (lod + 1)) - 1);
+            patchDrawCall.Terrain.TerrainChunkSizeLOD0 = chunkEdgeSize;
+            patchDrawCall.Terrain.NeighborLOD = Float4::Zero;
+            patchDrawCall.Terrain.Lightmap = nullptr;
+            patchDrawCall.Terrain.LightmapUVsArea = Rectangle::Empty;
+            patchDrawCall.WorldDeterminantSign = Math::FloatSelect(patchDrawCall.World.RotDeterminant(), 1, -1);
+            patchDrawCall.PerInstanceRandom = patch->Chunks[0]._perInstanceRandom;
+            batch.InstanceBuffer = cullingPass->GetInstancesBuffer();
+            batch.InstanceBufferData = nullptr;
+            batch.InstanceBufferOffset = 0;
+            batch.InstanceBufferCount = TERRAIN_CULLING_SLOTS_PER_DRAW;
+
+            // Add draw call batch to proper draw lists
+            const int32 batchIndex = renderContext.List->BatchedDrawCalls.Add(MoveTemp(batch));
+            if (EnumHasAnyFlags(drawModes, DrawPass::Depth))
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::Depth].PreBatchedDrawCalls.Add(batchIndex);
+            if (EnumHasAnyFlags(drawModes, DrawPass::GBuffer))
+                renderContext.List->DrawCallsLists[(int32)DrawCallsListType::GBuffer].PreBatchedDrawCalls.Add(batchIndex);
+        }
+    }
+    return true;
+}
+
+bool Terrain::UpdateCullingChunks(const Vector3& origin)
+{
+    PROFILE_CPU();
+    const float chunkSize = _chunkSize * TERRAIN_UNITS_PER_VERTEX;
+    Array<TerrainCullingChunk, RendererAllocation> chunks;
+    chunks.Resize(_patches.Count() * Terrain::ChunksCount);
+    for (int32 patchIndex = 0; patchIndex < _patches.Count(); patchIndex++)
+    {
+        TerrainPatch* patch = _patches.Get()[patchIndex];
+        for (int32 chunkIndex = 0; chunkIndex < Terrain::ChunksCount; chunkIndex++)
+        {
+            TerrainChunk* chunk = &patch->Chunks[chunkIndex];
+            if (!chunk->_neighbors[0])
+                chunk->CacheNeighbors();
+            auto& data = chunks.Get()[patchIndex * Terrain::ChunksCount + chunkIndex];
+            data.BoundsMin = Float3(chunk->_bounds.Minimum - origin);
+            data.PatchIndex = patchIndex;
+            data.BoundsMax = Float3(chunk->_bounds.Maximum - origin);
+            data.Dummy0 = 0;
+            data.SphereCenter = Float3(chunk->_sphere.Center - origin);
+            data.Dummy1 = 0;
+            for (int32 i = 0; i < 4; i++)
+            {
+                const TerrainChunk* neighbor = chunk->_neighbors[i];
+                const int32 neighborPatchIndex = _patches.Find(neighbor->_patch);
+                data.Neighbors[i] = neighborPatchIndex != -1 ? neighborPatchIndex * Terrain::ChunksCount + (int32)(neighbor - neighbor->_patch->Chunks) : patchIndex * Terrain::ChunksCount + chunkIndex;
+            }
+            data.HeightmapUVScaleBias = chunk->_heightmapUVScaleBias;
+            data.OffsetUV = Float2((float)(patch->_x * Terrain::ChunksCountEdge + chunk->_x), (float)(patch->_z * Terrain::ChunksCountEdge + chunk->_z));
+            data.LocalOffset = Float2(chunk->_x * chunkSize, chunk->_z * chunkSize);
+        }
+    }
+    if (chunks.IsEmpty())
+        return true;
+    if (!_cullingChunks)
+        _cullingChunks = GPUDevice::Instance->CreateBuffer(TEXT("Terrain.CullingChunks"));
+    auto desc = GPUBufferDescription::Structured(chunks.Count(), sizeof(TerrainCullingChunk));
+    desc.InitData = chunks.Get();
+    if (_cullingChunks->Init(desc))
+    {
+        LOG(Error, "Failed to create terrain culling buffer.");
+        return true;
+    }
+    _cullingOrigin = origin;
+    _cullingDirty = false;
+    return false;
+}
+
 #if USE_EDITOR
 
 //#include "Engine/Debug/DebugDraw.h"
@@ -704,6 +948,9 @@ void Terrain::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
     SERIALIZE(Material);
     SERIALIZE(DrawModes);
+    SERIALIZE(StreamTexturesByVisibility);
+    SERIALIZE(StreamCollision);
+    SERIALIZE(CollisionStreamingDistance);
 
     SERIALIZE_MEMBER(LODCount, _lodCount);
     SERIALIZE_MEMBER(ChunkSize, _chunkSize);
@@ -751,6 +998,9 @@ void Terrain::Deserialize(DeserializeStream& stream, ISerializeModifier* modifie
     DESERIALIZE_MEMBER(PhysicalMaterials, _physicalMaterials);
     DESERIALIZE(Material);
     DESERIALIZE(DrawModes);
+    DESERIALIZE(StreamTexturesByVisibility);
+    DESERIALIZE(StreamCollision);
+    DESERIALIZE(CollisionStreamingDistance);
 
     member = stream.FindMember("LODCount");
     if (member != stream.MemberEnd() && member->value.IsInt())
@@ -927,6 +1177,35 @@ void Terrain::BeginPlay(SceneBeginData* data)
 {
     CacheNeighbors();
     _cachedScale = _transform.Scale;
+
+    // Release collision data of the patches that are far from the streaming sources (if sources are not known yet then create collision for all patches and let the streaming unload it)
+    const bool streamCollision = UseCollisionStreaming();
+    if (streamCollision)
+    {
+        const Array<Vector3> sources = WorldPartition::GetStreamingSources();
+        if (sources.HasItems())
+        {
+            for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
+            {
+                const auto patch = _patches[pathIndex];
+                if (!patch->HasCollision() && !patch->IsInCollisionStreamingRange(sources))
+                    patch->ReleaseHeightfield();
+            }
+        }
+    }
+
+    if (_patches.Count() > 1)
+    {
+        // Create height fields in parallel (loading cooked collision is the most costly part of the collision setup)
+        PROFILE_CPU_NAMED("PrepareHeightFields");
+        Function<void(int32)> job = [this](int32 pathIndex)
+        {
+            const auto patch = _patches[pathIndex];
+            if (!patch->HasCollision())
+                patch->PrepareHeightField();
+        };
+        JobSystem::Wait(JobSystem::Dispatch(job, _patches.Count()));
+    }
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
@@ -934,6 +1213,10 @@ void Terrain::BeginPlay(SceneBeginData* data)
         {
             patch->CreateCollision();
         }
+        if (streamCollision)
+        {
+            patch->StartStreaming(true);
+        }
     }
     UpdateLayerBits();
 
@@ -946,6 +1229,8 @@ void Terrain::EndPlay()
     for (int32 pathIndex = 0; pathIndex < _patches.Count(); pathIndex++)
     {
         const auto patch = _patches[pathIndex];
+        patch->CancelStreamingTasks();
+        patch->StopStreaming();
         if (patch->HasCollision())
         {
             patch->DestroyCollision();
@@ -13,6 +13,7 @@ class TerrainManager;
 class PhysicalMaterial;
 struct RayCastHit;
 struct RenderView;
+class GPUBuffer;
 
 // Maximum amount of levels of detail for the terrain chunks
 #define TERRAIN_MAX_LODS 8
@@ -73,6 +74,9 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     Float3 _cachedScale;
     Array<TerrainPatch*, InlinedAllocation<64>> _patches;
     Array<JsonAssetReference<PhysicalMaterial>, FixedAllocation<8>> _physicalMaterials;
+    GPUBuffer* _cullingChunks = nullptr;
+    Vector3 _cullingOrigin = Vector3::Zero;
+    bool _cullingDirty = true;
 
 public:
     /// <summary>
@@ -93,6 +97,24 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     API_FIELD(Attributes="EditorOrder(115), DefaultValue(DrawPass.Default), EditorDisplay(\"Terrain\")")
     DrawPass DrawModes = DrawPass::Default;
 
+    /// <summary>
+    /// If checked, the terrain heightmaps and splatmaps stream only the mip levels needed by the visible chunks (based on the chunks LOD and size on the screen). Reduces the GPU memory usage of the large terrains that are mostly seen from a distance.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(116), DefaultValue(false), EditorDisplay(\"Terrain\")")
+    bool StreamTexturesByVisibility = false;
+
+    /// <summary>
+    /// If checked, the terrain patches have collision (and the cooked heightfield data loaded) only within the streaming distance from the streaming sources (see WorldPartition). Reduces the memory usage and the loading time of the large terrains. Used only during the game (collision is not streamed when editing the scene).
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(530), DefaultValue(false), EditorDisplay(\"Collision\")")
+    bool StreamCollision = false;
+
+    /// <summary>
+    /// The distance (from the patch bounds to the closest streaming source) within which terrain patch has collision. Used only if StreamCollision is checked.
+    /// </summary>
+    API_FIELD(Attributes="EditorOrder(540), DefaultValue(20000.0f), Limit(0), EditorDisplay(\"Collision\"), VisibleIf(nameof(StreamCollision))")
+    float CollisionStreamingDistance = 20000.0f;
+
 public:
     /// <summary>
     /// Gets the terrain Level Of Detail bias value. Allows to increase or decrease rendered terrain quality.
@@ -392,6 +414,7 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
     /// Updates the collider shapes collisions/queries layer mask bits.
     /// </summary>
     void UpdateLayerBits();
+    bool UseCollisionStreaming() const;
 
     /// <summary>
     /// Removes the lightmap data from the terrain.
@@ -446,6 +469,8 @@ API_CLASS(Sealed) class FLAXENGINE_API Terrain : public PhysicsColliderActor
 #endif
     bool DrawSetup(RenderContext& renderContext);
     void DrawImpl(RenderContext& renderContext, HashSet<TerrainChunk*, class RendererAllocation>& drawnChunks);
+    bool DrawGPU(const RenderContextBatch& renderContextBatch, const RenderContext& renderContext);
+    bool UpdateCullingChunks(const Vector3& origin);
 
 public:
     // [PhysicsColliderActor]
@@ -7,6 +7,7 @@
 #include "TerrainManager.h"
 #include "Engine/Graphics/RenderView.h"
 #include "Engine/Graphics/RenderTask.h"
+#include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Textures/GPUTexture.h"
 #include "Engine/Renderer/RenderList.h"
 #include "Engine/Core/Math/OrientedBoundingBox.h"
@@ -62,6 +63,11 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
         //lod = (int32)Vector2::Distance(Vector2(2, 2), Vector2(_patch->_x, _patch->_z) * Terrain::ChunksCountEdge + Vector2(_x, _z));
         //lod = (int32)(Vector3::Distance(_bounds.GetCenter(), view.Position) / 10000.0f);
     }
+
+    // Report the needed heightmap and splatmaps mips to the streaming
+    if (EnumHasAnyFlags(renderContext.View.Pass, DrawPass::GBuffer))
+        ReportStreamingFeedback(renderContext, Math::Clamp(lod, 0, lodCount - 1));
+
     lod = Math::Clamp(lod, minStreamedLod, lodCount - 1);
 
     // Pick a material
@@ -81,6 +87,34 @@ bool TerrainChunk::PrepareDraw(const RenderContext& renderContext)
     return true;
 }
 
+void TerrainChunk::ReportStreamingFeedback(const RenderContext& renderContext, int32 lod) const
+{
+    const bool enabled = _patch->_terrain->StreamTexturesByVisibility;
+    const StreamingTexture* heightmap = _patch->Heightmap.Get()->StreamingTexture();
+    heightmap->SetForceFeedback(enabled);
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+    {
+        if (Texture* splatmap = _patch->Splatmap[i].Get())
+            splatmap->StreamingTexture()->SetForceFeedback(enabled);
+    }
+    if (!enabled)
+        return;
+
+    // Heightmap mip matches the chunk LOD
+    heightmap->ReportFeedbackResidency(heightmap->TotalMipLevels() - lod);
+
+    // Splatmaps resolution is based on the chunk size on the screen (scaled to the whole patch size)
+    const RenderView& view = renderContext.View;
+    const float screenRadiusSquared = RenderTools::ComputeBoundsScreenRadiusSquared(_sphere.Center - view.Origin, (float)_sphere.Radius, view);
+    const float patchScreenSize = 2.0f * Math::Sqrt(screenRadiusSquared) * view.ScreenSize.Y * Terrain::ChunksCountEdge;
+    for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
+    {
+        Texture* splatmap = _patch->Splatmap[i].Get();
+        if (splatmap && splatmap->IsLoaded())
+            splatmap->StreamingTexture()->ReportFeedback(patchScreenSize);
+    }
+}
+
 void TerrainChunk::Draw(const RenderContext& renderContext) const
 {
     const int32 lod = _cachedDrawLOD;
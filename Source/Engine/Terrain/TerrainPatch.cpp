@@ -12,8 +12,11 @@
 #include "Engine/Physics/CollisionCooking.h"
 #include "Engine/Level/Scene/Scene.h"
 #include "Engine/Level/Level.h"
+#include "Engine/Level/WorldPartition.h"
+#include "Engine/Streaming/StreamingGroup.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Threading/Threading.h"
+#include "Engine/Threading/MainThreadTask.h"
 #if TERRAIN_EDITING
 #include "Engine/Core/Math/Packed.h"
 #include "Engine/Graphics/PixelFormatExtensions.h"
@@ -38,6 +41,9 @@
 
 #define TERRAIN_PATCH_COLLISION_QUANTIZATION ((float)0x7fff)
 
+// The scale of the collision streaming distance at which patch collision gets unloaded (prevents collision reloading when streaming source moves around the patch edge)
+#define TERRAIN_COLLISION_STREAMING_UNLOAD_SCALE 1.25f
+
 // [Deprecated on 4.03.2024, expires on 4.03.2029]
 struct TerrainCollisionDataHeaderOld
 {
@@ -56,6 +62,7 @@ struct TerrainCollisionDataHeader
 
 TerrainPatch::TerrainPatch(const SpawnParams& params)
     : ScriptingObject(params)
+    , StreamableResource(StreamingGroups::Instance()->Terrain())
 {
 }
 
@@ -83,6 +90,8 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
         Splatmap[i] = nullptr;
     }
     _heightfield = nullptr;
+    _heightfieldId = Guid::Empty;
+    _heightfieldSize = 0;
 #if TERRAIN_UPDATING
     _cachedHeightMap.Resize(0);
     _cachedHolesMask.Resize(0);
@@ -104,6 +113,8 @@ void TerrainPatch::Init(Terrain* terrain, int16 x, int16 z)
 
 TerrainPatch::~TerrainPatch()
 {
+    CancelStreamingTasks();
+    StopStreaming();
 #if TERRAIN_UPDATING
     SAFE_DELETE(_dataHeightmap);
     for (int32 i = 0; i < TERRAIN_MAX_SPLATMAPS_COUNT; i++)
@@ -2113,7 +2124,7 @@ void TerrainPatch::CreateCollision()
 {
     PROFILE_CPU();
     ASSERT(!HasCollision());
-    if (CreateHeightField())
+    if (_physicsHeightField == nullptr && CreateHeightField())
         return;
     ASSERT(_physicsHeightField);
 
@@ -2166,6 +2177,7 @@ bool TerrainPatch::CreateHeightField()
 
     // Create heightfield object from the data
     _collisionScaleXZ = collisionHeader->ScaleXZ * TERRAIN_UNITS_PER_VERTEX;
+    _heightfieldSize = _heightfield->Data.Count();
     _physicsHeightField = PhysicsBackend::CreateHeightField(_heightfield->Data.Get() + sizeof(TerrainCollisionDataHeader), _heightfield->Data.Count() - sizeof(TerrainCollisionDataHeader));
     if (_physicsHeightField == nullptr)
     {
@@ -2176,6 +2188,19 @@ bool TerrainPatch::CreateHeightField()
     return false;
 }
 
+void TerrainPatch::PrepareHeightField()
+{
+    PROFILE_CPU();
+    if (_physicsHeightField || _heightfield == nullptr || _heightfield->WaitForLoaded() || _heightfield->Data.IsEmpty())
+        return;
+    auto collisionHeader = (TerrainCollisionDataHeader*)_heightfield->Data.Get();
+    if (collisionHeader->CheckOldMagicNumber != MAX_int32 || collisionHeader->Version != TerrainCollisionDataHeader::CurrentVersion)
+        return;
+    _collisionScaleXZ = collisionHeader->ScaleXZ * TERRAIN_UNITS_PER_VERTEX;
+    _heightfieldSize = _heightfield->Data.Count();
+    _physicsHeightField = PhysicsBackend::CreateHeightField(_heightfield->Data.Get() + sizeof(TerrainCollisionDataHeader), _heightfield->Data.Count() - sizeof(TerrainCollisionDataHeader));
+}
+
 void TerrainPatch::UpdateCollisionScale() const
 {
     PROFILE_CPU();
@@ -2545,7 +2570,16 @@ void TerrainPatch::Serialize(SerializeStream& stream, const void* otherObj)
     SERIALIZE_MEMBER(Splatmap0, Splatmap[0]);
     SERIALIZE_MEMBER(Splatmap1, Splatmap[1]);
     static_assert(ARRAY_COUNT(Splatmap) == 2, "Please update the code above to match the maximum terrain splatmaps amount.");
-    SERIALIZE_MEMBER(Heightfield, _heightfield);
+    if (_heightfield == nullptr && _heightfieldId.IsValid())
+    {
+        // Collision data has been released by the streaming
+        stream.JKEY("Heightfield");
+        stream.Guid(_heightfieldId);
+    }
+    else
+    {
+        SERIALIZE_MEMBER(Heightfield, _heightfield);
+    }
 
     stream.JKEY("Chunks");
     stream.StartArray();
@@ -2574,6 +2608,8 @@ void TerrainPatch::Deserialize(DeserializeStream& stream, ISerializeModifier* mo
     DESERIALIZE_MEMBER(Splatmap1, Splatmap[1]);
     static_assert(ARRAY_COUNT(Splatmap) == 2, "Please update the code above to match the maximum terrain splatmaps amount.");
     DESERIALIZE_MEMBER(Heightfield, _heightfield);
+    if (_heightfield)
+        _heightfieldId = Guid::Empty;
 
     // Update offset (x or/and z may be modified)
     const float size = _terrain->_chunkSize * TERRAIN_UNITS_PER_VERTEX * Terrain::ChunksCountEdge;
@@ -2597,3 +2633,126 @@ void TerrainPatch::OnPhysicsSceneChanged(PhysicsScene* previous)
     void* scene = _terrain->GetPhysicsScene()->GetPhysicsScene();
     PhysicsBackend::AddSceneActor(scene, _physicsActor);
 }
+
+bool TerrainPatch::IsInCollisionStreamingRange(const Array<Vector3>& sources) const
+{
+    Real distance = (Real)_terrain->CollisionStreamingDistance;
+    if (HasCollision())
+        distance *= TERRAIN_COLLISION_STREAMING_UNLOAD_SCALE;
+    for (const Vector3& source : sources)
+    {
+        if (_bounds.Distance(source) <= distance)
+            return true;
+    }
+    return false;
+}
+
+float TerrainPatch::CalculateStreamingQuality() const
+{
+    const Array<Vector3> sources = WorldPartition::GetStreamingSources();
+    if (sources.IsEmpty())
+    {
+        // Keep the current state
+        return HasCollision() ? 1.0f : 0.0f;
+    }
+    return IsInCollisionStreamingRange(sources) ? 1.0f : 0.0f;
+}
+
+void TerrainPatch::ReleaseHeightfield()
+{
+    if (_heightfield)
+    {
+        // Keep the asset ID to load it again when needed (asset gets unloaded when not used)
+        _heightfieldId = _heightfield.GetID();
+        _heightfield = nullptr;
+    }
+}
+
+bool TerrainPatch::UpdateStreamedCollision(int32 residency)
+{
+    PROFILE_CPU();
+    _streamingTask = nullptr;
+    if (!_terrain->IsDuringPlay())
+        return false;
+    if (residency == 0)
+    {
+        // Unload collision
+        if (HasCollision())
+            DestroyCollision();
+        ReleaseHeightfield();
+        return false;
+    }
+    if (HasCollision())
+        return false;
+
+    // Load the cooked collision data (without blocking, streaming will retry this later)
+    if (!_heightfield && _heightfieldId.IsValid())
+    {
+        _heightfield = Content::LoadAsync<RawDataAsset>(_heightfieldId);
+        if (_heightfield)
+            _heightfieldId = Guid::Empty;
+    }
+    if (!_heightfield || !_heightfield->IsLoaded())
+        return false;
+
+    // Create collision
+    CreateCollision();
+    if (HasCollision())
+        _terrain->UpdateLayerBits();
+    return false;
+}
+
+int32 TerrainPatch::GetMaxResidency() const
+{
+    return 1;
+}
+
+int32 TerrainPatch::GetCurrentResidency() const
+{
+    return HasCollision() ? 1 : 0;
+}
+
+int32 TerrainPatch::GetAllocatedResidency() const
+{
+    return GetCurrentResidency();
+}
+
+uint64 TerrainPatch::GetMemoryUsage(int32 residency) const
+{
+    // Estimate memory usage from the cooked collision data size
+    return residency > 0 ? _heightfieldSize : 0;
+}
+
+bool TerrainPatch::CanBeUpdated() const
+{
+    // Check if has no streaming tasks running
+    return _streamingTask == nullptr;
+}
+
+Task* TerrainPatch::UpdateAllocation(int32 residency)
+{
+    // Terrain patches are not using dynamic allocation feature
+    return nullptr;
+}
+
+Task* TerrainPatch::CreateStreamingTask(int32 residency)
+{
+    ASSERT(_streamingTask == nullptr);
+
+    // Physics objects are created and destroyed on a main thread (to not conflict with the simulation and the scripts)
+    Function<bool()> action = [this, residency]
+    {
+        return UpdateStreamedCollision(residency);
+    };
+    _streamingTask = New<MainThreadActionTask>(action, this);
+    return _streamingTask;
+}
+
+void TerrainPatch::CancelStreamingTasks()
+{
+    if (_streamingTask)
+    {
+        _streamingTask->Cancel();
+        _streamingTask = nullptr;
+    }
+}
@@ -8,19 +8,22 @@
 #include "Engine/Core/Math/Vector2.h"
 #include "Engine/Level/Scene/Lightmap.h"
 #include "Engine/Content/Assets/RawDataAsset.h"
+#include "Engine/Streaming/StreamableResource.h"
 
 struct RayCastHit;
 class TerrainMaterialShader;
+class Task;
 
 /// <summary>
 /// Represents single terrain patch made of 16 terrain chunks.
 /// </summary>
-API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingObject, public ISerializable
+API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingObject, public ISerializable, public StreamableResource
 {
     DECLARE_SCRIPTING_TYPE(TerrainPatch);
     friend Terrain;
     friend TerrainPatch;
     friend TerrainChunk;
+    friend class TerrainStreamingHandler;
 
 private:
     Terrain* _terrain;
@@ -29,6 +32,9 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     BoundingBox _bounds;
     Float3 _offset;
     AssetReference<RawDataAsset> _heightfield;
+    Guid _heightfieldId; // The heightfield asset released by the collision streaming
+    uint64 _heightfieldSize;
+    Task* _streamingTask = nullptr;
     void* _physicsShape;
     void* _physicsActor;
     void* _physicsHeightField;
@@ -388,6 +394,12 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     API_FUNCTION() void ExtractCollisionGeometry(API_PARAM(Out) Array<Float3>& vertexBuffer, API_PARAM(Out) Array<int32>& indexBuffer);
 
 private:
+    // Collision streaming (residency 1 means that patch has collision)
+    bool IsInCollisionStreamingRange(const Array<Vector3>& sources) const;
+    float CalculateStreamingQuality() const;
+    void ReleaseHeightfield();
+    bool UpdateStreamedCollision(int32 residency);
+
     /// <summary>
     /// Determines whether this patch has created collision representation.
     /// </summary>
@@ -407,6 +419,11 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     /// <returns>True if failed, otherwise false.</returns>
     bool CreateHeightField();
 
+    /// <summary>
+    /// Creates the height field from the up-to-date cooked collision data. Can be called from the job thread to create multiple patches height fields in parallel (outdated collision data is skipped and gets re-cooked later by CreateHeightField on the calling thread).
+    /// </summary>
+    void PrepareHeightField();
+
     /// <summary>
     /// Updates the collision geometry scale for the patch. Called when terrain actor scale gets changed.
     /// </summary>
@@ -434,4 +451,14 @@ API_CLASS(Sealed, NoSpawn) class FLAXENGINE_API TerrainPatch : public ScriptingO
     // [ISerializable]
     void Serialize(SerializeStream& stream, const void* otherObj) override;
     void Deserialize(DeserializeStream& stream, ISerializeModifier* modifier) override;
+
+    // [StreamableResource]
+    int32 GetMaxResidency() const override;
+    int32 GetCurrentResidency() const override;
+    int32 GetAllocatedResidency() const override;
+    uint64 GetMemoryUsage(int32 residency) const override;
+    bool CanBeUpdated() const override;
+    Task* UpdateAllocation(int32 residency) override;
+    Task* CreateStreamingTask(int32 residency) override;
+    void CancelStreamingTasks() override;
 };
@@ -5,6 +5,10 @@
 #include "Engine/Core/Collections/BitArray.h"
 #include "Engine/Core/Collections/HashSet.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Collections/FlatDictionary.h"
+#include "Engine/Core/Collections/SoAArray.h"
+#include "Engine/Core/Math/Vector3.h"
+#include "Engine/Core/Types/String.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("Array")
@@ -291,3 +295,254 @@ TEST_CASE("Dictionary")
         CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY);
     }
 }
+
+TEST_CASE("FlatDictionary")
+{
+    SECTION("Test Allocators")
+    {
+        FlatDictionary<int32, int32> a1;
+        FlatDictionary<int32, int32, InlinedAllocation<64>> a2;
+        for (int32 i = 0; i < 40; i++)
+        {
+            a1.Add(i, i);
+            a2.Add(i, i);
+        }
+        CHECK(a1.Count() == 40);
+        CHECK(a2.Count() == 40);
+        for (int32 i = 0; i < 40; i++)
+        {
+            CHECK(a1.ContainsKey(i));
+            CHECK(a2.ContainsKey(i));
+            CHECK(a1[i] == i);
+            CHECK(a2[i] == i);
+        }
+
+        // Grow over the inlined storage
+        for (int32 i = 40; i < 200; i++)
+            a2.Add(i, i);
+        CHECK(a2.Count() == 200);
+        for (int32 i = 0; i < 200; i++)
+            CHECK(a2.At(i) == i);
+    }
+
+    SECTION("Test Resizing")
+    {
+        FlatDictionary<int32, int32> a1;
+        int32 capacity = a1.Capacity();
+        int32 rehashes = 0;
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i, i);
+            if (a1.Capacity() != capacity)
+            {
+                capacity = a1.Capacity();
+                rehashes++;
+            }
+        }
+        CHECK(rehashes > 1);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Count() <= a1.Capacity());
+        for (int32 i = 0; i < 4000; i++)
+        {
+            int32 value = -1;
+            CHECK(a1.TryGet(i, value));
+            CHECK(value == i);
+        }
+        CHECK(!a1.ContainsKey(4000));
+        a1.Clear();
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() == capacity);
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i, i);
+        CHECK(a1.Count() == 4000);
+        CHECK(a1.Capacity() == capacity);
+        a1.SetCapacity(a1.Capacity() * 2);
+        CHECK(a1.Count() == 4000);
+        for (int32 i = 0; i < 4000; i++)
+            CHECK(a1[i] == i);
+    }
+
+    SECTION("Test Add/Remove")
+    {
+        // Re-adding over the removed items reuses their buckets without growing
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i, i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 0);
+        CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY * 2);
+        for (int32 i = 1; i <= 10; i++)
+            a1.Add(-i, -i);
+        for (int32 i = 0; i < 4000; i++)
+        {
+            a1.Add(i, i);
+            a1.Remove(i);
+        }
+        CHECK(a1.Count() == 10);
+        CHECK(a1.Capacity() <= DICTIONARY_DEFAULT_CAPACITY * 2);
+        for (int32 i = 1; i <= 10; i++)
+            CHECK(a1[-i] == -i);
+
+        // Remove every other item from a full table and add them back (lookups have to skip the removed buckets)
+        FlatDictionary<int32, int32> a2;
+        for (int32 i = 0; i < 1000; i++)
+            a2.Add(i, i);
+        for (int32 i = 0; i < 1000; i += 2)
+            CHECK(a2.Remove(i));
+        CHECK(!a2.Remove(0));
+        CHECK(a2.Count() == 500);
+        for (int32 i = 0; i < 1000; i++)
+            CHECK(a2.ContainsKey(i) == (i % 2 == 1));
+        for (int32 i = 0; i < 1000; i += 2)
+            a2.Add(i, i * 2);
+        CHECK(a2.Count() == 1000);
+        for (int32 i = 0; i < 1000; i++)
+            CHECK(a2[i] == (i % 2 == 0 ? i * 2 : i));
+    }
+
+    SECTION("Test Remove While Iterating")
+    {
+        FlatDictionary<int32, int32> a1;
+        for (int32 i = 0; i < 1000; i++)
+            a1.Add(i, i);
+        int32 visited = 0;
+        for (auto i = a1.Begin(); i.IsNotEnd(); ++i)
+        {
+            visited++;
+            if (i->Key % 3 == 0)
+                a1.Remove(i);
+        }
+        CHECK(visited == 1000);
+        CHECK(a1.Count() == 666);
+        for (int32 i = 0; i < 1000; i++)
+            CHECK(a1.ContainsKey(i) == (i % 3 != 0));
+        int32 count = 0;
+        for (const auto& e : a1)
+        {
+            CHECK(e.Key == e.Value);
+            count++;
+        }
+        CHECK(count == 666);
+    }
+
+    SECTION("Test Copy/Move")
+    {
+        FlatDictionary<int32, String> a1;
+        for (int32 i = 0; i < 100; i++)
+            a1.Add(i, String::Format(TEXT("{0}"), i));
+        a1.Remove(50);
+
+        FlatDictionary<int32, String> a2(a1);
+        CHECK(a2.Count() == 99);
+        CHECK(a2[10] == TEXT("10"));
+        CHECK(!a2.ContainsKey(50));
+
+        FlatDictionary<int32, String> a3;
+        a3.Add(-1, TEXT("-1"));
+        a3 = a1;
+        CHECK(a3.Count() == 99);
+        CHECK(!a3.ContainsKey(-1));
+        CHECK(a3[99] == TEXT("99"));
+
+        FlatDictionary<int32, String> a4(MoveTemp(a2));
+        CHECK(a2.Count() == 0);
+        CHECK(a4.Count() == 99);
+        CHECK(a4[20] == TEXT("20"));
+
+        a3 = MoveTemp(a4);
+        CHECK(a4.Count() == 0);
+        CHECK(a3.Count() == 99);
+        CHECK(a3[30] == TEXT("30"));
+        a4.Add(1, TEXT("1"));
+        CHECK(a4.Count() == 1);
+
+        FlatDictionary<int32, String, InlinedAllocation<32>> a5;
+        for (int32 i = 0; i < 10; i++)
+            a5.Add(i, String::Format(TEXT("{0}"), i));
+        FlatDictionary<int32, String, InlinedAllocation<32>> a6(MoveTemp(a5));
+        CHECK(a6.Count() == 10);
+        CHECK(a6[5] == TEXT("5"));
+        a5 = a6;
+        CHECK(a5.Count() == 10);
+        CHECK(a5[9] == TEXT("9"));
+    }
+}
+
+TEST_CASE("SoAArray")
+{
+    SECTION("Test Allocators")
+    {
+        SoAArray<int32, float> a1;
+        SoAArrayBase<InlinedAllocation<8>, int32, float> a2;
+        SoAArrayBase<FixedAllocation<8>, int32, float> a3;
+        for (int32 i = 0; i < 7; i++)
+        {
+            a1.Add(i, (float)i);
+            a2.Add(i, (float)i);
+            a3.Add(i, (float)i);
+        }
+        CHECK(a1.Count() == 7);
+        CHECK(a2.Count() == 7);
+        CHECK(a3.Count() == 7);
+        CHECK(a1.Capacity() % SOA_ARRAY_CAPACITY_GRANULARITY == 0);
+        CHECK(((uintptr)a1.Get<1>() & 15) == 0);
+        for (int32 i = 0; i < 7; i++)
+        {
+            CHECK(a1.At<0>(i) == i);
+            CHECK(a2.At<1>(i) == (float)i);
+            CHECK(a3.At<0>(i) == i);
+        }
+        for (int32 i = 7; i < 100; i++)
+            a2.Add(i, (float)i);
+        CHECK(a2.Count() == 100);
+        CHECK(a2.At<0>(99) == 99);
+    }
+
+    SECTION("Test Swap Remove")
+    {
+        SoAArray<int32, String> a1;
+        for (int32 i = 0; i < 5; i++)
+            a1.Add(i, String::Format(TEXT("{0}"), i));
+        a1.RemoveAt(1);
+        CHECK(a1.Count() == 4);
+        CHECK(a1.At<0>(1) == 4);
+        CHECK(a1.At<1>(1) == TEXT("4"));
+        a1.RemoveAt(3);
+        CHECK(a1.Count() == 3);
+        CHECK(a1.At<1>(2) == TEXT("2"));
+        a1.RemoveLast();
+        CHECK(a1.Count() == 2);
+
+        SoAArray<int32, String> a2(a1);
+        CHECK(a2.Count() == 2);
+        CHECK(a2.At<1>(1) == TEXT("4"));
+        a1.Clear();
+        CHECK(a1.IsEmpty());
+        a1 = MoveTemp(a2);
+        CHECK(a1.Count() == 2);
+        CHECK(a2.Count() == 0);
+    }
+
+    SECTION("Test Columns Iteration")
+    {
+        SoAArray<Float3, float, int32> a1;
+        for (int32 i = 0; i < 10; i++)
+            a1.Add(Float3((float)i), 1.0f, i);
+        a1.ForEach<0, 1>([](Float3& position, float& scale)
+        {
+            position *= scale * 2.0f;
+        });
+        int32 sum = 0;
+        a1.ForEach<2>([&sum](int32& value)
+        {
+            sum += value;
+        });
+        CHECK(sum == 45);
+        CHECK(a1.At<0>(3) == Float3(6.0f));
+        a1.Resize(20);
+        CHECK(a1.Count() == 20);
+        CHECK(a1.At<2>(9) == 9);
+    }
+}
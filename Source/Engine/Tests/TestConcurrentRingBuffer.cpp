@@ -0,0 +1,246 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Threading/ConcurrentRingBuffer.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include "Engine/Core/Collections/Array.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("SPSCRingBuffer")
+{
+    SECTION("Test Capacity")
+    {
+        SPSCRingBuffer<int32> a1(5);
+        CHECK(a1.Capacity() == 8);
+        SPSCRingBuffer<int32> a2(0);
+        CHECK(a2.Capacity() == 2);
+    }
+
+    SECTION("Test Full/Empty")
+    {
+        SPSCRingBuffer<int32> a1(8);
+        int32 value = -1;
+        CHECK(!a1.TryDequeue(value));
+        CHECK(value == -1);
+        for (int32 i = 0; i < 8; i++)
+            CHECK(a1.TryEnqueue(i));
+        CHECK(a1.Count() == 8);
+        CHECK(!a1.TryEnqueue(8));
+        CHECK(a1.Count() == 8);
+        for (int32 i = 0; i < 8; i++)
+        {
+            CHECK(a1.TryDequeue(value));
+            CHECK(value == i);
+        }
+        CHECK(!a1.TryDequeue(value));
+        CHECK(a1.Count() == 0);
+    }
+
+    SECTION("Test Wraparound")
+    {
+        SPSCRingBuffer<int32> a1(8);
+        int32 next = 0, expected = 0;
+        bool valid = true;
+        for (int32 i = 0; i < 100; i++)
+        {
+            for (int32 j = 0; j < 5; j++)
+                valid &= a1.TryEnqueue(next++);
+            int32 value;
+            for (int32 j = 0; j < 5; j++)
+                valid &= a1.TryDequeue(value) && value == expected++;
+        }
+        CHECK(valid);
+        CHECK(a1.Count() == 0);
+    }
+
+    SECTION("Test Batch")
+    {
+        SPSCRingBuffer<int32> a1(8);
+        int32 items[12];
+        for (int32 i = 0; i < 12; i++)
+            items[i] = i;
+        CHECK(a1.TryEnqueue(items, 5) == 5);
+        CHECK(a1.TryEnqueue(items + 5, 7) == 3);
+        CHECK(a1.TryEnqueue(items + 8, 4) == 0);
+        int32 output[12] = {};
+        CHECK(a1.TryDequeue(output, 3) == 3);
+        CHECK(output[0] == 0);
+        CHECK(output[2] == 2);
+
+        // Batch split over the buffer end
+        CHECK(a1.TryEnqueue(items + 8, 4) == 3);
+        CHECK(a1.TryDequeue(output, 12) == 8);
+        for (int32 i = 0; i < 8; i++)
+            CHECK(output[i] == i + 3);
+        CHECK(a1.TryDequeue(output, 12) == 0);
+    }
+
+    SECTION("Test Threads")
+    {
+        constexpr int32 count = 100000;
+        SPSCRingBuffer<int32> a1(64);
+        Thread* thread = ThreadSpawner::Start([&a1]
+        {
+            int32 items[7];
+            int32 next = 0;
+            while (next < count)
+            {
+                const int32 batch = Math::Min(1 + next % 7, count - next);
+                for (int32 i = 0; i < batch; i++)
+                    items[i] = next + i;
+                const int32 added = a1.TryEnqueue(items, batch);
+                if (added == 0)
+                    Platform::Sleep(0);
+                next += added;
+            }
+            return 0;
+        }, TEXT("Test Producer"));
+        REQUIRE(thread);
+        int32 expected = 0;
+        bool valid = true;
+        int32 output[16];
+        while (expected < count)
+        {
+            const int32 dequeued = a1.TryDequeue(output, 1 + expected % 16);
+            if (dequeued == 0)
+                Platform::Sleep(0);
+            for (int32 i = 0; i < dequeued; i++)
+                valid &= output[i] == expected++;
+        }
+        thread->Join();
+        Delete(thread);
+        CHECK(valid);
+        CHECK(a1.Count() == 0);
+    }
+}
+
+TEST_CASE("MPSCRingBuffer")
+{
+    SECTION("Test Full/Empty")
+    {
+        MPSCRingBuffer<int32> a1(8);
+        CHECK(a1.Capacity() == 8);
+        int32 value = -1;
+        CHECK(!a1.TryDequeue(value));
+        for (int32 i = 0; i < 8; i++)
+            CHECK(a1.TryEnqueue(i));
+        CHECK(a1.Count() == 8);
+        CHECK(!a1.TryEnqueue(8));
+        for (int32 i = 0; i < 8; i++)
+        {
+            CHECK(a1.TryDequeue(value));
+            CHECK(value == i);
+        }
+        CHECK(!a1.TryDequeue(value));
+        CHECK(a1.Count() == 0);
+    }
+
+    SECTION("Test Wraparound")
+    {
+        MPSCRingBuffer<int32> a1(8);
+        int32 next = 0, expected = 0;
+        bool valid = true;
+        for (int32 i = 0; i < 100; i++)
+        {
+            for (int32 j = 0; j < 5; j++)
+                valid &= a1.TryEnqueue(next++);
+            int32 value;
+            for (int32 j = 0; j < 5; j++)
+                valid &= a1.TryDequeue(value) && value == expected++;
+        }
+        CHECK(valid);
+        CHECK(a1.Count() == 0);
+    }
+
+    SECTION("Test Batch")
+    {
+        MPSCRingBuffer<int32> a1(8);
+        int32 items[8];
+        for (int32 i = 0; i < 8; i++)
+            items[i] = i;
+        CHECK(a1.TryEnqueue(items, 5));
+
+        // Batch that doesn't fit is not added at all
+        CHECK(!a1.TryEnqueue(items + 5, 4));
+        CHECK(a1.Count() == 5);
+        CHECK(a1.TryEnqueue(items + 5, 3));
+        CHECK(!a1.TryEnqueue(items, 1));
+
+        int32 output[8] = {};
+        CHECK(a1.TryDequeue(output, 6) == 6);
+        for (int32 i = 0; i < 6; i++)
+            CHECK(output[i] == i);
+
+        // Batch split over the buffer end
+        CHECK(a1.TryEnqueue(items, 6));
+        CHECK(a1.TryDequeue(output, 8) == 8);
+        CHECK(output[0] == 6);
+        CHECK(output[1] == 7);
+        for (int32 i = 0; i < 6; i++)
+            CHECK(output[i + 2] == i);
+        CHECK(a1.TryDequeue(output, 8) == 0);
+    }
+
+    SECTION("Test Multiple Producers")
+    {
+        constexpr int32 producers = 4;
+        constexpr int32 count = 50000;
+        MPSCRingBuffer<int32> a1(256);
+        Array<Thread*> threads;
+        for (int32 producer = 0; producer < producers; producer++)
+        {
+            Thread* thread = ThreadSpawner::Start([&a1, producer]
+            {
+                // Items are encoded as (producer, index) pairs and added in batches of up to 4 items
+                int32 items[4];
+                int32 next = 0;
+                while (next < count)
+                {
+                    const int32 batch = Math::Min(1 + (next + producer) % 4, count - next);
+                    for (int32 i = 0; i < batch; i++)
+                        items[i] = (producer << 24) | (next + i);
+                    if (a1.TryEnqueue(items, batch))
+                        next += batch;
+                    else
+                        Platform::Sleep(0);
+                }
+                return 0;
+            }, TEXT("Test Producer"));
+            REQUIRE(thread);
+            threads.Add(thread);
+        }
+
+        // Every item has to arrive exactly once and items of each producer in order
+        int32 nextIndex[producers] = {};
+        int32 received = 0;
+        bool valid = true;
+        int32 output[32];
+        while (received < producers * count)
+        {
+            const int32 dequeued = a1.TryDequeue(output, 32);
+            if (dequeued == 0)
+                Platform::Sleep(0);
+            for (int32 i = 0; i < dequeued; i++)
+            {
+                const int32 producer = output[i] >> 24;
+                const int32 index = output[i] & 0xffffff;
+                if (producer < 0 || producer >= producers || nextIndex[producer] != index)
+                {
+                    valid = false;
+                    continue;
+                }
+                nextIndex[producer]++;
+            }
+            received += dequeued;
+        }
+        for (Thread* thread : threads)
+        {
+            thread->Join();
+            Delete(thread);
+        }
+        CHECK(valid);
+        for (int32 producer = 0; producer < producers; producer++)
+            CHECK(nextIndex[producer] == count);
+        int32 value;
+        CHECK(!a1.TryDequeue(value));
+    }
+}
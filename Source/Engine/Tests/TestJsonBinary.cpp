@@ -0,0 +1,131 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Serialization/Json.h"
+#include "Engine/Serialization/JsonBinary.h"
+#include "Engine/Serialization/JsonWriters.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    void WriteTestData(JsonWriter& writer)
+    {
+        writer.StartObject();
+        writer.JKEY("Name");
+        writer.String("Test \"value\"\n");
+        writer.JKEY("Empty");
+        writer.String("");
+        writer.JKEY("Bool");
+        writer.Bool(true);
+        writer.JKEY("Int");
+        writer.Int(-123456);
+        writer.JKEY("Uint");
+        writer.Uint(MAX_uint32);
+        writer.JKEY("Int64");
+        writer.Int64(MIN_int64);
+        writer.JKEY("Uint64");
+        writer.Uint64(MAX_uint64);
+        writer.JKEY("Float");
+        writer.Float(0.1f);
+        writer.JKEY("Double");
+        writer.Double(-1.0e-300);
+        writer.JKEY("Raw");
+        writer.RawValue("{\"A\":[1,2,{\"B\":null}],\"C\":\"D\"}");
+        writer.JKEY("Array");
+        writer.StartArray();
+        for (int32 i = 0; i < 100; i++)
+        {
+            // Nested objects reuse the same keys
+            writer.StartObject();
+            writer.JKEY("Index");
+            writer.Int(i);
+            writer.JKEY("Values");
+            writer.StartArray();
+            for (int32 j = 0; j < i % 4; j++)
+                writer.Double(i * 0.5 + j);
+            writer.EndArray();
+            writer.EndObject();
+        }
+        writer.StartArray();
+        writer.EndArray();
+        writer.StartObject();
+        writer.EndObject();
+        writer.EndArray();
+        writer.JKEY("Nested");
+        writer.StartObject();
+        writer.JKEY("Name");
+        writer.String("Inner");
+        writer.JKEY("Nested");
+        writer.StartObject();
+        writer.JKEY("Int64");
+        writer.Int64(MAX_int64);
+        writer.EndObject();
+        writer.EndObject();
+        writer.EndObject();
+    }
+}
+
+TEST_CASE("JsonBinary")
+{
+    // Write the same data to text and binary json
+    rapidjson_flax::StringBuffer buffer;
+    CompactJsonWriter textWriter(buffer);
+    WriteTestData(textWriter);
+    BinaryJsonWriter binaryWriter;
+    WriteTestData(binaryWriter);
+    Array<byte> data;
+    binaryWriter.GetData(data);
+
+    SECTION("Test Round Trip")
+    {
+        CHECK(JsonBinary::IsBinary(data.Get(), data.Count()));
+        CHECK(!JsonBinary::IsBinary((const byte*)buffer.GetString(), (int32)buffer.GetSize()));
+
+        rapidjson_flax::Document textDocument;
+        textDocument.Parse(buffer.GetString(), buffer.GetSize());
+        REQUIRE(!textDocument.HasParseError());
+        rapidjson_flax::Document binaryDocument;
+        REQUIRE(!JsonBinary::Parse(binaryDocument, data.Get(), data.Count()));
+        CHECK(binaryDocument == textDocument);
+
+        // Values keep their types and precision
+        CHECK(binaryDocument["Int"].GetInt() == -123456);
+        CHECK(binaryDocument["Uint"].GetUint() == MAX_uint32);
+        CHECK(binaryDocument["Int64"].GetInt64() == MIN_int64);
+        CHECK(binaryDocument["Uint64"].GetUint64() == MAX_uint64);
+        CHECK(binaryDocument["Float"].GetFloat() == 0.1f);
+        CHECK(binaryDocument["Double"].GetDouble() == -1.0e-300);
+        CHECK(binaryDocument["Nested"]["Nested"]["Int64"].GetInt64() == MAX_int64);
+        CHECK(binaryDocument["Raw"]["A"][2]["B"].IsNull());
+        CHECK(binaryDocument["Array"].Size() == 102);
+        CHECK(binaryDocument["Array"][99]["Values"].Size() == 3);
+
+        // Binary data is smaller than the text
+        CHECK(data.Count() < (int32)buffer.GetSize());
+    }
+
+    SECTION("Test Invalid Data")
+    {
+        // Truncated data has to fail without reading outside the input
+        for (int32 length = 0; length < data.Count(); length++)
+        {
+            Array<byte> truncated;
+            truncated.Set(data.Get(), length);
+            rapidjson_flax::Document document;
+            CHECK(JsonBinary::Parse(document, truncated.Get(), truncated.Count()));
+        }
+
+        // Corrupted header
+        Array<byte> corrupted = data;
+        corrupted[0] ^= 0xff;
+        rapidjson_flax::Document document;
+        CHECK(JsonBinary::Parse(document, corrupted.Get(), corrupted.Count()));
+        corrupted = data;
+        corrupted[4]++;
+        CHECK(JsonBinary::Parse(document, corrupted.Get(), corrupted.Count()));
+
+        // Trailing data after the root value
+        corrupted = data;
+        corrupted.Add(0);
+        CHECK(JsonBinary::Parse(document, corrupted.Get(), corrupted.Count()));
+    }
+}
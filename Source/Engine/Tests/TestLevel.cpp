@@ -5,6 +5,7 @@
 #include "Engine/Core/Types/StringView.h"
 #include "Engine/Level/LargeWorlds.h"
 #include "Engine/Level/Tags.h"
+#include "Engine/Level/Actors/EmptyActor.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("LargeWorlds")
@@ -20,6 +21,39 @@ TEST_CASE("LargeWorlds")
     }
 }
 
+TEST_CASE("Actor")
+{
+    SECTION("Batched Transforms")
+    {
+        auto parent = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        auto child = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        auto childOfChild = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        auto other = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        child->SetParent(parent, false);
+        childOfChild->SetParent(child, false);
+        childOfChild->SetLocalPosition(Vector3(0, 10, 0));
+
+        // Child is before parent in the batch to check that it uses the new parent transformation
+        Actor* actors[] = { child, other, parent };
+        const Transform transforms[] = { Transform(Vector3(100, 0, 0)), Transform(Vector3(0, 0, 50)), Transform(Vector3(10, 20, 30), Quaternion::Euler(0, 90, 0)) };
+        Actor::SetTransforms(ToSpan(actors, ARRAY_COUNT(actors)), ToSpan(transforms, ARRAY_COUNT(transforms)));
+        CHECK(Vector3::NearEqual(child->GetPosition(), Vector3(100, 0, 0)));
+        CHECK(Vector3::NearEqual(other->GetPosition(), Vector3(0, 0, 50)));
+        CHECK(Vector3::NearEqual(parent->GetPosition(), Vector3(10, 20, 30)));
+        CHECK(Vector3::NearEqual(childOfChild->GetPosition(), Vector3(100, 10, 0)));
+
+        Array<Transform> result;
+        Actor::GetTransforms(ToSpan(actors, ARRAY_COUNT(actors)), result);
+        REQUIRE(result.Count() == 3);
+        CHECK(result[0] == child->GetTransform());
+        CHECK(result[1] == other->GetTransform());
+        CHECK(result[2] == parent->GetTransform());
+
+        parent->DeleteObject();
+        other->DeleteObject();
+    }
+}
+
 TEST_CASE("Tags")
 {
     SECTION("Tag")
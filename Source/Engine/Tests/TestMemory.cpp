@@ -0,0 +1,301 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Memory/ThreadCacheAllocator.h"
+#include "Engine/Core/Memory/FrameAllocation.h"
+#include "Engine/Core/Memory/PoolAllocator.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    bool IsFilled(const byte* ptr, uint32 size, byte value)
+    {
+        for (uint32 i = 0; i < size; i++)
+        {
+            if (ptr[i] != value)
+                return false;
+        }
+        return true;
+    }
+}
+
+TEST_CASE("ThreadCacheAllocator")
+{
+    SECTION("Test Size Classes")
+    {
+        // Allocate blocks of all small size classes and a few large ones
+        Array<byte*> blocks;
+        Array<uint32> sizes;
+        for (uint32 size = 1; size <= 20 * 1024; size += size < 256 ? 1 : 61)
+        {
+            byte* ptr = (byte*)ThreadCacheAllocator::Allocate(size);
+            REQUIRE(ptr);
+            CHECK(((uintptr)ptr & 15) == 0);
+            Platform::MemorySet(ptr, size, (int32)(size & 0xff));
+            blocks.Add(ptr);
+            sizes.Add(size);
+        }
+
+        // Blocks must not overlap
+        for (int32 i = 0; i < blocks.Count(); i++)
+            CHECK(IsFilled(blocks[i], sizes[i], (byte)(sizes[i] & 0xff)));
+        for (int32 i = 0; i < blocks.Count(); i++)
+            ThreadCacheAllocator::Free(blocks[i]);
+
+        // Over-aligned allocations
+        void* ptr = ThreadCacheAllocator::Allocate(64, 256);
+        REQUIRE(ptr);
+        CHECK(((uintptr)ptr & 255) == 0);
+        ThreadCacheAllocator::Free(ptr);
+
+        // The freed block is reused by the next allocation from the same size class
+        void* a = ThreadCacheAllocator::Allocate(100);
+        ThreadCacheAllocator::Free(a);
+        void* b = ThreadCacheAllocator::Allocate(112);
+        CHECK(a == b);
+        ThreadCacheAllocator::Free(b);
+    }
+
+    SECTION("Test Free On Other Thread")
+    {
+        constexpr int32 count = 1000;
+        Array<byte*> blocks;
+        for (int32 i = 0; i < count; i++)
+        {
+            byte* ptr = (byte*)ThreadCacheAllocator::Allocate(48);
+            REQUIRE(ptr);
+            Platform::MemorySet(ptr, 48, i & 0xff);
+            blocks.Add(ptr);
+        }
+        const ThreadCacheAllocator::Stats statsBefore = ThreadCacheAllocator::GetStats();
+
+        // Free all blocks on the other thread and return them to the global pool
+        Thread* thread = ThreadSpawner::Start([&blocks]
+        {
+            for (byte* ptr : blocks)
+                ThreadCacheAllocator::Free(ptr);
+            ThreadCacheAllocator::FlushThreadCache();
+            return 0;
+        }, TEXT("Test Allocator"));
+        REQUIRE(thread);
+        thread->Join();
+        Delete(thread);
+        const ThreadCacheAllocator::Stats statsAfter = ThreadCacheAllocator::GetStats();
+        CHECK(statsAfter.PooledBytes >= statsBefore.PooledBytes + count * 48);
+
+        // Blocks freed by the other thread get reused without reserving more memory
+        for (int32 i = 0; i < count; i++)
+        {
+            byte* ptr = (byte*)ThreadCacheAllocator::Allocate(48);
+            REQUIRE(ptr);
+            Platform::MemorySet(ptr, 48, 0);
+            blocks[i] = ptr;
+        }
+        CHECK(ThreadCacheAllocator::GetStats().ReservedBytes == statsAfter.ReservedBytes);
+        for (byte* ptr : blocks)
+            ThreadCacheAllocator::Free(ptr);
+    }
+
+    SECTION("Test Thread Cache Limit")
+    {
+        // Freeing more blocks than the thread cache keeps moves them to the global pool
+        constexpr int32 count = 64;
+        constexpr uint32 size = 8 * 1024;
+        Array<void*> blocks;
+        for (int32 i = 0; i < count; i++)
+        {
+            void* ptr = ThreadCacheAllocator::Allocate(size);
+            REQUIRE(ptr);
+            blocks.Add(ptr);
+        }
+        const ThreadCacheAllocator::Stats statsBefore = ThreadCacheAllocator::GetStats();
+        for (void* ptr : blocks)
+            ThreadCacheAllocator::Free(ptr);
+        const ThreadCacheAllocator::Stats statsAfter = ThreadCacheAllocator::GetStats();
+        CHECK(statsAfter.PooledBytes >= statsBefore.PooledBytes + (count / 2) * size);
+
+        // Allocating them again takes the pooled blocks back
+        for (int32 i = 0; i < count; i++)
+            blocks[i] = ThreadCacheAllocator::Allocate(size);
+        const ThreadCacheAllocator::Stats statsRealloc = ThreadCacheAllocator::GetStats();
+        CHECK(statsRealloc.ReservedBytes == statsAfter.ReservedBytes);
+        CHECK(statsRealloc.PooledBytes < statsAfter.PooledBytes);
+        for (void* ptr : blocks)
+            ThreadCacheAllocator::Free(ptr);
+    }
+}
+
+TEST_CASE("PoolAllocator")
+{
+    SECTION("Test Allocate")
+    {
+        PoolAllocator pool(40, 4);
+        CHECK(pool.GetBlockSize() == 40);
+        CHECK(pool.GetCapacity() == 0);
+
+        // Blocks are aligned, don't overlap and know their pool
+        byte* blocks[10];
+        for (int32 i = 0; i < 10; i++)
+        {
+            blocks[i] = (byte*)pool.Allocate();
+            REQUIRE(blocks[i]);
+            CHECK(((uintptr)blocks[i] & 15) == 0);
+            CHECK(PoolAllocator::GetPool(blocks[i]) == &pool);
+            Platform::MemorySet(blocks[i], 40, i);
+        }
+        CHECK(pool.GetAllocatedCount() == 10);
+        CHECK(pool.GetCapacity() == 12);
+        for (int32 i = 0; i < 10; i++)
+            CHECK(IsFilled(blocks[i], 40, (byte)i));
+
+        // Freed blocks are reused without allocating more slabs
+        pool.Free(blocks[3]);
+        pool.Free(blocks[7]);
+        CHECK(pool.GetAllocatedCount() == 8);
+        CHECK(pool.Allocate() == blocks[7]);
+        CHECK(pool.Allocate() == blocks[3]);
+        CHECK(pool.GetCapacity() == 12);
+        pool.Free(nullptr);
+        for (byte* ptr : blocks)
+            pool.Free(ptr);
+        CHECK(pool.GetAllocatedCount() == 0);
+    }
+
+    SECTION("Test Reserve")
+    {
+        PoolAllocator pool(1, 8);
+        CHECK(pool.GetBlockSize() >= (int32)sizeof(void*));
+        pool.Reserve(20);
+        CHECK(pool.GetCapacity() == 24);
+        pool.Reserve(10);
+        CHECK(pool.GetCapacity() == 24);
+        Array<void*> blocks;
+        for (int32 i = 0; i < 24; i++)
+            blocks.Add(pool.Allocate());
+        CHECK(pool.GetCapacity() == 24);
+        for (void* ptr : blocks)
+            pool.Free(ptr);
+    }
+
+    SECTION("Test Threads")
+    {
+        constexpr int32 threads = 4;
+        constexpr int32 count = 2000;
+        PoolAllocator pool(32, 16);
+        Array<Thread*> threadsList;
+        volatile int64 failed = 0;
+        for (int32 thread = 0; thread < threads; thread++)
+        {
+            Thread* t = ThreadSpawner::Start([&pool, &failed, thread]
+            {
+                // Every thread fills its blocks with its own value and checks them before freeing
+                byte* blocks[16];
+                for (int32 i = 0; i < count; i++)
+                {
+                    byte*& ptr = blocks[i % 16];
+                    if (i >= 16)
+                    {
+                        if (!IsFilled(ptr, 32, (byte)thread))
+                            Platform::InterlockedIncrement(&failed);
+                        pool.Free(ptr);
+                    }
+                    ptr = (byte*)pool.Allocate();
+                    Platform::MemorySet(ptr, 32, thread);
+                }
+                for (byte* ptr : blocks)
+                    pool.Free(ptr);
+                return 0;
+            }, TEXT("Test PoolAllocator"));
+            REQUIRE(t);
+            threadsList.Add(t);
+        }
+        for (Thread* t : threadsList)
+        {
+            t->Join();
+            Delete(t);
+        }
+        CHECK(failed == 0);
+        CHECK(pool.GetAllocatedCount() == 0);
+        CHECK(pool.GetCapacity() <= threads * 16 + 16);
+    }
+}
+
+TEST_CASE("FrameAllocation")
+{
+    SECTION("Test Array")
+    {
+        Array<int32, FrameAllocation> a1;
+        for (int32 i = 0; i < 100000; i++)
+            a1.Add(i);
+        CHECK(a1.Count() == 100000);
+        CHECK(((uintptr)a1.Get() & 15) == 0);
+        bool valid = true;
+        for (int32 i = 0; i < a1.Count(); i++)
+            valid &= a1[i] == i;
+        CHECK(valid);
+        a1.RemoveAtKeepOrder(0);
+        CHECK(a1[0] == 1);
+        a1.Resize(10);
+        a1.SetCapacity(10);
+        CHECK(a1.Count() == 10);
+        CHECK(a1[9] == 10);
+
+        Array<int32, FrameAllocation> a2 = a1;
+        CHECK(a2.Count() == 10);
+        CHECK(a2.Get() != a1.Get());
+        a2.Swap(a1);
+        CHECK(a1.Count() == 10);
+        CHECK(a2[9] == 10);
+    }
+
+    SECTION("Test Dictionary")
+    {
+        Dictionary<int32, int32, FrameAllocation> a1;
+        for (int32 i = 0; i < 4000; i++)
+            a1.Add(i, i * 2);
+        CHECK(a1.Count() == 4000);
+        for (int32 i = 0; i < 4000; i += 2)
+            a1.Remove(i);
+        CHECK(a1.Count() == 2000);
+        bool valid = true;
+        for (int32 i = 0; i < 4000; i++)
+        {
+            int32 value;
+            const bool found = a1.TryGet(i, value);
+            valid &= found == (i % 2 == 1);
+            if (found)
+                valid &= value == i * 2;
+        }
+        CHECK(valid);
+    }
+
+    SECTION("Test Recycling")
+    {
+        FrameAllocation::NextFrame();
+        byte* a = (byte*)FrameAllocation::Allocate(100);
+        byte* b = (byte*)FrameAllocation::Allocate(16);
+        CHECK(((uintptr)a & 15) == 0);
+        CHECK(b == a + 112);
+        Platform::MemorySet(b, 16, 7);
+
+        // Allocations larger than the arena chunk get the dedicated memory
+        byte* c = (byte*)FrameAllocation::Allocate(1024 * 1024);
+        REQUIRE(c);
+        Platform::MemorySet(c, 1024 * 1024, 1);
+        CHECK(IsFilled(b, 16, 7));
+
+        // The next frame reuses the arena memory from the start
+        FrameAllocation::NextFrame();
+        byte* d = (byte*)FrameAllocation::Allocate(100);
+        CHECK(d == a);
+        {
+            Array<int32, FrameAllocation> array;
+            array.Resize(40000);
+        }
+        FrameAllocation::NextFrame();
+        byte* e = (byte*)FrameAllocation::Allocate(100);
+        CHECK(e == a);
+    }
+}
@@ -0,0 +1,184 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Threading/Parallel.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    // Sizes around the jobs splitting thresholds
+    const int32 TestSizes[] =
+    {
+        0, 1, 2, 63,
+        PARALLEL_MIN_GRAIN_SIZE - 1, PARALLEL_MIN_GRAIN_SIZE, PARALLEL_MIN_GRAIN_SIZE + 1,
+        1000,
+        PARALLEL_SORT_MIN_CHUNK_SIZE - 1, PARALLEL_SORT_MIN_CHUNK_SIZE, PARALLEL_SORT_MIN_CHUNK_SIZE + 1,
+        PARALLEL_MAX_RANGES * PARALLEL_MIN_GRAIN_SIZE + 3,
+        100000,
+    };
+
+    void FillRandom(Array<int32>& data, int32 count, uint32 seed, int32 range)
+    {
+        data.Resize(count);
+        for (int32 i = 0; i < count; i++)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            data[i] = (int32)((seed >> 8) % (uint32)range) - range / 2;
+        }
+    }
+
+    template<typename Op>
+    int64 ScanSequential(const Array<int64>& input, Array<int64>& output, int64 identity, const Op& op, bool inclusive)
+    {
+        output.Resize(input.Count());
+        int64 sum = identity;
+        for (int32 i = 0; i < input.Count(); i++)
+        {
+            if (inclusive)
+            {
+                sum = op(sum, input[i]);
+                output[i] = sum;
+            }
+            else
+            {
+                output[i] = sum;
+                sum = op(sum, input[i]);
+            }
+        }
+        return sum;
+    }
+}
+
+TEST_CASE("Parallel")
+{
+    SECTION("Test For")
+    {
+        const int32 grainSizes[] = { 0, 1, 7, PARALLEL_MIN_GRAIN_SIZE };
+        for (const int32 count : TestSizes)
+        {
+            for (const int32 grainSize : grainSizes)
+            {
+                // Every item has to be processed exactly once
+                Array<int32> visits;
+                visits.Resize(count);
+                visits.SetAll(0);
+                bool validRanges = true;
+                Parallel::For(count, grainSize, [&](int32 start, int32 end)
+                {
+                    if (start < 0 || start >= end || end > count)
+                        validRanges = false;
+                    for (int32 i = start; i < end; i++)
+                        visits[i]++;
+                });
+                CHECK(validRanges);
+                bool valid = true;
+                for (int32 i = 0; i < count; i++)
+                    valid &= visits[i] == 1;
+                CHECK(valid);
+            }
+        }
+
+        Array<int32> data;
+        FillRandom(data, 10000, 1, 1000);
+        Array<int32> expected = data;
+        for (int32& e : expected)
+            e *= 3;
+        Parallel::ForEach(data, [](int32& e) { e *= 3; });
+        CHECK(data == expected);
+    }
+
+    SECTION("Test Reduce")
+    {
+        for (const int32 count : TestSizes)
+        {
+            Array<int32> values;
+            FillRandom(values, count, count + 1, 100000);
+            Array<int64> data;
+            data.Resize(count);
+            int64 sum = 0, max = MIN_int64;
+            for (int32 i = 0; i < count; i++)
+            {
+                data[i] = values[i];
+                sum += data[i];
+                max = Math::Max(max, data[i]);
+            }
+            const auto add = [](const int64& a, const int64& b) { return a + b; };
+            const auto maxOp = [](const int64& a, const int64& b) { return Math::Max(a, b); };
+            CHECK(Parallel::Reduce(data, (int64)0, add) == sum);
+            CHECK(Parallel::Reduce(data, (int64)0, add, 1) == sum);
+            CHECK(Parallel::Reduce(data, MIN_int64, maxOp) == max);
+            CHECK(Parallel::Reduce(data, MIN_int64, maxOp, 5) == max);
+        }
+    }
+
+    SECTION("Test Scan")
+    {
+        const auto add = [](const int64& a, const int64& b) { return a + b; };
+        for (const int32 count : TestSizes)
+        {
+            Array<int32> values;
+            FillRandom(values, count, count + 7, 1000);
+            Array<int64> input;
+            input.Resize(count);
+            for (int32 i = 0; i < count; i++)
+                input[i] = values[i];
+            for (int32 inclusive = 0; inclusive < 2; inclusive++)
+            {
+                Array<int64> expected;
+                const int64 expectedTotal = ScanSequential(input, expected, 0, add, inclusive != 0);
+
+                // Separate output
+                Array<int64> output;
+                output.Resize(count);
+                int64 total = Parallel::Scan(Span<int64>(input.Get(), count), Span<int64>(output.Get(), count), (int64)0, add, inclusive != 0);
+                CHECK(total == expectedTotal);
+                CHECK(output == expected);
+                total = Parallel::Scan(Span<int64>(input.Get(), count), Span<int64>(output.Get(), count), (int64)0, add, inclusive != 0, 3);
+                CHECK(total == expectedTotal);
+                CHECK(output == expected);
+
+                // In-place
+                Array<int64> data = input;
+                total = Parallel::Scan(Span<int64>(data.Get(), count), Span<int64>(data.Get(), count), (int64)0, add, inclusive != 0);
+                CHECK(total == expectedTotal);
+                CHECK(data == expected);
+            }
+
+            // Prefix sum (exclusive, in-place)
+            Array<int64> expected;
+            const int64 expectedTotal = ScanSequential(input, expected, 0, add, false);
+            Array<int64> data = input;
+            CHECK(Parallel::PrefixSum(data) == expectedTotal);
+            CHECK(data == expected);
+        }
+    }
+
+    SECTION("Test Sort")
+    {
+        const int32 threads = Math::Max(JobSystem::GetThreadsCount(), 1);
+        Array<int32> sizes;
+        sizes.Add(TestSizes, ARRAY_COUNT(TestSizes));
+        sizes.Add(PARALLEL_SORT_MIN_CHUNK_SIZE * threads - 1);
+        sizes.Add(PARALLEL_SORT_MIN_CHUNK_SIZE * threads + 1);
+        sizes.Add(PARALLEL_SORT_MIN_CHUNK_SIZE * threads * 3 + 17);
+        for (const int32 count : sizes)
+        {
+            // Random values with many duplicates
+            Array<int32> data;
+            FillRandom(data, count, count + 3, Math::Max(count / 4, 1));
+            Array<int32> expected = data;
+            Sorting::QuickSort(expected.Get(), expected.Count());
+            Parallel::Sort(data);
+            CHECK(data == expected);
+
+            // Already sorted and reversed input
+            Parallel::Sort(data);
+            CHECK(data == expected);
+            for (int32 i = 0; i < count / 2; i++)
+                Swap(data[i], data[count - i - 1]);
+            Parallel::Sort(data);
+            CHECK(data == expected);
+        }
+    }
+}
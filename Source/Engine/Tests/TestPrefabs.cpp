@@ -3,7 +3,9 @@
 #include "Engine/Content/Content.h"
 #include "Engine/Content/AssetReference.h"
 #include "Engine/Core/Log.h"
+#include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Level/Actor.h"
+#include "Engine/Level/ActorsPool.h"
 #include "Engine/Level/Actors/EmptyActor.h"
 #include "Engine/Level/Prefabs/Prefab.h"
 #include "Engine/Level/Prefabs/PrefabManager.h"
@@ -557,4 +559,110 @@ TEST_CASE("Prefabs")
         Content::DeleteAsset(prefabNested1);
         Content::DeleteAsset(prefabBase);
     }
+    SECTION("Test Spawning Prefabs Batch")
+    {
+        // Create Prefab with a child attached to the root
+        AssetReference<Prefab> prefab = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefab);
+        auto prefabInit = prefab->Init(Prefab::TypeName,
+                                       "["
+                                       "{"
+                                       "\"ID\": \"3b2f0c9a4e1d7a6b5c8e9f0a1b2c3d4e\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"Name\": \"Root\""
+                                       "},"
+                                       "{"
+                                       "\"ID\": \"7c6d5e4f3a2b1c0d9e8f7a6b5c4d3e2f\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"ParentID\": \"3b2f0c9a4e1d7a6b5c8e9f0a1b2c3d4e\","
+                                       "\"Name\": \"Child\""
+                                       "}"
+                                       "]");
+        REQUIRE(!prefabInit);
+
+        // Spawn multiple instances at once
+        Array<Transform> transforms;
+        for (int32 i = 0; i < 10; i++)
+            transforms.Add(Transform(Vector3((Real)i * 100, 0, 0)));
+        Array<Actor*> instances = PrefabManager::SpawnPrefabs(prefab, transforms);
+
+        // Verify scenario
+        REQUIRE(instances.Count() == transforms.Count());
+        for (int32 i = 0; i < instances.Count(); i++)
+        {
+            Actor* instance = instances[i];
+            REQUIRE(instance);
+            REQUIRE(instance->GetName() == TEXT("Root"));
+            REQUIRE(instance->GetPosition() == transforms[i].Translation);
+            REQUIRE(instance->GetPrefabID() == prefab->GetID());
+            REQUIRE(instance->GetChildrenCount() == 1);
+            REQUIRE(instance->Children[0]->GetName() == TEXT("Child"));
+            for (int32 j = 0; j < i; j++)
+            {
+                REQUIRE(instance->GetID() != instances[j]->GetID());
+                REQUIRE(instance->Children[0]->GetID() != instances[j]->Children[0]->GetID());
+            }
+        }
+
+        // Cleanup
+        for (Actor* instance : instances)
+            instance->DeleteObject();
+        Content::DeleteAsset(prefab);
+    }
+    SECTION("Test Actors Pool")
+    {
+        AssetReference<Prefab> prefab = Content::CreateVirtualAsset<Prefab>();
+        REQUIRE(prefab);
+        auto prefabInit = prefab->Init(Prefab::TypeName,
+                                       "["
+                                       "{"
+                                       "\"ID\": \"5d1c7e3a4b2f4e8a9c6d0b1a2e3f4c5d\","
+                                       "\"TypeName\": \"FlaxEngine.EmptyActor\","
+                                       "\"Name\": \"Root\""
+                                       "}"
+                                       "]");
+        REQUIRE(!prefabInit);
+        auto parent = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+
+        // Released instance is deactivated and reused by the next spawn
+        Actor* a = ActorsPool::Spawn(prefab, parent, Transform(Vector3(100, 0, 0)));
+        REQUIRE(a);
+        CHECK(a->GetParent() == parent);
+        CHECK(a->GetPosition() == Vector3(100, 0, 0));
+        CHECK(ActorsPool::GetPooledCount(prefab) == 0);
+        ActorsPool::Release(a);
+        CHECK(!a->GetIsActive());
+        CHECK(ActorsPool::GetPooledCount(prefab) == 1);
+        Actor* b = ActorsPool::Spawn(prefab, parent, Transform(Vector3(0, 200, 0)));
+        CHECK(b == a);
+        CHECK(b->GetIsActive());
+        CHECK(b->GetPosition() == Vector3(0, 200, 0));
+        CHECK(ActorsPool::GetPooledCount(prefab) == 0);
+        ActorsPool::Release(b);
+
+        // Prewarm spawns only the missing instances
+        ActorsPool::Prewarm(prefab, parent, 3);
+        CHECK(ActorsPool::GetPooledCount(prefab) == 3);
+        CHECK(parent->GetChildrenCount() == 3);
+
+        // Pooled actors deleted with their parent are not reused
+        parent->DeleteObject();
+        ObjectsRemovalService::Flush();
+        CHECK(ActorsPool::GetPooledCount(prefab) == 0);
+        parent = EmptyActor::Spawn(ScriptingObject::SpawnParams(Guid::New(), EmptyActor::TypeInitializer));
+        Actor* c = ActorsPool::Spawn(prefab, parent, Transform::Identity);
+        REQUIRE(c);
+        CHECK(c->GetParent() == parent);
+
+        // Clear destroys the pooled actors
+        ActorsPool::Release(c);
+        ActorsPool::Clear();
+        ObjectsRemovalService::Flush();
+        CHECK(ActorsPool::GetPooledCount(prefab) == 0);
+        CHECK(parent->GetChildrenCount() == 0);
+
+        // Cleanup
+        parent->DeleteObject();
+        Content::DeleteAsset(prefab);
+    }
 }
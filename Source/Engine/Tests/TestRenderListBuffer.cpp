@@ -0,0 +1,94 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Renderer/RenderListBuffer.h"
+#include "Engine/Threading/ThreadSpawner.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+TEST_CASE("RenderListBuffer")
+{
+    SECTION("Test Local")
+    {
+        RenderListBuffer<int32> a1;
+        for (int32 i = 0; i < 10; i++)
+            CHECK(a1.AddLocal(i) == i);
+        CHECK(a1.Count() == RenderListBuffer<int32>::LocalChunkSize);
+        RenderListBuffer<int32>::CompactRemap remap;
+        a1.FlushLocal(&remap);
+        CHECK(remap.IsEmpty());
+        CHECK(a1.Count() == 10);
+        for (int32 i = 0; i < 10; i++)
+            CHECK(a1[i] == i);
+
+        // Items added after the reserved chunk get moved over its unused slots
+        CHECK(a1.AddLocal(10) == 10);
+        CHECK(a1.Add(11) == 10 + RenderListBuffer<int32>::LocalChunkSize);
+        a1.FlushLocal(&remap);
+        REQUIRE(remap.Count() == 1);
+        CHECK(a1.Count() == 12);
+        int32 index = 10 + RenderListBuffer<int32>::LocalChunkSize;
+        RenderListBuffer<int32>::RemapIndices(remap, &index, 1);
+        CHECK(index == 11);
+        CHECK(a1[11] == 11);
+
+        a1.Clear();
+        a1.AddLocal(1);
+        a1.Clear();
+        a1.FlushLocal();
+        CHECK(a1.Count() == 0);
+    }
+
+    SECTION("Test Threads")
+    {
+        // Every thread adds items and their indices, flushed indices have to point to the items after the compaction
+        constexpr int32 threads = 4;
+        constexpr int32 count = 1000;
+        RenderListBuffer<int32> items, indices;
+        Array<Thread*> threadsList;
+        for (int32 thread = 0; thread < threads; thread++)
+        {
+            Thread* t = ThreadSpawner::Start([&items, &indices, thread]
+            {
+                for (int32 i = 0; i < count; i++)
+                {
+                    const int32 value = (thread << 16) | i;
+                    indices.AddLocal(items.AddLocal(value));
+                    if (i % 100 == 0)
+                        items.Add(-1);
+                }
+                return 0;
+            }, TEXT("Test RenderListBuffer"));
+            REQUIRE(t);
+            threadsList.Add(t);
+        }
+        for (Thread* t : threadsList)
+        {
+            t->Join();
+            Delete(t);
+        }
+        RenderListBuffer<int32>::CompactRemap remap;
+        items.FlushLocal(&remap);
+        indices.FlushLocal();
+        RenderListBuffer<int32>::RemapIndices(remap, indices.Get(), indices.Count());
+        CHECK(items.Count() == threads * count + threads * (count / 100));
+        CHECK(indices.Count() == threads * count);
+        int32 next[threads] = {};
+        bool valid = true;
+        for (int32 i = 0; i < indices.Count(); i++)
+        {
+            const int32 index = indices[i];
+            if (index < 0 || index >= items.Count() || items[index] == -1)
+            {
+                valid = false;
+                continue;
+            }
+            const int32 value = items[index];
+            const int32 thread = value >> 16;
+            valid &= thread < threads && (value & 0xffff) == next[thread];
+            if (thread < threads)
+                next[thread]++;
+        }
+        CHECK(valid);
+        for (int32 thread = 0; thread < threads; thread++)
+            CHECK(next[thread] == count);
+    }
+}
@@ -1,6 +1,7 @@
 // Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
 
 #include "TestScripting.h"
+#include "Engine/Core/ObjectsRemovalService.h"
 #include "Engine/Scripting/Scripting.h"
 #include "Engine/Scripting/ManagedCLR/MClass.h"
 #include "Engine/Scripting/ManagedCLR/MMethod.h"
@@ -167,4 +168,32 @@ TEST_CASE("Scripting")
         CHECK(interfaceObject);
         CHECK(interfaceObject == object);
     }
+
+    SECTION("Test Objects Pool")
+    {
+        CHECK(ScriptingObjectsPool::GetAllocatedCount(Foo::TypeInitializer) == 0);
+        ScriptingObjectsPool::Reserve<Foo>(4);
+
+        // Objects of the pooled type are allocated from the pool
+        Foo* a = Foo::Spawn(ScriptingObject::SpawnParams(Guid::New(), Foo::TypeInitializer));
+        Foo* b = Foo::Spawn(ScriptingObject::SpawnParams(Guid::New(), Foo::TypeInitializer));
+        REQUIRE(a);
+        REQUIRE(b);
+        CHECK(EnumHasAnyFlags(a->Flags, ObjectFlags::IsPooled));
+        CHECK(EnumHasAnyFlags(b->Flags, ObjectFlags::IsPooled));
+        CHECK(ScriptingObjectsPool::GetAllocatedCount(Foo::TypeInitializer) == 2);
+
+        // Deleted object memory is reused by the next spawn
+        void* memory = b;
+        b->DeleteObject();
+        ObjectsRemovalService::Flush();
+        CHECK(ScriptingObjectsPool::GetAllocatedCount(Foo::TypeInitializer) == 1);
+        Foo* c = Foo::Spawn(ScriptingObject::SpawnParams(Guid::New(), Foo::TypeInitializer));
+        CHECK((void*)c == memory);
+        CHECK(c->FooInterface == nullptr);
+        a->DeleteObject();
+        c->DeleteObject();
+        ObjectsRemovalService::Flush();
+        CHECK(ScriptingObjectsPool::GetAllocatedCount(Foo::TypeInitializer) == 0);
+    }
 }
@@ -2,6 +2,7 @@
 
 #include "Engine/Core/Types/String.h"
 #include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Types/StringId.h"
 #include <ThirdParty/catch2/catch.hpp>
 
 TEST_CASE("String Replace")
@@ -380,3 +381,90 @@ TEST_CASE("String Compare")
         }
     }
 }
+
+TEST_CASE("String Inline Storage")
+{
+    SECTION("grow and shrink")
+    {
+        String str(TEXT("abc"));
+        str += TEXT("defgh");
+        CHECK(str == String("abcdefgh"));
+        str += TEXT("ijklmnop");
+        CHECK(str == String("abcdefghijklmnop"));
+        str.Remove(2, 12);
+        CHECK(str == String("abop"));
+        str.Insert(2, String(TEXT("0123456789")));
+        CHECK(str == String("ab0123456789op"));
+        str.Resize(3);
+        CHECK(str == String("ab0"));
+        CHECK(str.Replace(TEXT("0"), TEXT("xyzxyzxyzxyz")) == 1);
+        CHECK(str == String("abxyzxyzxyzxyz"));
+    }
+
+    SECTION("move")
+    {
+        String a(TEXT("short"));
+        String b = MoveTemp(a);
+        CHECK(a.IsEmpty());
+        CHECK(b == String("short"));
+        String c(TEXT("a longer text that is allocated on heap"));
+        c = MoveTemp(b);
+        CHECK(c == String("short"));
+        CHECK(b.IsEmpty());
+    }
+
+    SECTION("set from self")
+    {
+        String str(TEXT("hello"));
+        str = StringView(str).Substring(1);
+        CHECK(str == String("ello"));
+        str.Set(str.Get() + 1, 2);
+        CHECK(str == String("ll"));
+    }
+
+    SECTION("ansi")
+    {
+        StringAnsi str("hello");
+        str += "world and more text";
+        CHECK(str == StringAnsi("helloworld and more text"));
+        str.Remove(0, 5);
+        CHECK(str == StringAnsi("world and more text"));
+        const StringAnsi moved = MoveTemp(str);
+        CHECK(moved == StringAnsi("world and more text"));
+    }
+}
+
+TEST_CASE("StringId")
+{
+    SECTION("compare")
+    {
+        const StringId a(TEXT("Player.Health"));
+        const StringId b(String(TEXT("Player.Health")));
+        const StringId c(StringAnsiView("Player.Health"));
+        const StringId d(TEXT("Player.Mana"));
+        CHECK(a == b);
+        CHECK(a == c);
+        CHECK(a != d);
+        CHECK(GetHash(a) == GetHash(b));
+        CHECK(a.ToStringView() == TEXT("Player.Health"));
+        CHECK(a.Length() == 13);
+    }
+
+    SECTION("empty")
+    {
+        const StringId a;
+        const StringId b(StringView::Empty);
+        CHECK(a == b);
+        CHECK(a == StringId::Empty);
+        CHECK(a.IsEmpty());
+        CHECK(a.Length() == 0);
+        CHECK(StringView(a.GetText()).IsEmpty());
+    }
+
+    SECTION("find")
+    {
+        CHECK(StringId::Find(TEXT("StringId.Test.NotInterned")).IsEmpty());
+        const StringId a(TEXT("StringId.Test.Interned"));
+        CHECK(StringId::Find(TEXT("StringId.Test.Interned")) == a);
+    }
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "Engine/Core/Types/Variant.h"
+#include "Engine/Core/Types/String.h"
+#include "Engine/Core/Types/StringView.h"
+#include "Engine/Core/Math/Transform.h"
+#include "Engine/Core/Math/Double4.h"
+#include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/Ray.h"
+#include <ThirdParty/catch2/catch.hpp>
+
+namespace
+{
+    bool IsInline(const Variant& v, const void* value)
+    {
+        return (const byte*)value >= (const byte*)&v && (const byte*)value < (const byte*)&v + sizeof(Variant);
+    }
+}
+
+TEST_CASE("Variant")
+{
+    SECTION("Test Storage")
+    {
+        const Transform transform(Vector3(1, 2, 3), Quaternion::Euler(10, 20, 30), Float3(2, 2, 2));
+        const Double4 double4(1.0, 2.0, 3.0, 4.0);
+        Variant a1(transform);
+        Variant a2(double4);
+        CHECK(a1.AsTransform() == transform);
+        CHECK(a2.AsDouble4() == double4);
+#if USE_LARGE_WORLDS
+        CHECK(!IsInline(a1, &a1.AsTransform()));
+        CHECK(!IsInline(a2, &a2.AsDouble4()));
+#else
+        // Transform and Double4 are stored inline without a heap allocation
+        CHECK(IsInline(a1, &a1.AsTransform()));
+        CHECK(IsInline(a2, &a2.AsDouble4()));
+#endif
+
+        // Copy
+        Variant b1(a1);
+        Variant b2 = a2;
+        CHECK(b1 == a1);
+        CHECK(b2 == a2);
+        CHECK(&b1.AsTransform() != &a1.AsTransform());
+        CHECK(&b2.AsDouble4() != &a2.AsDouble4());
+    }
+
+    SECTION("Test Move")
+    {
+        const Transform transform(Vector3(1, 2, 3), Quaternion::Euler(10, 20, 30), Float3(2, 2, 2));
+        const Double4 double4(1.0, 2.0, 3.0, 4.0);
+        const BoundingBox box(Vector3(-1, -2, -3), Vector3(4, 5, 6));
+        const Ray ray(Vector3(1, 2, 3), Vector3::Up);
+
+        // Move constructor leaves the source empty (large worlds keep some types on the heap so the pointer has to be moved)
+        Variant a1(transform), a2(double4), a3(box), a4(ray), a5(TEXT("Text"));
+        Variant b1(MoveTemp(a1)), b2(MoveTemp(a2)), b3(MoveTemp(a3)), b4(MoveTemp(a4)), b5(MoveTemp(a5));
+        CHECK(a1.Type == VariantType::Null);
+        CHECK(a2.Type == VariantType::Null);
+        CHECK(a3.Type == VariantType::Null);
+        CHECK(a4.Type == VariantType::Null);
+        CHECK(a5.Type == VariantType::Null);
+        CHECK(b1.AsTransform() == transform);
+        CHECK(b2.AsDouble4() == double4);
+        CHECK(b3.AsBoundingBox() == box);
+        CHECK((Ray)b4 == ray);
+        CHECK((StringView)b5 == TEXT("Text"));
+
+        // Move assignment
+        Variant c1, c2(1.0f);
+        c1 = MoveTemp(b1);
+        c2 = MoveTemp(b2);
+        CHECK(b1.Type == VariantType::Null);
+        CHECK(b2.Type == VariantType::Null);
+        CHECK(c1.AsTransform() == transform);
+        CHECK(c2.AsDouble4() == double4);
+    }
+
+    SECTION("Test Cast")
+    {
+        // Cast of a value that already has the target type returns a copy
+        const Variant a1(TEXT("Text"));
+        Variant b1 = a1.Cast(VariantType(VariantType::String));
+        CHECK(b1 == a1);
+        CHECK((StringView)a1 == TEXT("Text"));
+        const Variant a2(1.5f);
+        CHECK(a2.Cast(VariantType(VariantType::Float)) == a2);
+        CHECK((int32)a2.Cast(VariantType(VariantType::Int)) == 1);
+        CHECK(a2.Type == VariantType::Float);
+
+        // Cast of a temporary value moves it if it already has the target type
+        Variant a3(TEXT("Text"));
+        Variant b3 = MoveTemp(a3).Cast(VariantType(VariantType::String));
+        CHECK(a3.Type == VariantType::Null);
+        CHECK((StringView)b3 == TEXT("Text"));
+        Variant a4(2.5f);
+        Variant b4 = MoveTemp(a4).Cast(VariantType(VariantType::Int));
+        CHECK(a4.Type == VariantType::Float);
+        CHECK(b4.Type == VariantType::Int);
+        CHECK((int32)b4 == 2);
+    }
+}
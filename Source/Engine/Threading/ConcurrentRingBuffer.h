@@ -0,0 +1,292 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "Engine/Platform/Platform.h"
+#include "Engine/Core/Memory/Memory.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/NonCopyable.h"
+
+/// <summary>
+/// Bounded wait-free ring buffer for a single producer thread and a single consumer thread (eg. audio streaming or per-thread events buffer read by the main thread). Producer and consumer indices are placed on separate cache lines to prevent false sharing.
+/// </summary>
+/// <remarks>
+/// Capacity is rounded up to the power of two. Items are default-constructed up-front and passed by assignment (slots are reused).
+/// </remarks>
+template<typename T>
+class SPSCRingBuffer : public NonCopyable
+{
+private:
+    T* _data;
+    int64 _capacity;
+    int64 _mask;
+    byte _padding0[PLATFORM_CACHE_LINE_SIZE];
+
+    // Producer-owned (write position and the last seen read position)
+    int64 volatile _tail = 0;
+    int64 _cachedHead = 0;
+    byte _padding1[PLATFORM_CACHE_LINE_SIZE - sizeof(int64) * 2];
+
+    // Consumer-owned (read position and the last seen write position)
+    int64 volatile _head = 0;
+    int64 _cachedTail = 0;
+    byte _padding2[PLATFORM_CACHE_LINE_SIZE - sizeof(int64) * 2];
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="SPSCRingBuffer"/> class.
+    /// </summary>
+    /// <param name="capacity">The buffer capacity (rounded up to the power of two).</param>
+    explicit SPSCRingBuffer(int32 capacity)
+    {
+        _capacity = Math::RoundUpToPowerOf2((int64)Math::Max(capacity, 2));
+        _mask = _capacity - 1;
+        _data = NewArray<T>((uint32)_capacity);
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="SPSCRingBuffer"/> class.
+    /// </summary>
+    ~SPSCRingBuffer()
+    {
+        DeleteArray(_data, (uint32)_capacity);
+    }
+
+public:
+    /// <summary>
+    /// Gets the buffer capacity.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return (int32)_capacity;
+    }
+
+    /// <summary>
+    /// Gets an estimate of the amount of the items in the buffer (exact if called from producer or consumer thread while the other one is idle).
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return (int32)(Platform::AtomicRead(&_tail) - Platform::AtomicRead(&_head));
+    }
+
+public:
+    /// <summary>
+    /// Adds the item to the buffer. Can be called only from the producer thread.
+    /// </summary>
+    /// <param name="item">The item.</param>
+    /// <returns>True if item has been added, false if buffer is full.</returns>
+    bool TryEnqueue(const T& item)
+    {
+        return TryEnqueue(&item, 1) == 1;
+    }
+
+    /// <summary>
+    /// Adds the items to the buffer (as many as fit). Can be called only from the producer thread.
+    /// </summary>
+    /// <param name="items">The items.</param>
+    /// <param name="count">The amount of items to add.</param>
+    /// <returns>The amount of the added items.</returns>
+    int32 TryEnqueue(const T* items, int32 count)
+    {
+        const int64 tail = _tail;
+        int64 space = _capacity - (tail - _cachedHead);
+        if (space < count)
+        {
+            _cachedHead = Platform::AtomicRead(&_head);
+            space = _capacity - (tail - _cachedHead);
+        }
+        count = (int32)Math::Min<int64>(count, space);
+        for (int32 i = 0; i < count; i++)
+            _data[(tail + i) & _mask] = items[i];
+        Platform::AtomicStore(&_tail, tail + count);
+        return count;
+    }
+
+    /// <summary>
+    /// Removes the item from the buffer. Can be called only from the consumer thread.
+    /// </summary>
+    /// <param name="item">The output item.</param>
+    /// <returns>True if item has been removed, false if buffer is empty.</returns>
+    bool TryDequeue(T& item)
+    {
+        return TryDequeue(&item, 1) == 1;
+    }
+
+    /// <summary>
+    /// Removes the items from the buffer (up to the given amount). Can be called only from the consumer thread.
+    /// </summary>
+    /// <param name="items">The output items.</param>
+    /// <param name="maxCount">The maximum amount of items to remove.</param>
+    /// <returns>The amount of the removed items.</returns>
+    int32 TryDequeue(T* items, int32 maxCount)
+    {
+        const int64 head = _head;
+        int64 available = _cachedTail - head;
+        if (available < maxCount)
+        {
+            _cachedTail = Platform::AtomicRead(&_tail);
+            available = _cachedTail - head;
+        }
+        const int32 count = (int32)Math::Min<int64>(maxCount, available);
+        for (int32 i = 0; i < count; i++)
+            items[i] = MoveTemp(_data[(head + i) & _mask]);
+        Platform::AtomicStore(&_head, head + count);
+        return count;
+    }
+};
+
+/// <summary>
+/// Bounded lock-free ring buffer for multiple producer threads and a single consumer thread (eg. log messages or network packets gathered on the main thread). Producers reserve the slots with a single atomic operation (also for the batch) and the consumer never blocks producers.
+/// </summary>
+/// <remarks>
+/// Capacity is rounded up to the power of two. Items are default-constructed up-front and passed by assignment (slots are reused). Based on the bounded queue algorithm by Dmitry Vyukov.
+/// </remarks>
+template<typename T>
+class MPSCRingBuffer : public NonCopyable
+{
+private:
+    struct Cell
+    {
+        int64 volatile Sequence;
+        T Data;
+    };
+
+    Cell* _cells;
+    int64 _capacity;
+    int64 _mask;
+    byte _padding0[PLATFORM_CACHE_LINE_SIZE];
+
+    // Shared by producers
+    int64 volatile _tail = 0;
+    byte _padding1[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+
+    // Consumer-owned
+    int64 volatile _head = 0;
+    byte _padding2[PLATFORM_CACHE_LINE_SIZE - sizeof(int64)];
+
+public:
+    /// <summary>
+    /// Initializes a new instance of the <see cref="MPSCRingBuffer"/> class.
+    /// </summary>
+    /// <param name="capacity">The buffer capacity (rounded up to the power of two).</param>
+    explicit MPSCRingBuffer(int32 capacity)
+    {
+        _capacity = Math::RoundUpToPowerOf2((int64)Math::Max(capacity, 2));
+        _mask = _capacity - 1;
+        _cells = NewArray<Cell>((uint32)_capacity);
+        for (int64 i = 0; i < _capacity; i++)
+            _cells[i].Sequence = i;
+    }
+
+    /// <summary>
+    /// Finalizes an instance of the <see cref="MPSCRingBuffer"/> class.
+    /// </summary>
+    ~MPSCRingBuffer()
+    {
+        DeleteArray(_cells, (uint32)_capacity);
+    }
+
+public:
+    /// <summary>
+    /// Gets the buffer capacity.
+    /// </summary>
+    FORCE_INLINE int32 Capacity() const
+    {
+        return (int32)_capacity;
+    }
+
+    /// <summary>
+    /// Gets an estimate of the amount of the items in the buffer (includes slots reserved by producers that are still being written).
+    /// </summary>
+    FORCE_INLINE int32 Count() const
+    {
+        return (int32)Math::Max<int64>(Platform::AtomicRead(&_tail) - Platform::AtomicRead(&_head), 0);
+    }
+
+public:
+    /// <summary>
+    /// Adds the item to the buffer. Can be called from any thread.
+    /// </summary>
+    /// <param name="item">The item.</param>
+    /// <returns>True if item has been added, false if buffer is full.</returns>
+    FORCE_INLINE bool TryEnqueue(const T& item)
+    {
+        return TryEnqueue(&item, 1);
+    }
+
+    /// <summary>
+    /// Adds the items to the buffer as a continuous batch (consumer will see them in order, not interleaved with other producers). Can be called from any thread.
+    /// </summary>
+    /// <param name="items">The items.</param>
+    /// <param name="count">The amount of items to add (must not exceed the capacity).</param>
+    /// <returns>True if items have been added, false if buffer has not enough free space (nothing is added).</returns>
+    bool TryEnqueue(const T* items, int32 count)
+    {
+        ASSERT_LOW_LAYER(count > 0 && count <= _capacity);
+        int64 pos = Platform::AtomicRead(&_tail);
+        while (true)
+        {
+            // Consumer releases slots in order so if the last slot of the batch is free then all of them are
+            const int64 last = pos + count - 1;
+            const int64 sequence = Platform::AtomicRead(&_cells[last & _mask].Sequence);
+            const int64 diff = sequence - last;
+            if (diff == 0)
+            {
+                const int64 prev = Platform::InterlockedCompareExchange(&_tail, pos + count, pos);
+                if (prev == pos)
+                    break;
+                pos = prev;
+            }
+            else if (diff < 0)
+            {
+                // Full
+                return false;
+            }
+            else
+            {
+                pos = Platform::AtomicRead(&_tail);
+            }
+        }
+        for (int32 i = 0; i < count; i++)
+        {
+            Cell& cell = _cells[(pos + i) & _mask];
+            cell.Data = items[i];
+            Platform::AtomicStore(&cell.Sequence, pos + i + 1);
+        }
+        return true;
+    }
+
+    /// <summary>
+    /// Removes the item from the buffer. Can be called only from the consumer thread.
+    /// </summary>
+    /// <param name="item">The output item.</param>
+    /// <returns>True if item has been removed, false if buffer is empty (or the next item is still being written by the producer).</returns>
+    FORCE_INLINE bool TryDequeue(T& item)
+    {
+        return TryDequeue(&item, 1) == 1;
+    }
+
+    /// <summary>
+    /// Removes the items from the buffer (up to the given amount). Can be called only from the consumer thread.
+    /// </summary>
+    /// <param name="items">The output items.</param>
+    /// <param name="maxCount">The maximum amount of items to remove.</param>
+    /// <returns>The amount of the removed items.</returns>
+    int32 TryDequeue(T* items, int32 maxCount)
+    {
+        const int64 head = _head;
+        int32 count = 0;
+        while (count < maxCount)
+        {
+            const int64 pos = head + count;
+            Cell& cell = _cells[pos & _mask];
+            if (Platform::AtomicRead(&cell.Sequence) != pos + 1)
+                break;
+            items[count++] = MoveTemp(cell.Data);
+            Platform::AtomicStore(&cell.Sequence, pos + _capacity);
+        }
+        if (count)
+            Platform::AtomicStore(&_head, head + count);
+        return count;
+    }
+};
@@ -2,6 +2,7 @@
 
 #include "JobSystem.h"
 #include "IRunnable.h"
+#include "ThreadRegistry.h"
 #include "Engine/Platform/CPUInfo.h"
 #include "Engine/Platform/Thread.h"
 #include "Engine/Platform/ConditionVariable.h"
@@ -17,10 +18,14 @@
 // JOB_SYSTEM_USE_MUTEX=1, enqueue=130-280 cycles, dequeue=2-6 cycles
 // JOB_SYSTEM_USE_MUTEX=0, enqueue=300-700 cycles, dequeue=10-16 cycles
 // So using RingBuffer+Mutex+Signals is better than moodycamel::ConcurrentQueue
+// Queues hold job contexts (single dispatch) and threads claim job indices from it via atomic counter, thus large dispatches don't need to enqueue every job separately.
+// JOB_SYSTEM_USE_WORK_STEALING=1 uses per-thread Chase-Lev deques for dispatches made from job threads (local LIFO pop and stealing from random victim), global queue is used only for dispatches from other threads.
 
 #define JOB_SYSTEM_ENABLED 1
 #define JOB_SYSTEM_USE_MUTEX 1
+#define JOB_SYSTEM_USE_WORK_STEALING 1
 #define JOB_SYSTEM_USE_STATS 0
+#define JOB_SYSTEM_LOCAL_QUEUE_SIZE 256
 
 #if JOB_SYSTEM_USE_STATS
 #include "Engine/Core/Log.h"
@@ -46,19 +51,97 @@ class JobSystemService : public EngineService
     void Dispose() override;
 };
 
-struct JobData
+struct JobContext
 {
     Function<void(int32)> Job;
-    int32 Index;
-    int64 JobKey;
+    int64 Label;
+    int32 JobsCount;
+    // Index of the next job to execute (claimed by threads).
+    volatile int64 NextIndex;
+    // Amount of jobs that are not yet finished.
+    volatile int64 JobsLeft;
+    // References count (one for the dispatch and one per every queue entry).
+    volatile int64 RefCount;
+    // Amount of dependencies that are not yet finished (job can start once it gets to zero).
+    volatile int64 DependenciesLeft;
+    // Amount of queue entries to add once all dependencies are done.
+    int32 EntriesCount;
+    // Dispatches waiting for this one to finish (accessed within JobsLocker).
+    Array<JobContext*> Dependents;
+    // Callbacks to call after all jobs are done (accessed within JobsLocker).
+    Array<Function<void()>> Continuations;
+    JobContext* NextFree;
 };
 
-template<>
-struct TIsPODType<JobData>
+#if JOB_SYSTEM_USE_WORK_STEALING
+
+// Chase-Lev work-stealing deque with fixed capacity. Owner thread pushes and pops items from the bottom (LIFO), other threads steal from the top (FIFO).
+class JobQueue
 {
-    enum { Value = false };
+private:
+    volatile int64 _top = 0;
+    volatile int64 _bottom = 0;
+    JobContext* _items[JOB_SYSTEM_LOCAL_QUEUE_SIZE];
+
+public:
+    // Called only by the owner thread. Returns false if queue is full.
+    bool Push(JobContext* item)
+    {
+        const int64 bottom = Platform::AtomicRead(&_bottom);
+        const int64 top = Platform::AtomicRead(&_top);
+        if (bottom - top >= JOB_SYSTEM_LOCAL_QUEUE_SIZE)
+            return false;
+        _items[bottom & (JOB_SYSTEM_LOCAL_QUEUE_SIZE - 1)] = item;
+        Platform::AtomicStore(&_bottom, bottom + 1);
+        return true;
+    }
+
+    // Called only by the owner thread.
+    JobContext* Pop()
+    {
+        const int64 bottom = Platform::AtomicRead(&_bottom) - 1;
+        Platform::AtomicStore(&_bottom, bottom);
+        Platform::MemoryBarrier();
+        const int64 top = Platform::AtomicRead(&_top);
+        if (top > bottom)
+        {
+            // Empty
+            Platform::AtomicStore(&_bottom, bottom + 1);
+            return nullptr;
+        }
+        JobContext* item = _items[bottom & (JOB_SYSTEM_LOCAL_QUEUE_SIZE - 1)];
+        if (top == bottom)
+        {
+            // Last item so race against stealing threads
+            if (Platform::InterlockedCompareExchange(&_top, top + 1, top) != top)
+                item = nullptr;
+            Platform::AtomicStore(&_bottom, bottom + 1);
+        }
+        return item;
+    }
+
+    // Called by any thread.
+    JobContext* Steal()
+    {
+        const int64 top = Platform::AtomicRead(&_top);
+        Platform::MemoryBarrier();
+        const int64 bottom = Platform::AtomicRead(&_bottom);
+        if (top >= bottom)
+            return nullptr;
+        JobContext* item = _items[top & (JOB_SYSTEM_LOCAL_QUEUE_SIZE - 1)];
+        if (Platform::InterlockedCompareExchange(&_top, top + 1, top) != top)
+            return nullptr;
+        return item;
+    }
+
+    FORCE_INLINE bool IsEmpty() const
+    {
+        return Platform::AtomicRead(&_bottom) <= Platform::AtomicRead(&_top);
+    }
 };
 
+#endif
+
 class JobSystemThread : public IRunnable
 {
 public:
@@ -79,17 +162,6 @@ class JobSystemThread : public IRunnable
     }
 };
 
-struct JobContext
-{
-    volatile int64 JobsLeft;
-};
-
-template<>
-struct TIsPODType<JobContext>
-{
-    enum { Value = true };
-};
-
 namespace
 {
     JobSystemService JobSystemInstance;
@@ -98,16 +170,22 @@ namespace
     bool JobStartingOnDispatch = true;
     volatile int64 ExitFlag = 0;
     volatile int64 JobLabel = 0;
-    Dictionary<int64, JobContext> JobContexts;
+    Dictionary<int64, JobContext*> JobContexts;
+    JobContext* JobContextsPool = nullptr;
     ConditionVariable JobsSignal;
     CriticalSection JobsMutex;
     ConditionVariable WaitSignal;
     CriticalSection WaitMutex;
     CriticalSection JobsLocker;
 #if JOB_SYSTEM_USE_MUTEX
-    RingBuffer<JobData> Jobs;
+    RingBuffer<JobContext*> Jobs;
 #else
-    ConcurrentQueue<JobData> Jobs;
+    ConcurrentQueue<JobContext*> Jobs;
+#endif
+#if JOB_SYSTEM_USE_WORK_STEALING
+    JobQueue LocalJobs[ARRAY_COUNT(Threads)];
+    THREADLOCAL int32 ThreadIndex = -1;
+    THREADLOCAL uint32 ThreadRandom = 0;
 #endif
 #if JOB_SYSTEM_USE_STATS
     int64 DequeueCount = 0;
@@ -151,41 +229,192 @@ void JobSystemService::Dispose()
             Threads[i] = nullptr;
         }
     }
+
+    JobsLocker.Lock();
+    while (JobContextsPool)
+    {
+        JobContext* context = JobContextsPool;
+        JobContextsPool = context->NextFree;
+        Delete(context);
+    }
+    JobsLocker.Unlock();
+}
+
+JobContext* AllocateContext()
+{
+    // Reuse contexts to reduce dynamic memory allocations (called within JobsLocker)
+    JobContext* context = JobContextsPool;
+    if (context)
+        JobContextsPool = context->NextFree;
+    else
+        context = New<JobContext>();
+    context->NextFree = nullptr;
+    return context;
+}
+
+void ReleaseContext(JobContext* context)
+{
+    if (Platform::InterlockedDecrement(&context->RefCount) == 0)
+    {
+        JobsLocker.Lock();
+        context->Job.Unbind();
+        context->Dependents.Clear();
+        context->Continuations.Clear();
+        context->NextFree = JobContextsPool;
+        JobContextsPool = context;
+        JobsLocker.Unlock();
+    }
+}
+
+void EnqueueContext(JobContext* context, int32 count)
+{
+#if JOB_SYSTEM_USE_WORK_STEALING
+    // Dispatch from the job thread goes to the thread local queue (other threads can steal it)
+    const int32 threadIndex = ThreadIndex;
+    if (threadIndex != -1)
+    {
+        JobQueue& queue = LocalJobs[threadIndex];
+        while (count > 0 && queue.Push(context))
+            count--;
+        if (count == 0)
+            return;
+    }
+#endif
+#if JOB_SYSTEM_USE_MUTEX
+    JobsLocker.Lock();
+    for (int32 i = 0; i < count; i++)
+        Jobs.PushBack(context);
+    JobsLocker.Unlock();
+#else
+    for (int32 i = 0; i < count; i++)
+        Jobs.enqueue(context);
+#endif
+}
+
+JobContext* DequeueContext()
+{
+#if JOB_SYSTEM_USE_WORK_STEALING
+    // Try to get job from the local queue (the most recently added first)
+    const int32 threadIndex = ThreadIndex;
+    if (threadIndex != -1)
+    {
+        if (JobContext* context = LocalJobs[threadIndex].Pop())
+            return context;
+    }
+#endif
+
+    // Try to get job from the global queue
+    JobContext* context = nullptr;
+#if JOB_SYSTEM_USE_MUTEX
+    JobsLocker.Lock();
+    if (Jobs.Count() != 0)
+    {
+        context = Jobs.PeekFront();
+        Jobs.PopFront();
+    }
+    JobsLocker.Unlock();
+#else
+    if (!Jobs.try_dequeue(context))
+        context = nullptr;
+#endif
+
+#if JOB_SYSTEM_USE_WORK_STEALING
+    if (!context && ThreadsCount > 1)
+    {
+        // Try to steal job from the random thread
+        uint32& random = ThreadRandom;
+        if (random == 0)
+            random = (uint32)(threadIndex + 1) * 2654435761u;
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+        const int32 start = (int32)(random % (uint32)ThreadsCount);
+        for (int32 i = 0; i < ThreadsCount && !context; i++)
+        {
+            const int32 victim = (start + i) % ThreadsCount;
+            if (victim != threadIndex)
+                context = LocalJobs[victim].Steal();
+        }
+    }
+#endif
+
+    return context;
+}
+
+void StartContext(JobContext* context)
+{
+    EnqueueContext(context, context->EntriesCount);
+    if (JobStartingOnDispatch)
+    {
+        if (context->EntriesCount == 1)
+            JobsSignal.NotifyOne();
+        else
+            JobsSignal.NotifyAll();
+    }
+}
+
+void EndContext(JobContext* context)
+{
+    // Last job done so end the dispatch
+    Array<JobContext*, InlinedAllocation<8>> dependents;
+    Array<Function<void()>, InlinedAllocation<4>> continuations;
+    JobsLocker.Lock();
+    JobContexts.Remove(context->Label);
+    dependents.Add(context->Dependents);
+    continuations.Add(context->Continuations);
+    JobsLocker.Unlock();
+
+    for (const auto& continuation : continuations)
+        continuation();
+
+    // Start dispatches that were waiting for this one
+    for (JobContext* dependent : dependents)
+    {
+        if (Platform::InterlockedDecrement(&dependent->DependenciesLeft) == 0)
+            StartContext(dependent);
+    }
+
+    WaitSignal.NotifyAll();
+    ReleaseContext(context);
+}
+
+void ExecuteContext(JobContext* context)
+{
+    // Claim and run jobs from the context until all are taken
+    while (true)
+    {
+        const int64 index = Platform::InterlockedIncrement(&context->NextIndex) - 1;
+        if (index >= context->JobsCount)
+            break;
+        context->Job((int32)index);
+        if (Platform::InterlockedDecrement(&context->JobsLeft) == 0)
+            EndContext(context);
+    }
 }
 
 int32 JobSystemThread::Run()
 {
-    Platform::SetThreadAffinityMask(1ull << Index);
+#if JOB_SYSTEM_USE_WORK_STEALING
+    ThreadIndex = (int32)Index;
+#endif
 
-    JobData data;
     bool attachCSharpThread = true;
-#if !JOB_SYSTEM_USE_MUTEX
-    moodycamel::ConsumerToken consumerToken(Jobs);
-#endif
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
+        // Pin worker to the CPU core (from the cores matching the placement policy)
+        ThreadRegistry::UpdateThreadPlacement(ThreadRegistry::ThreadType::Worker, ThreadPriority::AboveNormal, (int32)Index);
+
         // Try to get a job
 #if JOB_SYSTEM_USE_STATS
         const auto start = Platform::GetTimeCycles();
 #endif
-#if JOB_SYSTEM_USE_MUTEX
-        JobsLocker.Lock();
-        if (Jobs.Count() != 0)
-        {
-            data = Jobs.PeekFront();
-            Jobs.PopFront();
-        }
-        JobsLocker.Unlock();
-#else
-        if (!Jobs.try_dequeue(consumerToken, data))
-            data.Job.Unbind();
-#endif
+        JobContext* context = DequeueContext();
 #if JOB_SYSTEM_USE_STATS
         Platform::InterlockedIncrement(&DequeueCount);
         Platform::InterlockedAdd(&DequeueSum, Platform::GetTimeCycles() - start);
 #endif
 
-        if (data.Job.IsBinded())
+        if (context)
         {
 #if USE_CSHARP
             // Ensure to have C# thread attached to this thead (late init due to MCore being initialized after Job System)
@@ -196,22 +425,9 @@ int32 JobSystemThread::Run()
             }
 #endif
 
-            // Run job
-            data.Job(data.Index);
-
-            // Move forward with the job queue
-            JobsLocker.Lock();
-            JobContext& context = JobContexts.At(data.JobKey);
-            if (Platform::InterlockedDecrement(&context.JobsLeft) <= 0)
-            {
-                ASSERT_LOW_LAYER(context.JobsLeft <= 0);
-                JobContexts.Remove(data.JobKey);
-            }
-            JobsLocker.Unlock();
-
-            WaitSignal.NotifyAll();
-
-            data.Job.Unbind();
+            // Run jobs
+            ExecuteContext(context);
+            ReleaseContext(context);
         }
         else
         {
@@ -229,10 +445,9 @@ int32 JobSystemThread::Run()
 void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
 {
 #if JOB_SYSTEM_ENABLED
-    // TODO: disable async if called on job thread? or maybe Wait should handle waiting in job thread to do the processing?
     if (jobCount > 1)
     {
-        // Async
+        // Async (waiting thread participates in the jobs execution)
         const int64 jobWaitHandle = Dispatch(job, jobCount);
         Wait(jobWaitHandle);
     }
@@ -246,6 +461,11 @@ void JobSystem::Execute(const Function<void(int32)>& job, int32 jobCount)
 }
 
 int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
+{
+    return Dispatch(job, jobCount, Span<int64>());
+}
+
+int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount, const Span<int64>& dependencies)
 {
     PROFILE_CPU();
     if (jobCount <= 0)
@@ -256,39 +476,39 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 #endif
     const auto label = Platform::InterlockedAdd(&JobLabel, (int64)jobCount) + jobCount;
 
-    JobData data;
-    data.Job = job;
-    data.JobKey = label;
+    // Every thread can pick the dispatch from the queue so limit the amount of queue entries
+    const int32 entriesCount = Math::Clamp(jobCount, 1, ThreadsCount);
 
-    JobContext context;
-    context.JobsLeft = jobCount;
-
-#if JOB_SYSTEM_USE_MUTEX
-    JobsLocker.Lock();
-    JobContexts.Add(label, context);
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.PushBack(data);
-    JobsLocker.Unlock();
-#else
     JobsLocker.Lock();
+    JobContext* context = AllocateContext();
+    context->Job = job;
+    context->Label = label;
+    context->JobsCount = jobCount;
+    context->NextIndex = 0;
+    context->JobsLeft = jobCount;
+    context->RefCount = 1 + entriesCount;
+    context->EntriesCount = entriesCount;
+    context->DependenciesLeft = 1; // Guard to prevent starting the job until all dependencies are linked
+    for (int32 i = 0; i < dependencies.Length(); i++)
+    {
+        JobContext* dependency = nullptr;
+        if (JobContexts.TryGet(dependencies[i], dependency) && dependency != context)
+        {
+            dependency->Dependents.Add(context);
+            Platform::InterlockedIncrement(&context->DependenciesLeft);
+        }
+    }
     JobContexts.Add(label, context);
     JobsLocker.Unlock();
-    for (data.Index = 0; data.Index < jobCount; data.Index++)
-        Jobs.enqueue(data);
-#endif
+
+    // Start job unless it waits for any dependencies (last finished dependency will start it)
+    if (Platform::InterlockedDecrement(&context->DependenciesLeft) == 0)
+        StartContext(context);
 
 #if JOB_SYSTEM_USE_STATS
     LOG(Info, "Job enqueue time: {0} cycles", (int64)(Platform::GetTimeCycles() - start));
 #endif
 
-    if (JobStartingOnDispatch)
-    {
-        if (jobCount == 1)
-            JobsSignal.NotifyOne();
-        else
-            JobsSignal.NotifyAll();
-    }
-
     return label;
 #else
     for (int32 i = 0; i < jobCount; i++)
@@ -297,6 +517,24 @@ int64 JobSystem::Dispatch(const Function<void(int32)>& job, int32 jobCount)
 #endif
 }
 
+void JobSystem::AddContinuation(int64 label, const Function<void()>& continuation)
+{
+#if JOB_SYSTEM_ENABLED
+    JobsLocker.Lock();
+    JobContext* context = nullptr;
+    if (JobContexts.TryGet(label, context))
+    {
+        context->Continuations.Add(continuation);
+        JobsLocker.Unlock();
+        return;
+    }
+    JobsLocker.Unlock();
+#endif
+
+    // Dispatch has been already completed
+    continuation();
+}
+
 void JobSystem::Wait()
 {
 #if JOB_SYSTEM_ENABLED
@@ -325,14 +563,25 @@ void JobSystem::Wait(int64 label)
     while (Platform::AtomicRead(&ExitFlag) == 0)
     {
         JobsLocker.Lock();
-        const JobContext* context = JobContexts.TryGet(label);
+        JobContext* context = nullptr;
+        JobContexts.TryGet(label, context);
+        if (context)
+            Platform::InterlockedIncrement(&context->RefCount);
         JobsLocker.Unlock();
 
         // Skip if context has been already executed (last job removes it)
         if (!context)
             break;
 
-        // Wait on signal until input label is not yet done
+        // Run pending jobs of this dispatch on the waiting thread instead of blocking (unless it still waits for dependencies)
+        if (Platform::AtomicRead(&context->DependenciesLeft) == 0)
+            ExecuteContext(context);
+        const bool done = Platform::AtomicRead(&context->JobsLeft) <= 0;
+        ReleaseContext(context);
+        if (done)
+            break;
+
+        // Wait on signal until input label is not yet done (remaining jobs are being executed by other threads)
         WaitMutex.Lock();
         WaitSignal.Wait(WaitMutex, 1);
         WaitMutex.Unlock();
@@ -357,10 +606,15 @@ void JobSystem::SetJobStartingOnDispatch(bool value)
     {
 #if JOB_SYSTEM_USE_MUTEX
         JobsLocker.Lock();
-        const int32 count = Jobs.Count();
+        int32 count = Jobs.Count();
         JobsLocker.Unlock();
 #else
-        const int32 count = Jobs.Count();
+        int32 count = (int32)Jobs.Count();
+#endif
+#if JOB_SYSTEM_USE_WORK_STEALING
+        // Jobs dispatched from job thread are in its local queue
+        if (ThreadIndex != -1 && !LocalJobs[ThreadIndex].IsEmpty())
+            count = ThreadsCount;
 #endif
         if (count == 1)
             JobsSignal.NotifyOne();
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Engine/Core/Delegate.h"
+#include "Engine/Core/Types/Span.h"
 
 /// <summary>
 /// Lightweight multi-threaded jobs execution scheduler. Uses a pool of threads and supports work-stealing concept.
@@ -26,6 +27,22 @@ API_CLASS(Static) class FLAXENGINE_API JobSystem
     /// <returns>The label identifying this dispatch. Can be used to wait for the execution end.</returns>
     API_FUNCTION() static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount = 1);
 
+    /// <summary>
+    /// Dispatches the job for the execution after all the given dependencies are done. Doesn't block the calling thread.
+    /// </summary>
+    /// <param name="job">The job. Argument is an index of the job execution.</param>
+    /// <param name="jobCount">The job executions count.</param>
+    /// <param name="dependencies">The labels of the dispatches (returned by Dispatch) that have to finish before this job can start. Already completed (or invalid) labels are ignored.</param>
+    /// <returns>The label identifying this dispatch. Can be used to wait for the execution end or as a dependency for other jobs.</returns>
+    static int64 Dispatch(const Function<void(int32)>& job, int32 jobCount, const Span<int64>& dependencies);
+
+    /// <summary>
+    /// Registers the continuation callback to be invoked after all jobs of the dispatch with a given label are done. Continuation is called on a thread that finished the last job (or immediately on the calling thread if dispatch has been already completed).
+    /// </summary>
+    /// <param name="label">The dispatch label.</param>
+    /// <param name="continuation">The callback to invoke.</param>
+    static void AddContinuation(int64 label, const Function<void()>& continuation);
+
     /// <summary>
     /// Waits for all dispatched jobs to finish.
     /// </summary>
@@ -0,0 +1,328 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#pragma once
+
+#include "JobSystem.h"
+#include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Types/Span.h"
+#include "Engine/Core/Collections/Array.h"
+#include "Engine/Core/Collections/Sorting.h"
+
+// The minimum amount of items processed by a single job when grain size is not specified (smaller ranges are not worth the scheduling overhead)
+#define PARALLEL_MIN_GRAIN_SIZE 64
+// The minimum amount of items sorted by a single job in Parallel::Sort
+#define PARALLEL_SORT_MIN_CHUNK_SIZE 2048
+// The maximum amount of ranges used by Parallel::Reduce and Parallel::Scan (partial results are stored on the stack)
+#define PARALLEL_MAX_RANGES 256
+
+/// <summary>
+/// Parallel algorithms (for, sort, reduce and prefix scan) executed on top of the Job System. The calling thread participates in the jobs execution and the functions return after all work is done. Small inputs are processed synchronously.
+/// </summary>
+class Parallel
+{
+public:
+    /// <summary>
+    /// Calculates the default grain size for the given amount of items (to spread the work over the job system threads with a few ranges per thread for load balancing).
+    /// </summary>
+    /// <param name="count">The amount of items to process.</param>
+    /// <returns>The amount of items to process by a single job.</returns>
+    static int32 GetGrainSize(int32 count)
+    {
+        const int32 ranges = Math::Max(JobSystem::GetThreadsCount(), 1) * 4;
+        return Math::Max(Math::DivideAndRoundUp(count, ranges), PARALLEL_MIN_GRAIN_SIZE);
+    }
+
+    /// <summary>
+    /// Executes the function over the range of items split into the batches. Function is invoked with the batch range as (int32 start, int32 end) where end is exclusive.
+    /// </summary>
+    /// <param name="count">The amount of items to process.</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <param name="func">The function to invoke for each batch: void(int32 start, int32 end).</param>
+    template<typename Func>
+    static void For(int32 count, int32 grainSize, const Func& func)
+    {
+        if (count <= 0)
+            return;
+        if (grainSize <= 0)
+            grainSize = GetGrainSize(count);
+        const int32 jobsCount = Math::DivideAndRoundUp(count, grainSize);
+        if (jobsCount <= 1)
+        {
+            func(0, count);
+            return;
+        }
+        JobSystem::Execute([&](int32 job)
+        {
+            const int32 start = job * grainSize;
+            func(start, Math::Min(start + grainSize, count));
+        }, jobsCount);
+    }
+
+    /// <summary>
+    /// Executes the function over the range of items split into the batches (grain size is picked automatically). Function is invoked with the batch range as (int32 start, int32 end) where end is exclusive.
+    /// </summary>
+    /// <param name="count">The amount of items to process.</param>
+    /// <param name="func">The function to invoke for each batch: void(int32 start, int32 end).</param>
+    template<typename Func>
+    FORCE_INLINE static void For(int32 count, const Func& func)
+    {
+        For(count, 0, func);
+    }
+
+    /// <summary>
+    /// Executes the function for each item of the collection.
+    /// </summary>
+    /// <param name="data">The items to process.</param>
+    /// <param name="func">The function to invoke for each item: void(T& item).</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    template<typename T, typename Func>
+    static void ForEach(Span<T> data, const Func& func, int32 grainSize = 0)
+    {
+        T* items = data.Get();
+        For(data.Length(), grainSize, [&](int32 start, int32 end)
+        {
+            for (int32 i = start; i < end; i++)
+                func(items[i]);
+        });
+    }
+
+    /// <summary>
+    /// Executes the function for each item of the collection.
+    /// </summary>
+    /// <param name="data">The items to process.</param>
+    /// <param name="func">The function to invoke for each item: void(T& item).</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    template<typename T, typename AllocationType, typename Func>
+    FORCE_INLINE static void ForEach(Array<T, AllocationType>& data, const Func& func, int32 grainSize = 0)
+    {
+        ForEach(Span<T>(data.Get(), data.Count()), func, grainSize);
+    }
+
+public:
+    /// <summary>
+    /// Reduces the collection into a single value using the given associative operation (eg. sum, min, max or bounds merge). Ranges are reduced in parallel and then partial results are combined in order.
+    /// </summary>
+    /// <param name="data">The items to reduce.</param>
+    /// <param name="identity">The identity value of the operation (eg. 0 for sum).</param>
+    /// <param name="op">The reduction operation: T(const T& a, const T& b).</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <returns>The reduced value.</returns>
+    template<typename T, typename Op>
+    static T Reduce(Span<T> data, const T& identity, const Op& op, int32 grainSize = 0)
+    {
+        const int32 count = data.Length();
+        const T* items = data.Get();
+        const int32 rangeSize = GetRangeSize(count, grainSize);
+        const int32 rangesCount = Math::DivideAndRoundUp(count, rangeSize);
+        if (rangesCount <= 1)
+            return ReduceRange(items, 0, count, identity, op);
+        Array<T, InlinedAllocation<64>> partials;
+        partials.Resize(rangesCount);
+        For(count, rangeSize, [&](int32 start, int32 end)
+        {
+            partials[start / rangeSize] = ReduceRange(items, start, end, identity, op);
+        });
+        T result = identity;
+        for (int32 i = 0; i < rangesCount; i++)
+            result = op(result, partials[i]);
+        return result;
+    }
+
+    /// <summary>
+    /// Reduces the collection into a single value using the given associative operation (eg. sum, min, max or bounds merge).
+    /// </summary>
+    /// <param name="data">The items to reduce.</param>
+    /// <param name="identity">The identity value of the operation (eg. 0 for sum).</param>
+    /// <param name="op">The reduction operation: T(const T& a, const T& b).</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <returns>The reduced value.</returns>
+    template<typename T, typename AllocationType, typename Op>
+    FORCE_INLINE static T Reduce(const Array<T, AllocationType>& data, const T& identity, const Op& op, int32 grainSize = 0)
+    {
+        return Reduce(Span<T>(data.Get(), data.Count()), identity, op, grainSize);
+    }
+
+    /// <summary>
+    /// Computes the prefix scan (eg. prefix sum for the compaction offsets) of the collection using the given associative operation. Runs in two parallel passes: ranges reduction and ranges scan with the offsets. Input and output can be the same memory.
+    /// </summary>
+    /// <param name="input">The input items.</param>
+    /// <param name="output">The output items (the same length as input).</param>
+    /// <param name="identity">The identity value of the operation (eg. 0 for sum).</param>
+    /// <param name="op">The scan operation: T(const T& a, const T& b).</param>
+    /// <param name="inclusive">True if output[i] includes the input[i], otherwise output[i] contains the result of all the previous items (exclusive scan, output[0] is identity).</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <returns>The result of all the items (eg. total sum).</returns>
+    template<typename T, typename Op>
+    static T Scan(Span<T> input, Span<T> output, const T& identity, const Op& op, bool inclusive = false, int32 grainSize = 0)
+    {
+        ASSERT(input.Length() == output.Length());
+        const int32 count = input.Length();
+        const T* src = input.Get();
+        T* dst = output.Get();
+        const int32 rangeSize = GetRangeSize(count, grainSize);
+        const int32 rangesCount = Math::DivideAndRoundUp(count, rangeSize);
+        if (rangesCount <= 1)
+            return ScanRange(src, dst, 0, count, identity, op, inclusive);
+
+        // Reduce ranges and compute the offset of each range
+        Array<T, InlinedAllocation<64>> offsets;
+        offsets.Resize(rangesCount);
+        For(count, rangeSize, [&](int32 start, int32 end)
+        {
+            offsets[start / rangeSize] = ReduceRange(src, start, end, identity, op);
+        });
+        T total = identity;
+        for (int32 i = 0; i < rangesCount; i++)
+        {
+            const T value = offsets[i];
+            offsets[i] = total;
+            total = op(total, value);
+        }
+
+        // Scan ranges
+        For(count, rangeSize, [&](int32 start, int32 end)
+        {
+            ScanRange(src, dst, start, end, offsets[start / rangeSize], op, inclusive);
+        });
+        return total;
+    }
+
+    /// <summary>
+    /// Computes the exclusive prefix sum of the collection (in-place). Useful to convert per-item counts into the offsets.
+    /// </summary>
+    /// <param name="data">The items.</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <returns>The total sum of all the items.</returns>
+    template<typename T>
+    FORCE_INLINE static T PrefixSum(Span<T> data, int32 grainSize = 0)
+    {
+        return Scan(data, data, T(0), [](const T& a, const T& b) { return a + b; }, false, grainSize);
+    }
+
+    /// <summary>
+    /// Computes the exclusive prefix sum of the collection (in-place). Useful to convert per-item counts into the offsets.
+    /// </summary>
+    /// <param name="data">The items.</param>
+    /// <param name="grainSize">The amount of items processed by a single job. Use 0 to pick it automatically.</param>
+    /// <returns>The total sum of all the items.</returns>
+    template<typename T, typename AllocationType>
+    FORCE_INLINE static T PrefixSum(Array<T, AllocationType>& data, int32 grainSize = 0)
+    {
+        return PrefixSum(Span<T>(data.Get(), data.Count()), grainSize);
+    }
+
+public:
+    /// <summary>
+    /// Sorts the linear data array (using operator less). Chunks are sorted in parallel using Quick Sort and then merged in parallel passes (uses temporary memory of the same size as input). Sorting is not stable.
+    /// </summary>
+    /// <remarks>For the integer keys with values use Sorting::RadixSort which is already parallelized for large arrays.</remarks>
+    /// <param name="data">The data pointer.</param>
+    /// <param name="count">The elements count.</param>
+    template<typename T>
+    static void Sort(T* data, int32 count)
+    {
+        const int32 chunkSize = Math::Max(Math::DivideAndRoundUp(count, Math::Max(JobSystem::GetThreadsCount(), 1)), PARALLEL_SORT_MIN_CHUNK_SIZE);
+        if (count <= chunkSize)
+        {
+            Sorting::QuickSort(data, count);
+            return;
+        }
+
+        // Sort chunks
+        For(count, chunkSize, [&](int32 start, int32 end)
+        {
+            Sorting::QuickSort(data + start, end - start);
+        });
+
+        // Merge sorted chunks (the amount of sorted runs is halved in each pass)
+        Array<T> tmp;
+        tmp.Resize(count);
+        T* src = data;
+        T* dst = tmp.Get();
+        for (int32 width = chunkSize; width < count; width *= 2)
+        {
+            const int32 mergeSize = width * 2;
+            JobSystem::Execute([&](int32 i)
+            {
+                const int32 start = i * mergeSize;
+                const int32 mid = Math::Min(start + width, count);
+                const int32 end = Math::Min(start + mergeSize, count);
+                MergeRuns(src, dst, start, mid, end);
+            }, Math::DivideAndRoundUp(count, mergeSize));
+            Swap(src, dst);
+        }
+        if (src != data)
+        {
+            For(count, chunkSize, [&](int32 start, int32 end)
+            {
+                for (int32 i = start; i < end; i++)
+                    data[i] = MoveTemp(src[i]);
+            });
+        }
+    }
+
+    /// <summary>
+    /// Sorts the linear data array (using operator less). Chunks are sorted in parallel and then merged in parallel passes. Sorting is not stable.
+    /// </summary>
+    /// <param name="data">The data container.</param>
+    template<typename T, typename AllocationType>
+    FORCE_INLINE static void Sort(Array<T, AllocationType>& data)
+    {
+        Sort(data.Get(), data.Count());
+    }
+
+private:
+    static int32 GetRangeSize(int32 count, int32 grainSize)
+    {
+        if (grainSize <= 0)
+            grainSize = GetGrainSize(count);
+        return Math::Max(grainSize, Math::DivideAndRoundUp(count, PARALLEL_MAX_RANGES));
+    }
+
+    template<typename T, typename Op>
+    static T ReduceRange(const T* items, int32 start, int32 end, const T& identity, const Op& op)
+    {
+        T result = identity;
+        for (int32 i = start; i < end; i++)
+            result = op(result, items[i]);
+        return result;
+    }
+
+    template<typename T, typename Op>
+    static T ScanRange(const T* src, T* dst, int32 start, int32 end, const T& offset, const Op& op, bool inclusive)
+    {
+        T sum = offset;
+        for (int32 i = start; i < end; i++)
+        {
+            const T value = src[i];
+            if (inclusive)
+            {
+                sum = op(sum, value);
+                dst[i] = sum;
+            }
+            else
+            {
+                dst[i] = sum;
+                sum = op(sum, value);
+            }
+        }
+        return sum;
+    }
+
+    template<typename T>
+    static void MergeRuns(T* src, T* dst, int32 start, int32 mid, int32 end)
+    {
+        int32 a = start, b = mid, i = start;
+        while (a < mid && b < end)
+        {
+            if (src[b] < src[a])
+                dst[i++] = MoveTemp(src[b++]);
+            else
+                dst[i++] = MoveTemp(src[a++]);
+        }
+        while (a < mid)
+            dst[i++] = MoveTemp(src[a++]);
+        while (b < end)
+            dst[i++] = MoveTemp(src[b++]);
+    }
+};
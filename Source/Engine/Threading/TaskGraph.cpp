@@ -2,11 +2,15 @@
 
 #include "TaskGraph.h"
 #include "JobSystem.h"
+#include "Threading.h"
 #include "Engine/Core/Collections/Sorting.h"
 #include "Engine/Profiler/ProfilerCPU.h"
 
 namespace
 {
+    // The system which Execute is currently called on this thread (used by DispatchJob)
+    THREADLOCAL TaskGraphSystem* CurrentSystem = nullptr;
+
     bool SortTaskGraphSystem(TaskGraphSystem* const& a, TaskGraphSystem* const& b)
     {
         return b->Order > a->Order;
@@ -85,10 +89,19 @@ void TaskGraph::Execute()
     _queue.Clear();
     _remaining.Clear();
     _remaining.Add(_systems);
+    _labels.Clear();
+    for (auto system : _systems)
+    {
+        system->_labels.Clear();
+        system->_executeLabel = 0;
+    }
 
+    // Schedule all systems in a single pass (system that depends on the jobs of other systems is executed within a job dispatched with dependencies on them, so the calling thread never waits in between)
+    JobSystem::SetJobStartingOnDispatch(false);
+    Array<int64, InlinedAllocation<64>> labels;
     while (_remaining.HasItems())
     {
-        // Find systems without dependencies or with already executed dependencies
+        // Find systems without dependencies or with already scheduled dependencies
         for (int32 i = _remaining.Count() - 1; i >= 0; i--)
         {
             auto e = _remaining[i];
@@ -114,19 +127,32 @@ void TaskGraph::Execute()
 
         // Execute in order
         Sorting::QuickSort(_queue.Get(), _queue.Count(), &SortTaskGraphSystem);
-        JobSystem::SetJobStartingOnDispatch(false);
-        _labels.Clear();
         for (int32 i = 0; i < _queue.Count(); i++)
         {
-            _currentSystem = _queue[i];
-            _currentSystem->Execute(this);
+            TaskGraphSystem* system = _queue[i];
+            labels.Clear();
+            const bool anyDeferred = GetDependencyLabels(system, labels);
+            if (labels.IsEmpty())
+                ExecuteSystem(system);
+            else
+                DispatchSystem(system, labels, !anyDeferred);
         }
-        _currentSystem = nullptr;
         _queue.Clear();
+    }
 
-        // Wait for async jobs to finish
-        JobSystem::SetJobStartingOnDispatch(true);
-        for (const int64 label : _labels)
+    // Wait for async jobs to finish (deferred systems add their jobs before their own job ends, so wait until no new labels appear)
+    JobSystem::SetJobStartingOnDispatch(true);
+    int32 waited = 0;
+    while (true)
+    {
+        _locker.Lock();
+        labels.Clear();
+        labels.Add(_labels.Get() + waited, _labels.Count() - waited);
+        waited = _labels.Count();
+        _locker.Unlock();
+        if (labels.IsEmpty())
+            break;
+        for (const int64 label : labels)
             JobSystem::Wait(label);
     }
 
@@ -134,9 +160,84 @@ void TaskGraph::Execute()
         system->PostExecute(this);
 }
 
-void TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
+int64 TaskGraph::DispatchJob(const Function<void(int32)>& job, int32 jobCount)
 {
-    ASSERT(_currentSystem);
-    const int64 label = JobSystem::Dispatch(job, jobCount);
+    TaskGraphSystem* system = CurrentSystem;
+    ASSERT(system);
+    ScopeLock lock(_locker);
+
+    // Gather jobs of the systems that the current one depends on
+    Array<int64, InlinedAllocation<64>> dependencies;
+    for (const TaskGraphSystem* dependency : system->_dependencies)
+        dependencies.Add(dependency->_labels);
+
+    const int64 label = JobSystem::Dispatch(job, jobCount, Span<int64>(dependencies.Get(), dependencies.Count()));
+    system->_labels.Add(label);
     _labels.Add(label);
+    return label;
+}
+
+bool TaskGraph::GetDependencyLabels(const TaskGraphSystem* system, Array<int64, InlinedAllocation<64>>& labels)
+{
+    // Deferred dependencies that haven't been executed yet give their Execute job label (their jobs are not known yet)
+    ScopeLock lock(_locker);
+    bool anyDeferred = false;
+    for (const TaskGraphSystem* dependency : system->_dependencies)
+    {
+        if (dependency->_executeLabel != 0)
+        {
+            labels.Add(dependency->_executeLabel);
+            anyDeferred = true;
+        }
+        else
+        {
+            labels.Add(dependency->_labels);
+        }
+    }
+    return anyDeferred;
+}
+
+void TaskGraph::DispatchSystem(TaskGraphSystem* system, const Array<int64, InlinedAllocation<64>>& labels, bool jobsDependencies)
+{
+    ScopeLock lock(_locker);
+    const Function<void(int32)> job = [this, system, jobsDependencies](int32)
+    {
+        RunSystem(system, jobsDependencies);
+    };
+    const int64 label = JobSystem::Dispatch(job, 1, Span<int64>(labels.Get(), labels.Count()));
+    system->_executeLabel = label;
+    _labels.Add(label);
+}
+
+void TaskGraph::RunSystem(TaskGraphSystem* system, bool jobsDependencies)
+{
+    if (!jobsDependencies)
+    {
+        // Deferred dependencies have been executed now so dispatch again after their jobs (or after the ones that are still not executed)
+        Array<int64, InlinedAllocation<64>> labels;
+        const bool anyDeferred = GetDependencyLabels(system, labels);
+        if (labels.HasItems())
+        {
+            DispatchSystem(system, labels, !anyDeferred);
+            return;
+        }
+    }
+    ExecuteSystem(system);
+}
+
+void TaskGraph::ExecuteSystem(TaskGraphSystem* system)
+{
+    TaskGraphSystem* prevSystem = CurrentSystem;
+    CurrentSystem = system;
+    system->Execute(this);
+    CurrentSystem = prevSystem;
+
+    ScopeLock lock(_locker);
+    if (system->_labels.IsEmpty())
+    {
+        // Pass-through dependencies of the system that didn't dispatch any jobs
+        for (const TaskGraphSystem* dependency : system->_dependencies)
+            system->_labels.Add(dependency->_labels);
+    }
+    system->_executeLabel = 0;
 }
@@ -4,6 +4,7 @@
 
 #include "Engine/Scripting/ScriptingObject.h"
 #include "Engine/Core/Collections/Array.h"
+#include "Engine/Platform/CriticalSection.h"
 
 class TaskGraph;
 
@@ -17,6 +18,9 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
 private:
     Array<TaskGraphSystem*, InlinedAllocation<16>> _dependencies;
     Array<TaskGraphSystem*, InlinedAllocation<16>> _reverseDependencies;
+    Array<int64, InlinedAllocation<4>> _labels;
+    // The label of the job that runs Execute of this system (0 if it's not deferred or has been already executed)
+    int64 _executeLabel = 0;
 
 public:
     /// <summary>
@@ -48,6 +52,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraphSystem);
     /// <summary>
     /// Executes the system logic and schedules the asynchronous work.
     /// </summary>
+    /// <remarks>Called after all jobs dispatched by the dependency systems are done, so their results can be used here. If any dependency dispatched jobs then this method is called from the job system thread (as soon as they are done, without blocking the graph scheduling).</remarks>
     /// <param name="graph">The graph executing the system.</param>
     API_FUNCTION() virtual void Execute(TaskGraph* graph);
 
@@ -69,7 +74,7 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     Array<TaskGraphSystem*, InlinedAllocation<64>> _remaining;
     Array<TaskGraphSystem*, InlinedAllocation<64>> _queue;
     Array<int64, InlinedAllocation<64>> _labels;
-    TaskGraphSystem* _currentSystem = nullptr;
+    CriticalSection _locker;
 
 public:
     /// <summary>
@@ -95,10 +100,17 @@ DECLARE_SCRIPTING_TYPE(TaskGraph);
     API_FUNCTION() void Execute();
 
     /// <summary>
-    /// Dispatches the job for the execution.
+    /// Dispatches the job for the execution. Job starts after all jobs dispatched by the dependencies of the current system are done.
     /// </summary>
     /// <remarks>Call only from system's Execute method to properly schedule job.</remarks>
     /// <param name="job">The job. Argument is an index of the job execution.</param>
     /// <param name="jobCount">The job executions count.</param>
-    API_FUNCTION() void DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1);
+    /// <returns>The label of the dispatched jobs (can be used as a dependency of other jobs or to wait for them).</returns>
+    API_FUNCTION() int64 DispatchJob(const Function<void(int32)>& job, int32 jobCount = 1);
+
+private:
+    bool GetDependencyLabels(const TaskGraphSystem* system, Array<int64, InlinedAllocation<64>>& labels);
+    void DispatchSystem(TaskGraphSystem* system, const Array<int64, InlinedAllocation<64>>& labels, bool jobsDependencies);
+    void RunSystem(TaskGraphSystem* system, bool jobsDependencies);
+    void ExecuteSystem(TaskGraphSystem* system);
 };
@@ -4,6 +4,7 @@
 #include "IRunnable.h"
 #include "Threading.h"
 #include "ThreadPoolTask.h"
+#include "ThreadRegistry.h"
 #include "ConcurrentTaskQueue.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
@@ -111,6 +112,8 @@ int32 ThreadPool::ThreadProc()
     // Work until end
     while (Platform::AtomicRead(&ThreadPoolImpl::ExitFlag) == 0)
     {
+        ThreadRegistry::UpdateThreadPlacement(ThreadRegistry::ThreadType::Background, ThreadPriority::Normal);
+
         // Try to get a job
         if (ThreadPoolImpl::Jobs.try_dequeue(task))
         {
@@ -2,16 +2,98 @@
 
 #include "ThreadRegistry.h"
 #include "Engine/Core/Collections/Dictionary.h"
+#include "Engine/Core/Math/Math.h"
 #include "Engine/Platform/CriticalSection.h"
+#include "Engine/Platform/CPUInfo.h"
+#include "Engine/Threading/Threading.h"
+#if PLATFORM_WINDOWS || USE_EDITOR
+#include "Engine/Platform/Windows/WindowsPlatformSettings.h"
+#endif
+#if PLATFORM_LINUX || USE_EDITOR
+#include "Engine/Platform/Linux/LinuxPlatformSettings.h"
+#endif
 
 namespace ThreadRegistryImpl
 {
     Dictionary<uint64, Thread*> Registry(64);
     CriticalSection Locker;
+    ThreadPlacement Placements[(int32)ThreadRegistry::ThreadType::MAX] = { ThreadPlacement::Performance, ThreadPlacement::Performance, ThreadPlacement::Efficiency };
+    int64 PlacementVersion = 1;
+    THREADLOCAL int64 ThreadPlacementVersion = 0;
+
+    void ApplyPlacement(ThreadPlacement mainThread, ThreadPlacement workers, ThreadPlacement background)
+    {
+        ThreadRegistry::SetPlacement(ThreadRegistry::ThreadType::Main, mainThread);
+        ThreadRegistry::SetPlacement(ThreadRegistry::ThreadType::Worker, workers);
+        ThreadRegistry::SetPlacement(ThreadRegistry::ThreadType::Background, background);
+        if (IsInMainThread())
+            ThreadRegistry::UpdateThreadPlacement(ThreadRegistry::ThreadType::Main, ThreadPriority::Normal);
+    }
 }
 
 using namespace ThreadRegistryImpl;
 
+ThreadPlacement ThreadRegistry::GetPlacement(ThreadType type)
+{
+    return Placements[(int32)type];
+}
+
+void ThreadRegistry::SetPlacement(ThreadType type, ThreadPlacement placement)
+{
+    if (Placements[(int32)type] == placement)
+        return;
+    Placements[(int32)type] = placement;
+    Platform::InterlockedIncrement(&PlacementVersion);
+}
+
+uint64 ThreadRegistry::GetAffinityMask(ThreadPlacement placement)
+{
+    const CPUInfo cpuInfo = Platform::GetCPUInfo();
+    uint64 mask = 0;
+    if (placement == ThreadPlacement::Performance)
+        mask = cpuInfo.PerformanceCoresMask;
+    else if (placement == ThreadPlacement::Efficiency)
+        mask = cpuInfo.EfficiencyCoresMask;
+    if (mask == 0)
+        mask = cpuInfo.LogicalProcessorCount >= 64 ? MAX_uint64 : (1ull << cpuInfo.LogicalProcessorCount) - 1;
+    return mask;
+}
+
+void ThreadRegistry::UpdateThreadPlacement(ThreadType type, ThreadPriority priority, int32 processorIndex)
+{
+    const int64 version = Platform::AtomicRead(&PlacementVersion);
+    if (ThreadPlacementVersion == version)
+        return;
+    ThreadPlacementVersion = version;
+    const ThreadPlacement placement = Placements[(int32)type];
+    uint64 mask = GetAffinityMask(placement);
+
+    // Pin to a single processor from the mask
+    if (processorIndex != -1)
+    {
+        int32 processorsCount = 0;
+        for (int32 i = 0; i < 64; i++)
+        {
+            if (mask & (1ull << i))
+                processorsCount++;
+        }
+        processorIndex %= Math::Max(processorsCount, 1);
+        for (int32 i = 0; i < 64; i++)
+        {
+            if (mask & (1ull << i) && processorIndex-- == 0)
+            {
+                mask = 1ull << i;
+                break;
+            }
+        }
+    }
+
+    Platform::SetThreadAffinityMask(mask);
+    if (placement == ThreadPlacement::Efficiency && Platform::GetCPUInfo().EfficiencyCoresMask != 0)
+        priority = ThreadPriority::BelowNormal;
+    Platform::SetThreadPriority(priority);
+}
+
 Thread* ThreadRegistry::GetThread(uint64 id)
 {
     Thread* result = nullptr;
@@ -64,3 +146,21 @@ void ThreadRegistry::Remove(Thread* thread)
     Registry.Remove(thread->GetID());
     Locker.Unlock();
 }
+
+#if PLATFORM_WINDOWS || USE_EDITOR
+
+void WindowsPlatformSettings::Apply()
+{
+    ApplyPlacement(MainThreadPlacement, WorkersPlacement, BackgroundPlacement);
+}
+
+#endif
+
+#if PLATFORM_LINUX || USE_EDITOR
+
+void LinuxPlatformSettings::Apply()
+{
+    ApplyPlacement(MainThreadPlacement, WorkersPlacement, BackgroundPlacement);
+}
+
+#endif
@@ -5,11 +5,77 @@
 #include "Engine/Core/Types/BaseTypes.h"
 #include "Engine/Platform/Thread.h"
 
+/// <summary>
+/// The policy of the thread placement on the CPU cores (used on hybrid CPUs with performance and efficiency cores).
+/// </summary>
+API_ENUM() enum class ThreadPlacement
+{
+    /// <summary>
+    /// The thread can run on any CPU core.
+    /// </summary>
+    Any = 0,
+
+    /// <summary>
+    /// The thread runs on the performance cores. Use for latency-critical work such as the main thread and rendering jobs.
+    /// </summary>
+    Performance = 1,
+
+    /// <summary>
+    /// The thread runs on the efficiency cores at lower priority. Use for background work such as content loading and shaders compilation.
+    /// </summary>
+    Efficiency = 2,
+};
+
 /// <summary>
 /// Holds all created threads (except the main thread)
 /// </summary>
 class FLAXENGINE_API ThreadRegistry
 {
+public:
+    /// <summary>
+    /// The types of the engine threads with a separate placement policy.
+    /// </summary>
+    enum class ThreadType
+    {
+        // The main thread.
+        Main,
+        // The Job System workers (used by the rendering and other latency-critical work).
+        Worker,
+        // The Thread Pool workers and content loading threads (background work).
+        Background,
+
+        MAX
+    };
+
+    /// <summary>
+    /// Gets the placement policy of the threads of the given type.
+    /// </summary>
+    /// <param name="type">The threads type.</param>
+    /// <returns>The placement policy.</returns>
+    static ThreadPlacement GetPlacement(ThreadType type);
+
+    /// <summary>
+    /// Sets the placement policy of the threads of the given type. Threads apply it on their next update (see UpdateThreadPlacement).
+    /// </summary>
+    /// <param name="type">The threads type.</param>
+    /// <param name="placement">The placement policy.</param>
+    static void SetPlacement(ThreadType type, ThreadPlacement placement);
+
+    /// <summary>
+    /// Gets the mask of the logical processors to use for the given placement policy. Returns all logical processors if CPU has no cores of the requested type.
+    /// </summary>
+    /// <param name="placement">The placement policy.</param>
+    /// <returns>The logical processors mask.</returns>
+    static uint64 GetAffinityMask(ThreadPlacement placement);
+
+    /// <summary>
+    /// Updates the current thread affinity and priority to match the placement policy of its type. Does nothing if the placement didn't change since the last call on this thread so it can be called from the thread work loop.
+    /// </summary>
+    /// <param name="type">The current thread type.</param>
+    /// <param name="priority">The current thread priority (lowered on efficiency cores).</param>
+    /// <param name="processorIndex">The index of the logical processor (within the placement mask) to pin the thread to, or -1 to use all processors from the placement mask.</param>
+    static void UpdateThreadPlacement(ThreadType type, ThreadPriority priority, int32 processorIndex = -1);
+
 public:
 
     /// <summary>
@@ -10,10 +10,9 @@
 #include "Engine/Scripting/Enums.h"
 #endif
 
-#define CONVERT_TO_MONO_AVG 1
-#if !CONVERT_TO_MONO_AVG
 #include "Engine/Core/Math/Math.h"
-#endif
+
+#define CONVERT_TO_MONO_AVG 1
 
 #if USE_EDITOR
 
@@ -313,4 +312,136 @@ void AudioTool::ConvertFromFloat(const float* input, int32* output, uint32 numSa
     }
 }
 
+namespace
+{
+    // IMA ADPCM step sizes
+    const int16 ADPCMStepTable[89] =
+    {
+        7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+        50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+        253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+        1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+        3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487,
+        12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+    };
+
+    // IMA ADPCM step index changes
+    const int8 ADPCMIndexTable[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+    struct ADPCMState
+    {
+        int32 Predictor;
+        int32 Index;
+
+        FORCE_INLINE int16 Decode(byte code)
+        {
+            const int32 step = ADPCMStepTable[Index];
+            int32 diff = step >> 3;
+            if (code & 4)
+                diff += step;
+            if (code & 2)
+                diff += step >> 1;
+            if (code & 1)
+                diff += step >> 2;
+            if (code & 8)
+                diff = -diff;
+            Predictor = Math::Clamp(Predictor + diff, (int32)MIN_int16, (int32)MAX_int16);
+            Index = Math::Clamp(Index + ADPCMIndexTable[code & 7], 0, 88);
+            return (int16)Predictor;
+        }
+
+        FORCE_INLINE byte Encode(int16 sample)
+        {
+            // Quantize the difference and use decoder to track the state (prevents drift)
+            const int32 step = ADPCMStepTable[Index];
+            int32 diff = sample - Predictor;
+            byte code = 0;
+            if (diff < 0)
+            {
+                code = 8;
+                diff = -diff;
+            }
+            if (diff >= step)
+            {
+                code |= 4;
+                diff -= step;
+            }
+            if (diff >= step >> 1)
+            {
+                code |= 2;
+                diff -= step >> 1;
+            }
+            if (diff >= step >> 2)
+                code |= 1;
+            Decode(code);
+            return code;
+        }
+    };
+}
+
+void AudioTool::ConvertToADPCM(const int16* input, byte* output, uint32 numFrames, uint32 numChannels)
+{
+    const uint32 channelBlockSize = GetADPCMBlockSize(1);
+    ADPCMState state[8] = {};
+    ASSERT(numChannels <= ARRAY_COUNT(state));
+    for (uint32 blockStart = 0; blockStart < numFrames; blockStart += ADPCMBlockFrames)
+    {
+        const uint32 blockFrames = Math::Min(ADPCMBlockFrames, numFrames - blockStart);
+        for (uint32 c = 0; c < numChannels; c++)
+        {
+            // Header with the first sample (stored as is) and the step index
+            byte* dst = output + c * channelBlockSize;
+            const int16* src = input + blockStart * numChannels + c;
+            ADPCMState& s = state[c];
+            s.Predictor = src[0];
+            Platform::MemoryCopy(dst, &src[0], sizeof(int16));
+            dst[2] = (byte)s.Index;
+            dst[3] = 0;
+            dst += 4;
+
+            // Samples (two per byte, low nibble first)
+            Platform::MemoryClear(dst, ADPCMBlockFrames / 2);
+            for (uint32 i = 1; i < blockFrames; i++)
+            {
+                const byte code = s.Encode(src[i * numChannels]);
+                dst[(i - 1) >> 1] |= (i - 1) & 1 ? (byte)(code << 4) : code;
+            }
+        }
+        output += GetADPCMBlockSize(numChannels);
+    }
+}
+
+void AudioTool::ConvertFromADPCM(const byte* input, int16* output, uint32 numFrames, uint32 numChannels)
+{
+    for (uint32 blockStart = 0; blockStart < numFrames; blockStart += ADPCMBlockFrames)
+    {
+        const uint32 blockFrames = Math::Min(ADPCMBlockFrames, numFrames - blockStart);
+        DecodeADPCMBlock(input, output + blockStart * numChannels, blockFrames, numChannels);
+        input += GetADPCMBlockSize(numChannels);
+    }
+}
+
+void AudioTool::DecodeADPCMBlock(const byte* block, int16* output, uint32 numFrames, uint32 numChannels)
+{
+    const uint32 channelBlockSize = GetADPCMBlockSize(1);
+    for (uint32 c = 0; c < numChannels; c++)
+    {
+        const byte* src = block + c * channelBlockSize;
+        int16* dst = output + c;
+        ADPCMState s;
+        int16 first;
+        Platform::MemoryCopy(&first, src, sizeof(int16));
+        s.Predictor = first;
+        s.Index = Math::Min<int32>(src[2], 88);
+        src += 4;
+        if (numFrames != 0)
+            dst[0] = first;
+        for (uint32 i = 1; i < numFrames; i++)
+        {
+            const byte packed = src[(i - 1) >> 1];
+            dst[i * numChannels] = s.Decode((i - 1) & 1 ? packed >> 4 : packed & 0xf);
+        }
+    }
+}
+
 #endif
@@ -119,6 +119,60 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API AudioTool
     /// <param name="numSamples">The total number of samples to process.</param>
     static void ConvertFromFloat(const float* input, int32* output, uint32 numSamples);
 
+public:
+    /// <summary>
+    /// The amount of the audio frames (samples per channel) stored in a single IMA ADPCM block. Blocks are independent so they can be decoded in any order (eg. during mixing).
+    /// </summary>
+    static constexpr uint32 ADPCMBlockFrames = 256;
+
+    /// <summary>
+    /// Gets the size (in bytes) of a single IMA ADPCM block (for all channels). Each channel has a 4-byte header (the first sample and the step index) followed by 4-bit samples.
+    /// </summary>
+    /// <param name="numChannels">The number of channels.</param>
+    /// <returns>The block size (in bytes).</returns>
+    FORCE_INLINE static uint32 GetADPCMBlockSize(uint32 numChannels)
+    {
+        return numChannels * (4 + ADPCMBlockFrames / 2);
+    }
+
+    /// <summary>
+    /// Gets the size (in bytes) of the IMA ADPCM data.
+    /// </summary>
+    /// <param name="numFrames">The number of samples per a single channel.</param>
+    /// <param name="numChannels">The number of channels.</param>
+    /// <returns>The data size (in bytes).</returns>
+    FORCE_INLINE static uint32 GetADPCMSize(uint32 numFrames, uint32 numChannels)
+    {
+        return (numFrames + ADPCMBlockFrames - 1) / ADPCMBlockFrames * GetADPCMBlockSize(numChannels);
+    }
+
+    /// <summary>
+    /// Compresses a set of 16-bit audio samples into IMA ADPCM format (4 bits per sample).
+    /// </summary>
+    /// <param name="input">A set of input samples. Per-channels samples should be interleaved.</param>
+    /// <param name="output">The pre-allocated buffer to store the compressed data. Should be of GetADPCMSize(numFrames, numChannels) size.</param>
+    /// <param name="numFrames">The number of samples per a single channel.</param>
+    /// <param name="numChannels">The number of channels in the input data.</param>
+    static void ConvertToADPCM(const int16* input, byte* output, uint32 numFrames, uint32 numChannels);
+
+    /// <summary>
+    /// Decompresses the IMA ADPCM data into a set of 16-bit audio samples.
+    /// </summary>
+    /// <param name="input">The compressed data. Should be of GetADPCMSize(numFrames, numChannels) size.</param>
+    /// <param name="output">The pre-allocated buffer to store the samples (interleaved). Should be of (numFrames * numChannels * sizeof(int16)) size.</param>
+    /// <param name="numFrames">The number of samples per a single channel.</param>
+    /// <param name="numChannels">The number of channels.</param>
+    static void ConvertFromADPCM(const byte* input, int16* output, uint32 numFrames, uint32 numChannels);
+
+    /// <summary>
+    /// Decompresses a single IMA ADPCM block into a set of 16-bit audio samples.
+    /// </summary>
+    /// <param name="block">The compressed block data. Should be of GetADPCMBlockSize(numChannels) size.</param>
+    /// <param name="output">The pre-allocated buffer to store the samples (interleaved). Should be of (numFrames * numChannels * sizeof(int16)) size.</param>
+    /// <param name="numFrames">The number of samples per a single channel to decode (up to ADPCMBlockFrames).</param>
+    /// <param name="numChannels">The number of channels.</param>
+    static void DecodeADPCMBlock(const byte* block, int16* output, uint32 numFrames, uint32 numChannels);
+
     /// <summary>
     /// Converts a 24-bit signed integer into a 32-bit signed integer.
     /// </summary>
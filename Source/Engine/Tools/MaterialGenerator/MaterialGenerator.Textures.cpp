@@ -732,6 +732,54 @@ void MaterialGenerator::ProcessGroupTextures(Box* box, Node* node, Value& value)
         value = output;
         break;
     }
+    // Vertex Animation Texture
+    case 19:
+    {
+        auto textureBox = node->GetBox(0);
+        auto positionOffsetBox = node->GetBox(4);
+        auto positionBox = node->GetBox(5);
+        if (!textureBox->HasConnection())
+        {
+            // No texture to sample
+            value = Value::Zero;
+            break;
+        }
+        const auto texture = eatBox(textureBox->GetParent<Node>(), textureBox->FirstConnection());
+        const auto time = tryGetValue(node->GetBox(1), getTime).AsFloat();
+        const auto framesCount = tryGetValue(node->GetBox(2), node->Values[0]).AsFloat();
+        const auto frameRate = tryGetValue(node->GetBox(3), node->Values[1]).AsFloat();
+
+        // Vertex color encodes the index of the vertex in the baked texture (see VertexAnimationBaker)
+        auto position = writeLocal(Value::InitForZero(ValueType::Float3), node);
+        const String vertexAnimation = String::Format(TEXT(
+            "	{{\n"
+            "	uint width, height;\n"
+            "	{0}.GetDimensions(width, height);\n"
+            "	uint framesCount = max((uint){2}, 1);\n"
+            "	uint rowsPerFrame = max(height / framesCount, 1);\n"
+            "	uint vertexIndex = (uint)dot(round(GetVertexColor(input).rgb * 255.0f), float3(1, 256, 65536));\n"
+            "	int2 texel = int2(vertexIndex % width, vertexIndex / width);\n"
+            "	float frame = frac({1} * {3} / framesCount) * framesCount;\n"
+            "	uint frame0 = (uint)frame % framesCount;\n"
+            "	uint frame1 = (frame0 + 1) % framesCount;\n"
+            "	float3 position0 = {0}.Load(int3(texel.x, texel.y + frame0 * rowsPerFrame, 0)).xyz;\n"
+            "	float3 position1 = {0}.Load(int3(texel.x, texel.y + frame1 * rowsPerFrame, 0)).xyz;\n"
+            "	{4} = lerp(position0, position1, frac(frame));\n"
+            "	}}\n"
+        ),
+                                                       texture.Value, // {0}
+                                                       time.Value, // {1}
+                                                       framesCount.Value, // {2}
+                                                       frameRate.Value, // {3}
+                                                       position.Value // {4}
+        );
+        _writer.Write(*vertexAnimation);
+        _treeLayer->UsageFlags |= MaterialUsageFlags::UseVertexColor;
+        positionBox->Cache = position;
+        positionOffsetBox->Cache = writeLocal(VariantType::Float3, String::Format(TEXT("TransformLocalVectorToWorld(input, {0} - input.PreSkinnedPosition)"), position.Value), node);
+        value = box == positionBox ? positionBox->Cache : positionOffsetBox->Cache;
+        break;
+    }
     default:
         break;
     }
@@ -4,288 +4,290 @@
 
 #include "MeshAccelerationStructure.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Core/SIMD.h"
 #include "Engine/Content/Content.h"
 #include "Engine/Content/Assets/Model.h"
 #include "Engine/Graphics/Models/ModelData.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 
-void MeshAccelerationStructure::BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch)
+// The amount of bins used to find the best node split with Surface Area Heuristic (SAH)
+#define BVH_SAH_BINS 12
+
+// The maximum amount of triangles in a sub-tree built by a single job (larger nodes are split before dispatching the jobs)
+#define BVH_JOB_TRIANGLES 8192
+
+namespace
 {
-    auto& root = _bvh[node];
-    ASSERT_LOW_LAYER(root.Leaf.IsLeaf);
-    if (root.Leaf.TriangleCount <= maxLeafSize)
-        return;
+    struct BVHBin
+    {
+        Float3 Min, Max;
+        int32 Count;
+    };
 
-    // Spawn two leaves
-    const int32 childIndex = _bvh.Count();
-    _bvh.AddDefault(2);
-    auto& left = _bvh.Get()[childIndex];
-    auto& right = _bvh.Get()[childIndex + 1];
-    left.Leaf.IsLeaf = 1;
-    right.Leaf.IsLeaf = 1;
-    left.Leaf.MeshIndex = root.Leaf.MeshIndex;
-    right.Leaf.MeshIndex = root.Leaf.MeshIndex;
-
-    // Mid-point splitting based on the largest axis
-    const Float3 boundsSize = root.Bounds.GetSize();
-    int32 axisCount = 0;
-    int32 axis = 0;
-RETRY:
-    if (axisCount == 0)
+    struct RayStackEntry
     {
-        // Pick the highest axis
-        axis = 0;
-        if (boundsSize.Y > boundsSize.X && boundsSize.Y >= boundsSize.Z)
-            axis = 1;
-        else if (boundsSize.Z > boundsSize.X)
-            axis = 2;
+        int32 Node;
+        float Distance;
+    };
+
+    FORCE_INLINE float GetHalfArea(const Float3& min, const Float3& max)
+    {
+        const Float3 size = max - min;
+        return size.X * size.Y + size.Y * size.Z + size.Z * size.X;
     }
-    else if (axisCount == 3)
+
+    template<typename IndexType>
+    FORCE_INLINE Float3 GetCentroid(const IndexType* tri, const Float3* vb)
     {
-        // Failed to split
-        _bvh.Resize(childIndex);
-        return;
+        return (vb[tri[0]] + vb[tri[1]] + vb[tri[2]]) * (1.0f / 3.0f);
     }
-    else
+
+    FORCE_INLINE int32 GetBin(float centroid, float binMin, float binScale)
     {
-        // Go to the next axis
-        axis = (axis + 1) % 3;
+        return Math::Min((int32)((centroid - binMin) * binScale), BVH_SAH_BINS - 1);
     }
-    const float midPoint = (float)(root.Bounds.Minimum.Raw[axis] + boundsSize.Raw[axis] * 0.5f);
-    const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-    const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-    int32 indexStart = root.Leaf.TriangleIndex * 3;
-    int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-    left.Leaf.TriangleCount = 0;
-    right.Leaf.TriangleCount = 0;
-    if (meshData.Use16BitIndexBuffer)
+
+    template<typename IndexType>
+    FORCE_INLINE void MergeBounds(const IndexType* tri, const Float3* vb, Float3& min, Float3& max)
     {
-        struct Tri
-        {
-            uint16 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib16 = meshData.IndexBuffer.Get<uint16>();
-        for (int32 i = indexStart; i < indexEnd;)
-        {
-            const Tri tri = { ib16[i++], ib16[i++], ib16[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
-        }
-        Platform::MemoryCopy(ib16 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint16));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
+        for (int32 i = 0; i < 3; i++)
         {
-            axisCount++;
-            goto RETRY;
+            const Float3& v = vb[tri[i]];
+            min = Float3::Min(min, v);
+            max = Float3::Max(max, v);
         }
-
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint16*)scratch.Get())[i]]);
     }
-    else
+
+    // Splits triangles (sorts them in-place) with the lowest SAH cost and returns the amount of triangles in the left node (0 if failed).
+    template<typename IndexType>
+    int32 SplitSAH(IndexType* ib, const Float3* vb, int32 triangleCount, Float3& leftMin, Float3& leftMax, Float3& rightMin, Float3& rightMax)
     {
-        struct Tri
+        // Calculate bounds of the triangle centroids to place bins within
+        Float3 centroidMin(MAX_float), centroidMax(MIN_float);
+        for (int32 i = 0; i < triangleCount; i++)
         {
-            uint32 I0, I1, I2;
-        };
-        scratch.Resize(root.Leaf.TriangleCount * sizeof(Tri));
-        auto dst = (Tri*)scratch.Get();
-        auto ib32 = meshData.IndexBuffer.Get<uint32>();
-        for (int32 i = indexStart; i < indexEnd;)
+            const Float3 centroid = GetCentroid(ib + i * 3, vb);
+            centroidMin = Float3::Min(centroidMin, centroid);
+            centroidMax = Float3::Max(centroidMax, centroid);
+        }
+        const Float3 centroidSize = centroidMax - centroidMin;
+        Float3 binScale;
+        for (int32 axis = 0; axis < 3; axis++)
+            binScale.Raw[axis] = centroidSize.Raw[axis] > ZeroTolerance ? (float)BVH_SAH_BINS * 0.9999f / centroidSize.Raw[axis] : 0.0f;
+
+        // Bin triangles along all axes
+        BVHBin bins[3][BVH_SAH_BINS];
+        for (int32 axis = 0; axis < 3; axis++)
         {
-            const Tri tri = { ib32[i++], ib32[i++], ib32[i++] };
-            const float v0 = vb[tri.I0].Raw[axis];
-            const float v1 = vb[tri.I1].Raw[axis];
-            const float v2 = vb[tri.I2].Raw[axis];
-            const float centroid = (v0 + v1 + v2) * 0.333f;
-            if (centroid <= midPoint)
-                dst[left.Leaf.TriangleCount++] = tri; // Left
-            else
-                dst[root.Leaf.TriangleCount - ++right.Leaf.TriangleCount] = tri; // Right
+            for (BVHBin& bin : bins[axis])
+            {
+                bin.Min = Float3(MAX_float);
+                bin.Max = Float3(MIN_float);
+                bin.Count = 0;
+            }
         }
-        Platform::MemoryCopy(ib32 + indexStart, dst, root.Leaf.TriangleCount * 3 * sizeof(uint32));
-        if (left.Leaf.TriangleCount == 0 || right.Leaf.TriangleCount == 0)
+        for (int32 i = 0; i < triangleCount; i++)
         {
-            axisCount++;
-            goto RETRY;
+            const IndexType* tri = ib + i * 3;
+            const Float3 centroid = GetCentroid(tri, vb);
+            for (int32 axis = 0; axis < 3; axis++)
+            {
+                if (binScale.Raw[axis] == 0.0f)
+                    continue;
+                BVHBin& bin = bins[axis][GetBin(centroid.Raw[axis], centroidMin.Raw[axis], binScale.Raw[axis])];
+                MergeBounds(tri, vb, bin.Min, bin.Max);
+                bin.Count++;
+            }
         }
 
-        left.Bounds = BoundingBox(vb[dst[0].I0]);
-        indexStart = 0;
-        indexEnd = left.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            left.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
-
-        right.Bounds = BoundingBox(vb[dst[root.Leaf.TriangleCount - 1].I0]);
-        indexStart = left.Leaf.TriangleCount;
-        indexEnd = root.Leaf.TriangleCount * 3;
-        for (int32 i = indexStart; i < indexEnd; i++)
-            right.Bounds.Merge(vb[((uint32*)scratch.Get())[i]]);
-    }
-    ASSERT_LOW_LAYER(left.Leaf.TriangleCount + right.Leaf.TriangleCount == root.Leaf.TriangleCount);
-    left.Leaf.TriangleIndex = root.Leaf.TriangleIndex;
-    right.Leaf.TriangleIndex = left.Leaf.TriangleIndex + left.Leaf.TriangleCount;
-
-    // Convert into a node
-    root.Node.IsLeaf = 0;
-    root.Node.ChildIndex = childIndex;
-    root.Node.ChildrenCount = 2;
-
-    // Split children
-    BuildBVH(childIndex, maxLeafSize, scratch);
-    BuildBVH(childIndex + 1, maxLeafSize, scratch);
-}
-
-bool MeshAccelerationStructure::PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const
-{
-    const auto& root = _bvh[node];
-    bool hit = false;
-    if (root.Leaf.IsLeaf)
-    {
-        // Find closest triangle
-        Vector3 p;
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
+        // Find the split with the lowest cost (sum of children area weighted by the triangles count)
+        float bestCost = MAX_float;
+        int32 bestAxis = -1, bestSplit = -1;
+        for (int32 axis = 0; axis < 3; axis++)
         {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
+            if (binScale.Raw[axis] == 0.0f)
+                continue;
+            const BVHBin* axisBins = bins[axis];
+            float rightCost[BVH_SAH_BINS];
+            Float3 min(MAX_float), max(MIN_float);
+            int32 count = 0;
+            for (int32 i = BVH_SAH_BINS - 1; i > 0; i--)
             {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
+                if (axisBins[i].Count != 0)
                 {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
+                    min = Float3::Min(min, axisBins[i].Min);
+                    max = Float3::Max(max, axisBins[i].Max);
+                    count += axisBins[i].Count;
                 }
+                rightCost[i - 1] = count != 0 ? (float)count * GetHalfArea(min, max) : 0.0f;
             }
-        }
-        else
-        {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            min = Float3(MAX_float);
+            max = Float3(MIN_float);
+            count = 0;
+            for (int32 i = 0; i < BVH_SAH_BINS - 1; i++)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
-                const Real distance = Vector3::Distance(point, p);
-                if (distance < hitDistance)
+                if (axisBins[i].Count != 0)
                 {
-                    hitDistance = distance;
-                    hitPoint = p;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
+                    min = Float3::Min(min, axisBins[i].Min);
+                    max = Float3::Max(max, axisBins[i].Max);
+                    count += axisBins[i].Count;
+                }
+                if (count == 0 || count == triangleCount)
+                    continue;
+                const float cost = (float)count * GetHalfArea(min, max) + rightCost[i];
+                if (cost < bestCost)
+                {
+                    bestCost = cost;
+                    bestAxis = axis;
+                    bestSplit = i;
                 }
             }
         }
-    }
-    else
-    {
-        // Check all nested nodes
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
-        {
-            const int32 index = root.Node.ChildIndex + i;
-            if (_bvh[index].Bounds.Distance(point) >= hitDistance)
-                continue;
-            if (PointQueryBVH(index, point, hitDistance, hitPoint, hitTriangle))
-                hit = true;
-        }
-    }
-    return hit;
-}
+        if (bestAxis == -1)
+            return 0;
 
-bool MeshAccelerationStructure::RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const
-{
-    const auto& root = _bvh[node];
-    if (!root.Bounds.Intersects(ray))
-        return false;
-    Vector3 normal;
-    Real distance;
-    bool hit = false;
-    if (root.Leaf.IsLeaf)
-    {
-        // Ray cast along triangles in the leaf 
-        const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
-        const Float3* vb = meshData.VertexBuffer.Get<Float3>();
-        const int32 indexStart = root.Leaf.TriangleIndex * 3;
-        const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
-        if (meshData.Use16BitIndexBuffer)
+        // Partition triangles in-place
+        const float binMin = centroidMin.Raw[bestAxis];
+        const float splitScale = binScale.Raw[bestAxis];
+        leftMin = rightMin = Float3(MAX_float);
+        leftMax = rightMax = Float3(MIN_float);
+        int32 left = 0, right = triangleCount - 1;
+        while (left <= right)
         {
-            const uint16* ib16 = meshData.IndexBuffer.Get<uint16>();
-            for (int32 i = indexStart; i < indexEnd;)
+            IndexType* tri = ib + left * 3;
+            if (GetBin(GetCentroid(tri, vb).Raw[bestAxis], binMin, splitScale) <= bestSplit)
             {
-                Vector3 v0 = vb[ib16[i++]];
-                Vector3 v1 = vb[ib16[i++]];
-                Vector3 v2 = vb[ib16[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitNormal = normal;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
+                MergeBounds(tri, vb, leftMin, leftMax);
+                left++;
+            }
+            else
+            {
+                IndexType* other = ib + right * 3;
+                for (int32 i = 0; i < 3; i++)
+                    Swap(tri[i], other[i]);
+                MergeBounds(other, vb, rightMin, rightMax);
+                right--;
             }
         }
-        else
+        return left;
+    }
+
+    FORCE_INLINE float GetDistanceSquared(const Float4& boxMin, const Float4& boxMax, const SimdVector4& point)
+    {
+        const SimdVector4 zero = SIMD::Splat(0.0f);
+        const SimdVector4 d = SIMD::Max(SIMD::Max(SIMD::Sub(SIMD::LoadUnaligned(&boxMin), point), SIMD::Sub(point, SIMD::LoadUnaligned(&boxMax))), zero);
+        ALIGN_BEGIN(16) float data[4] ALIGN_END(16);
+        SIMD::Store(data, SIMD::Mul(d, d));
+        return data[0] + data[1] + data[2];
+    }
+
+    FORCE_INLINE bool IntersectsRay(const Float4& boxMin, const Float4& boxMax, const SimdVector4& origin, const SimdVector4& invDirection, float maxDistance, float& distance)
+    {
+        const SimdVector4 t0 = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(&boxMin), origin), invDirection);
+        const SimdVector4 t1 = SIMD::Mul(SIMD::Sub(SIMD::LoadUnaligned(&boxMax), origin), invDirection);
+        ALIGN_BEGIN(16) float tMin[4] ALIGN_END(16);
+        ALIGN_BEGIN(16) float tMax[4] ALIGN_END(16);
+        SIMD::Store(tMin, SIMD::Min(t0, t1));
+        SIMD::Store(tMax, SIMD::Max(t0, t1));
+        distance = Math::Max(Math::Max(tMin[0], tMin[1]), Math::Max(tMin[2], 0.0f));
+        return distance <= Math::Min(Math::Min(tMax[0], tMax[1]), Math::Min(tMax[2], maxDistance));
+    }
+
+    template<typename IndexType>
+    bool PointQueryTriangles(const IndexType* ib, const Float3* vb, int32 indexStart, int32 indexEnd, const Vector3& point, float& hitDistanceSq, Vector3& hitPoint, Triangle& hitTriangle)
+    {
+        Vector3 p;
+        bool hit = false;
+        for (int32 i = indexStart; i < indexEnd;)
         {
-            const uint32* ib32 = meshData.IndexBuffer.Get<uint32>();
-            for (int32 i = indexStart; i < indexEnd;)
+            Vector3 v0 = vb[ib[i++]];
+            Vector3 v1 = vb[ib[i++]];
+            Vector3 v2 = vb[ib[i++]];
+            CollisionsHelper::ClosestPointPointTriangle(point, v0, v1, v2, p);
+            const float distance = (float)Vector3::DistanceSquared(point, p);
+            if (distance < hitDistanceSq)
             {
-                Vector3 v0 = vb[ib32[i++]];
-                Vector3 v1 = vb[ib32[i++]];
-                Vector3 v2 = vb[ib32[i++]];
-                if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
-                {
-                    hitDistance = distance;
-                    hitNormal = normal;
-                    hitTriangle = Triangle(v0, v1, v2);
-                    hit = true;
-                }
+                hitDistanceSq = distance;
+                hitPoint = p;
+                hitTriangle = Triangle(v0, v1, v2);
+                hit = true;
             }
         }
+        return hit;
     }
-    else
+
+    template<typename IndexType>
+    bool RayCastTriangles(const IndexType* ib, const Float3* vb, int32 indexStart, int32 indexEnd, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle)
     {
-        // Ray cast all child nodes
-        Triangle triangle;
-        for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+        Vector3 normal;
+        Real distance;
+        bool hit = false;
+        for (int32 i = indexStart; i < indexEnd;)
         {
-            const int32 index = root.Node.ChildIndex + i;
-            distance = hitDistance;
-            if (RayCastBVH(index, ray, distance, normal, triangle) && distance < hitDistance)
+            Vector3 v0 = vb[ib[i++]];
+            Vector3 v1 = vb[ib[i++]];
+            Vector3 v2 = vb[ib[i++]];
+            if (CollisionsHelper::RayIntersectsTriangle(ray, v0, v1, v2, distance, normal) && distance < hitDistance)
             {
                 hitDistance = distance;
                 hitNormal = normal;
-                hitTriangle = triangle;
+                hitTriangle = Triangle(v0, v1, v2);
                 hit = true;
             }
         }
+        return hit;
     }
-    return hit;
+}
+
+bool MeshAccelerationStructure::SplitBVH(Array<BVH>& bvh, int32 node) const
+{
+    const auto leaf = bvh[node].Leaf;
+    ASSERT_LOW_LAYER(leaf.IsLeaf);
+    const Mesh& meshData = _meshes[leaf.MeshIndex];
+    const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+    Float3 leftMin, leftMax, rightMin, rightMax;
+    int32 leftCount;
+    if (meshData.Use16BitIndexBuffer)
+        leftCount = SplitSAH(meshData.IndexBuffer.Get<uint16>() + leaf.TriangleIndex * 3, vb, leaf.TriangleCount, leftMin, leftMax, rightMin, rightMax);
+    else
+        leftCount = SplitSAH(meshData.IndexBuffer.Get<uint32>() + leaf.TriangleIndex * 3, vb, leaf.TriangleCount, leftMin, leftMax, rightMin, rightMax);
+    if (leftCount == 0)
+        return false; // Failed to split
+
+    // Spawn two leaves
+    const int32 childIndex = bvh.Count();
+    bvh.AddDefault(2);
+    auto& left = bvh.Get()[childIndex];
+    auto& right = bvh.Get()[childIndex + 1];
+    left.Leaf.IsLeaf = 1;
+    left.Leaf.MeshIndex = leaf.MeshIndex;
+    left.Leaf.TriangleIndex = leaf.TriangleIndex;
+    left.Leaf.TriangleCount = leftCount;
+    left.SetBounds(leftMin, leftMax);
+    right.Leaf.IsLeaf = 1;
+    right.Leaf.MeshIndex = leaf.MeshIndex;
+    right.Leaf.TriangleIndex = leaf.TriangleIndex + leftCount;
+    right.Leaf.TriangleCount = leaf.TriangleCount - leftCount;
+    right.SetBounds(rightMin, rightMax);
+
+    // Convert into a node
+    auto& root = bvh.Get()[node];
+    root.Node.IsLeaf = 0;
+    root.Node.ChildIndex = childIndex;
+    root.Node.ChildrenCount = 2;
+    return true;
+}
+
+void MeshAccelerationStructure::BuildBVH(Array<BVH>& bvh, int32 node, int32 maxLeafSize) const
+{
+    if (bvh[node].Leaf.TriangleCount <= (uint32)maxLeafSize || !SplitBVH(bvh, node))
+        return;
+
+    // Split children
+    const int32 childIndex = bvh[node].Node.ChildIndex;
+    BuildBVH(bvh, childIndex, maxLeafSize);
+    BuildBVH(bvh, childIndex + 1, maxLeafSize);
 }
 
 void MeshAccelerationStructure::Add(Model* model, int32 lodIndex)
@@ -382,6 +384,7 @@ void MeshAccelerationStructure::Add(Float3* vb, int32 vertices, void* ib, int32
     meshData.Vertices = vertices;
     meshData.Indices = indices;
     meshData.Use16BitIndexBuffer = use16BitIndex;
+    BoundingBox::FromPoints(vb, vertices, meshData.Bounds);
 }
 
 void MeshAccelerationStructure::BuildBVH(int32 maxLeafSize)
@@ -389,20 +392,21 @@ void MeshAccelerationStructure::BuildBVH(int32 maxLeafSize)
     if (_meshes.Count() == 0)
         return;
     PROFILE_CPU();
+    maxLeafSize = Math::Max(maxLeafSize, 1);
 
     // Estimate memory usage
     int32 trianglesCount = 0;
     for (const Mesh& meshData : _meshes)
         trianglesCount += meshData.Indices / 3;
     _bvh.Clear();
-    _bvh.EnsureCapacity(trianglesCount / maxLeafSize);
+    _bvh.EnsureCapacity(trianglesCount / maxLeafSize * 2 + _meshes.Count() + 1);
 
     // Init with the root node and all meshes as leaves
     auto& root = _bvh.AddOne();
     root.Node.IsLeaf = 0;
     root.Node.ChildIndex = 1;
     root.Node.ChildrenCount = _meshes.Count();
-    root.Bounds = _meshes[0].Bounds;
+    BoundingBox rootBounds = _meshes[0].Bounds;
     for (int32 i = 0; i < _meshes.Count(); i++)
     {
         const Mesh& meshData = _meshes[i];
@@ -411,39 +415,111 @@ void MeshAccelerationStructure::BuildBVH(int32 maxLeafSize)
         child.Leaf.MeshIndex = i;
         child.Leaf.TriangleIndex = 0;
         child.Leaf.TriangleCount = meshData.Indices / 3;
-        child.Bounds = meshData.Bounds;
-        BoundingBox::Merge(root.Bounds, meshData.Bounds, root.Bounds);
+        child.SetBounds(meshData.Bounds.Minimum, meshData.Bounds.Maximum);
+        BoundingBox::Merge(rootBounds, meshData.Bounds, rootBounds);
     }
+    _bvh[0].SetBounds(rootBounds.Minimum, rootBounds.Maximum);
 
-    // Sub-divide mesh nodes into smaller leaves
-    Array<byte> scratch;
+    // Split large nodes on this thread until sub-trees are small enough to be built by jobs
+    Array<int32> jobNodes, nodes;
     for (int32 i = 0; i < _meshes.Count(); i++)
-        BuildBVH(i + 1, maxLeafSize, scratch);
+        nodes.Add(i + 1);
+    while (nodes.HasItems())
+    {
+        const int32 node = nodes.Pop();
+        const uint32 nodeTriangles = _bvh[node].Leaf.TriangleCount;
+        if (nodeTriangles <= (uint32)maxLeafSize)
+            continue;
+        if (nodeTriangles <= BVH_JOB_TRIANGLES)
+        {
+            jobNodes.Add(node);
+            continue;
+        }
+        if (SplitBVH(_bvh, node))
+        {
+            const int32 childIndex = _bvh[node].Node.ChildIndex;
+            nodes.Add(childIndex);
+            nodes.Add(childIndex + 1);
+        }
+    }
+    if (jobNodes.IsEmpty())
+        return;
+
+    // Sub-divide nodes into smaller leaves in parallel (each sub-tree sorts its own range of the mesh index buffer)
+    Array<Array<BVH>> subTrees;
+    subTrees.Resize(jobNodes.Count());
+    Function<void(int32)> bvhJob = [this, &jobNodes, &subTrees, maxLeafSize](int32 i)
+    {
+        PROFILE_CPU_NAMED("BVH Job");
+        Array<BVH>& bvh = subTrees[i];
+        const BVH& node = _bvh[jobNodes[i]];
+        bvh.EnsureCapacity(node.Leaf.TriangleCount / maxLeafSize * 2 + 1);
+        bvh.Add(node);
+        BuildBVH(bvh, 0, maxLeafSize);
+    };
+    if (jobNodes.Count() == 1)
+        bvhJob(0);
+    else
+        JobSystem::Execute(bvhJob, jobNodes.Count());
+
+    // Merge sub-trees into the hierarchy (sub-tree root replaces the job node)
+    for (int32 i = 0; i < jobNodes.Count(); i++)
+    {
+        const Array<BVH>& bvh = subTrees[i];
+        const int32 offset = _bvh.Count() - 1;
+        for (int32 j = 0; j < bvh.Count(); j++)
+        {
+            BVH node = bvh[j];
+            if (!node.Node.IsLeaf)
+                node.Node.ChildIndex += offset;
+            if (j == 0)
+                _bvh[jobNodes[i]] = node;
+            else
+                _bvh.Add(node);
+        }
+    }
 }
 
 bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle, Real maxDistance) const
 {
-    hitDistance = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
-    bool hit = false;
-
     // BVH
     if (_bvh.Count() != 0)
     {
-        Array<int32, InlinedAllocation<32>> stack;
+        float hitDistanceSq = maxDistance >= MAX_Real ? MAX_float : (float)(maxDistance * maxDistance);
+        const SimdVector4 p = SIMD::Load((float)point.X, (float)point.Y, (float)point.Z, 0.0f);
+        bool hit = false;
+        Array<int32, InlinedAllocation<64>> stack;
         stack.Push(0);
         while (stack.HasItems())
         {
             const int32 node = stack.Pop();
-            auto& root = _bvh[node];
+            const BVH& root = _bvh.Get()[node];
 
             // Skip too far nodes
-            if (root.Bounds.Distance(point) >= hitDistance)
+            if (GetDistanceSquared(root.BoundsMin, root.BoundsMax, p) >= hitDistanceSq)
                 continue;
 
             if (root.Leaf.IsLeaf)
             {
-                // Check this leaf
-                hit |= PointQueryBVH(node, point, hitDistance, hitPoint, hitTriangle);
+                // Find closest triangle
+                const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
+                const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+                const int32 indexStart = root.Leaf.TriangleIndex * 3;
+                const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
+                if (meshData.Use16BitIndexBuffer)
+                    hit |= PointQueryTriangles(meshData.IndexBuffer.Get<uint16>(), vb, indexStart, indexEnd, point, hitDistanceSq, hitPoint, hitTriangle);
+                else
+                    hit |= PointQueryTriangles(meshData.IndexBuffer.Get<uint32>(), vb, indexStart, indexEnd, point, hitDistanceSq, hitPoint, hitTriangle);
+            }
+            else if (root.Node.ChildrenCount == 2)
+            {
+                // Visit the closer child first
+                const int32 childIndex = root.Node.ChildIndex;
+                const BVH& left = _bvh.Get()[childIndex];
+                const BVH& right = _bvh.Get()[childIndex + 1];
+                const bool leftFirst = GetDistanceSquared(left.BoundsMin, left.BoundsMax, p) <= GetDistanceSquared(right.BoundsMin, right.BoundsMax, p);
+                stack.Push(leftFirst ? childIndex + 1 : childIndex);
+                stack.Push(leftFirst ? childIndex : childIndex + 1);
             }
             else
             {
@@ -452,10 +528,13 @@ bool MeshAccelerationStructure::PointQuery(const Vector3& point, Real& hitDistan
                     stack.Push(root.Node.ChildIndex + i);
             }
         }
-        //hit = PointQueryBVH(0, point, hitDistance, hitPoint, hitTriangle);
+        hitDistance = hit ? Math::Sqrt((Real)hitDistanceSq) : maxDistance;
         return hit;
     }
 
+    hitDistance = maxDistance >= MAX_Real ? maxDistance : maxDistance * maxDistance;
+    bool hit = false;
+
     // Brute-force
     {
         Vector3 p;
@@ -514,7 +593,72 @@ bool MeshAccelerationStructure::RayCast(const Ray& ray, Real& hitDistance, Vecto
     // BVH
     if (_bvh.Count() != 0)
     {
-        return RayCastBVH(0, ray, hitDistance, hitNormal, hitTriangle);
+        // Use tiny direction instead of zero to don't get NaN in the slab test (0 * inf) for rays starting at the box plane
+        Float3 direction = ray.Direction;
+        for (int32 axis = 0; axis < 3; axis++)
+        {
+            if (Math::Abs(direction.Raw[axis]) < 1e-20f)
+                direction.Raw[axis] = direction.Raw[axis] < 0.0f ? -1e-20f : 1e-20f;
+        }
+        const SimdVector4 origin = SIMD::Load((float)ray.Position.X, (float)ray.Position.Y, (float)ray.Position.Z, 0.0f);
+        const SimdVector4 invDirection = SIMD::Load(1.0f / direction.X, 1.0f / direction.Y, 1.0f / direction.Z, 0.0f);
+        bool hit = false;
+        float distance;
+        if (!IntersectsRay(_bvh[0].BoundsMin, _bvh[0].BoundsMax, origin, invDirection, (float)hitDistance, distance))
+            return false;
+        Array<RayStackEntry, InlinedAllocation<64>> stack;
+        stack.Push({ 0, distance });
+        while (stack.HasItems())
+        {
+            const RayStackEntry entry = stack.Pop();
+            if (entry.Distance > hitDistance)
+                continue;
+            const BVH& root = _bvh.Get()[entry.Node];
+            if (root.Leaf.IsLeaf)
+            {
+                // Ray cast along triangles in the leaf
+                const Mesh& meshData = _meshes[root.Leaf.MeshIndex];
+                const Float3* vb = meshData.VertexBuffer.Get<Float3>();
+                const int32 indexStart = root.Leaf.TriangleIndex * 3;
+                const int32 indexEnd = indexStart + root.Leaf.TriangleCount * 3;
+                if (meshData.Use16BitIndexBuffer)
+                    hit |= RayCastTriangles(meshData.IndexBuffer.Get<uint16>(), vb, indexStart, indexEnd, ray, hitDistance, hitNormal, hitTriangle);
+                else
+                    hit |= RayCastTriangles(meshData.IndexBuffer.Get<uint32>(), vb, indexStart, indexEnd, ray, hitDistance, hitNormal, hitTriangle);
+            }
+            else if (root.Node.ChildrenCount == 2)
+            {
+                // Visit the closer child first
+                const int32 childIndex = root.Node.ChildIndex;
+                const BVH& left = _bvh.Get()[childIndex];
+                const BVH& right = _bvh.Get()[childIndex + 1];
+                float leftDistance, rightDistance;
+                const bool leftHit = IntersectsRay(left.BoundsMin, left.BoundsMax, origin, invDirection, (float)hitDistance, leftDistance);
+                const bool rightHit = IntersectsRay(right.BoundsMin, right.BoundsMax, origin, invDirection, (float)hitDistance, rightDistance);
+                if (leftHit && rightHit)
+                {
+                    const bool leftFirst = leftDistance <= rightDistance;
+                    stack.Push(leftFirst ? RayStackEntry{ childIndex + 1, rightDistance } : RayStackEntry{ childIndex, leftDistance });
+                    stack.Push(leftFirst ? RayStackEntry{ childIndex, leftDistance } : RayStackEntry{ childIndex + 1, rightDistance });
+                }
+                else if (leftHit)
+                    stack.Push({ childIndex, leftDistance });
+                else if (rightHit)
+                    stack.Push({ childIndex + 1, rightDistance });
+            }
+            else
+            {
+                // Ray cast all child nodes
+                for (uint32 i = 0; i < root.Node.ChildrenCount; i++)
+                {
+                    const int32 childIndex = root.Node.ChildIndex + i;
+                    const BVH& child = _bvh.Get()[childIndex];
+                    if (IntersectsRay(child.BoundsMin, child.BoundsMax, origin, invDirection, (float)hitDistance, distance))
+                        stack.Push({ childIndex, distance });
+                }
+            }
+        }
+        return hit;
     }
 
     // Brute-force
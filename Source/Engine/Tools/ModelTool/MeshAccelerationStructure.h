@@ -6,6 +6,7 @@
 
 #include "Engine/Core/Math/Triangle.h"
 #include "Engine/Core/Math/BoundingBox.h"
+#include "Engine/Core/Math/Vector4.h"
 #include "Engine/Core/Types/DataContainer.h"
 #include "Engine/Core/Collections/Array.h"
 
@@ -28,16 +29,18 @@ class FLAXENGINE_API MeshAccelerationStructure
 
     struct BVH
     {
-        BoundingBox Bounds;
+        // Node bounds (W component is unused and set to zero for SIMD tests)
+        Float4 BoundsMin;
+        Float4 BoundsMax;
 
         union
         {
             struct
             {
                 uint32 IsLeaf : 1;
-                uint16 TriangleCount : 15;
-                uint16 MeshIndex : 16;
+                uint32 TriangleCount : 31;
                 uint32 TriangleIndex;
+                uint32 MeshIndex;
             } Leaf;
 
             struct
@@ -47,14 +50,19 @@ class FLAXENGINE_API MeshAccelerationStructure
                 int32 ChildIndex;
             } Node;
         };
+
+        void SetBounds(const Float3& min, const Float3& max)
+        {
+            BoundsMin = Float4(min, 0.0f);
+            BoundsMax = Float4(max, 0.0f);
+        }
     };
 
     Array<Mesh, InlinedAllocation<16>> _meshes;
     Array<BVH> _bvh;
 
-    void BuildBVH(int32 node, int32 maxLeafSize, Array<byte>& scratch);
-    bool PointQueryBVH(int32 node, const Vector3& point, Real& hitDistance, Vector3& hitPoint, Triangle& hitTriangle) const;
-    bool RayCastBVH(int32 node, const Ray& ray, Real& hitDistance, Vector3& hitNormal, Triangle& hitTriangle) const;
+    bool SplitBVH(Array<BVH>& bvh, int32 node) const;
+    void BuildBVH(Array<BVH>& bvh, int32 node, int32 maxLeafSize) const;
 
 public:
     // Adds the model geometry for the build to the structure.
@@ -66,7 +74,7 @@ class FLAXENGINE_API MeshAccelerationStructure
     // Adds the triangles geometry for the build to the structure.
     void Add(Float3* vb, int32 vertices, void* ib, int32 indices, bool use16BitIndex, bool copy = false);
 
-    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries.
+    // Builds Bounding Volume Hierarchy (BVH) structure for accelerated geometry queries. Uses binned Surface Area Heuristic (SAH) splits and builds the sub-trees in parallel on Job System.
     void BuildBVH(int32 maxLeafSize = 16);
 
     // Queries the closest triangle.
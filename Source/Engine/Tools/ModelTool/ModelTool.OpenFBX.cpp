@@ -995,11 +995,6 @@ bool ProcessMesh(ModelData& result, OpenFbxImporterData& data, const ofbx::Mesh*
         }
     }
 
-    if (data.Options.OptimizeMeshes)
-    {
-        mesh.ImproveCacheLocality();
-    }
-
     // Apply FBX Mesh geometry transformation
     /*const Matrix geometryTransform = ToMatrix(aMesh->getGeometricMatrix());
     if (!geometryTransform.IsIdentity())
@@ -344,6 +344,8 @@ void ModelTool::Options::Serialize(SerializeStream& stream, const void* otherObj
     SERIALIZE(SmoothingTangentsAngle);
     SERIALIZE(OptimizeMeshes);
     SERIALIZE(MergeMeshes);
+    SERIALIZE(GenerateMeshlets);
+    SERIALIZE(CompressVertexPositions);
     SERIALIZE(ImportLODs);
     SERIALIZE(ImportVertexColors);
     SERIALIZE(ImportBlendShapes);
@@ -394,6 +396,8 @@ void ModelTool::Options::Deserialize(DeserializeStream& stream, ISerializeModifi
     DESERIALIZE(SmoothingTangentsAngle);
     DESERIALIZE(OptimizeMeshes);
     DESERIALIZE(MergeMeshes);
+    DESERIALIZE(GenerateMeshlets);
+    DESERIALIZE(CompressVertexPositions);
     DESERIALIZE(ImportLODs);
     DESERIALIZE(ImportVertexColors);
     DESERIALIZE(ImportBlendShapes);
@@ -725,6 +729,94 @@ void MeshOptDeallocate(void* ptr)
     Allocator::Free(ptr);
 }
 
+int32 BuildMeshlets(MeshData& mesh)
+{
+    mesh.Meshlets.Clear();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    if (indexCount / 3 < MODEL_MESHLET_MIN_TRIANGLES)
+        return 0;
+
+    // Build clusters of the nearby triangles (with similar normals for better cone culling)
+    const int32 maxMeshlets = (int32)meshopt_buildMeshletsBound(indexCount, MODEL_MESHLET_MAX_VERTICES, MODEL_MESHLET_MAX_TRIANGLES);
+    Array<meshopt_Meshlet> meshlets;
+    Array<unsigned int> meshletVertices;
+    Array<unsigned char> meshletTriangles;
+    meshlets.Resize(maxMeshlets);
+    meshletVertices.Resize(maxMeshlets * MODEL_MESHLET_MAX_VERTICES);
+    meshletTriangles.Resize(maxMeshlets * MODEL_MESHLET_MAX_TRIANGLES * 3);
+    const float* positions = (const float*)mesh.Positions.Get();
+    const int32 meshletsCount = (int32)meshopt_buildMeshlets(meshlets.Get(), meshletVertices.Get(), meshletTriangles.Get(), mesh.Indices.Get(), indexCount, positions, vertexCount, sizeof(Float3), MODEL_MESHLET_MAX_VERTICES, MODEL_MESHLET_MAX_TRIANGLES, 0.25f);
+
+    // Rewrite index buffer to store the triangles of each meshlet in a contiguous range
+    mesh.Meshlets.Resize(meshletsCount);
+    uint32 startIndex = 0;
+    for (int32 meshletIndex = 0; meshletIndex < meshletsCount; meshletIndex++)
+    {
+        const meshopt_Meshlet& src = meshlets[meshletIndex];
+        const unsigned int* srcVertices = meshletVertices.Get() + src.vertex_offset;
+        const unsigned char* srcTriangles = meshletTriangles.Get() + src.triangle_offset;
+        const meshopt_Bounds bounds = meshopt_computeMeshletBounds(srcVertices, srcTriangles, src.triangle_count, positions, vertexCount, sizeof(Float3));
+        Meshlet& dst = mesh.Meshlets[meshletIndex];
+        dst.Center = Float3(bounds.center);
+        dst.Radius = bounds.radius;
+        dst.ConeAxis = Float3(bounds.cone_axis);
+        dst.ConeCutoff = bounds.cone_cutoff;
+        dst.StartIndex = startIndex;
+        dst.TrianglesCount = src.triangle_count;
+        for (uint32 i = 0; i < src.triangle_count * 3; i++)
+            mesh.Indices[startIndex + i] = srcVertices[srcTriangles[i]];
+        startIndex += src.triangle_count * 3;
+    }
+    ASSERT(startIndex == (uint32)indexCount);
+    return meshletsCount;
+}
+
+int32 OptimizeMesh(MeshData& mesh)
+{
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    if (indexCount < 3 || vertexCount == 0)
+        return vertexCount;
+
+    // Reorder triangles for the post-transform vertex cache and to reduce the overdraw
+    meshopt_optimizeVertexCache(mesh.Indices.Get(), mesh.Indices.Get(), indexCount, vertexCount);
+    meshopt_optimizeOverdraw(mesh.Indices.Get(), mesh.Indices.Get(), indexCount, (const float*)mesh.Positions.Get(), vertexCount, sizeof(Float3), 1.05f);
+
+    // Reorder vertices in the order of use by the index buffer for the vertex fetch locality (unused vertices are removed)
+    Array<unsigned int> remap;
+    remap.Resize(vertexCount);
+    const int32 newVertexCount = (int32)meshopt_optimizeVertexFetchRemap(remap.Get(), mesh.Indices.Get(), indexCount, vertexCount);
+    meshopt_remapIndexBuffer(mesh.Indices.Get(), mesh.Indices.Get(), indexCount, remap.Get());
+#define REMAP_VERTEX_BUFFER(name, type) \
+    if (mesh.name.Count() == vertexCount) \
+    { \
+        meshopt_remapVertexBuffer(mesh.name.Get(), mesh.name.Get(), vertexCount, sizeof(type), remap.Get()); \
+        mesh.name.Resize(newVertexCount); \
+    }
+    REMAP_VERTEX_BUFFER(Positions, Float3);
+    REMAP_VERTEX_BUFFER(UVs, Float2);
+    REMAP_VERTEX_BUFFER(Normals, Float3);
+    REMAP_VERTEX_BUFFER(Tangents, Float3);
+    REMAP_VERTEX_BUFFER(BitangentSigns, float);
+    REMAP_VERTEX_BUFFER(LightmapUVs, Float2);
+    REMAP_VERTEX_BUFFER(Colors, Color);
+    REMAP_VERTEX_BUFFER(BlendIndices, Int4);
+    REMAP_VERTEX_BUFFER(BlendWeights, Float4);
+#undef REMAP_VERTEX_BUFFER
+    for (auto& blendShape : mesh.BlendShapes)
+    {
+        for (int32 i = blendShape.Vertices.Count() - 1; i >= 0; i--)
+        {
+            auto& v = blendShape.Vertices[i];
+            v.VertexIndex = v.VertexIndex < (uint32)vertexCount ? remap[v.VertexIndex] : ~0u;
+            if (v.VertexIndex == ~0u)
+                blendShape.Vertices.RemoveAtKeepOrder(i);
+        }
+    }
+    return newVertexCount;
+}
+
 void TrySetupMaterialParameter(MaterialInstance* instance, Span<const Char*> paramNames, const Variant& value, MaterialParameterType type)
 {
     for (const Char* name : paramNames)
@@ -1625,6 +1717,32 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
             LOG(Info, "Merged {0} meshes", meshesMerged);
     }
 
+    // Optimize meshes for the vertex cache, overdraw and vertex fetch (each mesh on a separate job)
+    if (options.OptimizeMeshes && data.LODs.HasItems())
+    {
+        auto optimizeStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        Array<MeshData*> meshes;
+        for (auto& lod : data.LODs)
+            meshes.Add(lod.Meshes.Get(), lod.Meshes.Count());
+        volatile int64 removedVertices = 0;
+        const Function<void(int32)> optimizeJob = [&](int32 meshIndex)
+        {
+            PROFILE_CPU_NAMED("Optimize Mesh Job");
+            MeshData& mesh = *meshes[meshIndex];
+            const int32 vertexCount = mesh.Positions.Count();
+            const int32 newVertexCount = OptimizeMesh(mesh);
+            if (newVertexCount != vertexCount)
+                Platform::InterlockedAdd(&removedVertices, vertexCount - newVertexCount);
+        };
+        JobSystem::Execute(optimizeJob, meshes.Count());
+        if (meshes.HasItems())
+        {
+            auto optimizeEndTime = DateTime::NowUTC();
+            LOG(Info, "Optimized {1} meshes in {0} ms (removed {2} unused vertices)", static_cast<int32>((optimizeEndTime - optimizeStartTime).GetTotalMilliseconds()), meshes.Count(), (int32)removedVertices);
+        }
+    }
+
     // Automatic LOD generation
     if (options.GenerateLODs && options.LODCount > 1 && data.LODs.HasItems() && options.TriangleReduction < 1.0f - ZeroTolerance)
     {
@@ -1634,22 +1752,24 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
         int32 lodCount = Math::Max(options.LODCount, data.LODs.Count());
         int32 baseLOD = Math::Clamp(options.BaseLOD, 0, lodCount - 1);
         data.LODs.Resize(lodCount);
-        int32 generatedLod = 0, baseLodTriangleCount = 0, baseLodVertexCount = 0;
+        volatile int64 generatedLod = 0;
+        int32 baseLodTriangleCount = 0, baseLodVertexCount = 0;
         for (auto& mesh : data.LODs[baseLOD].Meshes)
         {
             baseLodTriangleCount += mesh->Indices.Count() / 3;
             baseLodVertexCount += mesh->Positions.Count();
         }
-        Array<unsigned int> indices;
         for (int32 lodIndex = Math::Clamp(baseLOD + 1, 1, lodCount - 1); lodIndex < lodCount; lodIndex++)
         {
             auto& dstLod = data.LODs[lodIndex];
             const auto& srcLod = data.LODs[lodIndex - 1];
 
-            int32 lodTriangleCount = 0, lodVertexCount = 0;
+            // Simplify meshes in parallel (each mesh on a separate job)
+            volatile int64 lodTriangleCount = 0, lodVertexCount = 0;
             dstLod.Meshes.Resize(srcLod.Meshes.Count());
-            for (int32 meshIndex = 0; meshIndex < dstLod.Meshes.Count(); meshIndex++)
+            const Function<void(int32)> lodJob = [&](int32 meshIndex)
             {
+                PROFILE_CPU_NAMED("Generate LOD Job");
                 auto& dstMesh = dstLod.Meshes[meshIndex] = New<MeshData>();
                 const auto& srcMesh = srcLod.Meshes[meshIndex];
 
@@ -1663,8 +1783,8 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 int32 srcMeshVertexCount = srcMesh->Positions.Count();
                 int32 dstMeshIndexCountTarget = int32(srcMeshIndexCount * triangleReduction) / 3 * 3;
                 if (dstMeshIndexCountTarget < 3 || dstMeshIndexCountTarget >= srcMeshIndexCount)
-                    continue;
-                indices.Clear();
+                    return;
+                Array<unsigned int> indices;
                 indices.Resize(srcMeshIndexCount);
                 int32 dstMeshIndexCount = {};
                 if (options.SloppyOptimization)
@@ -1672,7 +1792,7 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 else
                     dstMeshIndexCount = (int32)meshopt_simplify(indices.Get(), srcMesh->Indices.Get(), srcMeshIndexCount, (const float*)srcMesh->Positions.Get(), srcMeshVertexCount, sizeof(Float3), dstMeshIndexCountTarget, options.LODTargetError);
                 if (dstMeshIndexCount <= 0 || dstMeshIndexCount > indices.Count())
-                    continue;
+                    return;
                 indices.Resize(dstMeshIndexCount);
 
                 // Generate simplified vertex buffer remapping table (use only vertices from LOD index buffer)
@@ -1735,10 +1855,11 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
                 meshopt_optimizeVertexCache(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, dstMeshVertexCount);
                 meshopt_optimizeOverdraw(dstMesh->Indices.Get(), dstMesh->Indices.Get(), dstMeshIndexCount, (const float*)dstMesh->Positions.Get(), dstMeshVertexCount, sizeof(Float3), 1.05f);
 
-                lodTriangleCount += dstMeshIndexCount / 3;
-                lodVertexCount += dstMeshVertexCount;
-                generatedLod++;
-            }
+                Platform::InterlockedAdd(&lodTriangleCount, dstMeshIndexCount / 3);
+                Platform::InterlockedAdd(&lodVertexCount, dstMeshVertexCount);
+                Platform::InterlockedIncrement(&generatedLod);
+            };
+            JobSystem::Execute(lodJob, dstLod.Meshes.Count());
 
             // Remove empty meshes (no LOD was generated for them)
             for (int32 i = dstLod.Meshes.Count() - 1; i >= 0; i--)
@@ -1753,8 +1874,8 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
 
             LOG(Info, "Generated LOD{0}: triangles: {1} ({2}% of base LOD), verticies: {3} ({4}% of base LOD)",
                 lodIndex,
-                lodTriangleCount, (int32)(lodTriangleCount * 100 / baseLodTriangleCount),
-                lodVertexCount, (int32)(lodVertexCount * 100 / baseLodVertexCount));
+                (int32)lodTriangleCount, (int32)(lodTriangleCount * 100 / baseLodTriangleCount),
+                (int32)lodVertexCount, (int32)(lodVertexCount * 100 / baseLodVertexCount));
         }
         for (int32 lodIndex = data.LODs.Count() - 1; lodIndex > 0; lodIndex--)
         {
@@ -1766,7 +1887,29 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
         if (generatedLod)
         {
             auto lodEndTime = DateTime::NowUTC();
-            LOG(Info, "Generated LODs for {1} meshes in {0} ms", static_cast<int32>((lodEndTime - lodStartTime).GetTotalMilliseconds()), generatedLod);
+            LOG(Info, "Generated LODs for {1} meshes in {0} ms", static_cast<int32>((lodEndTime - lodStartTime).GetTotalMilliseconds()), (int32)generatedLod);
+        }
+    }
+
+    // Meshlets generation (after LODs generation and optimization as it reorders the index buffers)
+    if (options.GenerateMeshlets && (options.Type == ModelType::Model || options.Type == ModelType::Prefab))
+    {
+        auto meshletsStartTime = DateTime::NowUTC();
+        meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+        Array<MeshData*> meshes;
+        for (auto& lod : data.LODs)
+            meshes.Add(lod.Meshes.Get(), lod.Meshes.Count());
+        volatile int64 meshletsCount = 0;
+        const Function<void(int32)> meshletsJob = [&](int32 meshIndex)
+        {
+            PROFILE_CPU_NAMED("Build Meshlets Job");
+            Platform::InterlockedAdd(&meshletsCount, BuildMeshlets(*meshes[meshIndex]));
+        };
+        JobSystem::Execute(meshletsJob, meshes.Count());
+        if (meshletsCount)
+        {
+            auto meshletsEndTime = DateTime::NowUTC();
+            LOG(Info, "Generated {1} meshlets in {0} ms", static_cast<int32>((meshletsEndTime - meshletsStartTime).GetTotalMilliseconds()), (int32)meshletsCount);
         }
     }
 
@@ -1801,6 +1944,49 @@ bool ModelTool::ImportModel(const String& path, ModelData& data, Options& option
     return false;
 }
 
+bool ModelTool::SimplifyMesh(MeshData& mesh, float triangleReduction, float targetError)
+{
+    PROFILE_CPU();
+    const int32 indexCount = mesh.Indices.Count();
+    const int32 vertexCount = mesh.Positions.Count();
+    const int32 indexCountTarget = int32(indexCount * Math::Saturate(triangleReduction)) / 3 * 3;
+    if (indexCountTarget < 3 || indexCountTarget >= indexCount || mesh.BlendShapes.HasItems())
+        return true;
+    meshopt_setAllocator(MeshOptAllocate, MeshOptDeallocate);
+
+    // Simplify mesh
+    Array<unsigned int> indices;
+    indices.Resize(indexCount);
+    const int32 newIndexCount = (int32)meshopt_simplify(indices.Get(), mesh.Indices.Get(), indexCount, (const float*)mesh.Positions.Get(), vertexCount, sizeof(Float3), indexCountTarget, targetError);
+    if (newIndexCount <= 0 || newIndexCount >= indexCount)
+        return true;
+
+    // Remove vertices that are not used by the simplified index buffer
+    Array<unsigned int> remap;
+    remap.Resize(vertexCount);
+    const int32 newVertexCount = (int32)meshopt_optimizeVertexFetchRemap(remap.Get(), indices.Get(), newIndexCount, vertexCount);
+    mesh.Indices.Resize(newIndexCount);
+    meshopt_remapIndexBuffer(mesh.Indices.Get(), indices.Get(), newIndexCount, remap.Get());
+#define REMAP_VERTEX_BUFFER(name, type) \
+    if (mesh.name.Count() == vertexCount) \
+    { \
+        meshopt_remapVertexBuffer(mesh.name.Get(), mesh.name.Get(), vertexCount, sizeof(type), remap.Get()); \
+        mesh.name.Resize(newVertexCount); \
+    }
+    REMAP_VERTEX_BUFFER(Positions, Float3);
+    REMAP_VERTEX_BUFFER(UVs, Float2);
+    REMAP_VERTEX_BUFFER(Normals, Float3);
+    REMAP_VERTEX_BUFFER(Tangents, Float3);
+    REMAP_VERTEX_BUFFER(BitangentSigns, float);
+    REMAP_VERTEX_BUFFER(LightmapUVs, Float2);
+    REMAP_VERTEX_BUFFER(Colors, Color);
+    REMAP_VERTEX_BUFFER(BlendIndices, Int4);
+    REMAP_VERTEX_BUFFER(BlendWeights, Float4);
+#undef REMAP_VERTEX_BUFFER
+    mesh.Meshlets.Clear();
+    return false;
+}
+
 int32 ModelTool::DetectLodIndex(const String& nodeName)
 {
     int32 index = nodeName.FindLast(TEXT("LOD"), StringSearchCase::IgnoreCase);
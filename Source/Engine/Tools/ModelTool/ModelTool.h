@@ -170,12 +170,18 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
         // Specifies the maximum angle (in degrees) that may be between two vertex tangents before their tangents and bi-tangents are smoothed. The default value is 45.
         API_FIELD(Attributes="EditorOrder(45), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowSmoothingTangentsAngle)), Limit(0, 45, 0.1f)")
         float SmoothingTangentsAngle = 45.0f;
-        // Enable/disable meshes geometry optimization.
+        // Enable/disable meshes geometry optimization (triangles and vertices reordering for the GPU vertex cache, overdraw and vertex fetch efficiency).
         API_FIELD(Attributes="EditorOrder(50), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         bool OptimizeMeshes = true;
         // Enable/disable geometry merge for meshes with the same materials. Index buffer will be reordered to improve performance and other modifications will be applied. However, importing time will be increased.
         API_FIELD(Attributes="EditorOrder(60), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowGeometry))")
         bool MergeMeshes = true;
+        // Enable/disable meshlets (clusters of triangles) generation for high-poly meshes. Used by the GPU-driven rendering to cull the invisible and back-facing parts of the static models.
+        API_FIELD(Attributes="EditorOrder(65), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool GenerateMeshlets = false;
+        // Enable/disable vertex positions compression to 16-bit within the mesh bounds. Reduces vertex buffer memory and bandwidth of the static models (positions stream is 33% smaller) at the cost of the precision (1/65535 of the mesh size).
+        API_FIELD(Attributes="EditorOrder(66), EditorDisplay(\"Geometry\"), VisibleIf(nameof(ShowModel))")
+        bool CompressVertexPositions = false;
         // Enable/disable importing meshes Level of Details.
         API_FIELD(Attributes="EditorOrder(70), EditorDisplay(\"Geometry\", \"Import LODs\"), VisibleIf(nameof(ShowGeometry))")
         bool ImportLODs = true;
@@ -356,6 +362,15 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API ModelTool
     /// <returns>True if fails, otherwise false.</returns>
     static bool ImportModel(const String& path, ModelData& data, Options& options, String& errorMsg, const String& autoImportOutput = String::Empty);
 
+    /// <summary>
+    /// Simplifies the mesh geometry to the given amount of triangles (in-place). Vertices not used by the simplified mesh are removed. Used to generate the proxy meshes (eg. HLOD).
+    /// </summary>
+    /// <param name="mesh">The mesh data to simplify.</param>
+    /// <param name="triangleReduction">The target amount of triangles (as a fraction of the input triangles count).</param>
+    /// <param name="targetError">The target error of the simplification (relative to the mesh size).</param>
+    /// <returns>True if mesh cannot be simplified, otherwise false.</returns>
+    static bool SimplifyMesh(MeshData& mesh, float triangleReduction, float targetError);
+
 public:
     static int32 DetectLodIndex(const String& nodeName);
     static bool FindTexture(const String& sourcePath, const String& file, String& path);
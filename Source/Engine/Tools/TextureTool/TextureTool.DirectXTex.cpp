@@ -5,9 +5,12 @@
 #include "TextureTool.h"
 #include "Engine/Core/Log.h"
 #include "Engine/Core/Math/Math.h"
+#include "Engine/Core/Collections/Array.h"
 #include "Engine/Platform/File.h"
 #include "Engine/Platform/CriticalSection.h"
 #include "Engine/Platform/ConditionVariable.h"
+#include "Engine/Threading/JobSystem.h"
+#include "Engine/Profiler/ProfilerCPU.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Graphics/Async/GPUTask.h"
 #include "Engine/Graphics/Textures/TextureData.h"
@@ -38,6 +41,11 @@ DECLARE_HANDLE(HMONITOR);
 #include <ThirdParty/tinyexr/tinyexr.h>
 #endif
 
+// Height (in pixels, multiple of block size) of the image strip compressed by a single job
+#define TEXTURE_TOOL_COMPRESS_STRIP_HEIGHT 64
+// Minimum amount of pixels to compress the images in parallel (small images are compressed directly to reduce the jobs overhead)
+#define TEXTURE_TOOL_COMPRESS_PARALLEL_MIN_PIXELS (256 * 256)
+
 namespace
 {
     FORCE_INLINE PixelFormat ToPixelFormat(const DXGI_FORMAT format)
@@ -50,10 +58,73 @@ namespace
         return static_cast<DXGI_FORMAT>(format);
     }
 
+    HRESULT CompressParallel(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DXGI_FORMAT format, DirectX::TEX_COMPRESS_FLAGS compress, float threshold, DirectX::ScratchImage& cImages)
+    {
+        if (metadata.width * metadata.height < TEXTURE_TOOL_COMPRESS_PARALLEL_MIN_PIXELS || !DirectX::IsCompressed(format) || metadata.IsVolumemap())
+            return DirectX::Compress(srcImages, nimages, metadata, format, compress, threshold, cImages);
+        PROFILE_CPU();
+
+        // Split images into the strips of blocks rows and compress them with the job system (DirectXTex parallelizes only with OpenMP which is not used)
+        DirectX::TexMetadata mdata = metadata;
+        mdata.format = format;
+        HRESULT result = cImages.Initialize(mdata);
+        if (FAILED(result))
+            return result;
+        if (cImages.GetImageCount() != nimages)
+        {
+            cImages.Release();
+            return E_FAIL;
+        }
+        struct Strip
+        {
+            int32 Image;
+            int32 Y;
+            int32 Height;
+        };
+        Array<Strip> strips;
+        for (size_t i = 0; i < nimages; i++)
+        {
+            const int32 height = (int32)srcImages[i].height;
+            for (int32 y = 0; y < height; y += TEXTURE_TOOL_COMPRESS_STRIP_HEIGHT)
+                strips.Add({ (int32)i, y, Math::Min(height - y, TEXTURE_TOOL_COMPRESS_STRIP_HEIGHT) });
+        }
+        const DirectX::TEX_COMPRESS_FLAGS stripCompress = (DirectX::TEX_COMPRESS_FLAGS)(compress & ~DirectX::TEX_COMPRESS_PARALLEL);
+        const DirectX::Image* dstImages = cImages.GetImages();
+        volatile int64 failed = 0;
+        const Function<void(int32)> job = [&](int32 index)
+        {
+            const Strip& strip = strips[index];
+            const DirectX::Image& src = srcImages[strip.Image];
+            const DirectX::Image& dst = dstImages[strip.Image];
+            DirectX::Image srcStrip = src;
+            srcStrip.height = strip.Height;
+            srcStrip.slicePitch = src.rowPitch * strip.Height;
+            srcStrip.pixels = src.pixels + src.rowPitch * strip.Y;
+            DirectX::ScratchImage dstStrip;
+            const HRESULT stripResult = DirectX::Compress(srcStrip, format, stripCompress, threshold, dstStrip);
+            const DirectX::Image* dstStripImage = dstStrip.GetImage(0, 0, 0);
+            if (FAILED(stripResult) || !dstStripImage || dstStripImage->rowPitch != dst.rowPitch)
+            {
+                Platform::AtomicStore(&failed, FAILED(stripResult) ? (int64)stripResult : (int64)E_FAIL);
+                return;
+            }
+            uint8_t* dstPixels = dst.pixels + dst.rowPitch * (strip.Y / 4);
+            Platform::MemoryCopy(dstPixels, dstStripImage->pixels, Math::Min(dstStripImage->slicePitch, (size_t)(dst.pixels + dst.slicePitch - dstPixels)));
+        };
+        JobSystem::Execute(job, strips.Count());
+        if (failed != 0)
+        {
+            cImages.Release();
+            return (HRESULT)failed;
+        }
+        return S_OK;
+    }
+
     HRESULT Compress(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DXGI_FORMAT format, DirectX::TEX_COMPRESS_FLAGS compress, float threshold, DirectX::ScratchImage& cImages)
     {
 #if USE_EDITOR
-        if ((format == DXGI_FORMAT_BC7_UNORM || format == DXGI_FORMAT_BC7_UNORM_SRGB || format == DXGI_FORMAT_BC6H_UF16 || format == DXGI_FORMAT_BC6H_SF16) &&
+        if (TextureTool::UseGPUCompression &&
+            (format == DXGI_FORMAT_BC7_UNORM || format == DXGI_FORMAT_BC7_UNORM_SRGB || format == DXGI_FORMAT_BC6H_UF16 || format == DXGI_FORMAT_BC6H_SF16) &&
             GPUDevice::Instance &&
             GPUDevice::Instance->GetState() == GPUDevice::DeviceState::Ready &&
             GPUDevice::Instance->GetRendererType() == RendererType::DirectX11)
@@ -125,7 +196,53 @@ namespace
             return task->CompressResult;
         }
 #endif
-        return DirectX::Compress(srcImages, nimages, metadata, format, compress, threshold, cImages);
+        return CompressParallel(srcImages, nimages, metadata, format, compress, threshold, cImages);
+    }
+
+    HRESULT GenerateMipMapsParallel(const DirectX::Image* srcImages, size_t nimages, const DirectX::TexMetadata& metadata, DirectX::TEX_FILTER_FLAGS filter, size_t levels, DirectX::ScratchImage& mipChain)
+    {
+        if (metadata.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || metadata.arraySize <= 1 || metadata.mipLevels != 1 || nimages != metadata.arraySize)
+            return DirectX::GenerateMipMaps(srcImages, nimages, metadata, filter, levels, mipChain);
+        PROFILE_CPU();
+
+        // Generate mip maps chain for each array slice (or cube face) in parallel
+        Array<DirectX::ScratchImage> itemChains;
+        itemChains.Resize((int32)nimages);
+        Array<HRESULT> results;
+        results.Resize((int32)nimages);
+        const Function<void(int32)> job = [&](int32 index)
+        {
+            PROFILE_CPU_NAMED("GenerateMipMaps");
+            results[index] = DirectX::GenerateMipMaps(srcImages[index], filter, levels, itemChains[index]);
+        };
+        JobSystem::Execute(job, (int32)nimages);
+        for (const HRESULT result : results)
+        {
+            if (FAILED(result))
+                return result;
+        }
+
+        // Combine results into a single mip maps chain
+        DirectX::TexMetadata mdata = metadata;
+        mdata.mipLevels = itemChains[0].GetMetadata().mipLevels;
+        HRESULT result = mipChain.Initialize(mdata);
+        if (FAILED(result))
+            return result;
+        for (size_t item = 0; item < nimages; item++)
+        {
+            for (size_t level = 0; level < mdata.mipLevels; level++)
+            {
+                const DirectX::Image* src = itemChains[(int32)item].GetImage(level, 0, 0);
+                const DirectX::Image* dst = mipChain.GetImage(level, item, 0);
+                if (!src || !dst || src->slicePitch != dst->slicePitch)
+                {
+                    mipChain.Release();
+                    return E_FAIL;
+                }
+                Platform::MemoryCopy(dst->pixels, src->pixels, dst->slicePitch);
+            }
+        }
+        return S_OK;
     }
 }
 
@@ -798,7 +915,7 @@ bool TextureTool::ImportTextureDirectXTex(ImageType type, const StringView& path
         }
         else
         {
-            result = GenerateMipMaps(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), DirectX::TEX_FILTER_SEPARATE_ALPHA, mipLevels, tmpImg);
+            result = GenerateMipMapsParallel(currentImage->GetImages(), currentImage->GetImageCount(), currentImage->GetMetadata(), DirectX::TEX_FILTER_SEPARATE_ALPHA, mipLevels, tmpImg);
         }
         if (FAILED(result))
         {
@@ -9,8 +9,12 @@
 #include "Engine/Graphics/PixelFormatExtensions.h"
 #include "Engine/Graphics/RenderTools.h"
 #include "Engine/Profiler/ProfilerCPU.h"
+#include "Engine/Threading/JobSystem.h"
 #include <ThirdParty/astc/astcenc.h>
 
+// Minimum amount of blocks to compress the mip level with multiple job system threads (small mips are compressed directly to reduce the jobs overhead)
+#define TEXTURE_TOOL_ASTC_PARALLEL_MIN_BLOCKS 1024
+
 bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const PixelFormat dstFormat)
 {
     PROFILE_CPU();
@@ -39,8 +43,10 @@ bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const Pi
     }
 
     // Allocate working state given config and thread_count
+    // Encoder splits work into tasks picked by all threads that call compress so use job system threads to compress blocks in parallel
+    const int32 threadsCount = Math::Max(JobSystem::GetThreadsCount(), 1);
     astcenc_context* astcContext;
-    astcError = astcenc_context_alloc(&astcConfig, 1, &astcContext);
+    astcError = astcenc_context_alloc(&astcConfig, threadsCount, &astcContext);
     if (astcError != ASTCENC_SUCCESS)
     {
         LOG(Warning, "Cannot compress image. ASTC failed with error: {}", String(astcenc_get_error_string(astcError)));
@@ -118,7 +124,24 @@ bool TextureTool::ConvertAstc(TextureData& dst, const TextureData& src, const Pi
             astcInput.data_type = isHDR ? ASTCENC_TYPE_F16 : ASTCENC_TYPE_U8;
             void* srcData = (void*)srcMip.Data.Get();
             astcInput.data = &srcData;
-            astcError = astcenc_compress_image(astcContext, &astcInput, &astcSwizzle, dstMip.Data.Get(), dstMip.Data.Length(), 0);
+            if (threadsCount > 1 && blocksWidth * blocksHeight >= TEXTURE_TOOL_ASTC_PARALLEL_MIN_BLOCKS)
+            {
+                volatile int64 jobsError = ASTCENC_SUCCESS;
+                const Function<void(int32)> job = [&](int32 threadIndex)
+                {
+                    PROFILE_CPU_NAMED("ASTC.Compress");
+                    const astcenc_error jobError = astcenc_compress_image(astcContext, &astcInput, &astcSwizzle, dstMip.Data.Get(), dstMip.Data.Length(), threadIndex);
+                    if (jobError != ASTCENC_SUCCESS)
+                        Platform::AtomicStore(&jobsError, (int64)jobError);
+                };
+                JobSystem::Execute(job, threadsCount);
+                astcError = (astcenc_error)jobsError;
+            }
+            else
+            {
+                // Single thread picks all the tasks
+                astcError = astcenc_compress_image(astcContext, &astcInput, &astcSwizzle, dstMip.Data.Get(), dstMip.Data.Length(), 0);
+            }
             if (astcError == ASTCENC_SUCCESS)
                 astcError = astcenc_compress_reset(astcContext);
         }
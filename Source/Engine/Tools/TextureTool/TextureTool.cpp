@@ -25,6 +25,8 @@ namespace
 }
 #endif
 
+bool TextureTool::UseGPUCompression = true;
+
 String TextureTool::Options::ToString() const
 {
     return String::Format(TEXT("Type: {}, IsAtlas: {}, NeverStream: {}, IndependentChannels: {}, sRGB: {}, GenerateMipMaps: {}, FlipY: {}, InvertGreen: {} Scale: {}, MaxSize: {}, Resize: {}, PreserveAlphaCoverage: {}, PreserveAlphaCoverageReference: {}, SizeX: {}, SizeY: {}"),
@@ -109,6 +109,11 @@ API_CLASS(Namespace="FlaxEngine.Tools", Static) class FLAXENGINE_API TextureTool
     };
 
 public:
+    /// <summary>
+    /// True if use GPU to compress textures into BC6H and BC7 formats (if supported by the graphics device), otherwise textures get compressed on CPU by the job system threads. GPU compression is faster but the CPU one can be used to produce deterministic results (eg. on build servers).
+    /// </summary>
+    static bool UseGPUCompression;
+
 #if USE_EDITOR
     /// <summary>
     /// Checks whenever the given texture file contains alpha channel data with values different than solid fill of 1 (non fully opaque).
@@ -11,11 +11,22 @@ namespace FlaxEngine.GUI
     [ActorToolbox("GUI")]
     public class Image : ContainerControl
     {
+        private IBrush _brush;
+        private Color _color = Color.White;
+
         /// <summary>
         /// Gets or sets the image source.
         /// </summary>
         [EditorOrder(10), Tooltip("The image to draw.")]
-        public IBrush Brush { get; set; }
+        public IBrush Brush
+        {
+            get => _brush;
+            set
+            {
+                _brush = value;
+                InvalidateDraw();
+            }
+        }
 
         /// <summary>
         /// Gets or sets the margin for the image.
@@ -27,7 +38,15 @@ public class Image : ContainerControl
         /// Gets or sets the color used to multiply the image pixels.
         /// </summary>
         [EditorDisplay("Image Style"), EditorOrder(2010), ExpandGroups]
-        public Color Color { get; set; } = Color.White;
+        public Color Color
+        {
+            get => _color;
+            set
+            {
+                _color = value;
+                InvalidateDraw();
+            }
+        }
 
         /// <summary>
         /// Gets or sets the color used to multiply the image pixels when mouse is over the image.
@@ -43,6 +43,7 @@ public class Label : ContainerControl
         private Float2 _textSize;
         private Float2 _autoFitTextRange = new Float2(0.1f, 100.0f);
         private Margin _margin;
+        private Color _textColor;
 
         /// <summary>
         /// The font.
@@ -59,6 +60,7 @@ public LocalizedString Text
             set
             {
                 _text = value;
+                InvalidateDraw();
                 if (_autoWidth || _autoHeight || _autoFitText)
                 {
                     _textSize = Float2.Zero;
@@ -89,7 +91,15 @@ public LocalizedString Text
         /// Gets or sets the color of the text.
         /// </summary>
         [EditorDisplay("Text Style"), EditorOrder(2010), Tooltip("The color of the text."), ExpandGroups]
-        public Color TextColor { get; set; }
+        public Color TextColor
+        {
+            get => _textColor;
+            set
+            {
+                _textColor = value;
+                InvalidateDraw();
+            }
+        }
 
         /// <summary>
         /// Gets or sets the color of the text when it is highlighted (mouse is over).
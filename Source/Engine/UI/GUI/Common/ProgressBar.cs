@@ -143,6 +143,7 @@ public float Value
                 if (!Mathf.NearEqual(value, _value))
                 {
                     _value = value;
+                    InvalidateDraw();
                     if (!UseSmoothing || _firstUpdate)
                     {
                         _current = _value;
@@ -210,6 +211,7 @@ public override void Update(float deltaTime)
                     if (!isDeltaSlow && UseSmoothing)
                         value = Mathf.Lerp(_current, _value, Mathf.Saturate(deltaTime * 5.0f * SmoothingScale));
                     _current = value;
+                    InvalidateDraw();
                 }
                 else
                 {
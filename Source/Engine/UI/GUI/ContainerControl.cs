@@ -29,8 +29,18 @@ public class ContainerControl : Control
         [NoSerialize]
         protected bool _isLayoutLocked;
 
+        internal enum DrawListState
+        {
+            Invalid,
+            Valid,
+            Unsupported,
+        }
+
         private bool _clipChildren = true;
         private bool _cullChildren = true;
+        private bool _cacheDraw;
+        private uint _drawList;
+        internal DrawListState _drawListState;
 
         /// <summary>
         /// Initializes a new instance of the <see cref="ContainerControl"/> class.
@@ -102,7 +112,11 @@ public bool IsLayoutLocked
         public bool ClipChildren
         {
             get => _clipChildren;
-            set => _clipChildren = value;
+            set
+            {
+                _clipChildren = value;
+                InvalidateDraw();
+            }
         }
 
         /// <summary>
@@ -112,7 +126,28 @@ public bool ClipChildren
         public bool CullChildren
         {
             get => _cullChildren;
-            set => _cullChildren = value;
+            set
+            {
+                _cullChildren = value;
+                InvalidateDraw();
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets a value indicating whether cache the control and children draw calls and replay them in the next frames without drawing the controls. Cache gets invalidated on layout or controls state change and it's not used when control has mouse over or focus. Use it for static panels (eg. HUD or inventory).
+        /// </summary>
+        /// <remarks>Controls that change their appearance without the layout or state change need to call <see cref="Control.InvalidateDraw"/>.</remarks>
+        [EditorOrder(550), Tooltip("If checked, control will cache the draw calls of itself and children and replay them in the next frames until any control changes. Use it for static panels.")]
+        public bool CacheDraw
+        {
+            get => _cacheDraw;
+            set
+            {
+                if (_cacheDraw == value)
+                    return;
+                _cacheDraw = value;
+                FreeDrawList();
+            }
         }
 
         /// <summary>
@@ -423,6 +458,8 @@ public virtual void OnChildrenChanged()
             // Check if control isn't during disposing state
             if (!IsDisposing)
             {
+                InvalidateDraw();
+
                 // Arrange child controls
                 PerformLayout();
             }
@@ -733,6 +770,8 @@ public override void OnDestroy()
                 LockChildrenRecursive();
             }
 
+            FreeDrawList();
+
             base.OnDestroy();
 
             // Pass event further
@@ -792,6 +831,25 @@ public override void ClearState()
         /// Draw the control and the children.
         /// </summary>
         public override void Draw()
+        {
+            if (_cacheDraw && _drawListState != DrawListState.Unsupported && !IsMouseOver && !ContainsFocus)
+            {
+                // Replay the cached draw calls if nothing has changed
+                if (_drawListState == DrawListState.Valid && !Render2D.DrawList(_drawList))
+                    return;
+
+                // Record draw calls
+                Render2D.BeginDrawList();
+                DrawContents();
+                _drawList = Render2D.EndDrawList(_drawList);
+                _drawListState = _drawList != 0 ? DrawListState.Valid : DrawListState.Unsupported;
+                return;
+            }
+
+            DrawContents();
+        }
+
+        private void DrawContents()
         {
             DrawSelf();
 
@@ -858,11 +916,22 @@ protected virtual void DrawChildren()
             }
         }
 
+        private void FreeDrawList()
+        {
+            if (_drawList != 0)
+            {
+                Render2D.FreeDrawList(_drawList);
+                _drawList = 0;
+            }
+            _drawListState = DrawListState.Invalid;
+        }
+
         /// <inheritdoc />
         public override void PerformLayout(bool force = false)
         {
             if (_isLayoutLocked && !force)
                 return;
+            InvalidateDraw();
 
             bool wasLocked = _isLayoutLocked;
             if (!wasLocked)
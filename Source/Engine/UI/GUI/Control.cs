@@ -123,6 +123,7 @@ public ContainerControl Parent
                     return;
 
                 Defocus();
+                InvalidateDraw();
 
                 Float2 oldParentSize;
                 if (_parent != null)
@@ -138,6 +139,7 @@ public ContainerControl Parent
 
                 _parent = value;
                 _parent?.AddChildInternal(this);
+                InvalidateDraw();
 
                 CacheRootHandle();
                 OnParentChangedInternal();
@@ -172,7 +174,11 @@ public int IndexInParent
         public Color BackgroundColor
         {
             get => _backgroundColor;
-            set => _backgroundColor = value;
+            set
+            {
+                _backgroundColor = value;
+                InvalidateDraw();
+            }
         }
 
         /// <summary>
@@ -185,6 +191,7 @@ public IBrush BackgroundBrush
             set
             {
                 _backgroundBrush = value;
+                InvalidateDraw();
 
 #if FLAX_EDITOR
                 // Auto-reset background color so brush is visible as it uses it for tint
@@ -238,6 +245,7 @@ public bool Enabled
                     _isEnabled = value;
                     if (!_isEnabled)
                         ClearState();
+                    InvalidateDraw();
                 }
             }
         }
@@ -271,6 +279,7 @@ public bool Visible
                     _isVisible = value;
                     if (!_isVisible)
                         ClearState();
+                    InvalidateDraw();
 
                     OnVisibleChanged();
                     _parent?.PerformLayout();
@@ -447,6 +456,20 @@ public virtual void Draw()
             }
         }
 
+        /// <summary>
+        /// Invalidates the cached draw lists of the control and its parents (see <see cref="ContainerControl.CacheDraw"/>). Should be called when the control appearance changes without the layout or state change (eg. in custom controls).
+        /// </summary>
+        [NoAnimate]
+        public void InvalidateDraw()
+        {
+            var container = this as ContainerControl ?? _parent;
+            while (container != null)
+            {
+                container._drawListState = ContainerControl.DrawListState.Invalid;
+                container = container.Parent;
+            }
+        }
+
         /// <summary>
         /// Update control layout
         /// </summary>
@@ -528,6 +551,7 @@ public virtual void OnGotFocus()
             // Cache flag
             _isFocused = true;
             _isNavFocused = false;
+            InvalidateDraw();
         }
 
         /// <summary>
@@ -539,6 +563,7 @@ public virtual void OnLostFocus()
             // Clear flag
             _isFocused = false;
             _isNavFocused = false;
+            InvalidateDraw();
         }
 
         /// <summary>
@@ -740,6 +765,7 @@ public virtual void OnMouseEnter(Float2 location)
         {
             // Set flag
             _isMouseOver = true;
+            InvalidateDraw();
 
             // Update tooltip
             if (ShowTooltip && OnTestTooltipOverControl(ref location))
@@ -780,6 +806,7 @@ public virtual void OnMouseLeave()
         {
             // Clear flag
             _isMouseOver = false;
+            InvalidateDraw();
 
             // Update tooltip
             if (_tooltipUpdate != null)
@@ -1331,6 +1358,7 @@ public virtual Float2 PointFromScreen(Float2 location)
         protected virtual void OnLocationChanged()
         {
             LocationChanged?.Invoke(this);
+            InvalidateDraw();
         }
 
         /// <summary>
@@ -1340,6 +1368,7 @@ protected virtual void OnSizeChanged()
         {
             SizeChanged?.Invoke(this);
             _parent?.OnChildResized(this);
+            InvalidateDraw();
         }
 
         /// <summary>
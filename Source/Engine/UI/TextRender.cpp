@@ -192,6 +192,10 @@ void TextRender::UpdateLayout()
             {
                 font->GetCharacter(c, entry);
 
+                // Update layout again when glyph that is rasterized in the background gets ready
+                if (entry.TextureIndex == MAX_uint8 && entry.Height != 0)
+                    _isDirty = true;
+
                 // Check if need to select/change font atlas (since characters even in the same font may be located in different atlases)
                 if (fontAtlas == nullptr || entry.TextureIndex != drawChunk.FontAtlasIndex)
                 {
@@ -255,7 +259,8 @@ void TextRender::UpdateLayout()
                     const float x = pointer.X + (float)entry.OffsetX * scale;
                     const float y = pointer.Y + (float)(font->GetHeight() + font->GetDescender() - entry.OffsetY) * scale;
 
-                    Rectangle charRect(x, y, entry.UVSize.X * scale, entry.UVSize.Y * scale);
+                    const float glyphScale = entry.Font->GetGlyphScale();
+                    Rectangle charRect(x, y, entry.UVSize.X * glyphScale * scale, entry.UVSize.Y * glyphScale * scale);
                     charRect.Offset(_layoutOptions.Bounds.Location);
 
                     Float2 upperLeftUV = entry.UV * invAtlasSize;
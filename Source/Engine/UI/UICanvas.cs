@@ -42,6 +42,9 @@ public enum CanvasRenderMode
     [HideInEditor]
     public sealed class CanvasRenderer : PostProcessEffect
     {
+        private GPUTexture _cachedTexture;
+        private float _cachedTextureTime;
+
         /// <summary>
         /// The canvas to render.
         /// </summary>
@@ -86,14 +89,97 @@ public override void Render(GPUContext context, ref RenderContext renderContext,
 
             // Render GUI in 3D
             var features = Render2D.Features;
-            if (Canvas.RenderMode == CanvasRenderMode.WorldSpace || Canvas.RenderMode == CanvasRenderMode.WorldSpaceFaceCamera)
+            var isWorldSpace = Canvas.RenderMode == CanvasRenderMode.WorldSpace || Canvas.RenderMode == CanvasRenderMode.WorldSpaceFaceCamera;
+            if (isWorldSpace)
                 Render2D.Features &= ~Render2D.RenderingFeatures.VertexSnapping;
-            Render2D.CallDrawing(Canvas.GUI, context, input, depthBuffer, ref viewProjectionMatrix);
+            if (isWorldSpace && Canvas.CachedRendering && UpdateCachedTexture(context))
+            {
+                // Draw cached GUI as a single quad
+                Render2D.Begin(context, input, depthBuffer, ref viewProjectionMatrix);
+                try
+                {
+                    Render2D.DrawTexture(_cachedTexture, new Rectangle(Float2.Zero, Canvas.Size));
+                }
+                finally
+                {
+                    Render2D.End();
+                }
+            }
+            else
+            {
+                Render2D.CallDrawing(Canvas.GUI, context, input, depthBuffer, ref viewProjectionMatrix);
+            }
             Render2D.Features = features;
 
             Profiler.EndEvent();
             Profiler.EndEventGPU();
         }
+
+        private bool UpdateCachedTexture(GPUContext context)
+        {
+            // Check if need to resize the texture
+            var guiRoot = Canvas.GUI;
+            var scale = Mathf.Max(Canvas.CachedRenderingScale, 0.01f);
+            var maxSize = GPUDevice.Instance.Limits.MaximumTexture2DSize;
+            var width = Mathf.Clamp(Mathf.CeilToInt(Canvas.Size.X * scale), 1, maxSize);
+            var height = Mathf.Clamp(Mathf.CeilToInt(Canvas.Size.Y * scale), 1, maxSize);
+            var time = Time.UnscaledGameTime;
+            var redraw = false;
+            if (!_cachedTexture)
+                _cachedTexture = new GPUTexture();
+            if (_cachedTexture.Width != width || _cachedTexture.Height != height)
+            {
+                var desc = GPUTextureDescription.New2D(width, height, PixelFormat.R8G8B8A8_UNorm);
+                if (_cachedTexture.Init(ref desc))
+                {
+                    Debug.Logger.LogHandler.LogWrite(LogType.Error, "Failed to allocate texture for UICanvas cached rendering");
+                    return false;
+                }
+                redraw = true;
+            }
+
+            // Redraw only if any control has changed (see Control.InvalidateDraw) or at the fixed rate
+            var rate = Canvas.CachedRenderingRate;
+            if (guiRoot._drawListState == ContainerControl.DrawListState.Invalid)
+                redraw = true;
+            else if (rate > 0.0f && time - _cachedTextureTime >= 1.0f / rate)
+                redraw = true;
+            if (!redraw)
+                return true;
+            _cachedTextureTime = time;
+
+            Profiler.BeginEventGPU("Cached");
+            context.Clear(_cachedTexture.View(), Color.Transparent);
+            Render2D.Begin(context, _cachedTexture);
+            try
+            {
+                var scaling = new Float3(width / Mathf.Max(Canvas.Size.X, 1.0f), height / Mathf.Max(Canvas.Size.Y, 1.0f), 1);
+                Matrix3x3.Scaling(ref scaling, out Matrix3x3 scaleMatrix);
+                Render2D.PushTransform(ref scaleMatrix);
+                guiRoot.Draw();
+                Render2D.PopTransform();
+            }
+            finally
+            {
+                Render2D.End();
+            }
+            guiRoot._drawListState = ContainerControl.DrawListState.Valid;
+            Profiler.EndEventGPU();
+            return true;
+        }
+
+        internal void ReleaseCachedTexture()
+        {
+            Destroy(ref _cachedTexture);
+        }
+
+        /// <inheritdoc />
+        public override void OnDestroy()
+        {
+            ReleaseCachedTexture();
+
+            base.OnDestroy();
+        }
     }
 
     partial class UICanvas
@@ -166,6 +252,8 @@ public int Order
         private bool Editor_IsCameraSpace => _renderMode == CanvasRenderMode.CameraSpace;
 
         private bool Editor_UseRenderCamera => _renderMode == CanvasRenderMode.CameraSpace || _renderMode == CanvasRenderMode.WorldSpaceFaceCamera;
+
+        private bool Editor_UseCachedRendering => Editor_IsWorldSpace && _cachedRendering;
 #endif
 
         /// <summary>
@@ -190,6 +278,37 @@ public Float2 Size
         [EditorOrder(30), EditorDisplay("Canvas"), VisibleIf("Editor_Is3D"), Tooltip("If checked, scene depth will be ignored when rendering the GUI (scene objects won't cover the interface).")]
         public bool IgnoreDepth { get; set; } = false;
 
+        private bool _cachedRendering;
+
+        /// <summary>
+        /// Gets or sets a value indicating whether cache the world-space canvas in a texture that is drawn as a single textured quad. GUI is redrawn only when any control changes (see <see cref="Control.InvalidateDraw"/>) or at the <see cref="CachedRenderingRate"/>. Useful for many in-world screens or nameplates. Used only in <see cref="CanvasRenderMode.WorldSpace"/> or <see cref="CanvasRenderMode.WorldSpaceFaceCamera"/>.
+        /// </summary>
+        [EditorOrder(32), EditorDisplay("Canvas"), VisibleIf("Editor_IsWorldSpace"), Tooltip("If checked, the canvas will be rendered into a texture that is drawn as a single textured quad. GUI is redrawn only when any control changes or at the cached rendering rate. Useful for many in-world screens or nameplates.")]
+        public bool CachedRendering
+        {
+            get => _cachedRendering;
+            set
+            {
+                if (_cachedRendering == value)
+                    return;
+                _cachedRendering = value;
+                if (!value)
+                    _renderer?.ReleaseCachedTexture();
+            }
+        }
+
+        /// <summary>
+        /// Gets or sets the rate (updates per second) at which the cached canvas texture is redrawn even if controls didn't change (eg. for animated content). Use 0 to redraw it only on changes.
+        /// </summary>
+        [EditorOrder(33), Limit(0), EditorDisplay("Canvas"), VisibleIf("Editor_UseCachedRendering"), Tooltip("The rate (updates per second) at which the cached canvas texture is redrawn even if controls didn't change (eg. for animated content). Use 0 to redraw it only on changes.")]
+        public float CachedRenderingRate { get; set; } = 0.0f;
+
+        /// <summary>
+        /// Gets or sets the cached canvas texture resolution scale (texture pixels per canvas unit). Use lower values for small or distant canvases to reduce the memory usage.
+        /// </summary>
+        [EditorOrder(34), Limit(0.01f, 8.0f, 0.01f), EditorDisplay("Canvas"), VisibleIf("Editor_UseCachedRendering"), Tooltip("The cached canvas texture resolution scale (texture pixels per canvas unit). Use lower values for small or distant canvases to reduce the memory usage.")]
+        public float CachedRenderingScale { get; set; } = 1.0f;
+
         /// <summary>
         /// Gets or sets the camera used to place the GUI when render mode is set to <see cref="CanvasRenderMode.CameraSpace"/> or <see cref="CanvasRenderMode.WorldSpaceFaceCamera"/>.
         /// </summary>
@@ -620,6 +739,24 @@ internal string Serialize(UICanvas other)
                     jsonWriter.WriteValue(IgnoreDepth);
                 }
 
+                if (noOther || CachedRendering != other.CachedRendering)
+                {
+                    jsonWriter.WritePropertyName("CachedRendering");
+                    jsonWriter.WriteValue(CachedRendering);
+                }
+
+                if (noOther || !Mathf.NearEqual(CachedRenderingRate, other.CachedRenderingRate))
+                {
+                    jsonWriter.WritePropertyName("CachedRenderingRate");
+                    jsonWriter.WriteValue(CachedRenderingRate);
+                }
+
+                if (noOther || !Mathf.NearEqual(CachedRenderingScale, other.CachedRenderingScale))
+                {
+                    jsonWriter.WritePropertyName("CachedRenderingScale");
+                    jsonWriter.WriteValue(CachedRenderingScale);
+                }
+
                 if (noOther || RenderCamera != other.RenderCamera)
                 {
                     jsonWriter.WritePropertyName("RenderCamera");
@@ -355,8 +355,8 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, MathOp1 op)
     }
     case VariantType::Double4:
     {
-        Double4& vv = *(Double4*)v.AsBlob.Data;
-        const Double4& aa = *(const Double4*)a.AsBlob.Data;
+        Double4& vv = v.AsDouble4();
+        const Double4& aa = a.AsDouble4();
         vv.X = (double)op((float)aa.X);
         vv.Y = (double)op((float)aa.Y);
         vv.Z = (double)op((float)aa.Z);
@@ -375,8 +375,8 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, MathOp1 op)
     }
     case VariantType::Transform:
     {
-        Transform& vv = *(Transform*)v.AsBlob.Data;
-        const Transform& aa = *(const Transform*)a.AsBlob.Data;
+        Transform& vv = v.AsTransform();
+        const Transform& aa = a.AsTransform();
         vv.Translation.X = op((float)aa.Translation.X);
         vv.Translation.Y = op((float)aa.Translation.Y);
         vv.Translation.Z = op((float)aa.Translation.Z);
@@ -479,9 +479,9 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, Variant& b, MathO
     }
     case VariantType::Double4:
     {
-        Double4& vv = *(Double4*)v.AsBlob.Data;
-        const Double4& aa = *(const Double4*)a.AsBlob.Data;
-        const Double4& bb = *(const Double4*)b.AsBlob.Data;
+        Double4& vv = v.AsDouble4();
+        const Double4& aa = a.AsDouble4();
+        const Double4& bb = b.AsDouble4();
         vv.X = (double)op((float)aa.X, (float)bb.X);
         vv.Y = (double)op((float)aa.Y, (float)bb.Y);
         vv.Z = (double)op((float)aa.Z, (float)bb.Z);
@@ -501,9 +501,9 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, Variant& b, MathO
     }
     case VariantType::Transform:
     {
-        Transform& vv = *(Transform*)v.AsBlob.Data;
-        const Transform& aa = *(const Transform*)a.AsBlob.Data;
-        const Transform& bb = *(const Transform*)b.AsBlob.Data;
+        Transform& vv = v.AsTransform();
+        const Transform& aa = a.AsTransform();
+        const Transform& bb = b.AsTransform();
         vv.Translation.X = op((float)aa.Translation.X, (float)bb.Translation.X);
         vv.Translation.Y = op((float)aa.Translation.Y, (float)bb.Translation.Y);
         vv.Translation.Z = op((float)aa.Translation.Z, (float)bb.Translation.Z);
@@ -596,10 +596,10 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, Variant& b, Varia
     }
     case VariantType::Double4:
     {
-        Double4& vv = *(Double4*)v.AsBlob.Data;
-        const Double4& aa = *(const Double4*)a.AsBlob.Data;
-        const Double4& bb = *(const Double4*)b.AsBlob.Data;
-        const Double4& cc = *(const Double4*)b.AsBlob.Data;
+        Double4& vv = v.AsDouble4();
+        const Double4& aa = a.AsDouble4();
+        const Double4& bb = b.AsDouble4();
+        const Double4& cc = b.AsDouble4();
         vv.X = (double)op((float)aa.X, (float)bb.X, (float)cc.X);
         vv.Y = (double)op((float)aa.Y, (float)bb.Y, (float)cc.Y);
         vv.Z = (double)op((float)aa.Z, (float)bb.Z, (float)cc.Z);
@@ -620,10 +620,10 @@ void GraphUtilities::ApplySomeMathHere(Variant& v, Variant& a, Variant& b, Varia
     }
     case VariantType::Transform:
     {
-        Transform& vv = *(Transform*)v.AsBlob.Data;
-        const Transform& aa = *(const Transform*)a.AsBlob.Data;
-        const Transform& bb = *(const Transform*)b.AsBlob.Data;
-        const Transform& cc = *(const Transform*)c.AsBlob.Data;
+        Transform& vv = v.AsTransform();
+        const Transform& aa = a.AsTransform();
+        const Transform& bb = b.AsTransform();
+        const Transform& cc = c.AsTransform();
         vv.Translation.X = op((float)aa.Translation.X, (float)bb.Translation.X, (float)cc.Translation.X);
         vv.Translation.Y = op((float)aa.Translation.Y, (float)bb.Translation.Y, (float)cc.Translation.Y);
         vv.Translation.Z = op((float)aa.Translation.Z, (float)bb.Translation.Z, (float)cc.Translation.Z);
@@ -0,0 +1,23 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+using Flax.Build;
+
+/// <summary>
+/// Target that builds standalone, native benchmarks (engine microbenchmarks with results saved to JSON file).
+/// </summary>
+public class FlaxBenchmarksTarget : FlaxTestsTarget
+{
+    /// <inheritdoc />
+    public override void Init()
+    {
+        base.Init();
+
+        // Initialize
+        OutputName = "FlaxBenchmarks";
+        ConfigurationName = "Benchmarks";
+        GlobalDefinitions.Add("FLAX_BENCHMARKS");
+
+        Modules.Remove("Tests");
+        Modules.Add("Benchmarks");
+    }
+}
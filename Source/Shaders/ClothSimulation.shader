@@ -0,0 +1,167 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define CLOTH_THREAD_GROUP_SIZE 64
+
+// Size of the static mesh vertex streams (VB0ElementType and VB1ElementType) in bytes
+#define OUTPUT_VB0_STRIDE 12
+#define OUTPUT_VB1_STRIDE 16
+
+META_CB_BEGIN(0, Data)
+
+float3 Gravity;
+float DeltaTime;
+float3 InertiaOffset;
+float VelocityScale;
+float3 Wind;
+float AirDrag;
+uint ParticlesCount;
+uint ConstraintsOffset;
+uint ConstraintsCount;
+float MaxDistance;
+
+META_CB_END
+
+// The cloth particles rest pose (xyz: local-space position, w: max distance scale)
+ByteAddressBuffer RestParticles : register(t0);
+
+// The cloth distance constraints sorted by the independent groups (x: particle 0, y: particle 1, z: rest length, w: compliance)
+ByteAddressBuffer Constraints : register(t1);
+
+// The cloth particles adjacency (per-particle offset and count of the triangles, followed by the triangles indices)
+ByteAddressBuffer Adjacency : register(t2);
+
+// The cloth particles (xyz: local-space position, w: inverse mass) and the particles positions from the previous step
+RWByteAddressBuffer Particles : register(u0);
+RWByteAddressBuffer PrevParticles : register(u1);
+
+uint PackVector(float3 value, uint packed)
+{
+	// Keep the alpha bits (eg. bitangent sign of the tangent)
+	uint3 v = (uint3)round(saturate(value * 0.5f + 0.5f) * 1023.0f);
+	return v.x | (v.y << 10) | (v.z << 20) | (packed & 0xc0000000);
+}
+
+// Integrates the particles motion (Verlet) with the external forces
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(CLOTH_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Integrate(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ParticlesCount)
+		return;
+	float4 particle = asfloat(Particles.Load4(index * 16));
+	if (particle.w <= 0.0f)
+		return;
+	float3 prevPosition = asfloat(PrevParticles.Load3(index * 16));
+
+	// Move particles against the cloth movement to keep them in place (in world-space)
+	float3 position = particle.xyz - InertiaOffset;
+	prevPosition -= InertiaOffset;
+
+	// Apply damping, gravity and air drag (wind)
+	float3 displacement = (position - prevPosition) * VelocityScale;
+	float3 velocity = displacement / DeltaTime;
+	float3 acceleration = Gravity + (Wind - velocity) * AirDrag;
+	PrevParticles.Store3(index * 16, asuint(position));
+	Particles.Store3(index * 16, asuint(position + displacement + acceleration * (DeltaTime * DeltaTime)));
+}
+
+// Solves the group of the distance constraints (XPBD, constraints within a single group don't share particles so can be solved in parallel)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(CLOTH_THREAD_GROUP_SIZE, 1, 1)]
+void CS_SolveConstraints(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ConstraintsCount)
+		return;
+	uint4 constraint = Constraints.Load4((ConstraintsOffset + index) * 16);
+	float4 p0 = asfloat(Particles.Load4(constraint.x * 16));
+	float4 p1 = asfloat(Particles.Load4(constraint.y * 16));
+	float weightsSum = p0.w + p1.w;
+	if (weightsSum <= 0.0f)
+		return;
+	float3 delta = p1.xyz - p0.xyz;
+	float currentLength = length(delta);
+	if (currentLength < 0.0001f)
+		return;
+	float compliance = asfloat(constraint.w) / (DeltaTime * DeltaTime);
+	float deltaLambda = (asfloat(constraint.z) - currentLength) / (weightsSum + compliance);
+	float3 correction = delta * (deltaLambda / currentLength);
+	Particles.Store3(constraint.x * 16, asuint(p0.xyz - correction * p0.w));
+	Particles.Store3(constraint.y * 16, asuint(p1.xyz + correction * p1.w));
+}
+
+// Limits the particles movement to the max distance from the rest pose
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(CLOTH_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Constrain(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ParticlesCount)
+		return;
+	float4 particle = asfloat(Particles.Load4(index * 16));
+	if (particle.w <= 0.0f)
+		return;
+	float4 rest = asfloat(RestParticles.Load4(index * 16));
+	float maxDistance = MaxDistance * rest.w;
+	float3 offset = particle.xyz - rest.xyz;
+	float offsetLength = length(offset);
+	if (offsetLength > maxDistance)
+		Particles.Store3(index * 16, asuint(rest.xyz + offset * (maxDistance / offsetLength)));
+}
+
+// The output mesh vertices (static mesh vertex buffers layout)
+RWByteAddressBuffer OutputVB0 : register(u0);
+RWByteAddressBuffer OutputVB1 : register(u1);
+
+// The simulated particles (read-only for the output)
+ByteAddressBuffer SimulatedParticles : register(t3);
+
+// Writes the particles positions into the mesh vertex buffer
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(CLOTH_THREAD_GROUP_SIZE, 1, 1)]
+void CS_OutputPositions(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ParticlesCount)
+		return;
+	OutputVB0.Store3(index * OUTPUT_VB0_STRIDE, SimulatedParticles.Load3(index * 16));
+}
+
+// Calculates the mesh normals from the particles positions and writes them into the mesh vertex buffer
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(CLOTH_THREAD_GROUP_SIZE, 1, 1)]
+void CS_OutputNormals(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint index = dispatchThreadId.x;
+	if (index >= ParticlesCount)
+		return;
+
+	// Sum normals of the adjacent triangles
+	uint2 range = Adjacency.Load2(index * 8);
+	float3 normal = float3(0, 0, 0);
+	for (uint i = 0; i < range.y; i++)
+	{
+		uint3 indices = Adjacency.Load3((range.x + i * 3) * 4);
+		float3 v0 = asfloat(SimulatedParticles.Load3(indices.x * 16));
+		float3 v1 = asfloat(SimulatedParticles.Load3(indices.y * 16));
+		float3 v2 = asfloat(SimulatedParticles.Load3(indices.z * 16));
+		normal += cross(v1 - v0, v2 - v0);
+	}
+	float normalLength = length(normal);
+	if (normalLength < 0.000001f)
+		return;
+	normal /= normalLength;
+
+	// Calculate tangent (the same way as RenderTools::CalculateTangentFrame)
+	float3 c1 = cross(normal, float3(0, 0, 1));
+	float3 c2 = cross(normal, float3(0, 1, 0));
+	float3 tangent = normalize(dot(c1, c1) > dot(c2, c2) ? c1 : c2);
+
+	// Write vertex (texcoord and lightmap UVs are kept from the original mesh)
+	uint2 packed = OutputVB1.Load2(index * OUTPUT_VB1_STRIDE + 4);
+	OutputVB1.Store2(index * OUTPUT_VB1_STRIDE + 4, uint2(PackVector(normal, packed.x), PackVector(tangent, packed.y)));
+}
@@ -74,6 +74,16 @@
 #else
 #define CAN_USE_TESSELLATION 0
 #endif
+#if DIRECTX && FEATURE_LEVEL >= FEATURE_LEVEL_SM6
+#define CAN_USE_BINDLESS 1
+#else
+#define CAN_USE_BINDLESS 0
+#endif
+
+#if CAN_USE_BINDLESS
+// Declares the bindless textures table (indexed with GPUResourceView::GetBindlessIndex passed via constants). Must match DX12_ROOT_SIGNATURE_BINDLESS in C++.
+#define DECLARE_BINDLESS_TEXTURES2D(name) Texture2D name[] : register(t0, space1)
+#endif
 
 // Compiler attributes
 
@@ -0,0 +1,87 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define COMPUTE_SKINNING_THREAD_GROUP_SIZE 64
+#define COMPUTE_SKINNING_GROUPS_PER_ROW 1024
+
+// Size of the skinned mesh vertex (VB0SkinnedElementType) in bytes
+#define SKINNED_VERTEX_STRIDE 36
+
+// Size of the static mesh vertex streams (VB0ElementType and VB1ElementType) in bytes
+#define OUTPUT_VB0_STRIDE 12
+#define OUTPUT_VB1_STRIDE 16
+
+META_CB_BEGIN(0, Data)
+
+uint VerticesCount;
+uint3 Dummy0;
+
+META_CB_END
+
+// The skinned mesh vertices
+ByteAddressBuffer Vertices : register(t0);
+
+// The skeletal bones matrix buffer (stored as 4x3, 3 float4 behind each other)
+Buffer<float4> BoneMatrices : register(t1);
+
+// The output skinned vertices (static mesh vertex buffers layout)
+RWByteAddressBuffer OutputVB0 : register(u0);
+RWByteAddressBuffer OutputVB1 : register(u1);
+
+float3x4 GetBoneMatrix(uint index)
+{
+	float4 a = BoneMatrices[index * 3];
+	float4 b = BoneMatrices[index * 3 + 1];
+	float4 c = BoneMatrices[index * 3 + 2];
+	return float3x4(a, b, c);
+}
+
+float3 UnpackVector(uint packed)
+{
+	return float3(packed & 0x3ff, (packed >> 10) & 0x3ff, (packed >> 20) & 0x3ff) / 1023.0f * 2.0f - 1.0f;
+}
+
+uint PackVector(float3 value, uint packed)
+{
+	// Keep the alpha bits (eg. bitangent sign of the tangent)
+	uint3 v = (uint3)round(saturate(value * 0.5f + 0.5f) * 1023.0f);
+	return v.x | (v.y << 10) | (v.z << 20) | (packed & 0xc0000000);
+}
+
+// Skins the mesh vertices with the bones matrices (the same as skinning in the material vertex shader)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(COMPUTE_SKINNING_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Skin(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID)
+{
+	uint vertexIndex = (groupId.y * COMPUTE_SKINNING_GROUPS_PER_ROW + groupId.x) * COMPUTE_SKINNING_THREAD_GROUP_SIZE + groupThreadId.x;
+	if (vertexIndex >= VerticesCount)
+		return;
+
+	// Load vertex (position, texcoord, normal, tangent, blend indices and weights)
+	uint address = vertexIndex * SKINNED_VERTEX_STRIDE;
+	uint4 data0 = Vertices.Load4(address);
+	uint4 data1 = Vertices.Load4(address + 16);
+	uint data2 = Vertices.Load(address + 32);
+	float3 position = asfloat(data0.xyz);
+	uint4 blendIndices = uint4(data1.z & 0xff, (data1.z >> 8) & 0xff, (data1.z >> 16) & 0xff, data1.z >> 24);
+	float4 blendWeights = float4(f16tof32(data1.w), f16tof32(data1.w >> 16), f16tof32(data2), f16tof32(data2 >> 16));
+
+	// Calculate the bone matrix
+	float weightsSum = blendWeights.x + blendWeights.y + blendWeights.z + blendWeights.w;
+	float mainWeight = blendWeights.x + (1.0f - weightsSum); // Re-normalize to account for 16-bit weights encoding erros
+	float3x4 boneMatrix = mainWeight * GetBoneMatrix(blendIndices.x);
+	boneMatrix += blendWeights.y * GetBoneMatrix(blendIndices.y);
+	boneMatrix += blendWeights.z * GetBoneMatrix(blendIndices.z);
+	boneMatrix += blendWeights.w * GetBoneMatrix(blendIndices.w);
+
+	// Apply skinning
+	position = mul(boneMatrix, float4(position, 1));
+	float3 normal = normalize(mul(boneMatrix, float4(UnpackVector(data1.x), 0)));
+	float3 tangent = normalize(mul(boneMatrix, float4(UnpackVector(data1.y), 0)));
+
+	// Write vertex (texcoord is copied as-is, lightmap UVs are not used by skinned meshes)
+	OutputVB0.Store3(vertexIndex * OUTPUT_VB0_STRIDE, asuint(position));
+	OutputVB1.Store4(vertexIndex * OUTPUT_VB1_STRIDE, uint4(data0.w, PackVector(normal, data1.x), PackVector(tangent, data1.y), 0));
+}
@@ -0,0 +1,245 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/HZB.hlsl"
+
+// Those defines must match the C++
+#define FOLIAGE_CULLING_CLUSTER_SIZE 64
+#define FOLIAGE_CULLING_THREAD_GROUP_SIZE 64
+#define FOLIAGE_CULLING_GROUPS_PER_ROW 1024
+#define FOLIAGE_CULLING_MAX_LODS 8
+
+#define INVALID_SLOT 0xffffffff
+
+// Size of the indirect draw arguments (DrawIndexedInstancedIndirect) in bytes
+#define ARGS_STRIDE 20
+
+// Size of the instance data (InstanceData) in bytes
+#define INSTANCE_STRIDE 64
+
+// The leaf cluster data (positions are relative to the cache origin)
+struct FoliageCluster
+{
+	float3 BoundsMin;
+	uint InstancesStart;
+	float3 BoundsMax;
+	uint InstancesCount;
+	float3 SphereCenter;
+	float SphereRadius;
+	float MaxCullDistance;
+	uint3 Dummy0;
+};
+
+// The instance culling data (positions are relative to the cache origin)
+struct FoliageInstance
+{
+	float3 Center;
+	float Radius;
+	float CullDistance;
+	uint3 Dummy0;
+};
+
+// The draw batch (single mesh of the model LOD) data
+struct FoliageBatch
+{
+	uint IndicesCount;
+	uint StartIndex;
+	uint LOD;
+	uint Dummy0;
+};
+
+META_CB_BEGIN(0, Data)
+
+float4 FrustumPlanes[6];
+float3 LODViewPosition;
+float LODScreenMultiple;
+float LODDistanceScale;
+float ModelLODDistanceFactorSqrt;
+int ModelLODBias;
+uint LODsCount;
+float MinScreenSize;
+uint ClustersCount;
+uint InstancesCount;
+uint VisibleOffset;
+float4 LODScreenSize[FOLIAGE_CULLING_MAX_LODS / 4];
+uint CountersOffset;
+uint ArgsStart;
+uint ArgsCount;
+uint MinLOD;
+float2 HZBSize;
+uint HZBMipLevels;
+float Dummy1;
+float4x4 HZBViewProjection;
+float3 HZBOrigin;
+float Dummy2;
+
+META_CB_END
+
+StructuredBuffer<FoliageCluster> Clusters : register(t0);
+StructuredBuffer<FoliageInstance> CullingInstances : register(t1);
+ByteAddressBuffer Instances : register(t2);
+StructuredBuffer<FoliageBatch> Batches : register(t3);
+Texture2D<float> HZB : register(t4);
+
+RWByteAddressBuffer IndirectArgs : register(u0);
+RWByteAddressBuffer Counters : register(u1);
+RWByteAddressBuffer VisibleSlots : register(u2);
+RWByteAddressBuffer OutputInstances : register(u3);
+
+// Counters layout (per cull request): visible instances count per LOD, then output instances offset per LOD
+#define COUNTER_ADDRESS(lod) ((CountersOffset + (lod)) * 4)
+#define OFFSET_ADDRESS(lod) ((CountersOffset + FOLIAGE_CULLING_MAX_LODS + (lod)) * 4)
+
+#ifdef _CS_Cull
+
+bool IsOutsideFrustum(float3 center, float radius)
+{
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, center) + FrustumPlanes[i].w < -radius)
+			return true;
+	}
+	return false;
+}
+
+bool IsOutsideFrustum(float3 boundsMin, float3 boundsMax)
+{
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		// Test the box corner that is the most in front of the plane
+		float3 p = FrustumPlanes[i].xyz >= 0 ? boundsMax : boundsMin;
+		if (dot(FrustumPlanes[i].xyz, p) + FrustumPlanes[i].w < 0)
+			return true;
+	}
+	return false;
+}
+
+// Culls the instance and selects its LOD (matches RenderTools::ComputeModelLOD). Returns -1 if instance is not visible.
+int CullInstance(FoliageInstance instance)
+{
+	// Distance culling
+	float3 toView = instance.Center - LODViewPosition;
+	if (length(toView) - instance.Radius > instance.CullDistance)
+		return -1;
+
+	// Frustum culling
+	if (IsOutsideFrustum(instance.Center, instance.Radius))
+		return -1;
+
+	// Occlusion culling
+	if (HZBMipLevels != 0 && IsOccludedHZB(HZB, HZBSize, HZBMipLevels, HZBViewProjection, instance.Center - instance.Radius - HZBOrigin, instance.Center + instance.Radius - HZBOrigin))
+		return -1;
+
+	// LOD selection
+	float distSqr = dot(toView, toView) * LODDistanceScale;
+	float screenRadius = LODScreenMultiple * instance.Radius;
+	float screenRadiusSquared = screenRadius * screenRadius / max(1.0f, distSqr) * ModelLODDistanceFactorSqrt;
+	float minScreenSize = MinScreenSize * 0.5f;
+	if (minScreenSize * minScreenSize > screenRadiusSquared)
+		return -1;
+	int lod = 0;
+	for (int lodIndex = (int)LODsCount - 1; lodIndex >= 0; lodIndex--)
+	{
+		float screenSize = LODScreenSize[lodIndex >> 2][lodIndex & 3] * 0.5f;
+		if (screenSize * screenSize >= screenRadiusSquared)
+		{
+			lod = lodIndex;
+			break;
+		}
+	}
+	return clamp(lod + ModelLODBias, (int)MinLOD, (int)LODsCount - 1);
+}
+
+// Culls the leaf clusters and their instances (one thread group per cluster) and counts the visible instances per LOD
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(FOLIAGE_CULLING_CLUSTER_SIZE, 1, 1)]
+void CS_Cull(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID)
+{
+	uint clusterIndex = groupId.y * FOLIAGE_CULLING_GROUPS_PER_ROW + groupId.x;
+	if (clusterIndex >= ClustersCount)
+		return;
+	FoliageCluster cluster = Clusters[clusterIndex];
+	if (groupThreadId.x >= cluster.InstancesCount)
+		return;
+	uint instanceIndex = cluster.InstancesStart + groupThreadId.x;
+	uint visibleSlot = INVALID_SLOT;
+
+	// Cluster culling (the same for all threads in a group)
+	bool clusterVisible = distance(LODViewPosition, cluster.SphereCenter) - cluster.SphereRadius <= cluster.MaxCullDistance && !IsOutsideFrustum(cluster.BoundsMin, cluster.BoundsMax);
+	BRANCH
+	if (clusterVisible && HZBMipLevels != 0)
+		clusterVisible = !IsOccludedHZB(HZB, HZBSize, HZBMipLevels, HZBViewProjection, cluster.BoundsMin - HZBOrigin, cluster.BoundsMax - HZBOrigin);
+	BRANCH
+	if (clusterVisible)
+	{
+		int lod = CullInstance(CullingInstances[instanceIndex]);
+		if (lod >= 0)
+		{
+			uint slot;
+			Counters.InterlockedAdd(COUNTER_ADDRESS(lod), 1, slot);
+			visibleSlot = ((uint)lod << 28) | slot;
+		}
+	}
+	VisibleSlots.Store((VisibleOffset + instanceIndex) * 4, visibleSlot);
+}
+
+#endif
+
+#ifdef _CS_PrepareArgs
+
+// Allocates the ranges in the output instances buffer for all LODs and writes the indirect draw arguments of the batches
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_PrepareArgs()
+{
+	uint counts[FOLIAGE_CULLING_MAX_LODS];
+	uint offsets[FOLIAGE_CULLING_MAX_LODS];
+	uint offset = VisibleOffset;
+	for (uint lod = 0; lod < FOLIAGE_CULLING_MAX_LODS; lod++)
+	{
+		counts[lod] = Counters.Load(COUNTER_ADDRESS(lod));
+		offsets[lod] = offset;
+		Counters.Store(OFFSET_ADDRESS(lod), offset);
+		offset += counts[lod];
+	}
+
+	// Args: IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation
+	for (uint i = 0; i < ArgsCount; i++)
+	{
+		FoliageBatch batch = Batches[ArgsStart + i];
+		uint address = (ArgsStart + i) * ARGS_STRIDE;
+		IndirectArgs.Store4(address, uint4(batch.IndicesCount, counts[batch.LOD], batch.StartIndex, 0));
+		IndirectArgs.Store(address + 16, offsets[batch.LOD]);
+	}
+}
+
+#endif
+
+#ifdef _CS_WriteInstances
+
+// Writes the visible instances data for drawing (compacted per LOD)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(FOLIAGE_CULLING_THREAD_GROUP_SIZE, 1, 1)]
+void CS_WriteInstances(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID)
+{
+	uint instanceIndex = (groupId.y * FOLIAGE_CULLING_GROUPS_PER_ROW + groupId.x) * FOLIAGE_CULLING_THREAD_GROUP_SIZE + groupThreadId.x;
+	if (instanceIndex >= InstancesCount)
+		return;
+	uint visibleSlot = VisibleSlots.Load((VisibleOffset + instanceIndex) * 4);
+	if (visibleSlot == INVALID_SLOT)
+		return;
+	uint lod = visibleSlot >> 28;
+	uint slot = visibleSlot & 0x0fffffff;
+
+	// Copy InstanceData (instances are already relative to the view origin)
+	uint srcAddress = instanceIndex * INSTANCE_STRIDE;
+	uint dstAddress = (Counters.Load(OFFSET_ADDRESS(lod)) + slot) * INSTANCE_STRIDE;
+	OutputInstances.Store4(dstAddress, Instances.Load4(srcAddress));
+	OutputInstances.Store4(dstAddress + 16, Instances.Load4(srcAddress + 16));
+	OutputInstances.Store4(dstAddress + 32, Instances.Load4(srcAddress + 32));
+	OutputInstances.Store4(dstAddress + 48, Instances.Load4(srcAddress + 48));
+}
+
+#endif
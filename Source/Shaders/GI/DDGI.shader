@@ -27,7 +27,7 @@ DDGIData DDGI;
 GlobalSDFData GlobalSDF;
 GlobalSurfaceAtlasData GlobalSurfaceAtlas;
 GBufferData GBuffer;
-float Padding0;
+float ProbesUpdateRate;
 float ProbesDistanceLimit;
 float ResetBlend;
 float TemporalTime;
@@ -67,6 +67,8 @@ uint GetProbeRaysCount(DDGIData data, uint probeState)
 
 #ifdef _CS_Classify
 
+#include "./Flax/Random.hlsl"
+
 #define DDGI_PROBE_RELOCATE_ITERATIVE 0 // If true, probes relocation algorithm tries to move them in additive way, otherwise all nearby locations are checked to find the best position
 
 RWTexture2D<snorm float4> RWProbesData : register(u0);
@@ -124,6 +126,7 @@ void CS_Classify(uint3 DispatchThreadId : SV_DispatchThreadID)
     }
     else
     {
+        bool insideGeometry = false;
 #if DDGI_PROBE_RELOCATE_ITERATIVE
         if (sdf < threshold) // Probe is inside geometry
         {
@@ -178,7 +181,8 @@ void CS_Classify(uint3 DispatchThreadId : SV_DispatchThreadID)
         }
 
         // Relocate the probe to the best found location (or zero if nothing good found)
-        if (bestOffset.w <= threshold)
+        insideGeometry = bestOffset.w <= threshold;
+        if (insideGeometry)
             bestOffset.xyz = float3(0, 0, 0);
         probeOffset = bestOffset.xyz;
 #endif
@@ -199,14 +203,30 @@ void CS_Classify(uint3 DispatchThreadId : SV_DispatchThreadID)
         bool wasInactive = probeState == DDGI_PROBE_STATE_INACTIVE;
         bool wasRelocated = distance(probeOffset, probeOffsetOld) > 2.0f;
         probeState = wasInactive || wasScrolled || wasRelocated ? DDGI_PROBE_STATE_ACTIVATED : DDGI_PROBE_STATE_ACTIVE;
+
+        if (insideGeometry)
+        {
+            // Disable probe stuck inside the geometry (prevents light leaking)
+            probeOffset = float3(0, 0, 0);
+            probeState = DDGI_PROBE_STATE_INACTIVE;
+        }
+        else if (probeState == DDGI_PROBE_STATE_ACTIVE && ProbesUpdateRate < 1.0f)
+        {
+            // Put probe to sleep (keeps the last irradiance) to update it stochastically at the reduced rate (probes near the view are always updated)
+            float viewDistance = distance(probeBasePosition, DDGI.ViewPos);
+            float updateRate = viewDistance < probesSpacing * 4.0f ? 1.0f : ProbesUpdateRate;
+            float random = RandN1((float)probeIndex * 0.618034f + DDGI.RaysRotation.x * 100.0f);
+            if (random >= updateRate)
+                probeState = DDGI_PROBE_STATE_SLEEPING;
+        }
     }
 
     // Save probe state
     probeOffset /= probesSpacing; // Move offset back to [-1;1] space
     RWProbesData[probeDataCoords] = EncodeDDGIProbeData(probeOffset, probeState);
 
-    // Collect active probes
-    if (probeState != DDGI_PROBE_STATE_INACTIVE)
+    // Collect active probes (sleeping ones are skipped)
+    if (probeState == DDGI_PROBE_STATE_ACTIVATED || probeState == DDGI_PROBE_STATE_ACTIVE)
     {
         uint activeProbeIndex;
         RWActiveProbes.InterlockedAdd(0, 1, activeProbeIndex); // Counter at 0
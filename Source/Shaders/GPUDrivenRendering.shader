@@ -0,0 +1,337 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/HZB.hlsl"
+
+// Those defines must match the C++
+#define GPU_DRIVEN_THREAD_GROUP_SIZE 64
+#define GPU_DRIVEN_MAX_LODS 8
+#define GPU_DRIVEN_BATCH_MAIN 1
+#define GPU_DRIVEN_BATCH_SHADOWS 2
+#define GPU_DRIVEN_BATCH_MESHLETS 8
+
+#define INVALID_LOD 0xffffffff
+
+// Size of the indirect draw arguments (DrawIndexedInstancedIndirect) in bytes
+#define ARGS_STRIDE 20
+
+// Size of the instance data (InstanceData) in bytes
+#define INSTANCE_STRIDE 64
+
+struct GPUInstance
+{
+	float3 Origin;
+	float PerInstanceRandom;
+	float3 Transform1;
+	uint Group;
+	float3 Transform2;
+	float Radius;
+	float3 Transform3;
+	uint LayerMask;
+	float3 Center;
+	int ForcedLOD;
+	int LODBias;
+	float3 Dummy0;
+};
+
+struct GPUGroup
+{
+	float MinScreenSize;
+	uint LODsCount;
+	uint2 Dummy0;
+	float4 LODScreenSize[GPU_DRIVEN_MAX_LODS / 4];
+	uint4 LODBatchStart[GPU_DRIVEN_MAX_LODS / 4];
+	uint4 LODBatchCount[GPU_DRIVEN_MAX_LODS / 4];
+};
+
+struct GPUBatch
+{
+	uint IndicesCount;
+	uint StartIndex;
+	uint Flags;
+	uint MeshletIndicesOffset;
+};
+
+struct GPUMeshlet
+{
+	float3 Center;
+	float Radius;
+	float3 ConeAxis;
+	float ConeCutoff;
+	uint StartIndex;
+	uint TrianglesCount;
+};
+
+META_CB_BEGIN(0, Data)
+
+float4 FrustumPlanes[6];
+float3 ViewOrigin;
+uint InstancesCount;
+float3 LODViewPosition;
+float LODScreenMultiple;
+float LODDistanceScale;
+float ModelLODDistanceFactorSqrt;
+int ModelLODBias;
+uint BatchesCount;
+uint RenderLayersMask;
+uint BatchFlagsMask;
+float2 HZBSize;
+float4x4 HZBViewProjection;
+float3 HZBOrigin;
+uint HZBMipLevels;
+float3 ViewPosition;
+uint MeshletsEnabled;
+uint MeshletsOffset;
+uint MeshletsCount;
+uint MeshletBatch;
+uint MeshletInstance;
+uint MeshletConeCulling;
+float3 Dummy1;
+
+META_CB_END
+
+StructuredBuffer<GPUInstance> Instances : register(t0);
+StructuredBuffer<GPUGroup> Groups : register(t1);
+StructuredBuffer<GPUBatch> Batches : register(t2);
+Texture2D<float> HZB : register(t3);
+StructuredBuffer<GPUMeshlet> Meshlets : register(t4);
+ByteAddressBuffer MeshIndices : register(t5);
+
+RWByteAddressBuffer IndirectArgs : register(u0);
+RWByteAddressBuffer BatchCounters : register(u1);
+RWByteAddressBuffer VisibleLODs : register(u2);
+RWByteAddressBuffer OutputInstances : register(u3);
+RWByteAddressBuffer OutputIndices : register(u4);
+
+#ifdef _CS_ClearArgs
+
+// Resets the indirect draw arguments of all batches
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GPU_DRIVEN_THREAD_GROUP_SIZE, 1, 1)]
+void CS_ClearArgs(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint batchIndex = dispatchThreadId.x;
+	if (batchIndex >= BatchesCount)
+		return;
+	GPUBatch batch = Batches[batchIndex];
+
+	// Args: IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation
+	uint address = batchIndex * ARGS_STRIDE;
+	if (MeshletsEnabled && (batch.Flags & GPU_DRIVEN_BATCH_MESHLETS))
+	{
+		// Visible triangles are appended by the meshlets culling into the compacted index buffer
+		IndirectArgs.Store4(address, uint4(0, 0, batch.MeshletIndicesOffset, 0));
+	}
+	else
+	{
+		IndirectArgs.Store4(address, uint4(batch.IndicesCount, 0, batch.StartIndex, 0));
+	}
+	IndirectArgs.Store(address + 16, 0);
+	BatchCounters.Store(batchIndex * 4, 0);
+}
+
+#endif
+
+#if defined(_CS_Cull) || defined(_CS_CullMeshlets)
+
+// Checks if the sphere is occluded by the hierarchical depth buffer (from the previous frame)
+bool IsOccluded(float3 center, float radius)
+{
+	return IsOccludedHZB(HZB, HZBSize, HZBMipLevels, HZBViewProjection, center - radius - HZBOrigin, center + radius - HZBOrigin);
+}
+
+// Checks if the sphere is outside the view frustum (planes are in world-space)
+bool IsOutsideFrustum(float3 center, float radius)
+{
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		if (dot(FrustumPlanes[i].xyz, center) + FrustumPlanes[i].w < -radius)
+			return true;
+	}
+	return false;
+}
+
+#endif
+
+#ifdef _CS_Cull
+
+// Culls the instance and selects its LOD (matches RenderTools::ComputeModelLOD). Returns INVALID_LOD if instance is not visible.
+uint CullInstance(GPUInstance instance, GPUGroup group)
+{
+	// Layers culling
+	if ((instance.LayerMask & RenderLayersMask) == 0)
+		return INVALID_LOD;
+
+	// Frustum culling
+	if (IsOutsideFrustum(instance.Center, instance.Radius))
+		return INVALID_LOD;
+
+	// Occlusion culling
+	if (HZBMipLevels != 0 && IsOccluded(instance.Center, instance.Radius))
+		return INVALID_LOD;
+
+	// LOD selection
+	int lod = instance.ForcedLOD;
+	if (lod < 0)
+	{
+		float3 toView = instance.Center - LODViewPosition;
+		float distSqr = dot(toView, toView) * LODDistanceScale;
+		float screenRadius = LODScreenMultiple * instance.Radius;
+		float screenRadiusSquared = screenRadius * screenRadius / max(1.0f, distSqr) * ModelLODDistanceFactorSqrt;
+		float minScreenSize = group.MinScreenSize * 0.5f;
+		if (minScreenSize * minScreenSize > screenRadiusSquared)
+			return INVALID_LOD;
+		lod = 0;
+		for (int lodIndex = (int)group.LODsCount - 1; lodIndex >= 0; lodIndex--)
+		{
+			float screenSize = group.LODScreenSize[lodIndex >> 2][lodIndex & 3] * 0.5f;
+			if (screenSize * screenSize >= screenRadiusSquared)
+			{
+				lod = lodIndex;
+				break;
+			}
+		}
+	}
+	lod = clamp(lod + instance.LODBias + ModelLODBias, 0, (int)group.LODsCount - 1);
+	return (uint)lod;
+}
+
+// Culls the instances and counts the visible instances per batch
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GPU_DRIVEN_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Cull(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint instanceIndex = dispatchThreadId.x;
+	if (instanceIndex >= InstancesCount)
+		return;
+	GPUInstance instance = Instances[instanceIndex];
+	GPUGroup group = Groups[instance.Group];
+
+	uint lod = CullInstance(instance, group);
+	VisibleLODs.Store(instanceIndex * 4, lod);
+	if (lod == INVALID_LOD)
+		return;
+
+	uint batchStart = group.LODBatchStart[lod >> 2][lod & 3];
+	uint batchEnd = batchStart + group.LODBatchCount[lod >> 2][lod & 3];
+	for (uint batchIndex = batchStart; batchIndex < batchEnd; batchIndex++)
+	{
+		if (Batches[batchIndex].Flags & BatchFlagsMask)
+			IndirectArgs.InterlockedAdd(batchIndex * ARGS_STRIDE + 4, 1);
+	}
+}
+
+#endif
+
+#ifdef _CS_CullMeshlets
+
+// Culls the meshlets of the single-instance batch (frustum, backface cone and occlusion) and appends the triangles of the visible ones into the compacted index buffer
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GPU_DRIVEN_THREAD_GROUP_SIZE, 1, 1)]
+void CS_CullMeshlets(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint meshletIndex = dispatchThreadId.x;
+	if (meshletIndex >= MeshletsCount)
+		return;
+
+	// Skip if the instance has been culled or uses the other LOD
+	uint argsAddress = MeshletBatch * ARGS_STRIDE;
+	if (IndirectArgs.Load(argsAddress + 4) == 0)
+		return;
+	GPUMeshlet meshlet = Meshlets[MeshletsOffset + meshletIndex];
+	GPUInstance instance = Instances[MeshletInstance];
+
+	// Transform bounds into world-space
+	float3 center = instance.Origin + meshlet.Center.x * instance.Transform1 + meshlet.Center.y * instance.Transform2 + meshlet.Center.z * instance.Transform3;
+	float3 scaleSq = float3(dot(instance.Transform1, instance.Transform1), dot(instance.Transform2, instance.Transform2), dot(instance.Transform3, instance.Transform3));
+	float maxScaleSq = max(scaleSq.x, max(scaleSq.y, scaleSq.z));
+	float radius = meshlet.Radius * sqrt(maxScaleSq);
+
+	// Frustum culling
+	if (IsOutsideFrustum(center, radius))
+		return;
+
+	// Backface culling (all triangles of the meshlet are facing away from the view), skipped for non-uniformly scaled instances
+	float minScaleSq = min(scaleSq.x, min(scaleSq.y, scaleSq.z));
+	if (MeshletConeCulling && minScaleSq > maxScaleSq * 0.98f)
+	{
+		float3 coneAxis = normalize(meshlet.ConeAxis.x * instance.Transform1 + meshlet.ConeAxis.y * instance.Transform2 + meshlet.ConeAxis.z * instance.Transform3);
+		float3 viewToCenter = center - ViewPosition;
+		if (dot(viewToCenter, coneAxis) >= meshlet.ConeCutoff * length(viewToCenter) + radius)
+			return;
+	}
+
+	// Occlusion culling
+	if (HZBMipLevels != 0 && IsOccluded(center, radius))
+		return;
+
+	// Append meshlet triangles to the batch indices range
+	uint indicesCount = meshlet.TrianglesCount * 3;
+	uint offset;
+	IndirectArgs.InterlockedAdd(argsAddress, indicesCount, offset);
+	uint dstAddress = (IndirectArgs.Load(argsAddress + 8) + offset) * 4;
+	uint srcAddress = meshlet.StartIndex * 4;
+	for (uint i = 0; i < indicesCount; i++)
+		OutputIndices.Store(dstAddress + i * 4, MeshIndices.Load(srcAddress + i * 4));
+}
+
+#endif
+
+#ifdef _CS_PrepareArgs
+
+// Allocates the ranges in the output instances buffer for all batches
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_PrepareArgs()
+{
+	uint offset = 0;
+	for (uint batchIndex = 0; batchIndex < BatchesCount; batchIndex++)
+	{
+		uint address = batchIndex * ARGS_STRIDE;
+		IndirectArgs.Store(address + 16, offset);
+		offset += IndirectArgs.Load(address + 4);
+	}
+}
+
+#endif
+
+#ifdef _CS_WriteInstances
+
+// Writes the visible instances data for drawing (matches InstanceData)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GPU_DRIVEN_THREAD_GROUP_SIZE, 1, 1)]
+void CS_WriteInstances(uint3 dispatchThreadId : SV_DispatchThreadID)
+{
+	uint instanceIndex = dispatchThreadId.x;
+	if (instanceIndex >= InstancesCount)
+		return;
+	uint lod = VisibleLODs.Load(instanceIndex * 4);
+	if (lod == INVALID_LOD)
+		return;
+	GPUInstance instance = Instances[instanceIndex];
+	GPUGroup group = Groups[instance.Group];
+
+	// InstanceData: InstanceOrigin, PerInstanceRandom, InstanceTransform1, LODDitherFactor, InstanceTransform2, InstanceTransform3, InstanceLightmapArea
+	uint4 data0 = asuint(float4(instance.Origin - ViewOrigin, instance.PerInstanceRandom));
+	uint4 data1 = asuint(float4(instance.Transform1, 0.0f));
+	uint4 data2 = asuint(float4(instance.Transform2, instance.Transform3.x));
+	uint4 data3 = uint4(asuint(instance.Transform3.yz), 0, 0);
+
+	uint batchStart = group.LODBatchStart[lod >> 2][lod & 3];
+	uint batchEnd = batchStart + group.LODBatchCount[lod >> 2][lod & 3];
+	for (uint batchIndex = batchStart; batchIndex < batchEnd; batchIndex++)
+	{
+		if ((Batches[batchIndex].Flags & BatchFlagsMask) == 0)
+			continue;
+		uint slot;
+		BatchCounters.InterlockedAdd(batchIndex * 4, 1, slot);
+		uint address = (IndirectArgs.Load(batchIndex * ARGS_STRIDE + 16) + slot) * INSTANCE_STRIDE;
+		OutputInstances.Store4(address, data0);
+		OutputInstances.Store4(address + 16, data1);
+		OutputInstances.Store4(address + 32, data2);
+		OutputInstances.Store4(address + 48, data3);
+	}
+}
+
+#endif
@@ -20,6 +20,22 @@ META_CB_END
 // Particles data buffer
 ByteAddressBuffer ParticlesData : register(t0);
 
+#ifdef _CS_DispatchArgs
+
+// Output indirect dispatch arguments buffer
+RWByteAddressBuffer DispatchArgs : register(u0);
+
+// Sorting keys generation dispatch arguments shader (executed with a single thread after the particles simulation)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(1, 1, 1)]
+void CS_DispatchArgs()
+{
+	uint particlesCount = min(ParticlesData.Load(ParticleCounterOffset), ParticleCapacity);
+	DispatchArgs.Store3(12, uint3((particlesCount + 1023) / 1024, 1, 1));
+}
+
+#else
+
 // Output sorting keys buffer (index + key)
 struct Item
 {
@@ -85,3 +101,5 @@ void CS_Sort(uint3 dispatchThreadId : SV_DispatchThreadID)
 	item.Value = index;
 	SortingKeys[index] = item;
 }
+
+#endif
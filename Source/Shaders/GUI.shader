@@ -62,6 +62,31 @@ float4 PS_ImagePoint(VS2PS input) : SV_Target0
 	return Image.Sample(SamplerPointClamp, input.TexCoord) * input.Color;
 }
 
+#if CAN_USE_BINDLESS
+
+// Render2D batching with bindless textures (texture index is stored in CustomData.x)
+DECLARE_BINDLESS_TEXTURES2D(Textures);
+
+META_PS(true, FEATURE_LEVEL_SM6)
+float4 PS_ImageBindless(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	Texture2D image = Textures[NonUniformResourceIndex((uint)(input.CustomData.x + 0.5f))];
+	return image.Sample(SamplerLinearClamp, input.TexCoord) * input.Color;
+}
+
+META_PS(true, FEATURE_LEVEL_SM6)
+float4 PS_ImagePointBindless(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	Texture2D image = Textures[NonUniformResourceIndex((uint)(input.CustomData.x + 0.5f))];
+	return image.Sample(SamplerPointClamp, input.TexCoord) * input.Color;
+}
+
+#endif
+
 META_PS(true, FEATURE_LEVEL_ES2)
 float4 PS_Color(VS2PS input) : SV_Target0
 {
@@ -101,6 +126,19 @@ float4 PS_Font(VS2PS input) : SV_Target0
 	return color;
 }
 
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_FontSDF(VS2PS input) : SV_Target0
+{
+	PerformClipping(input);
+
+	// Signed distance field glyph (0.5 at the edge) with anti-aliasing based on the screen-space derivatives
+	float4 color = input.Color;
+	float distance = Image.Sample(SamplerLinearClamp, input.TexCoord).r;
+	float width = max(fwidth(distance), 0.0001f) * 0.5f;
+	color.a *= smoothstep(0.5f - width, 0.5f + width, distance);
+	return color;
+}
+
 float4 GetSample(float weight, float offset, float2 uv)
 {
 #if BLUR_V
@@ -240,6 +240,26 @@ void CS_GenerateMip(uint3 DispatchThreadId : SV_DispatchThreadID)
 
 #endif
 
+#if defined(_CS_SampleVolume)
+
+Texture3D<float> GlobalSDFTex : register(t0);
+Texture3D<float> GlobalSDFMip : register(t1);
+RWBuffer<float> VolumeDistances : register(u0);
+
+// Compute shader for sampling Global SDF into the small volume (read back by the CPU particles simulation)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE, GLOBAL_SDF_RASTERIZE_GROUP_SIZE)]
+void CS_SampleVolume(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	if (any(DispatchThreadId >= (uint)CascadeResolution))
+		return;
+	float3 worldPosition = DispatchThreadId * CascadeCoordToPosMul + CascadeCoordToPosAdd;
+	float distance = SampleGlobalSDF(GlobalSDF, GlobalSDFTex, GlobalSDFMip, worldPosition);
+	VolumeDistances[ObjectsCount + (DispatchThreadId.z * CascadeResolution + DispatchThreadId.y) * CascadeResolution + DispatchThreadId.x] = distance;
+}
+
+#endif
+
 #ifdef _PS_Debug
 
 Texture3D<float> GlobalSDFTex : register(t0);
@@ -0,0 +1,44 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#ifndef __HZB__
+#define __HZB__
+
+// Checks if the axis-aligned box is occluded by the hierarchical depth buffer that stores the farthest depth per texel (see HZBPass).
+// Bounds are relative to the origin of the view used to render the depth buffer.
+bool IsOccludedHZB(Texture2D<float> hzb, float2 hzbSize, uint hzbMipLevels, float4x4 hzbViewProjection, float3 boundsMin, float3 boundsMax)
+{
+	// Project bounds corners to the screen
+	float2 rectMin = 1.0f;
+	float2 rectMax = -1.0f;
+	float minDepth = 1.0f;
+	UNROLL
+	for (uint i = 0; i < 8; i++)
+	{
+		float3 corner = float3(i & 1 ? boundsMax.x : boundsMin.x, i & 2 ? boundsMax.y : boundsMin.y, i & 4 ? boundsMax.z : boundsMin.z);
+		float4 clip = mul(float4(corner, 1), hzbViewProjection);
+		if (clip.w <= 0.0001f)
+			return false; // Intersects with the camera near plane
+		float3 ndc = clip.xyz / clip.w;
+		rectMin = min(rectMin, ndc.xy);
+		rectMax = max(rectMax, ndc.xy);
+		minDepth = min(minDepth, ndc.z);
+	}
+	if (minDepth <= 0.0f)
+		return false;
+
+	// Convert to texels rect (flip Y to match texture space)
+	float2 uvMin = saturate(float2(rectMin.x, -rectMax.y) * 0.5f + 0.5f);
+	float2 uvMax = saturate(float2(rectMax.x, -rectMin.y) * 0.5f + 0.5f);
+	int2 texelMin = min((int2)(uvMin * hzbSize), (int2)hzbSize - 1);
+	int2 texelMax = min((int2)(uvMax * hzbSize), (int2)hzbSize - 1);
+
+	// Pick the mip that covers the rect with up to 2x2 texels and sample the farthest depth of the area
+	int2 extent = texelMax - texelMin;
+	uint mip = min((uint)ceil(log2((float)max(max(extent.x, extent.y), 1))), hzbMipLevels - 1);
+	int2 p0 = texelMin >> mip;
+	int2 p1 = texelMax >> mip;
+	float maxDepth = max(max(hzb.Load(int3(p0, mip)), hzb.Load(int3(p1.x, p0.y, mip))), max(hzb.Load(int3(p0.x, p1.y, mip)), hzb.Load(int3(p1, mip))));
+	return minDepth > maxDepth;
+}
+
+#endif
@@ -0,0 +1,32 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+META_CB_BEGIN(0, Data)
+
+float2 InputSize;
+float2 InputScale;
+
+META_CB_END
+
+Texture2D Input : register(t0);
+
+// Pixel Shader for the hierarchical depth buffer downscale (keeps the farthest depth of the covered input texels)
+META_PS(true, FEATURE_LEVEL_ES2)
+float PS_Downscale(Quad_VS2PS input) : SV_Target
+{
+	// Find the input texels range covered by the output texel (up to 3x3 when downscaling by a non-power-of-two ratio)
+	float2 outputPos = floor(input.Position.xy);
+	int2 start = (int2)floor(outputPos * InputScale);
+	int2 end = min((int2)ceil((outputPos + 1.0f) * InputScale), (int2)InputSize) - 1;
+
+	float depth = 0.0f;
+	LOOP
+	for (int y = start.y; y <= end.y; y++)
+	{
+		LOOP
+		for (int x = start.x; x <= end.x; x++)
+			depth = max(depth, Input.Load(int3(x, y, 0)).r);
+	}
+	return depth;
+}
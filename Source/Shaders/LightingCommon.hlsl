@@ -34,7 +34,7 @@ struct LightData
 
     float FalloffExponent;
     float InverseSquared;
-    float Dummy0;
+    float SeparatePass; // Non-zero if light is drawn in a separate pass (eg. with shadow or IES profile) and should be skipped by the clustered lighting
     float RadiusInv;
 };
 
@@ -20,6 +20,13 @@ META_CB_BEGIN(1, PerFrame)
 GBufferData GBuffer;
 META_CB_END
 
+// Clustered lights grid data
+META_CB_BEGIN(2, PerGrid)
+int3 LightGridSize;
+uint Dummy0;
+float4 LightGridParams;
+META_CB_END
+
 DECLARE_GBUFFERDATA_ACCESS(GBuffer)
 
 // Rendered shadow
@@ -27,6 +34,13 @@ Texture2D Shadow : register(t5);
 Texture2D IESTexture : register(t6);
 TextureCube CubeImage : register(t7);
 
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+// Clustered lights grid
+StructuredBuffer<LightData> LightGridLights : register(t8);
+Buffer<uint2> LightGridCells : register(t9);
+Buffer<uint> LightGridIndices : register(t10);
+#endif
+
 // Vertex Shader for models rendering
 META_VS(true, FEATURE_LEVEL_ES2)
 META_VS_IN_ELEMENT(POSITION, 0, R32G32B32_FLOAT, 0, 0, PER_VERTEX, 0, true)
@@ -175,3 +189,54 @@ float4 PS_Sky(Model_VS2PS input) : SV_Target0
 
 	return output;
 }
+
+#if FEATURE_LEVEL >= FEATURE_LEVEL_SM5
+
+// Pixel shader for local lights rendering using the clustered lights grid (all lights affecting the pixel in a single pass)
+META_PS(true, FEATURE_LEVEL_SM5)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=0)
+META_PERMUTATION_1(LIGHTING_NO_SPECULAR=1)
+void PS_Clustered(Quad_VS2PS input, out float4 output : SV_Target0)
+{
+	output = 0;
+
+	// Sample GBuffer
+	GBufferData gBufferData = GetGBufferData();
+	GBufferSample gBuffer = SampleGBuffer(gBufferData, input.TexCoord);
+
+	// Check if cannot light pixel
+	BRANCH
+	if (gBuffer.ShadingModel == SHADING_MODEL_UNLIT)
+	{
+		discard;
+		return;
+	}
+
+	// Find the cluster (screen tile and exponential depth slice)
+	int3 cellCoord;
+	cellCoord.xy = (int2)(input.Position.xy * LightGridParams.x);
+	cellCoord.z = (int)(log2(max(gBuffer.ViewPos.z, 0.0001f)) * LightGridParams.y + LightGridParams.z);
+	cellCoord = clamp(cellCoord, 0, LightGridSize - 1);
+	uint2 cell = LightGridCells[(cellCoord.z * LightGridSize.y + cellCoord.y) * LightGridSize.x + cellCoord.x];
+	BRANCH
+	if (cell.y == 0)
+	{
+		discard;
+		return;
+	}
+
+	// Calculate lighting from all cluster lights (lights with shadows or IES profiles are drawn separately)
+	float4 shadowMask = 1;
+	LOOP
+	for (uint cellLightIndex = 0; cellLightIndex < cell.y; cellLightIndex++)
+	{
+		const LightData light = LightGridLights[LightGridIndices[cell.x + cellLightIndex]];
+		BRANCH
+		if (light.SeparatePass > 0)
+			continue;
+		bool isSpotLight = light.SpotAngles.x > -2.0f;
+		output += GetLighting(gBufferData.ViewPos, light, gBuffer, shadowMask, true, isSpotLight);
+	}
+}
+
+#endif
@@ -37,6 +37,9 @@
 #ifndef USE_SKINNING
 #define USE_SKINNING 0
 #endif
+#ifndef USE_COMPRESSED_POSITIONS
+#define USE_COMPRESSED_POSITIONS 0
+#endif
 #ifndef USE_LIGHTMAP
 #define USE_LIGHTMAP 0
 #endif
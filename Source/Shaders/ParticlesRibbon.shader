@@ -0,0 +1,155 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define RIBBON_THREAD_GROUP_SIZE 1024
+#define RIBBON_NO_ORDER 0xffffffff
+#define RIBBON_NO_COUNTER 0xffffffff
+
+// The minimum distance between the particles to create a ribbon segment (squared)
+#define RIBBON_MIN_SEGMENT_LENGTH_SQ (0.002f * 0.002f)
+
+// Primary constant buffer
+META_CB_BEGIN(0, Data)
+uint ParticleCounterOffset;
+uint ParticlesCount;
+uint ParticleStride;
+uint ParticleCapacity;
+int PositionOffset;
+int SortKeyOffset;
+uint OrderOffset;
+uint VertexOffset;
+uint DrawArgsOffset;
+uint UseDistance;
+float2 Dummy0;
+META_CB_END
+
+// Particles data buffer
+ByteAddressBuffer ParticlesData : register(t0);
+
+// Ribbon particles order (sorted indices)
+Buffer<uint> RibbonOrder : register(t1);
+
+// Output ribbon vertices (RibbonParticleVertex layout) and the indirect draw arguments
+RWByteAddressBuffer RibbonVertices : register(u0);
+RWByteAddressBuffer RibbonDrawArgs : register(u1);
+
+groupshared float SharedDistance[RIBBON_THREAD_GROUP_SIZE];
+groupshared uint SharedSegments[RIBBON_THREAD_GROUP_SIZE];
+groupshared uint SharedSegmentCount;
+
+uint GetParticleIndex(uint orderIndex)
+{
+	return OrderOffset != RIBBON_NO_ORDER ? RibbonOrder[OrderOffset + orderIndex] : orderIndex;
+}
+
+float GetParticleFloat(uint particleIndex, int offset)
+{
+	return asfloat(ParticlesData.Load(particleIndex * ParticleStride + offset));
+}
+
+float3 GetParticleVec3(uint particleIndex, int offset)
+{
+	return asfloat(ParticlesData.Load3(particleIndex * ParticleStride + offset));
+}
+
+void WriteVertices(uint order, uint particleIndex, uint prevParticleIndex, float u)
+{
+	// 2 vertices per ribbon segment end
+	uint4 v = uint4(order, particleIndex, prevParticleIndex, asuint(u));
+	uint address = (VertexOffset + order * 2) * 16;
+	RibbonVertices.Store4(address, v);
+	RibbonVertices.Store4(address + 16, v);
+}
+
+// Ribbon geometry generation shader (executed with a single thread group that loops over all the ribbon particles)
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(RIBBON_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Ribbon(uint groupIndex : SV_GroupIndex)
+{
+	uint count = ParticleCounterOffset != RIBBON_NO_COUNTER ? min(ParticlesData.Load(ParticleCounterOffset), ParticleCapacity) : ParticlesCount;
+
+	// Count the ribbon segments (skip particles too close to the previous ones)
+	if (groupIndex == 0)
+		SharedSegmentCount = 0;
+	GroupMemoryBarrierWithGroupSync();
+	uint segments = 0;
+	for (uint i = groupIndex + 1; i < count; i += RIBBON_THREAD_GROUP_SIZE)
+	{
+		float3 delta = GetParticleVec3(GetParticleIndex(i), PositionOffset) - GetParticleVec3(GetParticleIndex(i - 1), PositionOffset);
+		if (dot(delta, delta) > RIBBON_MIN_SEGMENT_LENGTH_SQ)
+			segments++;
+	}
+	InterlockedAdd(SharedSegmentCount, segments);
+	GroupMemoryBarrierWithGroupSync();
+	uint segmentCount = SharedSegmentCount;
+
+	// Write the indirect draw arguments (2 triangles per segment)
+	if (groupIndex == 0)
+	{
+		RibbonDrawArgs.Store4(DrawArgsOffset, uint4(segmentCount * 6, 1, 0, VertexOffset));
+		RibbonDrawArgs.Store(DrawArgsOffset + 16, 0);
+	}
+	if (segmentCount == 0)
+		return;
+
+	// Texture coordinates along the ribbon are normalized and mapped to the sort key range (if not using the distance tiling)
+	float uScale = 1.0f / (float)segmentCount;
+	float uOffset = 0.0f;
+	if (SortKeyOffset != -1)
+	{
+		float firstSortKey = GetParticleFloat(GetParticleIndex(0), SortKeyOffset);
+		float lastSortKey = GetParticleFloat(GetParticleIndex(count - 1), SortKeyOffset);
+		uScale *= lastSortKey - firstSortKey;
+		uOffset = firstSortKey;
+	}
+
+	// Write the ribbon vertices (prefix sum of the segments and the ribbon length)
+	float distanceCarry = 0.0f;
+	uint segmentCarry = 0;
+	for (uint chunk = 0; chunk < count; chunk += RIBBON_THREAD_GROUP_SIZE)
+	{
+		uint orderIndex = chunk + groupIndex;
+		uint particleIndex = 0, prevParticleIndex = 0;
+		float distance = 0.0f;
+		uint isSegment = 0;
+		if (orderIndex > 0 && orderIndex < count)
+		{
+			particleIndex = GetParticleIndex(orderIndex);
+			prevParticleIndex = GetParticleIndex(orderIndex - 1);
+			float3 delta = GetParticleVec3(particleIndex, PositionOffset) - GetParticleVec3(prevParticleIndex, PositionOffset);
+			float distanceSq = dot(delta, delta);
+			if (distanceSq > RIBBON_MIN_SEGMENT_LENGTH_SQ)
+			{
+				isSegment = 1;
+				distance = sqrt(distanceSq);
+			}
+		}
+		SharedDistance[groupIndex] = distance;
+		SharedSegments[groupIndex] = isSegment;
+		GroupMemoryBarrierWithGroupSync();
+		for (uint offset = 1; offset < RIBBON_THREAD_GROUP_SIZE; offset <<= 1)
+		{
+			float prevDistance = groupIndex >= offset ? SharedDistance[groupIndex - offset] : 0.0f;
+			uint prevSegments = groupIndex >= offset ? SharedSegments[groupIndex - offset] : 0;
+			GroupMemoryBarrierWithGroupSync();
+			SharedDistance[groupIndex] += prevDistance;
+			SharedSegments[groupIndex] += prevSegments;
+			GroupMemoryBarrierWithGroupSync();
+		}
+		if (isSegment)
+		{
+			uint order = segmentCarry + SharedSegments[groupIndex];
+			float totalDistance = distanceCarry + SharedDistance[groupIndex];
+			WriteVertices(order, particleIndex, prevParticleIndex, UseDistance ? totalDistance : order * uScale + uOffset);
+
+			// Ribbon start uses the direction to the first segment end
+			if (order == 1)
+				WriteVertices(0, GetParticleIndex(0), particleIndex, UseDistance ? 0.0f : uOffset);
+		}
+		distanceCarry += SharedDistance[RIBBON_THREAD_GROUP_SIZE - 1];
+		segmentCarry += SharedSegments[RIBBON_THREAD_GROUP_SIZE - 1];
+		GroupMemoryBarrierWithGroupSync();
+	}
+}
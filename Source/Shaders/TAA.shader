@@ -13,6 +13,8 @@ float Sharpness;
 float StationaryBlending;
 float MotionBlending;
 float Dummy0;
+float2 InputSize;
+float2 JitterUV;
 GBufferData GBuffer;
 META_CB_END
 
@@ -106,3 +108,68 @@ float4 PS(Quad_VS2PS input) : SV_Target0
 	color = clamp(color, 0, HDR_CLAMP_MAX);
 	return color;
 }
+
+// Pixel Shader for Temporal Upscaling (input is at the lower resolution than output and history)
+META_PS(true, FEATURE_LEVEL_ES2)
+float4 PS_Upscale(Quad_VS2PS input) : SV_Target0
+{
+	float2 inputSizeInv = 1.0f / InputSize;
+
+	// Calculate previous frame UVs based on per-pixel velocity
+	float2 velocity = SAMPLE_RT_LINEAR(MotionVectors, input.TexCoord).xy;
+	float velocityLength = length(velocity);
+	float2 prevUV = input.TexCoord - velocity;
+
+	// Find the input pixel that contains the jittered sample closest to the output pixel
+	float2 inputPos = (input.TexCoord + JitterUV) * InputSize;
+	float2 inputPixel = floor(inputPos) + 0.5f;
+	float2 inputUV = inputPixel * inputSizeInv;
+
+	// Gather 3x3 input neighborhood around it
+	float4 neighborhoodMin = 100000;
+	float4 neighborhoodMax = -10000;
+	float4 neighborhoodSum = 0;
+	for (int x = -1; x <= 1; ++x)
+	{
+		for (int y = -1; y <= 1; ++y)
+		{
+			float4 neighbor = SAMPLE_RT(Input, inputUV + float2(x, y) * inputSizeInv);
+			neighborhoodMin = min(neighborhoodMin, neighbor);
+			neighborhoodMax = max(neighborhoodMax, neighbor);
+			neighborhoodSum += neighbor;
+		}
+	}
+	float4 neighborhoodAvg = neighborhoodSum / 9.0;
+
+	// Reconstruct the current frame color at the output pixel location
+	float4 current = SAMPLE_RT_LINEAR(Input, input.TexCoord + JitterUV);
+	current += (current - neighborhoodAvg) * Sharpness;
+
+	// Sample history by clamp it to the nearby colors range to reduce artifacts
+	float4 history = SAMPLE_RT_LINEAR(InputHistory, prevUV);
+	float lumaOffset = abs(Luminance(neighborhoodAvg.rgb) - Luminance(current.rgb));
+	float aabbMargin = lerp(4.0, 0.25, saturate(velocityLength * 100.0)) * lumaOffset;
+	history = ClipToAABB(history, neighborhoodMin - aabbMargin, neighborhoodMax + aabbMargin);
+
+	// Weight the current sample contribution by the distance of the jittered sample to the output pixel center (in input pixels)
+	float2 sampleOffset = inputPos - inputPixel;
+	float sampleWeight = exp(-2.29f * dot(sampleOffset, sampleOffset));
+
+	// Calculate history blending factor (more history is used since every frame covers only part of the output pixels)
+	float motion = saturate(velocityLength * 1000.0f);
+	float blendfactor = lerp(StationaryBlending, MotionBlending, motion);
+	blendfactor = 1.0f - (1.0f - blendfactor) * sampleWeight;
+
+	// Perform linear accumulation of the previous samples with a current one
+	float4 color = lerp(current, history, blendfactor);
+
+	// Use the current frame when sample has no valid prevous frame data
+	float miss = any(abs(prevUV * 2 - 1) >= 1.0f) ? 1 : 0;
+#if DEBUG_HISTORY_REJECTION
+	current = float4(1, 0, 0, 1);
+#endif
+	color = lerp(color, current, miss);
+
+	color = clamp(color, 0, HDR_CLAMP_MAX);
+	return color;
+}
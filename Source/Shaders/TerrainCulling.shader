@@ -0,0 +1,165 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+#include "./Flax/HZB.hlsl"
+
+// Those defines must match the C++
+#define TERRAIN_CULLING_THREAD_GROUP_SIZE 64
+#define TERRAIN_CULLING_GROUPS_PER_ROW 1024
+#define TERRAIN_CULLING_SLOTS_PER_DRAW 16
+
+#define INVALID_DRAW 0xffffffff
+
+// Size of the indirect draw arguments (DrawIndexedInstancedIndirect) in bytes
+#define ARGS_STRIDE 20
+
+// Size of the chunk instance data (TerrainCullingInstance) in bytes
+#define INSTANCE_STRIDE 48
+
+// The terrain chunk data (positions are relative to the data origin)
+struct TerrainChunk
+{
+	float3 BoundsMin;
+	uint PatchIndex;
+	float3 BoundsMax;
+	uint Dummy0;
+	float3 SphereCenter;
+	uint Dummy1;
+	int4 Neighbors;
+	float4 HeightmapUVScaleBias;
+	float2 OffsetUV;
+	float2 LocalOffset;
+};
+
+// The terrain patch data (per view)
+struct TerrainPatch
+{
+	uint MinLOD;
+	uint MaxLOD;
+	uint DrawsStart;
+	uint DrawsMinLOD;
+	uint DrawsMaxLOD;
+	uint3 Dummy0;
+};
+
+META_CB_BEGIN(0, Data)
+
+float4 FrustumPlanes[6];
+float3 LODViewPosition;
+float ChunkEdgeSizeInv;
+float LODDistribution;
+int LODBias;
+int ForcedLOD;
+uint ChunksCount;
+uint LODsOffset;
+uint DrawsStart;
+uint CullingDisabled;
+uint PatchesStart;
+float2 HZBSize;
+uint HZBMipLevels;
+float Dummy1;
+float4x4 HZBViewProjection;
+float3 HZBOrigin;
+float Dummy2;
+
+META_CB_END
+
+StructuredBuffer<TerrainChunk> Chunks : register(t0);
+StructuredBuffer<TerrainPatch> Patches : register(t1);
+Texture2D<float> HZB : register(t2);
+
+RWByteAddressBuffer IndirectArgs : register(u0);
+RWByteAddressBuffer ChunkLODs : register(u1);
+RWByteAddressBuffer OutputInstances : register(u2);
+
+uint GetChunkIndex(uint3 groupId, uint3 groupThreadId)
+{
+	return (groupId.y * TERRAIN_CULLING_GROUPS_PER_ROW + groupId.x) * TERRAIN_CULLING_THREAD_GROUP_SIZE + groupThreadId.x;
+}
+
+#ifdef _CS_LOD
+
+// Selects the LOD of every terrain chunk (matches TerrainChunk::PrepareDraw), including the chunks of the culled patches that can be neighbors of the visible ones
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(TERRAIN_CULLING_THREAD_GROUP_SIZE, 1, 1)]
+void CS_LOD(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID)
+{
+	uint chunkIndex = GetChunkIndex(groupId, groupThreadId);
+	if (chunkIndex >= ChunksCount)
+		return;
+	TerrainChunk chunk = Chunks[chunkIndex];
+	TerrainPatch patch = Patches[PatchesStart + chunk.PatchIndex];
+
+	int lod = ForcedLOD;
+	if (lod < 0)
+	{
+		float distance = length(chunk.SphereCenter - LODViewPosition);
+		lod = (int)pow(distance * ChunkEdgeSizeInv, LODDistribution) + LODBias;
+	}
+	lod = clamp(lod, (int)patch.MinLOD, (int)patch.MaxLOD);
+
+	// Drawn patches have draws only for the LODs range estimated on CPU
+	if (patch.DrawsStart != INVALID_DRAW)
+		lod = clamp(lod, (int)patch.DrawsMinLOD, (int)patch.DrawsMaxLOD);
+
+	ChunkLODs.Store((LODsOffset + chunkIndex) * 4, (uint)lod);
+}
+
+#endif
+
+#ifdef _CS_Cull
+
+bool IsOutsideFrustum(float3 boundsMin, float3 boundsMax)
+{
+	UNROLL
+	for (uint i = 0; i < 6; i++)
+	{
+		// Test the box corner that is the most in front of the plane
+		float3 p = FrustumPlanes[i].xyz >= 0 ? boundsMax : boundsMin;
+		if (dot(FrustumPlanes[i].xyz, p) + FrustumPlanes[i].w < 0)
+			return true;
+	}
+	return false;
+}
+
+// Culls the chunks of the drawn patches and writes the visible chunks instances into the draw of the patch LOD
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(TERRAIN_CULLING_THREAD_GROUP_SIZE, 1, 1)]
+void CS_Cull(uint3 groupId : SV_GroupID, uint3 groupThreadId : SV_GroupThreadID)
+{
+	uint chunkIndex = GetChunkIndex(groupId, groupThreadId);
+	if (chunkIndex >= ChunksCount)
+		return;
+	TerrainChunk chunk = Chunks[chunkIndex];
+	TerrainPatch patch = Patches[PatchesStart + chunk.PatchIndex];
+	if (patch.DrawsStart == INVALID_DRAW)
+		return;
+
+	// Frustum culling
+	if (CullingDisabled == 0 && IsOutsideFrustum(chunk.BoundsMin, chunk.BoundsMax))
+		return;
+
+	// Occlusion culling
+	if (HZBMipLevels != 0 && IsOccludedHZB(HZB, HZBSize, HZBMipLevels, HZBViewProjection, chunk.BoundsMin - HZBOrigin, chunk.BoundsMax - HZBOrigin))
+		return;
+
+	// Get LOD of this chunk and the neighbors to morph with (matches TerrainChunk::Draw)
+	uint lod = ChunkLODs.Load((LODsOffset + chunkIndex) * 4);
+	float4 neighborLOD;
+	UNROLL
+	for (uint i = 0; i < 4; i++)
+		neighborLOD[i] = (float)clamp(ChunkLODs.Load((LODsOffset + (uint)chunk.Neighbors[i]) * 4), lod, lod + 1);
+
+	// Allocate the instance slot in the draw of the patch LOD
+	uint drawIndex = DrawsStart + patch.DrawsStart + (lod - patch.DrawsMinLOD);
+	uint slot;
+	IndirectArgs.InterlockedAdd(drawIndex * ARGS_STRIDE + 4, 1, slot);
+
+	// Write instance data (TerrainCullingInstance)
+	uint address = (drawIndex * TERRAIN_CULLING_SLOTS_PER_DRAW + slot) * INSTANCE_STRIDE;
+	OutputInstances.Store4(address, asuint(chunk.HeightmapUVScaleBias));
+	OutputInstances.Store4(address + 16, asuint(neighborLOD));
+	OutputInstances.Store4(address + 32, asuint(float4(chunk.OffsetUV, chunk.LocalOffset)));
+}
+
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) 2012-2024 Wojciech Figat. All rights reserved.
+
+#include "./Flax/Common.hlsl"
+
+// Those defines must match the C++
+#define THREADGROUP_SIZE 8
+
+// The amount of samples per tile axis used to estimate the luminance contrast
+#define SAMPLES_PER_AXIS 4
+
+META_CB_BEGIN(0, Data)
+
+float2 InputSize;
+float TileSize;
+float ContrastThreshold;
+float MotionThreshold;
+float3 Dummy0;
+
+META_CB_END
+
+#ifdef _CS_ShadingRate
+
+Texture2D Input : register(t0);
+Texture2D MotionVectors : register(t1);
+
+RWTexture2D<uint> RWShadingRate : register(u0);
+
+float GetPerceptualLuminance(int2 pixel)
+{
+	// Approximate the display response of the HDR scene color (tonemapped and gamma-encoded)
+	pixel = min(pixel, (int2)InputSize - 1);
+	float luminance = Luminance(Input.Load(int3(pixel, 0)).rgb);
+	return sqrt(luminance / (1.0f + luminance));
+}
+
+uint GetShadingRateSize(float error, float threshold)
+{
+	// Returns log2 of the shading rate along the axis (0 for 1 pixel, 1 for 2 pixels, 2 for 4 pixels)
+	return error < threshold * 0.25f ? 2 : error < threshold ? 1 : 0;
+}
+
+// Compute shader for the shading rate image generation (one thread per screen tile). Estimates the error of the reduced shading rate from the pixels luminance differences (relative to the tile brightness) along each axis.
+META_CS(true, FEATURE_LEVEL_SM5)
+[numthreads(THREADGROUP_SIZE, THREADGROUP_SIZE, 1)]
+void CS_ShadingRate(uint3 DispatchThreadId : SV_DispatchThreadID)
+{
+	uint2 tile = DispatchThreadId.xy;
+	int2 tileStart = (int2)(tile * (uint)TileSize);
+	if (any(tileStart >= (int2)InputSize))
+		return;
+
+	// Sample the luminance differences between the neighbour pixels on a grid within the tile
+	int stride = max((int)TileSize / SAMPLES_PER_AXIS, 1);
+	float sum = 0.0f, errorX = 0.0f, errorY = 0.0f;
+	UNROLL
+	for (int y = 0; y < SAMPLES_PER_AXIS; y++)
+	{
+		UNROLL
+		for (int x = 0; x < SAMPLES_PER_AXIS; x++)
+		{
+			int2 pixel = tileStart + int2(x, y) * stride;
+			float luminance = GetPerceptualLuminance(pixel);
+			sum += luminance;
+			errorX += abs(GetPerceptualLuminance(pixel + int2(1, 0)) - luminance);
+			errorY += abs(GetPerceptualLuminance(pixel + int2(0, 1)) - luminance);
+		}
+	}
+	float mean = sum / (SAMPLES_PER_AXIS * SAMPLES_PER_AXIS);
+	float normalization = 1.0f / ((SAMPLES_PER_AXIS * SAMPLES_PER_AXIS) * (mean + 0.05f));
+	errorX *= normalization;
+	errorY *= normalization;
+
+	// Increase the threshold in the fast-moving areas
+	float threshold = ContrastThreshold;
+	if (MotionThreshold > 0.0f)
+	{
+		float2 uv = (tileStart + TileSize * 0.5f) / InputSize;
+		float2 motion = SAMPLE_RT_LINEAR(MotionVectors, uv).xy * InputSize;
+		threshold *= 1.0f + length(motion) / MotionThreshold;
+	}
+
+	// Pick the shading rate (4x1 and 1x4 rates are not supported)
+	uint sizeX = GetShadingRateSize(errorX, threshold);
+	uint sizeY = GetShadingRateSize(errorY, threshold);
+	if (sizeX == 2 && sizeY == 0)
+		sizeX = 1;
+	if (sizeY == 2 && sizeX == 0)
+		sizeY = 1;
+	RWShadingRate[tile] = (sizeX << 2) | sizeY;
+}
+
+#endif
@@ -198,6 +198,16 @@ struct dtCrowdAgentDebugInfo
 	dtObstacleAvoidanceDebugData* vod;
 };
 
+/// Runs the job function for all job indices [0, jobs) and returns once all of them are done.
+/// Jobs can be executed in parallel (eg. on a thread pool).
+/// @ingroup crowd
+/// @see dtCrowd::setParallelFor
+typedef void (*dtCrowdParallelFor)(void* userData, void (*job)(void* context, const int jobIndex), void* context, const int jobs);
+
+/// The minimum amount of the active agents to run the crowd update phases in parallel.
+/// @ingroup crowd
+static const int DT_CROWD_MIN_PARALLEL_AGENTS = 64;
+
 /// Provides local steering behaviors for a group of agents. 
 /// @ingroup crowd
 class dtCrowd
@@ -227,6 +237,35 @@ class dtCrowd
 
 	dtNavMeshQuery* m_navquery;
 
+	dtCrowdParallelFor m_parallelFor;
+	void* m_parallelForUserData;
+	int m_parallelJobs;
+	dtObstacleAvoidanceQuery** m_jobObstacleQueries;
+	int* m_jobVelocitySampleCounts;
+	dtCrowdAgentDebugInfo* m_debug;
+
+	typedef void (dtCrowd::*UpdatePhase)(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	struct PhaseContext
+	{
+		dtCrowd* crowd;
+		UpdatePhase phase;
+		dtCrowdAgent** agents;
+		int nagents;
+		int jobs;
+		float dt;
+	};
+	static void runPhaseJob(void* context, const int job);
+	void runPhase(UpdatePhase phase, dtCrowdAgent** agents, const int nagents, const float dt, const bool parallel);
+
+	// Per-agent update phases (job is -1 if running on a single thread).
+	void updateNeighbours(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void updateSteering(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void updateVelocityPlanning(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void updateIntegration(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void updateCollisions(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void applyCollisions(dtCrowdAgent** agents, const int nagents, const int begin, const int end, const int job, const float dt);
+	void freeParallelJobs();
+
 	void updateTopologyOptimization(dtCrowdAgent** agents, const int nagents, const float dt);
 	void updateMoveRequest(const float dt);
 	void checkPathValidity(dtCrowdAgent** agents, const int nagents, const float dt);
@@ -316,6 +355,13 @@ class dtCrowd
 	///  @param[in]		dt		The time, in seconds, to update the simulation. [Limit: > 0]
 	///  @param[out]	debug	A debug object to load with debug information. [Opt]
 	void update(const float dt, dtCrowdAgentDebugInfo* debug);
+
+	/// Sets the function used to run the per-agent update phases (neighbours, steering, velocity planning, integration and collisions) in parallel.
+	///  @param[in]		func		The parallel for function. Use null to update on a single thread.
+	///  @param[in]		userData	The user data passed to the function.
+	///  @param[in]		jobs		The amount of jobs to split the agents into (eg. amount of worker threads).
+	/// @return False if the jobs data could not be allocated.
+	bool setParallelFor(dtCrowdParallelFor func, void* userData, const int jobs);
 	
 	/// Gets the filter used by the crowd.
 	/// @return The filter used by the crowd.
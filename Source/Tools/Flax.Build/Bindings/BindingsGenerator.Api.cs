@@ -255,6 +255,48 @@ public static bool UseCustomMarshalling(BuildData buildData, StructureInfo struc
 
             return false;
         }
+
+        /// <summary>
+        /// Checks if function can use the fast-call path in scripting bindings (blittable call without GC transition). Requires the function to be marked with FastCall tag, to be not virtual (could be overriden in scripts) and to use only blittable types (no objects, strings or collections).
+        /// </summary>
+        /// <param name="buildData">The build data.</param>
+        /// <param name="functionInfo">The function information.</param>
+        /// <param name="caller">The calling type. It's parent module types and references are used to find the given API type.</param>
+        /// <returns>True if use fast-call path for the function, otherwise false.</returns>
+        public static bool UseFastCall(BuildData buildData, FunctionInfo functionInfo, ApiTypeInfo caller)
+        {
+            if (!functionInfo.IsFastCall || functionInfo.IsVirtual)
+                return false;
+            if (!IsFastCallType(buildData, functionInfo.ReturnType, caller))
+                return false;
+            foreach (var parameterInfo in functionInfo.Parameters)
+            {
+                if (!IsFastCallType(buildData, parameterInfo.Type, caller))
+                    return false;
+            }
+            return true;
+        }
+
+        private static bool IsFastCallType(BuildData buildData, TypeInfo typeInfo, ApiTypeInfo caller)
+        {
+            if (typeInfo.IsArray || typeInfo.IsBitField || typeInfo.GenericArgs != null)
+                return false;
+            if (typeInfo.Type == "void" || CSharpNativeToManagedBasicTypes.ContainsKey(typeInfo.Type))
+                return true;
+            var apiType = FindApiTypeInfo(buildData, typeInfo, caller);
+            if (apiType == null)
+                return false;
+            apiType.EnsureInited(buildData);
+            if (apiType.MarshalAs != null)
+                return IsFastCallType(buildData, apiType.MarshalAs, caller);
+            if (apiType is TypedefInfo typedefInfo && typedefInfo.IsAlias)
+                return IsFastCallType(buildData, typedefInfo.Type, caller);
+            if (apiType is LangType || apiType.IsEnum)
+                return true;
+            if (apiType is StructureInfo structureInfo && !typeInfo.IsPtr)
+                return structureInfo.IsPod && !UseCustomMarshalling(buildData, structureInfo, caller);
+            return false;
+        }
 #endif
 
         /// <summary>
@@ -615,6 +615,10 @@ private static void GenerateCSharpWrapperFunction(BuildData buildData, StringBui
             if (string.IsNullOrEmpty(functionInfo.Glue.LibraryEntryPoint))
                 throw new Exception($"Function {caller.FullNameNative}::{functionInfo.Name} has missing entry point for library import.");
             contents.AppendLine().Append(indent).Append($"[LibraryImport(\"{caller.ParentModule.Module.BinaryModuleName}\", EntryPoint = \"{functionInfo.Glue.LibraryEntryPoint}\", StringMarshalling = StringMarshalling.Custom, StringMarshallingCustomType = typeof(FlaxEngine.Interop.StringMarshaller))]");
+            if (UseFastCall(buildData, functionInfo, caller))
+                contents.AppendLine().Append(indent).Append("[SuppressGCTransition]");
+            else if (functionInfo.IsFastCall)
+                Log.Warning($"Function {caller.FullNameNative}::{functionInfo.Name} cannot use fast-call bindings (only non-virtual functions with blittable parameters and result are supported).");
             if (!string.IsNullOrEmpty(returnMarshalType))
                 contents.AppendLine().Append(indent).Append($"[return: {returnMarshalType}]");
             contents.AppendLine().Append(indent).Append("internal static partial ");
@@ -741,6 +745,12 @@ private static void GenerateCSharpWrapperFunctionCall(BuildData buildData, Strin
             var separator = false;
             if (!functionInfo.IsStatic)
             {
+#if USE_NETCORE
+                // Fast-call native code cannot throw managed exception so validate object on a managed side
+                if (UseFastCall(buildData, functionInfo, caller))
+                    contents.Append("(__unmanagedPtr != IntPtr.Zero ? __unmanagedPtr : throw new NullReferenceException())");
+                else
+#endif
                 contents.Append("__unmanagedPtr");
                 separator = true;
             }
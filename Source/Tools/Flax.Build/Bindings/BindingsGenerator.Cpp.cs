@@ -1165,7 +1165,12 @@ private static void GenerateCppWrapperFunction(BuildData buildData, StringBuilde
             if (buildData.Toolchain?.Compiler == TargetCompiler.MSVC && !useLibraryExportInPlainC)
                 contents.Append(indent).AppendLine($"MSVC_FUNC_EXPORT(\"{libraryEntryPoint}\")"); // Export generated function binding under the C# name
 #endif
+#if USE_NETCORE
+            // Fast-call functions are called without GC transition so object is validated on a managed side (see GenerateCSharpWrapperFunctionCall)
+            if (!functionInfo.IsStatic && !UseFastCall(buildData, functionInfo, caller))
+#else
             if (!functionInfo.IsStatic)
+#endif
                 contents.Append(indent).AppendLine("if (__obj == nullptr) DebugLog::ThrowNullReference();");
 
             string callBegin = indent;
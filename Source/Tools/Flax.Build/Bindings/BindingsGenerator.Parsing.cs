@@ -884,6 +884,9 @@ private static FunctionInfo ParseFunction(ref ParsingContext context)
                 case "noproxy":
                     desc.NoProxy = true;
                     break;
+                case "fastcall":
+                    desc.IsFastCall = true;
+                    break;
                 case "hidden":
                     desc.IsHidden = true;
                     break;
@@ -76,6 +76,7 @@ public struct GlueInfo
         public bool IsVirtual;
         public bool IsConst;
         public bool NoProxy;
+        public bool IsFastCall;
         public GlueInfo Glue;
 
         public override void Write(BinaryWriter writer)
@@ -86,6 +87,7 @@ public override void Write(BinaryWriter writer)
             writer.Write(IsVirtual);
             writer.Write(IsConst);
             writer.Write(NoProxy);
+            writer.Write(IsFastCall);
 
             base.Write(writer);
         }
@@ -98,6 +100,7 @@ public override void Read(BinaryReader reader)
             IsVirtual = reader.ReadBoolean();
             IsConst = reader.ReadBoolean();
             NoProxy = reader.ReadBoolean();
+            IsFastCall = reader.ReadBoolean();
 
             base.Read(reader);
         }
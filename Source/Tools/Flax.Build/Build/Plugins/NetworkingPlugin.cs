@@ -44,6 +44,7 @@ private struct MethodRPC
             public bool IsServer;
             public bool IsClient;
             public int Channel;
+            public bool LatestOnly;
             public MethodDefinition Execute;
         }
 
@@ -220,6 +221,7 @@ private void OnGenerateCppTypeInternals(Builder.BuildData buildData, ApiTypeInfo
                         channelType = "Unreliable";
                     else if (tag.IndexOf("Reliable", StringComparison.OrdinalIgnoreCase) != -1)
                         channelType = "Reliable";
+                    bool isLatestOnly = tag.IndexOf("LatestOnly", StringComparison.OrdinalIgnoreCase) != -1;
 
                     // Generated method thunk to execute RPC from network
                     {
@@ -289,6 +291,7 @@ private void OnGenerateCppTypeInternals(Builder.BuildData buildData, ApiTypeInfo
                         contents.AppendLine($"        info.Execute = {functionInfo.Name}_Execute;");
                         contents.AppendLine($"        info.Invoke = {functionInfo.Name}_Invoke;");
                         contents.AppendLine($"        info.Channel = (uint8)NetworkChannelType::{channelType};");
+                        contents.AppendLine($"        info.LatestOnly = {(isLatestOnly ? "1" : "0")};");
                         contents.AppendLine($"        info.Tag = nullptr;");
                         contents.AppendLine("        return info;");
                         contents.AppendLine("    }");
@@ -620,7 +623,7 @@ private void OnPatchDotNetAssembly(Builder.BuildData buildData, NativeCpp.BuildO
                     module.ImportReference(addSerializer);
                     var serializeFuncType = addSerializer.Parameters[1].ParameterType;
                     var serializeFuncCtor = serializeFuncType.Resolve().GetMethod(".ctor");
-                    var addRPC = networkReplicatorType.Resolve().GetMethod("AddRPC", 6);
+                    var addRPC = networkReplicatorType.Resolve().GetMethod("AddRPC", 7);
                     module.ImportReference(addRPC);
                     var executeRPCFuncType = addRPC.Parameters[2].ParameterType;
                     var executeRPCFuncCtor = executeRPCFuncType.Resolve().GetMethod(".ctor");
@@ -640,7 +643,7 @@ private void OnPatchDotNetAssembly(Builder.BuildData buildData, NativeCpp.BuildO
 
                     foreach (var e in context.MethodRPCs)
                     {
-                        // NetworkReplicator.AddRPC(typeof(<type>), "<name>", <name>_Execute, <isServer>, <isClient>, <channel>);
+                        // NetworkReplicator.AddRPC(typeof(<type>), "<name>", <name>_Execute, <isServer>, <isClient>, <channel>, <latestOnly>);
                         il.Emit(OpCodes.Ldtoken, e.Type);
                         il.Emit(OpCodes.Call, module.ImportReference(getTypeFromHandle));
                         il.Emit(OpCodes.Ldstr, e.Method.Name);
@@ -650,6 +653,7 @@ private void OnPatchDotNetAssembly(Builder.BuildData buildData, NativeCpp.BuildO
                         il.Emit(OpCodes.Ldc_I4, e.IsServer ? 1 : 0);
                         il.Emit(OpCodes.Ldc_I4, e.IsClient ? 1 : 0);
                         il.Emit(OpCodes.Ldc_I4, e.Channel);
+                        il.Emit(OpCodes.Ldc_I4, e.LatestOnly ? 1 : 0);
                         il.Emit(OpCodes.Call, module.ImportReference(addRPC));
                     }
 
@@ -1631,6 +1635,7 @@ private static void GenerateDotNetRPCBody(ref DotnetContext context, TypeDefinit
             methodRPC.IsServer = (bool)attribute.GetFieldValue("Server", methodRPC.IsServer);
             methodRPC.IsClient = (bool)attribute.GetFieldValue("Client", methodRPC.IsClient);
             methodRPC.Channel = (int)attribute.GetFieldValue("Channel", methodRPC.Channel);
+            methodRPC.LatestOnly = (bool)attribute.GetFieldValue("LatestOnly", false);
             if (methodRPC.IsServer && methodRPC.IsClient)
             {
                 MonoCecil.CompilationError($"Network RPC {method.Name} in {type.FullName} cannot be both Server and Client.", method);
@@ -276,6 +276,12 @@ public static partial class EngineConfiguration
         [CommandLine("useDotNet", "1 to enable .NET support in build, 0 to enable Mono support in build")]
         public static bool UseDotNet = true;
 
+        /// <summary>
+        /// 1 to use the thread-caching memory allocator for the engine allocations (USE_THREAD_CACHE_ALLOCATOR=1), otherwise the default CRT allocator is used.
+        /// </summary>
+        [CommandLine("useThreadCacheAllocator", "1 to use the thread-caching memory allocator for the engine allocations (USE_THREAD_CACHE_ALLOCATOR=1)")]
+        public static bool UseThreadCacheAllocator = false;
+
         public static bool WithCSharp(NativeCpp.BuildOptions options)
         {
             return UseCSharp || options.Target.IsEditor;
@@ -291,5 +297,10 @@ public static bool WithDotNet(NativeCpp.BuildOptions options)
         {
             return UseDotNet;
         }
+
+        public static bool WithThreadCacheAllocator(NativeCpp.BuildOptions options)
+        {
+            return UseThreadCacheAllocator;
+        }
     }
 }